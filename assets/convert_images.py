@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+"""
+Converts the PNG images in assets/images into LVGL 9 image descriptors (main/adapters/view/images/*.c).
+
+Images are stored as RGB565A8 and RLE compressed (LV_USE_RLE); LVGL decompresses them once into the image cache.
+Only the standard library is used, so the step runs wherever the simulator builds.
+With --check nothing is written: the script fails if a descriptor is missing or differs from what its PNG produces.
+
+Usage: convert_images.py [--no-compress] [--check] <output dir> <png> [<png> ...]
+"""
+import sys
+import struct
+import zlib
+from pathlib import Path
+
+
+COMPRESS_NONE = 0
+COMPRESS_RLE = 1
+
+RLE_MAX_RUN = 0x7F
+BYTES_PER_LINE = 32
+
+
+def read_png(path):
+    """Returns (width, height, rows of RGBA tuples) for non-interlaced 8 bit PNG files."""
+    data = Path(path).read_bytes()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG file")
+
+    offset = 8
+    idat = b""
+    palette = []
+    transparency = b""
+    while offset < len(data):
+        (length, tag) = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+
+        if tag == b"IHDR":
+            (width, height, depth, color_type, _, _,
+             interlace) = struct.unpack(">IIBBBBB", chunk)
+            if depth != 8 or interlace != 0:
+                raise ValueError(
+                    f"{path}: only 8 bit, non interlaced images are supported")
+        elif tag == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif tag == b"tRNS":
+            transparency = chunk
+        elif tag == b"IDAT":
+            idat += chunk
+        elif tag == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+
+    rows = []
+    previous = bytearray(stride)
+    position = 0
+    for _ in range(height):
+        filter_type = raw[position]
+        line = bytearray(raw[position + 1:position + 1 + stride])
+        position += 1 + stride
+
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = previous[i]
+            up_left = previous[i - channels] if i >= channels else 0
+            if filter_type == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif filter_type == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif filter_type == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif filter_type == 4:
+                p = left + up - up_left
+                (pa, pb, pc) = (abs(p - left), abs(p - up), abs(p - up_left))
+                predictor = left if pa <= pb and pa <= pc else (
+                    up if pb <= pc else up_left)
+                line[i] = (line[i] + predictor) & 0xFF
+
+        pixels = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color_type == 6:
+                pixels.append(tuple(px))
+            elif color_type == 2:
+                pixels.append((px[0], px[1], px[2], 0xFF))
+            elif color_type == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            elif color_type == 0:
+                pixels.append((px[0], px[0], px[0], 0xFF))
+            else:
+                index = px[0]
+                alpha = transparency[index] if index < len(
+                    transparency) else 0xFF
+                pixels.append(palette[index] + (alpha,))
+        rows.append(pixels)
+        previous = line
+
+    return (width, height, rows)
+
+
+def to_rgb565a8(rows):
+    """RGB565 plane (little endian) followed by the A8 plane, as LV_COLOR_FORMAT_RGB565A8 expects."""
+    colors = bytearray()
+    alpha = bytearray()
+    for row in rows:
+        for (r, g, b, a) in row:
+            colors += struct.pack("<H", ((r >> 3) << 11)
+                                  | ((g >> 2) << 5) | (b >> 3))
+            alpha.append(a)
+    return bytes(colors + alpha)
+
+
+def rle_compress(data, block_size):
+    """Same encoding as lv_rle_decompress: a control byte with the MSB set is followed by (ctrl & 0x7F) literal
+    blocks, otherwise the next block is repeated ctrl times."""
+    blocks = [data[i:i + block_size] for i in range(0, len(data), block_size)]
+    output = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:RLE_MAX_RUN]
+            del literals[:RLE_MAX_RUN]
+            output.append(0x80 | len(chunk))
+            for block in chunk:
+                output.extend(block)
+
+    i = 0
+    while i < len(blocks):
+        run = 1
+        while i + run < len(blocks) and run < RLE_MAX_RUN and blocks[i + run] == blocks[i]:
+            run += 1
+
+        if run > 1:
+            flush_literals()
+            output.append(run)
+            output.extend(blocks[i])
+        else:
+            literals.append(blocks[i])
+        i += run
+
+    flush_literals()
+    return bytes(output)
+
+
+def render_c_file(name, width, height, data, compress):
+    flags = "0"
+    stride = width * 2
+
+    if compress == COMPRESS_RLE:
+        # The RLE blocks are one RGB565 pixel wide; the A8 plane of an odd number of pixels needs padding
+        if len(data) % 2:
+            data += b"\x00"
+        compressed = rle_compress(data, 2)
+        data = struct.pack("<III", COMPRESS_RLE,
+                           len(compressed), len(data)) + compressed
+        flags = "LV_IMAGE_FLAGS_COMPRESSED"
+
+    attribute = f"LV_ATTRIBUTE_IMAGE_{name.upper()}"
+    lines = []
+    for i in range(0, len(data), BYTES_PER_LINE):
+        lines.append(
+            "  " + ", ".join(f"0x{byte:02x}" for byte in data[i:i + BYTES_PER_LINE]) + ",")
+    content = "\n".join(lines)
+
+    return f"""/* Generated by assets/convert_images.py from assets/images/{name}.png, do not edit */
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attribute}
+#define {attribute}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t {name}_map[] = {{
+{content}
+}};
+
+const lv_image_dsc_t {name} = {{
+  .header.cf = LV_COLOR_FORMAT_RGB565A8,
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = {flags},
+  .header.w = {width},
+  .header.h = {height},
+  .header.stride = {stride},
+  .data_size = sizeof({name}_map),
+  .data = {name}_map,
+}};
+"""
+
+
+def main(argv):
+    compress = COMPRESS_RLE
+    check = False
+    while argv and argv[0].startswith("--"):
+        if argv[0] == "--no-compress":
+            compress = COMPRESS_NONE
+        elif argv[0] == "--check":
+            check = True
+        else:
+            print(__doc__)
+            return 1
+        argv = argv[1:]
+
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+
+    output_dir = argv[0]
+    stale = 0
+    for png in argv[1:]:
+        name = Path(png).stem
+        (width, height, rows) = read_png(png)
+        content = render_c_file(name, width, height,
+                                to_rgb565a8(rows), compress)
+        path = Path(output_dir, f"{name}.c")
+
+        if not check:
+            path.write_text(content)
+        elif not path.exists() or path.read_text() != content:
+            print(f"{path} is out of date with {png}")
+            stale += 1
+
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -117,11 +117,27 @@ typedef struct {
 } pman_event_t;
 
 
+/**
+ * @brief What happens to the LVGL objects of a page when it leaves view
+ *
+ */
+typedef enum {
+    PMAN_RETENTION_NONE = 0,     // The page builds its objects in `open` and deletes them in `close`
+    PMAN_RETENTION_CACHED,       // The page gets its own screen, which is hidden instead of deleted
+} pman_retention_t;
+
+
 typedef struct {
     int   id;
     void *state;
     void *extra;
 
+    // Retention policy. Retained pages must not delete their objects in `close`; the page manager owns their screen
+    // and keeps it (along with the page state) after the page is popped, up to PMAN_CACHE_DEPTH pages and
+    // PMAN_CACHE_BUDGET_OBJECTS objects. The next push of the same page reuses them instead of calling `create` and
+    // `open`.
+    pman_retention_t retention;
+
     // Called when the page is first created; it initializes and returns the state structures used by the page
     void *(*create)(pman_handle_t handle, void *extra);
     // Called when the page definitively exits the scenes; should free all used memory
@@ -131,6 +147,9 @@ typedef struct {
     void (*open)(pman_handle_t handle, void *state);
     // Called when the page exits view
     void (*close)(void *state);
+    // Called instead of `open` when the screen of a retained page is shown again, with the (possibly new) extra
+    // argument; should refresh the displayed data. If missing the screen is cleaned and `open` is called again
+    void (*resume)(pman_handle_t handle, void *state, void *extra);
 
     // Called to process an event
     pman_msg_t (*process_event)(pman_handle_t handle, void *state, pman_event_t event);
@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <string.h>
 #include "page_manager_timer.h"
 #include "page_manager.h"
 #include "page.h"
@@ -16,13 +17,22 @@ static void clear_page_stack(pman_t *pman);
 static void wait_release(pman_t *pman);
 static void reset_page(pman_t *pman);
 static void page_subscription_cb(pman_t *pman, pman_event_t event);
-static void open_page(pman_handle_t handle, pman_page_t *page);
+static void create_page(pman_t *pman, pman_page_t *page, void *extra);
+static void open_page(pman_t *pman, pman_page_t *page);
 static void close_page(pman_t *pman, pman_page_t *page);
-static void destroy_page(pman_page_t *page);
+static void destroy_page(pman_t *pman, pman_page_t *page);
 #ifndef PMAN_EXCLUDE_LVGL
-static void free_user_data_callback(lv_event_t *event);
-static void event_callback(lv_event_t *event);
-static void timer_callback(lv_timer_t *timer);
+static void                free_user_data_callback(lv_event_t *event);
+static void                event_callback(lv_event_t *event);
+static void                timer_callback(lv_timer_t *timer);
+static void                delegated_event_callback(lv_event_t *event);
+static pman_cached_page_t *cache_find_in_stack(pman_t *pman, pman_page_t *page);
+static pman_cached_page_t *cache_find_idle(pman_t *pman, pman_page_t *page);
+static pman_cached_page_t *cache_get_free(pman_t *pman);
+static pman_cached_page_t *cache_get_oldest_idle(pman_t *pman);
+static void                cache_evict(pman_cached_page_t *cached);
+static void                cache_enforce_limits(pman_t *pman);
+static uint32_t            count_objects(lv_obj_t *obj);
 
 #if LVGL_VERSION_MAJOR >= 9
 #define lv_mem_free  lv_free
@@ -49,6 +59,9 @@ void pman_init(pman_t *pman, void *user_data,
                uint8_t (*event_global_cb)(void *handle, pman_event_t event)) {
 #ifndef PMAN_EXCLUDE_LVGL
     pman->touch_indev = indev;
+    pman->screen           = lv_screen_active();
+    pman->delegated_events = 0;
+    memset(&pman->cache, 0, sizeof(pman->cache));
 #endif
     pman->user_data       = user_data;
     pman->user_msg_cb     = user_msg_cb;
@@ -78,20 +91,15 @@ void pman_swap_page_extra(pman_t *pman, pman_page_t newpage, void *extra) {
     assert(current != NULL);
 
     close_page(pman, current);
-    destroy_page(current);
+    destroy_page(pman, current);
 
     pman_page_stack_pop(&pman->page_stack, NULL);
 
     current = pman_page_stack_push(&pman->page_stack, &newpage);
     assert(current != NULL);
 
-    current->extra = extra;
     // Create the newpage
-    if (current->create) {
-        current->state = current->create(pman, current->extra);
-    } else {
-        current->state = NULL;
-    }
+    create_page(pman, current, extra);
 
     open_page(pman, current);
     reset_page(pman);
@@ -146,7 +154,7 @@ void pman_reset_to_page_id(pman_t *pman, int id, uint8_t *found) {
             reset_page(pman);
             break;
         } else {
-            destroy_page(current);
+            destroy_page(pman, current);
         }
 
         pman_page_stack_pop(&pman->page_stack, NULL);
@@ -182,13 +190,8 @@ void pman_rebase_page_extra(pman_t *pman, pman_page_t newpage, void *extra) {
     current = pman_page_stack_push(&pman->page_stack, &newpage);
     assert(current != NULL);
 
-    current->extra = extra;
     // Create the newpage
-    if (current->create) {
-        current->state = current->create(pman, current->extra);
-    } else {
-        current->state = NULL;
-    }
+    create_page(pman, current, extra);
 
     // Open the page
     open_page(pman, current);
@@ -225,14 +228,8 @@ void pman_change_page_extra(pman_t *pman, pman_page_t newpage, void *extra) {
     current = pman_page_stack_push(&pman->page_stack, &newpage);
     assert(current != NULL);
 
-    current->extra = extra;
-
     // Create the newpage
-    if (current->create) {
-        current->state = current->create(pman, extra);
-    } else {
-        current->state = NULL;
-    }
+    create_page(pman, current, extra);
 
     // Open the page
     open_page(pman, current);
@@ -257,7 +254,7 @@ void pman_back(pman_t *pman) {
 
     if (pman_page_stack_pop(&pman->page_stack, &page) == 0) {
         close_page(pman, &page);
-        destroy_page(&page);
+        destroy_page(pman, &page);
 
         pman_page_t *current = pman_page_stack_top(&pman->page_stack);
         assert(current != NULL);
@@ -328,6 +325,8 @@ void *pman_process_page_event(pman_t *pman, pman_event_t event) {
 #ifndef PMAN_EXCLUDE_LVGL
 void pman_unregister_obj_event(lv_obj_t *obj) {
     lv_obj_remove_event_cb(obj, event_callback);
+    lv_obj_remove_event_cb(obj, delegated_event_callback);
+    lv_obj_remove_flag(obj, PMAN_OBJ_FLAG_DELEGATED);
 }
 
 
@@ -336,6 +335,46 @@ void pman_register_obj_event(pman_handle_t handle, lv_obj_t *obj, lv_event_code_
 }
 
 
+/**
+ * @brief Selects which event codes are forwarded to the page for objects registered with
+ * `pman_register_obj_delegated`
+ *
+ * @param pman
+ * @param codes mask of `PMAN_EVENT_CODE_BIT`
+ */
+void pman_set_delegated_events(pman_t *pman, uint64_t codes) {
+    pman->delegated_events = codes;
+}
+
+
+/**
+ * @brief Registers an object with a single callback for all its events, which forwards to the current page only the
+ * codes selected with `pman_set_delegated_events`.
+ * The bubbling of the object and of its ancestors is left untouched, so that their widgets behave as usual.
+ *
+ * @param handle
+ * @param obj
+ */
+void pman_register_obj_delegated(pman_handle_t handle, lv_obj_t *obj) {
+    if (!lv_obj_has_flag(obj, PMAN_OBJ_FLAG_DELEGATED)) {
+        lv_obj_add_flag(obj, PMAN_OBJ_FLAG_DELEGATED);
+        lv_obj_add_event_cb(obj, delegated_event_callback, LV_EVENT_ALL, handle);
+    }
+}
+
+
+/**
+ * @brief Returns the registered object an LVGL event is addressed to, whether it was registered with
+ * `pman_register_obj_event` or `pman_register_obj_delegated`
+ *
+ * @param event
+ * @return lv_obj_t*
+ */
+lv_obj_t *pman_event_get_target_obj(pman_event_t event) {
+    return lv_event_get_current_target_obj(event.as.lvgl);
+}
+
+
 void pman_set_obj_self_destruct(lv_obj_t *obj) {
     lv_obj_remove_event_cb(obj, free_user_data_callback);
     lv_obj_add_event_cb(obj, free_user_data_callback, LV_EVENT_DELETE, NULL);
@@ -459,7 +498,7 @@ static void clear_page_stack(pman_t *pman) {
     pman_page_t page;
 
     while (pman_page_stack_pop(&pman->page_stack, &page) == 0) {
-        destroy_page(&page);
+        destroy_page(pman, &page);
     }
 }
 
@@ -531,6 +570,28 @@ static void event_callback(lv_event_t *event) {
 }
 
 
+/**
+ * @brief Handler installed on delegated objects
+ *
+ * @param event
+ */
+static void delegated_event_callback(lv_event_t *event) {
+    pman_t         *pman = lv_event_get_user_data(event);
+    lv_event_code_t code = lv_event_get_code(event);
+
+    if (code >= 64 || (pman->delegated_events & PMAN_EVENT_CODE_BIT(code)) == 0) {
+        return;
+    }
+
+    pman_event_t pman_event = {
+        .tag = PMAN_EVENT_TAG_LVGL,
+        .as  = {.lvgl = event},
+    };
+
+    page_subscription_cb(pman, pman_event);
+}
+
+
 /**
  * @brief LVGL timers callback
  *
@@ -550,11 +611,70 @@ static void timer_callback(lv_timer_t *timer) {
 
 
 /**
- * @brief Destroys a page
+ * @brief Creates the state of a page that was just pushed on the stack. Retained pages reuse an idle cached instance if
+ * there is one
  *
+ * @param pman
  * @param page
+ * @param extra
  */
-static void destroy_page(pman_page_t *page) {
+static void create_page(pman_t *pman, pman_page_t *page, void *extra) {
+    page->extra = extra;
+
+#ifndef PMAN_EXCLUDE_LVGL
+    if (page->retention == PMAN_RETENTION_CACHED) {
+        pman_cached_page_t *cached = cache_find_idle(pman, page);
+        if (cached != NULL) {
+            cached->status     = PMAN_CACHED_PAGE_IN_STACK;
+            cached->page.extra = extra;
+            page->state        = cached->page.state;
+            return;
+        }
+    }
+#endif
+
+    if (page->create) {
+        page->state = page->create(pman, extra);
+    } else {
+        page->state = NULL;
+    }
+
+#ifndef PMAN_EXCLUDE_LVGL
+    if (page->retention == PMAN_RETENTION_CACHED) {
+        // Cached instances are identified by their state
+        assert(page->state != NULL);
+
+        pman_cached_page_t *cached = cache_get_free(pman);
+        cached->status             = PMAN_CACHED_PAGE_IN_STACK;
+        cached->page               = *page;
+        cached->screen             = NULL;
+        cached->num_objects        = 0;
+        cached->last_used          = ++pman->cache.clock;
+    }
+#endif
+}
+
+
+/**
+ * @brief Destroys a page. Retained pages that were already shown are kept in the cache instead
+ *
+ * @param pman
+ * @param page
+ */
+static void destroy_page(pman_t *pman, pman_page_t *page) {
+#ifndef PMAN_EXCLUDE_LVGL
+    pman_cached_page_t *cached = cache_find_in_stack(pman, page);
+    if (cached != NULL) {
+        if (cached->screen != NULL) {
+            cached->status    = PMAN_CACHED_PAGE_IDLE;
+            cached->last_used = ++pman->cache.clock;
+            return;
+        } else {
+            cached->status = PMAN_CACHED_PAGE_FREE;
+        }
+    }
+#endif
+
     if (page->destroy) {
         page->destroy(page->state, page->extra);
     }
@@ -562,14 +682,49 @@ static void destroy_page(pman_page_t *page) {
 
 
 /**
- * @brief Opens a page
+ * @brief Opens a page. Retained pages are drawn on their own screen, which is built only the first time
  *
- * @param handle
+ * @param pman
  * @param page
  */
-static void open_page(pman_handle_t handle, pman_page_t *page) {
+static void open_page(pman_t *pman, pman_page_t *page) {
+#ifndef PMAN_EXCLUDE_LVGL
+    pman_cached_page_t *cached = cache_find_in_stack(pman, page);
+
+    if (cached != NULL) {
+        cached->last_used = ++pman->cache.clock;
+
+        if (cached->screen == NULL) {
+            cached->screen = lv_obj_create(NULL);
+            lv_screen_load(cached->screen);
+        } else {
+            lv_screen_load(cached->screen);
+
+            if (page->resume) {
+                page->resume(pman, page->state, page->extra);
+                cache_enforce_limits(pman);
+                return;
+            } else {
+                lv_obj_clean(cached->screen);
+            }
+        }
+
+        if (page->open) {
+            page->open(pman, page->state);
+        }
+
+        cached->num_objects = count_objects(cached->screen);
+        cache_enforce_limits(pman);
+        return;
+    }
+
+    if (pman->screen != NULL && lv_screen_active() != pman->screen) {
+        lv_screen_load(pman->screen);
+    }
+#endif
+
     if (page->open) {
-        page->open(handle, page->state);
+        page->open(pman, page->state);
     }
 }
 
@@ -588,3 +743,162 @@ static void close_page(pman_t *pman, pman_page_t *page) {
         page->close(page->state);
     }
 }
+
+
+#ifndef PMAN_EXCLUDE_LVGL
+/**
+ * @brief Finds the cache entry of a retained page that is currently in the stack
+ *
+ * @param pman
+ * @param page
+ * @return pman_cached_page_t* NULL if the page is not retained
+ */
+static pman_cached_page_t *cache_find_in_stack(pman_t *pman, pman_page_t *page) {
+    if (page->retention != PMAN_RETENTION_CACHED) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < sizeof(pman->cache.items) / sizeof(pman->cache.items[0]); i++) {
+        pman_cached_page_t *cached = &pman->cache.items[i];
+        if (cached->status == PMAN_CACHED_PAGE_IN_STACK && cached->page.state == page->state) {
+            return cached;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Finds a cached instance of the same page that is not in the stack anymore
+ *
+ * @param pman
+ * @param page
+ * @return pman_cached_page_t*
+ */
+static pman_cached_page_t *cache_find_idle(pman_t *pman, pman_page_t *page) {
+    for (size_t i = 0; i < sizeof(pman->cache.items) / sizeof(pman->cache.items[0]); i++) {
+        pman_cached_page_t *cached = &pman->cache.items[i];
+        if (cached->status == PMAN_CACHED_PAGE_IDLE && cached->page.id == page->id &&
+            cached->page.process_event == page->process_event) {
+            return cached;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Returns an unused cache entry, evicting the least recently used idle page if needed
+ *
+ * @param pman
+ * @return pman_cached_page_t*
+ */
+static pman_cached_page_t *cache_get_free(pman_t *pman) {
+    for (size_t i = 0; i < sizeof(pman->cache.items) / sizeof(pman->cache.items[0]); i++) {
+        if (pman->cache.items[i].status == PMAN_CACHED_PAGE_FREE) {
+            return &pman->cache.items[i];
+        }
+    }
+
+    // There is always room for the whole stack, so at least one page must be idle
+    pman_cached_page_t *oldest = cache_get_oldest_idle(pman);
+    assert(oldest != NULL);
+    cache_evict(oldest);
+
+    return oldest;
+}
+
+
+/**
+ * @brief Returns the least recently used idle page that can be evicted (i.e. whose screen is not being displayed)
+ *
+ * @param pman
+ * @return pman_cached_page_t*
+ */
+static pman_cached_page_t *cache_get_oldest_idle(pman_t *pman) {
+    pman_cached_page_t *oldest = NULL;
+
+    for (size_t i = 0; i < sizeof(pman->cache.items) / sizeof(pman->cache.items[0]); i++) {
+        pman_cached_page_t *cached = &pman->cache.items[i];
+        if (cached->status == PMAN_CACHED_PAGE_IDLE && cached->screen != lv_screen_active() &&
+            (oldest == NULL || cached->last_used < oldest->last_used)) {
+            oldest = cached;
+        }
+    }
+
+    return oldest;
+}
+
+
+/**
+ * @brief Deletes the screen and the state of an idle page
+ *
+ * @param cached
+ */
+static void cache_evict(pman_cached_page_t *cached) {
+    assert(cached->status == PMAN_CACHED_PAGE_IDLE);
+
+    if (cached->screen != NULL) {
+        // The eviction may happen while handling an event of the same screen
+        lv_obj_delete_async(cached->screen);
+    }
+    if (cached->page.destroy) {
+        cached->page.destroy(cached->page.state, cached->page.extra);
+    }
+
+    memset(cached, 0, sizeof(*cached));
+}
+
+
+/**
+ * @brief Evicts idle pages until both the number of cached pages and the object budget are respected. Pages in the
+ * stack are never evicted, so the budget may still be exceeded by them
+ *
+ * @param pman
+ */
+static void cache_enforce_limits(pman_t *pman) {
+    for (;;) {
+        uint32_t num_idle    = 0;
+        uint32_t num_objects = 0;
+
+        for (size_t i = 0; i < sizeof(pman->cache.items) / sizeof(pman->cache.items[0]); i++) {
+            pman_cached_page_t *cached = &pman->cache.items[i];
+            if (cached->status != PMAN_CACHED_PAGE_FREE) {
+                num_objects += cached->num_objects;
+            }
+            if (cached->status == PMAN_CACHED_PAGE_IDLE) {
+                num_idle++;
+            }
+        }
+
+        if (num_idle <= PMAN_CACHE_DEPTH && num_objects <= PMAN_CACHE_BUDGET_OBJECTS) {
+            break;
+        }
+
+        pman_cached_page_t *oldest = cache_get_oldest_idle(pman);
+        if (oldest == NULL) {
+            break;
+        }
+        cache_evict(oldest);
+    }
+}
+
+
+/**
+ * @brief Counts an object and all of its descendants
+ *
+ * @param obj
+ * @return uint32_t
+ */
+static uint32_t count_objects(lv_obj_t *obj) {
+    uint32_t count = 1;
+
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        count += count_objects(lv_obj_get_child(obj, i));
+    }
+
+    return count;
+}
+#endif
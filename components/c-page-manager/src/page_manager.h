@@ -10,11 +10,35 @@
 
 
 #define PMAN_REGISTER_TIMER_ID(handle, period, id) pman_timer_create(handle, period, ((void *)(uintptr_t)id))
+#define PMAN_EVENT_CODE_BIT(code)                  (((uint64_t)1) << (code))
 
 
 typedef void (*pman_user_msg_cb_t)(pman_handle_t, void *);
 
 
+#ifndef PMAN_EXCLUDE_LVGL
+typedef enum {
+    PMAN_CACHED_PAGE_FREE = 0,
+    PMAN_CACHED_PAGE_IN_STACK,
+    PMAN_CACHED_PAGE_IDLE,
+} pman_cached_page_status_t;
+
+
+/**
+ * @brief Retained page instance
+ *
+ */
+typedef struct {
+    pman_cached_page_status_t status;
+    // Copy of the page, used to identify it and to destroy it on eviction
+    pman_page_t page;
+    lv_obj_t   *screen;
+    uint32_t    num_objects;
+    uint32_t    last_used;
+} pman_cached_page_t;
+#endif
+
+
 /**
  * @brief Page manager structure
  *
@@ -26,6 +50,18 @@ typedef struct {
 #ifndef PMAN_EXCLUDE_LVGL
     // Reference to the touch input device; used to reset the touch state when changing page
     lv_indev_t *touch_indev;
+
+    // Screen shared by all pages that are not retained
+    lv_obj_t *screen;
+
+    // Event codes forwarded for delegated objects
+    uint64_t delegated_events;
+
+    // Retained pages; every page in the stack must fit, plus the idle ones
+    struct {
+        pman_cached_page_t items[PMAN_PAGE_STACK_DEPTH + PMAN_CACHE_DEPTH];
+        uint32_t           clock;
+    } cache;
 #endif
 
     // Callback to process user messages (i.e. system commands)
@@ -63,10 +99,13 @@ void   *pman_get_user_data(pman_handle_t handle);
 uint8_t pman_is_current_page_id(pman_t *pman, int id);
 int     pman_get_current_page_id(pman_t *pman);
 #ifndef PMAN_EXCLUDE_LVGL
-void pman_register_obj_event(pman_handle_t handle, lv_obj_t *obj, lv_event_code_t event);
-void pman_unregister_obj_event(lv_obj_t *obj);
-void pman_set_obj_self_destruct(lv_obj_t *obj);
-void pman_register_obj_id_and_number(pman_handle_t handle, lv_obj_t *obj, int id, int number);
+void      pman_register_obj_event(pman_handle_t handle, lv_obj_t *obj, lv_event_code_t event);
+void      pman_unregister_obj_event(lv_obj_t *obj);
+void      pman_set_delegated_events(pman_t *pman, uint64_t codes);
+void      pman_register_obj_delegated(pman_handle_t handle, lv_obj_t *obj);
+lv_obj_t *pman_event_get_target_obj(pman_event_t event);
+void      pman_set_obj_self_destruct(lv_obj_t *obj);
+void      pman_register_obj_id_and_number(pman_handle_t handle, lv_obj_t *obj, int id, int number);
 
 void         *pman_timer_get_user_data(pman_timer_t *timer);
 pman_timer_t *pman_timer_create(pman_handle_t handle, uint32_t period, void *user_data);
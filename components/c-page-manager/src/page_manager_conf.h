@@ -6,5 +6,20 @@
 #define PMAN_PAGE_STACK_DEPTH 16
 #endif
 
+// Maximum number of retained pages kept alive after leaving the stack
+#ifndef PMAN_CACHE_DEPTH
+#define PMAN_CACHE_DEPTH 4
+#endif
+
+// Maximum number of LVGL objects owned by retained pages, both in the stack and cached
+#ifndef PMAN_CACHE_BUDGET_OBJECTS
+#define PMAN_CACHE_BUDGET_OBJECTS 2048
+#endif
+
+// Object flag reserved for delegated events (see `pman_register_obj_delegated`)
+#ifndef PMAN_OBJ_FLAG_DELEGATED
+#define PMAN_OBJ_FLAG_DELEGATED LV_OBJ_FLAG_USER_1
+#endif
+
 
 #endif
@@ -0,0 +1,216 @@
+/*
+ * c-watcher benchmark: measures the cost of `watcher_watch` as the number of entries, the size of the watched regions
+ * and the fraction of regions that change between calls grow.
+ * Build and run with `scons bench`.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "watcher.h"
+
+
+#define MAX_ENTRIES     10000
+#define MAX_REGION_SIZE 64
+#define TARGET_NS       (200UL * 1000UL * 1000UL)     // Time spent on each configuration
+
+
+typedef enum {
+    MODE_DYNAMIC = 0,
+    MODE_STATIC,
+    MODE_NOTIFIED,
+} bench_mode_t;
+
+
+static void           callback(void *old_value, const void *new_value, watcher_size_t size, void *user_ptr, void *arg);
+static void           restart_callback(void *old_value, const void *new_value, watcher_size_t size, void *user_ptr,
+                                       void *arg);
+static void          *counting_realloc(void *pointer, size_t size);
+static void           counting_free(void *pointer);
+static unsigned long  now_ns(void);
+static void           run_case(bench_mode_t mode, size_t num_entries, size_t region_size, unsigned change_permille);
+static void           run_restart_case(size_t num_entries);
+static const char    *mode_to_string(bench_mode_t mode);
+
+
+static uint8_t memory[MAX_ENTRIES][MAX_REGION_SIZE];
+static int16_t indexes[MAX_ENTRIES];
+
+static struct {
+    unsigned long allocations;
+    unsigned long frees;
+    unsigned long callbacks;
+} counters = {0};
+
+
+int main(void) {
+    const size_t   entries[]      = {10, 100, 1000, MAX_ENTRIES};
+    const size_t   sizes[]        = {1, 4, 16, MAX_REGION_SIZE};
+    const unsigned change_rates[] = {0, 10, 100, 1000};     // Per mille of the entries changed before each call
+
+    printf("%-9s %7s %5s %9s %12s %8s %8s\n", "mode", "entries", "size", "changed", "ns/watch", "allocs", "frees");
+
+    for (size_t m = MODE_DYNAMIC; m <= MODE_NOTIFIED; m++) {
+        for (size_t e = 0; e < sizeof(entries) / sizeof(entries[0]); e++) {
+            for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+                for (size_t c = 0; c < sizeof(change_rates) / sizeof(change_rates[0]); c++) {
+                    run_case(m, entries[e], sizes[s], change_rates[c]);
+                }
+            }
+        }
+    }
+
+    printf("\nRestart on change (a callback adds an entry)\n");
+    printf("%7s %12s\n", "entries", "ns/watch");
+    for (size_t e = 0; e < sizeof(entries) / sizeof(entries[0]); e++) {
+        run_restart_case(entries[e]);
+    }
+
+    return 0;
+}
+
+
+static void run_case(bench_mode_t mode, size_t num_entries, size_t region_size, unsigned change_permille) {
+    static watcher_entry_t     static_entries[MAX_ENTRIES];
+    static watcher_callback_t  static_callbacks[1];
+    static void               *static_args[1];
+    static unsigned long       static_delays[1];
+    static watcher_debouncer_t static_debouncers[1];
+    static uint8_t             static_old_buffers[MAX_ENTRIES][MAX_REGION_SIZE];
+
+    memset(memory, 0, sizeof(memory));
+    memset(&counters, 0, sizeof(counters));
+
+    watcher_t watcher;
+    if (mode == MODE_STATIC) {
+        watcher_init_static(&watcher, static_entries, MAX_ENTRIES, static_callbacks, 1, static_args, 1, static_delays,
+                            1, static_debouncers, 1, NULL);
+    } else {
+        watcher_init(&watcher, NULL, counting_realloc, counting_free);
+    }
+
+    for (size_t i = 0; i < num_entries; i++) {
+        switch (mode) {
+            case MODE_DYNAMIC:
+                indexes[i] = watcher_add_entry(&watcher, memory[i], region_size, callback, NULL);
+                break;
+            case MODE_STATIC:
+                indexes[i] = watcher_add_entry_static(&watcher, memory[i], region_size, callback, NULL,
+                                                      static_old_buffers[i]);
+                break;
+            case MODE_NOTIFIED:
+                indexes[i] = watcher_add_entry_notified(&watcher, memory[i], region_size, callback, NULL);
+                break;
+        }
+    }
+    unsigned long setup_allocations = counters.allocations;
+
+    size_t        num_changed = (num_entries * change_permille) / 1000;
+    size_t        stride      = num_changed > 0 ? num_entries / num_changed : 0;
+    unsigned long iterations  = 0;
+    unsigned long elapsed     = 0;
+    unsigned long start       = now_ns();
+
+    while (elapsed < TARGET_NS) {
+        for (size_t i = 0; i < num_changed; i++) {
+            size_t index = i * stride;
+            memory[index][region_size - 1]++;
+            if (mode == MODE_NOTIFIED) {
+                watcher_set_dirty(&watcher, indexes[index]);
+            }
+        }
+
+        watcher_watch(&watcher, iterations);
+        iterations++;
+        elapsed = now_ns() - start;
+    }
+
+    watcher_destroy(&watcher);
+
+    printf("%-9s %7zu %5zu %4u/1000 %12.1f %8lu %8lu\n", mode_to_string(mode), num_entries, region_size, change_permille,
+           (double)elapsed / iterations, setup_allocations, counters.frees);
+}
+
+
+static void run_restart_case(size_t num_entries) {
+    memset(memory, 0, sizeof(memory));
+
+    watcher_t watcher;
+    watcher_init(&watcher, &watcher, counting_realloc, counting_free);
+
+    for (size_t i = 0; i < num_entries; i++) {
+        watcher_add_entry(&watcher, memory[i], sizeof(uint32_t), callback, NULL);
+    }
+    // The last entry adds another one every time it changes, forcing the scan to restart
+    watcher_add_entry(&watcher, memory[num_entries - 1], sizeof(uint32_t), restart_callback, &memory[0]);
+
+    unsigned long iterations = 0;
+    unsigned long start      = now_ns();
+    // Bounded by the maximum number of entries
+    while (iterations < 1000 && watcher.entries.num < C_WATCHER_MAX_ENTRIES - 1) {
+        memory[num_entries - 1][0]++;
+        watcher_watch(&watcher, iterations);
+        iterations++;
+    }
+    unsigned long elapsed = now_ns() - start;
+
+    printf("%7zu %12.1f\n", num_entries, (double)elapsed / iterations);
+
+    watcher_destroy(&watcher);
+}
+
+
+static void callback(void *old_value, const void *new_value, watcher_size_t size, void *user_ptr, void *arg) {
+    (void)old_value;
+    (void)new_value;
+    (void)size;
+    (void)user_ptr;
+    (void)arg;
+    counters.callbacks++;
+}
+
+
+static void restart_callback(void *old_value, const void *new_value, watcher_size_t size, void *user_ptr,
+                             void *arg) {
+    (void)old_value;
+    (void)new_value;
+    (void)size;
+    counters.callbacks++;
+    watcher_add_entry(user_ptr, arg, sizeof(uint32_t), callback, NULL);
+}
+
+
+static void *counting_realloc(void *pointer, size_t size) {
+    counters.allocations++;
+    return realloc(pointer, size);
+}
+
+
+static void counting_free(void *pointer) {
+    if (pointer != NULL) {
+        counters.frees++;
+    }
+    free(pointer);
+}
+
+
+static unsigned long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)ts.tv_sec * 1000000000UL + (unsigned long)ts.tv_nsec;
+}
+
+
+static const char *mode_to_string(bench_mode_t mode) {
+    switch (mode) {
+        case MODE_DYNAMIC:
+            return "dynamic";
+        case MODE_STATIC:
+            return "static";
+        case MODE_NOTIFIED:
+            return "notified";
+    }
+    return "";
+}
@@ -17,12 +17,17 @@
         name.capacity = cap;                                                                                           \
     }
 
+// Geometric growth, clamped to the maximum number of entries
 #define VECTOR_GROW(name)                                                                                              \
     {                                                                                                                  \
-        void *new_entries = watcher->fn_realloc(name.items, (name.capacity + 1) * sizeof(name.items[0]));              \
+        size_t new_capacity = name.capacity == 0 ? VECTOR_INITIAL_CAPACITY : (size_t)name.capacity * 2;                \
+        if (new_capacity > C_WATCHER_MAX_ENTRIES) {                                                                    \
+            new_capacity = C_WATCHER_MAX_ENTRIES;                                                                      \
+        }                                                                                                              \
+        void *new_entries = watcher->fn_realloc(name.items, new_capacity * sizeof(name.items[0]));                     \
         if (new_entries != NULL) {                                                                                     \
-            name.items = new_entries;                                                                                  \
-            name.capacity++;                                                                                           \
+            name.items    = new_entries;                                                                               \
+            name.capacity = new_capacity;                                                                              \
         } else {                                                                                                       \
             return WATCHER_RESULT_ALLOC_ERROR;                                                                         \
         }                                                                                                              \
@@ -45,10 +50,22 @@
         }                                                                                                              \
     }
 
-#define VECTOR_FULL(name)               (name.num == name.capacity)
-#define VECTOR_AT_MAX_CAPACITY(name)    (name.capacity == C_WATCHER_MAX_ENTRIES)
-#define FITS_IN_POINTER(size)           ((size) < sizeof(void *))
-#define ENTRY_GET_OLD_BUFFER_POINTER(e) (FITS_IN_POINTER((e).size) ? &(e).old_buffer : (e).old_buffer)
+#define VECTOR_FULL(name)            (name.num == name.capacity)
+#define VECTOR_AT_MAX_CAPACITY(name) (name.capacity == C_WATCHER_MAX_ENTRIES)
+#define VECTOR_INITIAL_CAPACITY      4
+#define FITS_IN_POINTER(size)        ((size) < sizeof(void *))
+#define ENTRY_GET_OLD_BUFFER_POINTER(e)                                                                                \
+    (FITS_IN_POINTER((e).size)            ? (void *)&(e).old_buffer                                                    \
+     : ((e).flags & ENTRY_FLAG_IN_SHADOW) ? (void *)&watcher->shadow.items[(uintptr_t)(e).old_buffer]                  \
+                                          : (e).old_buffer)
+
+#define SHADOW_ALIGNMENT         sizeof(uintptr_t)
+#define SHADOW_INITIAL_CAPACITY  64
+#define SHADOW_ALIGN(size)       (((size) + SHADOW_ALIGNMENT - 1) & ~(SHADOW_ALIGNMENT - 1))
+
+#define ENTRY_FLAG_NOTIFIED  0x01     // Only checked when marked as dirty
+#define ENTRY_FLAG_DIRTY     0x02     // Currently in the dirty list
+#define ENTRY_FLAG_IN_SHADOW 0x04     // old_buffer is an offset in the shadow arena
 
 
 typedef enum {
@@ -61,7 +78,12 @@ typedef enum {
 static watcher_result_t add_callback(watcher_t *watcher, watcher_callback_t callback, watcher_size_t *callback_index);
 static watcher_result_t add_arg(watcher_t *watcher, void *arg, watcher_size_t *arg_index);
 static watcher_result_t add_entry_static(watcher_t *watcher, const void *pointer, watcher_size_t size,
-                                         watcher_callback_t callback, void *arg, void *old_buffer, unsigned long delay);
+                                         watcher_callback_t callback, void *arg, void *old_buffer, unsigned long delay,
+                                         uint8_t flags);
+static void             clear_dirty_list(watcher_t *watcher);
+static watcher_result_t add_entry_dynamic(watcher_t *watcher, const void *pointer, watcher_size_t size,
+                                          watcher_callback_t callback, void *arg, unsigned long delay, uint8_t flags);
+static inline uint8_t   region_changed(const void *watched, const void *old_buffer, size_t size);
 static void debouncer_callback(void *old_value, const void *new_value, watcher_size_t size, void *user_ptr, void *arg);
 static uint8_t is_debounced(watcher_t *watcher, watcher_size_t entry_index);
 static void    trigger_debouncer_entry(watcher_t *watcher, watcher_size_t entry_index, watcher_debouncer_t *pdebouncer);
@@ -81,8 +103,13 @@ watcher_result_t watcher_init(watcher_t *watcher, void *user_ptr, void *(*fn_rea
     VECTOR_INIT(watcher->args);
     VECTOR_INIT(watcher->delays);
     VECTOR_INIT(watcher->debouncers);
+    VECTOR_INIT(watcher->shadow);
 
-    watcher->user_ptr = user_ptr;
+    watcher->user_ptr   = user_ptr;
+    watcher->dirty_head = WATCHER_NO_ENTRY;
+    watcher->dirty_tail = WATCHER_NO_ENTRY;
+    watcher->num_polled = 0;
+    watcher->changed    = 0;
 
     return WATCHER_RESULT_OK;
 }
@@ -97,10 +124,15 @@ void watcher_init_static(watcher_t *watcher, watcher_entry_t *entries, watcher_s
     VECTOR_INIT_STATIC(watcher->args, args, args_capacity);
     VECTOR_INIT_STATIC(watcher->delays, delays, delays_capacity);
     VECTOR_INIT_STATIC(watcher->debouncers, debouncers, debouncers_capacity);
+    VECTOR_INIT(watcher->shadow);
 
     watcher->user_ptr   = user_ptr;
     watcher->fn_realloc = NULL;
     watcher->fn_free    = NULL;
+    watcher->dirty_head = WATCHER_NO_ENTRY;
+    watcher->dirty_tail = WATCHER_NO_ENTRY;
+    watcher->num_polled = 0;
+    watcher->changed    = 0;
 }
 
 
@@ -111,45 +143,68 @@ void watcher_destroy(watcher_t *watcher) {
         watcher->fn_free(watcher->args.items);
         watcher->fn_free(watcher->delays.items);
         watcher->fn_free(watcher->debouncers.items);
+        watcher->fn_free(watcher->shadow.items);
     }
 
-    watcher->changed = 1;
+    watcher->dirty_head = WATCHER_NO_ENTRY;
+    watcher->dirty_tail = WATCHER_NO_ENTRY;
+    watcher->num_polled = 0;
+    watcher->changed    = 1;
 }
 
 
 watcher_result_t watcher_add_entry(watcher_t *watcher, const void *pointer, watcher_size_t size,
                                    watcher_callback_t callback, void *arg) {
-    void *old_buffer = NULL;
-    if (FITS_IN_POINTER(size)) {
-        // If the watched region fits in a pointer we can use the old_buffer field itself
-    } else {
-        old_buffer = watcher->fn_realloc(NULL, size);
-        if (old_buffer == NULL) {
-            return WATCHER_RESULT_ALLOC_ERROR;
-        }
-    }
-    return add_entry_static(watcher, pointer, size, callback, arg, old_buffer, 0);
+    return add_entry_dynamic(watcher, pointer, size, callback, arg, 0, 0);
 }
 
+
+watcher_result_t watcher_add_entry_notified(watcher_t *watcher, const void *pointer, watcher_size_t size,
+                                            watcher_callback_t callback, void *arg) {
+    return add_entry_dynamic(watcher, pointer, size, callback, arg, 0, ENTRY_FLAG_NOTIFIED);
+}
+
+
 watcher_result_t watcher_add_entry_delayed(watcher_t *watcher, const void *pointer, watcher_size_t size,
                                            watcher_callback_t callback, void *arg, unsigned long delay) {
-    void *old_buffer = NULL;
-    if (FITS_IN_POINTER(size)) {
-        // If the watched region fits in a pointer we can use the old_buffer field itself
-    } else {
-        old_buffer = watcher->fn_realloc(NULL, size);
-        if (old_buffer == NULL) {
-            return WATCHER_RESULT_ALLOC_ERROR;
-        }
-    }
-    return watcher_add_entry_delayed_static(watcher, pointer, size, callback, arg, delay, old_buffer);
+    return add_entry_dynamic(watcher, pointer, size, callback, arg, delay, 0);
+}
+
+
+watcher_result_t watcher_add_entry_static(watcher_t *watcher, const void *pointer, watcher_size_t size,
+                                          watcher_callback_t callback, void *arg, void *old_buffer) {
+    return add_entry_static(watcher, pointer, size, callback, arg, old_buffer, 0, 0);
 }
 
 
 watcher_result_t watcher_add_entry_delayed_static(watcher_t *watcher, const void *pointer, watcher_size_t size,
                                                   watcher_callback_t callback, void *arg, unsigned long delay,
                                                   void *old_buffer) {
-    return add_entry_static(watcher, pointer, size, callback, arg, old_buffer, delay);
+    return add_entry_static(watcher, pointer, size, callback, arg, old_buffer, delay, 0);
+}
+
+
+void watcher_set_dirty(watcher_t *watcher, int16_t entry_index) {
+    // Invalid index
+    if (entry_index >= watcher->entries.num || entry_index < 0) {
+        return;
+    }
+
+    watcher_entry_t *entry = &watcher->entries.items[entry_index];
+    if (entry->flags & ENTRY_FLAG_DIRTY) {
+        // Already queued
+        return;
+    }
+
+    entry->flags |= ENTRY_FLAG_DIRTY;
+    entry->next_dirty = WATCHER_NO_ENTRY;
+
+    if (watcher->dirty_tail == WATCHER_NO_ENTRY) {
+        watcher->dirty_head = entry_index;
+    } else {
+        watcher->entries.items[watcher->dirty_tail].next_dirty = entry_index;
+    }
+    watcher->dirty_tail = entry_index;
 }
 
 
@@ -160,12 +215,34 @@ watcher_size_t watcher_watch(watcher_t *watcher, unsigned long timestamp) {
     do {
         watcher->changed = 0;
 
-        for (i = 0; i < watcher->entries.num; i++) {
-            watcher_entry_t *pentry             = &watcher->entries.items[i];
-            void            *old_buffer         = ENTRY_GET_OLD_BUFFER_POINTER(*pentry);
-            uint8_t          is_entry_debounced = is_debounced(watcher, i);
+        // Entries explicitly marked by the writers; indexes are stable, so there is no need to restart here
+        while (watcher->dirty_head != WATCHER_NO_ENTRY) {
+            i = watcher->dirty_head;
+
+            watcher_entry_t *pentry = &watcher->entries.items[i];
+            watcher->dirty_head     = pentry->next_dirty;
+            if (watcher->dirty_head == WATCHER_NO_ENTRY) {
+                watcher->dirty_tail = WATCHER_NO_ENTRY;
+            }
+            pentry->flags &= ~ENTRY_FLAG_DIRTY;
+
+            watcher_trigger_entry(watcher, i);
+            if (!is_debounced(watcher, i)) {
+                count++;
+            }
+        }
+
+        // Legacy entries, compared against their old value
+        for (i = 0; i < watcher->entries.num && watcher->num_polled > 0; i++) {
+            watcher_entry_t *pentry = &watcher->entries.items[i];
+            if (pentry->flags & ENTRY_FLAG_NOTIFIED) {
+                continue;
+            }
+
+            void   *old_buffer         = ENTRY_GET_OLD_BUFFER_POINTER(*pentry);
+            uint8_t is_entry_debounced = is_debounced(watcher, i);
 
-            if (memcmp(pentry->watched, old_buffer, pentry->size)) {
+            if (region_changed(pentry->watched, old_buffer, pentry->size)) {
                 // Immediate logic
                 watcher_trigger_entry(watcher, i);
 
@@ -246,6 +323,7 @@ void watcher_reset_all(watcher_t *watcher) {
         void            *old_buffer = ENTRY_GET_OLD_BUFFER_POINTER(*entry);
         memcpy(old_buffer, entry->watched, entry->size);
     }
+    clear_dirty_list(watcher);
 
     for (i = 0; i < watcher->debouncers.num; i++) {
         watcher_debouncer_t *pdebouncer = &watcher->debouncers.items[i];
@@ -298,8 +376,8 @@ static watcher_result_t add_arg(watcher_t *watcher, void *arg, watcher_size_t *a
 
 
 static watcher_result_t add_entry_static(watcher_t *watcher, const void *pointer, watcher_size_t size,
-                                         watcher_callback_t callback, void *arg, void *old_buffer,
-                                         unsigned long delay) {
+                                         watcher_callback_t callback, void *arg, void *old_buffer, unsigned long delay,
+                                         uint8_t flags) {
     GROW_OR_FAIL(entries);
 
     watcher_size_t   callback_index = 0;
@@ -319,6 +397,8 @@ static watcher_result_t add_entry_static(watcher_t *watcher, const void *pointer
         .size           = size,
         .callback_index = callback_index,
         .arg_index      = arg_index,
+        .next_dirty     = WATCHER_NO_ENTRY,
+        .flags          = flags,
     };
     // If the watched region fits in a pointer just use the corresponding field
     old_buffer = ENTRY_GET_OLD_BUFFER_POINTER(entry);
@@ -330,6 +410,9 @@ static watcher_result_t add_entry_static(watcher_t *watcher, const void *pointer
     GROW_OR_FAIL(entries);
     int16_t entry_index = watcher->entries.num;
     VECTOR_APPEND(watcher->entries, entry);
+    if ((flags & ENTRY_FLAG_NOTIFIED) == 0) {
+        watcher->num_polled++;
+    }
 
     if (delay > 0) {
         watcher_entry_t *pentry = &watcher->entries.items[entry_index];
@@ -427,3 +510,107 @@ static void trigger_debouncer_entry(watcher_t *watcher, watcher_size_t entry_ind
                                                          arg);
     pdebouncer->triggered = TRIGGER_STATE_INACTIVE;
 }
+
+
+static void clear_dirty_list(watcher_t *watcher) {
+    while (watcher->dirty_head != WATCHER_NO_ENTRY) {
+        watcher_entry_t *pentry = &watcher->entries.items[watcher->dirty_head];
+        watcher->dirty_head     = pentry->next_dirty;
+        pentry->flags &= ~ENTRY_FLAG_DIRTY;
+    }
+    watcher->dirty_tail = WATCHER_NO_ENTRY;
+}
+
+
+static watcher_result_t add_entry_dynamic(watcher_t *watcher, const void *pointer, watcher_size_t size,
+                                          watcher_callback_t callback, void *arg, unsigned long delay, uint8_t flags) {
+    if (FITS_IN_POINTER(size)) {
+        // If the watched region fits in a pointer we can use the old_buffer field itself
+        return add_entry_static(watcher, pointer, size, callback, arg, NULL, delay, flags);
+    } else if (watcher->fn_realloc == NULL) {
+        return WATCHER_RESULT_STATIC_OVERFLOW;
+    }
+
+    // Reserve a slice of the shadow arena; the entry keeps its offset, as the arena may move when it grows
+    size_t offset   = watcher->shadow.num;
+    size_t required = offset + SHADOW_ALIGN(size);
+    if (required > watcher->shadow.capacity) {
+        size_t new_capacity = watcher->shadow.capacity == 0 ? SHADOW_INITIAL_CAPACITY : watcher->shadow.capacity;
+        while (new_capacity < required) {
+            new_capacity *= 2;
+        }
+
+        uint8_t *new_items = watcher->fn_realloc(watcher->shadow.items, new_capacity);
+        if (new_items == NULL) {
+            return WATCHER_RESULT_ALLOC_ERROR;
+        }
+        watcher->shadow.items    = new_items;
+        watcher->shadow.capacity = new_capacity;
+    }
+    watcher->shadow.num = required;
+
+    watcher_size_t   num_entries = watcher->entries.num;
+    watcher_result_t result      = add_entry_static(watcher, pointer, size, callback, arg, (void *)(uintptr_t)offset,
+                                                    delay, flags | ENTRY_FLAG_IN_SHADOW);
+    if (watcher->entries.num == num_entries) {
+        // The entry was not added, give back the slice
+        watcher->shadow.num = offset;
+    }
+    return result;
+}
+
+
+/*
+ * Comparison kernel. Most watched fields are a handful of bytes, for which a call to memcmp costs more than the
+ * comparison itself; larger regions are compared one machine word at a time.
+ * The loads go through memcpy so that unaligned sources are handled, the compiler turns them into plain loads.
+ */
+static inline uint8_t region_changed(const void *watched, const void *old_buffer, size_t size) {
+    const uint8_t *a = watched;
+    const uint8_t *b = old_buffer;
+
+    switch (size) {
+        case 1:
+            return *a != *b;
+
+        case 2: {
+            uint16_t x, y;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            return x != y;
+        }
+
+        case 4: {
+            uint32_t x, y;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            return x != y;
+        }
+
+        case 8: {
+            uint64_t x, y;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            return x != y;
+        }
+
+        default: {
+            size_t i = 0;
+
+            for (; i + sizeof(uintptr_t) <= size; i += sizeof(uintptr_t)) {
+                uintptr_t x, y;
+                memcpy(&x, &a[i], sizeof(x));
+                memcpy(&y, &b[i], sizeof(y));
+                if (x != y) {
+                    return 1;
+                }
+            }
+
+            uint8_t difference = 0;
+            for (; i < size; i++) {
+                difference |= a[i] ^ b[i];
+            }
+            return difference != 0;
+        }
+    }
+}
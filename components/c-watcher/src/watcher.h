@@ -86,6 +86,18 @@
 #define WATCHER_ADD_ENTRY_DELAYED(watcher, ptr, cb, arg, delay)                                                        \
     watcher_add_entry_delayed(watcher, ptr, sizeof(*(ptr)), cb, arg, delay)
 
+/**
+ * @brief Add a new entry that is only checked after being marked with `watcher_set_dirty`
+ *
+ * @param watcher
+ * @param pointer pointer to observe
+ * @param callback function to be called when the entry is marked as dirty
+ * @param arg additional argument to be passed to the function
+ * @return int16_t entry index if successful, -1 on failure
+ */
+#define WATCHER_ADD_ENTRY_NOTIFIED(watcher, ptr, cb, arg)                                                              \
+    watcher_add_entry_notified(watcher, ptr, sizeof(*(ptr)), cb, ((void *)(arg)))
+
 
 // Private utility, defines a vector struct
 #define VECTOR_DEFINE(type, name)                                                                                      \
@@ -97,6 +109,9 @@
 
 typedef C_WATCHER_SIZE_TYPE watcher_size_t;
 
+// Marks the end of the dirty list
+#define WATCHER_NO_ENTRY ((watcher_size_t)C_WATCHER_MAX_ENTRIES)
+
 /**
  * @brief Callback typedef
  *
@@ -126,6 +141,9 @@ typedef struct C_WATCHER_STRUCT_ATTRIBUTES {
 
     watcher_size_t callback_index;     // Index for the callback vector
     watcher_size_t arg_index;          // Index for the argument vector
+
+    watcher_size_t next_dirty;     // Next entry in the dirty list
+    uint8_t        flags;
 } watcher_entry_t;
 
 
@@ -146,8 +164,21 @@ typedef struct {
     VECTOR_DEFINE(void *, args);
     VECTOR_DEFINE(watcher_debouncer_t, debouncers);
 
+    // Old values of the dynamically added entries, laid out contiguously in insertion order
+    struct {
+        uint8_t *items;
+        size_t   num;
+        size_t   capacity;
+    } shadow;
+
     void *user_ptr;
 
+    // Entries marked with `watcher_set_dirty`, in order
+    watcher_size_t dirty_head;
+    watcher_size_t dirty_tail;
+    // Entries that must still be compared on every pass
+    watcher_size_t num_polled;
+
     // Allocator
     void *(*fn_realloc)(void *, size_t);
     void (*fn_free)(void *);
@@ -256,6 +287,30 @@ watcher_result_t watcher_add_entry_delayed_static(watcher_t *watcher, const void
                                                   void *old_buffer);
 
 
+/**
+ * @brief Adds a new entry that is never compared against its old value: the writer is responsible for calling
+ * `watcher_set_dirty` after modifying the watched memory. `watcher_watch` only visits the entries marked as dirty.
+ *
+ * @param watcher
+ * @param pointer pointer to observe
+ * @param size size of the associated type
+ * @param callback function to be called when the entry is marked as dirty
+ * @param arg additional argument to be passed to the function
+ * @return int16_t entry index if successful, -1 on failure
+ */
+watcher_result_t watcher_add_entry_notified(watcher_t *watcher, const void *pointer, watcher_size_t size,
+                                            watcher_callback_t callback, void *arg);
+
+/**
+ * @brief Marks an entry as modified; its callback will be invoked by the next `watcher_watch`.
+ * Constant time, can be called multiple times before the watcher runs.
+ *
+ * @param watcher
+ * @param entry_index index returned when adding the entry
+ */
+void watcher_set_dirty(watcher_t *watcher, int16_t entry_index);
+
+
 /**
  * @brief Run the observer engine
  *
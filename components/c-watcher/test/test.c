@@ -42,6 +42,27 @@ static void null_arg_callback(void *old_value, const void *new_value, uint16_t s
 }
 
 
+static void counting_callback(void *old_value, const void *new_value, uint16_t size, void *user_ptr, void *arg) {
+    (void)old_value;
+    (void)new_value;
+    (void)size;
+    (void)user_ptr;
+    (void)arg;
+    cbtest++;
+}
+
+
+static void adding_callback(void *old_value, const void *new_value, uint16_t size, void *user_ptr, void *arg) {
+    (void)old_value;
+    (void)new_value;
+    (void)size;
+    watcher_t *watcher = user_ptr;
+    // Modifies the watcher while it is scanning
+    assert_true(WATCHER_ADD_ENTRY(watcher, (int *)arg, counting_callback, NULL) >= 0);
+    cbtest++;
+}
+
+
 /* These functions will be used to initialize
    and clean resources up after each test run */
 int setup(void **state) {
@@ -132,11 +153,112 @@ void watcher_mixed_test(void **state) {
 }
 
 
+void watcher_notified_test(void **state) {
+    (void)state;
+    cbtest = 0;
+
+    watcher_t watcher;
+    WATCHER_INIT_STD(&watcher, user_pointer);
+
+    int16_t notified_index = WATCHER_ADD_ENTRY_NOTIFIED(&watcher, &var4, callback, entries_arg);
+    assert_true(notified_index >= 0);
+    assert_true(WATCHER_ADD_ENTRY(&watcher, &var2, callback, entries_arg) >= 0);
+
+    // Not compared: nothing happens until the writer marks the entry
+    var4.b++;
+    assert_false(watcher_watch(&watcher, 0));
+    assert_int_equal(0, cbtest);
+
+    // Marking twice results in a single notification
+    watcher_set_dirty(&watcher, notified_index);
+    watcher_set_dirty(&watcher, notified_index);
+    assert_int_equal(1, watcher_watch(&watcher, 0));
+    assert_int_equal(1, cbtest);
+    assert_false(watcher_watch(&watcher, 0));
+
+    // Legacy entries keep working alongside notified ones
+    var2++;
+    watcher_set_dirty(&watcher, notified_index);
+    assert_int_equal(2, watcher_watch(&watcher, 0));
+    assert_int_equal(3, cbtest);
+
+    // Resetting discards pending notifications
+    watcher_set_dirty(&watcher, notified_index);
+    watcher_reset_all(&watcher);
+    assert_false(watcher_watch(&watcher, 0));
+    assert_int_equal(3, cbtest);
+
+    watcher_destroy(&watcher);
+}
+
+
+void watcher_many_entries_test(void **state) {
+    (void)state;
+    cbtest = 0;
+
+    static struct {
+        char     small;
+        uint64_t large[3];
+    } values[100] = {0};
+
+    watcher_t watcher;
+    WATCHER_INIT_STD(&watcher, user_pointer);
+
+    // Enough entries to grow both the vectors and the shadow storage several times
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        assert_true(WATCHER_ADD_ENTRY(&watcher, &values[i].small, callback, entries_arg) >= 0);
+        assert_true(WATCHER_ADD_SLICE_ENTRY(&watcher, values[i].large, 3, callback, entries_arg) >= 0);
+    }
+    assert_false(watcher_watch(&watcher, 0));
+
+    values[0].large[0]++;
+    values[50].large[2]++;
+    values[99].small++;
+    values[99].large[1]++;
+    assert_int_equal(4, watcher_watch(&watcher, 0));
+    assert_int_equal(4, cbtest);
+    assert_false(watcher_watch(&watcher, 0));
+
+    watcher_destroy(&watcher);
+}
+
+
+void watcher_restart_test(void **state) {
+    (void)state;
+    cbtest             = 0;
+    int trigger        = 0;
+    int added_variable = 0;
+
+    watcher_t watcher;
+    WATCHER_INIT_STD(&watcher, &watcher);
+
+    assert_true(WATCHER_ADD_ENTRY(&watcher, &trigger, adding_callback, &added_variable) >= 0);
+    assert_int_equal(1, watcher.entries.num);
+
+    // The callback adds an entry, the scan restarts and terminates
+    trigger++;
+    assert_int_equal(1, watcher_watch(&watcher, 0));
+    assert_int_equal(1, cbtest);
+    assert_int_equal(2, watcher.entries.num);
+    assert_false(watcher_watch(&watcher, 0));
+
+    // The entry added during the scan is watched as well
+    added_variable++;
+    assert_int_equal(1, watcher_watch(&watcher, 0));
+    assert_int_equal(2, cbtest);
+
+    watcher_destroy(&watcher);
+}
+
+
 int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(watcher_test),
         cmocka_unit_test(watcher_delayed_test),
         cmocka_unit_test(watcher_mixed_test),
+        cmocka_unit_test(watcher_notified_test),
+        cmocka_unit_test(watcher_many_entries_test),
+        cmocka_unit_test(watcher_restart_test),
     };
 
     /* If setup and teardown functions are not
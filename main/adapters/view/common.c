@@ -186,39 +186,6 @@ lv_obj_t *view_common_title_create(lv_obj_t *parent, uint16_t back_id, const cha
 }
 
 
-lv_obj_t *view_common_time_bar_create(lv_obj_t *parent, uint16_t id) {
-    lv_obj_t *cont = lv_obj_create(parent);
-    lv_obj_add_style(cont, &style_time_bar, LV_STATE_DEFAULT);
-
-    lv_obj_set_style_pad_column(cont, 1, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_row(cont, 0, LV_STATE_DEFAULT);
-    lv_obj_set_size(cont, PROGRAM_NUM_TIME_UNITS * 47, 46);
-
-    lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
-
-    for (uint16_t i = 0; i < PROGRAM_NUM_TIME_UNITS; i++) {
-        lv_obj_t *unit = lv_button_create(cont);
-        lv_obj_remove_flag(unit, LV_OBJ_FLAG_SNAPPABLE);
-        lv_obj_remove_flag(unit, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
-        lv_obj_add_style(unit, &style_time_unit, LV_STATE_DEFAULT);
-        lv_obj_set_style_border_post(unit, 0, LV_STATE_DEFAULT);
-        lv_obj_set_style_shadow_opa(unit, LV_OPA_TRANSP, LV_STATE_DEFAULT);
-        lv_obj_set_height(unit, 46);
-        lv_obj_set_width(unit, 46);
-        // lv_obj_set_flex_grow(unit, 1);
-        view_register_object_default_callback_with_number(unit, id, i);
-
-        lv_obj_t *label = lv_label_create(unit);
-        lv_label_set_text_fmt(label, "%i", i + 1);
-        lv_obj_center(label);
-    }
-
-    return cont;
-}
-
-
 lv_obj_t *view_common_gradient_background_create(lv_obj_t *parent) {
     lv_obj_t *obj = lv_obj_create(parent);
     lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
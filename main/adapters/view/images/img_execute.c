@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_execute.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,294 +24,641 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_EXECUTE uint8_t img_execute_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x73, 0x2e, 0x5b, 0x0e, 0x53, 0x6b, 0x42, 0xa8, 0x29, 0xa9, 0x29, 0x8c, 0x4a, 0xad, 0x4a, 0x8c, 0x4a, 0x8c, 0x4a, 0x8c, 0x4a, 0xac, 0x4a, 0xad, 0x4a, 0xac, 0x4a, 0xac, 0x4a, 0xad, 0x4a, 0xad, 0x4a, 0xad, 0x4a, 0xad, 0x4a, 0xad, 0x4a, 0xac, 0x4a, 0x8c, 0x42, 0x6c, 0x42, 0x2b, 0x42, 0x2b, 0x3a, 0x0b, 0x3a, 0x0a, 0x3a, 0xea, 0x39, 0x0a, 0x3a, 0x2b, 0x42, 0x6c, 0x42, 0x8c, 0x42, 0x8c, 0x42, 0x6c, 0x42, 0x6c, 0x42, 0x6b, 0x42, 0x4b, 0x42, 0x2b, 0x3a, 0x0b, 0x3a, 0x0b, 0x3a, 0x0b, 0x3a, 0x2b, 0x3a, 0x2b, 0x3a, 0x4b, 0x42, 0x4b, 0x42, 0x4b, 0x42, 0x2b, 0x3a, 0x2b, 0x3a, 0x0b, 0x3a, 0x0a, 0x3a, 0x0a, 0x3a, 0xea, 0x31, 0xca, 0x31, 0x0a, 0x3a, 0x0a, 0x3a, 0xea, 0x31, 0xea, 0x31, 0x0a, 0x3a, 0xea, 0x39, 0xea, 0x39, 0xea, 0x39, 0x0a, 0x3a, 0x0a, 0x3a, 0xea, 0x31, 0xea, 0x31, 0xea, 0x31, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0xa9, 0x29, 0x0a, 0x3a, 0x4b, 0x42, 0x89, 0x29, 0x4c, 0x42, 0x0e, 0x53, 0xd1, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x4a, 0x42, 0xe9, 0x31, 0x88, 0x29, 0x88, 0x29, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe6, 0x18, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0xe7, 0x18, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x06, 0x19, 0x67, 0x21, 0x88, 0x29, 0x0a, 0x3a, 0xac, 0x4a, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x84, 0x0e, 0x53, 0xc9, 0x31, 0x68, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe6, 0x10, 0xa9, 0x29, 0xe9, 0x31, 0x4f, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0xea, 0x31, 0x88, 0x29, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x10, 0xe6, 0x10, 0x27, 0x21, 0x0a, 0x3a, 0x4f, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x6b, 0xa9, 0x31, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x21, 0xea, 0x39, 0xcd, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xa5, 0xed, 0x52, 0x68, 0x29, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xc8, 0x31, 0x8b, 0x4a, 0xaf, 0x73, 0x10, 0x7c, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x32, 0x84, 0x32, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x51, 0x84, 0x31, 0x7c, 0x31, 0x7c, 0x31, 0x7c, 0x11, 0x7c, 0x31, 0x7c, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x7c, 0x31, 0x7c, 0x11, 0x7c, 0x11, 0x7c, 0x31, 0x84, 0x31, 0x7c, 0x31, 0x7c, 0x11, 0x7c, 0x10, 0x7c, 0x10, 0x7c, 0x31, 0x7c, 0x11, 0x7c, 0x11, 0x7c, 0x11, 0x7c, 0x31, 0x7c, 0x31, 0x7c, 0x31, 0x7c, 0x31, 0x84, 0x31, 0x84, 0x31, 0x7c, 0x31, 0x84, 0x31, 0x7c, 0x11, 0x7c, 0x10, 0x7c, 0x10, 0x7c, 0x11, 0x7c, 0x10, 0x7c, 0x10, 0x7c, 0x31, 0x7c, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x51, 0x84, 0x51, 0x8c, 0x52, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x71, 0x8c, 0x31, 0x84, 0xae, 0x73, 0x6a, 0x4a, 0x87, 0x29, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x47, 0x21, 0xea, 0x31, 0x4f, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6b, 0x0a, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x08, 0x19, 0x48, 0x21, 0xd0, 0x73, 0x96, 0xad, 0xba, 0xd6, 0x5d, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x3c, 0xe7, 0x58, 0xc6, 0xf3, 0x94, 0x8a, 0x4a, 0xc6, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xa9, 0x29, 0x0a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x9c, 0x6b, 0x42, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x8f, 0x6b, 0xf7, 0xb5, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xda, 0xd6, 0xf2, 0x9c, 0x67, 0x29, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xea, 0x31, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8c, 0xcd, 0x52, 0xe6, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x68, 0x29, 0xd3, 0x94, 0xfb, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0x14, 0xa5, 0x67, 0x29, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x89, 0x29, 0x4f, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x8c, 0x6b, 0x42, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x52, 0x84, 0x1c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xd3, 0x9c, 0x06, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x21, 0x29, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x73, 0x47, 0x21, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xed, 0x5a, 0x9a, 0xce, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xda, 0xde, 0xec, 0x5a, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xee, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x31, 0x88, 0x29, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xd3, 0x9c, 0x9e, 0xf7, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0xf3, 0x9c, 0xe6, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xa9, 0x31, 0x8d, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x7c, 0x47, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0xe9, 0x31, 0x18, 0xc6, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x67, 0x29, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x21, 0xd2, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x9d, 0x09, 0x3a, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xac, 0x52, 0xfb, 0xde, 0xde, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xba, 0xd6, 0xb6, 0xb5, 0xb3, 0x8c, 0xaf, 0x6b, 0x8f, 0x6b, 0xaf, 0x6b, 0xb3, 0x8c, 0x56, 0xa5, 0x7a, 0xce, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0xe9, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x88, 0x29, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xad, 0x8c, 0x4a, 0x06, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x0d, 0x63, 0x3c, 0xe7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x9a, 0xce, 0xb7, 0xad, 0xd4, 0x94, 0x72, 0x8c, 0x51, 0x84, 0x31, 0x84, 0x31, 0x84, 0x11, 0x84, 0x11, 0x84, 0x31, 0x84, 0x11, 0x84, 0x11, 0x84, 0x11, 0x7c, 0xf0, 0x7b, 0xd0, 0x73, 0x8f, 0x6b, 0x4e, 0x63, 0x2d, 0x63, 0x2d, 0x63, 0x2d, 0x63, 0x2d, 0x63, 0x2d, 0x63, 0x4e, 0x63, 0x6e, 0x6b, 0x8f, 0x6b, 0xcf, 0x73, 0xd0, 0x7b, 0xf0, 0x7b, 0x10, 0x7c, 0x11, 0x7c, 0x11, 0x84, 0x51, 0x84, 0x55, 0xad, 0x39, 0xc6, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xd6, 0xb3, 0x94, 0xa8, 0x29, 0xe6, 0x18, 0xe7, 0x18, 0x07, 0x11, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x27, 0x19, 0xb0, 0x73, 0xf8, 0xbd, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdb, 0xde, 0x09, 0x42, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xc9, 0x31, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x63, 0x47, 0x21, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x6b, 0x4a, 0x3d, 0xe7, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x39, 0xc6, 0xd0, 0x73, 0x07, 0x19, 0xe6, 0x18, 0x06, 0x19, 0x06, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x8f, 0x6b, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7a, 0xce, 0x0d, 0x63, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x18, 0xa9, 0x31, 0x14, 0x9d, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xde, 0x48, 0x29, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x21, 0xb0, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x84, 0xa8, 0x29, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xa8, 0x31, 0xdc, 0xde, 0xbf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x59, 0xce, 0xcc, 0x52, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0x06, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x8f, 0x6b, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x72, 0x8c, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0xc9, 0x31, 0x18, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x79, 0xce, 0x27, 0x29, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x88, 0x29, 0x37, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x52, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xb7, 0xb5, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x51, 0x8c, 0xe6, 0x10, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x67, 0x29, 0xb8, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xcc, 0x5a, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xd4, 0x9c, 0xdf, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x55, 0xad, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x0e, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x7c, 0x67, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x11, 0x7c, 0xbf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xcc, 0x5a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x06, 0x19, 0x77, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xde, 0x29, 0x42, 0x06, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x2e, 0x63, 0xf4, 0x9c, 0xd7, 0xb5, 0x38, 0xbe, 0x38, 0xc6, 0xf7, 0xb5, 0x34, 0xa5, 0x8d, 0x6b, 0x06, 0x19, 0xc6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x52, 0x8c, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x8f, 0x73, 0x07, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x68, 0x29, 0xb0, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2a, 0x42, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x4b, 0x42, 0x7e, 0xef, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdb, 0xde, 0xc8, 0x39, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x21, 0xac, 0x52, 0x52, 0x84, 0x93, 0x8c, 0x14, 0xa5, 0x35, 0xa5, 0x35, 0xa5, 0x35, 0xa5, 0x35, 0xa5, 0x55, 0xa5, 0x35, 0xa5, 0x35, 0xa5, 0x14, 0xa5, 0x14, 0xa5, 0xf4, 0xa4, 0xb3, 0x9c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0x72, 0x8c, 0xd3, 0x9c, 0x14, 0xa5, 0x34, 0xa5, 0x35, 0xa5, 0x55, 0xad, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0xf3, 0x9c, 0xcf, 0x73, 0x67, 0x29, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x21, 0x5a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdb, 0xde, 0x09, 0x42, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x88, 0x29, 0x14, 0x9d, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x96, 0xb5, 0x09, 0x42, 0xc6, 0x10, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x06, 0x19, 0x07, 0x19, 0x52, 0x8c, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xde, 0x47, 0x29, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x88, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x19, 0xbe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x8b, 0x52, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x2e, 0x63, 0x18, 0xbe, 0x7d, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0xf7, 0xbd, 0x09, 0x42, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x2a, 0x42, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xe6, 0xe9, 0x41, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x10, 0x7c, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x51, 0x8c, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xd4, 0x9c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x21, 0xb0, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xaf, 0xc9, 0x31, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xaf, 0x6b, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xaf, 0x73, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x4b, 0x42, 0x5a, 0xc6, 0xdf, 0xf7, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0x8e, 0x6b, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xf4, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x3c, 0xe7, 0x6b, 0x4a, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0x07, 0x19, 0x27, 0x19, 0x75, 0xad, 0xdf, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0x22, 0x00, 0x46, 0x29, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb3, 0x94, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x19, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0x09, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe9, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4e, 0x5b, 0x48, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x39, 0xc6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd7, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x8f, 0x6b, 0x5e, 0xe7, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x0d, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x68, 0x29, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x0d, 0x63, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x56, 0xad, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0x1c, 0xdf, 0xdb, 0xd6, 0xfc, 0xde, 0xbf, 0xf7, 0xff, 0xff, 0xec, 0x5a, 0x44, 0x00, 0x44, 0x00, 0x84, 0x10, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x31, 0x84, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x0a, 0x3a, 0x5d, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x76, 0xad, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xa8, 0x29, 0x12, 0x74, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6b, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x2a, 0x3a, 0x9f, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0x0a, 0x42, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x6f, 0x63, 0x7e, 0xef, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xd8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x72, 0x8c, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x8f, 0x73, 0xbf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x9a, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xfc, 0xd6, 0x5d, 0xe7, 0xbf, 0xf7, 0x27, 0x21, 0x44, 0x00, 0x44, 0x08, 0x64, 0x08, 0x87, 0x31, 0x5d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x0a, 0x42, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x32, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5d, 0xef, 0x88, 0x31, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0xad, 0x52, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0xa6, 0xc9, 0x31, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x35, 0x9d, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xad, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0x0a, 0x32, 0x3d, 0xdf, 0xdf, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x52, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xce, 0xc6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x5a, 0xce, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0x9a, 0xce, 0x9a, 0xce, 0xbb, 0xce, 0xdb, 0xce, 0xdc, 0xd6, 0xfc, 0xd6, 0x5e, 0xe7, 0xb4, 0x94, 0x65, 0x08, 0x44, 0x08, 0x64, 0x08, 0x86, 0x08, 0x96, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xbd, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x72, 0x8c, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x8c, 0x4a, 0x18, 0xc6, 0x00, 0x00, 
-  0x00, 0x00, 0xf1, 0x73, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x3c, 0xd7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0x4a, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x28, 0x19, 0x97, 0xad, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x9d, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x4e, 0x63, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0xab, 0x52, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x09, 0x3a, 0x9f, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x9a, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0xbb, 0xce, 0xbb, 0xd6, 0xdc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xf9, 0xbd, 0xd1, 0x73, 0xa6, 0x10, 0xa9, 0x31, 0x1b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xe9, 0x39, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x8c, 0x52, 0x9e, 0xf7, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x79, 0xce, 0x07, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x21, 0xd1, 0x73, 0x00, 0x00, 
-  0x00, 0x00, 0x0a, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x21, 0x2d, 0x5b, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x59, 0xce, 0x27, 0x21, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0xa8, 0x29, 0x5e, 0xe7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xa5, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0x2d, 0x5b, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x39, 0xce, 0x07, 0x19, 0xe6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x28, 0x19, 0x92, 0x8c, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xbb, 0xd6, 0x9a, 0xce, 0x9b, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdc, 0xd6, 0xdc, 0xce, 0xbc, 0xce, 0x39, 0xbe, 0x3c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0xe6, 0x18, 0xc6, 0x10, 0x56, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x88, 0x31, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x6c, 0x4a, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0x31, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xf4, 0x94, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x93, 0x94, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x19, 0xd4, 0x8c, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x73, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0xaf, 0x73, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x72, 0x8c, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x10, 0xe7, 0x18, 0x08, 0x19, 0x08, 0x19, 0x28, 0x19, 0xb7, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xbb, 0xce, 0x9a, 0xce, 0xba, 0xce, 0xbb, 0xce, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfc, 0xd6, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xa5, 0x10, 0x87, 0x31, 0x7e, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd0, 0x7b, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xa8, 0x29, 0x00, 0x00, 
-  0x00, 0x00, 0xa9, 0x29, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xd8, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xac, 0x52, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x48, 0x19, 0xbb, 0xce, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x1c, 0xe7, 0x06, 0x19, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x08, 0x19, 0x76, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x2a, 0x42, 0x07, 0x19, 0x07, 0x19, 0x68, 0x29, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x28, 0x19, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0x1c, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xbb, 0xde, 0xc6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xa5, 0x10, 0x84, 0x08, 0xb7, 0xb5, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x76, 0xb5, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xa9, 0x31, 0xff, 0xff, 
-  0x70, 0x63, 0x68, 0x21, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x9b, 0xce, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0x28, 0x21, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0xa8, 0x29, 0x7e, 0xef, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x7b, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0xba, 0xd6, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x07, 0x19, 0x08, 0x19, 0x07, 0x19, 0x4b, 0x42, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x28, 0x19, 0x96, 0xad, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfc, 0xd6, 0x9e, 0xef, 0xde, 0xff, 0xde, 0xff, 0xde, 0xf7, 0xbe, 0xf7, 0xbb, 0xd6, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xa5, 0x10, 0x85, 0x08, 0xf0, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x67, 0x21, 0x12, 0x84, 
-  0x0f, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x21, 0x5d, 0xe7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x1c, 0xe7, 0x07, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x0a, 0x3a, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xb3, 0x94, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0x07, 0x19, 0xcc, 0x52, 0xbe, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0x07, 0x19, 0x08, 0x19, 0x07, 0x19, 0xee, 0x52, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x28, 0x19, 0x8f, 0x6b, 0x39, 0xbe, 0xfc, 0xde, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0x5d, 0xe7, 0xde, 0xf7, 0xde, 0xf7, 0xde, 0xf7, 0xbe, 0xf7, 0xb7, 0xb5, 0xc6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0x48, 0x21, 0xc5, 0x10, 0xa5, 0x10, 0xc8, 0x31, 0xbe, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5d, 0xef, 0x47, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x2a, 0x42, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x6b, 0x42, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x5d, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0x9d, 0xef, 0x7d, 0xef, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x7d, 0xef, 0x9d, 0xf7, 0x9e, 0xf7, 0xbe, 0xf7, 0xde, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbe, 0xf7, 0x7d, 0xef, 0xfb, 0xde, 0x97, 0xb5, 0x4b, 0x42, 0x06, 0x11, 0xe6, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0x75, 0xad, 0xde, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0x9c, 0x07, 0x19, 0x08, 0x19, 0x27, 0x19, 0x2f, 0x5b, 0xe7, 0x18, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x93, 0x8c, 0x39, 0xbe, 0x9a, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xde, 0x7d, 0xef, 0x9e, 0xf7, 0x5d, 0xe7, 0xbb, 0xce, 0xf5, 0x94, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0x0a, 0x3a, 0xe6, 0x10, 0xc6, 0x10, 0xe6, 0x10, 0xdb, 0xd6, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x2a, 0x42, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xe9, 0x31, 
-  0x2b, 0x42, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x8f, 0x6b, 0xdf, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9a, 0xd6, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x8c, 0x4a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x1c, 0xe7, 0x0d, 0x63, 0xe6, 0x18, 0xc6, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x47, 0x21, 0x47, 0x21, 0x67, 0x21, 0x47, 0x21, 0x27, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0x06, 0x11, 0x06, 0x19, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0x06, 0x19, 0x0d, 0x5b, 0x38, 0xb6, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x72, 0x8c, 0x07, 0x19, 0x07, 0x19, 0x89, 0x29, 0x30, 0x5b, 0xe7, 0x10, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x93, 0x8c, 0x5a, 0xc6, 0x9a, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xba, 0xce, 0x7a, 0xc6, 0x7a, 0xbe, 0x5a, 0xb6, 0x93, 0x84, 0xe6, 0x18, 0x06, 0x19, 0x06, 0x19, 0x07, 0x19, 0xac, 0x4a, 0xe6, 0x18, 0xc6, 0x10, 0xe6, 0x18, 0xf7, 0xbd, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x6b, 0x4a, 
-  0x0b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x72, 0x8c, 0xdf, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9a, 0xd6, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0xcc, 0x52, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x31, 0x84, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0x06, 0x19, 0x06, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xed, 0x5a, 0xb7, 0xa5, 0xf8, 0xa5, 0x5d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x52, 0x8c, 0x07, 0x19, 0x07, 0x19, 0x88, 0x29, 0xb2, 0x6b, 0xc6, 0x10, 0xe7, 0x10, 0x08, 0x19, 0xe8, 0x18, 0x8f, 0x6b, 0x7a, 0xc6, 0x9a, 0xce, 0xbb, 0xce, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xce, 0x9b, 0xc6, 0x9b, 0xbe, 0x5a, 0xbe, 0x4e, 0x63, 0xe6, 0x18, 0x06, 0x19, 0x06, 0x19, 0x07, 0x19, 0xed, 0x52, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x96, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x93, 0x94, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xea, 0x39, 
-  0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xd3, 0x94, 0xdf, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7a, 0xd6, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0xcc, 0x52, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x6e, 0x6b, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x06, 0x19, 0xd1, 0x73, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x92, 0x94, 0xe7, 0x18, 0x07, 0x19, 0x27, 0x19, 0x13, 0x74, 0x28, 0x21, 0xe7, 0x10, 0xe7, 0x10, 0xe8, 0x18, 0x88, 0x29, 0x5a, 0xc6, 0x9a, 0xce, 0xba, 0xce, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xce, 0xbb, 0xce, 0x9b, 0xc6, 0x19, 0xb6, 0x87, 0x29, 0xe6, 0x10, 0xe6, 0x18, 0x06, 0x19, 0x06, 0x19, 0xee, 0x52, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0x96, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf4, 0x9c, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x88, 0x29, 
-  0xca, 0x31, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0xcc, 0x52, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x6e, 0x6b, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x4b, 0x42, 0x15, 0x95, 0xf9, 0xad, 0xd9, 0xad, 0xf9, 0xa5, 0xd8, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x55, 0xad, 0xe7, 0x18, 0x07, 0x19, 0xe6, 0x18, 0xb2, 0x6b, 0x6d, 0x42, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xf5, 0x94, 0x7a, 0xc6, 0xba, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xce, 0x9a, 0xc6, 0xf5, 0x94, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0x06, 0x19, 0xea, 0x39, 0x2f, 0x5b, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xb7, 0xb5, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x55, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xca, 0x31, 
-  0xaa, 0x31, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9a, 0xd6, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x27, 0x19, 0x8b, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x8f, 0x6b, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xc6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe6, 0x10, 0x27, 0x19, 0x2f, 0x5b, 0xd5, 0x8c, 0xd9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xf9, 0xa5, 0xdb, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xe7, 0x18, 0x07, 0x19, 0xe7, 0x18, 0x50, 0x5b, 0x92, 0x63, 0xc6, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xea, 0x39, 0x19, 0xbe, 0x9a, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xce, 0xbb, 0xce, 0x5a, 0xbe, 0x2a, 0x3a, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0x2e, 0x5b, 0x2f, 0x5b, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0x39, 0xc6, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x55, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xca, 0x31, 
-  0xa9, 0x31, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9a, 0xd6, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x4b, 0x42, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x8f, 0x6b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x4e, 0x5b, 0x16, 0x95, 0xf6, 0x8c, 0xf6, 0x8c, 0xd5, 0x8c, 0xd5, 0x8c, 0xd5, 0x8c, 0xf5, 0x8c, 0xd5, 0x8c, 0x74, 0x84, 0x13, 0x7c, 0x33, 0x7c, 0x32, 0x7c, 0x33, 0x7c, 0x53, 0x7c, 0x74, 0x84, 0x94, 0x84, 0x94, 0x84, 0xb5, 0x8c, 0xd5, 0x8c, 0xf6, 0x8c, 0x16, 0x95, 0x16, 0x95, 0x57, 0x9d, 0xb9, 0xa5, 0xf9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0x19, 0xae, 0xdf, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xe6, 0xe6, 0x10, 0x07, 0x19, 0x07, 0x19, 0xad, 0x4a, 0x55, 0x7c, 0xca, 0x31, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x0e, 0x5b, 0x5a, 0xc6, 0x9a, 0xc6, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xce, 0x9b, 0xc6, 0xd0, 0x6b, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0x27, 0x19, 0x12, 0x74, 0xad, 0x4a, 0xe7, 0x10, 0xe6, 0x10, 0xc6, 0x10, 0xfc, 0xde, 0xdf, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x76, 0xad, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x2b, 0x3a, 
-  0xa9, 0x31, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0xe6, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x4a, 0x42, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x6f, 0x6b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x90, 0x63, 0xb8, 0xa5, 0xb8, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x77, 0x95, 0x77, 0x95, 0x77, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xd8, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0x19, 0xae, 0x19, 0xae, 0x7d, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xc9, 0x39, 0xe7, 0x18, 0x07, 0x19, 0x68, 0x21, 0x54, 0x7c, 0xb2, 0x63, 0x85, 0x10, 0xc6, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0x90, 0x6b, 0x5a, 0xbe, 0x7a, 0xbe, 0x9a, 0xc6, 0xdb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xfc, 0xd6, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xd6, 0xfb, 0xd6, 0xfb, 0xd6, 0xdb, 0xce, 0xbb, 0xc6, 0x9b, 0xbe, 0x52, 0x7c, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0x0e, 0x53, 0x74, 0x84, 0x28, 0x19, 0xe7, 0x10, 0xe7, 0x18, 0x2a, 0x3a, 0xbf, 0xf7, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x76, 0xad, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x0a, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdb, 0xde, 0xe6, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x4a, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x4e, 0x6b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xd1, 0x6b, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xad, 0xf9, 0xad, 0x19, 0xae, 0x39, 0xb6, 0x5d, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x84, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0x91, 0x63, 0x76, 0x7c, 0x2c, 0x3a, 0xa6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe8, 0x18, 0xcd, 0x52, 0xd8, 0xad, 0x5a, 0xb6, 0x3a, 0xb6, 0x7a, 0xbe, 0xdc, 0xce, 0xfc, 0xd6, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xd7, 0xdb, 0xce, 0x9a, 0xbe, 0x9b, 0xb6, 0xf9, 0xa5, 0x4f, 0x5b, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xc9, 0x31, 0x50, 0x63, 0xb1, 0x6b, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x31, 0x7c, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x97, 0xad, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x2b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xe6, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x4a, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x4e, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xd0, 0x6b, 0xd8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xad, 0xf9, 0xad, 0x39, 0xb6, 0x7d, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0xe6, 0x10, 0xe7, 0x18, 0xe7, 0x10, 0x6c, 0x42, 0x96, 0x7c, 0x14, 0x64, 0x07, 0x19, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x68, 0x29, 0x73, 0x84, 0xfa, 0xad, 0x3a, 0xae, 0xf9, 0x9d, 0x1a, 0xa6, 0x5b, 0xae, 0x3b, 0xae, 0x3a, 0xa6, 0x1a, 0x9e, 0x3a, 0xa6, 0x1a, 0xa6, 0x53, 0x74, 0x27, 0x19, 0xe6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0x06, 0x19, 0x0f, 0x53, 0x54, 0x84, 0xc9, 0x31, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xb7, 0xad, 0xdf, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xb7, 0xb5, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xed, 0x5a, 
-  0x2b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x2a, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x2e, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xd0, 0x6b, 0xd9, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb9, 0x9d, 0xb9, 0x9d, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xf9, 0xa5, 0xd9, 0xad, 0x7a, 0xc6, 0x9d, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0x68, 0x29, 0xc6, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xf2, 0x6b, 0xb6, 0x74, 0x93, 0x5b, 0xc6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0x47, 0x21, 0x6f, 0x63, 0xd5, 0x8c, 0x98, 0x95, 0xd9, 0x9d, 0xd9, 0x9d, 0x78, 0x95, 0x16, 0x85, 0xd1, 0x63, 0x48, 0x21, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xce, 0x52, 0xb5, 0x84, 0xd1, 0x73, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x4b, 0x32, 0xfc, 0xce, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xb7, 0xb5, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xed, 0x52, 
-  0x2b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xd3, 0x94, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x4a, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x2d, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xf1, 0x6b, 0x1a, 0xae, 0xf9, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xd9, 0xad, 0xd9, 0xad, 0xd8, 0xad, 0xd8, 0xa5, 0xd8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd8, 0xa5, 0xf9, 0xad, 0x9a, 0xc6, 0x7c, 0xe7, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x32, 0x84, 0xa5, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0x69, 0x21, 0x55, 0x74, 0x96, 0x74, 0x51, 0x53, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0xc6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xad, 0x4a, 0x94, 0x7c, 0x17, 0x95, 0x27, 0x19, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xd5, 0x74, 0x7d, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd7, 0xb5, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x8c, 0x4a, 
-  0x2b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xf3, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xe7, 0x18, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4a, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x93, 0x8c, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xbd, 0xf7, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x0a, 0x42, 0xa6, 0x10, 0xc6, 0x10, 0xe7, 0x10, 0x2b, 0x3a, 0x75, 0x7c, 0x96, 0x74, 0xd2, 0x63, 0x28, 0x19, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x68, 0x21, 0x91, 0x5b, 0x13, 0x74, 0x16, 0x8d, 0x0a, 0x3a, 0xc6, 0x10, 0xc6, 0x10, 0xe6, 0x18, 0xed, 0x4a, 0x19, 0x9e, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x5a, 
-  0x2b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x14, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4a, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x14, 0x9d, 0xbe, 0xf7, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0x16, 0x9d, 0xa5, 0x10, 0xa5, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xcd, 0x4a, 0x95, 0x7c, 0x95, 0x74, 0x14, 0x6c, 0x8d, 0x42, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x19, 0xce, 0x42, 0x34, 0x64, 0xd6, 0x74, 0xb6, 0x84, 0x6b, 0x42, 0xe6, 0x10, 0xe6, 0x10, 0xc6, 0x18, 0x88, 0x29, 0x57, 0x95, 0x5a, 0xb6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x5a, 
-  0x2b, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x34, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x6b, 0x4a, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0x55, 0xa5, 0xbe, 0xf7, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0x1a, 0xb6, 0x90, 0x63, 0x85, 0x08, 0xa5, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0x0b, 0x3a, 0x54, 0x74, 0x75, 0x74, 0x95, 0x6c, 0x13, 0x64, 0x4d, 0x3a, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x6c, 0x3a, 0xd2, 0x5b, 0x54, 0x64, 0x95, 0x6c, 0x75, 0x74, 0x0a, 0x3a, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xb4, 0x84, 0xb8, 0x9d, 0xdb, 0xd6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x6b, 0x4a, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0x76, 0xad, 0xbe, 0xf7, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xc6, 0xb8, 0x9d, 0x4b, 0x42, 0x85, 0x10, 0xa6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xa9, 0x29, 0xf2, 0x63, 0x95, 0x6c, 0x95, 0x6c, 0x95, 0x6c, 0xd3, 0x63, 0xef, 0x4a, 0x0b, 0x32, 0xe7, 0x10, 0xa6, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xa6, 0x10, 0xe7, 0x10, 0xea, 0x31, 0xee, 0x42, 0x91, 0x53, 0x13, 0x5c, 0x34, 0x5c, 0x34, 0x6c, 0xb1, 0x5b, 0x68, 0x21, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xd1, 0x6b, 0xb8, 0x9d, 0xb8, 0x95, 0x7d, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x6b, 0x4a, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x96, 0xad, 0xbe, 0xf7, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xff, 0xbe, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xb9, 0x9d, 0x37, 0x95, 0xa9, 0x31, 0x85, 0x10, 0xa6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xee, 0x4a, 0x34, 0x6c, 0x95, 0x6c, 0x55, 0x64, 0x34, 0x64, 0x34, 0x5c, 0x13, 0x64, 0xb2, 0x5b, 0x91, 0x5b, 0x91, 0x53, 0xb2, 0x53, 0xf3, 0x5b, 0xf3, 0x53, 0xf3, 0x53, 0x13, 0x5c, 0x34, 0x64, 0xd2, 0x63, 0x4c, 0x3a, 0xe7, 0x10, 0xe7, 0x18, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x10, 0x2e, 0x5b, 0xb9, 0xa5, 0xd8, 0x9d, 0x39, 0xae, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xee, 0x5a, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x8b, 0x4a, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x96, 0xad, 0x9e, 0xf7, 0x9e, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9e, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbe, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x98, 0x9d, 0x99, 0x9d, 0x37, 0x8d, 0x4b, 0x3a, 0xa6, 0x10, 0xa6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0x27, 0x19, 0x0e, 0x4b, 0xd2, 0x63, 0x55, 0x6c, 0x55, 0x6c, 0x34, 0x64, 0x14, 0x64, 0x14, 0x5c, 0x14, 0x5c, 0x13, 0x5c, 0x14, 0x5c, 0x13, 0x5c, 0x14, 0x64, 0xd2, 0x63, 0x6c, 0x42, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x10, 0xe6, 0x18, 0xd1, 0x6b, 0xd9, 0xa5, 0xd9, 0xa5, 0xd8, 0x9d, 0x5d, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x5a, 
-  0x2c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x8b, 0x4a, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x2d, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x97, 0xb5, 0xbe, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x99, 0x95, 0x99, 0x95, 0x78, 0x95, 0x2f, 0x53, 0xa6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xe6, 0x10, 0x68, 0x21, 0x4b, 0x3a, 0xee, 0x4a, 0x2f, 0x53, 0x91, 0x5b, 0x70, 0x53, 0x91, 0x5b, 0x70, 0x53, 0x2f, 0x53, 0xea, 0x31, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0x27, 0x19, 0x73, 0x7c, 0xd9, 0xa5, 0xd9, 0xa5, 0xf9, 0xa5, 0x9a, 0xbe, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x5a, 
-  0x2b, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xd3, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xac, 0x52, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x2e, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xb3, 0x94, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x18, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xb5, 0xd6, 0xb5, 0x96, 0xad, 0x96, 0xad, 0x75, 0xad, 0x55, 0xad, 0x75, 0xad, 0xb7, 0xb5, 0xd7, 0xb5, 0xf7, 0xbd, 0x18, 0xbe, 0x38, 0xc6, 0x79, 0xce, 0x3d, 0xe7, 0x9e, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xef, 0x9d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x9d, 0xf7, 0xbe, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x57, 0x9d, 0x79, 0x95, 0x78, 0x95, 0x99, 0x95, 0x74, 0x74, 0xa9, 0x29, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xcc, 0x4a, 0x56, 0x95, 0xd8, 0xa5, 0xf9, 0x9d, 0xf9, 0xa5, 0x1a, 0xa6, 0x9e, 0xef, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xbd, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x2b, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x30, 0x84, 0xdb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xe6, 0x1b, 0xe7, 0x1b, 0xe7, 0x3c, 0xef, 0x5c, 0xf7, 0x7d, 0xef, 0x38, 0xc6, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4b, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x4e, 0x6b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0xe6, 0x10, 0x47, 0x21, 0x8f, 0x6b, 0xf8, 0xbd, 0x5d, 0xe7, 0x9d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xef, 0x7c, 0xf7, 0x9d, 0xf7, 0xde, 0xff, 0xdd, 0xff, 0xde, 0xff, 0xfb, 0xde, 0x58, 0x8d, 0x78, 0x8d, 0x58, 0x8d, 0x78, 0x8d, 0x57, 0x8d, 0x70, 0x5b, 0x07, 0x11, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x0a, 0x3a, 0x73, 0x84, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xd8, 0x9d, 0xf9, 0xa5, 0x3d, 0xdf, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xbe, 0xf7, 0x9d, 0xf7, 0x7d, 0xf7, 0x5c, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x35, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x52, 
-  0x2c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xef, 0x7b, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xba, 0xd6, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xb6, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x4e, 0x6b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x4b, 0x4a, 0xf8, 0xbd, 0x7d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x3c, 0xef, 0x3c, 0xef, 0x5c, 0xef, 0x7c, 0xf7, 0xbd, 0xff, 0x39, 0xbe, 0x37, 0x85, 0x78, 0x8d, 0x37, 0x8d, 0x78, 0x95, 0x98, 0x95, 0x37, 0x8d, 0xb1, 0x63, 0xea, 0x31, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xed, 0x52, 0x94, 0x84, 0x77, 0x9d, 0x97, 0x95, 0x98, 0x9d, 0x77, 0x95, 0xb8, 0x9d, 0xd8, 0x9d, 0xfc, 0xce, 0xbe, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x7c, 0xef, 0x5c, 0xef, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xd4, 0x94, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xf0, 0x7b, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0xba, 0xce, 0xba, 0xce, 0xba, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0x96, 0xad, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xaf, 0x7b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x06, 0x19, 0xe6, 0x18, 0x73, 0x8c, 0x3d, 0xe7, 0x5d, 0xe7, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xef, 0x7d, 0xef, 0x19, 0xb6, 0x17, 0x85, 0x57, 0x8d, 0x78, 0x8d, 0x78, 0x8d, 0xb9, 0x9d, 0xb9, 0x9d, 0x98, 0x95, 0xf6, 0x7c, 0xf1, 0x63, 0xee, 0x52, 0xea, 0x31, 0x48, 0x21, 0x27, 0x19, 0x27, 0x19, 0x88, 0x29, 0x2b, 0x3a, 0x4f, 0x5b, 0x32, 0x74, 0x36, 0x95, 0x98, 0x9d, 0x57, 0x95, 0x36, 0x8d, 0x57, 0x8d, 0x57, 0x8d, 0x57, 0x8d, 0x36, 0x8d, 0x9b, 0xc6, 0x7e, 0xf7, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfb, 0xde, 0xf4, 0x94, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x10, 0x7c, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x96, 0xad, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x53, 0x84, 0x3d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1b, 0xe7, 0x3b, 0xe7, 0x5c, 0xef, 0x9a, 0xc6, 0x57, 0x8d, 0x99, 0x95, 0x57, 0x8d, 0x78, 0x8d, 0x78, 0x8d, 0x98, 0x95, 0xd9, 0x9d, 0xb9, 0x9d, 0xb9, 0x9d, 0xb9, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0xb9, 0xa5, 0xd9, 0xa5, 0x78, 0x95, 0x77, 0x95, 0x77, 0x95, 0x36, 0x8d, 0x36, 0x8d, 0x36, 0x8d, 0x36, 0x8d, 0x16, 0x85, 0x57, 0x8d, 0xdb, 0xce, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfb, 0xde, 0xf4, 0x94, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x51, 0x84, 0xfc, 0xde, 0xfc, 0xd6, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfb, 0xde, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xd6, 0xb7, 0xb5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x9d, 0xef, 0x11, 0x7c, 0xe9, 0x39, 0xe9, 0x39, 0x09, 0x3a, 0x09, 0x3a, 0x09, 0x3a, 0x0a, 0x3a, 0x09, 0x3a, 0x09, 0x3a, 0xe9, 0x39, 0xc9, 0x31, 0xa8, 0x29, 0x88, 0x29, 0x88, 0x29, 0x88, 0x29, 0x87, 0x29, 0x88, 0x29, 0x88, 0x29, 0xa8, 0x29, 0xa8, 0x29, 0xa8, 0x31, 0xc8, 0x31, 0xe9, 0x31, 0xe9, 0x39, 0x09, 0x3a, 0x29, 0x3a, 0xe9, 0x39, 0x26, 0x21, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xd4, 0x94, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1b, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0xdb, 0xd6, 0x98, 0x9d, 0x57, 0x85, 0x78, 0x8d, 0x57, 0x8d, 0x78, 0x8d, 0xb9, 0x95, 0xb9, 0x9d, 0x98, 0x95, 0xb9, 0x9d, 0xb9, 0x9d, 0xb8, 0x9d, 0xb9, 0x9d, 0xb8, 0x9d, 0x98, 0x9d, 0x78, 0x95, 0x98, 0x95, 0x77, 0x95, 0x57, 0x8d, 0xf5, 0x84, 0x57, 0x85, 0x16, 0x85, 0x36, 0x95, 0x1c, 0xdf, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x3c, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xf4, 0x9c, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x51, 0x8c, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfb, 0xde, 0xdb, 0xd6, 0xdb, 0xd6, 0xb7, 0xb5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xde, 0xf7, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x38, 0xc6, 0x0d, 0x5b, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x39, 0xc6, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x7a, 0xc6, 0x36, 0x85, 0x37, 0x85, 0x57, 0x8d, 0x78, 0x8d, 0x57, 0x8d, 0x78, 0x95, 0x98, 0x95, 0x78, 0x95, 0x78, 0x95, 0x78, 0x95, 0x77, 0x95, 0x77, 0x95, 0x57, 0x95, 0x77, 0x8d, 0x57, 0x8d, 0x57, 0x8d, 0xf6, 0x84, 0x36, 0x95, 0xdb, 0xce, 0x7d, 0xe7, 0x5c, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x15, 0x9d, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x4b, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x72, 0x8c, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfb, 0xde, 0xfb, 0xd6, 0xd7, 0xb5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0x93, 0x94, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x2e, 0x63, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x59, 0xbe, 0x57, 0x8d, 0x57, 0x85, 0x78, 0x85, 0x78, 0x85, 0x78, 0x8d, 0x57, 0x8d, 0x77, 0x8d, 0x77, 0x8d, 0x78, 0x8d, 0x37, 0x8d, 0x78, 0x8d, 0x57, 0x85, 0x16, 0x85, 0xd8, 0xa5, 0xdb, 0xce, 0x7d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0x15, 0x9d, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x4b, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x92, 0x94, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfb, 0xde, 0xd8, 0xb5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x11, 0x84, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x59, 0xc6, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x5c, 0xef, 0x5d, 0xef, 0xbb, 0xd6, 0x39, 0xb6, 0xd8, 0xa5, 0x97, 0x95, 0x57, 0x95, 0x57, 0x8d, 0x16, 0x8d, 0x37, 0x8d, 0x36, 0x95, 0x19, 0xb6, 0xfc, 0xd6, 0x5d, 0xe7, 0x7d, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x3c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfc, 0xde, 0xd8, 0xb5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0xa9, 0x31, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xf4, 0x9c, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0xbe, 0xf7, 0xde, 0xf7, 0xde, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0x9e, 0xf7, 0x9d, 0xef, 0x7d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x35, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x52, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x07, 0x19, 0x6b, 0x4a, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x93, 0x8c, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x6f, 0x6b, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xde, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0x9d, 0xf7, 0x9d, 0xef, 0x7d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x36, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x6c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x8b, 0x4a, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf8, 0xbd, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x6b, 0x4a, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x9d, 0xef, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xde, 0xf7, 0xde, 0xf7, 0xbe, 0xf7, 0x9d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x36, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x5a, 
-  0x8c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x94, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x07, 0x19, 0x6b, 0x4a, 0xbe, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xbd, 0xff, 0xde, 0xff, 0xfe, 0xff, 0x18, 0xbe, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x89, 0x29, 0x1d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x9d, 0xef, 0xbe, 0xf7, 0x7d, 0xef, 0x79, 0xce, 0x7a, 0xce, 0x7e, 0xef, 0xbe, 0xf7, 0x9e, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x5a, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0x9d, 0xf7, 0x9d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xde, 0xff, 0xde, 0xff, 0x14, 0x9d, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xed, 0x5a, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0xba, 0xd6, 0x6b, 0x4a, 0xc6, 0x10, 0xc6, 0x08, 0xa9, 0x31, 0xd9, 0xbd, 0x9e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x56, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbe, 0xf7, 0x4b, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xf1, 0x7b, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x1c, 0xdf, 0xe9, 0x39, 0xc6, 0x10, 0xc6, 0x08, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0x3a, 0xbe, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x36, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x72, 0x8c, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0x18, 0xc6, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x35, 0xa5, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x15, 0xa5, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x08, 0xc6, 0x10, 0xc6, 0x10, 0xc7, 0x10, 0x6f, 0x6b, 0x7e, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x36, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x5a, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x72, 0x8c, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xfb, 0xde, 0x0a, 0x42, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x27, 0x21, 0x3a, 0xc6, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x2e, 0x63, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x08, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0x88, 0x29, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x36, 0xa5, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x0e, 0x5b, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x72, 0x8c, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0x7d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0x9d, 0xf7, 0x9e, 0xf7, 0x39, 0xc6, 0x2a, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x0d, 0x63, 0x9b, 0xc6, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x9d, 0xef, 0x8f, 0x73, 0xa6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xed, 0x5a, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x36, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xee, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x6a, 0x4a, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x5c, 0xe7, 0x39, 0xc6, 0xf8, 0xbd, 0xf8, 0xbd, 0xf8, 0xbd, 0xf8, 0xbd, 0x18, 0xbe, 0x18, 0xbe, 0x19, 0xc6, 0xf8, 0xbd, 0xd8, 0xbd, 0xd8, 0xb5, 0xb7, 0xb5, 0x97, 0xb5, 0x97, 0xb5, 0x97, 0xb5, 0x97, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xd8, 0xb5, 0xd8, 0xbd, 0xf8, 0xbd, 0xf9, 0xbd, 0x19, 0xbe, 0xd8, 0xbd, 0x97, 0xb5, 0x76, 0xad, 0xd4, 0x94, 0x4b, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x88, 0x29, 0x96, 0xa5, 0x5b, 0xbe, 0x5e, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0xd7, 0xbd, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xb7, 0xb5, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x36, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x8b, 0x4a, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0xba, 0xd6, 0x4a, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0xb3, 0x8c, 0xf9, 0xad, 0x3a, 0xb6, 0x5e, 0xe7, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x31, 0x84, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0x73, 0x8c, 0x3d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xac, 0x4a, 
-  0x4c, 0x42, 0x07, 0x19, 0x08, 0x19, 0x07, 0x19, 0x27, 0x19, 0x92, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4b, 0x42, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0xf0, 0x7b, 0x27, 0x19, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x89, 0x29, 0xd4, 0x8c, 0xf9, 0xad, 0xf9, 0xad, 0x7b, 0xb6, 0x7e, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x9a, 0xce, 0x76, 0xad, 0x76, 0xad, 0x7a, 0xce, 0x7d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x6c, 0x4a, 
-  0x4c, 0x42, 0x07, 0x19, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x92, 0x94, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4b, 0x42, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x8b, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x28, 0x19, 0xed, 0x52, 0x57, 0x9d, 0xd8, 0xa5, 0xd9, 0xad, 0xf9, 0xad, 0xfc, 0xce, 0x7d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x0a, 0x3a, 
-  0x6c, 0x42, 0x07, 0x19, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x93, 0x94, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x8c, 0x4a, 0x93, 0x84, 0x98, 0xa5, 0xb8, 0xa5, 0xd8, 0xa5, 0xf9, 0xa5, 0x19, 0xae, 0x7e, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x35, 0x9d, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x0a, 0x3a, 
-  0x6c, 0x42, 0x07, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0xb3, 0x94, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4b, 0x42, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x68, 0x21, 0xc9, 0x29, 0xa9, 0x29, 0x89, 0x29, 0x69, 0x29, 0x68, 0x29, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x21, 0x89, 0x29, 0xc9, 0x31, 0x0b, 0x3a, 0x6c, 0x42, 0x8c, 0x4a, 0x4c, 0x42, 0xee, 0x52, 0x70, 0x63, 0xf2, 0x73, 0xd5, 0x8c, 0x98, 0xa5, 0x98, 0x9d, 0xb8, 0x9d, 0xd8, 0xa5, 0xd9, 0xa5, 0xf9, 0xad, 0xdc, 0xd6, 0x7d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x15, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x6c, 0x4a, 
-  0x6c, 0x42, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x93, 0x94, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x8b, 0x4a, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0xea, 0x39, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x6f, 0x5b, 0x57, 0x95, 0x78, 0x95, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x77, 0x95, 0x58, 0x95, 0x57, 0x95, 0x37, 0x95, 0x37, 0x95, 0x37, 0x95, 0x57, 0x95, 0x57, 0x95, 0x37, 0x95, 0x57, 0x95, 0x78, 0x9d, 0x77, 0x9d, 0x57, 0x9d, 0x16, 0x8d, 0xd5, 0x8c, 0xb5, 0x84, 0xd5, 0x8c, 0xb4, 0x84, 0x57, 0x9d, 0x98, 0x9d, 0x98, 0xa5, 0xb8, 0x9d, 0xb8, 0xa5, 0xd8, 0xa5, 0xd9, 0xa5, 0x5a, 0xbe, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x52, 
-  0x6c, 0x4a, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x93, 0x8c, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x8b, 0x4a, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0xea, 0x39, 0xe7, 0x18, 0xe6, 0x18, 0x07, 0x19, 0xe6, 0x18, 0x6f, 0x63, 0x57, 0x95, 0x77, 0x95, 0x77, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x77, 0x9d, 0x57, 0x9d, 0x16, 0x95, 0xd5, 0x8c, 0xf5, 0x8c, 0x36, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x98, 0xa5, 0xb8, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xd8, 0xa5, 0x19, 0xb6, 0x3c, 0xdf, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xed, 0x5a, 
-  0x6c, 0x42, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x93, 0x94, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x18, 0xbe, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x6b, 0x4a, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x6f, 0x63, 0x77, 0x95, 0x98, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xf9, 0xb5, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xac, 0x4a, 
-  0x4c, 0x42, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0xb3, 0x94, 0x5c, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x18, 0xbe, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x6b, 0x4a, 0x7e, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0x0a, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xb0, 0x63, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0x39, 0xbe, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x55, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xcd, 0x52, 
-  0x4c, 0x42, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x92, 0x94, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x6b, 0x4a, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xd1, 0x63, 0xb8, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0xa5, 0x98, 0x9d, 0xb7, 0xad, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x55, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x8c, 0x4a, 
-  0x4c, 0x42, 0x08, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x92, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x07, 0x19, 0x8b, 0x4a, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x72, 0x84, 0xdb, 0xd6, 0xbb, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x79, 0xc6, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0xba, 0xce, 0xba, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xc6, 0x59, 0xc6, 0x79, 0xc6, 0x9a, 0xce, 0xdb, 0xd6, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x55, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xac, 0x4a, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x72, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x6b, 0x4a, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x93, 0x8c, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xed, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x93, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xf8, 0xbd, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x6b, 0x42, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x15, 0x9d, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0xee, 0x5a, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x4b, 0x42, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0x8c, 0x52, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x55, 0xa5, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xee, 0x52, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x6b, 0x4a, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0x0d, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x76, 0xa5, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xcd, 0x52, 
-  0x8c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xbd, 0x07, 0x19, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x8b, 0x4a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0x0d, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x96, 0xad, 0x9d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x56, 0xa5, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0xed, 0x5a, 
-  0x8c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x8b, 0x4a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0xed, 0x5a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x97, 0xad, 0x9e, 0xef, 0x9d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0xcd, 0x52, 
-  0xad, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x4b, 0x42, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3d, 0xe7, 0x8b, 0x4a, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x35, 0x9d, 0xfc, 0xde, 0xdc, 0xd6, 0xdc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xde, 0xdc, 0xd6, 0xdb, 0xd6, 0xdc, 0xd6, 0xdc, 0xd6, 0xbc, 0xd6, 0xbb, 0xd6, 0x9b, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfc, 0xd6, 0x1c, 0xdf, 0x1c, 0xdf, 0xfc, 0xde, 0xfc, 0xd6, 0xdc, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xfb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xd6, 0xbb, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x7a, 0xc6, 0x5a, 0xc6, 0x5a, 0xc6, 0x39, 0xbe, 0x19, 0xbe, 0x18, 0xbe, 0x59, 0xc6, 0xdb, 0xd6, 0x5d, 0xe7, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x28, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0xad, 0x4a, 
-  0xad, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x2a, 0x42, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x0a, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0x07, 0x11, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x27, 0x21, 0x47, 0x21, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0x07, 0x19, 0x47, 0x21, 0x88, 0x29, 0x67, 0x29, 0x47, 0x21, 0x27, 0x21, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x10, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x19, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe6, 0x10, 0x27, 0x21, 0xcd, 0x52, 0x76, 0xa5, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x56, 0xa5, 0x27, 0x21, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x8c, 0x4a, 
-  0x8d, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xb3, 0x94, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x09, 0x3a, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0xea, 0x39, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x11, 0x07, 0x11, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x8c, 0x4a, 0xd8, 0xb5, 0x7e, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x56, 0xa5, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xad, 0x4a, 
-  0x8d, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x28, 0x21, 0x93, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0xe9, 0x39, 0x5d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x8c, 0x52, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x33, 0x84, 0x3d, 0xe7, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3d, 0xe7, 0x56, 0xa5, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xee, 0x52, 
-  0x8d, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x28, 0x21, 0x93, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0xf8, 0xbd, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0xc9, 0x31, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x11, 0x84, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x0e, 0x63, 0xfd, 0xde, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x56, 0xa5, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x0e, 0x5b, 
-  0x8c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x28, 0x21, 0x93, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x19, 0xbe, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xa9, 0x31, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0xdb, 0xd6, 0x6f, 0x6b, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0xe7, 0x10, 0xe8, 0x18, 0xe8, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe8, 0x18, 0xe8, 0x18, 0xe8, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0xc7, 0x10, 0xc7, 0x10, 0xc6, 0x10, 0x07, 0x19, 0x27, 0x21, 0x88, 0x29, 0xe9, 0x39, 0x2a, 0x42, 0xc9, 0x39, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xb0, 0x73, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x76, 0xa5, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xee, 0x5a, 
-  0x6c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x28, 0x21, 0x93, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3d, 0xe7, 0x39, 0xc6, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x88, 0x31, 0x3d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x1c, 0xe7, 0x7a, 0xce, 0x39, 0xc6, 0x7a, 0xce, 0x9a, 0xce, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0xdb, 0xd6, 0xdb, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xbb, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0xbb, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x39, 0xc6, 0x18, 0xbe, 0x39, 0xc6, 0x39, 0xc6, 0x38, 0xbe, 0x18, 0xc6, 0x18, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x18, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x9a, 0xd6, 0xdb, 0xd6, 0xfc, 0xde, 0x1c, 0xdf, 0x1c, 0xe7, 0x3d, 0xe7, 0x5d, 0xef, 0x9e, 0xef, 0x7d, 0xef, 0xfb, 0xde, 0x76, 0xad, 0xe9, 0x39, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xb8, 0xb5, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x77, 0xad, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xee, 0x52, 
-  0x8c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x28, 0x21, 0x28, 0x21, 0xb4, 0x94, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x59, 0xc6, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x29, 0x1c, 0xdf, 0x5d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xef, 0x3c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xfb, 0xde, 0xec, 0x52, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xac, 0x52, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x97, 0xad, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0xee, 0x52, 
-  0x8d, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x28, 0x21, 0x28, 0x21, 0xb3, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x7a, 0xce, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xfc, 0xde, 0x5d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x1c, 0xdf, 0x8c, 0x4a, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xf9, 0xbd, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x97, 0xad, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0xee, 0x52, 
-  0x4c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x28, 0x21, 0x28, 0x21, 0x72, 0x84, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xdf, 0x48, 0x21, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x07, 0x19, 0x9a, 0xce, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x39, 0xbe, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x73, 0x8c, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x97, 0xad, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x6c, 0x42, 
-  0xad, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x21, 0x27, 0x21, 0x8f, 0x6b, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x2e, 0x63, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xb7, 0xb5, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0xcd, 0x5a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x6c, 0x4a, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x36, 0xa5, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x6c, 0x42, 
-  0x0f, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x2a, 0x42, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xd4, 0x94, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xb0, 0x73, 0x7e, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5c, 0xe7, 0xb4, 0x94, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0xfc, 0xde, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x52, 0x84, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0x27, 0x19, 0x6c, 0x42, 
-  0x70, 0x63, 0x07, 0x21, 0x27, 0x19, 0x27, 0x19, 0x28, 0x21, 0x48, 0x21, 0xfc, 0xde, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0xf8, 0xb5, 0x07, 0x19, 0x08, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0xdc, 0xd6, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0xb4, 0x94, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0xfc, 0xde, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x6b, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0xad, 0x4a, 
-  0x0e, 0x5b, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x21, 0x28, 0x21, 0xf8, 0xbd, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xdf, 0xbb, 0xce, 0xc9, 0x31, 0x08, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0xb3, 0x94, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x7d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x6f, 0x6b, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xea, 0x39, 0x1d, 0xdf, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0xba, 0xd6, 0x27, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x4c, 0x42, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0xb4, 0x94, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xfc, 0xd6, 0xbb, 0xce, 0xf1, 0x73, 0x08, 0x19, 0x08, 0x19, 0x28, 0x19, 0x07, 0x19, 0x27, 0x21, 0x7a, 0xce, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xfc, 0xde, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x2e, 0x63, 0x1c, 0xdf, 0x3d, 0xdf, 0x3d, 0xe7, 0x3d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x96, 0xad, 0x08, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4c, 0x42, 
-  0x8c, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0xed, 0x5a, 0x5e, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0xbb, 0xce, 0x5a, 0xbe, 0x77, 0xa5, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x0d, 0x5b, 0x3c, 0xdf, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x35, 0xa5, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0xd5, 0x94, 0xbb, 0xd6, 0x1c, 0xdf, 0x3d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x11, 0x84, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xad, 0x4a, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x27, 0x19, 0xdc, 0xde, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0x5a, 0xc6, 0x19, 0xb6, 0xf9, 0xb5, 0x4e, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x11, 0x7c, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xba, 0xd6, 0x47, 0x21, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x68, 0x21, 0x19, 0xbe, 0x7b, 0xc6, 0xfc, 0xd6, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x1c, 0xdf, 0xa9, 0x31, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0xad, 0x52, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x97, 0xb5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x19, 0xb6, 0xb8, 0xad, 0xb8, 0xa5, 0x56, 0x9d, 0x68, 0x29, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0xaf, 0x73, 0x1c, 0xdf, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x59, 0xce, 0x2a, 0x42, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0xf1, 0x7b, 0x1a, 0xb6, 0x3a, 0xb6, 0xbb, 0xce, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xe7, 0xf7, 0xb5, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0xcd, 0x52, 
-  0x2b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x21, 0x28, 0x19, 0x0e, 0x63, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0xf8, 0xb5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x73, 0x84, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x2a, 0x42, 0xd8, 0xb5, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x3c, 0xe7, 0x14, 0x9d, 0x28, 0x19, 0xe7, 0x10, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0xc9, 0x31, 0x98, 0xa5, 0xf9, 0xad, 0xf9, 0xad, 0xbb, 0xce, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x4e, 0x63, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0xcd, 0x52, 
-  0x6c, 0x42, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x39, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9b, 0xce, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x6f, 0x63, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x06, 0x19, 0x2a, 0x42, 0xd4, 0x94, 0x18, 0xbe, 0xbb, 0xd6, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1d, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x1c, 0xdf, 0x3c, 0xdf, 0x3c, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x1c, 0xdf, 0x1c, 0xdf, 0x3d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x7d, 0xe7, 0x7d, 0xe7, 0x7d, 0xe7, 0x7d, 0xe7, 0x7d, 0xef, 0x5d, 0xe7, 0x3c, 0xe7, 0x59, 0xc6, 0xf4, 0x9c, 0x0a, 0x3a, 0x08, 0x11, 0x07, 0x11, 0xe7, 0x10, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x94, 0x84, 0xf9, 0xa5, 0xf9, 0xa5, 0xf9, 0xa5, 0xfc, 0xd6, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x79, 0xce, 0x48, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0xac, 0x4a, 
-  0x6d, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x2e, 0x63, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x3c, 0xdf, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x2e, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x47, 0x19, 0x68, 0x21, 0xc9, 0x31, 0xe9, 0x31, 0xc9, 0x31, 0xa9, 0x29, 0xc9, 0x31, 0xc9, 0x31, 0xa8, 0x29, 0xa8, 0x29, 0xa8, 0x31, 0x88, 0x29, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x47, 0x21, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x10, 0xe6, 0x10, 0xc6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x10, 0xc6, 0x08, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0x27, 0x19, 0x88, 0x29, 0xa9, 0x29, 0xc9, 0x31, 0xac, 0x4a, 0xcc, 0x52, 0xcc, 0x52, 0xcc, 0x52, 0x8b, 0x4a, 0x88, 0x21, 0xe7, 0x10, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x07, 0x11, 0x07, 0x11, 0xe7, 0x18, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x90, 0x63, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0x3d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xf0, 0x7b, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x6c, 0x42, 
-  0x2b, 0x3a, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x97, 0xb5, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x3a, 0xbe, 0xb9, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0xb1, 0x6b, 0x07, 0x19, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x4e, 0x63, 0x98, 0xa5, 0xd8, 0xa5, 0xd9, 0xa5, 0xd9, 0xa5, 0x19, 0xae, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x59, 0xce, 0x28, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x4b, 0x42, 
-  0xad, 0x52, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0xea, 0x39, 0xdb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x3d, 0xe7, 0xb8, 0xa5, 0xb9, 0xa5, 0xb8, 0xa5, 0xd8, 0xa5, 0xb9, 0xa5, 0xb9, 0xa5, 0xb4, 0x8c, 0xe9, 0x31, 0xe6, 0x18, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x4e, 0x5b, 0x77, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xd8, 0xa5, 0xd9, 0xa5, 0xbb, 0xce, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x2d, 0x63, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x6b, 0x4a, 
-  0xa8, 0x29, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x31, 0x84, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xbb, 0xce, 0x98, 0x9d, 0xb9, 0xa5, 0xb9, 0xa5, 0xb9, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x53, 0x84, 0xea, 0x39, 0xe6, 0x10, 0xe7, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x0b, 0x3a, 0xb0, 0x6b, 0xf5, 0x8c, 0x98, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xd8, 0xa5, 0xf9, 0xad, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x14, 0x9d, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x8b, 0x4a, 
-  0xac, 0x4a, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x21, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x27, 0x21, 0x19, 0xc6, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0xf9, 0xb5, 0x98, 0x9d, 0xb9, 0x9d, 0xb9, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0xb4, 0x84, 0xb0, 0x6b, 0x4b, 0x42, 0x06, 0x19, 0xe6, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x10, 0x0a, 0x3a, 0x70, 0x63, 0x33, 0x7c, 0xd5, 0x8c, 0x36, 0x95, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xb9, 0xa5, 0xd8, 0xa5, 0xdc, 0xce, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7a, 0xce, 0x47, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x68, 0x21, 0x28, 0x19, 0x08, 0x19, 0x27, 0x19, 0xac, 0x52, 
-  0x0e, 0x5b, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x89, 0x29, 0x68, 0x21, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x19, 0x27, 0x19, 0x2a, 0x42, 0xdb, 0xd6, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0xd8, 0xad, 0x78, 0x95, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x57, 0x9d, 0xd5, 0x8c, 0x12, 0x74, 0x32, 0x7c, 0x12, 0x74, 0xd1, 0x73, 0xf1, 0x73, 0xd1, 0x73, 0x90, 0x6b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x6b, 0x90, 0x6b, 0x90, 0x6b, 0xd1, 0x73, 0xf1, 0x73, 0x12, 0x74, 0xf1, 0x73, 0xb1, 0x6b, 0xd1, 0x6b, 0xf1, 0x73, 0xf1, 0x73, 0x32, 0x7c, 0x32, 0x74, 0xf1, 0x73, 0xd1, 0x73, 0xd1, 0x6b, 0xb1, 0x6b, 0xb1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd2, 0x73, 0xd2, 0x73, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x73, 0x12, 0x74, 0x12, 0x74, 0x33, 0x7c, 0x53, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x33, 0x7c, 0x13, 0x74, 0xf2, 0x73, 0xf2, 0x73, 0xf2, 0x73, 0xd2, 0x73, 0xd1, 0x6b, 0xd2, 0x73, 0x12, 0x74, 0xd2, 0x73, 0xd2, 0x73, 0xf2, 0x73, 0x12, 0x74, 0xf2, 0x73, 0x12, 0x74, 0x12, 0x7c, 0x33, 0x7c, 0x53, 0x7c, 0x53, 0x7c, 0x33, 0x7c, 0xd1, 0x6b, 0x4f, 0x5b, 0x0e, 0x5b, 0x2f, 0x5b, 0x0e, 0x5b, 0x0e, 0x5b, 0x12, 0x7c, 0xd5, 0x8c, 0x16, 0x95, 0xf5, 0x8c, 0x36, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xd9, 0xa5, 0x3a, 0xbe, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xfb, 0xde, 0x8b, 0x4a, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x21, 0x68, 0x21, 0xa9, 0x29, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x8c, 0x4a, 
-  0x6f, 0x63, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x88, 0x29, 0xc9, 0x29, 0x48, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x27, 0x21, 0x27, 0x21, 0x0d, 0x63, 0xfc, 0xde, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xe7, 0xd8, 0xad, 0x78, 0x95, 0xb8, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x77, 0x9d, 0x37, 0x95, 0xf5, 0x8c, 0x16, 0x95, 0x16, 0x95, 0x53, 0x7c, 0xb5, 0x84, 0xf6, 0x8c, 0xd5, 0x84, 0xd5, 0x8c, 0xd5, 0x8c, 0xd5, 0x8c, 0xd5, 0x8c, 0xd5, 0x8c, 0x16, 0x8d, 0x16, 0x95, 0x57, 0x95, 0x37, 0x95, 0x36, 0x95, 0x37, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x16, 0x95, 0xd5, 0x84, 0xd5, 0x8c, 0x94, 0x84, 0x74, 0x7c, 0x53, 0x7c, 0xf2, 0x73, 0x12, 0x74, 0xf6, 0x8c, 0x36, 0x95, 0x57, 0x95, 0x57, 0x95, 0x77, 0x9d, 0x78, 0x9d, 0x77, 0x95, 0x78, 0x95, 0x78, 0x95, 0x78, 0x95, 0x78, 0x95, 0x78, 0x9d, 0x77, 0x9d, 0x57, 0x95, 0x16, 0x8d, 0xf6, 0x8c, 0x16, 0x95, 0x16, 0x8d, 0xb5, 0x84, 0xf5, 0x8c, 0x16, 0x8d, 0x16, 0x8d, 0xf5, 0x8c, 0x16, 0x8d, 0x57, 0x95, 0x57, 0x9d, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x57, 0x9d, 0x16, 0x95, 0x16, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x57, 0x95, 0x77, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xd9, 0xa5, 0x19, 0xb6, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xe7, 0x1c, 0xdf, 0x0d, 0x63, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x48, 0x21, 0xeb, 0x31, 0xaa, 0x29, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x2f, 0x5b, 
-  0x90, 0x6b, 0x69, 0x29, 0x07, 0x19, 0xe7, 0x18, 0x47, 0x21, 0xc9, 0x29, 0xa9, 0x29, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x27, 0x21, 0x48, 0x21, 0x4f, 0x63, 0xfc, 0xde, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9b, 0xce, 0x57, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x77, 0x9d, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0xd5, 0x84, 0xf5, 0x8c, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x95, 0x57, 0x95, 0x36, 0x95, 0x36, 0x95, 0x16, 0x95, 0xb5, 0x84, 0x94, 0x84, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xd9, 0xa5, 0x39, 0xb6, 0x5d, 0xe7, 0x7d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xe7, 0x3c, 0xdf, 0x2e, 0x63, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x0b, 0x32, 0x4c, 0x3a, 0x89, 0x29, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0xee, 0x5a, 
-  0x4e, 0x4a, 0xca, 0x31, 0x08, 0x19, 0xe7, 0x18, 0x07, 0x19, 0xa9, 0x29, 0xca, 0x29, 0x89, 0x29, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x2e, 0x63, 0x1c, 0xdf, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x5d, 0xe7, 0xd8, 0xb5, 0x37, 0x8d, 0x98, 0x95, 0x98, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x77, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x77, 0x95, 0x78, 0x95, 0x57, 0x95, 0x98, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0xa5, 0x78, 0xa5, 0x98, 0xa5, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xd9, 0xa5, 0xd8, 0xa5, 0x9a, 0xc6, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x3c, 0xe7, 0xcf, 0x73, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0xca, 0x29, 0x4c, 0x3a, 0x6c, 0x3a, 0x48, 0x21, 0xe7, 0x18, 0x07, 0x19, 0xa9, 0x29, 0xce, 0x5a, 
-  0x00, 0x00, 0x6c, 0x42, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x89, 0x21, 0xca, 0x29, 0xca, 0x29, 0x89, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x0d, 0x5b, 0xbb, 0xd6, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xdb, 0xd6, 0x98, 0xa5, 0x57, 0x8d, 0x78, 0x95, 0x98, 0x95, 0x98, 0x95, 0x98, 0x95, 0x98, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x78, 0x9d, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x78, 0x95, 0x78, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xd9, 0xa5, 0xd8, 0xa5, 0x39, 0xb6, 0x3c, 0xdf, 0x9d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xfc, 0xd6, 0x4e, 0x63, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x68, 0x21, 0x2c, 0x32, 0x4c, 0x3a, 0x4c, 0x32, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x6c, 0x4a, 0xb0, 0x5a, 
-  0x00, 0x00, 0x70, 0x5b, 0x27, 0x19, 0xe7, 0x18, 0xe8, 0x18, 0x28, 0x19, 0xca, 0x29, 0xca, 0x29, 0xea, 0x29, 0x89, 0x21, 0x07, 0x19, 0x28, 0x21, 0x28, 0x19, 0x28, 0x21, 0x48, 0x21, 0x28, 0x21, 0xe9, 0x39, 0xd8, 0xb5, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x1c, 0xdf, 0x5a, 0xbe, 0x77, 0x9d, 0x37, 0x8d, 0x78, 0x95, 0x78, 0x95, 0x57, 0x95, 0x57, 0x95, 0x77, 0x95, 0x77, 0x95, 0x77, 0x95, 0x77, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x57, 0x95, 0x78, 0x95, 0x78, 0x95, 0x78, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x97, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x95, 0x78, 0x95, 0x57, 0x95, 0x57, 0x95, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x95, 0x78, 0x95, 0x78, 0x95, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x77, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x57, 0x95, 0x98, 0x9d, 0x7a, 0xc6, 0x3c, 0xdf, 0x9d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x59, 0xc6, 0x0a, 0x3a, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x48, 0x21, 0x0b, 0x32, 0x2b, 0x32, 0x4c, 0x32, 0xea, 0x29, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xed, 0x5a, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x84, 0xc9, 0x31, 0xe7, 0x18, 0xe7, 0x18, 0xe8, 0x18, 0xaa, 0x29, 0xca, 0x29, 0xea, 0x29, 0xca, 0x29, 0x69, 0x21, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x27, 0x21, 0x47, 0x21, 0x72, 0x8c, 0x1c, 0xdf, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x3d, 0xe7, 0xdb, 0xd6, 0x59, 0xc6, 0x19, 0xbe, 0xf8, 0xb5, 0xf8, 0xb5, 0xf8, 0xb5, 0xf8, 0xb5, 0x18, 0xbe, 0x18, 0xb6, 0xf8, 0xb5, 0xf8, 0xb5, 0xf8, 0xb5, 0xd7, 0xb5, 0xd8, 0xb5, 0xd8, 0xb5, 0xf8, 0xb5, 0xf8, 0xb5, 0x19, 0xbe, 0x39, 0xbe, 0x39, 0xbe, 0x39, 0xbe, 0x39, 0xbe, 0x19, 0xbe, 0x19, 0xb6, 0x19, 0xb6, 0x19, 0xb6, 0x18, 0xb6, 0x19, 0xbe, 0x19, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x19, 0xbe, 0x19, 0xbe, 0x18, 0xbe, 0x19, 0xbe, 0x39, 0xbe, 0x39, 0xbe, 0x39, 0xbe, 0x19, 0xbe, 0x19, 0xbe, 0xf8, 0xbd, 0xf8, 0xbd, 0xd8, 0xb5, 0xd8, 0xb5, 0xd8, 0xb5, 0xf8, 0xb5, 0xf8, 0xbd, 0x18, 0xbe, 0x39, 0xbe, 0x19, 0xbe, 0x39, 0xbe, 0x18, 0xbe, 0x19, 0xbe, 0x18, 0xbe, 0xf8, 0xb5, 0xf8, 0xb5, 0xf8, 0xbd, 0xf8, 0xb5, 0xf8, 0xb5, 0xf8, 0xb5, 0xf8, 0xbd, 0xf8, 0xbd, 0xf8, 0xbd, 0xf8, 0xb5, 0xd8, 0xb5, 0xd8, 0xb5, 0x97, 0xad, 0x56, 0xa5, 0x56, 0xa5, 0x56, 0xa5, 0x76, 0xa5, 0x97, 0xad, 0xf8, 0xb5, 0x19, 0xbe, 0x79, 0xce, 0x1c, 0xdf, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x5d, 0xe7, 0x14, 0x9d, 0x47, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x68, 0x21, 0x0b, 0x32, 0x0b, 0x32, 0x0b, 0x32, 0x2c, 0x32, 0x48, 0x21, 0xe6, 0x18, 0xe7, 0x18, 0xe9, 0x31, 0xd3, 0x6c, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x84, 0x6d, 0x4a, 0xe7, 0x10, 0xe7, 0x18, 0xe8, 0x18, 0x28, 0x19, 0xeb, 0x31, 0xea, 0x29, 0xca, 0x29, 0xca, 0x29, 0x69, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x48, 0x21, 0x2a, 0x42, 0xb7, 0xb5, 0x5d, 0xe7, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xef, 0x9d, 0xef, 0x7d, 0xef, 0x9e, 0xef, 0x59, 0xbe, 0xed, 0x52, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x27, 0x19, 0x68, 0x21, 0x0b, 0x32, 0x0b, 0x2a, 0x0b, 0x32, 0x0b, 0x32, 0xeb, 0x31, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xad, 0x4a, 0x75, 0xad, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x8e, 0x52, 0xa9, 0x29, 0xe7, 0x18, 0x08, 0x19, 0x08, 0x19, 0x89, 0x29, 0xeb, 0x31, 0xea, 0x29, 0xca, 0x29, 0xca, 0x29, 0x69, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x21, 0x28, 0x21, 0x28, 0x21, 0x27, 0x21, 0xec, 0x5a, 0xf8, 0xbd, 0x5d, 0xe7, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9e, 0xef, 0x7e, 0xef, 0x7a, 0xce, 0xd0, 0x73, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x69, 0x21, 0x0b, 0x32, 0x0b, 0x2a, 0x0b, 0x2a, 0x0b, 0x2a, 0x0b, 0x2a, 0x48, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x0e, 0x53, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x32, 0xe7, 0x10, 0xe8, 0x18, 0x08, 0x19, 0x08, 0x19, 0xca, 0x29, 0xeb, 0x31, 0xea, 0x29, 0xca, 0x29, 0xca, 0x29, 0x69, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x28, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x6a, 0x4a, 0x35, 0x9d, 0xdc, 0xd6, 0x9e, 0xef, 0x9e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xef, 0x9d, 0xef, 0xdb, 0xd6, 0x56, 0xa5, 0xed, 0x5a, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x89, 0x29, 0x0b, 0x32, 0x0b, 0x32, 0x0b, 0x2a, 0x0b, 0x2a, 0x0b, 0x2a, 0xa9, 0x29, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x6b, 0x4a, 0xd1, 0x6b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x42, 0xaa, 0x29, 0xe8, 0x18, 0xe8, 0x18, 0x08, 0x19, 0x28, 0x19, 0xeb, 0x31, 0xeb, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xaa, 0x29, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x27, 0x21, 0x27, 0x21, 0x47, 0x21, 0x4e, 0x63, 0x56, 0xa5, 0x7a, 0xce, 0x3d, 0xe7, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0xbb, 0xce, 0x55, 0xa5, 0x4e, 0x63, 0x48, 0x21, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0xea, 0x29, 0x2b, 0x32, 0x0b, 0x32, 0x0b, 0x32, 0x0b, 0x32, 0x0b, 0x2a, 0xeb, 0x29, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0x26, 0x21, 0xed, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4e, 0x3a, 0x29, 0x19, 0xe8, 0x18, 0x08, 0x19, 0x08, 0x19, 0x69, 0x21, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xca, 0x29, 0x68, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0xa9, 0x31, 0x6f, 0x6b, 0x15, 0x9d, 0x59, 0xc6, 0x1c, 0xdf, 0x7d, 0xe7, 0x7d, 0xe7, 0x7d, 0xe7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0xfc, 0xd6, 0x79, 0xc6, 0xb6, 0xb5, 0x72, 0x8c, 0x8c, 0x52, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x68, 0x21, 0x0b, 0x32, 0x0b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x0b, 0x32, 0x0b, 0x32, 0x0b, 0x2a, 0x48, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x2a, 0x4a, 0xb1, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x42, 0x4e, 0x3a, 0xe8, 0x10, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0xaa, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xa9, 0x29, 0x28, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x88, 0x29, 0x4b, 0x42, 0x8f, 0x6b, 0x32, 0x7c, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x52, 0x84, 0x52, 0x84, 0x52, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x51, 0x7c, 0x11, 0x7c, 0x11, 0x7c, 0xf1, 0x73, 0xf1, 0x73, 0xf1, 0x73, 0x11, 0x7c, 0x11, 0x7c, 0x31, 0x7c, 0x31, 0x7c, 0x32, 0x7c, 0x51, 0x7c, 0x51, 0x7c, 0x51, 0x7c, 0x52, 0x84, 0x72, 0x84, 0x72, 0x84, 0x72, 0x84, 0x52, 0x84, 0x52, 0x84, 0x32, 0x7c, 0x11, 0x7c, 0xf1, 0x73, 0xd0, 0x73, 0xd0, 0x73, 0xd0, 0x73, 0xd0, 0x73, 0xf1, 0x7b, 0xd0, 0x73, 0xb0, 0x73, 0x8f, 0x6b, 0x8f, 0x6b, 0x6f, 0x6b, 0x6f, 0x6b, 0x8f, 0x6b, 0x8f, 0x6b, 0x8f, 0x6b, 0x8f, 0x6b, 0x6f, 0x63, 0x0e, 0x5b, 0x6c, 0x42, 0x8c, 0x4a, 0x2b, 0x42, 0xea, 0x39, 0xc9, 0x31, 0x68, 0x21, 0x48, 0x21, 0x48, 0x21, 0x28, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x48, 0x21, 0xea, 0x29, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x0b, 0x32, 0x48, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x27, 0x21, 0x0d, 0x5b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4b, 0x8a, 0x21, 0xe8, 0x18, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0xca, 0x29, 0xeb, 0x31, 0xeb, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xca, 0x29, 0x69, 0x21, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x48, 0x19, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 0x48, 0x19, 0x29, 0x19, 0x28, 0x19, 0x29, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x28, 0x21, 0x28, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0xca, 0x29, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x0b, 0x32, 0x89, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0x4a, 0x42, 0x8f, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x6c, 0xae, 0x42, 0x08, 0x19, 0xe8, 0x18, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0xca, 0x31, 0xea, 0x31, 0xeb, 0x31, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xca, 0x29, 0xca, 0x29, 0x69, 0x21, 0x28, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x28, 0x21, 0x28, 0x21, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x48, 0x21, 0xea, 0x31, 0x4b, 0x32, 0x4c, 0x32, 0x4b, 0x32, 0x2b, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0xa9, 0x29, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x67, 0x29, 0xaf, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x53, 0xeb, 0x29, 0xe8, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x21, 0xca, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xaa, 0x29, 0x69, 0x21, 0x28, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x19, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x28, 0x21, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x48, 0x21, 0x89, 0x29, 0xea, 0x31, 0x2b, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2b, 0x32, 0x2b, 0x2a, 0x2b, 0x32, 0xa9, 0x29, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x67, 0x29, 0xcc, 0x52, 0x92, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xaf, 0x42, 0x8a, 0x21, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0xaa, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x31, 0xca, 0x29, 0xa9, 0x29, 0x68, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x68, 0x21, 0x89, 0x29, 0xca, 0x29, 0x0a, 0x32, 0x0b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2b, 0x2a, 0x0b, 0x2a, 0xa9, 0x29, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0x8b, 0x4a, 0x11, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x32, 0x49, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x89, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0x0b, 0x2a, 0x0b, 0x2a, 0x0b, 0x2a, 0xeb, 0x29, 0xeb, 0x29, 0xaa, 0x29, 0x89, 0x21, 0x68, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x68, 0x21, 0xa9, 0x29, 0xca, 0x29, 0xea, 0x29, 0xea, 0x29, 0x0b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2c, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x4c, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2b, 0x32, 0x68, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xac, 0x52, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x29, 0x49, 0x21, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x21, 0xca, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0x0b, 0x2a, 0x0b, 0x2a, 0xeb, 0x29, 0xeb, 0x29, 0xca, 0x29, 0xaa, 0x29, 0x89, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x68, 0x21, 0x89, 0x21, 0xa9, 0x29, 0xca, 0x29, 0xea, 0x29, 0xeb, 0x29, 0x0b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x2c, 0x2a, 0xea, 0x29, 0x27, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0x6a, 0x4a, 0x8e, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x32, 0x69, 0x21, 0x07, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x89, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xeb, 0x29, 0xca, 0x29, 0xca, 0x29, 0xaa, 0x29, 0xa9, 0x21, 0x89, 0x21, 0x69, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x21, 0x48, 0x21, 0x68, 0x21, 0x89, 0x21, 0xa9, 0x29, 0xca, 0x29, 0xea, 0x29, 0xeb, 0x29, 0x0b, 0x32, 0x0c, 0x32, 0x0c, 0x32, 0x0c, 0x32, 0x2c, 0x32, 0x2c, 0x2a, 0x2c, 0x2a, 0x0b, 0x2a, 0x89, 0x21, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x20, 0x6a, 0x42, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6d, 0x3a, 0xaa, 0x29, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x21, 0xa9, 0x29, 0xca, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xea, 0x29, 0xea, 0x29, 0xea, 0x29, 0xeb, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xa9, 0x29, 0xa9, 0x29, 0x89, 0x21, 0x69, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x21, 0x48, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x19, 0x48, 0x21, 0x68, 0x21, 0x89, 0x21, 0xa9, 0x29, 0xca, 0x29, 0xea, 0x29, 0x0b, 0x2a, 0x0b, 0x32, 0x0b, 0x32, 0x0b, 0x32, 0x0c, 0x32, 0x0b, 0x2a, 0x0b, 0x2a, 0xa9, 0x21, 0x06, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe6, 0x18, 0xa8, 0x31, 0xec, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4d, 0x3a, 0xaa, 0x29, 0xe8, 0x18, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x19, 0x89, 0x21, 0xca, 0x29, 0xca, 0x29, 0xea, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xaa, 0x29, 0xa9, 0x29, 0xa9, 0x21, 0x89, 0x21, 0x89, 0x21, 0x88, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x48, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x28, 0x21, 0x48, 0x19, 0x48, 0x21, 0x68, 0x21, 0x89, 0x21, 0xa9, 0x29, 0xca, 0x29, 0xea, 0x29, 0xeb, 0x29, 0x0b, 0x2a, 0x0b, 0x2a, 0x0b, 0x32, 0xeb, 0x31, 0xa9, 0x29, 0x27, 0x19, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0x27, 0x21, 0xc8, 0x31, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x70, 0x5b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x3a, 0xcb, 0x29, 0x28, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x68, 0x21, 0xa9, 0x29, 0xca, 0x29, 0xca, 0x29, 0xa9, 0x29, 0xaa, 0x29, 0xaa, 0x29, 0xa9, 0x29, 0xa9, 0x21, 0xa9, 0x21, 0x89, 0x21, 0x89, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x48, 0x21, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x28, 0x19, 0x48, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x28, 0x21, 0x48, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x21, 0x28, 0x21, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x28, 0x19, 0x48, 0x19, 0x48, 0x21, 0x68, 0x21, 0x88, 0x21, 0xa9, 0x21, 0xca, 0x29, 0xea, 0x29, 0xea, 0x31, 0x0a, 0x32, 0xca, 0x29, 0x68, 0x21, 0x06, 0x19, 0x06, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe7, 0x18, 0x88, 0x29, 0xac, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x53, 0x6b, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x3a, 0x2c, 0x3a, 0x89, 0x21, 0x07, 0x11, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x27, 0x21, 0x47, 0x21, 0x68, 0x21, 0x88, 0x21, 0x89, 0x21, 0x89, 0x29, 0x89, 0x29, 0x88, 0x21, 0x88, 0x21, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x48, 0x21, 0x47, 0x21, 0x47, 0x21, 0x27, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x47, 0x21, 0x28, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x21, 0x48, 0x21, 0x48, 0x21, 0x68, 0x21, 0x68, 0x29, 0x68, 0x21, 0x68, 0x21, 0x47, 0x21, 0x07, 0x19, 0x06, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0xe6, 0x18, 0x06, 0x19, 0xc9, 0x31, 0xd1, 0x73, 0x00, 0x00, 0xff, 0xff, 0x18, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x6b, 0xce, 0x4a, 0x2b, 0x3a, 0x68, 0x21, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x07, 0x21, 0x07, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x21, 0x27, 0x21, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0xa9, 0x31, 0x0a, 0x42, 0xab, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x9c, 0x50, 0x5b, 0x0f, 0x53, 0xea, 0x31, 0x8a, 0x21, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x21, 0x07, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0xe6, 0x18, 0xa9, 0x31, 0xe9, 0x39, 0xcd, 0x5a, 0xab, 0x5a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x87, 0xda, 0x9c, 0xaf, 0x42, 0x4d, 0x3a, 0xcb, 0x31, 0x28, 0x19, 0xe7, 0x18, 0xe7, 0x18, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x27, 0x21, 0x89, 0x31, 0xc9, 0x31, 0xac, 0x4a, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x4a, 0xaf, 0x4a, 0x4d, 0x42, 0x2c, 0x3a, 0xa9, 0x29, 0x28, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x19, 0x07, 0x21, 0x07, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x21, 0x07, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x19, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x21, 0x27, 0x21, 0xa9, 0x31, 0x0a, 0x3a, 0x6c, 0x4a, 0xcd, 0x52, 0x70, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb1, 0x63, 0x6c, 0x42, 0x2c, 0x3a, 0x6d, 0x42, 0x0b, 0x3a, 0xa9, 0x29, 0xa9, 0x29, 0xa9, 0x31, 0x69, 0x29, 0xaa, 0x29, 0x8a, 0x29, 0xaa, 0x31, 0xaa, 0x29, 0x89, 0x29, 0xaa, 0x29, 0xeb, 0x31, 0xeb, 0x39, 0xca, 0x31, 0xca, 0x31, 0xeb, 0x39, 0xeb, 0x39, 0x0b, 0x3a, 0x0b, 0x3a, 0xeb, 0x31, 0xca, 0x31, 0xeb, 0x31, 0xeb, 0x39, 0x0b, 0x3a, 0x0b, 0x3a, 0xeb, 0x39, 0x0b, 0x3a, 0xeb, 0x39, 0x0b, 0x3a, 0x0b, 0x3a, 0x2b, 0x3a, 0x0b, 0x3a, 0xeb, 0x39, 0x2b, 0x3a, 0x0b, 0x3a, 0x0b, 0x3a, 0xea, 0x31, 0xca, 0x31, 0xca, 0x31, 0x0b, 0x3a, 0xca, 0x31, 0xca, 0x31, 0xaa, 0x31, 0x89, 0x29, 0xca, 0x31, 0xea, 0x31, 0xaa, 0x29, 0xca, 0x31, 0xca, 0x31, 0xea, 0x39, 0xea, 0x39, 0xca, 0x31, 0xca, 0x31, 0xca, 0x31, 0xca, 0x31, 0x0b, 0x3a, 0xeb, 0x31, 0xea, 0x31, 0xea, 0x31, 0x0b, 0x3a, 0xeb, 0x39, 0x0b, 0x3a, 0x2b, 0x3a, 0x0b, 0x3a, 0xeb, 0x39, 0x0b, 0x3a, 0x0b, 0x3a, 0xeb, 0x39, 0xeb, 0x39, 0xca, 0x31, 0x69, 0x21, 0xa9, 0x29, 0xa9, 0x31, 0x48, 0x21, 0x89, 0x29, 0x89, 0x29, 0x69, 0x29, 0x89, 0x29, 0x6c, 0x4a, 0xac, 0x4a, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x42, 0x81, 0x8f, 0x96, 0xa2, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xd0, 0xca, 0xc7, 0xc6, 0xc6, 0xc6, 0xba, 0x8d, 0x71, 0x3a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x47, 0x95, 0xca, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc5, 0x8f, 0x3a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x5b, 0xaa, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe1, 0x80, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x8f, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xb5, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x9c, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8f, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x99, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x46, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x25, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x39, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x23, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x03, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x20, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0x00, 0x00, 
-  0x00, 0x08, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x04, 0x00, 
-  0x00, 0x2b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x15, 0x00, 
-  0x00, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x00, 
-  0x00, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 
-  0x00, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x03, 
-  0x1a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x14, 
-  0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 
-  0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 
-  0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 
-  0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 
-  0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 
-  0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 
-  0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 
-  0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 
-  0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 
-  0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 
-  0x46, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x2a, 
-  0x07, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x14, 
-  0x00, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x06, 
-  0x00, 0x28, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x11, 0x00, 
-  0x00, 0x02, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x05, 0x00, 
-  0x00, 0x02, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x03, 0x00, 
-  0x00, 0x00, 0x1c, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x11, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2e, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x27, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7d, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x97, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x42, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6c, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x71, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3c, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x57, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xb9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x2d, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x91, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x86, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5e, 0x96, 0xcb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xbc, 0x3f, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x5a, 0xa4, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xc2, 0x70, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x5d, 0xac, 0xf1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0x53, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x17, 0x63, 0xbc, 0xc8, 0xd0, 0xcf, 0xc8, 0xd1, 0xe5, 0xe7, 0xe6, 0xe6, 0xe6, 0xe5, 0xe2, 0xe8, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xc7, 0xcb, 0xdc, 0xc1, 0xbc, 0xcf, 0xa7, 0x5d, 0x36, 0x22, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x24, 0x4e, 0x00, 0x00, 0xd8, 0xdb, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x88, 0xb0, 0x63, 0x0e, 0x53, 0xed, 0x52, 0x4b, 0x3a, 0xa8, 0x21, 0x88, 0x29, 0x8c, 0x42, 0x8c, 0x4a,
+  0x03, 0x8c, 0x42, 0x82, 0x8c, 0x4a, 0xac, 0x4a, 0x03, 0x8c, 0x4a, 0x02, 0xac, 0x4a, 0x83, 0x8c, 0x4a, 0xac, 0x4a, 0x8c, 0x4a, 0x02, 0x6b, 0x42, 0x81, 0x2b, 0x3a, 0x02, 0x0a, 0x3a, 0x02, 0xea,
+  0x31, 0x8a, 0x0a, 0x32, 0x2b, 0x3a, 0x4b, 0x42, 0x6b, 0x42, 0x6c, 0x42, 0x6b, 0x42, 0x4b, 0x42, 0x4b, 0x3a, 0x2b, 0x3a, 0x0a, 0x3a, 0x03, 0x0a, 0x32, 0x02, 0x0a, 0x3a, 0x81, 0x2b, 0x3a, 0x02,
+  0x4b, 0x3a, 0x82, 0x2a, 0x3a, 0x0a, 0x3a, 0x02, 0x0a, 0x32, 0x83, 0xea, 0x31, 0xc9, 0x31, 0xc9, 0x29, 0x02, 0xea, 0x31, 0x81, 0xc9, 0x31, 0x09, 0xea, 0x31, 0x8c, 0xca, 0x31, 0x68, 0x21, 0x47,
+  0x21, 0x67, 0x21, 0x68, 0x21, 0x88, 0x21, 0x0a, 0x32, 0x2a, 0x3a, 0x88, 0x21, 0x4b, 0x3a, 0xed, 0x52, 0x8f, 0x63, 0x0d, 0x00, 0x00, 0x02, 0x2f, 0x5b, 0x26, 0x00, 0x00, 0x85, 0x4e, 0x5b, 0x2a,
+  0x3a, 0xe9, 0x31, 0x88, 0x29, 0x68, 0x21, 0x02, 0xe6, 0x18, 0x02, 0x06, 0x19, 0x02, 0x06, 0x11, 0x06, 0xe6, 0x10, 0x02, 0xe6, 0x18, 0x29, 0xe6, 0x10, 0x03, 0x06, 0x11, 0x82, 0x07, 0x11, 0x06,
+  0x11, 0x02, 0xe6, 0x10, 0x04, 0xe7, 0x10, 0x03, 0xe6, 0x10, 0x04, 0x06, 0x11, 0x02, 0xe6, 0x10, 0x85, 0x47, 0x21, 0x87, 0x29, 0xe9, 0x31, 0x8c, 0x42, 0x0e, 0x53, 0x2e, 0x00, 0x00, 0x86, 0x12,
+  0x74, 0xed, 0x52, 0xc9, 0x29, 0x47, 0x21, 0x06, 0x11, 0x07, 0x11, 0x02, 0x06, 0x11, 0x02, 0x07, 0x11, 0x81, 0x06, 0x11, 0x02, 0x06, 0x19, 0x06, 0xe6, 0x10, 0x81, 0x06, 0x11, 0x02, 0xe6, 0x18,
+  0x02, 0x06, 0x11, 0x28, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x02, 0x07, 0x11, 0x05, 0xe6, 0x10, 0x05, 0x06, 0x11, 0x09, 0xe6, 0x10, 0x83, 0x88, 0x29, 0xe9, 0x31, 0x0e, 0x5b, 0x2a, 0x00, 0x00, 0x84,
+  0x6b, 0x42, 0xe9, 0x31, 0x88, 0x21, 0x06, 0x11, 0x05, 0x07, 0x11, 0x81, 0x06, 0x11, 0x02, 0x07, 0x11, 0x81, 0x06, 0x11, 0x02, 0x06, 0x19, 0x05, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x02, 0xe6, 0x18,
+  0x02, 0x06, 0x11, 0x25, 0xe6, 0x10, 0x81, 0x06, 0x11, 0x02, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x0a, 0x07, 0x11, 0x02, 0x06, 0x11, 0x82, 0xe6, 0x10, 0xe6, 0x18, 0x09, 0xe6, 0x10, 0x83, 0x26, 0x19,
+  0xe9, 0x31, 0x0e, 0x5b, 0x26, 0x00, 0x00, 0x84, 0x90, 0x6b, 0xa9, 0x29, 0x07, 0x19, 0xe6, 0x10, 0x08, 0x07, 0x11, 0x03, 0x07, 0x19, 0x81, 0x06, 0x19, 0x0c, 0xe6, 0x18, 0x81, 0xe7, 0x18, 0x12,
+  0xe6, 0x18, 0x84, 0xe6, 0x10, 0xe6, 0x18, 0xe6, 0x10, 0xc6, 0x10, 0x07, 0xe6, 0x10, 0x02, 0xe6, 0x18, 0x06, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x03, 0xe7, 0x18, 0x0b, 0xe7, 0x10, 0x82, 0x07, 0x11,
+  0xe7, 0x10, 0x02, 0xe6, 0x10, 0x81, 0x06, 0x11, 0x09, 0xe6, 0x10, 0x83, 0x27, 0x19, 0xca, 0x31, 0xac, 0x4a, 0x22, 0x00, 0x00, 0x83, 0x36, 0x9d, 0xcc, 0x52, 0x67, 0x21, 0x02, 0xe7, 0x10, 0x09,
+  0x07, 0x11, 0x86, 0x26, 0x19, 0xc8, 0x29, 0x8b, 0x4a, 0xaf, 0x6b, 0xf0, 0x7b, 0x11, 0x7c, 0x0a, 0x31, 0x7c, 0x81, 0x11, 0x7c, 0x02, 0x10, 0x7c, 0x03, 0x11, 0x7c, 0x03, 0x31, 0x7c, 0x03, 0x10,
+  0x7c, 0x02, 0x11, 0x7c, 0x02, 0x10, 0x7c, 0x02, 0xf0, 0x7b, 0x06, 0x10, 0x7c, 0x81, 0x11, 0x7c, 0x02, 0x31, 0x7c, 0x82, 0x10, 0x7c, 0x11, 0x7c, 0x02, 0x10, 0x7c, 0x02, 0xf0, 0x7b, 0x05, 0x10,
+  0x7c, 0x81, 0x30, 0x7c, 0x02, 0x30, 0x84, 0x02, 0x31, 0x84, 0x82, 0x51, 0x84, 0x51, 0x8c, 0x02, 0x51, 0x84, 0x02, 0x51, 0x8c, 0x04, 0x71, 0x8c, 0x86, 0x51, 0x8c, 0x30, 0x84, 0x8e, 0x6b, 0x69,
+  0x4a, 0x66, 0x29, 0xc5, 0x10, 0x08, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x83, 0x27, 0x19, 0xc9, 0x31, 0xce, 0x52, 0x1f, 0x00, 0x00, 0x84, 0x8f, 0x6b, 0x09, 0x3a, 0xe6, 0x10, 0xe7, 0x10, 0x03, 0x07,
+  0x11, 0x04, 0x07, 0x19, 0x87, 0x27, 0x19, 0xaf, 0x73, 0x76, 0xad, 0x9a, 0xce, 0x5c, 0xe7, 0xde, 0xf7, 0xfe, 0xf7, 0x05, 0xde, 0xff, 0x82, 0xdd, 0xff, 0xde, 0xff, 0x02, 0xdd, 0xff, 0x06, 0xde,
+  0xff, 0x81, 0xfe, 0xff, 0x2f, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x87, 0xbe, 0xf7, 0x3b, 0xe7, 0x58, 0xc6, 0xd2, 0x94, 0x6a, 0x4a, 0xc5, 0x10, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x83,
+  0xe6, 0x10, 0x88, 0x29, 0xea, 0x31, 0x1c, 0x00, 0x00, 0x84, 0x53, 0x7c, 0x4a, 0x42, 0x06, 0x19, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x86, 0x07, 0x19, 0x27, 0x19, 0x8f, 0x63, 0xd7,
+  0xb5, 0x3c, 0xe7, 0xde, 0xf7, 0x40, 0xde, 0xff, 0x81, 0xdd, 0xff, 0x03, 0xde, 0xff, 0x0b, 0xfe, 0xff, 0x84, 0xde, 0xf7, 0xda, 0xd6, 0xd2, 0x94, 0x46, 0x21, 0x02, 0xe6, 0x10, 0x03, 0xe7, 0x10,
+  0x02, 0x07, 0x11, 0x83, 0xe6, 0x10, 0xe9, 0x31, 0x74, 0x84, 0x19, 0x00, 0x00, 0x82, 0x53, 0x84, 0xac, 0x4a, 0x02, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x84, 0x67, 0x21, 0xd3, 0x8c,
+  0xfb, 0xd6, 0xde, 0xf7, 0x49, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x84, 0x5c, 0xe7, 0x13, 0x9d, 0x67, 0x29, 0xe6, 0x18, 0x03, 0xe7, 0x10, 0x85, 0x07, 0x11, 0xe7,
+  0x10, 0xe6, 0x10, 0x88, 0x29, 0xee, 0x5a, 0x17, 0x00, 0x00, 0x82, 0x73, 0x84, 0x4b, 0x42, 0x02, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x85, 0x07, 0x11, 0x07, 0x19, 0x51, 0x84, 0x1b, 0xdf, 0xde, 0xf7,
+  0x05, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x0f, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x26, 0xde, 0xff, 0x14, 0xfe, 0xff, 0x83, 0x5c,
+  0xe7, 0xd3, 0x94, 0x06, 0x19, 0x03, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x82, 0x27, 0x19, 0x07, 0x19, 0x15, 0x00, 0x00, 0x82, 0xd0, 0x73, 0x26, 0x19, 0x02, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x02, 0x07,
+  0x11, 0x83, 0xcc, 0x52, 0x79, 0xce, 0xde, 0xf7, 0x07, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x0e, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff,
+  0x02, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x14, 0xde, 0xff, 0x18, 0xfe, 0xff, 0x82, 0xba, 0xd6, 0xcc, 0x5a, 0x02, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x83, 0xe7, 0x18, 0x07, 0x19, 0xed, 0x52, 0x13, 0x00,
+  0x00, 0x02, 0x88, 0x29, 0x02, 0xe6, 0x10, 0x88, 0x07, 0x11, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x19, 0xb3, 0x94, 0x7d, 0xef, 0xbe, 0xf7, 0xde, 0xf7, 0x03, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde,
+  0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x1c, 0xfe, 0xff, 0x0f, 0xde, 0xff, 0x1e,
+  0xfe, 0xff, 0x82, 0xbd, 0xf7, 0xd3, 0x9c, 0x02, 0xe6, 0x18, 0x81, 0xe7, 0x18, 0x03, 0xe7, 0x10, 0x82, 0xa9, 0x29, 0x6b, 0x42, 0x11, 0x00, 0x00, 0x82, 0xf1, 0x73, 0x27, 0x19, 0x02, 0xe6, 0x10,
+  0x88, 0x06, 0x11, 0x07, 0x11, 0x07, 0x19, 0xc8, 0x31, 0x17, 0xbe, 0xbe, 0xf7, 0xbf, 0xf7, 0xde, 0xf7, 0x03, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xde, 0xff,
+  0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x1c, 0xfe, 0xff, 0x0f, 0xde, 0xff, 0x0d, 0xfe, 0xff, 0x04, 0xff, 0xff, 0x02, 0xfe,
+  0xff, 0x81, 0xff, 0xff, 0x0c, 0xfe, 0xff, 0x83, 0xf7, 0xbd, 0x67, 0x29, 0xe6, 0x18, 0x02, 0xe7, 0x18, 0x84, 0xe7, 0x10, 0xe7, 0x18, 0x47, 0x21, 0xb1, 0x6b, 0x0f, 0x00, 0x00, 0x82, 0xf5, 0x94,
+  0xe9, 0x31, 0x02, 0xe6, 0x10, 0x81, 0x06, 0x11, 0x02, 0x07, 0x11, 0x82, 0x8b, 0x4a, 0xfb, 0xde, 0x02, 0xbe, 0xf7, 0x81, 0xde, 0xf7, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x09,
+  0xfe, 0xff, 0x03, 0xde, 0xff, 0x81, 0xdf, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x82, 0xfe, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x05,
+  0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x0c, 0xfe, 0xff, 0x07, 0xde, 0xff, 0x0d, 0xfe, 0xff, 0x8b, 0xbe, 0xf7, 0xba, 0xd6, 0x96, 0xad, 0x92, 0x8c, 0x8f, 0x63, 0x6e, 0x63, 0x8f, 0x63,
+  0x93, 0x8c, 0x35, 0xa5, 0x7a, 0xc6, 0x7e, 0xef, 0x04, 0xff, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xb9, 0xd6, 0xe8, 0x39, 0x03, 0xe6, 0x18, 0x84, 0xe7, 0x18, 0xe7, 0x10, 0x68, 0x29, 0x70, 0x63, 0x0d,
+  0x00, 0x00, 0x82, 0x57, 0x9d, 0x8b, 0x4a, 0x03, 0xe6, 0x10, 0x86, 0x06, 0x11, 0x07, 0x19, 0x0d, 0x5b, 0x1c, 0xdf, 0xbe, 0xf7, 0xde, 0xf7, 0x04, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x86, 0x5d, 0xe7,
+  0x79, 0xce, 0x96, 0xad, 0xd3, 0x94, 0x72, 0x84, 0x31, 0x84, 0x07, 0x10, 0x7c, 0x02, 0xf0, 0x7b, 0x83, 0xcf, 0x73, 0x6e, 0x6b, 0x2d, 0x63, 0x02, 0x0d, 0x5b, 0x02, 0x2d, 0x5b, 0x02, 0x2d, 0x63,
+  0x83, 0x4e, 0x63, 0x8e, 0x6b, 0xaf, 0x73, 0x02, 0xcf, 0x73, 0x81, 0xf0, 0x7b, 0x02, 0x10, 0x7c, 0x84, 0x31, 0x84, 0x35, 0xa5, 0x38, 0xc6, 0x3c, 0xdf, 0x02, 0xff, 0xff, 0x08, 0xfe, 0xff, 0x07,
+  0xde, 0xff, 0x0a, 0xfe, 0xff, 0x84, 0xde, 0xff, 0x9a, 0xd6, 0x92, 0x94, 0x87, 0x29, 0x09, 0xe6, 0x10, 0x85, 0x06, 0x19, 0x8f, 0x6b, 0xf8, 0xbd, 0x7e, 0xef, 0xff, 0xff, 0x0a, 0xfe, 0xff, 0x82,
+  0xda, 0xd6, 0xe9, 0x39, 0x02, 0xe6, 0x18, 0x85, 0xe7, 0x18, 0xe7, 0x10, 0xe6, 0x18, 0xa9, 0x31, 0x36, 0x9d, 0x0c, 0x00, 0x00, 0x82, 0x4e, 0x5b, 0x27, 0x19, 0x03, 0xe6, 0x10, 0x86, 0x06, 0x19,
+  0x4a, 0x42, 0x1c, 0xdf, 0xbe, 0xf7, 0xde, 0xf7, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x84, 0xbe, 0xf7, 0x38, 0xc6, 0xaf, 0x6b, 0x06, 0x19, 0x0a, 0xe6, 0x10, 0x02,
+  0xc6, 0x10, 0x11, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x03, 0xe6, 0x10, 0x84, 0xe6, 0x18, 0x6e, 0x6b, 0x59, 0xce, 0xdf, 0xff, 0x17, 0xfe, 0xff, 0x82, 0x79, 0xce, 0x0d, 0x5b, 0x0f, 0xe6, 0x10, 0x84,
+  0xa8, 0x31, 0xf4, 0x9c, 0x5d, 0xef, 0xff, 0xff, 0x09, 0xfe, 0xff, 0x83, 0xba, 0xd6, 0x47, 0x21, 0xe7, 0x18, 0x03, 0xe6, 0x18, 0x82, 0x27, 0x19, 0x90, 0x6b, 0x0b, 0x00, 0x00, 0x82, 0x32, 0x7c,
+  0x87, 0x29, 0x03, 0xe6, 0x10, 0x86, 0xe6, 0x18, 0xa8, 0x29, 0xdb, 0xd6, 0xbf, 0xf7, 0xdf, 0xf7, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x83, 0xde, 0xff, 0x39, 0xc6, 0xac, 0x52, 0x0b, 0xe6, 0x10, 0x02,
+  0xc6, 0x10, 0x02, 0xe6, 0x10, 0x81, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x81, 0xc6, 0x10, 0x08, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x81, 0xe6, 0x10, 0x02, 0xe7, 0x10,
+  0x03, 0xe6, 0x10, 0x83, 0x8f, 0x6b, 0xfb, 0xd6, 0xff, 0xff, 0x12, 0xfe, 0xff, 0x84, 0xde, 0xff, 0x7d, 0xef, 0x52, 0x8c, 0xe6, 0x18, 0x11, 0xe6, 0x10, 0x84, 0xe6, 0x18, 0xa8, 0x31, 0x18, 0xbe,
+  0xdf, 0xff, 0x09, 0xfe, 0xff, 0x82, 0x58, 0xce, 0x27, 0x21, 0x04, 0xe6, 0x18, 0x82, 0x88, 0x29, 0x16, 0x9d, 0x0a, 0x00, 0x00, 0x81, 0xcc, 0x52, 0x02, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x83, 0x06,
+  0x19, 0x97, 0xb5, 0xbf, 0xf7, 0x02, 0xdf, 0xff, 0x81, 0xff, 0xff, 0x06, 0xfe, 0xff, 0x82, 0x7c, 0xef, 0x31, 0x84, 0x0d, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x08, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x07,
+  0xe6, 0x10, 0x07, 0xe7, 0x10, 0x81, 0xe6, 0x10, 0x03, 0x06, 0x11, 0x83, 0x47, 0x21, 0xb7, 0xb5, 0xff, 0xf7, 0x11, 0xfe, 0xff, 0x83, 0x1b, 0xdf, 0xcc, 0x52, 0xe6, 0x18, 0x08, 0xe6, 0x10, 0x04,
+  0xc6, 0x10, 0x81, 0xe6, 0x10, 0x03, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x86, 0xe7, 0x10, 0xe7, 0x18, 0xe6, 0x10, 0xd3, 0x94, 0xbe, 0xf7, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x83, 0x55, 0xad, 0xe6, 0x18,
+  0xe7, 0x18, 0x03, 0x06, 0x19, 0x81, 0xed, 0x52, 0x09, 0x00, 0x00, 0x82, 0xf1, 0x7b, 0x47, 0x21, 0x02, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x82, 0x10, 0x7c, 0x9e, 0xef, 0x03, 0xdf, 0xff, 0x06, 0xfe,
+  0xff, 0x82, 0xfb, 0xde, 0xac, 0x52, 0x07, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x09, 0xe6, 0x10, 0x82, 0xc6, 0x10, 0xc6, 0x18, 0x02, 0xe6, 0x10, 0x0a, 0xc6, 0x10, 0x81, 0xc7, 0x10, 0x07, 0xe7, 0x10,
+  0x05, 0xe6, 0x10, 0x85, 0x06, 0x11, 0xe6, 0x18, 0x76, 0xad, 0xff, 0xff, 0xde, 0xff, 0x0e, 0xfe, 0xff, 0x82, 0xdb, 0xd6, 0x09, 0x3a, 0x03, 0xe6, 0x10, 0x05, 0x07, 0x19, 0x83, 0x2d, 0x5b, 0xf4,
+  0x94, 0xd6, 0xb5, 0x02, 0x37, 0xbe, 0x84, 0xf6, 0xb5, 0x33, 0x9d, 0x8d, 0x63, 0x05, 0x19, 0x02, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x85, 0xe7, 0x10, 0xe6, 0x18, 0x31, 0x84, 0x9e, 0xf7, 0xde, 0xff,
+  0x07, 0xfe, 0xff, 0x83, 0xbd, 0xf7, 0x8e, 0x6b, 0xe7, 0x18, 0x03, 0x06, 0x19, 0x82, 0x67, 0x21, 0x90, 0x6b, 0x07, 0x00, 0x00, 0x83, 0xf5, 0x94, 0x2a, 0x3a, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x84,
+  0x06, 0x19, 0x4a, 0x42, 0x7e, 0xe7, 0xbf, 0xf7, 0x02, 0xdf, 0xff, 0x81, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x85, 0xde, 0xff, 0xda, 0xd6, 0xc8, 0x31, 0xe6, 0x10, 0xe7, 0x10, 0x05, 0xe6, 0x10, 0x86,
+  0x27, 0x19, 0x8b, 0x4a, 0x31, 0x84, 0x92, 0x8c, 0x14, 0x9d, 0x14, 0xa5, 0x02, 0x34, 0xa5, 0x02, 0x35, 0xa5, 0x81, 0x34, 0xa5, 0x02, 0x14, 0xa5, 0x84, 0xf4, 0x9c, 0xf3, 0x9c, 0xb3, 0x94, 0x52,
+  0x8c, 0x02, 0x72, 0x8c, 0x02, 0x52, 0x8c, 0x84, 0x72, 0x8c, 0xb3, 0x94, 0xf4, 0x9c, 0x14, 0x9d, 0x02, 0x34, 0xa5, 0x87, 0x54, 0xa5, 0x74, 0xa5, 0x75, 0xa5, 0x74, 0xa5, 0xf3, 0x94, 0xae, 0x73,
+  0x66, 0x21, 0x05, 0xe6, 0x10, 0x02, 0x06, 0x19, 0x82, 0x39, 0xc6, 0xdf, 0xff, 0x0d, 0xfe, 0xff, 0x82, 0xdb, 0xde, 0xe9, 0x39, 0x03, 0xe6, 0x10, 0x81, 0xe6, 0x18, 0x02, 0x07, 0x19, 0x84, 0x88,
+  0x29, 0x14, 0x9d, 0x3c, 0xdf, 0xff, 0xf7, 0x06, 0xff, 0xff, 0x84, 0xfe, 0xff, 0x5c, 0xe7, 0x96, 0xad, 0x09, 0x3a, 0x02, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x84, 0x06, 0x11, 0x52, 0x84, 0xbe, 0xf7,
+  0xde, 0xff, 0x06, 0xfe, 0xff, 0x83, 0xde, 0xff, 0xda, 0xde, 0x27, 0x21, 0x04, 0x06, 0x19, 0x81, 0x67, 0x21, 0x07, 0x00, 0x00, 0x83, 0xac, 0x4a, 0x06, 0x19, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x84,
+  0x06, 0x19, 0xf8, 0xbd, 0xdf, 0xf7, 0xdf, 0xff, 0x07, 0xfe, 0xff, 0x82, 0x5c, 0xe7, 0x6a, 0x4a, 0x02, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x85, 0x07, 0x11, 0xe7, 0x10, 0x2e, 0x5b, 0xf7, 0xb5, 0x7d,
+  0xe7, 0x0c, 0xde, 0xff, 0x02, 0xdd, 0xff, 0x02, 0xde, 0xff, 0x81, 0xdd, 0xff, 0x03, 0xde, 0xff, 0x81, 0xdd, 0xff, 0x04, 0xde, 0xff, 0x81, 0xdd, 0xff, 0x03, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x84,
+  0x7d, 0xef, 0xd6, 0xb5, 0x08, 0x3a, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x83, 0xe6, 0x18, 0x2a, 0x42, 0x7d, 0xef, 0x0c, 0xfe, 0xff, 0x82, 0xfb, 0xde, 0xe9, 0x39, 0x04, 0xe6, 0x10, 0x85, 0xe6, 0x18,
+  0x07, 0x19, 0x10, 0x7c, 0x3c, 0xe7, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x04, 0xff, 0xff, 0x87, 0xdf, 0xff, 0xdb, 0xd6, 0x7e, 0xef, 0xdf, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x51, 0x84, 0x02, 0xc6, 0x10,
+  0x03, 0xe6, 0x10, 0x84, 0xe7, 0x10, 0xb3, 0x94, 0xdf, 0xff, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x83, 0xde, 0xff, 0xd3, 0x94, 0xe6, 0x18, 0x03, 0x06, 0x19, 0x82, 0x26, 0x19, 0x90, 0x6b, 0x05, 0x00,
+  0x00, 0x83, 0x77, 0xa5, 0xc9, 0x31, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x85, 0x07, 0x19, 0xaf, 0x6b, 0xbf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0x05, 0xfe, 0xff, 0x84, 0xde, 0xff, 0xbe, 0xf7, 0x8e, 0x73,
+  0xe6, 0x10, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x83, 0x4a, 0x42, 0x59, 0xc6, 0xbe, 0xf7, 0x02, 0xde, 0xf7, 0x10, 0xde, 0xff, 0x81, 0xdd, 0xff, 0x03, 0xde, 0xff, 0x81, 0xdd, 0xff, 0x04, 0xde,
+  0xff, 0x81, 0xdd, 0xff, 0x03, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x83, 0x5c, 0xe7, 0x6e, 0x6b, 0xe5, 0x10, 0x03, 0xe6, 0x10, 0x83, 0x06, 0x11, 0xd3, 0x94, 0xde, 0xff, 0x0a, 0xfe, 0xff, 0x83, 0x1b,
+  0xe7, 0x6a, 0x4a, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x87, 0x06, 0x19, 0x27, 0x19, 0x55, 0xa5, 0xbe, 0xf7, 0xde, 0xf7, 0xde, 0xff, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x02, 0xff, 0xff,
+  0x88, 0x96, 0xb5, 0x22, 0x00, 0x46, 0x21, 0xf8, 0xbd, 0xdf, 0xf7, 0xff, 0xff, 0xde, 0xf7, 0x92, 0x94, 0x02, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x83, 0xe6, 0x18, 0x18, 0xbe, 0xde, 0xff, 0x07, 0xfe,
+  0xff, 0x82, 0x7c, 0xef, 0xe9, 0x39, 0x04, 0x06, 0x19, 0x81, 0xe9, 0x31, 0x05, 0x00, 0x00, 0x82, 0x0d, 0x53, 0x47, 0x19, 0x04, 0x07, 0x11, 0x84, 0x39, 0xbe, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff,
+  0x05, 0xfe, 0xff, 0x84, 0xde, 0xff, 0xd7, 0xbd, 0xe6, 0x18, 0xe7, 0x10, 0x03, 0x07, 0x11, 0x84, 0x6f, 0x63, 0x5d, 0xe7, 0xbf, 0xf7, 0xbe, 0xf7, 0x1f, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde,
+  0xff, 0x03, 0xfe, 0xff, 0x82, 0x9d, 0xef, 0xec, 0x5a, 0x02, 0xe6, 0x10, 0x84, 0xe7, 0x10, 0x07, 0x11, 0x67, 0x21, 0x5d, 0xe7, 0x09, 0xfe, 0xff, 0x83, 0x7d, 0xef, 0xec, 0x5a, 0xc6, 0x10, 0x04,
+  0xe6, 0x10, 0x91, 0x06, 0x19, 0x55, 0xa5, 0xbf, 0xf7, 0xdf, 0xf7, 0xde, 0xf7, 0xff, 0xff, 0xbe, 0xf7, 0x1c, 0xdf, 0xbb, 0xd6, 0xfc, 0xd6, 0xbe, 0xef, 0xff, 0xff, 0xcc, 0x5a, 0x23, 0x00, 0x44,
+  0x00, 0x63, 0x08, 0x39, 0xc6, 0x02, 0xff, 0xff, 0x83, 0xde, 0xf7, 0x11, 0x84, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x83, 0x06, 0x11, 0xea, 0x39, 0x3d, 0xe7, 0x08, 0xfe, 0xff, 0x83, 0x55, 0xad, 0xe6,
+  0x18, 0x07, 0x19, 0x02, 0x06, 0x19, 0x82, 0x88, 0x29, 0xb0, 0x6b, 0x04, 0x00, 0x00, 0x82, 0x4a, 0x42, 0x06, 0x11, 0x02, 0x07, 0x11, 0x86, 0x07, 0x19, 0x09, 0x3a, 0x9e, 0xef, 0xdf, 0xf7, 0xdf,
+  0xff, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x85, 0xde, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0x09, 0x3a, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x84, 0x6e, 0x63, 0x7e, 0xef, 0xbf, 0xf7, 0xde, 0xf7, 0x05, 0xde, 0xff,
+  0x04, 0xfe, 0xff, 0x06, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x0f, 0xde, 0xff, 0x82, 0xfe, 0xff, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x81, 0x9a, 0xce, 0x02, 0xe6, 0x10, 0x85, 0xe7, 0x10, 0x07, 0x11, 0x07,
+  0x19, 0xd7, 0xb5, 0xdf, 0xff, 0x07, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x71, 0x8c, 0x02, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x82, 0x06, 0x19, 0x8f, 0x6b, 0x02, 0xbf, 0xf7, 0x8b, 0xdf, 0xf7, 0xff, 0xff,
+  0x5d, 0xe7, 0x9a, 0xce, 0x9a, 0xc6, 0xbb, 0xce, 0xdb, 0xd6, 0x5d, 0xdf, 0x9e, 0xef, 0x26, 0x21, 0x23, 0x00, 0x02, 0x43, 0x00, 0x82, 0x87, 0x29, 0x3d, 0xe7, 0x02, 0xfe, 0xff, 0x82, 0x7d, 0xef,
+  0xe9, 0x39, 0x03, 0xe6, 0x10, 0x84, 0x06, 0x11, 0x07, 0x19, 0x31, 0x84, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x83, 0x5c, 0xe7, 0x67, 0x29, 0x07, 0x19, 0x03, 0x06, 0x19, 0x81, 0xac, 0x4a, 0x03, 0x00,
+  0x00, 0x82, 0x35, 0x9d, 0xa8, 0x29, 0x02, 0x07, 0x11, 0x85, 0x07, 0x19, 0x07, 0x11, 0x15, 0x9d, 0xbf, 0xf7, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x83, 0x75, 0xad,
+  0x07, 0x19, 0x07, 0x11, 0x02, 0x07, 0x19, 0x84, 0xe9, 0x31, 0x1c, 0xdf, 0xbf, 0xf7, 0xbf, 0xff, 0x03, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x09, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x0d,
+  0xfe, 0xff, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x83, 0xde, 0xff, 0x0c, 0x5b, 0xe7, 0x10, 0x03, 0x07, 0x11, 0x81, 0x31, 0x84, 0x02, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x38, 0xc6, 0x03, 0xc6,
+  0x10, 0x03, 0xe6, 0x10, 0x87, 0x07, 0x19, 0x39, 0xc6, 0xbf, 0xf7, 0xde, 0xf7, 0xff, 0xff, 0x1c, 0xdf, 0x7a, 0xc6, 0x02, 0x9a, 0xc6, 0x8a, 0xbb, 0xce, 0xdb, 0xce, 0xfc, 0xd6, 0x3d, 0xdf, 0xb3,
+  0x8c, 0x64, 0x08, 0x43, 0x00, 0x44, 0x00, 0x85, 0x00, 0x95, 0xad, 0x02, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xd7, 0xbd, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x83, 0x06, 0x19, 0xe6, 0x10, 0x39, 0xc6, 0x07,
+  0xfe, 0xff, 0x82, 0xde, 0xff, 0x72, 0x8c, 0x04, 0x06, 0x19, 0x82, 0x6b, 0x42, 0x36, 0x9d, 0x02, 0x00, 0x00, 0x82, 0xd0, 0x6b, 0x06, 0x19, 0x02, 0x07, 0x11, 0x83, 0x07, 0x19, 0x27, 0x11, 0x1c,
+  0xd7, 0x02, 0xdf, 0xf7, 0x81, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x82, 0x9d, 0xf7, 0x2a, 0x42, 0x04, 0x07, 0x19, 0x84, 0x96, 0xad, 0xbf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0x07, 0xfe,
+  0xff, 0x06, 0xde, 0xff, 0x0c, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x0e, 0xfe, 0xff, 0x82, 0xf4, 0x9c, 0xe6, 0x10, 0x03, 0x07, 0x11, 0x83, 0x4e, 0x63, 0xde, 0xf7, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x82,
+  0xbd, 0xf7, 0x8b, 0x4a, 0x03, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x86, 0x06, 0x11, 0x09, 0x3a, 0x9e, 0xef, 0xbe, 0xf7, 0xde, 0xff, 0x7d, 0xef, 0x02, 0x9a, 0xce, 0x83, 0x9a, 0xc6, 0x9a, 0xce, 0xbb,
+  0xce, 0x02, 0xdb, 0xce, 0x87, 0xfb, 0xd6, 0xdb, 0xd6, 0xf9, 0xb5, 0xb0, 0x73, 0x85, 0x08, 0xa8, 0x29, 0xfb, 0xd6, 0x02, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xbe, 0xf7, 0xc8, 0x31, 0xc6, 0x10, 0x04,
+  0xe6, 0x10, 0x83, 0x8b, 0x4a, 0x7e, 0xef, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x59, 0xce, 0x04, 0x06, 0x19, 0x82, 0x47, 0x21, 0x6f, 0x63, 0x02, 0x00, 0x00, 0x82, 0x0a, 0x3a, 0x06, 0x11, 0x02,
+  0x07, 0x11, 0x82, 0x07, 0x19, 0x0d, 0x53, 0x02, 0xdf, 0xf7, 0x82, 0xdf, 0xff, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x81, 0x58, 0xc6, 0x04, 0x07, 0x19, 0x85, 0xa8, 0x29, 0x5e, 0xe7,
+  0xbf, 0xf7, 0xdf, 0xf7, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x06, 0xde, 0xff, 0x0c, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x0e, 0xfe, 0xff, 0x81, 0x14, 0xa5, 0x02, 0xe6, 0x10, 0x85, 0x07, 0x11, 0x07, 0x19,
+  0x0d, 0x5b, 0xde, 0xf7, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x82, 0x38, 0xc6, 0xe6, 0x10, 0x03, 0xc6, 0x10, 0x81, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x82, 0x72, 0x84, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x81,
+  0xba, 0xce, 0x02, 0x9a, 0xce, 0x81, 0x9a, 0xc6, 0x02, 0xbb, 0xce, 0x04, 0xdb, 0xce, 0x02, 0xbb, 0xce, 0x82, 0x19, 0xb6, 0x1c, 0xdf, 0x02, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x82,
+  0xb3, 0x94, 0xc6, 0x10, 0x04, 0xe6, 0x10, 0x83, 0xa5, 0x08, 0x55, 0xa5, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x83, 0x7d, 0xef, 0x67, 0x29, 0x07, 0x19, 0x03, 0x06, 0x19, 0x81, 0x6b, 0x42, 0x02, 0x00,
+  0x00, 0x82, 0xc9, 0x31, 0x06, 0x11, 0x02, 0x06, 0x19, 0x82, 0x07, 0x19, 0xd4, 0x94, 0x02, 0xdf, 0xf7, 0x81, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x81, 0x92, 0x8c, 0x02, 0x07, 0x19,
+  0x02, 0x27, 0x19, 0x83, 0xb3, 0x8c, 0xbf, 0xf7, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x07, 0xde, 0xff, 0x0e, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x0b,
+  0xfe, 0xff, 0x81, 0x8f, 0x6b, 0x02, 0xe6, 0x10, 0x83, 0xe7, 0x10, 0x07, 0x11, 0x8f, 0x6b, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x84, 0xde, 0xff, 0x51, 0x84, 0xe7, 0x10, 0xe6, 0x10, 0x02, 0xc6,
+  0x10, 0x87, 0xe7, 0x10, 0x07, 0x19, 0x08, 0x11, 0x96, 0xad, 0xdf, 0xf7, 0xfe, 0xff, 0x5d, 0xe7, 0x04, 0x9a, 0xce, 0x84, 0xba, 0xce, 0xbb, 0xce, 0xdb, 0xce, 0xdb, 0xd6, 0x02, 0xdb, 0xce, 0x02,
+  0xbb, 0xce, 0x82, 0xfc, 0xd6, 0x9d, 0xef, 0x05, 0xff, 0xff, 0x82, 0x18, 0xc6, 0xc6, 0x10, 0x04, 0xe6, 0x10, 0x84, 0xa5, 0x08, 0x87, 0x29, 0x7d, 0xef, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x83, 0xde,
+  0xff, 0xb0, 0x7b, 0x07, 0x19, 0x03, 0x06, 0x19, 0x81, 0x88, 0x29, 0x02, 0x00, 0x00, 0x81, 0x88, 0x29, 0x02, 0x06, 0x19, 0x83, 0x07, 0x19, 0x26, 0x19, 0xd7, 0xb5, 0x02, 0xdf, 0xf7, 0x81, 0xde,
+  0xff, 0x03, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x83, 0xbe, 0xf7, 0x8b, 0x4a, 0x07, 0x19, 0x02, 0x27, 0x19, 0x84, 0x47, 0x19, 0xbb, 0xce, 0xbf, 0xf7, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff,
+  0x07, 0xde, 0xff, 0x0e, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x0a, 0xfe, 0xff, 0x83, 0xfb, 0xde, 0xe6, 0x10, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x84, 0x07, 0x11, 0x55,
+  0xa5, 0xdf, 0xf7, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x8d, 0xbd, 0xf7, 0x09, 0x3a, 0xe7, 0x10, 0xe6, 0x10, 0x67, 0x21, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x19, 0x08, 0x11, 0xd7, 0xb5, 0xdf, 0xff, 0xff,
+  0xff, 0xfc, 0xde, 0x03, 0x9a, 0xce, 0x02, 0xba, 0xce, 0x81, 0xbb, 0xce, 0x02, 0xdb, 0xd6, 0x04, 0xdb, 0xce, 0x83, 0xdb, 0xd6, 0x1c, 0xdf, 0xde, 0xf7, 0x03, 0xfe, 0xff, 0x83, 0xde, 0xf7, 0xba,
+  0xd6, 0xc5, 0x10, 0x04, 0xe6, 0x10, 0x84, 0xa5, 0x08, 0x84, 0x08, 0xb7, 0xb5, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x82, 0x76, 0xad, 0x27, 0x19, 0x03, 0x06, 0x19, 0x84, 0xa8, 0x29, 0xb8, 0xad, 0x2e,
+  0x5b, 0x67, 0x21, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0x06, 0x19, 0x9a, 0xce, 0xbf, 0xf7, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x83, 0x5d, 0xef, 0x27, 0x19, 0x07, 0x19, 0x02,
+  0x27, 0x19, 0x85, 0x88, 0x21, 0x7d, 0xe7, 0xdf, 0xf7, 0xdf, 0xff, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x1e, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0xf0, 0x7b, 0x02, 0xc6, 0x10, 0x86, 0xe6,
+  0x10, 0xe7, 0x10, 0x07, 0x19, 0x9a, 0xce, 0xde, 0xf7, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x86, 0xba, 0xde, 0xe6, 0x18, 0x07, 0x11, 0xe7, 0x10, 0x4b, 0x42, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x86, 0x08,
+  0x19, 0x96, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xbb, 0xce, 0xba, 0xce, 0x02, 0x9a, 0xce, 0x83, 0xba, 0xce, 0xbb, 0xce, 0xdb, 0xce, 0x02, 0xdb, 0xd6, 0x05, 0xdb, 0xce, 0x82, 0xfb, 0xd6, 0x9d, 0xef,
+  0x02, 0xde, 0xf7, 0x84, 0xbe, 0xf7, 0xbd, 0xef, 0xba, 0xd6, 0xc5, 0x10, 0x04, 0xe6, 0x10, 0x84, 0xa5, 0x08, 0x84, 0x08, 0xd0, 0x73, 0xdf, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x99, 0xd6, 0x03, 0x07,
+  0x19, 0x85, 0x06, 0x19, 0x67, 0x21, 0xf1, 0x73, 0xee, 0x52, 0x06, 0x11, 0x03, 0x07, 0x19, 0x84, 0x47, 0x19, 0x5d, 0xe7, 0xbf, 0xf7, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x83, 0xfb,
+  0xde, 0xe7, 0x10, 0x07, 0x19, 0x02, 0x27, 0x19, 0x83, 0x09, 0x3a, 0xbf, 0xf7, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x0b, 0xde, 0xff, 0x09, 0xfe,
+  0xff, 0x84, 0x9d, 0xef, 0x92, 0x8c, 0xe6, 0x10, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x84, 0xcc, 0x52, 0x9e, 0xef, 0xde, 0xf7, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x85, 0xd7, 0xbd, 0x07, 0x19, 0x07, 0x11,
+  0xe6, 0x10, 0xed, 0x52, 0x02, 0xe7, 0x10, 0x85, 0x07, 0x11, 0x08, 0x19, 0x8f, 0x63, 0x19, 0xbe, 0xfb, 0xd6, 0x04, 0xba, 0xce, 0x82, 0xbb, 0xce, 0xdb, 0xce, 0x04, 0xdb, 0xd6, 0x04, 0xdb, 0xce,
+  0x82, 0xdb, 0xd6, 0x5c, 0xe7, 0x03, 0xbe, 0xf7, 0x83, 0x9d, 0xef, 0xb7, 0xad, 0xc5, 0x10, 0x03, 0xe6, 0x10, 0x85, 0x47, 0x21, 0xa5, 0x08, 0x85, 0x08, 0xa8, 0x31, 0x9e, 0xf7, 0x06, 0xfe, 0xff,
+  0x82, 0x5c, 0xef, 0x27, 0x21, 0x02, 0x07, 0x19, 0x02, 0x06, 0x19, 0x82, 0xcc, 0x4a, 0x4b, 0x42, 0x03, 0x07, 0x19, 0x82, 0x27, 0x19, 0x09, 0x3a, 0x02, 0xbf, 0xf7, 0x82, 0xde, 0xff, 0xfe, 0xff,
+  0x05, 0xde, 0xff, 0x81, 0xba, 0xd6, 0x02, 0x07, 0x19, 0x02, 0x27, 0x19, 0x83, 0x4b, 0x42, 0xdf, 0xf7, 0xde, 0xf7, 0x02, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xfe, 0xff, 0x02, 0xde,
+  0xff, 0x81, 0x5c, 0xe7, 0x02, 0x1c, 0xe7, 0x81, 0x5d, 0xe7, 0x03, 0x7d, 0xef, 0x81, 0x7c, 0xe7, 0x02, 0x1b, 0xdf, 0x82, 0x3b, 0xe7, 0x1b, 0xe7, 0x02, 0x3b, 0xe7, 0x86, 0x1b, 0xe7, 0x1b, 0xdf,
+  0x1b, 0xe7, 0x7c, 0xef, 0x9d, 0xef, 0x9d, 0xf7, 0x02, 0xbe, 0xf7, 0x81, 0xde, 0xf7, 0x02, 0xbe, 0xf7, 0x84, 0x5c, 0xe7, 0xdb, 0xd6, 0x96, 0xad, 0x4a, 0x42, 0x06, 0xe6, 0x10, 0x84, 0x55, 0xa5,
+  0xbe, 0xf7, 0xde, 0xf7, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x86, 0xde, 0xff, 0xf3, 0x9c, 0xe7, 0x18, 0x07, 0x11, 0x27, 0x19, 0x0f, 0x5b, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x84, 0x73, 0x84, 0x19,
+  0xbe, 0x7a, 0xc6, 0x9a, 0xce, 0x03, 0xba, 0xce, 0x82, 0xbb, 0xce, 0xdb, 0xce, 0x06, 0xdb, 0xd6, 0x02, 0xdb, 0xce, 0x88, 0xda, 0xce, 0xfb, 0xd6, 0x5c, 0xe7, 0x9d, 0xef, 0x5c, 0xe7, 0x9a, 0xc6,
+  0xf4, 0x94, 0xc5, 0x10, 0x03, 0xe6, 0x10, 0x86, 0x09, 0x3a, 0xc5, 0x10, 0xa5, 0x08, 0xc5, 0x10, 0xba, 0xd6, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x29, 0x42, 0x02, 0x07, 0x19, 0x02,
+  0x06, 0x19, 0x82, 0xc8, 0x31, 0x0b, 0x3a, 0x03, 0x07, 0x19, 0x86, 0x27, 0x19, 0x6e, 0x6b, 0xdf, 0xf7, 0xbe, 0xf7, 0xde, 0xff, 0xfe, 0xff, 0x05, 0xde, 0xff, 0x81, 0x99, 0xce, 0x02, 0x07, 0x19,
+  0x84, 0x27, 0x19, 0x28, 0x19, 0x8b, 0x42, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x84, 0xde, 0xff, 0xfb, 0xde, 0xec, 0x5a, 0xe6, 0x10, 0x02, 0xc6,
+  0x10, 0x02, 0xe6, 0x10, 0x82, 0xe6, 0x18, 0x06, 0x19, 0x0a, 0xe6, 0x10, 0x84, 0xe7, 0x10, 0x07, 0x11, 0x07, 0x19, 0x27, 0x19, 0x02, 0x47, 0x21, 0x82, 0x46, 0x19, 0x06, 0x19, 0x09, 0xe6, 0x10,
+  0x83, 0xec, 0x5a, 0x38, 0xb6, 0xbe, 0xef, 0x02, 0xde, 0xff, 0x8a, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x51, 0x8c, 0xe7, 0x10, 0x07, 0x19, 0x88, 0x21, 0x0f, 0x5b, 0xc7, 0x10, 0x03,
+  0xe7, 0x10, 0x84, 0x73, 0x84, 0x59, 0xbe, 0x7a, 0xc6, 0x9a, 0xce, 0x03, 0xba, 0xce, 0x81, 0xdb, 0xce, 0x08, 0xdb, 0xd6, 0x81, 0xdb, 0xce, 0x02, 0xba, 0xce, 0x85, 0x9a, 0xce, 0x7a, 0xc6, 0x5a,
+  0xbe, 0x39, 0xb6, 0x73, 0x84, 0x04, 0xe6, 0x10, 0x82, 0x8c, 0x4a, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x81, 0xd7, 0xbd, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xdf, 0xff, 0xaf, 0x73, 0x02, 0x07,
+  0x19, 0x85, 0x06, 0x19, 0x07, 0x19, 0x4b, 0x42, 0xea, 0x31, 0x06, 0x19, 0x03, 0x07, 0x19, 0x85, 0x72, 0x84, 0xdf, 0xf7, 0xde, 0xf7, 0xde, 0xff, 0xfe, 0xff, 0x05, 0xde, 0xff, 0x87, 0x79, 0xce,
+  0x07, 0x11, 0x07, 0x19, 0x27, 0x19, 0x28, 0x19, 0xac, 0x4a, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x83, 0xde, 0xff, 0x10, 0x84, 0x07, 0x11, 0x03,
+  0xe6, 0x10, 0x16, 0xe7, 0x10, 0x08, 0xe6, 0x10, 0x85, 0xec, 0x52, 0x97, 0xa5, 0xd8, 0xa5, 0x3c, 0xdf, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x89, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x51, 0x8c, 0xe6,
+  0x10, 0xe7, 0x18, 0x68, 0x21, 0x91, 0x6b, 0xa6, 0x08, 0x03, 0xe7, 0x10, 0x84, 0x6e, 0x63, 0x5a, 0xc6, 0x7a, 0xc6, 0x9a, 0xce, 0x02, 0xba, 0xce, 0x81, 0xda, 0xce, 0x09, 0xdb, 0xd6, 0x88, 0xda,
+  0xce, 0xba, 0xce, 0xbb, 0xce, 0xba, 0xce, 0x9a, 0xc6, 0x7a, 0xbe, 0x59, 0xb6, 0x4e, 0x5b, 0x04, 0xe6, 0x10, 0x81, 0xcd, 0x52, 0x03, 0xc6, 0x10, 0x81, 0x96, 0xad, 0x02, 0xde, 0xff, 0x04, 0xfe,
+  0xff, 0x82, 0xde, 0xff, 0x92, 0x8c, 0x02, 0x07, 0x19, 0x85, 0x06, 0x19, 0x07, 0x19, 0xe9, 0x31, 0xea, 0x31, 0x06, 0x19, 0x03, 0x07, 0x19, 0x82, 0xb3, 0x94, 0xde, 0xf7, 0x02, 0xde, 0xff, 0x81,
+  0xfe, 0xff, 0x05, 0xde, 0xff, 0x82, 0x79, 0xce, 0x07, 0x11, 0x02, 0x07, 0x19, 0x83, 0x27, 0x19, 0xac, 0x4a, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0x4e, 0x63, 0x09,
+  0xe6, 0x10, 0x05, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x09, 0xe7, 0x10, 0x08, 0xe6, 0x10, 0x86, 0xd0, 0x73, 0xb7, 0xa5, 0xd8, 0xa5, 0xd8, 0x9d, 0x7d, 0xe7, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe,
+  0xff, 0x88, 0xde, 0xff, 0x72, 0x8c, 0xe6, 0x18, 0xe7, 0x10, 0x06, 0x19, 0x13, 0x74, 0x27, 0x19, 0xc6, 0x10, 0x02, 0xe7, 0x10, 0x84, 0x67, 0x29, 0x3a, 0xbe, 0x7a, 0xc6, 0x9a, 0xce, 0x02, 0xba,
+  0xce, 0x81, 0xda, 0xce, 0x09, 0xdb, 0xd6, 0x02, 0xda, 0xce, 0x02, 0xba, 0xce, 0x85, 0x9a, 0xc6, 0x9a, 0xbe, 0x19, 0xb6, 0x67, 0x21, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x82, 0xcd, 0x52, 0xc5, 0x10,
+  0x02, 0xc6, 0x10, 0x81, 0x75, 0xad, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xd3, 0x9c, 0x04, 0x06, 0x19, 0x83, 0x68, 0x21, 0xca, 0x31, 0x06, 0x19, 0x03, 0x07, 0x19, 0x81, 0x93,
+  0x8c, 0x03, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x05, 0xde, 0xff, 0x81, 0x79, 0xce, 0x02, 0x07, 0x11, 0x02, 0x07, 0x19, 0x82, 0xac, 0x4a, 0xdf, 0xf7, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xde,
+  0xf7, 0x6e, 0x63, 0x09, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x04, 0xe6, 0x10, 0x07, 0xe7, 0x10, 0x08, 0xe6, 0x10, 0x83, 0x4a, 0x42, 0xf5, 0x8c, 0xd8, 0xad, 0x02, 0xd8, 0xa5, 0x83, 0xd8, 0x9d, 0xdf,
+  0xf7, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x86, 0x35, 0xa5, 0xe7, 0x18, 0xe7, 0x10, 0xe6, 0x10, 0xb1, 0x63, 0x4c, 0x42, 0x02, 0xc6, 0x10, 0x85, 0xc7, 0x10, 0xc6, 0x10, 0xd5, 0x94,
+  0x7a, 0xc6, 0x9a, 0xce, 0x02, 0xba, 0xce, 0x81, 0xda, 0xce, 0x0a, 0xdb, 0xd6, 0x81, 0xda, 0xce, 0x02, 0xba, 0xce, 0x84, 0xba, 0xc6, 0x7a, 0xbe, 0xd4, 0x94, 0xc5, 0x10, 0x03, 0xe6, 0x10, 0x83,
+  0xe9, 0x31, 0x2e, 0x5b, 0xc5, 0x10, 0x02, 0xc6, 0x10, 0x83, 0xb6, 0xb5, 0xde, 0xf7, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x35, 0xa5, 0x04, 0x06, 0x19, 0x83, 0xc9, 0x31, 0xa9, 0x29,
+  0x06, 0x11, 0x03, 0x07, 0x19, 0x81, 0x93, 0x8c, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x83, 0x9a, 0xce, 0xe6, 0x10, 0x07, 0x11, 0x02, 0x07, 0x19, 0x82, 0x6b, 0x42, 0xdf, 0xff,
+  0x02, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0x6e, 0x6b, 0x05, 0xe6, 0x10, 0x06, 0xc6, 0x10, 0x81, 0xc7, 0x10, 0x02, 0xc6, 0x10, 0x82, 0xc6, 0x08, 0xc6, 0x10, 0x03, 0xc6, 0x08, 0x81,
+  0xa6, 0x08, 0x04, 0xc6, 0x08, 0x87, 0xc6, 0x10, 0xc7, 0x10, 0xe6, 0x10, 0xc6, 0x10, 0x07, 0x19, 0x0e, 0x5b, 0xb4, 0x8c, 0x03, 0xd8, 0xa5, 0x84, 0xd9, 0xa5, 0xf9, 0xa5, 0xbb, 0xc6, 0xde, 0xff,
+  0x03, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xf7, 0xbd, 0x02, 0xe7, 0x10, 0x84, 0xe6, 0x10, 0x4f, 0x5b, 0x91, 0x63, 0xa6, 0x08, 0x03, 0xc6, 0x10, 0x83, 0xc9, 0x31, 0xf9, 0xb5,
+  0x7a, 0xc6, 0x02, 0xba, 0xce, 0x81, 0xda, 0xce, 0x0a, 0xdb, 0xd6, 0x02, 0xda, 0xce, 0x84, 0xba, 0xce, 0xba, 0xc6, 0x5a, 0xbe, 0x09, 0x3a, 0x02, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x02, 0x0e, 0x5b,
+  0x81, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x83, 0x18, 0xbe, 0xde, 0xf7, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x82, 0xfe, 0xff, 0x35, 0xa5, 0x04, 0x06, 0x19, 0x82, 0xc9, 0x31, 0xa9, 0x29,
+  0x02, 0x06, 0x19, 0x02, 0x07, 0x19, 0x81, 0x93, 0x8c, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x82, 0x9a, 0xd6, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x83, 0x07, 0x19, 0x4a, 0x42, 0xdf,
+  0xff, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0x6e, 0x6b, 0x04, 0xe6, 0x10, 0x82, 0x2e, 0x5b, 0xf5, 0x8c, 0x03, 0xd5, 0x8c, 0x02, 0xd5, 0x84, 0x83, 0xd5, 0x8c, 0xb4, 0x84, 0x73,
+  0x84, 0x03, 0x12, 0x74, 0x81, 0x32, 0x74, 0x02, 0x53, 0x7c, 0x84, 0x74, 0x84, 0x94, 0x84, 0xb4, 0x84, 0xd5, 0x84, 0x02, 0xf5, 0x8c, 0x83, 0x16, 0x8d, 0x37, 0x95, 0xb8, 0xa5, 0x02, 0xd9, 0xa5,
+  0x03, 0xd8, 0xa5, 0x83, 0xd9, 0xa5, 0x19, 0xa6, 0xbe, 0xf7, 0x04, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x82, 0xdb, 0xde, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x85, 0x8c, 0x4a, 0x54, 0x74,
+  0xa9, 0x29, 0xa6, 0x08, 0xc6, 0x08, 0x02, 0xc6, 0x10, 0x85, 0xed, 0x5a, 0x5a, 0xc6, 0x7a, 0xc6, 0x9a, 0xce, 0xdb, 0xce, 0x04, 0xdb, 0xd6, 0x81, 0xfb, 0xd6, 0x05, 0xdb, 0xd6, 0x03, 0xdb, 0xce,
+  0x82, 0x7a, 0xbe, 0xd0, 0x6b, 0x02, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x88, 0x26, 0x19, 0xf2, 0x73, 0xac, 0x4a, 0xe6, 0x10, 0xc6, 0x10, 0xc5, 0x08, 0xfb, 0xd6, 0xde, 0xf7, 0x02, 0xde, 0xff, 0x81,
+  0xfe, 0xff, 0x03, 0xde, 0xff, 0x82, 0x55, 0xa5, 0xe6, 0x10, 0x03, 0x06, 0x19, 0x84, 0x0a, 0x3a, 0xa9, 0x29, 0x07, 0x19, 0x06, 0x19, 0x02, 0x07, 0x19, 0x81, 0x93, 0x8c, 0x02, 0xde, 0xff, 0x02,
+  0xfe, 0xff, 0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x82, 0x9a, 0xd6, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x83, 0x07, 0x19, 0x2a, 0x3a, 0xde, 0xf7, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff,
+  0x83, 0xde, 0xff, 0x6e, 0x6b, 0xe7, 0x10, 0x03, 0xe6, 0x10, 0x82, 0x8f, 0x63, 0x98, 0x9d, 0x05, 0x97, 0x9d, 0x83, 0x77, 0x9d, 0x77, 0x95, 0x57, 0x95, 0x06, 0x77, 0x95, 0x82, 0x97, 0x95, 0x97,
+  0x9d, 0x02, 0x98, 0x9d, 0x02, 0xb8, 0x9d, 0x81, 0xb8, 0xa5, 0x05, 0xd8, 0xa5, 0x02, 0xf9, 0xad, 0x82, 0xf8, 0xa5, 0x5d, 0xdf, 0x08, 0xfe, 0xff, 0x88, 0xbe, 0xf7, 0xc8, 0x31, 0xe6, 0x10, 0xe7,
+  0x10, 0x68, 0x21, 0x34, 0x74, 0x91, 0x5b, 0x85, 0x08, 0x02, 0xc6, 0x08, 0x89, 0xc6, 0x10, 0xe7, 0x10, 0x8f, 0x6b, 0x39, 0xbe, 0x5a, 0xbe, 0x7a, 0xbe, 0xdb, 0xce, 0xfb, 0xd6, 0xdb, 0xd6, 0x06,
+  0xfb, 0xd6, 0x02, 0xdb, 0xce, 0x83, 0x9a, 0xc6, 0x7a, 0xbe, 0x32, 0x7c, 0x02, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x89, 0xee, 0x52, 0x74, 0x7c, 0x07, 0x19, 0xe6, 0x10, 0xc6, 0x10, 0x29, 0x3a, 0x9e,
+  0xef, 0xbe, 0xf7, 0xdd, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x83, 0xde, 0xff, 0x76, 0xad, 0xe6, 0x18, 0x03, 0x06, 0x19, 0x84, 0xac, 0x52, 0xea, 0x31, 0x07, 0x19, 0x06, 0x19, 0x02, 0x07,
+  0x19, 0x83, 0xb3, 0x8c, 0xde, 0xf7, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x82, 0xba, 0xd6, 0xc6, 0x10, 0x02, 0x07, 0x11, 0x83, 0x07, 0x19, 0x2a, 0x3a,
+  0xde, 0xf7, 0x02, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x82, 0x4e, 0x63, 0xe7, 0x18, 0x02, 0xe6, 0x10, 0x82, 0x06, 0x11, 0xd0, 0x6b, 0x03, 0xb8, 0x9d, 0x81, 0xb7, 0x9d, 0x07, 0x97,
+  0x9d, 0x06, 0x98, 0x9d, 0x04, 0xb8, 0x9d, 0x05, 0xd8, 0xa5, 0x84, 0xf9, 0xa5, 0xf9, 0xad, 0x19, 0xae, 0x5d, 0xdf, 0x02, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x82, 0x10, 0x84, 0xe6, 0x10, 0x02, 0xe7,
+  0x10, 0x86, 0x91, 0x63, 0x75, 0x74, 0x2c, 0x32, 0xa5, 0x08, 0xc6, 0x08, 0xc6, 0x10, 0x02, 0xe7, 0x10, 0x86, 0xcc, 0x52, 0xd8, 0xad, 0x3a, 0xb6, 0x39, 0xae, 0x7a, 0xbe, 0xdb, 0xce, 0x03, 0xfb,
+  0xd6, 0x87, 0xfc, 0xd6, 0x1c, 0xd7, 0xdb, 0xce, 0x9a, 0xbe, 0x7b, 0xb6, 0xd8, 0xa5, 0x4e, 0x5b, 0x04, 0xc6, 0x10, 0x84, 0xe6, 0x10, 0xa9, 0x29, 0x50, 0x5b, 0x90, 0x6b, 0x03, 0xe6, 0x10, 0x82,
+  0x11, 0x74, 0xbf, 0xf7, 0x05, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xde, 0xff, 0x76, 0xad, 0x04, 0x06, 0x19, 0x84, 0xac, 0x52, 0x2b, 0x3a, 0x07, 0x19, 0x06, 0x19, 0x02, 0x07, 0x19, 0x81, 0x92, 0x8c,
+  0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xba, 0xd6, 0xc6, 0x10, 0x03, 0x07, 0x11, 0x83, 0x2a, 0x42, 0xde, 0xf7, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x02, 0xde, 0xff,
+  0x03, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x2d, 0x63, 0x03, 0xe6, 0x10, 0x82, 0x06, 0x19, 0xb0, 0x63, 0x08, 0xb8, 0x9d, 0x81, 0xb7, 0x9d, 0x04, 0x98, 0x9d, 0x81, 0xb8, 0x9d, 0x03, 0x98, 0x9d, 0x04,
+  0xb8, 0x9d, 0x05, 0xd8, 0xa5, 0x83, 0xf9, 0xa5, 0x19, 0xb6, 0x5c, 0xe7, 0x03, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x81, 0xd7, 0xbd, 0x02, 0xc6, 0x10, 0x86, 0xe7,
+  0x10, 0x6c, 0x42, 0x95, 0x7c, 0x14, 0x64, 0x07, 0x11, 0xa6, 0x08, 0x02, 0xc6, 0x10, 0x89, 0xc7, 0x10, 0xe7, 0x10, 0x48, 0x21, 0x73, 0x7c, 0xf9, 0xad, 0x1a, 0xa6, 0xf9, 0x9d, 0xf9, 0xa5, 0x3a,
+  0xae, 0x02, 0x3a, 0xa6, 0x86, 0x19, 0x9e, 0x3a, 0x9e, 0xfa, 0xa5, 0x32, 0x74, 0x26, 0x11, 0xe6, 0x10, 0x03, 0xc6, 0x10, 0x85, 0xe6, 0x10, 0x06, 0x11, 0xee, 0x52, 0x53, 0x7c, 0xc9, 0x31, 0x03,
+  0xe6, 0x10, 0x82, 0xb7, 0xa5, 0xde, 0xf7, 0x07, 0xde, 0xff, 0x81, 0x97, 0xad, 0x02, 0x06, 0x19, 0x02, 0x07, 0x19, 0x84, 0xcd, 0x52, 0x2b, 0x3a, 0x07, 0x19, 0x06, 0x19, 0x02, 0x07, 0x19, 0x81,
+  0x92, 0x8c, 0x02, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x83, 0xde, 0xff, 0xba, 0xd6, 0xe6, 0x10, 0x03, 0x07, 0x11, 0x83, 0x2a, 0x3a, 0xde, 0xf7, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x02,
+  0xfe, 0xff, 0x82, 0xde, 0xff, 0x2d, 0x63, 0x02, 0xe6, 0x10, 0x83, 0xe6, 0x18, 0x06, 0x19, 0xd0, 0x63, 0x04, 0xb8, 0x9d, 0x81, 0x98, 0x9d, 0x04, 0xb8, 0x9d, 0x02, 0x98, 0x9d, 0x0a, 0xb8, 0x9d,
+  0x02, 0xd8, 0x9d, 0x03, 0xd8, 0xa5, 0x82, 0x59, 0xbe, 0x9d, 0xef, 0x04, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x82, 0x1c, 0xdf, 0x67, 0x29, 0x02, 0xc6, 0x10, 0x85, 0xc7, 0x10, 0xd2, 0x63, 0x96, 0x74,
+  0x92, 0x53, 0xc6, 0x10, 0x02, 0xa6, 0x08, 0x02, 0xc7, 0x10, 0x86, 0xe7, 0x10, 0xe6, 0x10, 0x47, 0x21, 0x4e, 0x5b, 0xd5, 0x84, 0x78, 0x95, 0x02, 0xb9, 0x95, 0x85, 0x78, 0x8d, 0x16, 0x85, 0xb1,
+  0x63, 0x47, 0x19, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x85, 0xe6, 0x10, 0xcd, 0x4a, 0xb5, 0x7c, 0xd1, 0x6b, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x82, 0x2a, 0x2a, 0xfb, 0xce, 0x04, 0xde,
+  0xff, 0x03, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xb7, 0xb5, 0x02, 0x06, 0x19, 0x86, 0x07, 0x19, 0x06, 0x19, 0xcd, 0x52, 0x2b, 0x3a, 0x07, 0x19, 0x06, 0x19, 0x02, 0x07, 0x19, 0x81, 0xb2, 0x94, 0x02,
+  0xde, 0xff, 0x06, 0xfe, 0xff, 0x83, 0xde, 0xff, 0xbb, 0xd6, 0xe6, 0x10, 0x03, 0x07, 0x11, 0x83, 0x2a, 0x42, 0xde, 0xf7, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xde,
+  0xff, 0x0d, 0x5b, 0x02, 0xe6, 0x10, 0x85, 0xe6, 0x18, 0x06, 0x19, 0xd1, 0x6b, 0xf9, 0xad, 0xd9, 0xad, 0x02, 0xb8, 0xa5, 0x04, 0xd8, 0xad, 0x02, 0xd8, 0xa5, 0x03, 0xb8, 0xa5, 0x81, 0x98, 0xa5,
+  0x02, 0x98, 0x9d, 0x06, 0xb8, 0x9d, 0x84, 0xb8, 0xa5, 0xf8, 0xad, 0x9a, 0xc6, 0x5c, 0xe7, 0x02, 0xdd, 0xff, 0x03, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x8b, 0xbe, 0xf7, 0x32, 0x7c, 0x85, 0x10, 0xa6,
+  0x08, 0xc7, 0x10, 0x68, 0x21, 0x54, 0x74, 0x96, 0x6c, 0x51, 0x4b, 0xc6, 0x10, 0xa6, 0x08, 0x02, 0xc6, 0x10, 0x81, 0xc7, 0x10, 0x03, 0xe6, 0x10, 0x04, 0xc6, 0x10, 0x83, 0xc5, 0x10, 0xc6, 0x10,
+  0xe6, 0x08, 0x04, 0xc6, 0x10, 0x81, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x85, 0xac, 0x42, 0x74, 0x7c, 0x16, 0x95, 0x26, 0x19, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x82, 0xd5, 0x74, 0x5d, 0xe7, 0x03, 0xde,
+  0xff, 0x04, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xb7, 0xb5, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0x06, 0x19, 0x8c, 0x4a, 0x0b, 0x3a, 0x04, 0x07, 0x19, 0x81, 0xd3, 0x94, 0x02, 0xde, 0xff, 0x07, 0xfe,
+  0xff, 0x82, 0xdb, 0xd6, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x84, 0x07, 0x19, 0x2a, 0x42, 0xde, 0xf7, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xde, 0xff, 0xec, 0x5a, 0x03,
+  0xe6, 0x10, 0x82, 0x06, 0x19, 0x92, 0x8c, 0x06, 0xbd, 0xf7, 0x0a, 0x9d, 0xf7, 0x81, 0x9c, 0xef, 0x02, 0x7c, 0xef, 0x02, 0x5c, 0xef, 0x83, 0x7c, 0xef, 0x9d, 0xf7, 0xbd, 0xf7, 0x05, 0xdd, 0xff,
+  0x81, 0xde, 0xff, 0x0b, 0xfe, 0xff, 0x8c, 0x3a, 0xbe, 0x0a, 0x3a, 0xa5, 0x08, 0xa6, 0x08, 0xc7, 0x10, 0x0b, 0x3a, 0x54, 0x74, 0x96, 0x74, 0xb2, 0x5b, 0x28, 0x19, 0xa6, 0x08, 0xc6, 0x08, 0x03,
+  0xc6, 0x10, 0x03, 0xe6, 0x10, 0x03, 0xc6, 0x10, 0x81, 0xe6, 0x10, 0x06, 0xc6, 0x10, 0x85, 0x48, 0x19, 0x90, 0x5b, 0x12, 0x6c, 0xf6, 0x84, 0xea, 0x31, 0x03, 0xc6, 0x10, 0x83, 0xed, 0x4a, 0xf9,
+  0x95, 0xde, 0xf7, 0x03, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xd7, 0xb5, 0x07, 0x19, 0x03, 0x06, 0x19, 0x82, 0xcd, 0x52, 0x0b, 0x3a, 0x04, 0x07, 0x19, 0x81, 0xf3, 0x9c, 0x02, 0xde,
+  0xff, 0x07, 0xfe, 0xff, 0x88, 0xdb, 0xde, 0xe6, 0x10, 0x07, 0x11, 0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0xde, 0xf7, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xde, 0xff,
+  0xec, 0x5a, 0x03, 0xe6, 0x10, 0x83, 0xe6, 0x18, 0xf4, 0x94, 0x9d, 0xf7, 0x05, 0xbd, 0xf7, 0x0d, 0x9d, 0xf7, 0x81, 0xbd, 0xf7, 0x02, 0xbd, 0xff, 0x02, 0xbd, 0xf7, 0x06, 0xdd, 0xff, 0x0b, 0xfe,
+  0xff, 0x8d, 0x1c, 0xdf, 0xf6, 0x94, 0xa5, 0x08, 0x85, 0x08, 0xa6, 0x08, 0xc6, 0x08, 0xad, 0x4a, 0x95, 0x74, 0x75, 0x74, 0x13, 0x64, 0x8d, 0x42, 0xa6, 0x08, 0xc6, 0x08, 0x0d, 0xc6, 0x10, 0x87,
+  0xe7, 0x10, 0xad, 0x42, 0x33, 0x64, 0xb6, 0x74, 0x95, 0x7c, 0x4b, 0x42, 0xc6, 0x08, 0x02, 0xc6, 0x10, 0x83, 0x68, 0x21, 0x36, 0x8d, 0x5a, 0xae, 0x04, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xff,
+  0xff, 0xd7, 0xb5, 0x03, 0x06, 0x19, 0x83, 0x07, 0x19, 0xcd, 0x52, 0x2b, 0x3a, 0x04, 0x07, 0x19, 0x81, 0x14, 0x9d, 0x02, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x88, 0xdb, 0xde, 0xe6, 0x10, 0x07, 0x11,
+  0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0xde, 0xf7, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xde, 0xff, 0xec, 0x5a, 0x03, 0xe6, 0x10, 0x82, 0xe6, 0x18, 0x55, 0xa5, 0x04,
+  0xbd, 0xf7, 0x0f, 0x9d, 0xf7, 0x04, 0xbd, 0xf7, 0x02, 0xbd, 0xff, 0x05, 0xdd, 0xff, 0x0b, 0xfe, 0xff, 0x90, 0xbe, 0xf7, 0x19, 0xb6, 0x8f, 0x63, 0x84, 0x08, 0x85, 0x08, 0xa6, 0x08, 0xc6, 0x08,
+  0x0a, 0x32, 0x54, 0x6c, 0x74, 0x6c, 0x75, 0x6c, 0xf3, 0x63, 0x2c, 0x3a, 0xa7, 0x08, 0xc7, 0x08, 0xc7, 0x10, 0x08, 0xc6, 0x10, 0x87, 0xe7, 0x10, 0x4c, 0x32, 0xb1, 0x53, 0x33, 0x64, 0x95, 0x6c,
+  0x74, 0x74, 0xea, 0x31, 0x04, 0xc6, 0x10, 0x83, 0x94, 0x7c, 0xb8, 0x95, 0xdb, 0xce, 0x03, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x82, 0xdf, 0xff, 0xd7, 0xb5, 0x03, 0x06, 0x19, 0x83, 0x07, 0x19, 0xed,
+  0x52, 0x2b, 0x3a, 0x04, 0x07, 0x19, 0x81, 0x14, 0x9d, 0x02, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x88, 0xdb, 0xde, 0xe7, 0x10, 0x07, 0x19, 0x27, 0x19, 0x07, 0x19, 0x4a, 0x42, 0xde, 0xf7, 0xde, 0xff,
+  0x07, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xde, 0xff, 0xec, 0x5a, 0x04, 0xe6, 0x10, 0x81, 0x76, 0xa5, 0x13, 0x9d, 0xf7, 0x05, 0xbd, 0xf7, 0x83, 0xbd, 0xff, 0xbd, 0xf7, 0xbd, 0xff,
+  0x02, 0xdd, 0xff, 0x02, 0xde, 0xff, 0x0a, 0xfe, 0xff, 0x84, 0xff, 0xff, 0x5a, 0xbe, 0x98, 0x9d, 0x4b, 0x3a, 0x02, 0x85, 0x08, 0x85, 0xa6, 0x08, 0xc6, 0x08, 0x89, 0x21, 0xd2, 0x63, 0x74, 0x6c,
+  0x02, 0x75, 0x6c, 0x84, 0xd2, 0x5b, 0xee, 0x42, 0x0b, 0x2a, 0xe6, 0x10, 0x04, 0xa6, 0x08, 0x89, 0xc6, 0x10, 0xea, 0x29, 0xce, 0x42, 0x91, 0x53, 0xf3, 0x53, 0x13, 0x5c, 0x33, 0x64, 0x91, 0x5b,
+  0x47, 0x21, 0x04, 0xc6, 0x10, 0x84, 0xd0, 0x6b, 0xb8, 0x95, 0xb7, 0x8d, 0x5d, 0xef, 0x02, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xd7, 0xbd, 0x03, 0x06, 0x19, 0x84, 0x07, 0x19, 0xed,
+  0x52, 0x2b, 0x3a, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x81, 0x13, 0x9d, 0x03, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x82, 0xdb, 0xde, 0xe7, 0x10, 0x02, 0x27, 0x19, 0x82, 0x07, 0x19, 0x6a, 0x42, 0x03, 0xde,
+  0xff, 0x06, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x83, 0xfe, 0xff, 0xde, 0xff, 0xec, 0x5a, 0x04, 0xe6, 0x10, 0x81, 0x76, 0xad, 0x19, 0x9d, 0xf7, 0x03, 0xbd, 0xf7, 0x81, 0xdd, 0xff, 0x02, 0xde, 0xff,
+  0x03, 0xfe, 0xff, 0x82, 0xdf, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x91, 0xfb, 0xd6, 0xb8, 0x9d, 0x37, 0x8d, 0xa8, 0x29, 0x85, 0x08, 0xa5, 0x08, 0xa6, 0x08, 0xc6, 0x08, 0xe7,
+  0x10, 0xcd, 0x42, 0x33, 0x64, 0x75, 0x6c, 0x54, 0x64, 0x34, 0x5c, 0x13, 0x5c, 0xf3, 0x5b, 0xb2, 0x53, 0x03, 0x91, 0x53, 0x02, 0xd2, 0x53, 0x86, 0xd2, 0x4b, 0xf3, 0x53, 0x13, 0x5c, 0xd2, 0x5b,
+  0x2b, 0x32, 0xc7, 0x10, 0x04, 0xc6, 0x10, 0x84, 0x2e, 0x5b, 0xb8, 0x9d, 0xb8, 0x95, 0x19, 0xae, 0x02, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xf8, 0xbd, 0x03, 0x06, 0x19, 0x84, 0x07,
+  0x19, 0xed, 0x52, 0x2b, 0x3a, 0x07, 0x11, 0x03, 0x07, 0x19, 0x81, 0x34, 0x9d, 0x03, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x86, 0xda, 0xd6, 0x07, 0x11, 0x27, 0x11, 0x27, 0x19, 0x07, 0x19, 0x6a, 0x42,
+  0x03, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xec, 0x5a, 0x03, 0xe6, 0x10, 0x82, 0x06, 0x11, 0x96, 0xad, 0x03, 0x9d, 0xf7, 0x02, 0x9d, 0xef, 0x05, 0x9d, 0xf7, 0x81, 0x9d, 0xef, 0x10,
+  0x9d, 0xf7, 0x03, 0xbd, 0xf7, 0x82, 0xdd, 0xff, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x08, 0xff, 0xff, 0x88, 0xbe, 0xf7, 0x78, 0x9d, 0x99, 0x95, 0x17, 0x8d, 0x2a, 0x3a, 0x85, 0x08, 0xa5, 0x08, 0xa6,
+  0x08, 0x02, 0xc6, 0x08, 0x83, 0x07, 0x11, 0xee, 0x4a, 0xd2, 0x5b, 0x02, 0x54, 0x64, 0x81, 0x33, 0x5c, 0x03, 0x13, 0x5c, 0x81, 0x13, 0x54, 0x02, 0xf3, 0x53, 0x86, 0x13, 0x5c, 0xb2, 0x5b, 0x6c,
+  0x3a, 0xe7, 0x10, 0xe6, 0x10, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x86, 0xc6, 0x10, 0xb0, 0x6b, 0xb8, 0x9d, 0xd8, 0x9d, 0xb7, 0x95, 0x3c, 0xdf, 0x02, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x89, 0xff, 0xff,
+  0xf7, 0xbd, 0x06, 0x19, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0xed, 0x52, 0x2b, 0x3a, 0x07, 0x11, 0x02, 0xe7, 0x18, 0x85, 0x07, 0x19, 0x14, 0x9d, 0xdf, 0xff, 0xde, 0xff, 0xdf, 0xff, 0x06, 0xfe,
+  0xff, 0x87, 0xda, 0xd6, 0x07, 0x11, 0x27, 0x11, 0x27, 0x19, 0x07, 0x19, 0x8b, 0x4a, 0xde, 0xf7, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x0d, 0x5b, 0x02, 0xe6, 0x10, 0x02, 0x07,
+  0x11, 0x82, 0x96, 0xad, 0x9d, 0xf7, 0x05, 0x9d, 0xef, 0x81, 0x9c, 0xef, 0x03, 0x9d, 0xef, 0x03, 0x7d, 0xef, 0x81, 0x9d, 0xef, 0x02, 0x7d, 0xef, 0x0d, 0x9d, 0xef, 0x03, 0x9d, 0xf7, 0x82, 0xbd,
+  0xf7, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x07, 0xff, 0xff, 0x81, 0x5a, 0xbe, 0x02, 0x98, 0x95, 0x82, 0x77, 0x8d, 0x2e, 0x53, 0x02, 0xa6, 0x08, 0x03, 0xc6, 0x08, 0x86, 0xc6, 0x10, 0xc6, 0x08, 0x68,
+  0x21, 0x4b, 0x3a, 0xee, 0x4a, 0x0f, 0x4b, 0x02, 0x70, 0x53, 0x86, 0x90, 0x53, 0x50, 0x4b, 0x0f, 0x4b, 0xc9, 0x29, 0xc6, 0x10, 0xc7, 0x10, 0x02, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x86, 0x26, 0x19,
+  0x52, 0x7c, 0xb8, 0xa5, 0xd8, 0x9d, 0xf8, 0x9d, 0x7a, 0xbe, 0x02, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x82, 0xf7, 0xb5, 0x07, 0x19, 0x02, 0x06, 0x19, 0x83, 0x07, 0x19, 0xed, 0x52,
+  0x2b, 0x3a, 0x02, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x82, 0xb2, 0x94, 0xdf, 0xff, 0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x84, 0xde, 0xff, 0xb9, 0xd6, 0x07, 0x11,
+  0x27, 0x19, 0x02, 0x07, 0x19, 0x82, 0x8b, 0x4a, 0xdf, 0xff, 0x02, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x2d, 0x63, 0x04, 0x07, 0x11, 0x82, 0x93, 0x8c, 0x59, 0xc6, 0x03, 0x38, 0xc6,
+  0x81, 0x38, 0xbe, 0x03, 0xf7, 0xbd, 0x81, 0xd7, 0xb5, 0x03, 0xb6, 0xb5, 0x82, 0x95, 0xad, 0x75, 0xad, 0x03, 0x55, 0xa5, 0x81, 0xb6, 0xad, 0x02, 0xd7, 0xb5, 0x02, 0x18, 0xbe, 0x82, 0x59, 0xc6,
+  0x1c, 0xdf, 0x04, 0x9d, 0xef, 0x81, 0x7d, 0xef, 0x04, 0x5c, 0xef, 0x85, 0x7d, 0xef, 0x9c, 0xef, 0xbd, 0xf7, 0xbe, 0xff, 0xde, 0xff, 0x04, 0xff, 0xff, 0x88, 0xfe, 0xff, 0x9d, 0xf7, 0x57, 0x95,
+  0x78, 0x95, 0x78, 0x8d, 0x98, 0x95, 0x73, 0x74, 0xa8, 0x21, 0x02, 0xa6, 0x08, 0x83, 0xc6, 0x08, 0xc6, 0x10, 0xc6, 0x08, 0x0d, 0xc6, 0x10, 0x85, 0xe6, 0x10, 0xc6, 0x10, 0xac, 0x4a, 0x36, 0x95,
+  0xb8, 0x9d, 0x02, 0xd8, 0x9d, 0x82, 0x19, 0xa6, 0x9d, 0xef, 0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x08, 0xff, 0xff, 0x82, 0xd7, 0xb5, 0x07, 0x19, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0xed, 0x52,
+  0x2b, 0x3a, 0xe7, 0x10, 0x03, 0xe6, 0x10, 0x88, 0x10, 0x7c, 0xdb, 0xd6, 0xda, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0xfb, 0xe6, 0x1b, 0xe7, 0x3b, 0xef, 0x02, 0x5c, 0xef, 0x82, 0x17, 0xc6, 0x07, 0x11,
+  0x03, 0x07, 0x19, 0x82, 0x4b, 0x42, 0xdf, 0xff, 0x0b, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x2d, 0x63, 0x03, 0x07, 0x11, 0x82, 0x06, 0x11, 0xe6, 0x10, 0x14, 0xe7, 0x10, 0x03, 0xe6, 0x10, 0x87, 0x27,
+  0x21, 0x6f, 0x6b, 0xf8, 0xb5, 0x5c, 0xe7, 0x7d, 0xef, 0x7c, 0xe7, 0x5c, 0xe7, 0x03, 0x3c, 0xe7, 0x02, 0x1b, 0xdf, 0x02, 0x1b, 0xe7, 0x02, 0x3b, 0xe7, 0x83, 0x5c, 0xef, 0x9c, 0xf7, 0xbd, 0xf7,
+  0x02, 0xdd, 0xff, 0x8b, 0xfb, 0xd6, 0x37, 0x8d, 0x57, 0x8d, 0x37, 0x85, 0x57, 0x8d, 0x37, 0x85, 0x6f, 0x53, 0xe6, 0x10, 0xc6, 0x08, 0xc6, 0x10, 0xc6, 0x08, 0x0d, 0xc6, 0x10, 0x82, 0x0a, 0x32,
+  0x53, 0x7c, 0x02, 0x97, 0x9d, 0x85, 0xb7, 0x9d, 0xd8, 0x9d, 0xf8, 0x9d, 0x3c, 0xdf, 0xbe, 0xff, 0x03, 0xde, 0xff, 0x85, 0xbe, 0xff, 0xbd, 0xf7, 0x9d, 0xf7, 0x7d, 0xef, 0x5c, 0xef, 0x03, 0x3c,
+  0xe7, 0x82, 0x35, 0xa5, 0x07, 0x19, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0xcd, 0x52, 0x2b, 0x3a, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x82, 0xe6, 0x10, 0xef, 0x73, 0x02, 0x79, 0xce, 0x81, 0x79, 0xd6,
+  0x03, 0x99, 0xd6, 0x84, 0x9a, 0xd6, 0xba, 0xd6, 0xba, 0xde, 0xb5, 0xb5, 0x02, 0x07, 0x11, 0x83, 0x27, 0x19, 0x07, 0x19, 0x2a, 0x42, 0x02, 0xde, 0xff, 0x0a, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x4d,
+  0x6b, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x81, 0x06, 0x11, 0x04, 0xe6, 0x10, 0x05, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x04, 0xe7, 0x10, 0x0b, 0xe6, 0x10, 0x87, 0x4a, 0x42, 0xd8, 0xb5, 0x5d, 0xe7,
+  0x5c, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x1c, 0xdf, 0x06, 0x1b, 0xdf, 0x02, 0x1b, 0xe7, 0x8e, 0x3b, 0xe7, 0x5b, 0xef, 0x7c, 0xef, 0x9d, 0xf7, 0x39, 0xbe, 0x17, 0x85, 0x78, 0x8d, 0x16, 0x85, 0x77,
+  0x8d, 0x78, 0x8d, 0x36, 0x85, 0xb0, 0x5b, 0xc9, 0x29, 0xc6, 0x08, 0x0a, 0xc6, 0x10, 0x8a, 0xc6, 0x08, 0xcd, 0x4a, 0x93, 0x7c, 0x57, 0x95, 0x77, 0x95, 0x97, 0x95, 0x77, 0x95, 0x97, 0x95, 0xb7,
+  0x95, 0xdb, 0xce, 0x03, 0x9d, 0xf7, 0x83, 0x7c, 0xef, 0x5c, 0xef, 0x3c, 0xe7, 0x03, 0x1b, 0xe7, 0x03, 0xfb, 0xde, 0x82, 0xdb, 0xd6, 0xd3, 0x94, 0x03, 0x06, 0x19, 0x83, 0x07, 0x19, 0xcd, 0x52,
+  0x2b, 0x3a, 0x03, 0xe7, 0x10, 0x83, 0xe6, 0x10, 0xef, 0x73, 0x79, 0xce, 0x03, 0x9a, 0xce, 0x02, 0x99, 0xce, 0x03, 0x9a, 0xce, 0x81, 0x75, 0xad, 0x02, 0x07, 0x11, 0x83, 0x27, 0x19, 0x07, 0x19,
+  0x4a, 0x42, 0x02, 0xde, 0xff, 0x0a, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x8f, 0x73, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x83, 0x06, 0x11, 0x07, 0x11, 0xe6, 0x10, 0x07, 0xe7, 0x10, 0x02, 0xe6, 0x10,
+  0x04, 0xe7, 0x10, 0x81, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x0a, 0xe6, 0x10, 0x85, 0x72, 0x8c, 0x3d, 0xe7, 0x3c, 0xe7, 0x3c, 0xdf, 0x1c, 0xdf, 0x09, 0x1b, 0xdf, 0x02, 0x1b, 0xe7, 0x8f, 0x3b, 0xe7,
+  0x5c, 0xef, 0xf8, 0xb5, 0x16, 0x85, 0x57, 0x8d, 0x77, 0x8d, 0x57, 0x8d, 0xb8, 0x95, 0xb9, 0x95, 0x78, 0x8d, 0xd5, 0x7c, 0xd1, 0x63, 0xcd, 0x4a, 0xe9, 0x29, 0x47, 0x19, 0x02, 0x06, 0x19, 0x8e,
+  0x68, 0x21, 0x0a, 0x32, 0x2e, 0x5b, 0x12, 0x74, 0x36, 0x8d, 0x97, 0x9d, 0x36, 0x8d, 0x16, 0x8d, 0x56, 0x8d, 0x36, 0x8d, 0x56, 0x8d, 0x36, 0x85, 0x9a, 0xc6, 0x7d, 0xef, 0x02, 0x5c, 0xef, 0x81,
+  0x3c, 0xe7, 0x02, 0x3b, 0xe7, 0x81, 0x1c, 0xe7, 0x03, 0x1b, 0xdf, 0x03, 0xfb, 0xde, 0x82, 0xfb, 0xd6, 0xd4, 0x94, 0x03, 0x06, 0x19, 0x83, 0x07, 0x19, 0xed, 0x52, 0x2b, 0x3a, 0x03, 0xe7, 0x10,
+  0x83, 0xe6, 0x10, 0x10, 0x7c, 0xba, 0xce, 0x02, 0xbb, 0xce, 0x02, 0xbb, 0xd6, 0x82, 0xba, 0xd6, 0xba, 0xce, 0x02, 0x9a, 0xce, 0x81, 0x76, 0xad, 0x02, 0x07, 0x11, 0x85, 0x27, 0x19, 0x07, 0x19,
+  0x4a, 0x42, 0xdf, 0xff, 0xde, 0xff, 0x0a, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xf3, 0x9c, 0x02, 0xe7, 0x10, 0x81, 0x07, 0x11, 0x08, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x04, 0xe6, 0x10, 0x02, 0xe7, 0x10,
+  0x02, 0xe6, 0x10, 0x06, 0xe7, 0x10, 0x82, 0xe6, 0x10, 0xc6, 0x10, 0x05, 0xe6, 0x10, 0x83, 0x06, 0x11, 0x32, 0x84, 0x1d, 0xdf, 0x02, 0x3c, 0xdf, 0x81, 0x1b, 0xdf, 0x02, 0x1c, 0xdf, 0x09, 0x1b,
+  0xdf, 0x86, 0x1b, 0xe7, 0x3c, 0xe7, 0x7a, 0xc6, 0x37, 0x85, 0x98, 0x8d, 0x37, 0x85, 0x02, 0x57, 0x8d, 0x82, 0x78, 0x8d, 0xb9, 0x95, 0x02, 0xb8, 0x95, 0x82, 0xb8, 0x9d, 0x98, 0x95, 0x02, 0x77,
+  0x95, 0x83, 0xb8, 0x9d, 0xd9, 0x9d, 0x77, 0x95, 0x02, 0x57, 0x8d, 0x02, 0x16, 0x8d, 0x86, 0x16, 0x85, 0x36, 0x85, 0xf5, 0x84, 0x36, 0x85, 0xdb, 0xce, 0x5c, 0xe7, 0x04, 0x3c, 0xe7, 0x83, 0x3b,
+  0xe7, 0x1b, 0xe7, 0x1c, 0xe7, 0x04, 0x1b, 0xdf, 0x02, 0xfb, 0xde, 0x82, 0xfb, 0xd6, 0xf4, 0x94, 0x03, 0x06, 0x19, 0x83, 0x07, 0x19, 0xcd, 0x52, 0x2b, 0x3a, 0x02, 0xe7, 0x10, 0x83, 0x07, 0x19,
+  0x06, 0x19, 0x30, 0x84, 0x04, 0xdb, 0xd6, 0x81, 0xfb, 0xd6, 0x02, 0xdb, 0xd6, 0x02, 0xba, 0xce, 0x83, 0x96, 0xad, 0x06, 0x11, 0x07, 0x11, 0x02, 0x07, 0x19, 0x81, 0x4a, 0x42, 0x02, 0xde, 0xff,
+  0x0b, 0xfe, 0xff, 0x84, 0x7d, 0xef, 0xf0, 0x7b, 0xc8, 0x31, 0xe8, 0x31, 0x02, 0xe9, 0x39, 0x03, 0x09, 0x3a, 0x84, 0xe9, 0x31, 0xc9, 0x31, 0xa8, 0x31, 0x88, 0x29, 0x02, 0x67, 0x29, 0x03, 0x67,
+  0x21, 0x03, 0x87, 0x29, 0x02, 0xa8, 0x29, 0x82, 0xc8, 0x31, 0xe9, 0x31, 0x02, 0x09, 0x3a, 0x83, 0xe8, 0x31, 0x06, 0x19, 0xc6, 0x10, 0x04, 0xe6, 0x10, 0x83, 0x06, 0x11, 0xe7, 0x18, 0xb4, 0x94,
+  0x03, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x0c, 0x1b, 0xdf, 0x86, 0xda, 0xd6, 0x97, 0x9d, 0x37, 0x85, 0x57, 0x85, 0x37, 0x85, 0x57, 0x8d, 0x06, 0x98, 0x95, 0x02, 0xb8, 0x9d, 0x81, 0x98, 0x95, 0x02,
+  0x77, 0x95, 0x87, 0x57, 0x8d, 0x36, 0x8d, 0xd5, 0x7c, 0x36, 0x85, 0xf5, 0x7c, 0x36, 0x95, 0x1c, 0xdf, 0x03, 0x3c, 0xe7, 0x03, 0x3b, 0xe7, 0x02, 0x1b, 0xe7, 0x81, 0x1c, 0xdf, 0x04, 0x1b, 0xdf,
+  0x02, 0xfb, 0xde, 0x82, 0xfb, 0xd6, 0xf4, 0x94, 0x03, 0x06, 0x19, 0x83, 0x07, 0x19, 0xcd, 0x52, 0x2b, 0x3a, 0x02, 0xe7, 0x10, 0x83, 0x07, 0x19, 0x06, 0x19, 0x51, 0x84, 0x06, 0xfb, 0xd6, 0x03,
+  0xdb, 0xd6, 0x83, 0xb6, 0xad, 0x06, 0x11, 0x07, 0x11, 0x02, 0x07, 0x19, 0x81, 0x4a, 0x42, 0x02, 0xde, 0xff, 0x0d, 0xfe, 0xff, 0x81, 0xdf, 0xf7, 0x02, 0xde, 0xf7, 0x84, 0xdf, 0xff, 0xde, 0xff,
+  0xfe, 0xff, 0xfe, 0xf7, 0x02, 0xde, 0xf7, 0x82, 0xbe, 0xf7, 0xbd, 0xf7, 0x04, 0x9d, 0xef, 0x02, 0x9e, 0xef, 0x8d, 0x9d, 0xef, 0x9e, 0xef, 0xbe, 0xf7, 0xbd, 0xf7, 0xdd, 0xf7, 0xde, 0xf7, 0xdf,
+  0xff, 0xfe, 0xff, 0xde, 0xf7, 0x5c, 0xe7, 0x18, 0xbe, 0xec, 0x5a, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x83, 0x07, 0x11, 0x07, 0x19, 0x39, 0xbe, 0x02, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x0c, 0x1b, 0xdf,
+  0x83, 0x1b, 0xe7, 0x3c, 0xe7, 0x7a, 0xc6, 0x02, 0x16, 0x85, 0x85, 0x37, 0x85, 0x57, 0x8d, 0x57, 0x85, 0x77, 0x8d, 0x78, 0x8d, 0x04, 0x77, 0x8d, 0x04, 0x57, 0x8d, 0x85, 0x37, 0x85, 0xf5, 0x7c,
+  0x36, 0x8d, 0xba, 0xc6, 0x5c, 0xe7, 0x06, 0x3b, 0xe7, 0x03, 0x1b, 0xe7, 0x81, 0x3c, 0xdf, 0x05, 0x1b, 0xdf, 0x83, 0xfb, 0xde, 0xfb, 0xd6, 0xf4, 0x9c, 0x03, 0x06, 0x19, 0x84, 0x07, 0x19, 0xcd,
+  0x4a, 0x2b, 0x3a, 0x07, 0x11, 0x03, 0x07, 0x19, 0x83, 0x71, 0x8c, 0xfb, 0xde, 0xfb, 0xd6, 0x03, 0xfb, 0xde, 0x02, 0xfb, 0xd6, 0x02, 0xdb, 0xd6, 0x83, 0xb7, 0xb5, 0x06, 0x11, 0x07, 0x11, 0x02,
+  0x07, 0x19, 0x82, 0x4a, 0x42, 0xde, 0xf7, 0x02, 0xde, 0xff, 0x12, 0xfe, 0xff, 0x0f, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x84, 0xbd, 0xf7, 0x92, 0x8c, 0xc6, 0x10,
+  0xe6, 0x10, 0x02, 0xe7, 0x10, 0x83, 0x07, 0x11, 0x2e, 0x5b, 0x3d, 0xe7, 0x03, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x0d, 0x1b, 0xdf, 0x88, 0x1c, 0xdf, 0x39, 0xb6, 0x56, 0x85, 0x37, 0x7d, 0x57, 0x7d,
+  0x57, 0x85, 0x57, 0x8d, 0x57, 0x85, 0x02, 0x57, 0x8d, 0x88, 0x77, 0x8d, 0x36, 0x85, 0x57, 0x85, 0x37, 0x7d, 0x15, 0x7d, 0xd8, 0xa5, 0xbb, 0xc6, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x06, 0x3b, 0xe7,
+  0x81, 0x1b, 0xe7, 0x02, 0x3b, 0xdf, 0x04, 0x1b, 0xdf, 0x81, 0x1c, 0xdf, 0x03, 0x1b, 0xdf, 0x82, 0x14, 0x9d, 0x07, 0x19, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0xac, 0x4a, 0x2b, 0x3a, 0x07, 0x11,
+  0x03, 0x07, 0x19, 0x81, 0x92, 0x8c, 0x02, 0x1c, 0xdf, 0x04, 0x1b, 0xdf, 0x02, 0xfb, 0xd6, 0x82, 0xdb, 0xd6, 0xb7, 0xb5, 0x02, 0x07, 0x11, 0x02, 0x07, 0x19, 0x82, 0x4a, 0x42, 0xbe, 0xf7, 0x03,
+  0xde, 0xff, 0x05, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x0f, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xde, 0xff,
+  0x05, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0x10, 0x7c, 0x03, 0xe7, 0x10, 0x85, 0x07, 0x11, 0x06, 0x11, 0x39, 0xc6, 0x3c, 0xe7, 0x3c, 0xdf, 0x03, 0x1c, 0xdf, 0x81, 0x1b, 0xdf, 0x02, 0x3c, 0xdf, 0x0a,
+  0x1b, 0xdf, 0x92, 0x1b, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0xba, 0xce, 0x19, 0xb6, 0xb7, 0xa5, 0x76, 0x95, 0x56, 0x8d, 0x57, 0x8d, 0xf6, 0x84, 0x16, 0x8d, 0x36, 0x8d, 0x19, 0xae, 0xdb, 0xce, 0x5d,
+  0xe7, 0x7d, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x04, 0x3b, 0xe7, 0x05, 0x1b, 0xe7, 0x02, 0x3c, 0xdf, 0x03, 0x1b, 0xdf, 0x05, 0x1c, 0xdf, 0x82, 0x15, 0x9d, 0x07, 0x19, 0x02, 0x06, 0x19, 0x84, 0x07,
+  0x19, 0xcd, 0x52, 0x4b, 0x3a, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x81, 0x92, 0x8c, 0x05, 0x1c, 0xdf, 0x81, 0x1b, 0xdf, 0x02, 0xfb, 0xde, 0x82, 0xfb, 0xd6, 0xd7, 0xb5, 0x02, 0x07, 0x11, 0x02, 0x07,
+  0x19, 0x82, 0x2a, 0x42, 0xbe, 0xf7, 0x06, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x1a, 0xfe, 0xff, 0x82, 0x5c, 0xe7, 0x88, 0x31, 0x03, 0xe7, 0x10,
+  0x82, 0x07, 0x11, 0xf4, 0x94, 0x02, 0x3c, 0xe7, 0x09, 0x3c, 0xdf, 0x81, 0x1c, 0xdf, 0x07, 0x1b, 0xdf, 0x02, 0x3c, 0xe7, 0x83, 0x5c, 0xe7, 0x7d, 0xef, 0x9d, 0xef, 0x03, 0xbe, 0xf7, 0x81, 0x9d,
+  0xef, 0x02, 0xbd, 0xf7, 0x84, 0x9d, 0xef, 0x7d, 0xef, 0x7c, 0xe7, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x81, 0x3b, 0xe7, 0x06, 0x1b, 0xe7, 0x81, 0x3b, 0xdf, 0x03, 0x3c, 0xdf, 0x03, 0x1b, 0xdf, 0x05,
+  0x1c, 0xdf, 0x81, 0x15, 0x9d, 0x03, 0x06, 0x19, 0x84, 0x07, 0x19, 0xcd, 0x52, 0x4b, 0x42, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x03, 0x3c, 0xdf, 0x03, 0x1c, 0xdf, 0x86, 0x1b, 0xdf,
+  0xfb, 0xde, 0xfb, 0xd6, 0xd7, 0xb5, 0x07, 0x11, 0x27, 0x19, 0x02, 0x07, 0x19, 0x82, 0x6b, 0x4a, 0xbe, 0xf7, 0x03, 0xde, 0xf7, 0x81, 0xdd, 0xf7, 0x08, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x04, 0xde,
+  0xff, 0x1a, 0xfe, 0xff, 0x82, 0x72, 0x8c, 0x07, 0x11, 0x03, 0xe7, 0x10, 0x83, 0x4e, 0x63, 0x3d, 0xe7, 0x3c, 0xe7, 0x0a, 0x3c, 0xdf, 0x07, 0x1b, 0xdf, 0x02, 0x3c, 0xe7, 0x84, 0x5c, 0xe7, 0x7c,
+  0xef, 0x7d, 0xef, 0x9d, 0xef, 0x02, 0xbd, 0xf7, 0x81, 0xbe, 0xf7, 0x02, 0xbd, 0xf7, 0x84, 0x9d, 0xef, 0x7d, 0xef, 0x7c, 0xe7, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x07, 0x1b, 0xe7, 0x81, 0x3b, 0xdf,
+  0x02, 0x3c, 0xdf, 0x04, 0x1b, 0xdf, 0x05, 0x1c, 0xdf, 0x81, 0x35, 0xa5, 0x03, 0x06, 0x19, 0x84, 0x07, 0x19, 0xcd, 0x52, 0x6c, 0x42, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x03, 0x3c,
+  0xe7, 0x81, 0x3c, 0xdf, 0x03, 0x1c, 0xdf, 0x83, 0x1b, 0xdf, 0xfb, 0xd6, 0xd7, 0xb5, 0x04, 0x07, 0x19, 0x82, 0x8b, 0x4a, 0xbe, 0xf7, 0x0c, 0xbd, 0xf7, 0x03, 0xde, 0xff, 0x83, 0xde, 0xf7, 0xde,
+  0xff, 0xbe, 0xff, 0x02, 0xbe, 0xf7, 0x02, 0xbd, 0xf7, 0x82, 0x9d, 0xf7, 0xbe, 0xf7, 0x03, 0x9d, 0xf7, 0x03, 0xbe, 0xf7, 0x82, 0xbd, 0xf7, 0x9d, 0xf7, 0x04, 0xbe, 0xf7, 0x81, 0xde, 0xf7, 0x08,
+  0xde, 0xff, 0x82, 0xf8, 0xbd, 0x07, 0x11, 0x03, 0xe7, 0x10, 0x83, 0x4a, 0x42, 0x1c, 0xe7, 0x3c, 0xe7, 0x0a, 0x3c, 0xdf, 0x06, 0x1b, 0xdf, 0x81, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x02, 0x5c, 0xe7,
+  0x02, 0x9d, 0xef, 0x04, 0xbe, 0xf7, 0x83, 0xbd, 0xef, 0x9d, 0xef, 0x7d, 0xe7, 0x02, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x82, 0x3b, 0xe7, 0x1b, 0xe7, 0x08, 0x3c, 0xdf, 0x06, 0x1b, 0xdf, 0x03, 0x1c,
+  0xdf, 0x81, 0x35, 0xa5, 0x03, 0x06, 0x19, 0x84, 0x07, 0x19, 0xed, 0x52, 0x6c, 0x42, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x81, 0x92, 0x8c, 0x03, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x03, 0x1c, 0xdf, 0x83,
+  0x1b, 0xdf, 0xfb, 0xd6, 0xd7, 0xb5, 0x04, 0x07, 0x19, 0x81, 0x6a, 0x42, 0x07, 0x9d, 0xf7, 0x02, 0x7d, 0xf7, 0x81, 0x7d, 0xef, 0x03, 0x7c, 0xef, 0x02, 0x7d, 0xef, 0x03, 0x7c, 0xef, 0x03, 0x5c,
+  0xef, 0x0e, 0x5c, 0xe7, 0x03, 0x5c, 0xef, 0x02, 0x7c, 0xef, 0x81, 0x7d, 0xef, 0x02, 0x9d, 0xf7, 0x85, 0xbd, 0xf7, 0xdd, 0xf7, 0xdd, 0xff, 0x18, 0xbe, 0x07, 0x11, 0x03, 0xe7, 0x10, 0x83, 0x88,
+  0x29, 0x1c, 0xdf, 0x3c, 0xe7, 0x0c, 0x3c, 0xdf, 0x03, 0x1b, 0xdf, 0x82, 0x1c, 0xdf, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x02, 0x5c, 0xe7, 0x83, 0x7d, 0xef, 0x9d, 0xef, 0x5d, 0xe7, 0x02, 0x59, 0xc6,
+  0x84, 0x5d, 0xe7, 0xbe, 0xf7, 0x9d, 0xef, 0x7d, 0xe7, 0x02, 0x5c, 0xe7, 0x03, 0x3c, 0xe7, 0x81, 0x3b, 0xe7, 0x07, 0x3c, 0xdf, 0x07, 0x1b, 0xdf, 0x03, 0x1c, 0xdf, 0x81, 0x35, 0xa5, 0x03, 0x06,
+  0x19, 0x84, 0x07, 0x19, 0xed, 0x52, 0x4c, 0x42, 0x07, 0x11, 0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x03, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x03, 0x1c, 0xdf, 0x02, 0x1b, 0xdf, 0x82, 0xd7, 0xb5, 0x07,
+  0x11, 0x03, 0x07, 0x19, 0x82, 0x4a, 0x42, 0x9d, 0xef, 0x04, 0x7c, 0xef, 0x0b, 0x5c, 0xef, 0x81, 0x7c, 0xef, 0x12, 0x5c, 0xe7, 0x04, 0x5c, 0xef, 0x02, 0x7c, 0xef, 0x82, 0x9d, 0xef, 0x9d, 0xf7,
+  0x02, 0xbd, 0xf7, 0x82, 0xde, 0xf7, 0xf4, 0x9c, 0x04, 0xe7, 0x10, 0x83, 0xec, 0x52, 0x3c, 0xdf, 0x3c, 0xe7, 0x0c, 0x3c, 0xdf, 0x03, 0x1b, 0xdf, 0x81, 0x3c, 0xdf, 0x03, 0x3c, 0xe7, 0x02, 0x5c,
+  0xe7, 0x89, 0x7d, 0xef, 0x9a, 0xce, 0x6a, 0x4a, 0xc6, 0x08, 0xa5, 0x08, 0xa8, 0x31, 0xd8, 0xb5, 0x7d, 0xef, 0x7d, 0xe7, 0x02, 0x5c, 0xe7, 0x04, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x07, 0x1b, 0xdf,
+  0x05, 0x3c, 0xdf, 0x82, 0x35, 0xa5, 0x07, 0x19, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0xcd, 0x52, 0x4c, 0x42, 0x07, 0x11, 0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x03, 0x3c, 0xe7, 0x81, 0x3c, 0xdf,
+  0x03, 0x1c, 0xdf, 0x84, 0x1b, 0xdf, 0xfb, 0xd6, 0xd7, 0xb5, 0x07, 0x11, 0x03, 0x07, 0x19, 0x84, 0x2a, 0x42, 0x7d, 0xef, 0x7c, 0xef, 0x5c, 0xef, 0x0b, 0x5c, 0xe7, 0x02, 0x5c, 0xef, 0x14, 0x5c,
+  0xe7, 0x03, 0x5c, 0xef, 0x02, 0x7c, 0xef, 0x81, 0x9d, 0xef, 0x02, 0x9d, 0xf7, 0x83, 0xbd, 0xf7, 0x9d, 0xef, 0x4a, 0x42, 0x03, 0xe7, 0x10, 0x82, 0x07, 0x11, 0xf0, 0x7b, 0x0e, 0x3c, 0xdf, 0x03,
+  0x1b, 0xdf, 0x81, 0x3c, 0xdf, 0x03, 0x3c, 0xe7, 0x02, 0x5c, 0xe7, 0x83, 0xfb, 0xde, 0xc8, 0x31, 0xa6, 0x08, 0x04, 0xc6, 0x08, 0x82, 0x39, 0xbe, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x03, 0x3c, 0xe7,
+  0x05, 0x3c, 0xdf, 0x08, 0x1b, 0xdf, 0x05, 0x3c, 0xdf, 0x82, 0x35, 0x9d, 0x07, 0x19, 0x02, 0x06, 0x19, 0x83, 0x07, 0x19, 0xed, 0x52, 0x4b, 0x42, 0x04, 0x07, 0x19, 0x81, 0x71, 0x84, 0x03, 0x3c,
+  0xe7, 0x81, 0x3c, 0xdf, 0x03, 0x1c, 0xdf, 0x83, 0x1b, 0xdf, 0xfb, 0xd6, 0xd7, 0xb5, 0x04, 0x07, 0x19, 0x82, 0x29, 0x42, 0x5d, 0xe7, 0x04, 0x5c, 0xe7, 0x04, 0x3c, 0xe7, 0x1c, 0x5c, 0xe7, 0x02,
+  0x5c, 0xef, 0x03, 0x7c, 0xef, 0x85, 0x9d, 0xef, 0x9d, 0xf7, 0xbd, 0xf7, 0x18, 0xbe, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x82, 0x07, 0x19, 0x15, 0x9d, 0x0e, 0x3c, 0xdf, 0x03, 0x1b, 0xdf, 0x02, 0x3c,
+  0xdf, 0x81, 0x3c, 0xe7, 0x03, 0x5c, 0xe7, 0x82, 0x14, 0x9d, 0xa5, 0x08, 0x02, 0xa6, 0x08, 0x03, 0xc6, 0x08, 0x82, 0x4e, 0x63, 0x7d, 0xef, 0x02, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x06, 0x3c, 0xdf,
+  0x08, 0x1b, 0xdf, 0x05, 0x3c, 0xdf, 0x82, 0x35, 0x9d, 0x07, 0x19, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0xed, 0x52, 0x4b, 0x3a, 0x07, 0x11, 0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x03, 0x3c, 0xe7,
+  0x81, 0x3c, 0xdf, 0x03, 0x1c, 0xdf, 0x83, 0x1b, 0xdf, 0xfb, 0xd6, 0xd7, 0xb5, 0x04, 0x07, 0x19, 0x81, 0x29, 0x42, 0x02, 0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x1b, 0x5c, 0xe7, 0x05, 0x7c, 0xef, 0x84,
+  0x9c, 0xef, 0x9d, 0xf7, 0xfb, 0xde, 0x09, 0x3a, 0x02, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x82, 0x27, 0x19, 0x39, 0xbe, 0x0e, 0x3c, 0xdf, 0x03, 0x1b, 0xdf, 0x81, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x02,
+  0x5c, 0xe7, 0x85, 0x7d, 0xef, 0x2d, 0x63, 0xa6, 0x08, 0xa5, 0x08, 0xa6, 0x08, 0x03, 0xc6, 0x08, 0x82, 0x87, 0x29, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x06, 0x3c, 0xdf, 0x07, 0x1b,
+  0xdf, 0x06, 0x3c, 0xdf, 0x82, 0x35, 0x9d, 0x07, 0x19, 0x02, 0x06, 0x19, 0x84, 0x07, 0x19, 0xed, 0x52, 0x4b, 0x3a, 0x07, 0x11, 0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x03, 0x3c, 0xe7, 0x81, 0x3c,
+  0xdf, 0x03, 0x1c, 0xdf, 0x83, 0x1b, 0xdf, 0xfb, 0xd6, 0xd7, 0xb5, 0x04, 0x07, 0x19, 0x81, 0x29, 0x42, 0x02, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x17, 0x5c, 0xe7, 0x81, 0x7c, 0xef, 0x02, 0x5c, 0xe7,
+  0x04, 0x7c, 0xef, 0x02, 0x9d, 0xef, 0x83, 0x38, 0xbe, 0x2a, 0x3a, 0x07, 0x11, 0x02, 0xe6, 0x10, 0x02, 0x07, 0x19, 0x83, 0x0d, 0x5b, 0x7b, 0xc6, 0x3d, 0xdf, 0x04, 0x3c, 0xdf, 0x04, 0x3c, 0xe7,
+  0x05, 0x3c, 0xdf, 0x03, 0x1b, 0xdf, 0x81, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x02, 0x5c, 0xe7, 0x82, 0x7d, 0xef, 0x8e, 0x6b, 0x03, 0xa6, 0x08, 0x03, 0xc6, 0x08, 0x83, 0xec, 0x5a, 0x5d, 0xe7, 0x5c,
+  0xe7, 0x03, 0x3c, 0xe7, 0x06, 0x3c, 0xdf, 0x06, 0x1b, 0xdf, 0x06, 0x3c, 0xdf, 0x83, 0x1c, 0xdf, 0x35, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x83, 0xed, 0x52, 0x4b, 0x3a, 0xe7, 0x10, 0x03, 0x07,
+  0x19, 0x81, 0x72, 0x8c, 0x03, 0x3c, 0xe7, 0x03, 0x3c, 0xdf, 0x85, 0x1c, 0xdf, 0x1b, 0xdf, 0xfb, 0xde, 0xd7, 0xb5, 0x06, 0x11, 0x03, 0x07, 0x19, 0x83, 0x4a, 0x42, 0x5d, 0xe7, 0x5c, 0xe7, 0x09,
+  0x3c, 0xe7, 0x03, 0x5c, 0xe7, 0x84, 0x3c, 0xdf, 0x38, 0xbe, 0xf8, 0xb5, 0xd7, 0xb5, 0x03, 0xf8, 0xb5, 0x02, 0x18, 0xbe, 0x84, 0xf8, 0xb5, 0xd7, 0xb5, 0xb7, 0xb5, 0x97, 0xad, 0x05, 0x96, 0xad,
+  0x82, 0xb7, 0xad, 0xb7, 0xb5, 0x02, 0xd8, 0xb5, 0x87, 0xf8, 0xb5, 0xf8, 0xbd, 0xd7, 0xb5, 0x96, 0xad, 0x76, 0xad, 0xb3, 0x94, 0x4a, 0x42, 0x04, 0x07, 0x11, 0x86, 0xe7, 0x10, 0x07, 0x11, 0x67,
+  0x29, 0x76, 0xa5, 0x5a, 0xb6, 0x3d, 0xdf, 0x03, 0x3c, 0xdf, 0x06, 0x3c, 0xe7, 0x09, 0x3c, 0xdf, 0x81, 0x3c, 0xe7, 0x02, 0x5c, 0xe7, 0x82, 0x7d, 0xef, 0xb7, 0xb5, 0x04, 0xa6, 0x08, 0x85, 0xc6,
+  0x08, 0xa5, 0x08, 0xb7, 0xad, 0x5d, 0xe7, 0x5c, 0xe7, 0x04, 0x3c, 0xe7, 0x11, 0x3c, 0xdf, 0x83, 0x1c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x03, 0x06, 0x19, 0x83, 0xad, 0x52, 0x2b, 0x3a, 0xe7, 0x10,
+  0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x04, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x85, 0x1c, 0xdf, 0x1b, 0xdf, 0xfb, 0xde, 0xd7, 0xb5, 0x06, 0x11, 0x03, 0x07, 0x19, 0x82, 0x8b, 0x4a, 0x5d, 0xe7, 0x02,
+  0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x02, 0x5c, 0xe7, 0x84, 0xba, 0xd6, 0x4a, 0x42, 0xe6, 0x18, 0xe7, 0x18, 0x03, 0x07, 0x19, 0x82, 0xe6, 0x10, 0xe7, 0x10, 0x0a, 0xe6, 0x10, 0x05, 0xe7, 0x10, 0x81,
+  0xe6, 0x10, 0x03, 0xe7, 0x10, 0x07, 0x07, 0x11, 0x85, 0x27, 0x19, 0x93, 0x84, 0xf8, 0xad, 0x3a, 0xae, 0x5d, 0xe7, 0x02, 0x3c, 0xdf, 0x07, 0x3c, 0xe7, 0x09, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x81,
+  0x5c, 0xe7, 0x02, 0x5d, 0xe7, 0x81, 0x31, 0x7c, 0x03, 0xa6, 0x08, 0x83, 0xc5, 0x10, 0x52, 0x84, 0x3c, 0xdf, 0x08, 0x3c, 0xe7, 0x0e, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x82, 0x35, 0x9d, 0x07, 0x19,
+  0x03, 0x06, 0x19, 0x83, 0x8c, 0x4a, 0x4b, 0x3a, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x04, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x83, 0x1b, 0xdf, 0xd7, 0xb5, 0xe7, 0x10,
+  0x03, 0x07, 0x19, 0x82, 0x4a, 0x42, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x81, 0xcf, 0x7b, 0x03, 0x07, 0x19, 0x03, 0x07, 0x11, 0x0f, 0xe6, 0x10, 0x05, 0xe7, 0x10, 0x04, 0x07, 0x11,
+  0x03, 0x07, 0x19, 0x82, 0x88, 0x29, 0xb4, 0x8c, 0x02, 0xd8, 0xa5, 0x82, 0x7b, 0xb6, 0x7d, 0xe7, 0x02, 0x3c, 0xdf, 0x07, 0x3c, 0xe7, 0x07, 0x3c, 0xdf, 0x82, 0x1c, 0xdf, 0x3c, 0xdf, 0x03, 0x3c,
+  0xe7, 0x88, 0x5c, 0xe7, 0x5d, 0xe7, 0x5c, 0xe7, 0x79, 0xce, 0x76, 0xad, 0x55, 0xa5, 0x7a, 0xc6, 0x5d, 0xe7, 0x0a, 0x3c, 0xe7, 0x03, 0x3c, 0xdf, 0x04, 0x1b, 0xdf, 0x81, 0x1c, 0xdf, 0x05, 0x3c,
+  0xdf, 0x02, 0x1c, 0xdf, 0x82, 0x35, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x83, 0x6b, 0x42, 0x4b, 0x42, 0x07, 0x11, 0x03, 0x07, 0x19, 0x81, 0x92, 0x8c, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02,
+  0x1c, 0xdf, 0x83, 0x1b, 0xdf, 0xd7, 0xb5, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x82, 0x2a, 0x3a, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x86, 0x3c, 0xdf, 0x6b, 0x4a, 0x07, 0x19, 0xe7, 0x10,
+  0x07, 0x11, 0x06, 0x11, 0x16, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x03, 0x07, 0x11, 0x02, 0x07, 0x19, 0x82, 0xcd, 0x52, 0x56, 0x9d, 0x02, 0xd8, 0xa5, 0x83, 0xf8, 0xa5, 0xdc, 0xc6, 0x5d, 0xe7, 0x09,
+  0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x04, 0x1c, 0xdf, 0x81, 0x3c, 0xdf, 0x03, 0x3c, 0xe7, 0x83, 0x5c, 0xe7, 0x5d, 0xe7, 0x7d, 0xe7, 0x03, 0x5d, 0xe7, 0x81, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x04, 0x3c,
+  0xdf, 0x04, 0x1b, 0xdf, 0x03, 0x1c, 0xdf, 0x03, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x82, 0x34, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x83, 0x0a, 0x3a, 0x4c, 0x42, 0x07, 0x11, 0x02, 0x07, 0x19, 0x82,
+  0x27, 0x19, 0x92, 0x8c, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x83, 0x1b, 0xdf, 0xf8, 0xb5, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x82, 0x2a, 0x42, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x09,
+  0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0xe9, 0x31, 0x02, 0xe7, 0x10, 0x0a, 0xe6, 0x10, 0x09, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x81, 0xc6, 0x10, 0x04, 0xe6, 0x10, 0x86, 0xe7, 0x10, 0x07, 0x11, 0x8c, 0x42,
+  0x73, 0x7c, 0x97, 0x9d, 0xb8, 0xa5, 0x02, 0xd8, 0xa5, 0x83, 0xf9, 0xad, 0x5d, 0xdf, 0x5c, 0xe7, 0x0a, 0x3c, 0xe7, 0x04, 0x3c, 0xdf, 0x04, 0x1c, 0xdf, 0x81, 0x3c, 0xdf, 0x04, 0x3c, 0xe7, 0x05,
+  0x5d, 0xe7, 0x06, 0x3c, 0xe7, 0x07, 0x3c, 0xdf, 0x05, 0x1b, 0xdf, 0x04, 0x1c, 0xdf, 0x02, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x82, 0x14, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x82, 0x0a, 0x3a, 0x6c,
+  0x42, 0x04, 0x07, 0x19, 0x82, 0x92, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x85, 0x3c, 0xdf, 0x1c, 0xdf, 0x1b, 0xdf, 0xf8, 0xb5, 0xe6, 0x10, 0x02, 0x07, 0x19, 0x83, 0x07, 0x11, 0x2a, 0x42, 0x5d,
+  0xe7, 0x02, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0xe9, 0x31, 0x04, 0xe6, 0x10, 0x83, 0x67, 0x21, 0xa8, 0x29, 0x88, 0x29, 0x03, 0x68, 0x21, 0x02, 0x48, 0x21, 0x82, 0x27, 0x19, 0x07,
+  0x19, 0x02, 0x06, 0x19, 0x03, 0x07, 0x19, 0x8d, 0x27, 0x19, 0x88, 0x21, 0xa9, 0x29, 0x0a, 0x32, 0x4b, 0x42, 0x6c, 0x42, 0x4b, 0x3a, 0xee, 0x52, 0x6f, 0x5b, 0xf1, 0x6b, 0xd5, 0x8c, 0x77, 0x9d,
+  0x97, 0x9d, 0x02, 0xb8, 0x9d, 0x02, 0xd8, 0xa5, 0x83, 0xdb, 0xce, 0x5d, 0xdf, 0x5d, 0xe7, 0x08, 0x3c, 0xe7, 0x06, 0x3c, 0xdf, 0x04, 0x1c, 0xdf, 0x02, 0x3c, 0xdf, 0x04, 0x3c, 0xe7, 0x04, 0x5c,
+  0xe7, 0x06, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x05, 0x1b, 0xdf, 0x04, 0x1c, 0xdf, 0x02, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x82, 0x14, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x82, 0x6b,
+  0x42, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x82, 0x92, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x85, 0x3c, 0xdf, 0x1c, 0xdf, 0x1b, 0xdf, 0xf7, 0xb5, 0xe7, 0x10, 0x02, 0x07, 0x19, 0x83, 0x07, 0x11, 0x8b,
+  0x4a, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x82, 0x1c, 0xdf, 0xe9, 0x31, 0x04, 0xe6, 0x10, 0x86, 0x6f, 0x5b, 0x57, 0x8d, 0x77, 0x95, 0x57, 0x95, 0x78, 0x95, 0x77, 0x95, 0x03, 0x57,
+  0x95, 0x03, 0x36, 0x8d, 0x03, 0x37, 0x95, 0x82, 0x36, 0x95, 0x77, 0x95, 0x02, 0x57, 0x95, 0x86, 0xf6, 0x8c, 0xd5, 0x84, 0x94, 0x84, 0xb5, 0x84, 0x94, 0x84, 0x56, 0x95, 0x03, 0x97, 0x9d, 0x02,
+  0xb8, 0x9d, 0x82, 0xd8, 0xa5, 0x39, 0xb6, 0x02, 0x5d, 0xe7, 0x09, 0x3c, 0xe7, 0x06, 0x3c, 0xdf, 0x05, 0x1c, 0xdf, 0x81, 0x3c, 0xdf, 0x0e, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x05,
+  0x1b, 0xdf, 0x04, 0x1c, 0xdf, 0x02, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x82, 0x15, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x82, 0xcd, 0x52, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x06, 0x3c,
+  0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x82, 0xf8, 0xbd, 0x07, 0x11, 0x03, 0x07, 0x19, 0x82, 0x8b, 0x4a, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0xe9, 0x31, 0x04,
+  0xe6, 0x10, 0x83, 0x6f, 0x5b, 0x36, 0x8d, 0x57, 0x8d, 0x0d, 0x77, 0x95, 0x89, 0x77, 0x9d, 0x57, 0x95, 0x56, 0x95, 0x15, 0x8d, 0xd5, 0x84, 0xd5, 0x8c, 0x36, 0x95, 0x56, 0x95, 0x77, 0x9d, 0x02,
+  0x97, 0x9d, 0x85, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xf8, 0xad, 0x3c, 0xdf, 0x0a, 0x3c, 0xe7, 0x0e, 0x3c, 0xdf, 0x0d, 0x3c, 0xe7, 0x04, 0x3c, 0xdf, 0x0c, 0x1c, 0xdf, 0x03, 0x3c, 0xdf, 0x83,
+  0x1c, 0xdf, 0x35, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x82, 0xcd, 0x52, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x81, 0x92, 0x8c, 0x06, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x82, 0xf8, 0xbd,
+  0xe7, 0x10, 0x03, 0x07, 0x19, 0x82, 0x6a, 0x42, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x82, 0x1c, 0xdf, 0xe9, 0x31, 0x04, 0xe6, 0x10, 0x81, 0x6f, 0x5b, 0x0c, 0x77, 0x95, 0x06, 0x77,
+  0x9d, 0x81, 0x77, 0x95, 0x02, 0x57, 0x95, 0x81, 0x77, 0x9d, 0x03, 0x97, 0x9d, 0x87, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0xf8, 0xad, 0x1b, 0xdf, 0x3c, 0xe7, 0x3c, 0xdf, 0x09, 0x3c, 0xe7, 0x0e,
+  0x3c, 0xdf, 0x0d, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x0a, 0x1c, 0xdf, 0x05, 0x3c, 0xdf, 0x82, 0x35, 0x9d, 0x07, 0x19, 0x03, 0x06, 0x19, 0x82, 0x8c, 0x4a, 0x4b, 0x42, 0x04, 0x07, 0x19, 0x82, 0x92,
+  0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x85, 0x3c, 0xdf, 0x1c, 0xdf, 0x1b, 0xdf, 0xf8, 0xbd, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x82, 0x6a, 0x42, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x82,
+  0x3c, 0xdf, 0x0a, 0x3a, 0x02, 0xe6, 0x10, 0x83, 0xe7, 0x18, 0x06, 0x11, 0xb0, 0x63, 0x09, 0x97, 0x95, 0x81, 0x77, 0x95, 0x02, 0x78, 0x95, 0x82, 0x98, 0x95, 0x97, 0x95, 0x09, 0x97, 0x9d, 0x03,
+  0x98, 0x9d, 0x83, 0x97, 0x9d, 0x38, 0xb6, 0x3c, 0xdf, 0x03, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x06, 0x3c, 0xe7, 0x11, 0x3c, 0xdf, 0x0b, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x0a, 0x1c, 0xdf, 0x05, 0x3c,
+  0xdf, 0x82, 0x35, 0x9d, 0x07, 0x19, 0x02, 0x06, 0x19, 0x83, 0x07, 0x19, 0xac, 0x4a, 0x2b, 0x3a, 0x04, 0x07, 0x19, 0x82, 0x92, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c,
+  0xdf, 0x81, 0xf8, 0xbd, 0x04, 0x07, 0x19, 0x82, 0x6a, 0x42, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x0a, 0x3c, 0xe7, 0x81, 0xe9, 0x31, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x19, 0x81, 0xd0, 0x63, 0x03, 0x97,
+  0x95, 0x81, 0x98, 0x95, 0x03, 0x97, 0x9d, 0x04, 0x97, 0x95, 0x82, 0x77, 0x95, 0x98, 0x9d, 0x02, 0x97, 0x9d, 0x83, 0x98, 0x9d, 0x97, 0x9d, 0x98, 0x9d, 0x05, 0x97, 0x9d, 0x85, 0x98, 0x9d, 0x97,
+  0x9d, 0x97, 0xa5, 0x9a, 0xce, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x06, 0x3c, 0xe7, 0x11, 0x3c, 0xdf, 0x0b, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x0a, 0x1c, 0xdf, 0x05, 0x3c, 0xdf, 0x82,
+  0x35, 0xa5, 0x07, 0x19, 0x02, 0x06, 0x19, 0x83, 0x07, 0x19, 0x8c, 0x42, 0x2b, 0x3a, 0x04, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x06, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x81, 0xf8, 0xb5,
+  0x04, 0x07, 0x19, 0x83, 0x6a, 0x42, 0x5d, 0xe7, 0x5c, 0xe7, 0x0b, 0x3c, 0xe7, 0x81, 0xe9, 0x31, 0x03, 0xe7, 0x10, 0x84, 0x07, 0x11, 0x52, 0x7c, 0xdb, 0xce, 0x9a, 0xce, 0x02, 0x9a, 0xc6, 0x02,
+  0x7a, 0xc6, 0x82, 0x9a, 0xc6, 0x7a, 0xc6, 0x02, 0x59, 0xc6, 0x02, 0x79, 0xc6, 0x02, 0x7a, 0xce, 0x81, 0x79, 0xce, 0x04, 0x9a, 0xce, 0x86, 0x79, 0xc6, 0x59, 0xc6, 0x39, 0xbe, 0x59, 0xc6, 0x7a,
+  0xce, 0xdb, 0xd6, 0x02, 0x5c, 0xe7, 0x19, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x0b, 0x3c, 0xe7, 0x06, 0x3c, 0xdf, 0x08, 0x1c, 0xdf, 0x06, 0x3c, 0xdf, 0x81, 0x35, 0xa5, 0x04, 0x07, 0x19, 0x82, 0x8c,
+  0x4a, 0x2b, 0x3a, 0x04, 0x07, 0x19, 0x81, 0x72, 0x8c, 0x06, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x81, 0xf7, 0xb5, 0x04, 0x07, 0x19, 0x83, 0x6a, 0x42, 0x5d, 0xe7, 0x5c, 0xe7, 0x0b,
+  0x3c, 0xe7, 0x81, 0xe9, 0x31, 0x02, 0xe6, 0x10, 0x86, 0xe7, 0x10, 0x07, 0x11, 0x92, 0x8c, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x13, 0x3c, 0xe7, 0x81, 0x5c, 0xe7, 0x16, 0x3c, 0xe7, 0x03, 0x3c,
+  0xdf, 0x04, 0x3c, 0xe7, 0x06, 0x3c, 0xdf, 0x09, 0x3c, 0xe7, 0x08, 0x3c, 0xdf, 0x06, 0x1c, 0xdf, 0x07, 0x3c, 0xdf, 0x81, 0x35, 0xa5, 0x04, 0x07, 0x19, 0x82, 0xcd, 0x52, 0x2b, 0x3a, 0x04, 0x07,
+  0x19, 0x81, 0x72, 0x8c, 0x06, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x81, 0xd7, 0xb5, 0x04, 0x07, 0x19, 0x83, 0x4a, 0x42, 0x5d, 0xe7, 0x5c, 0xe7, 0x0a, 0x3c, 0xe7, 0x82, 0x3c, 0xdf,
+  0xe9, 0x31, 0x02, 0xe6, 0x10, 0x84, 0xe7, 0x10, 0x07, 0x11, 0x14, 0x9d, 0x7d, 0xef, 0x04, 0x5c, 0xe7, 0x28, 0x3c, 0xe7, 0x05, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x07, 0x3c, 0xdf, 0x07, 0x3c, 0xe7,
+  0x0a, 0x3c, 0xdf, 0x04, 0x1c, 0xdf, 0x08, 0x3c, 0xdf, 0x81, 0x35, 0xa5, 0x02, 0x07, 0x19, 0x02, 0x27, 0x19, 0x82, 0xed, 0x52, 0x4b, 0x42, 0x04, 0x07, 0x19, 0x82, 0x92, 0x8c, 0x5c, 0xe7, 0x05,
+  0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x81, 0xd7, 0xb5, 0x04, 0x07, 0x19, 0x83, 0x4a, 0x42, 0x5d, 0xe7, 0x5c, 0xe7, 0x0b, 0x3c, 0xe7, 0x81, 0x8b, 0x4a, 0x02, 0xe6, 0x10, 0x83, 0xe7,
+  0x10, 0xe6, 0x10, 0x35, 0x9d, 0x07, 0x5c, 0xe7, 0x26, 0x3c, 0xe7, 0x0e, 0x3c, 0xdf, 0x05, 0x3c, 0xe7, 0x18, 0x3c, 0xdf, 0x81, 0x35, 0xa5, 0x02, 0x07, 0x19, 0x02, 0x27, 0x19, 0x82, 0xcd, 0x52,
+  0x6b, 0x42, 0x04, 0x07, 0x19, 0x82, 0x92, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x81, 0xf8, 0xb5, 0x04, 0x07, 0x19, 0x83, 0x6a, 0x42, 0x5d, 0xe7, 0x5c, 0xe7,
+  0x0b, 0x3c, 0xe7, 0x81, 0x0d, 0x5b, 0x02, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x81, 0x55, 0xa5, 0x02, 0x7d, 0xe7, 0x07, 0x5c, 0xe7, 0x27, 0x3c, 0xe7, 0x0b, 0x3c, 0xdf, 0x05, 0x3c, 0xe7, 0x18, 0x3c,
+  0xdf, 0x81, 0x35, 0xa5, 0x02, 0x07, 0x19, 0x02, 0x27, 0x19, 0x82, 0xcd, 0x52, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x82, 0x93, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf,
+  0x83, 0xf7, 0xb5, 0x07, 0x11, 0x27, 0x19, 0x02, 0x07, 0x19, 0x82, 0x6b, 0x42, 0x5d, 0xe7, 0x0b, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0x0d, 0x5b, 0x02, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x81, 0x76, 0xa5,
+  0x02, 0x7d, 0xef, 0x81, 0x7d, 0xe7, 0x0e, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x0a, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x02, 0x3c,
+  0xdf, 0x03, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x04, 0x3c, 0xdf, 0x0a, 0x3c, 0xe7, 0x18, 0x3c, 0xdf, 0x82, 0x35, 0xa5, 0x07, 0x19, 0x03, 0x27, 0x19, 0x82, 0xcd, 0x52, 0x8c, 0x4a,
+  0x04, 0x07, 0x19, 0x82, 0x93, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x83, 0xd7, 0xb5, 0x07, 0x11, 0x27, 0x19, 0x02, 0x07, 0x19, 0x82, 0x6b, 0x42, 0x5d, 0xe7,
+  0x03, 0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0xec, 0x52, 0x02, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x81, 0x96, 0xad, 0x02, 0x7d, 0xef, 0x82, 0x7d, 0xe7, 0x7c, 0xe7, 0x0c, 0x5c, 0xe7, 0x0d,
+  0x3c, 0xe7, 0x0a, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x03, 0x3c, 0xe7, 0x07, 0x3c, 0xdf, 0x09, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0x3c, 0xe7, 0x04, 0x3c, 0xdf, 0x81, 0x3c, 0xe7, 0x12,
+  0x3c, 0xdf, 0x83, 0x1c, 0xdf, 0x35, 0xa5, 0x07, 0x19, 0x03, 0x27, 0x19, 0x82, 0xac, 0x4a, 0x8c, 0x4a, 0x04, 0x07, 0x19, 0x82, 0x93, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02,
+  0x1c, 0xdf, 0x82, 0xd8, 0xb5, 0x07, 0x11, 0x02, 0x27, 0x19, 0x83, 0x07, 0x19, 0x4a, 0x42, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x09, 0x3c, 0xe7, 0x81, 0x6b, 0x4a, 0x04, 0xe7, 0x10, 0x83, 0x15, 0x9d,
+  0xdc, 0xd6, 0xbb, 0xd6, 0x04, 0xdb, 0xd6, 0x81, 0xfb, 0xd6, 0x08, 0xdb, 0xd6, 0x85, 0xbb, 0xd6, 0xbb, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x02, 0x7a, 0xc6, 0x03, 0x59, 0xc6, 0x02, 0x5a,
+  0xc6, 0x81, 0x7a, 0xc6, 0x05, 0x9a, 0xce, 0x03, 0xba, 0xce, 0x81, 0xdb, 0xce, 0x05, 0xdb, 0xd6, 0x82, 0xfb, 0xd6, 0x1c, 0xdf, 0x02, 0xfb, 0xd6, 0x81, 0xdb, 0xd6, 0x02, 0xdb, 0xce, 0x02, 0xdb,
+  0xd6, 0x81, 0xdb, 0xce, 0x03, 0xbb, 0xce, 0x02, 0x9a, 0xce, 0x02, 0x7a, 0xc6, 0x03, 0x59, 0xc6, 0x02, 0x18, 0xbe, 0x84, 0xf8, 0xbd, 0x39, 0xc6, 0xdb, 0xd6, 0x3d, 0xe7, 0x0a, 0x3c, 0xe7, 0x0a,
+  0x3c, 0xdf, 0x81, 0x35, 0x9d, 0x02, 0x07, 0x19, 0x02, 0x27, 0x19, 0x82, 0xac, 0x4a, 0x8c, 0x4a, 0x04, 0x07, 0x19, 0x82, 0x93, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x3c, 0xdf, 0x02, 0x1c,
+  0xdf, 0x82, 0xd8, 0xb5, 0x07, 0x11, 0x02, 0x27, 0x19, 0x83, 0x07, 0x19, 0x2a, 0x3a, 0x5d, 0xe7, 0x04, 0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x81, 0xe9, 0x31, 0x04, 0xe7, 0x10, 0x82, 0xe6, 0x10, 0xe6,
+  0x08, 0x03, 0xc6, 0x10, 0x18, 0xe6, 0x10, 0x04, 0xc6, 0x10, 0x03, 0xe6, 0x10, 0x81, 0x06, 0x19, 0x02, 0x26, 0x19, 0x81, 0x06, 0x19, 0x02, 0xe6, 0x18, 0x8c, 0x06, 0x19, 0x47, 0x21, 0x67, 0x29,
+  0x67, 0x21, 0x47, 0x21, 0x26, 0x19, 0x06, 0x19, 0xe6, 0x10, 0x06, 0x19, 0x26, 0x19, 0x06, 0x19, 0x06, 0x11, 0x06, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x87, 0xc6, 0x10, 0xe6, 0x10,
+  0xc6, 0x10, 0x27, 0x19, 0xcc, 0x52, 0x56, 0xa5, 0x1c, 0xdf, 0x02, 0x5d, 0xe7, 0x81, 0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x03, 0x3c, 0xdf, 0x02, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x82, 0x35, 0x9d, 0x07,
+  0x19, 0x03, 0x27, 0x19, 0x82, 0x8c, 0x42, 0x8c, 0x4a, 0x04, 0x07, 0x19, 0x82, 0x93, 0x8c, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x82, 0x1c, 0xdf, 0xd8, 0xb5, 0x03, 0x07, 0x19, 0x83,
+  0x27, 0x19, 0xe9, 0x39, 0x5d, 0xe7, 0x05, 0x5c, 0xe7, 0x07, 0x3c, 0xe7, 0x81, 0xe9, 0x31, 0x09, 0xe7, 0x10, 0x81, 0x07, 0x11, 0x09, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x02, 0x07,
+  0x11, 0x02, 0xe7, 0x10, 0x81, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x82, 0x07, 0x11, 0x06, 0x11, 0x02, 0xe7, 0x10, 0x07, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x04, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x04, 0xe6,
+  0x10, 0x06, 0xe7, 0x10, 0x10, 0xe6, 0x10, 0x82, 0x6c, 0x4a, 0xd8, 0xb5, 0x02, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x0c, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0x35, 0x9d, 0x03, 0x27, 0x19, 0x81, 0x07, 0x19,
+  0x02, 0x8c, 0x4a, 0x04, 0x07, 0x19, 0x82, 0x93, 0x8c, 0x5d, 0xe7, 0x06, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x81, 0xf8, 0xb5, 0x04, 0x07, 0x19, 0x82, 0xc9, 0x31, 0x5d, 0xe7, 0x07, 0x5c, 0xe7, 0x81,
+  0x3c, 0xe7, 0x03, 0x5c, 0xe7, 0x84, 0x3c, 0xe7, 0x8b, 0x4a, 0xe7, 0x10, 0xe6, 0x10, 0x07, 0xe7, 0x10, 0x04, 0x07, 0x11, 0x03, 0xe7, 0x10, 0x05, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11,
+  0x03, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x11, 0xe7, 0x10, 0x1b, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x84, 0x32, 0x84, 0x3d, 0xdf, 0x5d, 0xe7, 0x5c, 0xe7, 0x0c, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0x56, 0xa5,
+  0x03, 0x27, 0x19, 0x83, 0x07, 0x19, 0xed, 0x52, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x82, 0x73, 0x8c, 0x5c, 0xe7, 0x07, 0x3c, 0xe7, 0x83, 0x3c, 0xdf, 0xf8, 0xbd, 0x27, 0x19, 0x03, 0x07, 0x19, 0x82,
+  0xc9, 0x31, 0x3d, 0xe7, 0x06, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x04, 0x5c, 0xe7, 0x81, 0xf0, 0x7b, 0x09, 0xe7, 0x10, 0x05, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x81,
+  0x07, 0x11, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x03, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x10, 0xe7, 0x10, 0x1c, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x85, 0xe6, 0x10, 0x0e, 0x5b, 0xfc, 0xd6, 0x5d, 0xe7,
+  0x5c, 0xe7, 0x0b, 0x3c, 0xe7, 0x83, 0x3c, 0xdf, 0x56, 0xa5, 0x07, 0x19, 0x02, 0x27, 0x19, 0x83, 0x07, 0x19, 0xed, 0x52, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x82, 0x73, 0x8c, 0x5c, 0xe7, 0x07, 0x3c,
+  0xe7, 0x82, 0x3c, 0xdf, 0x18, 0xbe, 0x04, 0x07, 0x19, 0x82, 0xa8, 0x31, 0x3d, 0xe7, 0x04, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x5c, 0xe7, 0x02, 0x3c, 0xe7, 0x84, 0xba, 0xd6, 0x4e, 0x6b, 0xc6,
+  0x10, 0xe7, 0x10, 0x02, 0xc7, 0x10, 0x81, 0xc7, 0x08, 0x05, 0xe7, 0x10, 0x02, 0xc7, 0x10, 0x81, 0xe7, 0x10, 0x05, 0xc7, 0x10, 0x05, 0xe7, 0x10, 0x02, 0xc7, 0x10, 0x82, 0xe7, 0x10, 0xc7, 0x10,
+  0x08, 0xc6, 0x10, 0x03, 0xc7, 0x10, 0x06, 0xe7, 0x10, 0x81, 0xc7, 0x10, 0x02, 0xe7, 0x10, 0x0e, 0xc6, 0x10, 0x02, 0xc6, 0x08, 0x86, 0xe6, 0x10, 0x27, 0x19, 0x68, 0x29, 0xe9, 0x39, 0x09, 0x3a,
+  0xc9, 0x31, 0x03, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x81, 0x07, 0x11, 0x02, 0xe7, 0x18, 0x82, 0x90, 0x73, 0x3d, 0xe7, 0x02, 0x5c, 0xe7, 0x03, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x06, 0x3c, 0xe7, 0x82,
+  0x56, 0xa5, 0x07, 0x19, 0x02, 0x27, 0x19, 0x83, 0x07, 0x19, 0xed, 0x52, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x82, 0x93, 0x8c, 0x5d, 0xe7, 0x07, 0x3c, 0xe7, 0x82, 0x3c, 0xdf, 0x19, 0xbe, 0x04, 0x07,
+  0x19, 0x83, 0x88, 0x29, 0x3c, 0xdf, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x02, 0x5c, 0xe7, 0x89, 0x3c, 0xe7, 0x3b, 0xe7, 0x1c, 0xdf, 0x79, 0xce, 0x18, 0xbe, 0x79, 0xc6, 0x9a, 0xce,
+  0xba, 0xce, 0xba, 0xd6, 0x03, 0xdb, 0xd6, 0x82, 0xda, 0xd6, 0xba, 0xd6, 0x07, 0x9a, 0xce, 0x81, 0xba, 0xce, 0x06, 0xba, 0xd6, 0x81, 0xba, 0xce, 0x03, 0xba, 0xd6, 0x02, 0xba, 0xce, 0x06, 0x9a,
+  0xce, 0x81, 0x79, 0xc6, 0x05, 0x18, 0xbe, 0x04, 0xf8, 0xbd, 0x04, 0xf7, 0xbd, 0x81, 0x17, 0xbe, 0x02, 0x18, 0xbe, 0x81, 0x38, 0xbe, 0x03, 0x38, 0xc6, 0x8f, 0x59, 0xc6, 0x38, 0xc6, 0x7a, 0xce,
+  0xbb, 0xd6, 0xfb, 0xde, 0xfc, 0xde, 0x1c, 0xdf, 0x3c, 0xe7, 0x5d, 0xe7, 0x7d, 0xef, 0x5d, 0xe7, 0xdb, 0xd6, 0x75, 0xa5, 0xc8, 0x31, 0xc6, 0x10, 0x02, 0xe6, 0x10, 0x86, 0xe7, 0x10, 0x07, 0x19,
+  0xe6, 0x10, 0x97, 0xad, 0x5d, 0xe7, 0x5c, 0xe7, 0x03, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x05, 0x3c, 0xe7, 0x82, 0x5c, 0xe7, 0x76, 0xa5, 0x04, 0x07, 0x19, 0x82, 0xed, 0x52, 0x6c, 0x42, 0x04, 0x07,
+  0x19, 0x83, 0x93, 0x8c, 0x5d, 0xe7, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x83, 0x3c, 0xdf, 0x39, 0xc6, 0x07, 0x11, 0x03, 0x07, 0x19, 0x83, 0x47, 0x21, 0x1c, 0xdf, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x3f,
+  0x3c, 0xe7, 0x11, 0x5c, 0xe7, 0x02, 0x7d, 0xef, 0x84, 0xfb, 0xd6, 0xcc, 0x52, 0xc6, 0x10, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x85, 0x07, 0x19, 0x8c, 0x52, 0x3d, 0xe7, 0x5c, 0xe7, 0x3c, 0xdf, 0x09,
+  0x3c, 0xe7, 0x82, 0x5c, 0xe7, 0x76, 0xad, 0x04, 0x07, 0x19, 0x82, 0xed, 0x52, 0x6c, 0x42, 0x04, 0x07, 0x19, 0x83, 0x93, 0x8c, 0x5d, 0xe7, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x83, 0x3c, 0xdf, 0x79,
+  0xc6, 0x07, 0x11, 0x03, 0x07, 0x19, 0x83, 0x27, 0x19, 0xdc, 0xd6, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x3a, 0x3c, 0xe7, 0x19, 0x5c, 0xe7, 0x82, 0xfb, 0xd6, 0x6b, 0x4a, 0x02, 0xe7, 0x10, 0x84, 0x07,
+  0x19, 0x07, 0x11, 0xe7, 0x18, 0xf8, 0xbd, 0x0b, 0x3c, 0xe7, 0x82, 0x5c, 0xe7, 0x97, 0xad, 0x04, 0x07, 0x19, 0x82, 0xcd, 0x52, 0x4b, 0x42, 0x04, 0x07, 0x19, 0x83, 0x52, 0x84, 0x5d, 0xe7, 0x5c,
+  0xe7, 0x06, 0x3c, 0xe7, 0x83, 0x3c, 0xdf, 0xfb, 0xd6, 0x47, 0x21, 0x03, 0x07, 0x19, 0x83, 0x06, 0x19, 0x7a, 0xce, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x1f, 0x3c, 0xe7, 0x04, 0x5c, 0xe7, 0x07, 0x3c,
+  0xe7, 0x0a, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x1a, 0x5c, 0xe7, 0x81, 0x18, 0xbe, 0x02, 0xe7, 0x10, 0x84, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0x52, 0x84, 0x02, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x07,
+  0x3c, 0xe7, 0x82, 0x5c, 0xe7, 0x76, 0xad, 0x04, 0x07, 0x19, 0x82, 0x4b, 0x42, 0x8c, 0x4a, 0x03, 0x07, 0x19, 0x84, 0x27, 0x19, 0x6e, 0x63, 0x5d, 0xe7, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x02, 0x3c,
+  0xdf, 0x81, 0x2e, 0x5b, 0x04, 0x07, 0x19, 0x82, 0x96, 0xad, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x1f, 0x3c, 0xe7, 0x04, 0x5c, 0xe7, 0x07, 0x3c, 0xe7, 0x0a, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x0b, 0x5c,
+  0xe7, 0x04, 0x3c, 0xe7, 0x0b, 0x5c, 0xe7, 0x89, 0x3c, 0xdf, 0xac, 0x52, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0x6b, 0x4a, 0x3d, 0xdf, 0x3c, 0xe7, 0x02, 0x3c, 0xdf, 0x07, 0x3c, 0xe7,
+  0x82, 0x5c, 0xe7, 0x35, 0x9d, 0x04, 0x07, 0x19, 0x82, 0x6b, 0x42, 0x0e, 0x53, 0x03, 0x07, 0x19, 0x83, 0x27, 0x19, 0x0a, 0x3a, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x02, 0x3c, 0xdf,
+  0x81, 0xd4, 0x94, 0x04, 0x07, 0x19, 0x82, 0xaf, 0x73, 0x7d, 0xe7, 0x03, 0x5c, 0xe7, 0x18, 0x3c, 0xe7, 0x0a, 0x5c, 0xe7, 0x07, 0x3c, 0xe7, 0x0a, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x0a, 0x5c, 0xe7,
+  0x06, 0x3c, 0xe7, 0x0a, 0x5c, 0xe7, 0x88, 0x3c, 0xe7, 0xb3, 0x94, 0xe7, 0x10, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0xe7, 0x10, 0xfc, 0xd6, 0x04, 0x3c, 0xdf, 0x06, 0x3c, 0xe7, 0x82, 0x5d, 0xe7,
+  0x31, 0x84, 0x04, 0x07, 0x19, 0x82, 0x6c, 0x42, 0x4f, 0x63, 0x04, 0x07, 0x19, 0x82, 0x27, 0x21, 0xdc, 0xd6, 0x02, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x83, 0x3c, 0xdf, 0x1b, 0xdf, 0xd7, 0xb5, 0x04,
+  0x07, 0x19, 0x83, 0xe7, 0x18, 0xdb, 0xd6, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x16, 0x3c, 0xe7, 0x0b, 0x5c, 0xe7, 0x07, 0x3c, 0xe7, 0x07, 0x5c, 0xe7, 0x0a, 0x3c, 0xe7, 0x08, 0x5c, 0xe7, 0x08, 0x3c,
+  0xe7, 0x0a, 0x5c, 0xe7, 0x82, 0xb3, 0x94, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x83, 0x07, 0x19, 0x07, 0x11, 0xfc, 0xd6, 0x03, 0x3c, 0xdf, 0x08, 0x3c, 0xe7, 0x82, 0x6b, 0x42, 0x07, 0x19, 0x02, 0x06,
+  0x19, 0x84, 0x07, 0x19, 0xac, 0x4a, 0xee, 0x52, 0x06, 0x19, 0x03, 0x07, 0x19, 0x84, 0x27, 0x19, 0xf8, 0xb5, 0x5d, 0xe7, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x84, 0x1c, 0xdf, 0xfc, 0xd6, 0x9b, 0xc6,
+  0xa9, 0x29, 0x04, 0x07, 0x19, 0x82, 0xb3, 0x8c, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x16, 0x3c, 0xe7, 0x0b, 0x5c, 0xe7, 0x07, 0x3c, 0xe7, 0x07, 0x5c, 0xe7, 0x0a, 0x3c, 0xe7, 0x08, 0x5c, 0xe7, 0x09,
+  0x3c, 0xe7, 0x08, 0x5c, 0xe7, 0x84, 0x5d, 0xef, 0x4e, 0x6b, 0xe6, 0x10, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x82, 0xc9, 0x31, 0xfc, 0xd6, 0x03, 0x3c, 0xdf, 0x07, 0x3c, 0xe7, 0x83, 0x9a, 0xce, 0x27,
+  0x19, 0x07, 0x19, 0x02, 0x06, 0x19, 0x83, 0x07, 0x19, 0x4b, 0x3a, 0x6c, 0x42, 0x03, 0x07, 0x19, 0x02, 0x27, 0x19, 0x83, 0xb4, 0x94, 0x5d, 0xe7, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x86, 0x1c, 0xdf,
+  0xdb, 0xd6, 0x9a, 0xc6, 0xf0, 0x73, 0xe7, 0x10, 0x07, 0x11, 0x02, 0x07, 0x19, 0x83, 0x26, 0x19, 0x5a, 0xc6, 0x5d, 0xe7, 0x05, 0x5c, 0xe7, 0x13, 0x3c, 0xe7, 0x10, 0x5c, 0xe7, 0x05, 0x3c, 0xe7,
+  0x03, 0x5c, 0xe7, 0x0b, 0x3c, 0xe7, 0x09, 0x5c, 0xe7, 0x08, 0x3c, 0xe7, 0x08, 0x5c, 0xe7, 0x81, 0xfb, 0xde, 0x02, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x82, 0x07, 0x11, 0x0d, 0x5b, 0x02, 0x1c, 0xdf,
+  0x03, 0x3c, 0xdf, 0x06, 0x3c, 0xe7, 0x81, 0x76, 0xad, 0x02, 0x07, 0x19, 0x81, 0x06, 0x19, 0x02, 0x07, 0x19, 0x82, 0x4b, 0x42, 0x6c, 0x42, 0x03, 0x07, 0x19, 0x02, 0x27, 0x19, 0x83, 0xcc, 0x52,
+  0x5d, 0xe7, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x85, 0x1c, 0xdf, 0xba, 0xce, 0x59, 0xbe, 0x56, 0x9d, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x84, 0x07, 0x19, 0x06, 0x19, 0xed, 0x5a, 0x1c, 0xdf, 0x33, 0x5c,
+  0xe7, 0x06, 0x3c, 0xe7, 0x12, 0x5c, 0xe7, 0x81, 0x3c, 0xe7, 0x06, 0x5c, 0xe7, 0x83, 0x5c, 0xef, 0x7d, 0xef, 0x15, 0xa5, 0x02, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x83, 0xd4, 0x94,
+  0xbb, 0xce, 0xfc, 0xd6, 0x02, 0x3c, 0xdf, 0x07, 0x3c, 0xe7, 0x81, 0x10, 0x7c, 0x05, 0x07, 0x19, 0x82, 0x8c, 0x4a, 0x6c, 0x42, 0x03, 0x07, 0x19, 0x02, 0x27, 0x19, 0x82, 0x07, 0x19, 0xdc, 0xd6,
+  0x02, 0x5c, 0xe7, 0x05, 0x3c, 0xe7, 0x81, 0x59, 0xbe, 0x02, 0xf9, 0xad, 0x88, 0x2e, 0x5b, 0x06, 0x11, 0x07, 0x11, 0x07, 0x19, 0x06, 0x19, 0xe6, 0x18, 0xf0, 0x7b, 0x3d, 0xe7, 0x02, 0x5d, 0xe7,
+  0x4e, 0x5c, 0xe7, 0x84, 0x5c, 0xef, 0x7c, 0xef, 0x9a, 0xce, 0x47, 0x21, 0x02, 0xe6, 0x10, 0x87, 0xe7, 0x10, 0x07, 0x11, 0x47, 0x21, 0xf9, 0xb5, 0x5a, 0xbe, 0xdb, 0xd6, 0x3c, 0xdf, 0x07, 0x3c,
+  0xe7, 0x82, 0x1b, 0xdf, 0xa8, 0x29, 0x05, 0x07, 0x19, 0x82, 0xac, 0x4a, 0x4b, 0x42, 0x04, 0x07, 0x19, 0x83, 0x27, 0x19, 0x07, 0x19, 0x96, 0xad, 0x06, 0x5c, 0xe7, 0x87, 0x5d, 0xe7, 0xf8, 0xb5,
+  0xb8, 0xa5, 0xb7, 0xa5, 0x36, 0x95, 0x67, 0x21, 0xe6, 0x10, 0x02, 0x07, 0x19, 0x84, 0x06, 0x19, 0xe6, 0x18, 0x8f, 0x6b, 0xfc, 0xde, 0x03, 0x5d, 0xe7, 0x4d, 0x5c, 0xe7, 0x82, 0x59, 0xc6, 0x0a,
+  0x3a, 0x03, 0xe6, 0x10, 0x86, 0xe7, 0x10, 0x07, 0x11, 0xf1, 0x73, 0xf9, 0xb5, 0x19, 0xae, 0xbb, 0xce, 0x02, 0x5c, 0xe7, 0x06, 0x3c, 0xe7, 0x81, 0xd7, 0xb5, 0x06, 0x07, 0x19, 0x82, 0xac, 0x4a,
+  0x2b, 0x3a, 0x06, 0x07, 0x19, 0x82, 0x0d, 0x5b, 0x3d, 0xe7, 0x05, 0x5c, 0xe7, 0x83, 0x5d, 0xe7, 0xd8, 0xad, 0xb8, 0xa5, 0x02, 0xb7, 0x9d, 0x85, 0x53, 0x7c, 0xe6, 0x10, 0xe7, 0x18, 0x07, 0x19,
+  0xe6, 0x18, 0x02, 0xe6, 0x10, 0x83, 0x2a, 0x42, 0xd7, 0xb5, 0x5d, 0xe7, 0x05, 0x7d, 0xe7, 0x07, 0x5c, 0xe7, 0x03, 0x5d, 0xe7, 0x07, 0x5c, 0xe7, 0x82, 0x7d, 0xe7, 0x5c, 0xe7, 0x03, 0x7d, 0xe7,
+  0x19, 0x5c, 0xe7, 0x82, 0x7d, 0xe7, 0x5d, 0xe7, 0x03, 0x5d, 0xef, 0x81, 0x5d, 0xe7, 0x06, 0x7d, 0xe7, 0x0c, 0x5c, 0xe7, 0x84, 0x3c, 0xdf, 0xf4, 0x9c, 0x27, 0x19, 0xe7, 0x10, 0x03, 0xe6, 0x10,
+  0x83, 0xe7, 0x10, 0xc9, 0x29, 0x97, 0xa5, 0x02, 0xf9, 0xa5, 0x82, 0x9a, 0xc6, 0x5d, 0xe7, 0x07, 0x5c, 0xe7, 0x82, 0x4d, 0x63, 0x27, 0x19, 0x05, 0x07, 0x19, 0x82, 0xcd, 0x52, 0x6c, 0x42, 0x05,
+  0x07, 0x19, 0x83, 0x27, 0x19, 0x07, 0x19, 0x19, 0xc6, 0x05, 0x5c, 0xe7, 0x87, 0x5d, 0xe7, 0x9a, 0xc6, 0x98, 0xa5, 0xb8, 0x9d, 0x98, 0x9d, 0x97, 0x9d, 0x6f, 0x63, 0x07, 0xe6, 0x10, 0x86, 0x0a,
+  0x3a, 0xb3, 0x94, 0xf8, 0xb5, 0xba, 0xce, 0x3c, 0xdf, 0x5c, 0xdf, 0x06, 0x5d, 0xdf, 0x02, 0x5d, 0xe7, 0x02, 0x3d, 0xe7, 0x04, 0x5d, 0xe7, 0x04, 0x3d, 0xdf, 0x03, 0x3d, 0xe7, 0x03, 0x3d, 0xdf,
+  0x81, 0x3c, 0xdf, 0x05, 0x1c, 0xdf, 0x03, 0xfc, 0xde, 0x03, 0x1c, 0xdf, 0x07, 0xfc, 0xde, 0x04, 0x1c, 0xdf, 0x02, 0x3c, 0xdf, 0x02, 0x1c, 0xdf, 0x81, 0x3c, 0xdf, 0x04, 0x1c, 0xdf, 0x81, 0x3c,
+  0xdf, 0x02, 0x3d, 0xe7, 0x02, 0x5d, 0xe7, 0x81, 0x5c, 0xe7, 0x05, 0x5d, 0xe7, 0x87, 0x5c, 0xe7, 0x1c, 0xdf, 0x58, 0xc6, 0xd3, 0x94, 0xe9, 0x31, 0x07, 0x11, 0xe7, 0x10, 0x03, 0xe6, 0x10, 0x83,
+  0xe7, 0x10, 0x07, 0x11, 0x93, 0x84, 0x02, 0xd8, 0xa5, 0x84, 0xd9, 0xa5, 0xdb, 0xce, 0x7d, 0xe7, 0x5d, 0xe7, 0x05, 0x5c, 0xe7, 0x81, 0x79, 0xc6, 0x02, 0x27, 0x19, 0x05, 0x07, 0x19, 0x82, 0x8c,
+  0x4a, 0x6c, 0x42, 0x05, 0x07, 0x19, 0x02, 0x27, 0x19, 0x83, 0x2e, 0x63, 0x3d, 0xe7, 0x5d, 0xe7, 0x04, 0x5c, 0xe7, 0x87, 0x1c, 0xdf, 0xb8, 0xa5, 0xb8, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0x97, 0x9d,
+  0x0e, 0x5b, 0x06, 0xe6, 0x10, 0x02, 0x07, 0x11, 0x02, 0x07, 0x19, 0x86, 0xe7, 0x10, 0x27, 0x19, 0x68, 0x21, 0xc9, 0x29, 0xc9, 0x31, 0xc9, 0x29, 0x04, 0xa8, 0x29, 0x83, 0x88, 0x29, 0xa8, 0x29,
+  0x87, 0x21, 0x02, 0x67, 0x21, 0x85, 0x47, 0x21, 0x27, 0x19, 0x07, 0x19, 0x07, 0x11, 0x06, 0x11, 0x08, 0xe6, 0x10, 0x02, 0xc6, 0x08, 0x06, 0xc6, 0x10, 0x03, 0xc5, 0x08, 0x81, 0xc6, 0x08, 0x02,
+  0xa5, 0x08, 0x82, 0xc6, 0x08, 0xa6, 0x08, 0x03, 0xc6, 0x08, 0x04, 0xc5, 0x08, 0x82, 0xc6, 0x08, 0xc5, 0x08, 0x02, 0xa5, 0x08, 0x03, 0xc6, 0x08, 0x02, 0xe6, 0x10, 0x81, 0x27, 0x19, 0x02, 0x88,
+  0x29, 0x82, 0xc9, 0x31, 0xab, 0x4a, 0x03, 0xcc, 0x52, 0x83, 0x6b, 0x42, 0x68, 0x21, 0xc7, 0x08, 0x03, 0xe7, 0x10, 0x82, 0x07, 0x11, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x84, 0xe7, 0x10, 0x07, 0x11,
+  0x8f, 0x63, 0xb8, 0xa5, 0x02, 0xd8, 0xa5, 0x82, 0xd9, 0xa5, 0x1c, 0xdf, 0x02, 0x5d, 0xe7, 0x05, 0x5c, 0xe7, 0x83, 0xcf, 0x73, 0x28, 0x19, 0x07, 0x19, 0x02, 0x27, 0x19, 0x03, 0x07, 0x19, 0x82,
+  0x6b, 0x42, 0x0b, 0x3a, 0x06, 0x07, 0x19, 0x83, 0x27, 0x19, 0x07, 0x19, 0x97, 0xad, 0x05, 0x5c, 0xe7, 0x82, 0x7d, 0xe7, 0x19, 0xb6, 0x04, 0xb8, 0x9d, 0x83, 0x98, 0x9d, 0xb0, 0x6b, 0xe6, 0x18,
+  0x04, 0xe6, 0x10, 0x07, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x81, 0xe7, 0x10, 0x06, 0x07, 0x11, 0x81, 0xe7, 0x10, 0x04, 0x07, 0x11, 0x02, 0xe6, 0x10, 0x81, 0x07, 0x11, 0x02, 0xe7,
+  0x10, 0x02, 0x07, 0x11, 0x05, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x0e, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x05, 0xe6, 0x10, 0x0a, 0xe7, 0x10, 0x07, 0x07, 0x11, 0x06, 0xe7, 0x10, 0x83,
+  0xe6, 0x10, 0x4e, 0x5b, 0x97, 0x9d, 0x02, 0xb8, 0x9d, 0x83, 0xd8, 0xa5, 0xf9, 0xad, 0x7d, 0xe7, 0x02, 0x5d, 0xe7, 0x04, 0x5c, 0xe7, 0x83, 0x58, 0xc6, 0x27, 0x19, 0x07, 0x19, 0x04, 0x27, 0x19,
+  0x02, 0x07, 0x19, 0x82, 0x4b, 0x42, 0xac, 0x4a, 0x06, 0x07, 0x19, 0x02, 0x27, 0x19, 0x82, 0xe9, 0x39, 0xdb, 0xd6, 0x04, 0x5c, 0xe7, 0x83, 0x5d, 0xe7, 0x3c, 0xdf, 0xb8, 0xa5, 0x04, 0xb8, 0x9d,
+  0x83, 0xb8, 0xa5, 0x93, 0x84, 0xe9, 0x31, 0x05, 0xe6, 0x10, 0x05, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x81, 0x07, 0x11, 0x03, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x84, 0xe7, 0x10, 0xe6, 0x10, 0x07, 0x11,
+  0xe7, 0x10, 0x04, 0x07, 0x11, 0x04, 0xe6, 0x10, 0x02, 0xe7, 0x10, 0x81, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x18, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x02, 0xe6, 0x10,
+  0x07, 0xe7, 0x10, 0x02, 0x07, 0x11, 0x81, 0xe7, 0x10, 0x04, 0x07, 0x11, 0x05, 0xe7, 0x10, 0x84, 0x07, 0x11, 0x2e, 0x5b, 0x57, 0x9d, 0x97, 0x9d, 0x02, 0xb8, 0x9d, 0x82, 0xd8, 0x9d, 0xbb, 0xce,
+  0x03, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x82, 0x3c, 0xe7, 0x0d, 0x5b, 0x02, 0x07, 0x19, 0x04, 0x27, 0x19, 0x02, 0x07, 0x19, 0x83, 0x4b, 0x42, 0x88, 0x29, 0xe7, 0x10, 0x05, 0x07, 0x19, 0x03, 0x27,
+  0x19, 0x82, 0x11, 0x7c, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x84, 0x5d, 0xe7, 0x7d, 0xe7, 0x9a, 0xce, 0x97, 0x9d, 0x03, 0xb8, 0x9d, 0x86, 0x98, 0x9d, 0xb8, 0xa5, 0x97, 0x9d, 0x52, 0x7c, 0xe9, 0x31,
+  0xc6, 0x10, 0x03, 0xe6, 0x10, 0x81, 0x06, 0x11, 0x0d, 0xe6, 0x10, 0x06, 0x07, 0x11, 0x29, 0xe6, 0x10, 0x05, 0xe7, 0x10, 0x07, 0x07, 0x11, 0x04, 0xe7, 0x10, 0x83, 0xea, 0x31, 0x90, 0x63, 0xf5,
+  0x8c, 0x02, 0x97, 0x9d, 0x02, 0xb8, 0x9d, 0x81, 0xd9, 0xa5, 0x04, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x84, 0x14, 0x9d, 0x27, 0x11, 0x27, 0x19, 0x07, 0x19, 0x03, 0x27, 0x19, 0x03, 0x07, 0x19, 0x83,
+  0x6b, 0x42, 0x8c, 0x4a, 0xe7, 0x10, 0x02, 0x07, 0x19, 0x81, 0x27, 0x19, 0x02, 0x07, 0x19, 0x02, 0x27, 0x19, 0x02, 0x07, 0x19, 0x81, 0x18, 0xbe, 0x03, 0x5c, 0xe7, 0x02, 0x5d, 0xe7, 0x83, 0x7d,
+  0xef, 0xf8, 0xb5, 0x98, 0x9d, 0x05, 0xb8, 0x9d, 0x86, 0xb8, 0xa5, 0x97, 0x9d, 0x94, 0x84, 0x90, 0x63, 0x2a, 0x3a, 0x06, 0x11, 0x0a, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x04, 0xe7,
+  0x10, 0x81, 0xe7, 0x18, 0x02, 0xe7, 0x10, 0x26, 0xe6, 0x10, 0x81, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x05, 0xe7, 0x10, 0x05, 0x07, 0x11, 0x02, 0xe7, 0x10, 0x88, 0xe6, 0x10, 0xea, 0x39, 0x4f, 0x63,
+  0x12, 0x74, 0xb4, 0x84, 0x36, 0x95, 0x77, 0x9d, 0x97, 0x9d, 0x03, 0xb8, 0x9d, 0x81, 0xbb, 0xce, 0x03, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x83, 0x79, 0xc6, 0x27, 0x19, 0x07, 0x11, 0x02, 0x07, 0x19,
+  0x02, 0x27, 0x19, 0x81, 0x48, 0x19, 0x03, 0x07, 0x19, 0x87, 0xac, 0x4a, 0xed, 0x52, 0xe7, 0x10, 0xe7, 0x18, 0xe7, 0x10, 0x68, 0x21, 0x48, 0x21, 0x02, 0x27, 0x19, 0x81, 0x07, 0x19, 0x02, 0x27,
+  0x19, 0x82, 0x0a, 0x42, 0xbb, 0xd6, 0x02, 0x5c, 0xe7, 0x02, 0x5d, 0xe7, 0x02, 0x7d, 0xe7, 0x82, 0xb7, 0xa5, 0x57, 0x95, 0x05, 0x98, 0x9d, 0x82, 0xb8, 0x9d, 0x98, 0x9d, 0x02, 0x97, 0x9d, 0x82,
+  0x57, 0x9d, 0xb4, 0x8c, 0x02, 0x12, 0x74, 0x81, 0xf1, 0x73, 0x03, 0xd1, 0x6b, 0x83, 0x70, 0x63, 0x6f, 0x63, 0x70, 0x63, 0x03, 0x90, 0x63, 0x84, 0xb1, 0x6b, 0xd1, 0x6b, 0xf1, 0x73, 0xd1, 0x6b,
+  0x02, 0xb0, 0x6b, 0x82, 0xd1, 0x6b, 0xf1, 0x6b, 0x02, 0x12, 0x74, 0x03, 0xd1, 0x6b, 0x02, 0xb0, 0x6b, 0x02, 0xb1, 0x6b, 0x81, 0xd1, 0x6b, 0x03, 0xb1, 0x6b, 0x05, 0xd1, 0x6b, 0x83, 0xf2, 0x6b,
+  0xf2, 0x73, 0x32, 0x74, 0x02, 0x33, 0x74, 0x02, 0x53, 0x7c, 0x89, 0x13, 0x74, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x73, 0xd2, 0x6b, 0xd1, 0x6b, 0xb1, 0x6b, 0xd1, 0x6b, 0xf2, 0x73, 0x03, 0xd1, 0x6b,
+  0x96, 0xf2, 0x73, 0xd1, 0x73, 0xf2, 0x73, 0x12, 0x74, 0x32, 0x74, 0x32, 0x7c, 0x33, 0x7c, 0x12, 0x74, 0xb0, 0x6b, 0x2f, 0x5b, 0x0e, 0x53, 0x2e, 0x5b, 0x0e, 0x5b, 0x0e, 0x53, 0xf1, 0x73, 0xb4,
+  0x8c, 0xf6, 0x94, 0xd5, 0x8c, 0x16, 0x8d, 0x36, 0x95, 0x77, 0x95, 0x97, 0x9d, 0x02, 0xb8, 0x9d, 0x83, 0xb8, 0xa5, 0x39, 0xb6, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x81, 0x5d, 0xe7, 0x02, 0x5c, 0xe7,
+  0x82, 0xfb, 0xd6, 0x6b, 0x4a, 0x05, 0x07, 0x19, 0x82, 0x48, 0x19, 0x89, 0x21, 0x03, 0x07, 0x19, 0x82, 0x6b, 0x42, 0x4f, 0x5b, 0x02, 0xe7, 0x10, 0x84, 0xe6, 0x10, 0x68, 0x21, 0xa9, 0x29, 0x47,
+  0x19, 0x05, 0x27, 0x19, 0x82, 0x0d, 0x5b, 0xfc, 0xde, 0x03, 0x5d, 0xe7, 0x03, 0x7d, 0xe7, 0x82, 0xd8, 0xad, 0x77, 0x95, 0x02, 0x98, 0x95, 0x04, 0x98, 0x9d, 0x02, 0x97, 0x9d, 0x83, 0x77, 0x95,
+  0x36, 0x95, 0xd5, 0x8c, 0x02, 0x16, 0x8d, 0x84, 0x53, 0x74, 0xb4, 0x84, 0xf5, 0x8c, 0xb4, 0x84, 0x02, 0xd5, 0x84, 0x03, 0xb5, 0x84, 0x82, 0xf6, 0x8c, 0x16, 0x8d, 0x02, 0x36, 0x95, 0x81, 0x16,
+  0x95, 0x04, 0x36, 0x95, 0x02, 0x56, 0x95, 0x02, 0x57, 0x95, 0x86, 0x16, 0x8d, 0xb5, 0x84, 0xd5, 0x84, 0x74, 0x7c, 0x73, 0x7c, 0x33, 0x74, 0x02, 0xf2, 0x6b, 0x82, 0xd5, 0x8c, 0x16, 0x8d, 0x02,
+  0x36, 0x95, 0x02, 0x77, 0x95, 0x07, 0x57, 0x95, 0x81, 0x37, 0x95, 0x02, 0xf5, 0x8c, 0x84, 0x16, 0x8d, 0xf5, 0x8c, 0xb4, 0x84, 0xd5, 0x84, 0x02, 0xf5, 0x8c, 0x86, 0xd5, 0x84, 0xf5, 0x8c, 0x37,
+  0x95, 0x57, 0x95, 0x36, 0x95, 0x57, 0x95, 0x03, 0x77, 0x9d, 0x04, 0x57, 0x9d, 0x84, 0x36, 0x95, 0x15, 0x8d, 0x16, 0x95, 0x36, 0x95, 0x02, 0x57, 0x95, 0x82, 0x56, 0x95, 0x57, 0x95, 0x02, 0x97,
+  0x9d, 0x86, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0xa5, 0x19, 0xae, 0x3c, 0xdf, 0x5d, 0xe7, 0x02, 0x5c, 0xe7, 0x02, 0x5d, 0xe7, 0x82, 0x1c, 0xdf, 0x0c, 0x5b, 0x05, 0x07, 0x19, 0x83, 0x48, 0x19, 0xea,
+  0x29, 0xa9, 0x21, 0x02, 0xe7, 0x18, 0x87, 0xe6, 0x10, 0x0e, 0x5b, 0x90, 0x63, 0x68, 0x21, 0xe7, 0x10, 0xe6, 0x18, 0x47, 0x19, 0x02, 0xa9, 0x29, 0x06, 0x27, 0x19, 0x82, 0x2e, 0x63, 0xfc, 0xde,
+  0x02, 0x5d, 0xe7, 0x04, 0x7d, 0xe7, 0x83, 0x7a, 0xc6, 0x57, 0x95, 0x78, 0x95, 0x02, 0x98, 0x95, 0x04, 0x97, 0x95, 0x02, 0x77, 0x95, 0x86, 0x56, 0x95, 0x57, 0x95, 0x77, 0x95, 0xb4, 0x84, 0xd5,
+  0x84, 0x56, 0x95, 0x07, 0x36, 0x95, 0x82, 0x56, 0x95, 0x77, 0x95, 0x04, 0x57, 0x95, 0x07, 0x77, 0x95, 0x82, 0x57, 0x95, 0x56, 0x95, 0x03, 0x16, 0x8d, 0x84, 0xb4, 0x84, 0x73, 0x7c, 0x36, 0x95,
+  0x57, 0x95, 0x0c, 0x77, 0x95, 0x81, 0x56, 0x95, 0x04, 0x36, 0x95, 0x81, 0x57, 0x95, 0x05, 0x77, 0x95, 0x11, 0x77, 0x9d, 0x02, 0x97, 0x9d, 0x02, 0xb8, 0x9d, 0x84, 0xb8, 0xa5, 0x19, 0xb6, 0x5c,
+  0xdf, 0x5c, 0xe7, 0x04, 0x5d, 0xe7, 0x82, 0x3c, 0xdf, 0x0d, 0x5b, 0x06, 0x07, 0x19, 0x83, 0x0b, 0x2a, 0x4c, 0x32, 0x89, 0x21, 0x02, 0xe7, 0x10, 0x85, 0xe6, 0x10, 0xcd, 0x4a, 0x0a, 0x32, 0xa9,
+  0x29, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x02, 0xa9, 0x29, 0x81, 0x69, 0x21, 0x06, 0x27, 0x19, 0x83, 0x2d, 0x63, 0xfc, 0xde, 0x5d, 0xe7, 0x05, 0x7d, 0xe7, 0x83, 0x3c, 0xdf, 0xd7, 0xad, 0x37, 0x8d,
+  0x03, 0x78, 0x95, 0x06, 0x77, 0x95, 0x81, 0x57, 0x95, 0x02, 0x36, 0x95, 0x08, 0x57, 0x95, 0x12, 0x77, 0x95, 0x02, 0x57, 0x95, 0x1b, 0x77, 0x95, 0x0c, 0x77, 0x9d, 0x81, 0x97, 0x9d, 0x03, 0x98,
+  0x9d, 0x03, 0xb8, 0x9d, 0x82, 0x9a, 0xc6, 0x7c, 0xe7, 0x02, 0x5d, 0xe7, 0x81, 0x5c, 0xe7, 0x02, 0x5d, 0xe7, 0x82, 0x3c, 0xdf, 0xaf, 0x6b, 0x06, 0x07, 0x19, 0x81, 0xa9, 0x21, 0x02, 0x4c, 0x32,
+  0x81, 0x28, 0x19, 0x02, 0xe7, 0x10, 0x84, 0x88, 0x29, 0xce, 0x4a, 0x00, 0x00, 0x4c, 0x42, 0x03, 0xe7, 0x10, 0x84, 0x68, 0x21, 0xa9, 0x29, 0xaa, 0x29, 0x69, 0x21, 0x06, 0x27, 0x19, 0x82, 0x0d,
+  0x5b, 0xbb, 0xce, 0x03, 0x7d, 0xe7, 0x03, 0x5d, 0xe7, 0x84, 0x7d, 0xe7, 0xbb, 0xd6, 0x77, 0x9d, 0x37, 0x8d, 0x02, 0x78, 0x95, 0x06, 0x77, 0x95, 0x03, 0x57, 0x95, 0x04, 0x56, 0x95, 0x81, 0x57,
+  0x95, 0x05, 0x77, 0x95, 0x05, 0x77, 0x9d, 0x28, 0x77, 0x95, 0x08, 0x77, 0x9d, 0x85, 0x97, 0x9d, 0x77, 0x9d, 0x97, 0x9d, 0x97, 0x95, 0x98, 0x9d, 0x03, 0xb8, 0x9d, 0x82, 0x19, 0xb6, 0x3c, 0xdf,
+  0x02, 0x7d, 0xef, 0x02, 0x7d, 0xe7, 0x85, 0x5d, 0xe7, 0x7d, 0xe7, 0xdb, 0xd6, 0x2d, 0x63, 0x27, 0x19, 0x05, 0x07, 0x19, 0x84, 0x68, 0x21, 0x2b, 0x32, 0x4c, 0x32, 0x2b, 0x32, 0x03, 0xe6, 0x10,
+  0x85, 0x6c, 0x42, 0x0c, 0x32, 0x00, 0x00, 0x2f, 0x5b, 0x07, 0x19, 0x02, 0xe7, 0x10, 0x85, 0x07, 0x19, 0xaa, 0x29, 0xca, 0x21, 0xca, 0x29, 0x68, 0x21, 0x02, 0x07, 0x19, 0x04, 0x27, 0x19, 0x82,
+  0xc9, 0x31, 0xd7, 0xb5, 0x02, 0x7d, 0xe7, 0x06, 0x5d, 0xe7, 0x84, 0x1c, 0xd7, 0x39, 0xbe, 0x57, 0x95, 0x16, 0x8d, 0x09, 0x57, 0x95, 0x84, 0x36, 0x95, 0x36, 0x8d, 0x56, 0x8d, 0x57, 0x8d, 0x06,
+  0x77, 0x95, 0x03, 0x97, 0x9d, 0x03, 0x77, 0x95, 0x02, 0x78, 0x95, 0x81, 0x77, 0x95, 0x02, 0x78, 0x95, 0x0e, 0x77, 0x95, 0x84, 0x57, 0x95, 0x77, 0x95, 0x37, 0x8d, 0x57, 0x95, 0x0a, 0x77, 0x95,
+  0x02, 0x57, 0x95, 0x04, 0x77, 0x95, 0x83, 0x77, 0x9d, 0x77, 0x95, 0x57, 0x95, 0x06, 0x77, 0x95, 0x86, 0x78, 0x95, 0x77, 0x95, 0x57, 0x95, 0x97, 0x9d, 0x7a, 0xbe, 0x1c, 0xd7, 0x02, 0x7d, 0xef,
+  0x81, 0x7d, 0xe7, 0x02, 0x7d, 0xef, 0x02, 0x7d, 0xe7, 0x82, 0x59, 0xbe, 0x09, 0x3a, 0x06, 0x07, 0x19, 0x85, 0x48, 0x19, 0x0a, 0x2a, 0x0b, 0x32, 0x4c, 0x32, 0xca, 0x29, 0x02, 0xc6, 0x10, 0x82,
+  0xe6, 0x10, 0xac, 0x4a, 0x02, 0x00, 0x00, 0x83, 0xad, 0x4a, 0xa9, 0x29, 0xc7, 0x10, 0x02, 0xe7, 0x10, 0x82, 0x89, 0x21, 0xca, 0x29, 0x02, 0xca, 0x21, 0x81, 0x68, 0x21, 0x02, 0x07, 0x19, 0x04,
+  0x27, 0x19, 0x83, 0x47, 0x19, 0x72, 0x84, 0x1c, 0xdf, 0x06, 0x5d, 0xe7, 0x03, 0x7d, 0xe7, 0x84, 0x3c, 0xdf, 0xbb, 0xce, 0x59, 0xbe, 0x18, 0xb6, 0x07, 0xf8, 0xb5, 0x02, 0xd7, 0xb5, 0x02, 0xb7,
+  0xad, 0x81, 0xd7, 0xb5, 0x03, 0xf8, 0xb5, 0x81, 0x18, 0xb6, 0x02, 0x39, 0xbe, 0x82, 0x19, 0xbe, 0x18, 0xb6, 0x05, 0xf8, 0xb5, 0x81, 0x18, 0xb6, 0x02, 0xf8, 0xb5, 0x02, 0x18, 0xb6, 0x81, 0xf8,
+  0xb5, 0x02, 0x18, 0xbe, 0x04, 0x18, 0xb6, 0x02, 0xf8, 0xb5, 0x05, 0xd7, 0xb5, 0x82, 0x18, 0xbe, 0x38, 0xbe, 0x02, 0x18, 0xbe, 0x03, 0xf8, 0xb5, 0x02, 0xd8, 0xb5, 0x02, 0xf8, 0xb5, 0x81, 0xd7,
+  0xb5, 0x02, 0xd8, 0xb5, 0x02, 0xf8, 0xb5, 0x8d, 0xd8, 0xb5, 0xd7, 0xb5, 0xd7, 0xad, 0x97, 0xa5, 0x35, 0x9d, 0x56, 0x9d, 0x36, 0x9d, 0x56, 0x9d, 0x97, 0xa5, 0xd8, 0xb5, 0x18, 0xbe, 0x79, 0xc6,
+  0xfb, 0xde, 0x04, 0x7d, 0xef, 0x81, 0x7d, 0xe7, 0x02, 0x7d, 0xef, 0x84, 0x7d, 0xe7, 0x3d, 0xdf, 0xf4, 0x94, 0x27, 0x19, 0x06, 0x07, 0x19, 0x82, 0x47, 0x19, 0xea, 0x29, 0x02, 0x0b, 0x2a, 0x86,
+  0x2b, 0x32, 0x47, 0x21, 0xc6, 0x10, 0xe6, 0x10, 0xe9, 0x31, 0xb1, 0x63, 0x02, 0x00, 0x00, 0x86, 0x0f, 0x53, 0x6c, 0x42, 0xc6, 0x10, 0xc7, 0x10, 0xe7, 0x10, 0x08, 0x19, 0x03, 0xca, 0x29, 0x82,
+  0xca, 0x21, 0x68, 0x21, 0x04, 0x07, 0x19, 0x03, 0x27, 0x19, 0x83, 0x2a, 0x42, 0x97, 0xad, 0x5d, 0xe7, 0x08, 0x7d, 0xe7, 0x05, 0x5d, 0xe7, 0x05, 0x5c, 0xe7, 0x0c, 0x3c, 0xe7, 0x02, 0x5c, 0xe7,
+  0x16, 0x3c, 0xe7, 0x03, 0x5c, 0xe7, 0x07, 0x3c, 0xe7, 0x10, 0x5c, 0xe7, 0x81, 0x5d, 0xe7, 0x05, 0x7d, 0xe7, 0x81, 0x7d, 0xef, 0x04, 0x7d, 0xe7, 0x83, 0x39, 0xbe, 0xcc, 0x52, 0x06, 0x11, 0x02,
+  0x07, 0x11, 0x04, 0x07, 0x19, 0x82, 0x68, 0x21, 0x0a, 0x2a, 0x02, 0x0b, 0x2a, 0x82, 0xeb, 0x29, 0xea, 0x29, 0x02, 0xc6, 0x10, 0x83, 0xe6, 0x10, 0xac, 0x4a, 0xd1, 0x63, 0x03, 0x00, 0x00, 0x82,
+  0x8d, 0x4a, 0x89, 0x29, 0x03, 0xe7, 0x10, 0x82, 0x69, 0x21, 0xea, 0x29, 0x02, 0xca, 0x29, 0x82, 0xaa, 0x21, 0x68, 0x21, 0x04, 0x07, 0x19, 0x04, 0x27, 0x19, 0x83, 0xec, 0x5a, 0xd7, 0xb5, 0x5d,
+  0xe7, 0x07, 0x7d, 0xe7, 0x04, 0x5d, 0xe7, 0x23, 0x5c, 0xe7, 0x04, 0x3c, 0xe7, 0x1a, 0x5c, 0xe7, 0x02, 0x5d, 0xe7, 0x09, 0x7d, 0xe7, 0x82, 0x5a, 0xc6, 0xd0, 0x73, 0x08, 0x07, 0x19, 0x82, 0x68,
+  0x21, 0xea, 0x29, 0x03, 0x0b, 0x2a, 0x82, 0xea, 0x29, 0x48, 0x19, 0x02, 0xc6, 0x10, 0x82, 0x06, 0x19, 0xee, 0x52, 0x05, 0x00, 0x00, 0x81, 0xea, 0x31, 0x03, 0xe7, 0x10, 0x87, 0x07, 0x11, 0xca,
+  0x29, 0xea, 0x29, 0xca, 0x29, 0xca, 0x21, 0xa9, 0x21, 0x68, 0x21, 0x05, 0x07, 0x19, 0x03, 0x27, 0x19, 0x84, 0x26, 0x19, 0x6a, 0x42, 0x14, 0x9d, 0xdb, 0xd6, 0x06, 0x7d, 0xe7, 0x08, 0x5d, 0xe7,
+  0x08, 0x5c, 0xe7, 0x08, 0x5d, 0xe7, 0x2b, 0x5c, 0xe7, 0x02, 0x5d, 0xe7, 0x07, 0x7d, 0xe7, 0x83, 0xdb, 0xd6, 0x55, 0xa5, 0xed, 0x52, 0x02, 0x07, 0x11, 0x07, 0x07, 0x19, 0x82, 0x88, 0x21, 0x0a,
+  0x2a, 0x03, 0x0b, 0x2a, 0x82, 0xea, 0x29, 0xa9, 0x29, 0x03, 0xe6, 0x10, 0x82, 0x6a, 0x42, 0x70, 0x63, 0x05, 0x00, 0x00, 0x82, 0x8d, 0x42, 0x89, 0x21, 0x03, 0xe7, 0x10, 0x81, 0x07, 0x19, 0x03,
+  0xca, 0x29, 0x85, 0xc9, 0x21, 0xca, 0x29, 0xa9, 0x21, 0x27, 0x19, 0x07, 0x19, 0x07, 0x27, 0x19, 0x88, 0x26, 0x19, 0x27, 0x21, 0x4d, 0x63, 0x55, 0xa5, 0x7a, 0xc6, 0x3c, 0xdf, 0x7d, 0xef, 0x7d,
+  0xe7, 0x09, 0x5d, 0xe7, 0x07, 0x5c, 0xe7, 0x0b, 0x5d, 0xe7, 0x0a, 0x5c, 0xe7, 0x81, 0x3c, 0xe7, 0x03, 0x5c, 0xe7, 0x82, 0x3c, 0xe7, 0x5c, 0xe7, 0x10, 0x5d, 0xe7, 0x08, 0x5c, 0xe7, 0x02, 0x5d,
+  0xe7, 0x03, 0x7d, 0xe7, 0x84, 0x5d, 0xe7, 0x9a, 0xce, 0x35, 0x9d, 0x2d, 0x5b, 0x02, 0x27, 0x19, 0x09, 0x07, 0x19, 0x81, 0xc9, 0x29, 0x05, 0x0b, 0x2a, 0x82, 0xea, 0x29, 0x07, 0x19, 0x02, 0xe6,
+  0x10, 0x82, 0x06, 0x19, 0xcd, 0x52, 0x06, 0x00, 0x00, 0x83, 0x10, 0x4b, 0x2d, 0x32, 0x08, 0x19, 0x03, 0xe7, 0x10, 0x81, 0x48, 0x21, 0x05, 0xca, 0x29, 0x83, 0xa9, 0x29, 0x48, 0x19, 0x27, 0x19,
+  0x06, 0x07, 0x19, 0x04, 0x27, 0x19, 0x86, 0x26, 0x19, 0xa8, 0x29, 0x6e, 0x63, 0x15, 0x95, 0x39, 0xbe, 0x1c, 0xdf, 0x04, 0x5d, 0xe7, 0x03, 0x5c, 0xe7, 0x04, 0x3c, 0xe7, 0x81, 0x5c, 0xe7, 0x0d,
+  0x5d, 0xe7, 0x05, 0x3c, 0xe7, 0x05, 0x5c, 0xe7, 0x81, 0x3c, 0xe7, 0x03, 0x5c, 0xe7, 0x81, 0x3c, 0xe7, 0x19, 0x5d, 0xe7, 0x86, 0x5c, 0xe7, 0xdb, 0xd6, 0x59, 0xc6, 0xb6, 0xad, 0x72, 0x84, 0x8b,
+  0x4a, 0x0b, 0x07, 0x19, 0x84, 0x27, 0x19, 0x68, 0x19, 0xea, 0x29, 0x0a, 0x2a, 0x04, 0x0b, 0x2a, 0x82, 0xea, 0x29, 0x28, 0x19, 0x02, 0xe6, 0x10, 0x83, 0xe6, 0x18, 0x29, 0x42, 0xb0, 0x63, 0x07,
+  0x00, 0x00, 0x82, 0x4e, 0x3a, 0x2d, 0x3a, 0x04, 0xe7, 0x10, 0x81, 0x89, 0x21, 0x06, 0xca, 0x29, 0x82, 0x89, 0x21, 0x27, 0x19, 0x07, 0x07, 0x19, 0x05, 0x27, 0x19, 0x86, 0x47, 0x21, 0x47, 0x19,
+  0x88, 0x29, 0x2a, 0x3a, 0x6f, 0x63, 0x31, 0x7c, 0x06, 0x52, 0x84, 0x02, 0x52, 0x7c, 0x81, 0x51, 0x7c, 0x03, 0x52, 0x7c, 0x02, 0x51, 0x7c, 0x81, 0x71, 0x7c, 0x03, 0x51, 0x7c, 0x81, 0x31, 0x7c,
+  0x02, 0xf0, 0x73, 0x02, 0xd0, 0x73, 0x81, 0xf0, 0x73, 0x03, 0x11, 0x74, 0x04, 0x31, 0x7c, 0x04, 0x51, 0x7c, 0x03, 0x52, 0x7c, 0x82, 0x31, 0x7c, 0x11, 0x74, 0x05, 0xd0, 0x73, 0x86, 0xf0, 0x73,
+  0xd0, 0x73, 0xaf, 0x6b, 0x8f, 0x6b, 0x6f, 0x6b, 0x6e, 0x63, 0x02, 0x6f, 0x63, 0x81, 0x8f, 0x63, 0x02, 0x6f, 0x63, 0x89, 0x6e, 0x63, 0xed, 0x52, 0x4b, 0x42, 0x6b, 0x42, 0x2a, 0x3a, 0xe9, 0x31,
+  0xc9, 0x31, 0x68, 0x21, 0x47, 0x19, 0x03, 0x27, 0x19, 0x0a, 0x07, 0x19, 0x83, 0x28, 0x19, 0xc9, 0x29, 0x0a, 0x2a, 0x05, 0x0b, 0x2a, 0x82, 0x0a, 0x2a, 0x47, 0x19, 0x02, 0xc6, 0x10, 0x84, 0xe6,
+  0x10, 0x06, 0x19, 0xec, 0x5a, 0xf2, 0x73, 0x08, 0x00, 0x00, 0x82, 0xef, 0x42, 0x8a, 0x19, 0x03, 0xe7, 0x10, 0x82, 0x07, 0x19, 0xaa, 0x29, 0x02, 0xea, 0x29, 0x02, 0xca, 0x29, 0x85, 0xea, 0x29,
+  0xca, 0x29, 0xc9, 0x29, 0x68, 0x21, 0x27, 0x19, 0x06, 0x07, 0x19, 0x05, 0x27, 0x19, 0x09, 0x28, 0x19, 0x83, 0x27, 0x11, 0x27, 0x19, 0x07, 0x19, 0x04, 0x28, 0x19, 0x81, 0x27, 0x19, 0x06, 0x28,
+  0x19, 0x81, 0x27, 0x19, 0x0b, 0x28, 0x19, 0x07, 0x28, 0x11, 0x81, 0x27, 0x11, 0x03, 0x27, 0x19, 0x81, 0x28, 0x19, 0x02, 0x27, 0x19, 0x10, 0x28, 0x19, 0x02, 0x48, 0x19, 0x02, 0x47, 0x19, 0x06,
+  0x27, 0x19, 0x06, 0x07, 0x19, 0x82, 0x27, 0x19, 0xa9, 0x21, 0x02, 0x2b, 0x2a, 0x81, 0x0b, 0x2a, 0x02, 0x2b, 0x2a, 0x02, 0x0b, 0x2a, 0x82, 0x0a, 0x2a, 0x68, 0x21, 0x03, 0xc6, 0x10, 0x83, 0xe6,
+  0x18, 0x49, 0x42, 0x6e, 0x63, 0x09, 0x00, 0x00, 0x83, 0x50, 0x53, 0x8e, 0x3a, 0xe8, 0x10, 0x03, 0xe7, 0x10, 0x86, 0x07, 0x19, 0xaa, 0x29, 0xca, 0x29, 0xea, 0x29, 0xca, 0x29, 0xea, 0x29, 0x03,
+  0xca, 0x29, 0x83, 0xa9, 0x29, 0x68, 0x21, 0x27, 0x19, 0x04, 0x07, 0x19, 0x05, 0x27, 0x19, 0x03, 0x48, 0x19, 0x04, 0x28, 0x19, 0x06, 0x27, 0x19, 0x06, 0x28, 0x19, 0x05, 0x27, 0x19, 0x0d, 0x28,
+  0x19, 0x17, 0x27, 0x19, 0x05, 0x28, 0x19, 0x0a, 0x27, 0x19, 0x04, 0x07, 0x19, 0x84, 0x47, 0x21, 0xc9, 0x29, 0x2b, 0x32, 0x4b, 0x2a, 0x02, 0x2b, 0x2a, 0x04, 0x0b, 0x2a, 0x82, 0x0a, 0x2a, 0x88,
+  0x21, 0x02, 0xc6, 0x10, 0x84, 0xe6, 0x10, 0xe6, 0x18, 0x67, 0x29, 0x8f, 0x6b, 0x0b, 0x00, 0x00, 0x82, 0xef, 0x42, 0xcb, 0x29, 0x03, 0xe7, 0x10, 0x84, 0x07, 0x11, 0x27, 0x19, 0xaa, 0x29, 0xca,
+  0x29, 0x02, 0xea, 0x29, 0x06, 0xca, 0x29, 0x83, 0xa9, 0x21, 0x68, 0x21, 0x27, 0x19, 0x02, 0x07, 0x19, 0x04, 0x27, 0x19, 0x03, 0x48, 0x19, 0x05, 0x28, 0x19, 0x06, 0x27, 0x19, 0x05, 0x28, 0x19,
+  0x05, 0x27, 0x19, 0x08, 0x28, 0x19, 0x81, 0x48, 0x19, 0x04, 0x28, 0x19, 0x17, 0x27, 0x19, 0x05, 0x28, 0x19, 0x0c, 0x27, 0x19, 0x83, 0x88, 0x21, 0xea, 0x31, 0x2b, 0x32, 0x02, 0x4b, 0x32, 0x81,
+  0x4b, 0x2a, 0x02, 0x2b, 0x2a, 0x04, 0x0b, 0x2a, 0x81, 0xa9, 0x21, 0x04, 0xc6, 0x10, 0x83, 0x47, 0x21, 0xcc, 0x4a, 0xb0, 0x63, 0x0b, 0x00, 0x00, 0x83, 0x0d, 0x2a, 0x8e, 0x42, 0x69, 0x21, 0x02,
+  0xe7, 0x10, 0x02, 0x07, 0x11, 0x84, 0x07, 0x19, 0xa9, 0x29, 0xca, 0x29, 0xea, 0x29, 0x04, 0xca, 0x29, 0x05, 0xea, 0x29, 0x83, 0xa9, 0x29, 0x89, 0x21, 0x48, 0x21, 0x02, 0x27, 0x19, 0x81, 0x47,
+  0x19, 0x03, 0x48, 0x19, 0x06, 0x28, 0x19, 0x16, 0x27, 0x19, 0x04, 0x28, 0x19, 0x1a, 0x27, 0x19, 0x04, 0x28, 0x19, 0x08, 0x27, 0x19, 0x84, 0x48, 0x21, 0x68, 0x21, 0xa9, 0x29, 0xea, 0x29, 0x02,
+  0x0a, 0x32, 0x02, 0x2b, 0x32, 0x02, 0x4b, 0x32, 0x04, 0x2b, 0x2a, 0x83, 0x0a, 0x2a, 0xa9, 0x21, 0xe6, 0x10, 0x03, 0xc6, 0x10, 0x83, 0xe6, 0x18, 0x8b, 0x42, 0xd0, 0x6b, 0x0e, 0x00, 0x00, 0x82,
+  0x0c, 0x2a, 0x49, 0x19, 0x03, 0xe7, 0x10, 0x83, 0xe7, 0x18, 0x07, 0x19, 0x69, 0x21, 0x05, 0xca, 0x29, 0x05, 0xea, 0x29, 0x02, 0xeb, 0x29, 0x84, 0xea, 0x29, 0xca, 0x29, 0xa9, 0x21, 0x68, 0x21,
+  0x05, 0x48, 0x19, 0x02, 0x28, 0x19, 0x3f, 0x27, 0x19, 0x88, 0x48, 0x19, 0x68, 0x21, 0x89, 0x21, 0xc9, 0x29, 0xca, 0x29, 0xea, 0x29, 0x0a, 0x2a, 0x0b, 0x2a, 0x02, 0x2b, 0x2a, 0x81, 0x2b, 0x32,
+  0x04, 0x2b, 0x2a, 0x02, 0x0b, 0x2a, 0x81, 0x68, 0x21, 0x03, 0xe6, 0x10, 0x84, 0xc6, 0x10, 0xc5, 0x18, 0xab, 0x52, 0x4e, 0x5b, 0x10, 0x00, 0x00, 0x82, 0xab, 0x21, 0x48, 0x19, 0x02, 0xe7, 0x10,
+  0x84, 0xe7, 0x18, 0xe7, 0x10, 0xe7, 0x18, 0x28, 0x19, 0x04, 0xca, 0x29, 0x08, 0xea, 0x29, 0x83, 0xca, 0x29, 0xca, 0x21, 0xa9, 0x21, 0x02, 0x68, 0x21, 0x04, 0x48, 0x19, 0x81, 0x47, 0x19, 0x3e,
+  0x27, 0x19, 0x02, 0x48, 0x19, 0x84, 0x68, 0x21, 0xa9, 0x21, 0xc9, 0x21, 0xca, 0x29, 0x02, 0xea, 0x29, 0x83, 0x0b, 0x2a, 0x2b, 0x2a, 0x0b, 0x2a, 0x03, 0x2b, 0x2a, 0x02, 0x0b, 0x2a, 0x83, 0xea,
+  0x29, 0x27, 0x19, 0xe6, 0x18, 0x02, 0xe6, 0x10, 0x85, 0xc6, 0x10, 0xe5, 0x18, 0x6a, 0x4a, 0x6e, 0x63, 0xea, 0x31, 0x10, 0x00, 0x00, 0x83, 0x2c, 0x2a, 0xec, 0x29, 0x49, 0x21, 0x05, 0xe7, 0x10,
+  0x82, 0x07, 0x19, 0x68, 0x21, 0x02, 0xca, 0x29, 0x04, 0xea, 0x29, 0x81, 0xea, 0x21, 0x02, 0xea, 0x29, 0x81, 0xca, 0x29, 0x02, 0xca, 0x21, 0x82, 0xa9, 0x21, 0x89, 0x21, 0x02, 0x68, 0x21, 0x04,
+  0x48, 0x19, 0x81, 0x47, 0x19, 0x32, 0x27, 0x19, 0x05, 0x07, 0x19, 0x06, 0x27, 0x19, 0x88, 0x47, 0x19, 0x48, 0x19, 0x88, 0x21, 0xa9, 0x21, 0xc9, 0x29, 0xca, 0x29, 0xea, 0x29, 0xeb, 0x29, 0x04,
+  0x0b, 0x2a, 0x8c, 0x2b, 0x2a, 0x0b, 0x2a, 0xeb, 0x29, 0x68, 0x21, 0xe6, 0x10, 0xc6, 0x10, 0xc6, 0x18, 0xe6, 0x10, 0xc6, 0x18, 0xe6, 0x18, 0x49, 0x42, 0xcc, 0x52, 0x13, 0x00, 0x00, 0x83, 0xef,
+  0x4a, 0x4d, 0x3a, 0xaa, 0x29, 0x05, 0xe7, 0x10, 0x83, 0xe6, 0x10, 0x27, 0x19, 0xa9, 0x29, 0x02, 0xca, 0x29, 0x02, 0xca, 0x21, 0x83, 0xea, 0x21, 0xca, 0x21, 0xca, 0x29, 0x03, 0xca, 0x21, 0x81,
+  0xa9, 0x21, 0x02, 0x89, 0x21, 0x03, 0x68, 0x21, 0x03, 0x48, 0x19, 0x81, 0x47, 0x19, 0x31, 0x27, 0x19, 0x05, 0x07, 0x19, 0x06, 0x27, 0x19, 0x85, 0x47, 0x19, 0x68, 0x21, 0x88, 0x21, 0xa9, 0x21,
+  0xc9, 0x29, 0x02, 0xea, 0x29, 0x81, 0xeb, 0x29, 0x04, 0x0b, 0x2a, 0x83, 0xeb, 0x29, 0x89, 0x21, 0xe6, 0x10, 0x03, 0xc6, 0x10, 0x81, 0xc6, 0x18, 0x02, 0xe6, 0x10, 0x82, 0x87, 0x29, 0x8b, 0x4a,
+  0x0a, 0x00, 0x00, 0x81, 0x2f, 0x5b, 0x0a, 0x00, 0x00, 0x83, 0x39, 0x8d, 0x2d, 0x32, 0x8a, 0x21, 0x03, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x02, 0x06, 0x11, 0x82, 0x27, 0x19, 0x89, 0x21, 0x03, 0xca,
+  0x21, 0x02, 0xca, 0x29, 0x81, 0xc9, 0x21, 0x03, 0xa9, 0x21, 0x02, 0x89, 0x21, 0x81, 0x88, 0x21, 0x03, 0x68, 0x21, 0x03, 0x48, 0x19, 0x03, 0x47, 0x19, 0x33, 0x27, 0x19, 0x81, 0x07, 0x19, 0x05,
+  0x27, 0x19, 0x86, 0x47, 0x19, 0x68, 0x19, 0x88, 0x21, 0x89, 0x21, 0xc9, 0x29, 0xca, 0x29, 0x02, 0xea, 0x29, 0x02, 0xeb, 0x29, 0x83, 0xea, 0x29, 0x89, 0x21, 0x06, 0x19, 0x05, 0xc6, 0x10, 0x83,
+  0xe6, 0x18, 0x27, 0x21, 0xa8, 0x29, 0x02, 0x00, 0x00, 0x81, 0xef, 0x4a, 0x04, 0x00, 0x00, 0x81, 0x2f, 0x5b, 0x04, 0x00, 0x00, 0x02, 0x2f, 0x5b, 0x0b, 0x00, 0x00, 0x84, 0x0b, 0x32, 0xaa, 0x29,
+  0x07, 0x11, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x03, 0xe7, 0x10, 0x85, 0xe6, 0x10, 0x07, 0x19, 0x68, 0x21, 0x89, 0x21, 0xa9, 0x29, 0x04, 0xa9, 0x21, 0x03, 0x89, 0x21, 0x81, 0x88, 0x21, 0x03, 0x68,
+  0x21, 0x03, 0x48, 0x19, 0x03, 0x47, 0x19, 0x06, 0x27, 0x19, 0x02, 0x48, 0x19, 0x2a, 0x27, 0x19, 0x02, 0x07, 0x19, 0x05, 0x27, 0x19, 0x02, 0x47, 0x19, 0x84, 0x68, 0x21, 0x89, 0x21, 0xa9, 0x21,
+  0xca, 0x29, 0x02, 0xea, 0x29, 0x83, 0xc9, 0x29, 0x68, 0x21, 0xe6, 0x18, 0x04, 0xe6, 0x10, 0x02, 0xc6, 0x10, 0x83, 0xe6, 0x18, 0x67, 0x29, 0x8c, 0x4a, 0x07, 0x00, 0x00, 0x02, 0x2f, 0x5b, 0x04,
+  0x00, 0x00, 0x02, 0x2f, 0x5b, 0x0c, 0x00, 0x00, 0x83, 0x6d, 0x3a, 0x2b, 0x32, 0x89, 0x21, 0x02, 0xe6, 0x10, 0x04, 0xe7, 0x10, 0x02, 0xe6, 0x10, 0x86, 0xe6, 0x18, 0x06, 0x19, 0x26, 0x19, 0x47,
+  0x21, 0x67, 0x21, 0x68, 0x21, 0x03, 0x88, 0x21, 0x03, 0x68, 0x21, 0x81, 0x68, 0x19, 0x02, 0x47, 0x19, 0x2d, 0x27, 0x19, 0x81, 0x26, 0x19, 0x07, 0x27, 0x19, 0x81, 0x07, 0x19, 0x03, 0x06, 0x19,
+  0x05, 0x27, 0x19, 0x82, 0x47, 0x19, 0x47, 0x21, 0x02, 0x68, 0x21, 0x83, 0x48, 0x21, 0x27, 0x19, 0xe6, 0x18, 0x03, 0xe6, 0x10, 0x81, 0xe6, 0x18, 0x02, 0xe6, 0x10, 0x88, 0xe6, 0x18, 0xc6, 0x18,
+  0xe6, 0x18, 0xa8, 0x31, 0xb0, 0x6b, 0x00, 0x00, 0x99, 0x9d, 0x91, 0x5b, 0x1a, 0x00, 0x00, 0x85, 0x8d, 0x3a, 0xce, 0x42, 0x0b, 0x32, 0x47, 0x19, 0xe6, 0x10, 0x04, 0xe7, 0x10, 0x81, 0xe6, 0x10,
+  0x04, 0xe6, 0x18, 0x81, 0x06, 0x19, 0x0e, 0x07, 0x19, 0x81, 0x06, 0x19, 0x03, 0x07, 0x19, 0x82, 0x06, 0x19, 0x26, 0x19, 0x03, 0x27, 0x19, 0x83, 0x07, 0x19, 0x06, 0x19, 0x07, 0x19, 0x02, 0x26,
+  0x19, 0x03, 0x27, 0x19, 0x17, 0x07, 0x19, 0x03, 0x06, 0x19, 0x06, 0x07, 0x19, 0x0e, 0x06, 0x19, 0x02, 0xe6, 0x18, 0x81, 0x06, 0x19, 0x05, 0xe6, 0x18, 0x84, 0xc6, 0x18, 0x88, 0x31, 0x09, 0x3a,
+  0x4a, 0x42, 0x1f, 0x00, 0x00, 0x85, 0x74, 0x7c, 0x2f, 0x53, 0x0e, 0x53, 0xca, 0x29, 0x69, 0x21, 0x08, 0xe7, 0x10, 0x04, 0x07, 0x19, 0x04, 0xe7, 0x18, 0x02, 0x07, 0x19, 0x05, 0xe7, 0x18, 0x07,
+  0x07, 0x19, 0x05, 0xe7, 0x18, 0x0b, 0x07, 0x19, 0x07, 0xe7, 0x18, 0x09, 0x07, 0x19, 0x07, 0xe7, 0x18, 0x07, 0x06, 0x19, 0x05, 0xe7, 0x18, 0x07, 0xe6, 0x18, 0x81, 0x06, 0x19, 0x04, 0xe6, 0x18,
+  0x84, 0x88, 0x31, 0xc9, 0x31, 0xac, 0x52, 0x0a, 0x3a, 0x02, 0x00, 0x00, 0x81, 0x53, 0x74, 0x1e, 0x00, 0x00, 0x88, 0x94, 0x7c, 0x13, 0x6c, 0x75, 0x7c, 0x8e, 0x3a, 0x4d, 0x32, 0xab, 0x29, 0x28,
+  0x19, 0xc7, 0x10, 0x04, 0xe7, 0x10, 0x82, 0x07, 0x19, 0xe7, 0x18, 0x0b, 0x07, 0x19, 0x02, 0xe7, 0x18, 0x07, 0x07, 0x19, 0x05, 0xe7, 0x18, 0x0c, 0x07, 0x19, 0x04, 0xe7, 0x18, 0x0b, 0x07, 0x19,
+  0x02, 0xe7, 0x18, 0x81, 0x07, 0x19, 0x02, 0xe7, 0x18, 0x04, 0x07, 0x19, 0x0a, 0xe7, 0x18, 0x03, 0xe6, 0x18, 0x82, 0x06, 0x19, 0xe6, 0x18, 0x02, 0xe7, 0x18, 0x87, 0x06, 0x19, 0xe6, 0x18, 0x06,
+  0x19, 0x88, 0x29, 0xa8, 0x31, 0x8b, 0x42, 0x2e, 0x5b, 0x28, 0x00, 0x00, 0x87, 0x8e, 0x42, 0xaf, 0x42, 0x2c, 0x3a, 0x0b, 0x3a, 0x89, 0x29, 0x07, 0x19, 0xe7, 0x10, 0x03, 0xe7, 0x18, 0x0a, 0x07,
+  0x19, 0x02, 0xe7, 0x18, 0x02, 0x07, 0x19, 0x81, 0xe7, 0x18, 0x04, 0x07, 0x19, 0x07, 0xe7, 0x18, 0x02, 0x07, 0x19, 0x02, 0xe7, 0x18, 0x04, 0x07, 0x19, 0x06, 0xe7, 0x18, 0x02, 0x07, 0x19, 0x03,
+  0xe7, 0x18, 0x06, 0x07, 0x19, 0x02, 0xe7, 0x18, 0x81, 0xe6, 0x10, 0x02, 0xe7, 0x18, 0x81, 0xe7, 0x10, 0x03, 0x07, 0x19, 0x81, 0xe7, 0x18, 0x02, 0x07, 0x19, 0x03, 0xe7, 0x18, 0x07, 0xe6, 0x18,
+  0x81, 0x06, 0x19, 0x02, 0x07, 0x19, 0x85, 0x88, 0x31, 0xea, 0x39, 0x6b, 0x4a, 0xac, 0x4a, 0x0e, 0x5b, 0x2d, 0x00, 0x00, 0x86, 0x0b, 0x32, 0x30, 0x5b, 0x2b, 0x3a, 0x0b, 0x3a, 0x6c, 0x42, 0xeb,
+  0x39, 0x02, 0x89, 0x29, 0x82, 0xa9, 0x29, 0x68, 0x21, 0x02, 0x89, 0x29, 0x86, 0xa9, 0x29, 0x89, 0x29, 0x89, 0x21, 0x89, 0x29, 0xca, 0x31, 0xea, 0x31, 0x02, 0xca, 0x31, 0x04, 0xeb, 0x31, 0x84,
+  0xca, 0x31, 0xaa, 0x31, 0xca, 0x31, 0xeb, 0x31, 0x02, 0xeb, 0x39, 0x81, 0xca, 0x31, 0x02, 0xea, 0x31, 0x82, 0x0b, 0x3a, 0xeb, 0x31, 0x02, 0x0b, 0x3a, 0x82, 0xea, 0x31, 0x0b, 0x3a, 0x02, 0xeb,
+  0x31, 0x03, 0xca, 0x31, 0x81, 0xeb, 0x31, 0x02, 0xaa, 0x31, 0x02, 0x89, 0x29, 0x02, 0xca, 0x31, 0x02, 0xa9, 0x29, 0x81, 0xc9, 0x31, 0x02, 0xea, 0x31, 0x85, 0xc9, 0x29, 0xa9, 0x31, 0xa9, 0x29,
+  0xc9, 0x31, 0xea, 0x31, 0x03, 0xca, 0x31, 0x82, 0xea, 0x31, 0xca, 0x31, 0x03, 0x0b, 0x3a, 0x87, 0xea, 0x31, 0xeb, 0x39, 0xea, 0x31, 0xca, 0x31, 0xea, 0x31, 0xa9, 0x29, 0x48, 0x21, 0x02, 0x89,
+  0x29, 0x81, 0x27, 0x21, 0x04, 0x68, 0x29, 0x83, 0x4b, 0x42, 0x6b, 0x4a, 0xed, 0x5a, 0x02, 0x00, 0x00, 0x81, 0xf3, 0x73, 0x23, 0x00, 0x00, 0x84, 0x00, 0x17, 0x42, 0x81, 0x8f, 0x96, 0xa2, 0xfa,
+  0x1d, 0xff, 0xff, 0x86, 0xfa, 0xd0, 0xca, 0xc7, 0xc6, 0xc6, 0xc6, 0xba, 0x8d, 0x71, 0x3a, 0x0f, 0x06, 0x00, 0x00, 0x82, 0x00, 0x01, 0x02, 0x00, 0x12, 0x00, 0x00, 0x83, 0x00, 0x04, 0x47, 0x95,
+  0xca, 0xfc, 0x25, 0xff, 0xff, 0x83, 0xff, 0xf4, 0xc5, 0x8f, 0x3a, 0x02, 0x17, 0x00, 0x00, 0x82, 0x0e, 0x5b, 0xaa, 0xec, 0x29, 0xff, 0xff, 0x82, 0xfe, 0xe1, 0x80, 0x25, 0x15, 0x00, 0x00, 0x82,
+  0x1f, 0x8f, 0xed, 0xff, 0x2b, 0xff, 0xff, 0x82, 0xff, 0xfa, 0xb5, 0x3c, 0x13, 0x00, 0x00, 0x82, 0x2b, 0x9c, 0xf9, 0xff, 0x2d, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xb5, 0x35, 0x11, 0x00, 0x00, 0x82,
+  0x10, 0x8f, 0xf6, 0xff, 0x05, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xf7, 0xff, 0x28, 0xff, 0xff, 0x82, 0xff, 0xfd, 0x99, 0x0f, 0x0f, 0x00, 0x00, 0x82, 0x00, 0x4b, 0xdd, 0xff, 0x31, 0xff, 0xff, 0x82,
+  0xff, 0xe0, 0x3a, 0x00, 0x0d, 0x00, 0x00, 0x82, 0x00, 0x05, 0x7f, 0xf8, 0x33, 0xff, 0xff, 0x82, 0xf9, 0x7d, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x81, 0x13, 0xd0, 0x35, 0xff, 0xff, 0x81, 0xae, 0x0f,
+  0x0b, 0x00, 0x00, 0x82, 0x00, 0x3c, 0xed, 0xff, 0x35, 0xff, 0xff, 0x82, 0xff, 0xd4, 0x16, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x45, 0xd9, 0x37, 0xff, 0xff, 0x81, 0xd5, 0x34, 0x09, 0x00, 0x00, 0x82,
+  0x00, 0x16, 0xe7, 0xff, 0x37, 0xff, 0xff, 0x82, 0xff, 0xef, 0x1c, 0x00, 0x08, 0x00, 0x00, 0x81, 0x20, 0xd2, 0x39, 0xff, 0xff, 0x81, 0xd5, 0x1e, 0x07, 0x00, 0x00, 0x82, 0x00, 0x11, 0xb8, 0xff,
+  0x39, 0xff, 0xff, 0x82, 0xff, 0xaf, 0x03, 0x00, 0x06, 0x00, 0x00, 0x81, 0x03, 0x94, 0x3b, 0xff, 0xff, 0x81, 0x6d, 0x02, 0x06, 0x00, 0x00, 0x81, 0x5a, 0xff, 0x3b, 0xff, 0xff, 0x81, 0xf8, 0x43,
+  0x05, 0x00, 0x00, 0x82, 0x00, 0x14, 0xe2, 0xff, 0x3b, 0xff, 0xff, 0x82, 0xff, 0xce, 0x1c, 0x00, 0x04, 0x00, 0x00, 0x81, 0x00, 0xa3, 0x3d, 0xff, 0xff, 0x81, 0x8f, 0x00, 0x04, 0x00, 0x00, 0x81,
+  0x46, 0xfd, 0x3d, 0xff, 0xff, 0x81, 0xf5, 0x25, 0x03, 0x00, 0x00, 0x82, 0x00, 0x01, 0xba, 0xff, 0x3d, 0xff, 0xff, 0x81, 0xff, 0x91, 0x03, 0x00, 0x00, 0x82, 0x00, 0x39, 0xfe, 0xff, 0x3d, 0xff,
+  0xff, 0x82, 0xff, 0xf4, 0x23, 0x00, 0x02, 0x00, 0x00, 0x81, 0x03, 0xb0, 0x3f, 0xff, 0xff, 0x81, 0x8e, 0x00, 0x02, 0x00, 0x00, 0x81, 0x20, 0xfb, 0x3f, 0xff, 0xff, 0x81, 0xf3, 0x10, 0x02, 0x00,
+  0x00, 0x81, 0x81, 0xff, 0x3f, 0xff, 0xff, 0x84, 0xff, 0x75, 0x00, 0x00, 0x00, 0x08, 0xd2, 0xff, 0x3f, 0xff, 0xff, 0x84, 0xff, 0xd9, 0x04, 0x00, 0x00, 0x2b, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0x83,
+  0xff, 0xfc, 0x15, 0x00, 0x00, 0x69, 0x41, 0xff, 0xff, 0x82, 0x5c, 0x00, 0x00, 0xa9, 0x41, 0xff, 0xff, 0x82, 0x8f, 0x00, 0x00, 0xe5, 0x41, 0xff, 0xff, 0x82, 0xd1, 0x03, 0x1a, 0xfe, 0x41, 0xff,
+  0xff, 0x82, 0xf6, 0x14, 0x3b, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0x34, 0x60, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0x5c, 0x7c, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0xa0, 0x9b, 0xff, 0x41, 0xff,
+  0xff, 0x82, 0xff, 0xbb, 0xac, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0xd1, 0xc6, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xc7, 0xff, 0x42, 0xff, 0xff, 0x81, 0xc8, 0xff, 0x42, 0xff, 0xff, 0x81,
+  0xce, 0xff, 0x42, 0xff, 0xff, 0x81, 0xe7, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff,
+  0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff,
+  0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f,
+  0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x2b, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x42, 0xff, 0xff, 0x81, 0xd7, 0xff, 0x41, 0xff, 0xff,
+  0x82, 0xff, 0xe5, 0xc0, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0xb6, 0x98, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0xad, 0xae, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0xbb, 0x86, 0xff, 0x41, 0xff, 0xff,
+  0x82, 0xff, 0x99, 0x60, 0xff, 0x41, 0xff, 0xff, 0x82, 0xff, 0x91, 0x46, 0xf8, 0x41, 0xff, 0xff, 0x82, 0xf4, 0x2a, 0x07, 0xd4, 0x41, 0xff, 0xff, 0x82, 0xe6, 0x14, 0x00, 0x94, 0x41, 0xff, 0xff,
+  0x83, 0xb3, 0x06, 0x00, 0x28, 0xf0, 0xff, 0x3f, 0xff, 0xff, 0x84, 0xff, 0xf1, 0x11, 0x00, 0x00, 0x02, 0xcd, 0xff, 0x3f, 0xff, 0xff, 0x84, 0xff, 0xe1, 0x05, 0x00, 0x00, 0x02, 0x9b, 0xff, 0x3f,
+  0xff, 0xff, 0x84, 0xff, 0xca, 0x03, 0x00, 0x00, 0x00, 0x1c, 0xec, 0x3f, 0xff, 0xff, 0x81, 0xff, 0x68, 0x02, 0x00, 0x00, 0x81, 0x00, 0x72, 0x3f, 0xff, 0xff, 0x81, 0xe3, 0x11, 0x02, 0x00, 0x00,
+  0x82, 0x00, 0x2e, 0xea, 0xff, 0x3e, 0xff, 0xff, 0x81, 0x7d, 0x00, 0x02, 0x00, 0x00, 0x82, 0x00, 0x01, 0x60, 0xfc, 0x3d, 0xff, 0xff, 0x82, 0xff, 0xec, 0x27, 0x00, 0x03, 0x00, 0x00, 0x81, 0x13,
+  0xd1, 0x3d, 0xff, 0xff, 0x82, 0xf6, 0x7d, 0x01, 0x00, 0x03, 0x00, 0x00, 0x82, 0x00, 0x43, 0xf5, 0xff, 0x3c, 0xff, 0xff, 0x81, 0xcd, 0x30, 0x04, 0x00, 0x00, 0x82, 0x00, 0x05, 0xb2, 0xff, 0x3b,
+  0xff, 0xff, 0x82, 0xff, 0xe2, 0x78, 0x00, 0x05, 0x00, 0x00, 0x81, 0x24, 0xe9, 0x3b, 0xff, 0xff, 0x82, 0xfe, 0x97, 0x07, 0x00, 0x05, 0x00, 0x00, 0x82, 0x01, 0x4f, 0xf3, 0xff, 0x3a, 0xff, 0xff,
+  0x81, 0xc4, 0x1a, 0x07, 0x00, 0x00, 0x81, 0x4f, 0xf3, 0x39, 0xff, 0xff, 0x82, 0xff, 0xf7, 0x3b, 0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x52, 0xf7, 0xff, 0x38, 0xff, 0xff, 0x82, 0xd7, 0x42, 0x01,
+  0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x01, 0x71, 0xf9, 0x37, 0xff, 0xff, 0x82, 0xff, 0xc3, 0x23, 0x00, 0x09, 0x00, 0x00, 0x82, 0x01, 0x6c, 0xf9, 0xff, 0x35, 0xff, 0xff, 0x82, 0xff, 0xf2, 0x71,
+  0x0b, 0x05, 0x00, 0x00, 0x81, 0x01, 0x00, 0x04, 0x00, 0x00, 0x82, 0x00, 0x01, 0x3c, 0xde, 0x35, 0xff, 0xff, 0x85, 0xf7, 0x57, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+  0x81, 0x0e, 0x01, 0x05, 0x00, 0x00, 0x82, 0x00, 0x2c, 0xdf, 0xff, 0x33, 0xff, 0xff, 0x82, 0xff, 0xe3, 0x40, 0x00, 0x03, 0x00, 0x00, 0x81, 0x01, 0x01, 0x02, 0x00, 0x00, 0x81, 0x05, 0x04, 0x06,
+  0x00, 0x00, 0x82, 0x2b, 0xb9, 0xfe, 0xff, 0x32, 0xff, 0xff, 0x83, 0xc3, 0x2d, 0x00, 0x02, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x82, 0x00, 0x05, 0x91, 0xf7, 0x31, 0xff, 0xff, 0x82, 0xf9, 0x86, 0x0f,
+  0x00, 0x0f, 0x00, 0x00, 0x83, 0x05, 0x5e, 0x96, 0xcb, 0xfd, 0xff, 0x2e, 0xff, 0xff, 0x84, 0xf2, 0xbc, 0x3f, 0x03, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x84, 0x00, 0x01, 0x02, 0x05, 0x5a,
+  0xa4, 0xed, 0xff, 0x2b, 0xff, 0xff, 0x83, 0xfe, 0xf7, 0xc2, 0x70, 0x33, 0x04, 0x14, 0x00, 0x00, 0x83, 0x15, 0x5d, 0xac, 0xf1, 0xfd, 0xff, 0x28, 0xff, 0xff, 0x83, 0xf9, 0xbd, 0x53, 0x2b, 0x0c,
+  0x00, 0x16, 0x00, 0x00, 0x8a, 0x01, 0x0d, 0x17, 0x63, 0xbc, 0xc8, 0xd0, 0xcf, 0xc8, 0xd1, 0xe5, 0xe7, 0xe6, 0xe6, 0xe6, 0xe5, 0xe2, 0xe8, 0xf1, 0xff, 0x1b, 0xff, 0xff, 0x88, 0xdc, 0xc7, 0xcb,
+  0xdc, 0xc1, 0xbc, 0xcf, 0xa7, 0x5d, 0x36, 0x22, 0x02, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x00,
 };
 
 const lv_image_dsc_t img_execute = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 134,
   .header.h = 140,
-  .data_size = 18760 * 3,
+  .header.stride = 268,
+  .data_size = sizeof(img_execute_map),
   .data = img_execute_map,
 };
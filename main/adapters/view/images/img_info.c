@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_info.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,268 +24,528 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_INFO uint8_t img_info_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xae, 0x14, 0x8d, 0x08, 0x02, 0xc7, 0x01, 0x2a, 0x32, 0x7d, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x5b, 0xe3, 0x00, 0x62, 0x00, 0x87, 0x21, 0x46, 0x19, 0x66, 0x19, 0x66, 0x21, 0x66, 0x21, 0x66, 0x29, 0x66, 0x29, 0x66, 0x21, 0x86, 0x29, 0xa6, 0x29, 0xc7, 0x31, 0xc8, 0x31, 0xe8, 0x31, 0x08, 0x3a, 0x08, 0x3a, 0xc7, 0x31, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0xa7, 0x31, 0xe4, 0x10, 0xe4, 0x10, 0x41, 0x00, 0x69, 0x4a, 0x49, 0x4a, 0x41, 0x00, 0xe4, 0x10, 0xe4, 0x10, 0x41, 0x00, 0x08, 0x3a, 0x04, 0x19, 0x62, 0x00, 0x62, 0x00, 0xe7, 0x31, 0x08, 0x3a, 0xe7, 0x31, 0x66, 0x21, 0x25, 0x19, 0x25, 0x11, 0xe4, 0x08, 0x62, 0x00, 0x82, 0x00, 0x82, 0x00, 0x41, 0x00, 0x21, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x02, 0xcb, 0x52, 0xa3, 0x00, 0x87, 0x21, 0xe8, 0x31, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x46, 0x21, 0xa8, 0x31, 0x6a, 0x42, 0x83, 0x00, 0xb5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xb5, 0xec, 0x5a, 0xc7, 0x29, 0x66, 0x21, 0xe5, 0x08, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x19, 0x21, 0x00, 0x87, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x08, 0x3a, 0xc7, 0x29, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x19, 0x26, 0x19, 0xe9, 0x31, 0x84, 0x00, 0xa6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xa3, 0x00, 0x29, 0x3a, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x25, 0x11, 0x25, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x09, 0xe5, 0x10, 0xa4, 0x10, 0x02, 0x00, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0x25, 0x19, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x25, 0x11, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x19, 0x26, 0x19, 0x8b, 0x4a, 0x6b, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xa7, 0x29, 0x46, 0x11, 0x26, 0x09, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x25, 0x11, 0x25, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x09, 0xe5, 0x10, 0xe5, 0x10, 0x66, 0x29, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x42, 0x46, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x21, 0x52, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x29, 0x3a, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x09, 0x05, 0x09, 0xe5, 0x08, 0x06, 0x19, 0xc5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0xc8, 0x31, 0x8f, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x66, 0x21, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0xe5, 0x10, 0xe5, 0x08, 0x05, 0x09, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x19, 0x93, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x25, 0x19, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x29, 0x47, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x46, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x06, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x19, 0x06, 0x19, 0x26, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe6, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xa8, 0x39, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x42, 0x66, 0x29, 0x25, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x06, 0x11, 0x26, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0xc9, 0x39, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x2d, 0x63, 0x99, 0xd6, 0xda, 0xde, 0xbe, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x5c, 0xef, 0x26, 0x21, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe6, 0x08, 0xe6, 0x08, 0xc6, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xe4, 0x10, 0xe8, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x26, 0x19, 0x05, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x86, 0x21, 0x17, 0xc6, 0x18, 0xc6, 0x5d, 0xef, 0x1b, 0xe7, 0x1b, 0xe7, 0x38, 0xc6, 0xef, 0x7b, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x4a, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x52, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0xd7, 0xbd, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x45, 0x29, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0x42, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x71, 0x8c, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xe8, 0x39, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x21, 0x66, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xa7, 0x31, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x27, 0x11, 0xe9, 0x31, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x05, 0x21, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xa5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe8, 0x39, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0xc8, 0x31, 0x26, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x47, 0x19, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x6a, 0x4a, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0xc8, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x46, 0x21, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0x6e, 0x6b, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0xe4, 0x18, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xc4, 0x08, 0x31, 0x8c, 0xa7, 0x31, 0xa5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x11, 0x25, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x51, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xde, 0x46, 0x21, 0x05, 0x11, 0x05, 0x11, 0x06, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0xa6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x4e, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x04, 0x19, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xd6, 0xbd, 0xfb, 0xe6, 0xcb, 0x5a, 0xa4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xec, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x25, 0x19, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x46, 0x19, 0x66, 0x19, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xad, 0x06, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x06, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x39, 0x67, 0x21, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x67, 0x19, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x45, 0x21, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xda, 0xde, 0xff, 0xff, 0xde, 0xff, 0x0c, 0x63, 0xa4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xec, 0x5a, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x52, 0x06, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x46, 0x19, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x25, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x19, 0x26, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0xc5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x2c, 0x63, 0xa4, 0x08, 0xa4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0x41, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x21, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x46, 0x19, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x25, 0x19, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x31, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x5a, 0xc5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xba, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x2c, 0x63, 0x84, 0x08, 0xa4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x42, 0x00, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x38, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x8b, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0xc4, 0x10, 0x85, 0x08, 0xa8, 0x31, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xec, 0x5a, 0x4a, 0x42, 0x75, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x6b, 0x8f, 0x73, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x27, 0x11, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x08, 0xab, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xa4, 0x2c, 0x63, 0x8a, 0x52, 0x2d, 0x63, 0x59, 0xce, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5a, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc4, 0x08, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x0c, 0x63, 0x83, 0x08, 0xa4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x10, 0xa8, 0x31, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x86, 0x29, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x99, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x66, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x29, 0xe5, 0x18, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x85, 0x08, 0xa5, 0x00, 0xc6, 0x08, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xc5, 0x08, 0xc6, 0x08, 0xa5, 0x08, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x86, 0x00, 0x86, 0x00, 0xb3, 0x94, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x86, 0x08, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0x87, 0x29, 0xdf, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x49, 0x4a, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc8, 0x39, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x5a, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x6a, 0x4a, 0x83, 0x08, 0xc4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xc5, 0x10, 0x46, 0x21, 0xe5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0xf4, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x73, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x27, 0x19, 0x66, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x79, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x85, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xa5, 0x08, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x10, 0xba, 0xde, 0xff, 0xff, 0xdb, 0xde, 0x86, 0x00, 0x87, 0x08, 0xb3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x85, 0x08, 0x85, 0x00, 0x2a, 0x42, 0x55, 0xad, 0x34, 0xa5, 0x34, 0xa5, 0x75, 0xad, 0xff, 0xff, 0xbe, 0xf7, 0x08, 0x3a, 0xc5, 0x00, 0xc6, 0x00, 0xa5, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa5, 0x08, 0xa4, 0x08, 0x46, 0x29, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x84, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xaa, 0x52, 0xa4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x18, 0x06, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x29, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x95, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x39, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x21, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x85, 0x00, 0x85, 0x00, 0x84, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xa5, 0x08, 0xc6, 0x00, 0xc6, 0x00, 0xa5, 0x00, 0x46, 0x21, 0x9e, 0xf7, 0x7d, 0xef, 0xa6, 0x08, 0x86, 0x08, 0xb3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x85, 0x08, 0x84, 0x00, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0xc5, 0x00, 0xc6, 0x00, 0xa8, 0x29, 0xdb, 0xde, 0xde, 0xff, 0xba, 0xd6, 0xe8, 0x39, 0xa4, 0x00, 0xa4, 0x00, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x4a, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x2d, 0x6b, 0xa4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x09, 0xe5, 0x10, 0xe5, 0x10, 0x26, 0x21, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe5, 0x10, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xe7, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0x47, 0x19, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa5, 0x00, 0x85, 0x00, 0x85, 0x00, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xc6, 0x08, 0xc6, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0x4d, 0x6b, 0x7d, 0xf7, 0xa6, 0x08, 0xa6, 0x08, 0xb2, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x84, 0x08, 0x83, 0x00, 0x5c, 0xef, 0x3c, 0xef, 0x59, 0xce, 0x58, 0xce, 0xff, 0xff, 0xbe, 0xff, 0x45, 0x21, 0xc5, 0x00, 0xe6, 0x00, 0x1b, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x84, 0x00, 0x84, 0x00, 0x46, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x63, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xda, 0xde, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x92, 0x94, 0xe6, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x09, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x19, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xc6, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0x47, 0x19, 0xe9, 0x31, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x08, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xe6, 0x08, 0xe6, 0x00, 0x26, 0x19, 0xc5, 0x10, 0x85, 0x00, 0x84, 0x00, 0x72, 0x8c, 0xa6, 0x08, 0xa6, 0x08, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0x84, 0x08, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xdf, 0xff, 0xfb, 0xe6, 0xc4, 0x08, 0xc5, 0x00, 0xe5, 0x08, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x08, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x63, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x21, 0x47, 0x21, 0x6a, 0x4a, 0xec, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0x08, 0x42, 0xa8, 0x29, 0xe6, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe6, 0x08, 0x05, 0x09, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0xe5, 0x10, 0xcb, 0x5a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x94, 0x87, 0x29, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0xa8, 0x31, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x66, 0x21, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x47, 0x11, 0x47, 0x11, 0x29, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa5, 0x08, 0xa5, 0x00, 0xa5, 0x00, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xe6, 0x08, 0x07, 0x01, 0x8e, 0x73, 0xb6, 0xb5, 0x85, 0x08, 0x84, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0x84, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xe5, 0x10, 0xff, 0xff, 0xfb, 0xde, 0xc4, 0x08, 0xc4, 0x00, 0xe4, 0x08, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x08, 0x9d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc5, 0x00, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x19, 0xc7, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x0c, 0x63, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x51, 0x8c, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x46, 0x11, 0x47, 0x19, 0x67, 0x21, 0x93, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x39, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa5, 0x08, 0xa5, 0x00, 0xa5, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xe6, 0x00, 0x06, 0x01, 0x8e, 0x73, 0xbe, 0xff, 0x4a, 0x4a, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xa4, 0x00, 0x84, 0x00, 0x38, 0xc6, 0x7d, 0xf7, 0x7d, 0xf7, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xc4, 0x00, 0xe4, 0x08, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x96, 0xb5, 0xc5, 0x00, 0xc5, 0x00, 0xc8, 0x31, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0xc5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc4, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xc5, 0x08, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x08, 0xe5, 0x08, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0xe8, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x46, 0x21, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x49, 0x42, 0x99, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x29, 0x3a, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x46, 0x11, 0x46, 0x19, 0x47, 0x19, 0x8b, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3a, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa5, 0x08, 0xa5, 0x00, 0xa5, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x01, 0x06, 0x01, 0x6e, 0x6b, 0xff, 0xff, 0x3c, 0xef, 0xa5, 0x08, 0x84, 0x00, 0x84, 0x00, 0xa5, 0x00, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xa5, 0x00, 0xa4, 0x08, 0x3c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xc4, 0x08, 0xc4, 0x08, 0xe5, 0x08, 0x55, 0xad, 0x75, 0xb5, 0x4d, 0x63, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x21, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5b, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xaf, 0x73, 0x17, 0xc6, 0x79, 0xd6, 0x7d, 0xef, 0xfb, 0xde, 0x79, 0xd6, 0x30, 0x84, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x19, 0x47, 0x19, 0x67, 0x19, 0x6a, 0x3a, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x39, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xe5, 0x00, 0x07, 0x01, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0x84, 0x00, 0x84, 0x00, 0xa5, 0x00, 0xb3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0x85, 0x00, 0xa5, 0x08, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xeb, 0x5a, 0xc4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x06, 0x09, 0x06, 0x01, 0x06, 0x01, 0x27, 0x01, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe6, 0x08, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xe8, 0x31, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x47, 0x19, 0x67, 0x19, 0xc8, 0x21, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa5, 0x08, 0xa5, 0x00, 0xa5, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xe5, 0x00, 0x07, 0x01, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xcb, 0x5a, 0x84, 0x00, 0x85, 0x00, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0x85, 0x08, 0x05, 0x19, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x2d, 0x63, 0xe5, 0x08, 0x06, 0x09, 0x26, 0x01, 0x46, 0x01, 0x29, 0x3a, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xc4, 0x10, 0xc5, 0x10, 0xc4, 0x10, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xc4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe6, 0x08, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x66, 0x21, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x46, 0x19, 0x67, 0x19, 0x87, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x38, 0xce, 0x96, 0xb5, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xd3, 0x9c, 0xb2, 0x94, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x58, 0xce, 0x9a, 0xd6, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x95, 0xb5, 0x58, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xf7, 0xc5, 0x14, 0xa5, 0xba, 0xde, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xde, 0xb3, 0x9c, 0xb2, 0x94, 0xb2, 0x94, 0x75, 0xad, 0xb3, 0x94, 0x51, 0x8c, 0x79, 0xce, 0xef, 0x7b, 0x6e, 0x6b, 0x92, 0x94, 0xb2, 0x94, 0x34, 0xad, 0x34, 0xad, 0x51, 0x8c, 0x72, 0x94, 0xb2, 0x94, 0x92, 0x94, 0xb2, 0x94, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x05, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3a, 0x46, 0x21, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x19, 0x84, 0x00, 0xa6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0xe5, 0x08, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xa6, 0x29, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x19, 0x25, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0xe5, 0x08, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x01, 0x0c, 0x5b, 0x66, 0x21, 0xe5, 0x10, 0xe6, 0x10, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x05, 0x11, 0xe7, 0x39, 0xc6, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3a, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0xe5, 0x08, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xe8, 0x39, 0x87, 0x29, 0xa7, 0x29, 0xc5, 0x08, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x08, 0x46, 0x21, 0x86, 0x31, 0x40, 0x08, 0xa0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3a, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xef, 0xe5, 0x08, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x67, 0x21, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 0xa2, 0x00, 0xa6, 0x29, 0xc3, 0x08, 0x28, 0x42, 0xc7, 0x31, 0x04, 0x19, 0xc7, 0x31, 0x47, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3a, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xde, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x87, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3a, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xde, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x31, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xde, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xf7, 0xde, 0xff, 0xbe, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xff, 0xff, 0xbe, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x31, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x25, 0x19, 0xe5, 0x08, 0xe5, 0x08, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x08, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x45, 0x19, 0x45, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x11, 0x05, 0x09, 0xc5, 0x00, 0x05, 0x11, 0x05, 0x11, 0x05, 0x09, 0xc8, 0x31, 0x17, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x08, 0x3a, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xe5, 0x10, 0xe6, 0x08, 0x06, 0x09, 0x06, 0x09, 0xe6, 0x08, 0xe6, 0x08, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x09, 0x26, 0x09, 0x26, 0x11, 0x26, 0x11, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xe7, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x86, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xa7, 0x31, 0x06, 0x11, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xe7, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x42, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5b, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x06, 0x19, 0xe6, 0x08, 0xe6, 0x10, 0x05, 0x09, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x42, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0xeb, 0x5a, 0x9d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xd6, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x04, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x6a, 0x42, 0x82, 0x00, 0xec, 0x5a, 0xec, 0x62, 0x92, 0x94, 0xb2, 0x94, 0xa7, 0x31, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xc4, 0x10, 0xeb, 0x5a, 0x41, 0x00, 0x45, 0x21, 0x05, 0x19, 0x66, 0x29, 0xc3, 0x08, 0x21, 0x00, 0x41, 0x00, 0x41, 0x00, 0xc7, 0x39, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x45, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x45, 0x19, 0x45, 0x19, 0xc7, 0x29, 0x51, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x4a, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x17, 0xc6, 0x58, 0xce, 0x38, 0xce, 0xf3, 0x9c, 0xf3, 0x9c, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x99, 0xd6, 0x38, 0xc6, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0x9c, 0x58, 0xce, 0x58, 0xce, 0xd6, 0xbd, 0x18, 0xc6, 0x58, 0xce, 0x58, 0xce, 0x18, 0xc6, 0xf3, 0xa4, 0x17, 0xc6, 0xd2, 0x9c, 0xcf, 0x7b, 0x17, 0xc6, 0xd3, 0x9c, 0xd3, 0x9c, 0xd3, 0x9c, 0x10, 0x84, 0xf7, 0xbd, 0xf3, 0x9c, 0x75, 0xb5, 0xcf, 0x7b, 0xab, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x4a, 0xef, 0x83, 0x55, 0xad, 0x14, 0xa5, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x04, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5b, 0xa7, 0x31, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x19, 0x66, 0x19, 0x66, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x21, 0xe8, 0x39, 0xab, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x5a, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x86, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x25, 0x19, 0x46, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x87, 0x29, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x21, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 
-  0x00, 0x00, 0x60, 0x00, 0xa7, 0x29, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0xa8, 0x29, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xe7, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x08, 0x02, 0x41, 0x00, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x09, 0x3a, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x21, 0x00, 0x05, 0x19, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x47, 0x19, 0x46, 0x19, 0x47, 0x19, 0x47, 0x19, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x06, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x5c, 0xef, 0x7d, 0xf7, 0xbe, 0xf7, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x9d, 0xf7, 0xbe, 0xff, 0xbe, 0xff, 0x9d, 0xf7, 0x7d, 0xf7, 0x3c, 0xe7, 0xda, 0xde, 0x3c, 0xe7, 0x3c, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x5c, 0xef, 0x3c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x1c, 0xe7, 0xfb, 0xde, 0xdb, 0xde, 0x1b, 0xe7, 0x3c, 0xe7, 0x3c, 0xef, 0x3c, 0xef, 0x5c, 0xef, 0x1b, 0xe7, 0x1b, 0xe7, 0xda, 0xde, 0xfb, 0xde, 0x7d, 0xef, 0x9d, 0xf7, 0x9e, 0xf7, 0xbe, 0xff, 0xbe, 0xf7, 0x7d, 0xf7, 0x3c, 0xe7, 0x3c, 0xe7, 0xba, 0xd6, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0xc7, 0x39, 0x05, 0x19, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x52, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x6d, 0x6b, 0xe4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xe4, 0x08, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x08, 0xe4, 0x08, 0xe4, 0x08, 0xe4, 0x10, 0xe4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x08, 0xe4, 0x08, 0xe4, 0x08, 0xe4, 0x08, 0xe4, 0x08, 0xe4, 0x10, 0xe4, 0x08, 0xe4, 0x08, 0xe4, 0x08, 0x05, 0x09, 0x05, 0x11, 0x05, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x66, 0x29, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x09, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0x26, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x3c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xde, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x21, 0x00, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0xe8, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x06, 0x19, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xde, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x39, 
-  0x66, 0x29, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x52, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc8, 0x31, 0xe6, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 
-  0xe8, 0x39, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x47, 0x19, 0x67, 0x19, 0xec, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x42, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x67, 0x29, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0x06, 0x11, 0x06, 0x11, 0xe6, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0xe6, 0x10, 0xe6, 0x10, 0xe6, 0x08, 0xe6, 0x08, 0xe6, 0x08, 0xe7, 0x10, 0x07, 0x11, 0x06, 0x09, 0xb6, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 
-  0xa6, 0x31, 0x25, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x67, 0x11, 0x63, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x52, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x1b, 0xe7, 0xfb, 0xe6, 0x1c, 0xe7, 0x5c, 0xef, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 
-  0x00, 0x00, 0x41, 0x00, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x09, 0x3a, 0x25, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x52, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x05, 0x19, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0xec, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc8, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0xe8, 0x39, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0xe8, 0x31, 0x08, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5b, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x2c, 0x5b, 0x0c, 0x5b, 0x62, 0x00, 0x29, 0x3a, 0xa7, 0x29, 0xe8, 0x31, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x46, 0x19, 0xec, 0x52, 0x61, 0x00, 0xe4, 0x08, 0xc2, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x84, 0x46, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0xc8, 0x29, 0xc7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x31, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0x9a, 0xd6, 0x34, 0xa5, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x34, 0xad, 0x34, 0xa5, 0x58, 0xce, 0x96, 0xb5, 0xba, 0xde, 0xda, 0xde, 0xba, 0xde, 0xba, 0xd6, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0x9a, 0xd6, 0x34, 0xa5, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x54, 0xad, 0x54, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x34, 0xad, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xe8, 0x31, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x6a, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x05, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xde, 0x05, 0x19, 0x05, 0x09, 0x06, 0x09, 0x05, 0x09, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe8, 0x39, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x21, 0x25, 0x19, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x87, 0x31, 0x05, 0x11, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0xe5, 0x08, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x86, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x45, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x09, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x45, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x29, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x18, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x5a, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x66, 0x21, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x04, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x87, 0x21, 0x09, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x18, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xcb, 0x5a, 0xe4, 0x10, 0xc4, 0x10, 0xc5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xc5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x10, 0xc5, 0x08, 0xe6, 0x10, 0x06, 0x11, 0xe8, 0x39, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x41, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x87, 0x21, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x05, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0xde, 0xff, 0xde, 0xff, 0x7d, 0xf7, 0xbe, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x41, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x87, 0x21, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x04, 0x19, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x87, 0x21, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x45, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x87, 0x21, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0x05, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xe5, 0x10, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xa7, 0x31, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x67, 0x21, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x31, 0x05, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0x9d, 0xf7, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xf7, 0x9d, 0xf7, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xf7, 0x9d, 0xf7, 0xbe, 0xf7, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x9d, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xde, 0xff, 0x9d, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x46, 0x19, 0xab, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x05, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xcb, 0x5a, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x71, 0x8c, 0x34, 0xad, 0xab, 0x52, 0x2c, 0x63, 0x8a, 0x4a, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0xcb, 0x5a, 0x6a, 0x4a, 0xc7, 0x31, 0xa7, 0x29, 0x87, 0x29, 0x86, 0x29, 0x66, 0x21, 0x46, 0x21, 0x45, 0x21, 0x25, 0x19, 0x25, 0x19, 0x46, 0x21, 0x66, 0x21, 0x66, 0x29, 0x66, 0x29, 0x66, 0x21, 0x66, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x45, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x21, 0x66, 0x21, 0x86, 0x29, 0xa7, 0x31, 0x08, 0x3a, 0xab, 0x52, 0xe8, 0x39, 0x87, 0x29, 0x86, 0x29, 0x66, 0x21, 0x26, 0x19, 0xcb, 0x5a, 0x3c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xc7, 0x31, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x05, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0xc4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x67, 0x21, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x86, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x21, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x05, 0x19, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0x46, 0x21, 0xe4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x09, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x41, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x46, 0x29, 0xe4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x41, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xc4, 0x10, 0xc4, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe6, 0x10, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x6e, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xde, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x52, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x06, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x79, 0xce, 0x34, 0xa5, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x34, 0xad, 0x54, 0xad, 0x54, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x54, 0xad, 0x34, 0xad, 0x34, 0xa5, 0x58, 0xce, 0x34, 0xad, 0x34, 0xa5, 0x34, 0xa5, 0x79, 0xd6, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xde, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x21, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x05, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x05, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x4a, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xfb, 0xe6, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0xba, 0xd6, 0x3c, 0xef, 0xba, 0xde, 0xfb, 0xe6, 0x79, 0xce, 0xfb, 0xde, 0x58, 0xce, 0x58, 0xce, 0x79, 0xce, 0x59, 0xce, 0x18, 0xc6, 0xda, 0xde, 0xba, 0xd6, 0xda, 0xde, 0xfb, 0xde, 0x79, 0xce, 0xfb, 0xe6, 0x1b, 0xe7, 0x1b, 0xe7, 0x5c, 0xef, 0xda, 0xde, 0xfb, 0xde, 0x1b, 0xe7, 0xda, 0xde, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0xba, 0xd6, 0x3c, 0xe7, 0x79, 0xce, 0x79, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x09, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x66, 0x29, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x09, 0x05, 0x09, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x10, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xe5, 0x08, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x63, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x86, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x06, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x25, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x26, 0x11, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x41, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x06, 0x19, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x6b, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x08, 0x05, 0x09, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x09, 0x3a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x25, 0x11, 0x46, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x06, 0x19, 0x06, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0x51, 0x8c, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x08, 0xc4, 0x10, 0xc4, 0x10, 0xc5, 0x10, 0xc5, 0x08, 0xc5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x21, 0x66, 0x21, 0xa7, 0x29, 0xc7, 0x31, 0xc7, 0x31, 0xa7, 0x29, 0xa7, 0x29, 0xa7, 0x29, 0xa7, 0x29, 0x87, 0x29, 0x86, 0x21, 0x66, 0x21, 0x66, 0x21, 0x46, 0x19, 0x26, 0x19, 0x25, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0xae, 0x73, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0xa6, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x42, 0x06, 0x19, 0x06, 0x11, 0x05, 0x11, 0x26, 0x11, 0x25, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xde, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x42, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x4a, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x26, 0x11, 0x25, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xef, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x21, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x29, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x21, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x86, 0x29, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x31, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x21, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x52, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x21, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x21, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xa7, 0x31, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x21, 0xa0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x39, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x17, 0xc6, 0x49, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x49, 0x42, 0x29, 0x42, 0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x28, 0x42, 0x08, 0x42, 0xe8, 0x39, 0xc7, 0x31, 0xe8, 0x39, 0xc7, 0x31, 0x09, 0x42, 0x29, 0x42, 0x29, 0x42, 0xc7, 0x31, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0xa7, 0x29, 0x08, 0x3a, 0x29, 0x42, 0xc7, 0x31, 0xe8, 0x39, 0xc7, 0x31, 0x08, 0x3a, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x29, 0x42, 0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x49, 0x4a, 0x49, 0x42, 0x49, 0x42, 0xd3, 0x9c, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x6a, 0x4a, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x21, 0x20, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xe6, 0x10, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x09, 0x3a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x42, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0xe6, 0x10, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x38, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x46, 0x21, 0xe6, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x67, 0x21, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0xec, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x06, 0x11, 0xe6, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xad, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x46, 0x11, 0x62, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc5, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe6, 0x10, 0xe6, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x05, 0x11, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x4a, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0x47, 0x19, 0x6a, 0x4a, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x26, 0x21, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xcf, 0x73, 0xcf, 0x7b, 0xcf, 0x7b, 0xcf, 0x7b, 0xcf, 0x7b, 0xcf, 0x7b, 0xcf, 0x7b, 0xcf, 0x7b, 0xcf, 0x7b, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x6e, 0x6b, 0x10, 0x84, 0x0c, 0x63, 0x8e, 0x73, 0x8e, 0x73, 0x55, 0xad, 0x4d, 0x6b, 0x8e, 0x73, 0x8e, 0x73, 0xaf, 0x73, 0xf7, 0xbd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xef, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0x47, 0x11, 0xc8, 0x31, 0xe4, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x99, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x6b, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0x47, 0x11, 0x67, 0x19, 0x2a, 0x42, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xcb, 0x5a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x27, 0x11, 0x47, 0x11, 0x47, 0x19, 0x88, 0x19, 0xa6, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x19, 0x8e, 0x73, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc5, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x27, 0x11, 0x47, 0x11, 0x67, 0x11, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x26, 0x21, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x8e, 0x73, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0xcd, 0x42, 0x16, 0x8d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x31, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x21, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x19, 0xcb, 0x5a, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x8e, 0x6b, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x4b, 0x2a, 0x27, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x31, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x21, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x5b, 0x46, 0x29, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x05, 0x19, 0x45, 0x21, 0x34, 0xa5, 0x9d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x38, 0xc6, 0x66, 0x21, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x47, 0x11, 0x6b, 0x3a, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x31, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x21, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x26, 0x19, 0x06, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x8e, 0x73, 0x59, 0xce, 0x18, 0xc6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0x1b, 0xe7, 0x9d, 0xf7, 0x7d, 0xef, 0xfb, 0xe6, 0xfa, 0xe6, 0x1b, 0xe7, 0x37, 0xc6, 0xd9, 0xde, 0xb9, 0xde, 0xb9, 0xd6, 0x37, 0xc6, 0xd6, 0xbd, 0xd6, 0xbd, 0x58, 0xce, 0x99, 0xd6, 0xb9, 0xd6, 0x58, 0xce, 0x3b, 0xe7, 0xfa, 0xe6, 0x5b, 0xef, 0x7c, 0xef, 0x9d, 0xf7, 0xfa, 0xe6, 0xfa, 0xe6, 0x3b, 0xe7, 0x9d, 0xf7, 0x9d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0x7d, 0xef, 0xfb, 0xe6, 0xfb, 0xe6, 0x1b, 0xe7, 0x1b, 0xe7, 0x5c, 0xef, 0x3c, 0xef, 0x1c, 0xe7, 0x1c, 0xe7, 0x7d, 0xef, 0x1b, 0xe7, 0xfb, 0xe6, 0x3c, 0xe7, 0xb6, 0xb5, 0xcf, 0x7b, 0x25, 0x19, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x09, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x0a, 0x32, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x21, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x46, 0x21, 0x05, 0x19, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x09, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x86, 0x29, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x31, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x21, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x31, 0x46, 0x21, 0x06, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x09, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0xe5, 0x08, 0x05, 0x09, 0x05, 0x09, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0xa6, 0x29, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x21, 0xc7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x41, 0x00, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0xa0, 0x10, 0x08, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x21, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x02, 0x86, 0x29, 0x46, 0x21, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0xe6, 0x10, 0xe6, 0x08, 0x80, 0x10, 0x20, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0xec, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x52, 0x21, 0x00, 0x46, 0x21, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x25, 0x11, 0x25, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x09, 0x05, 0x11, 0x05, 0x11, 0x05, 0x09, 0x05, 0x11, 0xa7, 0x31, 0xed, 0x83, 0xa0, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x00, 0xe8, 0x39, 0x87, 0x29, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0xe5, 0x08, 0x66, 0x21, 0x08, 0x3a, 0xc7, 0x31, 0xcb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0xa7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x49, 0x42, 0x00, 0x08, 0x20, 0x00, 0x01, 0x00, 0xc7, 0x39, 0xc8, 0x39, 0xc9, 0x39, 0x43, 0x00, 0x64, 0x00, 0x65, 0x00, 0x0b, 0x3a, 0x68, 0x21, 0x68, 0x21, 0x68, 0x21, 0x88, 0x29, 0xc9, 0x31, 0x67, 0x31, 0xcc, 0x5a, 0x22, 0x00, 0x47, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x07, 0x11, 0x06, 0x11, 0xe5, 0x08, 0x06, 0x11, 0xa7, 0x31, 0xab, 0x5a, 0x49, 0x4a, 0x41, 0x00, 0x41, 0x00, 0x09, 0x3a, 0x08, 0x3a, 0xe8, 0x31, 0xa3, 0x00, 0xd3, 0x9c, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x52, 0x06, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x03, 0x00, 0xe9, 0x39, 0xe9, 0x39, 0xc9, 0x39, 0x8c, 0x52, 0x23, 0x00, 0x71, 0x8c, 0xe0, 0xff, 0x02, 0x08, 0x67, 0x29, 0x47, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x19, 0x25, 0x19, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x27, 0x11, 0x47, 0x19, 0x67, 0x21, 0x67, 0x21, 0x67, 0x21, 0x68, 0x21, 0x68, 0x19, 0x48, 0x11, 0x07, 0x09, 0xe5, 0x08, 0xc5, 0x08, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xa0, 0x5a, 0xa0, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x67, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x42, 0x00, 0x08, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x02, 0x00, 0x09, 0x3a, 0xc9, 0x31, 0x4b, 0x42, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x31, 0x67, 0x29, 0x67, 0x21, 0x47, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x27, 0x11, 0x48, 0x11, 0x68, 0x19, 0x68, 0x21, 0x88, 0x21, 0x88, 0x21, 0x69, 0x19, 0x69, 0x11, 0x48, 0x11, 0x06, 0x09, 0xc6, 0x08, 0xc7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x65, 0x21, 0x66, 0x29, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x25, 0x19, 0xa7, 0x29, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x05, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x29, 0x46, 0x21, 0xc8, 0x31, 0x2b, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xa0, 0x5a, 0xa0, 0x5a, 0x00, 0x84, 0xa0, 0x5a, 0x00, 0x42, 0x0f, 0x7c, 0x40, 0x00, 0x29, 0x42, 0x09, 0x3a, 0x0a, 0x3a, 0xc8, 0x29, 0xa5, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x67, 0x29, 0x67, 0x21, 0x67, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x09, 0x06, 0x09, 0x26, 0x11, 0x47, 0x19, 0x68, 0x19, 0x68, 0x21, 0x68, 0x21, 0x69, 0x19, 0x69, 0x19, 0x48, 0x11, 0x28, 0x09, 0xe6, 0x08, 0x26, 0x21, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x04, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x67, 0x21, 0x24, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x29, 0x60, 0x29, 0xc0, 0x30, 0x40, 0x29, 0xb2, 0x9c, 0xeb, 0x5a, 0x0c, 0x5b, 0xc7, 0x29, 0x09, 0x2a, 0xe9, 0x29, 0xc8, 0x29, 0xe9, 0x31, 0x0a, 0x32, 0xc5, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x29, 0x87, 0x21, 0x66, 0x21, 0x66, 0x21, 0x66, 0x21, 0x66, 0x21, 0x46, 0x21, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x09, 0xe5, 0x08, 0xe5, 0x08, 0x06, 0x11, 0x27, 0x11, 0x47, 0x19, 0x68, 0x21, 0x68, 0x21, 0x68, 0x19, 0x48, 0x11, 0x48, 0x09, 0x07, 0x09, 0xa5, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xec, 0x5a, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0xcb, 0x5a, 0x40, 0x00, 0x40, 0x00, 0x0c, 0x5b, 0x62, 0x00, 0x09, 0x32, 0xc8, 0x21, 0xa8, 0x21, 0xa8, 0x21, 0xa7, 0x21, 0xa8, 0x21, 0xa8, 0x21, 0x2a, 0x32, 0xd3, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x87, 0x29, 0x66, 0x21, 0x66, 0x21, 0x66, 0x21, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x11, 0x25, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x27, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x11, 0x28, 0x11, 0x27, 0x09, 0xe6, 0x08, 0xc7, 0x39, 0xa0, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xc8, 0x31, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x47, 0x19, 0x67, 0x21, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x0c, 0x5b, 0x69, 0x4a, 0x62, 0x00, 0x82, 0x00, 0x09, 0x3a, 0xc8, 0x29, 0xa8, 0x21, 0x87, 0x19, 0x87, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x82, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x87, 0x21, 0x66, 0x21, 0x66, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x26, 0x11, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x07, 0x09, 0xc8, 0x31, 0xa0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x2c, 0x63, 0xe5, 0x18, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x47, 0x19, 0x47, 0x19, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x10, 0x62, 0x00, 0x29, 0x3a, 0x09, 0x32, 0xe8, 0x31, 0xc8, 0x29, 0x88, 0x21, 0x87, 0x19, 0x67, 0x19, 0x67, 0x19, 0x46, 0x11, 0x46, 0x11, 0x26, 0x11, 0x26, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x39, 0x67, 0x21, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0xe6, 0x10, 0xce, 0x83, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x07, 0x3a, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x46, 0x11, 0x46, 0x19, 0x47, 0x19, 0x47, 0x19, 0xe9, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x5b, 0x09, 0x32, 0xe9, 0x31, 0xc8, 0x29, 0xa8, 0x21, 0xa8, 0x21, 0x67, 0x19, 0x67, 0x19, 0x47, 0x19, 0x46, 0x11, 0x26, 0x11, 0x06, 0x11, 0x05, 0x11, 0xc6, 0x31, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x41, 0x00, 0x67, 0x21, 0x46, 0x19, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x05, 0x11, 0x26, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x06, 0x11, 0x28, 0x4a, 0xa0, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x40, 0x00, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x46, 0x11, 0x46, 0x19, 0x47, 0x19, 0x67, 0x19, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x61, 0x00, 0xc9, 0x29, 0xa8, 0x29, 0xa8, 0x21, 0x88, 0x21, 0x87, 0x21, 0x67, 0x19, 0x67, 0x19, 0x46, 0x19, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0xa6, 0x31, 0xa0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x10, 0x08, 0x3a, 0x46, 0x19, 0x26, 0x19, 0x25, 0x11, 0x26, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x25, 0x19, 0x61, 0x00, 0x20, 0x00, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x11, 0x05, 0x19, 0x25, 0x11, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x40, 0x08, 0x20, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe3, 0x18, 0xe5, 0x10, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x46, 0x11, 0x47, 0x19, 0x47, 0x19, 0x67, 0x19, 0x67, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x73, 0xc8, 0x31, 0x88, 0x21, 0x88, 0x21, 0x88, 0x21, 0x87, 0x21, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x46, 0x11, 0x26, 0x11, 0x05, 0x11, 0xc7, 0x31, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x31, 0x46, 0x21, 0x26, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe4, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x06, 0x11, 0x66, 0x29, 0xb1, 0xa4, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x86, 0x31, 0xe5, 0x10, 0xe5, 0x10, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x47, 0x11, 0x47, 0x19, 0x47, 0x19, 0x68, 0x19, 0xa8, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x08, 0x87, 0x29, 0x87, 0x21, 0x67, 0x21, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x47, 0x19, 0x46, 0x19, 0x66, 0x21, 0x0c, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x25, 0x19, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xc7, 0x39, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x40, 0x08, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0x4c, 0x7b, 0x20, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xec, 0x62, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x11, 0x25, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x47, 0x19, 0x68, 0x19, 0xcc, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x08, 0x67, 0x21, 0x67, 0x21, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0x47, 0x19, 0x47, 0x19, 0xc8, 0x31, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x8c, 0xe7, 0x39, 0x26, 0x11, 0x06, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x66, 0x29, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x46, 0x29, 0x05, 0x19, 0x06, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x2c, 0x6b, 0x60, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4d, 0x6b, 0xc7, 0x39, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x47, 0x19, 0xa8, 0x29, 0xa8, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x66, 0x21, 0x46, 0x19, 0x46, 0x19, 0x46, 0x19, 0x67, 0x19, 0x67, 0x19, 0x67, 0x19, 0xc8, 0x29, 0xa2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18, 0x25, 0x19, 0x06, 0x11, 0x06, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x25, 0x19, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x45, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x21, 0x00, 0x60, 0x51, 0x40, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x41, 0x00, 0x05, 0x19, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x47, 0x19, 0x47, 0x19, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x46, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0x46, 0x19, 0x66, 0x21, 0x41, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x21, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x45, 0x29, 0x05, 0x21, 0xe5, 0x18, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0xc8, 0x29, 0x60, 0x10, 0xb1, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x27, 0x19, 0xe9, 0x31, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x29, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0xa7, 0x29, 0xeb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x26, 0x19, 0x06, 0x11, 0x06, 0x11, 0xe6, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe8, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x85, 0x31, 0x45, 0x29, 0xe4, 0x18, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x47, 0x11, 0x42, 0x00, 0x50, 0x9c, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x25, 0x19, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x25, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x11, 0x25, 0x19, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0xa6, 0x29, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xc6, 0x31, 0x27, 0x11, 0x06, 0x11, 0x06, 0x11, 0xe5, 0x10, 0x41, 0x00, 0x83, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x24, 0x21, 0xe4, 0x10, 0x05, 0x11, 0x06, 0x11, 0xe6, 0x10, 0x06, 0x11, 0x26, 0x11, 0xcc, 0x4a, 0xcb, 0x5a, 0x94, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x42, 0x00, 0x05, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x25, 0x19, 0x65, 0x29, 0x20, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x21, 0x05, 0x19, 0x25, 0x19, 0xe7, 0x31, 0x12, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xc7, 0x31, 0x27, 0x19, 0x06, 0x19, 0x05, 0x19, 0xa6, 0x31, 0xa6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc6, 0x31, 0xe4, 0x10, 0xe5, 0x10, 0xe6, 0x10, 0x06, 0x11, 0x06, 0x11, 0x2b, 0x32, 0x84, 0x00, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x6a, 0x4a, 0xe8, 0x39, 0xa7, 0x31, 0x45, 0x21, 0x04, 0x19, 0xe4, 0x10, 0xe3, 0x10, 0xe3, 0x10, 0x28, 0x42, 0x4c, 0x63, 0x40, 0x00, 0xe4, 0x18, 0x0c, 0x63, 0x00, 0x00, 0x40, 0x08, 0x40, 0x08, 0x40, 0x00, 0xe8, 0x41, 0x40, 0x00, 0x40, 0x00, 0x0c, 0x5b, 0x24, 0x19, 0x24, 0x19, 0x24, 0x19, 0x24, 0x19, 0x24, 0x19, 0x04, 0x11, 0x04, 0x11, 0x04, 0x19, 0x24, 0x19, 0x65, 0x21, 0xa6, 0x29, 0xc7, 0x31, 0x62, 0x00, 0x62, 0x00, 0x31, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x31, 0x25, 0x19, 0x65, 0x29, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x02, 0x87, 0x29, 0x26, 0x19, 0xc7, 0x31, 0x28, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x05, 0x11, 0x46, 0x21, 0x06, 0x11, 0x06, 0x11, 0xc9, 0x21, 0x4b, 0x32, 0xab, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x52, 0x6a, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x41, 0x00, 0xa7, 0x31, 0x6c, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x6b, 0xe8, 0x31, 0x26, 0x19, 0x88, 0x19, 0xa9, 0x21, 0x29, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x83, 0x00, 0x86, 0x21, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x46, 0x10, 0x0e, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2e, 0x49, 0xa6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xa3, 0x75, 0x6e, 0x67, 0x7e, 0x72, 0x72, 0x55, 0x75, 0x76, 0x52, 0x72, 0x72, 0x53, 0x7f, 0x65, 0x6e, 0x74, 0xa3, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x65, 0x67, 0x68, 0x7d, 0x5e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5e, 0x60, 0xe8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xb4, 0x3b, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x6b, 0xc8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x78, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x42, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3b, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x49, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x12, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x0c, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x02, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0e, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x95, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x78, 0xc9, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xca, 0x4e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1a, 0x66, 0x66, 0x57, 0x6b, 0x66, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3d, 0x23, 0x53, 0x26, 0x74, 0x51, 0x4a, 0x54, 0x54, 0x54, 0x54, 0x56, 0x29, 0x56, 0x55, 0x57, 0x54, 0x30, 0x27, 0x25, 0x38, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 
-  0x00, 0x00, 0x00, 0x18, 0x8f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 
-  0x00, 0x00, 0x2b, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0x00, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0x04, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 
-  0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x0f, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x2f, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x53, 0x64, 0x3c, 0x57, 0x8c, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x9c, 0x2e, 0x47, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x09, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x25, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xab, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x85, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x33, 0x31, 0x4c, 0x61, 0x8d, 0x96, 0xa1, 0x5b, 0x57, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xd4, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x7b, 0x8a, 0x6c, 0x72, 0xac, 0x89, 0x65, 0x37, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x84, 0xff, 0xff, 0xef, 0xff, 0x4a, 0x2a, 0x01, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x65, 0x00, 0x00, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x1f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x9e, 0xff, 0xe3, 0xdd, 0x40, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0a, 0x72, 0xdc, 0xea, 0xea, 0xea, 0xea, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xeb, 0xec, 0xbe, 0xee, 0xa7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x03, 0x04, 0x1c, 0x42, 0xc9, 0xff, 0xff, 0xcb, 0x89, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x1b, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x0a, 0x0d, 0x67, 0x2a, 0xa4, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x34, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x8b, 0x67, 0x6c, 0xe3, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x2c, 0x00, 0x00, 0x00, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xf5, 0xca, 0x97, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x02, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x2c, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x9f, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x74, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x03, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x4a, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x23, 0x00, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xaa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x2a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xbe, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0xdd, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x88, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x70, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x34, 0x7a, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd3, 0x4f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xc0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xff, 0xff, 0xfc, 0x8b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7e, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x32, 0x39, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x3c, 0x24, 0x40, 0x53, 0x25, 0x28, 0x28, 0x26, 0x44, 0x1f, 0x1e, 0x46, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x36, 0x28, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xf3, 0x70, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfd, 0xff, 0xdb, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x77, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0xa0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb5, 0xfe, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x49, 0xb7, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0xf5, 0x3f, 0x00, 0x00, 0x5c, 0xd0, 0x00, 0x00, 0x16, 0x00, 0x00, 0x86, 0xf7, 0xad, 0xf4, 0x8c, 0xa7, 0x01, 0x66, 0x01, 0xe9, 0x29, 0x5a, 0xbe, 0x28, 0x00, 0x00, 0x87,
+  0xaa, 0x4a, 0xc3, 0x00, 0x41, 0x00, 0x86, 0x21, 0x45, 0x11, 0x66, 0x19, 0x46, 0x19, 0x02, 0x66, 0x21, 0x02, 0x65, 0x21, 0x85, 0x66, 0x21, 0x86, 0x29, 0xa7, 0x29, 0xc7, 0x31, 0xe7, 0x31, 0x02,
+  0xe8, 0x31, 0x81, 0xc7, 0x31, 0x03, 0x20, 0x00, 0x84, 0x86, 0x29, 0xc3, 0x10, 0xe4, 0x10, 0x20, 0x00, 0x02, 0x49, 0x42, 0x81, 0x20, 0x00, 0x02, 0xc3, 0x08, 0x83, 0x20, 0x00, 0xe7, 0x31, 0xe4,
+  0x18, 0x02, 0x41, 0x00, 0x8c, 0xc7, 0x31, 0x07, 0x32, 0xc7, 0x31, 0x65, 0x21, 0x25, 0x11, 0x04, 0x11, 0xe4, 0x08, 0x61, 0x00, 0x81, 0x00, 0x61, 0x00, 0x41, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x00,
+  0x85, 0xe3, 0x00, 0xcb, 0x4a, 0xa2, 0x00, 0x86, 0x19, 0xe8, 0x29, 0x02, 0x05, 0x09, 0x86, 0xe5, 0x08, 0x46, 0x19, 0xa7, 0x29, 0x49, 0x42, 0x62, 0x00, 0xb4, 0x8c, 0x22, 0x00, 0x00, 0x86, 0xb6,
+  0xad, 0xeb, 0x52, 0xc7, 0x29, 0x66, 0x21, 0xe5, 0x08, 0x05, 0x09, 0x03, 0xe5, 0x08, 0x02, 0xe4, 0x08, 0x02, 0xe5, 0x08, 0x09, 0xe5, 0x10, 0x81, 0x04, 0x11, 0x06, 0xe4, 0x10, 0x81, 0x04, 0x11,
+  0x02, 0x05, 0x11, 0x82, 0x04, 0x11, 0x04, 0x09, 0x02, 0x05, 0x09, 0x81, 0x05, 0x11, 0x02, 0xe5, 0x08, 0x05, 0x05, 0x09, 0x81, 0x05, 0x11, 0x03, 0x05, 0x09, 0x81, 0x04, 0x09, 0x02, 0xe4, 0x08,
+  0x83, 0xe4, 0x10, 0x21, 0x00, 0x66, 0x29, 0x25, 0x00, 0x00, 0x83, 0xa2, 0x00, 0x07, 0x32, 0xa7, 0x29, 0x04, 0x05, 0x09, 0x07, 0x05, 0x11, 0x83, 0xc8, 0x31, 0x64, 0x00, 0x04, 0x00, 0x1e, 0x00,
+  0x00, 0x83, 0x46, 0x01, 0xa3, 0x00, 0x08, 0x32, 0x03, 0x05, 0x09, 0x06, 0xe5, 0x08, 0x07, 0x05, 0x09, 0x10, 0x05, 0x11, 0x07, 0x05, 0x09, 0x02, 0x05, 0x11, 0x08, 0x05, 0x09, 0x03, 0xe5, 0x08,
+  0x81, 0x84, 0x08, 0x02, 0x02, 0x00, 0x22, 0x00, 0x00, 0x82, 0xa6, 0x29, 0x25, 0x11, 0x02, 0x25, 0x09, 0x81, 0x05, 0x11, 0x03, 0x05, 0x09, 0x06, 0x05, 0x11, 0x02, 0x25, 0x11, 0x83, 0x26, 0x19,
+  0x6b, 0x4a, 0x2a, 0x42, 0x1c, 0x00, 0x00, 0x83, 0x82, 0x00, 0xa6, 0x29, 0x25, 0x11, 0x04, 0x05, 0x09, 0x05, 0xe5, 0x08, 0x06, 0x05, 0x09, 0x12, 0x05, 0x11, 0x07, 0x05, 0x09, 0x02, 0x05, 0x11,
+  0x09, 0x05, 0x09, 0x03, 0xe5, 0x08, 0x83, 0xc5, 0x08, 0x46, 0x29, 0x01, 0x00, 0x20, 0x00, 0x00, 0x83, 0x28, 0x42, 0x45, 0x19, 0x25, 0x09, 0x04, 0x05, 0x11, 0x02, 0x05, 0x09, 0x07, 0x05, 0x11,
+  0x85, 0x25, 0x11, 0x26, 0x11, 0x26, 0x19, 0x06, 0x19, 0x51, 0x84, 0x1a, 0x00, 0x00, 0x83, 0x61, 0x00, 0x08, 0x32, 0x25, 0x09, 0x05, 0x05, 0x09, 0x05, 0xe5, 0x08, 0x06, 0x05, 0x09, 0x03, 0xe5,
+  0x10, 0x06, 0x05, 0x11, 0x05, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x02, 0xe5, 0x10, 0x07, 0x05, 0x09, 0x03, 0x05, 0x11, 0x04, 0x05, 0x09, 0x07, 0xe5, 0x08, 0x82, 0xe5, 0x18, 0xa4, 0x10, 0x1e, 0x00,
+  0x00, 0x83, 0x20, 0x00, 0x05, 0x11, 0x25, 0x09, 0x02, 0x05, 0x09, 0x03, 0x05, 0x11, 0x81, 0x05, 0x09, 0x08, 0x05, 0x11, 0x02, 0x25, 0x11, 0x02, 0x26, 0x11, 0x82, 0xc8, 0x29, 0x6e, 0x6b, 0x18,
+  0x00, 0x00, 0x85, 0x61, 0x00, 0x45, 0x19, 0x25, 0x09, 0x06, 0x09, 0x06, 0x11, 0x02, 0x05, 0x11, 0x02, 0x05, 0x09, 0x0b, 0xe5, 0x08, 0x09, 0xe5, 0x10, 0x05, 0xe4, 0x10, 0x06, 0xe5, 0x10, 0x0a,
+  0x05, 0x09, 0x82, 0xe5, 0x08, 0xe5, 0x10, 0x07, 0xe5, 0x08, 0x85, 0xe4, 0x08, 0xe5, 0x08, 0xc4, 0x08, 0x05, 0x19, 0x72, 0x8c, 0x1c, 0x00, 0x00, 0x82, 0xc7, 0x31, 0x25, 0x19, 0x02, 0x05, 0x11,
+  0x81, 0x05, 0x09, 0x0e, 0x05, 0x11, 0x02, 0x25, 0x11, 0x02, 0x26, 0x11, 0x82, 0x47, 0x21, 0x26, 0x21, 0x16, 0x00, 0x00, 0x85, 0x21, 0x00, 0x45, 0x19, 0x25, 0x09, 0x05, 0x09, 0x26, 0x09, 0x02,
+  0x06, 0x09, 0x81, 0x06, 0x11, 0x02, 0x05, 0x11, 0x82, 0xe5, 0x10, 0xe5, 0x08, 0x02, 0xc4, 0x08, 0x02, 0xe4, 0x08, 0x81, 0xe5, 0x10, 0x1d, 0x05, 0x11, 0x03, 0x25, 0x11, 0x81, 0x05, 0x11, 0x03,
+  0xe5, 0x10, 0x07, 0xe5, 0x08, 0x86, 0xe4, 0x00, 0xc4, 0x08, 0xc5, 0x08, 0xc4, 0x08, 0xa7, 0x31, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x82, 0xe8, 0x39, 0x65, 0x21, 0x04, 0x05, 0x11, 0x81, 0x26, 0x11,
+  0x02, 0x25, 0x11, 0x02, 0x05, 0x11, 0x07, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x02, 0x26, 0x11, 0x83, 0x26, 0x19, 0xc8, 0x31, 0x23, 0x00, 0x14, 0x00, 0x00, 0x82, 0x61, 0x00, 0x05, 0x11, 0x02, 0x26,
+  0x09, 0x81, 0x05, 0x09, 0x03, 0x06, 0x09, 0x81, 0x06, 0x11, 0x02, 0x05, 0x11, 0x84, 0x2c, 0x63, 0x79, 0xce, 0xba, 0xd6, 0x9d, 0xf7, 0x25, 0x7d, 0xef, 0x85, 0x3c, 0xe7, 0x25, 0x21, 0xe5, 0x08,
+  0xe4, 0x08, 0xe5, 0x08, 0x04, 0xc5, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xc5, 0x08, 0x02, 0xc4, 0x08, 0x82, 0xc4, 0x10, 0xe8, 0x31, 0x19, 0x00, 0x00, 0x82, 0x21, 0x00, 0x25, 0x11, 0x03, 0x05, 0x11,
+  0x81, 0x25, 0x11, 0x03, 0x26, 0x11, 0x84, 0x66, 0x21, 0xf7, 0xbd, 0x17, 0xc6, 0x5c, 0xef, 0x02, 0xfb, 0xde, 0x82, 0x17, 0xc6, 0xef, 0x7b, 0x03, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x81, 0x25, 0x11,
+  0x02, 0x26, 0x11, 0x82, 0x26, 0x19, 0x29, 0x42, 0x13, 0x00, 0x00, 0x82, 0x08, 0x3a, 0x25, 0x19, 0x02, 0x06, 0x09, 0x81, 0x26, 0x09, 0x03, 0x06, 0x09, 0x84, 0x26, 0x09, 0x05, 0x09, 0xd6, 0xbd,
+  0x7d, 0xef, 0x29, 0xff, 0xff, 0x85, 0x9d, 0xf7, 0x25, 0x21, 0xc5, 0x08, 0xe5, 0x08, 0xe4, 0x08, 0x02, 0xc5, 0x00, 0x02, 0xa5, 0x00, 0x82, 0xc5, 0x00, 0xc4, 0x00, 0x02, 0xc5, 0x08, 0x85, 0xc4,
+  0x08, 0xc4, 0x00, 0xe5, 0x10, 0x21, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x81, 0xeb, 0x5a, 0x04, 0x05, 0x11, 0x81, 0x25, 0x11, 0x03, 0x26, 0x11, 0x82, 0x51, 0x8c, 0x9d, 0xf7, 0x07, 0xff, 0xff,
+  0x82, 0x58, 0xce, 0xc7, 0x31, 0x02, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x82, 0x26, 0x19, 0x25, 0x19, 0x11, 0x00, 0x00, 0x83, 0x21, 0x00, 0x86, 0x29, 0x05, 0x11, 0x02, 0x06, 0x09,
+  0x02, 0x26, 0x09, 0x84, 0x06, 0x11, 0x26, 0x11, 0xc8, 0x31, 0x99, 0xd6, 0x2b, 0xff, 0xff, 0x82, 0xbe, 0xf7, 0x04, 0x19, 0x02, 0xc4, 0x08, 0x02, 0xc4, 0x00, 0x81, 0xa5, 0x00, 0x03, 0xa4, 0x00,
+  0x02, 0xc4, 0x00, 0x02, 0xc5, 0x08, 0x85, 0xc5, 0x00, 0xc5, 0x08, 0xc4, 0x10, 0xc8, 0x31, 0x22, 0x00, 0x14, 0x00, 0x00, 0x82, 0xa3, 0x00, 0xc7, 0x31, 0x04, 0x05, 0x11, 0x84, 0x25, 0x11, 0x26,
+  0x11, 0x46, 0x11, 0xb6, 0xb5, 0x0a, 0xff, 0xff, 0x84, 0x5c, 0xef, 0x69, 0x4a, 0xe4, 0x10, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x26, 0x11, 0xa8, 0x29, 0x11, 0x00, 0x00, 0x84, 0x20,
+  0x00, 0x26, 0x19, 0x05, 0x11, 0x05, 0x09, 0x02, 0x06, 0x09, 0x02, 0x26, 0x11, 0x82, 0x6e, 0x6b, 0xbe, 0xf7, 0x2c, 0xff, 0xff, 0x82, 0x9d, 0xf7, 0xe4, 0x10, 0x02, 0xc4, 0x08, 0x03, 0xc4, 0x00,
+  0x85, 0xa4, 0x00, 0x30, 0x84, 0x87, 0x31, 0xa4, 0x08, 0xa4, 0x00, 0x02, 0xc4, 0x08, 0x02, 0xc5, 0x08, 0x02, 0xc4, 0x08, 0x81, 0x25, 0x19, 0x14, 0x00, 0x00, 0x81, 0x61, 0x00, 0x04, 0x05, 0x11,
+  0x02, 0x25, 0x11, 0x82, 0x26, 0x11, 0x31, 0x84, 0x0c, 0xff, 0xff, 0x83, 0xba, 0xd6, 0x25, 0x19, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x83, 0x25, 0x11, 0x26, 0x19, 0xe5, 0x00, 0x10, 0x00, 0x00, 0x82,
+  0x21, 0x00, 0x06, 0x11, 0x02, 0x05, 0x11, 0x02, 0x06, 0x11, 0x83, 0x26, 0x11, 0x2d, 0x63, 0xde, 0xff, 0x2d, 0xff, 0xff, 0x82, 0x9d, 0xf7, 0xe4, 0x18, 0x02, 0xc4, 0x08, 0x02, 0xc4, 0x00, 0x02,
+  0xa4, 0x00, 0x87, 0xb6, 0xb5, 0xfb, 0xde, 0xcb, 0x5a, 0x84, 0x08, 0xa4, 0x00, 0xa4, 0x08, 0xc4, 0x08, 0x03, 0xc5, 0x08, 0x82, 0xc4, 0x08, 0xcb, 0x52, 0x13, 0x00, 0x00, 0x81, 0x40, 0x00, 0x04,
+  0x05, 0x11, 0x84, 0x25, 0x11, 0x26, 0x11, 0x46, 0x11, 0x9d, 0xf7, 0x0d, 0xff, 0xff, 0x81, 0x34, 0xa5, 0x02, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x05, 0x09, 0x21, 0x00, 0x0f, 0x00,
+  0x00, 0x83, 0xa6, 0x31, 0x46, 0x21, 0x06, 0x11, 0x02, 0x05, 0x11, 0x02, 0x26, 0x11, 0x82, 0x46, 0x11, 0x3c, 0xe7, 0x2e, 0xff, 0xff, 0x82, 0x9d, 0xf7, 0x25, 0x21, 0x02, 0xc4, 0x08, 0x02, 0xc4,
+  0x00, 0x02, 0xa4, 0x00, 0x85, 0xba, 0xd6, 0xff, 0xff, 0xbe, 0xf7, 0x0c, 0x63, 0x84, 0x08, 0x02, 0xa4, 0x00, 0x87, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x08, 0xc4, 0x08, 0xc4, 0x00, 0xcb, 0x52, 0x83,
+  0x00, 0x11, 0x00, 0x00, 0x81, 0xaa, 0x52, 0x04, 0x05, 0x11, 0x83, 0x25, 0x11, 0x26, 0x11, 0xb2, 0x94, 0x0e, 0xff, 0xff, 0x82, 0xba, 0xd6, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x02,
+  0x05, 0x11, 0x0f, 0x00, 0x00, 0x83, 0x04, 0x19, 0x06, 0x11, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x82, 0x26, 0x11, 0xd3, 0x94, 0x30, 0xff, 0xff, 0x81, 0x69, 0x4a, 0x02, 0xc4, 0x08, 0x82, 0xe4, 0x08,
+  0xc4, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x1b, 0xe7, 0x02, 0xff, 0xff, 0x83, 0x9d, 0xf7, 0x0c, 0x63, 0x83, 0x08, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x03, 0xc5, 0x08, 0x83, 0xc4, 0x00, 0x21, 0x00,
+  0x83, 0x00, 0x10, 0x00, 0x00, 0x81, 0x25, 0x19, 0x04, 0x05, 0x11, 0x83, 0x25, 0x11, 0x26, 0x11, 0x17, 0xc6, 0x0e, 0xff, 0xff, 0x81, 0x9d, 0xf7, 0x05, 0x05, 0x11, 0x83, 0x25, 0x11, 0x26, 0x11,
+  0x08, 0x3a, 0x0f, 0x00, 0x00, 0x81, 0x86, 0x29, 0x05, 0x05, 0x11, 0x82, 0x26, 0x11, 0x1b, 0xe7, 0x06, 0xff, 0xff, 0x02, 0x9d, 0xf7, 0x81, 0xde, 0xff, 0x04, 0xff, 0xff, 0x81, 0xde, 0xf7, 0x06,
+  0xff, 0xff, 0x81, 0xde, 0xff, 0x03, 0xff, 0xff, 0x02, 0xde, 0xff, 0x81, 0x9d, 0xf7, 0x02, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x10, 0xff, 0xff, 0x82, 0xcb, 0x52, 0xc5, 0x08, 0x02,
+  0xe4, 0x08, 0x02, 0xc4, 0x00, 0x82, 0xa4, 0x00, 0xba, 0xd6, 0x03, 0xff, 0xff, 0x83, 0x9d, 0xf7, 0x0c, 0x63, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x08, 0x02, 0xc5, 0x08, 0x82, 0xc5, 0x00,
+  0xc4, 0x08, 0x02, 0x21, 0x00, 0x0f, 0x00, 0x00, 0x82, 0x66, 0x29, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x81, 0x38, 0xc6, 0x06, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x08, 0xff, 0xff, 0x81,
+  0x2c, 0x63, 0x02, 0x05, 0x11, 0x82, 0x06, 0x11, 0x05, 0x11, 0x02, 0x06, 0x11, 0x81, 0xc7, 0x31, 0x0f, 0x00, 0x00, 0x81, 0x05, 0x19, 0x05, 0x05, 0x11, 0x81, 0x8a, 0x4a, 0x06, 0xff, 0xff, 0x84,
+  0x7d, 0xef, 0xa4, 0x08, 0x84, 0x00, 0xa8, 0x31, 0x02, 0xff, 0xff, 0x85, 0xbd, 0xf7, 0xcb, 0x5a, 0x2a, 0x42, 0x75, 0xad, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x83, 0x2d, 0x63, 0x6e, 0x6b, 0x58, 0xce,
+  0x02, 0xff, 0xff, 0x84, 0x54, 0xad, 0x06, 0x11, 0xc5, 0x00, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x81, 0xab, 0x52, 0x03, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xf3, 0x9c, 0x0c, 0x63, 0x8a, 0x4a, 0x2c, 0x63,
+  0x58, 0xce, 0xbe, 0xf7, 0x06, 0xff, 0xff, 0x85, 0xcb, 0x5a, 0xc5, 0x08, 0xe4, 0x08, 0xc4, 0x08, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x5c, 0xef, 0x04, 0xff, 0xff, 0x83, 0x9d, 0xf7, 0xeb, 0x5a,
+  0x62, 0x00, 0x02, 0xa4, 0x00, 0x87, 0xc4, 0x00, 0xc5, 0x08, 0xc5, 0x00, 0xe5, 0x08, 0xc4, 0x08, 0xa7, 0x31, 0x21, 0x00, 0x0d, 0x00, 0x00, 0x83, 0x99, 0xce, 0x66, 0x29, 0xe5, 0x10, 0x03, 0x05,
+  0x11, 0x02, 0x25, 0x11, 0x81, 0x79, 0xce, 0x06, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x07, 0xff, 0xff, 0x81, 0xcf, 0x73, 0x04, 0x06, 0x11, 0x02, 0x26, 0x11, 0x81, 0x66, 0x21, 0x0e, 0x00, 0x00, 0x82,
+  0x65, 0x29, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x2d, 0x63, 0x06, 0xff, 0xff, 0x8b, 0x1b, 0xe7, 0x84, 0x00, 0x85, 0x00, 0xa5, 0x08, 0xde, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xc5, 0x08, 0xc5, 0x00,
+  0xa5, 0x00, 0x99, 0xd6, 0x02, 0xff, 0xff, 0x84, 0x9d, 0xf7, 0x65, 0x00, 0x86, 0x00, 0xb2, 0x94, 0x02, 0xff, 0xff, 0x83, 0x10, 0x7c, 0x85, 0x00, 0x86, 0x00, 0x03, 0xa6, 0x00, 0x86, 0xa5, 0x00,
+  0x66, 0x21, 0xde, 0xff, 0xff, 0xff, 0x1b, 0xe7, 0x49, 0x42, 0x02, 0xa4, 0x00, 0x02, 0xa5, 0x00, 0x83, 0xa4, 0x00, 0xa7, 0x31, 0x1b, 0xe7, 0x05, 0xff, 0xff, 0x82, 0xcb, 0x5a, 0xc5, 0x08, 0x02,
+  0xe5, 0x08, 0x81, 0xc4, 0x08, 0x02, 0xc4, 0x00, 0x81, 0x5c, 0xef, 0x05, 0xff, 0xff, 0x83, 0xbe, 0xf7, 0x49, 0x4a, 0x83, 0x08, 0x02, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x81, 0xc5, 0x08, 0x02, 0xc4,
+  0x08, 0x82, 0x45, 0x21, 0xe4, 0x10, 0x0d, 0x00, 0x00, 0x82, 0xc4, 0x10, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x81, 0xf3, 0x9c, 0x0f, 0xff, 0xff, 0x82, 0xae, 0x73, 0x05, 0x11, 0x03,
+  0x06, 0x11, 0x02, 0x26, 0x11, 0x81, 0x45, 0x19, 0x0e, 0x00, 0x00, 0x82, 0x40, 0x00, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x79, 0xce, 0x06, 0xff, 0xff, 0x87, 0x1b, 0xe7, 0x84, 0x00, 0x85, 0x00,
+  0x84, 0x00, 0xde, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x03, 0xa5, 0x00, 0x87, 0xc5, 0x08, 0xba, 0xd6, 0xff, 0xff, 0xda, 0xde, 0x86, 0x00, 0x66, 0x00, 0xb2, 0x94, 0x02, 0xff, 0xff, 0x81, 0x10, 0x84,
+  0x02, 0x65, 0x00, 0x82, 0x09, 0x42, 0x34, 0xa5, 0x02, 0x14, 0xa5, 0x84, 0x55, 0xad, 0xff, 0xff, 0x9d, 0xf7, 0xe8, 0x39, 0x03, 0xa5, 0x00, 0x86, 0x64, 0x00, 0x84, 0x00, 0x85, 0x00, 0x84, 0x00,
+  0x45, 0x21, 0x9d, 0xf7, 0x04, 0xff, 0xff, 0x82, 0x10, 0x84, 0xc5, 0x08, 0x02, 0xe5, 0x08, 0x84, 0xc4, 0x00, 0xc5, 0x08, 0xc4, 0x00, 0x5c, 0xef, 0x06, 0xff, 0xff, 0x84, 0xbe, 0xf7, 0x8a, 0x52,
+  0xa3, 0x08, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x81, 0xc4, 0x00, 0x03, 0xe4, 0x08, 0x82, 0xc5, 0x10, 0xc4, 0x18, 0x0c, 0x00, 0x00, 0x82, 0x46, 0x21, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11,
+  0x05, 0x11, 0x75, 0xad, 0x0e, 0xff, 0xff, 0x84, 0xde, 0xff, 0xe8, 0x31, 0x05, 0x11, 0x06, 0x11, 0x04, 0x26, 0x11, 0x81, 0xa7, 0x29, 0x0e, 0x00, 0x00, 0x82, 0x45, 0x21, 0xe5, 0x10, 0x05, 0x05,
+  0x11, 0x81, 0x34, 0xa5, 0x06, 0xff, 0xff, 0x87, 0x1b, 0xe7, 0x84, 0x00, 0x85, 0x00, 0x84, 0x00, 0xde, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x04, 0xa5, 0x00, 0x83, 0x46, 0x19, 0x9d, 0xf7, 0x5c, 0xef,
+  0x02, 0x86, 0x00, 0x81, 0xb2, 0x94, 0x02, 0xff, 0xff, 0x81, 0x10, 0x84, 0x02, 0x64, 0x00, 0x81, 0x79, 0xce, 0x05, 0xff, 0xff, 0x81, 0x17, 0xc6, 0x02, 0xa5, 0x00, 0x88, 0x88, 0x21, 0xda, 0xde,
+  0xbe, 0xf7, 0x99, 0xd6, 0xc7, 0x31, 0x84, 0x00, 0x83, 0x00, 0x92, 0x8c, 0x04, 0xff, 0xff, 0x82, 0x49, 0x4a, 0xc5, 0x08, 0x02, 0xe5, 0x08, 0x81, 0xe5, 0x00, 0x02, 0xc5, 0x08, 0x81, 0xda, 0xde,
+  0x07, 0xff, 0xff, 0x83, 0xbe, 0xf7, 0x2c, 0x63, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x87, 0xe5, 0x00, 0xe4, 0x00, 0xe4, 0x08, 0xe5, 0x08, 0xe4, 0x10, 0x05, 0x19, 0x41, 0x00, 0x0c, 0x00, 0x00, 0x81,
+  0xe5, 0x10, 0x05, 0x05, 0x11, 0x82, 0xe5, 0x10, 0xbe, 0xf7, 0x0d, 0xff, 0xff, 0x82, 0xfb, 0xde, 0x05, 0x11, 0x03, 0x06, 0x11, 0x03, 0x26, 0x11, 0x81, 0x62, 0x00, 0x0e, 0x00, 0x00, 0x82, 0xc7,
+  0x31, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x06, 0xff, 0xff, 0x91, 0x1b, 0xe7, 0x84, 0x00, 0x85, 0x00, 0x84, 0x00, 0xde, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xa5, 0x00, 0xc5, 0x00, 0xa5,
+  0x00, 0x85, 0x00, 0x84, 0x00, 0x2d, 0x63, 0x7d, 0xef, 0xa6, 0x00, 0x86, 0x00, 0xb2, 0x94, 0x02, 0xff, 0xff, 0x85, 0x0f, 0x7c, 0x64, 0x00, 0x63, 0x00, 0x3c, 0xe7, 0x3b, 0xe7, 0x02, 0x38, 0xc6,
+  0x86, 0xff, 0xff, 0xbd, 0xf7, 0x25, 0x21, 0xc4, 0x00, 0xc5, 0x00, 0xfb, 0xde, 0x03, 0xff, 0xff, 0x81, 0x59, 0xce, 0x02, 0x83, 0x00, 0x81, 0x25, 0x21, 0x04, 0xff, 0xff, 0x81, 0x0c, 0x5b, 0x03,
+  0xe5, 0x08, 0x02, 0xc5, 0x08, 0x82, 0xc4, 0x08, 0xba, 0xd6, 0x03, 0xbe, 0xf7, 0x82, 0xff, 0xff, 0xde, 0xff, 0x03, 0xff, 0xff, 0x84, 0xbe, 0xf7, 0x92, 0x94, 0xc5, 0x00, 0xe5, 0x00, 0x05, 0xe5,
+  0x08, 0x82, 0xe5, 0x10, 0x21, 0x00, 0x0b, 0x00, 0x00, 0x81, 0xa6, 0x31, 0x02, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x96, 0xb5, 0x0d, 0xff, 0xff, 0x81, 0xf7, 0xbd, 0x03, 0x06, 0x11, 0x02, 0x26,
+  0x11, 0x83, 0x46, 0x11, 0xe8, 0x31, 0x63, 0x00, 0x0e, 0x00, 0x00, 0x81, 0xa7, 0x31, 0x02, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x06, 0xff, 0xff, 0x87, 0x1b, 0xe7, 0xa5, 0x00, 0x85,
+  0x00, 0x84, 0x00, 0xde, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x02, 0xc6, 0x00, 0x88, 0x05, 0x19, 0xc5, 0x10, 0x84, 0x00, 0x63, 0x00, 0x71, 0x8c, 0xa5, 0x00, 0x86, 0x00, 0xb2, 0x94, 0x02, 0xff, 0xff,
+  0x84, 0xef, 0x7b, 0x63, 0x00, 0x83, 0x00, 0x84, 0x00, 0x02, 0xa5, 0x00, 0x87, 0x84, 0x00, 0xde, 0xff, 0xfb, 0xde, 0xa3, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x9d, 0xf7, 0x03, 0xff, 0xff, 0x82, 0x9d,
+  0xf7, 0x63, 0x00, 0x02, 0x83, 0x00, 0x81, 0x1c, 0xe7, 0x03, 0xff, 0xff, 0x82, 0xeb, 0x5a, 0xc5, 0x08, 0x02, 0xe5, 0x08, 0x03, 0xc4, 0x08, 0x81, 0x05, 0x11, 0x02, 0x25, 0x19, 0x83, 0x26, 0x19,
+  0x46, 0x21, 0x69, 0x4a, 0x03, 0xeb, 0x5a, 0x84, 0x08, 0x3a, 0x87, 0x29, 0xc5, 0x00, 0xe5, 0x00, 0x05, 0xe5, 0x08, 0x83, 0xe5, 0x10, 0xe4, 0x10, 0xab, 0x52, 0x0a, 0x00, 0x00, 0x83, 0x92, 0x8c,
+  0x86, 0x29, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x82, 0xa7, 0x31, 0x9d, 0xf7, 0x0b, 0xff, 0xff, 0x82, 0x5c, 0xef, 0x46, 0x21, 0x02, 0x06, 0x11, 0x03, 0x26, 0x11, 0x82, 0x46, 0x11,
+  0x09, 0x32, 0x0f, 0x00, 0x00, 0x82, 0xa7, 0x31, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x06, 0xff, 0xff, 0x87, 0x1b, 0xe7, 0xa5, 0x00, 0x85, 0x00, 0x84, 0x00, 0xde, 0xff, 0xff, 0xff,
+  0x5c, 0xef, 0x02, 0xe6, 0x00, 0x88, 0x8e, 0x73, 0xb6, 0xb5, 0x64, 0x00, 0x84, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xb2, 0x94, 0x02, 0xff, 0xff, 0x81, 0xcf, 0x7b, 0x02, 0x84, 0x00, 0x02,
+  0xa4, 0x00, 0x85, 0x84, 0x00, 0xe5, 0x08, 0xde, 0xff, 0xfa, 0xde, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x81, 0xbe, 0xf7, 0x03, 0xff, 0xff, 0x81, 0x3c, 0xe7, 0x02, 0x84, 0x00, 0x82, 0x83, 0x00, 0x7d,
+  0xef, 0x03, 0xff, 0xff, 0x81, 0x8a, 0x4a, 0x02, 0xc4, 0x08, 0x04, 0xe4, 0x08, 0x81, 0xc4, 0x08, 0x0a, 0xc4, 0x00, 0x82, 0xc5, 0x00, 0xe5, 0x00, 0x03, 0xe5, 0x08, 0x03, 0x05, 0x09, 0x83, 0x05,
+  0x11, 0xe4, 0x18, 0x86, 0x29, 0x0a, 0x00, 0x00, 0x82, 0x21, 0x00, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82, 0xec, 0x5a, 0x9d, 0xf7, 0x09, 0xff, 0xff, 0x84, 0xbd, 0xf7, 0x50, 0x84,
+  0x26, 0x11, 0x26, 0x09, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x67, 0x19, 0x92, 0x84, 0x0f, 0x00, 0x00, 0x81, 0xc7, 0x31, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x06, 0xff, 0xff, 0x8c, 0x1b, 0xe7,
+  0xa5, 0x00, 0x85, 0x00, 0x84, 0x00, 0xde, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xe5, 0x00, 0xe6, 0x00, 0x8e, 0x6b, 0xbe, 0xf7, 0x29, 0x42, 0x02, 0x83, 0x00, 0x83, 0x84, 0x00, 0xa5, 0x00, 0xb2, 0x94,
+  0x02, 0xff, 0xff, 0x81, 0xcf, 0x7b, 0x02, 0x84, 0x00, 0x81, 0x17, 0xc6, 0x02, 0x7d, 0xef, 0x84, 0x9d, 0xf7, 0xff, 0xff, 0xde, 0xff, 0x05, 0x19, 0x02, 0xc4, 0x00, 0x81, 0xd6, 0xbd, 0x02, 0xff,
+  0xff, 0x82, 0xde, 0xff, 0x95, 0xb5, 0x02, 0xa5, 0x00, 0x82, 0xc7, 0x31, 0xde, 0xff, 0x03, 0xff, 0xff, 0x83, 0x4d, 0x63, 0xc4, 0x10, 0xc4, 0x08, 0x03, 0xe4, 0x08, 0x05, 0xc4, 0x08, 0x07, 0xc4,
+  0x00, 0x82, 0xc5, 0x00, 0xe5, 0x00, 0x03, 0xe5, 0x08, 0x04, 0x05, 0x09, 0x82, 0xe5, 0x10, 0xc7, 0x31, 0x0a, 0x00, 0x00, 0x82, 0x21, 0x00, 0x25, 0x19, 0x02, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x82,
+  0x29, 0x42, 0x79, 0xce, 0x07, 0xff, 0xff, 0x83, 0x99, 0xd6, 0x08, 0x3a, 0x25, 0x11, 0x05, 0x26, 0x11, 0x82, 0x46, 0x11, 0x6b, 0x42, 0x10, 0x00, 0x00, 0x81, 0x08, 0x3a, 0x05, 0x05, 0x11, 0x82,
+  0x06, 0x11, 0x54, 0xad, 0x06, 0xff, 0xff, 0x91, 0x1b, 0xe7, 0xa5, 0x00, 0x85, 0x00, 0x84, 0x00, 0xde, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xe5, 0x00, 0xe6, 0x00, 0x4d, 0x6b, 0xff, 0xff, 0x3c, 0xe7,
+  0xa4, 0x00, 0x83, 0x00, 0x84, 0x00, 0x85, 0x00, 0xb2, 0x94, 0x02, 0xff, 0xff, 0x81, 0xcf, 0x7b, 0x02, 0x84, 0x00, 0x81, 0x3c, 0xe7, 0x05, 0xff, 0xff, 0x88, 0xf3, 0x9c, 0xa4, 0x00, 0xc4, 0x00,
+  0xe4, 0x08, 0x54, 0xa5, 0x75, 0xad, 0x2d, 0x63, 0xc5, 0x00, 0x02, 0xc6, 0x00, 0x81, 0xdb, 0xde, 0x04, 0xff, 0xff, 0x83, 0x75, 0xad, 0xc4, 0x10, 0xc4, 0x08, 0x02, 0xe4, 0x08, 0x07, 0xc4, 0x08,
+  0x06, 0xc4, 0x00, 0x82, 0xc5, 0x00, 0xe5, 0x00, 0x03, 0xe5, 0x08, 0x04, 0x05, 0x09, 0x82, 0x05, 0x11, 0x21, 0x00, 0x0b, 0x00, 0x00, 0x82, 0xeb, 0x52, 0xe4, 0x08, 0x02, 0xe5, 0x10, 0x03, 0x05,
+  0x11, 0x8c, 0x05, 0x09, 0x05, 0x11, 0xe5, 0x08, 0xae, 0x73, 0xf7, 0xbd, 0x79, 0xce, 0x5c, 0xef, 0xda, 0xde, 0x79, 0xce, 0x30, 0x84, 0x05, 0x09, 0x26, 0x09, 0x04, 0x26, 0x11, 0x02, 0x46, 0x11,
+  0x82, 0x4a, 0x3a, 0xc5, 0x00, 0x10, 0x00, 0x00, 0x81, 0xe7, 0x31, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xad, 0x06, 0xff, 0xff, 0x8a, 0x1b, 0xe7, 0xa5, 0x00, 0x85, 0x00, 0x84, 0x00, 0xde,
+  0xff, 0xff, 0xff, 0x9d, 0xf7, 0xe5, 0x00, 0xe6, 0x00, 0x6d, 0x6b, 0x02, 0xff, 0xff, 0x85, 0xd7, 0xbd, 0x63, 0x00, 0x83, 0x00, 0x84, 0x00, 0xb2, 0x94, 0x02, 0xff, 0xff, 0x84, 0xcf, 0x7b, 0x84,
+  0x00, 0xa4, 0x08, 0x7d, 0xef, 0x05, 0xff, 0xff, 0x84, 0xde, 0xff, 0xcb, 0x5a, 0xa3, 0x08, 0xc4, 0x08, 0x03, 0xe5, 0x00, 0x84, 0xe6, 0x00, 0x07, 0x01, 0x75, 0xad, 0xfe, 0xff, 0x04, 0xff, 0xff,
+  0x83, 0xde, 0xff, 0x96, 0xb5, 0xc4, 0x10, 0x0b, 0xc4, 0x08, 0x04, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x03, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x84, 0x05, 0x11, 0x05, 0x09, 0x05, 0x11, 0x04, 0x19, 0x0b,
+  0x00, 0x00, 0x83, 0x61, 0x00, 0xc8, 0x31, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x03, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x03, 0xe5, 0x08, 0x83, 0xe4, 0x08, 0x04, 0x09, 0x05, 0x11, 0x02, 0x25, 0x09, 0x81,
+  0x06, 0x11, 0x04, 0x26, 0x11, 0x83, 0x46, 0x11, 0xc8, 0x19, 0x05, 0x01, 0x11, 0x00, 0x00, 0x81, 0xa7, 0x29, 0x04, 0x05, 0x11, 0x02, 0x06, 0x11, 0x81, 0x54, 0xad, 0x06, 0xff, 0xff, 0x8a, 0x1b,
+  0xe7, 0xa4, 0x00, 0x85, 0x00, 0x84, 0x00, 0xde, 0xff, 0xff, 0xff, 0x5c, 0xef, 0xe5, 0x00, 0xe6, 0x00, 0x8e, 0x6b, 0x02, 0xff, 0xff, 0x85, 0x9d, 0xf7, 0xab, 0x52, 0x63, 0x00, 0x84, 0x00, 0xd3,
+  0x94, 0x02, 0xff, 0xff, 0x84, 0xcf, 0x7b, 0x84, 0x00, 0xe5, 0x18, 0xbe, 0xf7, 0x06, 0xff, 0xff, 0x88, 0x9d, 0xf7, 0x2c, 0x63, 0xc4, 0x08, 0xe5, 0x00, 0x26, 0x01, 0x46, 0x01, 0x08, 0x32, 0xda,
+  0xde, 0x07, 0xff, 0xff, 0x82, 0xde, 0xff, 0xcf, 0x73, 0x02, 0xc4, 0x08, 0x81, 0xa4, 0x08, 0x08, 0xc4, 0x08, 0x04, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x03, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x03, 0x05,
+  0x11, 0x81, 0xe4, 0x10, 0x0c, 0x00, 0x00, 0x84, 0x6a, 0x42, 0x46, 0x19, 0xe5, 0x08, 0xe5, 0x10, 0x03, 0xe5, 0x08, 0x05, 0x05, 0x09, 0x81, 0xe5, 0x08, 0x04, 0x05, 0x09, 0x81, 0x05, 0x11, 0x04,
+  0x26, 0x11, 0x82, 0x67, 0x19, 0x87, 0x21, 0x12, 0x00, 0x00, 0x81, 0x41, 0x00, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xa5, 0x06, 0xff, 0xff, 0x8a, 0x9d, 0xf7, 0x38, 0xc6, 0x95, 0xad, 0x17,
+  0xc6, 0xfe, 0xff, 0xff, 0xff, 0xde, 0xff, 0xd2, 0x94, 0x92, 0x94, 0x55, 0xad, 0x03, 0xff, 0xff, 0x84, 0x5c, 0xef, 0x38, 0xc6, 0x99, 0xd6, 0x3c, 0xe7, 0x02, 0xff, 0xff, 0x83, 0xd6, 0xbd, 0x75,
+  0xad, 0x38, 0xc6, 0x08, 0xff, 0xff, 0x86, 0xfe, 0xff, 0x58, 0xce, 0xf7, 0xbd, 0x13, 0x9d, 0xba, 0xd6, 0xbe, 0xf7, 0x0a, 0xff, 0xff, 0x82, 0xba, 0xd6, 0xb2, 0x94, 0x02, 0x92, 0x94, 0x88, 0x54,
+  0xad, 0xb2, 0x94, 0x30, 0x84, 0x58, 0xce, 0xcf, 0x73, 0x6d, 0x6b, 0x71, 0x8c, 0x92, 0x94, 0x02, 0x34, 0xa5, 0x82, 0x50, 0x84, 0x71, 0x8c, 0x03, 0x92, 0x94, 0x81, 0xe5, 0x08, 0x02, 0x05, 0x09,
+  0x04, 0x05, 0x11, 0x0d, 0x00, 0x00, 0x83, 0xe7, 0x31, 0x25, 0x19, 0xe5, 0x10, 0x05, 0xe5, 0x08, 0x03, 0x05, 0x09, 0x81, 0xe5, 0x08, 0x04, 0x05, 0x09, 0x81, 0x05, 0x11, 0x03, 0x26, 0x11, 0x83,
+  0x46, 0x19, 0x63, 0x00, 0x84, 0x00, 0x12, 0x00, 0x00, 0x81, 0x41, 0x00, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x82, 0x7c, 0xef, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x04,
+  0x05, 0x11, 0x0e, 0x00, 0x00, 0x83, 0x81, 0x00, 0x86, 0x21, 0xc4, 0x08, 0x04, 0xe5, 0x08, 0x82, 0x05, 0x09, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x81, 0xe5, 0x08, 0x04, 0x05, 0x09, 0x84, 0x05, 0x11,
+  0x06, 0x11, 0x05, 0x11, 0x04, 0x19, 0x14, 0x00, 0x00, 0x81, 0x86, 0x29, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x82, 0x7d, 0xef, 0xe5, 0x08, 0x04, 0x05, 0x11, 0x82,
+  0x06, 0x11, 0x26, 0x19, 0x0f, 0x00, 0x00, 0x83, 0x82, 0x00, 0xeb, 0x52, 0x66, 0x21, 0x05, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x81, 0xe5, 0x08, 0x04, 0x05, 0x09, 0x83, 0xe5, 0x08, 0xc7, 0x31, 0xa6,
+  0x31, 0x15, 0x00, 0x00, 0x82, 0xe7, 0x31, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x82, 0x7d, 0xef, 0xc5, 0x08, 0x05, 0x05, 0x11, 0x81, 0x46, 0x19, 0x11,
+  0x00, 0x00, 0x85, 0x61, 0x00, 0xe7, 0x31, 0x86, 0x29, 0x87, 0x29, 0xc4, 0x08, 0x02, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x02, 0xe5, 0x10, 0x85, 0xc5, 0x08, 0x45, 0x19, 0x86, 0x29, 0x20, 0x00, 0x40,
+  0x08, 0x16, 0x00, 0x00, 0x82, 0xe7, 0x31, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x05, 0x09, 0x05, 0x11, 0x66,
+  0x19, 0x14, 0x00, 0x00, 0x89, 0x42, 0x00, 0x81, 0x00, 0x85, 0x21, 0xa3, 0x08, 0x08, 0x42, 0xa6, 0x31, 0xe4, 0x10, 0xa6, 0x31, 0xc6, 0x31, 0x19, 0x00, 0x00, 0x82, 0xe7, 0x31, 0xe5, 0x10, 0x05,
+  0x05, 0x11, 0x81, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x88, 0xba, 0xd6, 0xe5, 0x08, 0x05, 0x11, 0x05, 0x09, 0x05, 0x11, 0x05, 0x09, 0x25, 0x11, 0x86, 0x21, 0x36, 0x00, 0x00, 0x82, 0xe7, 0x39, 0xe5,
+  0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x84, 0xba, 0xd6, 0xe5, 0x08, 0x05, 0x11, 0x05, 0x09, 0x02, 0x05, 0x11, 0x82, 0x26, 0x11, 0xa7, 0x29, 0x36, 0x00, 0x00, 0x82, 0x86,
+  0x29, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x09, 0xff, 0xff, 0x02, 0x9d, 0xf7, 0x04, 0xde, 0xff, 0x03, 0x9d, 0xf7, 0x82, 0xde, 0xff, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x03, 0xfe, 0xff,
+  0x82, 0xde, 0xff, 0x9d, 0xf7, 0x02, 0xde, 0xff, 0x0b, 0x9d, 0xf7, 0x02, 0xbe, 0xf7, 0x81, 0x9d, 0xf7, 0x02, 0xbe, 0xf7, 0x07, 0x9d, 0xf7, 0x82, 0xbe, 0xf7, 0xde, 0xff, 0x02, 0x9d, 0xf7, 0x82,
+  0xde, 0xff, 0x9d, 0xf7, 0x04, 0xde, 0xff, 0x08, 0xff, 0xff, 0x82, 0x99, 0xd6, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x26, 0x11, 0xc8, 0x31, 0x36, 0x00, 0x00, 0x82, 0x41, 0x00, 0xe5,
+  0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x08, 0xff, 0xff, 0x83, 0x99, 0xd6, 0x05, 0x11, 0xc4, 0x08, 0x03, 0xc4, 0x00, 0x02, 0xe5, 0x08, 0x03, 0xe4, 0x08, 0x81, 0xc4, 0x08, 0x02, 0xe4, 0x08,
+  0x81, 0xc4, 0x08, 0x02, 0xa4, 0x00, 0x83, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0x02, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x83, 0x05, 0x11, 0x04, 0x11, 0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11,
+  0x81, 0x25, 0x11, 0x05, 0x25, 0x19, 0x03, 0x25, 0x11, 0x82, 0x05, 0x11, 0x05, 0x09, 0x02, 0xe5, 0x08, 0x81, 0xe4, 0x08, 0x03, 0xe5, 0x08, 0x86, 0xc4, 0x00, 0xe5, 0x08, 0xe4, 0x08, 0xe5, 0x08,
+  0xc7, 0x29, 0xf7, 0xbd, 0x07, 0xff, 0xff, 0x82, 0xba, 0xd6, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x81, 0xe8, 0x39, 0x36, 0x00, 0x00, 0x82, 0x41, 0x00, 0xe5, 0x10, 0x05, 0x05, 0x11,
+  0x81, 0x54, 0xa5, 0x07, 0xff, 0xff, 0x82, 0x75, 0xad, 0xc4, 0x08, 0x06, 0xe5, 0x08, 0x07, 0x05, 0x09, 0x08, 0xe5, 0x08, 0x05, 0x05, 0x09, 0x04, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x08, 0x05, 0x11,
+  0x0e, 0x05, 0x09, 0x82, 0x25, 0x11, 0xda, 0xd6, 0x06, 0xff, 0xff, 0x82, 0xfb, 0xde, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x81, 0x86, 0x29, 0x36, 0x00, 0x00, 0x81, 0x41, 0x00, 0x06,
+  0x05, 0x11, 0x81, 0x54, 0xa5, 0x06, 0xff, 0xff, 0x82, 0xbe, 0xf7, 0x87, 0x29, 0x08, 0xe5, 0x08, 0x1d, 0x05, 0x09, 0x08, 0x05, 0x11, 0x09, 0x05, 0x09, 0x82, 0x25, 0x09, 0xd3, 0x9c, 0x06, 0xff,
+  0xff, 0x82, 0xfb, 0xde, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x81, 0x21, 0x00, 0x36, 0x00, 0x00, 0x81, 0xeb, 0x52, 0x02, 0x05, 0x11, 0x02, 0x06, 0x11, 0x02, 0x05, 0x11, 0x81, 0x54,
+  0xa5, 0x06, 0xff, 0xff, 0x82, 0x9d, 0xf7, 0x06, 0x11, 0x21, 0xe5, 0x08, 0x05, 0x05, 0x11, 0x04, 0xe5, 0x10, 0x02, 0x05, 0x09, 0x09, 0xe5, 0x08, 0x83, 0x05, 0x11, 0x05, 0x09, 0x54, 0xa5, 0x06,
+  0xff, 0xff, 0x82, 0x59, 0xce, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x81, 0x21, 0x00, 0x36, 0x00, 0x00, 0x84, 0x65, 0x21, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x02, 0x06, 0x11, 0x82,
+  0x05, 0x11, 0x54, 0xad, 0x07, 0xff, 0xff, 0x81, 0xb6, 0xb5, 0x04, 0xe5, 0x08, 0x81, 0xc5, 0x08, 0x03, 0xe5, 0x08, 0x81, 0xc5, 0x08, 0x1b, 0xe5, 0x08, 0x06, 0xe5, 0x10, 0x0c, 0xe5, 0x08, 0x82,
+  0xcb, 0x52, 0x9d, 0xef, 0x06, 0xff, 0xff, 0x82, 0x79, 0xce, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x05, 0x11, 0xe3, 0x18, 0x05, 0x00, 0x00, 0x83, 0xd3, 0x8c, 0x49, 0x3a, 0x41, 0x00,
+  0x02, 0xcb, 0x5a, 0x02, 0x92, 0x94, 0x82, 0x86, 0x31, 0xc3, 0x08, 0x02, 0xc4, 0x08, 0x87, 0xc3, 0x08, 0xcb, 0x52, 0x20, 0x00, 0x25, 0x21, 0xe4, 0x10, 0x45, 0x21, 0xa3, 0x08, 0x03, 0x20, 0x00,
+  0x82, 0xa6, 0x31, 0xe4, 0x10, 0x06, 0x04, 0x11, 0x83, 0x04, 0x19, 0x25, 0x11, 0x24, 0x11, 0x03, 0x04, 0x11, 0x02, 0x25, 0x19, 0x82, 0xa7, 0x29, 0x10, 0x7c, 0x0a, 0x00, 0x00, 0x81, 0x49, 0x42,
+  0x04, 0x05, 0x11, 0x83, 0x06, 0x11, 0x05, 0x11, 0x54, 0xad, 0x08, 0xff, 0xff, 0x82, 0x58, 0xc6, 0xf7, 0xbd, 0x02, 0x38, 0xc6, 0x02, 0xd3, 0x9c, 0x04, 0x99, 0xd6, 0x82, 0x79, 0xce, 0x17, 0xc6,
+  0x0e, 0xf3, 0x9c, 0x95, 0xd2, 0x9c, 0x38, 0xc6, 0x58, 0xc6, 0xd6, 0xb5, 0x17, 0xc6, 0x58, 0xc6, 0x38, 0xc6, 0x17, 0xc6, 0xf3, 0x9c, 0xf7, 0xbd, 0xb2, 0x94, 0xce, 0x7b, 0xf7, 0xbd, 0xd2, 0x9c,
+  0xd2, 0x94, 0xd2, 0x9c, 0xef, 0x7b, 0xd6, 0xbd, 0xf3, 0x9c, 0x75, 0xad, 0xae, 0x73, 0x03, 0x8a, 0x4a, 0x85, 0x6a, 0x4a, 0xef, 0x7b, 0x54, 0xa5, 0xf3, 0x9c, 0x7d, 0xef, 0x07, 0xff, 0xff, 0x81,
+  0x99, 0xd6, 0x02, 0x05, 0x11, 0x85, 0x05, 0x09, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0xe3, 0x18, 0x03, 0x00, 0x00, 0x84, 0xcb, 0x52, 0xa7, 0x29, 0x05, 0x09, 0x25, 0x09, 0x0b, 0x25, 0x11, 0x02,
+  0x25, 0x19, 0x82, 0x26, 0x11, 0x25, 0x19, 0x16, 0x46, 0x19, 0x82, 0xe8, 0x31, 0x8a, 0x4a, 0x08, 0x00, 0x00, 0x81, 0xeb, 0x52, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x81, 0xba,
+  0xd6, 0x02, 0x05, 0x11, 0x85, 0x05, 0x09, 0x05, 0x11, 0x25, 0x11, 0x05, 0x11, 0x66, 0x29, 0x02, 0x00, 0x00, 0x83, 0x61, 0x00, 0x25, 0x11, 0x26, 0x11, 0x04, 0x25, 0x11, 0x82, 0x26, 0x11, 0x25,
+  0x11, 0x08, 0x26, 0x11, 0x84, 0x25, 0x11, 0x26, 0x11, 0x25, 0x11, 0x25, 0x19, 0x03, 0x26, 0x19, 0x0a, 0x46, 0x19, 0x02, 0x46, 0x11, 0x82, 0x46, 0x19, 0x26, 0x19, 0x02, 0x46, 0x19, 0x81, 0x46,
+  0x11, 0x02, 0x46, 0x19, 0x82, 0x67, 0x21, 0x23, 0x00, 0x07, 0x00, 0x00, 0x81, 0x25, 0x21, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0xda, 0xde, 0x05, 0x09, 0x03, 0x05, 0x11,
+  0x87, 0x25, 0x11, 0x05, 0x11, 0xa7, 0x31, 0x00, 0x00, 0x40, 0x00, 0x86, 0x29, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x25, 0x11, 0x0b, 0x26, 0x11, 0x81, 0x26, 0x19, 0x07, 0x25, 0x19, 0x81, 0x26,
+  0x19, 0x08, 0x46, 0x19, 0x84, 0x26, 0x19, 0x46, 0x19, 0x46, 0x11, 0x26, 0x11, 0x02, 0x26, 0x19, 0x02, 0x26, 0x11, 0x02, 0x26, 0x19, 0x83, 0x46, 0x19, 0x87, 0x29, 0x22, 0x00, 0x06, 0x00, 0x00,
+  0x81, 0x62, 0x00, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0xfb, 0xde, 0x05, 0x09, 0x03, 0x05, 0x11, 0x83, 0x26, 0x11, 0x06, 0x11, 0xc7, 0x31, 0x02, 0x41, 0x00, 0x06, 0x25,
+  0x11, 0x08, 0x26, 0x11, 0x03, 0x25, 0x11, 0x12, 0x25, 0x19, 0x02, 0x25, 0x11, 0x02, 0x26, 0x19, 0x02, 0x26, 0x11, 0x02, 0x26, 0x19, 0x84, 0x46, 0x11, 0x46, 0x19, 0xe8, 0x31, 0x22, 0x00, 0x05,
+  0x00, 0x00, 0x81, 0x82, 0x00, 0x02, 0x06, 0x11, 0x04, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0x1b, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x85, 0x26, 0x11, 0x06, 0x09, 0xe8, 0x39,
+  0x00, 0x00, 0xe5, 0x10, 0x07, 0x05, 0x11, 0x20, 0x25, 0x11, 0x05, 0x26, 0x11, 0x83, 0x46, 0x19, 0x26, 0x11, 0x21, 0x00, 0x05, 0x00, 0x00, 0x82, 0x62, 0x00, 0x06, 0x11, 0x05, 0x05, 0x11, 0x81,
+  0x54, 0xad, 0x09, 0xff, 0xff, 0x84, 0x99, 0xd6, 0x3c, 0xe7, 0x7d, 0xef, 0x9d, 0xf7, 0x03, 0xbe, 0xf7, 0x02, 0xbd, 0xf7, 0x81, 0x9d, 0xf7, 0x02, 0xbe, 0xf7, 0x85, 0x9d, 0xf7, 0x7d, 0xef, 0x1b,
+  0xe7, 0xba, 0xd6, 0x1b, 0xe7, 0x0c, 0x3c, 0xe7, 0x02, 0x3b, 0xe7, 0x81, 0x1b, 0xe7, 0x02, 0xda, 0xde, 0x83, 0xfb, 0xde, 0x1b, 0xe7, 0x3b, 0xe7, 0x02, 0x3c, 0xe7, 0x02, 0xfb, 0xde, 0x88, 0xba,
+  0xd6, 0xda, 0xde, 0x5c, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0xbe, 0xf7, 0x9d, 0xf7, 0x7c, 0xef, 0x02, 0x1b, 0xe7, 0x82, 0x99, 0xd6, 0x3c, 0xe7, 0x08, 0xff, 0xff, 0x82, 0x99, 0xce, 0xe5, 0x08, 0x03,
+  0x05, 0x11, 0x85, 0x26, 0x11, 0x05, 0x11, 0xe7, 0x39, 0xa6, 0x31, 0xe5, 0x10, 0x07, 0x05, 0x11, 0x21, 0x25, 0x11, 0x04, 0x26, 0x11, 0x83, 0x46, 0x11, 0x47, 0x11, 0x42, 0x00, 0x05, 0x00, 0x00,
+  0x82, 0xcb, 0x52, 0x06, 0x11, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x07, 0xff, 0xff, 0x82, 0x7d, 0xef, 0x4d, 0x6b, 0x02, 0xc4, 0x08, 0x83, 0xa4, 0x00, 0xa3, 0x00, 0xc4, 0x08, 0x02, 0xe4, 0x08,
+  0x03, 0xc4, 0x08, 0x81, 0xe4, 0x08, 0x12, 0xc4, 0x08, 0x81, 0xc3, 0x08, 0x03, 0xc4, 0x08, 0x04, 0xe4, 0x08, 0x82, 0xc4, 0x08, 0xc3, 0x08, 0x03, 0xc4, 0x08, 0x02, 0xc3, 0x08, 0x05, 0xc4, 0x08,
+  0x02, 0xe4, 0x08, 0x83, 0x04, 0x09, 0xe4, 0x08, 0x75, 0xad, 0x07, 0xff, 0xff, 0x82, 0x99, 0xce, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x85, 0x26, 0x11, 0x05, 0x11, 0xe7, 0x31, 0x66, 0x29, 0xe5, 0x10,
+  0x08, 0x05, 0x11, 0x04, 0x25, 0x11, 0x02, 0x05, 0x11, 0x03, 0x25, 0x11, 0x04, 0x05, 0x11, 0x0c, 0x25, 0x11, 0x07, 0x05, 0x11, 0x81, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x47, 0x11,
+  0x08, 0x32, 0x05, 0x00, 0x00, 0x82, 0xcb, 0x52, 0x06, 0x11, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x07, 0xff, 0xff, 0x81, 0xef, 0x7b, 0x02, 0xc4, 0x08, 0x06, 0xe4, 0x08, 0x02, 0xe5, 0x08, 0x02,
+  0xe4, 0x08, 0x83, 0xe5, 0x08, 0xe5, 0x10, 0xe5, 0x08, 0x02, 0xe4, 0x08, 0x02, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x02, 0xe5, 0x08, 0x15, 0xe4, 0x10, 0x02, 0xe4, 0x08, 0x03, 0xe5,
+  0x08, 0x04, 0x05, 0x09, 0x82, 0x05, 0x11, 0x3c, 0xe7, 0x06, 0xff, 0xff, 0x82, 0xba, 0xd6, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x85, 0x26, 0x11, 0x05, 0x11, 0xc7, 0x31, 0x00, 0x00, 0xe5, 0x10, 0x08,
+  0x05, 0x11, 0x04, 0x25, 0x11, 0x02, 0x05, 0x11, 0x03, 0x25, 0x11, 0x06, 0x05, 0x11, 0x04, 0x25, 0x11, 0x02, 0x05, 0x11, 0x04, 0x25, 0x11, 0x08, 0x05, 0x11, 0x03, 0x26, 0x11, 0x02, 0x46, 0x11,
+  0x81, 0xc7, 0x29, 0x05, 0x00, 0x00, 0x82, 0xcb, 0x52, 0x06, 0x11, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x06, 0xff, 0xff, 0x85, 0x3c, 0xe7, 0x05, 0x11, 0xc5, 0x08, 0xc4, 0x08, 0xe4, 0x08, 0x04,
+  0xe5, 0x08, 0x81, 0xe4, 0x08, 0x03, 0xe5, 0x08, 0x83, 0xe4, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0x03, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x03, 0xe5, 0x10, 0x0d, 0xe4, 0x10, 0x02, 0x04,
+  0x11, 0x07, 0xe5, 0x10, 0x08, 0x05, 0x09, 0x82, 0x26, 0x09, 0xd3, 0x9c, 0x06, 0xff, 0xff, 0x82, 0xba, 0xd6, 0x05, 0x09, 0x03, 0x05, 0x11, 0x84, 0x26, 0x11, 0x05, 0x11, 0xc7, 0x31, 0x46, 0x21,
+  0x02, 0xe5, 0x10, 0x07, 0x05, 0x11, 0x09, 0x25, 0x11, 0x06, 0x05, 0x11, 0x05, 0x25, 0x11, 0x02, 0x05, 0x11, 0x07, 0x25, 0x11, 0x04, 0x05, 0x11, 0x03, 0x26, 0x11, 0x02, 0x46, 0x11, 0x81, 0x41,
+  0x00, 0x05, 0x00, 0x00, 0x82, 0xcb, 0x52, 0x06, 0x11, 0x05, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x06, 0xff, 0xff, 0x87, 0xde, 0xff, 0xa7, 0x29, 0xc5, 0x08, 0xc4, 0x08, 0xe4, 0x08, 0xe5, 0x08, 0xe4,
+  0x08, 0x05, 0xe5, 0x08, 0x26, 0xe5, 0x10, 0x03, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x03, 0x06, 0x09, 0x81, 0x3c, 0xe7, 0x06, 0xff, 0xff, 0x82, 0xda, 0xde, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x85, 0x26,
+  0x11, 0x05, 0x11, 0xc7, 0x31, 0xe7, 0x39, 0xe4, 0x08, 0x03, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x09, 0x25, 0x11, 0x04, 0x05, 0x11, 0x11, 0x25, 0x11, 0x03, 0x05, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46,
+  0x11, 0x46, 0x19, 0xcb, 0x52, 0x05, 0x00, 0x00, 0x81, 0x29, 0x3a, 0x02, 0x06, 0x11, 0x04, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x07, 0xff, 0xff, 0x82, 0x99, 0xd6, 0x66, 0x21, 0x02, 0xe4, 0x08, 0x03,
+  0xe5, 0x08, 0x81, 0xe6, 0x08, 0x03, 0xe5, 0x08, 0x23, 0xe5, 0x10, 0x03, 0xe5, 0x08, 0x05, 0xe6, 0x08, 0x82, 0xe5, 0x08, 0xb6, 0xb5, 0x07, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05,
+  0x11, 0x85, 0x26, 0x11, 0x05, 0x11, 0xc7, 0x31, 0x24, 0x21, 0x04, 0x19, 0x03, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x1b, 0x25, 0x11, 0x81, 0x26, 0x11, 0x03, 0x25, 0x11, 0x05, 0x26, 0x11, 0x83, 0x46,
+  0x11, 0x42, 0x00, 0x63, 0x00, 0x05, 0x00, 0x00, 0x81, 0xcb, 0x4a, 0x02, 0x06, 0x11, 0x04, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x08, 0xff, 0xff, 0x81, 0x9d, 0xf7, 0x02, 0xfb, 0xde, 0x82, 0x1b, 0xe7,
+  0x3c, 0xe7, 0x0e, 0x58, 0xce, 0x20, 0x59, 0xce, 0x83, 0x58, 0xce, 0x59, 0xce, 0x5c, 0xef, 0x08, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x86, 0x26, 0x11, 0x05, 0x11, 0xc7,
+  0x31, 0x00, 0x00, 0x20, 0x00, 0xc5, 0x08, 0x02, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x18, 0x25, 0x11, 0x02, 0x25, 0x19, 0x09, 0x26, 0x11, 0x83, 0x46, 0x11, 0x08, 0x32, 0x25, 0x19, 0x06, 0x00, 0x00,
+  0x83, 0xcb, 0x52, 0x05, 0x11, 0x06, 0x11, 0x03, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x26, 0x11, 0x05, 0x11, 0xc7,
+  0x31, 0x02, 0x00, 0x00, 0x82, 0x20, 0x00, 0x05, 0x11, 0x02, 0xe5, 0x10, 0x08, 0x05, 0x11, 0x14, 0x25, 0x11, 0x02, 0x26, 0x11, 0x02, 0x46, 0x11, 0x07, 0x26, 0x11, 0x82, 0x26, 0x19, 0xcb, 0x52,
+  0x07, 0x00, 0x00, 0x81, 0x8a, 0x4a, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xa5, 0x46, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x26, 0x11, 0x06, 0x11, 0xc7, 0x31,
+  0x03, 0x00, 0x00, 0x82, 0x21, 0x00, 0xe8, 0x31, 0x02, 0xe5, 0x10, 0x07, 0x05, 0x11, 0x14, 0x25, 0x11, 0x02, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x46, 0x11, 0x02, 0x26, 0x11, 0x02, 0x05, 0x11,
+  0x83, 0x26, 0x11, 0xc7, 0x29, 0x07, 0x3a, 0x08, 0x00, 0x00, 0x81, 0xeb, 0x52, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11,
+  0x83, 0x26, 0x11, 0x06, 0x09, 0xc7, 0x31, 0x04, 0x00, 0x00, 0x81, 0x61, 0x00, 0x02, 0x0b, 0x5b, 0x84, 0x41, 0x00, 0x08, 0x3a, 0xa7, 0x29, 0xc8, 0x31, 0x04, 0x05, 0x11, 0x11, 0x25, 0x11, 0x02,
+  0x26, 0x11, 0x81, 0x46, 0x11, 0x04, 0x46, 0x19, 0x84, 0x46, 0x11, 0xcb, 0x52, 0x41, 0x00, 0xe3, 0x08, 0x02, 0xa1, 0x00, 0x09, 0x00, 0x00, 0x81, 0x20, 0x00, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11,
+  0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0x7d, 0xef, 0x05, 0x09, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x05, 0x09, 0xe8, 0x31, 0x0a, 0x00, 0x00, 0x82, 0x71, 0x84, 0x26, 0x19, 0x07, 0x05, 0x11, 0x0d,
+  0x25, 0x11, 0x02, 0x26, 0x19, 0x02, 0x46, 0x19, 0x02, 0x66, 0x19, 0x82, 0xa8, 0x21, 0xa7, 0x29, 0x0e, 0x00, 0x00, 0x81, 0x86, 0x29, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xad, 0x08, 0xff,
+  0xff, 0x82, 0x7c, 0xef, 0x99, 0xd6, 0x14, 0x34, 0xa5, 0x82, 0x38, 0xc6, 0x75, 0xad, 0x03, 0xba, 0xd6, 0x81, 0x99, 0xd6, 0x03, 0xba, 0xd6, 0x82, 0x99, 0xd6, 0x14, 0xa5, 0x14, 0x34, 0xa5, 0x81,
+  0x99, 0xce, 0x08, 0xff, 0xff, 0x82, 0x7d, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x25, 0x09, 0xe8, 0x39, 0x0a, 0x00, 0x00, 0x82, 0xc3, 0x00, 0xe7, 0x31, 0x02, 0x25, 0x11, 0x05,
+  0x05, 0x11, 0x0d, 0x25, 0x11, 0x02, 0x26, 0x19, 0x03, 0x46, 0x19, 0x82, 0x66, 0x19, 0x49, 0x3a, 0x0f, 0x00, 0x00, 0x81, 0xc3, 0x10, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x07, 0xff, 0xff, 0x82,
+  0xba, 0xd6, 0x04, 0x11, 0x03, 0xe5, 0x08, 0x08, 0xe4, 0x08, 0x02, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x07, 0x05, 0x11, 0x02, 0xe5, 0x10, 0x0a, 0xe4, 0x10, 0x06, 0x05, 0x11, 0x06,
+  0xe4, 0x10, 0x02, 0xe4, 0x08, 0x02, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x82, 0xb6, 0xb5, 0xde, 0xff, 0x06, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x25, 0x09,
+  0xc7, 0x31, 0x0b, 0x00, 0x00, 0x81, 0x45, 0x21, 0x0b, 0x25, 0x11, 0x02, 0x05, 0x11, 0x07, 0x25, 0x11, 0x82, 0x26, 0x11, 0x46, 0x11, 0x04, 0x46, 0x19, 0x81, 0x82, 0x00, 0x0f, 0x00, 0x00, 0x81,
+  0xc3, 0x10, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x06, 0xff, 0xff, 0x82, 0xde, 0xff, 0x86, 0x29, 0x04, 0xe5, 0x08, 0x81, 0xe4, 0x08, 0x04, 0xe5, 0x08, 0x03, 0xe4, 0x08, 0x81, 0xe4, 0x10, 0x04,
+  0xe5, 0x10, 0x81, 0x05, 0x11, 0x06, 0x04, 0x11, 0x03, 0x05, 0x11, 0x03, 0xe5, 0x10, 0x04, 0xe4, 0x10, 0x03, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x04, 0x11, 0x02, 0x04, 0x09, 0x82, 0x05, 0x11,
+  0xe5, 0x10, 0x05, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x02, 0x05, 0x11, 0x81, 0x38, 0xc6, 0x06, 0xff, 0xff, 0x82, 0x7d, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x25, 0x09, 0x66, 0x29,
+  0x0b, 0x00, 0x00, 0x81, 0x86, 0x21, 0x0b, 0x25, 0x11, 0x02, 0x05, 0x11, 0x07, 0x25, 0x11, 0x82, 0x26, 0x11, 0x46, 0x11, 0x03, 0x46, 0x19, 0x82, 0x47, 0x19, 0x25, 0x11, 0x0f, 0x00, 0x00, 0x81,
+  0xc3, 0x10, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x06, 0xff, 0xff, 0x82, 0x1b, 0xe7, 0xe4, 0x10, 0x09, 0xe5, 0x08, 0x03, 0xe4, 0x08, 0x81, 0xe4, 0x10, 0x04, 0xe5, 0x10, 0x81, 0x05, 0x11, 0x06,
+  0x04, 0x11, 0x02, 0x05, 0x11, 0x04, 0xe5, 0x10, 0x04, 0xe4, 0x10, 0x08, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x04, 0xe5, 0x10, 0x04, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x02, 0x05, 0x11, 0x81, 0x55, 0xad,
+  0x06, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x25, 0x11, 0x25, 0x09, 0x45, 0x21, 0x0b, 0x00, 0x00, 0x81, 0x86, 0x29, 0x0b, 0x25, 0x11, 0x06, 0x05, 0x11, 0x02, 0x25,
+  0x11, 0x03, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x82, 0x47, 0x19, 0x08, 0x32, 0x0f, 0x00, 0x00, 0x81, 0xc3, 0x10, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x06, 0xff, 0xff, 0x84, 0xfe,
+  0xff, 0xcb, 0x52, 0xc5, 0x08, 0xe4, 0x08, 0x06, 0xe5, 0x08, 0x04, 0xe4, 0x08, 0x02, 0xe4, 0x10, 0x04, 0xe5, 0x10, 0x07, 0xe4, 0x10, 0x82, 0xe5, 0x10, 0xe4, 0x10, 0x15, 0xe5, 0x10, 0x04, 0xe5,
+  0x08, 0x02, 0x05, 0x09, 0x82, 0x66, 0x21, 0x5c, 0xef, 0x06, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x02, 0x05, 0x09, 0x81, 0xe3, 0x18, 0x0b, 0x00, 0x00, 0x81, 0x86, 0x29,
+  0x0b, 0x25, 0x11, 0x06, 0x05, 0x11, 0x02, 0x25, 0x11, 0x03, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x82, 0x67, 0x19, 0x08, 0x3a, 0x0f, 0x00, 0x00, 0x81, 0xc3, 0x10, 0x05, 0x05, 0x11,
+  0x82, 0x06, 0x11, 0x54, 0xad, 0x07, 0xff, 0xff, 0x82, 0xbd, 0xf7, 0xcb, 0x52, 0x04, 0xc4, 0x08, 0x02, 0xc5, 0x10, 0x81, 0xe5, 0x10, 0x02, 0xc4, 0x08, 0x02, 0xc4, 0x10, 0x04, 0xe4, 0x10, 0x81,
+  0x05, 0x11, 0x04, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x81, 0x04, 0x19, 0x04, 0x05, 0x19, 0x04, 0x25, 0x19, 0x06, 0x05, 0x19, 0x02, 0xe5, 0x10, 0x05, 0xe4, 0x10, 0x89, 0xe4, 0x08, 0xc4, 0x08, 0xe4,
+  0x08, 0xe5, 0x08, 0xc4, 0x00, 0xe5, 0x10, 0xe6, 0x10, 0xe8, 0x31, 0x58, 0xce, 0x07, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x02, 0x05, 0x09, 0x81, 0x20, 0x00, 0x0b, 0x00,
+  0x00, 0x81, 0x66, 0x21, 0x02, 0x05, 0x11, 0x0b, 0x25, 0x11, 0x04, 0x05, 0x11, 0x03, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x82, 0x67, 0x21, 0x41, 0x00, 0x0f, 0x00,
+  0x00, 0x82, 0xc3, 0x10, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54, 0xad, 0x08, 0xff, 0xff, 0x81, 0xde, 0xff, 0x1a, 0x7d, 0xef, 0x02, 0xbd, 0xf7, 0x81, 0xbe, 0xf7, 0x04, 0xbd, 0xf7,
+  0x81, 0x9d, 0xf7, 0x0c, 0x7d, 0xef, 0x02, 0xbe, 0xf7, 0x82, 0x7d, 0xef, 0xbd, 0xf7, 0x02, 0x7d, 0xef, 0x81, 0xde, 0xff, 0x08, 0xff, 0xff, 0x83, 0x3c, 0xe7, 0xe5, 0x08, 0x05, 0x09, 0x02, 0x05,
+  0x11, 0x02, 0x05, 0x09, 0x81, 0x21, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x66, 0x21, 0x0d, 0x25, 0x11, 0x04, 0x05, 0x11, 0x03, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x82,
+  0x67, 0x21, 0x21, 0x00, 0x0f, 0x00, 0x00, 0x82, 0xc3, 0x10, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82, 0x06, 0x11, 0x55, 0xad, 0x46, 0xff, 0xff, 0x83, 0x3c, 0xe7, 0xe5, 0x08, 0x05, 0x09, 0x02, 0x05,
+  0x11, 0x02, 0x05, 0x09, 0x81, 0xe3, 0x18, 0x0b, 0x00, 0x00, 0x81, 0x45, 0x21, 0x0b, 0x25, 0x11, 0x06, 0x05, 0x11, 0x03, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x82,
+  0x67, 0x21, 0x21, 0x00, 0x0f, 0x00, 0x00, 0x82, 0xc3, 0x10, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82, 0x06, 0x11, 0x55, 0xad, 0x46, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x81,
+  0x05, 0x11, 0x02, 0x05, 0x09, 0x81, 0x45, 0x21, 0x0b, 0x00, 0x00, 0x81, 0x45, 0x21, 0x0b, 0x25, 0x11, 0x06, 0x05, 0x11, 0x03, 0x25, 0x11, 0x02, 0x26, 0x19, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19,
+  0x82, 0x67, 0x21, 0x41, 0x00, 0x0f, 0x00, 0x00, 0x82, 0xa3, 0x10, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82, 0x06, 0x11, 0x55, 0xad, 0x46, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x08, 0x02, 0x05, 0x09,
+  0x81, 0x05, 0x11, 0x02, 0x05, 0x09, 0x81, 0xa6, 0x29, 0x0b, 0x00, 0x00, 0x81, 0x45, 0x21, 0x0b, 0x25, 0x11, 0x05, 0x05, 0x11, 0x04, 0x25, 0x11, 0x02, 0x26, 0x19, 0x81, 0x46, 0x11, 0x02, 0x46,
+  0x19, 0x82, 0x66, 0x19, 0x41, 0x00, 0x0f, 0x00, 0x00, 0x82, 0x86, 0x29, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82, 0x06, 0x11, 0x55, 0xad, 0x15, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x05, 0xff, 0xff, 0x81,
+  0xfe, 0xff, 0x03, 0xde, 0xff, 0x84, 0xbe, 0xf7, 0x7d, 0xef, 0xbd, 0xf7, 0xbe, 0xf7, 0x02, 0xbd, 0xf7, 0x82, 0x9d, 0xf7, 0x7d, 0xef, 0x03, 0xbe, 0xf7, 0x85, 0x9d, 0xf7, 0x7d, 0xef, 0x9d, 0xf7,
+  0xbd, 0xf7, 0xbe, 0xf7, 0x03, 0xbd, 0xf7, 0x82, 0xbe, 0xf7, 0x7d, 0xef, 0x03, 0xde, 0xff, 0x81, 0xff, 0xff, 0x03, 0xde, 0xff, 0x82, 0x7d, 0xef, 0xbe, 0xf7, 0x09, 0xff, 0xff, 0x82, 0x5c, 0xef,
+  0xe5, 0x08, 0x05, 0x05, 0x09, 0x81, 0xa7, 0x31, 0x0b, 0x00, 0x00, 0x81, 0x45, 0x21, 0x13, 0x25, 0x11, 0x02, 0x26, 0x11, 0x82, 0x26, 0x19, 0x46, 0x11, 0x02, 0x46, 0x19, 0x82, 0x26, 0x19, 0x21,
+  0x00, 0x0f, 0x00, 0x00, 0x81, 0xeb, 0x52, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x55, 0xad, 0x07, 0xff, 0xff, 0x84, 0xde, 0xff, 0x75, 0xad, 0xab, 0x52, 0xeb, 0x5a, 0x06, 0xec, 0x5a, 0x86, 0xeb,
+  0x5a, 0x51, 0x8c, 0x34, 0xa5, 0xaa, 0x52, 0x0c, 0x5b, 0x69, 0x4a, 0x03, 0xeb, 0x5a, 0x83, 0xcb, 0x52, 0x69, 0x4a, 0xa7, 0x31, 0x02, 0x86, 0x29, 0x83, 0x66, 0x21, 0x45, 0x21, 0x45, 0x19, 0x03,
+  0x25, 0x19, 0x82, 0x45, 0x19, 0x45, 0x21, 0x03, 0x65, 0x21, 0x02, 0x45, 0x21, 0x81, 0x45, 0x19, 0x06, 0x25, 0x19, 0x86, 0x45, 0x21, 0x66, 0x21, 0x86, 0x29, 0xe8, 0x39, 0xaa, 0x52, 0xc7, 0x31,
+  0x02, 0x86, 0x21, 0x84, 0x46, 0x19, 0x25, 0x11, 0xcb, 0x52, 0x3c, 0xe7, 0x07, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x09, 0x02, 0x25, 0x09, 0x81, 0xa7, 0x31, 0x0b, 0x00, 0x00,
+  0x81, 0x45, 0x21, 0x13, 0x25, 0x11, 0x02, 0x26, 0x11, 0x82, 0x26, 0x19, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x26, 0x11, 0x10, 0x00, 0x00, 0x82, 0xeb, 0x52, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x82,
+  0x06, 0x11, 0x55, 0xad, 0x07, 0xff, 0xff, 0x81, 0x50, 0x8c, 0x05, 0xc4, 0x08, 0x02, 0xe4, 0x08, 0x09, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x81, 0xe5, 0x08, 0x10, 0xe5, 0x10, 0x03, 0xe5, 0x08, 0x05,
+  0xe5, 0x10, 0x03, 0xe5, 0x08, 0x07, 0x05, 0x09, 0x83, 0x05, 0x11, 0x46, 0x21, 0x3c, 0xe7, 0x06, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x09, 0x02, 0x25, 0x09, 0x81, 0x66, 0x29,
+  0x0b, 0x00, 0x00, 0x81, 0x45, 0x21, 0x04, 0x25, 0x11, 0x03, 0x05, 0x11, 0x0d, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x10, 0x00, 0x00, 0x83, 0x28, 0x3a, 0xe5,
+  0x10, 0x05, 0x11, 0x04, 0x06, 0x11, 0x81, 0x55, 0xad, 0x06, 0xff, 0xff, 0x82, 0x7d, 0xef, 0x25, 0x21, 0x05, 0xc4, 0x08, 0x02, 0xe4, 0x08, 0x07, 0xe5, 0x08, 0x0b, 0xe5, 0x10, 0x04, 0x05, 0x09,
+  0x05, 0xe5, 0x10, 0x02, 0x05, 0x09, 0x04, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x06, 0xe5, 0x08, 0x07, 0x05, 0x09, 0x82, 0x06, 0x09, 0x79, 0xce, 0x06, 0xff, 0xff, 0x88, 0x5c, 0xef, 0xe5, 0x08, 0x05,
+  0x11, 0x05, 0x09, 0x25, 0x09, 0x26, 0x09, 0x25, 0x11, 0x21, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x25, 0x19, 0x03, 0x05, 0x11, 0x81, 0x25, 0x11, 0x03, 0x05, 0x11, 0x0d, 0x25, 0x11, 0x03, 0x26, 0x11,
+  0x83, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x10, 0x00, 0x00, 0x82, 0x28, 0x3a, 0xe5, 0x10, 0x05, 0x06, 0x11, 0x81, 0x55, 0xad, 0x06, 0xff, 0xff, 0x82, 0xbd, 0xf7, 0x45, 0x21, 0x05, 0xc4, 0x08,
+  0x02, 0xe4, 0x08, 0x07, 0xe5, 0x08, 0x0b, 0xe5, 0x10, 0x04, 0x05, 0x09, 0x04, 0xe5, 0x10, 0x07, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x06, 0xe5, 0x08, 0x07, 0x05, 0x09, 0x82, 0x25, 0x11, 0x5c, 0xef,
+  0x06, 0xff, 0xff, 0x88, 0x3c, 0xe7, 0x05, 0x09, 0x05, 0x11, 0x05, 0x09, 0x25, 0x09, 0x26, 0x09, 0x25, 0x11, 0x21, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x25, 0x19, 0x03, 0x05, 0x11, 0x81, 0x25, 0x11,
+  0x03, 0x05, 0x11, 0x0d, 0x25, 0x11, 0x86, 0x26, 0x11, 0x26, 0x19, 0x26, 0x11, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x10, 0x00, 0x00, 0x82, 0x28, 0x3a, 0xe5, 0x10, 0x02, 0x06, 0x11, 0x03, 0x05,
+  0x11, 0x81, 0x55, 0xad, 0x07, 0xff, 0xff, 0x81, 0x95, 0xb5, 0x05, 0xc4, 0x08, 0x81, 0xe5, 0x08, 0x03, 0xc5, 0x08, 0x81, 0xe5, 0x08, 0x06, 0xc5, 0x10, 0x81, 0xe5, 0x10, 0x07, 0xe5, 0x08, 0x05,
+  0xe5, 0x10, 0x81, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x06, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x81, 0xe5, 0x08, 0x04, 0xe5, 0x10, 0x03, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x02, 0xe6, 0x08, 0x02, 0x06, 0x09,
+  0x81, 0x4d, 0x6b, 0x07, 0xff, 0xff, 0x88, 0xda, 0xd6, 0x05, 0x09, 0x05, 0x11, 0x05, 0x09, 0x25, 0x09, 0x26, 0x09, 0x26, 0x11, 0x04, 0x09, 0x0b, 0x00, 0x00, 0x81, 0x45, 0x21, 0x03, 0x05, 0x11,
+  0x81, 0x25, 0x11, 0x03, 0x05, 0x11, 0x0d, 0x25, 0x11, 0x86, 0x26, 0x11, 0x26, 0x19, 0x26, 0x11, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x10, 0x00, 0x00, 0x82, 0xca, 0x52, 0xe5, 0x10, 0x03, 0x06,
+  0x11, 0x02, 0x05, 0x11, 0x81, 0x55, 0xad, 0x08, 0xff, 0xff, 0x83, 0x79, 0xce, 0x58, 0xce, 0x14, 0xa5, 0x0d, 0x34, 0xa5, 0x07, 0x54, 0xa5, 0x09, 0x34, 0xa5, 0x03, 0x54, 0xa5, 0x0e, 0x34, 0xa5,
+  0x81, 0x38, 0xc6, 0x03, 0x34, 0xa5, 0x82, 0x79, 0xce, 0xbe, 0xf7, 0x07, 0xff, 0xff, 0x88, 0xba, 0xd6, 0x05, 0x09, 0x05, 0x11, 0x05, 0x09, 0x25, 0x09, 0x26, 0x09, 0x26, 0x11, 0xe4, 0x08, 0x0b,
+  0x00, 0x00, 0x81, 0x45, 0x21, 0x05, 0x25, 0x11, 0x02, 0x05, 0x11, 0x0d, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x25, 0x11, 0x10, 0x00, 0x00, 0x83, 0xeb, 0x52,
+  0xe5, 0x10, 0x06, 0x11, 0x04, 0x05, 0x11, 0x81, 0x55, 0xad, 0x46, 0xff, 0xff, 0x82, 0xda, 0xde, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x05, 0x09, 0x25, 0x09, 0xe4, 0x08, 0x0b, 0x00, 0x00, 0x81,
+  0x45, 0x21, 0x14, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x82, 0x25, 0x19, 0x60, 0x00, 0x0f, 0x00, 0x00, 0x81, 0xeb, 0x52, 0x05, 0x05, 0x11, 0x82, 0x06, 0x11, 0x54,
+  0xad, 0x46, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83, 0x05, 0x09, 0x25, 0x09, 0x04, 0x09, 0x0b, 0x00, 0x00, 0x81, 0x65, 0x21, 0x14, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81,
+  0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x25, 0x11, 0x10, 0x00, 0x00, 0x81, 0x69, 0x42, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x08, 0x03, 0x05, 0x11, 0x83,
+  0x05, 0x09, 0x25, 0x09, 0x04, 0x09, 0x0b, 0x00, 0x00, 0x81, 0x66, 0x21, 0x14, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x25, 0x11, 0x10, 0x00, 0x00, 0x81, 0xc6,
+  0x31, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x88, 0x1b, 0xe7, 0xe5, 0x08, 0x05, 0x11, 0x05, 0x09, 0x05, 0x11, 0x05, 0x09, 0x25, 0x09, 0x04, 0x09, 0x0b, 0x00, 0x00, 0x82, 0x65,
+  0x21, 0x25, 0x19, 0x13, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x25, 0x11, 0x10, 0x00, 0x00, 0x81, 0xc6, 0x31, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x08, 0xff,
+  0xff, 0x82, 0x3c, 0xe7, 0xfb, 0xde, 0x0a, 0x58, 0xce, 0x86, 0x99, 0xd6, 0x3c, 0xe7, 0xba, 0xd6, 0xfb, 0xde, 0x58, 0xce, 0xda, 0xde, 0x02, 0x38, 0xc6, 0x02, 0x58, 0xce, 0x86, 0x17, 0xc6, 0xba,
+  0xd6, 0x99, 0xd6, 0xda, 0xd6, 0xda, 0xde, 0x58, 0xce, 0x03, 0xfb, 0xde, 0x85, 0x3c, 0xe7, 0xda, 0xd6, 0xda, 0xde, 0xfb, 0xde, 0xba, 0xd6, 0x0e, 0x58, 0xce, 0x85, 0x99, 0xd6, 0x1b, 0xe7, 0x58,
+  0xce, 0x79, 0xce, 0xfe, 0xff, 0x07, 0xff, 0xff, 0x85, 0x7d, 0xef, 0xe5, 0x08, 0x05, 0x11, 0x05, 0x09, 0x05, 0x11, 0x02, 0x05, 0x09, 0x81, 0xe4, 0x08, 0x0b, 0x00, 0x00, 0x82, 0x65, 0x21, 0x25,
+  0x19, 0x13, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x25, 0x11, 0x10, 0x00, 0x00, 0x81, 0x45, 0x21, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x07, 0xff, 0xff, 0x82,
+  0x99, 0xd6, 0x46, 0x21, 0x09, 0xe5, 0x08, 0x82, 0xe5, 0x10, 0xe4, 0x10, 0x03, 0xe5, 0x10, 0x81, 0xe5, 0x08, 0x04, 0xe5, 0x10, 0x81, 0xe5, 0x08, 0x03, 0x05, 0x09, 0x12, 0xe5, 0x08, 0x81, 0xe5,
+  0x10, 0x04, 0x05, 0x09, 0x06, 0xe5, 0x08, 0x83, 0x05, 0x09, 0x10, 0x7c, 0xde, 0xff, 0x06, 0xff, 0xff, 0x88, 0x9d, 0xf7, 0xe5, 0x08, 0x05, 0x11, 0x05, 0x09, 0x05, 0x11, 0x06, 0x09, 0x05, 0x09,
+  0xe4, 0x08, 0x0b, 0x00, 0x00, 0x82, 0x65, 0x21, 0x25, 0x19, 0x13, 0x25, 0x11, 0x02, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x25, 0x11, 0x10, 0x00, 0x00, 0x81, 0x40, 0x00, 0x06,
+  0x05, 0x11, 0x81, 0x54, 0xad, 0x07, 0xff, 0xff, 0x81, 0xeb, 0x5a, 0x0f, 0xe5, 0x08, 0x83, 0x05, 0x09, 0xe5, 0x10, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x04, 0x05, 0x09, 0x04, 0xe5, 0x10, 0x03, 0x05,
+  0x09, 0x04, 0xe5, 0x10, 0x07, 0x05, 0x11, 0x81, 0xe5, 0x08, 0x03, 0x05, 0x09, 0x07, 0xe5, 0x08, 0x83, 0x05, 0x09, 0x06, 0x09, 0x1b, 0xe7, 0x06, 0xff, 0xff, 0x83, 0x7d, 0xef, 0xe5, 0x08, 0x05,
+  0x11, 0x04, 0x05, 0x09, 0x81, 0x66, 0x21, 0x0b, 0x00, 0x00, 0x82, 0x65, 0x21, 0x25, 0x19, 0x0a, 0x25, 0x11, 0x02, 0x05, 0x11, 0x07, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x46, 0x19,
+  0x25, 0x11, 0x10, 0x00, 0x00, 0x81, 0x40, 0x00, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x06, 0xff, 0xff, 0x82, 0x5c, 0xef, 0x05, 0x19, 0x06, 0xe4, 0x08, 0x0a, 0xe5, 0x08, 0x03, 0xe5, 0x10, 0x02,
+  0xe5, 0x08, 0x02, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x04, 0xe5, 0x10, 0x02, 0xe5, 0x08, 0x04, 0xe5, 0x10, 0x02, 0x05, 0x09, 0x04, 0x05, 0x11, 0x07, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x04, 0xe5, 0x08,
+  0x83, 0x05, 0x09, 0x06, 0x09, 0xda, 0xde, 0x06, 0xff, 0xff, 0x83, 0x5c, 0xef, 0xe5, 0x08, 0x05, 0x11, 0x04, 0x05, 0x09, 0x81, 0x41, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x65, 0x21, 0x0b, 0x25, 0x11,
+  0x02, 0x05, 0x11, 0x07, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x10, 0x00, 0x00, 0x81, 0x41, 0x00, 0x06, 0x05, 0x11, 0x81, 0x54, 0xad, 0x07, 0xff, 0xff, 0x81,
+  0x6d, 0x6b, 0x0a, 0xc4, 0x08, 0x81, 0xe4, 0x08, 0x05, 0xe5, 0x08, 0x03, 0xe5, 0x10, 0x02, 0xe5, 0x08, 0x03, 0xe5, 0x10, 0x81, 0x05, 0x11, 0x04, 0xe5, 0x10, 0x02, 0xe5, 0x08, 0x04, 0xe5, 0x10,
+  0x12, 0xe5, 0x08, 0x83, 0x05, 0x09, 0x08, 0x3a, 0xbe, 0xf7, 0x06, 0xff, 0xff, 0x83, 0x1b, 0xe7, 0xe5, 0x08, 0x05, 0x11, 0x03, 0x05, 0x09, 0x82, 0x05, 0x11, 0x45, 0x21, 0x0b, 0x00, 0x00, 0x81,
+  0x66, 0x29, 0x0d, 0x25, 0x11, 0x05, 0x05, 0x11, 0x02, 0x25, 0x11, 0x03, 0x26, 0x11, 0x02, 0x46, 0x11, 0x81, 0x25, 0x11, 0x10, 0x00, 0x00, 0x82, 0x08, 0x3a, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81,
+  0x54, 0xad, 0x07, 0xff, 0xff, 0x82, 0x7d, 0xef, 0x50, 0x84, 0x04, 0xc4, 0x08, 0x03, 0xa4, 0x08, 0x04, 0xc4, 0x08, 0x83, 0xe4, 0x08, 0xe5, 0x08, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11,
+  0x05, 0x25, 0x19, 0x83, 0x46, 0x19, 0x66, 0x21, 0x87, 0x21, 0x05, 0xa7, 0x29, 0x02, 0x86, 0x21, 0x02, 0x66, 0x21, 0x83, 0x45, 0x19, 0x25, 0x19, 0x25, 0x11, 0x02, 0x05, 0x11, 0x83, 0xe5, 0x10,
+  0xe4, 0x08, 0xe5, 0x08, 0x03, 0xc5, 0x08, 0x02, 0xc4, 0x08, 0x02, 0xe4, 0x08, 0x83, 0xe5, 0x08, 0xae, 0x73, 0x5c, 0xef, 0x07, 0xff, 0xff, 0x82, 0xda, 0xde, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81,
+  0x86, 0x29, 0x0b, 0x00, 0x00, 0x82, 0x86, 0x29, 0x25, 0x19, 0x0c, 0x25, 0x11, 0x05, 0x05, 0x11, 0x02, 0x25, 0x11, 0x03, 0x26, 0x11, 0x02, 0x46, 0x11, 0x82, 0x25, 0x11, 0x60, 0x00, 0x0f, 0x00,
+  0x00, 0x82, 0x29, 0x42, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x09, 0xff, 0xff, 0x18, 0xbe, 0xf7, 0x09, 0xde, 0xff, 0x81, 0xbe, 0xf7, 0x03, 0xde, 0xff, 0x0f, 0xbe, 0xf7, 0x09, 0xff,
+  0xff, 0x82, 0xba, 0xd6, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x41, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x86, 0x29, 0x25, 0x19, 0x0e, 0x25, 0x11, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x04, 0x26, 0x11,
+  0x83, 0x46, 0x11, 0x25, 0x19, 0x60, 0x00, 0x0f, 0x00, 0x00, 0x82, 0x69, 0x42, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0x3c, 0xe7, 0xe5, 0x10, 0x05, 0x05, 0x11,
+  0x81, 0x21, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x86, 0x29, 0x25, 0x19, 0x0f, 0x25, 0x11, 0x02, 0x05, 0x11, 0x02, 0x25, 0x11, 0x04, 0x26, 0x11, 0x83, 0x46, 0x11, 0x66, 0x19, 0x60, 0x00, 0x0f, 0x00,
+  0x00, 0x82, 0xcb, 0x52, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe4, 0x10, 0x05, 0x05, 0x11, 0x81, 0x66, 0x21, 0x0b, 0x00, 0x00, 0x82, 0x86, 0x29,
+  0x05, 0x19, 0x04, 0x25, 0x11, 0x04, 0x05, 0x11, 0x07, 0x25, 0x11, 0x02, 0x05, 0x11, 0x03, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x66, 0x21, 0x60, 0x00, 0x0f, 0x00, 0x00, 0x82, 0xcb,
+  0x52, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x46, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x45, 0x19, 0x0b, 0x00, 0x00, 0x82, 0x86, 0x29, 0x25, 0x19, 0x04,
+  0x25, 0x11, 0x04, 0x05, 0x11, 0x0c, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x66, 0x21, 0x60, 0x00, 0x0f, 0x00, 0x00, 0x82, 0xab, 0x52, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad,
+  0x23, 0xff, 0xff, 0x81, 0xde, 0xff, 0x06, 0xbe, 0xf7, 0x81, 0xde, 0xff, 0x03, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x17, 0xff, 0xff, 0x82, 0x1b, 0xe7, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x86, 0x31,
+  0x0b, 0x00, 0x00, 0x82, 0x86, 0x29, 0x25, 0x19, 0x04, 0x25, 0x11, 0x04, 0x05, 0x11, 0x0c, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x66, 0x19, 0x60, 0x00, 0x0f, 0x00, 0x00, 0x82, 0xe8,
+  0x39, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xad, 0x07, 0xff, 0xff, 0x82, 0xbe, 0xf7, 0xf7, 0xbd, 0x03, 0x28, 0x42, 0x02, 0x08, 0x3a, 0x0c, 0x28, 0x42, 0x02, 0x08, 0x3a, 0x89, 0xc7, 0x31,
+  0xa7, 0x31, 0xe8, 0x31, 0xa7, 0x31, 0x08, 0x3a, 0x28, 0x42, 0x08, 0x3a, 0xa7, 0x31, 0x45, 0x21, 0x05, 0x45, 0x19, 0x86, 0x86, 0x29, 0x08, 0x3a, 0x28, 0x42, 0xa7, 0x29, 0xc7, 0x31, 0xa7, 0x29,
+  0x02, 0x08, 0x3a, 0x03, 0x28, 0x42, 0x82, 0x29, 0x42, 0x28, 0x3a, 0x02, 0x29, 0x42, 0x02, 0x49, 0x42, 0x02, 0x29, 0x42, 0x82, 0xd2, 0x94, 0x1b, 0xe7, 0x07, 0xff, 0xff, 0x81, 0x1b, 0xe7, 0x02,
+  0x05, 0x11, 0x02, 0x05, 0x09, 0x83, 0x06, 0x11, 0x05, 0x11, 0x49, 0x42, 0x0b, 0x00, 0x00, 0x81, 0x86, 0x29, 0x07, 0x25, 0x11, 0x02, 0x05, 0x11, 0x0c, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46,
+  0x11, 0x46, 0x19, 0x40, 0x00, 0x0f, 0x00, 0x00, 0x82, 0xcb, 0x52, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0x54, 0xa5, 0x07, 0xff, 0xff, 0x81, 0xd7, 0xbd, 0x0c, 0xe5, 0x08, 0x07, 0x05, 0x09, 0x0e,
+  0x05, 0x11, 0x81, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x83, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x81, 0x05, 0x09, 0x02, 0xe5, 0x08, 0x83, 0x05, 0x11, 0xe5, 0x08, 0x05, 0x11, 0x04,
+  0x05, 0x09, 0x83, 0x25, 0x11, 0x08, 0x3a, 0xbe, 0xf7, 0x06, 0xff, 0xff, 0x81, 0x58, 0xce, 0x02, 0x05, 0x11, 0x85, 0x05, 0x09, 0x25, 0x09, 0x26, 0x09, 0x26, 0x11, 0x41, 0x00, 0x0b, 0x00, 0x00,
+  0x81, 0x86, 0x29, 0x07, 0x25, 0x11, 0x02, 0x05, 0x11, 0x0c, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x46, 0x19, 0x60, 0x00, 0x0f, 0x00, 0x00, 0x82, 0x41, 0x00, 0xe5, 0x10, 0x05, 0x05,
+  0x11, 0x81, 0x38, 0xc6, 0x06, 0xff, 0xff, 0x82, 0x5c, 0xef, 0x46, 0x19, 0x0f, 0xe5, 0x08, 0x02, 0x05, 0x11, 0x02, 0x05, 0x09, 0x81, 0x05, 0x11, 0x02, 0xe5, 0x10, 0x12, 0x05, 0x11, 0x81, 0xe5,
+  0x10, 0x02, 0x05, 0x11, 0x02, 0x05, 0x09, 0x82, 0xe5, 0x08, 0x05, 0x09, 0x02, 0x05, 0x11, 0x04, 0x05, 0x09, 0x02, 0x05, 0x11, 0x81, 0x79, 0xce, 0x06, 0xff, 0xff, 0x81, 0x58, 0xce, 0x02, 0x05,
+  0x11, 0x82, 0x05, 0x09, 0x25, 0x09, 0x02, 0x26, 0x11, 0x81, 0x66, 0x19, 0x0b, 0x00, 0x00, 0x81, 0x65, 0x29, 0x14, 0x25, 0x11, 0x03, 0x26, 0x11, 0x84, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x60,
+  0x00, 0x0f, 0x00, 0x00, 0x82, 0x01, 0x00, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x81, 0xeb, 0x5a, 0x06, 0xff, 0xff, 0x82, 0x5c, 0xef, 0xe5, 0x10, 0x0e, 0xe5, 0x08, 0x10, 0xe5, 0x10, 0x06, 0x05, 0x11,
+  0x03, 0xe5, 0x10, 0x82, 0xe4, 0x10, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x05, 0x05, 0x09, 0x84, 0x05, 0x11, 0xe5, 0x08, 0x05, 0x11, 0x05, 0x09, 0x03, 0x05, 0x11, 0x81, 0x5c, 0xe7, 0x06, 0xff, 0xff,
+  0x84, 0x54, 0xad, 0x05, 0x09, 0x06, 0x09, 0x26, 0x09, 0x03, 0x26, 0x11, 0x81, 0x42, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x66, 0x29, 0x25, 0x19, 0x13, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11,
+  0x46, 0x19, 0x25, 0x11, 0x11, 0x00, 0x00, 0x05, 0x05, 0x11, 0x83, 0x06, 0x11, 0x06, 0x09, 0x7c, 0xef, 0x06, 0xff, 0xff, 0x87, 0xf7, 0xbd, 0xc4, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0xe4, 0x08, 0xe5,
+  0x08, 0xc4, 0x08, 0x09, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x81, 0xe5, 0x08, 0x04, 0xe5, 0x10, 0x81, 0xe5, 0x08, 0x03, 0xe5, 0x10, 0x81, 0xe5, 0x08, 0x0c, 0xe5, 0x10, 0x03, 0xe4, 0x10, 0x02, 0xe5,
+  0x08, 0x03, 0x05, 0x09, 0x82, 0xe5, 0x08, 0x05, 0x09, 0x05, 0x05, 0x11, 0x82, 0xb2, 0x94, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x81, 0x69, 0x42, 0x02, 0x06, 0x09, 0x81, 0x26, 0x09, 0x02, 0x26, 0x11,
+  0x82, 0x46, 0x11, 0x49, 0x42, 0x0b, 0x00, 0x00, 0x81, 0x65, 0x21, 0x14, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x10, 0x00, 0x00, 0x82, 0x21, 0x00, 0x25, 0x19,
+  0x05, 0x05, 0x11, 0x82, 0x26, 0x11, 0x55, 0xad, 0x06, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xd6, 0xbd, 0x02, 0x6d, 0x6b, 0x08, 0x8e, 0x6b, 0x0a, 0x8e, 0x73, 0x04, 0x8d, 0x73, 0x05, 0xae, 0x73, 0x04,
+  0xce, 0x73, 0x04, 0xae, 0x73, 0x05, 0x8e, 0x73, 0x87, 0x4d, 0x6b, 0xef, 0x7b, 0xeb, 0x5a, 0x8e, 0x6b, 0x6d, 0x6b, 0x54, 0xad, 0x4d, 0x63, 0x02, 0x8e, 0x6b, 0x83, 0xae, 0x73, 0xd6, 0xbd, 0xde,
+  0xff, 0x06, 0xff, 0xff, 0x84, 0x3c, 0xe7, 0x25, 0x09, 0x06, 0x09, 0x26, 0x09, 0x03, 0x26, 0x11, 0x82, 0xa8, 0x29, 0x02, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x65, 0x21, 0x14, 0x25, 0x11, 0x03, 0x26,
+  0x11, 0x83, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x11, 0x00, 0x00, 0x82, 0x21, 0x00, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x83, 0x26, 0x11, 0x05, 0x11, 0x79, 0xce, 0x1b, 0xff, 0xff, 0x05, 0xfe, 0xff,
+  0x22, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x6d, 0x6b, 0x02, 0x06, 0x09, 0x03, 0x26, 0x11, 0x82, 0x47, 0x11, 0x29, 0x3a, 0x0c, 0x00, 0x00, 0x81, 0x65, 0x29, 0x14, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83,
+  0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x11, 0x00, 0x00, 0x83, 0xc7, 0x39, 0x05, 0x19, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x83, 0x26, 0x11, 0xcb, 0x52, 0xde, 0xff, 0x19, 0xff, 0xff, 0x06, 0xfe, 0xff,
+  0x22, 0xff, 0xff, 0x84, 0x58, 0xce, 0xe5, 0x08, 0x05, 0x09, 0x06, 0x09, 0x02, 0x26, 0x11, 0x83, 0x27, 0x11, 0x87, 0x11, 0x64, 0x00, 0x0c, 0x00, 0x00, 0x81, 0x65, 0x29, 0x14, 0x25, 0x11, 0x03,
+  0x26, 0x11, 0x83, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x12, 0x00, 0x00, 0x82, 0x21, 0x00, 0xe5, 0x10, 0x06, 0x05, 0x11, 0x82, 0x6d, 0x6b, 0xbd, 0xf7, 0x17, 0xff, 0xff, 0x08, 0xfe, 0xff, 0x20,
+  0xff, 0xff, 0x89, 0xf7, 0xbd, 0x05, 0x11, 0xe5, 0x08, 0x05, 0x09, 0x06, 0x09, 0x26, 0x11, 0x46, 0x11, 0x67, 0x11, 0xc5, 0x00, 0x0d, 0x00, 0x00, 0x81, 0x66, 0x29, 0x14, 0x25, 0x11, 0x03, 0x26,
+  0x11, 0x83, 0x46, 0x11, 0x46, 0x19, 0x25, 0x11, 0x12, 0x00, 0x00, 0x82, 0x61, 0x00, 0x25, 0x19, 0x07, 0x05, 0x11, 0x82, 0x8e, 0x6b, 0xde, 0xff, 0x14, 0xff, 0xff, 0x0b, 0xfe, 0xff, 0x1d, 0xff,
+  0xff, 0x83, 0xfe, 0xff, 0x13, 0x9d, 0xe4, 0x08, 0x02, 0xe5, 0x08, 0x86, 0x05, 0x09, 0x06, 0x09, 0x26, 0x11, 0x47, 0x11, 0xac, 0x42, 0xf5, 0x8c, 0x0d, 0x00, 0x00, 0x81, 0x86, 0x29, 0x14, 0x25,
+  0x11, 0x03, 0x26, 0x11, 0x81, 0x46, 0x11, 0x02, 0x46, 0x19, 0x81, 0x41, 0x00, 0x12, 0x00, 0x00, 0x81, 0x08, 0x3a, 0x08, 0x05, 0x11, 0x82, 0xcb, 0x52, 0xda, 0xde, 0x12, 0xff, 0xff, 0x0e, 0xfe,
+  0xff, 0x1a, 0xff, 0xff, 0x82, 0x5c, 0xef, 0x6d, 0x6b, 0x04, 0xe5, 0x08, 0x85, 0x05, 0x09, 0x06, 0x11, 0x26, 0x09, 0x2a, 0x22, 0x06, 0x01, 0x0e, 0x00, 0x00, 0x81, 0xa6, 0x29, 0x14, 0x25, 0x11,
+  0x03, 0x26, 0x11, 0x84, 0x26, 0x19, 0x46, 0x19, 0x66, 0x21, 0x41, 0x00, 0x12, 0x00, 0x00, 0x82, 0xeb, 0x5a, 0x45, 0x21, 0x06, 0x05, 0x11, 0x02, 0x04, 0x11, 0x83, 0x25, 0x19, 0x14, 0xa5, 0x9d,
+  0xf7, 0x0e, 0xff, 0xff, 0x11, 0xfe, 0xff, 0x17, 0xff, 0xff, 0x83, 0x9d, 0xf7, 0x17, 0xc6, 0x66, 0x21, 0x05, 0xe5, 0x08, 0x85, 0x05, 0x09, 0x06, 0x11, 0x47, 0x09, 0x6b, 0x32, 0x65, 0x00, 0x0e,
+  0x00, 0x00, 0x81, 0xa6, 0x31, 0x05, 0x25, 0x11, 0x02, 0x05, 0x11, 0x0d, 0x25, 0x11, 0x02, 0x26, 0x11, 0x02, 0x26, 0x19, 0x83, 0x46, 0x19, 0x66, 0x21, 0x61, 0x00, 0x13, 0x00, 0x00, 0x83, 0x41,
+  0x00, 0x05, 0x19, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x03, 0x04, 0x11, 0x84, 0xe4, 0x10, 0x8e, 0x6b, 0x58, 0xce, 0x17, 0xbe, 0x05, 0xfb, 0xde, 0x86, 0x7d, 0xef, 0x5c, 0xef, 0xfb, 0xde, 0xfa, 0xde,
+  0x1a, 0xe7, 0x17, 0xc6, 0x02, 0xb9, 0xd6, 0x8d, 0x99, 0xd6, 0x37, 0xc6, 0xd6, 0xbd, 0xb5, 0xb5, 0x37, 0xc6, 0x78, 0xce, 0x99, 0xd6, 0x37, 0xc6, 0x1a, 0xe7, 0xfa, 0xde, 0x3b, 0xe7, 0x5b, 0xef,
+  0x9c, 0xf7, 0x02, 0xfa, 0xde, 0x83, 0x1a, 0xe7, 0x9c, 0xf7, 0x7d, 0xef, 0x04, 0x5c, 0xef, 0x82, 0x7d, 0xef, 0x5c, 0xef, 0x04, 0xfb, 0xde, 0x02, 0x3c, 0xe7, 0x02, 0x1b, 0xe7, 0x81, 0x5c, 0xef,
+  0x02, 0xfb, 0xde, 0x84, 0x1b, 0xe7, 0x95, 0xb5, 0xce, 0x73, 0x05, 0x11, 0x07, 0xe5, 0x08, 0x84, 0x05, 0x09, 0x06, 0x09, 0xe9, 0x31, 0xe8, 0x00, 0x0f, 0x00, 0x00, 0x81, 0xa6, 0x29, 0x05, 0x25,
+  0x11, 0x02, 0x05, 0x11, 0x0d, 0x25, 0x11, 0x02, 0x26, 0x11, 0x03, 0x26, 0x19, 0x82, 0x46, 0x21, 0x61, 0x00, 0x14, 0x00, 0x00, 0x83, 0x41, 0x00, 0x46, 0x19, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x02,
+  0x04, 0x11, 0x03, 0x05, 0x11, 0x06, 0x05, 0x09, 0x81, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x03, 0xe5, 0x08, 0x81, 0xe4, 0x08, 0x0b, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x08, 0x05, 0x11,
+  0x81, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x82, 0x05, 0x11, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x03, 0x04, 0x11, 0x86, 0x05, 0x11, 0xe4, 0x10, 0xe4, 0x08, 0xe5, 0x08, 0xe4, 0x08, 0xc4, 0x08, 0x09, 0xe5,
+  0x08, 0x83, 0x06, 0x11, 0x66, 0x21, 0x41, 0x00, 0x10, 0x00, 0x00, 0x81, 0xa6, 0x29, 0x02, 0x25, 0x11, 0x02, 0x05, 0x11, 0x05, 0x25, 0x11, 0x02, 0x05, 0x11, 0x09, 0x25, 0x11, 0x81, 0x26, 0x11,
+  0x03, 0x26, 0x19, 0x02, 0x46, 0x19, 0x81, 0x61, 0x00, 0x15, 0x00, 0x00, 0x84, 0xc7, 0x31, 0x25, 0x19, 0xe5, 0x10, 0x05, 0x11, 0x02, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x07, 0x05, 0x09, 0x02, 0xe5,
+  0x08, 0x03, 0x05, 0x09, 0x02, 0x04, 0x09, 0x82, 0xe4, 0x08, 0x05, 0x09, 0x09, 0xe5, 0x10, 0x81, 0x05, 0x11, 0x03, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x81, 0xe5, 0x10, 0x04, 0x05, 0x09, 0x02, 0x05,
+  0x11, 0x02, 0x05, 0x09, 0x02, 0x05, 0x11, 0x05, 0x05, 0x09, 0x82, 0xe5, 0x08, 0x05, 0x09, 0x09, 0xe5, 0x08, 0x84, 0xe6, 0x08, 0x05, 0x09, 0x85, 0x29, 0x40, 0x00, 0x11, 0x00, 0x00, 0x81, 0xa6,
+  0x29, 0x02, 0x25, 0x11, 0x02, 0x05, 0x11, 0x05, 0x25, 0x11, 0x02, 0x05, 0x11, 0x09, 0x25, 0x11, 0x02, 0x26, 0x11, 0x03, 0x26, 0x19, 0x82, 0x46, 0x19, 0x86, 0x29, 0x16, 0x00, 0x00, 0x02, 0x21,
+  0x00, 0x03, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x13, 0x05, 0x09, 0x06, 0xe5, 0x10, 0x06, 0x05, 0x11, 0x81, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x81, 0x05, 0x09, 0x03, 0x05, 0x11, 0x81, 0x05, 0x09, 0x04,
+  0x05, 0x11, 0x07, 0x05, 0x09, 0x09, 0xe5, 0x08, 0x83, 0x05, 0x11, 0x80, 0x08, 0x07, 0x42, 0x12, 0x00, 0x00, 0x81, 0x66, 0x21, 0x04, 0x05, 0x11, 0x12, 0x25, 0x11, 0x81, 0x25, 0x19, 0x02, 0x26,
+  0x19, 0x82, 0x46, 0x19, 0x42, 0x00, 0x17, 0x00, 0x00, 0x83, 0x40, 0x00, 0x66, 0x29, 0x45, 0x21, 0x02, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x15, 0x05, 0x09, 0x04, 0x05, 0x11, 0x07, 0xe5, 0x10, 0x03,
+  0x05, 0x09, 0x81, 0x05, 0x11, 0x03, 0x05, 0x09, 0x04, 0xe5, 0x08, 0x81, 0x05, 0x11, 0x05, 0x05, 0x09, 0x0a, 0xe5, 0x08, 0x82, 0x60, 0x08, 0xe0, 0x49, 0x14, 0x00, 0x00, 0x81, 0x25, 0x19, 0x04,
+  0x05, 0x11, 0x13, 0x25, 0x11, 0x81, 0x25, 0x19, 0x02, 0x26, 0x19, 0x81, 0xcb, 0x52, 0x19, 0x00, 0x00, 0x83, 0x69, 0x4a, 0x20, 0x00, 0x46, 0x19, 0x0d, 0x05, 0x11, 0x0b, 0x05, 0x09, 0x05, 0x05,
+  0x11, 0x06, 0xe5, 0x10, 0x03, 0x05, 0x09, 0x02, 0x05, 0x11, 0x02, 0x05, 0x09, 0x04, 0xe5, 0x08, 0x81, 0x05, 0x11, 0x05, 0x05, 0x09, 0x81, 0x05, 0x11, 0x02, 0x05, 0x09, 0x04, 0xe5, 0x08, 0x84,
+  0x05, 0x11, 0xa6, 0x31, 0xcd, 0x7b, 0x60, 0x62, 0x15, 0x00, 0x00, 0x81, 0x04, 0x11, 0x03, 0x05, 0x11, 0x14, 0x25, 0x11, 0x02, 0x26, 0x19, 0x82, 0x05, 0x19, 0x42, 0x00, 0x1b, 0x00, 0x00, 0x83,
+  0x40, 0x00, 0xe7, 0x31, 0x86, 0x29, 0x08, 0x05, 0x11, 0x81, 0x25, 0x09, 0x05, 0x05, 0x09, 0x02, 0x25, 0x11, 0x02, 0x05, 0x11, 0x81, 0x06, 0x11, 0x02, 0x05, 0x11, 0x81, 0x25, 0x11, 0x07, 0x05,
+  0x11, 0x02, 0xe5, 0x10, 0x04, 0x05, 0x11, 0x81, 0x05, 0x09, 0x02, 0x05, 0x11, 0x81, 0x06, 0x11, 0x02, 0x05, 0x09, 0x03, 0xe5, 0x08, 0x83, 0x05, 0x09, 0x06, 0x09, 0xe6, 0x08, 0x02, 0x06, 0x09,
+  0x02, 0x05, 0x09, 0x87, 0x06, 0x09, 0xe6, 0x08, 0xc5, 0x08, 0x45, 0x21, 0xe8, 0x39, 0xa7, 0x31, 0xaa, 0x52, 0x18, 0x00, 0x00, 0x81, 0x45, 0x21, 0x03, 0x05, 0x11, 0x13, 0x25, 0x11, 0x02, 0x26,
+  0x11, 0x83, 0x25, 0x11, 0x05, 0x19, 0x87, 0x21, 0x1d, 0x00, 0x00, 0x82, 0xd2, 0x94, 0x29, 0x42, 0x03, 0x00, 0x00, 0x84, 0xa7, 0x31, 0xc7, 0x31, 0xc8, 0x31, 0x22, 0x00, 0x02, 0x44, 0x00, 0x81,
+  0x0a, 0x3a, 0x04, 0x67, 0x21, 0x84, 0xa8, 0x31, 0x67, 0x29, 0xab, 0x5a, 0x01, 0x00, 0x04, 0x26, 0x19, 0x02, 0x25, 0x19, 0x81, 0x05, 0x19, 0x03, 0x05, 0x11, 0x83, 0xe5, 0x10, 0xe4, 0x10, 0x05,
+  0x09, 0x02, 0x05, 0x11, 0x81, 0x26, 0x11, 0x02, 0x26, 0x19, 0x02, 0x46, 0x19, 0x82, 0x26, 0x11, 0x06, 0x11, 0x03, 0xe5, 0x08, 0x8b, 0x86, 0x29, 0xaa, 0x52, 0x29, 0x42, 0x21, 0x00, 0x41, 0x00,
+  0x08, 0x3a, 0xe8, 0x31, 0xc7, 0x31, 0x62, 0x00, 0xb2, 0x94, 0x20, 0x00, 0x1b, 0x00, 0x00, 0x81, 0xab, 0x52, 0x04, 0x05, 0x11, 0x15, 0x25, 0x11, 0x82, 0x05, 0x11, 0x62, 0x00, 0x27, 0x00, 0x00,
+  0x83, 0x04, 0x00, 0x03, 0x00, 0xe9, 0x39, 0x02, 0xc9, 0x31, 0x86, 0x8b, 0x4a, 0x02, 0x00, 0x30, 0x8c, 0x80, 0x20, 0x01, 0x00, 0x47, 0x21, 0x03, 0x46, 0x21, 0x04, 0x25, 0x19, 0x81, 0x05, 0x19,
+  0x02, 0x05, 0x11, 0x02, 0xe5, 0x08, 0x8d, 0x05, 0x09, 0x26, 0x11, 0x27, 0x11, 0x47, 0x19, 0x67, 0x19, 0x67, 0x21, 0x67, 0x19, 0x48, 0x19, 0x28, 0x11, 0x07, 0x09, 0xc4, 0x00, 0xc4, 0x08, 0x08,
+  0x42, 0x02, 0x00, 0x00, 0x81, 0xe0, 0x20, 0x02, 0xc0, 0x18, 0x1f, 0x00, 0x00, 0x82, 0x83, 0x00, 0x46, 0x19, 0x04, 0x05, 0x11, 0x16, 0x25, 0x11, 0x82, 0x41, 0x00, 0xc7, 0x31, 0x02, 0x00, 0x00,
+  0x81, 0x99, 0xce, 0x23, 0x00, 0x00, 0x86, 0x02, 0x08, 0x02, 0x00, 0xe9, 0x39, 0xc9, 0x31, 0x2b, 0x42, 0x22, 0x00, 0x03, 0x00, 0x00, 0x82, 0x45, 0x29, 0x47, 0x21, 0x04, 0x46, 0x21, 0x81, 0x46,
+  0x19, 0x03, 0x25, 0x19, 0x83, 0x05, 0x19, 0x05, 0x11, 0x05, 0x09, 0x02, 0xe5, 0x08, 0x84, 0x06, 0x09, 0x27, 0x11, 0x47, 0x19, 0x67, 0x19, 0x03, 0x68, 0x19, 0x85, 0x48, 0x11, 0x27, 0x09, 0xe6,
+  0x00, 0xc5, 0x00, 0xa7, 0x31, 0x1d, 0x00, 0x00, 0x89, 0x61, 0x00, 0x45, 0x21, 0x65, 0x21, 0xc4, 0x08, 0xe4, 0x10, 0x04, 0x11, 0x05, 0x11, 0xa7, 0x21, 0x26, 0x11, 0x05, 0x05, 0x11, 0x15, 0x25,
+  0x11, 0x03, 0x05, 0x11, 0x85, 0x05, 0x19, 0x45, 0x21, 0x26, 0x21, 0xa8, 0x31, 0x0a, 0x42, 0x18, 0x00, 0x00, 0x81, 0xc0, 0x20, 0x03, 0xc0, 0x28, 0x84, 0xc0, 0x20, 0xe0, 0x28, 0xce, 0x73, 0x20,
+  0x00, 0x02, 0x09, 0x3a, 0x84, 0x09, 0x32, 0xa8, 0x29, 0x85, 0x00, 0x63, 0x00, 0x04, 0x00, 0x00, 0x83, 0x67, 0x21, 0x46, 0x21, 0x46, 0x19, 0x02, 0x46, 0x21, 0x81, 0x46, 0x19, 0x03, 0x25, 0x19,
+  0x02, 0x05, 0x11, 0x81, 0x05, 0x09, 0x03, 0xe5, 0x08, 0x84, 0x06, 0x09, 0x26, 0x11, 0x47, 0x19, 0x67, 0x19, 0x02, 0x68, 0x19, 0x86, 0x48, 0x11, 0x48, 0x09, 0x27, 0x09, 0xc6, 0x00, 0x25, 0x19,
+  0x30, 0x84, 0x1b, 0x00, 0x00, 0x81, 0x40, 0x00, 0x03, 0xe4, 0x10, 0x04, 0x05, 0x11, 0x06, 0x25, 0x11, 0x06, 0x05, 0x11, 0x0c, 0x25, 0x11, 0x04, 0x26, 0x11, 0x05, 0x25, 0x11, 0x85, 0x05, 0x11,
+  0x26, 0x11, 0x47, 0x21, 0x03, 0x00, 0x44, 0x00, 0x15, 0x00, 0x00, 0x82, 0xc0, 0x18, 0xc0, 0x20, 0x02, 0xa0, 0x18, 0x85, 0x91, 0x94, 0xaa, 0x52, 0x0b, 0x5b, 0xc6, 0x29, 0xe8, 0x29, 0x03, 0xc8,
+  0x29, 0x83, 0x09, 0x32, 0xa4, 0x00, 0x82, 0x00, 0x03, 0x00, 0x00, 0x82, 0x86, 0x29, 0x67, 0x21, 0x02, 0x46, 0x21, 0x03, 0x46, 0x19, 0x02, 0x25, 0x19, 0x81, 0x25, 0x11, 0x02, 0x05, 0x11, 0x81,
+  0x05, 0x09, 0x05, 0xe5, 0x08, 0x84, 0x06, 0x11, 0x26, 0x19, 0x47, 0x19, 0x48, 0x19, 0x02, 0x48, 0x11, 0x84, 0x27, 0x09, 0xe6, 0x00, 0x84, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x00, 0x82, 0xcb, 0x52,
+  0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x05, 0x09, 0x03, 0x05, 0x11, 0x06, 0x25, 0x11, 0x07, 0x05, 0x11, 0x0b, 0x25, 0x11, 0x04, 0x26, 0x11, 0x82, 0x25, 0x11, 0x05, 0x11, 0x04, 0x25, 0x11, 0x84,
+  0x26, 0x11, 0x46, 0x11, 0x46, 0x19, 0x01, 0x00, 0x15, 0x00, 0x00, 0x02, 0xca, 0x52, 0x02, 0x40, 0x00, 0x85, 0x0b, 0x5b, 0x61, 0x00, 0xe8, 0x29, 0xa8, 0x21, 0x87, 0x21, 0x03, 0x87, 0x19, 0x83,
+  0xa8, 0x21, 0x09, 0x32, 0xb2, 0x8c, 0x03, 0x00, 0x00, 0x84, 0x29, 0x42, 0x87, 0x21, 0x66, 0x21, 0x46, 0x21, 0x02, 0x46, 0x19, 0x81, 0x45, 0x19, 0x03, 0x25, 0x11, 0x02, 0x05, 0x11, 0x02, 0x05,
+  0x09, 0x03, 0xe5, 0x08, 0x85, 0xe6, 0x08, 0x06, 0x11, 0x26, 0x11, 0x46, 0x19, 0x47, 0x19, 0x02, 0x27, 0x11, 0x85, 0x27, 0x09, 0x07, 0x09, 0xc6, 0x00, 0xa6, 0x31, 0x20, 0x39, 0x19, 0x00, 0x00,
+  0x81, 0xc7, 0x31, 0x08, 0x05, 0x11, 0x04, 0x25, 0x11, 0x09, 0x05, 0x11, 0x10, 0x25, 0x11, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x02, 0x26, 0x11, 0x83, 0x46, 0x19, 0x46, 0x21, 0x21, 0x00, 0x13,
+  0x00, 0x00, 0x8b, 0xd2, 0x94, 0x0b, 0x5b, 0x49, 0x42, 0x61, 0x00, 0x62, 0x00, 0x08, 0x32, 0xc8, 0x29, 0xa7, 0x19, 0x87, 0x19, 0x67, 0x19, 0x66, 0x11, 0x02, 0x46, 0x11, 0x83, 0x66, 0x19, 0x81,
+  0x00, 0xe0, 0x00, 0x03, 0x00, 0x00, 0x82, 0xe3, 0x18, 0x87, 0x21, 0x04, 0x45, 0x19, 0x03, 0x25, 0x11, 0x03, 0x05, 0x11, 0x81, 0x05, 0x09, 0x02, 0xe5, 0x08, 0x81, 0x05, 0x09, 0x03, 0x06, 0x09,
+  0x81, 0x06, 0x11, 0x03, 0x26, 0x11, 0x86, 0x27, 0x11, 0x27, 0x09, 0x07, 0x09, 0x06, 0x09, 0xa7, 0x31, 0xc0, 0x38, 0x18, 0x00, 0x00, 0x82, 0xeb, 0x5a, 0xe4, 0x10, 0x15, 0x05, 0x11, 0x10, 0x25,
+  0x11, 0x03, 0x05, 0x11, 0x02, 0x25, 0x11, 0x02, 0x26, 0x11, 0x83, 0x46, 0x11, 0x26, 0x19, 0x22, 0x00, 0x13, 0x00, 0x00, 0x87, 0x80, 0x08, 0x61, 0x00, 0x08, 0x3a, 0xe8, 0x31, 0xc8, 0x29, 0xa8,
+  0x21, 0x87, 0x21, 0x02, 0x67, 0x19, 0x02, 0x46, 0x11, 0x02, 0x26, 0x11, 0x82, 0x25, 0x11, 0x60, 0x00, 0x04, 0x00, 0x00, 0x82, 0xe8, 0x39, 0x66, 0x21, 0x02, 0x45, 0x19, 0x81, 0x25, 0x19, 0x03,
+  0x25, 0x11, 0x03, 0x05, 0x11, 0x83, 0x05, 0x09, 0xe5, 0x08, 0xe4, 0x08, 0x02, 0xe5, 0x08, 0x03, 0x06, 0x09, 0x82, 0x06, 0x11, 0x25, 0x11, 0x02, 0x26, 0x11, 0x82, 0x27, 0x11, 0x26, 0x09, 0x02,
+  0x06, 0x09, 0x83, 0xc5, 0x08, 0xad, 0x7b, 0x20, 0x39, 0x17, 0x00, 0x00, 0x83, 0xe7, 0x31, 0xe4, 0x10, 0xe5, 0x10, 0x14, 0x05, 0x11, 0x02, 0x25, 0x11, 0x05, 0x05, 0x11, 0x06, 0x25, 0x11, 0x06,
+  0x05, 0x11, 0x81, 0x25, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x47, 0x19, 0xc8, 0x31, 0x13, 0x00, 0x00, 0x82, 0x0b, 0x5b, 0x08, 0x32, 0x02, 0xc8, 0x29, 0x85, 0xa7, 0x21, 0x87, 0x21, 0x67,
+  0x19, 0x47, 0x11, 0x46, 0x11, 0x02, 0x26, 0x11, 0x84, 0x05, 0x11, 0xe5, 0x10, 0xa6, 0x31, 0xc0, 0x08, 0x03, 0x00, 0x00, 0x83, 0x60, 0x08, 0x20, 0x00, 0x46, 0x19, 0x04, 0x25, 0x11, 0x05, 0x05,
+  0x11, 0x02, 0xe5, 0x10, 0x84, 0xe4, 0x10, 0xc4, 0x08, 0xc5, 0x08, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x03, 0x05, 0x11, 0x88, 0x06, 0x11, 0x26, 0x11, 0x06, 0x09, 0x26, 0x09, 0x06, 0x09, 0xe6, 0x08,
+  0x28, 0x4a, 0x20, 0x41, 0x17, 0x00, 0x00, 0x83, 0x20, 0x00, 0xe4, 0x10, 0xe5, 0x10, 0x14, 0x05, 0x11, 0x02, 0x25, 0x11, 0x07, 0x05, 0x11, 0x02, 0x25, 0x11, 0x08, 0x05, 0x11, 0x81, 0x25, 0x11,
+  0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x47, 0x11, 0x42, 0x00, 0x12, 0x00, 0x00, 0x86, 0x20, 0x11, 0x61, 0x00, 0xc8, 0x29, 0xa8, 0x21, 0x88, 0x21, 0x87, 0x19, 0x02, 0x67, 0x19, 0x87, 0x47, 0x11,
+  0x46, 0x11, 0x26, 0x11, 0x05, 0x11, 0xe4, 0x10, 0x85, 0x29, 0x60, 0x00, 0x04, 0x00, 0x00, 0x84, 0x80, 0x08, 0xe7, 0x39, 0x26, 0x19, 0x25, 0x11, 0x06, 0x05, 0x11, 0x89, 0xe5, 0x10, 0x05, 0x11,
+  0x05, 0x09, 0x04, 0x19, 0x41, 0x00, 0x20, 0x00, 0xc3, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x04, 0x06, 0x09, 0x83, 0xe6, 0x08, 0x20, 0x08, 0xe0, 0x38, 0x17, 0x00, 0x00, 0x82, 0xe2,
+  0x18, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x18, 0x05, 0x11, 0x08, 0x25, 0x11, 0x07, 0x05, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x47, 0x11, 0x66, 0x19, 0x12, 0x00, 0x00, 0x83, 0xad, 0x73, 0xc7,
+  0x31, 0x87, 0x21, 0x02, 0x87, 0x19, 0x02, 0x67, 0x19, 0x82, 0x47, 0x19, 0x46, 0x11, 0x02, 0x26, 0x11, 0x83, 0x04, 0x11, 0xa6, 0x29, 0x40, 0x00, 0x05, 0x00, 0x00, 0x83, 0x84, 0x29, 0x45, 0x21,
+  0x25, 0x11, 0x02, 0x05, 0x11, 0x82, 0x05, 0x09, 0xe5, 0x08, 0x02, 0x05, 0x09, 0x81, 0x05, 0x11, 0x02, 0xe5, 0x10, 0x82, 0xe4, 0x10, 0x40, 0x00, 0x02, 0x00, 0x00, 0x84, 0x65, 0x29, 0xe4, 0x18,
+  0xe4, 0x10, 0xe5, 0x10, 0x05, 0x05, 0x11, 0x04, 0x06, 0x09, 0x83, 0x66, 0x29, 0x90, 0xa4, 0x00, 0x49, 0x16, 0x00, 0x00, 0x82, 0x85, 0x29, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x17, 0x05, 0x11, 0x08,
+  0x25, 0x11, 0x08, 0x05, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x47, 0x11, 0x87, 0x21, 0x12, 0x00, 0x00, 0x82, 0x40, 0x00, 0x87, 0x21, 0x04, 0x67, 0x19, 0x02, 0x47, 0x19, 0x84, 0x46, 0x11,
+  0x26, 0x11, 0x66, 0x21, 0xeb, 0x5a, 0x07, 0x00, 0x00, 0x83, 0x20, 0x00, 0x05, 0x19, 0x05, 0x11, 0x07, 0xe5, 0x08, 0x83, 0xe5, 0x10, 0xc7, 0x31, 0x00, 0x08, 0x03, 0x00, 0x00, 0x83, 0x40, 0x00,
+  0x20, 0x00, 0xe4, 0x18, 0x06, 0x05, 0x11, 0x03, 0x06, 0x09, 0x84, 0x05, 0x09, 0xe5, 0x08, 0x4b, 0x73, 0x00, 0x49, 0x16, 0x00, 0x00, 0x82, 0xeb, 0x5a, 0xc4, 0x08, 0x02, 0xe5, 0x08, 0x81, 0xe5,
+  0x10, 0x18, 0x05, 0x11, 0x06, 0x25, 0x11, 0x08, 0x05, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x47, 0x11, 0xab, 0x52, 0x12, 0x00, 0x00, 0x84, 0x40, 0x00, 0x66, 0x21, 0x67, 0x19, 0x47, 0x19,
+  0x02, 0x46, 0x19, 0x85, 0x47, 0x11, 0x47, 0x19, 0x46, 0x11, 0xc7, 0x29, 0x41, 0x00, 0x07, 0x00, 0x00, 0x84, 0xed, 0x83, 0xc6, 0x39, 0x05, 0x11, 0x05, 0x09, 0x06, 0xe5, 0x08, 0x82, 0x66, 0x21,
+  0x20, 0x00, 0x07, 0x00, 0x00, 0x82, 0xc7, 0x39, 0x45, 0x21, 0x02, 0x05, 0x19, 0x03, 0x05, 0x11, 0x03, 0x06, 0x09, 0x84, 0x05, 0x09, 0xe5, 0x08, 0x0b, 0x6b, 0x20, 0x51, 0x16, 0x00, 0x00, 0x84,
+  0x28, 0x42, 0xc7, 0x31, 0xe4, 0x08, 0xe5, 0x08, 0x02, 0xe5, 0x10, 0x81, 0x05, 0x09, 0x17, 0x05, 0x11, 0x04, 0x25, 0x11, 0x09, 0x05, 0x11, 0x03, 0x26, 0x11, 0x83, 0x46, 0x11, 0x87, 0x21, 0x66,
+  0x29, 0x12, 0x00, 0x00, 0x81, 0xc6, 0x31, 0x06, 0x46, 0x19, 0x83, 0x47, 0x11, 0xa7, 0x29, 0x82, 0x08, 0x08, 0x00, 0x00, 0x84, 0x60, 0x10, 0x25, 0x19, 0x05, 0x11, 0x05, 0x09, 0x05, 0xe5, 0x08,
+  0x82, 0x05, 0x19, 0x20, 0x00, 0x09, 0x00, 0x00, 0x85, 0x40, 0x08, 0x45, 0x21, 0x04, 0x19, 0x05, 0x19, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x81, 0x06, 0x09, 0x02, 0x05, 0x09, 0x84, 0xe5, 0x08, 0x20,
+  0x00, 0x20, 0x49, 0x20, 0x51, 0x16, 0x00, 0x00, 0x82, 0x20, 0x00, 0x05, 0x11, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x03, 0x05, 0x09, 0x15, 0x05, 0x11, 0x04, 0x25, 0x11, 0x09, 0x05, 0x11, 0x81,
+  0x06, 0x11, 0x02, 0x26, 0x11, 0x82, 0x46, 0x11, 0x83, 0x00, 0x13, 0x00, 0x00, 0x81, 0x65, 0x21, 0x03, 0x25, 0x19, 0x85, 0x26, 0x19, 0x46, 0x11, 0x46, 0x19, 0x20, 0x00, 0x80, 0x00, 0x09, 0x00,
+  0x00, 0x82, 0x40, 0x08, 0x05, 0x11, 0x05, 0xe5, 0x08, 0x81, 0xc4, 0x08, 0x02, 0x21, 0x00, 0x0b, 0x00, 0x00, 0x84, 0x20, 0x00, 0x24, 0x21, 0xe4, 0x18, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x02, 0x05,
+  0x09, 0x85, 0xe5, 0x08, 0x05, 0x09, 0xa7, 0x29, 0x20, 0x08, 0x90, 0xa4, 0x17, 0x00, 0x00, 0x85, 0x20, 0x00, 0xc4, 0x08, 0xe4, 0x08, 0xe4, 0x10, 0xe5, 0x10, 0x02, 0x05, 0x09, 0x08, 0x05, 0x11,
+  0x81, 0x25, 0x11, 0x03, 0x05, 0x11, 0x81, 0x25, 0x11, 0x15, 0x05, 0x11, 0x81, 0x06, 0x11, 0x02, 0x26, 0x11, 0x82, 0xe9, 0x31, 0xc4, 0x00, 0x13, 0x00, 0x00, 0x82, 0x46, 0x29, 0x25, 0x19, 0x02,
+  0x05, 0x11, 0x83, 0x25, 0x19, 0x86, 0x29, 0xcb, 0x52, 0x0b, 0x00, 0x00, 0x82, 0x40, 0x00, 0x06, 0x11, 0x02, 0xe5, 0x10, 0x84, 0xc5, 0x10, 0xc5, 0x08, 0xe5, 0x10, 0xe8, 0x39, 0x0e, 0x00, 0x00,
+  0x85, 0x40, 0x08, 0x65, 0x29, 0x24, 0x21, 0xc4, 0x10, 0xe4, 0x10, 0x04, 0xe5, 0x08, 0x84, 0x26, 0x11, 0x41, 0x00, 0x4f, 0x9c, 0x20, 0x61, 0x17, 0x00, 0x00, 0x82, 0xe4, 0x18, 0x05, 0x19, 0x02,
+  0xe4, 0x10, 0x82, 0xe4, 0x08, 0x05, 0x09, 0x21, 0x05, 0x11, 0x81, 0x06, 0x11, 0x02, 0x05, 0x11, 0x82, 0x05, 0x19, 0x22, 0x00, 0x14, 0x00, 0x00, 0x81, 0x05, 0x19, 0x03, 0x05, 0x11, 0x82, 0x86,
+  0x29, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x83, 0xc0, 0x10, 0xa6, 0x29, 0x06, 0x11, 0x03, 0xe5, 0x10, 0x02, 0x41, 0x00, 0x81, 0x21, 0x00, 0x10, 0x00, 0x00, 0x84, 0xc6, 0x39, 0x03, 0x19, 0xe4, 0x10,
+  0xe5, 0x08, 0x02, 0xe5, 0x10, 0x85, 0xe5, 0x08, 0x06, 0x09, 0xac, 0x42, 0xaa, 0x5a, 0x73, 0xc5, 0x18, 0x00, 0x00, 0x85, 0xa7, 0x31, 0x21, 0x00, 0x04, 0x19, 0xe4, 0x10, 0xe4, 0x08, 0x03, 0xe5,
+  0x10, 0x10, 0x05, 0x11, 0x81, 0x06, 0x11, 0x0e, 0x05, 0x11, 0x83, 0x25, 0x19, 0x64, 0x29, 0x80, 0x00, 0x15, 0x00, 0x00, 0x85, 0x25, 0x19, 0x05, 0x11, 0x04, 0x11, 0xe7, 0x31, 0xd1, 0x94, 0x0c,
+  0x00, 0x00, 0x87, 0x60, 0x08, 0xa7, 0x29, 0x06, 0x11, 0xe5, 0x10, 0x04, 0x19, 0xa6, 0x29, 0x20, 0x00, 0x13, 0x00, 0x00, 0x83, 0xa0, 0x08, 0xa5, 0x31, 0xe4, 0x10, 0x03, 0xe5, 0x10, 0x84, 0x06,
+  0x11, 0x2a, 0x32, 0x83, 0x00, 0x40, 0x10, 0x1a, 0x00, 0x00, 0x86, 0xb2, 0x94, 0x49, 0x42, 0xc7, 0x31, 0x86, 0x29, 0x25, 0x21, 0xe4, 0x10, 0x03, 0xc3, 0x10, 0x86, 0x08, 0x42, 0x0c, 0x63, 0x00,
+  0x00, 0xc3, 0x10, 0xeb, 0x5a, 0x00, 0x00, 0x02, 0x20, 0x00, 0x82, 0x00, 0x00, 0xc7, 0x39, 0x02, 0x00, 0x00, 0x81, 0xeb, 0x5a, 0x04, 0x04, 0x19, 0x81, 0x03, 0x11, 0x03, 0xe3, 0x10, 0x87, 0x04,
+  0x19, 0x45, 0x21, 0x86, 0x29, 0xa6, 0x29, 0x41, 0x00, 0x40, 0x00, 0x0f, 0x7c, 0x18, 0x00, 0x00, 0x84, 0xa6, 0x29, 0x05, 0x19, 0x44, 0x21, 0x40, 0x00, 0x0d, 0x00, 0x00, 0x85, 0x20, 0x00, 0x67,
+  0x21, 0x25, 0x11, 0xc6, 0x31, 0x07, 0x3a, 0x17, 0x00, 0x00, 0x88, 0x40, 0x00, 0x04, 0x11, 0x46, 0x19, 0xe5, 0x10, 0x06, 0x11, 0xa9, 0x19, 0x4b, 0x32, 0xab, 0x52, 0x57, 0x00, 0x00, 0x82, 0xa9,
+  0x4a, 0x69, 0x4a, 0x0f, 0x00, 0x00, 0x84, 0x20, 0x00, 0x21, 0x00, 0x87, 0x29, 0x2b, 0x63, 0x1a, 0x00, 0x00, 0x86, 0x6d, 0x63, 0xe7, 0x31, 0x26, 0x11, 0x67, 0x11, 0xa8, 0x19, 0x09, 0x3a, 0x7f,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x84, 0x61, 0x00, 0x82, 0x00, 0x66, 0x21, 0x40, 0x00, 0x1f, 0x00, 0x00, 0x83, 0x39, 0x46, 0x10, 0x0e, 0x1e, 0x0a, 0x14, 0x00, 0x00, 0x82, 0x0f, 0x2e, 0x49, 0xa6,
+  0x07, 0xb7, 0xb7, 0x8a, 0xa3, 0x75, 0x6e, 0x67, 0x7e, 0x72, 0x72, 0x55, 0x75, 0x76, 0x52, 0x72, 0x72, 0x53, 0x7f, 0x65, 0x6e, 0x74, 0xa3, 0xb7, 0x02, 0xb7, 0xb7, 0x84, 0xb7, 0x65, 0x67, 0x68,
+  0x7d, 0x5e, 0x1c, 0x00, 0x14, 0x00, 0x00, 0x87, 0x03, 0x5e, 0x60, 0xe8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xb4, 0x3b, 0x1f, 0x00, 0x10, 0x00, 0x00, 0x83, 0x00, 0x1e, 0x6b, 0xc8, 0xfb, 0xff,
+  0x17, 0xff, 0xff, 0x82, 0xff, 0x84, 0x25, 0x00, 0x12, 0x00, 0x00, 0x82, 0x08, 0x78, 0xf4, 0xff, 0x05, 0xff, 0xff, 0x82, 0xf6, 0x42, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x82, 0x00, 0x01, 0x3b, 0xf6,
+  0x1a, 0xff, 0xff, 0x82, 0xf6, 0x49, 0x06, 0x00, 0x10, 0x00, 0x00, 0x82, 0x00, 0x29, 0xd6, 0xff, 0x07, 0xff, 0xff, 0x81, 0xd4, 0x25, 0x0e, 0x00, 0x00, 0x81, 0x14, 0xa7, 0x1c, 0xff, 0xff, 0x81,
+  0xc8, 0x13, 0x10, 0x00, 0x00, 0x81, 0x4f, 0xfc, 0x08, 0xff, 0xff, 0x82, 0xff, 0xe6, 0x34, 0x00, 0x0c, 0x00, 0x00, 0x82, 0x00, 0x38, 0xfb, 0xff, 0x1c, 0xff, 0xff, 0x82, 0xff, 0xe8, 0x2a, 0x00,
+  0x0e, 0x00, 0x00, 0x82, 0x00, 0x40, 0xfd, 0xff, 0x09, 0xff, 0xff, 0x81, 0xd5, 0x29, 0x0c, 0x00, 0x00, 0x81, 0x2e, 0xff, 0x1e, 0xff, 0xff, 0x81, 0xeb, 0x4b, 0x0e, 0x00, 0x00, 0x81, 0x62, 0xff,
+  0x0a, 0xff, 0xff, 0x82, 0xff, 0xea, 0x27, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x00, 0x35, 0x1f, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x2c, 0x00, 0x0c, 0x00, 0x00, 0x82, 0x00, 0x24, 0xf7, 0xff, 0x0b, 0xff,
+  0xff, 0x81, 0xd4, 0x04, 0x0a, 0x00, 0x00, 0x81, 0x25, 0xfb, 0x20, 0xff, 0xff, 0x81, 0xfb, 0x60, 0x0c, 0x00, 0x00, 0x81, 0x00, 0x87, 0x0c, 0xff, 0xff, 0x81, 0xff, 0x87, 0x09, 0x00, 0x00, 0x82,
+  0x00, 0x0d, 0xe6, 0xff, 0x20, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x3a, 0x01, 0x0b, 0x00, 0x00, 0x81, 0x6e, 0xff, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xf7, 0x1c, 0x00, 0x08, 0x00, 0x00, 0x81, 0x01, 0xa3,
+  0x22, 0xff, 0xff, 0x82, 0xff, 0x9b, 0x01, 0x00, 0x09, 0x00, 0x00, 0x82, 0x00, 0x02, 0xc8, 0xff, 0x0d, 0xff, 0xff, 0x81, 0x94, 0x00, 0x08, 0x00, 0x00, 0x81, 0x1e, 0xff, 0x23, 0xff, 0xff, 0x81,
+  0x9b, 0x00, 0x09, 0x00, 0x00, 0x81, 0x00, 0x1f, 0x0e, 0xff, 0xff, 0x81, 0xdf, 0x05, 0x08, 0x00, 0x00, 0x81, 0x88, 0xff, 0x23, 0xff, 0xff, 0x81, 0xff, 0xbb, 0x09, 0x00, 0x00, 0x81, 0x00, 0x5b,
+  0x0e, 0xff, 0xff, 0x81, 0xff, 0x0f, 0x07, 0x00, 0x00, 0x81, 0x00, 0x22, 0x25, 0xff, 0xff, 0x81, 0xc1, 0x01, 0x08, 0x00, 0x00, 0x81, 0x00, 0xc5, 0x0e, 0xff, 0xff, 0x81, 0xff, 0x55, 0x07, 0x00,
+  0x00, 0x81, 0x00, 0x7f, 0x25, 0xff, 0xff, 0x82, 0xff, 0x70, 0x02, 0x00, 0x07, 0x00, 0x00, 0x81, 0x00, 0xee, 0x0e, 0xff, 0xff, 0x81, 0xff, 0x5b, 0x07, 0x00, 0x00, 0x81, 0x00, 0xd0, 0x26, 0xff,
+  0xff, 0x81, 0x76, 0x06, 0x07, 0x00, 0x00, 0x81, 0x00, 0xf5, 0x0e, 0xff, 0xff, 0x81, 0xff, 0x8b, 0x07, 0x00, 0x00, 0x81, 0x00, 0xfc, 0x26, 0xff, 0xff, 0x82, 0xff, 0xc8, 0x0c, 0x00, 0x06, 0x00,
+  0x00, 0x81, 0x03, 0xf6, 0x0e, 0xff, 0xff, 0x81, 0xff, 0x9c, 0x07, 0x00, 0x00, 0x81, 0x29, 0xfe, 0x27, 0xff, 0xff, 0x81, 0xce, 0x12, 0x06, 0x00, 0x00, 0x81, 0x00, 0xee, 0x0e, 0xff, 0xff, 0x81,
+  0xff, 0x9c, 0x07, 0x00, 0x00, 0x81, 0x27, 0xff, 0x27, 0xff, 0xff, 0x82, 0xff, 0xcf, 0x10, 0x00, 0x05, 0x00, 0x00, 0x81, 0x00, 0xdb, 0x0e, 0xff, 0xff, 0x81, 0xff, 0x6d, 0x07, 0x00, 0x00, 0x81,
+  0x5e, 0xff, 0x28, 0xff, 0xff, 0x81, 0xce, 0x0c, 0x05, 0x00, 0x00, 0x81, 0x00, 0x71, 0x0e, 0xff, 0xff, 0x81, 0xff, 0x2c, 0x07, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x28, 0xff, 0xff, 0x82, 0xff, 0x7b,
+  0x02, 0x00, 0x04, 0x00, 0x00, 0x81, 0x00, 0x4b, 0x0e, 0xff, 0xff, 0x81, 0xfd, 0x06, 0x07, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x29, 0xff, 0xff, 0x81, 0x67, 0x00, 0x04, 0x00, 0x00, 0x81, 0x00, 0x33,
+  0x0e, 0xff, 0xff, 0x81, 0x8b, 0x00, 0x07, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x29, 0xff, 0xff, 0x81, 0xe5, 0x0e, 0x05, 0x00, 0x00, 0x81, 0x70, 0xff, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x43, 0x00,
+  0x07, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0x8b, 0x05, 0x00, 0x00, 0x81, 0x14, 0xfe, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xd9, 0x08, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x29, 0xff,
+  0xff, 0x81, 0xff, 0x8c, 0x05, 0x00, 0x00, 0x81, 0x00, 0xa0, 0x0c, 0xff, 0xff, 0x81, 0xfa, 0x1c, 0x08, 0x00, 0x00, 0x81, 0x81, 0xff, 0x2a, 0xff, 0xff, 0x05, 0x00, 0x00, 0x82, 0x00, 0x08, 0xdc,
+  0xff, 0x0b, 0xff, 0xff, 0x81, 0x2a, 0x00, 0x08, 0x00, 0x00, 0x81, 0x75, 0xff, 0x2a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x81, 0x27, 0xf0, 0x0a, 0xff, 0xff, 0x81, 0xff, 0x64, 0x09, 0x00, 0x00, 0x81,
+  0x59, 0xff, 0x2a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x82, 0x00, 0x38, 0xf0, 0xff, 0x09, 0xff, 0xff, 0x81, 0x59, 0x05, 0x09, 0x00, 0x00, 0x81, 0x58, 0xff, 0x2a, 0xff, 0xff, 0x07, 0x00, 0x00, 0x81,
+  0x15, 0xd6, 0x08, 0xff, 0xff, 0x81, 0xff, 0x90, 0x0a, 0x00, 0x00, 0x81, 0x6e, 0xff, 0x2a, 0xff, 0xff, 0x07, 0x00, 0x00, 0x82, 0x00, 0x06, 0x95, 0xf8, 0x06, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x72,
+  0x00, 0x0a, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x2a, 0xff, 0xff, 0x08, 0x00, 0x00, 0x83, 0x00, 0x0a, 0x78, 0xc9, 0xfb, 0xff, 0x03, 0xff, 0xff, 0x82, 0xfd, 0xca, 0x4e, 0x05, 0x0b, 0x00, 0x00, 0x81,
+  0x8a, 0xff, 0x2a, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x85, 0x09, 0x1a, 0x66, 0x66, 0x57, 0x6b, 0x66, 0x2d, 0x12, 0x00, 0x0c, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x2a, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x81,
+  0x8a, 0xff, 0x2a, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x81, 0x6e, 0xff, 0x2a, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x81, 0x56, 0xff, 0x2a, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x81, 0x53, 0xff, 0x29, 0xff, 0xff,
+  0x81, 0xff, 0xcb, 0x1b, 0x00, 0x00, 0x81, 0x50, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa5, 0x1b, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa5, 0x1b, 0x00, 0x00, 0x81, 0x42,
+  0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb2, 0x02, 0x00, 0x00, 0x8c, 0x00, 0x06, 0x3d, 0x23, 0x53, 0x26, 0x74, 0x51, 0x4a, 0x54, 0x54, 0x54, 0x54, 0x56, 0x29, 0x56, 0x55, 0x57, 0x54, 0x30, 0x27,
+  0x25, 0x38, 0x54, 0x07, 0x54, 0x54, 0x81, 0x54, 0x1c, 0x05, 0x00, 0x00, 0x81, 0x4a, 0xff, 0x29, 0xff, 0xff, 0x84, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x18, 0x8f, 0xe3, 0x13, 0xff, 0xff, 0x81, 0xb4,
+  0x2e, 0x04, 0x00, 0x00, 0x81, 0x61, 0xff, 0x29, 0xff, 0xff, 0x83, 0xff, 0xcb, 0x00, 0x00, 0x2b, 0xe6, 0x14, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x30, 0x00, 0x03, 0x00, 0x00, 0x81, 0x3a, 0xff, 0x29,
+  0xff, 0xff, 0x82, 0xff, 0xe3, 0x00, 0x29, 0x16, 0xff, 0xff, 0x81, 0xff, 0x27, 0x03, 0x00, 0x00, 0x81, 0x32, 0xff, 0x29, 0xff, 0xff, 0x82, 0xff, 0xef, 0x04, 0x9a, 0x16, 0xff, 0xff, 0x82, 0xff,
+  0xed, 0x08, 0x00, 0x02, 0x00, 0x00, 0x81, 0x32, 0xff, 0x29, 0xff, 0xff, 0x82, 0xff, 0xfa, 0x39, 0xff, 0x17, 0xff, 0xff, 0x81, 0x34, 0x00, 0x02, 0x00, 0x00, 0x81, 0x33, 0xff, 0x2a, 0xff, 0xff,
+  0x81, 0x93, 0xff, 0x17, 0xff, 0xff, 0x81, 0x73, 0x00, 0x02, 0x00, 0x00, 0x81, 0x73, 0xff, 0x2a, 0xff, 0xff, 0x81, 0xc1, 0xff, 0x17, 0xff, 0xff, 0x81, 0x9f, 0x00, 0x02, 0x00, 0x00, 0x81, 0x7d,
+  0xff, 0x2a, 0xff, 0xff, 0x81, 0x7e, 0xff, 0x17, 0xff, 0xff, 0x81, 0xcd, 0x00, 0x02, 0x00, 0x00, 0x81, 0x7d, 0xff, 0x2a, 0xff, 0xff, 0x81, 0xb7, 0xff, 0x17, 0xff, 0xff, 0x81, 0x77, 0x00, 0x02,
+  0x00, 0x00, 0x81, 0x8a, 0xff, 0x2a, 0xff, 0xff, 0x81, 0x70, 0xff, 0x17, 0xff, 0xff, 0x81, 0x76, 0x00, 0x02, 0x00, 0x00, 0x81, 0x6f, 0xff, 0x2a, 0xff, 0xff, 0x81, 0x0f, 0xf2, 0x16, 0xff, 0xff,
+  0x82, 0xff, 0x98, 0x04, 0x00, 0x02, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x2a, 0xff, 0xff, 0x81, 0x00, 0x40, 0x16, 0xff, 0xff, 0x81, 0xff, 0x2a, 0x03, 0x00, 0x00, 0x81, 0x86, 0xff, 0x2a, 0xff, 0xff,
+  0x82, 0x00, 0x00, 0x4b, 0xff, 0x14, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x70, 0x00, 0x03, 0x00, 0x00, 0x81, 0x6a, 0xff, 0x2a, 0xff, 0xff, 0x83, 0x00, 0x00, 0x00, 0x2f, 0xf4, 0xff, 0x13, 0xff, 0xff,
+  0x81, 0xe5, 0x62, 0x04, 0x00, 0x00, 0x81, 0x7c, 0xff, 0x2a, 0xff, 0xff, 0x02, 0x00, 0x00, 0x84, 0x02, 0x53, 0x64, 0x3c, 0x57, 0x8c, 0xeb, 0xff, 0x0d, 0xff, 0xff, 0x84, 0xff, 0xfb, 0x9c, 0x2e,
+  0x47, 0x20, 0x01, 0x00, 0x04, 0x00, 0x00, 0x81, 0x39, 0xff, 0x2a, 0xff, 0xff, 0x05, 0x00, 0x00, 0x81, 0x54, 0xff, 0x0d, 0xff, 0xff, 0x81, 0xff, 0x42, 0x07, 0x00, 0x00, 0x81, 0x4c, 0xff, 0x2a,
+  0xff, 0xff, 0x05, 0x00, 0x00, 0x81, 0x01, 0xd1, 0x0d, 0xff, 0xff, 0x81, 0x71, 0x00, 0x07, 0x00, 0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xef, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7,
+  0x0d, 0xff, 0xff, 0x81, 0x1f, 0x00, 0x07, 0x00, 0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xcb, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x3c, 0x00, 0x07, 0x00,
+  0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xbf, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x3c, 0x00, 0x07, 0x00, 0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81,
+  0xff, 0xb2, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x27, 0x00, 0x07, 0x00, 0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa2, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7,
+  0x0d, 0xff, 0xff, 0x81, 0x17, 0x00, 0x07, 0x00, 0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa5, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x16, 0x00, 0x07, 0x00,
+  0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb2, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x15, 0x00, 0x07, 0x00, 0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81,
+  0xff, 0xbf, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x14, 0x00, 0x07, 0x00, 0x00, 0x81, 0x45, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xd8, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7,
+  0x0c, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x0d, 0x00, 0x07, 0x00, 0x00, 0x81, 0x48, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xe3, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xf7,
+  0x03, 0x00, 0x07, 0x00, 0x00, 0x81, 0x7b, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xe3, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x86, 0xff,
+  0x29, 0xff, 0xff, 0x81, 0xff, 0xcb, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x64, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa1, 0x05, 0x00,
+  0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x64, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0x9b, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81,
+  0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x64, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb8, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x7d, 0xff,
+  0x29, 0xff, 0xff, 0x81, 0xff, 0xb7, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x86, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb7, 0x05, 0x00,
+  0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xf7, 0x01, 0x00, 0x07, 0x00, 0x00, 0x81, 0x86, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb7, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff,
+  0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x6c, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb7, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81,
+  0x5c, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb7, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x5c, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb7,
+  0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x54, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb7, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff,
+  0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x4e, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xc7, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81,
+  0x52, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa2, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x52, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xbf,
+  0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x65, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xcb, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff,
+  0xff, 0x82, 0xff, 0xf7, 0x02, 0x00, 0x07, 0x00, 0x00, 0x81, 0x6e, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa2, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x81, 0x76, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0x98, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfd, 0x0f, 0x00, 0x07, 0x00, 0x00, 0x81, 0x8a, 0xff,
+  0x29, 0xff, 0xff, 0x81, 0xff, 0xc6, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x10, 0x00, 0x07, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xbd,
+  0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfd, 0x0f, 0x00, 0x07, 0x00, 0x00, 0x81, 0x8a, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0x99, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7,
+  0x0c, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x81, 0x67, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xa0, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfa,
+  0x07, 0x00, 0x07, 0x00, 0x00, 0x81, 0x89, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0x7f, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x04, 0x00, 0x07, 0x00, 0x00, 0x81,
+  0x2f, 0xff, 0x29, 0xff, 0xff, 0x81, 0xff, 0xb7, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xf6, 0x01, 0x00, 0x07, 0x00, 0x00, 0x81, 0x27, 0xff, 0x29, 0xff, 0xff, 0x81,
+  0xff, 0x60, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x0f, 0xfd, 0x29, 0xff, 0xff, 0x81, 0xff, 0x43, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7,
+  0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x81, 0x01, 0xca, 0x29, 0xff, 0xff, 0x81, 0xfa, 0x09, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00,
+  0x00, 0x81, 0x00, 0x51, 0x29, 0xff, 0xff, 0x81, 0xb5, 0x00, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x82, 0x00, 0x1f, 0xfa, 0xff, 0x28, 0xff,
+  0xff, 0x81, 0x28, 0x00, 0x05, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x09, 0x00, 0x00, 0x81, 0x7a, 0xff, 0x27, 0xff, 0xff, 0x81, 0xff, 0x68, 0x06, 0x00, 0x00, 0x81,
+  0x00, 0xb7, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x09, 0x00, 0x00, 0x81, 0x1c, 0xff, 0x27, 0xff, 0xff, 0x81, 0xfa, 0x25, 0x06, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfa,
+  0x08, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x7f, 0x27, 0xff, 0xff, 0x81, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x11, 0x00, 0x08, 0x00, 0x00, 0x82,
+  0x00, 0x17, 0xb1, 0xff, 0x25, 0xff, 0xff, 0x82, 0xff, 0x52, 0x01, 0x00, 0x06, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x12, 0x00, 0x09, 0x00, 0x00, 0x81, 0x22, 0xf6, 0x25, 0xff,
+  0xff, 0x81, 0xde, 0x06, 0x07, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x15, 0x00, 0x09, 0x00, 0x00, 0x82, 0x00, 0x26, 0xf8, 0xff, 0x23, 0xff, 0xff, 0x82, 0xff, 0xe2, 0x16, 0x00,
+  0x07, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x19, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x46, 0xf6, 0x23, 0xff, 0xff, 0x81, 0xcc, 0x10, 0x08, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff,
+  0xff, 0x81, 0x21, 0x00, 0x0a, 0x00, 0x00, 0x82, 0x00, 0x1f, 0x96, 0xff, 0x21, 0xff, 0xff, 0x82, 0xff, 0x67, 0x08, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x1d, 0x00,
+  0x0b, 0x00, 0x00, 0x82, 0x03, 0x90, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0x82, 0xff, 0x90, 0x29, 0x00, 0x09, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x3a, 0x00, 0x0c, 0x00, 0x00, 0x81,
+  0x2b, 0x71, 0x1e, 0xff, 0xff, 0x82, 0xff, 0xdc, 0x7d, 0x03, 0x0a, 0x00, 0x00, 0x81, 0x00, 0xb7, 0x0d, 0xff, 0xff, 0x81, 0x26, 0x00, 0x0d, 0x00, 0x00, 0x82, 0x1b, 0xab, 0xf6, 0xff, 0x1b, 0xff,
+  0xff, 0x82, 0xd6, 0x85, 0x37, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x00, 0xba, 0x0d, 0xff, 0xff, 0x81, 0x3c, 0x00, 0x0e, 0x00, 0x00, 0x86, 0x14, 0x33, 0x31, 0x4c, 0x61, 0x8d, 0x96, 0xa1, 0x5b, 0x57,
+  0x7c, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xb2, 0xd4, 0x7a, 0x0c, 0xff, 0xff, 0x86, 0xff, 0x92, 0x7b, 0x8a, 0x6c, 0x72, 0xac, 0x89, 0x65, 0x37, 0x32, 0x08, 0x0d, 0x00, 0x00, 0x81, 0x00, 0xbf,
+  0x0d, 0xff, 0xff, 0x81, 0x1f, 0x00, 0x13, 0x00, 0x00, 0x85, 0x14, 0x84, 0xff, 0xff, 0xef, 0xff, 0x4a, 0x2a, 0x01, 0x25, 0x0c, 0xff, 0xff, 0x84, 0xff, 0x65, 0x00, 0x00, 0x01, 0x03, 0x03, 0x00,
+  0x0f, 0x00, 0x00, 0x81, 0x15, 0xfc, 0x0d, 0xff, 0xff, 0x83, 0x7e, 0x1f, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x85, 0x34, 0x9e, 0xff, 0xe3, 0xdd, 0x40, 0x00, 0x00, 0x00, 0x2a, 0x0c, 0xff,
+  0xff, 0x81, 0xff, 0xd7, 0x0e, 0x00, 0x00, 0x82, 0x00, 0x0a, 0x72, 0xdc, 0x02, 0xea, 0xea, 0x81, 0xfc, 0xff, 0x0d, 0xff, 0xff, 0x84, 0xff, 0xf8, 0xeb, 0xec, 0xbe, 0xee, 0xa7, 0x39, 0x0c, 0x00,
+  0x00, 0x89, 0x02, 0x03, 0x03, 0x02, 0x03, 0x04, 0x1c, 0x42, 0xc9, 0xff, 0xff, 0xcb, 0x89, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x25, 0x00, 0x0d, 0x00, 0x00, 0x81,
+  0x1b, 0xe1, 0x15, 0xff, 0xff, 0x81, 0x4b, 0x01, 0x0a, 0x00, 0x00, 0x85, 0x00, 0x07, 0x06, 0x0a, 0x0d, 0x67, 0x2a, 0xa4, 0xc4, 0xff, 0x02, 0xff, 0xff, 0x83, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x89,
+  0x0d, 0xff, 0xff, 0x81, 0x2d, 0x00, 0x0c, 0x00, 0x00, 0x82, 0x00, 0x34, 0xef, 0xff, 0x15, 0xff, 0xff, 0x81, 0xff, 0x3b, 0x0a, 0x00, 0x00, 0x84, 0x00, 0x55, 0x8b, 0x67, 0x6c, 0xe3, 0x98, 0xff,
+  0x03, 0xff, 0xff, 0x83, 0xe3, 0x2c, 0x00, 0x00, 0x00, 0x7b, 0x0d, 0xff, 0xff, 0x81, 0x7c, 0x05, 0x0c, 0x00, 0x00, 0x81, 0x00, 0xcc, 0x16, 0xff, 0xff, 0x82, 0xff, 0xf3, 0x0e, 0x00, 0x09, 0x00,
+  0x00, 0x83, 0x59, 0xf5, 0xca, 0x97, 0xa3, 0xff, 0x04, 0xff, 0xff, 0x83, 0x90, 0x02, 0x00, 0x00, 0x00, 0x7d, 0x0d, 0xff, 0xff, 0x81, 0xf1, 0x0a, 0x0c, 0x00, 0x00, 0x81, 0x2c, 0xfa, 0x17, 0xff,
+  0xff, 0x81, 0x3c, 0x00, 0x09, 0x00, 0x00, 0x82, 0x2a, 0x9f, 0xfa, 0xff, 0x05, 0xff, 0xff, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x0d, 0xff, 0xff, 0x82, 0xfd, 0x74, 0x04, 0x00, 0x0b, 0x00,
+  0x00, 0x81, 0x71, 0xff, 0x17, 0xff, 0xff, 0x81, 0xb5, 0x00, 0x09, 0x00, 0x00, 0x81, 0xa6, 0xff, 0x05, 0xff, 0xff, 0x84, 0xff, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x03, 0x8e, 0x0d, 0xff, 0xff, 0x82,
+  0xff, 0x7c, 0x0f, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x51, 0xff, 0x17, 0xff, 0xff, 0x81, 0x93, 0x00, 0x08, 0x00, 0x00, 0x82, 0x00, 0x03, 0x96, 0xff, 0x05, 0xff, 0xff, 0x81, 0xd4, 0x0e, 0x02, 0x00,
+  0x00, 0x81, 0x13, 0xff, 0x05, 0xff, 0xff, 0x82, 0xff, 0xf2, 0x4a, 0x93, 0x06, 0xff, 0xff, 0x82, 0xff, 0x92, 0x0e, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x81, 0xff, 0x17, 0xff, 0xff, 0x81, 0xf6, 0x00,
+  0x08, 0x00, 0x00, 0x81, 0x00, 0x56, 0x05, 0xff, 0xff, 0x82, 0xfd, 0x9c, 0x02, 0x00, 0x02, 0x00, 0x00, 0x81, 0x44, 0xff, 0x05, 0xff, 0xff, 0x83, 0xd3, 0x23, 0x00, 0x00, 0x92, 0xff, 0x05, 0xff,
+  0xff, 0x82, 0xff, 0xf9, 0xaa, 0x01, 0x0b, 0x00, 0x00, 0x81, 0x8b, 0xff, 0x17, 0xff, 0xff, 0x81, 0xf6, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x4f, 0x04, 0xff, 0xff, 0x82, 0xff, 0xee, 0x6a, 0x00,
+  0x03, 0x00, 0x00, 0x81, 0x70, 0xff, 0x04, 0xff, 0xff, 0x85, 0xff, 0xb7, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xfa, 0xff, 0x05, 0xff, 0xff, 0x81, 0x7d, 0x07, 0x0b, 0x00, 0x00, 0x81, 0x6a, 0xff,
+  0x17, 0xff, 0xff, 0x81, 0xc9, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x65, 0x04, 0xff, 0xff, 0x81, 0xeb, 0x18, 0x03, 0x00, 0x00, 0x82, 0x00, 0x1e, 0xf9, 0xff, 0x03, 0xff, 0xff, 0x82, 0xff, 0xfd,
+  0x4c, 0x00, 0x03, 0x00, 0x00, 0x81, 0x55, 0xfa, 0x05, 0xff, 0xff, 0x81, 0xd0, 0x22, 0x0b, 0x00, 0x00, 0x81, 0x05, 0xeb, 0x17, 0xff, 0xff, 0x81, 0x26, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0xc5,
+  0x03, 0xff, 0xff, 0x82, 0xff, 0xc8, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0x30, 0x04, 0xff, 0xff, 0x81, 0xcb, 0x1b, 0x04, 0x00, 0x00, 0x82, 0x00, 0x22, 0xe3, 0xff, 0x04, 0xff, 0xff, 0x82,
+  0x8a, 0x2a, 0x0d, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x00, 0x24, 0x16, 0xff, 0xff, 0x81, 0xff, 0x60, 0x09, 0x00, 0x00, 0x81, 0x00, 0xe6, 0x03, 0xff, 0xff, 0x81, 0x62, 0x04, 0x04, 0x00, 0x00, 0x81,
+  0x00, 0x5e, 0x03, 0xff, 0xff, 0x82, 0xff, 0x76, 0x09, 0x00, 0x05, 0x00, 0x00, 0x81, 0x0a, 0xb8, 0x04, 0xff, 0xff, 0x82, 0xfe, 0x26, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x5d, 0xff, 0x15, 0xff,
+  0xff, 0x81, 0xf0, 0x07, 0x09, 0x00, 0x00, 0x81, 0x00, 0xea, 0x02, 0xff, 0xff, 0x81, 0xf9, 0x6a, 0x05, 0x00, 0x00, 0x81, 0x00, 0x84, 0x03, 0xff, 0xff, 0x81, 0x8f, 0x00, 0x06, 0x00, 0x00, 0x82,
+  0x00, 0x04, 0x80, 0xff, 0x03, 0xff, 0xff, 0x82, 0xff, 0x67, 0xbe, 0x02, 0x0b, 0x00, 0x00, 0x81, 0x00, 0x72, 0x14, 0xff, 0xff, 0x82, 0xff, 0xd4, 0x25, 0x00, 0x09, 0x00, 0x00, 0x84, 0x00, 0xe6,
+  0xff, 0xff, 0xff, 0xdd, 0x14, 0x00, 0x05, 0x00, 0x00, 0x81, 0x01, 0xc6, 0x02, 0xff, 0xff, 0x82, 0x88, 0x23, 0x01, 0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x41, 0xd8, 0xff, 0x02, 0xff, 0xff, 0x82,
+  0xff, 0xf8, 0x70, 0x23, 0x0c, 0x00, 0x00, 0x82, 0x34, 0x7a, 0xfa, 0xff, 0x11, 0xff, 0xff, 0x82, 0xfb, 0xd3, 0x4f, 0x07, 0x0a, 0x00, 0x00, 0x83, 0x00, 0xe7, 0xff, 0xff, 0xc0, 0x1e, 0x06, 0x00,
+  0x00, 0x84, 0x02, 0xfd, 0xff, 0xff, 0xfc, 0x8b, 0x05, 0x00, 0x09, 0x00, 0x00, 0x82, 0x08, 0x7e, 0xe9, 0xff, 0x02, 0xff, 0xff, 0x81, 0x84, 0x17, 0x0d, 0x00, 0x00, 0x82, 0x15, 0x32, 0x39, 0x40,
+  0x02, 0x40, 0x40, 0x87, 0x40, 0x35, 0x3c, 0x24, 0x40, 0x53, 0x25, 0x28, 0x28, 0x26, 0x44, 0x1f, 0x1e, 0x46, 0x05, 0x40, 0x40, 0x83, 0x40, 0x36, 0x28, 0x25, 0x15, 0x00, 0x0b, 0x00, 0x00, 0x83,
+  0x00, 0xec, 0xf3, 0x70, 0x06, 0x00, 0x06, 0x00, 0x00, 0x83, 0x03, 0xfd, 0xff, 0xdb, 0x39, 0x00, 0x0b, 0x00, 0x00, 0x84, 0x0b, 0x77, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x84, 0x2b, 0x00, 0x00, 0x82,
+  0x00, 0x5d, 0x24, 0x00, 0x07, 0x00, 0x00, 0x82, 0x01, 0x87, 0xa0, 0x18, 0x0d, 0x00, 0x00, 0x83, 0x19, 0xb5, 0xfe, 0xff, 0xff, 0xbc, 0x44, 0x00, 0x00, 0x82, 0x16, 0x49, 0xb7, 0x74, 0x0a, 0x00,
+  0x00,
 };
 
 const lv_image_dsc_t img_info = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 140,
   .header.h = 127,
-  .data_size = 17780 * 3,
+  .header.stride = 280,
+  .data_size = sizeof(img_info_map),
   .data = img_info_map,
 };
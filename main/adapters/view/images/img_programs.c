@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_programs.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,282 +24,1378 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_PROGRAMS uint8_t img_programs_map[] = {
-  0x6b, 0xad, 0x6d, 0x9e, 0xb5, 0xde, 0x08, 0x86, 0xb0, 0xde, 0xf5, 0xdf, 0xf3, 0xd7, 0xe8, 0xc7, 0xf5, 0xdf, 0xb0, 0xde, 0xb0, 0xde, 0x6d, 0x9e, 0x08, 0x86, 0x6b, 0x85, 0xd2, 0xbd, 0x6b, 0x85, 0x66, 0x9e, 0x05, 0x84, 0x66, 0x9e, 0xce, 0x95, 0x00, 0x5c, 0x6b, 0xad, 0x65, 0x85, 0x85, 0x74, 0x0b, 0x84, 0xb0, 0xae, 0x08, 0x86, 0x6b, 0x85, 0x05, 0x84, 0x6b, 0x85, 0x6b, 0x85, 0x89, 0x74, 0x6b, 0x85, 0x89, 0x74, 0x05, 0x84, 0x00, 0x84, 0xc6, 0x6c, 0x08, 0x86, 0x6d, 0x9e, 0xbb, 0xde, 0x10, 0xc6, 0xc6, 0x6c, 0x6b, 0xad, 0x6d, 0x9e, 0x00, 0x5c, 0x05, 0x84, 0x05, 0x84, 0x00, 0x5c, 0x05, 0x84, 0x05, 0x84, 0x6b, 0x85, 0x6b, 0xad, 0x65, 0x85, 0x6d, 0x9e, 0x6b, 0xad, 0x70, 0xad, 0x14, 0xc7, 0xf3, 0xd7, 0xc6, 0x9c, 0x6b, 0xad, 0xc0, 0x6c, 0xd7, 0xbd, 0xd2, 0xbd, 0xb5, 0xaa, 0xda, 0xd4, 0x18, 0x84, 0xcd, 0x34, 0x8e, 0x2c, 0x8e, 0x3b, 0x8b, 0x3b, 0x0c, 0x43, 0xb0, 0x5a, 0x10, 0x84, 0xfb, 0xdf, 0xf3, 0xd7, 0xb5, 0xae, 0x70, 0xad, 0x10, 0x86, 0x18, 0x86, 0x10, 0xc6, 0x6d, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd, 0x10, 0x86, 0xf3, 0xd7, 0xf7, 0xbf, 0xf5, 0xdf, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xb5, 0xde, 0xf2, 0xbe, 0x6d, 0x9e, 0x70, 0xad, 0x70, 0x85, 0x00, 0x5c, 0x6b, 0xad, 0x6b, 0x85, 0xd3, 0x9c, 0xf7, 0xbe, 0xf5, 0xdf, 0xfa, 0xd7, 0xfb, 0xdf, 0xb0, 0xae, 0x6d, 0xd6, 0x6d, 0xd6, 0xf8, 0xe7, 0xf0, 0xff, 0xf3, 0xd7, 0xf5, 0xdf, 0xf0, 0xff, 0x39, 0xff, 0xb5, 0xde, 0xb0, 0xae, 0x6d, 0x9e, 0xb0, 0xae, 0x0b, 0x84, 0xb0, 0xae, 0xf5, 0xdf, 0x73, 0xd6, 0x08, 0x86, 0x70, 0xad, 0x10, 0x86, 0x73, 0x9e, 0x73, 0xd6, 0x10, 0xc6, 0xf2, 0xbe, 0xfa, 0xff, 0x75, 0xad, 0xff, 0xff, 0x7a, 0xd6, 0x6b, 0x85, 0x6b, 0x5d, 0xb0, 0xae, 0x6b, 0x85, 0xc6, 0x9c, 0x8e, 0x94, 0x65, 0x85, 0x70, 0xad, 
-  0xb0, 0xae, 0x14, 0xc7, 0x55, 0xce, 0x73, 0x9e, 0xb0, 0xae, 0xb5, 0xde, 0x14, 0xc7, 0xf7, 0xff, 0x6d, 0xd6, 0xf0, 0xff, 0xf7, 0xdf, 0x6b, 0xad, 0x6d, 0x9e, 0x6d, 0x9e, 0x6b, 0xad, 0xc6, 0x9c, 0xb0, 0xae, 0xb0, 0xae, 0x6d, 0x9e, 0x6b, 0x85, 0x00, 0x84, 0x05, 0x84, 0x89, 0x74, 0x89, 0x94, 0x65, 0x85, 0x70, 0xad, 0x6d, 0xd6, 0x70, 0xad, 0xce, 0x95, 0xf2, 0xbe, 0x6b, 0x85, 0x05, 0x5c, 0xc0, 0x6c, 0xc6, 0x9c, 0x66, 0x9e, 0x66, 0x9e, 0x08, 0xc6, 0xf5, 0xdf, 0xf8, 0xe7, 0xf0, 0xff, 0xf3, 0xd7, 0x6d, 0x9e, 0x05, 0x84, 0x6b, 0x85, 0xc0, 0x6c, 0x65, 0x85, 0xce, 0x95, 0x66, 0x9e, 0xc6, 0x9c, 0xce, 0xdd, 0xb0, 0xde, 0xc6, 0x6c, 0xed, 0xd7, 0x6b, 0xad, 0x66, 0x9e, 0x70, 0xdd, 0x73, 0xd6, 0xd2, 0x75, 0xfc, 0xbe, 0x7f, 0xdf, 0xb5, 0x74, 0xce, 0x42, 0xac, 0x42, 0xea, 0x29, 0x8b, 0x42, 0xac, 0x42, 0x88, 0x01, 0x47, 0x09, 0xa8, 0x21, 0xc8, 0x21, 0xa7, 0x19, 0xc8, 0x21, 0xc9, 0x21, 0xca, 0x19, 0x0e, 0x4b, 0xcd, 0x4a, 0x4c, 0x3a, 0x4f, 0x5b, 0x92, 0x4b, 0xda, 0x9d, 0x1f, 0xc7, 0x9e, 0xd7, 0x1c, 0xc7, 0xfc, 0xcf, 0xfb, 0xbf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc7, 0x08, 0x46, 0x75, 0xad, 0x6d, 0x9e, 0xc6, 0x6c, 0x05, 0x84, 0x05, 0x84, 0x05, 0x84, 0x65, 0x85, 0x6d, 0x9e, 0x6b, 0xad, 0xf2, 0xbe, 0xf3, 0xd7, 0xf3, 0xd7, 0xf3, 0xff, 0xf3, 0xd7, 0x73, 0xd6, 0x6d, 0xd6, 0xf7, 0xdf, 0xf3, 0xff, 0xf5, 0xdf, 0xf3, 0xd7, 0xe8, 0xc7, 0x6d, 0x9e, 0xf3, 0xd7, 0x05, 0x5c, 0x00, 0x5c, 0x6b, 0x85, 0xc6, 0x9c, 0x73, 0xd6, 0xff, 0xff, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xfc, 0xc7, 0xff, 0xd7, 0xff, 0xff, 0xf3, 0xff, 0x73, 0xd6, 0xff, 0xff, 0xfa, 0x9f, 0x1c, 0xa7, 0xf7, 0x96, 0xf7, 0xbe, 0x70, 0xad, 0xf7, 0xde, 0xfb, 0xdf, 0xb0, 0xae, 0x6d, 0x9e, 0xb0, 0xae, 
-  0x05, 0x5c, 0x70, 0xad, 0x6d, 0xd6, 0xb5, 0xae, 0x6b, 0xad, 0xf7, 0xdf, 0xf7, 0xdf, 0xb0, 0xae, 0xf2, 0xde, 0xed, 0xd7, 0xf5, 0xdf, 0xf3, 0xd7, 0xf2, 0xde, 0x35, 0xcf, 0xb5, 0xfe, 0x6d, 0xd6, 0x08, 0x86, 0xab, 0xae, 0x66, 0x6e, 0x6b, 0xad, 0x89, 0x94, 0x89, 0x94, 0x6b, 0x85, 0x6b, 0x85, 0x6b, 0x85, 0x6b, 0x85, 0x05, 0x5c, 0x85, 0x74, 0xce, 0xbd, 0xce, 0x95, 0x6b, 0x85, 0xc0, 0x6c, 0x00, 0x86, 0xf7, 0xdf, 0xe8, 0xc7, 0xf0, 0xff, 0xf5, 0xdf, 0xf8, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xb0, 0xae, 0x6b, 0x85, 0xc0, 0x6c, 0x6b, 0x85, 0x00, 0x84, 0x6b, 0x85, 0xe8, 0xc7, 0x6d, 0xd6, 0xf4, 0xe7, 0xf4, 0xe7, 0x6b, 0xad, 0xfc, 0xae, 0xd5, 0x7c, 0x4f, 0x53, 0x0e, 0x53, 0x70, 0x5b, 0x0a, 0x32, 0x05, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x11, 0xa8, 0x21, 0x0d, 0x53, 0xd0, 0x63, 0x36, 0x8d, 0x7e, 0xb7, 0xbf, 0xdf, 0xfd, 0xdf, 0xff, 0xd7, 0x7f, 0x9e, 0x18, 0x86, 0x10, 0x46, 0xc6, 0x34, 0x40, 0x6b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x84, 0xb0, 0xae, 0xf2, 0xbe, 0xc0, 0x6c, 0x00, 0x86, 0xe0, 0xc7, 0xf5, 0xdf, 0xf3, 0xff, 0xf3, 0xff, 0xf5, 0xdf, 0x6d, 0xd6, 0xf7, 0xdf, 0xf8, 0xe7, 0xf8, 0xff, 0xf5, 0xdf, 0xf3, 0xd7, 0xc6, 0x6c, 0x65, 0x85, 0x05, 0x84, 0x00, 0x84, 0x6b, 0x85, 0x70, 0xad, 0xf8, 0xc7, 0xff, 0xd7, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xdf, 0xfd, 0xd7, 0xfc, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xff, 0xdf, 0xff, 0x87, 0xfa, 0x9f, 0xbb, 0xae, 0x73, 0x6e, 0xb5, 0x86, 0xfb, 0xdf, 0xff, 0xff, 0xf2, 0xbe, 0xc6, 0x9c, 0x70, 0xad, 
-  0x60, 0x73, 0xc6, 0x9c, 0x66, 0x9e, 0x14, 0xe7, 0x08, 0x86, 0x08, 0xc6, 0x66, 0x9e, 0xf5, 0xdf, 0xf0, 0xff, 0x08, 0xc6, 0xf5, 0xdf, 0xb0, 0xde, 0x73, 0xd6, 0xf2, 0xbe, 0x18, 0xff, 0x73, 0xfe, 0x73, 0xd6, 0xc6, 0x6c, 0x05, 0x84, 0x00, 0x5c, 0xc0, 0x6c, 0xc6, 0x6c, 0x6b, 0x85, 0x89, 0x94, 0x05, 0x84, 0x00, 0x84, 0x60, 0x73, 0x00, 0x84, 0x10, 0xa5, 0x89, 0x74, 0xc0, 0x6c, 0xcd, 0x9c, 0x66, 0x9e, 0xf5, 0xdf, 0xf0, 0xff, 0xf7, 0xdf, 0xfb, 0xef, 0xfc, 0xf7, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xc6, 0x6c, 0xb0, 0xde, 0x6b, 0x85, 0xc0, 0x6c, 0x00, 0x5c, 0x00, 0x5c, 0x18, 0xc7, 0x34, 0x8d, 0xeb, 0x42, 0x29, 0x32, 0x66, 0x11, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0xe9, 0x31, 0xed, 0x4a, 0x94, 0x7c, 0x7d, 0xbe, 0xfe, 0xc7, 0xfa, 0x37, 0x73, 0x06, 0x40, 0x33, 0x00, 0x5c, 0x6b, 0x85, 0x00, 0x5c, 0xf2, 0xbe, 0x6d, 0x9e, 0x00, 0x86, 0xe0, 0xc7, 0xf3, 0xd7, 0xf3, 0xff, 0xf5, 0xff, 0xf7, 0xdf, 0xf8, 0xe7, 0xf9, 0xe7, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xf8, 0xff, 0xb0, 0xde, 0xf2, 0xbe, 0xb0, 0xae, 0x00, 0x5c, 0x60, 0x85, 0x65, 0x85, 0x73, 0x9e, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0x87, 0xff, 0x5f, 0xfd, 0xd7, 0xfc, 0xcf, 0xfa, 0xff, 0x9b, 0xff, 0xdd, 0xff, 0xdd, 0xff, 0xbd, 0xff, 0xf4, 0xa7, 0xfa, 0x9f, 0xfb, 0xaf, 0xf8, 0x47, 0xf8, 0x87, 0xfb, 0xbe, 0x75, 0xad, 0xff, 0xff, 0xf8, 0xe7, 0x73, 0xd6, 0xab, 0x5a, 
-  0xce, 0x95, 0xd2, 0xbd, 0x70, 0xad, 0xf0, 0xff, 0xf7, 0xdf, 0xb0, 0xae, 0xb0, 0xae, 0x6b, 0xad, 0x08, 0x86, 0x08, 0x86, 0xf3, 0xd7, 0xf0, 0xff, 0x08, 0xc6, 0x6d, 0x9e, 0xb0, 0xde, 0x14, 0xc7, 0x6b, 0x85, 0x6b, 0xad, 0x66, 0x6e, 0x6b, 0x85, 0x66, 0x9e, 0x66, 0x9e, 0xc6, 0x9c, 0x00, 0x84, 0xc6, 0x9c, 0xc6, 0x6c, 0xa6, 0x31, 0x65, 0x73, 0x00, 0x63, 0x89, 0x94, 0x08, 0xc4, 0x75, 0xad, 0x10, 0x86, 0xf3, 0xd7, 0xf7, 0xfe, 0x9e, 0xe7, 0xbf, 0xe7, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xe7, 0xf7, 0xdf, 0xf6, 0xd7, 0xf2, 0xbf, 0xf2, 0xdf, 0xb0, 0x86, 0x91, 0x95, 0xaa, 0x42, 0xa7, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x8b, 0x42, 0xb5, 0x8c, 0xde, 0xbe, 0xbf, 0xae, 0x73, 0x9e, 0xf0, 0xc7, 0x73, 0x9e, 0x73, 0xee, 0x54, 0xff, 0xb5, 0xde, 0xf2, 0xde, 0x76, 0xfe, 0xf7, 0xff, 0xf0, 0xff, 0xf5, 0xdf, 0xf9, 0xff, 0xf7, 0xdf, 0xf9, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xff, 0xff, 0x18, 0xc6, 0x7a, 0x9e, 0xcd, 0x34, 0xbb, 0xae, 0xfb, 0xaf, 0xfc, 0xcf, 0x9f, 0xbe, 0xfa, 0xbf, 0xdc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x3a, 0xd7, 0xf5, 0x87, 0xf7, 0x96, 0xff, 0xc7, 0x1f, 0xf8, 0xb0, 0xae, 0xce, 0x95, 0xd3, 0x34, 
-  0x00, 0x86, 0x66, 0x9e, 0xc6, 0x9c, 0xf5, 0xdf, 0xf7, 0xde, 0x14, 0xc7, 0xb0, 0xae, 0xb0, 0xae, 0x6d, 0x9e, 0x6b, 0xad, 0xab, 0xae, 0xf2, 0xde, 0xf5, 0xdf, 0x14, 0xc7, 0xf3, 0xd7, 0xce, 0xbd, 0xb0, 0xae, 0xce, 0x95, 0x85, 0x74, 0x65, 0x85, 0x00, 0x5c, 0x00, 0x5c, 0x70, 0xad, 0xc6, 0x6c, 0x89, 0x74, 0x0b, 0x84, 0x08, 0x82, 0x70, 0xdd, 0x76, 0xfe, 0xdd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb9, 0xde, 0xec, 0x52, 0x26, 0x11, 0xe6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x26, 0x19, 0x11, 0x74, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7c, 0xff, 0x97, 0xff, 0x57, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xef, 0xfd, 0xef, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xbf, 0x7a, 0x06, 0xd3, 0x34, 0xf2, 0x4e, 0x18, 0xa7, 0x7a, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xd7, 0xff, 0xd7, 0xff, 0xff, 0xed, 0xd7, 0x70, 0x85, 0x73, 0x6e, 
-  0xc6, 0x6c, 0x6b, 0x85, 0x6b, 0x85, 0xf2, 0xde, 0xd2, 0xdd, 0x14, 0xe6, 0xc6, 0x9c, 0x10, 0xa5, 0xce, 0xbd, 0xb0, 0xde, 0xf2, 0xde, 0xb0, 0xae, 0x66, 0x9e, 0x73, 0xd6, 0xb0, 0xae, 0x6b, 0xad, 0x6b, 0x85, 0x10, 0xa6, 0x65, 0x85, 0x05, 0x84, 0xc6, 0x6c, 0xc6, 0x6c, 0x7a, 0xd6, 0x75, 0xad, 0x66, 0x9e, 0x05, 0xac, 0x19, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0xe6, 0x08, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x63, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 0x28, 0x01, 0x08, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x14, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdc, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x7f, 0xdf, 0x1c, 0x86, 0x18, 0x66, 0xdd, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfa, 0xff, 0xe8, 0xc7, 0x08, 0x86, 
-  0x65, 0x85, 0x66, 0x9e, 0x6b, 0xad, 0xb0, 0xae, 0xd2, 0xdd, 0xf2, 0xbe, 0xc6, 0x9c, 0x6d, 0x9e, 0xb0, 0xae, 0x05, 0x5c, 0x70, 0xad, 0x05, 0x84, 0xb0, 0xae, 0x6b, 0x85, 0xce, 0x95, 0x60, 0x73, 0x65, 0x85, 0x65, 0x73, 0x6b, 0x85, 0x8e, 0x94, 0x66, 0x6e, 0x05, 0x84, 0x10, 0x84, 0x4d, 0x9b, 0xd9, 0xee, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xb7, 0xbd, 0x72, 0x8c, 0x8e, 0x6b, 0x47, 0x21, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x47, 0x19, 0x67, 0x19, 0x27, 0x19, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xa6, 0x00, 0x97, 0xe6, 0xbd, 0xff, 0xdd, 0xff, 0xbd, 0xff, 0x9d, 0xff, 0x7c, 0xf7, 0x7c, 0xef, 0x3b, 0xef, 0xfa, 0xe6, 0xba, 0xde, 0x37, 0xce, 0xd6, 0xc5, 0x74, 0xb5, 0xd2, 0x9c, 0x92, 0x94, 0x92, 0x94, 0x91, 0x94, 0xb2, 0x94, 0xd2, 0x9c, 0x50, 0x8c, 0xec, 0x62, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x11, 0x06, 0x19, 0x27, 0x19, 0x8f, 0x6b, 0x55, 0xad, 0x3c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xf7, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x58, 0xc6, 0x8e, 0x6b, 0x05, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xe5, 0x10, 0x8b, 0x52, 0x75, 0xad, 0x7d, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xfd, 0xff, 0xf5, 0xff, 0x6d, 0x9e, 
-  0x60, 0x4b, 0x00, 0x5c, 0x65, 0x85, 0x6b, 0x85, 0xf2, 0xbe, 0xf2, 0xbe, 0x6d, 0x9e, 0x08, 0x86, 0x00, 0x84, 0x65, 0x85, 0x6b, 0x85, 0x89, 0x74, 0x6b, 0x85, 0x6b, 0x85, 0x85, 0x74, 0x05, 0x84, 0x05, 0x84, 0x00, 0x5c, 0x6b, 0x85, 0xb0, 0xae, 0x00, 0x5c, 0x65, 0x85, 0x4d, 0x6b, 0x3a, 0xe7, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xcb, 0x5a, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x07, 0x01, 0x28, 0x01, 0xea, 0x41, 0xbc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xdd, 0xff, 0xdc, 0xff, 0x7b, 0xff, 0xe5, 0x20, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xcf, 0x73, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xef, 0xec, 0x5a, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x08, 0x35, 0xa5, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9c, 0xff, 0xff, 0xff, 0x6d, 0x9e, 
-  0x05, 0x5c, 0x89, 0x74, 0xf2, 0xbe, 0x05, 0x84, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xce, 0x95, 0xce, 0x95, 0xce, 0x95, 0x65, 0x73, 0x00, 0x5c, 0x00, 0x5c, 0x70, 0xad, 0xb0, 0xae, 0x65, 0x85, 0x05, 0x84, 0x6b, 0x85, 0x6b, 0x85, 0x08, 0x42, 0x08, 0x42, 0x4d, 0x9b, 0x1b, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x2c, 0x63, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0x07, 0x01, 0xa9, 0x21, 0x5b, 0xf7, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0xdd, 0xff, 0x0b, 0x63, 0x64, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x26, 0x19, 0x18, 0xbe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x14, 0x9d, 0xb2, 0x8c, 0xd3, 0x9c, 0xf8, 0xbd, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0xa7, 0x31, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xf0, 0x7b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe7, 0xff, 0xff, 
-  0x05, 0x5c, 0x00, 0x5c, 0xce, 0x95, 0x6b, 0x85, 0xc0, 0x6c, 0xb0, 0xae, 0xb0, 0xae, 0x6b, 0xad, 0xc6, 0x9c, 0xc6, 0x6c, 0xc6, 0x6c, 0x00, 0x84, 0x60, 0x73, 0x89, 0x74, 0x00, 0x5c, 0x6b, 0x85, 0x6b, 0x85, 0x00, 0x86, 0xb0, 0xae, 0xd3, 0x9c, 0x46, 0x9b, 0x6e, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0x05, 0x11, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xe8, 0x39, 0xaa, 0x52, 0x8d, 0x73, 0xd6, 0xb5, 0xdc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x99, 0xd6, 0x87, 0x31, 0x43, 0x00, 0x63, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0x55, 0xad, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x2d, 0x63, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x8f, 0x6b, 0xda, 0xde, 0xff, 0xff, 0x7d, 0xef, 0x08, 0x3a, 0xc4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x51, 0x84, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 
-  0x65, 0x73, 0x65, 0x85, 0xb0, 0xae, 0x65, 0x85, 0xb0, 0xae, 0xf2, 0xbe, 0xb0, 0xae, 0x6d, 0x9e, 0xc6, 0x9c, 0xc6, 0x9c, 0x05, 0x84, 0x05, 0x84, 0x60, 0x4b, 0x04, 0x44, 0x60, 0x4b, 0x00, 0x5c, 0x0b, 0x84, 0x6d, 0xd6, 0xf2, 0xde, 0x8e, 0xbc, 0x89, 0xdc, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x55, 0xad, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x47, 0x11, 0xcf, 0x73, 0x96, 0xad, 0x59, 0xc6, 0xfb, 0xd6, 0x1b, 0xdf, 0x1b, 0xdf, 0xfa, 0xd6, 0xda, 0xd6, 0xfa, 0xd6, 0x3b, 0xe7, 0x9c, 0xef, 0xdd, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xef, 0x7c, 0xe7, 0x3b, 0xdf, 0xda, 0xd6, 0x17, 0xbe, 0xb2, 0x8c, 0x87, 0x19, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xcf, 0x7b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x8a, 0x4a, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xd0, 0x7b, 0xa7, 0x29, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x0c, 0x5b, 0x38, 0xc6, 0x5c, 0xe7, 0x9d, 0xef, 0xba, 0xd6, 0xf0, 0x7b, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x79, 0xce, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0xff, 0xff, 
-  0x65, 0x85, 0x89, 0x94, 0x6d, 0x9e, 0x6d, 0x9e, 0xb0, 0xde, 0x6d, 0x9e, 0xf2, 0xde, 0x66, 0x6e, 0xc6, 0x6c, 0x6d, 0x9e, 0xb0, 0xae, 0x89, 0x74, 0x6b, 0x85, 0xce, 0x95, 0x60, 0x4b, 0x00, 0x5c, 0x00, 0x5c, 0x0b, 0x84, 0xb0, 0xae, 0xab, 0xde, 0xf9, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf6, 0xbd, 0xa3, 0x00, 0x83, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0x8f, 0x63, 0x79, 0xce, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0x7c, 0xef, 0x3b, 0xe7, 0xfa, 0xde, 0xda, 0xde, 0xda, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0xb9, 0xd6, 0x99, 0xce, 0x79, 0xce, 0x58, 0xc6, 0x79, 0xce, 0x99, 0xce, 0x99, 0xce, 0x99, 0xce, 0xba, 0xd6, 0xfb, 0xde, 0x5d, 0xef, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x79, 0xce, 0xec, 0x5a, 0xa5, 0x00, 0xa5, 0x00, 0xc8, 0x31, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x49, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xb2, 0x94, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x49, 0x42, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd3, 0xd4, 
-  0x05, 0x84, 0x0c, 0xa5, 0x6d, 0xd6, 0x08, 0x86, 0xb5, 0xde, 0xb0, 0xae, 0xf7, 0xde, 0x66, 0x9e, 0xb0, 0xae, 0x73, 0xd6, 0x6d, 0x9e, 0x05, 0x5c, 0x05, 0x84, 0x0c, 0x84, 0x60, 0x4b, 0x05, 0x84, 0x6b, 0x85, 0x00, 0x5c, 0x0b, 0x84, 0x08, 0xa5, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xab, 0x52, 0xfb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x14, 0x9d, 0xcb, 0x52, 0x05, 0x11, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc8, 0x29, 0x92, 0x8c, 0x59, 0xce, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0x46, 0x21, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x29, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x51, 0x84, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x4a, 0xe7, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x59, 0xe6, 
-  0x65, 0x85, 0x65, 0x85, 0x6d, 0x9e, 0xb0, 0xae, 0xf2, 0xde, 0xf7, 0xbe, 0x73, 0xd6, 0xb0, 0xae, 0xb0, 0xae, 0xf2, 0xbe, 0x05, 0x84, 0x05, 0x84, 0xce, 0x95, 0x89, 0x94, 0x6b, 0x85, 0x00, 0x5c, 0x60, 0x73, 0x00, 0x5c, 0x00, 0x83, 0x0a, 0xb4, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x6d, 0x6b, 0x63, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xae, 0x73, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xb6, 0xb5, 0xc8, 0x31, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe5, 0x08, 0xd0, 0x73, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x28, 0x42, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x8a, 0x52, 0x38, 0xc6, 0xb9, 0xd6, 0x55, 0xad, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x96, 0xad, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x3c, 0xe7, 0x31, 0x84, 0x2a, 0x01, 0x6a, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 
-  0x00, 0x5c, 0x05, 0x84, 0x6b, 0xad, 0x6b, 0x85, 0xf3, 0xd7, 0x00, 0x86, 0x08, 0x86, 0x6d, 0x9e, 0x6d, 0x9e, 0xd2, 0xbd, 0x66, 0x9e, 0x05, 0x5c, 0x6b, 0xad, 0x6b, 0xad, 0xce, 0x95, 0x05, 0x84, 0x05, 0x84, 0x60, 0x4b, 0x00, 0x83, 0x56, 0xce, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xde, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0xa3, 0x00, 0x29, 0x42, 0xde, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xde, 0x4a, 0x42, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xcc, 0x52, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xff, 0xab, 0x52, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xcf, 0x73, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x50, 0x8c, 0xde, 0xff, 0x5c, 0xe7, 0x71, 0x8c, 0xa6, 0x00, 0x08, 0x01, 0x29, 0x01, 0x4a, 0x01, 0x8b, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xaf, 0x73, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 
-  0x08, 0x86, 0x6b, 0x85, 0x85, 0x74, 0x6b, 0x85, 0x6d, 0x9e, 0x08, 0x86, 0xb0, 0xae, 0x6b, 0x85, 0xce, 0x95, 0x60, 0x85, 0xc6, 0x9c, 0xc6, 0x9c, 0x65, 0x85, 0xb0, 0xae, 0x6d, 0x9e, 0xd2, 0xbd, 0x89, 0x94, 0x65, 0x73, 0x00, 0x43, 0x7c, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0x54, 0xad, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x79, 0xce, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x72, 0x8c, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xff, 0xec, 0x5a, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x2c, 0x63, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0xc7, 0x31, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x2a, 0x3a, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0x46, 0x21, 0x07, 0x01, 0x08, 0x01, 0x28, 0x01, 0x28, 0x01, 0x4a, 0x01, 0x6a, 0x01, 0x8b, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xae, 0x73, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 
-  0xc6, 0x9c, 0x6b, 0x85, 0x00, 0x5c, 0x00, 0x5c, 0xc0, 0x6c, 0x08, 0x86, 0x66, 0x6e, 0x00, 0x86, 0xc6, 0x9c, 0x70, 0xad, 0x70, 0xad, 0x6d, 0x9e, 0x66, 0x6e, 0x6b, 0xad, 0x66, 0x9e, 0xc6, 0x9c, 0x8e, 0xbc, 0x0b, 0x84, 0x65, 0x73, 0xbd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb1, 0x94, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0xa3, 0x00, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xde, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xe7, 0x00, 0x0b, 0x2a, 0x4c, 0x3a, 0x8a, 0x21, 0xe8, 0x00, 0x28, 0x01, 0x07, 0x01, 0xe5, 0x00, 0xe4, 0x00, 0xe4, 0x00, 0xe4, 0x00, 0xc4, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x29, 0x42, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xff, 0xaa, 0x52, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xec, 0x52, 0xde, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xf7, 0x8a, 0x52, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x87, 0x21, 0x9e, 0xef, 0x9a, 0xce, 0x05, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x07, 0x01, 0x49, 0x01, 0x49, 0x01, 0x6a, 0x01, 0x8a, 0x01, 0x6a, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x92, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 
-  0x89, 0x94, 0x00, 0x5c, 0x65, 0x73, 0x05, 0x84, 0x6b, 0x85, 0x6d, 0x9e, 0xb0, 0xae, 0x6d, 0x9e, 0xb0, 0xae, 0x6b, 0xad, 0x14, 0xc7, 0xb0, 0xae, 0x08, 0x86, 0x6d, 0x9e, 0xb0, 0xde, 0x08, 0xc6, 0xc6, 0xd4, 0x00, 0x84, 0x05, 0x84, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x91, 0x94, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0xa8, 0x31, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xe7, 0x00, 0xcb, 0x08, 0x2f, 0x11, 0x4e, 0x02, 0x92, 0x02, 0x55, 0x02, 0xd2, 0x01, 0x6f, 0x11, 0xaf, 0x11, 0x6f, 0x11, 0xee, 0x20, 0x6e, 0x29, 0xce, 0x49, 0x4e, 0x4a, 0x6d, 0x4a, 0x4c, 0x5a, 0x2c, 0x4a, 0xcb, 0x41, 0xcb, 0x41, 0xca, 0x41, 0x09, 0x3a, 0x0b, 0x3a, 0xcb, 0x39, 0x69, 0x19, 0xa7, 0x08, 0xc8, 0x09, 0x08, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x84, 0x00, 0xb7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xff, 0x2c, 0x63, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xcb, 0x52, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x73, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x99, 0xce, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x6d, 0x6b, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0x69, 0x01, 0x6a, 0x01, 0xab, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x59, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x55, 0xe6, 
-  0x6b, 0xad, 0x6b, 0xad, 0x66, 0x9e, 0x65, 0x73, 0xc6, 0x9c, 0x08, 0x86, 0x08, 0x86, 0xc6, 0x6c, 0xc6, 0x9c, 0x00, 0x5c, 0x70, 0xad, 0xf2, 0xbe, 0xd2, 0xdd, 0x14, 0xe6, 0x6d, 0xd6, 0x70, 0xad, 0xc6, 0x6c, 0x66, 0x9e, 0x00, 0x86, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd2, 0x9c, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8e, 0x6b, 0xa4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x83, 0x00, 0xe5, 0x08, 0x90, 0x12, 0xb5, 0x4a, 0x3c, 0xe7, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0x5c, 0xef, 0x71, 0x94, 0x86, 0x01, 0x24, 0x01, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x15, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xff, 0xcb, 0x5a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x29, 0x42, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x8c, 0xc4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x87, 0x29, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x9d, 0x84, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0x8a, 0x01, 0x48, 0x01, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa7, 0x29, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xdc, 
-  0x10, 0xc6, 0xb0, 0xae, 0x65, 0x85, 0x6b, 0x85, 0x65, 0x85, 0xc6, 0x9c, 0xc6, 0x6c, 0x65, 0x85, 0x6b, 0x85, 0xc6, 0x6c, 0xb0, 0xae, 0x6b, 0xad, 0xb0, 0xde, 0x73, 0xfe, 0x6b, 0x85, 0x66, 0x6e, 0xc6, 0x9c, 0xc0, 0x6c, 0xce, 0x95, 0xdd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x54, 0xad, 0x83, 0x00, 0x83, 0x00, 0x84, 0x00, 0xc4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0xc4, 0x00, 0x55, 0x44, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0x74, 0xa5, 0x48, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x76, 0xad, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0xeb, 0x5a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa7, 0x31, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x66, 0x21, 0x99, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0x26, 0x19, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xd7, 0xb5, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xdb, 0xfd, 
-  0x14, 0xc6, 0xf2, 0xbe, 0x05, 0x84, 0x70, 0xad, 0xab, 0xae, 0x08, 0x86, 0xc6, 0x9c, 0x6b, 0x85, 0x6d, 0x9e, 0x66, 0x6e, 0xb0, 0xae, 0x6b, 0xad, 0xf2, 0xbe, 0xf2, 0xbe, 0x6d, 0x9e, 0x6b, 0x85, 0x05, 0x84, 0x00, 0x5c, 0xa0, 0x72, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc5, 0x84, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x08, 0x3a, 0xa3, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x0e, 0x23, 0xdf, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x8e, 0x73, 0x48, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x59, 0xc6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xff, 0xec, 0x5a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x87, 0x29, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0x76, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0xc8, 0x31, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xae, 0x73, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0x10, 0xfe, 
-  0x65, 0x85, 0x70, 0xad, 0xce, 0xbd, 0xb0, 0xae, 0x6d, 0x9e, 0x00, 0x86, 0xf5, 0xdf, 0xf2, 0xde, 0xb0, 0xde, 0x6d, 0xd6, 0xb0, 0xde, 0xf7, 0xde, 0xf9, 0xe7, 0xf7, 0xdf, 0x73, 0xd6, 0x6b, 0xad, 0x00, 0x5c, 0x00, 0x84, 0x5a, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xd6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xde, 0xa4, 0x00, 0xa3, 0x00, 0xa3, 0x00, 0x83, 0x00, 0xe5, 0x00, 0x5e, 0xcf, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xda, 0xd6, 0xe9, 0x01, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x11, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x8e, 0x6b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x25, 0x19, 0x1c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xef, 0x46, 0x21, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x8e, 0x6b, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xe6, 0x08, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0x28, 0x42, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xfd, 0xb5, 0xfa, 
-  0x60, 0x6e, 0x00, 0x5c, 0x6b, 0x85, 0x6d, 0x9e, 0xc6, 0x6c, 0x00, 0x86, 0x66, 0x9e, 0xf0, 0xff, 0x18, 0xe7, 0xf5, 0xdf, 0xf8, 0xe7, 0xf5, 0xff, 0xf0, 0xff, 0xf5, 0xdf, 0xf0, 0xc7, 0x00, 0x86, 0x00, 0xac, 0xdc, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf3, 0x9c, 0x84, 0x00, 0xa3, 0x00, 0xa3, 0x00, 0xa3, 0x00, 0xf0, 0x63, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x9d, 0xef, 0xe9, 0x11, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xaf, 0x73, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x10, 0x84, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0x69, 0x4a, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x69, 0x01, 0xe7, 0x00, 0x83, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x87, 0x29, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x6b, 0x09, 0xe6, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x21, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0xad, 0xb5, 0xaa, 0xb5, 0xfa, 
-  0x05, 0x84, 0x00, 0x5c, 0x00, 0x84, 0xb0, 0xae, 0x89, 0x74, 0x6b, 0x85, 0xb0, 0xae, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf8, 0xe7, 0xf8, 0xff, 0x3a, 0xff, 0x39, 0xff, 0xf0, 0xff, 0x05, 0xac, 0x1a, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x92, 0x94, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xab, 0x52, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x2c, 0x63, 0xa3, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfb, 0xd6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x25, 0x01, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x9a, 0xce, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x99, 0xd6, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x83, 0x00, 0x17, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x73, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x73, 0xad, 0x1b, 0xdf, 0x10, 0x0a, 0xe8, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0x14, 0x9d, 0xbe, 0xf7, 0x2e, 0x32, 0xee, 0x01, 0xee, 0x01, 0xc6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x99, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xbe, 0x05, 0xac, 0xab, 0xaa, 0xab, 0x5a, 
-  0x00, 0x5c, 0x00, 0x5c, 0x00, 0x84, 0x00, 0x5c, 0x66, 0x9e, 0x65, 0x85, 0xb0, 0xae, 0xf8, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf9, 0xe7, 0xf9, 0xff, 0x39, 0xff, 0x35, 0xff, 0xe8, 0xff, 0xca, 0xec, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0x2c, 0x5b, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x15, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x11, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x83, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x29, 0x42, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x92, 0x94, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x55, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xf3, 0x9c, 0xfe, 0xff, 0xfe, 0xff, 0x9e, 0xef, 0xb5, 0x8c, 0x4a, 0x01, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x87, 0x21, 0xcc, 0x01, 0x0f, 0x02, 0xad, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x75, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xf7, 0x05, 0x5c, 0x46, 0x9b, 0x10, 0xc4, 0x08, 0x44, 
-  0x69, 0x73, 0x89, 0x74, 0xce, 0x95, 0x05, 0x84, 0x89, 0x74, 0xc6, 0x6c, 0x6b, 0x85, 0xf3, 0xff, 0xf7, 0xdf, 0xf9, 0xe7, 0xfa, 0xff, 0x39, 0xff, 0xf5, 0xff, 0xb5, 0xde, 0x89, 0xfc, 0xdd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x4d, 0x6b, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x14, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x25, 0x19, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x37, 0xce, 0x83, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x6a, 0x4a, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2d, 0x63, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x58, 0xc6, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0x10, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x28, 0x09, 0xe6, 0x00, 0x84, 0x00, 0x84, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xcc, 0x01, 0xe6, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x51, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x08, 0xc4, 0x08, 0x42, 0xa6, 0x31, 0x10, 0x84, 0x00, 0x5c, 
-  0x89, 0x94, 0x89, 0x94, 0x69, 0x73, 0x00, 0x5c, 0x05, 0x84, 0x70, 0xad, 0x66, 0x6e, 0xf3, 0xd7, 0xf7, 0xdf, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf5, 0xdf, 0x6d, 0x9e, 0x97, 0xee, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x96, 0xb5, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x08, 0x3a, 0x92, 0x94, 0x30, 0x84, 0x25, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x79, 0xce, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x1a, 0xdf, 0xfb, 0xde, 0x1b, 0xe7, 0x1b, 0xe7, 0x3b, 0xe7, 0x1b, 0xe7, 0x3c, 0xe7, 0x3c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xca, 0x5a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x8e, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x08, 0x42, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0xda, 0xd6, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xd6, 0x05, 0x11, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xce, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x31, 0x84, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2d, 0x63, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xd2, 0xdd, 0xa6, 0x69, 0xa0, 0x31, 0xc6, 0x6c, 0xcd, 0x9c, 0x46, 0x6b, 
-  0x8e, 0x94, 0x89, 0x74, 0x60, 0x4b, 0x00, 0x5c, 0x65, 0x73, 0x66, 0x9e, 0xf7, 0xde, 0xf8, 0xe7, 0xf8, 0xe7, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x25, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xb2, 0x94, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xef, 0xab, 0x52, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x49, 0x42, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x05, 0x19, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x78, 0xce, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x64, 0x00, 0x46, 0x19, 0x11, 0x7c, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x3b, 0xe7, 0xa3, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x9e, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x6e, 0x73, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x19, 0x79, 0xd6, 0x7c, 0xef, 0x67, 0x21, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xab, 0x52, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x92, 0x8c, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xa5, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x29, 0x3a, 0x9e, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x35, 0xcf, 0xc0, 0xd4, 0xa0, 0x82, 0x00, 0x42, 0x60, 0x85, 0x6b, 0x85, 0x08, 0x42, 
-  0x0c, 0x85, 0xc9, 0x95, 0x65, 0x85, 0x00, 0x84, 0x66, 0x6e, 0xc6, 0x9c, 0xf2, 0xbe, 0xf7, 0xdf, 0xf8, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x99, 0xce, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x6a, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xa5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x05, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x58, 0xce, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x0d, 0x5b, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x6a, 0x4a, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x38, 0xc6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x95, 0xad, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe8, 0x29, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x05, 0x19, 0x3c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x13, 0x9d, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa7, 0x29, 0x3c, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5a, 0xff, 0x0b, 0x84, 0x08, 0x64, 0x89, 0x74, 0x05, 0x84, 0x60, 0x73, 0xc6, 0x6c, 0x65, 0x85, 
-  0x65, 0x85, 0x89, 0x94, 0x89, 0x74, 0x05, 0x84, 0x6d, 0x9e, 0xb0, 0xae, 0xf2, 0xde, 0xf3, 0xd7, 0xf7, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfb, 0xbe, 0xbd, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x54, 0xad, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xd4, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x3b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x58, 0xce, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xb2, 0x94, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0x63, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x84, 0x00, 0x58, 0xce, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x75, 0xad, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x27, 0x01, 0xe5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x9a, 0xd6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xff, 0xcd, 0x6c, 0x00, 0x5c, 0x05, 0x5c, 0x05, 0x5c, 0x05, 0x84, 0x00, 0x5c, 0x6b, 0x85, 0x6b, 0x85, 
-  0x70, 0xad, 0x65, 0x85, 0x6b, 0x85, 0xb0, 0xae, 0x6d, 0xd6, 0xf5, 0xdf, 0x14, 0xe7, 0xf3, 0xd7, 0xf7, 0xdf, 0xf5, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0x5b, 0xff, 0x32, 0x84, 0x37, 0xbe, 0xff, 0xff, 0xfe, 0xff, 0xf3, 0x9c, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xd3, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x06, 0x11, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x7c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x66, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x8a, 0x4a, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0x63, 0x00, 0x84, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x54, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x58, 0xce, 0xa6, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xf7, 0xbd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7a, 0xd6, 0x60, 0x85, 0xc0, 0x95, 0x05, 0x84, 0x05, 0x84, 0x00, 0x5c, 0x85, 0x74, 0x00, 0x5c, 0x6b, 0x85, 
-  0x60, 0x85, 0xb0, 0xae, 0x05, 0xac, 0x55, 0xe6, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf7, 0xdf, 0xf8, 0xe7, 0xf5, 0xdf, 0xf5, 0xff, 0xfa, 0xff, 0x74, 0xa5, 0xc4, 0x10, 0x14, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0xb6, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x66, 0x29, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x08, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xf1, 0x73, 0x30, 0x5b, 0x2d, 0x32, 0x4b, 0x11, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x29, 0x01, 0x48, 0x01, 0xc5, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe8, 0x39, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x64, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x38, 0xc6, 0x46, 0x21, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x71, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xde, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x54, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xdf, 0xb0, 0xae, 0xab, 0xae, 0x00, 0x5c, 0x00, 0x84, 0x00, 0x84, 0x60, 0x6e, 0xc0, 0x6c, 0x6b, 0x85, 
-  0xc6, 0x9c, 0x6d, 0x9e, 0xf2, 0xde, 0x55, 0xfe, 0xf7, 0xdf, 0xf7, 0xdf, 0xf3, 0xff, 0xf3, 0xd7, 0xb0, 0xde, 0x14, 0xc6, 0xb0, 0xde, 0x5a, 0xef, 0xa7, 0x29, 0xa4, 0x00, 0xab, 0x52, 0xff, 0xff, 0xfe, 0xff, 0x3c, 0xe7, 0x83, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x29, 0x42, 0xbb, 0xde, 0xfe, 0xff, 0xde, 0xff, 0x59, 0xc6, 0x46, 0x21, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x3a, 0xbe, 0xbf, 0xc6, 0xd4, 0x01, 0x11, 0x02, 0x71, 0x02, 0x73, 0x02, 0xd3, 0x02, 0xd2, 0x02, 0x51, 0x03, 0xf1, 0x02, 0x27, 0x01, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xf8, 0xbd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xab, 0x52, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xdd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0xe5, 0x08, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xae, 0x73, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0xe6, 0x08, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xd2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0x6d, 0x9e, 0x00, 0x86, 0x6d, 0x9e, 0x6d, 0x9e, 0x6d, 0x9e, 0xc6, 0x9c, 0xc6, 0x6c, 0xb0, 0xae, 
-  0x00, 0x5c, 0x66, 0x9e, 0xb0, 0xde, 0xb5, 0xde, 0x6d, 0x9e, 0xf7, 0xdf, 0xf7, 0xff, 0xf5, 0xdf, 0xf3, 0xd7, 0x6d, 0x9e, 0xab, 0xde, 0xcb, 0x52, 0x83, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x7d, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xcf, 0x7b, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x43, 0x00, 0x84, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x66, 0x21, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x5c, 0xe7, 0xd2, 0x4b, 0x48, 0x09, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x2d, 0x63, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x51, 0x8c, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x9d, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x29, 0x42, 0xbe, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0xa8, 0x29, 0xc7, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x30, 0x84, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x34, 0xa5, 0x9f, 0xef, 0xff, 0xf7, 0xfe, 0xf7, 0xf8, 0xff, 0xf0, 0xc7, 0x6d, 0x9e, 0xb0, 0xae, 0xb0, 0xae, 0x66, 0x6e, 0x6d, 0x9e, 0x66, 0x9e, 0xc6, 0x6c, 
-  0x00, 0x5c, 0x66, 0x6e, 0xb0, 0xae, 0xf3, 0xff, 0xf2, 0xde, 0xf3, 0xd7, 0xf3, 0xff, 0xeb, 0xff, 0xf0, 0xc7, 0xff, 0xbe, 0x35, 0x85, 0x25, 0x19, 0x84, 0x00, 0x84, 0x00, 0x83, 0x00, 0xf3, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0xc7, 0x31, 0x84, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x05, 0x11, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x18, 0xb6, 0xc5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf3, 0x9c, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x5c, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x1b, 0xdf, 0xa7, 0x29, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x25, 0x19, 0x3c, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x6e, 0x6b, 0xc7, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x2c, 0x63, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x34, 0xa5, 0xa5, 0x00, 0xb4, 0x8c, 0xdf, 0xef, 0xfe, 0xff, 0xf7, 0xff, 0xf3, 0xd7, 0xf3, 0xd7, 0xb0, 0xae, 0xb5, 0xde, 0xb0, 0xde, 0xf2, 0xbe, 0x60, 0x9e, 0x66, 0x9e, 
-  0xd2, 0xbd, 0x65, 0x85, 0x6d, 0xd6, 0xc6, 0x9c, 0x73, 0xd6, 0xf7, 0xdf, 0xf3, 0xd7, 0xeb, 0xff, 0xf0, 0xff, 0x18, 0xc6, 0x47, 0x21, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x83, 0x00, 0xa4, 0x08, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x29, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xe8, 0x31, 0xfb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x37, 0xc6, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x31, 0x84, 0xa5, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0x9d, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf4, 0x9c, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x5b, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7c, 0xef, 0x86, 0x29, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x59, 0xce, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x75, 0xad, 0xc7, 0x00, 0xc7, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x8a, 0x42, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xc4, 0x00, 0xc5, 0x00, 0x46, 0x19, 0x1f, 0xdf, 0xfc, 0xff, 0xf9, 0xff, 0xf8, 0xe7, 0xf7, 0xff, 0xf4, 0xe7, 0xf5, 0xdf, 0xf5, 0xdf, 0xf7, 0xdf, 0xf2, 0xde, 0x6d, 0xd6, 
-  0x65, 0x85, 0x00, 0x5c, 0x6b, 0x85, 0x6d, 0x9e, 0xf2, 0xde, 0xb0, 0xae, 0xf0, 0xc7, 0xeb, 0xff, 0xf0, 0xff, 0x52, 0x94, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xc5, 0x00, 0x6e, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x96, 0xb5, 0x69, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xd7, 0xbd, 0xde, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x1c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd3, 0x94, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0x9d, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xb3, 0x94, 0x84, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x5c, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xec, 0x5a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x34, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb9, 0xd6, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x86, 0x21, 0x5c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0x3b, 0xe7, 0xc5, 0x08, 0xa5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x2e, 0x5b, 0xbf, 0xef, 0xff, 0xff, 0xf8, 0xe7, 0xf8, 0xe7, 0xf3, 0xff, 0xf3, 0xff, 0xf5, 0xdf, 0xf7, 0xde, 0x66, 0x9e, 0xf0, 0xc7, 
-  0x05, 0x84, 0xc6, 0x6c, 0x66, 0x6e, 0xab, 0xae, 0xb0, 0xde, 0x65, 0x85, 0x6d, 0xd6, 0x73, 0xfe, 0xfb, 0xff, 0x6b, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x1b, 0xe7, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x1c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8b, 0x4a, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x08, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8e, 0x6b, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xbd, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf3, 0x9c, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xaf, 0x73, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7c, 0xef, 0xc6, 0x08, 0xa7, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xba, 0xd6, 0xff, 0xff, 0xfe, 0xff, 0xdc, 0xf7, 0x2a, 0x3a, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xe5, 0x08, 0x3a, 0xae, 0xff, 0xe7, 0xf5, 0xff, 0xf0, 0xff, 0xf3, 0xff, 0xeb, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0x6d, 0xd6, 0x6d, 0x9e, 
-  0x08, 0x86, 0x6d, 0x9e, 0x08, 0x86, 0x60, 0x9e, 0x00, 0x86, 0x6d, 0x9e, 0x6d, 0xd6, 0x75, 0xfd, 0x33, 0x95, 0xc5, 0x08, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xf0, 0x7b, 0x9e, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xde, 0x84, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xbe, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x5c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x71, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x08, 0x3a, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x99, 0xd6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x8a, 0x4a, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x4d, 0x63, 0xc7, 0x00, 0xc7, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x18, 0xc6, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x4d, 0x63, 0xe7, 0x00, 0xc6, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xab, 0x42, 0xff, 0xc7, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xe7, 0xf7, 0xdf, 0xeb, 0xff, 0xb5, 0xde, 
-  0x6d, 0xd6, 0xf3, 0xd7, 0xe8, 0xc7, 0xf7, 0xdf, 0xe8, 0xc7, 0x6d, 0xd6, 0x6d, 0xd6, 0x59, 0xfe, 0x6a, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xe6, 0x08, 0x5c, 0xe7, 0xff, 0xff, 0x99, 0xce, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xbe, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x7d, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x3c, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xff, 0x84, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x50, 0x8c, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7c, 0xef, 0xa7, 0x29, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x25, 0x19, 0x3c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf3, 0x9c, 0xc6, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x75, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x71, 0x8c, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x10, 0x3e, 0xbe, 0xf7, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xf5, 0xdf, 0xf0, 0xff, 0xf2, 0xbe, 
-  0xf3, 0xff, 0xf3, 0xd7, 0xf0, 0xff, 0xf8, 0xe7, 0xf0, 0xc7, 0xcd, 0xd4, 0xd2, 0xfd, 0x58, 0xde, 0x05, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x5d, 0xe7, 0xff, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xbe, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x4d, 0x63, 0x6d, 0x63, 0x6d, 0x6b, 0xae, 0x73, 0xce, 0x73, 0xce, 0x73, 0xee, 0x73, 0xef, 0x73, 0xae, 0x73, 0x66, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xd6, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xda, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0xeb, 0x5a, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd7, 0xbd, 0xc7, 0x00, 0xc7, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x71, 0x84, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb5, 0xb5, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x2e, 0x53, 0xfc, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf5, 0xdf, 0xf5, 0xdf, 0x10, 0x86, 
-  0xb0, 0xde, 0xf3, 0xd7, 0xf7, 0xdf, 0xf7, 0xff, 0xf0, 0xff, 0x08, 0xc6, 0xd2, 0xdd, 0xac, 0x52, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x7d, 0xef, 0xff, 0xff, 0x38, 0xc6, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xbe, 0xe5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x4a, 0x42, 0xbe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x93, 0x8c, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x70, 0x8c, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x10, 0x84, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x92, 0x8c, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x59, 0xc6, 0xa7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2d, 0x63, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x58, 0xce, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xe7, 0x00, 0xc6, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa8, 0x29, 0x9f, 0xcf, 0xfa, 0xd7, 0xf8, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xf7, 0xdf, 
-  0xf3, 0xd7, 0xf5, 0xff, 0xf7, 0xdf, 0xf5, 0xdf, 0xeb, 0xff, 0x08, 0xc6, 0x10, 0xa4, 0x05, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x9d, 0xef, 0xff, 0xff, 0x38, 0xc6, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xbe, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe8, 0x31, 0x5c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0x26, 0x11, 0xc5, 0x00, 0xc5, 0x00, 0x8d, 0x73, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd3, 0x9c, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0x8d, 0x6b, 0xde, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xc7, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa7, 0x31, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xda, 0xde, 0xc6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x74, 0x7c, 0xfa, 0xd7, 0xf5, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf3, 0xd7, 0xf3, 0xff, 0xf8, 0xe7, 
-  0x6d, 0x9e, 0x6d, 0xd6, 0xf3, 0xd7, 0xf0, 0xc7, 0xeb, 0xff, 0x66, 0x9e, 0x13, 0x74, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x26, 0x01, 0x7d, 0xef, 0xff, 0xff, 0x79, 0xce, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x59, 0xce, 0xa5, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x28, 0x2a, 0x7c, 0xdf, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x96, 0xb5, 0xc6, 0x00, 0xe6, 0x00, 0x8a, 0x4a, 0xbd, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xc6, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x49, 0x42, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x5d, 0xe7, 0x07, 0x09, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x66, 0x21, 0x1b, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xdf, 0xe6, 0x08, 0xc6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xcc, 0x52, 0xfe, 0xf7, 0xf7, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf5, 0xff, 
-  0xb0, 0xae, 0xf0, 0xc7, 0xe8, 0xc7, 0xed, 0xd7, 0xeb, 0xff, 0xf2, 0x96, 0x0a, 0x3a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x46, 0x19, 0xb9, 0xd6, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0xef, 0x7b, 0x8f, 0x73, 0x4e, 0x63, 0x6b, 0x42, 0xe6, 0x08, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x27, 0x11, 0xc9, 0x21, 0x50, 0x3b, 0x9d, 0xd7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0x88, 0x21, 0xe6, 0x00, 0xe8, 0x31, 0x5c, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xde, 0xc5, 0x08, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x06, 0x19, 0x1b, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x0a, 0x32, 0xe8, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe7, 0x00, 0xe6, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x87, 0x21, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x05, 0x19, 0x5f, 0xd7, 0xfa, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xfa, 0xef, 0xf8, 0xff, 0xf8, 0xe7, 
-  0x08, 0x86, 0xe8, 0xc7, 0x6d, 0xd6, 0xb0, 0xde, 0xe8, 0xc7, 0x7a, 0xb6, 0x25, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x29, 0x3a, 0x7c, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x3f, 0xf7, 0x5f, 0xe6, 0x5f, 0x75, 0xdc, 0x14, 0x5a, 0x14, 0xd7, 0x1b, 0x36, 0x0c, 0x76, 0x44, 0x97, 0x44, 0x56, 0x4c, 0x55, 0x03, 0xb5, 0x3b, 0x9d, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd3, 0x94, 0x07, 0x01, 0x26, 0x09, 0xb9, 0xd6, 0xff, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0xc8, 0x31, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0x58, 0xc6, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xde, 0xff, 0x2d, 0x63, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0x59, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x6a, 0x42, 0xa6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xa5, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x15, 0x9d, 0xfd, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xef, 
-  0xf7, 0xde, 0x66, 0x9e, 0xb0, 0xae, 0x08, 0x86, 0xf0, 0xc7, 0x73, 0x74, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x47, 0x11, 0x7c, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x6e, 0x63, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x15, 0xa5, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5f, 0xd7, 0x1f, 0xcf, 0x3f, 0xcf, 0x9e, 0xc6, 0xdd, 0xce, 0x3d, 0xdf, 0x9e, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9a, 0xd6, 0x06, 0x01, 0x27, 0x01, 0x75, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xec, 0x5a, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x31, 0x7c, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x96, 0xad, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xcf, 0x73, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x83, 0x00, 0x4e, 0x63, 0xfe, 0xd7, 0xf8, 0xff, 0xf5, 0xdf, 0xf3, 0xff, 0xf9, 0xff, 0xf8, 0xff, 
-  0xf2, 0xbe, 0x73, 0xd6, 0xb0, 0xae, 0x66, 0x9e, 0xb5, 0xae, 0x6a, 0x3a, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xb9, 0xd6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x92, 0x8c, 0x05, 0x01, 0x05, 0x01, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x26, 0x21, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x45, 0x19, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x3c, 0xef, 0xa8, 0x29, 0x27, 0x01, 0x8e, 0x6b, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x10, 0x84, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x54, 0xa5, 0xe7, 0x00, 0x27, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x14, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x92, 0x94, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x83, 0x00, 0x25, 0x19, 0x7f, 0xdf, 0xfb, 0xff, 0xf0, 0xff, 0xf9, 0xe7, 0xf3, 0xff, 0xf8, 0xff, 
-  0xf2, 0xde, 0x6d, 0x9e, 0x6d, 0x9e, 0x66, 0x9e, 0x72, 0x93, 0x46, 0x19, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xcf, 0x73, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x92, 0x8c, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x18, 0xc6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x45, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7c, 0xef, 0x08, 0x3a, 0x27, 0x01, 0xcc, 0x52, 0x9d, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0x13, 0xa5, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xef, 0x73, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xc6, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xef, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x95, 0xad, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0xc5, 0x00, 0x84, 0x00, 0x83, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x77, 0xad, 0xfd, 0xef, 0xfa, 0xff, 0xf9, 0xe7, 0xfa, 0xef, 0xfa, 0xef, 
-  0xf3, 0xff, 0x66, 0x9e, 0xf2, 0xbe, 0xc6, 0x9c, 0xdb, 0xbd, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe7, 0x00, 0x1b, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0x58, 0xce, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfb, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0x09, 0x3a, 0x27, 0x01, 0xab, 0x42, 0x9c, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0x95, 0xb5, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x6d, 0x6b, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x79, 0xce, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xab, 0x52, 0xde, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x78, 0xce, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xc6, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x2e, 0x5b, 0xfd, 0xef, 0xf8, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf9, 0xe7, 
-  0xb5, 0xde, 0x6b, 0x85, 0xd2, 0xbd, 0x0b, 0x84, 0xb1, 0x6b, 0x63, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x88, 0x19, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x29, 0x42, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x29, 0x42, 0x79, 0xce, 0xde, 0xf7, 0xbd, 0xf7, 0xf7, 0xbd, 0xe5, 0x10, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2d, 0x63, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xde, 0x87, 0x29, 0x07, 0x01, 0x4a, 0x3a, 0x7c, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0x37, 0xc6, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x6a, 0x4a, 0xbe, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xd6, 0x07, 0x09, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x21, 0x3c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0x99, 0xce, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xed, 0x52, 0xfe, 0xe7, 0xf7, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0x18, 0xe7, 
-  0xf0, 0xff, 0xe8, 0xc7, 0xb0, 0xae, 0x6b, 0x85, 0xab, 0x4a, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0xec, 0x52, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xe7, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x9d, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x95, 0xad, 0xc6, 0x00, 0x07, 0x01, 0x2a, 0x3a, 0x3c, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0x79, 0xce, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x87, 0x21, 0x5d, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x3c, 0xe7, 0x08, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0x9a, 0xd6, 0xff, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0xc4, 0x10, 0xa5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x67, 0x19, 0xff, 0xef, 0xf8, 0xff, 0xf5, 0xdf, 0xf5, 0xdf, 0xf0, 0xff, 
-  0xf7, 0xdf, 0xf3, 0xd7, 0xb0, 0xae, 0x52, 0xae, 0x29, 0x3a, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x13, 0x95, 0xff, 0xff, 0xff, 0xff, 0x17, 0xc6, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x8e, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x29, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xfb, 0xe6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0xab, 0x52, 0xe5, 0x00, 0xe6, 0x00, 0x8a, 0x4a, 0x5c, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0x99, 0xd6, 0xc4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0x46, 0x19, 0x1b, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x0a, 0x32, 0x08, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x18, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x05, 0x19, 0x83, 0x00, 0xa5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x48, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x7a, 0xbe, 0xff, 0xff, 0xf8, 0xff, 0xfa, 0xef, 0xf3, 0xd7, 
-  0xf8, 0xe7, 0xed, 0xd7, 0x66, 0x9e, 0x76, 0x9e, 0x67, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x34, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0xd6, 0xb5, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xf0, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0x3a, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x1b, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x99, 0xd6, 0x4d, 0x63, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x8e, 0x6b, 0xbe, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0x1b, 0xe7, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x5b, 0x08, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x54, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x49, 0x42, 0xa4, 0x00, 0x84, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x48, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x72, 0x84, 0xff, 0xf7, 0xf8, 0xff, 0xf7, 0xff, 0xf3, 0xd7, 
-  0xfb, 0xff, 0xb0, 0xde, 0x6b, 0x85, 0xf5, 0x74, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xef, 0x73, 0xff, 0xff, 0xfe, 0xff, 0x59, 0xce, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xe5, 0x08, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xbd, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x26, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xf7, 0xba, 0xce, 0xba, 0xd6, 0xba, 0xd6, 0xdb, 0xd6, 0xbb, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x9a, 0xce, 0x7a, 0xce, 0x59, 0xce, 0x39, 0xc6, 0x39, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0x35, 0xa5, 0x10, 0x7c, 0x66, 0x21, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe5, 0x00, 0xcb, 0x52, 0xbd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xde, 0xa7, 0x31, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x8c, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x51, 0x84, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x4e, 0x6b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x48, 0x01, 0x07, 0x01, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x2d, 0x5b, 0x7f, 0xf7, 0xb5, 0xde, 0xf3, 0xd7, 0xf3, 0xd7, 
-  0xff, 0xff, 0xf0, 0xff, 0xc0, 0x6c, 0xce, 0x3a, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x08, 0x32, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2d, 0x63, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x8a, 0x4a, 0xa5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xeb, 0x52, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x37, 0xc6, 0x83, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xda, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0x1b, 0xdf, 0x04, 0x19, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x10, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x9d, 0xe7, 0x00, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x4d, 0x63, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x8b, 0x4a, 0x7f, 0xdf, 0xf3, 0xd7, 0xf7, 0xde, 0xf3, 0xd7, 
-  0xf5, 0xff, 0xeb, 0xff, 0x10, 0x86, 0x0e, 0x53, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x27, 0x01, 0x9d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x10, 0xec, 0x5a, 0xcb, 0x5a, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x59, 0xce, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xa6, 0x29, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0xa7, 0x31, 0xc4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x71, 0x8c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9c, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa7, 0x29, 0x9d, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xdb, 0xd6, 0xeb, 0x29, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x08, 0x01, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa8, 0x29, 0x9f, 0xe7, 0x10, 0xc6, 0xf8, 0xe7, 0xf5, 0xdf, 
-  0xe8, 0xc7, 0xeb, 0xaf, 0xf5, 0xaf, 0x6b, 0x42, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x95, 0xad, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xe7, 0xa4, 0x08, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x0f, 0x7c, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x38, 0xce, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x29, 0x42, 0x17, 0xc6, 0xfe, 0xff, 0xfe, 0xff, 0x75, 0xad, 0xc4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x8b, 0x4a, 0x3c, 0xe7, 0x96, 0xad, 0x28, 0x01, 0x08, 0x01, 0x07, 0x01, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x52, 0x02, 0x08, 0x09, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xdf, 0xce, 0xf0, 0xc7, 0xf3, 0xd7, 0xf3, 0xd7, 
-  0xf3, 0xd7, 0xeb, 0xff, 0xf7, 0xbf, 0x09, 0x32, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x09, 0xbe, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x58, 0xce, 0xa4, 0x08, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xef, 0x7b, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x38, 0xce, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x05, 0x19, 0xef, 0x73, 0xf7, 0xbd, 0x5c, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x87, 0x29, 0xc4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x27, 0x09, 0x28, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xf7, 0xbd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x12, 0x4b, 0xb3, 0x02, 0xc7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x28, 0x01, 0xc6, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x1a, 0xa6, 0xf5, 0xff, 0xf0, 0xc7, 0xf5, 0xff, 
-  0xf0, 0xff, 0xf0, 0xff, 0xfd, 0xef, 0x88, 0x29, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x72, 0x84, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x1b, 0xe7, 0x4d, 0x63, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x8a, 0x4a, 0x58, 0xc6, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xb3, 0x94, 0x71, 0x9c, 0xaa, 0x5a, 0xc9, 0x62, 0x0e, 0x8c, 0x13, 0xad, 0xb6, 0xb5, 0xf7, 0xc5, 0x38, 0xc6, 0x58, 0xce, 0x79, 0xd6, 0xba, 0xde, 0x7c, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb6, 0xb5, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x48, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xc6, 0x00, 0x28, 0x01, 0x08, 0x01, 0x08, 0x01, 0x28, 0x01, 0x27, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x13, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x79, 0xc6, 0xb2, 0x02, 0xb2, 0x02, 0xe7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xd5, 0x84, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 
-  0xf0, 0xff, 0xf3, 0xff, 0xfc, 0xe7, 0x46, 0x21, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x55, 0xa5, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x78, 0xce, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x75, 0xa5, 0xbc, 0xff, 0x10, 0xfc, 0xb0, 0xfe, 0xba, 0xff, 0x9d, 0xff, 0xbd, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xe8, 0x31, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0x30, 0x7c, 0x5a, 0xb6, 0x69, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0x28, 0x01, 0x28, 0x01, 0x27, 0x01, 0x27, 0x01, 0xe5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xef, 0x73, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x7c, 0xef, 0xb1, 0x02, 0x70, 0x02, 0xd2, 0x02, 0xe7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 0x07, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xf0, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 
-  0xeb, 0xff, 0x08, 0x86, 0xdb, 0x9d, 0x64, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe7, 0x00, 0xf4, 0x94, 0xde, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xd9, 0xde, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xb3, 0x7c, 0x7d, 0xdf, 0xa6, 0x69, 0x29, 0x49, 0x2e, 0x71, 0x55, 0xcd, 0xfb, 0xf6, 0xdb, 0xee, 0x1b, 0xe7, 0xbc, 0xe6, 0x7c, 0xde, 0xfb, 0xc5, 0xb8, 0x8c, 0x75, 0x53, 0xce, 0x01, 0xac, 0x09, 0x5c, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0x9a, 0xce, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x3b, 0xe7, 0xfe, 0xff, 0x9d, 0xef, 0x2e, 0x53, 0xa6, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0x28, 0x01, 0x07, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xcb, 0x52, 0xde, 0xf7, 0xfe, 0xff, 0xfd, 0xff, 0xdc, 0xf7, 0x4f, 0x0a, 0xb1, 0x02, 0x30, 0x02, 0xb3, 0x02, 0xe6, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x48, 0x01, 0x27, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x0d, 0x43, 0x10, 0x84, 0xff, 0xff, 0xf9, 0xff, 
-  0x6d, 0x9e, 0x08, 0x86, 0x13, 0x54, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x0a, 0x3a, 0x7d, 0xef, 0xfe, 0xff, 0x99, 0xd6, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x53, 0x74, 0x18, 0x65, 0x10, 0x1a, 0x4b, 0x12, 0xab, 0x02, 0xb1, 0x02, 0x12, 0x03, 0xd0, 0x02, 0x70, 0x02, 0x31, 0x02, 0xf1, 0x01, 0xf3, 0x01, 0x12, 0x02, 0xb0, 0x01, 0x55, 0xa5, 0x7c, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x7b, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x0c, 0x63, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x06, 0x09, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x66, 0x21, 0x7d, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x90, 0x42, 0x90, 0x02, 0x91, 0x02, 0x90, 0x02, 0x1c, 0xe7, 0x8e, 0x6b, 0xa5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x48, 0x01, 0x28, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xac, 0x42, 0x75, 0xad, 0xfb, 0xff, 0xfa, 0xff, 
-  0xe8, 0xc7, 0x00, 0x86, 0xd0, 0x53, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x5d, 0xe7, 0xff, 0xff, 0x78, 0xd6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xbe, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x18, 0xb6, 0xde, 0xff, 0x3d, 0xe7, 0xbb, 0xe6, 0x99, 0xde, 0x37, 0xbe, 0xb8, 0xad, 0xf7, 0x94, 0xb5, 0x8c, 0xf6, 0x9c, 0x99, 0xd6, 0x7c, 0xef, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xef, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x59, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xbd, 0xc6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x66, 0x21, 0x1b, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd6, 0x94, 0x31, 0x02, 0xb1, 0x02, 0x32, 0x03, 0x9e, 0xf7, 0xff, 0xff, 0xd0, 0x7b, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x06, 0x01, 0xc6, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x47, 0x01, 0x28, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xcd, 0x52, 0x1f, 0x86, 0xff, 0xff, 0xf8, 0xff, 
-  0xeb, 0xff, 0x00, 0xc6, 0xd0, 0x6b, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x08, 0x01, 0x5d, 0xe7, 0xff, 0xff, 0x58, 0xce, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xbe, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xda, 0xd6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x95, 0xad, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe8, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x0b, 0x32, 0xad, 0x01, 0xc6, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x99, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7a, 0xc6, 0x91, 0x02, 0xd4, 0x02, 0x93, 0x03, 0x5b, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x7b, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x07, 0x01, 0x06, 0x01, 0xc5, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x48, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa9, 0x29, 0xda, 0x9c, 0xff, 0xff, 0xf5, 0xff, 
-  0xf3, 0xff, 0xeb, 0xff, 0x31, 0x74, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0x5c, 0xe7, 0xff, 0xff, 0x58, 0xce, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xbe, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xdb, 0xd6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xe8, 0x39, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x8e, 0x6b, 0x8b, 0x01, 0x8c, 0x01, 0xce, 0x01, 0x48, 0x01, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xb5, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xba, 0xd6, 0xb6, 0x01, 0xd3, 0x02, 0xb4, 0x03, 0x3c, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf0, 0x7b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x27, 0x01, 0x27, 0x01, 0xc5, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x48, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x68, 0x21, 0xda, 0x9c, 0xf5, 0xff, 0xf0, 0xff, 
-  0xf8, 0xc7, 0xff, 0xff, 0x13, 0x7c, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x68, 0x09, 0x7d, 0xef, 0xff, 0xff, 0x58, 0xce, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xbe, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xdb, 0xd6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xde, 0x84, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x6f, 0x6b, 0x8a, 0x01, 0xab, 0x01, 0xac, 0x01, 0xcc, 0x01, 0xab, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0x10, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x92, 0x02, 0xd5, 0x02, 0xd6, 0x02, 0x1c, 0xd7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x11, 0x7c, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa6, 0x01, 0x87, 0x09, 0xe6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x08, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x67, 0x21, 0xd2, 0x95, 0xb5, 0xde, 0xf5, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xf2, 0x73, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x0b, 0x5b, 0x7b, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0x79, 0xd6, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x26, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xdb, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x92, 0x8c, 0xa4, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xcb, 0x52, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x1c, 0xe7, 0xea, 0x31, 0x6a, 0x01, 0x8a, 0x01, 0xab, 0x01, 0x49, 0x01, 0xe6, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x89, 0x4a, 0xbd, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x78, 0x12, 0xd5, 0x02, 0xb6, 0x03, 0x1b, 0xae, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x52, 0x84, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xf2, 0x94, 0x5b, 0xff, 0xe6, 0x08, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe8, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x47, 0x19, 0xd2, 0x95, 0xe8, 0xc7, 0xf0, 0xff, 
-  0xf0, 0xc7, 0xe8, 0xc7, 0xd0, 0x6b, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x0f, 0x84, 0xdd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x26, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0xe4, 0x10, 0x83, 0x00, 0xa3, 0x00, 0x83, 0x00, 0x83, 0x00, 0x34, 0xa5, 0xff, 0xff, 0xf7, 0xbd, 0x29, 0x01, 0x4a, 0x01, 0x6a, 0x01, 0x48, 0x01, 0x06, 0x01, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0x69, 0x42, 0x3b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd9, 0xb5, 0x57, 0x02, 0xd5, 0x02, 0x37, 0x4c, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x72, 0x8c, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x9a, 0xd6, 0xdd, 0xff, 0x6a, 0x4a, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe8, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x88, 0x21, 0x92, 0x94, 0x6d, 0x9e, 0xf3, 0xff, 
-  0xf7, 0xdf, 0xc6, 0x6c, 0xd1, 0x6b, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x8a, 0x4a, 0xdd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb6, 0xb5, 0x49, 0x42, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x6a, 0x4a, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x26, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x78, 0xce, 0x83, 0x00, 0x83, 0x00, 0xa3, 0x00, 0x83, 0x00, 0x83, 0x00, 0xa3, 0x00, 0x09, 0x3a, 0x4a, 0x01, 0x29, 0x01, 0x07, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0x26, 0x19, 0x54, 0xa5, 0xdd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0xf6, 0x02, 0x97, 0x02, 0xd9, 0x12, 0xdf, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x52, 0x8c, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x5c, 0xef, 0xfe, 0xff, 0x30, 0x84, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x06, 0x01, 0x07, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa8, 0x19, 0x65, 0x4b, 0x6d, 0x9e, 0xf5, 0xdf, 
-  0x6d, 0xd6, 0x08, 0x86, 0xb4, 0x7c, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x07, 0x01, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x1a, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x4d, 0x63, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xd0, 0x73, 0xde, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x26, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x45, 0x21, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xbe, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x37, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x83, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0x26, 0x09, 0x54, 0xad, 0xbd, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xd5, 0x02, 0x17, 0x03, 0x99, 0x33, 0x9f, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x52, 0x84, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x9e, 0xf7, 0xfe, 0xff, 0x54, 0xa5, 0xc7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x06, 0x01, 0xe7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x87, 0x11, 0x0b, 0x84, 0x6b, 0x85, 0xf0, 0xc7, 
-  0xe8, 0xc7, 0x6d, 0xd6, 0x7a, 0x9d, 0x63, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa5, 0x00, 0x07, 0x01, 0xe7, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0xb2, 0x8c, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x8f, 0x73, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x11, 0x7c, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x17, 0xbe, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x95, 0xad, 0xc4, 0x00, 0xc4, 0x00, 0xe5, 0x10, 0x93, 0x94, 0x63, 0x00, 0x84, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x08, 0x33, 0xa5, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9a, 0xce, 0x71, 0x02, 0x94, 0x02, 0xb8, 0x02, 0xbd, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x31, 0x84, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xd7, 0xb5, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xcc, 0x42, 0x60, 0x9e, 0x08, 0x86, 0xf5, 0xdf, 
-  0xf5, 0xdf, 0xf0, 0xc7, 0xbc, 0xc6, 0x64, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x47, 0x01, 0x5c, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xcb, 0x52, 0xec, 0x52, 0x84, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xab, 0x52, 0xc5, 0x00, 0xc4, 0x00, 0x6e, 0x6b, 0x9a, 0xce, 0xe9, 0x39, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe5, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x47, 0x19, 0x13, 0x9d, 0x9c, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x70, 0x4b, 0xb2, 0x02, 0x73, 0x02, 0x96, 0x02, 0x5e, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x11, 0x7c, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x4e, 0x5b, 0x6d, 0x9e, 0xe8, 0xc7, 0xf3, 0xff, 
-  0xf8, 0xff, 0xf7, 0xff, 0x1c, 0xe7, 0x06, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc8, 0x21, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x08, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xcf, 0x73, 0x7c, 0xef, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xec, 0x5a, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x29, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x46, 0x21, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfb, 0xe6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x67, 0x21, 0x54, 0xa5, 0xbd, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xe7, 0x54, 0x74, 0x71, 0x02, 0xb4, 0x02, 0xd5, 0x02, 0xd4, 0x22, 0x9e, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x11, 0x7c, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc6, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x90, 0x6b, 0x6d, 0x9e, 0x6d, 0xd6, 0xf5, 0xff, 
-  0xf9, 0xe7, 0xf5, 0xff, 0xfc, 0xc7, 0x67, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x2d, 0x5b, 0xff, 0xff, 0xfe, 0xff, 0x1b, 0xe7, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xe8, 0x31, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x9d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x21, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfb, 0xe6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x95, 0xad, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xa7, 0x21, 0x74, 0xa5, 0xbd, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x14, 0x74, 0xb2, 0x02, 0xf3, 0x02, 0x34, 0x03, 0x74, 0x03, 0x5a, 0xb6, 0xde, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x58, 0xc6, 0xe7, 0x00, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x58, 0x9d, 0x73, 0x9e, 0xed, 0xd7, 0xf5, 0xff, 
-  0xf7, 0xff, 0xf5, 0xff, 0xf8, 0xc7, 0x4a, 0x3a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x06, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x34, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0x17, 0xc6, 0xa4, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0x51, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x11, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x1b, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x1b, 0xe7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xef, 0x7b, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x05, 0x09, 0x6d, 0x6b, 0x58, 0xce, 0xdd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0x13, 0x6c, 0x73, 0x02, 0x74, 0x02, 0x35, 0x03, 0x97, 0x03, 0xdd, 0x8d, 0xdf, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x7b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xbe, 0xf7, 0xff, 0xff, 0x79, 0xce, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xff, 0xce, 0xf3, 0xd7, 0xf0, 0xc7, 0xf2, 0xde, 
-  0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0x0b, 0x53, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x14, 0x9d, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x72, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x11, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfb, 0xe6, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf3, 0x9c, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xec, 0x5a, 0xd6, 0xbd, 0x9d, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0x73, 0x7c, 0x72, 0x02, 0x93, 0x02, 0xd4, 0x02, 0x37, 0x3b, 0xde, 0xce, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xbe, 0xf7, 0xff, 0xff, 0x9a, 0xd6, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x67, 0x21, 0xff, 0xd7, 0xb0, 0xde, 0xe8, 0xc7, 0xe8, 0xc7, 
-  0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xd7, 0xae, 0x63, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x4e, 0x5b, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc7, 0x31, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x1b, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x14, 0xa5, 0xf7, 0xbd, 0x7d, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x99, 0xd6, 0x8e, 0x01, 0x11, 0x02, 0xd7, 0x94, 0x9b, 0xce, 0x9e, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x7b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xbe, 0xf7, 0xff, 0xff, 0x9a, 0xd6, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x6b, 0x3a, 0x18, 0x86, 0xc6, 0x9c, 0x08, 0x86, 0xb0, 0xae, 
-  0xfb, 0xff, 0xf5, 0xff, 0xfa, 0xd7, 0xd7, 0x95, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc8, 0x29, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x84, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xaf, 0x73, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x09, 0x3a, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfb, 0xe6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0xbe, 0xf7, 0xff, 0xff, 0x9a, 0xd6, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xad, 0x42, 0x18, 0xc4, 0xcd, 0x6c, 0x6d, 0x9e, 0x66, 0x9e, 
-  0xf5, 0xaf, 0xf7, 0xdf, 0xf7, 0xdf, 0x9c, 0xe7, 0x05, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe7, 0x00, 0x27, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x06, 0x01, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x46, 0x21, 0xaf, 0x73, 0x2d, 0x63, 0xe5, 0x08, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x25, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xe6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x63, 0x00, 0xde, 0xf7, 0xff, 0xff, 0x9a, 0xd6, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0xe5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xd3, 0x63, 0x18, 0xc4, 0x08, 0x86, 0xc0, 0x6c, 0x6d, 0xd6, 
-  0xf6, 0xb7, 0xf4, 0xc7, 0xf3, 0xff, 0x73, 0xd6, 0x4a, 0x3a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0x27, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0x34, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0x7c, 0xef, 0x05, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x25, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xe6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x63, 0x00, 0xde, 0xff, 0xff, 0xff, 0xba, 0xd6, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xfd, 0xad, 0x53, 0xd3, 0x08, 0x86, 0xb0, 0xae, 0x08, 0x86, 
-  0xf9, 0xe7, 0xb0, 0xde, 0x18, 0xe7, 0x08, 0x86, 0x4c, 0x32, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x09, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x06, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xfb, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x43, 0x00, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xe7, 0x00, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x08, 0x01, 0x28, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x88, 0x29, 0x3f, 0x8e, 0x08, 0x82, 0x08, 0x86, 0x08, 0x86, 0xe8, 0xc7, 
-  0xf5, 0xdf, 0xf3, 0xd7, 0xf5, 0xdf, 0x6d, 0x9e, 0x74, 0x74, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x06, 0x01, 0x6e, 0x6b, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0x10, 0x84, 0xa4, 0x08, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xef, 0x73, 0xfa, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xfb, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x3c, 0xe7, 0xab, 0x52, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0x8e, 0x6b, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x43, 0x00, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x08, 0x01, 0x07, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xac, 0x42, 0x1c, 0xa6, 0x40, 0x6b, 0xb5, 0xae, 0x6d, 0x9e, 0xf3, 0xd7, 
-  0xf7, 0xd7, 0xf7, 0xdf, 0xf5, 0xff, 0xf5, 0xdf, 0x59, 0xae, 0xc8, 0x29, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0x92, 0x8c, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xce, 0xc4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xcb, 0x52, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xec, 0x52, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x63, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x51, 0x53, 0x46, 0x6b, 0x00, 0x5c, 0x08, 0x86, 0x6d, 0x9e, 0xf3, 0xd7, 
-  0xfa, 0xef, 0xf7, 0xdf, 0xf2, 0xde, 0xf0, 0xff, 0xfa, 0xd7, 0xc9, 0x29, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x07, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xae, 0x73, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x99, 0xd6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x11, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x45, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xec, 0x5a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x4d, 0x63, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0x7e, 0xb6, 0x08, 0x86, 0xd2, 0xbd, 0x08, 0x86, 0xe8, 0xc7, 0xf3, 0xd7, 
-  0xf7, 0xdf, 0xf8, 0xe7, 0xf8, 0xe7, 0xf5, 0xdf, 0x1f, 0xfc, 0xf3, 0x73, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa5, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x09, 0xbb, 0xd6, 0xff, 0xff, 0x58, 0xce, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x10, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x17, 0xbe, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xdb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x1c, 0xe7, 0xa7, 0x31, 0x43, 0x00, 0x23, 0x00, 0x03, 0x00, 0x03, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x23, 0x00, 0x23, 0x00, 0x03, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x43, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x44, 0x00, 0x23, 0x00, 0x23, 0x00, 0x49, 0x42, 0x5c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x8b, 0x42, 0xbf, 0x9d, 0xc6, 0x6c, 0xf5, 0xdf, 0xb0, 0xde, 0xf3, 0xd7, 0xb0, 0xde, 
-  0xf5, 0xdf, 0x73, 0xd6, 0x6d, 0x9e, 0xe8, 0xc7, 0xeb, 0xaf, 0xbe, 0xce, 0x07, 0x19, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x26, 0x01, 0xbb, 0xd6, 0xff, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x11, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x38, 0xc6, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xda, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0x28, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xb0, 0x5b, 0x6d, 0x6e, 0x6d, 0x9e, 0xe0, 0x87, 0xf5, 0xdf, 0xb0, 0xde, 0xf7, 0xde, 
-  0xf5, 0xdf, 0xf3, 0xd7, 0xf7, 0xdf, 0xf3, 0xd7, 0xf0, 0xc7, 0xab, 0x86, 0x8b, 0x42, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x26, 0x01, 0x1c, 0xdf, 0xff, 0xff, 0x59, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe6, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x25, 0x11, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x38, 0xc6, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xfb, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0x28, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0x3d, 0xb7, 0xf0, 0xaf, 0xf5, 0xdf, 0xf3, 0xd7, 0xf3, 0xd7, 0xf2, 0xde, 0xf8, 0xe7, 
-  0xf7, 0xdf, 0xed, 0xd7, 0xf3, 0xd7, 0xf5, 0xdf, 0xf0, 0xc7, 0x08, 0xc6, 0xd4, 0x8c, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x06, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x5c, 0xe7, 0xff, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x4d, 0x63, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x9e, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x96, 0xad, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0x3c, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0xe6, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2e, 0x53, 0xfd, 0xb7, 0xf0, 0xff, 0xf5, 0xdf, 0x14, 0xe7, 0xf7, 0xde, 0xb5, 0xde, 0xb0, 0xde, 
-  0xf5, 0xdf, 0xeb, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xeb, 0xff, 0xf3, 0xff, 0x5b, 0xc7, 0x67, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xc6, 0x00, 0x07, 0x01, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x27, 0x01, 0x7d, 0xef, 0xff, 0xff, 0x18, 0xbe, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x96, 0xad, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xec, 0x52, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x25, 0x11, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd7, 0xb5, 0xb2, 0x94, 0xb2, 0x94, 0xb3, 0x94, 0xd3, 0x9c, 0xd3, 0x94, 0xb2, 0x94, 0xb2, 0x94, 0xb3, 0x94, 0xf3, 0x9c, 0x14, 0x9d, 0x35, 0xa5, 0x54, 0xa5, 0x75, 0xad, 0x75, 0xad, 0x95, 0xad, 0x96, 0xad, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x95, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd6, 0xb5, 0xf7, 0xbd, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xc4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x25, 0x11, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xe8, 0x00, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0x28, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x98, 0x8d, 0xfb, 0xdf, 0xf5, 0xdf, 0xf9, 0xe7, 0xf5, 0xff, 0xf8, 0xe7, 0xf7, 0xdf, 0xff, 0x5f, 
-  0xf5, 0xdf, 0xb5, 0xde, 0xf7, 0xdf, 0xb0, 0xde, 0xf0, 0xff, 0xb0, 0xde, 0xe8, 0xc7, 0x70, 0x5b, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa5, 0x00, 0x07, 0x01, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0x27, 0x01, 0x7d, 0xef, 0xff, 0xff, 0xf7, 0xbd, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x4a, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x91, 0x8c, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb2, 0x94, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x76, 0xad, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0x73, 0xc4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa7, 0x29, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x08, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0x08, 0x01, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe9, 0x29, 0x5f, 0xbf, 0xfc, 0xff, 0xf9, 0xe7, 0xf9, 0xe7, 0xf8, 0xff, 0xf5, 0xdf, 0xf8, 0xe7, 0xff, 0x9f, 
-  0xfa, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xf5, 0xdf, 0x08, 0x86, 0xbb, 0x9e, 0x05, 0x11, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x06, 0x01, 0x07, 0x01, 0x06, 0x01, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xbd, 0xf7, 0xff, 0xff, 0xf7, 0xbd, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xcf, 0x73, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x8e, 0x73, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xbe, 0x05, 0x11, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0x3d, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x28, 0x42, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x08, 0x32, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa7, 0x29, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x28, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xd1, 0x5b, 0x9f, 0xd7, 0xff, 0xff, 0xf7, 0xbf, 0xf7, 0xdf, 0xf7, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xff, 0xff, 
-  0xfa, 0xd7, 0xf5, 0xaf, 0xf3, 0xd7, 0xe8, 0xc7, 0xf0, 0xff, 0x6d, 0x9e, 0x08, 0x86, 0x73, 0x6e, 0xad, 0x4a, 0x83, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x27, 0x01, 0x07, 0x01, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x30, 0x84, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x3c, 0xef, 0xe5, 0x08, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x66, 0x21, 0xf3, 0x9c, 0x79, 0xce, 0xba, 0xd6, 0xf7, 0xbd, 0x2d, 0x63, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x91, 0x94, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd7, 0xbd, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x95, 0xad, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa7, 0x29, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x08, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x26, 0x19, 0xde, 0xb6, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0xef, 0xfa, 0xef, 0xf8, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfc, 0xe7, 
-  0xf5, 0xdf, 0xf5, 0xaf, 0xf2, 0xbf, 0xf3, 0xff, 0xf3, 0xd7, 0xf7, 0xde, 0x6d, 0x9e, 0x6d, 0x6e, 0x96, 0x74, 0x64, 0x00, 0x83, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x8a, 0x42, 0xdd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x96, 0xad, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x46, 0x21, 0xbd, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xf7, 0xbd, 0xd7, 0xb5, 0xd7, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xad, 0x96, 0xb5, 0x95, 0xb5, 0x95, 0xb5, 0x75, 0xad, 0x75, 0xad, 0x55, 0xad, 0x75, 0xad, 0x54, 0xad, 0x75, 0xad, 0x75, 0xad, 0x95, 0xb5, 0x95, 0xb5, 0x95, 0xb5, 0x75, 0xb5, 0x95, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x75, 0xb5, 0x75, 0xad, 0xd6, 0xb5, 0x99, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa7, 0x29, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x0e, 0x4b, 0x5f, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0xf6, 0xb7, 
-  0xf5, 0xdf, 0x6d, 0x9e, 0xb0, 0xae, 0xf0, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf8, 0xe7, 0xf3, 0xd7, 0xf5, 0xaf, 0x0a, 0x3a, 0x83, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x27, 0x01, 0x27, 0x01, 0x47, 0x01, 0xfa, 0xde, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xe4, 0x08, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x51, 0x84, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xb2, 0x84, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0x73, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa7, 0x31, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xb5, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x08, 0xd9, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x9f, 0xfa, 0xef, 0xf7, 0xff, 0xf7, 0xff, 0xf9, 0xe7, 0xfa, 0xef, 0xf7, 0xdf, 
-  0x66, 0x9e, 0xf0, 0xff, 0xf3, 0xd7, 0xf7, 0xdf, 0xfb, 0xff, 0xf8, 0xe7, 0xf8, 0xe7, 0xf7, 0xdf, 0x08, 0x86, 0x76, 0x84, 0x63, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x07, 0x01, 0x27, 0x01, 0xab, 0x4a, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x78, 0xce, 0xe4, 0x10, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x30, 0x84, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa8, 0x01, 0x15, 0x86, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xaf, 0x73, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x66, 0x29, 0xff, 0xff, 0xff, 0xff, 0x76, 0xad, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0xe5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xed, 0x4a, 0x1f, 0xd7, 0xff, 0xff, 0xff, 0xdf, 0xfb, 0xff, 0xf9, 0xe7, 0xf7, 0xdf, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xf8, 0xe7, 
-  0xab, 0xae, 0xf2, 0xde, 0xf3, 0xd7, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xc8, 0x31, 0x83, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x47, 0x01, 0x79, 0xce, 0xfe, 0xff, 0xfe, 0xff, 0x1a, 0xdf, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc4, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x94, 0xb5, 0x26, 0x19, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x01, 0x0c, 0x03, 0x8f, 0x03, 0xde, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x2e, 0x5b, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x45, 0x29, 0xff, 0xff, 0xff, 0xff, 0x35, 0xa5, 0xe7, 0x00, 0x27, 0x01, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x06, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe5, 0x10, 0x3b, 0xc6, 0xfd, 0xdf, 0xfc, 0xe7, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xe7, 0xf8, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf7, 0xff, 
-  0xb0, 0xde, 0xb0, 0xde, 0xf3, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc7, 0x7a, 0xd6, 0x7f, 0xd6, 0xf7, 0xa5, 0xc5, 0x08, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x26, 0x01, 0xbd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x8e, 0x73, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x1a, 0xff, 0xac, 0xa3, 0x44, 0x31, 0xa2, 0x08, 0x82, 0x00, 0x04, 0x09, 0x66, 0x21, 0xc9, 0x11, 0xb0, 0x03, 0x52, 0x04, 0x10, 0x04, 0xd9, 0xc6, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0xae, 0x73, 0xaa, 0x52, 0x8a, 0x4a, 0xab, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xab, 0x52, 0xcb, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0xcb, 0x5a, 0xcc, 0x5a, 0xec, 0x5a, 0xec, 0x5a, 0xcc, 0x5a, 0xcc, 0x5a, 0xcc, 0x52, 0xcb, 0x52, 0xcb, 0x52, 0x4a, 0x42, 0x8e, 0x6b, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xa6, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x65, 0x29, 0xff, 0xff, 0xff, 0xff, 0x35, 0xa5, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x90, 0x6b, 0x9f, 0xf7, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 
-  0xb0, 0xae, 0x6d, 0x9e, 0xf5, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x10, 0xc6, 0xff, 0x87, 0xff, 0xc7, 0x6b, 0x3a, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x09, 0x3a, 0xfe, 0xff, 0xfd, 0xff, 0xbd, 0xff, 0xe6, 0x00, 0x06, 0x01, 0xc5, 0x00, 0xa5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xa4, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0x70, 0xed, 0x66, 0x9a, 0x40, 0x61, 0x83, 0x31, 0x6b, 0x3c, 0x7f, 0xb7, 0xff, 0xbe, 0xff, 0xae, 0x1f, 0x9f, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xcf, 0x7b, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xec, 0x52, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xde, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe3, 0x10, 0xff, 0xff, 0xff, 0xff, 0x55, 0xa5, 0x07, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x27, 0x01, 0x48, 0x01, 0x06, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x19, 0x7e, 0xde, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf5, 0xff, 
-  0x6b, 0xad, 0x6b, 0xad, 0xb5, 0xde, 0x14, 0xe7, 0xf0, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xf8, 0xff, 0xf7, 0xdf, 0xf5, 0xff, 0xf0, 0xff, 0xfa, 0xd7, 0x67, 0x21, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xae, 0x73, 0xfd, 0xff, 0xfd, 0xff, 0x78, 0xd6, 0xe6, 0x00, 0x06, 0x01, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0x3b, 0xe7, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x39, 0xff, 0x7a, 0xfe, 0xbf, 0xde, 0x5f, 0xd7, 0x9f, 0xdf, 0x9f, 0xe7, 0xff, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xec, 0x62, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x29, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb3, 0x94, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0x56, 0xa5, 0x28, 0x01, 0x28, 0x01, 0x27, 0x01, 0x27, 0x01, 0x48, 0x01, 0x27, 0x01, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0xd1, 0x7b, 0x9f, 0xf7, 0xfb, 0xff, 0xfd, 0xdf, 0xfb, 0xcf, 0xf8, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf0, 0xff, 0xfb, 0xff, 
-  0x73, 0xd6, 0x73, 0xd6, 0xf7, 0xbe, 0xf7, 0xde, 0xf8, 0xff, 0xfa, 0xff, 0xfb, 0xdf, 0xfa, 0xff, 0xf7, 0xdf, 0xf5, 0xdf, 0xf7, 0xfe, 0xf7, 0xff, 0xb3, 0x7c, 0xc5, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x8e, 0x6b, 0xfd, 0xff, 0xdc, 0xff, 0x4a, 0x63, 0xa5, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x54, 0xa5, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xba, 0xde, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe4, 0x00, 0xda, 0xde, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9d, 0xef, 0x05, 0x11, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x83, 0x00, 0xff, 0xff, 0xff, 0xff, 0x96, 0xad, 0x28, 0x01, 0x28, 0x01, 0x28, 0x01, 0x28, 0x01, 0x48, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2a, 0x3a, 0x3f, 0xdf, 0x9f, 0xf7, 0xfc, 0xff, 0xfe, 0xdf, 0xf8, 0xdf, 0xf9, 0xe7, 0xf8, 0xff, 0xf8, 0xe7, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xef, 0xf5, 0xff, 
-  0xb0, 0xae, 0x6d, 0x9e, 0xf0, 0xc7, 0x73, 0x9e, 0xff, 0xdf, 0x7a, 0xd6, 0xf7, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xf3, 0xd7, 0xf5, 0xff, 0xf7, 0xff, 0xfd, 0xef, 0x0d, 0x4b, 0x84, 0x00, 0xc5, 0x00, 0x29, 0x42, 0xdc, 0xff, 0x39, 0xff, 0xc3, 0x08, 0x64, 0x00, 0x84, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa7, 0x29, 0xde, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xe7, 0x79, 0xc6, 0x78, 0xc6, 0x79, 0xc6, 0x79, 0xc6, 0x79, 0xc6, 0x79, 0xc6, 0x79, 0xce, 0x78, 0xce, 0x78, 0xc6, 0x78, 0xc6, 0x78, 0xc6, 0x78, 0xc6, 0x78, 0xc6, 0x78, 0xce, 0x99, 0xce, 0x99, 0xce, 0x99, 0xce, 0x99, 0xce, 0x99, 0xce, 0x99, 0xce, 0x99, 0xce, 0xb9, 0xce, 0xb9, 0xce, 0xb9, 0xd6, 0xb9, 0xd6, 0xb9, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xfa, 0xde, 0x9d, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xef, 0x7b, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x83, 0x00, 0xff, 0xff, 0xff, 0xff, 0x18, 0xbe, 0x08, 0x01, 0x28, 0x01, 0x28, 0x01, 0x28, 0x01, 0x06, 0x01, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x11, 0x5b, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xef, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf5, 0xff, 
-  0xf0, 0xaf, 0xb5, 0xde, 0x73, 0xd6, 0x18, 0xc6, 0xf8, 0xc7, 0x10, 0x86, 0xf5, 0xdf, 0xf5, 0xdf, 0xf5, 0xff, 0xf8, 0xe7, 0xf7, 0xdf, 0xf3, 0xff, 0xf3, 0xff, 0x3d, 0xb6, 0xa9, 0x29, 0xe5, 0x00, 0xe5, 0x00, 0x16, 0xf7, 0x2b, 0xa4, 0x62, 0x08, 0x81, 0x10, 0x74, 0xc5, 0xcc, 0x5a, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x92, 0x8c, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd2, 0x94, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x83, 0x00, 0xff, 0xff, 0xff, 0xff, 0x59, 0xc6, 0x29, 0x01, 0x48, 0x01, 0x48, 0x01, 0x27, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x53, 0x7c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xf7, 0xff, 0xfa, 0xff, 0xf8, 0xe7, 0xf7, 0xff, 
-  0xb0, 0x86, 0x6d, 0x9e, 0xfb, 0xde, 0xff, 0xff, 0xf0, 0xff, 0xf3, 0xd7, 0xf7, 0xdf, 0xf9, 0xe7, 0xf8, 0xe7, 0xf7, 0xff, 0xf7, 0xff, 0xf0, 0xff, 0x1f, 0xfc, 0x18, 0x84, 0xb1, 0x4a, 0xe6, 0x08, 0xc5, 0x00, 0x21, 0x31, 0x20, 0x31, 0x21, 0x10, 0x32, 0xb5, 0xde, 0xff, 0x6e, 0x6b, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x34, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xde, 0xff, 0x10, 0x84, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x83, 0x00, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xce, 0x29, 0x01, 0x68, 0x01, 0x48, 0x01, 0xe5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x0e, 0x5b, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xf7, 0xdf, 0xf8, 0xe7, 0xfa, 0xff, 0xf0, 0xff, 0xfb, 0xff, 
-  0xf9, 0xff, 0xf9, 0xe7, 0xf5, 0xdf, 0xf3, 0xd7, 0x6d, 0xd6, 0xfa, 0xd7, 0x7a, 0xd6, 0xf0, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x7f, 0xad, 0x18, 0xc6, 0x6b, 0x29, 0xac, 0x19, 0xc5, 0x00, 0x63, 0x00, 0x40, 0x18, 0x80, 0x20, 0x9b, 0xff, 0xde, 0xff, 0x6b, 0x52, 0xa5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xef, 0x73, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x18, 0xc6, 0xe8, 0x39, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x83, 0x00, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xce, 0x49, 0x01, 0x68, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x46, 0x19, 0xbf, 0xce, 0xff, 0xff, 0x7b, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf5, 0xdf, 0xf5, 0xdf, 0xf5, 0xdf, 0xf5, 0xdf, 0xf3, 0xff, 0xf8, 0xe7, 
-  0xf3, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf0, 0xc7, 0xb5, 0xde, 0x10, 0xc6, 0xff, 0xff, 0xf8, 0xff, 0xf5, 0xdf, 0xf5, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0x02, 0x14, 0x25, 0xca, 0x01, 0x83, 0x00, 0x22, 0x08, 0x88, 0x6a, 0xbc, 0xff, 0xbe, 0xff, 0x47, 0x21, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x72, 0x8c, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0xb6, 0xb5, 0x6b, 0x42, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xe5, 0x10, 0x26, 0x19, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0x84, 0x00, 0xff, 0xff, 0xff, 0xff, 0x59, 0xc6, 0x4a, 0x01, 0x06, 0x01, 0xc4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x08, 0xd7, 0x94, 0x5f, 0xef, 0xfc, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf3, 0xd7, 0xf2, 0xde, 0xf5, 0xdf, 0xf5, 0xff, 0xf8, 0xe7, 
-  0xf8, 0xff, 0xf5, 0xdf, 0xfa, 0x9f, 0xff, 0x9f, 0x18, 0xc6, 0x18, 0xc6, 0xf3, 0xd7, 0xf3, 0xd7, 0xf9, 0xff, 0xf8, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x7a, 0x36, 0x9d, 0x66, 0xe9, 0x29, 0x42, 0x00, 0x51, 0xc5, 0x9c, 0xff, 0xbd, 0xff, 0x06, 0x19, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x2d, 0x63, 0xc5, 0x08, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x09, 0x6e, 0x6b, 0x31, 0x84, 0x31, 0x84, 0x51, 0x84, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x84, 0x30, 0x84, 0x31, 0x84, 0x31, 0x84, 0x51, 0x84, 0x51, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x30, 0x84, 0x31, 0x84, 0x31, 0x84, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x30, 0x84, 0x10, 0x7c, 0xf0, 0x7b, 0xf0, 0x7b, 0x10, 0x7c, 0x10, 0x84, 0x10, 0x7c, 0xf0, 0x7b, 0x10, 0x7c, 0xf0, 0x7b, 0x30, 0x84, 0x31, 0x84, 0x31, 0x84, 0x10, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x30, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0xaf, 0x73, 0x27, 0x11, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x87, 0x39, 0xe8, 0x41, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0x28, 0x01, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x2f, 0x43, 0x1f, 0xe7, 0xf9, 0xff, 0xf9, 0xe7, 0xf8, 0xc7, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf9, 0xe7, 0xf8, 0xe7, 0xf8, 0xe7, 0xb0, 0xde, 0xf0, 0xc7, 0xb0, 0xae, 0xe8, 0xff, 0xf5, 0xdf, 0xf3, 0xff, 
-  0xf0, 0xc7, 0xbb, 0xde, 0xf7, 0x96, 0x7a, 0x9e, 0xf8, 0xc7, 0xf8, 0xff, 0xf0, 0xff, 0xed, 0xd7, 0xf5, 0xdf, 0xf9, 0xe7, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xd7, 0xfb, 0xdf, 0xff, 0xe7, 0x3a, 0xb7, 0x4a, 0x3a, 0x75, 0xde, 0xdc, 0xff, 0xde, 0xff, 0x06, 0x19, 0xc5, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x14, 0x9d, 0x35, 0xa5, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x66, 0x01, 0x2c, 0x9b, 0x05, 0x29, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0xe6, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x0e, 0x4b, 0xfd, 0x87, 0xf7, 0xdf, 0xf9, 0xff, 0xf7, 0xff, 0xfa, 0xef, 0xf9, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf7, 0xdf, 0xf8, 0xe7, 0xf5, 0xdf, 0xf2, 0xbe, 0xf0, 0xff, 0xf3, 0xd7, 0xe8, 0xc7, 
-  0xf7, 0xdf, 0xfb, 0xdf, 0xfb, 0xbf, 0x18, 0x86, 0xc0, 0x6c, 0x6d, 0xd6, 0xf0, 0xff, 0xb5, 0xde, 0xf7, 0xdf, 0xf8, 0xe7, 0xf7, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xd7, 0x1d, 0xcf, 0x19, 0xef, 0xdd, 0xff, 0xfe, 0xff, 0x0a, 0x42, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x4e, 0x6b, 0xff, 0xff, 0x6e, 0x63, 0xc5, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x27, 0x01, 0x08, 0x42, 0x94, 0xf6, 0xe5, 0x20, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa7, 0x21, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x8b, 0x42, 0x9e, 0xdf, 0xf4, 0xc7, 0xf7, 0xd7, 0xf8, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf7, 0xdf, 0xf7, 0xde, 0xf5, 0xdf, 0xf8, 0xe7, 0xf3, 0xd7, 
-  0x6d, 0x9e, 0x73, 0xd6, 0x10, 0xc6, 0xf2, 0xbe, 0xf0, 0xc7, 0xb0, 0xde, 0x6d, 0x9e, 0xf3, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xf7, 0xdf, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x32, 0x97, 0xfe, 0xc7, 0xfd, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x72, 0x8c, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xbe, 0xf7, 0x3d, 0xdf, 0x90, 0x22, 0x89, 0x19, 0xc5, 0x08, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0x05, 0x01, 0x4a, 0x01, 0x0c, 0x01, 0xbc, 0xff, 0xfe, 0xff, 0xcb, 0x5a, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0x6a, 0x42, 0xff, 0xff, 0xff, 0xff, 0x09, 0x3a, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x08, 0x32, 0xbb, 0xdf, 0xfc, 0xff, 0xfa, 0xef, 0xf9, 0xdf, 0xfb, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf8, 0xe7, 0xf5, 0xdf, 0xf0, 0xff, 0xf3, 0xff, 
-  0xcd, 0x9c, 0x6d, 0x9e, 0x00, 0x86, 0xf2, 0xbe, 0x6d, 0x9e, 0xf2, 0xde, 0xf3, 0xd7, 0xf7, 0xdf, 0xf0, 0xc7, 0xf0, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfa, 0xd7, 0xb5, 0xde, 0xd2, 0x95, 0xff, 0x9f, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x38, 0xc6, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x55, 0xad, 0xff, 0xff, 0x9e, 0xef, 0x0f, 0x4b, 0x0e, 0x1a, 0x8a, 0x01, 0x48, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xc5, 0x00, 0x27, 0x01, 0x8b, 0x01, 0x0d, 0x02, 0xb3, 0x8c, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x84, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x8a, 0x52, 0xfe, 0xff, 0x7c, 0xef, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x49, 0x3a, 0x7b, 0xdf, 0xbc, 0xff, 0xbb, 0xff, 0xfa, 0xef, 0xfb, 0xdf, 0xfa, 0xff, 0xfc, 0xff, 0xfa, 0xef, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xfb, 0xf7, 0xf9, 0xff, 0xfa, 0xef, 0xf8, 0xe7, 0xf3, 0xff, 0xf3, 0xff, 0xf5, 0xdf, 0xfb, 0xdf, 
-  0x66, 0x9e, 0x66, 0x9e, 0xb5, 0xde, 0xb0, 0xae, 0x73, 0x9e, 0x73, 0xd6, 0xe8, 0xc7, 0xf3, 0xff, 0xf3, 0xff, 0x18, 0xe7, 0xf9, 0xe7, 0xf7, 0xff, 0x18, 0xe7, 0xf3, 0xff, 0xf7, 0xdf, 0xf8, 0xff, 0xf5, 0xdf, 0x6d, 0x9e, 0x10, 0x86, 0x9d, 0xf7, 0xfd, 0xff, 0xfe, 0xff, 0x9d, 0xf7, 0x64, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xb3, 0x8c, 0x0b, 0x2a, 0xac, 0x01, 0x6e, 0x01, 0x6e, 0x01, 0x6d, 0x01, 0x6d, 0x01, 0x8d, 0x01, 0x8d, 0x01, 0x8d, 0x01, 0x4d, 0x01, 0x2c, 0x01, 0x2c, 0x01, 0x2c, 0x01, 0x2c, 0x01, 0x2b, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x0c, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x29, 0x01, 0xe9, 0x00, 0xea, 0x00, 0x0a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x4a, 0x01, 0x09, 0x01, 0xe9, 0x00, 0xc8, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0xc8, 0x00, 0x87, 0x00, 0x87, 0x00, 0xa7, 0x00, 0x87, 0x00, 0x87, 0x00, 0xa7, 0x00, 0xc7, 0x00, 0xc7, 0x00, 0xa6, 0x00, 0x86, 0x00, 0xa6, 0x00, 0xc7, 0x00, 0xa7, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x28, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0xca, 0x09, 0x56, 0x9d, 0x9d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x31, 0x7c, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x28, 0x42, 0x9b, 0xff, 0xb1, 0xa4, 0xe6, 0x00, 0xa5, 0x00, 0xc8, 0x29, 0x39, 0xcf, 0xbb, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xfa, 0xef, 0xfa, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf7, 0xde, 0xff, 0xff, 
-  0xf2, 0xde, 0xc0, 0x6c, 0xc6, 0x6c, 0x66, 0x6e, 0xeb, 0xaf, 0xf0, 0xc7, 0xf3, 0xd7, 0x6d, 0xd6, 0xb0, 0xde, 0xf5, 0xdf, 0x73, 0xd6, 0xe8, 0xc7, 0xf7, 0xff, 0xf5, 0xdf, 0xf3, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xeb, 0xff, 0xe8, 0xc7, 0x6b, 0xad, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x10, 0x84, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x66, 0x21, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xde, 0xf7, 0xbe, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x7c, 0xef, 0x7c, 0xef, 0x5c, 0xef, 0x3b, 0xe7, 0x1b, 0xe7, 0x1b, 0xe7, 0x3b, 0xe7, 0x5c, 0xef, 0x9d, 0xf7, 0xbd, 0xf7, 0xdd, 0xff, 0xdd, 0xff, 0xdd, 0xff, 0xbd, 0xff, 0xbd, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbe, 0xff, 0xbd, 0xf7, 0xbe, 0xf7, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xbd, 0xf7, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9d, 0xf7, 0x9c, 0xf7, 0x7c, 0xf7, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x1b, 0xdf, 0x79, 0xce, 0xb7, 0xad, 0xd5, 0x8c, 0xb4, 0x84, 0x93, 0x84, 0xd7, 0xb5, 0xfc, 0xde, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xdf, 0x8d, 0x3a, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe4, 0x08, 0x28, 0xab, 0x48, 0x19, 0xe6, 0x00, 0x45, 0x09, 0x36, 0x8d, 0x97, 0xff, 0x5a, 0xff, 0x9a, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xfb, 0xfe, 0xf8, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0x10, 0xc6, 
-  0x6b, 0xad, 0x6d, 0x9e, 0x6d, 0xd6, 0x08, 0x86, 0xe8, 0xc7, 0xf0, 0xc7, 0xf2, 0xbe, 0x6d, 0xd6, 0x08, 0x86, 0xf0, 0xc7, 0xf0, 0xc7, 0x73, 0xd6, 0xf8, 0xe7, 0xf8, 0xe7, 0xf5, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0x85, 0x74, 0x5b, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0x5c, 0xef, 0x84, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x14, 0x9d, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xe7, 0x32, 0x6c, 0x48, 0x01, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xe5, 0x00, 0xc3, 0x00, 0x60, 0x18, 0x28, 0x01, 0xa8, 0x21, 0x70, 0x34, 0xf7, 0xff, 0x5b, 0xff, 0x9b, 0xff, 0x9a, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf9, 0xe7, 0xf8, 0xe7, 0xf7, 0xff, 0xfa, 0xff, 0xf8, 0xe7, 0xf7, 0xff, 0x58, 0xff, 0x3a, 0xff, 0xf7, 0xdf, 0xf3, 0xd7, 0xf8, 0xe7, 0xf5, 0xdf, 0xf7, 0xdf, 0xf5, 0xdf, 0xf3, 0xd7, 0xf5, 0xdf, 0xf3, 0xd7, 
-  0x36, 0xd7, 0xf2, 0xde, 0xb5, 0xde, 0xf2, 0xbe, 0xe8, 0xc7, 0xf0, 0xc7, 0x6d, 0xd6, 0x6d, 0xd6, 0xb0, 0xae, 0xb0, 0xde, 0x6d, 0x9e, 0x73, 0xd6, 0xf5, 0xdf, 0xf8, 0xe7, 0xf8, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0x73, 0xd6, 0xc6, 0x9c, 0x05, 0x84, 0xa3, 0x5a, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x05, 0x11, 0x10, 0x7c, 0xd7, 0xb5, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x58, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xb7, 0xb5, 0xd7, 0xb5, 0xd7, 0xbd, 0x18, 0xbe, 0x38, 0xc6, 0x59, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xc6, 0x59, 0xc6, 0x58, 0xce, 0x58, 0xc6, 0x58, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x17, 0xc6, 0x17, 0xbe, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x17, 0xbe, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x39, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0xf7, 0xbd, 0xd7, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd6, 0xb5, 0x95, 0xad, 0x55, 0xa5, 0xd3, 0x94, 0x92, 0x8c, 0x71, 0x8c, 0x91, 0x8c, 0x34, 0x9d, 0x55, 0xa5, 0xf4, 0x94, 0x4d, 0x5b, 0x67, 0x19, 0xe6, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x63, 0x00, 0x08, 0x42, 0x74, 0xa5, 0xf9, 0xbe, 0x73, 0xd6, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf9, 0xe7, 0xf8, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0x18, 0xff, 0xf3, 0xd7, 0xf5, 0xdf, 0xf0, 0xc7, 0x6d, 0xd6, 0xf7, 0xdf, 0xf5, 0xdf, 0xb0, 0xae, 0xf7, 0xdf, 
-  0xe8, 0xc7, 0xf3, 0xd7, 0x6d, 0x9e, 0xb5, 0xae, 0xe8, 0xff, 0xf3, 0xd7, 0xf0, 0xff, 0xb0, 0xae, 0xf2, 0xde, 0xb0, 0xae, 0xf2, 0xbe, 0xf3, 0xd7, 0xf0, 0xc7, 0xf7, 0xff, 0xf0, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xb5, 0xde, 0x73, 0xd6, 0x6b, 0x85, 0x04, 0x44, 0x58, 0xce, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x45, 0x29, 0xb8, 0xde, 0xfd, 0xff, 0xdd, 0xff, 0x10, 0xc6, 0xf3, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xef, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf7, 0xdf, 0xf5, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xb5, 0xfe, 0xf0, 0xff, 0x6d, 0x9e, 0x6d, 0x9e, 0xb0, 0xae, 0x6d, 0x9e, 0x6d, 0x9e, 0xb0, 0xae, 0xb0, 0xae, 
-  0xf5, 0xff, 0xf5, 0xdf, 0x6d, 0x9e, 0x73, 0xd6, 0xf0, 0xc7, 0xb5, 0xde, 0xf2, 0xbe, 0x6b, 0xad, 0x6d, 0x9e, 0xf2, 0xbe, 0x14, 0xc7, 0xb0, 0xde, 0xf5, 0xff, 0xf0, 0xc7, 0xf3, 0xff, 0xf5, 0xff, 0xf0, 0xc7, 0x66, 0x9e, 0xb0, 0xae, 0x6b, 0x85, 0x8e, 0x74, 0xa7, 0x02, 0xd9, 0xd6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x05, 0x19, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa9, 0x52, 0x9c, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0x6d, 0x9e, 0xb0, 0xae, 0x6d, 0x9e, 0xc6, 0x9c, 0x70, 0xad, 0x6d, 0xd6, 0x6d, 0x9e, 0x6d, 0xd6, 
-  0xf7, 0xdf, 0xf7, 0xde, 0xf8, 0xe7, 0x6d, 0x9e, 0xf0, 0xc7, 0xf2, 0xde, 0xf2, 0xbe, 0xb5, 0xde, 0xb5, 0xde, 0xf0, 0xc7, 0x14, 0xe7, 0xf9, 0xe7, 0xf9, 0xe7, 0xf7, 0xdf, 0xf0, 0xc7, 0xeb, 0xff, 0xf3, 0xff, 0xf5, 0xdf, 0x10, 0x86, 0xb0, 0xae, 0x6d, 0x6e, 0x0c, 0x45, 0x6d, 0x2b, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xcf, 0x73, 0x84, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x6c, 0x6b, 0xdc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0x74, 0xf5, 0xdf, 0xf5, 0xff, 0xf7, 0xff, 0xfa, 0xef, 0xf9, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xeb, 0xff, 0xe8, 0xc7, 0x66, 0x9e, 0xb0, 0xae, 0xb0, 0xae, 0x6d, 0x9e, 0x10, 0x86, 0xf5, 0xdf, 0x6d, 0x9e, 
-  0xf5, 0xdf, 0xf7, 0xde, 0xf7, 0xdf, 0xf7, 0xdf, 0xf3, 0xd7, 0xf5, 0xdf, 0xb0, 0xde, 0xf2, 0xde, 0xf0, 0xc7, 0xf0, 0xff, 0xf5, 0xff, 0xf8, 0xe7, 0xf9, 0xe7, 0xf7, 0xff, 0xf7, 0xdf, 0xeb, 0xff, 0xf7, 0xdf, 0xfb, 0xff, 0x7a, 0xd6, 0xf8, 0xff, 0xf3, 0x9f, 0x73, 0x6e, 0x14, 0x64, 0x8f, 0x02, 0x77, 0xa5, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd9, 0xde, 0x8d, 0x73, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x0f, 0x7c, 0xfd, 0xff, 0xfd, 0xff, 0xbc, 0xff, 0x84, 0x5b, 0x69, 0x73, 0x73, 0x9e, 0xf3, 0xd7, 0xf5, 0xdf, 0xf0, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0x6d, 0xd6, 0x6d, 0x9e, 0xb0, 0xae, 0x6d, 0x9e, 0x00, 0x86, 0x6d, 0x9e, 0xb0, 0xde, 0x73, 0xd6, 
-  0xeb, 0xaf, 0xf7, 0xdf, 0xf5, 0xdf, 0xf7, 0xdf, 0xf5, 0xdf, 0xf0, 0xc7, 0x6d, 0x9e, 0xf5, 0xdf, 0x18, 0xe7, 0xf8, 0xe7, 0xf5, 0xff, 0xf7, 0xdf, 0xf3, 0xff, 0xf0, 0xff, 0xf7, 0xde, 0xf8, 0xe7, 0xf3, 0xd7, 0xf5, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0x18, 0xc6, 0xab, 0x2a, 0xad, 0x02, 0xb1, 0x5a, 0x9d, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x7b, 0xf7, 0x2c, 0x6b, 0x05, 0x01, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xc5, 0x00, 0x50, 0x8c, 0xfe, 0xff, 0xfe, 0xff, 0xb8, 0xce, 0x63, 0x52, 0x00, 0x24, 0xc9, 0x75, 0xb0, 0xae, 0x6d, 0x9e, 0x08, 0x86, 0xe8, 0xc7, 0xf3, 0xff, 0xf7, 0xdf, 0xfc, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xf3, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf9, 0xe7, 0xf9, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf5, 0xdf, 0xb0, 0xde, 0xb0, 0xae, 0xb0, 0xae, 0xf0, 0xc7, 0x08, 0xc6, 0x39, 0xe7, 0xf5, 0xff, 0xeb, 0xff, 
-  0xf3, 0xff, 0xf3, 0xd7, 0xf7, 0xde, 0xf3, 0xff, 0xf7, 0xff, 0xf3, 0xd7, 0xf7, 0xff, 0xf9, 0xe7, 0xf7, 0xde, 0xf7, 0xdf, 0xf5, 0xff, 0xf3, 0xff, 0xf8, 0xe7, 0xfc, 0xff, 0xf3, 0xd7, 0xf5, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0x10, 0x84, 0xae, 0x02, 0x8f, 0x02, 0x2d, 0x12, 0x31, 0x8c, 0x9d, 0xf7, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbd, 0xff, 0xe8, 0x39, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xe6, 0x00, 0x27, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x71, 0x8c, 0xfe, 0xff, 0xfc, 0xff, 0x4e, 0xcd, 0x60, 0x73, 0x65, 0x73, 0x65, 0x5d, 0x6b, 0x85, 0x66, 0x9e, 0x08, 0x86, 0x6d, 0x9e, 0xf7, 0xdf, 0xf3, 0xd7, 0xf5, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0xf5, 0xdf, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf0, 0xc7, 0xf0, 0xff, 0xf3, 0xd7, 0xe8, 0xc7, 0x66, 0x9e, 0xeb, 0xff, 0xf8, 0xe7, 0xf7, 0xff, 0xf7, 0xff, 
-  0xf5, 0xdf, 0xf8, 0xff, 0xf5, 0xdf, 0xf7, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf9, 0xe7, 0xf5, 0xff, 0xf3, 0xff, 0xf8, 0xe7, 0xf5, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xdf, 0xf0, 0xff, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x84, 0x70, 0x2d, 0xa7, 0x02, 0x2c, 0x02, 0xc9, 0x01, 0xad, 0x01, 0x2d, 0x02, 0x4e, 0x63, 0xb6, 0xb5, 0x78, 0xd6, 0xd2, 0xac, 0xa3, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x26, 0x19, 0x34, 0x95, 0xfe, 0xf7, 0xf3, 0xff, 0xcd, 0xfc, 0xcd, 0xfc, 0x6d, 0xd6, 0x73, 0xd6, 0x66, 0x9e, 0xf2, 0xde, 0xf0, 0xc7, 0xf0, 0xc7, 0xf5, 0xdf, 0xf5, 0xdf, 0xf3, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0xf7, 0xdf, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf3, 0xff, 0xeb, 0xff, 0xf3, 0xd7, 0xf7, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xf3, 0xd7, 0xf0, 0xc7, 0xf0, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xfa, 0xff, 
-  0xf5, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf9, 0xe7, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0x7a, 0xd6, 0xfa, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xfd, 0xff, 0xfb, 0xff, 0xf5, 0xff, 0xeb, 0xff, 0xcd, 0x6c, 0x4d, 0x03, 0x8b, 0x03, 0x29, 0x02, 0x0b, 0x02, 0x47, 0x02, 0x26, 0x02, 0xa6, 0x01, 0x86, 0x11, 0xa3, 0x11, 0x81, 0x21, 0xc2, 0x10, 0x83, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x06, 0x01, 0x07, 0x01, 0x06, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x08, 0x0c, 0x53, 0x59, 0xb6, 0x6d, 0xfe, 0xd7, 0xfd, 0x7a, 0xfe, 0x73, 0xfe, 0xf2, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xf8, 0xe7, 0xf3, 0xd7, 0x73, 0xd6, 0xeb, 0xff, 0xf5, 0xff, 0xf8, 0xe7, 0xf3, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf8, 0xe7, 0xe8, 0xff, 0xf5, 0xdf, 0xf8, 0xe7, 0xf5, 0xff, 0xf5, 0xdf, 0xf5, 0xff, 0xf5, 0xff, 0xf3, 0xd7, 0xb0, 0xde, 0xe8, 0x87, 0xf5, 0xdf, 0xf5, 0xdf, 0xf3, 0xd7, 0xf3, 0xd7, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-  0xfa, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xfa, 0xef, 0xf9, 0xe7, 0xf3, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xfa, 0xef, 0xf3, 0xd7, 0xf8, 0xff, 0xfa, 0xff, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0x7a, 0x9e, 0xd3, 0x34, 0xcd, 0x34, 0x89, 0x2c, 0x08, 0x24, 0x8b, 0x23, 0x66, 0x1a, 0x46, 0x1b, 0x82, 0x12, 0x00, 0x42, 0x20, 0x5a, 0x08, 0x41, 0xc3, 0x08, 0xa3, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0x07, 0x01, 0xe7, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x06, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe7, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xcb, 0x42, 0xd8, 0x9d, 0x3f, 0xef, 0x73, 0xfe, 0x73, 0xfe, 0x73, 0xfe, 0x7a, 0xfe, 0x73, 0xfe, 0xee, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0x08, 0x86, 0xeb, 0xff, 0xf0, 0xff, 0xf3, 0xd7, 0xf8, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf0, 0xff, 0xf5, 0xdf, 0xf0, 0xff, 0xf8, 0xe7, 0xf3, 0xff, 0xf8, 0xe7, 0xf7, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0x6d, 0xd6, 0xc0, 0x6c, 0x14, 0xa7, 0xf2, 0xbf, 0xf5, 0xdf, 0xf3, 0xd7, 0xf0, 0xdf, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 
-  0xf9, 0xe7, 0xf7, 0xff, 0xf5, 0xdf, 0xf8, 0xff, 0xf3, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xfd, 0xd7, 0xff, 0x9f, 0xeb, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xb0, 0xde, 0xf0, 0xff, 0xb0, 0xae, 0xf3, 0xd7, 0xd2, 0xbd, 0x70, 0xad, 0x05, 0x84, 0x6d, 0x9e, 0x6b, 0xad, 0x89, 0x74, 0x00, 0x63, 0x00, 0xa3, 0xc0, 0x71, 0xa0, 0x69, 0xc0, 0x71, 0x29, 0x5b, 0x28, 0x32, 0x83, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x27, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0x07, 0x01, 0xe7, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0xe7, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x07, 0x01, 0x06, 0x01, 0xe5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xab, 0x4a, 0x35, 0x95, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0x35, 0xff, 0x79, 0xff, 0xf2, 0xde, 0xf5, 0xdf, 0xf9, 0xe7, 0xf3, 0xff, 0xf3, 0xd7, 0xf0, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xf5, 0xdf, 0xf0, 0xff, 0xeb, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf5, 0xdf, 0xf0, 0xff, 0xe0, 0xff, 0xf9, 0xff, 0xf8, 0xe7, 0xf5, 0xff, 0xf2, 0xbe, 0xf3, 0xff, 0x66, 0x9e, 0x08, 0x86, 0xe8, 0xc7, 0xf0, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfb, 0xff, 
-  0xf7, 0xdf, 0xf5, 0xff, 0xf8, 0xff, 0xf9, 0xe7, 0xf3, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfd, 0xdf, 0xfc, 0xcf, 0xf3, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf5, 0xdf, 0xf7, 0xdf, 0xf5, 0xff, 0xf9, 0xff, 0xf8, 0xe7, 0xf7, 0xdf, 0xf3, 0xd7, 0xf7, 0xdf, 0xb0, 0xde, 0xf0, 0xc7, 0xf5, 0xdf, 0xf5, 0xff, 0xfa, 0xff, 0xf9, 0xe7, 0xf7, 0xde, 0xf8, 0xe7, 0xb5, 0xae, 0x70, 0xdd, 0x00, 0xac, 0xa0, 0xaa, 0x60, 0xbb, 0x00, 0xa4, 0xcc, 0xa5, 0xb4, 0x9c, 0xe8, 0x39, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0xe6, 0x00, 0x07, 0x01, 0x07, 0x01, 0x06, 0x01, 0x06, 0x01, 0xe6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe8, 0x31, 0xf5, 0x84, 0xbe, 0xd7, 0xfc, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xfe, 0x18, 0xff, 0x39, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf5, 0xdf, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xf5, 0xff, 0xfb, 0xef, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf8, 0xe7, 0xfb, 0xff, 0xf8, 0xe7, 0xf8, 0xe7, 0xf2, 0xde, 0xf5, 0xdf, 0xb0, 0xae, 0xf3, 0xd7, 0xf0, 0xff, 0xf7, 0xdf, 0xf9, 0xe7, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfa, 0xff, 
-  0xf5, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xfc, 0xe7, 0xfd, 0xdf, 0xfb, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf9, 0xe7, 0xf7, 0xdf, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf0, 0xdf, 0xf5, 0xff, 0xf8, 0xe7, 0xf7, 0xff, 0xf7, 0xdf, 0xf3, 0xd7, 0xe8, 0xc7, 0xf5, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xb0, 0xfe, 0xd2, 0xdd, 0x70, 0xdd, 0xc6, 0xd4, 0xc0, 0xd4, 0xc0, 0xd4, 0xc6, 0xd4, 0x73, 0xfe, 0xd4, 0xa5, 0xe9, 0x32, 0x86, 0x21, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x25, 0x11, 0x6b, 0x3a, 0x76, 0x8d, 0xfe, 0xd7, 0xfc, 0xe7, 0x5a, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0xe7, 0xf7, 0xff, 0x39, 0xff, 0x57, 0xff, 0x97, 0xfe, 0x36, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf7, 0xde, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf3, 0xd7, 0xf5, 0xdf, 0xf5, 0xdf, 0xf0, 0xc7, 0xf3, 0xd7, 0xf7, 0xff, 0xf0, 0xc7, 0xf4, 0xa7, 0xf8, 0xe7, 0xfa, 0xff, 0xfa, 0xef, 0xf8, 0xff, 0xf8, 0xff, 
-  0xf5, 0xdf, 0xf0, 0xdf, 0xf2, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xf7, 0xff, 0xf9, 0xff, 0xfc, 0xe7, 0xfa, 0xef, 0xfa, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf7, 0xdf, 0xf3, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf5, 0xdf, 0xf5, 0xdf, 0xf5, 0xdf, 0xf8, 0xe7, 0xf8, 0xff, 0xed, 0xd7, 0xf5, 0xdf, 0xf7, 0xde, 0xf7, 0xdf, 0xf8, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf7, 0xfe, 0x73, 0xfe, 0xb0, 0xfe, 0xcd, 0xfc, 0xcd, 0xfc, 0xd3, 0xfc, 0x00, 0xac, 0x00, 0x5c, 0x53, 0x7c, 0x28, 0x4a, 0x65, 0x21, 0xc4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe5, 0x08, 0x4b, 0x42, 0xf1, 0x6b, 0xfb, 0xa6, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe7, 0xfb, 0xdf, 0xf3, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x5a, 0xff, 0x79, 0xff, 0x79, 0xff, 0x3a, 0xff, 0xf0, 0xff, 0xf7, 0xdf, 0x6d, 0xd6, 0xf5, 0xdf, 0xf7, 0xdf, 0xf5, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xf5, 0xff, 0xeb, 0xff, 0xf8, 0xe7, 0xf8, 0xe7, 0xf8, 0xff, 0xf0, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xf8, 0xff, 0xfa, 0xef, 0xf9, 0xff, 0xf8, 0xe7, 
-  0xb0, 0xde, 0xf7, 0xde, 0xf7, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfb, 0xef, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xe7, 0xf8, 0xe7, 0xf8, 0xff, 0xf8, 0xe7, 0xf5, 0xdf, 0xf2, 0xde, 0xf8, 0xe7, 0xf0, 0xff, 0xf2, 0xde, 0xf3, 0xd7, 0xf3, 0xff, 0xf0, 0xff, 0xf5, 0xdf, 0x14, 0xe7, 0x39, 0xe7, 0xf3, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0x3a, 0xff, 0x79, 0xff, 0x57, 0xff, 0xf7, 0xfe, 0xf7, 0xfe, 0x18, 0xff, 0x10, 0xfe, 0x08, 0x86, 0x08, 0xc6, 0xcd, 0xfc, 0x52, 0xe6, 0x55, 0x9e, 0x8b, 0x3a, 0xe4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa5, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe4, 0x08, 0xa7, 0x29, 0x2d, 0x53, 0x7b, 0xa6, 0x3f, 0xe7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xeb, 0xff, 0xeb, 0xff, 0xf7, 0xff, 0x14, 0xff, 0x35, 0xff, 0x55, 0xfe, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xeb, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf9, 0xe7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xf3, 0xd7, 0xf0, 0xff, 0xf7, 0xff, 0xeb, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf7, 0xdf, 
-  0xf3, 0xd7, 0xf3, 0xff, 0xf3, 0xd7, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf3, 0xd7, 0xe8, 0xc7, 0xf3, 0xd7, 0xf2, 0xbe, 0xb0, 0xde, 0xf7, 0xde, 0xf5, 0xdf, 0xf3, 0xff, 0xf5, 0xdf, 0xf5, 0xdf, 0xb0, 0xae, 0xed, 0xd7, 0x14, 0xe7, 0xf9, 0xe7, 0xf7, 0xdf, 0xf9, 0xff, 0xf8, 0xff, 0xfa, 0xef, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf5, 0xe7, 0xf8, 0xff, 0xf9, 0xe7, 0xfb, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf5, 0xdf, 0xf0, 0xff, 0x73, 0xfe, 0x73, 0xfe, 0x73, 0xfe, 0x08, 0x86, 0x00, 0x5c, 0xc0, 0x9c, 0x8e, 0xbc, 0xe7, 0x52, 0xc4, 0x29, 0x25, 0x21, 0x26, 0x21, 0xa4, 0x00, 0x84, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa7, 0x29, 0xcc, 0x52, 0x4f, 0x63, 0x15, 0x95, 0x3c, 0xcf, 0x10, 0x84, 0x6b, 0x5d, 0xe0, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0x3a, 0xff, 0xf9, 0xff, 0xf8, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf7, 0xdf, 0xf8, 0xe7, 0xf5, 0xff, 0xfa, 0xff, 0xf7, 0xdf, 0xf5, 0xff, 0xf5, 0xdf, 0xf0, 0xff, 0xf8, 0xe7, 0x39, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xfa, 0xef, 0xf9, 0xe7, 0xf8, 0xe7, 0xf9, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf9, 0xe7, 0xfa, 0xef, 0xf9, 0xff, 0xfd, 0xd7, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xe7, 0x14, 0xe7, 0xf7, 0xdf, 0xf5, 0xdf, 0xf5, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf8, 0xe7, 0xfa, 0xff, 0xfb, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xfa, 0xef, 0xf7, 0xff, 
-  0xab, 0xae, 0xb0, 0xde, 0x18, 0xe7, 0xf7, 0xdf, 0xf7, 0xdf, 0xf5, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xe7, 0xf7, 0xff, 0xf8, 0xff, 0xf0, 0xc7, 0xed, 0xd7, 0xab, 0xae, 0xb0, 0xae, 0xf2, 0xde, 0xf7, 0xdf, 0x73, 0xd6, 0xf5, 0xdf, 0xf5, 0xdf, 0xf5, 0xdf, 0xf9, 0xe7, 0xf7, 0xdf, 0xf7, 0xdf, 0xf3, 0xd7, 0xf0, 0xc7, 0xf5, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xf5, 0xff, 0xf5, 0xdf, 0xf7, 0xff, 0xf8, 0xe7, 0xf5, 0xdf, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0x73, 0xfe, 0x73, 0xfe, 0xf0, 0xff, 0xeb, 0xff, 0x73, 0xd6, 0x73, 0xfe, 0x10, 0xfe, 0x6b, 0xdd, 0x0c, 0xe5, 0x89, 0xdc, 0x55, 0xce, 0x52, 0xad, 0x6d, 0x5b, 0x49, 0x42, 0x69, 0x42, 0x08, 0x3a, 0x25, 0x19, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xe5, 0x00, 0x8a, 0x42, 0x8b, 0x42, 0x0e, 0x53, 0xaf, 0x6b, 0x79, 0xb6, 0xfe, 0xe7, 0xfb, 0xdf, 0x73, 0x9e, 0x73, 0x9e, 0xfa, 0xd7, 0xff, 0xff, 0xf8, 0xc7, 0xf3, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf6, 0xd7, 0xfc, 0xff, 0xfb, 0xff, 0xf5, 0xdf, 0xf3, 0xd7, 0xf7, 0xdf, 0xf0, 0xff, 0xf7, 0xff, 0xf5, 0xdf, 0xf3, 0xd7, 0xf7, 0xdf, 0xf3, 0xff, 0xf7, 0xde, 0x5a, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf9, 0xe7, 0xf8, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfc, 0xe7, 0xfd, 0xef, 0xfc, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfa, 0xef, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xfa, 0xef, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf7, 0xdf, 0xf9, 0xff, 
-  0xc6, 0x6c, 0x6b, 0x85, 0xb0, 0xae, 0xf5, 0xdf, 0xf5, 0xdf, 0xf3, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xf8, 0xff, 0xf9, 0xff, 0xf7, 0xdf, 0xf7, 0xde, 0xf8, 0xe7, 0xb0, 0xae, 0xe8, 0xc7, 0xf3, 0xd7, 0x6d, 0xd6, 0xf3, 0xd7, 0xb0, 0xde, 0xb5, 0xde, 0xf5, 0xff, 0xf3, 0xd7, 0xf9, 0xe7, 0xf7, 0xdf, 0xf0, 0xc7, 0xf3, 0xd7, 0x6d, 0xd6, 0xf7, 0xdf, 0xf5, 0xdf, 0xf3, 0xd7, 0xf7, 0xdf, 0xb0, 0xde, 0xf7, 0xdf, 0xeb, 0xff, 0xeb, 0xff, 0xf8, 0xff, 0xed, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xb5, 0xfe, 0xf5, 0xff, 0xeb, 0xff, 0xb5, 0xfe, 0xb5, 0xfe, 0x73, 0xfe, 0xf7, 0xfe, 0x39, 0xff, 0x39, 0xff, 0x3a, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xff, 0x39, 0xff, 0x94, 0xee, 0x39, 0xf7, 0x98, 0xde, 0xb7, 0xb5, 0xd4, 0x94, 0xd0, 0x63, 0x6e, 0x63, 0xaf, 0x6b, 0x2d, 0x5b, 0xcb, 0x4a, 0x0c, 0x53, 0x6d, 0x5b, 0x8f, 0x6b, 0x70, 0x63, 0x94, 0x84, 0x56, 0x95, 0xf9, 0xad, 0x1e, 0xc7, 0xbe, 0xdf, 0xfb, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf3, 0xd7, 0xf7, 0xff, 0xf0, 0xff, 0xf9, 0xe7, 0xf3, 0xff, 0xf0, 0xc7, 0x73, 0xd6, 0xf3, 0xd7, 0xf3, 0xff, 0x18, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xfa, 0xef, 0xf7, 0xdf, 0xf7, 0xdf, 0xf9, 0xe7, 0xf8, 0xff, 0xf8, 0xe7, 0xf9, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xef, 0xf3, 0xff, 0xf3, 0xff, 0xf9, 0xe7, 0xf9, 0xe7, 0xf8, 0xe7, 0xf7, 0xff, 0x18, 0xe7, 0xf7, 0xff, 
-  0xb0, 0xae, 0xc6, 0x6c, 0x60, 0x9e, 0x10, 0xc7, 0xf7, 0xde, 0xf9, 0xff, 0x18, 0xff, 0xf7, 0xff, 0xf8, 0xe7, 0xf8, 0xff, 0xf5, 0xdf, 0xfa, 0x9f, 0xf7, 0xbe, 0xf2, 0xbe, 0x6d, 0x9e, 0xb5, 0xde, 0xf2, 0xbe, 0x73, 0xd6, 0xf0, 0xff, 0xfa, 0xff, 0xf7, 0xdf, 0xf9, 0xe7, 0xf0, 0xc7, 0xf5, 0xdf, 0xeb, 0xff, 0x00, 0x86, 0x73, 0xd6, 0xb5, 0xde, 0xe8, 0xc7, 0xf7, 0xdf, 0x18, 0xe7, 0xf7, 0xde, 0xf0, 0xff, 0xf5, 0xdf, 0xf0, 0xff, 0xf5, 0xff, 0x6d, 0xfe, 0xfa, 0xff, 0xf8, 0xe7, 0xfa, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfb, 0xef, 0xf7, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x39, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x3a, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xef, 0xfb, 0xef, 0xf6, 0xd7, 0xf5, 0xdf, 0x08, 0x86, 0x10, 0xfe, 0xeb, 0xaf, 0xf5, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf0, 0xc7, 0xf7, 0xdf, 0xf5, 0xdf, 0xfb, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xf7, 0xdf, 0xf5, 0xff, 0xf5, 0xdf, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xf5, 0xff, 0xb5, 0xfe, 0xf8, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xe7, 0xf8, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xf5, 0xdf, 0xf3, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xf7, 0xdf, 0xfa, 0xff, 0xf3, 0xff, 0xf7, 0xff, 
-
-  0x06, 0x05, 0x06, 0x04, 0x06, 0x06, 0x05, 0x04, 0x06, 0x06, 0x06, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x06, 0x05, 0x07, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x08, 0x05, 0x05, 0x06, 0x05, 0x07, 0x07, 0x03, 0x05, 0x04, 0x05, 0x07, 0x09, 0x09, 0x08, 0x06, 0x04, 0x06, 0x05, 0x06, 0x06, 0x04, 0x04, 0x04, 0x05, 0x02, 0x03, 0x03, 0x04, 0x05, 0x07, 0x06, 0x05, 0x05, 0x04, 0x06, 0x07, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0x05, 0x07, 0x06, 0x05, 0x05, 0x08, 0x04, 0x05, 0x06, 0x04, 0x09, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x06, 0x04, 0x05, 0x05, 0x04, 0x07, 0x05, 0x03, 0x02, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0x06, 
-  0x06, 0x08, 0x09, 0x05, 0x06, 0x06, 0x08, 0x07, 0x05, 0x04, 0x07, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x08, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x07, 0x05, 0x05, 0x07, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x0a, 0x07, 0x0f, 0x1a, 0x21, 0x3f, 0x5a, 0x69, 0x80, 0x93, 0x94, 0x98, 0x9f, 0xa4, 0xa8, 0xa7, 0x9f, 0x95, 0x93, 0x7c, 0x65, 0x55, 0x36, 0x28, 0x19, 0x11, 0x08, 0x09, 0x07, 0x06, 0x06, 0x04, 0x07, 0x04, 0x04, 0x03, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x05, 0x06, 0x05, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x03, 0x04, 0x03, 0x02, 0x04, 0x08, 0x05, 0x04, 0x05, 0x05, 0x03, 0x05, 0x08, 0x07, 0x07, 0x06, 0x07, 0x07, 0x06, 0x05, 0x06, 
-  0x06, 0x06, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x05, 0x06, 0x05, 0x07, 0x09, 0x06, 0x05, 0x04, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x06, 0x05, 0x04, 0x07, 0x04, 0x04, 0x06, 0x08, 0x0a, 0x09, 0x07, 0x07, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x04, 0x05, 0x08, 0x08, 0x06, 0x0f, 0x1e, 0x44, 0x76, 0xac, 0xc0, 0xde, 0xec, 0xef, 0xef, 0xf0, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xef, 0xed, 0xed, 0xee, 0xeb, 0xdb, 0xba, 0x96, 0x69, 0x3b, 0x1b, 0x18, 0x0c, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x04, 0x06, 0x05, 0x05, 0x06, 0x05, 0x07, 0x08, 0x08, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x05, 0x04, 0x04, 0x07, 0x0a, 0x09, 0x08, 0x05, 0x07, 0x09, 0x07, 0x04, 0x05, 0x06, 0x05, 0x06, 0x07, 0x05, 0x07, 0x05, 0x06, 
-  0x07, 0x05, 0x05, 0x08, 0x04, 0x04, 0x05, 0x06, 0x04, 0x04, 0x06, 0x06, 0x05, 0x07, 0x08, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x08, 0x07, 0x05, 0x05, 0x05, 0x06, 0x04, 0x07, 0x0d, 0x11, 0x0c, 0x0d, 0x0b, 0x08, 0x04, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x08, 0x21, 0x5a, 0x99, 0xcc, 0xea, 0xed, 0xea, 0xed, 0xed, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xf0, 0xee, 0xed, 0xeb, 0xea, 0xea, 0xe6, 0xd7, 0xb3, 0x86, 0x57, 0x28, 0x10, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x03, 0x09, 0x04, 0x03, 0x0a, 0x09, 0x0a, 0x13, 0x25, 0x23, 0x18, 0x08, 0x05, 0x06, 0x04, 0x04, 0x07, 0x03, 0x05, 0x08, 0x05, 0x03, 
-  0x07, 0x07, 0x06, 0x04, 0x07, 0x06, 0x06, 0x06, 0x04, 0x04, 0x05, 0x04, 0x04, 0x05, 0x06, 0x08, 0x06, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x07, 0x08, 0x07, 0x04, 0x03, 0x04, 0x05, 0x07, 0x0f, 0x19, 0x1e, 0x25, 0x1e, 0x18, 0x11, 0x07, 0x0a, 0x07, 0x07, 0x06, 0x13, 0x50, 0xa8, 0xe3, 0xea, 0xeb, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xe7, 0xe5, 0xd5, 0xa3, 0x6f, 0x33, 0x0c, 0x05, 0x04, 0x05, 0x0a, 0x0b, 0x06, 0x07, 0x0a, 0x07, 0x04, 0x06, 0x09, 0x07, 0x09, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x04, 0x05, 0x05, 0x06, 0x06, 0x09, 0x0b, 0x0b, 0x24, 0x7c, 0xc8, 0xf0, 0xfc, 0xfd, 0xf4, 0xdc, 0x9c, 0x48, 0x0a, 0x06, 0x07, 0x04, 0x01, 0x06, 0x07, 0x05, 
-  0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x06, 0x06, 0x05, 0x06, 0x06, 0x07, 0x06, 0x08, 0x05, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0x04, 0x06, 0x0a, 0x30, 0x62, 0x86, 0x9e, 0xae, 0xb5, 0xb3, 0xac, 0xb2, 0xab, 0x9e, 0x8d, 0x81, 0x71, 0x7b, 0x82, 0x5d, 0x93, 0xd9, 0xee, 0xec, 0xe9, 0xea, 0xea, 0xea, 0xec, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xec, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xe8, 0xe7, 0xe6, 0xe3, 0xe3, 0xd0, 0x7d, 0x44, 0x3c, 0x47, 0x53, 0x57, 0x4a, 0x3d, 0x29, 0x0f, 0x0b, 0x09, 0x09, 0x07, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x09, 0x07, 0x05, 0x05, 0x07, 0x08, 0x1d, 0x97, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xc1, 0x33, 0x0f, 0x0a, 0x04, 0x05, 0x06, 0x05, 
-  0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x05, 0x08, 0x07, 0x06, 0x07, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x08, 0x06, 0x06, 0x05, 0x05, 0x05, 0x03, 0x05, 0x06, 0x19, 0x7b, 0xd1, 0xf5, 0xfa, 0xfd, 0xf9, 0xf9, 0xfb, 0xf9, 0xf8, 0xf7, 0xf8, 0xf9, 0xfa, 0xf9, 0xf8, 0xf4, 0xb4, 0xd6, 0xe5, 0xea, 0xeb, 0xe6, 0xe5, 0xe8, 0xe6, 0xe0, 0xe3, 0xe6, 0xe8, 0xea, 0xec, 0xeb, 0xe5, 0xdd, 0xd2, 0xc9, 0xc6, 0xc0, 0xbd, 0xbf, 0xbf, 0xbd, 0xb8, 0xb5, 0xb0, 0xb3, 0xb6, 0xbd, 0xc6, 0xcc, 0xd2, 0xd9, 0xe4, 0xeb, 0xeb, 0xeb, 0xec, 0xea, 0xe9, 0xe8, 0xe7, 0xe6, 0xe5, 0xe4, 0xe6, 0xe0, 0x9d, 0xc1, 0xd3, 0xe2, 0xf0, 0xf3, 0xf3, 0xf4, 0xd6, 0x88, 0x28, 0x0f, 0x0a, 0x0e, 0x0d, 0x58, 0xa9, 0xc7, 0xc9, 0xc2, 0x9c, 0x62, 0x1c, 0x08, 0x08, 0x3f, 0xe0, 0xff, 0xff, 0xfe, 0xfd, 0xf5, 0xd7, 0xda, 0xe8, 0xfc, 0xfe, 0xff, 0xff, 0xf4, 0x62, 0x0e, 0x04, 0x05, 0x04, 0x04, 
-  0x06, 0x05, 0x06, 0x06, 0x07, 0x07, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x05, 0x06, 0x04, 0x05, 0x0d, 0x7a, 0xe7, 0xfb, 0xf9, 0xfc, 0xef, 0xd4, 0xd6, 0xcd, 0xd9, 0xc7, 0xcc, 0xd1, 0xd3, 0xd3, 0xd5, 0xd4, 0xce, 0xd8, 0xe5, 0xe7, 0xe7, 0xe8, 0xe7, 0xe0, 0xd1, 0xbd, 0x6c, 0x4c, 0x9a, 0xae, 0xc1, 0xca, 0xcb, 0xc5, 0xb3, 0xb4, 0xba, 0xa2, 0xa6, 0x97, 0x89, 0x8f, 0x90, 0x8d, 0x8b, 0x8a, 0x84, 0x7c, 0x7e, 0xaa, 0xcc, 0xd5, 0xd6, 0xd8, 0xdb, 0xe4, 0xe6, 0xe8, 0xea, 0xe9, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe9, 0xea, 0xe9, 0xe1, 0xd6, 0xcb, 0xd5, 0xd5, 0xe0, 0xf5, 0xfc, 0xf5, 0xed, 0x8a, 0x1f, 0x3e, 0xb8, 0xfa, 0xfc, 0xfa, 0xfd, 0xff, 0xff, 0xfe, 0xf0, 0x7d, 0x5c, 0xef, 0xfd, 0xff, 0xf2, 0xdb, 0xd3, 0xe9, 0xef, 0xee, 0xe8, 0xd1, 0xcf, 0xdd, 0xfc, 0xfe, 0xf7, 0x7f, 0x12, 0x0b, 0x03, 0x05, 
-  0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x05, 0x04, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x1b, 0xbf, 0xfc, 0xfb, 0xfa, 0xf1, 0xd4, 0xd1, 0xe7, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xec, 0xe9, 0xe7, 0xe0, 0xcf, 0xb5, 0x53, 0x7d, 0xc0, 0xda, 0xe1, 0xe6, 0xe7, 0xe7, 0xec, 0xf0, 0xed, 0xeb, 0xed, 0xf4, 0xf1, 0xf4, 0xef, 0xef, 0xf1, 0xf2, 0xe1, 0xb0, 0x61, 0x86, 0xd0, 0xd9, 0xdb, 0xdd, 0xdf, 0xe2, 0xe3, 0xe5, 0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe9, 0xe9, 0xea, 0xeb, 0xee, 0xee, 0xed, 0xee, 0xed, 0xec, 0xd2, 0xe0, 0xf6, 0xf7, 0xfb, 0xd5, 0xf3, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xf7, 0xfb, 0xfe, 0xe6, 0xda, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xef, 0xef, 0xef, 0xe6, 0xd2, 0xf2, 0xfb, 0xfb, 0x74, 0x12, 0x06, 0x05, 
-  0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x05, 0x18, 0xcc, 0xff, 0xff, 0xfe, 0xdd, 0xd3, 0xec, 0xed, 0xef, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0xef, 0xee, 0xee, 0xef, 0xee, 0xed, 0xed, 0xed, 0xee, 0xeb, 0xea, 0xe7, 0xe0, 0xd3, 0x93, 0x66, 0xbb, 0xd4, 0xe1, 0xe6, 0xeb, 0xed, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xfa, 0xf6, 0xf5, 0xf2, 0xf6, 0xf5, 0xea, 0xd6, 0xa2, 0x73, 0xce, 0xd8, 0xda, 0xde, 0xde, 0xe1, 0xe2, 0xe3, 0xe5, 0xe6, 0xe4, 0xe6, 0xe7, 0xe9, 0xe9, 0xe9, 0xeb, 0xec, 0xec, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xe7, 0xd7, 0xf2, 0xf7, 0xf9, 0xfa, 0xfb, 0xf5, 0xe4, 0xdf, 0xf1, 0xdb, 0xe1, 0xe7, 0xfa, 0xfe, 0xfd, 0xfd, 0xd5, 0xdc, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xef, 0xf0, 0xf0, 0xdd, 0xef, 0xfe, 0xf6, 0x3a, 0x09, 0x01, 
-  0x06, 0x06, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x04, 0x06, 0x05, 0x05, 0x09, 0xb3, 0xfa, 0xfb, 0xf9, 0xcd, 0xe2, 0xe9, 0xed, 0xed, 0xee, 0xf1, 0xf1, 0xef, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xf1, 0xee, 0xe8, 0xdf, 0xda, 0xce, 0xba, 0xb2, 0xb5, 0xd9, 0xde, 0xe1, 0xe7, 0xec, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf8, 0xf9, 0xf2, 0xf7, 0xfd, 0xf7, 0xf6, 0xf6, 0xf9, 0xfa, 0xf2, 0xeb, 0xd3, 0x80, 0xbf, 0xd6, 0xd8, 0xdd, 0xde, 0xdf, 0xe0, 0xe2, 0xe5, 0xe3, 0xe4, 0xe8, 0xe7, 0xe8, 0xea, 0xed, 0xee, 0xf1, 0xf2, 0xef, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xec, 0xed, 0xd0, 0xf7, 0xfa, 0xfb, 0xec, 0xe3, 0xf9, 0xf6, 0xf5, 0xf8, 0xf5, 0xf0, 0xde, 0xd9, 0xf7, 0xdf, 0xdc, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf3, 0xf5, 0xf3, 0xf1, 0xf1, 0xf0, 0xf0, 0xed, 0xd6, 0xf6, 0xfd, 0xc4, 0x12, 0x04, 
-  0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x08, 0x07, 0x06, 0x06, 0x05, 0x07, 0x07, 0x07, 0x61, 0xf9, 0xf9, 0xf2, 0xc4, 0xe8, 0xec, 0xec, 0xed, 0xeb, 0xef, 0xf2, 0xe9, 0xd2, 0xd6, 0xd3, 0xe8, 0xe5, 0xe8, 0xec, 0xec, 0xe8, 0xdb, 0xd1, 0xe6, 0xe0, 0xeb, 0xfb, 0xfb, 0xf7, 0xf4, 0xeb, 0xe9, 0xec, 0xee, 0xee, 0xf0, 0xf1, 0xf3, 0xf2, 0xf1, 0xfa, 0xfb, 0xf6, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xf0, 0xf0, 0xf1, 0xe7, 0xea, 0xe3, 0xdf, 0xe2, 0xe1, 0xe2, 0xe1, 0xdd, 0xdd, 0xdc, 0xe3, 0xe5, 0xe8, 0xe2, 0xd5, 0xcb, 0xda, 0xea, 0xd9, 0xd9, 0xe8, 0xf0, 0xee, 0xee, 0xed, 0xea, 0xde, 0xed, 0xf7, 0xfb, 0xe8, 0xeb, 0xf7, 0xf7, 0xf6, 0xf5, 0xf5, 0xf3, 0xf2, 0xf0, 0xee, 0xdd, 0xe4, 0xf4, 0xf2, 0xf3, 0xf2, 0xdd, 0xdc, 0xd7, 0xd3, 0xdb, 0xdb, 0xf2, 0xf0, 0xf0, 0xef, 0xeb, 0xd5, 0xf9, 0xfa, 0x59, 0x03, 
-  0x06, 0x07, 0x05, 0x05, 0x06, 0x05, 0x07, 0x05, 0x05, 0x05, 0x06, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0e, 0xd8, 0xf4, 0xf0, 0xb9, 0xe8, 0xe8, 0xe8, 0xe9, 0xec, 0xea, 0xcd, 0xc9, 0xd2, 0xed, 0xef, 0xf4, 0xf8, 0xfc, 0xfc, 0xfb, 0xf9, 0xf6, 0xf7, 0xfc, 0xfd, 0xfd, 0xfb, 0xf9, 0xe5, 0xd1, 0xda, 0xd9, 0xca, 0xc6, 0xce, 0xd5, 0xd9, 0xdd, 0xe1, 0xe6, 0xea, 0xe9, 0xe7, 0xea, 0xeb, 0xec, 0xe2, 0xd2, 0xe3, 0xd9, 0xf5, 0xf7, 0xf7, 0xf5, 0xf6, 0xf6, 0xf9, 0xfa, 0xf8, 0xf9, 0xf8, 0xf2, 0xf2, 0xf1, 0xf3, 0xf0, 0xf1, 0xf4, 0xf2, 0xf6, 0xf7, 0xf7, 0xf7, 0xed, 0xed, 0xf0, 0xe0, 0xd2, 0xd4, 0xec, 0xeb, 0xdf, 0xe4, 0xef, 0xf5, 0xdc, 0xe7, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf4, 0xf2, 0xf4, 0xdd, 0xe6, 0xf8, 0xfc, 0xfd, 0xfc, 0xf5, 0xb5, 0xf0, 0xf0, 0xee, 0xed, 0xde, 0xeb, 0xfd, 0xaa, 0x05, 
-  0x06, 0x08, 0x05, 0x04, 0x06, 0x06, 0x07, 0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 0x08, 0x62, 0xf8, 0xf1, 0xc0, 0xdd, 0xe9, 0xe9, 0xe8, 0xe9, 0xd5, 0xcf, 0xf1, 0xf1, 0xf0, 0xf0, 0xf4, 0xf9, 0xfa, 0xfa, 0xfa, 0xf8, 0xf5, 0xf6, 0xf6, 0xf9, 0xeb, 0xda, 0xd8, 0xcf, 0xdc, 0xe7, 0xea, 0xea, 0xea, 0xec, 0xec, 0xed, 0xf0, 0xf0, 0xf0, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf1, 0xf0, 0xec, 0xec, 0xe7, 0xcf, 0xd2, 0xda, 0xd9, 0xf9, 0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf5, 0xf2, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xfa, 0xfa, 0xf8, 0xf0, 0xf4, 0xf8, 0xf8, 0xfa, 0xf1, 0xca, 0xe3, 0xd6, 0xf0, 0xf0, 0xd7, 0xe3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf5, 0xf5, 0xf4, 0xf4, 0xf3, 0xf2, 0xd7, 0xeb, 0xf7, 0xfc, 0xfb, 0xfa, 0xfb, 0xe4, 0x7c, 0xbd, 0xf1, 0xef, 0xec, 0xed, 0xda, 0xfb, 0xe1, 0x09, 
-  0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x06, 0x08, 0x0a, 0xbb, 0xf4, 0xe1, 0xca, 0xe8, 0xea, 0xec, 0xeb, 0xd2, 0xd7, 0xed, 0xf2, 0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xfa, 0xff, 0xfa, 0xe8, 0xd6, 0xe1, 0xeb, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xed, 0xee, 0xee, 0xef, 0xf0, 0xf0, 0xf1, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xef, 0xee, 0xed, 0xec, 0xe7, 0xcd, 0xdc, 0xf4, 0xfc, 0xfb, 0xfb, 0xfa, 0xf7, 0xf5, 0xf1, 0xf6, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf6, 0xf5, 0xdb, 0xea, 0xf9, 0xde, 0xe0, 0xee, 0xf2, 0xf1, 0xee, 0xe0, 0xd9, 0xcf, 0xd4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf5, 0xdd, 0xf1, 0xf7, 0xfc, 0xf6, 0xd8, 0xb1, 0x81, 0x7c, 0x8a, 0xf3, 0xef, 0xec, 0xec, 0xd6, 0xfa, 0xf7, 0x1e, 
-  0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x04, 0x05, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x08, 0x1b, 0xeb, 0xed, 0xbc, 0xea, 0xeb, 0xeb, 0xeb, 0xd6, 0xdb, 0xe7, 0xec, 0xf2, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xf8, 0xfc, 0xd2, 0xdf, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xec, 0xec, 0xec, 0xec, 0xec, 0xee, 0xef, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf6, 0xf6, 0xf6, 0xf4, 0xf3, 0xf2, 0xf1, 0xf1, 0xef, 0xed, 0xed, 0xec, 0xec, 0xed, 0xeb, 0xdc, 0xdc, 0xfb, 0xfe, 0xfd, 0xfb, 0xf6, 0xf3, 0xf6, 0xf8, 0xf7, 0xf8, 0xfa, 0xf9, 0xf7, 0xfb, 0xfa, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xda, 0xd4, 0xee, 0xee, 0xf1, 0xf0, 0xe0, 0xe8, 0xf3, 0xf5, 0xce, 0xf6, 0xf4, 0xf2, 0xf3, 0xf5, 0xf7, 0xf6, 0xf5, 0xf4, 0xdc, 0xe8, 0xb0, 0x7c, 0x71, 0x74, 0x7b, 0x78, 0x78, 0xee, 0xf0, 0xed, 0xed, 0xd8, 0xfc, 0xfb, 0x2c, 
-  0x04, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06, 0x06, 0x07, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x07, 0x07, 0x07, 0x08, 0x47, 0xf0, 0xed, 0xb4, 0xeb, 0xea, 0xe9, 0xe7, 0xc5, 0xea, 0xec, 0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xf6, 0xcf, 0xe7, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xed, 0xec, 0xec, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf3, 0xf2, 0xf1, 0xee, 0xec, 0xec, 0xeb, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xd9, 0xee, 0xfb, 0xff, 0xfc, 0xf7, 0xf6, 0xf4, 0xf1, 0xf3, 0xfa, 0xf5, 0xf1, 0xfd, 0xfd, 0xf6, 0xf6, 0xf6, 0xfa, 0xf8, 0xf1, 0xf1, 0xf4, 0xde, 0xd4, 0xee, 0xee, 0xee, 0xee, 0xdb, 0xe4, 0xf2, 0xf7, 0xdf, 0xe6, 0xf3, 0xf3, 0xf1, 0xda, 0xf4, 0xf7, 0xf6, 0xf5, 0xf4, 0xf4, 0xe4, 0x87, 0x74, 0x76, 0x7a, 0x7b, 0x78, 0x73, 0xed, 0xf0, 0xed, 0xed, 0xdc, 0xfc, 0xfb, 0x2d, 
-  0x05, 0x06, 0x06, 0x06, 0x05, 0x04, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x07, 0x06, 0x07, 0x6d, 0xed, 0xe3, 0xb2, 0xe9, 0xe9, 0xe8, 0xe3, 0xcc, 0xed, 0xed, 0xf4, 0xf7, 0xf9, 0xf9, 0xf4, 0xf7, 0xfa, 0xf7, 0xf6, 0xf7, 0xd7, 0xe7, 0xec, 0xee, 0xf0, 0xf0, 0xee, 0xe8, 0xc1, 0xa6, 0x99, 0x8e, 0x7c, 0x6b, 0x60, 0x58, 0x50, 0x48, 0x46, 0x47, 0x47, 0x48, 0x4b, 0x4e, 0x54, 0x5b, 0x68, 0x77, 0x85, 0x99, 0xb4, 0xd8, 0xed, 0xef, 0xee, 0xed, 0xed, 0xec, 0xed, 0xee, 0xe1, 0xd7, 0xfc, 0xfa, 0xfa, 0xf7, 0xf6, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf8, 0xf8, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf7, 0xf7, 0xd7, 0xd5, 0xef, 0xee, 0xef, 0xef, 0xda, 0xdc, 0xf0, 0xf6, 0xea, 0xdb, 0xf3, 0xf3, 0xf2, 0xe8, 0xda, 0xd3, 0xed, 0xf6, 0xf5, 0xf5, 0xf6, 0xf8, 0xf5, 0xa6, 0x7a, 0x7a, 0x78, 0x76, 0x80, 0xf2, 0xf0, 0xed, 0xee, 0xd8, 0xfb, 0xf5, 0x1c, 
-  0x07, 0x06, 0x07, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x08, 0x06, 0x04, 0x05, 0x06, 0x04, 0x05, 0x06, 0x06, 0x70, 0xed, 0xe4, 0xb8, 0xe9, 0xe8, 0xe7, 0xdd, 0xe0, 0xf0, 0xf0, 0xf3, 0xf6, 0xf9, 0xf9, 0xf1, 0xf5, 0xfa, 0xf7, 0xf8, 0xe5, 0xe1, 0xec, 0xed, 0xed, 0xee, 0xdf, 0x79, 0x28, 0x15, 0x15, 0x13, 0x12, 0x12, 0x11, 0x13, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x16, 0x17, 0x17, 0x17, 0x18, 0x18, 0x1b, 0x1e, 0x24, 0x2a, 0x48, 0x8a, 0xd0, 0xee, 0xed, 0xec, 0xee, 0xee, 0xee, 0xe6, 0xd3, 0xee, 0xfa, 0xf8, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf3, 0xf9, 0xe4, 0xd5, 0xf0, 0xf0, 0xee, 0xee, 0xe6, 0xe4, 0xf3, 0xf5, 0xe9, 0xda, 0xed, 0xf2, 0xf1, 0xe9, 0xd6, 0xeb, 0xee, 0xd6, 0xe3, 0xf6, 0xf6, 0xf7, 0xf7, 0xf9, 0xf9, 0xbf, 0x7a, 0x75, 0x70, 0xb6, 0xf2, 0xef, 0xed, 0xec, 0xd2, 0xfa, 0xde, 0x09, 
-  0x06, 0x06, 0x05, 0x07, 0x05, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x05, 0x06, 0x05, 0x05, 0x04, 0x6d, 0xef, 0xec, 0xb4, 0xe7, 0xe7, 0xe5, 0xd8, 0xe8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xec, 0xd3, 0xec, 0xeb, 0xe9, 0xea, 0xcf, 0x31, 0x0f, 0x2d, 0x5a, 0x74, 0x81, 0x8e, 0xa0, 0xad, 0xb5, 0xbc, 0xc2, 0xc6, 0xcf, 0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd4, 0xd2, 0xc7, 0xbc, 0x96, 0x5e, 0x24, 0x21, 0x5e, 0xc9, 0xed, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xcd, 0xf0, 0xf5, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf5, 0xf6, 0xf6, 0xfb, 0xff, 0xff, 0xfd, 0xdc, 0xcf, 0xee, 0xf0, 0xf0, 0xf0, 0xe4, 0xe4, 0xf7, 0xf9, 0xf5, 0xdb, 0xf1, 0xef, 0xf1, 0xf1, 0xe8, 0xe4, 0xf0, 0xf3, 0xf6, 0xf0, 0xd3, 0xf3, 0xf7, 0xf6, 0xf7, 0xf8, 0xf7, 0xc7, 0x74, 0x96, 0xf2, 0xf3, 0xef, 0xed, 0xe5, 0xe8, 0xf6, 0xad, 0x06, 
-  0x08, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x07, 0x55, 0xf7, 0xf3, 0xba, 0xe8, 0xe7, 0xe5, 0xdc, 0xe2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xf1, 0xf0, 0xef, 0xef, 0xbe, 0xe8, 0xe8, 0xe7, 0xe8, 0xe4, 0x41, 0x41, 0xb9, 0xf1, 0xf2, 0xf5, 0xf5, 0xf6, 0xf4, 0xf9, 0xfd, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf0, 0xf1, 0xde, 0x82, 0x34, 0x31, 0x93, 0xe8, 0xed, 0xed, 0xec, 0xed, 0xec, 0xdc, 0xf5, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf4, 0xf5, 0xf8, 0xfb, 0xfc, 0xfd, 0xdb, 0xd3, 0xed, 0xed, 0xf0, 0xf0, 0xe2, 0xd5, 0xf5, 0xf9, 0xfa, 0xd4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xef, 0xd2, 0xf6, 0xfa, 0xfe, 0xfb, 0xd6, 0xef, 0xf5, 0xf6, 0xf6, 0xf5, 0xf3, 0xc8, 0xed, 0xf2, 0xf2, 0xf0, 0xed, 0xd1, 0xf5, 0xf6, 0x5a, 0x07, 
-  0x08, 0x07, 0x06, 0x06, 0x06, 0x04, 0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x06, 0x09, 0x53, 0xf8, 0xf6, 0xce, 0xea, 0xe8, 0xe7, 0xe3, 0xdb, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xf0, 0xed, 0xea, 0xdb, 0xcb, 0xe7, 0xe7, 0xe6, 0xe7, 0x8f, 0x84, 0xf8, 0xfb, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xfa, 0xfd, 0xfd, 0xf7, 0xe4, 0x88, 0x2f, 0x5c, 0xdb, 0xec, 0xec, 0xec, 0xec, 0xec, 0xd9, 0xf4, 0xf6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xfc, 0xfb, 0xf6, 0xeb, 0xd8, 0xed, 0xed, 0xed, 0xee, 0xe6, 0xd8, 0xf0, 0xf8, 0xfd, 0xd1, 0xee, 0xf1, 0xf1, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf3, 0xdf, 0xf3, 0xfe, 0xff, 0xfc, 0xd7, 0xe0, 0xf5, 0xf5, 0xf5, 0xf3, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xda, 0xe9, 0xf7, 0xcc, 0x0e, 0x04, 
-  0x06, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x09, 0x07, 0x05, 0x06, 0x06, 0x08, 0x33, 0xda, 0xf9, 0xf9, 0xcf, 0xeb, 0xea, 0xe7, 0xe5, 0xdc, 0xf6, 0xf5, 0xf6, 0xf6, 0xf2, 0xf1, 0xf0, 0xec, 0xe9, 0xc0, 0xe7, 0xe7, 0xe7, 0xe6, 0xdb, 0x85, 0xf9, 0xfe, 0xff, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xf9, 0xf8, 0xf4, 0xf2, 0xf1, 0xd3, 0x52, 0x46, 0xce, 0xec, 0xec, 0xec, 0xed, 0xe8, 0xdf, 0xf7, 0xf6, 0xf4, 0xf3, 0xf1, 0xf1, 0xf3, 0xfc, 0xfe, 0xeb, 0xdf, 0xed, 0xed, 0xed, 0xed, 0xe3, 0xdf, 0xf0, 0xf6, 0xfe, 0xdc, 0xe5, 0xf2, 0xf1, 0xf1, 0xf4, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xdb, 0xe5, 0xfe, 0xff, 0xfb, 0xd8, 0xe2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xe1, 0xe6, 0xf6, 0xef, 0x3d, 0x03, 0x03, 
-  0x05, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x04, 0x08, 0x06, 0x08, 0x06, 0x04, 0x06, 0x04, 0x04, 0x06, 0x3a, 0xe9, 0xfe, 0xfb, 0xf9, 0xdb, 0xec, 0xec, 0xea, 0xec, 0xde, 0xf8, 0xfa, 0xf8, 0xf6, 0xf2, 0xf1, 0xf0, 0xea, 0xe0, 0xbd, 0xe6, 0xe7, 0xe6, 0xe4, 0xb5, 0xec, 0xff, 0xff, 0xfb, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf7, 0xf7, 0xf5, 0x7f, 0x45, 0xdb, 0xeb, 0xeb, 0xec, 0xec, 0xda, 0xed, 0xf8, 0xf6, 0xf3, 0xf1, 0xf1, 0xf3, 0xfc, 0xf5, 0xd3, 0xed, 0xed, 0xed, 0xed, 0xea, 0xcb, 0xea, 0xf2, 0xfa, 0xe2, 0xdc, 0xf0, 0xf2, 0xf1, 0xf0, 0xed, 0xa3, 0xd4, 0xf7, 0xf5, 0xf3, 0xf6, 0xf5, 0xe9, 0xdb, 0xfd, 0xfd, 0xae, 0x7a, 0xd6, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xeb, 0xdb, 0xf3, 0xf5, 0x84, 0x06, 0x03, 0x03, 
-  0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x02, 0x01, 0x07, 0x08, 0x08, 0x0a, 0x09, 0x04, 0x06, 0x23, 0xdc, 0xfa, 0xff, 0xe8, 0xd7, 0xef, 0xf0, 0xf1, 0xf1, 0xf4, 0xdd, 0xdd, 0xf9, 0xfa, 0xf8, 0xf6, 0xf1, 0xf0, 0xea, 0xe1, 0xc2, 0xe6, 0xe6, 0xe5, 0xe1, 0xd0, 0xfc, 0xff, 0xf7, 0xf8, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfa, 0xf9, 0x89, 0x74, 0xe7, 0xeb, 0xec, 0xec, 0xed, 0xd6, 0xfb, 0xf6, 0xf3, 0xf1, 0xf1, 0xf2, 0xfb, 0xd8, 0xec, 0xf0, 0xed, 0xec, 0xe9, 0xd4, 0xf0, 0xf2, 0xfa, 0xef, 0xd5, 0xf2, 0xf1, 0xf0, 0xef, 0xef, 0xcc, 0x93, 0x62, 0xac, 0xf5, 0xf6, 0xf8, 0xf6, 0xf4, 0xf2, 0xda, 0xcd, 0x6e, 0x63, 0x66, 0xd8, 0xf3, 0xf2, 0xf0, 0xef, 0xd6, 0xf4, 0xf5, 0xa2, 0x0b, 0x06, 0x03, 0x03, 
-  0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x04, 0x03, 0x08, 0x09, 0x09, 0x09, 0x09, 0x04, 0x0a, 0xab, 0xf9, 0xfc, 0xe4, 0xdd, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xee, 0xda, 0xf7, 0xf8, 0xf6, 0xf1, 0xf0, 0xeb, 0xdb, 0xc5, 0xe7, 0xe6, 0xe5, 0xda, 0xeb, 0xfa, 0xfb, 0xf7, 0xf9, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xf8, 0xfa, 0x7c, 0xad, 0xeb, 0xec, 0xec, 0xeb, 0xdb, 0xe6, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf5, 0xce, 0xf1, 0xf0, 0xed, 0xee, 0xd4, 0xef, 0xf7, 0xfb, 0xfb, 0xcc, 0xf1, 0xf1, 0xf0, 0xee, 0xef, 0xd6, 0xf0, 0xfc, 0xc1, 0x6d, 0x92, 0xf3, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0xd4, 0x79, 0x60, 0x6d, 0xe2, 0xf4, 0xf3, 0xf1, 0xd4, 0xec, 0xf2, 0xbd, 0x15, 0x06, 0x05, 0x04, 0x04, 
-  0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x06, 0x05, 0x07, 0x09, 0x0a, 0x09, 0x06, 0x06, 0x07, 0x58, 0xf5, 0xfd, 0xeb, 0xd0, 0xf3, 0xef, 0xf1, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf0, 0xed, 0xdc, 0xf1, 0xf6, 0xf1, 0xf1, 0xee, 0xd6, 0xd0, 0xe7, 0xe6, 0xe6, 0xd1, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xf2, 0x6f, 0xdc, 0xec, 0xec, 0xeb, 0xea, 0xd2, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf5, 0xc4, 0xee, 0xf0, 0xed, 0xe3, 0xed, 0xf4, 0xfd, 0xfd, 0xd3, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xd0, 0xe5, 0xf6, 0xfc, 0xfd, 0xd0, 0x91, 0xa7, 0xed, 0xf6, 0xf6, 0xf3, 0xf4, 0xf3, 0xec, 0x83, 0xd9, 0xf6, 0xf5, 0xf3, 0xd7, 0xe7, 0xeb, 0xd7, 0x29, 0x04, 0x04, 0x05, 0x04, 0x06, 
-  0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x07, 0x08, 0x09, 0x0b, 0x06, 0x05, 0x0b, 0xd4, 0xf9, 0xf7, 0xc8, 0xf1, 0xf1, 0xf0, 0xf1, 0xe4, 0xdf, 0xda, 0xea, 0xf2, 0xed, 0xed, 0xec, 0xce, 0xf8, 0xf5, 0xf5, 0xf2, 0xd1, 0xd3, 0xe8, 0xe8, 0xe6, 0xcf, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xe5, 0xe4, 0xe4, 0xe5, 0xe5, 0xe2, 0xe1, 0xe2, 0xdf, 0xda, 0xd6, 0xd6, 0xcc, 0xe0, 0xe8, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xd8, 0x92, 0xea, 0xeb, 0xeb, 0xe9, 0xcc, 0xf6, 0xf5, 0xf5, 0xf1, 0xf2, 0xf6, 0xc9, 0xee, 0xf0, 0xed, 0xeb, 0xd2, 0xf3, 0xfe, 0xce, 0xea, 0xf0, 0xf0, 0xf0, 0xf0, 0xdb, 0xe5, 0xf0, 0xfb, 0xfe, 0xe4, 0x8b, 0x8d, 0x8a, 0x97, 0xe1, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf0, 0xf9, 0xf5, 0xf5, 0xdb, 0xe5, 0xed, 0xe9, 0x56, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 
-  0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x05, 0x03, 0x3e, 0xfc, 0xf7, 0xd6, 0xe3, 0xf1, 0xef, 0xee, 0xde, 0xea, 0xfb, 0xfb, 0xe2, 0xdb, 0xec, 0xec, 0xe9, 0xcd, 0xee, 0xf6, 0xf6, 0xf4, 0xcf, 0xd5, 0xe8, 0xe8, 0xe7, 0xcd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xd1, 0xe9, 0xed, 0xf0, 0xf1, 0xf4, 0xf3, 0xf4, 0xf6, 0xf6, 0xf3, 0xf2, 0xf1, 0xed, 0xe0, 0xdb, 0xd8, 0xf5, 0xfc, 0xfa, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0x9e, 0xde, 0xe8, 0xe7, 0xe6, 0xe5, 0xde, 0xf7, 0xf6, 0xf2, 0xf2, 0xf6, 0xc6, 0xef, 0xf1, 0xef, 0xed, 0xe5, 0xc5, 0xb8, 0xd8, 0xed, 0xf0, 0xf0, 0xf0, 0xe0, 0xd9, 0xef, 0xf7, 0xff, 0xea, 0x81, 0x8d, 0x8d, 0x87, 0x88, 0x94, 0xd5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf8, 0xe6, 0xe3, 0xf1, 0xf3, 0x7d, 0x09, 0x05, 0x06, 0x04, 0x06, 0x06, 0x04, 
-  0x08, 0x07, 0x06, 0x06, 0x05, 0x05, 0x07, 0x07, 0x08, 0x09, 0x08, 0x08, 0x07, 0x03, 0x77, 0xfb, 0xf8, 0xcb, 0xee, 0xf1, 0xf0, 0xe4, 0xe0, 0xf5, 0xfa, 0xfc, 0xff, 0xd4, 0xea, 0xeb, 0xe9, 0xe9, 0xcd, 0xf6, 0xf6, 0xf5, 0xd6, 0xd8, 0xe9, 0xe8, 0xe8, 0xcb, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xbe, 0xe7, 0xea, 0xee, 0xef, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xed, 0xdb, 0xe0, 0xf6, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xde, 0xb0, 0xe5, 0xe5, 0xe6, 0xe5, 0xd5, 0xf4, 0xf6, 0xf6, 0xf6, 0xf2, 0xcd, 0xec, 0xee, 0xef, 0xf0, 0xf0, 0xec, 0xdb, 0xef, 0xee, 0xee, 0xee, 0xe5, 0xd6, 0xf1, 0xf5, 0xfa, 0xed, 0x83, 0x8e, 0x91, 0x91, 0x8f, 0x8a, 0x8c, 0x91, 0xd2, 0xf7, 0xf4, 0xf4, 0xf4, 0xf5, 0xf1, 0xdd, 0xef, 0xf1, 0xa7, 0x0b, 0x06, 0x08, 0x07, 0x06, 0x07, 0x05, 0x06, 
-  0x06, 0x07, 0x07, 0x06, 0x05, 0x06, 0x07, 0x05, 0x07, 0x06, 0x08, 0x08, 0x08, 0x07, 0x90, 0xf9, 0xf7, 0xbe, 0xef, 0xf0, 0xf1, 0xdb, 0xed, 0xf8, 0xfc, 0xfd, 0xff, 0xe6, 0xe1, 0xeb, 0xe9, 0xe8, 0xc7, 0xf6, 0xf6, 0xf6, 0xd8, 0xd7, 0xe9, 0xe8, 0xe9, 0xc9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xbc, 0xe8, 0xeb, 0xed, 0xee, 0xee, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xed, 0xeb, 0xde, 0xf6, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xb2, 0xe4, 0xe5, 0xe4, 0xe3, 0xce, 0xf2, 0xf6, 0xf6, 0xf6, 0xf5, 0xce, 0xe8, 0xed, 0xee, 0xf1, 0xf1, 0xf2, 0xf1, 0xef, 0xed, 0xee, 0xea, 0xcc, 0xec, 0xf2, 0xf9, 0xf2, 0x87, 0x8f, 0x92, 0x96, 0x92, 0x93, 0x93, 0x92, 0x8f, 0xcc, 0xf6, 0xf4, 0xf2, 0xf3, 0xf2, 0xd3, 0xee, 0xf0, 0xc2, 0x19, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-  0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x08, 0x05, 0x07, 0x06, 0x07, 0x08, 0x0c, 0x5e, 0xd2, 0xf8, 0xf5, 0xb9, 0xf0, 0xf0, 0xf1, 0xda, 0xf4, 0xfa, 0xff, 0xff, 0xff, 0xdf, 0xe3, 0xec, 0xea, 0xe9, 0xd0, 0xf7, 0xf6, 0xf6, 0xd7, 0xd5, 0xe9, 0xe8, 0xe9, 0xc8, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xf3, 0xf0, 0xb6, 0xe8, 0xec, 0xec, 0xed, 0xea, 0xeb, 0xec, 0xec, 0xee, 0xee, 0xef, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xee, 0xf0, 0xec, 0xd9, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf7, 0xc2, 0xe1, 0xe5, 0xe4, 0xe2, 0xcc, 0xf0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xcf, 0xec, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xed, 0xec, 0xc6, 0xe9, 0xf0, 0xf4, 0xf7, 0x8e, 0x8c, 0x91, 0x92, 0x96, 0x95, 0x95, 0x95, 0x96, 0xc1, 0xf5, 0xf5, 0xf2, 0xf1, 0xf3, 0xdb, 0xf1, 0xf4, 0xdf, 0x37, 0x05, 0x06, 0x07, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 
-  0x06, 0x06, 0x06, 0x09, 0x06, 0x06, 0x06, 0x07, 0x08, 0x06, 0x06, 0x0a, 0x35, 0xe0, 0xd6, 0xf7, 0xf5, 0xbc, 0xf0, 0xf0, 0xf0, 0xe4, 0xd9, 0xf8, 0xff, 0xff, 0xff, 0xd4, 0xec, 0xed, 0xea, 0xd8, 0xde, 0xf6, 0xf6, 0xf6, 0xdd, 0xd2, 0xeb, 0xe9, 0xe9, 0xc7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xb5, 0xe7, 0xe9, 0xea, 0xea, 0xaa, 0x79, 0x7c, 0x7c, 0x7c, 0x7f, 0x83, 0x8d, 0xa5, 0xde, 0xef, 0xf1, 0xf0, 0xef, 0xed, 0xe4, 0xe7, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xdb, 0xd1, 0xe3, 0xe4, 0xe4, 0xdb, 0xe5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xd8, 0xe8, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xeb, 0xc8, 0xe9, 0xed, 0xf1, 0xf3, 0x96, 0x8c, 0x91, 0x93, 0x94, 0x97, 0x96, 0x96, 0x97, 0xb0, 0xf4, 0xf5, 0xf3, 0xf2, 0xf1, 0xda, 0xf1, 0xf3, 0xed, 0x61, 0x12, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 
-  0x05, 0x05, 0x07, 0x09, 0x07, 0x07, 0x05, 0x05, 0x06, 0x08, 0x06, 0x0b, 0xb0, 0xf1, 0xd6, 0xed, 0xf1, 0xc3, 0xed, 0xee, 0xef, 0xee, 0xdc, 0xd5, 0xf2, 0xe7, 0xd5, 0xea, 0xee, 0xed, 0xeb, 0xcf, 0xf5, 0xf6, 0xf6, 0xf6, 0xe3, 0xd1, 0xec, 0xea, 0xe9, 0xc6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xb6, 0xe7, 0xe8, 0xe9, 0xe9, 0xae, 0x2b, 0x1b, 0x23, 0x25, 0x21, 0x20, 0x23, 0x28, 0x32, 0xa3, 0xf0, 0xf1, 0xf0, 0xee, 0xf0, 0xd6, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xb9, 0xe2, 0xe4, 0xe4, 0xe6, 0xca, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfb, 0xd4, 0xe7, 0xee, 0xf0, 0xf0, 0xef, 0xd3, 0xdd, 0xeb, 0xf3, 0xf8, 0xaa, 0x88, 0x91, 0x93, 0x94, 0x96, 0x97, 0x99, 0x99, 0xa6, 0xef, 0xf6, 0xf4, 0xf2, 0xf2, 0xd8, 0xf4, 0xf5, 0xf5, 0x8f, 0x32, 0x11, 0x08, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 
-  0x06, 0x05, 0x06, 0x06, 0x05, 0x07, 0x07, 0x06, 0x05, 0x05, 0x06, 0x53, 0xea, 0xef, 0xf1, 0xd0, 0xf1, 0xe6, 0xc9, 0xee, 0xf0, 0xf0, 0xf1, 0xf0, 0xe8, 0xec, 0xf0, 0xf0, 0xee, 0xed, 0xe4, 0xde, 0xf0, 0xf6, 0xf6, 0xf4, 0xe2, 0xcf, 0xec, 0xea, 0xe8, 0xc9, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf1, 0xb7, 0xe8, 0xe9, 0xe9, 0xe9, 0xd7, 0xe3, 0xd7, 0xbf, 0xc0, 0xca, 0xc7, 0xbe, 0xa4, 0x62, 0x2c, 0xa7, 0xf0, 0xf1, 0xf0, 0xee, 0xd4, 0xf2, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xb9, 0xe2, 0xe4, 0xe4, 0xe7, 0xd0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf9, 0xd5, 0xeb, 0xed, 0xee, 0xec, 0xd8, 0xd5, 0xeb, 0xf3, 0xf7, 0xbb, 0x85, 0x8e, 0x91, 0x93, 0x95, 0x98, 0x9a, 0x9d, 0xa2, 0xe8, 0xf4, 0xf4, 0xf4, 0xf0, 0xda, 0xea, 0xf7, 0xf4, 0xc6, 0x5c, 0x2e, 0x11, 0x08, 0x04, 0x05, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 
-  0x06, 0x05, 0x06, 0x05, 0x07, 0x05, 0x05, 0x03, 0x04, 0x07, 0x14, 0xcb, 0xee, 0xee, 0xed, 0xd3, 0xf2, 0xf3, 0xd6, 0xdd, 0xed, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xe8, 0xce, 0xef, 0xf1, 0xf6, 0xf6, 0xf2, 0xe0, 0xcf, 0xeb, 0xea, 0xe8, 0xce, 0xf9, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xb3, 0xe8, 0xe9, 0xe9, 0xea, 0xd3, 0xf6, 0xf8, 0xf3, 0xf7, 0xf9, 0xf7, 0xf7, 0xf7, 0xf9, 0xd4, 0x70, 0xe7, 0xf0, 0xf0, 0xef, 0xe8, 0xdf, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xbb, 0xe3, 0xe5, 0xe5, 0xe7, 0xd6, 0xf6, 0xf9, 0xf9, 0xf6, 0xf6, 0xf5, 0xda, 0xe3, 0xed, 0xed, 0xed, 0xe3, 0xd1, 0xea, 0xf1, 0xf8, 0xe0, 0x80, 0x8d, 0x90, 0x91, 0x94, 0x96, 0x99, 0x9b, 0xa0, 0xe1, 0xf6, 0xf4, 0xf5, 0xf3, 0xdc, 0xe7, 0xf6, 0xf7, 0xcc, 0xf0, 0x90, 0x32, 0x10, 0x07, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x05, 0x05, 
-  0x07, 0x06, 0x05, 0x05, 0x05, 0x07, 0x05, 0x03, 0x02, 0x04, 0x72, 0xef, 0xee, 0xed, 0xee, 0xe3, 0xcb, 0xf5, 0xf5, 0xd8, 0xda, 0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xd4, 0xf7, 0xf4, 0xf1, 0xf6, 0xf6, 0xf2, 0xdf, 0xce, 0xec, 0xea, 0xe8, 0xd0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xb4, 0xe8, 0xe8, 0xe9, 0xed, 0xcc, 0xf9, 0xf5, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xfb, 0xee, 0xc8, 0xf1, 0xf1, 0xf1, 0xf2, 0xd8, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xfa, 0xbd, 0xe4, 0xe7, 0xe7, 0xe8, 0xd7, 0xf6, 0xfe, 0xfd, 0xf6, 0xf7, 0xd8, 0xde, 0xee, 0xed, 0xec, 0xea, 0xc9, 0xf1, 0xf3, 0xfa, 0xf4, 0x7f, 0x8d, 0x8f, 0x90, 0x93, 0x95, 0x98, 0x98, 0x9b, 0xd5, 0xf6, 0xf6, 0xf4, 0xf3, 0xe8, 0xe5, 0xf1, 0xf6, 0xc6, 0xec, 0xef, 0xd8, 0x30, 0x12, 0x09, 0x08, 0x07, 0x08, 0x06, 0x06, 0x07, 0x07, 0x05, 
-  0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0x04, 0x03, 0x04, 0x1a, 0xd9, 0xf0, 0xee, 0xed, 0xee, 0xbc, 0x89, 0xdb, 0xf5, 0xf5, 0xe1, 0xd1, 0xe3, 0xf2, 0xf1, 0xf1, 0xf3, 0xd7, 0xe2, 0xef, 0xf2, 0xf2, 0xf1, 0xf6, 0xf4, 0xec, 0xde, 0xcb, 0xec, 0xea, 0xe8, 0xcf, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xb5, 0xea, 0xeb, 0xec, 0xec, 0xcb, 0xfa, 0xf5, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xd4, 0xf4, 0xf1, 0xf1, 0xef, 0xd5, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xc1, 0xe6, 0xe7, 0xe7, 0xe7, 0xdb, 0xf6, 0xf8, 0xf8, 0xf6, 0xe9, 0xd4, 0xef, 0xed, 0xec, 0xeb, 0xd0, 0xef, 0xf4, 0xfc, 0xfb, 0x95, 0x89, 0x90, 0x91, 0x93, 0x95, 0x96, 0x9a, 0x99, 0xca, 0xf7, 0xf6, 0xf6, 0xf4, 0xed, 0xd3, 0xef, 0xf9, 0xc3, 0xe3, 0xee, 0xef, 0xf1, 0x72, 0x14, 0x0a, 0x08, 0x08, 0x05, 0x05, 0x06, 0x07, 0x05, 0x04, 
-  0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x07, 0x7d, 0xf0, 0xef, 0xee, 0xed, 0xdd, 0x8f, 0x94, 0x97, 0xea, 0xf9, 0xf7, 0xfa, 0xd9, 0xf0, 0xf0, 0xf0, 0xef, 0xe1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xef, 0xee, 0xe0, 0xc7, 0xea, 0xea, 0xe8, 0xce, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xb6, 0xea, 0xec, 0xec, 0xec, 0xc6, 0xfb, 0xf5, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xec, 0xdc, 0xf0, 0xf0, 0xf0, 0xda, 0xdd, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xbe, 0xe9, 0xe7, 0xe8, 0xe7, 0xd0, 0xf6, 0xf6, 0xf7, 0xf3, 0xce, 0xec, 0xed, 0xed, 0xeb, 0xd6, 0xe5, 0xf3, 0xf9, 0xff, 0xb0, 0x82, 0x8d, 0x91, 0x91, 0x95, 0x98, 0x9a, 0x9a, 0xbb, 0xf6, 0xf7, 0xf6, 0xf5, 0xef, 0xd1, 0xee, 0xf8, 0xcb, 0xa3, 0xed, 0xf0, 0xf0, 0xf0, 0xd8, 0x23, 0x09, 0x06, 0x04, 0x05, 0x03, 0x04, 0x04, 0x05, 0x05, 
-  0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06, 0x1c, 0xdc, 0xee, 0xee, 0xee, 0xee, 0xa7, 0x92, 0x95, 0x97, 0x98, 0xd6, 0xf8, 0xf6, 0xe7, 0xed, 0xf0, 0xef, 0xee, 0xdd, 0xf0, 0xf1, 0xf5, 0xfa, 0xf3, 0xf9, 0xf2, 0xef, 0xe2, 0xc6, 0xe9, 0xeb, 0xe9, 0xce, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf2, 0xbc, 0xeb, 0xed, 0xed, 0xee, 0xd0, 0xfb, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xd5, 0xee, 0xef, 0xf0, 0xf0, 0xc6, 0xef, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xef, 0xd1, 0xec, 0xeb, 0xe9, 0xd3, 0xec, 0xf6, 0xf6, 0xf6, 0xd1, 0xef, 0xee, 0xee, 0xed, 0xdd, 0xdf, 0xf2, 0xf7, 0xfb, 0xe0, 0x7d, 0x90, 0x91, 0x95, 0x96, 0x98, 0x9b, 0x9c, 0xac, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xd1, 0xef, 0xf0, 0xdb, 0x9f, 0xab, 0xd3, 0xef, 0xee, 0xed, 0xed, 0x7b, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x09, 0x07, 0x03, 0x06, 
-  0x05, 0x05, 0x04, 0x07, 0x04, 0x05, 0x05, 0x09, 0x77, 0xef, 0xee, 0xee, 0xee, 0xd7, 0x8d, 0x92, 0x93, 0x95, 0x96, 0x99, 0xd8, 0xfb, 0xda, 0xee, 0xf1, 0xef, 0xe7, 0xe0, 0xf2, 0xf3, 0xf3, 0xf6, 0xf5, 0xf9, 0xf2, 0xf0, 0xde, 0xc4, 0xea, 0xea, 0xe9, 0xcd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xc7, 0xed, 0xee, 0xee, 0xee, 0xe6, 0xf9, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf3, 0xf1, 0xe3, 0xd3, 0xeb, 0xef, 0xef, 0xf0, 0xeb, 0xc8, 0xef, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xd4, 0xe6, 0xed, 0xed, 0xec, 0xcc, 0xf7, 0xf6, 0xfa, 0xdb, 0xe9, 0xf3, 0xee, 0xf0, 0xe9, 0xd4, 0xf0, 0xf4, 0xfa, 0xe7, 0x86, 0x8f, 0x92, 0x94, 0x96, 0x97, 0x9c, 0x9d, 0xa6, 0xea, 0xf4, 0xf4, 0xf4, 0xf4, 0xcd, 0xed, 0xf0, 0xe8, 0x9c, 0xac, 0xa8, 0xb0, 0xef, 0xf0, 0xed, 0xed, 0xd2, 0x1f, 0x07, 0x08, 0x09, 0x08, 0x0c, 0x06, 0x04, 0x07, 
-  0x05, 0x05, 0x04, 0x08, 0x04, 0x05, 0x07, 0x18, 0xd4, 0xf0, 0xef, 0xed, 0xee, 0xa9, 0x8f, 0x8f, 0x90, 0x92, 0x94, 0x95, 0xc9, 0xfa, 0xce, 0xf0, 0xf1, 0xef, 0xe1, 0xe6, 0xf5, 0xf6, 0xf4, 0xf2, 0xf8, 0xf9, 0xf0, 0xf0, 0xdb, 0xc3, 0xec, 0xea, 0xe8, 0xce, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xca, 0xee, 0xee, 0xef, 0xef, 0xe6, 0xdc, 0xd8, 0xd6, 0xd2, 0xcd, 0xce, 0xcd, 0xd1, 0xd9, 0xea, 0xec, 0xef, 0xf0, 0xf0, 0xc7, 0xeb, 0xee, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd4, 0xee, 0xec, 0xed, 0xe9, 0xd4, 0xf5, 0xf6, 0xe7, 0xde, 0xf1, 0xf1, 0xf0, 0xee, 0xcc, 0xf0, 0xf0, 0xf6, 0xf6, 0x8d, 0x8f, 0x92, 0x93, 0x96, 0x98, 0x9b, 0x9d, 0xa1, 0xdc, 0xf3, 0xf2, 0xf2, 0xf3, 0xd6, 0xea, 0xf1, 0xf0, 0xa1, 0xad, 0xaa, 0xa6, 0xa4, 0xd9, 0xef, 0xee, 0xec, 0xea, 0x5e, 0x08, 0x08, 0x09, 0x09, 0x07, 0x06, 0x06, 0x04, 
-  0x06, 0x05, 0x07, 0x07, 0x04, 0x04, 0x07, 0x59, 0xee, 0xee, 0xed, 0xed, 0xdc, 0x8c, 0x8e, 0x8e, 0x8f, 0x92, 0x92, 0x94, 0xbf, 0xf8, 0xd3, 0xf2, 0xf0, 0xee, 0xdc, 0xec, 0xf5, 0xf6, 0xf6, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xd7, 0xc3, 0xec, 0xea, 0xe8, 0xd1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xc7, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xee, 0xec, 0xef, 0xed, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xed, 0xed, 0xda, 0xd8, 0xe9, 0xf0, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd0, 0xec, 0xec, 0xeb, 0xd6, 0xea, 0xf8, 0xed, 0xe3, 0xf2, 0xf1, 0xf1, 0xf0, 0xd3, 0xeb, 0xf0, 0xf6, 0xf6, 0x93, 0x8e, 0x94, 0x95, 0x96, 0x97, 0x99, 0x9c, 0x9f, 0xd6, 0xf4, 0xf1, 0xf1, 0xf0, 0xde, 0xe5, 0xee, 0xf2, 0xa5, 0xa8, 0xab, 0xa9, 0xa6, 0xa4, 0xb3, 0xef, 0xed, 0xec, 0xea, 0xb7, 0x12, 0x0a, 0x08, 0x07, 0x08, 0x08, 0x08, 0x07, 
-  0x05, 0x06, 0x07, 0x06, 0x03, 0x04, 0x08, 0xae, 0xf1, 0xee, 0xed, 0xee, 0xaf, 0x8b, 0x8b, 0x8b, 0x8e, 0x90, 0x92, 0x95, 0xc5, 0xfa, 0xce, 0xf3, 0xf0, 0xed, 0xda, 0xf3, 0xf5, 0xf6, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xd3, 0xc2, 0xec, 0xea, 0xe8, 0xd3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xc6, 0xf2, 0xf0, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf0, 0xee, 0xef, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xd6, 0xc0, 0xed, 0xed, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xdf, 0xe7, 0xed, 0xed, 0xd1, 0xe7, 0xf0, 0xf8, 0xd9, 0xf3, 0xf2, 0xf1, 0xf1, 0xe1, 0xdf, 0xed, 0xf6, 0xfa, 0xab, 0x8d, 0x91, 0x94, 0x96, 0x98, 0x98, 0x9b, 0x9f, 0xcd, 0xf4, 0xf4, 0xf1, 0xf1, 0xe0, 0xda, 0xf0, 0xf2, 0xad, 0xa3, 0xa5, 0xa7, 0xa5, 0xa4, 0xa3, 0xa0, 0xdd, 0xec, 0xec, 0xea, 0xe7, 0x3c, 0x0b, 0x06, 0x06, 0x09, 0x05, 0x05, 0x08, 
-  0x05, 0x05, 0x05, 0x04, 0x03, 0x05, 0x2e, 0xe7, 0xed, 0xed, 0xee, 0xe8, 0x8c, 0x88, 0x88, 0x8b, 0x8c, 0x8f, 0x92, 0x93, 0xc2, 0xff, 0xd8, 0xf4, 0xf0, 0xee, 0xdd, 0xf1, 0xf7, 0xf7, 0xf6, 0xf6, 0xf2, 0xf1, 0xf1, 0xef, 0xd5, 0xc3, 0xec, 0xea, 0xe8, 0xd3, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xd0, 0xf0, 0xef, 0xf1, 0xf3, 0xf4, 0xf2, 0xf1, 0xf0, 0xef, 0xee, 0xed, 0xed, 0xed, 0xec, 0xec, 0xed, 0xad, 0x68, 0xe3, 0xf5, 0xf3, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xd5, 0xef, 0xf0, 0xe0, 0xe2, 0xf1, 0xf6, 0xd8, 0xf1, 0xf3, 0xf4, 0xf1, 0xe4, 0xd7, 0xf0, 0xf5, 0xfc, 0xb0, 0x8a, 0x94, 0x95, 0x97, 0x97, 0x9a, 0x9a, 0x9a, 0xc1, 0xf2, 0xf3, 0xf3, 0xf3, 0xeb, 0xde, 0xef, 0xf8, 0xba, 0xa2, 0xa5, 0xa5, 0xa4, 0xa2, 0xa2, 0xa2, 0xa1, 0xbe, 0xed, 0xec, 0xeb, 0xea, 0x8f, 0x0f, 0x07, 0x06, 0x09, 0x06, 0x07, 0x06, 
-  0x06, 0x04, 0x04, 0x05, 0x03, 0x07, 0x70, 0xed, 0xed, 0xed, 0xee, 0xc4, 0x89, 0x87, 0x87, 0x89, 0x8c, 0x90, 0x8d, 0xae, 0xee, 0xff, 0xed, 0xf2, 0xf1, 0xf0, 0xdf, 0xf6, 0xfa, 0xf9, 0xf7, 0xf6, 0xf2, 0xf1, 0xf1, 0xef, 0xd6, 0xc4, 0xec, 0xea, 0xe8, 0xd4, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xc8, 0xa5, 0xb4, 0xb9, 0xb6, 0xb2, 0xbc, 0xc2, 0xc8, 0xce, 0xd5, 0xdc, 0xdc, 0xd1, 0xb7, 0x92, 0x50, 0x31, 0xcc, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xfa, 0xe8, 0xe9, 0xef, 0xe8, 0xde, 0xec, 0xf6, 0xdf, 0xec, 0xf1, 0xf3, 0xf2, 0xea, 0xd4, 0xee, 0xf4, 0xfa, 0xc9, 0x86, 0x90, 0x94, 0x96, 0x97, 0x9a, 0x9d, 0x9c, 0xb6, 0xf0, 0xf1, 0xf1, 0xf1, 0xee, 0xcd, 0xf3, 0xf6, 0xcc, 0xa0, 0xa6, 0xa4, 0xa2, 0xa1, 0xa0, 0x9f, 0xa0, 0xa0, 0xa4, 0xec, 0xec, 0xeb, 0xeb, 0xcc, 0x20, 0x0b, 0x09, 0x07, 0x0a, 0x08, 0x08, 
-  0x04, 0x04, 0x05, 0x06, 0x04, 0x0a, 0xb0, 0xed, 0xed, 0xee, 0xf0, 0xa1, 0x89, 0x87, 0x88, 0x87, 0x89, 0x86, 0xc2, 0xf8, 0xfa, 0xfe, 0xf1, 0xf0, 0xf2, 0xf1, 0xe1, 0xf8, 0xfa, 0xfa, 0xf8, 0xf6, 0xf2, 0xf1, 0xf1, 0xf0, 0xd7, 0xc6, 0xec, 0xea, 0xe8, 0xd4, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xc9, 0x4a, 0x38, 0x2d, 0x25, 0x17, 0x12, 0x11, 0x11, 0x13, 0x17, 0x1b, 0x1c, 0x1c, 0x1b, 0x1d, 0x5c, 0xd9, 0xf1, 0xf1, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfb, 0xf9, 0xd9, 0xf2, 0xf0, 0xd6, 0xeb, 0xf2, 0xe1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf0, 0xce, 0xf3, 0xf5, 0xfb, 0xd5, 0x83, 0x8f, 0x93, 0x94, 0x97, 0x99, 0x9e, 0x9f, 0xad, 0xee, 0xf1, 0xf1, 0xf1, 0xed, 0xde, 0xf1, 0xf3, 0xd9, 0x9f, 0xa2, 0xa5, 0xa3, 0xa1, 0x9e, 0x9e, 0x9d, 0x9e, 0x9f, 0xa0, 0xd8, 0xee, 0xec, 0xeb, 0xe9, 0x4f, 0x0d, 0x09, 0x06, 0x0b, 0x0a, 0x0b, 
-  0x07, 0x05, 0x06, 0x04, 0x04, 0x1b, 0xe6, 0xed, 0xed, 0xed, 0xe1, 0x88, 0x86, 0x85, 0x85, 0x85, 0x82, 0xc0, 0xf8, 0xfd, 0xfa, 0xdf, 0xea, 0xf2, 0xf4, 0xf2, 0xef, 0xd7, 0xe3, 0xfb, 0xfa, 0xf7, 0xf5, 0xf1, 0xf1, 0xf4, 0xdd, 0xc8, 0xec, 0xea, 0xe8, 0xd3, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xe8, 0xa1, 0x8c, 0x85, 0x6d, 0x50, 0x34, 0x2d, 0x21, 0x1d, 0x1c, 0x22, 0x2f, 0x45, 0x76, 0xbd, 0xf7, 0xf6, 0xf1, 0xf1, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xd9, 0xf1, 0xf1, 0xda, 0xe9, 0xf5, 0xde, 0xe3, 0xf1, 0xf1, 0xf1, 0xef, 0xcf, 0xef, 0xf6, 0xfa, 0xe6, 0x84, 0x90, 0x93, 0x94, 0x97, 0x99, 0x9b, 0x9d, 0xa5, 0xe9, 0xf4, 0xf2, 0xf1, 0xf2, 0xd1, 0xef, 0xf2, 0xe0, 0xa1, 0xa5, 0xa5, 0xa4, 0xa2, 0xa0, 0x9d, 0x9c, 0x9e, 0x9f, 0x9e, 0x9f, 0xb9, 0xee, 0xec, 0xe9, 0xe7, 0x96, 0x0f, 0x08, 0x06, 0x05, 0x09, 0x08, 
-  0x07, 0x05, 0x06, 0x05, 0x06, 0x53, 0xec, 0xec, 0xec, 0xed, 0xc5, 0x88, 0x86, 0x84, 0x84, 0x83, 0xa5, 0xf7, 0xfb, 0xf1, 0xd8, 0xf6, 0xf6, 0xf2, 0xf4, 0xf2, 0xf0, 0xee, 0xe4, 0xda, 0xfa, 0xf7, 0xf6, 0xf2, 0xf1, 0xf5, 0xde, 0xcb, 0xec, 0xea, 0xe9, 0xd2, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf3, 0xf6, 0xf8, 0xfa, 0xf8, 0xf6, 0xf6, 0xf7, 0xf7, 0xf6, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf6, 0xf2, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xd5, 0xe8, 0xf1, 0xdf, 0xea, 0xf1, 0xea, 0xd8, 0xf0, 0xf1, 0xf2, 0xf1, 0xd7, 0xe8, 0xf0, 0xf5, 0xf0, 0x84, 0x8d, 0x93, 0x96, 0x96, 0x98, 0x9c, 0x9c, 0xa1, 0xe4, 0xf4, 0xf3, 0xf2, 0xf2, 0xdd, 0xef, 0xf5, 0xeb, 0x98, 0xa4, 0xa4, 0xa4, 0xa3, 0xa0, 0x9f, 0x9d, 0x9f, 0x9e, 0x9d, 0x9d, 0x9a, 0x92, 0xe9, 0xec, 0xe9, 0xe7, 0xc9, 0x1d, 0x0c, 0x04, 0x09, 0x05, 0x08, 
-  0x07, 0x05, 0x05, 0x05, 0x07, 0x91, 0xec, 0xec, 0xec, 0xed, 0xac, 0x87, 0x85, 0x86, 0x84, 0x7d, 0xed, 0xfb, 0xf6, 0xd2, 0xf6, 0xf5, 0xf5, 0xf2, 0xf3, 0xf1, 0xf1, 0xf0, 0xee, 0xe9, 0xdb, 0xf5, 0xf8, 0xf5, 0xf1, 0xf5, 0xdd, 0xcb, 0xec, 0xea, 0xe9, 0xd3, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xdf, 0xe1, 0xf2, 0xe5, 0xeb, 0xee, 0xee, 0xd1, 0xef, 0xf0, 0xf3, 0xf1, 0xcf, 0xe1, 0xef, 0xf7, 0xf6, 0x96, 0x8d, 0x93, 0x97, 0x97, 0x98, 0x9b, 0x9c, 0x9e, 0xdc, 0xf2, 0xf2, 0xf2, 0xf2, 0xdb, 0xe0, 0xf2, 0xf2, 0x97, 0xa1, 0xa4, 0xa3, 0xa2, 0xa1, 0xa0, 0x9f, 0x9f, 0x9d, 0x9e, 0x9c, 0x9b, 0x91, 0x86, 0xd0, 0xeb, 0xe8, 0xeb, 0xe8, 0x3e, 0x0d, 0x0a, 0x09, 0x0a, 0x0a, 
-  0x05, 0x05, 0x07, 0x05, 0x0e, 0xcb, 0xec, 0xec, 0xec, 0xec, 0x93, 0x87, 0x85, 0x84, 0x82, 0xac, 0xf9, 0xf7, 0xcf, 0xf1, 0xf5, 0xf5, 0xf3, 0xf4, 0xf1, 0xf1, 0xf1, 0xef, 0xec, 0xeb, 0xe8, 0xd4, 0xf9, 0xf5, 0xf1, 0xf3, 0xe0, 0xcd, 0xed, 0xeb, 0xea, 0xd2, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf7, 0xfa, 0xd2, 0xe1, 0xee, 0xe5, 0xe0, 0xf2, 0xf4, 0xd0, 0xef, 0xef, 0xef, 0xf0, 0xdc, 0xe5, 0xf0, 0xf7, 0xf8, 0x96, 0x91, 0x93, 0x95, 0x98, 0x99, 0x9b, 0x9d, 0x9c, 0xd3, 0xf4, 0xf2, 0xf1, 0xf1, 0xe4, 0xdc, 0xea, 0xef, 0x9e, 0xa0, 0xa1, 0xa3, 0xa2, 0xa2, 0xa0, 0xa0, 0x9f, 0x9e, 0x9e, 0x9b, 0x9b, 0x93, 0x87, 0x83, 0xb1, 0xec, 0xea, 0xeb, 0xe9, 0x69, 0x0d, 0x08, 0x09, 0x08, 0x09, 
-  0x06, 0x06, 0x07, 0x06, 0x25, 0xe9, 0xec, 0xec, 0xec, 0xd7, 0x88, 0x87, 0x84, 0x85, 0x82, 0xdd, 0xf9, 0xe9, 0xde, 0xf1, 0xf3, 0xf4, 0xea, 0xd9, 0xe5, 0xe0, 0xcd, 0xe5, 0xea, 0xea, 0xea, 0xce, 0xf3, 0xf5, 0xf1, 0xf1, 0xe6, 0xcf, 0xed, 0xec, 0xeb, 0xd1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf2, 0xf2, 0xd9, 0xe2, 0xee, 0xe7, 0xdb, 0xec, 0xf0, 0xce, 0xea, 0xed, 0xee, 0xf0, 0xdd, 0xd8, 0xf0, 0xf9, 0xfd, 0xa5, 0x90, 0x92, 0x93, 0x98, 0x9b, 0x9c, 0x9c, 0x9d, 0xc8, 0xf4, 0xf4, 0xf2, 0xf1, 0xec, 0xd9, 0xeb, 0xef, 0xc2, 0x97, 0xa1, 0xa1, 0xa1, 0xa2, 0xa1, 0x9e, 0xa0, 0xa0, 0x9e, 0x9c, 0x9b, 0x96, 0x88, 0x81, 0x82, 0x93, 0xee, 0xeb, 0xea, 0xe8, 0xa0, 0x11, 0x07, 0x05, 0x05, 0x08, 
-  0x04, 0x04, 0x06, 0x06, 0x52, 0xed, 0xed, 0xec, 0xec, 0xbb, 0x87, 0x86, 0x86, 0x86, 0x79, 0xfb, 0xfa, 0xd4, 0xf5, 0xf1, 0xf1, 0xec, 0xd8, 0xeb, 0xf7, 0xf9, 0xfa, 0xc9, 0xe8, 0xe8, 0xe9, 0xe9, 0xd1, 0xf6, 0xf5, 0xf3, 0xe3, 0xd2, 0xed, 0xec, 0xea, 0xcf, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xf9, 0xe5, 0xd0, 0xe9, 0xed, 0xe9, 0xe6, 0xec, 0xee, 0xd4, 0xe9, 0xec, 0xec, 0xec, 0xe2, 0xdd, 0xef, 0xf5, 0xfd, 0xb3, 0x8c, 0x91, 0x92, 0x96, 0x98, 0x98, 0x9b, 0x9d, 0xbb, 0xf5, 0xf3, 0xf2, 0xef, 0xee, 0xcb, 0xe2, 0xe9, 0xd3, 0xee, 0x9a, 0x9e, 0x9f, 0x9e, 0xa0, 0xa0, 0x9f, 0xa1, 0x9f, 0x9e, 0x9c, 0x99, 0x8b, 0x7f, 0x80, 0x83, 0x84, 0xe5, 0xeb, 0xe8, 0xe7, 0xc3, 0x1d, 0x08, 0x06, 0x06, 0x04, 
-  0x07, 0x05, 0x06, 0x09, 0x87, 0xee, 0xed, 0xec, 0xec, 0xa1, 0x86, 0x84, 0x85, 0x86, 0x98, 0xfc, 0xfb, 0xd1, 0xf3, 0xf1, 0xf1, 0xd8, 0xec, 0xf1, 0xfa, 0xfa, 0xfb, 0xe6, 0xdf, 0xe8, 0xe9, 0xe8, 0xc7, 0xf6, 0xf6, 0xf4, 0xe1, 0xd5, 0xed, 0xec, 0xea, 0xcf, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xfa, 0xfa, 0xfa, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf8, 0xf9, 0xf6, 0xe5, 0xce, 0xd8, 0xf0, 0xef, 0xde, 0xe5, 0xec, 0xee, 0xce, 0xe7, 0xec, 0xeb, 0xec, 0xe9, 0xda, 0xf5, 0xf7, 0xfa, 0xca, 0x8c, 0x8e, 0x92, 0x94, 0x97, 0x99, 0x99, 0x9b, 0xaf, 0xf2, 0xf5, 0xf3, 0xf2, 0xef, 0xd9, 0xe7, 0xe6, 0xd1, 0xeb, 0xf5, 0x9a, 0x9d, 0x9d, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x9d, 0x9c, 0x90, 0x82, 0x80, 0x81, 0x83, 0x86, 0xcf, 0xeb, 0xe8, 0xe8, 0xe5, 0x28, 0x09, 0x04, 0x0a, 0x05, 
-  0x08, 0x05, 0x05, 0x0a, 0xb9, 0xee, 0xed, 0xec, 0xe9, 0x8c, 0x85, 0x85, 0x85, 0x85, 0x98, 0xfc, 0xff, 0xd2, 0xf1, 0xf1, 0xf1, 0xd9, 0xf1, 0xf5, 0xfc, 0xfd, 0xff, 0xf3, 0xdb, 0xe7, 0xe7, 0xe7, 0xc5, 0xf6, 0xf6, 0xf6, 0xe5, 0xd6, 0xed, 0xec, 0xeb, 0xcf, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xf6, 0xf7, 0xeb, 0xd7, 0xd5, 0xf0, 0xee, 0xef, 0xdc, 0xe9, 0xea, 0xed, 0xd6, 0xe5, 0xec, 0xeb, 0xeb, 0xe9, 0xd5, 0xf7, 0xfb, 0xfe, 0xdf, 0x8a, 0x8f, 0x90, 0x91, 0x94, 0x98, 0x9b, 0x99, 0xa4, 0xeb, 0xf4, 0xf4, 0xf4, 0xf3, 0xd7, 0xea, 0xe9, 0xe3, 0xe1, 0xf8, 0xf5, 0x9b, 0x9a, 0x9b, 0x9d, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9b, 0x96, 0x86, 0x81, 0x82, 0x81, 0x84, 0x87, 0xb8, 0xea, 0xe8, 0xe7, 0xe9, 0x56, 0x10, 0x08, 0x07, 0x05, 
-  0x07, 0x06, 0x06, 0x15, 0xdc, 0xed, 0xec, 0xec, 0xde, 0x84, 0x84, 0x85, 0x85, 0x85, 0x7d, 0xfc, 0xfd, 0xce, 0xf2, 0xf1, 0xf0, 0xe4, 0xdd, 0xf6, 0xfd, 0xff, 0xfe, 0xd2, 0xe7, 0xe8, 0xe7, 0xe8, 0xcb, 0xf6, 0xf6, 0xf5, 0xe2, 0xd8, 0xed, 0xec, 0xeb, 0xcf, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xe7, 0xe0, 0xe5, 0xec, 0xef, 0xf0, 0xf5, 0xf6, 0xf8, 0xee, 0xe4, 0xda, 0xcf, 0xd0, 0xd5, 0xde, 0xe8, 0xd6, 0xd5, 0xe1, 0xee, 0xef, 0xee, 0xef, 0xdf, 0xe4, 0xf1, 0xf4, 0xd8, 0xe1, 0xed, 0xed, 0xec, 0xed, 0xda, 0xf5, 0xf7, 0xfb, 0xeb, 0x90, 0x8f, 0x90, 0x92, 0x94, 0x95, 0x98, 0x99, 0xa0, 0xe3, 0xf4, 0xf2, 0xf2, 0xf2, 0xd8, 0xed, 0xef, 0xe5, 0xe8, 0xf6, 0xf6, 0xf2, 0x9a, 0x99, 0x9a, 0x9b, 0x9f, 0x9e, 0x9f, 0x9c, 0x9b, 0x97, 0x86, 0x80, 0x82, 0x81, 0x82, 0x85, 0x86, 0xa3, 0xec, 0xe8, 0xe7, 0xe6, 0x81, 0x0e, 0x06, 0x05, 0x05, 
-  0x04, 0x04, 0x05, 0x2b, 0xeb, 0xec, 0xec, 0xec, 0xcd, 0x85, 0x86, 0x85, 0x86, 0x86, 0x80, 0xec, 0xfc, 0xd3, 0xf0, 0xf0, 0xef, 0xee, 0xe2, 0xdc, 0xfc, 0xfb, 0xdd, 0xdd, 0xe9, 0xe9, 0xe9, 0xd1, 0xef, 0xf6, 0xf6, 0xf4, 0xe0, 0xd9, 0xed, 0xec, 0xeb, 0xd0, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xc1, 0xe8, 0xea, 0xe9, 0xeb, 0xee, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xef, 0xf1, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed, 0xef, 0xd5, 0xf2, 0xf8, 0xd9, 0xe7, 0xef, 0xef, 0xee, 0xed, 0xd4, 0xf4, 0xf7, 0xfb, 0xed, 0x92, 0x8f, 0x8f, 0x90, 0x93, 0x94, 0x97, 0x98, 0x9b, 0xd5, 0xf6, 0xf3, 0xf2, 0xf1, 0xdd, 0xe6, 0xf0, 0xeb, 0xc2, 0xf3, 0xf6, 0xf5, 0xf0, 0x98, 0x97, 0x9a, 0x9c, 0x9e, 0x9e, 0x9d, 0x99, 0x96, 0x88, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x85, 0x86, 0x91, 0xea, 0xe8, 0xe7, 0xe7, 0xa2, 0x0d, 0x05, 0x07, 0x05, 
-  0x06, 0x03, 0x04, 0x5b, 0xec, 0xeb, 0xeb, 0xec, 0xb9, 0x85, 0x86, 0x85, 0x86, 0x86, 0x89, 0xbe, 0xfa, 0xf5, 0xd4, 0xf1, 0xf0, 0xf0, 0xf0, 0xe9, 0xcc, 0xd4, 0xe8, 0xeb, 0xea, 0xea, 0xe9, 0xc7, 0xf5, 0xf6, 0xf6, 0xf4, 0xe0, 0xd9, 0xed, 0xe9, 0xe9, 0xd0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xbb, 0xe9, 0xeb, 0xeb, 0xec, 0xef, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe6, 0xf7, 0xe1, 0xe3, 0xf1, 0xf1, 0xf0, 0xef, 0xf0, 0xe1, 0xe7, 0xfc, 0xf2, 0x9b, 0x96, 0x92, 0x93, 0x93, 0x95, 0x95, 0x98, 0x96, 0xc6, 0xf5, 0xf5, 0xf5, 0xf3, 0xe6, 0xdf, 0xef, 0xf1, 0x6d, 0xb6, 0xf4, 0xf5, 0xf4, 0xed, 0x95, 0x96, 0x99, 0x9a, 0x9c, 0x9b, 0x98, 0x96, 0x8a, 0x7f, 0x7f, 0x80, 0x81, 0x83, 0x85, 0x84, 0x86, 0x86, 0xe0, 0xe8, 0xe7, 0xe7, 0xbc, 0x10, 0x04, 0x08, 0x06, 
-  0x04, 0x03, 0x03, 0x7f, 0xea, 0xeb, 0xeb, 0xeb, 0xa9, 0x84, 0x85, 0x86, 0x85, 0x87, 0x8a, 0x8f, 0xfb, 0xfb, 0xd1, 0xea, 0xef, 0xef, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xeb, 0xce, 0xe9, 0xf3, 0xf8, 0xf6, 0xf4, 0xdf, 0xd8, 0xec, 0xe9, 0xe9, 0xcf, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xbf, 0xe8, 0xea, 0xeb, 0xeb, 0xee, 0xef, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xed, 0xed, 0xee, 0xdc, 0xcf, 0xf4, 0xf9, 0xd4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xe5, 0xe6, 0xb1, 0x9d, 0x98, 0x95, 0x95, 0x95, 0x97, 0x99, 0x97, 0xb8, 0xf4, 0xf4, 0xf3, 0xf4, 0xf0, 0xd8, 0xf0, 0xf5, 0x8c, 0x28, 0xaf, 0xf2, 0xf2, 0xf1, 0xea, 0x93, 0x95, 0x98, 0x9a, 0x99, 0x98, 0x96, 0x8d, 0x81, 0x7e, 0x80, 0x82, 0x82, 0x84, 0x85, 0x86, 0x87, 0x85, 0xcd, 0xeb, 0xe8, 0xe7, 0xd4, 0x1a, 0x04, 0x05, 0x05, 
-  0x05, 0x03, 0x07, 0x9d, 0xec, 0xeb, 0xeb, 0xeb, 0x99, 0x85, 0x86, 0x88, 0x86, 0x86, 0x89, 0x85, 0xcb, 0xf9, 0xf3, 0xcc, 0xe8, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xef, 0xed, 0xeb, 0xce, 0xe6, 0xf8, 0xfa, 0xfe, 0xf5, 0xf0, 0xe2, 0xd7, 0xec, 0xe9, 0xe8, 0xce, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xbf, 0xe8, 0xea, 0xeb, 0xec, 0xed, 0xed, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xee, 0xee, 0xef, 0xec, 0xdb, 0xcb, 0xd2, 0xd5, 0xeb, 0xf6, 0xf8, 0xe3, 0xe3, 0xef, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf5, 0xf2, 0xc8, 0x9e, 0x99, 0x94, 0x97, 0x99, 0x99, 0x98, 0xab, 0xf0, 0xf4, 0xf3, 0xf1, 0xf4, 0xcf, 0xf1, 0xf3, 0xb2, 0x22, 0x25, 0xb0, 0xf2, 0xf1, 0xf0, 0xe9, 0x90, 0x94, 0x98, 0x98, 0x97, 0x96, 0x8f, 0x83, 0x7f, 0x80, 0x81, 0x82, 0x86, 0x85, 0x84, 0x86, 0x86, 0x85, 0xbb, 0xeb, 0xe8, 0xe8, 0xe8, 0x20, 0x03, 0x04, 0x06, 
-  0x04, 0x04, 0x0b, 0xb6, 0xec, 0xec, 0xeb, 0xe9, 0x8e, 0x86, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8b, 0x8a, 0xe9, 0xf6, 0xf0, 0xd0, 0xd5, 0xf0, 0xf0, 0xed, 0xed, 0xf1, 0xd3, 0xd3, 0xe5, 0xf1, 0xf9, 0xfa, 0xfe, 0xf4, 0xef, 0xe5, 0xd4, 0xec, 0xe9, 0xe9, 0xd2, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xbc, 0xe8, 0xea, 0xeb, 0xeb, 0xa4, 0x7c, 0x69, 0x6c, 0x77, 0x8b, 0x99, 0xa4, 0xac, 0xb1, 0xb0, 0xa5, 0xa5, 0xaf, 0xc0, 0xc5, 0xd3, 0xe6, 0xf6, 0xf2, 0xcf, 0xef, 0xf0, 0xee, 0xe7, 0xd7, 0xf1, 0xf1, 0xf4, 0xf5, 0xf7, 0xf8, 0xd2, 0x9b, 0x98, 0x99, 0x9a, 0x9a, 0xa4, 0xec, 0xf5, 0xf3, 0xf0, 0xf0, 0xd2, 0xeb, 0xf3, 0xd7, 0x31, 0x22, 0x25, 0xb0, 0xf1, 0xf1, 0xf1, 0xea, 0x92, 0x94, 0x96, 0x97, 0x96, 0x90, 0x86, 0x80, 0x80, 0x7f, 0x82, 0x83, 0x85, 0x84, 0x86, 0x86, 0x86, 0x85, 0xb1, 0xec, 0xea, 0xea, 0xeb, 0x41, 0x02, 0x07, 0x07, 
-  0x04, 0x05, 0x08, 0xca, 0xec, 0xec, 0xeb, 0xe2, 0x86, 0x85, 0x87, 0x88, 0x88, 0x87, 0x88, 0x8a, 0x8d, 0x92, 0xe7, 0xf1, 0xf0, 0xf3, 0xd2, 0xf0, 0xf0, 0xf0, 0xe9, 0xef, 0xeb, 0xec, 0xf2, 0xfa, 0xfa, 0xfc, 0xf0, 0xee, 0xe0, 0xd3, 0xec, 0xe9, 0xe8, 0xd3, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf1, 0xbb, 0xe9, 0xe9, 0xe9, 0xea, 0x81, 0x1c, 0x04, 0x06, 0x14, 0x3a, 0x5b, 0x7a, 0x8f, 0x9d, 0xa7, 0xa7, 0xa5, 0x8d, 0x6c, 0x4a, 0x67, 0xe9, 0xf6, 0xe5, 0xde, 0xee, 0xf1, 0xf1, 0xc7, 0x72, 0xaa, 0xf0, 0xf2, 0xf5, 0xf6, 0xf7, 0xfa, 0xdb, 0x9c, 0x9a, 0x9b, 0x9f, 0xe1, 0xf6, 0xf4, 0xf2, 0xf1, 0xdb, 0xe2, 0xf2, 0xf0, 0x4a, 0x1f, 0x21, 0x26, 0xaf, 0xf0, 0xf0, 0xf0, 0xeb, 0x92, 0x92, 0x96, 0x95, 0x94, 0x8c, 0x81, 0x7f, 0x82, 0x81, 0x83, 0x83, 0x85, 0x85, 0x87, 0x85, 0x86, 0x86, 0xa7, 0xed, 0xeb, 0xea, 0xe9, 0x5e, 0x01, 0x05, 0x06, 
-  0x03, 0x04, 0x12, 0xd7, 0xec, 0xec, 0xeb, 0xd9, 0x83, 0x84, 0x85, 0x85, 0x86, 0x85, 0x86, 0x88, 0x8d, 0x8f, 0x9c, 0xdd, 0xf6, 0xf8, 0xe7, 0xee, 0xf0, 0xf1, 0xdf, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xec, 0xea, 0xdd, 0xd3, 0xe9, 0xe8, 0xe7, 0xd3, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xb4, 0xe7, 0xe8, 0xe8, 0xea, 0x74, 0x0d, 0x05, 0x07, 0x07, 0x09, 0x0e, 0x14, 0x1a, 0x1e, 0x1f, 0x1b, 0x18, 0x1a, 0x28, 0x3a, 0x7d, 0xf2, 0xf5, 0xd5, 0xed, 0xee, 0xee, 0xec, 0xcf, 0xf6, 0x94, 0x75, 0xe0, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xe1, 0x9b, 0x95, 0xd6, 0xf6, 0xf4, 0xf2, 0xf1, 0xe2, 0xeb, 0xf1, 0xf3, 0x71, 0x1c, 0x1f, 0x21, 0x24, 0xb3, 0xf0, 0xf0, 0xef, 0xec, 0x8f, 0x8e, 0x93, 0x92, 0x90, 0x87, 0x81, 0x7e, 0x80, 0x83, 0x83, 0x84, 0x84, 0x85, 0x86, 0x85, 0x85, 0x85, 0x9b, 0xee, 0xeb, 0xea, 0xe8, 0x6f, 0x02, 0x04, 0x09, 
-  0x05, 0x04, 0x14, 0xe0, 0xec, 0xec, 0xeb, 0xce, 0x85, 0x85, 0x84, 0x85, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8e, 0x92, 0x96, 0xdc, 0xf9, 0xdd, 0xed, 0xf1, 0xf1, 0xd9, 0xf4, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf3, 0xf0, 0xed, 0xdc, 0xd2, 0xe9, 0xe8, 0xe6, 0xcf, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xb7, 0xe6, 0xe8, 0xe8, 0xe8, 0x71, 0x08, 0x0c, 0x0e, 0x0f, 0x0f, 0x10, 0x14, 0x18, 0x1a, 0x1e, 0x1d, 0x20, 0x23, 0x3d, 0x8e, 0xef, 0xf1, 0xf1, 0xd6, 0xed, 0xee, 0xef, 0xd1, 0xf2, 0xfb, 0xff, 0xd9, 0x84, 0xd6, 0xf4, 0xf6, 0xf5, 0xf6, 0xf5, 0xd6, 0xc9, 0xf5, 0xf5, 0xf3, 0xf1, 0xe2, 0xde, 0xf5, 0xfa, 0x9f, 0x1c, 0x1c, 0x1c, 0x1d, 0x4f, 0xbd, 0xed, 0xee, 0xee, 0xec, 0x89, 0x89, 0x91, 0x92, 0x8c, 0x85, 0x83, 0x82, 0x80, 0x83, 0x83, 0x82, 0x83, 0x83, 0x84, 0x84, 0x85, 0x84, 0x93, 0xed, 0xeb, 0xea, 0xe9, 0x88, 0x03, 0x06, 0x0a, 
-  0x04, 0x04, 0x1e, 0xe7, 0xec, 0xec, 0xeb, 0xc4, 0x84, 0x84, 0x85, 0x86, 0x85, 0x85, 0x87, 0x89, 0x8a, 0x8d, 0x91, 0x93, 0xcd, 0xfd, 0xc9, 0xef, 0xf0, 0xf0, 0xd8, 0xf4, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xfa, 0xf9, 0xf0, 0xd9, 0xd2, 0xe9, 0xe8, 0xe6, 0xcb, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf3, 0xf0, 0xbc, 0xe5, 0xe8, 0xe8, 0xe6, 0xa0, 0x44, 0x25, 0x1e, 0x1b, 0x15, 0x14, 0x15, 0x18, 0x1c, 0x32, 0x5a, 0x86, 0xbe, 0xf2, 0xf4, 0xf1, 0xf2, 0xd3, 0xeb, 0xee, 0xef, 0xef, 0xcd, 0xf1, 0xf9, 0xfc, 0xfa, 0xf9, 0x7c, 0xd1, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf3, 0xf3, 0xee, 0xde, 0xf0, 0xf4, 0xcc, 0x22, 0x1a, 0x18, 0x17, 0x52, 0xe7, 0xbf, 0xec, 0xed, 0xee, 0xec, 0x7c, 0x7e, 0x90, 0x90, 0x8a, 0x85, 0x84, 0x84, 0x83, 0x85, 0x84, 0x83, 0x83, 0x82, 0x82, 0x83, 0x84, 0x84, 0x8f, 0xec, 0xec, 0xea, 0xea, 0x9f, 0x04, 0x05, 0x08, 
-  0x03, 0x04, 0x2a, 0xea, 0xec, 0xec, 0xeb, 0xbb, 0x84, 0x85, 0x85, 0x86, 0x85, 0x84, 0x87, 0x89, 0x89, 0x8b, 0x8e, 0x93, 0xca, 0xff, 0xcc, 0xef, 0xf0, 0xf1, 0xd9, 0xf4, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf5, 0xf8, 0xef, 0xd7, 0xd1, 0xe9, 0xe8, 0xe7, 0xc8, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xbc, 0xe6, 0xe7, 0xe7, 0xe6, 0xda, 0xf7, 0xf7, 0xf2, 0xec, 0xed, 0xea, 0xe3, 0xe5, 0xeb, 0xf4, 0xf4, 0xf6, 0xf6, 0xf5, 0xf3, 0xf1, 0xf1, 0xcf, 0xf0, 0xf0, 0xf0, 0xe3, 0xe2, 0xf3, 0xfa, 0xfc, 0xfb, 0xce, 0x69, 0x65, 0xc8, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf0, 0xf0, 0xd7, 0xef, 0xf5, 0xdc, 0x38, 0x1c, 0x1a, 0x17, 0x47, 0xeb, 0xf1, 0xbf, 0xeb, 0xec, 0xed, 0xec, 0x6d, 0x6b, 0x8c, 0x8b, 0x88, 0x86, 0x85, 0x84, 0x85, 0x85, 0x84, 0x83, 0x82, 0x83, 0x82, 0x82, 0x84, 0x82, 0x8b, 0xeb, 0xeb, 0xea, 0xe9, 0x9a, 0x05, 0x02, 0x06, 
-  0x05, 0x03, 0x32, 0xea, 0xec, 0xec, 0xeb, 0xb6, 0x83, 0x83, 0x85, 0x85, 0x85, 0x86, 0x88, 0x87, 0x8a, 0x8c, 0x8e, 0x93, 0xcd, 0xfd, 0xce, 0xf1, 0xf0, 0xf1, 0xdd, 0xf5, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf8, 0xef, 0xd6, 0xd1, 0xe9, 0xe9, 0xe8, 0xc8, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xba, 0xe7, 0xe6, 0xe6, 0xe6, 0xd6, 0xf6, 0xf9, 0xf8, 0xf5, 0xfc, 0xfd, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xe6, 0xd6, 0xf0, 0xf0, 0xf3, 0xd4, 0xeb, 0xf5, 0xfd, 0xfd, 0xd5, 0x77, 0x6e, 0x67, 0x5e, 0xae, 0xf7, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xd6, 0xea, 0xf3, 0xee, 0x44, 0x19, 0x17, 0x18, 0x37, 0xdf, 0xf8, 0xf5, 0xbc, 0xec, 0xec, 0xec, 0xec, 0x60, 0x54, 0x84, 0x86, 0x88, 0x85, 0x84, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x82, 0x84, 0x82, 0x82, 0x89, 0xea, 0xec, 0xea, 0xe9, 0x9e, 0x05, 0x03, 0x04, 
-  0x04, 0x01, 0x37, 0xeb, 0xec, 0xec, 0xeb, 0xb7, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x87, 0x87, 0x87, 0x8a, 0x8d, 0x8f, 0xd1, 0xff, 0xce, 0xf1, 0xf1, 0xf0, 0xe3, 0xf2, 0xfa, 0xf9, 0xf4, 0xf1, 0xf1, 0xf2, 0xf8, 0xef, 0xdd, 0xd2, 0xe9, 0xe9, 0xe8, 0xc8, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xbd, 0xe7, 0xe6, 0xe7, 0xe9, 0xd9, 0xf9, 0xff, 0xfb, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xcc, 0xf2, 0xf1, 0xf1, 0xf1, 0xd9, 0xf9, 0xfe, 0xff, 0xcf, 0x76, 0x77, 0x72, 0x66, 0x62, 0x7d, 0xeb, 0xf7, 0xf7, 0xf5, 0xf4, 0xd9, 0xe9, 0xed, 0xf7, 0x56, 0x1d, 0x17, 0x14, 0x30, 0xd6, 0xf1, 0xf8, 0xf1, 0xbd, 0xec, 0xec, 0xec, 0xee, 0x45, 0x2f, 0x77, 0x85, 0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x84, 0x83, 0x84, 0x83, 0x82, 0x86, 0xeb, 0xeb, 0xea, 0xe9, 0xa0, 0x07, 0x06, 0x06, 
-  0x02, 0x02, 0x37, 0xeb, 0xec, 0xec, 0xec, 0xb8, 0x82, 0x82, 0x83, 0x82, 0x84, 0x83, 0x86, 0x87, 0x87, 0x88, 0x86, 0xc3, 0xfb, 0xff, 0xd5, 0xf2, 0xf2, 0xf2, 0xe7, 0xf0, 0xfa, 0xfa, 0xf7, 0xf3, 0xf1, 0xf2, 0xf5, 0xf0, 0xda, 0xd3, 0xea, 0xe9, 0xe9, 0xc6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xbe, 0xe7, 0xe6, 0xe7, 0xe9, 0xd8, 0xfd, 0xfc, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xd2, 0xf4, 0xf2, 0xf2, 0xe1, 0xf2, 0xfd, 0xf9, 0xb0, 0x72, 0x76, 0x79, 0x71, 0x8e, 0xd5, 0xfb, 0xfb, 0xf9, 0xf6, 0xf6, 0xec, 0xdc, 0xf0, 0xf5, 0x9e, 0x1b, 0x1a, 0x16, 0x21, 0xc6, 0xf3, 0xf1, 0xf6, 0xf0, 0xc1, 0xec, 0xec, 0xeb, 0xef, 0x3f, 0x1f, 0x67, 0x85, 0x88, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x84, 0x84, 0x83, 0x8a, 0xeb, 0xec, 0xea, 0xe9, 0x9e, 0x07, 0x04, 0x04, 
-  0x04, 0x04, 0x35, 0xeb, 0xec, 0xec, 0xec, 0xbe, 0x82, 0x81, 0x81, 0x83, 0x81, 0x82, 0x85, 0x86, 0x85, 0x8a, 0xdd, 0xf7, 0xfc, 0xfd, 0xe4, 0xf2, 0xf4, 0xf4, 0xe6, 0xf0, 0xf8, 0xfa, 0xf8, 0xf6, 0xf2, 0xf1, 0xf0, 0xee, 0xd7, 0xd3, 0xec, 0xe9, 0xe9, 0xc3, 0xf0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xbb, 0xe7, 0xe6, 0xe7, 0xe9, 0xd6, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd8, 0xe8, 0xf3, 0xf4, 0xf1, 0xf5, 0xd0, 0xdc, 0x85, 0x72, 0x72, 0x72, 0x93, 0xd4, 0xfb, 0xfb, 0xfa, 0xf9, 0xf9, 0xf5, 0xe9, 0xd8, 0xf3, 0xf5, 0xd6, 0x23, 0x19, 0x1a, 0x19, 0xa9, 0xf5, 0xf3, 0xf2, 0xf1, 0xed, 0xc4, 0xec, 0xec, 0xec, 0xee, 0x60, 0x5a, 0x62, 0x8a, 0x88, 0x88, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x8b, 0xeb, 0xec, 0xea, 0xea, 0x95, 0x07, 0x05, 0x05, 
-  0x07, 0x05, 0x2e, 0xeb, 0xec, 0xec, 0xec, 0xc6, 0x80, 0x80, 0x81, 0x83, 0x82, 0x82, 0x82, 0x85, 0x83, 0xd4, 0xf7, 0xf7, 0xef, 0xdb, 0xe8, 0xf1, 0xf3, 0xf4, 0xf2, 0xdc, 0xe2, 0xf9, 0xf8, 0xf6, 0xf2, 0xf1, 0xf0, 0xee, 0xd7, 0xd3, 0xec, 0xe9, 0xe8, 0xc1, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb9, 0xe7, 0xe7, 0xe8, 0xe9, 0xd3, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xca, 0xf4, 0xf4, 0xf4, 0xf3, 0xf8, 0xfa, 0xb8, 0x6b, 0x7d, 0xab, 0xdf, 0xfb, 0xfb, 0xfa, 0xf9, 0xf9, 0xfb, 0xef, 0xd5, 0xea, 0xfa, 0xf7, 0xec, 0x3d, 0x19, 0x19, 0x1a, 0x7a, 0xf5, 0xfb, 0xf6, 0xf5, 0xf4, 0xf2, 0xc3, 0xec, 0xec, 0xec, 0xed, 0x81, 0x93, 0x6f, 0x8b, 0x8c, 0x88, 0x86, 0x86, 0x87, 0x86, 0x86, 0x84, 0x85, 0x84, 0x82, 0x82, 0x83, 0x82, 0x8e, 0xec, 0xeb, 0xea, 0xe9, 0x88, 0x07, 0x05, 0x06, 
-  0x05, 0x04, 0x26, 0xe8, 0xec, 0xec, 0xec, 0xce, 0x81, 0x81, 0x82, 0x83, 0x82, 0x82, 0x81, 0x82, 0xa6, 0xf5, 0xf7, 0xe3, 0xda, 0xf6, 0xf3, 0xf1, 0xf4, 0xf3, 0xf4, 0xf6, 0xf5, 0xe1, 0xec, 0xf5, 0xf2, 0xf1, 0xf0, 0xee, 0xd7, 0xd3, 0xeb, 0xe9, 0xe8, 0xbf, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb8, 0xe7, 0xe8, 0xe8, 0xe8, 0xd0, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xc9, 0xf5, 0xf5, 0xf5, 0xf5, 0xfb, 0xfc, 0xfb, 0xdf, 0xf9, 0xfa, 0xfb, 0xfa, 0xf9, 0xf9, 0xf9, 0xeb, 0xd5, 0xe5, 0xfe, 0xfa, 0xfa, 0xf2, 0x55, 0x1a, 0x18, 0x19, 0x5d, 0xf0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xc3, 0xec, 0xec, 0xec, 0xeb, 0xb8, 0xc6, 0x7c, 0x8b, 0x8b, 0x88, 0x88, 0x87, 0x88, 0x86, 0x85, 0x85, 0x84, 0x85, 0x82, 0x81, 0x84, 0x82, 0x93, 0xee, 0xec, 0xea, 0xe8, 0x77, 0x06, 0x06, 0x04, 
-  0x04, 0x05, 0x1e, 0xdf, 0xed, 0xec, 0xec, 0xda, 0x80, 0x7f, 0x83, 0x83, 0x82, 0x82, 0x84, 0x84, 0xf0, 0xf8, 0xee, 0xd9, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xe1, 0xf2, 0xf5, 0xf5, 0xf0, 0xef, 0xdb, 0xd3, 0xe9, 0xe9, 0xe8, 0xc0, 0xf7, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xba, 0xe7, 0xe8, 0xe8, 0xe8, 0xcf, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xd3, 0xf5, 0xf6, 0xf2, 0xc3, 0xf8, 0xfc, 0xfc, 0xfb, 0xf9, 0xf8, 0xf9, 0xf8, 0xf8, 0xf1, 0xdb, 0xe2, 0xf9, 0xfd, 0xfe, 0xfe, 0xd6, 0x51, 0x1f, 0x1c, 0x18, 0x4f, 0xee, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xef, 0xc1, 0xeb, 0xec, 0xec, 0xea, 0xd8, 0xe3, 0x99, 0x8f, 0x8b, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x86, 0x85, 0x85, 0x84, 0x84, 0x83, 0x84, 0x9e, 0xed, 0xec, 0xea, 0xe7, 0x69, 0x05, 0x04, 0x06, 
-  0x06, 0x04, 0x11, 0xd1, 0xec, 0xec, 0xec, 0xe4, 0x80, 0x81, 0x83, 0x82, 0x81, 0x82, 0x83, 0xbb, 0xf1, 0xf7, 0xd3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf0, 0xe1, 0xe4, 0xf0, 0xf3, 0xf3, 0xf1, 0xf1, 0xd8, 0xf1, 0xf5, 0xf3, 0xf1, 0xe3, 0xd1, 0xe9, 0xe9, 0xe8, 0xc2, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xba, 0xe7, 0xe8, 0xe8, 0xe8, 0xce, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xdc, 0xf6, 0xf5, 0xd7, 0xd3, 0xe7, 0xfa, 0xfd, 0xfd, 0xfa, 0xf8, 0xf8, 0xed, 0xda, 0xe0, 0xfc, 0xfc, 0xfb, 0xfc, 0xea, 0x86, 0x30, 0x27, 0x22, 0x1c, 0x47, 0xea, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf0, 0xbd, 0xeb, 0xeb, 0xec, 0xe9, 0xdd, 0xee, 0xa2, 0x8d, 0x8d, 0x8b, 0x8a, 0x89, 0x88, 0x86, 0x86, 0x84, 0x85, 0x84, 0x84, 0x84, 0x83, 0x83, 0xa4, 0xec, 0xeb, 0xea, 0xe7, 0x55, 0x05, 0x04, 0x05, 
-  0x08, 0x07, 0x08, 0xbf, 0xed, 0xed, 0xec, 0xed, 0x87, 0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0xe3, 0xfc, 0xe7, 0xdb, 0xf2, 0xf1, 0xf2, 0xdd, 0xe1, 0xf7, 0xf7, 0xde, 0xde, 0xf0, 0xee, 0xee, 0xdf, 0xed, 0xf8, 0xf7, 0xf5, 0xe3, 0xd0, 0xe8, 0xea, 0xe8, 0xc4, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb7, 0xe7, 0xe8, 0xe7, 0xe5, 0xcc, 0xfd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd9, 0xf7, 0xf6, 0xf4, 0xf3, 0xf4, 0xf7, 0xf8, 0xf9, 0xfb, 0xfa, 0xeb, 0xd4, 0xe5, 0xfa, 0xf8, 0xfb, 0xfd, 0xe3, 0x88, 0x3a, 0x29, 0x27, 0x26, 0x28, 0x65, 0xea, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xbf, 0xea, 0xec, 0xed, 0xe8, 0xdc, 0xed, 0xae, 0x8f, 0x8e, 0x8b, 0x8b, 0x88, 0x85, 0x85, 0x85, 0x84, 0x84, 0x85, 0x83, 0x84, 0x83, 0x81, 0xad, 0xec, 0xea, 0xea, 0xea, 0x33, 0x05, 0x05, 0x06, 
-  0x09, 0x06, 0x08, 0xa6, 0xed, 0xed, 0xec, 0xee, 0x93, 0x82, 0x82, 0x83, 0x86, 0x85, 0x7e, 0xfb, 0xf9, 0xd0, 0xf2, 0xf2, 0xf2, 0xe9, 0xe8, 0xf6, 0xf7, 0xfb, 0xfe, 0xd2, 0xea, 0xec, 0xec, 0xee, 0xd6, 0xfa, 0xf9, 0xf6, 0xe6, 0xd2, 0xe9, 0xe9, 0xe8, 0xc6, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb8, 0xe8, 0xe8, 0xe8, 0xe6, 0xcc, 0xfb, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd7, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xf9, 0xf8, 0xea, 0xd3, 0xe3, 0xf8, 0xf9, 0xfa, 0xfa, 0xe1, 0x84, 0x38, 0x2d, 0x2a, 0x27, 0x24, 0x3d, 0xad, 0xf7, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xee, 0xbc, 0xea, 0xec, 0xed, 0xe9, 0xe0, 0xee, 0xb1, 0x92, 0x90, 0x8d, 0x88, 0x88, 0x87, 0x85, 0x84, 0x82, 0x84, 0x84, 0x84, 0x83, 0x83, 0x81, 0xc2, 0xec, 0xea, 0xea, 0xe5, 0x1d, 0x05, 0x05, 0x06, 
-  0x07, 0x06, 0x08, 0x8c, 0xed, 0xed, 0xec, 0xee, 0xa9, 0x84, 0x83, 0x84, 0x86, 0x86, 0x9a, 0xfa, 0xf6, 0xcb, 0xef, 0xf1, 0xf3, 0xd2, 0xf1, 0xf6, 0xf6, 0xfa, 0xff, 0xe3, 0xdb, 0xec, 0xeb, 0xeb, 0xc8, 0xfa, 0xfa, 0xf7, 0xe2, 0xd4, 0xe9, 0xe9, 0xe7, 0xc7, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf6, 0xf4, 0xee, 0xb6, 0xe8, 0xe9, 0xe8, 0xe7, 0xcc, 0xf7, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd5, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf3, 0xd0, 0xd3, 0xe1, 0xf6, 0xf3, 0xf6, 0xf8, 0xe1, 0x7f, 0x3b, 0x32, 0x2b, 0x29, 0x24, 0x27, 0x7c, 0xeb, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xee, 0xbf, 0xeb, 0xeb, 0xeb, 0xeb, 0xe7, 0xf5, 0xb1, 0x92, 0x90, 0x8d, 0x8a, 0x88, 0x86, 0x85, 0x84, 0x81, 0x83, 0x83, 0x84, 0x83, 0x83, 0x80, 0xd4, 0xec, 0xeb, 0xea, 0xd2, 0x1d, 0x05, 0x04, 0x07, 
-  0x07, 0x08, 0x06, 0x67, 0xec, 0xec, 0xec, 0xec, 0xbc, 0x83, 0x84, 0x84, 0x87, 0x88, 0x94, 0xfb, 0xf8, 0xcc, 0xf0, 0xf0, 0xf1, 0xd2, 0xf2, 0xf7, 0xff, 0xff, 0xff, 0xe1, 0xdd, 0xe9, 0xe8, 0xea, 0xd4, 0xfa, 0xfa, 0xf8, 0xe3, 0xd8, 0xe9, 0xe8, 0xe7, 0xc3, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xf6, 0xf4, 0xee, 0xb3, 0xe8, 0xe9, 0xe8, 0xe6, 0xcd, 0xf5, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd3, 0xf3, 0xf3, 0xf6, 0xd8, 0xd8, 0xd6, 0xf3, 0xf9, 0xf9, 0xf3, 0xfa, 0xf0, 0x8e, 0x3b, 0x36, 0x34, 0x2f, 0x26, 0x41, 0x87, 0xde, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xef, 0xc3, 0xeb, 0xeb, 0xea, 0xeb, 0xea, 0xf7, 0xaf, 0x93, 0x91, 0x8d, 0x8a, 0x88, 0x87, 0x86, 0x84, 0x84, 0x84, 0x83, 0x84, 0x83, 0x82, 0x84, 0xe5, 0xec, 0xeb, 0xe9, 0xb3, 0x0a, 0x06, 0x04, 0x04, 
-  0x07, 0x07, 0x05, 0x3e, 0xec, 0xec, 0xec, 0xec, 0xd1, 0x83, 0x84, 0x86, 0x87, 0x88, 0x78, 0xfb, 0xf9, 0xcb, 0xef, 0xf0, 0xf1, 0xe3, 0xe1, 0xfa, 0xff, 0xff, 0xfe, 0xd3, 0xea, 0xeb, 0xe9, 0xdf, 0xd4, 0xfa, 0xfa, 0xf8, 0xdf, 0xda, 0xe9, 0xe8, 0xe7, 0xc3, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb6, 0xe8, 0xe9, 0xe8, 0xe7, 0xca, 0xf5, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xf7, 0xf8, 0xec, 0xe1, 0xdd, 0xd8, 0xf7, 0xf4, 0xf5, 0xf6, 0xf9, 0xfa, 0xf6, 0xf0, 0x54, 0x3e, 0x35, 0x3f, 0x5a, 0x90, 0xd5, 0xfa, 0xfc, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xef, 0xc3, 0xeb, 0xea, 0xe9, 0xec, 0xeb, 0xf5, 0xac, 0x95, 0x92, 0x8e, 0x8a, 0x88, 0x87, 0x85, 0x85, 0x82, 0x83, 0x83, 0x85, 0x84, 0x82, 0x92, 0xec, 0xec, 0xea, 0xe8, 0x90, 0x04, 0x05, 0x04, 0x06, 
-  0x06, 0x06, 0x05, 0x1c, 0xe0, 0xea, 0xeb, 0xec, 0xe5, 0x83, 0x84, 0x85, 0x86, 0x87, 0x80, 0xe4, 0xfd, 0xd6, 0xec, 0xf0, 0xef, 0xf1, 0xd9, 0xe4, 0xfe, 0xfd, 0xe0, 0xde, 0xec, 0xeb, 0xe8, 0xc8, 0xf2, 0xf8, 0xfa, 0xf7, 0xdd, 0xdc, 0xe9, 0xe8, 0xe7, 0xc4, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb8, 0xe9, 0xe9, 0xe8, 0xe7, 0xcc, 0xf5, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf1, 0xe0, 0xe3, 0xf0, 0xf3, 0xf6, 0xf6, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf0, 0xc2, 0xeb, 0xec, 0xec, 0xe9, 0xe6, 0xf4, 0xa7, 0x94, 0x90, 0x8c, 0x8b, 0x89, 0x86, 0x86, 0x84, 0x82, 0x83, 0x82, 0x84, 0x85, 0x83, 0xaa, 0xed, 0xeb, 0xea, 0xe8, 0x65, 0x04, 0x05, 0x05, 0x05, 
-  0x06, 0x07, 0x07, 0x12, 0xbd, 0xeb, 0xec, 0xec, 0xee, 0x91, 0x86, 0x87, 0x88, 0x87, 0x86, 0xbe, 0xff, 0xf0, 0xcc, 0xef, 0xee, 0xf1, 0xf1, 0xe9, 0xd4, 0xd0, 0xea, 0xec, 0xeb, 0xe9, 0xe8, 0xd4, 0xf1, 0xf6, 0xf9, 0xf6, 0xda, 0xde, 0xe9, 0xe8, 0xe7, 0xc6, 0xf0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb8, 0xe8, 0xe8, 0xe8, 0xe8, 0xcc, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xfb, 0xfc, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xef, 0xc1, 0xeb, 0xec, 0xec, 0xe8, 0xe5, 0xf5, 0xa9, 0x95, 0x91, 0x8c, 0x8b, 0x88, 0x88, 0x86, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x84, 0xc2, 0xec, 0xeb, 0xeb, 0xeb, 0x3c, 0x04, 0x04, 0x05, 0x05, 
-  0x0a, 0x08, 0x05, 0x05, 0x90, 0xed, 0xed, 0xec, 0xed, 0xa7, 0x87, 0x8a, 0x88, 0x87, 0x86, 0x8c, 0xfa, 0xfe, 0xd4, 0xe2, 0xed, 0xee, 0xf0, 0xf1, 0xf0, 0xf0, 0xef, 0xed, 0xea, 0xe8, 0xd0, 0xe9, 0xf0, 0xf6, 0xf9, 0xf6, 0xd7, 0xdd, 0xe9, 0xe8, 0xe7, 0xc6, 0xed, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb7, 0xe8, 0xe8, 0xe8, 0xe8, 0xcd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfe, 0xfa, 0xfc, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf6, 0xf6, 0xf6, 0xf2, 0xef, 0xc1, 0xeb, 0xec, 0xec, 0xe6, 0xe1, 0xf5, 0xa8, 0x93, 0x92, 0x8e, 0x8b, 0x88, 0x89, 0x85, 0x85, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0xdb, 0xec, 0xeb, 0xe9, 0xdf, 0x1f, 0x05, 0x04, 0x06, 0x04, 
-  0x09, 0x06, 0x08, 0x04, 0x51, 0xee, 0xee, 0xed, 0xed, 0xc1, 0x87, 0x87, 0x89, 0x89, 0x89, 0x89, 0xbf, 0xf9, 0xf6, 0xca, 0xde, 0xec, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xec, 0xea, 0xd2, 0xea, 0xed, 0xf4, 0xf6, 0xf6, 0xf4, 0xd5, 0xdb, 0xe9, 0xe8, 0xe7, 0xc5, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb8, 0xe8, 0xe9, 0xe8, 0xe8, 0xcc, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf5, 0xf4, 0xf7, 0xf6, 0xfc, 0xf2, 0xe9, 0xe5, 0xec, 0xf1, 0xf4, 0xf3, 0xf4, 0xfa, 0xfa, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xfc, 0xfa, 0xf9, 0xf6, 0xf6, 0xf2, 0xef, 0xc1, 0xeb, 0xeb, 0xeb, 0xe2, 0xdc, 0xf5, 0xa9, 0x92, 0x91, 0x8e, 0x8a, 0x89, 0x86, 0x85, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x88, 0xec, 0xec, 0xe8, 0xe8, 0xaf, 0x0d, 0x04, 0x04, 0x04, 0x04, 
-  0x06, 0x05, 0x06, 0x05, 0x1d, 0xe7, 0xed, 0xed, 0xed, 0xdb, 0x86, 0x88, 0x87, 0x87, 0x89, 0x89, 0x88, 0xdc, 0xf9, 0xf5, 0xdd, 0xcd, 0xea, 0xee, 0xee, 0xf0, 0xef, 0xd8, 0xd8, 0xf0, 0xf0, 0xf1, 0xf5, 0xf6, 0xf4, 0xf2, 0xd9, 0xda, 0xe9, 0xe8, 0xe7, 0xc5, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb8, 0xe8, 0xe9, 0xe8, 0xe8, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd8, 0xe4, 0xe8, 0xea, 0xea, 0xeb, 0xeb, 0xe8, 0xe5, 0xe4, 0xe4, 0xe4, 0xe2, 0xdf, 0xde, 0xde, 0xde, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xd7, 0xd4, 0xd1, 0xcd, 0xcd, 0xcd, 0xce, 0xd1, 0xd4, 0xd4, 0xd2, 0xda, 0xdf, 0xf8, 0xf9, 0xf6, 0xf6, 0xf2, 0xee, 0xbf, 0xe9, 0xeb, 0xeb, 0xe0, 0xd6, 0xf8, 0xab, 0x93, 0x91, 0x8c, 0x8a, 0x86, 0x87, 0x85, 0x84, 0x83, 0x83, 0x82, 0x81, 0x80, 0xa2, 0xed, 0xeb, 0xe9, 0xe7, 0x79, 0x08, 0x05, 0x06, 0x05, 0x05, 
-  0x0b, 0x07, 0x06, 0x06, 0x09, 0xb7, 0xec, 0xed, 0xed, 0xed, 0x91, 0x87, 0x86, 0x86, 0x86, 0x89, 0x8b, 0x95, 0xec, 0xf9, 0xf9, 0xf8, 0xdb, 0xf3, 0xee, 0xef, 0xdc, 0xf5, 0xf0, 0xf1, 0xf2, 0xf4, 0xf6, 0xf5, 0xf1, 0xef, 0xd4, 0xdb, 0xe9, 0xe8, 0xe7, 0xc6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb7, 0xe9, 0xe8, 0xe8, 0xe7, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xd5, 0xee, 0xee, 0xee, 0xec, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xea, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xea, 0xea, 0xe8, 0xe9, 0xea, 0xeb, 0xe9, 0xe7, 0xe8, 0xe8, 0xe7, 0xe8, 0xea, 0xea, 0xe8, 0xea, 0xed, 0xed, 0xee, 0xee, 0xde, 0xed, 0xf9, 0xf6, 0xf6, 0xf2, 0xf0, 0xc1, 0xe9, 0xe9, 0xea, 0xdf, 0xd6, 0xfb, 0xbd, 0x92, 0x8f, 0x8d, 0x89, 0x88, 0x85, 0x86, 0x84, 0x83, 0x84, 0x83, 0x82, 0x80, 0xc3, 0xec, 0xeb, 0xea, 0xe7, 0x34, 0x05, 0x06, 0x04, 0x05, 0x05, 
-  0x0a, 0x07, 0x07, 0x04, 0x05, 0x68, 0xed, 0xed, 0xed, 0xec, 0xb0, 0x86, 0x85, 0x85, 0x86, 0x88, 0x8c, 0x91, 0x92, 0xce, 0xf9, 0xfa, 0xd7, 0xee, 0xef, 0xf0, 0xdc, 0xf4, 0xf4, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf1, 0xef, 0xd1, 0xde, 0xe8, 0xe7, 0xe5, 0xc7, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xb8, 0xea, 0xe9, 0xe8, 0xe8, 0xd1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xc9, 0xed, 0xec, 0xed, 0xec, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xea, 0xeb, 0xea, 0xea, 0xe8, 0xe8, 0xe9, 0xe9, 0xe8, 0xe7, 0xe8, 0xe8, 0xe9, 0xe8, 0xe8, 0xe8, 0xe8, 0xe9, 0xeb, 0xed, 0xed, 0xec, 0xdf, 0xf6, 0xfc, 0xf6, 0xf6, 0xf2, 0xf2, 0xc2, 0xe9, 0xe9, 0xe9, 0xde, 0xd9, 0xfd, 0xcf, 0x93, 0x8e, 0x8c, 0x8a, 0x88, 0x88, 0x86, 0x84, 0x85, 0x84, 0x83, 0x83, 0x83, 0xe5, 0xed, 0xec, 0xe9, 0xcb, 0x14, 0x04, 0x07, 0x04, 0x04, 0x05, 
-  0x07, 0x08, 0x08, 0x06, 0x02, 0x2b, 0xe9, 0xed, 0xed, 0xec, 0xd5, 0x88, 0x85, 0x84, 0x86, 0x87, 0x88, 0x8c, 0x93, 0x92, 0xbe, 0xfb, 0xc5, 0xed, 0xf0, 0xf0, 0xd6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xef, 0xce, 0xdf, 0xe8, 0xe6, 0xe5, 0xc8, 0xf8, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xee, 0xb7, 0xe9, 0xe9, 0xe8, 0xe8, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xc8, 0xd7, 0xe7, 0xe7, 0xe5, 0xe4, 0xe4, 0xe5, 0xe3, 0xe1, 0xe0, 0xe0, 0xe1, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe3, 0xe0, 0xe1, 0xe2, 0xe2, 0xe2, 0xe0, 0xdf, 0xdf, 0xde, 0xdb, 0xdb, 0xdc, 0xde, 0xe0, 0xe4, 0xe5, 0xe6, 0xde, 0xe0, 0xf9, 0xfd, 0xf6, 0xf6, 0xf2, 0xf2, 0xc2, 0xe9, 0xe9, 0xe9, 0xdf, 0xd9, 0xfa, 0xd4, 0x94, 0x8f, 0x8c, 0x8b, 0x88, 0x87, 0x86, 0x86, 0x84, 0x85, 0x84, 0x83, 0x9f, 0xef, 0xed, 0xec, 0xe9, 0x8f, 0x0a, 0x05, 0x06, 0x06, 0x05, 0x06, 
-  0x06, 0x05, 0x05, 0x04, 0x03, 0x12, 0xb8, 0xec, 0xec, 0xec, 0xee, 0x96, 0x87, 0x86, 0x86, 0x86, 0x88, 0x8a, 0x8d, 0x91, 0xb1, 0xf9, 0xca, 0xee, 0xf0, 0xf0, 0xcf, 0xf3, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf0, 0xd6, 0xdf, 0xe8, 0xe6, 0xe4, 0xca, 0xf9, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xef, 0xbe, 0xea, 0xea, 0xe9, 0xe9, 0xd3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf8, 0xeb, 0xe9, 0xef, 0xed, 0xea, 0xea, 0xe9, 0xea, 0xe5, 0xe7, 0xe8, 0xe8, 0xe6, 0xe4, 0xe7, 0xe8, 0xe7, 0xea, 0xec, 0xe8, 0xe8, 0xe9, 0xe9, 0xe6, 0xe7, 0xe5, 0xe0, 0xe0, 0xe0, 0xe1, 0xe3, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xed, 0xf3, 0xfd, 0xf6, 0xf6, 0xf2, 0xf2, 0xc2, 0xe9, 0xe9, 0xe9, 0xe0, 0xde, 0xfe, 0xce, 0x91, 0x8f, 0x8c, 0x8a, 0x88, 0x87, 0x86, 0x86, 0x84, 0x85, 0x85, 0x82, 0xc4, 0xee, 0xec, 0xe9, 0xe8, 0x43, 0x05, 0x05, 0x04, 0x06, 0x06, 0x07, 
-  0x06, 0x05, 0x07, 0x05, 0x04, 0x06, 0x72, 0xec, 0xed, 0xec, 0xed, 0xbc, 0x85, 0x86, 0x85, 0x85, 0x85, 0x88, 0x88, 0x8a, 0xc8, 0xfa, 0xcc, 0xed, 0xf0, 0xf0, 0xcb, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xe1, 0xd2, 0xe7, 0xe6, 0xe4, 0xd8, 0xed, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xc5, 0xea, 0xe9, 0xe9, 0xea, 0xd1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf7, 0xf7, 0xf6, 0xf7, 0xf5, 0xf5, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xee, 0xef, 0xf1, 0xef, 0xed, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf6, 0xf4, 0xf4, 0xfd, 0xf6, 0xf6, 0xf2, 0xf0, 0xc1, 0xe9, 0xe9, 0xe9, 0xe2, 0xde, 0xfc, 0xcc, 0x8f, 0x8e, 0x8b, 0x89, 0x87, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x88, 0xe9, 0xec, 0xeb, 0xe9, 0xc9, 0x14, 0x06, 0x06, 0x05, 0x05, 0x07, 0x08, 
-  0x07, 0x05, 0x05, 0x06, 0x04, 0x04, 0x2a, 0xe8, 0xed, 0xec, 0xec, 0xe2, 0x86, 0x85, 0x85, 0x83, 0x85, 0x85, 0x84, 0x83, 0xc9, 0xfb, 0xd4, 0xee, 0xf0, 0xf0, 0xcc, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xef, 0xc9, 0xe7, 0xe7, 0xe6, 0xe8, 0xd0, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xcf, 0xe8, 0xe9, 0xe9, 0xea, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xfa, 0xf7, 0xf9, 0xf9, 0xf6, 0xf6, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf9, 0xf9, 0xf9, 0xfd, 0xf6, 0xf6, 0xf2, 0xef, 0xbf, 0xe8, 0xe9, 0xe9, 0xe2, 0xdc, 0xff, 0xbe, 0x8d, 0x8e, 0x8c, 0x89, 0x87, 0x84, 0x83, 0x83, 0x85, 0x84, 0x86, 0xad, 0xf0, 0xec, 0xeb, 0xe9, 0x84, 0x0a, 0x04, 0x06, 0x08, 0x07, 0x06, 0x06, 
-  0x06, 0x03, 0x03, 0x04, 0x03, 0x05, 0x0c, 0xad, 0xec, 0xec, 0xec, 0xed, 0xab, 0x85, 0x84, 0x85, 0x85, 0x83, 0x81, 0x81, 0xc2, 0xfd, 0xd9, 0xee, 0xf0, 0xf0, 0xcc, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xc7, 0xe9, 0xe8, 0xe6, 0xe5, 0xd3, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfb, 0xee, 0xda, 0xec, 0xeb, 0xeb, 0xe5, 0xdb, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xee, 0xd8, 0xc5, 0xc9, 0xc6, 0xc6, 0xc6, 0xc3, 0xc0, 0xbe, 0xc5, 0xc9, 0xcd, 0xd1, 0xd4, 0xd8, 0xd7, 0xd8, 0xdc, 0xde, 0xdd, 0xdc, 0xda, 0xd8, 0xd9, 0xd9, 0xdb, 0xdb, 0xdb, 0xd9, 0xd9, 0xdb, 0xdd, 0xdf, 0xdc, 0xd7, 0xd5, 0xf1, 0xfa, 0xfb, 0xf8, 0xf6, 0xf5, 0xf2, 0xc0, 0xea, 0xea, 0xe9, 0xe2, 0xdc, 0xff, 0xab, 0x8c, 0x8e, 0x8a, 0x89, 0x86, 0x85, 0x85, 0x83, 0x81, 0x82, 0x84, 0xd8, 0xee, 0xec, 0xeb, 0xe5, 0x39, 0x07, 0x06, 0x09, 0x06, 0x08, 0x07, 0x03, 
-  0x06, 0x06, 0x07, 0x06, 0x04, 0x06, 0x04, 0x57, 0xec, 0xec, 0xec, 0xec, 0xd8, 0x89, 0x85, 0x85, 0x85, 0x85, 0x81, 0x80, 0xbe, 0xff, 0xdf, 0xed, 0xf0, 0xf0, 0xcc, 0xf2, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf3, 0xcf, 0xe6, 0xe7, 0xe7, 0xe8, 0xd8, 0xe4, 0xf9, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xd8, 0xf3, 0xee, 0xec, 0xee, 0xcd, 0xf4, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xcf, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xeb, 0xea, 0xeb, 0xea, 0xe8, 0xe8, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xea, 0xea, 0xea, 0xe9, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xeb, 0xed, 0xee, 0xee, 0xee, 0xed, 0xeb, 0xd7, 0xfa, 0xfa, 0xf8, 0xf6, 0xf6, 0xf4, 0xc2, 0xea, 0xea, 0xe9, 0xe3, 0xe3, 0xfb, 0xa9, 0x8d, 0x8d, 0x8a, 0x86, 0x85, 0x83, 0x82, 0x82, 0x81, 0x82, 0x97, 0xec, 0xec, 0xea, 0xe9, 0xb6, 0x18, 0x09, 0x09, 0x09, 0x08, 0x06, 0x08, 0x05, 
-  0x05, 0x05, 0x03, 0x07, 0x07, 0x06, 0x04, 0x12, 0xc2, 0xea, 0xea, 0xeb, 0xec, 0x9e, 0x86, 0x87, 0x87, 0x85, 0x83, 0x7d, 0xbf, 0xfd, 0xe1, 0xee, 0xf0, 0xef, 0xcf, 0xf7, 0xf7, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf6, 0xf6, 0xf3, 0xef, 0xc6, 0xe8, 0xe9, 0xe9, 0xea, 0xd4, 0xe2, 0xf9, 0xfb, 0xff, 0xfb, 0xf5, 0xdb, 0xed, 0xf0, 0xee, 0xeb, 0xe8, 0xd1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd2, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe8, 0xe7, 0xe8, 0xe8, 0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xea, 0xec, 0xed, 0xed, 0xed, 0xec, 0xe4, 0xeb, 0xfa, 0xf8, 0xf6, 0xf6, 0xf5, 0xc7, 0xea, 0xea, 0xe9, 0xe3, 0xe3, 0xfb, 0xae, 0x8d, 0x8a, 0x89, 0x86, 0x84, 0x84, 0x84, 0x81, 0x80, 0x81, 0xbf, 0xed, 0xeb, 0xea, 0xe9, 0x65, 0x0f, 0x07, 0x0b, 0x07, 0x07, 0x09, 0x08, 0x08, 
-  0x05, 0x06, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x69, 0xe9, 0xea, 0xeb, 0xec, 0xcd, 0x89, 0x89, 0x8a, 0x88, 0x86, 0x7b, 0xeb, 0xfd, 0xde, 0xed, 0xed, 0xed, 0xcd, 0xf5, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf6, 0xf6, 0xf3, 0xf5, 0xcf, 0xe5, 0xea, 0xeb, 0xec, 0xea, 0xe2, 0xcd, 0xde, 0xce, 0xdb, 0xdc, 0xef, 0xf0, 0xf0, 0xee, 0xec, 0xca, 0xe9, 0xf0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xc5, 0xec, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xe9, 0xe8, 0xe8, 0xe6, 0xe8, 0xea, 0xea, 0xea, 0xec, 0xec, 0xeb, 0xea, 0xe9, 0xe8, 0xe7, 0xe6, 0xe7, 0xe7, 0xe7, 0xe8, 0xe9, 0xe8, 0xe9, 0xe9, 0xeb, 0xec, 0xed, 0xed, 0xec, 0xee, 0xd0, 0xfb, 0xfa, 0xf7, 0xf6, 0xf6, 0xf2, 0xcd, 0xea, 0xea, 0xe9, 0xe2, 0xe2, 0xf6, 0xaa, 0x8b, 0x8a, 0x88, 0x86, 0x84, 0x85, 0x85, 0x82, 0x7f, 0x8a, 0xeb, 0xec, 0xec, 0xeb, 0xcb, 0x28, 0x08, 0x09, 0x0a, 0x0b, 0x08, 0x06, 0x07, 0x09, 
-  0x06, 0x09, 0x07, 0x05, 0x05, 0x07, 0x05, 0x05, 0x17, 0xd5, 0xe9, 0xea, 0xeb, 0xea, 0x9c, 0x8c, 0x8c, 0x8b, 0x7f, 0xd0, 0xfc, 0xff, 0xd7, 0xec, 0xec, 0xeb, 0xcc, 0xf3, 0xf5, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf6, 0xf6, 0xf3, 0xf1, 0xf1, 0xc7, 0xeb, 0xeb, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xf0, 0xf0, 0xee, 0xde, 0xcb, 0xef, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xef, 0xd4, 0xd8, 0xd8, 0xdb, 0xd8, 0xd5, 0xd4, 0xd7, 0xd5, 0xd3, 0xd2, 0xd3, 0xd1, 0xce, 0xce, 0xcb, 0xcc, 0xc9, 0xc9, 0xc7, 0xc8, 0xc3, 0xc6, 0xc7, 0xca, 0xca, 0xca, 0xc9, 0xcb, 0xce, 0xcf, 0xcb, 0xcb, 0xd2, 0xda, 0xcb, 0xec, 0xf7, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xd0, 0xeb, 0xea, 0xe9, 0xe2, 0xe0, 0xf5, 0x9d, 0x89, 0x8a, 0x89, 0x86, 0x84, 0x86, 0x85, 0x84, 0x81, 0xbf, 0xed, 0xec, 0xea, 0xe8, 0x7a, 0x0b, 0x04, 0x09, 0x07, 0x07, 0x07, 0x05, 0x09, 0x0a, 
-  0x06, 0x05, 0x06, 0x04, 0x06, 0x06, 0x08, 0x05, 0x06, 0x7a, 0xe9, 0xeb, 0xeb, 0xeb, 0xcd, 0x8f, 0x8e, 0x8c, 0xa0, 0xf7, 0xfc, 0xfc, 0xce, 0xeb, 0xec, 0xeb, 0xd1, 0xf8, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf3, 0xf1, 0xf1, 0xe9, 0xc2, 0xeb, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf0, 0xef, 0xe5, 0x68, 0xc5, 0xf2, 0xfa, 0xfc, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xee, 0xeb, 0xea, 0xeb, 0xeb, 0xec, 0xeb, 0xeb, 0xec, 0xeb, 0xed, 0xee, 0xeb, 0xec, 0xec, 0xed, 0xec, 0xed, 0xf0, 0xef, 0xf0, 0xf0, 0xf1, 0xf5, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf0, 0xf5, 0xf6, 0xf4, 0xf6, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xd3, 0xec, 0xea, 0xea, 0xe2, 0xe0, 0xf8, 0x91, 0x8c, 0x8a, 0x87, 0x86, 0x85, 0x86, 0x87, 0x87, 0x90, 0xea, 0xec, 0xec, 0xea, 0xdd, 0x27, 0x02, 0x03, 0x05, 0x0a, 0x07, 0x07, 0x09, 0x0a, 0x07, 
-  0x05, 0x04, 0x05, 0x07, 0x07, 0x08, 0x08, 0x07, 0x04, 0x16, 0xd3, 0xea, 0xeb, 0xea, 0xe9, 0xa2, 0x8b, 0x7d, 0xdf, 0xf5, 0xf4, 0xbc, 0xdd, 0xee, 0xeb, 0xeb, 0xd6, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf0, 0xc8, 0xa5, 0xea, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xec, 0xee, 0xef, 0xd6, 0x48, 0x18, 0xde, 0xf7, 0xfc, 0xfc, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf9, 0xfb, 0xfb, 0xfa, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xd9, 0xec, 0xeb, 0xeb, 0xe0, 0xe4, 0xf9, 0x87, 0x8c, 0x8b, 0x89, 0x87, 0x86, 0x88, 0x88, 0x87, 0xc6, 0xef, 0xed, 0xec, 0xea, 0x88, 0x11, 0x08, 0x07, 0x07, 0x09, 0x07, 0x05, 0x08, 0x08, 0x08, 
-  0x06, 0x07, 0x05, 0x06, 0x07, 0x07, 0x05, 0x01, 0x02, 0x05, 0x6b, 0xe9, 0xeb, 0xea, 0xe9, 0xd3, 0x87, 0x92, 0xe9, 0xf0, 0xd3, 0xdf, 0xe9, 0xec, 0xec, 0xeb, 0xdd, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xdd, 0x6f, 0x4d, 0xa1, 0xe6, 0xf0, 0xef, 0xed, 0xec, 0xed, 0xd3, 0x80, 0x23, 0x17, 0x57, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf0, 0xec, 0xea, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf2, 0xf2, 0xee, 0xf2, 0xf2, 0xfb, 0xf8, 0xfa, 0xf9, 0xf6, 0xf6, 0xf6, 0xf5, 0xdf, 0xeb, 0xed, 0xee, 0xde, 0xe1, 0xf8, 0x89, 0x8c, 0x8c, 0x8a, 0x87, 0x86, 0x88, 0x88, 0x9e, 0xeb, 0xec, 0xec, 0xea, 0xd1, 0x2b, 0x0d, 0x08, 0x04, 0x06, 0x09, 0x08, 0x07, 0x09, 0x08, 0x07, 
-  0x06, 0x06, 0x05, 0x06, 0x09, 0x09, 0x07, 0x04, 0x05, 0x05, 0x13, 0xcb, 0xea, 0xe9, 0xe9, 0xeb, 0xa0, 0xbe, 0xeb, 0xed, 0xba, 0xe3, 0xea, 0xec, 0xec, 0xeb, 0xe8, 0xec, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xee, 0x90, 0x28, 0x0b, 0x20, 0x61, 0x85, 0x85, 0x6d, 0x3c, 0x14, 0x13, 0x14, 0x26, 0xdf, 0xfa, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xe0, 0xd6, 0xeb, 0xe9, 0xe6, 0xe4, 0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xe2, 0xe1, 0xe1, 0xe1, 0xe3, 0xe2, 0xe2, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe5, 0xe3, 0xde, 0xd9, 0xd7, 0xd7, 0xd9, 0xdf, 0xe6, 0xea, 0xed, 0xe9, 0xdc, 0xe4, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xee, 0xdc, 0xea, 0xed, 0xee, 0xe0, 0xe1, 0xf6, 0x8c, 0x8c, 0x8c, 0x88, 0x86, 0x85, 0x88, 0x89, 0xd9, 0xed, 0xec, 0xeb, 0xe8, 0x70, 0x0f, 0x09, 0x08, 0x08, 0x06, 0x07, 0x07, 0x08, 0x0a, 0x0a, 0x08, 
-  0x06, 0x05, 0x06, 0x07, 0x08, 0x04, 0x02, 0x03, 0x04, 0x02, 0x04, 0x53, 0xe8, 0xe9, 0xe9, 0xe9, 0xc3, 0xe3, 0xf2, 0xbd, 0xbe, 0xdf, 0xeb, 0xed, 0xee, 0xed, 0xef, 0xd1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xe3, 0x52, 0x0c, 0x0a, 0x0d, 0x0b, 0x09, 0x0d, 0x0f, 0x15, 0x18, 0x28, 0xcb, 0xfc, 0xf7, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xc8, 0xf1, 0xf1, 0xee, 0xee, 0xf0, 0xee, 0xec, 0xec, 0xeb, 0xe9, 0xea, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xed, 0xee, 0xee, 0xee, 0xf1, 0xef, 0xda, 0xf3, 0xfa, 0xf8, 0xf7, 0xf6, 0xd2, 0xec, 0xec, 0xed, 0xee, 0xe0, 0xd9, 0xf6, 0x8e, 0x8c, 0x8b, 0x89, 0x87, 0x86, 0x86, 0xb4, 0xef, 0xed, 0xec, 0xe9, 0xbc, 0x1f, 0x09, 0x0b, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x06, 
-  0x03, 0x06, 0x06, 0x08, 0x04, 0x06, 0x05, 0x04, 0x07, 0x03, 0x04, 0x0b, 0xa7, 0xe9, 0xe9, 0xe9, 0xd2, 0xe1, 0xe3, 0x7a, 0xa8, 0xc9, 0xea, 0xef, 0xf0, 0xef, 0xf1, 0xd0, 0xf5, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xe6, 0x73, 0x1d, 0x0a, 0x0c, 0x17, 0x23, 0x27, 0x23, 0x6b, 0xdd, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xc7, 0xef, 0xee, 0xee, 0xee, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xec, 0xed, 0xee, 0xed, 0xec, 0xee, 0xee, 0xec, 0xec, 0xeb, 0xeb, 0xec, 0xed, 0xed, 0xed, 0xef, 0xef, 0xee, 0xef, 0xdb, 0xec, 0xfa, 0xfa, 0xfb, 0xfd, 0xd1, 0xee, 0xee, 0xed, 0xee, 0xdf, 0xdc, 0xf7, 0x8d, 0x8c, 0x8b, 0x8a, 0x87, 0x85, 0x92, 0xec, 0xef, 0xed, 0xec, 0xe7, 0x4e, 0x10, 0x06, 0x0c, 0x0d, 0x08, 0x05, 0x07, 0x09, 0x08, 0x09, 0x04, 0x06, 
-  0x05, 0x05, 0x07, 0x07, 0x04, 0x05, 0x06, 0x05, 0x07, 0x06, 0x07, 0x07, 0x2e, 0xdb, 0xe8, 0xea, 0xca, 0xd4, 0xb3, 0x50, 0x7d, 0x8e, 0xd8, 0xef, 0xf0, 0xf0, 0xf0, 0xcf, 0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf2, 0xda, 0x9f, 0x78, 0x74, 0x82, 0xa8, 0xda, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xfb, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xc3, 0xe5, 0xec, 0xed, 0xec, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xed, 0xf0, 0xee, 0xed, 0xef, 0xef, 0xed, 0xed, 0xec, 0xeb, 0xec, 0xee, 0xec, 0xea, 0xef, 0xef, 0xee, 0xe8, 0xd4, 0xfa, 0xfa, 0xfb, 0xfc, 0xde, 0xe6, 0xf0, 0xee, 0xed, 0xed, 0xde, 0xdc, 0xf3, 0x90, 0x8e, 0x8b, 0x89, 0x86, 0x85, 0xd6, 0xf0, 0xed, 0xed, 0xec, 0x9f, 0x1b, 0x10, 0x08, 0x0e, 0x0c, 0x09, 0x08, 0x08, 0x09, 0x08, 0x08, 0x0a, 0x06, 
-  0x06, 0x05, 0x04, 0x05, 0x06, 0x05, 0x07, 0x05, 0x04, 0x05, 0x06, 0x07, 0x0a, 0x67, 0xe7, 0xe9, 0xb6, 0x9d, 0x5e, 0x48, 0x51, 0x49, 0xb1, 0xef, 0xee, 0xee, 0xee, 0xe2, 0xe3, 0xf4, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf1, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xd4, 0xe1, 0xed, 0xf0, 0xee, 0xee, 0xee, 0xea, 0xe8, 0xe3, 0xe3, 0xe3, 0xe6, 0xe7, 0xe9, 0xe9, 0xe8, 0xe8, 0xe7, 0xe4, 0xe2, 0xe1, 0xdf, 0xdd, 0xdb, 0xd9, 0xd8, 0xd5, 0xd2, 0xd2, 0xd4, 0xd4, 0xd3, 0xd2, 0xcf, 0xe1, 0xf7, 0xfa, 0xfb, 0xff, 0xef, 0xd8, 0xf1, 0xf0, 0xee, 0xee, 0xed, 0xdf, 0xda, 0xf5, 0xab, 0x8c, 0x8b, 0x88, 0x85, 0xb4, 0xef, 0xef, 0xed, 0xed, 0xd5, 0x39, 0x0e, 0x0b, 0x0c, 0x0a, 0x08, 0x0b, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x07, 0x06, 
-  0x06, 0x06, 0x05, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x08, 0x07, 0x05, 0x05, 0x0d, 0xa6, 0xea, 0xc0, 0x38, 0x2d, 0x3e, 0x2e, 0x1c, 0xa0, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xd8, 0xf1, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf7, 0xfc, 0xfc, 0xfa, 0xf9, 0xfb, 0xf9, 0xfb, 0xfa, 0xf8, 0xfa, 0xf8, 0xf4, 0xf3, 0xf7, 0xf6, 0xf3, 0xf5, 0xf6, 0xf5, 0xf1, 0xf5, 0xf6, 0xf8, 0xf9, 0xf9, 0xf6, 0xf7, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xfc, 0xf9, 0xf6, 0xfa, 0xfb, 0xf3, 0xd7, 0xf1, 0xf2, 0xf0, 0xf0, 0xee, 0xec, 0xe2, 0xd8, 0xf6, 0xb1, 0x8e, 0x8c, 0x89, 0x99, 0xec, 0xee, 0xed, 0xec, 0xea, 0x57, 0x16, 0x0e, 0x0e, 0x0d, 0x0b, 0x08, 0x09, 0x08, 0x07, 0x07, 0x07, 0x0a, 0x08, 0x07, 
-  0x06, 0x05, 0x07, 0x06, 0x04, 0x05, 0x07, 0x09, 0x08, 0x07, 0x07, 0x02, 0x02, 0x04, 0x1e, 0xd2, 0xd9, 0x3c, 0x32, 0x34, 0x1c, 0x48, 0xaa, 0xed, 0xef, 0xf0, 0xf1, 0xef, 0xf1, 0xdd, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xf2, 0xf2, 0xf2, 0xf7, 0xfa, 0xfe, 0xfa, 0xfa, 0xfd, 0xfb, 0xf8, 0xf4, 0xfa, 0xfc, 0xf9, 0xfa, 0xfc, 0xf9, 0xf1, 0xf2, 0xf2, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf6, 0xf6, 0xf7, 0xf7, 0xf6, 0xf6, 0xfb, 0xe6, 0xd5, 0xf2, 0xf3, 0xf2, 0xf1, 0xf1, 0xee, 0xed, 0xe6, 0xd9, 0xf6, 0xb1, 0x8e, 0x8d, 0x93, 0xe0, 0xef, 0xed, 0xec, 0xec, 0x85, 0x1a, 0x10, 0x0f, 0x0c, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0x08, 0x07, 0x08, 0x0a, 0x04, 0x07, 
-  0x09, 0x09, 0x06, 0x05, 0x05, 0x05, 0x05, 0x04, 0x07, 0x05, 0x09, 0x05, 0x03, 0x04, 0x06, 0x39, 0xdc, 0x82, 0x43, 0x2f, 0x35, 0x5e, 0xa9, 0xeb, 0xef, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xdb, 0xdf, 0xfb, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf6, 0xf6, 0xf5, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf2, 0xf2, 0xf5, 0xf3, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xfa, 0xfe, 0xfa, 0xfa, 0xfd, 0xfb, 0xf8, 0xf1, 0xf6, 0xfa, 0xfc, 0xfe, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfc, 0xfe, 0xfe, 0xfd, 0xf9, 0xfb, 0xed, 0xd4, 0xe3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf0, 0xf1, 0xee, 0xed, 0xe9, 0xd8, 0xf6, 0xb3, 0x90, 0x90, 0xcf, 0xef, 0xed, 0xec, 0xed, 0xad, 0x18, 0x09, 0x0d, 0x0a, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x08, 
-  0x05, 0x05, 0x06, 0x04, 0x06, 0x04, 0x03, 0x04, 0x06, 0x06, 0x06, 0x04, 0x04, 0x01, 0x03, 0x08, 0x5d, 0xbc, 0x63, 0x2d, 0x59, 0x5f, 0xad, 0xeb, 0xef, 0xef, 0xef, 0xf0, 0xf1, 0xf0, 0xf3, 0xed, 0xd9, 0xd6, 0xe9, 0xf9, 0xf8, 0xf5, 0xf7, 0xf7, 0xf6, 0xf3, 0xf2, 0xf3, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xef, 0xf0, 0xf0, 0xee, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf4, 0xf0, 0xec, 0xef, 0xef, 0xee, 0xf2, 0xf3, 0xf7, 0xf6, 0xf6, 0xf9, 0xf7, 0xf7, 0xf0, 0xef, 0xf4, 0xf9, 0xfa, 0xf5, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf7, 0xf7, 0xf7, 0xf6, 0xf8, 0xf7, 0xfa, 0xfd, 0xfa, 0xde, 0xde, 0xe4, 0xf1, 0xf3, 0xf4, 0xf3, 0xf2, 0xeb, 0xdc, 0xef, 0xf0, 0xf0, 0xe9, 0xda, 0xfb, 0xb8, 0x93, 0xbd, 0xf0, 0xef, 0xed, 0xec, 0xd1, 0x28, 0x0c, 0x08, 0x09, 0x08, 0x07, 0x09, 0x09, 0x0c, 0x05, 0x08, 0x05, 0x05, 0x07, 0x06, 0x06, 0x08, 
-  0x08, 0x06, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x09, 0x08, 0x08, 0x06, 0x06, 0x02, 0x02, 0x05, 0x0b, 0x86, 0x98, 0x41, 0x6e, 0x5a, 0xbe, 0xef, 0xf1, 0xf1, 0xcf, 0xea, 0xf1, 0xf1, 0xf2, 0xf1, 0xee, 0xed, 0xe3, 0xdc, 0xe6, 0xe0, 0xdb, 0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0xd8, 0xd8, 0xd5, 0xd6, 0xd5, 0xda, 0xdd, 0xdf, 0xe2, 0xe2, 0xe1, 0xde, 0xdd, 0xdd, 0xdc, 0xd6, 0xd6, 0xd7, 0xd6, 0xd5, 0xd7, 0xd8, 0xdc, 0xe3, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe9, 0xec, 0xea, 0xe8, 0xeb, 0xe8, 0xec, 0xea, 0xe9, 0xe5, 0xe6, 0xe6, 0xe8, 0xe9, 0xe8, 0xe9, 0xe9, 0xe8, 0xe7, 0xe5, 0xe2, 0xe0, 0xe2, 0xeb, 0xe8, 0xe0, 0xf5, 0xf3, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0x7b, 0xa9, 0xee, 0xef, 0xf0, 0xe9, 0xe0, 0xff, 0xbe, 0xb3, 0xed, 0xee, 0xed, 0xec, 0xe6, 0x46, 0x08, 0x09, 0x09, 0x0c, 0x0a, 0x0a, 0x09, 0x0a, 0x09, 0x08, 0x08, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05, 
-  0x04, 0x06, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x06, 0x09, 0x09, 0x08, 0x08, 0x05, 0x05, 0x06, 0x09, 0x1d, 0x98, 0x63, 0x99, 0x7a, 0xc1, 0xf0, 0xf2, 0xf3, 0xe7, 0xa9, 0xef, 0xef, 0xf0, 0xf0, 0xed, 0xec, 0xec, 0xed, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xed, 0xee, 0xef, 0xed, 0xed, 0xef, 0xed, 0xec, 0xec, 0xec, 0xec, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xed, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf3, 0xf5, 0x8b, 0x12, 0x96, 0xed, 0xee, 0xef, 0xe7, 0xde, 0xfc, 0xc9, 0xe6, 0xeb, 0xeb, 0xea, 0xe9, 0x71, 0x0a, 0x07, 0x09, 0x07, 0x0b, 0x09, 0x0a, 0x08, 0x09, 0x0a, 0x09, 0x07, 0x08, 0x06, 0x07, 0x04, 0x05, 0x04, 
-  0x07, 0x06, 0x07, 0x04, 0x05, 0x05, 0x04, 0x06, 0x07, 0x08, 0x07, 0x08, 0x08, 0x08, 0x07, 0x05, 0x06, 0x10, 0x39, 0x80, 0xd8, 0xba, 0xb9, 0xef, 0xef, 0xf3, 0xde, 0x9c, 0x69, 0xdc, 0xef, 0xef, 0xee, 0xec, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xed, 0xee, 0xec, 0xec, 0xee, 0xed, 0xec, 0xee, 0xee, 0xec, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf0, 0xf1, 0xef, 0xee, 0xf0, 0xdd, 0x5f, 0x0c, 0x16, 0xa0, 0xec, 0xed, 0xee, 0xea, 0xe3, 0xf6, 0xd0, 0xe8, 0xe8, 0xe8, 0xe8, 0x90, 0x13, 0x08, 0x0b, 0x08, 0x07, 0x0d, 0x0a, 0x08, 0x0a, 0x09, 0x0d, 0x09, 0x07, 0x06, 0x07, 0x07, 0x06, 0x08, 0x05, 
-  0x05, 0x05, 0x04, 0x07, 0x04, 0x06, 0x05, 0x05, 0x03, 0x04, 0x07, 0x09, 0x0a, 0x05, 0x07, 0x04, 0x04, 0x09, 0x11, 0x7d, 0xe4, 0xdb, 0xbf, 0xec, 0xef, 0xf1, 0xf0, 0xdb, 0x3a, 0x34, 0x95, 0xe4, 0xf1, 0xed, 0xec, 0xec, 0xec, 0xed, 0xed, 0xec, 0xec, 0xed, 0xec, 0xec, 0xed, 0xed, 0xec, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xee, 0xec, 0xec, 0xec, 0xec, 0xec, 0xee, 0xee, 0xec, 0xed, 0xee, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xed, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xed, 0xee, 0xd8, 0x86, 0x2b, 0x18, 0x47, 0xca, 0xbe, 0xec, 0xee, 0xef, 0xe1, 0xf6, 0xed, 0xc3, 0xe7, 0xe6, 0xe6, 0xa0, 0x19, 0x0f, 0x0b, 0x0e, 0x0c, 0x0b, 0x09, 0x08, 0x09, 0x09, 0x0a, 0x0a, 0x0c, 0x09, 0x0a, 0x09, 0x08, 0x06, 0x04, 0x05, 
-  0x05, 0x05, 0x04, 0x07, 0x05, 0x07, 0x05, 0x07, 0x04, 0x04, 0x05, 0x09, 0x09, 0x08, 0x08, 0x05, 0x06, 0x07, 0x05, 0x50, 0xe7, 0xe8, 0xc3, 0xea, 0xee, 0xf0, 0xf0, 0xe1, 0xe8, 0x6e, 0x2f, 0x42, 0x78, 0xa4, 0xbd, 0xcb, 0xd3, 0xda, 0xde, 0xde, 0xe0, 0xe1, 0xdf, 0xe2, 0xe3, 0xe2, 0xde, 0xdc, 0xd6, 0xce, 0xcb, 0xc6, 0xc1, 0xbc, 0xb7, 0xba, 0xbd, 0xbf, 0xc4, 0xc7, 0xca, 0xcb, 0xcb, 0xc8, 0xc6, 0xc6, 0xc9, 0xcd, 0xd4, 0xd6, 0xd6, 0xd5, 0xd3, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd3, 0xd3, 0xd5, 0xd8, 0xd9, 0xda, 0xdd, 0xe1, 0xe2, 0xe2, 0xe3, 0xe3, 0xe4, 0xe6, 0xe7, 0xe8, 0xe8, 0xe4, 0xdd, 0xc7, 0xa1, 0x6e, 0x45, 0x2f, 0x29, 0x8b, 0xf8, 0xdb, 0xde, 0xec, 0xec, 0xec, 0xc5, 0xf5, 0xb8, 0xd1, 0xe3, 0xe2, 0xa3, 0x25, 0x16, 0x14, 0x0b, 0x0e, 0x0a, 0x09, 0x0a, 0x0c, 0x06, 0x0b, 0x09, 0x0c, 0x0e, 0x09, 0x0b, 0x08, 0x05, 0x05, 0x06, 0x06, 
-  0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x05, 0x08, 0x09, 0x07, 0x08, 0x05, 0x07, 0x08, 0x06, 0x05, 0x04, 0x13, 0xe1, 0xed, 0xca, 0xe1, 0xee, 0xee, 0xef, 0xeb, 0xe0, 0xfd, 0xca, 0x80, 0x59, 0x4d, 0x42, 0x38, 0x39, 0x41, 0x49, 0x4e, 0x4f, 0x51, 0x4f, 0x4f, 0x4e, 0x4d, 0x4a, 0x46, 0x43, 0x38, 0x32, 0x2d, 0x2e, 0x31, 0x38, 0x3f, 0x43, 0x47, 0x48, 0x4c, 0x4b, 0x4a, 0x47, 0x43, 0x41, 0x41, 0x44, 0x47, 0x4d, 0x54, 0x56, 0x59, 0x5a, 0x59, 0x59, 0x56, 0x51, 0x4e, 0x46, 0x43, 0x42, 0x43, 0x44, 0x46, 0x4c, 0x4e, 0x55, 0x5d, 0x62, 0x64, 0x60, 0x5a, 0x59, 0x58, 0x5c, 0x63, 0x64, 0x60, 0x59, 0x55, 0x53, 0x55, 0x5e, 0x92, 0xe5, 0xfe, 0xdf, 0xc7, 0xee, 0xed, 0xec, 0xeb, 0xb2, 0x9f, 0x6a, 0xd7, 0xde, 0xa5, 0x1d, 0x18, 0x13, 0x12, 0x0b, 0x0a, 0x0c, 0x09, 0x06, 0x09, 0x08, 0x0a, 0x08, 0x09, 0x08, 0x0b, 0x0a, 0x09, 0x08, 0x0a, 0x07, 0x06, 
-  0x07, 0x05, 0x05, 0x05, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x04, 0x07, 0x06, 0x05, 0x08, 0x05, 0x03, 0x04, 0x06, 0x9a, 0xee, 0xf1, 0xc2, 0xec, 0xee, 0xef, 0xef, 0xe9, 0xda, 0xfc, 0xfc, 0xf6, 0xdf, 0xc5, 0xbc, 0xb3, 0xb0, 0xaa, 0xa8, 0xaa, 0xaa, 0xa1, 0x9a, 0x8e, 0x88, 0x8b, 0x91, 0x9f, 0xa0, 0x9c, 0x9a, 0x99, 0x99, 0x9c, 0xa1, 0xa6, 0xa8, 0xa8, 0xa9, 0xa9, 0xa9, 0xa8, 0xa6, 0xa8, 0xa5, 0xa3, 0xa9, 0xb5, 0xbb, 0xba, 0xba, 0xb9, 0xb8, 0xb9, 0xbd, 0xc1, 0xba, 0xb4, 0xad, 0xa4, 0x9d, 0x9a, 0x9a, 0x94, 0x91, 0x8d, 0x84, 0x80, 0x7c, 0x7f, 0x7f, 0x77, 0x5e, 0x47, 0x44, 0x43, 0x47, 0x4c, 0x63, 0x97, 0xcb, 0xfc, 0xfe, 0xf2, 0xa0, 0xab, 0xec, 0xed, 0xed, 0xec, 0xec, 0xa5, 0x29, 0x6e, 0xd7, 0xaa, 0x16, 0x0f, 0x16, 0x11, 0x0e, 0x0c, 0x08, 0x0d, 0x08, 0x0b, 0x09, 0x06, 0x07, 0x08, 0x06, 0x07, 0x08, 0x07, 0x08, 0x07, 0x07, 0x08, 0x04, 
-  0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x08, 0x08, 0x06, 0x08, 0x05, 0x03, 0x03, 0x07, 0x38, 0xef, 0xf2, 0xcd, 0xe7, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xd2, 0xdc, 0xfd, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xfd, 0xfa, 0xfa, 0xf6, 0xfa, 0xfa, 0xf7, 0xee, 0xeb, 0xec, 0xed, 0xef, 0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf7, 0xf7, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf0, 0xec, 0xec, 0xec, 0xec, 0xec, 0xf0, 0xf2, 0xf5, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xec, 0xe8, 0xe1, 0xd9, 0xd8, 0xd4, 0xd2, 0xcb, 0xc8, 0xbe, 0xa3, 0x8e, 0x7b, 0x82, 0xaa, 0xea, 0xff, 0xff, 0xfd, 0xe1, 0xa4, 0x7c, 0xc9, 0xed, 0xed, 0xec, 0xec, 0xeb, 0xeb, 0x95, 0x40, 0x88, 0xa4, 0x16, 0x07, 0x0c, 0x12, 0x10, 0x0a, 0x09, 0x09, 0x08, 0x07, 0x0a, 0x08, 0x07, 0x0c, 0x0a, 0x07, 0x05, 0x08, 0x06, 0x07, 0x06, 0x05, 0x06, 0x05, 
-  0x0a, 0x07, 0x06, 0x07, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x08, 0x08, 0x08, 0x03, 0x05, 0x05, 0x06, 0x0c, 0x9a, 0xf7, 0xf3, 0xc5, 0xe9, 0xec, 0xec, 0xed, 0xef, 0xed, 0xe2, 0xc6, 0xcc, 0xcc, 0xc9, 0xcc, 0xcd, 0xd0, 0xd3, 0xd5, 0xd6, 0xcf, 0xd0, 0xc6, 0xbb, 0xba, 0xbe, 0xc1, 0xc4, 0xc2, 0xbf, 0xbf, 0xbd, 0xbd, 0xc7, 0xc8, 0xc9, 0xc8, 0xcc, 0xcf, 0xd2, 0xd1, 0xd5, 0xd8, 0xdb, 0xdd, 0xdd, 0xd8, 0xd6, 0xd7, 0xd4, 0xd4, 0xd2, 0xd1, 0xd1, 0xd3, 0xd4, 0xd4, 0xd6, 0xd7, 0xd3, 0xd6, 0xd2, 0xca, 0xc2, 0xbd, 0xb6, 0xb2, 0xb1, 0xaf, 0xb1, 0xa4, 0x9b, 0x90, 0x8a, 0x86, 0x85, 0x8f, 0x9b, 0xa0, 0x9b, 0xaf, 0xd6, 0xec, 0xee, 0xef, 0xed, 0xec, 0xec, 0xe8, 0xe6, 0x7e, 0x3e, 0x5e, 0x16, 0x05, 0x0a, 0x0c, 0x0d, 0x0a, 0x09, 0x0a, 0x09, 0x08, 0x06, 0x07, 0x08, 0x0a, 0x07, 0x09, 0x08, 0x05, 0x06, 0x04, 0x05, 0x07, 0x06, 0x06, 0x07, 
-  0x04, 0x05, 0x05, 0x06, 0x04, 0x05, 0x04, 0x06, 0x07, 0x06, 0x07, 0x05, 0x04, 0x07, 0x04, 0x05, 0x02, 0x06, 0x05, 0x06, 0x08, 0x17, 0xc7, 0xf7, 0xf1, 0xc7, 0xe8, 0xeb, 0xec, 0xed, 0xed, 0xed, 0xef, 0xed, 0xec, 0xec, 0xed, 0xeb, 0xea, 0xec, 0xed, 0xee, 0xec, 0xec, 0xec, 0xed, 0xee, 0xed, 0xeb, 0xed, 0xec, 0xeb, 0xec, 0xeb, 0xec, 0xef, 0xed, 0xed, 0xec, 0xeb, 0xed, 0xed, 0xed, 0xec, 0xed, 0xed, 0xec, 0xed, 0xed, 0xee, 0xef, 0xf1, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xec, 0xeb, 0xec, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xe8, 0xea, 0xed, 0xee, 0xec, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xe9, 0xb9, 0x62, 0x73, 0x3f, 0x04, 0x05, 0x0c, 0x0d, 0x0a, 0x0c, 0x0b, 0x0a, 0x08, 0x08, 0x07, 0x06, 0x07, 0x06, 0x08, 0x07, 0x06, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 
-  0x06, 0x06, 0x05, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x07, 0x08, 0x06, 0x06, 0x04, 0x05, 0x06, 0x04, 0x05, 0x06, 0x06, 0x07, 0x09, 0x26, 0xd5, 0xf6, 0xf3, 0xc9, 0xde, 0xec, 0xed, 0xee, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xec, 0xed, 0xee, 0xed, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xee, 0xef, 0xee, 0xee, 0xed, 0xee, 0xf0, 0xf0, 0xed, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xea, 0xae, 0x91, 0xa3, 0x5f, 0x0b, 0x06, 0x05, 0x0d, 0x0a, 0x0a, 0x0d, 0x09, 0x08, 0x09, 0x09, 0x07, 0x05, 0x07, 0x09, 0x09, 0x07, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 
-  0x07, 0x07, 0x08, 0x05, 0x04, 0x07, 0x07, 0x06, 0x06, 0x04, 0x08, 0x09, 0x09, 0x07, 0x04, 0x03, 0x05, 0x06, 0x04, 0x06, 0x05, 0x08, 0x0c, 0x23, 0xb8, 0xf6, 0xf2, 0xd2, 0xca, 0xea, 0xed, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xf1, 0xef, 0xf0, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xed, 0xee, 0xed, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xe9, 0xea, 0xa6, 0xa4, 0xa9, 0x4a, 0x07, 0x06, 0x06, 0x07, 0x0a, 0x09, 0x08, 0x0c, 0x09, 0x09, 0x09, 0x09, 0x0c, 0x09, 0x0b, 0x07, 0x07, 0x06, 0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x06, 0x05, 
-  0x06, 0x07, 0x07, 0x07, 0x05, 0x06, 0x06, 0x07, 0x04, 0x04, 0x06, 0x08, 0x09, 0x07, 0x07, 0x03, 0x07, 0x06, 0x05, 0x08, 0x05, 0x05, 0x08, 0x0d, 0x16, 0x96, 0xea, 0xe9, 0xdc, 0xbb, 0xc4, 0xe6, 0xed, 0xee, 0xee, 0xef, 0xf0, 0xf0, 0xf2, 0xf1, 0xf1, 0xef, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xed, 0xee, 0xed, 0xec, 0xee, 0xed, 0xed, 0xed, 0xec, 0xec, 0xeb, 0xeb, 0xe9, 0xaa, 0x9d, 0x9b, 0x34, 0x09, 0x07, 0x05, 0x05, 0x06, 0x04, 0x05, 0x06, 0x04, 0x08, 0x08, 0x07, 0x08, 0x0b, 0x0d, 0x09, 0x07, 0x06, 0x04, 0x06, 0x05, 0x05, 0x06, 0x05, 0x04, 0x05, 0x06, 0x05, 
-  0x03, 0x07, 0x06, 0x07, 0x06, 0x04, 0x05, 0x06, 0x08, 0x08, 0x06, 0x07, 0x05, 0x04, 0x07, 0x08, 0x05, 0x06, 0x07, 0x06, 0x08, 0x08, 0x04, 0x06, 0x0c, 0x0f, 0x4e, 0xbd, 0xde, 0xe2, 0xe3, 0xbc, 0xbe, 0xec, 0xee, 0xf0, 0xf1, 0xf1, 0xf3, 0xf1, 0xe2, 0xb8, 0xbb, 0xc1, 0xc1, 0xbf, 0xbd, 0xc0, 0xc0, 0xbe, 0xbe, 0xc0, 0xc0, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbd, 0xbd, 0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xbf, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbf, 0xbe, 0xbe, 0xbe, 0xbf, 0xc0, 0xbf, 0xbf, 0xbd, 0xbc, 0xba, 0xba, 0xba, 0xbc, 0xbb, 0xbb, 0xbc, 0xbe, 0xbf, 0xc2, 0xc5, 0xc7, 0xc5, 0xc4, 0xca, 0xeb, 0xed, 0xed, 0xed, 0xeb, 0xeb, 0xed, 0xea, 0xe9, 0xab, 0xa0, 0x6d, 0x18, 0x0a, 0x08, 0x07, 0x06, 0x05, 0x04, 0x04, 0x05, 0x07, 0x08, 0x03, 0x07, 0x05, 0x0a, 0x07, 0x09, 0x09, 0x07, 0x05, 0x07, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x09, 0x06, 0x03, 
-  0x05, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x09, 0x07, 0x07, 0x06, 0x05, 0x08, 0x08, 0x05, 0x06, 0x04, 0x04, 0x05, 0x09, 0x08, 0x09, 0x07, 0x04, 0x09, 0x0d, 0x0f, 0x17, 0x57, 0x9c, 0xc3, 0xdb, 0xba, 0xae, 0xeb, 0xef, 0xf0, 0xf2, 0xf2, 0xf3, 0xf4, 0xef, 0xc1, 0xa4, 0xa0, 0x9d, 0x99, 0x9a, 0x9a, 0x98, 0x97, 0x95, 0x94, 0x95, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9c, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x98, 0x98, 0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x99, 0x99, 0x98, 0x99, 0x99, 0x9b, 0x98, 0x97, 0x97, 0x98, 0x9a, 0x9b, 0x9b, 0x96, 0x91, 0xc1, 0xec, 0xed, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xe9, 0xa2, 0x7a, 0x37, 0x09, 0x07, 0x07, 0x06, 0x06, 0x05, 0x04, 0x05, 0x07, 0x05, 0x06, 0x03, 0x07, 0x06, 0x07, 0x07, 0x07, 0x09, 0x07, 0x08, 0x05, 0x06, 0x04, 0x04, 0x05, 0x04, 0x05, 0x03, 0x08, 0x07, 0x07, 
-  0x06, 0x08, 0x06, 0x07, 0x08, 0x07, 0x09, 0x06, 0x05, 0x08, 0x06, 0x09, 0x06, 0x05, 0x06, 0x04, 0x06, 0x05, 0x05, 0x08, 0x09, 0x08, 0x06, 0x02, 0x06, 0x09, 0x0b, 0x0e, 0x0f, 0x13, 0x1b, 0x28, 0x2e, 0x28, 0x9a, 0xe6, 0xec, 0xf0, 0xf1, 0xf2, 0xf3, 0xf2, 0xf4, 0xe7, 0xb8, 0x9a, 0x99, 0x99, 0x99, 0x98, 0x96, 0x94, 0x93, 0x93, 0x94, 0x94, 0x94, 0x95, 0x94, 0x95, 0x96, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x99, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x94, 0x95, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x96, 0x96, 0x97, 0x97, 0x97, 0x98, 0x98, 0x97, 0xa5, 0xd7, 0xec, 0xec, 0xec, 0xeb, 0xea, 0xe9, 0xe9, 0xca, 0x67, 0x28, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x04, 0x04, 0x06, 0x06, 0x05, 0x04, 0x05, 0x09, 0x07, 0x04, 0x04, 0x04, 0x05, 0x03, 0x05, 0x07, 0x04, 0x03, 0x06, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x0a, 
-  0x06, 0x08, 0x07, 0x08, 0x09, 0x07, 0x08, 0x08, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x09, 0x05, 0x05, 0x07, 0x05, 0x07, 0x0a, 0x07, 0x03, 0x03, 0x05, 0x05, 0x09, 0x0b, 0x0c, 0x0e, 0x0f, 0x0f, 0x10, 0x13, 0x16, 0x4e, 0xc6, 0xed, 0xee, 0xee, 0xef, 0xf0, 0xf3, 0xf1, 0xef, 0xe2, 0xc4, 0xa7, 0x99, 0x97, 0x96, 0x94, 0x93, 0x92, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x95, 0x95, 0x96, 0x95, 0x96, 0x96, 0x96, 0x98, 0x97, 0x97, 0x97, 0x95, 0x94, 0x96, 0x94, 0x96, 0x96, 0x94, 0x96, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x95, 0x95, 0x96, 0x97, 0x9b, 0xb6, 0xd5, 0xec, 0xec, 0xec, 0xec, 0xea, 0xe8, 0xe6, 0xd9, 0x7c, 0x1b, 0x05, 0x07, 0x05, 0x05, 0x07, 0x05, 0x04, 0x08, 0x05, 0x05, 0x03, 0x06, 0x08, 0x05, 0x05, 0x07, 0x07, 0x08, 0x04, 0x06, 0x08, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x04, 0x06, 0x06, 0x05, 0x05, 0x06, 0x09, 0x09, 
-  0x0a, 0x09, 0x03, 0x05, 0x05, 0x0b, 0x09, 0x05, 0x08, 0x05, 0x04, 0x06, 0x0a, 0x05, 0x08, 0x05, 0x04, 0x07, 0x03, 0x0b, 0x09, 0x0a, 0x04, 0x08, 0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x09, 0x0a, 0x0a, 0x0d, 0x10, 0x0f, 0x11, 0x65, 0xd3, 0xec, 0xec, 0xef, 0xf0, 0xf0, 0xee, 0xef, 0xf0, 0xf0, 0xde, 0xc0, 0xa7, 0x97, 0x94, 0x95, 0x97, 0x97, 0x97, 0x96, 0x94, 0x96, 0x95, 0x94, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x94, 0x95, 0x96, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x94, 0x95, 0x95, 0x95, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x96, 0xb4, 0xd0, 0xe8, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xea, 0xe9, 0xe4, 0x9a, 0x2f, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x04, 0x04, 0x03, 0x04, 0x05, 0x08, 0x08, 0x05, 0x07, 0x09, 0x04, 0x06, 0x04, 0x08, 0x05, 0x08, 0x07, 0x07, 0x07, 0x05, 0x05, 0x08, 0x07, 0x06, 0x05, 0x06, 0x07, 0x08, 0x08, 
-  0x09, 0x07, 0x06, 0x08, 0x05, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x0a, 0x05, 0x03, 0x03, 0x04, 0x04, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x04, 0x06, 0x05, 0x07, 0x06, 0x06, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0a, 0x09, 0x12, 0x72, 0xd3, 0xed, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xf1, 0xf1, 0xee, 0xee, 0xea, 0xd8, 0xc2, 0xae, 0x9d, 0x97, 0x97, 0x96, 0x94, 0x94, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x91, 0x92, 0x91, 0x92, 0x92, 0x93, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x94, 0x94, 0x95, 0x93, 0x94, 0x96, 0x98, 0xaa, 0xc4, 0xde, 0xec, 0xed, 0xec, 0xec, 0xeb, 0xea, 0xea, 0xeb, 0xe8, 0xe6, 0xaf, 0x42, 0x0e, 0x08, 0x04, 0x08, 0x09, 0x0d, 0x07, 0x06, 0x09, 0x05, 0x05, 0x04, 0x04, 0x07, 0x06, 0x04, 0x03, 0x06, 0x09, 0x09, 0x0c, 0x07, 0x07, 0x06, 0x04, 0x03, 0x09, 0x08, 0x06, 0x07, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x08, 0x0b, 0x0d, 
-  0x07, 0x06, 0x08, 0x09, 0x05, 0x09, 0x0a, 0x09, 0x08, 0x09, 0x07, 0x07, 0x0c, 0x09, 0x05, 0x04, 0x03, 0x06, 0x07, 0x06, 0x09, 0x08, 0x07, 0x05, 0x07, 0x06, 0x04, 0x06, 0x06, 0x05, 0x09, 0x07, 0x08, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x0b, 0x18, 0x72, 0xcb, 0xec, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xef, 0xed, 0xed, 0xe9, 0xd8, 0xc6, 0xb5, 0xa8, 0x99, 0x92, 0x90, 0x91, 0x8f, 0x90, 0x8f, 0x91, 0x92, 0x92, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x91, 0x90, 0x92, 0x94, 0x9a, 0xa6, 0xb2, 0xc2, 0xd5, 0xeb, 0xef, 0xee, 0xee, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xe9, 0xea, 0xe5, 0xa2, 0x4c, 0x17, 0x0f, 0x09, 0x07, 0x05, 0x06, 0x08, 0x09, 0x06, 0x07, 0x07, 0x08, 0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x0c, 0x08, 0x09, 0x09, 0x0b, 0x08, 0x08, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x06, 0x06, 0x05, 0x04, 0x07, 0x09, 0x08, 0x09, 0x09, 0x0b, 
-  0x06, 0x05, 0x07, 0x08, 0x07, 0x07, 0x06, 0x09, 0x0d, 0x0c, 0x09, 0x06, 0x07, 0x09, 0x07, 0x04, 0x07, 0x04, 0x06, 0x06, 0x06, 0x08, 0x07, 0x07, 0x05, 0x04, 0x06, 0x09, 0x07, 0x09, 0x0c, 0x09, 0x08, 0x07, 0x06, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0e, 0x48, 0x91, 0xd7, 0xed, 0xee, 0xee, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xea, 0xe0, 0xd2, 0xc6, 0xc0, 0xbb, 0xb6, 0xb1, 0xac, 0xa9, 0xa7, 0xaa, 0xaf, 0xb4, 0xb9, 0xbf, 0xc9, 0xd5, 0xe6, 0xec, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xea, 0xea, 0xd2, 0x82, 0x2d, 0x11, 0x09, 0x0b, 0x08, 0x08, 0x07, 0x02, 0x05, 0x08, 0x07, 0x09, 0x0b, 0x0b, 0x0a, 0x04, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0a, 0x0a, 0x08, 0x0a, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x04, 0x05, 0x07, 0x04, 0x08, 0x08, 0x0a, 0x0b, 0x08, 0x08, 
-  0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x0b, 0x0b, 0x0c, 0x07, 0x09, 0x07, 0x05, 0x08, 0x09, 0x06, 0x06, 0x06, 0x06, 0x08, 0x08, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0a, 0x09, 0x0a, 0x0b, 0x08, 0x07, 0x09, 0x09, 0x07, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x11, 0x4d, 0x9d, 0xdc, 0xeb, 0xec, 0xec, 0xed, 0xed, 0xec, 0xec, 0xed, 0xee, 0xef, 0xed, 0xee, 0xf0, 0xf1, 0xf0, 0xf0, 0xf1, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf5, 0xf5, 0xf4, 0xf2, 0xf1, 0xf0, 0xf0, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xec, 0xec, 0xdc, 0x99, 0x4f, 0x15, 0x05, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x05, 0x06, 0x08, 0x09, 0x0b, 0x0e, 0x0d, 0x0a, 0x04, 0x07, 0x05, 0x06, 0x07, 0x06, 0x06, 0x08, 0x09, 0x0b, 0x0c, 0x08, 0x08, 0x07, 0x03, 0x04, 0x07, 0x06, 0x03, 0x08, 0x08, 0x08, 0x04, 0x07, 0x07, 0x08, 0x0b, 0x09, 0x08, 
-  0x06, 0x07, 0x07, 0x08, 0x05, 0x08, 0x09, 0x0b, 0x0c, 0x0c, 0x0a, 0x0a, 0x09, 0x08, 0x04, 0x08, 0x06, 0x07, 0x08, 0x04, 0x07, 0x05, 0x05, 0x04, 0x06, 0x08, 0x09, 0x05, 0x0b, 0x05, 0x08, 0x0a, 0x09, 0x0c, 0x09, 0x09, 0x09, 0x0a, 0x0d, 0x0b, 0x07, 0x07, 0x08, 0x04, 0x04, 0x04, 0x05, 0x09, 0x18, 0x46, 0x89, 0xc8, 0xea, 0xed, 0xec, 0xec, 0xec, 0xee, 0xef, 0xed, 0xed, 0xed, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe8, 0xca, 0x91, 0x53, 0x1f, 0x12, 0x0a, 0x08, 0x07, 0x09, 0x0c, 0x09, 0x07, 0x06, 0x07, 0x07, 0x07, 0x03, 0x03, 0x07, 0x08, 0x09, 0x09, 0x07, 0x03, 0x04, 0x04, 0x03, 0x05, 0x07, 0x08, 0x07, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x05, 0x05, 0x07, 0x05, 0x04, 0x08, 0x05, 0x04, 0x07, 0x03, 0x08, 0x09, 0x05, 0x08, 0x0a, 0x07, 
-  0x05, 0x05, 0x05, 0x08, 0x08, 0x08, 0x09, 0x0c, 0x09, 0x0c, 0x07, 0x07, 0x07, 0x05, 0x04, 0x05, 0x07, 0x06, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x08, 0x09, 0x07, 0x09, 0x04, 0x0a, 0x08, 0x09, 0x0a, 0x09, 0x09, 0x08, 0x09, 0x0e, 0x0b, 0x06, 0x07, 0x07, 0x06, 0x04, 0x05, 0x05, 0x05, 0x04, 0x06, 0x05, 0x07, 0x1f, 0x4c, 0x79, 0xab, 0xd5, 0xea, 0xeb, 0xec, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xed, 0xec, 0xeb, 0xeb, 0xec, 0xe4, 0xc0, 0x94, 0x5e, 0x2b, 0x09, 0x02, 0x03, 0x03, 0x07, 0x08, 0x0a, 0x09, 0x0c, 0x04, 0x07, 0x06, 0x07, 0x08, 0x06, 0x05, 0x07, 0x06, 0x06, 0x04, 0x08, 0x09, 0x08, 0x05, 0x05, 0x0b, 0x09, 0x08, 0x09, 0x05, 0x06, 0x09, 0x0b, 0x09, 0x0a, 0x06, 0x08, 0x06, 0x09, 0x08, 0x07, 0x06, 0x06, 0x07, 0x09, 0x08, 0x0a, 0x0c, 0x06, 0x08, 0x0b, 0x07, 
-  0x06, 0x06, 0x08, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x0a, 0x09, 0x07, 0x08, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x06, 0x09, 0x07, 0x07, 0x05, 0x04, 0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x08, 0x06, 0x06, 0x06, 0x0b, 0x0c, 0x0a, 0x0c, 0x09, 0x07, 0x07, 0x07, 0x05, 0x05, 0x04, 0x03, 0x05, 0x05, 0x04, 0x06, 0x08, 0x07, 0x09, 0x09, 0x26, 0x57, 0x86, 0xab, 0xc5, 0xdd, 0xec, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf3, 0xef, 0xe3, 0xcb, 0xbd, 0x97, 0x73, 0x41, 0x1a, 0x0f, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x05, 0x08, 0x09, 0x0b, 0x08, 0x0a, 0x08, 0x06, 0x06, 0x05, 0x07, 0x04, 0x07, 0x06, 0x05, 0x07, 0x05, 0x07, 0x0b, 0x0b, 0x0a, 0x07, 0x07, 0x09, 0x09, 0x08, 0x05, 0x07, 0x06, 0x09, 0x0a, 0x09, 0x0a, 0x08, 0x07, 0x09, 0x0a, 0x07, 0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x0c, 0x0d, 0x08, 0x09, 0x07, 0x09, 
-  0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x08, 0x08, 0x08, 0x09, 0x07, 0x07, 0x08, 0x06, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x09, 0x07, 0x04, 0x05, 0x05, 0x07, 0x06, 0x05, 0x07, 0x06, 0x07, 0x03, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0c, 0x0a, 0x0b, 0x08, 0x0a, 0x06, 0x07, 0x06, 0x06, 0x03, 0x06, 0x06, 0x05, 0x07, 0x09, 0x09, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x0b, 0x12, 0x15, 0x1f, 0x34, 0x3f, 0x4f, 0x61, 0x6a, 0x6c, 0x6b, 0x65, 0x5b, 0x4e, 0x4a, 0x3d, 0x23, 0x21, 0x15, 0x0e, 0x09, 0x06, 0x05, 0x05, 0x07, 0x06, 0x06, 0x0a, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0b, 0x0a, 0x08, 0x07, 0x08, 0x06, 0x06, 0x05, 0x07, 0x04, 0x09, 0x05, 0x04, 0x05, 0x05, 0x05, 0x08, 0x09, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x08, 0x06, 0x0a, 0x07, 0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x08, 0x08, 0x08, 0x0b, 0x0a, 0x0a, 0x05, 0x05, 0x09, 0x09, 0x08, 0x07, 0x08, 0x07, 
-  0x06, 0x05, 0x05, 0x08, 0x07, 0x09, 0x08, 0x07, 0x08, 0x08, 0x06, 0x05, 0x07, 0x07, 0x05, 0x06, 0x07, 0x05, 0x04, 0x0a, 0x07, 0x09, 0x04, 0x06, 0x03, 0x04, 0x05, 0x06, 0x04, 0x07, 0x08, 0x07, 0x04, 0x06, 0x04, 0x06, 0x05, 0x05, 0x08, 0x0a, 0x09, 0x0a, 0x09, 0x0c, 0x07, 0x09, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x0c, 0x0c, 0x0d, 0x0c, 0x0a, 0x06, 0x04, 0x04, 0x03, 0x03, 0x06, 0x07, 0x04, 0x07, 0x06, 0x0c, 0x0c, 0x0f, 0x0b, 0x07, 0x08, 0x06, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08, 0x0a, 0x07, 0x07, 0x09, 0x08, 0x0b, 0x0e, 0x0c, 0x0c, 0x0b, 0x0b, 0x07, 0x05, 0x07, 0x06, 0x06, 0x04, 0x04, 0x04, 0x03, 0x03, 0x06, 0x06, 0x08, 0x0b, 0x0b, 0x0e, 0x0c, 0x0b, 0x09, 0x08, 0x08, 0x08, 0x06, 0x05, 0x06, 0x05, 0x08, 0x09, 0x08, 0x08, 0x08, 0x07, 0x08, 0x09, 0x07, 0x06, 0x05, 0x04, 0x07, 0x0a, 0x05, 0x07, 
+  0x01, 0x00, 0x00, 0x00, 0x38, 0xaa, 0x00, 0x00, 0xd8, 0xdb, 0x00, 0x00, 0xa2, 0x09, 0x8d, 0x8a, 0x95, 0x50, 0xae, 0x42, 0x55, 0x6e, 0xb6, 0xb1, 0xbe, 0x31, 0xcf, 0xa0, 0xb6, 0xf1, 0xc6, 0xaf,
+  0xbe, 0x4e, 0xb6, 0x68, 0x7d, 0x87, 0x6d, 0xa9, 0x7c, 0xae, 0xa5, 0x05, 0x6c, 0x26, 0x85, 0x80, 0x53, 0x46, 0x6d, 0x0c, 0x8d, 0x40, 0x53, 0xc9, 0x84, 0x44, 0x74, 0xa3, 0x53, 0xa5, 0x5b, 0x8c,
+  0x9d, 0x41, 0x75, 0xe9, 0x7c, 0xc3, 0x63, 0x46, 0x74, 0x26, 0x6c, 0x27, 0x6c, 0x67, 0x74, 0xa4, 0x63, 0x02, 0xa0, 0x5b, 0xff, 0x60, 0x5c, 0x66, 0x6d, 0xcb, 0x85, 0xb7, 0xce, 0xca, 0x84, 0x60,
+  0x5c, 0x2a, 0x8d, 0xca, 0x9d, 0x60, 0x53, 0xc0, 0x5b, 0xe2, 0x5b, 0xa0, 0x53, 0xe0, 0x63, 0xc4, 0x73, 0x08, 0x7c, 0xe9, 0x84, 0x61, 0x6c, 0x46, 0x8d, 0x08, 0x85, 0xcf, 0x8c, 0x53, 0xbe, 0xd0,
+  0xbe, 0xe5, 0x6b, 0x0a, 0x8d, 0x60, 0x4c, 0x92, 0xb5, 0x4e, 0xa5, 0x2b, 0x62, 0x58, 0x9c, 0xb4, 0x73, 0xa6, 0x23, 0x89, 0x0b, 0xec, 0x22, 0x29, 0x2b, 0xc8, 0x22, 0xae, 0x32, 0x4f, 0x4b, 0xf9,
+  0xce, 0xd1, 0xb6, 0x72, 0xae, 0x4f, 0xa5, 0xaf, 0x6d, 0xd0, 0x6d, 0xce, 0x95, 0x2c, 0x65, 0x91, 0xa5, 0x7a, 0xee, 0xae, 0xba, 0x68, 0x65, 0xcf, 0xb6, 0x15, 0xb7, 0x15, 0xd7, 0xd7, 0xe7, 0xd8,
+  0xd6, 0x53, 0xc6, 0x10, 0xb6, 0x30, 0xb6, 0xe8, 0x9d, 0x2b, 0x95, 0x2b, 0x7d, 0xa0, 0x53, 0x4a, 0x8d, 0x09, 0x74, 0xb0, 0x94, 0x32, 0xb6, 0xf1, 0xc6, 0x75, 0xc6, 0x38, 0xdf, 0x0e, 0xae, 0xec,
+  0xa5, 0x0a, 0xa6, 0x55, 0xdf, 0xef, 0xe7, 0x8e, 0xae, 0x51, 0xd7, 0xae, 0xd7, 0x95, 0xee, 0xd0, 0xd5, 0xec, 0xa5, 0xaa, 0x8d, 0x8c, 0x95, 0xe5, 0x6b, 0x4a, 0x9d, 0xb3, 0xc6, 0x10, 0xa6, 0xc2,
+  0x4c, 0x2e, 0x9d, 0xab, 0x6d, 0x2e, 0x8e, 0x30, 0xa6, 0xea, 0x8d, 0x31, 0xae, 0x53, 0xcf, 0x54, 0xa4, 0x33, 0x84, 0xd6, 0xa5, 0xaa, 0x6c, 0x07, 0x4c, 0x4b, 0x95, 0x48, 0x74, 0x85, 0x7c, 0x8a,
+  0x7c, 0x40, 0x6c, 0x0b, 0x8d, 0xcd, 0x9d, 0x72, 0xbe, 0x32, 0xb6, 0xec, 0x85, 0xac, 0xa5, 0x70, 0xb6, 0x92, 0xbe, 0x94, 0xdf, 0x2c, 0xae, 0x6c, 0xcf, 0x13, 0xcf, 0x2a, 0x85, 0x69, 0x8d, 0x88,
+  0x95, 0x2a, 0x95, 0x65, 0x6c, 0x4e, 0xae, 0x8b, 0x95, 0xaa, 0x8d, 0x68, 0x7c, 0xc0, 0x5b, 0xe5, 0x5b, 0xa5, 0x5b, 0xc7, 0x47, 0x6c, 0x23, 0x64, 0xea, 0x84, 0xea, 0x9d, 0x4b, 0x95, 0x4c, 0x95,
+  0x50, 0xb6, 0xea, 0x7c, 0xe0, 0x4b, 0x00, 0x54, 0x20, 0x6c, 0xc5, 0x74, 0x25, 0x85, 0xc6, 0x95, 0xf0, 0xbe, 0x75, 0xdf, 0x4d, 0xcf, 0x8e, 0xae, 0x8a, 0x8d, 0xe0, 0x5b, 0x65, 0x64, 0xa0, 0x54,
+  0x43, 0x64, 0xcb, 0x8c, 0x06, 0x75, 0x20, 0x6c, 0xad, 0xcc, 0xae, 0xcd, 0x40, 0x4c, 0x6c, 0xb6, 0xe8, 0x84, 0x00, 0x7d, 0x2d, 0xb5, 0x10, 0xbe, 0x4f, 0x65, 0xfb, 0xbe, 0x3d, 0xd7, 0x74, 0x74,
+  0xcd, 0x3a, 0x8b, 0x3a, 0xc9, 0x29, 0x8b, 0x3a, 0xab, 0x3a, 0x87, 0x01, 0x47, 0x01, 0x88, 0x19, 0xc8, 0x19, 0x87, 0x19, 0xc8, 0x21, 0xa8, 0x19, 0xc9, 0x19, 0xed, 0x42, 0xcc, 0x42, 0x2b, 0x32,
+  0x2e, 0x53, 0x91, 0x43, 0xb9, 0x9d, 0xde, 0xc6, 0x3d, 0xcf, 0xf9, 0xbe, 0x5a, 0xbf, 0x7a, 0x9f, 0x9a, 0x97, 0x7a, 0x9f, 0x5c, 0xdf, 0x7b, 0xe7, 0xec, 0xb6, 0x25, 0x34, 0x0d, 0x63, 0x2a, 0x8d,
+  0x00, 0x64, 0x03, 0xa0, 0x5b, 0x91, 0x00, 0x5c, 0xaa, 0x95, 0x4a, 0x8d, 0x30, 0xae, 0x8e, 0xb6, 0xaf, 0xbe, 0x51, 0xd7, 0xd0, 0xbe, 0x2d, 0x9e, 0x2b, 0xa6, 0x34, 0xd7, 0xd1, 0xe7, 0x33, 0xd7,
+  0x30, 0xcf, 0xe7, 0xbe, 0x69, 0x85, 0x8d, 0xae, 0x02, 0x80, 0x53, 0xac, 0xa5, 0x74, 0xa3, 0x7c, 0xce, 0xa5, 0x39, 0xce, 0xb6, 0xb5, 0x17, 0xbe, 0xb6, 0xbc, 0x74, 0x9d, 0xbb, 0xb7, 0x5b, 0xc7,
+  0x3b, 0xdf, 0x91, 0xd7, 0x71, 0xae, 0xd7, 0xb5, 0xf9, 0x9e, 0xd8, 0x9e, 0xb2, 0x7d, 0x95, 0x96, 0x0b, 0x8d, 0x15, 0xb6, 0xfb, 0xde, 0x6e, 0x9d, 0x89, 0x95, 0x0e, 0xae, 0x42, 0x53, 0x4c, 0x9d,
+  0xea, 0xa5, 0x10, 0xa6, 0x4a, 0x85, 0xf3, 0xce, 0xf4, 0xc6, 0xcd, 0x9d, 0x70, 0xbe, 0x6c, 0xae, 0xd0, 0xbe, 0x6d, 0xbe, 0xd2, 0xc6, 0x73, 0xc6, 0x71, 0xde, 0x8b, 0xbd, 0x20, 0x65, 0x69, 0x8d,
+  0xc3, 0x5c, 0xe8, 0x84, 0x02, 0x48, 0x74, 0xa6, 0x87, 0x6c, 0x05, 0x6c, 0x26, 0x6c, 0x85, 0x7c, 0x61, 0x53, 0x82, 0x53, 0x6d, 0x9d, 0x89, 0x84, 0x46, 0x64, 0x00, 0x4c, 0x60, 0x4d, 0x13, 0xcf,
+  0x27, 0x8e, 0x4e, 0xcf, 0xd1, 0xc6, 0xd6, 0xe7, 0xf8, 0xef, 0xd8, 0xef, 0xb5, 0xe7, 0x74, 0xdf, 0xae, 0xa5, 0x08, 0x7d, 0xc0, 0x4c, 0x25, 0x6c, 0xa0, 0x5b, 0x47, 0x74, 0x02, 0x8e, 0x46, 0xb5,
+  0x92, 0xcf, 0x11, 0xc7, 0x27, 0x8c, 0xfa, 0xae, 0xb4, 0x74, 0x4f, 0x4b, 0x0d, 0x53, 0x6f, 0x5b, 0x09, 0x2a, 0x05, 0x11, 0x03, 0x83, 0x00, 0x81, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x84, 0x00,
+  0x83, 0x00, 0x02, 0xa3, 0x00, 0x08, 0x83, 0x00, 0x98, 0xa4, 0x00, 0xe5, 0x08, 0x88, 0x19, 0xec, 0x4a, 0xb0, 0x5b, 0x15, 0x85, 0x1c, 0xb7, 0x9f, 0xcf, 0xfb, 0xc7, 0xdb, 0xbf, 0x39, 0x96, 0xf5,
+  0x5d, 0x8e, 0x04, 0xa5, 0x33, 0xa0, 0x42, 0xa0, 0x53, 0xe0, 0x53, 0x60, 0x53, 0xed, 0xa5, 0x10, 0xb6, 0x00, 0x54, 0x60, 0x4d, 0x20, 0x86, 0x11, 0xc7, 0x02, 0x6f, 0xd7, 0xdd, 0xb0, 0xbe, 0x4b,
+  0xb6, 0x54, 0xd7, 0x75, 0xdf, 0xb5, 0xe7, 0x31, 0xcf, 0x2f, 0xcf, 0xa0, 0x54, 0x01, 0x64, 0xe5, 0x63, 0xc0, 0x53, 0xc6, 0x6c, 0xef, 0x8c, 0x10, 0xa6, 0x3a, 0xbf, 0x7b, 0xaf, 0xbb, 0xb7, 0xdd,
+  0xcf, 0x9b, 0xcf, 0xb9, 0xd7, 0xdb, 0xe7, 0x3b, 0xdf, 0x38, 0xdf, 0xbc, 0xe7, 0x7d, 0xbf, 0xfa, 0x6e, 0x59, 0x8f, 0x55, 0x86, 0x90, 0x5d, 0xd2, 0x7d, 0xfa, 0xce, 0xfa, 0xd6, 0xf0, 0xad, 0xa0,
+  0x74, 0x4e, 0x84, 0xe0, 0x4a, 0x83, 0x7c, 0x23, 0x8d, 0x93, 0xc6, 0xa5, 0x65, 0xc0, 0x85, 0x80, 0x95, 0x10, 0xc7, 0x2a, 0xc7, 0xc2, 0x95, 0xf1, 0xbe, 0x8f, 0xbe, 0x6c, 0xb6, 0xcf, 0xad, 0x14,
+  0xf6, 0x0e, 0xe6, 0x0d, 0x9e, 0x84, 0x64, 0x63, 0x5b, 0xe0, 0x4b, 0x40, 0x4c, 0x22, 0x4c, 0x86, 0x74, 0x47, 0x74, 0x60, 0x5b, 0xe0, 0x63, 0x00, 0x4b, 0xc0, 0x5b, 0xcc, 0x8c, 0x08, 0x6c, 0xe0,
+  0x4b, 0x67, 0x7c, 0xc6, 0x8d, 0xb1, 0xbf, 0x6c, 0xcf, 0x75, 0xdf, 0xd8, 0xe7, 0xfb, 0xef, 0xf9, 0xf7, 0xd9, 0xef, 0xf9, 0xf7, 0xf5, 0xef, 0x4d, 0xcf, 0x60, 0x64, 0x6f, 0xb6, 0x0a, 0x7d, 0xc0,
+  0x54, 0x00, 0x4b, 0xc0, 0x4b, 0xd5, 0xbe, 0x14, 0x8d, 0xea, 0x3a, 0x29, 0x2a, 0x46, 0x11, 0xc4, 0x00, 0x84, 0x00, 0x83, 0x00, 0x84, 0x00, 0x02, 0x83, 0x00, 0x81, 0x84, 0x00, 0x0d, 0xa4, 0x00,
+  0x83, 0xa3, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x04, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x02, 0x83, 0x00, 0x95, 0xa4, 0x00, 0xc8, 0x31, 0xec, 0x4a, 0x73, 0x7c, 0x5c, 0xb6, 0xbc, 0xb7, 0x75, 0x1e, 0x30,
+  0x05, 0xe0, 0x29, 0x40, 0x53, 0x87, 0x74, 0x60, 0x53, 0x30, 0xae, 0xa9, 0x7d, 0x00, 0x6d, 0x60, 0xa6, 0xf0, 0xbe, 0x70, 0xd7, 0x93, 0xd7, 0x73, 0xdf, 0x14, 0xd7, 0x02, 0x97, 0xe7, 0xc6, 0xb6,
+  0xe7, 0x94, 0xdf, 0xb6, 0xe7, 0x6e, 0xb6, 0x30, 0xb6, 0x8c, 0x9d, 0x20, 0x53, 0x00, 0x5c, 0x02, 0x64, 0xf2, 0x94, 0xb7, 0xad, 0x5b, 0xb7, 0x79, 0x7f, 0xf9, 0x17, 0xdb, 0xbf, 0x9a, 0xc7, 0x58,
+  0xef, 0x5a, 0xf7, 0xbc, 0xff, 0xbc, 0xf7, 0x9c, 0xf7, 0x73, 0x9f, 0xf4, 0x7f, 0x79, 0xa7, 0x17, 0x3f, 0x37, 0x4f, 0xb6, 0x96, 0xd3, 0x94, 0x1b, 0xdf, 0x15, 0xd7, 0x0f, 0xa6, 0x0a, 0x41, 0xcc,
+  0x8c, 0x8e, 0x9d, 0xec, 0x8c, 0x6c, 0xd7, 0x13, 0xcf, 0xad, 0x9d, 0xab, 0xa5, 0xc8, 0x84, 0x85, 0x6d, 0x84, 0x6d, 0x8d, 0xb6, 0x6b, 0xd7, 0xc5, 0x9d, 0x67, 0x95, 0x2c, 0xb6, 0x72, 0xbe, 0xe6,
+  0x7c, 0x08, 0x85, 0x03, 0x5d, 0x05, 0x6c, 0x00, 0x7d, 0xc0, 0x7c, 0xa3, 0x74, 0x80, 0x5b, 0xc5, 0x74, 0xc6, 0x5b, 0x80, 0x19, 0xe1, 0x4a, 0xa0, 0x4a, 0x08, 0x6c, 0x64, 0x83, 0xeb, 0xa2, 0x6a,
+  0x65, 0x10, 0xb7, 0xb6, 0xee, 0x3c, 0xdf, 0x9e, 0xdf, 0xbe, 0xef, 0x02, 0xdf, 0xef, 0x8a, 0xde, 0xef, 0xbe, 0xe7, 0x73, 0xbf, 0x74, 0xc7, 0x8f, 0xaf, 0x90, 0xbf, 0xce, 0x7d, 0x30, 0x8d, 0x8a,
+  0x3a, 0x86, 0x19, 0x05, 0xa4, 0x00, 0x81, 0xa3, 0x00, 0x03, 0xa4, 0x00, 0x06, 0x84, 0x00, 0x0b, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x0b, 0xa4, 0x00, 0xa5, 0x84, 0x00, 0xa4, 0x00, 0x6b, 0x3a, 0xb4,
+  0x84, 0xbd, 0xb6, 0x7d, 0xae, 0xcd, 0x9d, 0xec, 0xb6, 0x0d, 0x96, 0x51, 0xde, 0xd2, 0xee, 0x90, 0xb6, 0xf2, 0xd5, 0x14, 0xee, 0x74, 0xe7, 0x8e, 0xdf, 0x73, 0xd7, 0xf7, 0xef, 0x55, 0xd7, 0xf6,
+  0xef, 0xf7, 0xef, 0xdc, 0xef, 0xfd, 0xef, 0xfb, 0xe6, 0x53, 0xad, 0xd7, 0xdd, 0xb2, 0x94, 0x56, 0x8e, 0xe7, 0x0b, 0x76, 0x86, 0xf8, 0x96, 0x9b, 0xb7, 0x7f, 0xbe, 0x77, 0xaf, 0xbc, 0xe7, 0xfe,
+  0xff, 0xff, 0xff, 0x06, 0xfe, 0xff, 0xa7, 0xbd, 0xff, 0x17, 0xbf, 0x74, 0x7f, 0x96, 0x86, 0x38, 0xae, 0x16, 0xd0, 0xad, 0xa5, 0x4d, 0x8d, 0xad, 0x04, 0x00, 0x4d, 0x45, 0x7d, 0x81, 0x74, 0xd0,
+  0xbe, 0x92, 0xce, 0x11, 0xb6, 0x6a, 0x95, 0x0d, 0xa6, 0x8a, 0x85, 0x28, 0x8d, 0x4a, 0x8d, 0x90, 0xbe, 0xb1, 0xc6, 0x53, 0xbe, 0x70, 0xa6, 0x8c, 0x9d, 0x0d, 0xa6, 0xeb, 0x8c, 0xe4, 0x5b, 0x40,
+  0x64, 0x60, 0x4b, 0xa0, 0x4b, 0x0c, 0x85, 0xa2, 0x53, 0xc5, 0x63, 0x65, 0x5b, 0x23, 0x41, 0x4c, 0xbc, 0x34, 0xee, 0xbc, 0xff, 0x02, 0xdd, 0xff, 0x81, 0xfd, 0xff, 0x08, 0xfe, 0xff, 0x03, 0xfd,
+  0xff, 0x84, 0xfe, 0xff, 0xb8, 0xd6, 0xcb, 0x52, 0x05, 0x09, 0x02, 0xc5, 0x00, 0x02, 0xa5, 0x00, 0x81, 0xa4, 0x00, 0x04, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x02,
+  0x84, 0x00, 0x81, 0xa4, 0x00, 0x08, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x0d, 0xa4, 0x00, 0x02, 0xa3, 0x00, 0x83, 0x25, 0x11, 0xf0, 0x73, 0xdf, 0xef, 0x02, 0xfe, 0xff, 0x04, 0xfd,
+  0xff, 0x86, 0x5b, 0xff, 0x55, 0xff, 0x36, 0xff, 0xf5, 0xef, 0xf8, 0xe7, 0x97, 0xdf, 0x02, 0xf8, 0xef, 0x81, 0xfc, 0xf7, 0x02, 0xdb, 0xe7, 0x89, 0xfb, 0xe7, 0xdc, 0xdf, 0x5c, 0xd7, 0xdb, 0xa6,
+  0x14, 0x05, 0xb2, 0x0c, 0xf1, 0x3d, 0xb5, 0x8e, 0x7a, 0xd7, 0x03, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x08, 0xfe, 0xff, 0xa2, 0xfc, 0xf7, 0xdc, 0xc7, 0xbe, 0xc7, 0xb9, 0xd6, 0x8c, 0xb6, 0xeb, 0x7c,
+  0x8f, 0x45, 0x00, 0x5c, 0xe7, 0x7c, 0xc5, 0x74, 0x50, 0xbe, 0x10, 0xdd, 0x91, 0xcd, 0xc5, 0x7c, 0xac, 0x84, 0x6d, 0x95, 0x4e, 0xb6, 0x51, 0xbe, 0x0d, 0xae, 0xe5, 0x74, 0x2c, 0x9e, 0xee, 0xa5,
+  0x49, 0x85, 0xa8, 0x7c, 0x2d, 0x95, 0x04, 0x6c, 0xe0, 0x53, 0x80, 0x5c, 0x20, 0x5c, 0x94, 0xa5, 0xae, 0x6b, 0xc0, 0x7c, 0x80, 0x8b, 0xf9, 0xe6, 0x02, 0xfd, 0xff, 0x05, 0xfe, 0xff, 0x0a, 0xff,
+  0xff, 0x83, 0x38, 0xc6, 0xe5, 0x08, 0xa5, 0x00, 0x05, 0xc5, 0x00, 0x82, 0xa4, 0x00, 0x63, 0x00, 0x04, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x02, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x04, 0xe6, 0x00, 0x02,
+  0x07, 0x01, 0x81, 0x27, 0x01, 0x02, 0x07, 0x01, 0x81, 0xe7, 0x00, 0x04, 0xe6, 0x00, 0x03, 0xc5, 0x00, 0x81, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x81, 0xa3, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xa3, 0x00,
+  0x83, 0x83, 0x00, 0xf4, 0x9c, 0xff, 0xff, 0x08, 0xfe, 0xff, 0x87, 0xbb, 0xff, 0x99, 0xf7, 0xfd, 0xf7, 0xb9, 0xf7, 0x77, 0xf7, 0xfd, 0xff, 0xfe, 0xff, 0x04, 0xfd, 0xff, 0x85, 0xde, 0xff, 0x5e,
+  0xdf, 0x7a, 0x65, 0x56, 0x4d, 0xbc, 0xf7, 0x05, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x02, 0xbe, 0xf7, 0x02, 0xff, 0xff, 0x04, 0xfe, 0xff, 0xa0, 0xfe, 0xf7, 0xbe, 0xdf, 0x1c, 0xe7, 0xd3, 0xe7, 0x24,
+  0x96, 0x80, 0x6d, 0x25, 0x64, 0xe5, 0x7c, 0x08, 0x85, 0xed, 0xa5, 0xaf, 0xbd, 0xaf, 0xb5, 0x80, 0x64, 0xe6, 0x6c, 0x4c, 0x95, 0xa0, 0x53, 0x4c, 0x8d, 0x60, 0x5b, 0xcd, 0xa5, 0x47, 0x64, 0x2b,
+  0x8d, 0x20, 0x4b, 0x24, 0x64, 0x21, 0x53, 0x49, 0x6c, 0x6a, 0x74, 0xc0, 0x5c, 0xa0, 0x5b, 0x8c, 0x4a, 0x89, 0x7a, 0x97, 0xde, 0xfd, 0xff, 0x05, 0xfe, 0xff, 0x85, 0xfb, 0xde, 0xb6, 0xb5, 0x71,
+  0x8c, 0x6e, 0x63, 0x47, 0x19, 0x02, 0x06, 0x11, 0x82, 0x26, 0x11, 0x06, 0x11, 0x02, 0x26, 0x11, 0x83, 0x47, 0x11, 0x26, 0x11, 0xc5, 0x00, 0x02, 0xe5, 0x00, 0x02, 0xc5, 0x00, 0x92, 0xc6, 0x00,
+  0xe6, 0x00, 0x07, 0x01, 0xa5, 0x00, 0x76, 0xde, 0x9c, 0xff, 0xbc, 0xff, 0x9c, 0xff, 0x9c, 0xf7, 0x7c, 0xf7, 0x5b, 0xef, 0x3b, 0xe7, 0xfa, 0xe6, 0xb9, 0xde, 0x37, 0xce, 0xd5, 0xbd, 0x54, 0xad,
+  0xb1, 0x9c, 0x03, 0x71, 0x8c, 0x84, 0x91, 0x94, 0xb2, 0x94, 0x30, 0x8c, 0xcb, 0x62, 0x02, 0xc5, 0x00, 0x12, 0xa4, 0x00, 0x88, 0x84, 0x00, 0xe5, 0x10, 0x05, 0x11, 0x26, 0x19, 0x8f, 0x63, 0x55,
+  0xa5, 0x1c, 0xdf, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x83, 0xdd, 0xff, 0xda, 0xef, 0xfc, 0xff, 0x0a, 0xfe, 0xff, 0x81, 0xdd, 0xff, 0x04, 0xfe, 0xff, 0x89, 0x37, 0xc6, 0x6d, 0x6b, 0xe5, 0x10, 0xa4,
+  0x00, 0x84, 0x00, 0xc5, 0x08, 0x8b, 0x4a, 0x75, 0xad, 0x7d, 0xef, 0x04, 0xfe, 0xff, 0x9c, 0x7d, 0xff, 0xfc, 0xf7, 0x6e, 0xc6, 0xca, 0x85, 0x20, 0x43, 0xc0, 0x53, 0x42, 0x64, 0x87, 0x74, 0x30,
+  0xb6, 0xef, 0xad, 0x67, 0x8d, 0x83, 0x65, 0xa0, 0x53, 0x40, 0x64, 0x48, 0x64, 0xc5, 0x5b, 0x86, 0x64, 0xc8, 0x7c, 0x81, 0x4b, 0xa0, 0x5b, 0x80, 0x5b, 0x20, 0x4b, 0x07, 0x6c, 0x8e, 0x95, 0xa0,
+  0x53, 0x00, 0x5c, 0x46, 0x32, 0xd9, 0xde, 0x05, 0xfe, 0xff, 0x83, 0x58, 0xc6, 0xaa, 0x52, 0xa3, 0x00, 0x03, 0xc4, 0x00, 0x82, 0xc5, 0x00, 0xa4, 0x00, 0x0c, 0xc5, 0x00, 0x85, 0xc6, 0x00, 0xe6,
+  0x00, 0x08, 0x01, 0xe9, 0x39, 0xbc, 0xff, 0x03, 0xdd, 0xff, 0x03, 0xfd, 0xff, 0x02, 0xdd, 0xff, 0x0a, 0xfd, 0xff, 0x84, 0xdd, 0xff, 0xbc, 0xff, 0x5a, 0xff, 0xc5, 0x18, 0x03, 0x84, 0x00, 0x81,
+  0x83, 0x00, 0x0d, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x06, 0xa4, 0x00, 0x82, 0xcf, 0x73, 0x5c, 0xe7, 0x08, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x83, 0x7c, 0xef, 0xeb, 0x52, 0xa4, 0x00,
+  0x07, 0xc4, 0x00, 0x83, 0xc5, 0x08, 0x34, 0x9d, 0xde, 0xf7, 0x02, 0xfe, 0xff, 0x8c, 0xfd, 0xff, 0x5b, 0xff, 0x5b, 0xdf, 0x6b, 0x85, 0xa0, 0x4b, 0xa4, 0x63, 0xee, 0xa5, 0xe4, 0x6b, 0xec, 0xa5,
+  0x6b, 0x95, 0xad, 0x9d, 0xca, 0x84, 0x02, 0xaa, 0x84, 0x8d, 0x40, 0x4b, 0x80, 0x43, 0x80, 0x53, 0xeb, 0x84, 0x6d, 0x95, 0x03, 0x5c, 0xc3, 0x53, 0xe7, 0x7c, 0x88, 0x6c, 0x64, 0x31, 0x83, 0x19,
+  0xc6, 0x69, 0xb9, 0xde, 0x04, 0xfe, 0xff, 0x82, 0x5c, 0xe7, 0x2c, 0x63, 0x02, 0xa4, 0x00, 0x07, 0xc5, 0x00, 0x0b, 0xa5, 0x00, 0x84, 0xa6, 0x00, 0xe7, 0x00, 0x88, 0x19, 0x3b, 0xef, 0x02, 0xdd,
+  0xff, 0x09, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0x03, 0xfd, 0xff, 0x84, 0xdd, 0xff, 0xbc, 0xff, 0xeb, 0x62, 0x63, 0x00, 0x04, 0x83, 0x00, 0x03, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x04, 0x84, 0x00, 0x03,
+  0xa4, 0x00, 0x04, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x85, 0xa5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x05, 0x11, 0xf8, 0xbd, 0x06, 0xfe, 0xff, 0x87, 0x99, 0xce, 0xf4, 0x9c, 0x92, 0x8c, 0xd3, 0x94, 0xf7,
+  0xbd, 0x5d, 0xe7, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x83, 0x5b, 0xef, 0xa7, 0x29, 0xc5, 0x00, 0x05, 0xa4, 0x00, 0x04, 0xc4, 0x00, 0x83, 0xc5, 0x00, 0xcf, 0x73, 0xbe, 0xf7, 0x02, 0xfe, 0xff, 0x99,
+  0xfd, 0xff, 0x5e, 0xcf, 0x79, 0xe4, 0x80, 0x53, 0x20, 0x4b, 0xeb, 0x8c, 0xa8, 0x7c, 0xa0, 0x5c, 0x8b, 0x9d, 0xcd, 0xa5, 0x27, 0x8d, 0x43, 0x74, 0x60, 0x64, 0xe0, 0x5b, 0x60, 0x53, 0x00, 0x4b,
+  0x65, 0x53, 0x60, 0x53, 0x26, 0x6c, 0x66, 0x74, 0x00, 0x55, 0xce, 0x95, 0x90, 0x94, 0x22, 0x6a, 0x0c, 0x9c, 0x04, 0xfe, 0xff, 0x83, 0x38, 0xc6, 0xe4, 0x08, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x05,
+  0xc5, 0x00, 0x81, 0xe5, 0x00, 0x02, 0xc5, 0x00, 0x81, 0xa4, 0x00, 0x02, 0xa5, 0x00, 0x81, 0xc5, 0x00, 0x02, 0xa5, 0x00, 0x88, 0x84, 0x00, 0xa4, 0x00, 0xe7, 0x31, 0x8a, 0x4a, 0x6d, 0x6b, 0xb5,
+  0xb5, 0xdc, 0xf7, 0xfc, 0xff, 0x04, 0xfd, 0xff, 0x0f, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x85, 0xdd, 0xff, 0x99, 0xd6, 0x86, 0x29, 0x22, 0x00, 0x42, 0x00, 0x02, 0x63, 0x00, 0x05, 0x83, 0x00, 0x81,
+  0x63, 0x00, 0x02, 0x83, 0x00, 0x02, 0x84, 0x00, 0x82, 0xa4, 0x00, 0xa3, 0x00, 0x07, 0xa4, 0x00, 0x03, 0xa5, 0x00, 0x82, 0xc5, 0x00, 0x55, 0xa5, 0x03, 0xfe, 0xff, 0x8f, 0x7d, 0xef, 0x0c, 0x5b,
+  0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x8e, 0x6b, 0xba, 0xd6, 0xfe, 0xff, 0x7c, 0xef, 0xe7, 0x39, 0xa4, 0x00, 0xc5, 0x00, 0x08, 0xa4, 0x00, 0x81, 0xc4, 0x00,
+  0x02, 0xa4, 0x00, 0x81, 0x30, 0x84, 0x03, 0xfe, 0xff, 0x98, 0xb8, 0xf7, 0x5c, 0xe7, 0x40, 0x53, 0x25, 0x6c, 0x8c, 0x9d, 0xa4, 0x7c, 0x8b, 0x9d, 0xce, 0xa5, 0x8c, 0x9d, 0x68, 0x8d, 0xc4, 0x7c,
+  0xc6, 0x74, 0x80, 0x5b, 0xc0, 0x53, 0xc0, 0x42, 0x21, 0x3b, 0x20, 0x43, 0x40, 0x53, 0xc5, 0x63, 0x0b, 0x9e, 0x51, 0xbe, 0x4b, 0x94, 0x46, 0xbc, 0xdd, 0xff, 0x03, 0xfe, 0xff, 0x8f, 0x54, 0xa5,
+  0x83, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x47, 0x09, 0xaf, 0x6b, 0x75, 0xad, 0x58, 0xc6, 0xda, 0xce, 0xfb, 0xd6, 0xfa, 0xd6, 0x02, 0xd9, 0xd6, 0x84,
+  0xda, 0xd6, 0x1b, 0xdf, 0x7c, 0xef, 0xbd, 0xf7, 0x02, 0xfe, 0xff, 0x08, 0xfd, 0xff, 0x15, 0xfe, 0xff, 0x84, 0xbd, 0xf7, 0x9d, 0xf7, 0x9d, 0xef, 0x9d, 0xf7, 0x02, 0x9c, 0xf7, 0x83, 0x9c, 0xef,
+  0x9c, 0xf7, 0x7c, 0xf7, 0x02, 0x9c, 0xef, 0x81, 0x9d, 0xef, 0x02, 0x9c, 0xef, 0x88, 0x7c, 0xef, 0x5b, 0xe7, 0x1b, 0xdf, 0xd9, 0xce, 0x17, 0xbe, 0x91, 0x84, 0x66, 0x19, 0xa5, 0x00, 0x02, 0xa4,
+  0x00, 0x84, 0xa5, 0x00, 0xa4, 0x00, 0xcf, 0x73, 0xde, 0xf7, 0x02, 0xfe, 0xff, 0x82, 0x7c, 0xef, 0x8a, 0x4a, 0x06, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x83, 0xa4, 0x00, 0xcf, 0x73, 0xa7, 0x29, 0x02,
+  0xc4, 0x00, 0x88, 0xa5, 0x00, 0xa4, 0x00, 0x0c, 0x5b, 0x37, 0xc6, 0x3b, 0xe7, 0x7c, 0xef, 0xba, 0xd6, 0xf0, 0x73, 0x05, 0xa4, 0x00, 0x9a, 0x59, 0xc6, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0x18,
+  0xce, 0x60, 0x74, 0x88, 0x7c, 0x49, 0x7d, 0x27, 0x75, 0x4f, 0xae, 0xcb, 0x95, 0x90, 0xbe, 0x05, 0x5d, 0x84, 0x64, 0x06, 0x8d, 0x0c, 0xa6, 0x85, 0x5b, 0x66, 0x64, 0xc9, 0x7c, 0xe0, 0x42, 0x40,
+  0x53, 0xc0, 0x4b, 0xc5, 0x63, 0xed, 0xa5, 0x68, 0xad, 0xb6, 0xe6, 0x03, 0xfe, 0xff, 0x81, 0xf6, 0xbd, 0x04, 0x83, 0x00, 0x85, 0xa4, 0x00, 0xc5, 0x00, 0x6e, 0x63, 0x78, 0xc6, 0xdd, 0xf7, 0x04,
+  0xfe, 0xff, 0x02, 0xfd, 0xff, 0x0a, 0xfe, 0xff, 0x86, 0xdd, 0xff, 0x9c, 0xef, 0x5b, 0xe7, 0x1a, 0xdf, 0xfa, 0xde, 0xda, 0xd6, 0x02, 0xb9, 0xd6, 0x03, 0x99, 0xce, 0x81, 0x78, 0xc6, 0x02, 0x58,
+  0xc6, 0x81, 0x79, 0xc6, 0x02, 0x79, 0xce, 0x84, 0x99, 0xce, 0xda, 0xd6, 0x3c, 0xe7, 0xbe, 0xf7, 0x0d, 0xfe, 0xff, 0x0a, 0xfd, 0xff, 0x03, 0xfe, 0xff, 0x83, 0xde, 0xf7, 0x78, 0xce, 0xcb, 0x52,
+  0x02, 0xa4, 0x00, 0x82, 0xa7, 0x29, 0xbe, 0xf7, 0x02, 0xfe, 0xff, 0x82, 0x5c, 0xef, 0x29, 0x42, 0x03, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x07, 0xc4, 0x00, 0x81, 0xb1, 0x8c, 0x06,
+  0xfe, 0xff, 0x81, 0xd0, 0x6b, 0x04, 0xa4, 0x00, 0x82, 0x29, 0x3a, 0xdf, 0xff, 0x02, 0xfe, 0xff, 0x96, 0xd1, 0xab, 0xe4, 0x63, 0x8b, 0x84, 0x0c, 0xa6, 0xa7, 0x6d, 0x90, 0xbe, 0x2e, 0xa6, 0x92,
+  0xbe, 0x42, 0x85, 0x0d, 0xae, 0x0d, 0xa6, 0xcb, 0x85, 0xc0, 0x4b, 0xa3, 0x5b, 0xe8, 0x6b, 0x20, 0x43, 0x80, 0x5b, 0xa5, 0x7c, 0x80, 0x4b, 0xc5, 0x63, 0x66, 0x84, 0xdd, 0xff, 0x02, 0xfe, 0xff,
+  0x82, 0x5b, 0xe7, 0x62, 0x00, 0x04, 0x83, 0x00, 0x82, 0x8a, 0x4a, 0xfa, 0xd6, 0x05, 0xfe, 0xff, 0x04, 0xfd, 0xff, 0x05, 0xfe, 0xff, 0x88, 0xde, 0xff, 0xba, 0xd6, 0x14, 0x9d, 0xcb, 0x52, 0xe4,
+  0x08, 0xa3, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x04, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x81, 0xa5, 0x00, 0x07, 0xa4, 0x00, 0x84, 0xa7, 0x29, 0x71, 0x84, 0x59, 0xc6,
+  0x9e, 0xf7, 0x05, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x09, 0xfd, 0xff, 0x05, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x83, 0xd7, 0xbd, 0x26, 0x19, 0xf7, 0xbd, 0x02, 0xfe, 0xff, 0x82, 0x5c, 0xef, 0x08, 0x3a,
+  0x04, 0xa3, 0x00, 0x04, 0x83, 0x00, 0x82, 0xa4, 0x00, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x85, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x50, 0x84, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x83, 0xde, 0xf7, 0x8c,
+  0x42, 0xe7, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x84, 0x00, 0xa4, 0x00, 0x9a, 0xd6, 0x02, 0xfe, 0xff, 0x91, 0xf8, 0xdd, 0x01, 0x6c, 0x23, 0x74, 0x47, 0x8d, 0xac, 0xa5, 0x72, 0xbe, 0x72, 0xb6, 0x4f,
+  0xa6, 0xee, 0xa5, 0x8b, 0x9d, 0x10, 0xae, 0xc0, 0x53, 0xe0, 0x5b, 0x0d, 0x8d, 0x08, 0x74, 0xca, 0x7c, 0x60, 0x4b, 0x02, 0x00, 0x4b, 0x82, 0x20, 0x7a, 0xc6, 0x9b, 0x03, 0xfe, 0xff, 0x82, 0x4c,
+  0x6b, 0x62, 0x00, 0x02, 0x83, 0x00, 0x83, 0xa3, 0x00, 0xae, 0x6b, 0xbe, 0xf7, 0x02, 0xfe, 0xff, 0x05, 0xfd, 0xff, 0x06, 0xfe, 0xff, 0x83, 0xde, 0xf7, 0xb6, 0xad, 0xc7, 0x29, 0x02, 0xa3, 0x00,
+  0x04, 0x84, 0x00, 0x07, 0xa4, 0x00, 0x05, 0xc4, 0x00, 0x0a, 0xa4, 0x00, 0x84, 0xc4, 0x00, 0xcf, 0x6b, 0xbb, 0xd6, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x07, 0xfd, 0xff, 0x06, 0xfe,
+  0xff, 0x90, 0xfd, 0xff, 0xfe, 0xff, 0xdd, 0xf7, 0xfe, 0xff, 0xde, 0xff, 0x7c, 0xef, 0x08, 0x3a, 0x83, 0x00, 0xa3, 0x00, 0x83, 0x00, 0x63, 0x00, 0x8a, 0x4a, 0x37, 0xc6, 0xb9, 0xd6, 0x54, 0xa5,
+  0x83, 0x00, 0x02, 0xa4, 0x00, 0x04, 0xc5, 0x00, 0x82, 0xa4, 0x00, 0x75, 0xad, 0x04, 0xfe, 0xff, 0x85, 0xbd, 0xf7, 0x1b, 0xe7, 0x10, 0x7c, 0x29, 0x01, 0x4a, 0x01, 0x02, 0xa4, 0x00, 0x83, 0x84,
+  0x00, 0xa4, 0x00, 0xd3, 0x94, 0x02, 0xfe, 0xff, 0x95, 0xbc, 0xff, 0xc0, 0x4b, 0xe1, 0x63, 0x29, 0x95, 0x48, 0x7c, 0x8e, 0xb6, 0x60, 0x4d, 0x42, 0x5d, 0x8a, 0x8d, 0x28, 0x6d, 0x8f, 0x9d, 0xe0,
+  0x6c, 0x80, 0x53, 0xe9, 0x8c, 0xa9, 0x84, 0x89, 0x74, 0xe3, 0x63, 0xa5, 0x63, 0xa0, 0x42, 0x40, 0x62, 0xf5, 0xc5, 0x02, 0xfe, 0xff, 0x83, 0xfa, 0xde, 0x63, 0x00, 0x62, 0x00, 0x02, 0x83, 0x00,
+  0x82, 0x08, 0x3a, 0xbe, 0xf7, 0x03, 0xfe, 0xff, 0x05, 0xfd, 0xff, 0x05, 0xfe, 0xff, 0x83, 0xda, 0xd6, 0x29, 0x42, 0xa4, 0x00, 0x03, 0xa3, 0x00, 0x81, 0x83, 0x00, 0x05, 0x84, 0x00, 0x02, 0xa4,
+  0x00, 0x81, 0x84, 0x00, 0x14, 0xa4, 0x00, 0x82, 0xcb, 0x52, 0x9a, 0xce, 0x02, 0xff, 0xff, 0x08, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x0c, 0xfe, 0xff, 0x82, 0x9d, 0xf7, 0x8a, 0x52, 0x04, 0x83, 0x00,
+  0x82, 0xce, 0x73, 0xdd, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0xba, 0xd6, 0x04, 0xa4, 0x00, 0x83, 0xc4, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0xa9, 0x30, 0x84, 0xbd, 0xf7, 0x3b, 0xe7, 0x51,
+  0x84, 0x85, 0x00, 0xe7, 0x00, 0x28, 0x01, 0x29, 0x01, 0x6a, 0x01, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xae, 0x73, 0xff, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0xe0, 0x64, 0xa7, 0x7c, 0xc4,
+  0x63, 0x88, 0x7c, 0xa8, 0x85, 0x86, 0x6d, 0xcd, 0x9d, 0x88, 0x6c, 0x0b, 0x85, 0x60, 0x6c, 0xc0, 0x74, 0xa0, 0x6c, 0x24, 0x6c, 0xec, 0xad, 0x07, 0x75, 0x2e, 0x95, 0x07, 0x6c, 0x01, 0x4b, 0x80,
+  0x3a, 0x5b, 0xef, 0xfe, 0xff, 0xfd, 0xff, 0x54, 0xa5, 0x83, 0x00, 0x02, 0x63, 0x00, 0x82, 0x83, 0x00, 0x58, 0xc6, 0x03, 0xfe, 0xff, 0x06, 0xfd, 0xff, 0x04, 0xfe, 0xff, 0x83, 0x58, 0xc6, 0xa4,
+  0x00, 0x84, 0x00, 0x04, 0xa3, 0x00, 0x02, 0x83, 0x00, 0x09, 0x84, 0x00, 0x08, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x06, 0xa4, 0x00, 0x83, 0x72, 0x8c, 0xbe, 0xf7,
+  0xff, 0xff, 0x07, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xbd, 0xf7, 0xeb, 0x5a, 0x04, 0x83, 0x00, 0x82, 0x2c, 0x5b, 0xde, 0xf7, 0x02, 0xfe,
+  0xff, 0x82, 0x7c, 0xef, 0xa7, 0x31, 0x03, 0xa4, 0x00, 0x81, 0x29, 0x32, 0x06, 0xa4, 0x00, 0x82, 0x46, 0x19, 0xe6, 0x00, 0x02, 0x07, 0x01, 0x89, 0x28, 0x01, 0x49, 0x01, 0x6a, 0x01, 0x6b, 0x01,
+  0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xae, 0x6b, 0x02, 0xfe, 0xff, 0x95, 0xdd, 0xff, 0x85, 0x74, 0x25, 0x6c, 0x40, 0x4b, 0x40, 0x53, 0x40, 0x54, 0x86, 0x6d, 0x05, 0x65, 0x20, 0x4d,
+  0xa3, 0x74, 0x4b, 0x95, 0x2b, 0x85, 0x27, 0x6d, 0x24, 0x65, 0x29, 0x85, 0x66, 0x7d, 0xc0, 0x83, 0x4b, 0xac, 0xa5, 0x6b, 0x20, 0x4b, 0xbc, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0x91, 0x94, 0x02, 0x63,
+  0x00, 0x02, 0x83, 0x00, 0x81, 0xbd, 0xf7, 0x04, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x03, 0xfe, 0xff, 0x81, 0xda, 0xd6, 0x03, 0x83, 0x00, 0x02, 0xa3, 0x00, 0x02,
+  0x83, 0x00, 0x84, 0x84, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x02, 0x85, 0x00, 0x8b, 0xc7, 0x00, 0xea, 0x29, 0x4b, 0x32, 0x69, 0x19, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xc5, 0x00, 0xc4,
+  0x00, 0xe3, 0x00, 0xc3, 0x00, 0x02, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x83, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x08, 0xa4, 0x00, 0x83, 0x09, 0x3a, 0xba, 0xd6, 0xff, 0xff, 0x11, 0xfe, 0xff, 0x83,
+  0xfd, 0xff, 0xbd, 0xf7, 0x8a, 0x4a, 0x04, 0x83, 0x00, 0x82, 0xcb, 0x52, 0xbd, 0xf7, 0x02, 0xfe, 0xff, 0x83, 0xbd, 0xf7, 0x8a, 0x4a, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x85, 0x86, 0x21, 0x7d, 0xef,
+  0x79, 0xce, 0xe4, 0x10, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x82, 0xe6, 0x00, 0x28, 0x01, 0x02, 0x49, 0x01, 0x9e, 0x6a, 0x01, 0x49, 0x01, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x92, 0x8c,
+  0xff, 0xff, 0xfe, 0xff, 0xbc, 0xf7, 0x27, 0x74, 0x40, 0x4b, 0x03, 0x4b, 0xa4, 0x63, 0x87, 0x74, 0x4a, 0x85, 0x2e, 0xae, 0x67, 0x85, 0xad, 0x9d, 0xaa, 0x84, 0x92, 0xbe, 0xcd, 0x8d, 0x61, 0x4d,
+  0x47, 0x85, 0x4e, 0xae, 0x81, 0x9c, 0x86, 0xbb, 0x60, 0x6b, 0xa1, 0x5b, 0xdd, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0x91, 0x8c, 0x02, 0x63, 0x00, 0x82, 0x83, 0x00, 0xa3, 0x00, 0x05, 0xfe, 0xff, 0x02,
+  0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x82, 0x7d, 0xef, 0xa7, 0x29, 0x05, 0x83, 0x00, 0x9d, 0xe6, 0x00, 0xca, 0x00, 0xee, 0x00, 0xed, 0x01, 0x52, 0x02, 0xf3, 0x01,
+  0xd1, 0x01, 0x0f, 0x01, 0x8e, 0x01, 0x2e, 0x09, 0xcc, 0x18, 0x0c, 0x21, 0xae, 0x41, 0x0e, 0x42, 0x2c, 0x42, 0x0b, 0x42, 0xea, 0x41, 0x8a, 0x39, 0x8b, 0x39, 0x89, 0x39, 0xa8, 0x31, 0xa9, 0x31,
+  0x8a, 0x31, 0x07, 0x11, 0x87, 0x00, 0xa8, 0x01, 0xe7, 0x00, 0xe5, 0x00, 0xc4, 0x00, 0x06, 0xa4, 0x00, 0x83, 0x63, 0x00, 0x96, 0xad, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0x85, 0xfd, 0xff, 0xbd, 0xf7,
+  0x2c, 0x63, 0x83, 0x00, 0x84, 0x00, 0x02, 0x83, 0x00, 0x82, 0xcb, 0x52, 0x9d, 0xef, 0x03, 0xfe, 0xff, 0x82, 0x8e, 0x6b, 0xa3, 0x00, 0x03, 0xc4, 0x00, 0x81, 0x79, 0xce, 0x02, 0xff, 0xff, 0x83,
+  0x5c, 0xef, 0x4d, 0x63, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x81, 0xe6, 0x00, 0x02, 0x49, 0x01, 0x87, 0x8a, 0x01, 0x07, 0x01, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x38, 0xc6, 0x02, 0xfe,
+  0xff, 0x95, 0xf3, 0xdd, 0x49, 0x8d, 0xc7, 0x84, 0x02, 0x7d, 0x20, 0x53, 0xc0, 0x74, 0x20, 0x6d, 0x61, 0x6d, 0x80, 0x64, 0x60, 0x6c, 0x20, 0x53, 0x0b, 0x8d, 0xf0, 0xad, 0x6f, 0xcd, 0x71, 0xd5,
+  0x0b, 0xa6, 0x4b, 0x8d, 0xc0, 0x64, 0x20, 0x7d, 0xe0, 0x5c, 0xdd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xb1, 0x94, 0x02, 0x63, 0x00, 0x82, 0x83, 0x00, 0xa3, 0x00, 0x0c, 0xfe, 0xff, 0x82, 0x6d, 0x6b,
+  0xa3, 0x00, 0x02, 0x83, 0x00, 0x87, 0x63, 0x00, 0xe4, 0x00, 0x6f, 0x0a, 0xb4, 0x42, 0x1c, 0xe7, 0xbe, 0xf7, 0xde, 0xff, 0x15, 0xfe, 0xff, 0x86, 0xbd, 0xf7, 0x5c, 0xe7, 0x50, 0x84, 0x45, 0x01,
+  0x04, 0x01, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x82, 0xf4, 0x9c, 0xff, 0xff, 0x0e, 0xfe, 0xff, 0x83, 0xbd, 0xf7, 0xaa, 0x52, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x83, 0xa3, 0x00, 0x29,
+  0x3a, 0x7d, 0xef, 0x03, 0xfe, 0xff, 0x81, 0x91, 0x8c, 0x03, 0xa4, 0x00, 0x83, 0xc4, 0x00, 0x86, 0x29, 0x1b, 0xdf, 0x02, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x82, 0x13, 0x9d, 0x63, 0x00, 0x05, 0xa4,
+  0x00, 0x89, 0xe6, 0x00, 0x6a, 0x01, 0x48, 0x01, 0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x87, 0x29, 0xde, 0xf7, 0x02, 0xfe, 0xff, 0x95, 0xf9, 0xc3, 0xaf, 0xa5, 0x6b, 0x95, 0x05, 0x64,
+  0xa9, 0x7c, 0x84, 0x74, 0xa0, 0x6c, 0xa0, 0x54, 0x20, 0x5c, 0x47, 0x74, 0x02, 0x54, 0x8c, 0x95, 0x29, 0x8d, 0x6b, 0xc5, 0xae, 0xd5, 0xea, 0x7c, 0xc0, 0x64, 0x80, 0x7c, 0x80, 0x4c, 0xab, 0x84,
+  0xbc, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0x34, 0xa5, 0x03, 0x83, 0x00, 0x81, 0xa4, 0x00, 0x0a, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x37, 0xc6, 0x04, 0x83, 0x00, 0x84, 0xa4, 0x00, 0x54, 0x3c, 0x9e, 0xef,
+  0xff, 0xff, 0x17, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x84, 0xbd, 0xf7, 0x53, 0xa5, 0x48, 0x01, 0xe5, 0x00, 0x03, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x55, 0xa5,
+  0x0d, 0xfe, 0xff, 0x89, 0x9d, 0xf7, 0xcb, 0x52, 0x83, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x86, 0x29, 0x3c, 0xe7, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x96, 0xad, 0x06, 0xa4, 0x00, 0x82,
+  0x46, 0x21, 0x79, 0xce, 0x02, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x82, 0x38, 0xc6, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x84, 0xc4, 0x00, 0xc5, 0x00, 0xe6, 0x00, 0xc5, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x84,
+  0x00, 0xb6, 0xb5, 0x02, 0xfe, 0xff, 0x96, 0xfd, 0xff, 0xba, 0xed, 0xd1, 0xad, 0xf1, 0xa5, 0xa4, 0x5b, 0x2c, 0x8d, 0x69, 0x8d, 0x60, 0x65, 0x60, 0x6c, 0xa6, 0x7c, 0xaa, 0x8d, 0x23, 0x5d, 0xad,
+  0xa5, 0xe9, 0x84, 0x50, 0xb6, 0x51, 0xb6, 0xc7, 0x6c, 0xe5, 0x7c, 0xe0, 0x63, 0x80, 0x4b, 0x40, 0x52, 0xbd, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0xf7, 0xbd, 0x03, 0x83, 0x00, 0x82, 0xa4, 0x00, 0xfe,
+  0xf7, 0x09, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x07, 0x3a, 0x04, 0x83, 0x00, 0x82, 0xed, 0x1a, 0xdf, 0xe7, 0x1a, 0xfe, 0xff, 0x03, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x85, 0x9c, 0xef, 0x6d, 0x6b, 0x27,
+  0x01, 0xc4, 0x00, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x38, 0xc6, 0x0b, 0xfe, 0xff, 0x83, 0xbd, 0xf7, 0xeb, 0x52, 0xa3, 0x00, 0x03, 0x84, 0x00, 0x83, 0x86, 0x29, 0x3c, 0xe7,
+  0xff, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x9a, 0xce, 0x06, 0xa4, 0x00, 0x02, 0x83, 0x00, 0x82, 0xc4, 0x00, 0x55, 0xad, 0x04, 0xff, 0xff, 0x82, 0x1b, 0xdf, 0xc8, 0x31, 0x02, 0xa4, 0x00, 0x84, 0xc4,
+  0x00, 0xc5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xae, 0x6b, 0x03, 0xfe, 0xff, 0x95, 0xba, 0xef, 0x68, 0xdc, 0x65, 0x74, 0x0a, 0x8d, 0x4d, 0x95, 0x8c, 0x9d, 0xa7, 0x95, 0x60,
+  0x4d, 0xf2, 0xc6, 0xb1, 0xc6, 0x6f, 0xae, 0x0a, 0x9e, 0x2e, 0xae, 0x92, 0xbe, 0x56, 0xdf, 0x53, 0xd7, 0x2d, 0xa6, 0x09, 0x8d, 0x80, 0x4b, 0x20, 0x7b, 0x3a, 0xe7, 0x03, 0xfe, 0xff, 0x81, 0x79,
+  0xce, 0x03, 0x83, 0x00, 0x82, 0xc4, 0x00, 0xfe, 0xf7, 0x08, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0xd9, 0xd6, 0x04, 0x83, 0x00, 0x82, 0xe4, 0x00, 0x5e, 0xcf, 0x1c, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x05,
+  0xfe, 0xff, 0x83, 0xba, 0xce, 0xc8, 0x01, 0xc4, 0x00, 0x03, 0x84, 0x00, 0x83, 0xa4, 0x00, 0xe5, 0x10, 0x3c, 0xe7, 0x07, 0xfe, 0xff, 0x85, 0xfd, 0xff, 0xfe, 0xff, 0xde, 0xf7, 0x6d, 0x6b, 0xa4,
+  0x00, 0x03, 0x84, 0x00, 0x82, 0x05, 0x19, 0xfb, 0xde, 0x02, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x5c, 0xe7, 0x46, 0x19, 0x04, 0xa4, 0x00, 0x81, 0xa3, 0x00, 0x04, 0x83, 0x00, 0x83, 0xa4, 0x00, 0x6e,
+  0x6b, 0x7d, 0xef, 0x03, 0xff, 0xff, 0x82, 0x5c, 0xe7, 0xe5, 0x08, 0x07, 0xa4, 0x00, 0x99, 0x08, 0x3a, 0x9d, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0xb5, 0xac, 0xec, 0xd1, 0xc0, 0x4c, 0xe0,
+  0x53, 0x86, 0x74, 0xa7, 0x95, 0xa0, 0x64, 0xe0, 0x4c, 0x63, 0x8d, 0x68, 0xcf, 0xf4, 0xce, 0x12, 0xcf, 0x35, 0xd7, 0x73, 0xdf, 0xcc, 0xdf, 0x12, 0xcf, 0xa9, 0xae, 0x00, 0x65, 0x60, 0x83, 0x9b,
+  0xf7, 0x04, 0xfe, 0xff, 0x82, 0x79, 0xce, 0x83, 0x00, 0x02, 0x84, 0x00, 0x83, 0xc4, 0x00, 0xdf, 0xf7, 0xff, 0xff, 0x07, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0xf3, 0x9c, 0x04, 0x83, 0x00, 0x82, 0xd0,
+  0x63, 0xff, 0xff, 0x02, 0xde, 0xff, 0x21, 0xfe, 0xff, 0x83, 0x7d, 0xef, 0xc8, 0x11, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x83, 0xa4, 0x00, 0x8f, 0x6b, 0xff, 0xff, 0x06, 0xfe, 0xff, 0x84, 0xfd, 0xff,
+  0xfe, 0xff, 0x10, 0x7c, 0x83, 0x00, 0x03, 0x84, 0x00, 0x82, 0xa4, 0x00, 0x79, 0xce, 0x02, 0xff, 0xff, 0x83, 0xfe, 0xff, 0xbd, 0xf7, 0x49, 0x42, 0x04, 0xa4, 0x00, 0x83, 0xa3, 0x00, 0x69, 0x01,
+  0xc6, 0x00, 0x03, 0x63, 0x00, 0x02, 0xa4, 0x00, 0x87, 0x66, 0x29, 0x9a, 0xce, 0xff, 0xff, 0xfe, 0xff, 0x1b, 0xdf, 0x6b, 0x01, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x82, 0x45, 0x19, 0x3b, 0xdf, 0x03,
+  0xfe, 0xff, 0x94, 0x29, 0xac, 0xcc, 0x81, 0x0f, 0xd0, 0xe0, 0x5b, 0x20, 0x53, 0xe0, 0x5b, 0x8d, 0x9d, 0x05, 0x64, 0xa7, 0x74, 0x6c, 0x95, 0x91, 0xc4, 0x99, 0xf4, 0xb5, 0xe7, 0x55, 0xd7, 0xb6,
+  0xe7, 0x17, 0xff, 0xb6, 0xfe, 0x4b, 0xe7, 0x20, 0xa3, 0x19, 0xe7, 0x03, 0xfe, 0xff, 0x82, 0xbe, 0xf7, 0x92, 0x8c, 0x03, 0xa4, 0x00, 0x85, 0x84, 0x00, 0x83, 0x00, 0x8b, 0x4a, 0xba, 0xd6, 0xff,
+  0xff, 0x06, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x0c, 0x5b, 0x04, 0x83, 0x00, 0x83, 0xdb, 0xce, 0xfe, 0xff, 0xde, 0xff, 0x23, 0xfe, 0xff, 0x82, 0x9d, 0xf7, 0x04, 0x01, 0x05, 0x84, 0x00, 0x81, 0x79,
+  0xce, 0x07, 0xfe, 0xff, 0x87, 0x99, 0xd6, 0x63, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x83, 0x00, 0x63, 0x00, 0xf7, 0xbd, 0x02, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xae, 0x6b, 0x05, 0xa4, 0x00, 0x84,
+  0x53, 0xad, 0xfb, 0xd6, 0xef, 0x09, 0xe8, 0x00, 0x02, 0x63, 0x00, 0x03, 0xa4, 0x00, 0x8c, 0x84, 0x00, 0xf3, 0x9c, 0x9e, 0xef, 0x2d, 0x2a, 0xee, 0x01, 0xce, 0x01, 0xc5, 0x00, 0x83, 0x00, 0x84,
+  0x00, 0xa4, 0x00, 0x83, 0x00, 0x79, 0xc6, 0x03, 0xfe, 0xff, 0x95, 0xf0, 0xbd, 0xe2, 0x9a, 0x46, 0x88, 0x28, 0x01, 0x80, 0x53, 0xa0, 0x4b, 0xa0, 0x53, 0x60, 0x53, 0xe0, 0x74, 0x20, 0x5c, 0x0e,
+  0x9e, 0xd5, 0xd6, 0xb3, 0xde, 0xf7, 0xef, 0x56, 0xe7, 0x57, 0xef, 0xd5, 0xee, 0xb4, 0xee, 0x05, 0xee, 0xc7, 0xd4, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x82, 0xbd, 0xf7, 0x0c, 0x5b, 0x02, 0xc4, 0x00,
+  0x03, 0xa4, 0x00, 0x03, 0x83, 0x00, 0x82, 0x14, 0x9d, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x45, 0x19, 0x03, 0x83, 0x00, 0x82, 0x04, 0x11, 0xff, 0xff, 0x26, 0xfe, 0xff, 0x81, 0x3b, 0xe7, 0x02,
+  0x83, 0x00, 0x03, 0x84, 0x00, 0x82, 0x28, 0x3a, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x87, 0x91, 0x94, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x54, 0xa5, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x83,
+  0x13, 0x9d, 0xa4, 0x00, 0xa5, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xf2, 0x94, 0x02, 0xfe, 0xff, 0x83, 0x9e, 0xef, 0x95, 0x8c, 0x29, 0x01, 0x03, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x85, 0x67, 0x21, 0xcc,
+  0x01, 0xef, 0x01, 0xad, 0x01, 0xa5, 0x00, 0x03, 0x83, 0x00, 0x81, 0x54, 0xa5, 0x03, 0xfe, 0xff, 0x95, 0x39, 0xef, 0x43, 0x53, 0xe3, 0x81, 0xea, 0x82, 0x85, 0x3a, 0x64, 0x5b, 0xc4, 0x5b, 0x8a,
+  0x7c, 0xc4, 0x5b, 0xc6, 0x63, 0x00, 0x5c, 0x08, 0x7d, 0x50, 0xcf, 0x55, 0xd7, 0x97, 0xe7, 0x57, 0xf7, 0xb6, 0xfe, 0xf1, 0xde, 0x50, 0xb6, 0x65, 0xdc, 0xdd, 0xff, 0x03, 0xfe, 0xff, 0x83, 0x2c,
+  0x63, 0xc4, 0x00, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x05, 0xa4, 0x00, 0x83, 0x84, 0x00, 0xf4, 0x9c, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x02, 0x83, 0x00, 0x82, 0xa3, 0x00,
+  0x25, 0x19, 0x28, 0xfe, 0xff, 0x82, 0x37, 0xc6, 0x63, 0x00, 0x04, 0x84, 0x00, 0x81, 0x58, 0xc6, 0x06, 0xfe, 0xff, 0x85, 0x49, 0x42, 0x83, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x0c, 0x5b, 0x04, 0xfe,
+  0xff, 0x81, 0x38, 0xc6, 0x05, 0xa4, 0x00, 0x82, 0xef, 0x7b, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x83, 0xbe, 0xf7, 0x28, 0x09, 0xc6, 0x00, 0x02, 0x83, 0x00, 0x04, 0xa4, 0x00, 0x83, 0xe5, 0x00, 0xac,
+  0x01, 0xc6, 0x00, 0x03, 0x83, 0x00, 0x81, 0x30, 0x84, 0x03, 0xfe, 0xff, 0x95, 0xbb, 0xff, 0xe4, 0x82, 0xe6, 0x31, 0xa4, 0x28, 0x4b, 0x63, 0x40, 0x53, 0x68, 0x7c, 0x27, 0x74, 0x44, 0x53, 0x40,
+  0x53, 0x82, 0x5b, 0x2b, 0x85, 0x45, 0x65, 0x2f, 0xc7, 0x54, 0xd7, 0xb7, 0xe7, 0x77, 0xe7, 0x57, 0xef, 0xd0, 0xce, 0xe9, 0x95, 0x34, 0xe6, 0x03, 0xfe, 0xff, 0x82, 0x75, 0xad, 0xa3, 0x00, 0x03,
+  0xa4, 0x00, 0x86, 0x07, 0x32, 0x91, 0x8c, 0x10, 0x7c, 0x05, 0x11, 0xa4, 0x00, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x78, 0xce, 0x04, 0xfe, 0xff, 0x86, 0xff, 0xff, 0x05, 0x11, 0x83, 0x00, 0xa4,
+  0x00, 0xa3, 0x00, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xdd, 0xf7, 0x03, 0xfa, 0xde, 0x04, 0x1b, 0xe7, 0x88, 0x3b, 0xe7, 0x3c, 0xe7, 0x5c, 0xe7, 0x5c, 0xef, 0x7d, 0xef, 0xbe, 0xf7, 0xfe, 0xff,
+  0xff, 0xff, 0x0f, 0xfe, 0xff, 0x81, 0xa9, 0x52, 0x04, 0x84, 0x00, 0x82, 0x6d, 0x6b, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x86, 0x08, 0x3a, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xba, 0xd6,
+  0x02, 0xfe, 0xff, 0x82, 0xda, 0xd6, 0x05, 0x11, 0x04, 0xa4, 0x00, 0x83, 0xae, 0x73, 0xde, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x82, 0x10, 0x7c, 0xe7, 0x00, 0x02, 0xe6, 0x00, 0x02, 0xa4, 0x00,
+  0x81, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x81, 0xa4, 0x00, 0x02, 0x83, 0x00, 0x83, 0x2c, 0x5b, 0xde, 0xff, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x95, 0xef, 0xcc, 0x25, 0x59, 0xc0, 0x00,
+  0x20, 0x3b, 0x49, 0x74, 0x23, 0x32, 0x49, 0x74, 0x65, 0x5b, 0xe0, 0x3a, 0x40, 0x4b, 0x20, 0x53, 0x86, 0x95, 0xb2, 0xc6, 0x34, 0xd7, 0x54, 0xd7, 0xd6, 0xe7, 0xf7, 0xef, 0xd7, 0xef, 0xd1, 0xe7,
+  0x0e, 0xc7, 0xbe, 0xff, 0x02, 0xfe, 0xff, 0x83, 0xbd, 0xf7, 0x05, 0x19, 0xa3, 0x00, 0x02, 0xa4, 0x00, 0x86, 0x91, 0x8c, 0xdd, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xaa, 0x4a, 0x03, 0xa4,
+  0x00, 0x81, 0x49, 0x42, 0x04, 0xfe, 0xff, 0x86, 0xff, 0xff, 0x05, 0x11, 0x83, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x58, 0xce, 0x04, 0xa4, 0x00, 0x82, 0xc4, 0x00,
+  0xc5, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x84, 0x63, 0x00, 0x26, 0x19, 0x10, 0x7c, 0x9a, 0xce, 0x02, 0xff, 0xff, 0x0c, 0xfe, 0xff, 0x83, 0x3b, 0xe7, 0x83, 0x00, 0xa4,
+  0x00, 0x02, 0x84, 0x00, 0x82, 0xa3, 0x00, 0x9d, 0xf7, 0x05, 0xfe, 0xff, 0x89, 0x6d, 0x6b, 0x63, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x04, 0x19, 0x78, 0xce, 0x5b, 0xe7, 0x46, 0x19, 0x04,
+  0xa4, 0x00, 0x82, 0xaa, 0x52, 0xbd, 0xf7, 0x04, 0xfe, 0xff, 0x8a, 0x71, 0x8c, 0xc6, 0x00, 0xe7, 0x00, 0xc6, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x02,
+  0xc5, 0x00, 0x02, 0xc4, 0x00, 0x83, 0x28, 0x3a, 0x9d, 0xef, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x91, 0x52, 0xb6, 0x40, 0xab, 0x80, 0x61, 0x40, 0x11, 0x00, 0x64, 0x68, 0x7c, 0x85, 0x11, 0x2a, 0x74,
+  0xa8, 0x7c, 0x80, 0x6c, 0x60, 0x53, 0xc0, 0x64, 0xa5, 0x74, 0x30, 0xb6, 0x74, 0xd7, 0xd6, 0xef, 0xd7, 0xef, 0x03, 0xf5, 0xef, 0x81, 0xec, 0x85, 0x03, 0xfe, 0xff, 0x87, 0x79, 0xce, 0x83, 0x00,
+  0xa3, 0x00, 0xa4, 0x00, 0x49, 0x42, 0xde, 0xff, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x81, 0xfb, 0xde, 0x04, 0xa4, 0x00, 0x81, 0x9d, 0xf7, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x05, 0x11, 0x03, 0xa4,
+  0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x83, 0x38, 0xc6, 0x84, 0x00, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x03, 0xc4, 0x00, 0x06, 0xa4, 0x00, 0x84, 0x84, 0x00, 0xec, 0x5a, 0xdb,
+  0xd6, 0xff, 0xff, 0x0c, 0xfe, 0xff, 0x82, 0x49, 0x42, 0x84, 0x00, 0x03, 0x83, 0x00, 0x81, 0x18, 0xc6, 0x05, 0xfe, 0xff, 0x84, 0x74, 0xad, 0x63, 0x00, 0x83, 0x00, 0x84, 0x00, 0x03, 0xa4, 0x00,
+  0x83, 0xc7, 0x29, 0xc5, 0x00, 0xa5, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xe4, 0x10, 0x3b, 0xe7, 0x04, 0xfe, 0xff, 0x82, 0xf2, 0x94, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x02, 0xe7, 0x00, 0x02, 0x06, 0x01,
+  0x06, 0xc4, 0x00, 0x83, 0xa7, 0x21, 0x1c, 0xe7, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x82, 0x19, 0xf7, 0x88, 0x63, 0x02, 0x64, 0x53, 0x93, 0x80, 0x5b, 0x00, 0x4b, 0xa2, 0x5c, 0x44, 0x5c, 0x20, 0x64,
+  0xe8, 0x73, 0x28, 0x6c, 0xe3, 0x5b, 0x88, 0x7d, 0x4f, 0xae, 0xd2, 0xc6, 0x30, 0xcf, 0xb4, 0xe7, 0xf4, 0xef, 0xf5, 0xef, 0xf7, 0xef, 0x79, 0xf7, 0x98, 0xa6, 0xbd, 0xef, 0x02, 0xfe, 0xff, 0x87,
+  0x54, 0xa5, 0x84, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xd3, 0x94, 0xff, 0xff, 0xfe, 0xff, 0x04, 0xff, 0xff, 0x81, 0x05, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x3b, 0xe7, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff,
+  0x05, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0x37, 0xc6, 0x84, 0x00, 0x0e, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x81, 0xf7, 0xbd, 0x02, 0xff, 0xff, 0x0a, 0xfe, 0xff, 0x81,
+  0xd7, 0xbd, 0x04, 0x83, 0x00, 0x81, 0x91, 0x8c, 0x05, 0xfe, 0xff, 0x82, 0x5c, 0xe7, 0x63, 0x00, 0x02, 0x83, 0x00, 0x81, 0xa4, 0x00, 0x04, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x83, 0x00, 0x38,
+  0xc6, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x82, 0x74, 0xad, 0xc6, 0x00, 0x05, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x82, 0xe5, 0x00, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x82, 0x99, 0xce, 0xfe,
+  0xff, 0x02, 0xfd, 0xff, 0x98, 0x9c, 0xff, 0x48, 0x53, 0xe0, 0x42, 0x60, 0x53, 0x80, 0x4b, 0xe5, 0x5b, 0x80, 0x4b, 0x25, 0x64, 0x68, 0x6c, 0x4c, 0x95, 0x25, 0x6c, 0x86, 0x7c, 0x0d, 0xae, 0xca,
+  0x9d, 0x31, 0xcf, 0xb3, 0xc6, 0xee, 0xbe, 0x33, 0xd7, 0xd2, 0xdf, 0xf4, 0xef, 0xd5, 0xf7, 0x38, 0xff, 0x12, 0x7c, 0x17, 0xbe, 0x02, 0xfe, 0xff, 0x81, 0xd2, 0x9c, 0x02, 0xa4, 0x00, 0x82, 0xa3,
+  0x00, 0xb3, 0x94, 0x02, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x82, 0xdf, 0xf7, 0xe5, 0x10, 0x03, 0xa4, 0x00, 0x81, 0x5b, 0xef, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x11, 0x03, 0xa4, 0x00, 0x81,
+  0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xc6, 0x04, 0xa4, 0x00, 0x05, 0x83, 0x00, 0x02, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x85, 0x84, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x9a, 0xce, 0xff, 0xff, 0x0a,
+  0xfe, 0xff, 0x81, 0x5c, 0xef, 0x03, 0x83, 0x00, 0x82, 0x63, 0x00, 0x8a, 0x4a, 0x06, 0xfe, 0xff, 0x84, 0xd7, 0xbd, 0x63, 0x00, 0x83, 0x00, 0xa4, 0x00, 0x04, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x81,
+  0x54, 0xa5, 0x02, 0xfe, 0xff, 0x84, 0xfd, 0xff, 0xfe, 0xff, 0x58, 0xc6, 0xa6, 0x00, 0x02, 0xc6, 0x00, 0x04, 0xe6, 0x00, 0x82, 0x06, 0x01, 0xe5, 0x00, 0x02, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0xa6,
+  0xc4, 0x00, 0xf6, 0xb5, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xdd, 0xff, 0xf6, 0xcd, 0x40, 0x6d, 0x00, 0x75, 0xc5, 0x63, 0xe0, 0x5b, 0x00, 0x4b, 0xc0, 0x5b, 0xa0, 0x4b, 0x65, 0x64, 0x20, 0x6c,
+  0xad, 0x9d, 0xa5, 0x9b, 0xd2, 0xd5, 0x92, 0xd7, 0xd3, 0xe7, 0xd2, 0xe7, 0x54, 0xd7, 0x15, 0xd7, 0x32, 0xcf, 0xf3, 0xef, 0xf7, 0xef, 0x73, 0xa5, 0xc4, 0x08, 0xf4, 0x9c, 0xff, 0xff, 0xfe, 0xff,
+  0xb6, 0xb5, 0x84, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x66, 0x21, 0x9d, 0xef, 0x04, 0xff, 0xff, 0x81, 0xf7, 0xb5, 0x03, 0xa4, 0x00, 0x82, 0xa3, 0x00, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff,
+  0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xc6, 0x04, 0xa4, 0x00, 0x84, 0xd1, 0x6b, 0x0f, 0x53, 0x2c, 0x32, 0x2a, 0x09, 0x02, 0xe9, 0x00, 0x86, 0x29, 0x01,
+  0x28, 0x01, 0x27, 0x01, 0xa4, 0x00, 0x83, 0x00, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x83, 0x00, 0xc8, 0x31, 0xbe, 0xf7, 0x0b, 0xfe, 0xff, 0x81, 0x25, 0x19, 0x03, 0x83, 0x00, 0x82, 0x63, 0x00,
+  0xdd, 0xff, 0x06, 0xfe, 0xff, 0x83, 0x18, 0xbe, 0x45, 0x19, 0xa4, 0x00, 0x04, 0xc4, 0x00, 0x82, 0xa4, 0x00, 0x50, 0x8c, 0x04, 0xfe, 0xff, 0x83, 0xba, 0xd6, 0xc6, 0x00, 0xa6, 0x00, 0x04, 0xc6,
+  0x00, 0x03, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x82, 0x34, 0xa5, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x9d, 0x9b, 0xff, 0x13, 0xcf, 0xed, 0xa5, 0xaa, 0x95, 0x20, 0x53, 0xc0, 0x5b, 0x80, 0x5b, 0xc0, 0x54,
+  0x60, 0x4c, 0x05, 0x6c, 0xa5, 0x6c, 0x26, 0x75, 0xd1, 0xdd, 0x34, 0xee, 0x53, 0xd7, 0x74, 0xd7, 0x51, 0xcf, 0xad, 0xae, 0x2e, 0xae, 0xf0, 0xad, 0x6d, 0xb6, 0xf7, 0xd6, 0xa7, 0x29, 0xa3, 0x00,
+  0x8a, 0x4a, 0xff, 0xff, 0xfe, 0xff, 0x3b, 0xe7, 0x83, 0x00, 0x03, 0x84, 0x00, 0x86, 0x28, 0x3a, 0xba, 0xd6, 0xde, 0xff, 0xbd, 0xf7, 0x38, 0xc6, 0x45, 0x19, 0x03, 0xa4, 0x00, 0x81, 0xf3, 0x9c,
+  0x04, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xbe, 0x03, 0xa4, 0x00, 0x92, 0x84, 0x00, 0x19, 0xb6, 0x9e, 0xbe, 0xb3, 0x01,
+  0xf1, 0x01, 0x51, 0x02, 0x53, 0x02, 0xb2, 0x02, 0xb1, 0x02, 0x10, 0x03, 0xd0, 0x02, 0x06, 0x01, 0x83, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xf7, 0xbd, 0x0b, 0xfe, 0xff, 0x82,
+  0x8a, 0x4a, 0x63, 0x00, 0x02, 0x83, 0x00, 0x82, 0x84, 0x00, 0xbd, 0xf7, 0x07, 0xfe, 0xff, 0x83, 0x3c, 0xdf, 0xc5, 0x08, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x82, 0xa4, 0x00, 0xae, 0x73, 0x04, 0xfe,
+  0xff, 0x86, 0x5b, 0xe7, 0xc5, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0x03, 0xc6, 0x00, 0x81, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x81, 0xb2, 0x8c, 0x04, 0xfe, 0xff, 0x9b, 0xfd, 0xff,
+  0xda, 0xf7, 0xb6, 0xe7, 0xeb, 0x8d, 0x40, 0x4d, 0x69, 0x7d, 0x8b, 0x85, 0xab, 0x95, 0xc2, 0x6c, 0x00, 0x5c, 0x8c, 0x8d, 0x80, 0x53, 0xe5, 0x6c, 0x4f, 0xae, 0x90, 0xb6, 0x0c, 0x96, 0x54, 0xd7,
+  0xb5, 0xe7, 0x13, 0xcf, 0xcf, 0xbe, 0xa8, 0x85, 0x0a, 0xbe, 0xab, 0x4a, 0x63, 0x00, 0x83, 0x00, 0xa3, 0x00, 0x5c, 0xef, 0x02, 0xfe, 0xff, 0x82, 0xae, 0x73, 0x84, 0x00, 0x04, 0xa4, 0x00, 0x82,
+  0x43, 0x00, 0x63, 0x00, 0x04, 0xa4, 0x00, 0x82, 0x46, 0x19, 0x9d, 0xef, 0x04, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xbe,
+  0x04, 0xa4, 0x00, 0x81, 0xda, 0xd6, 0x07, 0xfe, 0xff, 0x84, 0xdd, 0xff, 0x3b, 0xe7, 0xb1, 0x4b, 0x47, 0x09, 0x04, 0xa4, 0x00, 0x82, 0x2c, 0x5b, 0xff, 0xff, 0x0a, 0xfe, 0xff, 0x82, 0x50, 0x84,
+  0x63, 0x00, 0x03, 0x83, 0x00, 0x81, 0x7c, 0xef, 0x07, 0xfe, 0xff, 0x87, 0xdb, 0xd6, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x29, 0x42, 0x9e, 0xf7, 0x03, 0xfe, 0xff, 0x83, 0x9c, 0xef,
+  0xa7, 0x29, 0xa6, 0x00, 0x05, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x10, 0x7c, 0x03, 0xfe, 0xff, 0x99, 0x14, 0x9d, 0x9f, 0xef, 0xff, 0xef, 0xfc,
+  0xef, 0xf5, 0xef, 0xeb, 0xb6, 0x0b, 0x96, 0xed, 0xa5, 0xac, 0x95, 0x25, 0x65, 0xcb, 0x85, 0x40, 0x85, 0x20, 0x64, 0xc0, 0x53, 0xc6, 0x64, 0x6c, 0x95, 0x51, 0xcf, 0xb2, 0xbe, 0xee, 0xbe, 0x91,
+  0xdf, 0xe2, 0xdf, 0x4c, 0x9e, 0xdb, 0xb5, 0x14, 0x7d, 0x05, 0x11, 0x02, 0x83, 0x00, 0x82, 0x63, 0x00, 0xd2, 0x94, 0x02, 0xfe, 0xff, 0x83, 0x9d, 0xef, 0xa7, 0x31, 0x84, 0x00, 0x08, 0xa4, 0x00,
+  0x83, 0xe5, 0x08, 0xba, 0xce, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x81, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xc6, 0x04, 0xa4, 0x00, 0x81, 0xdb, 0xde, 0x07,
+  0xfe, 0xff, 0x85, 0xfd, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xf7, 0xb5, 0xc5, 0x00, 0x03, 0xa4, 0x00, 0x82, 0xa3, 0x00, 0xde, 0xff, 0x0a, 0xfe, 0xff, 0x81, 0xd3, 0x94, 0x02, 0x83, 0x00, 0x83, 0x84,
+  0x00, 0xa3, 0x00, 0x5b, 0xef, 0x04, 0xfe, 0xff, 0x84, 0xfd, 0xff, 0xfe, 0xff, 0x1b, 0xdf, 0x86, 0x21, 0x03, 0xa4, 0x00, 0x82, 0x05, 0x19, 0x3b, 0xe7, 0x02, 0xfe, 0xff, 0x83, 0xfd, 0xff, 0xfe,
+  0xff, 0x6d, 0x63, 0x02, 0xa6, 0x00, 0x04, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x82, 0x2c, 0x5b, 0xde, 0xf7, 0x02, 0xfe, 0xff, 0x99, 0x13, 0x9d, 0x84, 0x00, 0x93,
+  0x84, 0xbf, 0xe7, 0xfc, 0xf7, 0xf5, 0xef, 0x2f, 0xcf, 0xed, 0xbe, 0x2e, 0xae, 0x70, 0xb6, 0x4f, 0xae, 0x4f, 0xb6, 0xe0, 0x74, 0x00, 0x6d, 0x4e, 0x9d, 0xa5, 0x74, 0x4a, 0xa6, 0xa2, 0x6c, 0x4e,
+  0xa6, 0x33, 0xd7, 0x2e, 0xcf, 0xe2, 0xdf, 0x4d, 0xdf, 0x75, 0x9c, 0x46, 0x21, 0x04, 0x83, 0x00, 0x82, 0xa3, 0x00, 0x5c, 0xef, 0x02, 0xfe, 0xff, 0x83, 0x5b, 0xe7, 0x28, 0x42, 0x84, 0x00, 0x06,
+  0xa4, 0x00, 0x83, 0xc8, 0x29, 0xda, 0xd6, 0xdf, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xc6, 0x04, 0xa4, 0x00, 0x81, 0xfb,
+  0xde, 0x0b, 0xfe, 0xff, 0x81, 0x30, 0x7c, 0x04, 0xa4, 0x00, 0x81, 0x7d, 0xef, 0x0a, 0xfe, 0xff, 0x82, 0xf3, 0x9c, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x81, 0x3b, 0xe7, 0x04, 0xfe, 0xff, 0x83, 0xfd,
+  0xff, 0x7c, 0xef, 0x86, 0x29, 0x03, 0xa4, 0x00, 0x82, 0xa3, 0x00, 0x58, 0xce, 0x04, 0xfe, 0xff, 0x83, 0x54, 0xa5, 0xc6, 0x00, 0xa6, 0x00, 0x05, 0xc6, 0x00, 0x83, 0xe6, 0x00, 0xc5, 0x00, 0xc4,
+  0x00, 0x03, 0xa4, 0x00, 0x82, 0x6a, 0x42, 0x9d, 0xef, 0x02, 0xfe, 0xff, 0x81, 0xf6, 0xbd, 0x02, 0xa4, 0x00, 0x96, 0x26, 0x19, 0xfe, 0xd6, 0xbc, 0xff, 0xf7, 0xf7, 0x55, 0xdf, 0xd4, 0xe7, 0x13,
+  0xcf, 0x32, 0xcf, 0x12, 0xcf, 0x93, 0xdf, 0xd2, 0xc6, 0xcb, 0x9d, 0x24, 0x6c, 0xc0, 0x53, 0xc8, 0x7c, 0x07, 0x85, 0x71, 0xbe, 0xed, 0xa5, 0xe8, 0xbe, 0xe2, 0xdf, 0x29, 0xe7, 0x11, 0x8c, 0x05,
+  0x83, 0x00, 0x83, 0xc5, 0x00, 0x4d, 0x63, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x83, 0xdd, 0xf7, 0x95, 0xad, 0x49, 0x42, 0x04, 0xa4, 0x00, 0x82, 0xd7, 0xb5, 0xbe, 0xf7, 0x08, 0xfe, 0xff, 0x81, 0x46,
+  0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0x17, 0xbe, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xfb, 0xde, 0x0b, 0xfe, 0xff, 0x82, 0xb3, 0x94, 0xc4, 0x00, 0x03, 0xa4, 0x00,
+  0x81, 0x7c, 0xf7, 0x0a, 0xfe, 0xff, 0x82, 0xb2, 0x94, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x81, 0x3b, 0xe7, 0x04, 0xfe, 0xff, 0x82, 0xdd, 0xff, 0xeb, 0x5a, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x81,
+  0x34, 0x9d, 0x04, 0xfe, 0xff, 0x81, 0x99, 0xce, 0x05, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x81, 0xc5, 0x00, 0x02, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x86, 0x66, 0x21, 0x3c, 0xe7, 0xff, 0xff, 0xfe, 0xff,
+  0x1b, 0xdf, 0xc4, 0x08, 0x02, 0xa4, 0x00, 0x97, 0x84, 0x00, 0x0d, 0x53, 0x7e, 0xe7, 0xfc, 0xf7, 0x35, 0xd7, 0x75, 0xdf, 0x8f, 0xd7, 0x90, 0xd7, 0x53, 0xd7, 0xd3, 0xc6, 0x83, 0x8d, 0x8a, 0x9e,
+  0xc2, 0x63, 0x84, 0x5c, 0xe4, 0x5c, 0x6a, 0x95, 0x8f, 0xbe, 0x20, 0x64, 0xc8, 0x9d, 0xcd, 0xed, 0x97, 0xdf, 0x4a, 0x42, 0x84, 0x00, 0x04, 0x83, 0x00, 0x84, 0xe5, 0x00, 0xc5, 0x00, 0x92, 0x8c,
+  0xde, 0xff, 0x03, 0xfe, 0xff, 0x82, 0x1a, 0xdf, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xde, 0xff, 0x09, 0xfe, 0xff, 0x81, 0x46, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81,
+  0x17, 0xbe, 0x04, 0xa4, 0x00, 0x81, 0x1b, 0xdf, 0x0b, 0xfe, 0xff, 0x81, 0x8a, 0x4a, 0x03, 0xa4, 0x00, 0x81, 0xc4, 0x08, 0x0b, 0xfe, 0xff, 0x81, 0x6d, 0x63, 0x04, 0xa4, 0x00, 0x81, 0x9c, 0xf7,
+  0x02, 0xfe, 0xff, 0x83, 0xfd, 0xff, 0xfe, 0xff, 0xd2, 0x9c, 0x03, 0x84, 0x00, 0x83, 0x83, 0x00, 0xae, 0x73, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x81, 0x5b, 0xe7, 0x04, 0xa6, 0x00, 0x81, 0xc6, 0x00,
+  0x03, 0xe6, 0x00, 0x81, 0xe5, 0x00, 0x03, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x85, 0xb9, 0xce, 0xff, 0xff, 0xfe, 0xff, 0xbc, 0xf7, 0x09, 0x3a, 0x04, 0xa4, 0x00, 0x95, 0xc5, 0x00, 0x1a, 0xa6, 0xfc,
+  0xe7, 0xf4, 0xef, 0xaf, 0xdf, 0x70, 0xcf, 0x88, 0xc7, 0xf1, 0xe7, 0x29, 0xc7, 0x08, 0xa6, 0xea, 0x95, 0x40, 0x6d, 0xea, 0x95, 0x66, 0x6d, 0xe0, 0x74, 0x20, 0x4d, 0x48, 0x75, 0xca, 0xa5, 0x31,
+  0xf5, 0x12, 0x95, 0xa4, 0x00, 0x04, 0x83, 0x00, 0x81, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x83, 0xc4, 0x00, 0xcf, 0x7b, 0x9d, 0xef, 0x02, 0xfe, 0xff, 0x82, 0xda, 0xde, 0x83, 0x00, 0x03, 0xa4, 0x00,
+  0x04, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x46, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xf7, 0xbd, 0x02, 0xc4, 0x00,
+  0x02, 0xa4, 0x00, 0x81, 0x3c, 0xe7, 0x0a, 0xfe, 0xff, 0x82, 0x17, 0xbe, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0x50, 0x8c, 0x0b, 0xfe, 0xff, 0x81, 0xe8, 0x39, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x00,
+  0xa3, 0x00, 0x02, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x82, 0x98, 0xce, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x83, 0x83, 0x00, 0x8a, 0x4a, 0xbd, 0xf7, 0x03, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x2c, 0x63, 0x04,
+  0xc6, 0x00, 0x03, 0xe6, 0x00, 0x81, 0xe5, 0x00, 0x05, 0xa4, 0x00, 0x81, 0x17, 0xbe, 0x02, 0xfe, 0xff, 0x84, 0xdd, 0xff, 0x2c, 0x63, 0xe7, 0x00, 0xc5, 0x00, 0x04, 0x84, 0x00, 0x94, 0xab, 0x3a,
+  0x9e, 0xbf, 0xf6, 0xef, 0xf5, 0xef, 0xf7, 0xef, 0x95, 0xe7, 0x76, 0xdf, 0x74, 0xdf, 0x47, 0xc7, 0xb0, 0xb6, 0x49, 0x9e, 0xef, 0xc6, 0x66, 0x9e, 0x94, 0xdf, 0x86, 0x9e, 0xaa, 0xa5, 0xe9, 0xcc,
+  0xd6, 0xf5, 0x6a, 0x42, 0x84, 0x00, 0x03, 0x83, 0x00, 0x81, 0x84, 0x00, 0x04, 0xc5, 0x00, 0x86, 0x84, 0x00, 0xe5, 0x08, 0x3c, 0xe7, 0xfe, 0xff, 0x78, 0xce, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x04,
+  0xfe, 0xff, 0x82, 0xfd, 0xff, 0xfe, 0xff, 0x03, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0x46, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0xf7, 0xbd, 0xc4, 0x00, 0x03, 0xa4, 0x00,
+  0x81, 0x5c, 0xe7, 0x09, 0xfe, 0xff, 0x82, 0xd6, 0xb5, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x81, 0x3b, 0xe7, 0x0a, 0xfe, 0xff, 0x83, 0xbd, 0xf7, 0x83, 0x00, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x81, 0x4f,
+  0x84, 0x03, 0xfd, 0xff, 0x87, 0x5b, 0xef, 0x86, 0x29, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x05, 0x19, 0x3b, 0xe7, 0x04, 0xfe, 0xff, 0x82, 0xd2, 0x94, 0xa6, 0x00, 0x05, 0xc6, 0x00, 0x02, 0xe6,
+  0x00, 0x05, 0xa4, 0x00, 0x82, 0x54, 0xa5, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x82, 0x70, 0x84, 0xe5, 0x00, 0x02, 0xe6, 0x00, 0x82, 0x84, 0x00, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x94, 0xc5, 0x08, 0x3d,
+  0xae, 0xf5, 0xef, 0xf6, 0xef, 0xb7, 0xe7, 0xd5, 0xef, 0xf9, 0xf7, 0x53, 0xd7, 0x68, 0xcf, 0x50, 0xb6, 0x4e, 0xcf, 0x2f, 0xcf, 0xec, 0xdf, 0x55, 0xdf, 0x09, 0xb7, 0x68, 0x9c, 0x30, 0xe5, 0x16,
+  0xce, 0xe4, 0x10, 0xa4, 0x00, 0x03, 0x83, 0x00, 0x81, 0xa5, 0x00, 0x05, 0xc5, 0x00, 0x84, 0xe5, 0x00, 0x3c, 0xe7, 0xfe, 0xff, 0x37, 0xc6, 0x04, 0xa4, 0x00, 0x05, 0xfe, 0xff, 0x03, 0xfd, 0xff,
+  0x83, 0xdd, 0xff, 0xfe, 0xff, 0x46, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0xf7, 0xbd, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x85, 0x4c, 0x5b, 0x4c, 0x63, 0x6c, 0x63, 0x8d,
+  0x6b, 0xae, 0x73, 0x03, 0xce, 0x73, 0x82, 0xae, 0x6b, 0x66, 0x21, 0x05, 0xa4, 0x00, 0x82, 0x92, 0x94, 0xff, 0xff, 0x0a, 0xfe, 0xff, 0x81, 0xba, 0xd6, 0x02, 0xa4, 0x00, 0x83, 0xc4, 0x00, 0xa4,
+  0x00, 0xb9, 0xd6, 0x02, 0xfd, 0xff, 0x82, 0xdd, 0xf7, 0xcb, 0x5a, 0x03, 0xa4, 0x00, 0x82, 0x83, 0x00, 0x37, 0xbe, 0x04, 0xfe, 0xff, 0x81, 0xd6, 0xb5, 0x06, 0xc6, 0x00, 0x83, 0xc5, 0x00, 0xe6,
+  0x00, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x81, 0x51, 0x84, 0x03, 0xfe, 0xff, 0x81, 0x95, 0xad, 0x02, 0xe6, 0x00, 0x83, 0xc5, 0x00, 0xe6, 0x00, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x92, 0x83, 0x00, 0x2d,
+  0x4b, 0xfb, 0xe7, 0xf6, 0xef, 0xb6, 0xe7, 0xd7, 0xe7, 0xf6, 0xef, 0x53, 0xd7, 0x12, 0xc7, 0xa8, 0x75, 0x6e, 0xb6, 0xae, 0xbe, 0x75, 0xdf, 0xb4, 0xe7, 0x4b, 0xc7, 0x40, 0x94, 0xaf, 0xc4, 0xac,
+  0x52, 0x05, 0x83, 0x00, 0x06, 0xc5, 0x00, 0x84, 0xc6, 0x00, 0x5d, 0xe7, 0xff, 0xff, 0x17, 0xc6, 0x03, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x07, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0x46,
+  0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0xf7, 0xbd, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x82, 0x83, 0x00, 0x84, 0x00, 0x02, 0x83, 0x00, 0x81, 0x84, 0x00, 0x03, 0x83, 0x00,
+  0x04, 0xa3, 0x00, 0x83, 0xa4, 0x00, 0x49, 0x42, 0xbe, 0xf7, 0x0b, 0xfe, 0xff, 0x82, 0x92, 0x8c, 0xa5, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x70, 0x8c, 0x03, 0xfd, 0xff, 0x82, 0x0f, 0x7c, 0xa5, 0x00,
+  0x03, 0xa4, 0x00, 0x81, 0x71, 0x84, 0x04, 0xfe, 0xff, 0x82, 0x38, 0xc6, 0xa6, 0x00, 0x05, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x83, 0x84, 0x00, 0x2c, 0x5b, 0xde,
+  0xf7, 0x02, 0xfe, 0xff, 0x82, 0x38, 0xc6, 0xc5, 0x00, 0x04, 0xe6, 0x00, 0x81, 0xa5, 0x00, 0x02, 0x83, 0x00, 0x94, 0x84, 0x00, 0x83, 0x00, 0x88, 0x21, 0x1e, 0xbf, 0xf8, 0xcf, 0xf5, 0xef, 0xd4,
+  0xef, 0xf6, 0xef, 0xb5, 0xe7, 0x14, 0xd7, 0xf3, 0xc6, 0x8e, 0xb6, 0x72, 0xdf, 0x13, 0xcf, 0x51, 0xcf, 0xc1, 0xd7, 0xe0, 0xad, 0xaf, 0x93, 0xe4, 0x10, 0xa4, 0x00, 0x03, 0x83, 0x00, 0x81, 0xa4,
+  0x00, 0x06, 0xc5, 0x00, 0x84, 0xc6, 0x00, 0x7d, 0xef, 0xff, 0xff, 0x38, 0xc6, 0x03, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x07, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0x25, 0x19, 0x03, 0xa4,
+  0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0x17, 0xbe, 0xc5, 0x00, 0x06, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x83, 0x00, 0x03, 0x84, 0x00, 0x81, 0x83, 0x00, 0x04, 0xa3, 0x00, 0x82, 0xe7, 0x31,
+  0x3c, 0xe7, 0x0b, 0xfe, 0xff, 0x89, 0xbd, 0xf7, 0x06, 0x11, 0xc5, 0x00, 0xa4, 0x00, 0x6d, 0x6b, 0xdd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xd2, 0x94, 0x04, 0xa4, 0x00, 0x82, 0x6d, 0x63, 0xde, 0xf7,
+  0x03, 0xfe, 0xff, 0x84, 0xda, 0xd6, 0xa6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x03, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xc5, 0x00, 0x04, 0xa4, 0x00, 0x82, 0x86, 0x29, 0x7d, 0xef, 0x02, 0xfe, 0xff,
+  0x81, 0xba, 0xd6, 0x02, 0xc5, 0x00, 0x05, 0xe6, 0x00, 0x81, 0x84, 0x00, 0x03, 0x83, 0x00, 0x90, 0x63, 0x00, 0x73, 0x7c, 0xfa, 0xcf, 0xf3, 0xe7, 0xf5, 0xef, 0xd7, 0xef, 0x50, 0xcf, 0x8f, 0xd7,
+  0x75, 0xdf, 0xec, 0x95, 0xeb, 0x9d, 0x8e, 0xb6, 0xc9, 0xae, 0x61, 0xbf, 0x05, 0x76, 0xd3, 0x6b, 0x04, 0x83, 0x00, 0x83, 0xa4, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0x05, 0xe6, 0x00, 0x84, 0x06, 0x01,
+  0x5c, 0xef, 0xff, 0xff, 0x79, 0xce, 0x04, 0xa4, 0x00, 0x07, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x45, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0x59,
+  0xc6, 0xa5, 0x00, 0x02, 0x84, 0x00, 0x0d, 0x83, 0x00, 0x82, 0x08, 0x2a, 0x5b, 0xd7, 0x0c, 0xfe, 0xff, 0x81, 0x96, 0xad, 0x02, 0xc5, 0x00, 0x82, 0x89, 0x4a, 0x9c, 0xf7, 0x02, 0xfe, 0xff, 0x81,
+  0xf7, 0xbd, 0x04, 0xa4, 0x00, 0x82, 0x49, 0x42, 0x9d, 0xef, 0x03, 0xfe, 0xff, 0x84, 0x3c, 0xe7, 0xe7, 0x08, 0xe6, 0x00, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x83, 0xc6, 0x00, 0xe6, 0x00, 0xc5, 0x00,
+  0x04, 0xa4, 0x00, 0x82, 0x45, 0x19, 0xfb, 0xde, 0x02, 0xff, 0xff, 0x84, 0x1b, 0xdf, 0xe5, 0x08, 0xc6, 0x00, 0xc5, 0x00, 0x05, 0xe6, 0x00, 0x81, 0xc5, 0x00, 0x04, 0x83, 0x00, 0x8f, 0xcc, 0x4a,
+  0xdd, 0xe7, 0xd6, 0xe7, 0xf4, 0xef, 0xf6, 0xef, 0xd4, 0xe7, 0xd4, 0xef, 0x94, 0xdf, 0xcc, 0xa5, 0x69, 0xa6, 0xc7, 0xb6, 0xec, 0xbe, 0x01, 0xb7, 0xd1, 0x8d, 0xe9, 0x31, 0x04, 0x83, 0x00, 0x82,
+  0xa4, 0x00, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x83, 0x06, 0x01, 0x46, 0x19, 0x99, 0xd6, 0x02, 0xfe, 0xff, 0x83, 0xba, 0xd6, 0xa4, 0x00, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xff,
+  0xff, 0x06, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x45, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x88, 0x5c, 0xef, 0xcf, 0x73, 0x8f, 0x6b, 0x2d, 0x63, 0x6b,
+  0x42, 0xc6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0x03, 0xc5, 0x00, 0x02, 0x26, 0x09, 0x02, 0x26, 0x11, 0x83, 0xa9, 0x19, 0x2f, 0x33, 0x5c, 0xcf, 0x0b, 0xfe, 0xff, 0x8a, 0xfd, 0xff, 0x9d, 0xf7, 0x87,
+  0x21, 0xc6, 0x00, 0xc7, 0x31, 0x5b, 0xe7, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xde, 0xc4, 0x08, 0x03, 0xa4, 0x00, 0x82, 0x05, 0x11, 0x1b, 0xdf, 0x03, 0xfe, 0xff, 0x83, 0x9d, 0xef, 0xe9, 0x31, 0xe7,
+  0x00, 0x02, 0xe6, 0x00, 0x81, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x81, 0xc5, 0x00, 0x04, 0xa4, 0x00, 0x86, 0xc4, 0x00, 0x99, 0xce, 0xff, 0xff, 0xfe, 0xff, 0x7d, 0xef, 0x87, 0x21, 0x03, 0xc5, 0x00,
+  0x06, 0xe6, 0x00, 0x04, 0x83, 0x00, 0x8f, 0xe5, 0x10, 0x3e, 0xcf, 0xf8, 0xf7, 0xf7, 0xef, 0xf4, 0xef, 0x97, 0xe7, 0xf6, 0xef, 0x34, 0xd7, 0xa6, 0x75, 0x27, 0x86, 0x6c, 0xae, 0x8e, 0xb6, 0x20,
+  0x86, 0x57, 0xae, 0x25, 0x19, 0x03, 0x83, 0x00, 0x82, 0xa4, 0x00, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x82, 0x08, 0x3a, 0x5c, 0xef, 0x03, 0xfe, 0xff, 0x83, 0xda,
+  0xd6, 0xa4, 0x00, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x02, 0xff, 0xff, 0x08, 0xfe, 0xff, 0x81, 0x25, 0x19, 0x02, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x25, 0x19, 0x0c, 0xfe, 0xff, 0x8f, 0x9f, 0xff, 0x9f,
+  0xf7, 0x1f, 0xef, 0x3f, 0xd6, 0x5e, 0x6d, 0x5a, 0x04, 0xf9, 0x0b, 0x76, 0x0b, 0xd5, 0x0b, 0x76, 0x3c, 0x56, 0x3c, 0x35, 0x44, 0x14, 0x03, 0x54, 0x33, 0x9d, 0xe7, 0x0b, 0xfe, 0xff, 0x83, 0xfd,
+  0xff, 0xfe, 0xff, 0xb2, 0x94, 0x02, 0x06, 0x01, 0x81, 0xb9, 0xd6, 0x02, 0xfe, 0xff, 0x82, 0x7c, 0xef, 0xa7, 0x31, 0x04, 0xa4, 0x00, 0x81, 0x38, 0xc6, 0x03, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0x0d,
+  0x5b, 0x03, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x83, 0xe6, 0x00, 0x06, 0x01, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x81, 0x38, 0xc6, 0x02, 0xff, 0xff, 0x83, 0xbe, 0xef, 0x49, 0x42, 0x85, 0x00, 0x03, 0xc5,
+  0x00, 0x02, 0xc6, 0x00, 0x02, 0xc5, 0x00, 0x02, 0xc6, 0x00, 0x81, 0xa4, 0x00, 0x04, 0x83, 0x00, 0x8d, 0xf4, 0x94, 0xfb, 0xf7, 0xb7, 0xe7, 0xf5, 0xef, 0xd9, 0xef, 0xd8, 0xef, 0x99, 0xe7, 0xd3,
+  0xc6, 0x03, 0x85, 0xed, 0x9d, 0xa7, 0x75, 0xaa, 0xa6, 0x32, 0x6c, 0x05, 0x83, 0x00, 0x81, 0xe6, 0x00, 0x03, 0xc6, 0x00, 0x83, 0xe6, 0x00, 0x46, 0x09, 0x7b, 0xef, 0x02, 0xfd, 0xff, 0x8a, 0xfe,
+  0xff, 0x99, 0xce, 0x4d, 0x63, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x14, 0x9d, 0x7d, 0xef, 0xff, 0xff, 0x07, 0xfe, 0xff, 0x81, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0d,
+  0xfe, 0xff, 0x8c, 0xde, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xbe, 0xe7, 0x5f, 0xd7, 0xff, 0xc6, 0xfe, 0xc6, 0x9c, 0xbe, 0x9c, 0xc6, 0xfd, 0xd6, 0x7d, 0xef, 0xbe, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0xfd,
+  0xff, 0x0b, 0xfe, 0xff, 0x88, 0x99, 0xd6, 0xe6, 0x00, 0x06, 0x01, 0x75, 0xa5, 0xfe, 0xff, 0xfd, 0xff, 0xdd, 0xf7, 0xeb, 0x5a, 0x03, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x74, 0xad, 0x04, 0xfe, 0xff,
+  0x82, 0x10, 0x7c, 0xe7, 0x00, 0x07, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x81, 0x95, 0xad, 0x02, 0xff, 0xff, 0x82, 0xde, 0xff, 0xaf, 0x6b, 0x02, 0xc6, 0x00, 0x04, 0xc5, 0x00, 0x02, 0xc6, 0x00, 0x84,
+  0xe6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x03, 0x83, 0x00, 0x8e, 0x63, 0x00, 0x4e, 0x63, 0xbd, 0xcf, 0xf6, 0xef, 0x52, 0xcf, 0xb1, 0xdf, 0xf7, 0xef, 0xd6, 0xe7, 0x70, 0xb6, 0x2e, 0x9e,
+  0xcd, 0x95, 0x25, 0x65, 0x71, 0x85, 0x4a, 0x32, 0x04, 0x83, 0x00, 0x83, 0xa4, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x82, 0x07, 0x01, 0xb9, 0xce, 0x02, 0xfd, 0xff, 0x87, 0xde, 0xff,
+  0x91, 0x8c, 0x05, 0x01, 0xe5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x02, 0x83, 0x00, 0x83, 0x05, 0x19, 0x38, 0xc6, 0xff, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81,
+  0x25, 0x19, 0x1b, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x08, 0xfe, 0xff, 0x89, 0xfd, 0xff, 0x3b, 0xe7, 0x87, 0x21, 0x06, 0x01, 0x6d, 0x6b, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xef, 0x7b, 0x04, 0xa4,
+  0x00, 0x81, 0x92, 0x8c, 0x04, 0xfe, 0xff, 0x83, 0x34, 0xa5, 0xc7, 0x00, 0x07, 0x01, 0x06, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x81, 0xf3, 0x9c, 0x03, 0xfe, 0xff, 0x82, 0x71, 0x8c, 0xe5, 0x00, 0x04,
+  0xc6, 0x00, 0x86, 0xc5, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0xe5, 0x00, 0xc5, 0x00, 0x02, 0xe6, 0x00, 0x81, 0x84, 0x00, 0x02, 0x83, 0x00, 0x8e, 0x63, 0x00, 0x05, 0x19, 0x5e, 0xdf, 0xf9,
+  0xef, 0xef, 0xe7, 0x77, 0xdf, 0x92, 0xdf, 0x96, 0xe7, 0xd1, 0xc6, 0x49, 0x8d, 0x4a, 0x85, 0xe4, 0x6c, 0x50, 0x7b, 0x26, 0x11, 0x03, 0x83, 0x00, 0x87, 0x84, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc5,
+  0x00, 0xe6, 0x00, 0x07, 0x01, 0xae, 0x6b, 0x03, 0xfe, 0xff, 0x82, 0x71, 0x8c, 0xe5, 0x00, 0x03, 0xc5, 0x00, 0x05, 0xa4, 0x00, 0x82, 0x84, 0x00, 0xf7, 0xbd, 0x06, 0xfe, 0xff, 0x81, 0x25, 0x19,
+  0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x24, 0xfe, 0xff, 0x89, 0xfd, 0xff, 0x5b, 0xe7, 0xe8, 0x31, 0x07, 0x01, 0xcb, 0x4a, 0x9d, 0xef, 0xfe, 0xff, 0xfd, 0xff, 0xf3, 0x9c, 0x04, 0xa4, 0x00, 0x81,
+  0xce, 0x73, 0x04, 0xfe, 0xff, 0x81, 0x17, 0xbe, 0x02, 0xc6, 0x00, 0x06, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x82, 0xcf, 0x73, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x83, 0x75, 0xad, 0xc5, 0x00, 0xc6, 0x00,
+  0x05, 0xc5, 0x00, 0x81, 0xc6, 0x00, 0x02, 0xc5, 0x00, 0x02, 0xe5, 0x00, 0x02, 0xe6, 0x00, 0x83, 0xa4, 0x00, 0x83, 0x00, 0x63, 0x00, 0x02, 0x83, 0x00, 0x8b, 0x76, 0xa5, 0xfb, 0xdf, 0xf8, 0xf7,
+  0x97, 0xdf, 0x97, 0xe7, 0x77, 0xdf, 0x2f, 0xcf, 0xe0, 0x7c, 0xee, 0xad, 0xa6, 0x74, 0x59, 0xad, 0x04, 0x83, 0x00, 0x81, 0x84, 0x00, 0x03, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0x1b, 0xdf, 0x02,
+  0xfe, 0xff, 0x82, 0x38, 0xc6, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x82, 0xc5, 0x00, 0xc4, 0x00, 0x02, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x82, 0xa3, 0x00, 0xdb, 0xde, 0x05, 0xfe, 0xff,
+  0x81, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x23, 0xfe, 0xff, 0x89, 0xfd, 0xff, 0x3b, 0xe7, 0xe8, 0x39, 0x07, 0x01, 0x8b, 0x42, 0x7c, 0xef, 0xfe, 0xff, 0xfd, 0xff, 0x74, 0xad, 0x04,
+  0xa4, 0x00, 0x82, 0x4d, 0x63, 0xde, 0xf7, 0x03, 0xfe, 0xff, 0x83, 0x58, 0xc6, 0xe6, 0x00, 0xc6, 0x00, 0x06, 0xe6, 0x00, 0x81, 0xc5, 0x00, 0x03, 0xa4, 0x00, 0x83, 0x84, 0x00, 0xaa, 0x4a, 0xbd,
+  0xf7, 0x02, 0xfe, 0xff, 0x82, 0x58, 0xce, 0xc5, 0x00, 0x02, 0xc6, 0x00, 0x07, 0xc5, 0x00, 0x82, 0xc6, 0x00, 0xe5, 0x00, 0x02, 0xe6, 0x00, 0x82, 0x07, 0x01, 0xc5, 0x00, 0x04, 0x83, 0x00, 0x8c,
+  0x0d, 0x5b, 0xfb, 0xe7, 0xf6, 0xef, 0xf7, 0xef, 0xb4, 0xe7, 0x97, 0xe7, 0x90, 0xbe, 0x88, 0x7c, 0x8f, 0xa5, 0xe6, 0x6b, 0x70, 0x63, 0x63, 0x00, 0x03, 0x83, 0x00, 0x81, 0x84, 0x00, 0x03, 0xc6,
+  0x00, 0x83, 0xe6, 0x00, 0x67, 0x19, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x29, 0x3a, 0x02, 0xa4, 0x00, 0x88, 0xc4, 0x00, 0x28, 0x3a, 0x78, 0xc6, 0xbd, 0xf7, 0x9d, 0xef, 0xd7, 0xbd, 0xe4, 0x08,
+  0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x2d, 0x63, 0x04, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x23, 0xfe, 0xff, 0x85, 0xd9, 0xd6, 0x87, 0x21, 0x07, 0x01,
+  0x2a, 0x3a, 0x5c, 0xe7, 0x02, 0xfd, 0xff, 0x82, 0x17, 0xc6, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x83, 0xc4, 0x00, 0x6a, 0x4a, 0xbe, 0xf7, 0x03, 0xfe, 0xff, 0x83, 0xba, 0xd6, 0xe7, 0x00, 0xc6, 0x00,
+  0x06, 0xe6, 0x00, 0x82, 0xc5, 0x00, 0xa4, 0x00, 0x02, 0xa3, 0x00, 0x83, 0xa4, 0x00, 0x45, 0x19, 0x3c, 0xe7, 0x02, 0xfe, 0xff, 0x82, 0x79, 0xce, 0xa5, 0x00, 0x03, 0xc6, 0x00, 0x05, 0xc5, 0x00,
+  0x02, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x83, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0x04, 0x83, 0x00, 0x8c, 0xcc, 0x52, 0xbd, 0xe7, 0xf5, 0xef, 0xf0, 0xe7, 0x8f, 0xdf, 0xb4, 0xc6, 0x89, 0xcf, 0x46,
+  0x96, 0xcc, 0x9d, 0x65, 0x74, 0x8a, 0x42, 0x63, 0x00, 0x03, 0x83, 0x00, 0x81, 0xa4, 0x00, 0x02, 0xc6, 0x00, 0x83, 0xe6, 0x00, 0x06, 0x01, 0xcb, 0x4a, 0x02, 0xfe, 0xff, 0x81, 0xfb, 0xde, 0x04,
+  0xa4, 0x00, 0x82, 0x3c, 0xe7, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x83, 0xff, 0xff, 0x38, 0xc6, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0x9d, 0xf7, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x26,
+  0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x1f, 0xfe, 0xff, 0x8c, 0xfd, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x75, 0xad, 0xc5, 0x00, 0xe6, 0x00, 0x09, 0x32, 0x3b, 0xe7, 0xfe, 0xff, 0xfd, 0xff, 0x58,
+  0xce, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x86, 0x19, 0x5c, 0xe7, 0x03, 0xfe, 0xff, 0x81, 0x3c, 0xe7, 0x02, 0xe7, 0x00, 0x81, 0xc7, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xc6, 0x00, 0x02, 0xe6, 0x00,
+  0x81, 0xc5, 0x00, 0x03, 0xa4, 0x00, 0x8b, 0x83, 0x00, 0xa4, 0x00, 0x79, 0xce, 0xff, 0xff, 0xfe, 0xff, 0x99, 0xce, 0xc4, 0x08, 0x85, 0x00, 0xa6, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x03, 0xc5, 0x00,
+  0x03, 0xe6, 0x00, 0x81, 0xc5, 0x00, 0x02, 0xe6, 0x00, 0x82, 0x07, 0x01, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x81, 0xa4, 0x00, 0x03, 0x83, 0x00, 0x8c, 0x46, 0x19, 0xde, 0xe7, 0xf6, 0xef, 0x52, 0xd7,
+  0x32, 0xcf, 0xcd, 0xdf, 0x54, 0xd7, 0x6d, 0xae, 0xac, 0x9d, 0xb1, 0x9d, 0x09, 0x32, 0x84, 0x00, 0x03, 0x83, 0x00, 0x81, 0xc5, 0x00, 0x02, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xf3, 0x94, 0x02,
+  0xfe, 0xff, 0x81, 0xf7, 0xbd, 0x03, 0xa4, 0x00, 0x81, 0x6e, 0x6b, 0x05, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x87, 0x21, 0x03, 0xa4, 0x00, 0x81, 0xfa, 0xde, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25,
+  0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x1d, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x87, 0xfe, 0xff, 0x99, 0xce, 0x8a, 0x4a, 0xc5, 0x00, 0xe6, 0x00, 0x6a, 0x42, 0x3b, 0xe7, 0x02, 0xfe, 0xff, 0x83,
+  0x99, 0xce, 0xc3, 0x00, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x82, 0x25, 0x11, 0xfb, 0xd6, 0x03, 0xfe, 0xff, 0x82, 0x9d, 0xef, 0xe9, 0x31, 0x02, 0xe7, 0x00, 0x81, 0xc7, 0x00, 0x05, 0xe6, 0x00, 0x04,
+  0xa4, 0x00, 0x88, 0x83, 0x00, 0xf7, 0xbd, 0xff, 0xff, 0xfe, 0xff, 0x3c, 0xe7, 0x04, 0x11, 0x63, 0x00, 0x85, 0x00, 0x03, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xc6, 0x00, 0x02,
+  0xe6, 0x00, 0x02, 0x07, 0x01, 0x84, 0xe7, 0x00, 0x07, 0x01, 0x27, 0x01, 0xc4, 0x00, 0x03, 0x83, 0x00, 0x8c, 0xa4, 0x00, 0x39, 0xb6, 0xfe, 0xef, 0xb1, 0xdf, 0x77, 0xdf, 0x8e, 0xb6, 0x14, 0xcf,
+  0xac, 0xb6, 0xe0, 0x6c, 0xb5, 0x8d, 0x67, 0x21, 0x84, 0x00, 0x03, 0x83, 0x00, 0x81, 0xc5, 0x00, 0x04, 0xc6, 0x00, 0x81, 0x33, 0x9d, 0x02, 0xfe, 0xff, 0x81, 0xb6, 0xb5, 0x03, 0xa4, 0x00, 0x81,
+  0xef, 0x73, 0x02, 0xfe, 0xff, 0x04, 0xff, 0xff, 0x81, 0x08, 0x32, 0x03, 0xa4, 0x00, 0x81, 0xfa, 0xde, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x1d,
+  0xfe, 0xff, 0x84, 0xfd, 0xff, 0x99, 0xce, 0x2d, 0x63, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x82, 0x6e, 0x6b, 0xbd, 0xf7, 0x02, 0xfe, 0xff, 0x83, 0xfa, 0xde, 0xa3, 0x00, 0xc4, 0x00, 0x03, 0xa4, 0x00,
+  0x81, 0x59, 0xc6, 0x03, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0xed, 0x52, 0x03, 0xe7, 0x00, 0x81, 0xc7, 0x00, 0x04, 0xe6, 0x00, 0x05, 0xa4, 0x00, 0x85, 0x34, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0x9d, 0xf7,
+  0x29, 0x42, 0x02, 0x83, 0x00, 0x82, 0xa5, 0x00, 0xc5, 0x00, 0x02, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x04, 0xe6, 0x00, 0x82, 0xe7, 0x00, 0x07, 0x01, 0x02, 0xe7, 0x00, 0x83, 0x07, 0x01, 0x27, 0x01,
+  0xc5, 0x00, 0x04, 0x83, 0x00, 0x8b, 0x52, 0x84, 0xbf, 0xef, 0xd6, 0xef, 0x94, 0xdf, 0x0f, 0xbf, 0xd8, 0xef, 0x8f, 0xbe, 0x48, 0x6c, 0xb4, 0x6c, 0x63, 0x00, 0x84, 0x00, 0x03, 0x83, 0x00, 0x05,
+  0xc6, 0x00, 0x81, 0xce, 0x6b, 0x02, 0xfe, 0xff, 0x81, 0x58, 0xc6, 0x03, 0xa4, 0x00, 0x83, 0xc4, 0x08, 0x9d, 0xef, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xfb, 0xd6, 0x04, 0xa4, 0x00,
+  0x81, 0x9c, 0xf7, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x83, 0x9d, 0xf7, 0x99, 0xce, 0x9a, 0xce, 0x03, 0xba, 0xd6, 0x81, 0xba,
+  0xce, 0x02, 0x9a, 0xce, 0x8b, 0x7a, 0xce, 0x79, 0xc6, 0x59, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xbe, 0xf7, 0xbd, 0xd6, 0xb5, 0x14, 0x9d, 0xf0, 0x73, 0x46, 0x19, 0x04, 0xc4, 0x00, 0x86, 0xca,
+  0x52, 0xbd, 0xf7, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xde, 0xa7, 0x29, 0x03, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0x75, 0xad, 0x04, 0xfe, 0xff, 0x81, 0x92, 0x8c, 0x05, 0xe7, 0x00, 0x81, 0xe6, 0x00, 0x02,
+  0x06, 0x01, 0x81, 0xc5, 0x00, 0x04, 0xa4, 0x00, 0x81, 0x50, 0x84, 0x02, 0xfe, 0xff, 0x83, 0xbe, 0xf7, 0x4d, 0x63, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xa5, 0x00, 0xc5, 0x00, 0x02, 0xa5, 0x00,
+  0x81, 0xc5, 0x00, 0x06, 0xe6, 0x00, 0x81, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x82, 0x27, 0x01, 0xe6, 0x00, 0x04, 0x83, 0x00, 0x89, 0x0d, 0x5b, 0x1f, 0xe7, 0x92, 0xb6, 0xae, 0xb6,
+  0xce, 0xbe, 0x99, 0xef, 0xed, 0xdf, 0xa0, 0x4b, 0xcd, 0x3a, 0x04, 0x83, 0x00, 0x81, 0xa4, 0x00, 0x05, 0xc6, 0x00, 0x81, 0x08, 0x32, 0x02, 0xfe, 0xff, 0x87, 0x5d, 0xe7, 0x84, 0x00, 0xa4, 0x00,
+  0x84, 0x00, 0x83, 0x00, 0x0c, 0x5b, 0x7d, 0xef, 0x02, 0xff, 0xff, 0x82, 0x5c, 0xe7, 0x6a, 0x42, 0x03, 0xa4, 0x00, 0x81, 0xcb, 0x52, 0x04, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x26, 0x11, 0x03, 0xa4,
+  0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xbe, 0x04, 0x83, 0x00, 0x81, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xc4, 0x00, 0x06, 0xa4, 0x00, 0x81,
+  0xd9, 0xd6, 0x02, 0xfd, 0xff, 0x82, 0xfa, 0xde, 0x04, 0x11, 0x04, 0xa4, 0x00, 0x82, 0xf0, 0x7b, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xf4, 0x9c, 0x03, 0xe7, 0x00, 0x02, 0x07, 0x01,
+  0x02, 0xe6, 0x00, 0x83, 0x07, 0x01, 0xe5, 0x00, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x4c, 0x63, 0xde, 0xf7, 0x02, 0xfe, 0xff, 0x82, 0x71, 0x8c, 0x63, 0x00, 0x03, 0xa4, 0x00, 0x82, 0xa5, 0x00,
+  0xc5, 0x00, 0x02, 0xa5, 0x00, 0x81, 0xc5, 0x00, 0x03, 0xe6, 0x00, 0x84, 0xc6, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x83, 0x27, 0x01, 0x07, 0x01, 0x84,
+  0x00, 0x03, 0x83, 0x00, 0x89, 0x8a, 0x42, 0xfe, 0xd6, 0x4f, 0xcf, 0xd2, 0xc6, 0xae, 0xbe, 0x74, 0xd7, 0xe2, 0xd7, 0x48, 0x75, 0xed, 0x52, 0x04, 0x83, 0x00, 0x81, 0xc4, 0x00, 0x04, 0xc6, 0x00,
+  0x83, 0xe6, 0x00, 0x26, 0x01, 0x7c, 0xef, 0x02, 0xfe, 0xff, 0x82, 0x4d, 0x63, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x86, 0xa3, 0x00, 0xc4, 0x08, 0xec, 0x5a, 0xab, 0x52, 0x83, 0x00, 0x84, 0x00, 0x03,
+  0xa4, 0x00, 0x81, 0x58, 0xc6, 0x04, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xc6, 0x04, 0x83, 0x00, 0x81, 0x84, 0x00, 0x09,
+  0xa4, 0x00, 0x02, 0xc4, 0x00, 0x06, 0xa4, 0x00, 0x85, 0x86, 0x29, 0xdd, 0xff, 0xfd, 0xff, 0xbd, 0xf7, 0x87, 0x29, 0x05, 0xa4, 0x00, 0x86, 0x51, 0x84, 0xbe, 0xf7, 0xfe, 0xff, 0xde, 0xff, 0xd3,
+  0x94, 0x07, 0x01, 0x03, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x02, 0xe7, 0x00, 0x81, 0xc5, 0x00, 0x03, 0xc4, 0x00, 0x83, 0xa4, 0x00, 0xa6, 0x21, 0x7d, 0xef, 0x02, 0xfe, 0xff, 0x83, 0xda, 0xd6, 0xca,
+  0x21, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x02, 0xe5, 0x00, 0x03, 0xe6, 0x00, 0x02, 0x07, 0x01, 0x81, 0x06, 0x01, 0x03, 0x07, 0x01, 0x02, 0x27, 0x01, 0x82, 0x28,
+  0x01, 0xa4, 0x00, 0x03, 0x83, 0x00, 0x89, 0x87, 0x21, 0x3f, 0xd7, 0xeb, 0x85, 0x14, 0xcf, 0xd1, 0xc6, 0xc2, 0xa6, 0xe1, 0xae, 0xcf, 0x6d, 0x4b, 0x3a, 0x04, 0x83, 0x00, 0x82, 0xc5, 0x00, 0xc6,
+  0x00, 0x02, 0xe6, 0x00, 0x88, 0xc6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x75, 0xad, 0xff, 0xff, 0xfe, 0xff, 0x1b, 0xe7, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x02, 0xa4,
+  0x00, 0x84, 0xa3, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xef, 0x7b, 0x05, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x46, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0x38, 0xc6, 0x84, 0x00,
+  0x03, 0x83, 0x00, 0x03, 0x84, 0x00, 0x0b, 0xa4, 0x00, 0x81, 0xa3, 0x00, 0x02, 0x83, 0x00, 0x82, 0x08, 0x3a, 0x17, 0xc6, 0x02, 0xfe, 0xff, 0x83, 0x75, 0xad, 0xa4, 0x00, 0xc4, 0x00, 0x05, 0xa4,
+  0x00, 0x83, 0x8a, 0x4a, 0x3c, 0xdf, 0x76, 0xad, 0x02, 0x07, 0x01, 0x81, 0xe7, 0x00, 0x03, 0x07, 0x01, 0x02, 0xe7, 0x00, 0x8d, 0xc6, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xe4,
+  0x00, 0xda, 0xd6, 0xff, 0xff, 0xfe, 0xff, 0xbd, 0xf7, 0x11, 0x02, 0xe7, 0x00, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xa5, 0x00, 0x04, 0xc5, 0x00, 0x81, 0xe5, 0x00, 0x02, 0xe6, 0x00, 0x03, 0x07,
+  0x01, 0x02, 0x06, 0x01, 0x81, 0xe7, 0x00, 0x04, 0x07, 0x01, 0x81, 0xa5, 0x00, 0x03, 0x83, 0x00, 0x89, 0xa4, 0x00, 0xbe, 0xc6, 0x0f, 0x96, 0x0f, 0xc7, 0x52, 0xcf, 0x8d, 0xb6, 0xe2, 0xdf, 0x35,
+  0x97, 0xe9, 0x29, 0x03, 0x83, 0x00, 0x83, 0x84, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0x05, 0xe6, 0x00, 0x82, 0x06, 0x09, 0xbe, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0x37, 0xc6, 0x02, 0x84, 0x00, 0x81, 0xa4,
+  0x00, 0x03, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x84, 0x00, 0xee, 0x7b, 0xbd, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x46, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x83, 0x38, 0xc6,
+  0x84, 0x00, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x81, 0x83, 0x00, 0x05, 0x84, 0x00, 0x07, 0xa4, 0x00, 0x84, 0x05, 0x11, 0xcf, 0x73, 0xf6, 0xb5, 0x5c, 0xe7, 0x03, 0xfe, 0xff, 0x82, 0xde, 0xf7, 0x86,
+  0x21, 0x09, 0xa4, 0x00, 0x84, 0x26, 0x09, 0x08, 0x01, 0x07, 0x01, 0xe7, 0x00, 0x03, 0x07, 0x01, 0x82, 0xe7, 0x00, 0xe6, 0x00, 0x04, 0xa4, 0x00, 0x89, 0xc4, 0x00, 0xd6, 0xb5, 0xff, 0xff, 0xfe,
+  0xff, 0xdd, 0xff, 0xf1, 0x4a, 0x92, 0x02, 0xc6, 0x00, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xa5, 0x00, 0x04, 0xc5, 0x00, 0x82, 0xc6, 0x00, 0xe6, 0x00, 0x05, 0x07, 0x01, 0x82, 0xe6, 0x00, 0xe7,
+  0x00, 0x02, 0x07, 0x01, 0x83, 0x27, 0x01, 0x07, 0x01, 0xc6, 0x00, 0x03, 0x83, 0x00, 0x89, 0xa4, 0x00, 0xd9, 0x9d, 0x51, 0xcf, 0xed, 0xb6, 0x53, 0xd7, 0x6b, 0xd6, 0x4c, 0xc7, 0x9a, 0xd7, 0x87,
+  0x21, 0x04, 0x83, 0x00, 0x82, 0xe6, 0x00, 0xc6, 0x00, 0x05, 0xe6, 0x00, 0x82, 0xe7, 0x00, 0x51, 0x84, 0x03, 0xfe, 0xff, 0x89, 0xfa, 0xde, 0x2c, 0x63, 0xa3, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x83,
+  0x00, 0xa4, 0x00, 0x69, 0x4a, 0x37, 0xc6, 0x08, 0xfe, 0xff, 0x81, 0x46, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0x38, 0xc6, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x8d,
+  0x92, 0x94, 0x51, 0x94, 0xa9, 0x5a, 0xc9, 0x5a, 0xee, 0x83, 0x13, 0xa5, 0x95, 0xb5, 0xd7, 0xbd, 0x17, 0xc6, 0x38, 0xce, 0x58, 0xce, 0xb9, 0xd6, 0x5b, 0xef, 0x07, 0xfe, 0xff, 0x86, 0xb6, 0xb5,
+  0xc5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x27, 0x01, 0x02, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x84, 0xc4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x08, 0x01, 0x04, 0x07, 0x01, 0x81, 0x06, 0x01, 0x03,
+  0xa4, 0x00, 0x83, 0x84, 0x00, 0xa4, 0x00, 0x13, 0x9d, 0x02, 0xfe, 0xff, 0x85, 0xfd, 0xff, 0x58, 0xbe, 0x71, 0x02, 0x92, 0x02, 0xc6, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xc6, 0x00,
+  0x04, 0xc5, 0x00, 0x81, 0xe6, 0x00, 0x04, 0x07, 0x01, 0x02, 0x06, 0x01, 0x81, 0xe7, 0x00, 0x04, 0x07, 0x01, 0x81, 0xe6, 0x00, 0x04, 0x83, 0x00, 0x88, 0xb4, 0x84, 0xb6, 0xde, 0xfa, 0xef, 0xf5,
+  0xef, 0x2b, 0xee, 0x90, 0xd7, 0x3a, 0xd7, 0x26, 0x19, 0x04, 0x83, 0x00, 0x02, 0xc6, 0x00, 0x07, 0xe6, 0x00, 0x81, 0x35, 0xa5, 0x03, 0xfe, 0xff, 0x83, 0xfd, 0xff, 0x78, 0xc6, 0x84, 0x00, 0x03,
+  0xa4, 0x00, 0x81, 0xde, 0xff, 0x08, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x11, 0x0a, 0xfe, 0xff, 0x81, 0x38, 0xc6, 0x04, 0xa4, 0x00, 0x87, 0x75, 0xa5, 0x9c,
+  0xff, 0xed, 0xcb, 0xcf, 0xdd, 0x99, 0xf7, 0x7c, 0xff, 0x9d, 0xff, 0x03, 0xde, 0xff, 0x04, 0xfe, 0xff, 0x83, 0xfd, 0xf7, 0x9d, 0xef, 0xbe, 0xf7, 0x02, 0xfe, 0xff, 0x83, 0xde, 0xff, 0xe8, 0x31,
+  0xa4, 0x00, 0x02, 0xc5, 0x00, 0x83, 0x0f, 0x7c, 0x39, 0xb6, 0x69, 0x01, 0x02, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x83, 0xc5, 0x00, 0xa5, 0x00, 0x08, 0x01, 0x03, 0x07, 0x01, 0x02,
+  0xc4, 0x00, 0x03, 0xa4, 0x00, 0x89, 0xcf, 0x73, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x5b, 0xe7, 0x71, 0x02, 0x2f, 0x02, 0x91, 0x02, 0xe6, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xc6,
+  0x00, 0x04, 0xc5, 0x00, 0x02, 0xe6, 0x00, 0x02, 0x07, 0x01, 0x03, 0x06, 0x01, 0x81, 0xe7, 0x00, 0x04, 0x07, 0x01, 0x81, 0xe6, 0x00, 0x04, 0x83, 0x00, 0x88, 0xd0, 0x63, 0xf9, 0xe3, 0x7a, 0xef,
+  0xf5, 0xef, 0x85, 0xcf, 0x83, 0x75, 0x79, 0x9d, 0x63, 0x00, 0x04, 0x83, 0x00, 0x07, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x86, 0xd3, 0x94, 0xbe, 0xf7, 0xfe, 0xff, 0xfd, 0xff, 0xb9, 0xd6, 0x84, 0x00,
+  0x03, 0xa4, 0x00, 0x81, 0xff, 0xff, 0x08, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x11, 0x0a, 0xfe, 0xff, 0x81, 0x17, 0xbe, 0x04, 0xa4, 0x00, 0x95, 0xb2, 0x7c,
+  0x5c, 0xcf, 0x05, 0x49, 0xc8, 0x28, 0xed, 0x50, 0x94, 0xbc, 0x59, 0xe6, 0xba, 0xde, 0xda, 0xde, 0x9b, 0xd6, 0x7b, 0xce, 0xba, 0xbd, 0xb7, 0x8c, 0x34, 0x4b, 0xad, 0x01, 0x8b, 0x01, 0x5b, 0xe7,
+  0xfd, 0xff, 0xfe, 0xff, 0x79, 0xce, 0xa5, 0x00, 0x03, 0xa4, 0x00, 0x88, 0x1b, 0xe7, 0xfe, 0xff, 0x9c, 0xef, 0x0e, 0x4b, 0xa5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x81,
+  0xe5, 0x00, 0x02, 0x07, 0x01, 0x82, 0xc5, 0x00, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x8a, 0xab, 0x4a, 0xbe, 0xf7, 0xfe, 0xff, 0xfd, 0xff, 0xbc, 0xf7, 0x2e, 0x02, 0x50, 0x02, 0x0f, 0x02, 0xb2, 0x02,
+  0xe6, 0x00, 0x03, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0xc6, 0x00, 0x03, 0xa5, 0x00, 0x82, 0xc5, 0x00, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x04, 0x06, 0x01, 0x81, 0xe7, 0x00, 0x04, 0x27, 0x01, 0x81, 0x07,
+  0x01, 0x04, 0x83, 0x00, 0x88, 0xec, 0x42, 0xae, 0x5a, 0x19, 0xef, 0xd7, 0xef, 0x28, 0x7d, 0x86, 0x7d, 0xb2, 0x43, 0x63, 0x00, 0x03, 0x83, 0x00, 0x81, 0xa4, 0x00, 0x07, 0xc6, 0x00, 0x04, 0xe6,
+  0x00, 0x85, 0x09, 0x32, 0x5c, 0xe7, 0xfe, 0xff, 0x98, 0xd6, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xff, 0xff, 0x08, 0xfe, 0xff, 0x82, 0xde, 0xff, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x11,
+  0x0a, 0xfe, 0xff, 0x82, 0xf7, 0xbd, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x89, 0x52, 0x6c, 0x37, 0x4c, 0xcf, 0x09, 0xca, 0x01, 0x4a, 0x02, 0x8f, 0x02, 0x90, 0x02, 0xaf, 0x02, 0x2f, 0x02, 0x02, 0xd0,
+  0x01, 0x85, 0xf2, 0x01, 0xd1, 0x01, 0x8f, 0x01, 0x34, 0x9d, 0x7b, 0xef, 0x02, 0xfd, 0xff, 0x87, 0xfe, 0xff, 0xf0, 0x73, 0xa5, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xeb, 0x5a, 0xff, 0xff, 0x03, 0xfe,
+  0xff, 0x82, 0x59, 0xbe, 0xe5, 0x08, 0x03, 0xa4, 0x00, 0x04, 0xc5, 0x00, 0x02, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x8b, 0x46, 0x21, 0x5c, 0xe7, 0xfe, 0xff, 0xfd, 0xff, 0xdd, 0xf7, 0x8f, 0x3a, 0x6f,
+  0x02, 0x70, 0x02, 0x50, 0x02, 0x1c, 0xdf, 0x6e, 0x6b, 0x03, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0xc5, 0x00, 0x03, 0xa5, 0x00, 0x81, 0xc5, 0x00, 0x04, 0xe6, 0x00, 0x04, 0x06, 0x01, 0x03, 0x07, 0x01,
+  0x02, 0x27, 0x01, 0x81, 0x07, 0x01, 0x04, 0x83, 0x00, 0x87, 0x8b, 0x42, 0xf3, 0x73, 0x79, 0xdf, 0xf8, 0xf7, 0x40, 0x86, 0x60, 0x4d, 0xaf, 0x4b, 0x04, 0x83, 0x00, 0x83, 0xa4, 0x00, 0xc6, 0x00,
+  0xe6, 0x00, 0x02, 0xc6, 0x00, 0x07, 0xe6, 0x00, 0x85, 0xe7, 0x00, 0x3c, 0xe7, 0xfe, 0xff, 0x58, 0xce, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x06, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x02,
+  0xfe, 0xff, 0x81, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x83, 0xf6, 0xbd, 0xa3, 0x00, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x8d, 0xf7, 0xb5, 0xbe, 0xf7, 0xfc, 0xe6, 0x9a,
+  0xd6, 0x57, 0xd6, 0xd6, 0xb5, 0x77, 0xa5, 0xd5, 0x8c, 0x54, 0x84, 0xb5, 0x94, 0x78, 0xce, 0x5c, 0xef, 0xbd, 0xf7, 0x05, 0xfd, 0xff, 0x87, 0x7c, 0xef, 0x84, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa4,
+  0x00, 0x38, 0xc6, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xd7, 0xb5, 0xa6, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x03, 0xc4, 0x00, 0x82, 0x46, 0x19, 0x1a, 0xdf, 0x03, 0xfe,
+  0xff, 0x88, 0x94, 0x8c, 0x10, 0x02, 0xb0, 0x02, 0xf1, 0x02, 0x7d, 0xef, 0xfe, 0xff, 0xcf, 0x73, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x82, 0xe6, 0x00, 0xc5, 0x00, 0x02, 0xa5, 0x00, 0x81, 0xc5, 0x00,
+  0x02, 0xc6, 0x00, 0x81, 0xe6, 0x00, 0x03, 0x06, 0x01, 0x05, 0x07, 0x01, 0x02, 0x27, 0x01, 0x81, 0x28, 0x01, 0x03, 0x83, 0x00, 0x88, 0x84, 0x00, 0xcd, 0x4a, 0x19, 0x7c, 0x99, 0xef, 0xf5, 0xef,
+  0xe2, 0xdf, 0xc0, 0x95, 0xaf, 0x63, 0x04, 0x83, 0x00, 0x81, 0xa4, 0x00, 0x02, 0xc6, 0x00, 0x81, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x06, 0xe6, 0x00, 0x85, 0xe7, 0x00, 0x3c, 0xe7, 0xfe, 0xff, 0x38,
+  0xc6, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x07, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x26, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xf6,
+  0xbd, 0x02, 0x83, 0x00, 0x02, 0x84, 0x00, 0x81, 0xda, 0xd6, 0x03, 0xfe, 0xff, 0x03, 0xfd, 0xff, 0x05, 0xfe, 0xff, 0x06, 0xfd, 0xff, 0x87, 0x95, 0xad, 0xa5, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xe8,
+  0x31, 0xdf, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x84, 0xbd, 0xf7, 0x0b, 0x32, 0x8d, 0x01, 0xc6, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x84, 0xc4, 0x00, 0xa4, 0x00, 0xc4,
+  0x00, 0x79, 0xce, 0x03, 0xfe, 0xff, 0x85, 0x59, 0xc6, 0x50, 0x02, 0x92, 0x02, 0x33, 0x03, 0x5b, 0xe7, 0x02, 0xfe, 0xff, 0x82, 0xcf, 0x7b, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x06, 0x01, 0xe6,
+  0x00, 0x02, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x82, 0xc6, 0x00, 0xe6, 0x00, 0x04, 0x06, 0x01, 0x02, 0x07, 0x01, 0x81, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x82, 0x27, 0x01, 0x28, 0x01, 0x04, 0x83, 0x00,
+  0x87, 0x88, 0x21, 0x34, 0x7c, 0x95, 0xf6, 0xf2, 0xe7, 0x52, 0xd7, 0x20, 0xbf, 0x10, 0x6c, 0x04, 0x83, 0x00, 0x82, 0xa4, 0x00, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x03, 0xc6, 0x00, 0x04, 0xe6, 0x00,
+  0x02, 0x07, 0x01, 0x84, 0x3c, 0xe7, 0xfe, 0xff, 0x38, 0xc6, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x07, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x25, 0x19, 0x02, 0xa4, 0x00, 0x82, 0xc4,
+  0x00, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xf6, 0xbd, 0x03, 0x83, 0x00, 0x82, 0x84, 0x00, 0xda, 0xd6, 0x04, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x0b, 0xfe, 0xff, 0x81, 0xe8, 0x31, 0x02, 0xa4, 0x00,
+  0x82, 0xc4, 0x00, 0x54, 0xa5, 0x03, 0xff, 0xff, 0x89, 0xfe, 0xff, 0xdd, 0xf7, 0x6d, 0x63, 0x8a, 0x01, 0x8c, 0x01, 0xcd, 0x01, 0x28, 0x01, 0xa4, 0x00, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x83, 0xa4,
+  0x00, 0xc4, 0x00, 0x95, 0xad, 0x03, 0xfe, 0xff, 0x89, 0xb9, 0xd6, 0x95, 0x01, 0x93, 0x02, 0x53, 0x03, 0x1c, 0xdf, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xcf, 0x73, 0x02, 0x84, 0x00, 0x02, 0xa4,
+  0x00, 0x84, 0x27, 0x01, 0x26, 0x01, 0xc5, 0x00, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x82, 0xc6, 0x00, 0xe6, 0x00, 0x05, 0x06, 0x01, 0x03, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x81, 0x28, 0x01, 0x04, 0x83,
+  0x00, 0x87, 0x67, 0x19, 0x33, 0x74, 0xb0, 0xb5, 0xeb, 0xdf, 0x17, 0xbe, 0x94, 0xb2, 0x12, 0x74, 0x04, 0x83, 0x00, 0x83, 0xc4, 0x00, 0x06, 0x01, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x83, 0xc6, 0x00,
+  0xe6, 0x00, 0x06, 0x01, 0x04, 0xe6, 0x00, 0x84, 0x47, 0x09, 0x7c, 0xe7, 0xfe, 0xff, 0x38, 0xc6, 0x03, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0xff, 0xff, 0x06, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe,
+  0xff, 0x81, 0x26, 0x19, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xf6, 0xbd, 0x02, 0x83, 0x00, 0x83, 0x84, 0x00, 0xa4, 0x00, 0xda, 0xd6, 0x10, 0xfe, 0xff, 0x82,
+  0xda, 0xde, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0x7c, 0xef, 0x03, 0xfe, 0xff, 0x89, 0xbd, 0xf7, 0x6e, 0x63, 0x6a, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0xac, 0x01, 0xab, 0x01, 0xc5, 0x00, 0xc4, 0x00,
+  0x02, 0xc5, 0x00, 0x83, 0xe5, 0x00, 0xef, 0x7b, 0xfe, 0xf7, 0x02, 0xfe, 0xff, 0x86, 0x3c, 0xe7, 0x71, 0x02, 0x94, 0x02, 0xb5, 0x02, 0xfb, 0xce, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x8a, 0xfe, 0xff,
+  0x10, 0x7c, 0x84, 0x00, 0x83, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0x86, 0x01, 0x66, 0x01, 0xc5, 0x00, 0xa5, 0x00, 0x03, 0xc6, 0x00, 0x84, 0xe6, 0x00, 0x06, 0x01, 0x07, 0x01, 0xe6, 0x00, 0x02, 0x06,
+  0x01, 0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x83, 0xe6, 0x00, 0xe8, 0x00, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x87, 0x47, 0x19, 0xf0, 0x7c, 0x90, 0xbe, 0x53, 0xd7, 0xf3, 0xdd, 0x52, 0xee, 0xd1, 0x6b,
+  0x04, 0x83, 0x00, 0x82, 0xc4, 0x00, 0x06, 0x01, 0x03, 0xe6, 0x00, 0x83, 0xc6, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x03, 0xe6, 0x00, 0x82, 0x0b, 0x5b, 0x5a, 0xe7, 0x02, 0xfe, 0xff, 0x81, 0x78, 0xce,
+  0x03, 0xa4, 0x00, 0x84, 0xc4, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x25, 0x11, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0x45, 0x19,
+  0x0a, 0xfe, 0xff, 0x81, 0xf6, 0xbd, 0x02, 0x83, 0x00, 0x83, 0x84, 0x00, 0xa4, 0x00, 0xda, 0xd6, 0x10, 0xfe, 0xff, 0x81, 0x71, 0x8c, 0x03, 0x83, 0x00, 0x82, 0xab, 0x52, 0xff, 0xff, 0x02, 0xfe,
+  0xff, 0x82, 0xfb, 0xde, 0xca, 0x29, 0x02, 0x69, 0x01, 0x83, 0x8a, 0x01, 0x48, 0x01, 0xe6, 0x00, 0x04, 0xc5, 0x00, 0x83, 0xe5, 0x00, 0x69, 0x42, 0x9d, 0xf7, 0x02, 0xfe, 0xff, 0x86, 0xde, 0xf7,
+  0x36, 0x0a, 0x93, 0x02, 0x55, 0x03, 0xfa, 0xa5, 0xfe, 0xff, 0x03, 0xfd, 0xff, 0x83, 0xfe, 0xff, 0x31, 0x84, 0x84, 0x00, 0x02, 0x83, 0x00, 0x85, 0xa4, 0x00, 0xf1, 0x8c, 0x3a, 0xf7, 0xe5, 0x08,
+  0xc5, 0x00, 0x04, 0xe6, 0x00, 0x05, 0x06, 0x01, 0x81, 0xe7, 0x00, 0x03, 0x06, 0x01, 0x83, 0xe6, 0x00, 0xe7, 0x00, 0xa4, 0x00, 0x03, 0x83, 0x00, 0x87, 0x27, 0x11, 0xef, 0x84, 0x07, 0x86, 0xcd,
+  0xdf, 0x4a, 0xa6, 0x00, 0x8e, 0xaf, 0x63, 0x04, 0x83, 0x00, 0x82, 0xc4, 0x00, 0x06, 0x01, 0x05, 0xe6, 0x00, 0x03, 0x06, 0x01, 0x82, 0xee, 0x7b, 0xdd, 0xff, 0x03, 0xfe, 0xff, 0x82, 0xda, 0xd6,
+  0xa4, 0x00, 0x03, 0xc4, 0x00, 0x03, 0xff, 0xff, 0x07, 0xfe, 0xff, 0x81, 0x25, 0x11, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xd6, 0xbd, 0x02, 0x83, 0x00, 0x83,
+  0x84, 0x00, 0xa4, 0x00, 0xda, 0xd6, 0x0f, 0xfe, 0xff, 0x82, 0xbd, 0xf7, 0xe4, 0x10, 0x03, 0x83, 0x00, 0x85, 0x63, 0x00, 0x34, 0xa5, 0xde, 0xff, 0xd7, 0xb5, 0x09, 0x01, 0x02, 0x49, 0x01, 0x83,
+  0x28, 0x01, 0xe6, 0x00, 0xc4, 0x00, 0x05, 0xc5, 0x00, 0x82, 0x69, 0x42, 0x3b, 0xe7, 0x03, 0xfe, 0xff, 0x84, 0x98, 0xad, 0x36, 0x02, 0x94, 0x02, 0xf6, 0x43, 0x03, 0xfe, 0xff, 0x02, 0xfd, 0xff,
+  0x83, 0xfe, 0xff, 0x51, 0x84, 0x84, 0x00, 0x02, 0xa3, 0x00, 0x85, 0xc4, 0x00, 0x79, 0xd6, 0xbd, 0xff, 0x4a, 0x42, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x83, 0xc6, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x02,
+  0x06, 0x01, 0x03, 0xe7, 0x00, 0x03, 0x06, 0x01, 0x83, 0xe6, 0x00, 0xe7, 0x00, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x87, 0x88, 0x21, 0x6f, 0x74, 0xcc, 0x85, 0x51, 0xcf, 0xf3, 0xc6, 0x61, 0x54, 0xd0,
+  0x63, 0x04, 0x83, 0x00, 0x82, 0xa4, 0x00, 0x06, 0x01, 0x05, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x83, 0x8a, 0x4a, 0xbc, 0xf7, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x8a, 0xb6, 0xb5, 0x49, 0x42, 0xa4, 0x00,
+  0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x49, 0x42, 0xf7, 0xbd, 0xdf, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xff, 0x81, 0x25, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xf6, 0xbd,
+  0x02, 0x83, 0x00, 0x83, 0x84, 0x00, 0xa4, 0x00, 0xfa, 0xde, 0x0f, 0xfe, 0xff, 0x81, 0x58, 0xce, 0x03, 0x83, 0x00, 0x81, 0x63, 0x00, 0x02, 0x83, 0x00, 0x81, 0xe8, 0x31, 0x02, 0x29, 0x01, 0x83,
+  0xe6, 0x00, 0xc5, 0x00, 0xc4, 0x00, 0x04, 0xc5, 0x00, 0x84, 0xc6, 0x00, 0x26, 0x11, 0x54, 0xa5, 0xbd, 0xf7, 0x03, 0xfe, 0xff, 0x87, 0x1b, 0xdf, 0xd4, 0x02, 0x96, 0x02, 0xd7, 0x12, 0xbe, 0xf7,
+  0xfe, 0xff, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x84, 0xfd, 0xff, 0xfe, 0xff, 0x51, 0x84, 0x84, 0x00, 0x03, 0xa3, 0x00, 0x84, 0x3b, 0xe7, 0xdd, 0xff, 0x30, 0x84, 0xc6, 0x00, 0x05, 0xe6, 0x00, 0x04,
+  0x06, 0x01, 0x81, 0xe7, 0x00, 0x02, 0xe6, 0x00, 0x84, 0x06, 0x01, 0xe6, 0x00, 0xe7, 0x00, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x87, 0x87, 0x19, 0x04, 0x43, 0x0a, 0x86, 0x51, 0xcf, 0x6b, 0xae, 0xc0,
+  0x6d, 0x73, 0x7c, 0x04, 0x83, 0x00, 0x82, 0xa4, 0x00, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x04, 0x06, 0x01, 0x82, 0x26, 0x01, 0xfa, 0xde, 0x02, 0xfd, 0xff, 0x83, 0xbd, 0xf7, 0x2c, 0x63, 0xc4, 0x00,
+  0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x82, 0xaf, 0x73, 0xbe, 0xf7, 0x06, 0xfe, 0xff, 0x81, 0x25, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0xf7, 0xbd,
+  0x83, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xfa, 0xde, 0x0f, 0xfe, 0xff, 0x81, 0x17, 0xbe, 0x03, 0x83, 0x00, 0x02, 0x63, 0x00, 0x83, 0x83, 0x00, 0xa3, 0x00, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x05, 0xc5,
+  0x00, 0x83, 0x05, 0x09, 0x54, 0xa5, 0xbc, 0xef, 0x04, 0xfe, 0xff, 0x86, 0x5c, 0xe7, 0xd3, 0x02, 0xd5, 0x02, 0x79, 0x33, 0x9e, 0xef, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x04, 0xfe, 0xff, 0x82, 0x51,
+  0x84, 0x84, 0x00, 0x02, 0xa3, 0x00, 0x85, 0x83, 0x00, 0x9d, 0xef, 0xfe, 0xff, 0x34, 0xa5, 0xc6, 0x00, 0x05, 0xe6, 0x00, 0x04, 0x06, 0x01, 0x84, 0xe7, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x06, 0x01,
+  0x02, 0xe6, 0x00, 0x81, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x88, 0x86, 0x09, 0xe7, 0x63, 0xca, 0x7c, 0xcb, 0xae, 0xa7, 0xae, 0xa8, 0x9d, 0x38, 0x95, 0x63, 0x00, 0x03, 0x83, 0x00, 0x82, 0xa4, 0x00,
+  0x07, 0x01, 0x02, 0xe6, 0x00, 0x03, 0x06, 0x01, 0x83, 0x26, 0x01, 0x92, 0x8c, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x84, 0x8e, 0x6b, 0xc5, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0x07, 0xa4, 0x00, 0x82, 0x10,
+  0x7c, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x85, 0x25, 0x19, 0xa4, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0x45, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0xf7, 0xbd, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xfb, 0xde, 0x0f,
+  0xfe, 0xff, 0x81, 0x75, 0xad, 0x02, 0xa4, 0x00, 0x87, 0xe4, 0x08, 0x92, 0x8c, 0x43, 0x00, 0x83, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x04, 0xc5, 0x00, 0x83, 0xe5, 0x00, 0x13, 0x9d, 0xbc,
+  0xf7, 0x02, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x86, 0xde, 0xff, 0x79, 0xce, 0x10, 0x02, 0x74, 0x02, 0x96, 0x02, 0x7d, 0xe7, 0x08, 0xfe, 0xff, 0x88, 0x31, 0x7c, 0x84, 0x00, 0x83, 0x00, 0xa3, 0x00,
+  0x83, 0x00, 0xbe, 0xf7, 0xfe, 0xff, 0xd6, 0xb5, 0x09, 0xe6, 0x00, 0x06, 0x06, 0x01, 0x82, 0xc6, 0x00, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x83, 0xac, 0x3a, 0xc0, 0x6c, 0x80, 0x55, 0x02, 0x33, 0xcf,
+  0x83, 0x4b, 0x9e, 0x3a, 0xb6, 0x63, 0x00, 0x03, 0x83, 0x00, 0x82, 0xa4, 0x00, 0xe7, 0x00, 0x02, 0xe6, 0x00, 0x03, 0x06, 0x01, 0x82, 0x26, 0x01, 0x5c, 0xe7, 0x02, 0xfe, 0xff, 0x81, 0xf7, 0xbd,
+  0x05, 0xa4, 0x00, 0x83, 0xcb, 0x4a, 0xeb, 0x52, 0x83, 0x00, 0x04, 0xa4, 0x00, 0x81, 0xf7, 0xb5, 0x05, 0xfe, 0xff, 0x85, 0x26, 0x19, 0xa4, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0x25, 0x19, 0x0a, 0xfe,
+  0xff, 0x82, 0xf7, 0xbd, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xfb, 0xde, 0x0f, 0xfe, 0xff, 0x89, 0xab, 0x4a, 0xc4, 0x00, 0xa4, 0x00, 0x4e, 0x63, 0x9a, 0xce, 0xe8, 0x31, 0xa4, 0x00, 0xc5, 0x00,
+  0xe5, 0x00, 0x03, 0xc5, 0x00, 0x83, 0x46, 0x19, 0x13, 0x9d, 0x7c, 0xef, 0x02, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x88, 0x5d, 0xe7, 0x2f, 0x43, 0x91, 0x02, 0x52, 0x02, 0x75, 0x02, 0x3d, 0xdf, 0xfe,
+  0xff, 0xfd, 0xff, 0x07, 0xfe, 0xff, 0x82, 0x10, 0x7c, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x84, 0x83, 0x00, 0xbe, 0xf7, 0xfe, 0xff, 0xd7, 0xb5, 0x02, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x02, 0xe6, 0x00,
+  0x09, 0x06, 0x01, 0x81, 0xc6, 0x00, 0x04, 0x83, 0x00, 0x89, 0x2e, 0x53, 0x69, 0x75, 0x07, 0x8e, 0x70, 0xd7, 0xb6, 0xe7, 0xd5, 0xef, 0xd9, 0xd6, 0x05, 0x11, 0xa3, 0x00, 0x02, 0x83, 0x00, 0x82,
+  0x84, 0x00, 0xe7, 0x00, 0x04, 0x06, 0x01, 0x83, 0x07, 0x01, 0xc8, 0x21, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x81, 0x08, 0x3a, 0x03, 0xa4, 0x00, 0x82, 0xae, 0x6b, 0x7c, 0xe7, 0x02, 0xfe, 0xff, 0x82,
+  0x5d, 0xe7, 0xcb, 0x52, 0x03, 0xa4, 0x00, 0x81, 0x09, 0x3a, 0x04, 0xfe, 0xff, 0x86, 0xff, 0xff, 0x25, 0x19, 0x84, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x83, 0xf7, 0xbd,
+  0x84, 0x00, 0xa4, 0x00, 0x02, 0x83, 0x00, 0x81, 0xfb, 0xde, 0x0e, 0xfe, 0xff, 0x82, 0x5b, 0xe7, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x83, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x02,
+  0xe6, 0x00, 0x83, 0x66, 0x19, 0x53, 0xa5, 0xbc, 0xf7, 0x02, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x87, 0x5d, 0xe7, 0x34, 0x6c, 0x31, 0x02, 0x93, 0x02, 0xb4, 0x02, 0xd3, 0x1a, 0x7e, 0xe7, 0x0a, 0xfe,
+  0xff, 0x82, 0xf0, 0x73, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x86, 0x83, 0x00, 0xde, 0xf7, 0xfe, 0xff, 0x17, 0xbe, 0xe6, 0x00, 0x06, 0x01, 0x03, 0x07, 0x01, 0x81, 0xe7, 0x00, 0x08, 0x06, 0x01, 0x82,
+  0xe7, 0x00, 0xa5, 0x00, 0x04, 0x83, 0x00, 0x89, 0x6f, 0x63, 0x88, 0x8d, 0x6c, 0xb6, 0x53, 0xd7, 0x76, 0xdf, 0x93, 0xdf, 0x58, 0xbf, 0x46, 0x19, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x81, 0x06, 0x01,
+  0x02, 0x07, 0x01, 0x81, 0x06, 0x01, 0x02, 0x07, 0x01, 0x81, 0x2c, 0x53, 0x02, 0xfe, 0xff, 0x82, 0x1b, 0xe7, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x83, 0xe8, 0x31, 0xbe, 0xf7, 0xfe, 0xff, 0x03, 0xff,
+  0xff, 0x82, 0x1c, 0xdf, 0xa3, 0x00, 0x02, 0xa4, 0x00, 0x83, 0xc4, 0x00, 0x7d, 0xef, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe,
+  0xff, 0x82, 0xf7, 0xbd, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xa3, 0x00, 0xfb, 0xde, 0x0e, 0xfe, 0xff, 0x82, 0x75, 0xad, 0xc5, 0x00, 0x04, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x84, 0xe6, 0x00, 0x87,
+  0x21, 0x54, 0xa5, 0xbc, 0xf7, 0x02, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x82, 0x5d, 0xe7, 0xf4, 0x6b, 0x02, 0xb2, 0x02, 0x84, 0x14, 0x03, 0x34, 0x03, 0x5a, 0xae, 0xde, 0xf7, 0x0b, 0xfe, 0xff, 0x81,
+  0xcf, 0x73, 0x03, 0xa4, 0x00, 0x85, 0x83, 0x00, 0xbe, 0xf7, 0xfe, 0xff, 0x38, 0xc6, 0xe6, 0x00, 0x02, 0x07, 0x01, 0x81, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x81, 0x06, 0x01, 0x03, 0xe6, 0x00, 0x04,
+  0x06, 0x01, 0x82, 0xe7, 0x00, 0xa5, 0x00, 0x04, 0x83, 0x00, 0x89, 0x17, 0x95, 0xcf, 0x95, 0x6c, 0xb6, 0x73, 0xdf, 0xf6, 0xef, 0xf4, 0xe7, 0x34, 0xa7, 0x2a, 0x32, 0x84, 0x00, 0x03, 0x83, 0x00,
+  0x84, 0xe6, 0x00, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x02, 0xe6, 0x00, 0x81, 0x13, 0x95, 0x02, 0xfe, 0xff, 0x82, 0x17, 0xc6, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x31, 0x84, 0x06, 0xff, 0xff,
+  0x81, 0x05, 0x11, 0x03, 0xa4, 0x00, 0x82, 0xfb, 0xde, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x86, 0xf7, 0xbd, 0x84,
+  0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xfb, 0xde, 0x0e, 0xfe, 0xff, 0x81, 0xcf, 0x73, 0x04, 0xc4, 0x00, 0x85, 0xc5, 0x00, 0xe5, 0x08, 0x6d, 0x63, 0x57, 0xc6, 0xdd, 0xf7, 0x05, 0xfe, 0xff,
+  0x88, 0x5c, 0xe7, 0x13, 0x64, 0x72, 0x02, 0x73, 0x02, 0xf4, 0x02, 0x56, 0x03, 0xbc, 0x85, 0xde, 0xf7, 0x0d, 0xfe, 0xff, 0x81, 0xcf, 0x73, 0x03, 0x84, 0x00, 0x85, 0x83, 0x00, 0xbe, 0xf7, 0xff,
+  0xff, 0x79, 0xce, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x02, 0xe6, 0x00, 0x85, 0xe7, 0x00, 0x07, 0x01, 0xe6, 0x00, 0xc6, 0x00, 0xe7, 0x00, 0x03, 0x07, 0x01, 0x83, 0x06, 0x01, 0x07, 0x01, 0xa4, 0x00,
+  0x03, 0x83, 0x00, 0x89, 0xa4, 0x00, 0xbe, 0xc6, 0x91, 0xc6, 0xe8, 0xbe, 0xb2, 0xc6, 0xbd, 0xef, 0xfd, 0xef, 0xb7, 0xd7, 0xea, 0x4a, 0x02, 0x84, 0x00, 0x02, 0x83, 0x00, 0x82, 0xc5, 0x00, 0x07,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x81, 0xf3, 0x94, 0x02, 0xfe, 0xff, 0x81, 0xd6, 0xbd, 0x03, 0xa4, 0x00, 0x81, 0x51, 0x84, 0x06, 0xff, 0xff, 0x81, 0x04, 0x09, 0x03, 0xa4, 0x00, 0x81,
+  0x3c, 0xe7, 0x03, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x25, 0x19, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x86, 0xf6, 0xbd, 0x84, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xfb, 0xde,
+  0x0e, 0xfe, 0xff, 0x81, 0xf3, 0x9c, 0x02, 0xa4, 0x00, 0x84, 0xc4, 0x00, 0xcb, 0x52, 0xd6, 0xb5, 0x9c, 0xef, 0x06, 0xfe, 0xff, 0x88, 0x9d, 0xef, 0x33, 0x74, 0x51, 0x02, 0x72, 0x02, 0x94, 0x02,
+  0xf6, 0x2a, 0xbd, 0xc6, 0xde, 0xef, 0x0f, 0xfe, 0xff, 0x81, 0xd0, 0x73, 0x03, 0x84, 0x00, 0x85, 0x83, 0x00, 0x9d, 0xef, 0xff, 0xff, 0x79, 0xce, 0xc7, 0x00, 0x02, 0x07, 0x01, 0x03, 0xe6, 0x00,
+  0x81, 0xe7, 0x00, 0x03, 0x06, 0x01, 0x81, 0x07, 0x01, 0x02, 0x06, 0x01, 0x83, 0x07, 0x01, 0xe7, 0x00, 0xa4, 0x00, 0x03, 0x83, 0x00, 0x8a, 0x67, 0x19, 0x7d, 0xbf, 0x2d, 0xae, 0x07, 0xb7, 0x06,
+  0x96, 0x7b, 0xe7, 0xfb, 0xef, 0xf9, 0xcf, 0x8d, 0x63, 0x84, 0x00, 0x03, 0x83, 0x00, 0x83, 0xc4, 0x00, 0x07, 0x01, 0x06, 0x01, 0x03, 0xe6, 0x00, 0x81, 0x4d, 0x5b, 0x02, 0xfe, 0xff, 0x82, 0x78,
+  0xce, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xa7, 0x29, 0xbe, 0xf7, 0x02, 0xff, 0xff, 0x83, 0xfe, 0xff, 0xff, 0xff, 0xba, 0xce, 0x03, 0xa4, 0x00, 0x82, 0x83, 0x00, 0xde, 0xff, 0x03, 0xfe, 0xff,
+  0x82, 0xff, 0xff, 0x25, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x86, 0xd6, 0xbd, 0x84, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xfa, 0xde, 0x0e, 0xfe, 0xff, 0x84, 0x9d,
+  0xf7, 0x13, 0x9d, 0xd6, 0xbd, 0x7c, 0xef, 0x08, 0xfe, 0xff, 0x86, 0x99, 0xce, 0x8e, 0x01, 0xf1, 0x01, 0xb7, 0x8c, 0x7a, 0xc6, 0x7d, 0xef, 0x02, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x0e, 0xfe, 0xff,
+  0x82, 0xd0, 0x73, 0x84, 0x00, 0x02, 0x83, 0x00, 0x87, 0x63, 0x00, 0x9d, 0xef, 0xff, 0xff, 0x79, 0xce, 0xc7, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x03, 0xe6, 0x00, 0x83, 0xe7, 0x00, 0xe6, 0x00, 0x06,
+  0x01, 0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x83, 0x07, 0x01, 0xe6, 0x00, 0x84, 0x00, 0x03, 0x83, 0x00, 0x8a, 0x4a, 0x3a, 0xf2, 0x6c, 0xa5, 0x7c, 0x83, 0x6d, 0x2e, 0xae, 0x79, 0xe7, 0xf3, 0xef,
+  0x76, 0xb7, 0x96, 0x95, 0x63, 0x00, 0x02, 0x83, 0x00, 0x85, 0x84, 0x00, 0xa4, 0x00, 0xe7, 0x00, 0x07, 0x01, 0xe7, 0x00, 0x02, 0xe6, 0x00, 0x81, 0xa8, 0x29, 0x02, 0xfe, 0xff, 0x82, 0x7c, 0xef,
+  0x64, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x8e, 0x6b, 0x9e, 0xf7, 0x02, 0xff, 0xff, 0x82, 0x5c, 0xe7, 0x08, 0x3a, 0x03, 0xa4, 0x00, 0x81, 0x8d, 0x6b, 0x05, 0xfe, 0xff, 0x81, 0x05, 0x11, 0x03, 0xa4,
+  0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x86, 0xd6, 0xb5, 0x84, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0xfb, 0xde, 0x0f, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0x81, 0xfd, 0xff,
+  0x12, 0xfe, 0xff, 0x81, 0xd0, 0x73, 0x03, 0x84, 0x00, 0x85, 0x63, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0x9a, 0xce, 0xc7, 0x00, 0x02, 0xe6, 0x00, 0x05, 0xe7, 0x00, 0x82, 0x07, 0x01, 0xe7, 0x00, 0x04,
+  0x07, 0x01, 0x82, 0xc5, 0x00, 0x84, 0x00, 0x03, 0x83, 0x00, 0x8b, 0xad, 0x3a, 0xb0, 0xa3, 0x67, 0x54, 0x09, 0x7d, 0x42, 0x85, 0xd0, 0x8f, 0xf3, 0xd7, 0x34, 0xcf, 0x5b, 0xdf, 0xe5, 0x08, 0x83,
+  0x00, 0x03, 0x84, 0x00, 0x81, 0xe6, 0x00, 0x03, 0x07, 0x01, 0x83, 0xe7, 0x00, 0xe6, 0x00, 0x5c, 0xe7, 0x02, 0xfe, 0xff, 0x81, 0x6d, 0x6b, 0x03, 0xa4, 0x00, 0x85, 0xa3, 0x00, 0x45, 0x19, 0xae,
+  0x73, 0x2c, 0x63, 0xe4, 0x08, 0x03, 0xa4, 0x00, 0x82, 0xa3, 0x00, 0xda, 0xd6, 0x05, 0xfe, 0xff, 0x81, 0x05, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0xd6, 0xbd, 0x84,
+  0x00, 0x03, 0xa4, 0x00, 0x81, 0xfa, 0xde, 0x0f, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x22, 0xfe, 0xff, 0x89, 0xcf, 0x73, 0x84, 0x00, 0x83, 0x00, 0xa3, 0x00, 0x63, 0x00, 0xbe, 0xf7, 0xfe, 0xff, 0x99,
+  0xce, 0xc7, 0x00, 0x03, 0xe6, 0x00, 0x04, 0x07, 0x01, 0x81, 0x06, 0x01, 0x05, 0x07, 0x01, 0x82, 0xc5, 0x00, 0x84, 0x00, 0x03, 0x83, 0x00, 0x8b, 0xb2, 0x63, 0xf0, 0xba, 0x41, 0x4d, 0xc0, 0x4c,
+  0xeb, 0x9d, 0x73, 0xa7, 0x73, 0xb7, 0x50, 0xd7, 0x73, 0xc5, 0x29, 0x3a, 0x83, 0x00, 0x03, 0x84, 0x00, 0x81, 0xc5, 0x00, 0x02, 0x07, 0x01, 0x84, 0x06, 0x01, 0xe6, 0x00, 0xc6, 0x00, 0x14, 0x9d,
+  0x02, 0xfe, 0xff, 0x83, 0x5c, 0xef, 0xe5, 0x10, 0x84, 0x00, 0x07, 0xa4, 0x00, 0x02, 0x83, 0x00, 0x82, 0x14, 0xa5, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x81, 0x05, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x25,
+  0x19, 0x0a, 0xfe, 0xff, 0x82, 0xf6, 0xbd, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xda, 0xde, 0x0f, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x22, 0xfe, 0xff, 0x82, 0xcf, 0x73, 0x84, 0x00, 0x02, 0xa3, 0x00,
+  0x85, 0x43, 0x00, 0xbe, 0xf7, 0xfe, 0xff, 0x99, 0xce, 0xe7, 0x00, 0x03, 0xe6, 0x00, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x86, 0x07, 0x01, 0xe7, 0x00, 0x07, 0x01, 0x27, 0x01, 0xa4, 0x00, 0x84,
+  0x00, 0x02, 0x83, 0x00, 0x8c, 0xa4, 0x00, 0xdc, 0x9d, 0xb1, 0x9a, 0x66, 0x65, 0x2f, 0xae, 0x84, 0x5d, 0x97, 0xe7, 0x6f, 0xb6, 0xf4, 0xce, 0x67, 0x55, 0x2b, 0x32, 0x83, 0x00, 0x03, 0x84, 0x00,
+  0x83, 0xa5, 0x00, 0xe6, 0x00, 0x06, 0x01, 0x04, 0xe6, 0x00, 0x81, 0x7d, 0xef, 0x02, 0xfe, 0xff, 0x83, 0xda, 0xd6, 0x05, 0x19, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x84, 0x84, 0x00, 0x83, 0x00, 0x34,
+  0x9d, 0xff, 0xff, 0x06, 0xfe, 0xff, 0x82, 0x05, 0x11, 0xa3, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x82, 0xf7, 0xbd, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0xda,
+  0xde, 0x08, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x03, 0xde, 0xf7, 0x03, 0xfe, 0xf7, 0x81, 0xde, 0xf7, 0x02, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x0d, 0xfe, 0xff, 0x04,
+  0xff, 0xff, 0x07, 0xfe, 0xff, 0x82, 0xcf, 0x73, 0x84, 0x00, 0x02, 0xa3, 0x00, 0x85, 0x42, 0x00, 0xde, 0xff, 0xfe, 0xff, 0x99, 0xce, 0xe7, 0x00, 0x02, 0x06, 0x01, 0x03, 0xe6, 0x00, 0x02, 0xe7,
+  0x00, 0x06, 0x07, 0x01, 0x82, 0xa4, 0x00, 0xa3, 0x00, 0x02, 0x83, 0x00, 0x8c, 0x87, 0x21, 0xdd, 0x85, 0xc0, 0x40, 0x87, 0x75, 0x62, 0x55, 0xa6, 0xa6, 0xd1, 0xc7, 0x2e, 0xc7, 0x11, 0xcf, 0x88,
+  0x85, 0x33, 0x74, 0x83, 0x00, 0x03, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x06, 0xe6, 0x00, 0x82, 0x4d, 0x63, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x83, 0x5c, 0xef, 0x0f, 0x7c, 0xa3, 0x00, 0x03, 0x84, 0x00,
+  0x83, 0xa4, 0x00, 0xcf, 0x73, 0xda, 0xd6, 0x08, 0xfe, 0xff, 0x82, 0x25, 0x11, 0xa3, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xf6, 0xbd, 0x03, 0xa4, 0x00, 0x82, 0xc4,
+  0x00, 0xda, 0xde, 0x06, 0xfe, 0xff, 0x82, 0x1b, 0xe7, 0xaa, 0x4a, 0x08, 0xa4, 0x00, 0x03, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xc4, 0x00, 0x81, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x06, 0xa4, 0x00,
+  0x08, 0xc4, 0x00, 0x83, 0x6e, 0x6b, 0x3c, 0xe7, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x82, 0xcf, 0x73, 0xa4, 0x00, 0x02, 0xa3, 0x00, 0x87, 0x43, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x99, 0xce, 0xe7, 0x00,
+  0x06, 0x01, 0x07, 0x01, 0x04, 0xe6, 0x00, 0x82, 0xe7, 0x00, 0x07, 0x01, 0x02, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x83, 0xe6, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x02, 0x83, 0x00, 0x8d, 0x8c, 0x42, 0x99,
+  0x8d, 0x60, 0x3a, 0x10, 0xa6, 0xea, 0x8d, 0x10, 0xc7, 0xb7, 0xc7, 0x15, 0xcf, 0x94, 0xdf, 0x10, 0xcf, 0x15, 0xa6, 0xa8, 0x29, 0x83, 0x00, 0x03, 0x84, 0x00, 0x03, 0xe6, 0x00, 0x86, 0xc6, 0x00,
+  0xc5, 0x00, 0xc6, 0x00, 0xc5, 0x00, 0x91, 0x8c, 0xde, 0xf7, 0x03, 0xfe, 0xff, 0x86, 0x79, 0xce, 0xa4, 0x00, 0x83, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xdf, 0xff, 0x09, 0xfe, 0xff, 0x82, 0x05, 0x11,
+  0xa3, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xd6, 0xb5, 0x04, 0xa4, 0x00, 0x81, 0xda, 0xde, 0x06, 0xfe, 0xff, 0x81, 0xab, 0x52, 0x12, 0xa4, 0x00, 0x03, 0x84, 0x00,
+  0x02, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x84, 0x00, 0xa4, 0x00, 0xa3, 0x00, 0x02, 0x83, 0x00, 0x81, 0x84, 0x00, 0x04, 0xa4, 0x00, 0x82, 0xec, 0x52, 0xff, 0xff, 0x05, 0xfe,
+  0xff, 0x81, 0xcf, 0x73, 0x03, 0xa4, 0x00, 0x81, 0x63, 0x00, 0x02, 0xff, 0xff, 0x81, 0xda, 0xd6, 0x02, 0xe7, 0x00, 0x03, 0xe6, 0x00, 0x84, 0xe7, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0x07, 0x01, 0x02,
+  0xe7, 0x00, 0x02, 0x07, 0x01, 0x92, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa3, 0x00, 0x83, 0x00, 0x30, 0x4b, 0xc2, 0x42, 0x40, 0x53, 0x84, 0x65, 0xa9, 0x8d, 0xef, 0xbe, 0x97, 0xd7, 0x14, 0xd7,
+  0x71, 0xbe, 0x8e, 0xd7, 0x94, 0xb6, 0xa8, 0x21, 0x83, 0x00, 0x02, 0x84, 0x00, 0x84, 0x83, 0x00, 0xc5, 0x00, 0xe7, 0x00, 0xe6, 0x00, 0x03, 0xc6, 0x00, 0x89, 0xc5, 0x00, 0xe5, 0x00, 0x8e, 0x6b,
+  0x7d, 0xef, 0xff, 0xff, 0xfe, 0xff, 0x78, 0xce, 0x83, 0x00, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xff, 0xff, 0x09, 0xfe, 0xff, 0x81, 0x05, 0x11, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe,
+  0xff, 0x81, 0xf6, 0xbd, 0x04, 0xa4, 0x00, 0x81, 0xda, 0xd6, 0x06, 0xfe, 0xff, 0x81, 0xec, 0x5a, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x81, 0x83, 0x00, 0x05, 0x84, 0x00, 0x06, 0xa4, 0x00, 0x06,
+  0x84, 0x00, 0x81, 0x83, 0x00, 0x03, 0x84, 0x00, 0x82, 0xa4, 0x00, 0x84, 0x00, 0x03, 0x83, 0x00, 0x02, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x84, 0x00, 0x2c, 0x5b, 0xff, 0xff, 0x05, 0xfe, 0xff,
+  0x81, 0xaf, 0x73, 0x03, 0xa4, 0x00, 0x81, 0x83, 0x00, 0x02, 0xff, 0xff, 0x82, 0xfb, 0xde, 0xe6, 0x00, 0x02, 0xe7, 0x00, 0x03, 0xe6, 0x00, 0x03, 0xe7, 0x00, 0x04, 0x07, 0x01, 0x04, 0xa4, 0x00,
+  0x8d, 0xc4, 0x00, 0x3d, 0xae, 0xc1, 0x4c, 0xaf, 0xa5, 0x64, 0x65, 0x46, 0xa6, 0xaf, 0xbe, 0x53, 0xd7, 0x75, 0xdf, 0x34, 0xd7, 0xf1, 0xc6, 0xb2, 0xbb, 0xf2, 0x6b, 0x02, 0x83, 0x00, 0x83, 0x84,
+  0x00, 0x83, 0x00, 0xa4, 0x00, 0x02, 0xe6, 0x00, 0x04, 0xc6, 0x00, 0x87, 0xc5, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xba, 0xd6, 0xff, 0xff, 0x38, 0xc6, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xff, 0xff,
+  0x09, 0xfe, 0xff, 0x81, 0xe5, 0x08, 0x03, 0xa4, 0x00, 0x81, 0x25, 0x19, 0x0a, 0xfe, 0xff, 0x81, 0xf7, 0xbd, 0x04, 0xa4, 0x00, 0x81, 0xda, 0xd6, 0x06, 0xfe, 0xff, 0x83, 0x1b, 0xe7, 0x87, 0x29,
+  0x23, 0x00, 0x04, 0x02, 0x00, 0x81, 0x22, 0x00, 0x02, 0x02, 0x00, 0x02, 0x22, 0x00, 0x02, 0x23, 0x00, 0x81, 0x43, 0x00, 0x04, 0x23, 0x00, 0x04, 0x03, 0x00, 0x83, 0x02, 0x00, 0x22, 0x00, 0x03,
+  0x00, 0x02, 0x23, 0x00, 0x03, 0x03, 0x00, 0x82, 0x02, 0x00, 0x03, 0x00, 0x02, 0x23, 0x00, 0x83, 0x02, 0x00, 0x49, 0x42, 0x5c, 0xe7, 0x06, 0xfe, 0xff, 0x81, 0xcf, 0x73, 0x03, 0xa4, 0x00, 0x81,
+  0x83, 0x00, 0x02, 0xff, 0xff, 0x81, 0x1c, 0xdf, 0x02, 0xe6, 0x00, 0x81, 0xe7, 0x00, 0x03, 0xe6, 0x00, 0x03, 0xe7, 0x00, 0x03, 0x07, 0x01, 0x81, 0xe6, 0x00, 0x04, 0xa4, 0x00, 0x8e, 0x6b, 0x3a,
+  0x9c, 0x95, 0xa0, 0x54, 0xd1, 0xbe, 0x2e, 0xae, 0x2e, 0xcf, 0x4f, 0xb6, 0x12, 0xcf, 0x4d, 0xae, 0x2c, 0x9e, 0x03, 0x86, 0xe1, 0xae, 0x9c, 0xbe, 0x06, 0x11, 0x04, 0x83, 0x00, 0x02, 0xe6, 0x00,
+  0x83, 0xc6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x84, 0xba, 0xce, 0xff, 0xff, 0x38, 0xc6, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc5, 0x00, 0x0a, 0xfe, 0xff, 0x81,
+  0x05, 0x11, 0x03, 0xa4, 0x00, 0x82, 0x25, 0x19, 0xff, 0xff, 0x09, 0xfe, 0xff, 0x82, 0x17, 0xbe, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xda, 0xd6, 0x06, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x02, 0xbe,
+  0xf7, 0x07, 0xde, 0xf7, 0x03, 0xde, 0xff, 0x82, 0xbe, 0xf7, 0xbe, 0xff, 0x02, 0xbe, 0xf7, 0x82, 0xbd, 0xf7, 0xbe, 0xf7, 0x02, 0xde, 0xf7, 0x02, 0xbe, 0xf7, 0x81, 0xbd, 0xf7, 0x07, 0xde, 0xff,
+  0x02, 0xde, 0xf7, 0x02, 0xbe, 0xf7, 0x08, 0xfe, 0xff, 0x81, 0xcf, 0x73, 0x03, 0xa4, 0x00, 0x84, 0x83, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x3c, 0xdf, 0x02, 0xe6, 0x00, 0x81, 0xe7, 0x00, 0x04, 0xe6,
+  0x00, 0x03, 0xe7, 0x00, 0x83, 0x07, 0x01, 0x28, 0x01, 0xe5, 0x00, 0x03, 0xa4, 0x00, 0x8f, 0x83, 0x00, 0x8f, 0x5b, 0xc8, 0x5c, 0x46, 0x7d, 0x00, 0x7e, 0x52, 0xd7, 0x0f, 0xae, 0xb2, 0xc6, 0x72,
+  0xd7, 0xae, 0xb6, 0x14, 0xcf, 0x10, 0xcf, 0xab, 0xae, 0xe9, 0x5d, 0x6b, 0x42, 0x04, 0x83, 0x00, 0x81, 0xa5, 0x00, 0x03, 0xe6, 0x00, 0x81, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x85, 0x06, 0x01, 0x1b,
+  0xdf, 0xff, 0xff, 0x38, 0xc6, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xe5, 0x00, 0x09, 0xfe, 0xff, 0x83, 0xff, 0xff, 0x25, 0x19, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x82, 0x04, 0x11, 0xff, 0xff, 0x09,
+  0xfe, 0xff, 0x81, 0x18, 0xc6, 0x04, 0xa4, 0x00, 0x81, 0xda, 0xde, 0x07, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x06, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x11, 0xfe, 0xff,
+  0x81, 0xaf, 0x73, 0x03, 0xa4, 0x00, 0x81, 0x83, 0x00, 0x02, 0xff, 0xff, 0x82, 0x1c, 0xdf, 0xe6, 0x00, 0x02, 0xe7, 0x00, 0x03, 0xe6, 0x00, 0x02, 0xe7, 0x00, 0x04, 0x07, 0x01, 0x81, 0xa4, 0x00,
+  0x02, 0x83, 0x00, 0x92, 0xa4, 0x00, 0x25, 0x11, 0x1c, 0xaf, 0xcf, 0xa6, 0x31, 0xcf, 0x2f, 0xc7, 0xad, 0xb6, 0x91, 0xc6, 0x34, 0xd7, 0x34, 0xcf, 0xac, 0xb6, 0x0f, 0xcf, 0x13, 0xcf, 0xe9, 0xbe,
+  0x87, 0x95, 0xb3, 0x84, 0x83, 0x00, 0x84, 0x00, 0x03, 0x83, 0x00, 0x82, 0xe6, 0x00, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x86, 0xe6, 0x00, 0x06, 0x01, 0x3c, 0xe7, 0xff, 0xff, 0x18,
+  0xbe, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc5, 0x00, 0x0a, 0xfe, 0xff, 0x82, 0x2d, 0x63, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xa3, 0x00, 0x9d, 0xf7, 0x09, 0xfe, 0xff, 0x81, 0x95, 0xad, 0x04,
+  0xa4, 0x00, 0x81, 0x3c, 0xe7, 0x07, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x25, 0xfe, 0xff, 0x81, 0xaf, 0x6b, 0x02, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x83, 0x00, 0x02, 0xff, 0xff, 0x82, 0xfb, 0xde, 0xe7,
+  0x00, 0x02, 0x07, 0x01, 0x02, 0xe6, 0x00, 0x83, 0xe7, 0x00, 0x07, 0x01, 0xe7, 0x00, 0x03, 0x07, 0x01, 0x83, 0xe6, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x02, 0xa3, 0x00, 0x90, 0x0e, 0x53, 0x9b, 0xaf,
+  0x8e, 0xd7, 0x12, 0xcf, 0x92, 0xc6, 0x92, 0xbe, 0x90, 0xbe, 0x8e, 0xb6, 0x53, 0xcf, 0xc3, 0xd7, 0xe1, 0xdf, 0xab, 0xd7, 0xe7, 0xdf, 0x50, 0xcf, 0xf8, 0xbe, 0x46, 0x21, 0x04, 0x83, 0x00, 0x82,
+  0xc5, 0x00, 0x07, 0x01, 0x05, 0xe6, 0x00, 0x88, 0x06, 0x01, 0x5c, 0xe7, 0xff, 0xff, 0xf7, 0xbd, 0x83, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x0a, 0xfe, 0xff, 0x82, 0x75, 0xad, 0x83, 0x00,
+  0x02, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x18, 0xbe, 0x09, 0xfe, 0xff, 0x81, 0xcb, 0x52, 0x03, 0xa4, 0x00, 0x82, 0x05, 0x11, 0xde, 0xff, 0x06, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xb6, 0xb5, 0x02, 0x92,
+  0x8c, 0x89, 0xb2, 0x8c, 0xd3, 0x94, 0xb2, 0x94, 0x92, 0x8c, 0x92, 0x94, 0xb2, 0x94, 0xd3, 0x94, 0xf3, 0x9c, 0x14, 0x9d, 0x02, 0x54, 0xa5, 0x02, 0x75, 0xad, 0x0d, 0x95, 0xad, 0x82, 0x95, 0xb5,
+  0x96, 0xb5, 0x03, 0xb6, 0xb5, 0x82, 0xd6, 0xbd, 0x99, 0xd6, 0x02, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x81, 0xaf, 0x73, 0x02, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x04, 0x11, 0x02, 0xff, 0xff, 0x82, 0xdb,
+  0xd6, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x02, 0xe6, 0x00, 0x81, 0x06, 0x01, 0x03, 0xe7, 0x00, 0x84, 0x07, 0x01, 0x08, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0x02, 0x83, 0x00, 0x91, 0xa3, 0x00, 0x77, 0x8d,
+  0xd8, 0xcf, 0x33, 0xcf, 0x56, 0xdf, 0x93, 0xdf, 0x14, 0xd7, 0x14, 0xc7, 0x56, 0x47, 0xf1, 0xc6, 0x70, 0xbe, 0xf3, 0xce, 0x6f, 0xb6, 0x4d, 0xcf, 0x8f, 0xae, 0x86, 0xa6, 0x70, 0x53, 0x04, 0x83,
+  0x00, 0x82, 0xa4, 0x00, 0xe7, 0x00, 0x02, 0xe6, 0x00, 0x81, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x88, 0x07, 0x01, 0x7c, 0xe7, 0xff, 0xff, 0xf7, 0xb5, 0x83, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xc4, 0x00,
+  0x0a, 0xfe, 0xff, 0x82, 0x5c, 0xe7, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x49, 0x42, 0xbe, 0xf7, 0x07, 0xfe, 0xff, 0x82, 0x18, 0xbe, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0x71, 0x8c,
+  0x07, 0xfe, 0xff, 0x81, 0x92, 0x94, 0x1f, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x02, 0xa4, 0x00, 0x83, 0x83, 0x00, 0x55, 0xa5, 0xff, 0xff, 0x05, 0xfe, 0xff, 0x81, 0xd0, 0x73, 0x02, 0xa4, 0x00, 0x82,
+  0x84, 0x00, 0xa6, 0x29, 0x02, 0xff, 0xff, 0x85, 0xba, 0xd6, 0xe7, 0x00, 0x06, 0x01, 0x07, 0x01, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x05, 0x07, 0x01, 0x82, 0xa4, 0x00, 0x84, 0x00, 0x02, 0x83, 0x00,
+  0x8c, 0xc9, 0x29, 0x1f, 0xb7, 0x79, 0xef, 0xb6, 0xdf, 0x96, 0xe7, 0xb6, 0xe7, 0x32, 0xcf, 0x57, 0xcf, 0x7a, 0x9f, 0x35, 0xd7, 0x1c, 0xe7, 0xe9, 0xbe, 0x02, 0x74, 0xdf, 0x84, 0xf2, 0xc6, 0x20,
+  0x65, 0x79, 0x96, 0xe5, 0x08, 0x03, 0x83, 0x00, 0x82, 0x84, 0x00, 0xe6, 0x00, 0x04, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x87, 0xbd, 0xef, 0xff, 0xff, 0xf7, 0xbd, 0x83, 0x00, 0xa3, 0x00, 0xa4, 0x00,
+  0xc4, 0x00, 0x0b, 0xfe, 0xff, 0x81, 0xcf, 0x73, 0x04, 0xa4, 0x00, 0x83, 0x8e, 0x6b, 0x9d, 0xef, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x82, 0x18, 0xbe, 0xe5, 0x08, 0x02, 0xa4, 0x00, 0x83, 0x84, 0x00,
+  0xa3, 0x00, 0x3c, 0xe7, 0x07, 0xfe, 0xff, 0x81, 0x08, 0x3a, 0x14, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x02,
+  0xc4, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xe8, 0x29, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xaf, 0x6b, 0x03, 0xa4, 0x00, 0x81, 0xa7, 0x29, 0x02, 0xff, 0xff, 0x82, 0x99, 0xce, 0xe7, 0x00,
+  0x02, 0xe6, 0x00, 0x03, 0xe7, 0x00, 0x03, 0x07, 0x01, 0x99, 0x28, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x83, 0x00, 0xb0, 0x5b, 0x7f, 0xc7, 0xdb, 0xdf, 0xf6, 0xb7, 0xb4, 0xc7,
+  0xf5, 0xef, 0xd7, 0xef, 0xf8, 0xef, 0x9d, 0xe7, 0x53, 0xc7, 0x14, 0xa7, 0xf2, 0xae, 0x67, 0xa6, 0xcd, 0xdf, 0xca, 0x85, 0x40, 0x7d, 0x4d, 0x4e, 0xad, 0x42, 0x63, 0x00, 0x03, 0x83, 0x00, 0x81,
+  0xc4, 0x00, 0x03, 0x06, 0x01, 0x83, 0xe6, 0x00, 0x06, 0x01, 0x2f, 0x7c, 0x02, 0xfe, 0xff, 0x85, 0x17, 0xbe, 0x83, 0x00, 0x84, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0x0b, 0xfe, 0xff, 0x82, 0x3c, 0xe7,
+  0xc4, 0x00, 0x03, 0xa4, 0x00, 0x87, 0x83, 0x00, 0x46, 0x21, 0xd3, 0x94, 0x58, 0xc6, 0xba, 0xd6, 0xf7, 0xbd, 0x2d, 0x5b, 0x05, 0xa4, 0x00, 0x81, 0x71, 0x8c, 0x08, 0xfe, 0xff, 0x81, 0xd6, 0xb5,
+  0x06, 0xa4, 0x00, 0x82, 0x84, 0x00, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x02, 0xa5, 0x00, 0x02, 0xa4, 0x00, 0x07, 0x84, 0x00, 0x0a, 0xa4, 0x00, 0x82, 0x75, 0xad, 0xff, 0xff, 0x04,
+  0xfe, 0xff, 0x82, 0xff, 0xff, 0xaf, 0x6b, 0x03, 0xa4, 0x00, 0x85, 0x86, 0x29, 0xff, 0xff, 0xfe, 0xff, 0x58, 0xc6, 0xc7, 0x00, 0x04, 0xe6, 0x00, 0x81, 0xe7, 0x00, 0x04, 0x07, 0x01, 0x81, 0xa4,
+  0x00, 0x03, 0x84, 0x00, 0x93, 0x25, 0x11, 0x9d, 0xae, 0xfd, 0xe7, 0xdb, 0xe7, 0xf7, 0xd7, 0xf8, 0xe7, 0xb6, 0xe7, 0x77, 0xef, 0xd8, 0xe7, 0xb8, 0xc7, 0x31, 0xaf, 0x73, 0x9f, 0x12, 0xaf, 0xd3,
+  0xe7, 0x50, 0xcf, 0x92, 0xbe, 0x8a, 0x8d, 0xc6, 0x4d, 0x35, 0x64, 0x02, 0x63, 0x00, 0x02, 0x83, 0x00, 0x87, 0x84, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x06, 0x01, 0xe6, 0x00, 0x69, 0x42, 0xbd, 0xf7,
+  0x02, 0xfe, 0xff, 0x81, 0x17, 0xc6, 0x02, 0x84, 0x00, 0x82, 0xa4, 0x00, 0xc4, 0x00, 0x0c, 0xfe, 0xff, 0x83, 0x95, 0xad, 0x84, 0x00, 0xa3, 0x00, 0x05, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x05, 0xa4,
+  0x00, 0x82, 0x46, 0x21, 0x9d, 0xef, 0x09, 0xfe, 0xff, 0x83, 0xfb, 0xd6, 0xd7, 0xb5, 0xb6, 0xb5, 0x02, 0xb6, 0xad, 0x03, 0x95, 0xad, 0x81, 0xb6, 0xad, 0x02, 0xb6, 0xb5, 0x82, 0x96, 0xb5, 0x95,
+  0xad, 0x04, 0x75, 0xad, 0x82, 0x74, 0xad, 0x54, 0xad, 0x04, 0x54, 0xa5, 0x81, 0x74, 0xad, 0x05, 0x75, 0xad, 0x02, 0x95, 0xad, 0x03, 0x75, 0xad, 0x82, 0xb5, 0xb5, 0x78, 0xce, 0x06, 0xfe, 0xff,
+  0x82, 0xff, 0xff, 0xaf, 0x6b, 0x03, 0xa4, 0x00, 0x85, 0x86, 0x29, 0xff, 0xff, 0xfe, 0xff, 0x17, 0xbe, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x02, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x9a,
+  0xc5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x0d, 0x4b, 0xbe, 0xb6, 0x9c, 0xef, 0xfc, 0xef, 0x94, 0xdf, 0xd5, 0xe7, 0xb4, 0xdf, 0x3b, 0xe7, 0xba, 0xd7, 0x94, 0xa7, 0x72, 0xcf,
+  0x0a, 0x86, 0x2e, 0x9e, 0x68, 0xcf, 0xd4, 0xe7, 0x92, 0xdf, 0x75, 0xdf, 0x51, 0xcf, 0x71, 0x9f, 0xea, 0x31, 0x63, 0x00, 0x03, 0x83, 0x00, 0x85, 0xc4, 0x00, 0x27, 0x01, 0x07, 0x01, 0x26, 0x01,
+  0xd9, 0xd6, 0x02, 0xfd, 0xff, 0x83, 0xfe, 0xff, 0xd6, 0xbd, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x0d, 0xfe, 0xff, 0x82, 0x30, 0x7c, 0x83, 0x00, 0x0c, 0xa4, 0x00, 0x81, 0xb1, 0x7c,
+  0x35, 0xfe, 0xff, 0x81, 0xaf, 0x6b, 0x02, 0xa4, 0x00, 0x86, 0x84, 0x00, 0x86, 0x29, 0xff, 0xff, 0xfe, 0xff, 0xb7, 0xb5, 0xe7, 0x00, 0x06, 0xe6, 0x00, 0x83, 0x07, 0x01, 0x06, 0x01, 0xa4, 0x00,
+  0x02, 0xa3, 0x00, 0x02, 0xa4, 0x00, 0x95, 0x99, 0x9d, 0xb7, 0xb5, 0x39, 0xaf, 0x17, 0x97, 0x97, 0xe7, 0xb4, 0xe7, 0x94, 0xdf, 0x77, 0xdf, 0x98, 0xe7, 0x54, 0xcf, 0x25, 0x8d, 0x6d, 0xcf, 0x30,
+  0xcf, 0x54, 0xd7, 0x97, 0xdf, 0x76, 0xdf, 0x56, 0xdf, 0x55, 0xdf, 0x84, 0x65, 0x54, 0x74, 0x63, 0x00, 0x03, 0x83, 0x00, 0x84, 0xa3, 0x00, 0x06, 0x01, 0x07, 0x01, 0xaa, 0x4a, 0x03, 0xfd, 0xff,
+  0x82, 0x58, 0xc6, 0xe4, 0x08, 0x03, 0xa5, 0x00, 0x81, 0xc4, 0x00, 0x0c, 0xfe, 0xff, 0x84, 0xfd, 0xff, 0xfe, 0xff, 0x10, 0x7c, 0x83, 0x00, 0x03, 0x84, 0x00, 0x06, 0xa4, 0x00, 0x83, 0xc4, 0x00,
+  0x87, 0x01, 0xd4, 0x75, 0x2d, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x07, 0xfe, 0xff, 0x81, 0xaf, 0x6b, 0x02, 0xa4, 0x00, 0x86, 0x84, 0x00, 0x65, 0x21, 0xff, 0xff, 0xfe, 0xff, 0x75, 0xa5, 0xe7, 0x00,
+  0x03, 0xe6, 0x00, 0x81, 0x07, 0x01, 0x02, 0xe6, 0x00, 0x83, 0x07, 0x01, 0xc5, 0x00, 0xa4, 0x00, 0x03, 0xa3, 0x00, 0x89, 0xcc, 0x4a, 0x1f, 0xcf, 0x5c, 0xf7, 0xbc, 0xd7, 0x9b, 0xe7, 0x35, 0xdf,
+  0x75, 0xdf, 0xf3, 0xe7, 0xd7, 0xef, 0x02, 0x76, 0xdf, 0x8d, 0x8a, 0x9d, 0x51, 0xbe, 0x0f, 0xc7, 0x32, 0xcf, 0xbc, 0xe7, 0x9d, 0xe7, 0x7c, 0xef, 0x58, 0xda, 0x38, 0xed, 0x7b, 0xc6, 0xc8, 0x29,
+  0x63, 0x00, 0x83, 0x00, 0x02, 0xa3, 0x00, 0x88, 0xc4, 0x00, 0x47, 0x01, 0x58, 0xc6, 0xfd, 0xff, 0xfe, 0xff, 0xfa, 0xde, 0xc5, 0x00, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x81, 0xa4, 0x00, 0x0c, 0xfe,
+  0xff, 0x85, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x74, 0xb5, 0x05, 0x19, 0x04, 0x83, 0x00, 0x02, 0x84, 0x00, 0x85, 0xa4, 0x00, 0x24, 0x01, 0xcb, 0x02, 0x4f, 0x03, 0xbd, 0xef, 0x0b, 0xfe, 0xff,
+  0x05, 0xff, 0xff, 0x18, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x02, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x07, 0xfe, 0xff, 0x81, 0x0e, 0x53, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x21, 0x02, 0xff, 0xff, 0x82, 0x34,
+  0x9d, 0xe7, 0x00, 0x02, 0x07, 0x01, 0x02, 0xe6, 0x00, 0x02, 0x07, 0x01, 0x82, 0xe6, 0x00, 0x84, 0x00, 0x03, 0xa3, 0x00, 0x99, 0xc4, 0x08, 0x1b, 0xc6, 0xdc, 0xcf, 0x3a, 0xd7, 0x5d, 0xf7, 0xfa,
+  0xf6, 0x36, 0xd7, 0xb5, 0xe7, 0xd5, 0xe7, 0xf7, 0xef, 0x96, 0xe7, 0xd5, 0xe7, 0x4f, 0xb6, 0x2f, 0xae, 0xb2, 0xdf, 0x94, 0xdf, 0xdd, 0xef, 0x9d, 0xef, 0x7c, 0xe7, 0x76, 0xbe, 0xb7, 0xbd, 0x9d,
+  0xc5, 0x97, 0x95, 0xa4, 0x08, 0x83, 0x00, 0x03, 0xa3, 0x00, 0x88, 0x06, 0x01, 0x9c, 0xf7, 0xfd, 0xff, 0xdd, 0xff, 0x8e, 0x6b, 0xe5, 0x00, 0xc5, 0x00, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x81, 0xa4,
+  0x00, 0x0e, 0xfe, 0xff, 0x8d, 0xdd, 0xff, 0xf9, 0xfe, 0x08, 0x9b, 0x03, 0x29, 0x82, 0x08, 0x82, 0x00, 0x03, 0x09, 0x46, 0x19, 0xa8, 0x11, 0x6f, 0x03, 0x32, 0x04, 0xaf, 0x03, 0xb9, 0xc6, 0x0a,
+  0xfe, 0xff, 0x82, 0x7c, 0xef, 0x8e, 0x73, 0x02, 0x8a, 0x4a, 0x81, 0xaa, 0x4a, 0x07, 0xab, 0x52, 0x03, 0xaa, 0x4a, 0x0b, 0xab, 0x52, 0x06, 0xcb, 0x52, 0x03, 0xab, 0x52, 0x84, 0x29, 0x3a, 0x6d,
+  0x63, 0x5d, 0xe7, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xde, 0xff, 0xa6, 0x00, 0x03, 0xa4, 0x00, 0x81, 0x45, 0x21, 0x02, 0xff, 0xff, 0x82, 0x34, 0x9d, 0xe7, 0x00, 0x05, 0x07, 0x01, 0x83, 0x27,
+  0x01, 0xc4, 0x00, 0xa4, 0x00, 0x02, 0xa3, 0x00, 0x9b, 0x83, 0x00, 0x6f, 0x63, 0x1f, 0xe7, 0x9e, 0xdf, 0xdd, 0xe7, 0xfd, 0xef, 0xda, 0xf6, 0x95, 0xdf, 0xd5, 0xe7, 0xf5, 0xef, 0xd8, 0xef, 0xd9,
+  0xef, 0xb6, 0xe7, 0x8c, 0x95, 0xcc, 0x95, 0x11, 0xc7, 0x13, 0xcf, 0xbd, 0xef, 0xfb, 0xde, 0x3b, 0xe6, 0x0d, 0xbf, 0xeb, 0x8d, 0x12, 0x7c, 0x3a, 0xbe, 0x4a, 0x32, 0x83, 0x00, 0xa4, 0x00, 0x02,
+  0xa3, 0x00, 0x81, 0xe8, 0x39, 0x02, 0xdd, 0xff, 0x83, 0x9c, 0xf7, 0xc5, 0x00, 0xe6, 0x00, 0x04, 0xa5, 0x00, 0x82, 0x84, 0x00, 0xde, 0xf7, 0x0e, 0xfe, 0xff, 0x8b, 0xbc, 0xff, 0xee, 0xdc, 0xc6,
+  0x91, 0x20, 0x51, 0x20, 0x19, 0xea, 0x23, 0xfe, 0xb6, 0xde, 0xb6, 0xde, 0xa6, 0xde, 0x8e, 0x7c, 0xd7, 0x0b, 0xfe, 0xff, 0x82, 0xae, 0x73, 0xc5, 0x00, 0x03, 0xc4, 0x00, 0x81, 0xc5, 0x00, 0x04,
+  0xc4, 0x00, 0x16, 0xa4, 0x00, 0x82, 0xc4, 0x00, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x83, 0xc4, 0x00, 0xec, 0x52, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xfb, 0xde, 0xc5, 0x00, 0x03, 0xa4, 0x00, 0x85,
+  0xc3, 0x10, 0xfe, 0xff, 0xff, 0xff, 0x35, 0x9d, 0xe7, 0x00, 0x03, 0x07, 0x01, 0x02, 0x27, 0x01, 0x81, 0x06, 0x01, 0x02, 0xa4, 0x00, 0x86, 0xa3, 0x00, 0x83, 0x00, 0xe5, 0x10, 0x7d, 0xce, 0xbc,
+  0xef, 0x5f, 0xe7, 0x02, 0x9c, 0xe7, 0x9f, 0xbb, 0xef, 0x96, 0xe7, 0xd5, 0xe7, 0xb8, 0xef, 0x96, 0xe7, 0xd7, 0xe7, 0xf4, 0xe7, 0x46, 0x64, 0x07, 0x85, 0x70, 0xb6, 0xd3, 0xc6, 0xcf, 0xc6, 0x16,
+  0xd7, 0xbd, 0xef, 0xf5, 0xe7, 0x13, 0xcf, 0xab, 0xd7, 0xee, 0xee, 0x57, 0xbf, 0x66, 0x19, 0x83, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0x8e, 0x73, 0xdd, 0xff, 0xdc, 0xff, 0x58, 0xce, 0xc5, 0x00, 0xe6,
+  0x00, 0xc5, 0x00, 0xa4, 0x00, 0x02, 0xa5, 0x00, 0x82, 0x84, 0x00, 0x1b, 0xdf, 0x0f, 0xfe, 0xff, 0x89, 0xdd, 0xff, 0x38, 0xff, 0x16, 0xee, 0x7d, 0xc6, 0x1f, 0xd7, 0x7f, 0xd7, 0x7f, 0xdf, 0xdf,
+  0xe7, 0xfe, 0xf7, 0x0c, 0xfe, 0xff, 0x81, 0xeb, 0x5a, 0x04, 0xc4, 0x00, 0x11, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x04, 0x84, 0x00, 0x04, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x84, 0xa4,
+  0x00, 0xc4, 0x00, 0x08, 0x3a, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x82, 0xb3, 0x8c, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x84, 0x62, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x55, 0xa5, 0x04, 0x07, 0x01, 0x82, 0x27,
+  0x01, 0x07, 0x01, 0x02, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x02, 0x83, 0x00, 0x9a, 0xb1, 0x73, 0x1f, 0xe7, 0xda, 0xef, 0x5c, 0xcf, 0xf8, 0xc7, 0xb7, 0xe7, 0xd5, 0xe7, 0xd6, 0xe7, 0xd7, 0xef, 0xd5,
+  0xef, 0xd7, 0xe7, 0xed, 0xdf, 0xd5, 0xe7, 0x6e, 0x9d, 0x2d, 0xae, 0x52, 0xb6, 0xd3, 0xc6, 0x90, 0xd7, 0x76, 0xdf, 0xd8, 0xce, 0x94, 0xdf, 0x13, 0xcf, 0x53, 0xd7, 0x73, 0xee, 0x94, 0xe7, 0x92,
+  0x6c, 0x03, 0xa4, 0x00, 0x86, 0x6d, 0x6b, 0xdd, 0xff, 0xdc, 0xff, 0x0a, 0x63, 0x84, 0x00, 0xc5, 0x00, 0x04, 0xa4, 0x00, 0x82, 0x84, 0x00, 0x54, 0xa5, 0x10, 0xfe, 0xff, 0x03, 0xfd, 0xff, 0x11,
+  0xfe, 0xff, 0x82, 0xb9, 0xd6, 0x83, 0x00, 0x0a, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x0b, 0xa4, 0x00, 0x81, 0xa3, 0x00, 0x03, 0xa4, 0x00, 0x86, 0x84, 0x00, 0xa4,
+  0x00, 0xc4, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xd9, 0xd6, 0x04, 0xfe, 0xff, 0x83, 0x7c, 0xef, 0x05, 0x11, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x84, 0x62, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x76, 0xa5, 0x04,
+  0x07, 0x01, 0xa9, 0x27, 0x01, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa3, 0x00, 0x83, 0x00, 0x2a, 0x32, 0x1f, 0xd7, 0x5f, 0xe7, 0xfa, 0xef, 0xbb, 0xd7, 0xf7, 0xc7, 0x76, 0xdf, 0x96, 0xe7, 0x35,
+  0xd7, 0xb7, 0xe7, 0x96, 0xe7, 0xd6, 0xe7, 0x97, 0xe7, 0xf4, 0xef, 0xac, 0x95, 0x8a, 0x95, 0xac, 0xae, 0x0d, 0x96, 0xda, 0xd6, 0x34, 0xb6, 0x94, 0xdf, 0x50, 0xcf, 0x2d, 0xc7, 0x4f, 0xcf, 0x93,
+  0xdf, 0xf4, 0xef, 0xbb, 0xdf, 0xec, 0x4a, 0x84, 0x00, 0xc4, 0x00, 0x08, 0x3a, 0xbc, 0xff, 0x18, 0xf7, 0xa2, 0x08, 0x43, 0x00, 0x03, 0x84, 0x00, 0x03, 0x83, 0x00, 0x82, 0x86, 0x29, 0xbd, 0xf7,
+  0x24, 0xfe, 0xff, 0x81, 0x3b, 0xe7, 0x02, 0x58, 0xbe, 0x81, 0x58, 0xc6, 0x05, 0x78, 0xc6, 0x85, 0x58, 0xc6, 0x57, 0xc6, 0x57, 0xbe, 0x57, 0xc6, 0x58, 0xc6, 0x05, 0x78, 0xc6, 0x04, 0x98, 0xce,
+  0x02, 0x99, 0xce, 0x83, 0xb9, 0xce, 0xb9, 0xd6, 0xb9, 0xce, 0x06, 0xb9, 0xd6, 0x82, 0xda, 0xd6, 0x9c, 0xef, 0x05, 0xfe, 0xff, 0x81, 0xce, 0x73, 0x05, 0xa4, 0x00, 0x85, 0x82, 0x00, 0xfe, 0xff,
+  0xff, 0xff, 0x18, 0xb6, 0x08, 0x01, 0x03, 0x07, 0x01, 0x81, 0xe6, 0x00, 0x02, 0xa4, 0x00, 0x02, 0xa3, 0x00, 0x8a, 0xe5, 0x10, 0x3b, 0xbe, 0xde, 0xef, 0xfd, 0xf7, 0xd9, 0xef, 0xf9, 0xef, 0xb5,
+  0xe7, 0xb8, 0xe7, 0xb8, 0xef, 0xd8, 0xef, 0x03, 0xf7, 0xef, 0x91, 0x95, 0xdf, 0xd3, 0xe7, 0xce, 0x8e, 0x90, 0xbe, 0x10, 0xae, 0xf3, 0xbd, 0x31, 0xb6, 0x08, 0x75, 0xd0, 0xb6, 0x52, 0xd7, 0x72,
+  0xdf, 0x75, 0xdf, 0x53, 0xd7, 0x93, 0xdf, 0x90, 0xd7, 0xfc, 0xad, 0x88, 0x21, 0x02, 0xc5, 0x00, 0x88, 0xf5, 0xee, 0x0a, 0x9c, 0x41, 0x00, 0x61, 0x08, 0x73, 0xbd, 0xcb, 0x52, 0xa4, 0x00, 0x83,
+  0x00, 0x02, 0x84, 0x00, 0x83, 0x83, 0x00, 0x71, 0x8c, 0xff, 0xff, 0x29, 0xfe, 0xff, 0x83, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x1f, 0xfe, 0xff, 0x81, 0xb2, 0x94, 0x06, 0xa4, 0x00, 0x88, 0x83,
+  0x00, 0xff, 0xff, 0xfe, 0xff, 0x59, 0xc6, 0x08, 0x01, 0x27, 0x01, 0x28, 0x01, 0x07, 0x01, 0x03, 0xa4, 0x00, 0x8c, 0xa3, 0x00, 0x83, 0x00, 0x52, 0x7c, 0x7e, 0xf7, 0xfe, 0xf7, 0xfd, 0xf7, 0xf9,
+  0xf7, 0xf8, 0xef, 0xf5, 0xef, 0xb6, 0xe7, 0xd7, 0xef, 0x73, 0xdf, 0x02, 0x94, 0xdf, 0x94, 0xd8, 0xef, 0x75, 0xdf, 0xf6, 0xef, 0x4c, 0x6e, 0xeb, 0x9d, 0xd8, 0xce, 0x5c, 0xe7, 0x2a, 0xc7, 0xef,
+  0xbe, 0x53, 0xcf, 0x56, 0xdf, 0x55, 0xdf, 0xf5, 0xef, 0xd4, 0xe7, 0x2f, 0xce, 0x53, 0xbb, 0xb7, 0x42, 0xb0, 0x42, 0xc5, 0x00, 0xc4, 0x00, 0x02, 0x00, 0x29, 0x86, 0x20, 0x08, 0xf1, 0xac, 0xbd,
+  0xff, 0x4d, 0x6b, 0xa4, 0x00, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x02, 0x83, 0x00, 0x81, 0x14, 0x9d, 0x2a, 0xfe, 0xff, 0x06, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x06, 0xde, 0xff, 0x11, 0xfe, 0xff, 0x82,
+  0xbd, 0xf7, 0xef, 0x7b, 0x04, 0xa4, 0x00, 0x03, 0xc4, 0x00, 0x88, 0x83, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x79, 0xc6, 0x28, 0x01, 0x48, 0x01, 0x47, 0x01, 0xc5, 0x00, 0x02, 0xa4, 0x00, 0x84, 0x84,
+  0x00, 0x83, 0x00, 0x0d, 0x53, 0x7f, 0xdf, 0x02, 0xfe, 0xf7, 0x81, 0xdd, 0xf7, 0x02, 0xf8, 0xef, 0x83, 0xf7, 0xef, 0xf5, 0xef, 0xb4, 0xe7, 0x02, 0x75, 0xdf, 0x9b, 0x14, 0xd7, 0xb8, 0xe7, 0x8f,
+  0xd7, 0xf7, 0xef, 0xf6, 0xef, 0x36, 0xd7, 0x13, 0xcf, 0x30, 0xc7, 0xe9, 0xa5, 0x93, 0xbe, 0x37, 0xc6, 0x0e, 0xcf, 0xf6, 0xef, 0xf3, 0xe7, 0xfa, 0xf7, 0x5c, 0xe7, 0x56, 0xa5, 0x35, 0xa5, 0x25,
+  0x29, 0xab, 0x11, 0xa4, 0x00, 0x62, 0x00, 0x20, 0x10, 0x60, 0x18, 0x7b, 0xff, 0xbd, 0xff, 0x6a, 0x4a, 0x05, 0xa4, 0x00, 0x84, 0x84, 0x00, 0x83, 0x00, 0xcf, 0x73, 0x5c, 0xe7, 0x28, 0xfe, 0xff,
+  0x02, 0xde, 0xff, 0x81, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x02, 0xfe, 0xff, 0x04, 0xde, 0xff, 0x05, 0xfe, 0xff, 0x86, 0xfd,
+  0xff, 0xde, 0xff, 0x17, 0xbe, 0xe8, 0x31, 0xa5, 0x00, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xc4, 0x00, 0x87, 0x63, 0x00, 0xdf, 0xff, 0xfe, 0xff, 0x79, 0xc6, 0x29, 0x01, 0x48, 0x01, 0xe5, 0x00,
+  0x04, 0xa4, 0x00, 0xa8, 0x46, 0x19, 0x9d, 0xc6, 0xdd, 0xef, 0x39, 0xff, 0xf8, 0xf7, 0xf9, 0xf7, 0xf8, 0xf7, 0xf6, 0xef, 0xd7, 0xef, 0xb7, 0xe7, 0xd5, 0xe7, 0x52, 0xd7, 0x53, 0xd7, 0xd2, 0xb6,
+  0x52, 0xcf, 0xf2, 0xe7, 0x76, 0xdf, 0x6e, 0xcf, 0x51, 0xcf, 0xb3, 0xdf, 0xce, 0x9e, 0x52, 0xb6, 0x0e, 0xa5, 0xf9, 0xf6, 0x70, 0xdf, 0xb0, 0xbe, 0xf5, 0xef, 0xf8, 0xef, 0x7d, 0xf7, 0xba, 0xde,
+  0x57, 0xe1, 0x07, 0x01, 0x11, 0x1c, 0xa9, 0x01, 0x83, 0x00, 0x21, 0x00, 0x67, 0x62, 0x9b, 0xff, 0xbd, 0xff, 0x27, 0x21, 0x05, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x03, 0x83, 0x00, 0x82, 0x71, 0x8c,
+  0xda, 0xd6, 0x27, 0xfe, 0xff, 0x85, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x03, 0xfe, 0xff, 0x02, 0xde, 0xff, 0x07, 0xfe, 0xff, 0x02,
+  0xfd, 0xff, 0x85, 0xfe, 0xff, 0x5c, 0xef, 0xb6, 0xad, 0x6a, 0x42, 0xe5, 0x00, 0x02, 0xc5, 0x00, 0x02, 0xa4, 0x00, 0x82, 0xc4, 0x08, 0x05, 0x19, 0x03, 0xc4, 0x00, 0x87, 0x83, 0x00, 0xdf, 0xff,
+  0xff, 0xff, 0x59, 0xc6, 0x49, 0x01, 0xe6, 0x00, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0xaa, 0x83, 0x00, 0xa4, 0x00, 0xb6, 0x8c, 0x3f, 0xe7, 0xfb, 0xef, 0xb6, 0xf7, 0xf6, 0xef, 0xd4, 0xe7, 0xf6, 0xef,
+  0xd7, 0xef, 0xd9, 0xef, 0x92, 0xdf, 0xb6, 0xe7, 0x72, 0xd7, 0xf0, 0xc6, 0x72, 0xbe, 0x32, 0xcf, 0xb4, 0xe7, 0x74, 0xdf, 0x95, 0xe7, 0x12, 0xcf, 0x17, 0x9f, 0xba, 0x8f, 0xd2, 0x94, 0x90, 0xb5,
+  0x6e, 0xb6, 0x31, 0xcf, 0xb6, 0xe7, 0x95, 0xdf, 0xf9, 0xef, 0xdd, 0xef, 0x9d, 0xef, 0xb8, 0xcd, 0x4c, 0x29, 0x35, 0x0d, 0x1a, 0x56, 0xe8, 0x29, 0x21, 0x00, 0x30, 0xbd, 0x7b, 0xff, 0x9d, 0xff,
+  0xe6, 0x10, 0x02, 0xa4, 0x00, 0x85, 0x83, 0x00, 0x2d, 0x5b, 0xc4, 0x08, 0x84, 0x00, 0xa3, 0x00, 0x02, 0xa4, 0x00, 0x85, 0x84, 0x00, 0xa4, 0x00, 0xe4, 0x08, 0x6d, 0x63, 0x10, 0x7c, 0x02, 0x30,
+  0x84, 0x03, 0x31, 0x84, 0x04, 0x30, 0x84, 0x81, 0x10, 0x84, 0x06, 0x30, 0x84, 0x81, 0x10, 0x7c, 0x02, 0x10, 0x84, 0x06, 0x10, 0x7c, 0x81, 0x30, 0x84, 0x03, 0x31, 0x84, 0x02, 0x30, 0x84, 0x02,
+  0x10, 0x7c, 0x81, 0x0f, 0x7c, 0x02, 0xef, 0x73, 0x02, 0x10, 0x7c, 0x04, 0xef, 0x7b, 0x04, 0x10, 0x7c, 0x02, 0x10, 0x84, 0x08, 0x10, 0x7c, 0x81, 0x30, 0x84, 0x02, 0x31, 0x84, 0x83, 0x10, 0x7c,
+  0xaf, 0x6b, 0x26, 0x09, 0x02, 0x06, 0x01, 0x02, 0xe5, 0x00, 0x82, 0xc5, 0x00, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x82, 0x86, 0x39, 0xe8, 0x41, 0x03, 0xc4, 0x00, 0x86, 0x83, 0x00, 0xdf, 0xff, 0xfe,
+  0xff, 0x18, 0xbe, 0x27, 0x01, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0xaa, 0xa3, 0x00, 0x0f, 0x43, 0xbc, 0xce, 0x37, 0xff, 0xf6, 0xe7, 0xf7, 0xbf, 0xd8, 0xe7, 0xb7, 0xe7, 0xf7, 0xef, 0xb7, 0xef, 0x97,
+  0xe7, 0x74, 0xdf, 0x75, 0xdf, 0x8f, 0xae, 0x08, 0x8e, 0x0e, 0xa6, 0x47, 0xc7, 0xd1, 0xc6, 0xd2, 0xe7, 0xad, 0xb6, 0xb6, 0xc6, 0xf4, 0x8d, 0x14, 0x6e, 0x70, 0xbe, 0x70, 0xd7, 0xce, 0xdf, 0x6c,
+  0xae, 0x52, 0xcf, 0x96, 0xe7, 0xf9, 0xef, 0xfa, 0xef, 0xfd, 0xf7, 0x3b, 0xdf, 0x72, 0xbe, 0x35, 0xc7, 0xfc, 0xcf, 0xfa, 0xae, 0x29, 0x3a, 0x55, 0xd6, 0xbc, 0xff, 0xbe, 0xff, 0x06, 0x19, 0x02,
+  0xa4, 0x00, 0x84, 0x83, 0x00, 0xf4, 0x9c, 0x15, 0x9d, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x81, 0x83, 0x00, 0x08, 0x84, 0x00,
+  0x08, 0xa4, 0x00, 0x04, 0x84, 0x00, 0x07, 0xa4, 0x00, 0x07, 0x84, 0x00, 0x14, 0xa4, 0x00, 0x02, 0xa5, 0x00, 0x07, 0xc5, 0x00, 0x02, 0xa4, 0x00, 0x84, 0xc4, 0x00, 0x46, 0x01, 0xeb, 0x8a, 0xe4,
+  0x28, 0x03, 0xc4, 0x00, 0x81, 0xa4, 0x00, 0x02, 0xff, 0xff, 0x82, 0xf7, 0xb5, 0xc5, 0x00, 0x03, 0xa4, 0x00, 0x9c, 0xa3, 0x00, 0xed, 0x42, 0x7b, 0x6f, 0xd2, 0xc7, 0x76, 0xf7, 0xf4, 0xe7, 0xf7,
+  0xd7, 0xd8, 0xe7, 0xf7, 0xf7, 0xf5, 0xef, 0xf6, 0xef, 0xd8, 0xef, 0xd7, 0xef, 0x54, 0xd7, 0x75, 0xdf, 0xd0, 0xbe, 0x31, 0xb6, 0xac, 0xd7, 0x2d, 0xc7, 0x67, 0xae, 0x16, 0xcf, 0xba, 0xce, 0x39,
+  0xaf, 0xf2, 0x4d, 0x80, 0x64, 0x0a, 0x9e, 0x2b, 0xc7, 0x90, 0xbe, 0x02, 0x54, 0xd7, 0x8d, 0xb5, 0xe7, 0xf7, 0xef, 0xdc, 0xf7, 0xbd, 0xef, 0xb4, 0xe7, 0x55, 0xdf, 0xdd, 0xf7, 0xfb, 0xc7, 0xfc,
+  0xc6, 0x18, 0xe7, 0xdc, 0xff, 0xfe, 0xff, 0xe9, 0x39, 0x02, 0xa4, 0x00, 0x85, 0x83, 0x00, 0x4d, 0x63, 0xff, 0xff, 0x6e, 0x5b, 0xa4, 0x00, 0x04, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x0d, 0x84, 0x00,
+  0x03, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x08, 0xa4, 0x00, 0x07, 0x84, 0x00, 0x13, 0xa4, 0x00, 0x05, 0xc4, 0x00, 0x02, 0xc5,
+  0x00, 0x81, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x85, 0xc4, 0x00, 0x26, 0x01, 0x87, 0x39, 0x34, 0xee, 0xe4, 0x18, 0x03, 0xc4, 0x00, 0x81, 0x86, 0x21, 0x02, 0xff, 0xff, 0x83, 0xf4, 0x9c, 0xa5, 0x00,
+  0xa4, 0x00, 0x02, 0x84, 0x00, 0xab, 0x8a, 0x3a, 0x5d, 0xd7, 0xf3, 0xa7, 0xf7, 0xc7, 0xb6, 0xe7, 0x95, 0xdf, 0xf9, 0xf7, 0xf8, 0xef, 0xf6, 0xef, 0xf8, 0xef, 0xb8, 0xe7, 0xd9, 0xef, 0xd7, 0xef,
+  0xf5, 0xef, 0xf3, 0xef, 0x75, 0xdf, 0xd2, 0xc6, 0x31, 0xcf, 0x14, 0xd7, 0x0f, 0xc7, 0xec, 0x8c, 0xed, 0xa5, 0x88, 0x8d, 0x2f, 0xb6, 0xaa, 0xae, 0x2f, 0xae, 0x68, 0x8d, 0x90, 0xd7, 0x64, 0xcf,
+  0x48, 0xc7, 0x53, 0xdf, 0xd7, 0xef, 0xd8, 0xef, 0xd4, 0xe7, 0x3a, 0xdf, 0x1c, 0xe7, 0xbb, 0xe6, 0xb1, 0x8e, 0xbd, 0xc7, 0xdd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x71, 0x8c, 0x03, 0xa4, 0x00, 0x87,
+  0x83, 0x00, 0x9e, 0xef, 0x1c, 0xdf, 0x6f, 0x22, 0x69, 0x11, 0xa5, 0x00, 0xa4, 0x00, 0x06, 0x84, 0x00, 0x81, 0x83, 0x00, 0x02, 0x84, 0x00, 0x02, 0x83, 0x00, 0x0b, 0x84, 0x00, 0x03, 0xa4, 0x00,
+  0x04, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x06, 0x84, 0x00, 0x1d, 0xa4, 0x00, 0x86, 0xe5, 0x00, 0x2a, 0x01, 0xea, 0x00, 0xbc, 0xf7, 0xfe, 0xff, 0xaa, 0x52, 0x03,
+  0xc4, 0x00, 0x81, 0x49, 0x42, 0x02, 0xff, 0xff, 0xa5, 0x09, 0x32, 0xa5, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x08, 0x32, 0x7a, 0xd7, 0x99, 0xf7, 0xd7, 0xd7, 0xf8, 0xcf, 0xf9, 0xf7, 0xb8, 0xef, 0xb7,
+  0xe7, 0xdc, 0xef, 0xdc, 0xf7, 0xd6, 0xef, 0xd7, 0xef, 0xf7, 0xf7, 0xf9, 0xf7, 0xd7, 0xe7, 0xb8, 0xe7, 0xd6, 0xe7, 0x75, 0xdf, 0x52, 0xcf, 0xcb, 0xd7, 0x8f, 0xd7, 0x8b, 0x84, 0x66, 0x85, 0xe0,
+  0x4c, 0xf0, 0xad, 0x87, 0x75, 0xb1, 0xbe, 0x30, 0xc7, 0x34, 0xd7, 0xe9, 0xb6, 0xcf, 0xdf, 0x92, 0xdf, 0xb7, 0xef, 0x02, 0xb7, 0xe7, 0x8a, 0x9b, 0xe7, 0xd8, 0xce, 0xd4, 0xad, 0x6e, 0x95, 0x9a,
+  0x76, 0xdc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x18, 0xc6, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x89, 0x55, 0xa5, 0xff, 0xff, 0x7d, 0xe7, 0xee, 0x4a, 0x0d, 0x1a, 0x8a, 0x01, 0x28, 0x01, 0x06, 0x01, 0xc5,
+  0x00, 0x04, 0xa5, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x84, 0x00, 0xa4, 0x00, 0x05, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x04, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x0b, 0xa5, 0x00, 0x03, 0xa4, 0x00, 0x03, 0x84,
+  0x00, 0x81, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x04, 0xc5, 0x00, 0x81, 0xc4, 0x00, 0x0d, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x8a, 0x83, 0x00, 0xa4, 0x00, 0x06, 0x01, 0x6a, 0x01, 0x0c,
+  0x02, 0x93, 0x84, 0xde, 0xf7, 0xff, 0xff, 0xbe, 0xf7, 0x84, 0x00, 0x03, 0xc4, 0x00, 0xb0, 0x8a, 0x4a, 0xfe, 0xff, 0x5c, 0xef, 0xa5, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x28, 0x3a, 0x5a, 0xd7, 0x7b,
+  0xff, 0x9a, 0xff, 0xf7, 0xdf, 0xf9, 0xdf, 0xf8, 0xef, 0xd9, 0xef, 0x99, 0xe7, 0xbd, 0xef, 0xba, 0xf7, 0xda, 0xef, 0xb8, 0xef, 0xd9, 0xef, 0xfa, 0xef, 0xd6, 0xef, 0xb8, 0xe7, 0x76, 0xdf, 0xd1,
+  0xdf, 0xd0, 0xe7, 0x53, 0xd7, 0x35, 0xcf, 0x26, 0x7d, 0x65, 0x75, 0x90, 0xbe, 0x8d, 0x95, 0x4f, 0x96, 0x4c, 0x9e, 0x81, 0xae, 0x6f, 0xd7, 0x6e, 0xcf, 0xf4, 0xce, 0x76, 0xdf, 0x95, 0xdf, 0xf4,
+  0xce, 0x70, 0xd7, 0x75, 0xdf, 0xd7, 0xef, 0x31, 0xcf, 0xca, 0x95, 0x4c, 0x45, 0x3b, 0xe7, 0x02, 0xfd, 0xff, 0x82, 0x9d, 0xf7, 0x63, 0x00, 0x04, 0xa4, 0x00, 0x88, 0xfb, 0xde, 0xff, 0xff, 0xff,
+  0xf7, 0xfb, 0xde, 0x92, 0x8c, 0xea, 0x29, 0x8b, 0x01, 0x6d, 0x01, 0x03, 0x4d, 0x01, 0x02, 0x8d, 0x01, 0x82, 0x6c, 0x01, 0x4c, 0x01, 0x02, 0x0b, 0x01, 0x85, 0x0c, 0x01, 0x0b, 0x01, 0x2b, 0x01,
+  0x2a, 0x01, 0x0b, 0x01, 0x02, 0x2c, 0x01, 0x83, 0x0b, 0x01, 0xea, 0x00, 0xe9, 0x00, 0x02, 0x09, 0x01, 0x82, 0xc8, 0x00, 0xc9, 0x00, 0x03, 0x09, 0x01, 0x02, 0x0a, 0x01, 0x02, 0x2b, 0x01, 0x81,
+  0x0b, 0x01, 0x02, 0x0a, 0x01, 0x85, 0x29, 0x01, 0x2a, 0x01, 0xe9, 0x00, 0xe8, 0x00, 0xa7, 0x00, 0x02, 0xc6, 0x00, 0x02, 0xc7, 0x00, 0x81, 0xa7, 0x00, 0x03, 0xa8, 0x00, 0x82, 0x66, 0x00, 0x67,
+  0x00, 0x02, 0x87, 0x00, 0x82, 0x66, 0x00, 0x86, 0x00, 0x03, 0xa6, 0x00, 0x81, 0x85, 0x00, 0x02, 0xa6, 0x00, 0x82, 0x86, 0x00, 0xa6, 0x00, 0x02, 0xe6, 0x00, 0x81, 0x08, 0x01, 0x02, 0x29, 0x01,
+  0x83, 0xa9, 0x01, 0x55, 0x9d, 0x9d, 0xe7, 0x02, 0xff, 0xff, 0x83, 0xdf, 0xf7, 0x11, 0x74, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x96, 0xc4, 0x00, 0x08, 0x3a, 0x9a, 0xff, 0x90, 0x9c, 0xc6, 0x00, 0x84,
+  0x00, 0xc8, 0x29, 0x19, 0xcf, 0x7a, 0xff, 0x9a, 0xff, 0xfb, 0xf7, 0xf9, 0xf7, 0xf8, 0xef, 0xf9, 0xf7, 0xdb, 0xef, 0x7d, 0xef, 0xb8, 0xe7, 0x98, 0xe7, 0xde, 0xf7, 0xb9, 0xef, 0xd7, 0xef, 0xf5,
+  0xef, 0x02, 0xb8, 0xe7, 0x99, 0xd6, 0xef, 0xb5, 0xe7, 0xf7, 0xf7, 0xd4, 0xce, 0xbd, 0xf7, 0x91, 0xbe, 0xc0, 0x4c, 0xa0, 0x64, 0xc0, 0x54, 0xe1, 0xae, 0x0d, 0xbf, 0x2d, 0xc7, 0x09, 0xa6, 0x8e,
+  0xbe, 0xf2, 0xc6, 0x6e, 0xa6, 0x47, 0x9e, 0xb5, 0xe7, 0x32, 0xcf, 0x70, 0xd7, 0xf6, 0xef, 0xd2, 0xe7, 0x21, 0xb7, 0xc3, 0xa6, 0x45, 0x85, 0x02, 0xfd, 0xff, 0x83, 0xfe, 0xff, 0xf0, 0x7b, 0x84,
+  0x00, 0x02, 0xa4, 0x00, 0x83, 0x84, 0x00, 0x46, 0x21, 0x9a, 0xd6, 0x05, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xde, 0xf7, 0x02, 0xbe, 0xf7, 0x82, 0x9d, 0xf7, 0x7c, 0xef, 0x02, 0x5c, 0xef, 0x81, 0x3b,
+  0xe7, 0x02, 0x1b, 0xe7, 0x85, 0xfb, 0xe6, 0x1b, 0xe7, 0x3c, 0xe7, 0x7c, 0xef, 0x9d, 0xf7, 0x04, 0xbd, 0xf7, 0x81, 0xbc, 0xf7, 0x03, 0x9d, 0xf7, 0x81, 0x7d, 0xf7, 0x02, 0x9d, 0xef, 0x02, 0x9d,
+  0xf7, 0x06, 0xbd, 0xf7, 0x06, 0xdd, 0xff, 0x02, 0xde, 0xff, 0x02, 0xbd, 0xff, 0x81, 0xbd, 0xf7, 0x02, 0x9d, 0xf7, 0x02, 0x9c, 0xf7, 0x02, 0x7c, 0xef, 0x81, 0x5c, 0xef, 0x04, 0x5b, 0xef, 0x8a,
+  0x3b, 0xe7, 0xfa, 0xde, 0x78, 0xc6, 0x97, 0xad, 0xb5, 0x84, 0x93, 0x7c, 0x93, 0x84, 0xb6, 0xb5, 0xfb, 0xde, 0xbe, 0xf7, 0x03, 0xff, 0xff, 0x82, 0x1d, 0xd7, 0x6c, 0x32, 0x03, 0xa4, 0x00, 0x02,
+  0xc4, 0x00, 0xb5, 0xe4, 0x00, 0xe7, 0xa2, 0x47, 0x11, 0xc5, 0x00, 0x25, 0x09, 0x15, 0x8d, 0x77, 0xff, 0x39, 0xff, 0x7a, 0xff, 0xfa, 0xf7, 0xf9, 0xf7, 0xd5, 0xef, 0xfa, 0xf7, 0xd9, 0xef, 0xdb,
+  0xef, 0xf8, 0xef, 0x75, 0xe7, 0x97, 0xf6, 0x77, 0xef, 0xf3, 0xef, 0xf5, 0xef, 0xd6, 0xe7, 0x95, 0xdf, 0x95, 0xe7, 0x94, 0xe7, 0xf6, 0xef, 0xb7, 0xe7, 0xab, 0xa5, 0xe9, 0x84, 0x8a, 0x95, 0x2c,
+  0xae, 0x84, 0x65, 0x61, 0xae, 0x89, 0xb6, 0x50, 0xb6, 0xeb, 0xa5, 0x66, 0x75, 0x2a, 0x96, 0xca, 0xbe, 0x4e, 0xae, 0x34, 0xd7, 0x54, 0xd7, 0xb3, 0xdf, 0xb5, 0xe7, 0x90, 0xd7, 0xe2, 0xdf, 0x41,
+  0xbf, 0xa0, 0x6b, 0x3a, 0xe7, 0xfd, 0xff, 0xfe, 0xff, 0x5c, 0xe7, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x82, 0x14, 0x9d, 0xbe, 0xf7, 0x04, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x32, 0xfe,
+  0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x81, 0xde, 0xff, 0x03, 0xdd, 0xff, 0x81, 0xfd, 0xff, 0x02, 0xfe, 0xff, 0x04, 0xff, 0xff, 0x84, 0x5d, 0xe7, 0x11, 0x6c, 0x27, 0x01, 0x84, 0x00, 0x03,
+  0xa3, 0x00, 0xb3, 0xa4, 0x00, 0xc4, 0x00, 0xa3, 0x00, 0x40, 0x18, 0x08, 0x01, 0xa8, 0x21, 0x2f, 0x2c, 0xf4, 0xee, 0x38, 0xff, 0x39, 0xff, 0x79, 0xff, 0xd8, 0xef, 0xf6, 0xef, 0xb6, 0xe7, 0x75,
+  0xdf, 0xf5, 0xef, 0xb7, 0xe7, 0x75, 0xdf, 0x55, 0xef, 0xd7, 0xf6, 0x16, 0xef, 0x34, 0xd7, 0x70, 0xcf, 0x96, 0xdf, 0xf2, 0xce, 0x54, 0xd7, 0x52, 0xcf, 0xed, 0xbe, 0x12, 0xcf, 0x10, 0xc7, 0xd6,
+  0xce, 0xd1, 0xc6, 0x70, 0xb6, 0xee, 0xad, 0x44, 0x8e, 0xea, 0xbe, 0xea, 0xa5, 0x0b, 0xae, 0xab, 0xa5, 0x6f, 0xb6, 0xca, 0x95, 0x4d, 0xa6, 0xf2, 0xc6, 0x14, 0xd7, 0x75, 0xdf, 0x99, 0xe7, 0x7a,
+  0xde, 0xae, 0xa5, 0xc4, 0x6c, 0xa2, 0x5b, 0x62, 0x42, 0x02, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0xb6, 0xb5, 0x04, 0x84, 0x00, 0x89, 0xa4, 0x00, 0x84, 0x00, 0xe4, 0x10, 0xef, 0x73, 0xb7, 0xad, 0x58,
+  0xce, 0x79, 0xce, 0x59, 0xc6, 0x58, 0xce, 0x02, 0x58, 0xc6, 0x02, 0x38, 0xc6, 0x83, 0x18, 0xc6, 0x17, 0xbe, 0xd7, 0xb5, 0x02, 0xb6, 0xad, 0x83, 0xd7, 0xb5, 0xf7, 0xbd, 0x38, 0xbe, 0x04, 0x59,
+  0xc6, 0x81, 0x58, 0xc6, 0x04, 0x38, 0xc6, 0x81, 0x58, 0xc6, 0x03, 0x59, 0xc6, 0x81, 0x58, 0xc6, 0x02, 0x38, 0xc6, 0x84, 0x18, 0xc6, 0x17, 0xbe, 0xf6, 0xbd, 0xd6, 0xb5, 0x02, 0xf6, 0xb5, 0x82,
+  0xf7, 0xbd, 0x17, 0xbe, 0x02, 0x18, 0xbe, 0x04, 0x38, 0xc6, 0x81, 0x18, 0xc6, 0x03, 0x17, 0xbe, 0x83, 0xf7, 0xbd, 0xf7, 0xb5, 0xd6, 0xb5, 0x03, 0x96, 0xad, 0x02, 0xb6, 0xad, 0x8c, 0x75, 0xad,
+  0x34, 0x9d, 0xb2, 0x8c, 0x91, 0x84, 0x50, 0x84, 0x91, 0x8c, 0x13, 0x9d, 0x34, 0x9d, 0xf3, 0x94, 0x4d, 0x5b, 0x67, 0x11, 0xc5, 0x00, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x89, 0x83, 0x00, 0xa3,
+  0x00, 0x83, 0x00, 0xa4, 0x00, 0x42, 0x00, 0x07, 0x3a, 0x74, 0xa5, 0x98, 0xbe, 0x51, 0xae, 0x03, 0xf9, 0xf7, 0x86, 0xf8, 0xf7, 0xb7, 0xe7, 0xf8, 0xef, 0x97, 0xe7, 0xf6, 0xef, 0xf3, 0xef, 0x02,
+  0xf5, 0xef, 0xa2, 0xf8, 0xef, 0x94, 0xe7, 0x35, 0xf7, 0x34, 0xf6, 0xad, 0xb6, 0xf2, 0xc6, 0x8a, 0xa6, 0x4b, 0xb6, 0x14, 0xcf, 0x31, 0xc7, 0xce, 0xad, 0x13, 0xcf, 0x45, 0x9e, 0xb0, 0xb6, 0x0a,
+  0x8e, 0x50, 0xae, 0x27, 0xc7, 0xac, 0xb6, 0x89, 0xcf, 0xeb, 0xa5, 0x91, 0xbe, 0xcb, 0x95, 0x0f, 0xae, 0x0e, 0xc7, 0xeb, 0xbe, 0xb5, 0xdf, 0x88, 0xd7, 0x74, 0xe7, 0xf4, 0xd5, 0x32, 0xb6, 0x2e,
+  0x9e, 0x87, 0x7c, 0x03, 0x33, 0xf6, 0xc5, 0x03, 0xfe, 0xff, 0x81, 0x75, 0xad, 0x04, 0x84, 0x00, 0x04, 0xa4, 0x00, 0x81, 0xa3, 0x00, 0x08, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x81, 0xa4, 0x00, 0x02,
+  0x84, 0x00, 0x82, 0x83, 0x00, 0xa3, 0x00, 0x05, 0x83, 0x00, 0x81, 0xa3, 0x00, 0x02, 0x83, 0x00, 0x02, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x82, 0x84, 0x00, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x11, 0xa4,
+  0x00, 0x81, 0x83, 0x00, 0x03, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x08, 0x83, 0x00, 0x81, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x82, 0x83, 0x00, 0x84, 0x00, 0x02, 0x83,
+  0x00, 0xb5, 0xa4, 0x00, 0x44, 0x21, 0xb8, 0xd6, 0xfd, 0xff, 0x9d, 0xff, 0xcc, 0xa5, 0x70, 0xcf, 0xf9, 0xf7, 0xfa, 0xf7, 0xf8, 0xf7, 0xf9, 0xf7, 0xb8, 0xe7, 0xf8, 0xef, 0xf5, 0xef, 0xf6, 0xef,
+  0xf5, 0xef, 0xb2, 0xdf, 0x74, 0xdf, 0xd4, 0xe7, 0xb6, 0xe7, 0x35, 0xef, 0x31, 0xee, 0x09, 0xc7, 0x48, 0x8d, 0x46, 0x7d, 0x2e, 0xae, 0x48, 0x7d, 0xca, 0x8d, 0x0d, 0xae, 0xec, 0x9d, 0x93, 0xdf,
+  0x31, 0xcf, 0xa9, 0x85, 0x2e, 0x9e, 0xeb, 0xb6, 0x90, 0xbe, 0x70, 0xb6, 0x49, 0x8d, 0x67, 0x95, 0xcf, 0xa5, 0x93, 0xbe, 0x8f, 0xb6, 0x94, 0xdf, 0x09, 0xb7, 0x6f, 0xd7, 0xb4, 0xdf, 0x08, 0x96,
+  0xe6, 0x6c, 0x6b, 0x95, 0xca, 0x7c, 0x49, 0x64, 0x86, 0x02, 0x98, 0xd6, 0x03, 0xfe, 0xff, 0x82, 0x58, 0xc6, 0xe5, 0x18, 0x04, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x04, 0xa4, 0x00, 0x81, 0xc4, 0x00,
+  0x03, 0xa4, 0x00, 0x0b, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x07, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x0e, 0xa4,
+  0x00, 0x03, 0x84, 0x00, 0x82, 0xa4, 0x00, 0x84, 0x00, 0x04, 0x83, 0x00, 0x02, 0x84, 0x00, 0x03, 0x83, 0x00, 0x85, 0x84, 0x00, 0xa4, 0x00, 0x84, 0x00, 0xa9, 0x52, 0x7b, 0xf7, 0x02, 0xfd, 0xff,
+  0x8e, 0x96, 0xef, 0xf4, 0xef, 0xf2, 0xe7, 0xfa, 0xf7, 0xd8, 0xef, 0xf8, 0xf7, 0xf9, 0xf7, 0xd7, 0xef, 0xf6, 0xef, 0xf7, 0xef, 0xd7, 0xef, 0x75, 0xdf, 0x91, 0xdf, 0xd6, 0xe7, 0x02, 0xb7, 0xe7,
+  0xa2, 0x95, 0xdf, 0x93, 0xdf, 0xab, 0x85, 0x2d, 0xae, 0x48, 0x7d, 0x63, 0x6c, 0xca, 0x84, 0xcc, 0x9d, 0x8a, 0x95, 0x2c, 0xa6, 0x33, 0xd7, 0xd2, 0xc6, 0x35, 0xd7, 0xcb, 0x85, 0x68, 0xa6, 0xb1,
+  0xc6, 0xef, 0xad, 0x90, 0xbe, 0x50, 0xb6, 0xca, 0xbe, 0xd2, 0xce, 0x35, 0xd7, 0x76, 0xdf, 0x74, 0xd7, 0xab, 0xa6, 0xe2, 0xdf, 0x71, 0xd7, 0xf5, 0xce, 0x2b, 0x74, 0xcd, 0xa5, 0x29, 0x4d, 0x0b,
+  0x24, 0xcb, 0x1a, 0x99, 0xce, 0x03, 0xfe, 0xff, 0x83, 0x7c, 0xef, 0xce, 0x73, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x03, 0x84,
+  0x00, 0x19, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x17, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x81, 0xa3, 0x00, 0x03, 0x83, 0x00, 0x07, 0x84, 0x00, 0xb9, 0xa4, 0x00, 0x6c, 0x6b, 0xbb, 0xff, 0xfd, 0xff, 0xfd,
+  0xf7, 0x20, 0x6c, 0x11, 0xc7, 0xb3, 0xdf, 0xf6, 0xef, 0xb7, 0xe7, 0xf7, 0xf7, 0xf6, 0xef, 0xd9, 0xef, 0xb6, 0xe7, 0xf7, 0xef, 0xb8, 0xef, 0xdc, 0xef, 0xfa, 0xf7, 0xd7, 0xef, 0xd8, 0xef, 0xb5,
+  0xe7, 0xb5, 0xdf, 0xd4, 0xe7, 0xe2, 0xdf, 0x06, 0xbf, 0x45, 0x7d, 0x8b, 0x9d, 0x0e, 0xae, 0x07, 0x6d, 0xc8, 0x75, 0x12, 0xc7, 0xe8, 0x9d, 0x32, 0xcf, 0xd3, 0xbe, 0xd3, 0xc6, 0xf3, 0xc6, 0xd0,
+  0xbe, 0x13, 0xc7, 0x6f, 0xb6, 0x4f, 0xb6, 0xc8, 0xbe, 0xef, 0xe7, 0xb4, 0xdf, 0x75, 0xdf, 0x77, 0xdf, 0xb4, 0xe7, 0x34, 0xcf, 0xe2, 0xdf, 0x13, 0xcf, 0x79, 0xdf, 0x36, 0xbe, 0xd5, 0xef, 0x91,
+  0x8e, 0x71, 0x45, 0xf2, 0x4b, 0x2d, 0x02, 0x75, 0x9d, 0x02, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x84, 0xb9, 0xd6, 0x8d, 0x6b, 0xa3, 0x00, 0xa4, 0x00, 0x06, 0xc4, 0x00, 0x81, 0xa4, 0x00, 0x03, 0x84,
+  0x00, 0x33, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x03, 0xa3, 0x00, 0x81, 0x83, 0x00, 0x05, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0x0e, 0x7c, 0x02, 0xdd, 0xff, 0xb9, 0x9b, 0xf7, 0xc1, 0x42, 0x44, 0x53,
+  0xed, 0x95, 0xcf, 0xc6, 0xf1, 0xce, 0x4b, 0xcf, 0xf1, 0xe7, 0x92, 0xd7, 0xd1, 0xdf, 0xf7, 0xef, 0xd6, 0xef, 0xb7, 0xe7, 0x9d, 0xef, 0xdb, 0xef, 0xfa, 0xf7, 0xd7, 0xef, 0xf5, 0xef, 0xb3, 0xdf,
+  0xed, 0xdf, 0x73, 0xd7, 0x2c, 0xb6, 0x8a, 0x95, 0xcb, 0xa5, 0xea, 0x95, 0x20, 0x45, 0xca, 0x95, 0x0f, 0xae, 0x4d, 0xae, 0xc0, 0xae, 0xf3, 0xc6, 0xf1, 0xc6, 0x33, 0xcf, 0xf0, 0xce, 0x68, 0xae,
+  0xea, 0x8d, 0x11, 0xbf, 0xf4, 0xce, 0x34, 0xd7, 0x94, 0xdf, 0x54, 0xd7, 0x92, 0xdf, 0xef, 0xdf, 0xd3, 0xc6, 0x35, 0xd7, 0xb0, 0xae, 0xf1, 0xc6, 0xb6, 0xe7, 0x7d, 0xef, 0x9d, 0xef, 0x5b, 0xdf,
+  0xf7, 0xbd, 0xa7, 0x21, 0x2c, 0x02, 0x4f, 0x4a, 0x7c, 0xef, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0x84, 0xdd, 0xff, 0x5b, 0xef, 0x2b, 0x63, 0xe4, 0x00, 0x03, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x83, 0xa4,
+  0x00, 0xa5, 0x00, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x06, 0xc5, 0x00, 0x02, 0xa5, 0x00, 0x82, 0xc5, 0x00, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x02, 0xa5, 0x00, 0x03, 0xc5, 0x00, 0x03, 0xa5, 0x00, 0x05,
+  0xc5, 0x00, 0x04, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x06, 0xa5, 0x00, 0x81, 0xc5, 0x00, 0x03, 0xa5, 0x00, 0x02, 0xc6, 0x00, 0x81, 0xa5, 0x00, 0x02, 0xc5, 0x00, 0x04, 0xa5, 0x00, 0x03, 0xa4, 0x00,
+  0x02, 0xa3, 0x00, 0x81, 0x83, 0x00, 0x02, 0x84, 0x00, 0x04, 0xa4, 0x00, 0xbf, 0x30, 0x84, 0xdd, 0xff, 0xfe, 0xff, 0x77, 0xce, 0x20, 0x32, 0x80, 0x13, 0xa8, 0x64, 0xac, 0x9d, 0x0c, 0x96, 0x62,
+  0x55, 0x25, 0x8e, 0x51, 0xd7, 0x53, 0xd7, 0xfa, 0xef, 0x3c, 0xf7, 0x34, 0xd7, 0xb2, 0xdf, 0xd8, 0xef, 0xb5, 0xe7, 0x96, 0xdf, 0xf8, 0xef, 0xf4, 0xef, 0xd3, 0xe7, 0xb4, 0xdf, 0x52, 0xd7, 0x6e,
+  0xbe, 0xcd, 0xa5, 0x0d, 0x9e, 0x09, 0xb7, 0xe5, 0x9d, 0x15, 0xd7, 0x53, 0xdf, 0xea, 0xdf, 0x92, 0xd7, 0xce, 0xbe, 0xd2, 0xc6, 0x92, 0xdf, 0xb4, 0xe7, 0x2f, 0xc7, 0xf5, 0xef, 0x76, 0xdf, 0x92,
+  0xbe, 0x13, 0xcf, 0xd3, 0xe7, 0x31, 0xcf, 0x37, 0xd7, 0xd8, 0xef, 0x4e, 0xc7, 0x73, 0xdf, 0xcd, 0xdf, 0x10, 0xcf, 0xf7, 0xe7, 0xdd, 0xef, 0x7c, 0xe7, 0x9d, 0xef, 0xda, 0xd6, 0x6e, 0x5b, 0x4c,
+  0x02, 0x0c, 0x02, 0xab, 0x01, 0x10, 0x7c, 0x7c, 0xef, 0xdd, 0xff, 0x02, 0xfd, 0xff, 0x83, 0xbc, 0xff, 0xe7, 0x39, 0xe5, 0x00, 0x04, 0xc5, 0x00, 0x02, 0xc4, 0x00, 0x82, 0xa4, 0x00, 0xe6, 0x00,
+  0x02, 0x07, 0x01, 0x10, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x81, 0xe6, 0x00, 0x02, 0xc5, 0x00, 0x02, 0xe6, 0x00, 0x03, 0xc5, 0x00, 0x03, 0xc6, 0x00, 0x81, 0xc5, 0x00, 0x04, 0xc6, 0x00, 0x82, 0xe6,
+  0x00, 0xc6, 0x00, 0x03, 0xe6, 0x00, 0x81, 0xc5, 0x00, 0x05, 0xe6, 0x00, 0x84, 0xc6, 0x00, 0xe6, 0x00, 0xc6, 0x00, 0xe5, 0x00, 0x02, 0xc5, 0x00, 0x82, 0xa5, 0x00, 0xa4, 0x00, 0x02, 0xa3, 0x00,
+  0x81, 0x83, 0x00, 0x03, 0x84, 0x00, 0x99, 0xa4, 0x00, 0xc4, 0x00, 0x71, 0x84, 0xfd, 0xff, 0xbc, 0xff, 0xce, 0xc4, 0xc0, 0x6a, 0x00, 0x4b, 0x80, 0x54, 0xc7, 0x64, 0xe5, 0x6c, 0xc7, 0x7d, 0xec,
+  0x95, 0x12, 0xcf, 0xef, 0xc6, 0x93, 0xdf, 0x8f, 0xbe, 0x9b, 0xef, 0x72, 0xd7, 0x94, 0xdf, 0x33, 0xd7, 0xd6, 0xe7, 0xb6, 0xe7, 0xd5, 0xe7, 0xf6, 0xef, 0x02, 0x92, 0xdf, 0xae, 0x0d, 0xbf, 0xec,
+  0xc6, 0x30, 0xcf, 0x40, 0x96, 0x65, 0x7d, 0x44, 0xc7, 0x55, 0xd7, 0xb5, 0xe7, 0xf5, 0xef, 0x32, 0xcf, 0x96, 0xe7, 0x53, 0xd7, 0x94, 0xdf, 0xb5, 0xe7, 0x75, 0xdf, 0x56, 0xdf, 0xb2, 0xe7, 0x50,
+  0xcf, 0x55, 0xdf, 0x72, 0xdf, 0xf7, 0xef, 0x9a, 0xe7, 0xd9, 0xd6, 0x51, 0xd7, 0x8d, 0xd7, 0x11, 0xcf, 0x7a, 0xef, 0xbd, 0xf7, 0xbd, 0xe7, 0xbd, 0xef, 0x7c, 0xe7, 0x3c, 0xe7, 0xd0, 0x53, 0x2b,
+  0x1c, 0xa6, 0x02, 0x09, 0x02, 0x67, 0x01, 0x4c, 0x01, 0xcd, 0x01, 0x2e, 0x5b, 0x95, 0xad, 0x77, 0xce, 0xb1, 0xa4, 0xa3, 0x00, 0x83, 0x00, 0xa4, 0x00, 0x04, 0xc4, 0x00, 0x02, 0xa4, 0x00, 0x82,
+  0xc4, 0x00, 0xe5, 0x00, 0x16, 0xe6, 0x00, 0x02, 0xe5, 0x00, 0x82, 0xc5, 0x00, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x03, 0xc6, 0x00, 0x12, 0xe6, 0x00, 0x83, 0xc5, 0x00, 0xa5, 0x00, 0x83, 0x00, 0x03,
+  0xa3, 0x00, 0x82, 0x83, 0x00, 0x84, 0x00, 0x02, 0xa4, 0x00, 0xca, 0x25, 0x11, 0x14, 0x95, 0xfe, 0xef, 0x92, 0xef, 0x48, 0xdc, 0x4b, 0xdc, 0x0b, 0xad, 0x4d, 0xb6, 0x05, 0x85, 0x71, 0xbe, 0x8b,
+  0xa6, 0xaa, 0xae, 0xf1, 0xce, 0xf0, 0xc6, 0xf2, 0xef, 0xf0, 0xe7, 0xf2, 0xe7, 0xd7, 0xef, 0x55, 0xd7, 0x69, 0xcf, 0xca, 0xd7, 0xaf, 0xdf, 0x71, 0xd7, 0xa5, 0xd7, 0xcf, 0xc6, 0xb3, 0xe7, 0xee,
+  0xe7, 0xe0, 0xdf, 0xb3, 0xe7, 0x4f, 0xcf, 0xaf, 0xb6, 0x68, 0xa6, 0x2e, 0xc7, 0x90, 0xd7, 0xf3, 0xe7, 0xf8, 0xef, 0x94, 0xdf, 0xd7, 0xe7, 0xb9, 0xe7, 0xdb, 0xef, 0x35, 0xdf, 0x95, 0xdf, 0xd5,
+  0xe7, 0x95, 0xe7, 0x31, 0xcf, 0x35, 0xb6, 0x97, 0xdf, 0x8f, 0xd7, 0xb4, 0xdf, 0xb3, 0xef, 0xb6, 0xe7, 0x75, 0xd7, 0x39, 0xdf, 0x7b, 0xdf, 0xb9, 0xd6, 0x15, 0xd7, 0xda, 0xef, 0x78, 0xdf, 0x30,
+  0xd7, 0xca, 0xbe, 0xac, 0x53, 0x27, 0x03, 0xe8, 0x02, 0x27, 0x02, 0xc8, 0x01, 0x06, 0x02, 0xa5, 0x01, 0x65, 0x01, 0x05, 0x01, 0xa2, 0x09, 0x61, 0x19, 0xa2, 0x08, 0x62, 0x00, 0x84, 0x00, 0x04,
+  0xa4, 0x00, 0x81, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x81, 0xc5, 0x00, 0x16, 0xe6, 0x00, 0x81, 0xc6, 0x00, 0x02, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x81, 0xe5, 0x00, 0x12, 0xe6, 0x00, 0x82, 0xc5, 0x00,
+  0xa4, 0x00, 0x02, 0x83, 0x00, 0x02, 0xa3, 0x00, 0x03, 0x83, 0x00, 0xa4, 0xc4, 0x00, 0xec, 0x52, 0x17, 0xae, 0x0b, 0xd6, 0xb3, 0xfd, 0xb6, 0xfd, 0xb1, 0xed, 0x31, 0xe7, 0x4f, 0xdf, 0x2b, 0xc7,
+  0x96, 0xdf, 0xd0, 0xb6, 0x6d, 0xae, 0x41, 0xbf, 0xb3, 0xdf, 0x96, 0xdf, 0xf1, 0xe7, 0xd3, 0xe7, 0xd5, 0xe7, 0xb4, 0xdf, 0x75, 0xdf, 0x25, 0xc7, 0xf1, 0xce, 0x14, 0xd7, 0x72, 0xd7, 0x52, 0xd7,
+  0xf3, 0xe7, 0x93, 0xdf, 0x8e, 0xbe, 0xaf, 0xbe, 0x00, 0x76, 0xb1, 0xae, 0xb0, 0xbe, 0x0e, 0xc7, 0xad, 0xae, 0x72, 0xd7, 0x02, 0xf7, 0xef, 0xa6, 0xd8, 0xef, 0xb6, 0xe7, 0xd8, 0xe6, 0x9d, 0xf7,
+  0x92, 0xdf, 0x98, 0xe7, 0x76, 0xdf, 0x92, 0xdf, 0x55, 0xdf, 0xda, 0xde, 0x16, 0xdf, 0xd3, 0xe7, 0xb8, 0xe7, 0x11, 0xcf, 0xb6, 0xe7, 0xf6, 0xd6, 0xb6, 0xbd, 0x7b, 0xdf, 0x58, 0xde, 0xd8, 0xef,
+  0xd7, 0xef, 0xb8, 0xef, 0x69, 0xcf, 0x36, 0xd7, 0xda, 0xd6, 0x53, 0x8d, 0xad, 0x14, 0x29, 0x04, 0x88, 0x03, 0x27, 0x03, 0xe7, 0x02, 0x46, 0x02, 0x86, 0x02, 0xe0, 0x11, 0xe0, 0x31, 0x20, 0x52,
+  0xc6, 0x38, 0xa2, 0x00, 0x02, 0x83, 0x00, 0x81, 0x84, 0x00, 0x08, 0xa4, 0x00, 0x83, 0xa5, 0x00, 0xe6, 0x00, 0x07, 0x01, 0x03, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x81, 0x06, 0x01,
+  0x06, 0xe6, 0x00, 0x81, 0xe5, 0x00, 0x05, 0xe6, 0x00, 0x02, 0xc6, 0x00, 0x81, 0xe5, 0x00, 0x0f, 0xe6, 0x00, 0x84, 0xe5, 0x00, 0xc4, 0x00, 0xa4, 0x00, 0x84, 0x00, 0x02, 0xa3, 0x00, 0x82, 0x83,
+  0x00, 0xa3, 0x00, 0x03, 0x83, 0x00, 0xd1, 0xaa, 0x42, 0xb7, 0x95, 0x1c, 0xdf, 0xb0, 0xfd, 0x8d, 0xfd, 0xce, 0xfd, 0xd8, 0xfd, 0xf2, 0xf5, 0xac, 0xdf, 0x92, 0xe7, 0x6d, 0xd7, 0xc0, 0x6d, 0x81,
+  0xc7, 0x6d, 0xd7, 0x10, 0xc7, 0xd6, 0xe7, 0xd7, 0xef, 0xf2, 0xe7, 0x95, 0xdf, 0xf7, 0xef, 0xae, 0xdf, 0x52, 0xcf, 0x28, 0xc7, 0x76, 0xdf, 0xb2, 0xdf, 0x35, 0xd7, 0x54, 0xdf, 0xf3, 0xce, 0x54,
+  0xd7, 0x4c, 0xb6, 0x80, 0x54, 0xf2, 0x96, 0x10, 0x9f, 0x51, 0xd7, 0x2d, 0xcf, 0xaf, 0xc6, 0xd4, 0xef, 0xd6, 0xef, 0xd7, 0xe7, 0xb7, 0xe7, 0xf5, 0xef, 0x32, 0xcf, 0xf5, 0xef, 0x70, 0xd7, 0x9a,
+  0xe7, 0xdd, 0xef, 0xfd, 0xef, 0xbd, 0xef, 0xdd, 0xef, 0xbb, 0xef, 0xcd, 0xdf, 0xba, 0xc7, 0xda, 0x97, 0xe3, 0xdf, 0xe3, 0xd7, 0xab, 0xd7, 0x6c, 0xd7, 0xd4, 0xe7, 0x93, 0xdf, 0xd4, 0xe7, 0xf4,
+  0xef, 0xd4, 0xe7, 0x8f, 0xbe, 0x4e, 0xcf, 0x0d, 0xa6, 0x8e, 0xb6, 0xae, 0x9d, 0xcb, 0x84, 0xe2, 0x63, 0x47, 0x8d, 0x07, 0x85, 0x85, 0x5b, 0xc0, 0x42, 0x00, 0x82, 0x80, 0x61, 0x40, 0x59, 0xa0,
+  0x69, 0xc7, 0x52, 0x28, 0x32, 0x63, 0x00, 0x84, 0x00, 0x05, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x03, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x81, 0xe5, 0x00, 0x03, 0xe6, 0x00, 0x82, 0x07, 0x01, 0x06, 0x01,
+  0x15, 0xe6, 0x00, 0x81, 0x06, 0x01, 0x02, 0xe6, 0x00, 0x02, 0x06, 0x01, 0x83, 0xe5, 0x00, 0xc5, 0x00, 0xa4, 0x00, 0x05, 0x84, 0x00, 0x02, 0x83, 0x00, 0x81, 0xa3, 0x00, 0x02, 0x83, 0x00, 0xd3,
+  0x8b, 0x42, 0x14, 0x95, 0xde, 0xef, 0xfd, 0xef, 0x3a, 0xf7, 0x74, 0xfe, 0x35, 0xf6, 0xd8, 0xfe, 0xb2, 0xce, 0xb0, 0xc6, 0x56, 0xdf, 0x70, 0xd7, 0xb0, 0xbe, 0xae, 0xdf, 0xac, 0xd7, 0xf6, 0xef,
+  0xd2, 0xc6, 0x69, 0xcf, 0x84, 0xcf, 0xf3, 0xef, 0xd7, 0xef, 0xd8, 0xef, 0xf9, 0xf7, 0xf5, 0xef, 0x33, 0xd7, 0x53, 0xd7, 0xac, 0xd7, 0xa0, 0xcf, 0xd8, 0xef, 0x76, 0xdf, 0x94, 0xdf, 0x31, 0xb6,
+  0x8f, 0xd7, 0x62, 0x8d, 0x81, 0x5d, 0xe2, 0xb6, 0x2a, 0xc7, 0xec, 0xdf, 0xf7, 0xef, 0xf8, 0xf7, 0xfa, 0xf7, 0x73, 0xd7, 0x93, 0xdf, 0xd7, 0xef, 0x76, 0xdf, 0xd2, 0xe7, 0xb8, 0xef, 0xdc, 0xf7,
+  0xdd, 0xe7, 0xdd, 0xdf, 0xdc, 0xef, 0xd9, 0xef, 0x96, 0xdf, 0xba, 0xd7, 0x79, 0xbf, 0xb2, 0xdf, 0xf2, 0xe7, 0xf1, 0xce, 0xf4, 0xce, 0x54, 0xd7, 0xf4, 0xef, 0xd7, 0xef, 0x35, 0xd7, 0x54, 0xd7,
+  0xee, 0xc6, 0x34, 0xd7, 0x8e, 0xb6, 0xeb, 0xbe, 0x10, 0xcf, 0xb4, 0xe7, 0x96, 0xdf, 0x38, 0xd7, 0xb2, 0xc6, 0x17, 0xd7, 0x71, 0xa5, 0x4b, 0xc4, 0xa0, 0xa2, 0xa0, 0x9a, 0x40, 0x92, 0x60, 0x8b,
+  0x6a, 0x9d, 0x92, 0x8c, 0xc8, 0x31, 0x02, 0x83, 0x00, 0x0c, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x02, 0xc5, 0x00, 0x81, 0xe5, 0x00, 0x16, 0xe6, 0x00, 0x82, 0xc5, 0x00, 0xa5, 0x00, 0x05, 0xa4, 0x00,
+  0x02, 0x84, 0x00, 0x81, 0x83, 0x00, 0x02, 0x84, 0x00, 0x02, 0x83, 0x00, 0x85, 0xa3, 0x00, 0xc8, 0x29, 0xb5, 0x84, 0x9d, 0xd7, 0xfa, 0xd7, 0x02, 0xfd, 0xef, 0xcb, 0x5a, 0xef, 0x92, 0xf6, 0x94,
+  0xee, 0xf6, 0xf6, 0x13, 0xf7, 0x35, 0xf7, 0x14, 0xe7, 0xb7, 0xef, 0x30, 0xd7, 0xb4, 0xe7, 0x94, 0xdf, 0x33, 0xd7, 0x12, 0xcf, 0xb3, 0xe7, 0x99, 0xe7, 0xd5, 0xef, 0xf6, 0xef, 0xd7, 0xef, 0xf8,
+  0xef, 0xf7, 0xef, 0xf6, 0xef, 0x95, 0xdf, 0x97, 0xdf, 0x57, 0xdf, 0x56, 0xd7, 0x55, 0xd7, 0x91, 0xbe, 0xf2, 0xbe, 0xee, 0xa5, 0x0f, 0xc7, 0xab, 0xc7, 0xd4, 0xcf, 0x76, 0xcf, 0xf7, 0xef, 0xd8,
+  0xef, 0xb7, 0xe7, 0xf8, 0xef, 0x93, 0xdf, 0x50, 0xcf, 0x74, 0xdf, 0xd7, 0xef, 0x95, 0xdf, 0xb5, 0xe7, 0xd3, 0xe7, 0xfb, 0xcf, 0xfd, 0xc7, 0xd9, 0xef, 0xf8, 0xef, 0xd4, 0xe7, 0x95, 0xdf, 0x76,
+  0xdf, 0x53, 0xd7, 0x97, 0xdf, 0x7d, 0xef, 0xd4, 0xe7, 0x94, 0xdf, 0xaf, 0xbe, 0xb4, 0xe7, 0x75, 0xdf, 0xb4, 0xe7, 0x13, 0xcf, 0x50, 0xcf, 0x06, 0xb7, 0x93, 0xd7, 0xd6, 0xef, 0xf6, 0xef, 0x7c,
+  0xe7, 0xdb, 0xef, 0xb7, 0xe7, 0x9b, 0xe7, 0x9c, 0xef, 0x6f, 0xed, 0x10, 0xdd, 0x4c, 0xc4, 0xa5, 0xbb, 0x02, 0x40, 0xbb, 0x87, 0x42, 0xc3, 0x12, 0xe5, 0x33, 0x9d, 0xc9, 0x32, 0x65, 0x19, 0x83,
+  0x00, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x81, 0xc4, 0x00, 0x08, 0xa4, 0x00, 0x81, 0x84, 0x00, 0x03, 0xa4, 0x00, 0x02, 0xc4, 0x00, 0x81, 0xa4, 0x00, 0x02, 0xc5, 0x00, 0x04, 0xe5, 0x00, 0x03, 0xc5,
+  0x00, 0x81, 0xe5, 0x00, 0x02, 0xc5, 0x00, 0x04, 0xa4, 0x00, 0x09, 0x84, 0x00, 0x03, 0xa3, 0x00, 0x88, 0xa4, 0x00, 0x25, 0x11, 0x4a, 0x3a, 0x35, 0x85, 0xfd, 0xc7, 0xfc, 0xdf, 0x37, 0xff, 0x79,
+  0xf7, 0x02, 0xfd, 0xef, 0xa3, 0x50, 0xc5, 0x4f, 0xd7, 0x54, 0xdf, 0xf5, 0xef, 0xb5, 0xfe, 0xb7, 0xfe, 0x96, 0xf6, 0xf5, 0xee, 0xf0, 0xdf, 0x73, 0xd7, 0x72, 0xdf, 0x52, 0xd7, 0xd6, 0xe7, 0xd2,
+  0xc6, 0xb5, 0xe7, 0x95, 0xe7, 0xf6, 0xef, 0xf7, 0xef, 0xf8, 0xf7, 0xb5, 0xe7, 0xf8, 0xef, 0xd4, 0xe7, 0xd9, 0xe7, 0xdd, 0xf7, 0xaf, 0xbe, 0x31, 0xc7, 0x52, 0xd7, 0xc9, 0xb6, 0x6f, 0xae, 0xb5,
+  0xe7, 0xad, 0xbf, 0x93, 0x9f, 0xd5, 0xcf, 0xf7, 0xef, 0xb8, 0xe7, 0x02, 0xf6, 0xef, 0x89, 0x13, 0xc7, 0xcf, 0xbe, 0xf2, 0xce, 0x54, 0xd7, 0x34, 0xd7, 0xd6, 0xe7, 0xf8, 0xef, 0xd9, 0xdf, 0xf9,
+  0xdf, 0x02, 0xd9, 0xef, 0x9b, 0xb5, 0xe7, 0xb7, 0xe7, 0xf3, 0xc6, 0x92, 0xd7, 0x97, 0xe7, 0x98, 0xe7, 0x94, 0xdf, 0xd0, 0xbe, 0x12, 0xcf, 0x11, 0xc7, 0x55, 0xd7, 0xd5, 0xe7, 0x89, 0xb6, 0x51,
+  0xcf, 0xb2, 0xc6, 0x75, 0xdf, 0xd5, 0xef, 0xd8, 0xef, 0xde, 0xf7, 0xfb, 0xef, 0xf9, 0xef, 0xfd, 0xf7, 0xfd, 0xef, 0x3a, 0xef, 0x79, 0xef, 0x35, 0xe7, 0x73, 0xf6, 0x02, 0x4f, 0xed, 0x88, 0xac,
+  0xdc, 0x4c, 0xdc, 0xad, 0xe3, 0x20, 0x8b, 0xc0, 0x53, 0x11, 0x7c, 0x08, 0x42, 0x45, 0x21, 0x0b, 0xa4, 0x00, 0x02, 0x84, 0x00, 0x11, 0xa4, 0x00, 0x82, 0x84, 0x00, 0xa4, 0x00, 0x07, 0x84, 0x00,
+  0x03, 0x83, 0x00, 0xb4, 0xa3, 0x00, 0xc4, 0x00, 0x2a, 0x42, 0xd0, 0x63, 0x9b, 0x96, 0x1b, 0xd7, 0x1a, 0xff, 0xd8, 0xef, 0xd9, 0xf7, 0xbb, 0xf7, 0xba, 0xef, 0x98, 0xdf, 0x57, 0xdf, 0x13, 0xd7,
+  0xb4, 0xe7, 0xd6, 0xe7, 0xf6, 0xef, 0xf7, 0xfe, 0xf8, 0xfe, 0xd7, 0xfe, 0x17, 0xef, 0x0b, 0xc7, 0x13, 0xcf, 0x4c, 0x9e, 0x52, 0xd7, 0xf3, 0xce, 0xd3, 0xe7, 0xf2, 0xef, 0xd6, 0xef, 0xf7, 0xf7,
+  0xfb, 0xf7, 0xfd, 0xf7, 0xf6, 0xef, 0xf7, 0xef, 0xfb, 0xef, 0x36, 0xce, 0x9d, 0xf7, 0xf3, 0xce, 0x92, 0xd7, 0x25, 0xbf, 0x35, 0xd7, 0x55, 0xdf, 0xf6, 0xef, 0xcd, 0xcf, 0x52, 0xbf, 0xd4, 0xdf,
+  0xf7, 0xef, 0xb8, 0xe7, 0xb6, 0xe7, 0x75, 0xdf, 0x4f, 0xae, 0xb2, 0xbe, 0x02, 0xf5, 0xef, 0xb0, 0xb1, 0xdf, 0xd6, 0xe7, 0xd7, 0xef, 0xb8, 0xef, 0x99, 0xe7, 0xf9, 0xf7, 0xd8, 0xef, 0xb8, 0xe7,
+  0x77, 0xdf, 0x35, 0xd7, 0xb0, 0xdf, 0x55, 0xd7, 0x11, 0xcf, 0x91, 0xc6, 0x75, 0xd7, 0xac, 0xd7, 0x70, 0xbe, 0x50, 0xcf, 0xf1, 0xe7, 0xeb, 0xdf, 0xb0, 0xbe, 0xd3, 0xce, 0xf5, 0xce, 0xd2, 0xe7,
+  0xf9, 0xf7, 0x9e, 0xf7, 0xdb, 0xef, 0xf8, 0xef, 0xfc, 0xef, 0xfe, 0xf7, 0xbd, 0xef, 0xda, 0xef, 0xd7, 0xef, 0x16, 0xff, 0xd7, 0xfe, 0xb6, 0xfe, 0x73, 0xfe, 0x52, 0xfe, 0x34, 0xf6, 0x48, 0xcc,
+  0x60, 0x55, 0x62, 0x9c, 0x29, 0xcc, 0x2e, 0xd6, 0x15, 0x96, 0x6a, 0x3a, 0xc4, 0x00, 0x83, 0x00, 0x02, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x02, 0xa4, 0x00, 0x03, 0x84, 0x00, 0x10, 0xa4, 0x00, 0x09,
+  0x84, 0x00, 0x99, 0x83, 0x00, 0xc4, 0x08, 0x86, 0x21, 0x2c, 0x4b, 0x39, 0x96, 0xff, 0xde, 0x5d, 0xe7, 0xdd, 0xe7, 0xfd, 0xef, 0x7d, 0xf7, 0xf9, 0xf7, 0xf8, 0xef, 0xdd, 0xef, 0x38, 0xd7, 0x94,
+  0xdf, 0x95, 0xdf, 0x54, 0xd7, 0xe6, 0xdf, 0xea, 0xdf, 0xf4, 0xef, 0x53, 0xee, 0x75, 0xf6, 0x14, 0xee, 0xf3, 0xe6, 0xc6, 0xd7, 0x02, 0x2d, 0xc7, 0xc7, 0xa6, 0xcf, 0xd0, 0xdf, 0x74, 0xdf, 0xb6,
+  0xe7, 0xf5, 0xef, 0xb7, 0xef, 0xdc, 0xef, 0xde, 0xf7, 0x97, 0xdf, 0x98, 0xe7, 0xfb, 0xe6, 0x9c, 0xef, 0xbd, 0xef, 0x91, 0xdf, 0xb0, 0xdf, 0x96, 0xdf, 0x8d, 0xb6, 0xcc, 0xdf, 0xd6, 0xe7, 0xc6,
+  0xd7, 0xf7, 0xef, 0xb7, 0xe7, 0xd2, 0xe7, 0x96, 0xe7, 0xf7, 0xef, 0x94, 0xdf, 0xef, 0xbe, 0x51, 0xcf, 0x2f, 0xcf, 0xb6, 0xe7, 0x96, 0xe7, 0xd7, 0xe7, 0xf7, 0xef, 0xf9, 0xf7, 0xf7, 0xef, 0xf9,
+  0xf7, 0xf6, 0xef, 0x94, 0xdf, 0x33, 0xd7, 0x10, 0xc7, 0x41, 0x8e, 0xee, 0xbe, 0x10, 0xae, 0x8f, 0xbe, 0xb2, 0xc6, 0xf0, 0xc6, 0x6f, 0xd7, 0x31, 0xcf, 0xb0, 0xc6, 0xcd, 0x9d, 0x6b, 0xb6, 0xb2,
+  0xc6, 0x76, 0xdf, 0x74, 0xd7, 0xb7, 0xe7, 0xf0, 0xe7, 0x97, 0xe7, 0xd6, 0xe7, 0xb7, 0xe7, 0xd8, 0xef, 0xf7, 0xef, 0x35, 0xd7, 0xb6, 0xe7, 0x97, 0xe7, 0xfa, 0xf7, 0xf8, 0xf7, 0xf4, 0xef, 0xd6,
+  0xe7, 0x94, 0xdf, 0x32, 0xcf, 0x09, 0xe7, 0x03, 0xae, 0xfd, 0x88, 0x62, 0x75, 0xa0, 0x53, 0x40, 0x7b, 0x8a, 0x9b, 0xa6, 0x52, 0xc3, 0x29, 0x04, 0x21, 0x26, 0x19, 0x04, 0x84, 0x00, 0x12, 0xa4,
+  0x00, 0x04, 0x84, 0x00, 0xbd, 0x83, 0x00, 0xa3, 0x00, 0x87, 0x21, 0xcb, 0x4a, 0x4e, 0x63, 0xf4, 0x8c, 0xfb, 0xae, 0xed, 0x41, 0xa6, 0x3c, 0x20, 0xb7, 0xfa, 0xef, 0xda, 0xf7, 0x16, 0xff, 0xf6,
+  0xe7, 0xf6, 0xc7, 0x5a, 0xe7, 0xfc, 0xef, 0xb3, 0xe7, 0x34, 0xcf, 0x55, 0xd7, 0x53, 0xd7, 0xf3, 0xe7, 0x55, 0xdf, 0x52, 0xd7, 0x32, 0xcf, 0xcc, 0xdf, 0x14, 0xdf, 0x95, 0xfe, 0x75, 0xf7, 0xd0,
+  0xe7, 0xf2, 0xe7, 0x98, 0xe7, 0x76, 0xdf, 0x35, 0xd7, 0xb7, 0xe7, 0xd1, 0xe7, 0xb4, 0xe7, 0x56, 0xdf, 0xb8, 0xe7, 0xf7, 0xef, 0xbb, 0xbf, 0xfc, 0xbf, 0xde, 0xf7, 0xf9, 0xef, 0x77, 0xe7, 0xd3,
+  0xc6, 0x53, 0xd7, 0xf2, 0xc6, 0xb4, 0xe7, 0xb6, 0xe7, 0xd6, 0xef, 0x95, 0xdf, 0xf8, 0xef, 0xd9, 0xef, 0xf3, 0xe7, 0xd6, 0xef, 0xb8, 0xe7, 0xd4, 0xe7, 0x4a, 0x85, 0x2e, 0xae, 0xd4, 0xc6, 0x02,
+  0x54, 0xd7, 0x85, 0xd4, 0xe7, 0xf5, 0xef, 0xf8, 0xef, 0xf7, 0xef, 0x96, 0xe7, 0x02, 0xb5, 0xe7, 0x97, 0x08, 0xb7, 0x0c, 0xc7, 0x6a, 0x85, 0xcd, 0x95, 0x91, 0xbe, 0x53, 0xd7, 0x2c, 0xa6, 0xf3,
+  0xc6, 0x10, 0xcf, 0x51, 0xd7, 0x56, 0xdf, 0x33, 0xcf, 0x13, 0xc7, 0x8d, 0xb6, 0xeb, 0xbe, 0x33, 0xc7, 0x54, 0xd7, 0x74, 0xd7, 0x73, 0xdf, 0x32, 0xcf, 0x74, 0xdf, 0x76, 0xdf, 0x73, 0xd7, 0x02,
+  0xf3, 0xef, 0x99, 0xda, 0xef, 0xdb, 0xef, 0xf8, 0xf7, 0xfa, 0xf7, 0xfa, 0xef, 0xf6, 0xef, 0x94, 0xe7, 0x74, 0xe7, 0x2e, 0xfe, 0xae, 0xfd, 0x4c, 0xfe, 0x85, 0xd7, 0xcd, 0xc5, 0xaf, 0xdd, 0x89,
+  0xec, 0xa7, 0xcc, 0xca, 0xc4, 0x06, 0xc4, 0x94, 0xbd, 0xb1, 0x9c, 0x4c, 0x53, 0x28, 0x3a, 0x49, 0x42, 0x08, 0x32, 0x25, 0x11, 0x04, 0x83, 0x00, 0x07, 0xa4, 0x00, 0xb5, 0x84, 0x00, 0xa4, 0x00,
+  0x83, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xc5, 0x00, 0x6a, 0x3a, 0x8b, 0x3a, 0x0d, 0x53, 0xae, 0x63, 0x58, 0xae, 0xbd, 0xd7, 0x16, 0xb7, 0x32, 0x8e, 0x30, 0x8e, 0x94, 0xae, 0xfa, 0xce, 0x53, 0xae,
+  0xb2, 0xdf, 0xfa, 0xef, 0xda, 0xf7, 0x57, 0xff, 0xd5, 0xe7, 0xf6, 0xc7, 0xfa, 0xe7, 0x99, 0xe7, 0x31, 0xcf, 0x0f, 0xc7, 0x53, 0xd7, 0xcd, 0xdf, 0xb5, 0xe7, 0x33, 0xd7, 0x4f, 0xcf, 0x14, 0xcf,
+  0x50, 0xd7, 0xd3, 0xd6, 0xb7, 0xfe, 0x77, 0xf7, 0xb7, 0xef, 0x98, 0xdf, 0xd8, 0xef, 0xfa, 0xf7, 0x98, 0xe7, 0xb6, 0xe7, 0xb1, 0xdf, 0xf5, 0xef, 0x73, 0xd7, 0xd7, 0xef, 0xd8, 0xef, 0xfb, 0xcf,
+  0xda, 0xd7, 0x9a, 0xe7, 0xd8, 0xe7, 0x02, 0x97, 0xe7, 0x94, 0xf5, 0xef, 0xd6, 0xef, 0x75, 0xdf, 0xb7, 0xe7, 0xd8, 0xef, 0xf8, 0xef, 0xd8, 0xef, 0xd9, 0xef, 0xb7, 0xe7, 0xb6, 0xe7, 0x34, 0xd7,
+  0xb7, 0xe7, 0x80, 0x5c, 0xe8, 0x7c, 0xcc, 0xa5, 0x33, 0xd7, 0x72, 0xd7, 0xd1, 0xe7, 0x95, 0xe7, 0x96, 0xdf, 0x02, 0xb6, 0xe7, 0xcb, 0xf3, 0xce, 0xb3, 0xbe, 0x36, 0xd7, 0x8c, 0x9d, 0x60, 0x96,
+  0x6e, 0xa6, 0xec, 0xa5, 0x32, 0xc7, 0x8f, 0xbe, 0x90, 0xae, 0xd4, 0xe7, 0x0f, 0xc7, 0x76, 0xdf, 0x74, 0xd7, 0x0b, 0xb7, 0xae, 0xb6, 0x2b, 0xa6, 0xf3, 0xc6, 0xb1, 0xb6, 0xaf, 0xae, 0x14, 0xcf,
+  0x8f, 0xb6, 0x14, 0xcf, 0xc7, 0xd7, 0x01, 0xb7, 0xb0, 0xd7, 0x6a, 0xb6, 0xbc, 0xf7, 0xfd, 0xef, 0xf9, 0xf7, 0xfb, 0xf7, 0xde, 0xf7, 0xd8, 0xef, 0xf8, 0xf7, 0xf3, 0xef, 0x53, 0xf7, 0xf1, 0xf5,
+  0x93, 0xef, 0x88, 0xe7, 0x10, 0xfe, 0x31, 0xfe, 0xae, 0xfd, 0x73, 0xfe, 0x95, 0xf6, 0x96, 0xfe, 0xd6, 0xfe, 0xb6, 0xfe, 0x94, 0xfe, 0xd4, 0xfe, 0xd5, 0xfe, 0x53, 0xde, 0xd8, 0xe6, 0x57, 0xd6,
+  0x95, 0xad, 0xd3, 0x8c, 0xcf, 0x63, 0x4d, 0x5b, 0x8e, 0x63, 0x2d, 0x5b, 0xcb, 0x42, 0x0b, 0x4b, 0x4d, 0x5b, 0x8e, 0x63, 0x4f, 0x63, 0x74, 0x7c, 0x36, 0x95, 0xd8, 0xa5, 0x1d, 0xbf, 0x5d, 0xcf,
+  0x9a, 0xe7, 0xbb, 0xef, 0xbc, 0xef, 0xbd, 0xf7, 0xbd, 0xef, 0xdd, 0xef, 0x02, 0xbd, 0xef, 0x86, 0xf9, 0xf7, 0xb6, 0xe7, 0xbd, 0xef, 0xd9, 0xef, 0xb5, 0xe7, 0xf7, 0xef, 0x02, 0xf8, 0xf7, 0xa0,
+  0xf7, 0xef, 0xb6, 0xe7, 0xf6, 0xef, 0xd3, 0xe7, 0x73, 0xdf, 0xec, 0xc6, 0x95, 0xdf, 0xcd, 0xdf, 0x56, 0xdf, 0x30, 0xcf, 0xea, 0xbe, 0x2e, 0xa6, 0x4f, 0xcf, 0xf0, 0xde, 0x74, 0xfe, 0x76, 0xf7,
+  0xf6, 0xef, 0xdd, 0xf7, 0xfe, 0xf7, 0xfd, 0xf7, 0xda, 0xef, 0xf6, 0xef, 0xd5, 0xe7, 0x97, 0xe7, 0x33, 0xd7, 0x74, 0xdf, 0x96, 0xe7, 0x95, 0xe7, 0x54, 0xd7, 0xb6, 0xe7, 0xf5, 0xef, 0xb5, 0xe7,
+  0x02, 0xb6, 0xe7, 0xdf, 0xf8, 0xf7, 0xd7, 0xef, 0x98, 0xe7, 0xf3, 0xe7, 0x91, 0xd7, 0x97, 0xe7, 0x77, 0xdf, 0x55, 0xd7, 0xb4, 0xe7, 0xf5, 0xce, 0x94, 0xdf, 0xab, 0xa5, 0xa0, 0x5c, 0x20, 0x96,
+  0x8d, 0xb6, 0x92, 0xbe, 0x96, 0xf7, 0xb4, 0xf6, 0x34, 0xdf, 0x55, 0xd7, 0x96, 0xe7, 0xf3, 0xb6, 0x94, 0x76, 0x93, 0xb6, 0xef, 0xa5, 0x2b, 0x96, 0x50, 0xb6, 0x0f, 0xae, 0x2d, 0xae, 0x0d, 0xc7,
+  0xb7, 0xe7, 0x13, 0xcf, 0x56, 0xdf, 0xec, 0xbe, 0x31, 0xcf, 0x20, 0xbf, 0x00, 0x4d, 0x2e, 0xa6, 0xb0, 0xbe, 0x05, 0xb7, 0x14, 0xcf, 0xf5, 0xce, 0xd3, 0xc6, 0x8e, 0xd7, 0xb0, 0xbe, 0xcb, 0xd7,
+  0x11, 0xe7, 0xea, 0xd4, 0x34, 0xe7, 0x77, 0xdf, 0xb8, 0xef, 0xd8, 0xef, 0xba, 0xe7, 0xd8, 0xef, 0xb8, 0xef, 0xb5, 0xe7, 0xd7, 0xef, 0xb7, 0xf7, 0xb7, 0xef, 0xf8, 0xef, 0x35, 0xe7, 0x36, 0xff,
+  0x96, 0xfe, 0x57, 0xef, 0xb6, 0xf7, 0x96, 0xf7, 0x36, 0xff, 0x78, 0xff, 0xb9, 0xf7, 0xf9, 0xe7, 0xf8, 0xdf, 0xf6, 0xcf, 0xb2, 0xc7, 0x20, 0x6d, 0x8c, 0xc4, 0x86, 0x85, 0x32, 0xd7, 0xb6, 0xe7,
+  0xd6, 0xef, 0xca, 0xbe, 0xb3, 0xdf, 0xd2, 0xd7, 0xfa, 0xef, 0xfa, 0xf7, 0xbc, 0xf7, 0xfa, 0xf7, 0x95, 0xf7, 0x94, 0xf7, 0xf6, 0xef, 0xf7, 0xe7, 0xf3, 0xef, 0xf8, 0xef, 0xfd, 0xef, 0x3d, 0xff,
+  0x5c, 0xff, 0x02, 0xf8, 0xef, 0xc5, 0xb8, 0xe7, 0xf9, 0xf7, 0xf5, 0xef, 0xb8, 0xe7, 0xfb, 0xf7, 0xfc, 0xef, 0xf9, 0xf7, 0xfb, 0xf7, 0xfd, 0xf7, 0xfb, 0xf7, 0xf9, 0xf7, 0xd8, 0xef, 0x94, 0xdf,
+  0xd0, 0xdf, 0x12, 0xcf, 0x94, 0xdf, 0x32, 0xcf, 0xaf, 0xd7, 0x6e, 0xd7, 0x4c, 0xcf, 0xe1, 0xb6, 0xe2, 0xd7, 0x73, 0xf7, 0x11, 0xfe, 0x75, 0xf7, 0xf8, 0xf7, 0xfa, 0xf7, 0xfb, 0xf7, 0xfa, 0xf7,
+  0xf9, 0xf7, 0xf7, 0xf7, 0xb6, 0xe7, 0x96, 0xdf, 0xb6, 0xe7, 0x74, 0xdf, 0x90, 0xdf, 0x52, 0xd7, 0x91, 0xdf, 0xd6, 0xef, 0xd7, 0xef, 0xf6, 0xef, 0xf5, 0xef, 0xf7, 0xef, 0xd5, 0xe7, 0xd5, 0xef,
+  0xf6, 0xef, 0x96, 0xdf, 0x74, 0xdf, 0xd3, 0xe7, 0x4e, 0xd7, 0x94, 0xdf, 0xd8, 0xef, 0x50, 0xcf, 0x94, 0xdf, 0x06, 0x05, 0x06, 0x04, 0x06, 0x06, 0x05, 0x04, 0x06, 0x06, 0x06, 0x05, 0x04, 0x06,
+  0x07, 0x06, 0x05, 0x06, 0x05, 0x07, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x02, 0x06, 0x07, 0x85, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+  0x06, 0x95, 0x06, 0x05, 0x06, 0x06, 0x08, 0x05, 0x05, 0x06, 0x05, 0x07, 0x07, 0x03, 0x05, 0x04, 0x05, 0x07, 0x09, 0x09, 0x08, 0x06, 0x04, 0x06, 0x05, 0x06, 0x06, 0x04, 0x04, 0x04, 0x05, 0x02,
+  0x03, 0x03, 0x04, 0x05, 0x07, 0x06, 0x05, 0x05, 0x04, 0x06, 0x07, 0x05, 0x02, 0x06, 0x06, 0x89, 0x06, 0x05, 0x07, 0x06, 0x05, 0x07, 0x06, 0x05, 0x05, 0x08, 0x04, 0x05, 0x06, 0x04, 0x09, 0x06,
+  0x06, 0x05, 0x02, 0x06, 0x06, 0x86, 0x05, 0x04, 0x06, 0x04, 0x05, 0x05, 0x04, 0x07, 0x05, 0x03, 0x02, 0x05, 0x02, 0x06, 0x06, 0x92, 0x05, 0x07, 0x06, 0x06, 0x06, 0x08, 0x09, 0x05, 0x06, 0x06,
+  0x08, 0x07, 0x05, 0x04, 0x07, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x06, 0x02, 0x05, 0x05, 0x88, 0x04, 0x06,
+  0x08, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x07, 0x05, 0x05, 0x07, 0x06, 0x05, 0x02, 0x05, 0x06, 0x93, 0x0a, 0x07, 0x0f, 0x1a, 0x21, 0x3f, 0x5a, 0x69, 0x80, 0x93, 0x94, 0x98, 0x9f, 0xa4,
+  0xa8, 0xa7, 0x9f, 0x95, 0x93, 0x7c, 0x65, 0x55, 0x36, 0x28, 0x19, 0x11, 0x08, 0x09, 0x07, 0x06, 0x06, 0x04, 0x07, 0x04, 0x04, 0x03, 0x05, 0x05, 0x02, 0x06, 0x06, 0x82, 0x05, 0x06, 0x07, 0x05,
+  0x02, 0x05, 0x05, 0x9c, 0x05, 0x07, 0x05, 0x06, 0x05, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x03, 0x04, 0x03, 0x02, 0x04, 0x08, 0x05, 0x04, 0x05, 0x05, 0x03, 0x05, 0x08, 0x07, 0x07,
+  0x06, 0x07, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x05, 0x06, 0x05, 0x07, 0x09, 0x06, 0x05, 0x04, 0x06, 0x05, 0x06, 0x07, 0x07, 0x02, 0x06, 0x06, 0x96,
+  0x06, 0x07, 0x07, 0x07, 0x06, 0x05, 0x04, 0x07, 0x04, 0x04, 0x06, 0x08, 0x0a, 0x09, 0x07, 0x07, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x04, 0x05, 0x08, 0x08, 0x06, 0x0f, 0x1e, 0x44, 0x76, 0xac,
+  0xc0, 0xde, 0xec, 0xef, 0xef, 0xf0, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0x02, 0xf1, 0xf1, 0x8a, 0xf0, 0xef, 0xed, 0xed, 0xee, 0xeb, 0xdb, 0xba, 0x96, 0x69, 0x3b, 0x1b, 0x18, 0x0c, 0x05, 0x05,
+  0x04, 0x04, 0x05, 0x05, 0x02, 0x06, 0x06, 0x88, 0x07, 0x05, 0x04, 0x04, 0x06, 0x05, 0x05, 0x06, 0x05, 0x07, 0x08, 0x08, 0x06, 0x05, 0x05, 0x06, 0x02, 0x06, 0x06, 0xa6, 0x04, 0x05, 0x04, 0x04,
+  0x07, 0x0a, 0x09, 0x08, 0x05, 0x07, 0x09, 0x07, 0x04, 0x05, 0x06, 0x05, 0x06, 0x07, 0x05, 0x07, 0x05, 0x06, 0x07, 0x05, 0x05, 0x08, 0x04, 0x04, 0x05, 0x06, 0x04, 0x04, 0x06, 0x06, 0x05, 0x07,
+  0x08, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x08, 0x07, 0x05, 0x05, 0x05, 0x06, 0x04, 0x07, 0x0d, 0x11, 0x0c, 0x0d, 0x0b, 0x08, 0x04, 0x05, 0x06, 0x06,
+  0x05, 0x06, 0x06, 0x08, 0x21, 0x5a, 0x99, 0xcc, 0x02, 0xea, 0xed, 0x82, 0xed, 0xed, 0xee, 0xf0, 0x02, 0xf0, 0xf0, 0x83, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0x02, 0xf0, 0xf0, 0xbe, 0xee, 0xf0,
+  0xf0, 0xee, 0xed, 0xeb, 0xea, 0xea, 0xe6, 0xd7, 0xb3, 0x86, 0x57, 0x28, 0x10, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x08, 0x08, 0x08,
+  0x08, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x03, 0x09, 0x04, 0x03, 0x0a, 0x09, 0x0a, 0x13, 0x25, 0x23, 0x18, 0x08, 0x05, 0x06, 0x04, 0x04, 0x07, 0x03, 0x05, 0x08, 0x05, 0x03, 0x07, 0x07,
+  0x06, 0x04, 0x07, 0x06, 0x06, 0x06, 0x04, 0x04, 0x05, 0x04, 0x04, 0x05, 0x06, 0x08, 0x06, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x07, 0x08, 0x07, 0x04, 0x03, 0x04, 0x05,
+  0x07, 0x0f, 0x19, 0x1e, 0x25, 0x1e, 0x18, 0x11, 0x07, 0x0a, 0x07, 0x07, 0x06, 0x13, 0x50, 0xa8, 0xe3, 0xea, 0xeb, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf0, 0xef, 0x02, 0xed, 0xed, 0x81, 0xee, 0xf0,
+  0x04, 0xf0, 0xf0, 0xc3, 0xf0, 0xef, 0xed, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xe7, 0xe5, 0xd5, 0xa3, 0x6f, 0x33, 0x0c, 0x05, 0x04, 0x05, 0x0a, 0x0b, 0x06, 0x07, 0x0a,
+  0x07, 0x04, 0x06, 0x09, 0x07, 0x09, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x04, 0x05, 0x05, 0x06, 0x06, 0x09, 0x0b, 0x0b, 0x24, 0x7c, 0xc8, 0xf0, 0xfc, 0xfd, 0xf4, 0xdc, 0x9c, 0x48, 0x0a, 0x06,
+  0x07, 0x04, 0x01, 0x06, 0x07, 0x05, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x06, 0x06, 0x05, 0x06, 0x06, 0x07, 0x06, 0x08, 0x05, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06,
+  0x04, 0x06, 0x0a, 0x30, 0x62, 0x86, 0x9e, 0xae, 0xb5, 0xb3, 0xac, 0xb2, 0xab, 0x9e, 0x8d, 0x81, 0x71, 0x7b, 0x82, 0x5d, 0x93, 0xd9, 0xee, 0xec, 0xe9, 0xea, 0xea, 0xea, 0xec, 0xed, 0xed, 0xef,
+  0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xee, 0x03, 0xed, 0xed, 0x84, 0xee, 0xed, 0xed, 0xef, 0xed, 0xec, 0xed, 0xed, 0x02, 0xec, 0xec, 0x93, 0xeb, 0xe8, 0xe7, 0xe6, 0xe3, 0xe3,
+  0xd0, 0x7d, 0x44, 0x3c, 0x47, 0x53, 0x57, 0x4a, 0x3d, 0x29, 0x0f, 0x0b, 0x09, 0x09, 0x07, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x09, 0x07, 0x05, 0x05, 0x07, 0x08, 0x1d, 0x97, 0xf5, 0xff,
+  0x03, 0xff, 0xff, 0x89, 0xfe, 0xfc, 0xc1, 0x33, 0x0f, 0x0a, 0x04, 0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x05, 0x08, 0x02, 0x07, 0x06, 0xc4, 0x05, 0x05, 0x06, 0x06, 0x06, 0x08,
+  0x06, 0x06, 0x05, 0x05, 0x05, 0x03, 0x05, 0x06, 0x19, 0x7b, 0xd1, 0xf5, 0xfa, 0xfd, 0xf9, 0xf9, 0xfb, 0xf9, 0xf8, 0xf7, 0xf8, 0xf9, 0xfa, 0xf9, 0xf8, 0xf4, 0xb4, 0xd6, 0xe5, 0xea, 0xeb, 0xe6,
+  0xe5, 0xe8, 0xe6, 0xe0, 0xe3, 0xe6, 0xe8, 0xea, 0xec, 0xeb, 0xe5, 0xdd, 0xd2, 0xc9, 0xc6, 0xc0, 0xbd, 0xbf, 0xbf, 0xbd, 0xb8, 0xb5, 0xb0, 0xb3, 0xb6, 0xbd, 0xc6, 0xcc, 0xd2, 0xd9, 0xe4, 0xeb,
+  0xeb, 0xeb, 0xec, 0xea, 0xe9, 0xe8, 0xe7, 0xe6, 0xe5, 0xe4, 0xe6, 0xe0, 0x9d, 0xc1, 0xd3, 0xe2, 0xf0, 0xf3, 0xf3, 0xf4, 0xd6, 0x88, 0x28, 0x0f, 0x0a, 0x0e, 0x0d, 0x58, 0xa9, 0xc7, 0xc9, 0xc2,
+  0x9c, 0x62, 0x1c, 0x08, 0x08, 0x3f, 0xe0, 0xff, 0xff, 0xfe, 0xfd, 0xf5, 0xd7, 0xda, 0xe8, 0xfc, 0xfe, 0xff, 0xff, 0xf4, 0x62, 0x0e, 0x04, 0x05, 0x04, 0x04, 0x06, 0x05, 0x06, 0x06, 0x07, 0x07,
+  0x05, 0x05, 0x03, 0x06, 0x06, 0x81, 0x07, 0x07, 0x02, 0x06, 0x07, 0xa1, 0x05, 0x06, 0x04, 0x05, 0x0d, 0x7a, 0xe7, 0xfb, 0xf9, 0xfc, 0xef, 0xd4, 0xd6, 0xcd, 0xd9, 0xc7, 0xcc, 0xd1, 0xd3, 0xd3,
+  0xd5, 0xd4, 0xce, 0xd8, 0xe5, 0xe7, 0xe7, 0xe8, 0xe7, 0xe0, 0xd1, 0xbd, 0x6c, 0x4c, 0x9a, 0xae, 0xc1, 0xca, 0xcb, 0xc5, 0xb3, 0xb4, 0xba, 0xa2, 0xa6, 0x97, 0x89, 0x8f, 0x90, 0x8d, 0x8b, 0x8a,
+  0x84, 0x7c, 0x7e, 0xaa, 0xcc, 0xd5, 0xd6, 0xd8, 0xdb, 0xe4, 0xe6, 0xe8, 0xea, 0xe9, 0x03, 0xe8, 0xe8, 0xa0, 0xe9, 0xea, 0xe9, 0xe1, 0xd6, 0xcb, 0xd5, 0xd5, 0xe0, 0xf5, 0xfc, 0xf5, 0xed, 0x8a,
+  0x1f, 0x3e, 0xb8, 0xfa, 0xfc, 0xfa, 0xfd, 0xff, 0xff, 0xfe, 0xf0, 0x7d, 0x5c, 0xef, 0xfd, 0xff, 0xf2, 0xdb, 0xd3, 0xe9, 0xef, 0xee, 0xe8, 0xd1, 0xcf, 0xdd, 0xfc, 0xfe, 0xf7, 0x7f, 0x12, 0x0b,
+  0x03, 0x05, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x05, 0x04, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x03, 0x06, 0x06, 0xa0, 0x05, 0x1b, 0xbf, 0xfc, 0xfb, 0xfa, 0xf1, 0xd4, 0xd1, 0xe7,
+  0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xec, 0xe9, 0xe7, 0xe0, 0xcf, 0xb5, 0x53, 0x7d, 0xc0, 0xda, 0xe1, 0xe6, 0xe7, 0xe7, 0xec, 0xf0, 0xed, 0xeb,
+  0xed, 0xf4, 0xf1, 0xf4, 0xef, 0xef, 0xf1, 0xf2, 0xe1, 0xb0, 0x61, 0x86, 0xd0, 0xd9, 0xdb, 0xdd, 0xdf, 0xe2, 0xe3, 0xe5, 0xe7, 0xe7, 0x02, 0xe8, 0xe8, 0x83, 0xe8, 0xe9, 0xe9, 0xea, 0xeb, 0xee,
+  0x02, 0xee, 0xed, 0x86, 0xec, 0xd2, 0xe0, 0xf6, 0xf7, 0xfb, 0xd5, 0xf3, 0xfc, 0xfe, 0xff, 0xfe, 0x02, 0xff, 0xff, 0x92, 0xfe, 0xfd, 0xf7, 0xfb, 0xfe, 0xe6, 0xda, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0,
+  0xef, 0xef, 0xef, 0xe6, 0xd2, 0xf2, 0xfb, 0xfb, 0x74, 0x12, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x03, 0x06, 0x06, 0x95, 0x06, 0x04, 0x04, 0x05,
+  0x18, 0xcc, 0xff, 0xff, 0xfe, 0xdd, 0xd3, 0xec, 0xed, 0xef, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0xef, 0xee, 0xee, 0xef, 0xee, 0xed, 0xed, 0xed, 0xee, 0xeb, 0xea, 0xe7, 0xe0, 0xd3, 0x93, 0x66, 0xbb,
+  0xd4, 0xe1, 0xe6, 0xeb, 0xed, 0xf0, 0x02, 0xf1, 0xf1, 0xc3, 0xf1, 0xf5, 0xfa, 0xf6, 0xf5, 0xf2, 0xf6, 0xf5, 0xea, 0xd6, 0xa2, 0x73, 0xce, 0xd8, 0xda, 0xde, 0xde, 0xe1, 0xe2, 0xe3, 0xe5, 0xe6,
+  0xe4, 0xe6, 0xe7, 0xe9, 0xe9, 0xe9, 0xeb, 0xec, 0xec, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xe7, 0xd7, 0xf2, 0xf7, 0xf9, 0xfa, 0xfb, 0xf5, 0xe4, 0xdf, 0xf1, 0xdb, 0xe1, 0xe7, 0xfa, 0xfe,
+  0xfd, 0xfd, 0xd5, 0xdc, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xef, 0xf0, 0xf0, 0xdd, 0xef, 0xfe, 0xf6, 0x3a, 0x09, 0x01, 0x06, 0x06, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05,
+  0x05, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x04, 0x06, 0x05, 0x05, 0x09, 0xb3, 0xfa, 0xfb, 0xf9, 0xcd, 0xe2, 0xe9, 0xed, 0xed, 0xee, 0xf1, 0xf1, 0xef, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xef, 0xef,
+  0xef, 0xf1, 0xee, 0xe8, 0xdf, 0xda, 0xce, 0xba, 0xb2, 0xb5, 0xd9, 0xde, 0xe1, 0xe7, 0xec, 0xf0, 0x02, 0xf1, 0xf1, 0xc8, 0xf8, 0xf9, 0xf2, 0xf7, 0xfd, 0xf7, 0xf6, 0xf6, 0xf9, 0xfa, 0xf2, 0xeb,
+  0xd3, 0x80, 0xbf, 0xd6, 0xd8, 0xdd, 0xde, 0xdf, 0xe0, 0xe2, 0xe5, 0xe3, 0xe4, 0xe8, 0xe7, 0xe8, 0xea, 0xed, 0xee, 0xf1, 0xf2, 0xef, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xec, 0xed, 0xd0, 0xf7,
+  0xfa, 0xfb, 0xec, 0xe3, 0xf9, 0xf6, 0xf5, 0xf8, 0xf5, 0xf0, 0xde, 0xd9, 0xf7, 0xdf, 0xdc, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf3, 0xf5, 0xf3, 0xf1, 0xf1, 0xf0, 0xf0, 0xed, 0xd6, 0xf6, 0xfd, 0xc4,
+  0x12, 0x04, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x08, 0x07, 0x06, 0x06, 0x05, 0x07, 0x07, 0x07, 0x61, 0xf9, 0xf9, 0xf2, 0xc4, 0xe8, 0xec, 0xec, 0xed,
+  0xeb, 0xef, 0xf2, 0xe9, 0xd2, 0xd6, 0xd3, 0xe8, 0xe5, 0xe8, 0xec, 0xec, 0xe8, 0xdb, 0xd1, 0xe6, 0xe0, 0xeb, 0xfb, 0xfb, 0xf7, 0xf4, 0xeb, 0xe9, 0xec, 0xee, 0xee, 0xf0, 0xf1, 0xf3, 0xf2, 0xf1,
+  0xfa, 0xfb, 0xf6, 0xf7, 0x03, 0xf8, 0xf8, 0x84, 0xf4, 0xf0, 0xf0, 0xf1, 0xe7, 0xea, 0xe3, 0xdf, 0x02, 0xe2, 0xe1, 0xa1, 0xdd, 0xdd, 0xdc, 0xe3, 0xe5, 0xe8, 0xe2, 0xd5, 0xcb, 0xda, 0xea, 0xd9,
+  0xd9, 0xe8, 0xf0, 0xee, 0xee, 0xed, 0xea, 0xde, 0xed, 0xf7, 0xfb, 0xe8, 0xeb, 0xf7, 0xf7, 0xf6, 0xf5, 0xf5, 0xf3, 0xf2, 0xf0, 0xee, 0xdd, 0xe4, 0xf4, 0xf2, 0xf3, 0xf2, 0xdd, 0xdc, 0xd7, 0xd3,
+  0xdb, 0xdb, 0xf2, 0xf0, 0xf0, 0xef, 0xeb, 0xd5, 0xf9, 0xfa, 0x59, 0x03, 0x06, 0x07, 0x05, 0x05, 0x06, 0x05, 0x07, 0x05, 0x05, 0x05, 0x02, 0x06, 0x07, 0x81, 0x07, 0x06, 0x02, 0x06, 0x06, 0xaf,
+  0x0e, 0xd8, 0xf4, 0xf0, 0xb9, 0xe8, 0xe8, 0xe8, 0xe9, 0xec, 0xea, 0xcd, 0xc9, 0xd2, 0xed, 0xef, 0xf4, 0xf8, 0xfc, 0xfc, 0xfb, 0xf9, 0xf6, 0xf7, 0xfc, 0xfd, 0xfd, 0xfb, 0xf9, 0xe5, 0xd1, 0xda,
+  0xd9, 0xca, 0xc6, 0xce, 0xd5, 0xd9, 0xdd, 0xe1, 0xe6, 0xea, 0xe9, 0xe7, 0xea, 0xeb, 0xec, 0xe2, 0xd2, 0xe3, 0xd9, 0xf5, 0xf7, 0xf7, 0xf5, 0xf6, 0xf6, 0xf9, 0xfa, 0xf8, 0xf9, 0xf8, 0xf2, 0xf2,
+  0xf1, 0xf3, 0xf0, 0xf1, 0xf4, 0xf2, 0xf6, 0xf7, 0xf7, 0xf7, 0xed, 0xed, 0xf0, 0xe0, 0xd2, 0xd4, 0xec, 0xeb, 0xdf, 0xe4, 0xef, 0xf5, 0xdc, 0xe7, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0x02, 0xf3,
+  0xf2, 0xb5, 0xf2, 0xf3, 0xf4, 0xf2, 0xf4, 0xdd, 0xe6, 0xf8, 0xfc, 0xfd, 0xfc, 0xf5, 0xb5, 0xf0, 0xf0, 0xee, 0xed, 0xde, 0xeb, 0xfd, 0xaa, 0x05, 0x06, 0x08, 0x05, 0x04, 0x06, 0x06, 0x07, 0x05,
+  0x06, 0x05, 0x05, 0x06, 0x06, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 0x08, 0x62, 0xf8, 0xf1, 0xc0, 0xdd, 0xe9, 0xe9, 0xe8, 0xe9, 0xd5, 0xcf, 0xf1, 0xf1, 0xf0, 0xf0, 0xf4, 0xf9, 0xfa, 0xfa, 0xfa,
+  0xf8, 0xf5, 0xf6, 0xf6, 0xf9, 0xeb, 0xda, 0xd8, 0xcf, 0xdc, 0xe7, 0xea, 0xea, 0xea, 0xec, 0xec, 0xed, 0xf0, 0xf0, 0xf0, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf1, 0xf0, 0xec, 0xec, 0xe7, 0xcf,
+  0xd2, 0xda, 0xd9, 0xf9, 0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf5, 0xf2, 0x03, 0xf8, 0xf8, 0x89, 0xf9, 0xfa, 0xfa, 0xf8, 0xf0, 0xf4, 0xf8, 0xf8, 0xfa, 0xf1, 0xca, 0xe3, 0xd6, 0xf0, 0xf0, 0xd7,
+  0xe3, 0xf4, 0x03, 0xf4, 0xf4, 0xab, 0xf3, 0xf3, 0xf5, 0xf5, 0xf4, 0xf4, 0xf3, 0xf2, 0xd7, 0xeb, 0xf7, 0xfc, 0xfb, 0xfa, 0xfb, 0xe4, 0x7c, 0xbd, 0xf1, 0xef, 0xec, 0xed, 0xda, 0xfb, 0xe1, 0x09,
+  0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x06, 0x08, 0x0a, 0xbb, 0xf4, 0xe1, 0xca, 0xe8, 0xea, 0xec, 0xeb, 0xd2, 0xd7, 0xed, 0xf2,
+  0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xfa, 0xff, 0xfa, 0xe8, 0xd6, 0xe1, 0xeb, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xed, 0xee, 0xee, 0xef, 0xf0, 0xf0, 0xf1, 0xf4, 0x02, 0xf5, 0xf5, 0x8b,
+  0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xef, 0xee, 0xed, 0xec, 0xe7, 0xcd, 0xdc, 0xf4, 0xfc, 0xfb, 0xfb, 0xfa, 0xf7, 0xf5, 0xf1, 0xf6, 0x03, 0xfa, 0xfa, 0x81, 0xfa, 0xf8, 0x02, 0xf1, 0xf1, 0x89,
+  0xf2, 0xf6, 0xf5, 0xdb, 0xea, 0xf9, 0xde, 0xe0, 0xee, 0xf2, 0xf1, 0xee, 0xe0, 0xd9, 0xcf, 0xd4, 0xf4, 0xf4, 0x02, 0xf3, 0xf4, 0x8a, 0xf3, 0xf5, 0xdd, 0xf1, 0xf7, 0xfc, 0xf6, 0xd8, 0xb1, 0x81,
+  0x7c, 0x8a, 0xf3, 0xef, 0xec, 0xec, 0xd6, 0xfa, 0xf7, 0x1e, 0x02, 0x06, 0x06, 0x97, 0x05, 0x04, 0x04, 0x05, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x08, 0x1b, 0xeb, 0xed,
+  0xbc, 0xea, 0xeb, 0xeb, 0xeb, 0xd6, 0xdb, 0xe7, 0xec, 0xf2, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xf8, 0xfc, 0xd2, 0xdf, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xec, 0x02, 0xec, 0xec, 0xbb,
+  0xee, 0xef, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf6, 0xf6, 0xf6, 0xf4, 0xf3, 0xf2, 0xf1, 0xf1, 0xef, 0xed, 0xed, 0xec, 0xec, 0xed, 0xeb, 0xdc, 0xdc, 0xfb, 0xfe, 0xfd, 0xfb, 0xf6, 0xf3, 0xf6,
+  0xf8, 0xf7, 0xf8, 0xfa, 0xf9, 0xf7, 0xfb, 0xfa, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xda, 0xd4, 0xee, 0xee, 0xf1, 0xf0, 0xe0, 0xe8, 0xf3, 0xf5, 0xce, 0xf6, 0xf4, 0xf2, 0xf3,
+  0xf5, 0xf7, 0xf6, 0xf5, 0xf4, 0xdc, 0xe8, 0xb0, 0x7c, 0x71, 0x74, 0x7b, 0x78, 0x78, 0xee, 0xf0, 0xed, 0xed, 0xd8, 0xfc, 0xfb, 0x2c, 0x04, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06, 0x06, 0x07, 0x06,
+  0x05, 0x05, 0x06, 0x06, 0x05, 0x07, 0x07, 0x07, 0x08, 0x47, 0xf0, 0xed, 0xb4, 0xeb, 0xea, 0xe9, 0xe7, 0xc5, 0xea, 0xec, 0xf4, 0xfa, 0x02, 0xfa, 0xfa, 0x84, 0xfa, 0xf7, 0xf6, 0xf6, 0xf6, 0xcf,
+  0xe7, 0xee, 0x02, 0xf0, 0xf0, 0x9c, 0xed, 0xec, 0xec, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf3, 0xf2, 0xf1, 0xee, 0xec, 0xec, 0xeb,
+  0xed, 0xec, 0xec, 0xec, 0xeb, 0xd9, 0xee, 0xfb, 0xff, 0xfc, 0xf7, 0xf6, 0xf4, 0xf1, 0xf3, 0xfa, 0xf5, 0xf1, 0xfd, 0xfd, 0xf6, 0xf6, 0xf6, 0xfa, 0xf8, 0xf1, 0xf1, 0xf4, 0xde, 0xd4, 0x02, 0xee,
+  0xee, 0x92, 0xdb, 0xe4, 0xf2, 0xf7, 0xdf, 0xe6, 0xf3, 0xf3, 0xf1, 0xda, 0xf4, 0xf7, 0xf6, 0xf5, 0xf4, 0xf4, 0xe4, 0x87, 0x74, 0x76, 0x7a, 0x7b, 0x78, 0x73, 0xed, 0xf0, 0xed, 0xed, 0xdc, 0xfc,
+  0xfb, 0x2d, 0x05, 0x06, 0x06, 0x06, 0x02, 0x05, 0x04, 0xc2, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x07, 0x06, 0x07, 0x6d, 0xed, 0xe3, 0xb2, 0xe9, 0xe9, 0xe8, 0xe3, 0xcc, 0xed, 0xed,
+  0xf4, 0xf7, 0xf9, 0xf9, 0xf4, 0xf7, 0xfa, 0xf7, 0xf6, 0xf7, 0xd7, 0xe7, 0xec, 0xee, 0xf0, 0xf0, 0xee, 0xe8, 0xc1, 0xa6, 0x99, 0x8e, 0x7c, 0x6b, 0x60, 0x58, 0x50, 0x48, 0x46, 0x47, 0x47, 0x48,
+  0x4b, 0x4e, 0x54, 0x5b, 0x68, 0x77, 0x85, 0x99, 0xb4, 0xd8, 0xed, 0xef, 0xee, 0xed, 0xed, 0xec, 0xed, 0xee, 0xe1, 0xd7, 0xfc, 0xfa, 0xfa, 0xf7, 0xf6, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf8, 0xf8,
+  0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf7, 0xf7, 0xd7, 0xd5, 0xef, 0xee, 0xef, 0xef, 0xda, 0xdc, 0xf0, 0xf6, 0xea, 0xdb, 0xf3, 0xf3, 0xf2, 0xe8, 0xda, 0xd3, 0xed, 0xf6, 0xf5, 0xf5, 0xf6, 0xf8, 0xf5,
+  0xa6, 0x7a, 0x7a, 0x78, 0x76, 0x80, 0xf2, 0xf0, 0xed, 0xee, 0xd8, 0xfb, 0xf5, 0x1c, 0x02, 0x07, 0x06, 0x02, 0x06, 0x05, 0x98, 0x06, 0x06, 0x08, 0x06, 0x04, 0x05, 0x06, 0x04, 0x05, 0x06, 0x06,
+  0x70, 0xed, 0xe4, 0xb8, 0xe9, 0xe8, 0xe7, 0xdd, 0xe0, 0xf0, 0xf0, 0xf3, 0xf6, 0xf9, 0xf9, 0xf1, 0xf5, 0xfa, 0xf7, 0xf8, 0xe5, 0xe1, 0xec, 0xed, 0xed, 0xee, 0xdf, 0x79, 0x28, 0x15, 0x15, 0x13,
+  0x12, 0x12, 0x11, 0x13, 0x11, 0x02, 0x12, 0x12, 0x8e, 0x11, 0x12, 0x16, 0x17, 0x17, 0x17, 0x18, 0x18, 0x1b, 0x1e, 0x24, 0x2a, 0x48, 0x8a, 0xd0, 0xee, 0xed, 0xec, 0xee, 0xee, 0xee, 0xe6, 0xd3,
+  0xee, 0xfa, 0xf8, 0xf6, 0xf2, 0x02, 0xf1, 0xf1, 0xa6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf3, 0xf9, 0xe4, 0xd5, 0xf0, 0xf0, 0xee, 0xee, 0xe6, 0xe4, 0xf3, 0xf5, 0xe9, 0xda, 0xed, 0xf2, 0xf1,
+  0xe9, 0xd6, 0xeb, 0xee, 0xd6, 0xe3, 0xf6, 0xf6, 0xf7, 0xf7, 0xf9, 0xf9, 0xbf, 0x7a, 0x75, 0x70, 0xb6, 0xf2, 0xef, 0xed, 0xec, 0xd2, 0xfa, 0xde, 0x09, 0x06, 0x06, 0x05, 0x07, 0x05, 0x04, 0x04,
+  0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x05, 0x06, 0x05, 0x05, 0x04, 0x6d, 0xef, 0xec, 0xb4, 0xe7, 0xe7, 0xe5, 0xd8, 0xe8, 0x02, 0xf6, 0xf6, 0xbc, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xec,
+  0xd3, 0xec, 0xeb, 0xe9, 0xea, 0xcf, 0x31, 0x0f, 0x2d, 0x5a, 0x74, 0x81, 0x8e, 0xa0, 0xad, 0xb5, 0xbc, 0xc2, 0xc6, 0xcf, 0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd4, 0xd2, 0xc7, 0xbc,
+  0x96, 0x5e, 0x24, 0x21, 0x5e, 0xc9, 0xed, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xcd, 0xf0, 0xf5, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf5, 0xf6, 0xf6, 0xfb, 0xff, 0xff, 0xfd, 0xdc, 0xcf, 0xee, 0xf0,
+  0xf0, 0xf0, 0xe4, 0xe4, 0xf7, 0xf9, 0xf5, 0xdb, 0xf1, 0xef, 0xf1, 0xf1, 0xe8, 0xe4, 0xf0, 0xf3, 0xf6, 0xf0, 0xd3, 0xf3, 0xf7, 0xf6, 0xf7, 0xf8, 0xf7, 0xc7, 0x74, 0x96, 0xf2, 0xf3, 0xef, 0xed,
+  0xe5, 0xe8, 0xf6, 0xad, 0x06, 0x08, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x02, 0x06, 0x05, 0x86, 0x05, 0x05, 0x07, 0x55, 0xf7, 0xf3, 0xba, 0xe8, 0xe7, 0xe5, 0xdc,
+  0xe2, 0x02, 0xf6, 0xf6, 0x8c, 0xf2, 0xf1, 0xf1, 0xf0, 0xef, 0xef, 0xbe, 0xe8, 0xe8, 0xe7, 0xe8, 0xe4, 0x41, 0x41, 0xb9, 0xf1, 0xf2, 0xf5, 0xf5, 0xf6, 0xf4, 0xf9, 0xfd, 0xf9, 0x07, 0xf6, 0xf6,
+  0x85, 0xf2, 0xf0, 0xf1, 0xde, 0x82, 0x34, 0x31, 0x93, 0xe8, 0xed, 0x02, 0xed, 0xec, 0xaa, 0xdc, 0xf5, 0xf6, 0xf6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf4, 0xf5, 0xf8, 0xfb, 0xfc, 0xfd, 0xdb, 0xd3, 0xed,
+  0xed, 0xf0, 0xf0, 0xe2, 0xd5, 0xf5, 0xf9, 0xfa, 0xd4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xef, 0xd2, 0xf6, 0xfa, 0xfe, 0xfb, 0xd6, 0xef, 0xf5, 0xf6, 0xf6, 0xf5, 0xf3, 0xc8, 0xed, 0xf2, 0xf2,
+  0xf0, 0xed, 0xd1, 0xf5, 0xf6, 0x5a, 0x07, 0x08, 0x07, 0x06, 0x06, 0x06, 0x04, 0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x06, 0x09, 0x53, 0xf8, 0xf6, 0xce, 0xea, 0xe8,
+  0xe7, 0xe3, 0xdb, 0x02, 0xf6, 0xf6, 0x88, 0xf2, 0xf1, 0xf0, 0xed, 0xea, 0xdb, 0xcb, 0xe7, 0xe7, 0xe6, 0xe7, 0x8f, 0x84, 0xf8, 0xfb, 0xf5, 0x03, 0xf4, 0xf4, 0x08, 0xf6, 0xf6, 0x85, 0xf5, 0xfa,
+  0xfd, 0xfd, 0xf7, 0xe4, 0x88, 0x2f, 0x5c, 0xdb, 0x02, 0xec, 0xec, 0xb4, 0xec, 0xd9, 0xf4, 0xf6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xfc, 0xfb, 0xf6, 0xeb, 0xd8, 0xed, 0xed, 0xed, 0xee, 0xe6,
+  0xd8, 0xf0, 0xf8, 0xfd, 0xd1, 0xee, 0xf1, 0xf1, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf3, 0xdf, 0xf3, 0xfe, 0xff, 0xfc, 0xd7, 0xe0, 0xf5, 0xf5, 0xf5, 0xf3, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xda, 0xe9,
+  0xf7, 0xcc, 0x0e, 0x04, 0x06, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x09, 0x07, 0x05, 0x06, 0x06, 0x08, 0x33, 0xda, 0xf9, 0xf9, 0xcf, 0xeb, 0xea, 0xe7, 0xe5, 0xdc,
+  0xf6, 0xf5, 0xf6, 0xf6, 0xf2, 0xf1, 0xf0, 0xec, 0xe9, 0xc0, 0xe7, 0xe7, 0xe7, 0xe6, 0xdb, 0x85, 0xf9, 0xfe, 0xff, 0xf8, 0x0b, 0xf6, 0xf6, 0x8e, 0xf6, 0xf8, 0xf9, 0xf8, 0xf4, 0xf2, 0xf1, 0xd3,
+  0x52, 0x46, 0xce, 0xec, 0xec, 0xec, 0xed, 0xe8, 0xdf, 0xf7, 0xf6, 0xf4, 0xf3, 0xf1, 0xf1, 0xf3, 0xfc, 0xfe, 0xeb, 0xdf, 0x02, 0xed, 0xed, 0x95, 0xe3, 0xdf, 0xf0, 0xf6, 0xfe, 0xdc, 0xe5, 0xf2,
+  0xf1, 0xf1, 0xf4, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xdb, 0xe5, 0xfe, 0xff, 0xfb, 0xd8, 0xe2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xe1, 0xe6, 0xf6, 0xef, 0x3d, 0x03, 0x03, 0x05, 0x06,
+  0x06, 0x05, 0x02, 0x05, 0x04, 0x02, 0x08, 0x06, 0x92, 0x04, 0x06, 0x04, 0x04, 0x06, 0x3a, 0xe9, 0xfe, 0xfb, 0xf9, 0xdb, 0xec, 0xec, 0xea, 0xec, 0xde, 0xf8, 0xfa, 0xf8, 0xf6, 0xf2, 0xf1, 0xf0,
+  0xea, 0xe0, 0xbd, 0xe6, 0xe7, 0xe6, 0xe4, 0xb5, 0xec, 0xff, 0xff, 0xfb, 0xf7, 0x0d, 0xf6, 0xf6, 0xa1, 0xf5, 0xf5, 0xf7, 0xf7, 0xf5, 0x7f, 0x45, 0xdb, 0xeb, 0xeb, 0xec, 0xec, 0xda, 0xed, 0xf8,
+  0xf6, 0xf3, 0xf1, 0xf1, 0xf3, 0xfc, 0xf5, 0xd3, 0xed, 0xed, 0xed, 0xed, 0xea, 0xcb, 0xea, 0xf2, 0xfa, 0xe2, 0xdc, 0xf0, 0xf2, 0xf1, 0xf0, 0xed, 0xa3, 0xd4, 0xf7, 0xf5, 0xf3, 0xf6, 0xf5, 0xe9,
+  0xdb, 0xfd, 0xfd, 0xae, 0x7a, 0xd6, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xeb, 0xdb, 0xf3, 0xf5, 0x84, 0x06, 0x03, 0x03, 0x02, 0x06, 0x06, 0x96, 0x07, 0x06, 0x06, 0x02, 0x01, 0x07, 0x08, 0x08, 0x0a,
+  0x09, 0x04, 0x06, 0x23, 0xdc, 0xfa, 0xff, 0xe8, 0xd7, 0xef, 0xf0, 0xf1, 0xf1, 0xf4, 0xdd, 0xdd, 0xf9, 0xfa, 0xf8, 0xf6, 0xf1, 0xf0, 0xea, 0xe1, 0xc2, 0xe6, 0xe6, 0xe5, 0xe1, 0xd0, 0xfc, 0xff,
+  0xf7, 0xf8, 0xf7, 0x0f, 0xf6, 0xf6, 0x9f, 0xfa, 0xf9, 0x89, 0x74, 0xe7, 0xeb, 0xec, 0xec, 0xed, 0xd6, 0xfb, 0xf6, 0xf3, 0xf1, 0xf1, 0xf2, 0xfb, 0xd8, 0xec, 0xf0, 0xed, 0xec, 0xe9, 0xd4, 0xf0,
+  0xf2, 0xfa, 0xef, 0xd5, 0xf2, 0xf1, 0xf0, 0xef, 0xef, 0xcc, 0x93, 0x62, 0xac, 0xf5, 0xf6, 0xf8, 0xf6, 0xf4, 0xf2, 0xda, 0xcd, 0x6e, 0x63, 0x66, 0xd8, 0xf3, 0xf2, 0xf0, 0xef, 0xd6, 0xf4, 0xf5,
+  0xa2, 0x0b, 0x06, 0x03, 0x03, 0x02, 0x06, 0x06, 0x83, 0x05, 0x06, 0x06, 0x04, 0x03, 0x08, 0x02, 0x09, 0x09, 0x91, 0x04, 0x0a, 0xab, 0xf9, 0xfc, 0xe4, 0xdd, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3,
+  0xf3, 0xee, 0xda, 0xf7, 0xf8, 0xf6, 0xf1, 0xf0, 0xeb, 0xdb, 0xc5, 0xe7, 0xe6, 0xe5, 0xda, 0xeb, 0xfa, 0xfb, 0xf7, 0xf9, 0xf7, 0x0f, 0xf6, 0xf6, 0xb5, 0xf8, 0xf8, 0xfa, 0x7c, 0xad, 0xeb, 0xec,
+  0xec, 0xeb, 0xdb, 0xe6, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf5, 0xce, 0xf1, 0xf0, 0xed, 0xee, 0xd4, 0xef, 0xf7, 0xfb, 0xfb, 0xcc, 0xf1, 0xf1, 0xf0, 0xee, 0xef, 0xd6, 0xf0, 0xfc, 0xc1, 0x6d, 0x92,
+  0xf3, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0xd4, 0x79, 0x60, 0x6d, 0xe2, 0xf4, 0xf3, 0xf1, 0xd4, 0xec, 0xf2, 0xbd, 0x15, 0x06, 0x05, 0x04, 0x04, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x06, 0x05, 0x07,
+  0x09, 0x0a, 0x09, 0x06, 0x06, 0x07, 0x58, 0xf5, 0xfd, 0xeb, 0xd0, 0xf3, 0xef, 0xf1, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf0, 0xed, 0xdc, 0xf1, 0xf6, 0xf1, 0xf1, 0xee, 0xd6, 0xd0, 0xe7, 0xe6, 0xe6,
+  0xd1, 0xf7, 0xf6, 0x12, 0xf6, 0xf6, 0xb3, 0xf8, 0xf2, 0x6f, 0xdc, 0xec, 0xec, 0xeb, 0xea, 0xd2, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf5, 0xc4, 0xee, 0xf0, 0xed, 0xe3, 0xed, 0xf4, 0xfd, 0xfd, 0xd3,
+  0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xd0, 0xe5, 0xf6, 0xfc, 0xfd, 0xd0, 0x91, 0xa7, 0xed, 0xf6, 0xf6, 0xf3, 0xf4, 0xf3, 0xec, 0x83, 0xd9, 0xf6, 0xf5, 0xf3, 0xd7, 0xe7, 0xeb, 0xd7, 0x29, 0x04, 0x04,
+  0x05, 0x04, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x07, 0x08, 0x09, 0x0b, 0x06, 0x05, 0x0b, 0xd4, 0xf9, 0xf7, 0xc8, 0xf1, 0xf1, 0xf0, 0xf1, 0xe4, 0xdf, 0xda, 0xea, 0xf2, 0xed,
+  0xed, 0xec, 0xce, 0xf8, 0xf5, 0xf5, 0xf2, 0xd1, 0xd3, 0xe8, 0xe8, 0xe6, 0xcf, 0x05, 0xf6, 0xf6, 0x8a, 0xe5, 0xe4, 0xe4, 0xe5, 0xe5, 0xe2, 0xe1, 0xe2, 0xdf, 0xda, 0xd6, 0xd6, 0xcc, 0xe0, 0xe8,
+  0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0x04, 0xf6, 0xf6, 0x9c, 0xf5, 0xf5, 0xd8, 0x92, 0xea, 0xeb, 0xeb, 0xe9, 0xcc, 0xf6, 0xf5, 0xf5, 0xf1, 0xf2, 0xf6, 0xc9, 0xee, 0xf0, 0xed, 0xeb, 0xd2, 0xf3, 0xfe,
+  0xce, 0xea, 0xf0, 0xf0, 0xf0, 0xf0, 0xdb, 0xe5, 0xf0, 0xfb, 0xfe, 0xe4, 0x8b, 0x8d, 0x8a, 0x97, 0xe1, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf0, 0xf9, 0xf5, 0xf5, 0xdb, 0xe5, 0xed, 0xe9, 0x56, 0x07,
+  0x05, 0x02, 0x05, 0x05, 0x95, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x05, 0x03, 0x3e, 0xfc, 0xf7, 0xd6, 0xe3, 0xf1, 0xef, 0xee, 0xde, 0xea, 0xfb, 0xfb, 0xe2,
+  0xdb, 0xec, 0xec, 0xe9, 0xcd, 0xee, 0xf6, 0xf6, 0xf4, 0xcf, 0xd5, 0xe8, 0xe8, 0xe7, 0xcd, 0x04, 0xf6, 0xf6, 0x8c, 0xf6, 0xf5, 0xd1, 0xe9, 0xed, 0xf0, 0xf1, 0xf4, 0xf3, 0xf4, 0xf6, 0xf6, 0xf3,
+  0xf2, 0xf1, 0xed, 0xe0, 0xdb, 0xd8, 0xf5, 0xfc, 0xfa, 0xf7, 0xf6, 0x04, 0xf6, 0xf6, 0x94, 0xf3, 0x9e, 0xde, 0xe8, 0xe7, 0xe6, 0xe5, 0xde, 0xf7, 0xf6, 0xf2, 0xf2, 0xf6, 0xc6, 0xef, 0xf1, 0xef,
+  0xed, 0xe5, 0xc5, 0xb8, 0xd8, 0xed, 0xf0, 0xf0, 0xf0, 0xe0, 0xd9, 0xef, 0xf7, 0xff, 0xea, 0x81, 0x8d, 0x8d, 0x87, 0x88, 0x94, 0xd5, 0xf5, 0x02, 0xf5, 0xf5, 0x9d, 0xf6, 0xf8, 0xe6, 0xe3, 0xf1,
+  0xf3, 0x7d, 0x09, 0x05, 0x06, 0x04, 0x06, 0x06, 0x04, 0x08, 0x07, 0x06, 0x06, 0x05, 0x05, 0x07, 0x07, 0x08, 0x09, 0x08, 0x08, 0x07, 0x03, 0x77, 0xfb, 0xf8, 0xcb, 0xee, 0xf1, 0xf0, 0xe4, 0xe0,
+  0xf5, 0xfa, 0xfc, 0xff, 0xd4, 0xea, 0xeb, 0xe9, 0xe9, 0xcd, 0xf6, 0xf6, 0xf5, 0xd6, 0xd8, 0xe9, 0xe8, 0xe8, 0xcb, 0xf7, 0xf6, 0x03, 0xf6, 0xf6, 0x87, 0xf6, 0xf1, 0xbe, 0xe7, 0xea, 0xee, 0xef,
+  0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0x02, 0xf0, 0xf0, 0x83, 0xed, 0xdb, 0xe0, 0xf6, 0xf9, 0xf9, 0x04, 0xf6, 0xf6, 0xb3, 0xf2, 0xde, 0xb0, 0xe5, 0xe5, 0xe6, 0xe5, 0xd5, 0xf4, 0xf6, 0xf6,
+  0xf6, 0xf2, 0xcd, 0xec, 0xee, 0xef, 0xf0, 0xf0, 0xec, 0xdb, 0xef, 0xee, 0xee, 0xee, 0xe5, 0xd6, 0xf1, 0xf5, 0xfa, 0xed, 0x83, 0x8e, 0x91, 0x91, 0x8f, 0x8a, 0x8c, 0x91, 0xd2, 0xf7, 0xf4, 0xf4,
+  0xf4, 0xf5, 0xf1, 0xdd, 0xef, 0xf1, 0xa7, 0x0b, 0x06, 0x08, 0x07, 0x06, 0x07, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x05, 0x06, 0x07, 0x05, 0x07, 0x06, 0x08, 0x08, 0x08, 0x07, 0x90, 0xf9, 0xf7,
+  0xbe, 0xef, 0xf0, 0xf1, 0xdb, 0xed, 0xf8, 0xfc, 0xfd, 0xff, 0xe6, 0xe1, 0xeb, 0xe9, 0xe8, 0xc7, 0xf6, 0xf6, 0xf6, 0xd8, 0xd7, 0xe9, 0xe8, 0xe9, 0xc9, 0xf9, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf6,
+  0xf2, 0xbc, 0xe8, 0xeb, 0xed, 0xee, 0xee, 0xf0, 0xf1, 0x02, 0xf1, 0xf1, 0x02, 0xf0, 0xf0, 0x83, 0xee, 0xed, 0xeb, 0xde, 0xf6, 0xf9, 0x04, 0xf6, 0xf6, 0x9a, 0xf2, 0xf2, 0xb2, 0xe4, 0xe5, 0xe4,
+  0xe3, 0xce, 0xf2, 0xf6, 0xf6, 0xf6, 0xf5, 0xce, 0xe8, 0xed, 0xee, 0xf1, 0xf1, 0xf2, 0xf1, 0xef, 0xed, 0xee, 0xea, 0xcc, 0xec, 0xf2, 0xf9, 0xf2, 0x87, 0x8f, 0x92, 0x96, 0x92, 0x93, 0x93, 0x92,
+  0x8f, 0xcc, 0xf6, 0xf4, 0xf2, 0xf3, 0xf2, 0xd3, 0xee, 0xf0, 0xc2, 0x19, 0x05, 0x06, 0x05, 0x06, 0x06, 0x94, 0x05, 0x06, 0x08, 0x05, 0x07, 0x06, 0x07, 0x08, 0x0c, 0x5e, 0xd2, 0xf8, 0xf5, 0xb9,
+  0xf0, 0xf0, 0xf1, 0xda, 0xf4, 0xfa, 0xff, 0xff, 0xff, 0xdf, 0xe3, 0xec, 0xea, 0xe9, 0xd0, 0xf7, 0xf6, 0xf6, 0xd7, 0xd5, 0xe9, 0xe8, 0xe9, 0xc8, 0xf9, 0xf6, 0x02, 0xf6, 0xf6, 0x8e, 0xf6, 0xf3,
+  0xf3, 0xf0, 0xb6, 0xe8, 0xec, 0xec, 0xed, 0xea, 0xeb, 0xec, 0xec, 0xee, 0xee, 0xef, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xee, 0xf0, 0xec, 0xd9, 0xf6, 0xf5, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf4, 0xf7,
+  0xc2, 0xe1, 0xe5, 0xe4, 0xe2, 0xcc, 0xf0, 0xf6, 0x02, 0xf6, 0xf6, 0x95, 0xcf, 0xec, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xed, 0xec, 0xc6, 0xe9, 0xf0, 0xf4, 0xf7, 0x8e, 0x8c, 0x91, 0x92, 0x96,
+  0x95, 0x95, 0x95, 0x96, 0xc1, 0xf5, 0xf5, 0xf2, 0xf1, 0xf3, 0xdb, 0xf1, 0xf4, 0xdf, 0x37, 0x05, 0x06, 0x07, 0x06, 0x06, 0x06, 0x07, 0x02, 0x06, 0x06, 0x94, 0x06, 0x09, 0x06, 0x06, 0x06, 0x07,
+  0x08, 0x06, 0x06, 0x0a, 0x35, 0xe0, 0xd6, 0xf7, 0xf5, 0xbc, 0xf0, 0xf0, 0xf0, 0xe4, 0xd9, 0xf8, 0xff, 0xff, 0xff, 0xd4, 0xec, 0xed, 0xea, 0xd8, 0xde, 0xf6, 0xf6, 0xf6, 0xdd, 0xd2, 0xeb, 0xe9,
+  0xe9, 0xc7, 0x03, 0xf6, 0xf6, 0x8e, 0xf6, 0xf4, 0xf1, 0xf1, 0xb5, 0xe7, 0xe9, 0xea, 0xea, 0xaa, 0x79, 0x7c, 0x7c, 0x7c, 0x7f, 0x83, 0x8d, 0xa5, 0xde, 0xef, 0xf1, 0xf0, 0xef, 0xed, 0xe4, 0xe7,
+  0xf5, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf6, 0xf7, 0xdb, 0xd1, 0xe3, 0xe4, 0xe4, 0xdb, 0xe5, 0xf6, 0x02, 0xf6, 0xf6, 0x92, 0xf3, 0xd8, 0xe8, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xeb, 0xc8, 0xe9, 0xed,
+  0xf1, 0xf3, 0x96, 0x8c, 0x91, 0x93, 0x94, 0x97, 0x96, 0x96, 0x97, 0xb0, 0xf4, 0xf5, 0xf3, 0xf2, 0xf1, 0xda, 0xf1, 0xf3, 0xed, 0x61, 0x12, 0x06, 0x02, 0x06, 0x06, 0x98, 0x06, 0x05, 0x05, 0x06,
+  0x05, 0x05, 0x07, 0x09, 0x07, 0x07, 0x05, 0x05, 0x06, 0x08, 0x06, 0x0b, 0xb0, 0xf1, 0xd6, 0xed, 0xf1, 0xc3, 0xed, 0xee, 0xef, 0xee, 0xdc, 0xd5, 0xf2, 0xe7, 0xd5, 0xea, 0xee, 0xed, 0xeb, 0xcf,
+  0xf5, 0xf6, 0xf6, 0xf6, 0xe3, 0xd1, 0xec, 0xea, 0xe9, 0xc6, 0xf5, 0xf6, 0x02, 0xf6, 0xf6, 0x8e, 0xf6, 0xf5, 0xf1, 0xf1, 0xb6, 0xe7, 0xe8, 0xe9, 0xe9, 0xae, 0x2b, 0x1b, 0x23, 0x25, 0x21, 0x20,
+  0x23, 0x28, 0x32, 0xa3, 0xf0, 0xf1, 0xf0, 0xee, 0xf0, 0xd6, 0xf1, 0xf6, 0x04, 0xf6, 0xf6, 0x84, 0xf5, 0xb9, 0xe2, 0xe4, 0xe4, 0xe6, 0xca, 0xf6, 0x02, 0xf6, 0xf6, 0x93, 0xf6, 0xfb, 0xd4, 0xe7,
+  0xee, 0xf0, 0xf0, 0xef, 0xd3, 0xdd, 0xeb, 0xf3, 0xf8, 0xaa, 0x88, 0x91, 0x93, 0x94, 0x96, 0x97, 0x99, 0x99, 0xa6, 0xef, 0xf6, 0xf4, 0xf2, 0xf2, 0xd8, 0xf4, 0xf5, 0xf5, 0x8f, 0x32, 0x11, 0x08,
+  0x05, 0x04, 0x02, 0x05, 0x05, 0x97, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x07, 0x07, 0x06, 0x05, 0x05, 0x06, 0x53, 0xea, 0xef, 0xf1, 0xd0, 0xf1, 0xe6, 0xc9, 0xee, 0xf0, 0xf0, 0xf1, 0xf0,
+  0xe8, 0xec, 0xf0, 0xf0, 0xee, 0xed, 0xe4, 0xde, 0xf0, 0xf6, 0xf6, 0xf4, 0xe2, 0xcf, 0xec, 0xea, 0xe8, 0xc9, 0xf7, 0xf7, 0x02, 0xf6, 0xf6, 0x8e, 0xf6, 0xf5, 0xf2, 0xf1, 0xb7, 0xe8, 0xe9, 0xe9,
+  0xe9, 0xd7, 0xe3, 0xd7, 0xbf, 0xc0, 0xca, 0xc7, 0xbe, 0xa4, 0x62, 0x2c, 0xa7, 0xf0, 0xf1, 0xf0, 0xee, 0xd4, 0xf2, 0xf7, 0x04, 0xf6, 0xf6, 0x84, 0xf8, 0xb9, 0xe2, 0xe4, 0xe4, 0xe7, 0xd0, 0xf6,
+  0x02, 0xf6, 0xf6, 0x94, 0xf7, 0xf9, 0xd5, 0xeb, 0xed, 0xee, 0xec, 0xd8, 0xd5, 0xeb, 0xf3, 0xf7, 0xbb, 0x85, 0x8e, 0x91, 0x93, 0x95, 0x98, 0x9a, 0x9d, 0xa2, 0xe8, 0xf4, 0xf4, 0xf4, 0xf0, 0xda,
+  0xea, 0xf7, 0xf4, 0xc6, 0x5c, 0x2e, 0x11, 0x08, 0x04, 0x05, 0x06, 0x06, 0x02, 0x05, 0x05, 0x02, 0x06, 0x05, 0x89, 0x07, 0x05, 0x05, 0x03, 0x04, 0x07, 0x14, 0xcb, 0xee, 0xee, 0xed, 0xd3, 0xf2,
+  0xf3, 0xd6, 0xdd, 0xed, 0xf0, 0x02, 0xf1, 0xf1, 0x89, 0xf0, 0xf0, 0xf0, 0xe8, 0xce, 0xef, 0xf1, 0xf6, 0xf6, 0xf2, 0xe0, 0xcf, 0xeb, 0xea, 0xe8, 0xce, 0xf9, 0xf8, 0x03, 0xf6, 0xf6, 0x8d, 0xf4,
+  0xf1, 0xb3, 0xe8, 0xe9, 0xe9, 0xea, 0xd3, 0xf6, 0xf8, 0xf3, 0xf7, 0xf9, 0xf7, 0xf7, 0xf7, 0xf9, 0xd4, 0x70, 0xe7, 0xf0, 0xf0, 0xef, 0xe8, 0xdf, 0xfa, 0x04, 0xf6, 0xf6, 0xa7, 0xf6, 0xbb, 0xe3,
+  0xe5, 0xe5, 0xe7, 0xd6, 0xf6, 0xf9, 0xf9, 0xf6, 0xf6, 0xf5, 0xda, 0xe3, 0xed, 0xed, 0xed, 0xe3, 0xd1, 0xea, 0xf1, 0xf8, 0xe0, 0x80, 0x8d, 0x90, 0x91, 0x94, 0x96, 0x99, 0x9b, 0xa0, 0xe1, 0xf6,
+  0xf4, 0xf5, 0xf3, 0xdc, 0xe7, 0xf6, 0xf7, 0xcc, 0xf0, 0x90, 0x32, 0x10, 0x07, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x05, 0x05, 0x07, 0x06, 0x05, 0x05, 0x05, 0x07, 0x05, 0x03, 0x02, 0x04, 0x72,
+  0xef, 0xee, 0xed, 0xee, 0xe3, 0xcb, 0xf5, 0xf5, 0xd8, 0xda, 0xee, 0x02, 0xf1, 0xf1, 0x88, 0xf1, 0xf2, 0xe4, 0xd4, 0xf7, 0xf4, 0xf1, 0xf6, 0xf6, 0xf2, 0xdf, 0xce, 0xec, 0xea, 0xe8, 0xd0, 0x04,
+  0xf6, 0xf6, 0x86, 0xf4, 0xf1, 0xb4, 0xe8, 0xe8, 0xe9, 0xed, 0xcc, 0xf9, 0xf5, 0xf3, 0xf6, 0x02, 0xf6, 0xf6, 0x85, 0xf7, 0xfb, 0xee, 0xc8, 0xf1, 0xf1, 0xf1, 0xf2, 0xd8, 0xf5, 0x03, 0xf6, 0xf6,
+  0xb2, 0xf6, 0xf7, 0xfa, 0xbd, 0xe4, 0xe7, 0xe7, 0xe8, 0xd7, 0xf6, 0xfe, 0xfd, 0xf6, 0xf7, 0xd8, 0xde, 0xee, 0xed, 0xec, 0xea, 0xc9, 0xf1, 0xf3, 0xfa, 0xf4, 0x7f, 0x8d, 0x8f, 0x90, 0x93, 0x95,
+  0x98, 0x98, 0x9b, 0xd5, 0xf6, 0xf6, 0xf4, 0xf3, 0xe8, 0xe5, 0xf1, 0xf6, 0xc6, 0xec, 0xef, 0xd8, 0x30, 0x12, 0x09, 0x08, 0x07, 0x08, 0x06, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x06, 0x05, 0x07,
+  0x06, 0x04, 0x03, 0x04, 0x1a, 0xd9, 0xf0, 0xee, 0xed, 0xee, 0xbc, 0x89, 0xdb, 0xf5, 0xf5, 0xe1, 0xd1, 0xe3, 0xf2, 0xf1, 0xf1, 0xf3, 0xd7, 0xe2, 0xef, 0xf2, 0xf2, 0xf1, 0xf6, 0xf4, 0xec, 0xde,
+  0xcb, 0xec, 0xea, 0xe8, 0xcf, 0x04, 0xf6, 0xf6, 0x86, 0xf4, 0xf1, 0xb5, 0xea, 0xeb, 0xec, 0xec, 0xcb, 0xfa, 0xf5, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xf7, 0xd4, 0xf4, 0xf1, 0xf1, 0xef, 0xd5,
+  0xf7, 0x04, 0xf6, 0xf6, 0xb1, 0xf6, 0xc1, 0xe6, 0xe7, 0xe7, 0xe7, 0xdb, 0xf6, 0xf8, 0xf8, 0xf6, 0xe9, 0xd4, 0xef, 0xed, 0xec, 0xeb, 0xd0, 0xef, 0xf4, 0xfc, 0xfb, 0x95, 0x89, 0x90, 0x91, 0x93,
+  0x95, 0x96, 0x9a, 0x99, 0xca, 0xf7, 0xf6, 0xf6, 0xf4, 0xed, 0xd3, 0xef, 0xf9, 0xc3, 0xe3, 0xee, 0xef, 0xf1, 0x72, 0x14, 0x0a, 0x08, 0x08, 0x05, 0x05, 0x06, 0x07, 0x05, 0x04, 0x06, 0x05, 0x05,
+  0x06, 0x06, 0x06, 0x05, 0x05, 0x07, 0x7d, 0xf0, 0xef, 0xee, 0xed, 0xdd, 0x8f, 0x94, 0x97, 0xea, 0xf9, 0xf7, 0xfa, 0xd9, 0xf0, 0xf0, 0xf0, 0xef, 0xe1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xef,
+  0xee, 0xe0, 0xc7, 0xea, 0xea, 0xe8, 0xce, 0x04, 0xf6, 0xf6, 0x86, 0xf4, 0xf1, 0xb6, 0xea, 0xec, 0xec, 0xec, 0xc6, 0xfb, 0xf5, 0xf4, 0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xec, 0xdc, 0xf0, 0xf0, 0xf0,
+  0xda, 0xdd, 0xf4, 0x04, 0xf6, 0xf6, 0x9c, 0xf7, 0xbe, 0xe9, 0xe7, 0xe8, 0xe7, 0xd0, 0xf6, 0xf6, 0xf7, 0xf3, 0xce, 0xec, 0xed, 0xed, 0xeb, 0xd6, 0xe5, 0xf3, 0xf9, 0xff, 0xb0, 0x82, 0x8d, 0x91,
+  0x91, 0x95, 0x98, 0x9a, 0x9a, 0xbb, 0xf6, 0xf7, 0xf6, 0xf5, 0xef, 0xd1, 0xee, 0xf8, 0xcb, 0xa3, 0xed, 0xf0, 0xf0, 0xf0, 0xd8, 0x23, 0x09, 0x06, 0x04, 0x05, 0x03, 0x04, 0x04, 0x05, 0x05, 0x03,
+  0x04, 0x05, 0x82, 0x05, 0x06, 0x1c, 0xdc, 0x02, 0xee, 0xee, 0x8e, 0xa7, 0x92, 0x95, 0x97, 0x98, 0xd6, 0xf8, 0xf6, 0xe7, 0xed, 0xf0, 0xef, 0xee, 0xdd, 0xf0, 0xf1, 0xf5, 0xfa, 0xf3, 0xf9, 0xf2,
+  0xef, 0xe2, 0xc6, 0xe9, 0xeb, 0xe9, 0xce, 0x04, 0xf6, 0xf6, 0x85, 0xf4, 0xf2, 0xbc, 0xeb, 0xed, 0xed, 0xee, 0xd0, 0xfb, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf6, 0xf8, 0xd5, 0xee, 0xef, 0xf0, 0xf0,
+  0xc6, 0xef, 0xf4, 0x03, 0xf6, 0xf6, 0x99, 0xf6, 0xf7, 0xef, 0xd1, 0xec, 0xeb, 0xe9, 0xd3, 0xec, 0xf6, 0xf6, 0xf6, 0xd1, 0xef, 0xee, 0xee, 0xed, 0xdd, 0xdf, 0xf2, 0xf7, 0xfb, 0xe0, 0x7d, 0x90,
+  0x91, 0x95, 0x96, 0x98, 0x9b, 0x9c, 0xac, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xd1, 0xef, 0xf0, 0xdb, 0x9f, 0xab, 0xd3, 0xef, 0xee, 0xed, 0xed, 0x7b, 0x0c, 0x02, 0x08, 0x08, 0x97, 0x09, 0x07, 0x03,
+  0x06, 0x05, 0x05, 0x04, 0x07, 0x04, 0x05, 0x05, 0x09, 0x77, 0xef, 0xee, 0xee, 0xee, 0xd7, 0x8d, 0x92, 0x93, 0x95, 0x96, 0x99, 0xd8, 0xfb, 0xda, 0xee, 0xf1, 0xef, 0xe7, 0xe0, 0xf2, 0xf3, 0xf3,
+  0xf6, 0xf5, 0xf9, 0xf2, 0xf0, 0xde, 0xc4, 0xea, 0xea, 0xe9, 0xcd, 0x04, 0xf6, 0xf6, 0x8d, 0xf6, 0xf5, 0xc7, 0xed, 0xee, 0xee, 0xee, 0xe6, 0xf9, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf3, 0xf1, 0xe3,
+  0xd3, 0xeb, 0xef, 0xef, 0xf0, 0xeb, 0xc8, 0xef, 0xf4, 0x03, 0xf6, 0xf6, 0x90, 0xf6, 0xf8, 0xd4, 0xe6, 0xed, 0xed, 0xec, 0xcc, 0xf7, 0xf6, 0xfa, 0xdb, 0xe9, 0xf3, 0xee, 0xf0, 0xe9, 0xd4, 0xf0,
+  0xf4, 0xfa, 0xe7, 0x86, 0x8f, 0x92, 0x94, 0x96, 0x97, 0x9c, 0x9d, 0xa6, 0xea, 0x02, 0xf4, 0xf4, 0xa0, 0xcd, 0xed, 0xf0, 0xe8, 0x9c, 0xac, 0xa8, 0xb0, 0xef, 0xf0, 0xed, 0xed, 0xd2, 0x1f, 0x07,
+  0x08, 0x09, 0x08, 0x0c, 0x06, 0x04, 0x07, 0x05, 0x05, 0x04, 0x08, 0x04, 0x05, 0x07, 0x18, 0xd4, 0xf0, 0xef, 0xed, 0xee, 0xa9, 0x8f, 0x8f, 0x90, 0x92, 0x94, 0x95, 0xc9, 0xfa, 0xce, 0xf0, 0xf1,
+  0xef, 0xe1, 0xe6, 0xf5, 0xf6, 0xf4, 0xf2, 0xf8, 0xf9, 0xf0, 0xf0, 0xdb, 0xc3, 0xec, 0xea, 0xe8, 0xce, 0x04, 0xf6, 0xf6, 0x8d, 0xf6, 0xf4, 0xca, 0xee, 0xee, 0xef, 0xef, 0xe6, 0xdc, 0xd8, 0xd6,
+  0xd2, 0xcd, 0xce, 0xcd, 0xd1, 0xd9, 0xea, 0xec, 0xef, 0xf0, 0xf0, 0xc7, 0xeb, 0xee, 0xf4, 0x04, 0xf6, 0xf6, 0xb1, 0xd4, 0xee, 0xec, 0xed, 0xe9, 0xd4, 0xf5, 0xf6, 0xe7, 0xde, 0xf1, 0xf1, 0xf0,
+  0xee, 0xcc, 0xf0, 0xf0, 0xf6, 0xf6, 0x8d, 0x8f, 0x92, 0x93, 0x96, 0x98, 0x9b, 0x9d, 0xa1, 0xdc, 0xf3, 0xf2, 0xf2, 0xf3, 0xd6, 0xea, 0xf1, 0xf0, 0xa1, 0xad, 0xaa, 0xa6, 0xa4, 0xd9, 0xef, 0xee,
+  0xec, 0xea, 0x5e, 0x08, 0x08, 0x09, 0x09, 0x07, 0x06, 0x06, 0x04, 0x06, 0x05, 0x07, 0x07, 0x04, 0x04, 0x07, 0x59, 0xee, 0xee, 0xed, 0xed, 0xdc, 0x8c, 0x8e, 0x8e, 0x8f, 0x92, 0x92, 0x94, 0xbf,
+  0xf8, 0xd3, 0xf2, 0xf0, 0xee, 0xdc, 0xec, 0xf5, 0xf6, 0xf6, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xd7, 0xc3, 0xec, 0xea, 0xe8, 0xd1, 0x04, 0xf6, 0xf6, 0x8d, 0xf6, 0xf5, 0xc7, 0xf0, 0xf0, 0xf1, 0xf1,
+  0xf1, 0xf2, 0xf1, 0xee, 0xec, 0xef, 0xed, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xed, 0xed, 0xda, 0xd8, 0xe9, 0xf0, 0xf4, 0x04, 0xf6, 0xf6, 0xb1, 0xd0, 0xec, 0xec, 0xeb, 0xd6, 0xea, 0xf8, 0xed, 0xe3,
+  0xf2, 0xf1, 0xf1, 0xf0, 0xd3, 0xeb, 0xf0, 0xf6, 0xf6, 0x93, 0x8e, 0x94, 0x95, 0x96, 0x97, 0x99, 0x9c, 0x9f, 0xd6, 0xf4, 0xf1, 0xf1, 0xf0, 0xde, 0xe5, 0xee, 0xf2, 0xa5, 0xa8, 0xab, 0xa9, 0xa6,
+  0xa4, 0xb3, 0xef, 0xed, 0xec, 0xea, 0xb7, 0x12, 0x0a, 0x08, 0x07, 0x08, 0x08, 0x08, 0x07, 0x05, 0x06, 0x07, 0x06, 0x03, 0x04, 0x08, 0xae, 0xf1, 0xee, 0xed, 0xee, 0xaf, 0x8b, 0x8b, 0x8b, 0x8e,
+  0x90, 0x92, 0x95, 0xc5, 0xfa, 0xce, 0xf3, 0xf0, 0xed, 0xda, 0xf3, 0xf5, 0xf6, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xd3, 0xc2, 0xec, 0xea, 0xe8, 0xd3, 0x04, 0xf6, 0xf6, 0x8d, 0xf6, 0xf5, 0xc6,
+  0xf2, 0xf0, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf0, 0xee, 0xef, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xd6, 0xc0, 0xed, 0xed, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0xb3, 0xf6, 0xdf, 0xe7, 0xed, 0xed,
+  0xd1, 0xe7, 0xf0, 0xf8, 0xd9, 0xf3, 0xf2, 0xf1, 0xf1, 0xe1, 0xdf, 0xed, 0xf6, 0xfa, 0xab, 0x8d, 0x91, 0x94, 0x96, 0x98, 0x98, 0x9b, 0x9f, 0xcd, 0xf4, 0xf4, 0xf1, 0xf1, 0xe0, 0xda, 0xf0, 0xf2,
+  0xad, 0xa3, 0xa5, 0xa7, 0xa5, 0xa4, 0xa3, 0xa0, 0xdd, 0xec, 0xec, 0xea, 0xe7, 0x3c, 0x0b, 0x06, 0x06, 0x09, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x04, 0x03, 0x05, 0x2e, 0xe7, 0xed, 0xed, 0xee,
+  0xe8, 0x8c, 0x88, 0x88, 0x8b, 0x8c, 0x8f, 0x92, 0x93, 0xc2, 0xff, 0xd8, 0xf4, 0xf0, 0xee, 0xdd, 0xf1, 0xf7, 0xf7, 0xf6, 0xf6, 0xf2, 0xf1, 0xf1, 0xef, 0xd5, 0xc3, 0xec, 0xea, 0xe8, 0xd3, 0xf7,
+  0xf6, 0x03, 0xf6, 0xf6, 0x8d, 0xf6, 0xf1, 0xd0, 0xf0, 0xef, 0xf1, 0xf3, 0xf4, 0xf2, 0xf1, 0xf0, 0xef, 0xee, 0xed, 0xed, 0xed, 0xec, 0xec, 0xed, 0xad, 0x68, 0xe3, 0xf5, 0xf3, 0xf4, 0xf6, 0x03,
+  0xf6, 0xf6, 0xb3, 0xf8, 0xd5, 0xef, 0xf0, 0xe0, 0xe2, 0xf1, 0xf6, 0xd8, 0xf1, 0xf3, 0xf4, 0xf1, 0xe4, 0xd7, 0xf0, 0xf5, 0xfc, 0xb0, 0x8a, 0x94, 0x95, 0x97, 0x97, 0x9a, 0x9a, 0x9a, 0xc1, 0xf2,
+  0xf3, 0xf3, 0xf3, 0xeb, 0xde, 0xef, 0xf8, 0xba, 0xa2, 0xa5, 0xa5, 0xa4, 0xa2, 0xa2, 0xa2, 0xa1, 0xbe, 0xed, 0xec, 0xeb, 0xea, 0x8f, 0x0f, 0x07, 0x06, 0x09, 0x06, 0x07, 0x06, 0x06, 0x04, 0x04,
+  0x05, 0x03, 0x07, 0x70, 0xed, 0xed, 0xed, 0xee, 0xc4, 0x89, 0x87, 0x87, 0x89, 0x8c, 0x90, 0x8d, 0xae, 0xee, 0xff, 0xed, 0xf2, 0xf1, 0xf0, 0xdf, 0xf6, 0xfa, 0xf9, 0xf7, 0xf6, 0xf2, 0xf1, 0xf1,
+  0xef, 0xd6, 0xc4, 0xec, 0xea, 0xe8, 0xd4, 0xf7, 0xf6, 0x03, 0xf6, 0xf6, 0x8b, 0xf6, 0xf4, 0xc8, 0xa5, 0xb4, 0xb9, 0xb6, 0xb2, 0xbc, 0xc2, 0xc8, 0xce, 0xd5, 0xdc, 0xdc, 0xd1, 0xb7, 0x92, 0x50,
+  0x31, 0xcc, 0xf3, 0x04, 0xf6, 0xf6, 0xb4, 0xf8, 0xfa, 0xe8, 0xe9, 0xef, 0xe8, 0xde, 0xec, 0xf6, 0xdf, 0xec, 0xf1, 0xf3, 0xf2, 0xea, 0xd4, 0xee, 0xf4, 0xfa, 0xc9, 0x86, 0x90, 0x94, 0x96, 0x97,
+  0x9a, 0x9d, 0x9c, 0xb6, 0xf0, 0xf1, 0xf1, 0xf1, 0xee, 0xcd, 0xf3, 0xf6, 0xcc, 0xa0, 0xa6, 0xa4, 0xa2, 0xa1, 0xa0, 0x9f, 0xa0, 0xa0, 0xa4, 0xec, 0xec, 0xeb, 0xeb, 0xcc, 0x20, 0x0b, 0x09, 0x07,
+  0x0a, 0x08, 0x08, 0x04, 0x04, 0x05, 0x06, 0x04, 0x0a, 0xb0, 0xed, 0xed, 0xee, 0xf0, 0xa1, 0x89, 0x87, 0x88, 0x87, 0x89, 0x86, 0xc2, 0xf8, 0xfa, 0xfe, 0xf1, 0xf0, 0xf2, 0xf1, 0xe1, 0xf8, 0xfa,
+  0xfa, 0xf8, 0xf6, 0xf2, 0xf1, 0xf1, 0xf0, 0xd7, 0xc6, 0xec, 0xea, 0xe8, 0xd4, 0xf5, 0xf6, 0x04, 0xf6, 0xf6, 0x8b, 0xc9, 0x4a, 0x38, 0x2d, 0x25, 0x17, 0x12, 0x11, 0x11, 0x13, 0x17, 0x1b, 0x1c,
+  0x1c, 0x1b, 0x1d, 0x5c, 0xd9, 0xf1, 0xf1, 0xf5, 0xf6, 0x03, 0xf6, 0xf6, 0xb4, 0xfb, 0xf9, 0xd9, 0xf2, 0xf0, 0xd6, 0xeb, 0xf2, 0xe1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf0, 0xce, 0xf3, 0xf5, 0xfb, 0xd5,
+  0x83, 0x8f, 0x93, 0x94, 0x97, 0x99, 0x9e, 0x9f, 0xad, 0xee, 0xf1, 0xf1, 0xf1, 0xed, 0xde, 0xf1, 0xf3, 0xd9, 0x9f, 0xa2, 0xa5, 0xa3, 0xa1, 0x9e, 0x9e, 0x9d, 0x9e, 0x9f, 0xa0, 0xd8, 0xee, 0xec,
+  0xeb, 0xe9, 0x4f, 0x0d, 0x09, 0x06, 0x0b, 0x0a, 0x0b, 0x07, 0x05, 0x06, 0x04, 0x04, 0x1b, 0xe6, 0xed, 0xed, 0xed, 0xe1, 0x88, 0x86, 0x85, 0x85, 0x85, 0x82, 0xc0, 0xf8, 0xfd, 0xfa, 0xdf, 0xea,
+  0xf2, 0xf4, 0xf2, 0xef, 0xd7, 0xe3, 0xfb, 0xfa, 0xf7, 0xf5, 0xf1, 0xf1, 0xf4, 0xdd, 0xc8, 0xec, 0xea, 0xe8, 0xd3, 0xf3, 0xf6, 0x04, 0xf6, 0xf6, 0x8b, 0xe8, 0xa1, 0x8c, 0x85, 0x6d, 0x50, 0x34,
+  0x2d, 0x21, 0x1d, 0x1c, 0x22, 0x2f, 0x45, 0x76, 0xbd, 0xf7, 0xf6, 0xf1, 0xf1, 0xf5, 0xf6, 0x03, 0xf6, 0xf6, 0x96, 0xf9, 0xd9, 0xf1, 0xf1, 0xda, 0xe9, 0xf5, 0xde, 0xe3, 0xf1, 0xf1, 0xf1, 0xef,
+  0xcf, 0xef, 0xf6, 0xfa, 0xe6, 0x84, 0x90, 0x93, 0x94, 0x97, 0x99, 0x9b, 0x9d, 0xa5, 0xe9, 0xf4, 0xf2, 0xf1, 0xf2, 0xd1, 0xef, 0xf2, 0xe0, 0xa1, 0xa5, 0xa5, 0xa4, 0xa2, 0xa0, 0x9d, 0x9c, 0x02,
+  0x9e, 0x9f, 0x9c, 0xb9, 0xee, 0xec, 0xe9, 0xe7, 0x96, 0x0f, 0x08, 0x06, 0x05, 0x09, 0x08, 0x07, 0x05, 0x06, 0x05, 0x06, 0x53, 0xec, 0xec, 0xec, 0xed, 0xc5, 0x88, 0x86, 0x84, 0x84, 0x83, 0xa5,
+  0xf7, 0xfb, 0xf1, 0xd8, 0xf6, 0xf6, 0xf2, 0xf4, 0xf2, 0xf0, 0xee, 0xe4, 0xda, 0xfa, 0xf7, 0xf6, 0xf2, 0xf1, 0xf5, 0xde, 0xcb, 0xec, 0xea, 0xe9, 0xd2, 0xf3, 0xf6, 0x04, 0xf6, 0xf6, 0x8b, 0xf6,
+  0xf2, 0xf3, 0xf6, 0xf8, 0xfa, 0xf8, 0xf6, 0xf6, 0xf7, 0xf7, 0xf6, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf6, 0xf2, 0xf5, 0xf6, 0x02, 0xf6, 0xf6, 0xb5, 0xf7, 0xf7, 0xd5, 0xe8, 0xf1, 0xdf, 0xea,
+  0xf1, 0xea, 0xd8, 0xf0, 0xf1, 0xf2, 0xf1, 0xd7, 0xe8, 0xf0, 0xf5, 0xf0, 0x84, 0x8d, 0x93, 0x96, 0x96, 0x98, 0x9c, 0x9c, 0xa1, 0xe4, 0xf4, 0xf3, 0xf2, 0xf2, 0xdd, 0xef, 0xf5, 0xeb, 0x98, 0xa4,
+  0xa4, 0xa4, 0xa3, 0xa0, 0x9f, 0x9d, 0x9f, 0x9e, 0x9d, 0x9d, 0x9a, 0x92, 0xe9, 0xec, 0xe9, 0xe7, 0xc9, 0x1d, 0x0c, 0x04, 0x09, 0x05, 0x08, 0x07, 0x05, 0x05, 0x05, 0x07, 0x91, 0xec, 0xec, 0xec,
+  0xed, 0xac, 0x87, 0x85, 0x86, 0x84, 0x7d, 0xed, 0xfb, 0xf6, 0xd2, 0xf6, 0xf5, 0xf5, 0xf2, 0xf3, 0xf1, 0xf1, 0xf0, 0xee, 0xe9, 0xdb, 0xf5, 0xf8, 0xf5, 0xf1, 0xf5, 0xdd, 0xcb, 0xec, 0xea, 0xe9,
+  0xd3, 0xf7, 0xf6, 0x05, 0xf6, 0xf6, 0x82, 0xf6, 0xf4, 0xf5, 0xf6, 0x0a, 0xf6, 0xf6, 0x8e, 0xf8, 0xdf, 0xe1, 0xf2, 0xe5, 0xeb, 0xee, 0xee, 0xd1, 0xef, 0xf0, 0xf3, 0xf1, 0xcf, 0xe1, 0xef, 0xf7,
+  0xf6, 0x96, 0x8d, 0x93, 0x97, 0x97, 0x98, 0x9b, 0x9c, 0x9e, 0xdc, 0x02, 0xf2, 0xf2, 0x8a, 0xdb, 0xe0, 0xf2, 0xf2, 0x97, 0xa1, 0xa4, 0xa3, 0xa2, 0xa1, 0xa0, 0x9f, 0x9f, 0x9d, 0x9e, 0x9c, 0x9b,
+  0x91, 0x86, 0xd0, 0x02, 0xeb, 0xe8, 0x86, 0x3e, 0x0d, 0x0a, 0x09, 0x0a, 0x0a, 0x05, 0x05, 0x07, 0x05, 0x0e, 0xcb, 0x02, 0xec, 0xec, 0x91, 0x93, 0x87, 0x85, 0x84, 0x82, 0xac, 0xf9, 0xf7, 0xcf,
+  0xf1, 0xf5, 0xf5, 0xf3, 0xf4, 0xf1, 0xf1, 0xf1, 0xef, 0xec, 0xeb, 0xe8, 0xd4, 0xf9, 0xf5, 0xf1, 0xf3, 0xe0, 0xcd, 0xed, 0xeb, 0xea, 0xd2, 0xf7, 0xf6, 0x0f, 0xf6, 0xf6, 0x9f, 0xf5, 0xf5, 0xf7,
+  0xfa, 0xd2, 0xe1, 0xee, 0xe5, 0xe0, 0xf2, 0xf4, 0xd0, 0xef, 0xef, 0xef, 0xf0, 0xdc, 0xe5, 0xf0, 0xf7, 0xf8, 0x96, 0x91, 0x93, 0x95, 0x98, 0x99, 0x9b, 0x9d, 0x9c, 0xd3, 0xf4, 0xf2, 0xf1, 0xf1,
+  0xe4, 0xdc, 0xea, 0xef, 0x9e, 0xa0, 0xa1, 0xa3, 0xa2, 0xa2, 0xa0, 0xa0, 0x9f, 0x9e, 0x9e, 0x9b, 0x9b, 0x93, 0x87, 0x83, 0xb1, 0xec, 0xea, 0xeb, 0xe9, 0x69, 0x0d, 0x02, 0x08, 0x09, 0x95, 0x06,
+  0x06, 0x07, 0x06, 0x25, 0xe9, 0xec, 0xec, 0xec, 0xd7, 0x88, 0x87, 0x84, 0x85, 0x82, 0xdd, 0xf9, 0xe9, 0xde, 0xf1, 0xf3, 0xf4, 0xea, 0xd9, 0xe5, 0xe0, 0xcd, 0xe5, 0xea, 0xea, 0xea, 0xce, 0xf3,
+  0xf5, 0xf1, 0xf1, 0xe6, 0xcf, 0xed, 0xec, 0xeb, 0xd1, 0x0f, 0xf6, 0xf6, 0xb7, 0xf6, 0xf5, 0xf2, 0xf2, 0xf2, 0xd9, 0xe2, 0xee, 0xe7, 0xdb, 0xec, 0xf0, 0xce, 0xea, 0xed, 0xee, 0xf0, 0xdd, 0xd8,
+  0xf0, 0xf9, 0xfd, 0xa5, 0x90, 0x92, 0x93, 0x98, 0x9b, 0x9c, 0x9c, 0x9d, 0xc8, 0xf4, 0xf4, 0xf2, 0xf1, 0xec, 0xd9, 0xeb, 0xef, 0xc2, 0x97, 0xa1, 0xa1, 0xa1, 0xa2, 0xa1, 0x9e, 0xa0, 0xa0, 0x9e,
+  0x9c, 0x9b, 0x96, 0x88, 0x81, 0x82, 0x93, 0xee, 0xeb, 0xea, 0xe8, 0xa0, 0x11, 0x07, 0x05, 0x05, 0x08, 0x04, 0x04, 0x06, 0x06, 0x52, 0xed, 0xed, 0xec, 0xec, 0xbb, 0x87, 0x86, 0x86, 0x86, 0x79,
+  0xfb, 0xfa, 0xd4, 0xf5, 0xf1, 0xf1, 0xec, 0xd8, 0xeb, 0xf7, 0xf9, 0xfa, 0xc9, 0xe8, 0xe8, 0xe9, 0xe9, 0xd1, 0xf6, 0xf5, 0xf3, 0xe3, 0xd2, 0xed, 0xec, 0xea, 0xcf, 0x05, 0xf6, 0xf6, 0x83, 0xf9,
+  0xfa, 0xfa, 0xfa, 0xf9, 0xf7, 0x07, 0xf6, 0xf6, 0xb7, 0xf6, 0xf9, 0xf9, 0xe5, 0xd0, 0xe9, 0xed, 0xe9, 0xe6, 0xec, 0xee, 0xd4, 0xe9, 0xec, 0xec, 0xec, 0xe2, 0xdd, 0xef, 0xf5, 0xfd, 0xb3, 0x8c,
+  0x91, 0x92, 0x96, 0x98, 0x98, 0x9b, 0x9d, 0xbb, 0xf5, 0xf3, 0xf2, 0xef, 0xee, 0xcb, 0xe2, 0xe9, 0xd3, 0xee, 0x9a, 0x9e, 0x9f, 0x9e, 0xa0, 0xa0, 0x9f, 0xa1, 0x9f, 0x9e, 0x9c, 0x99, 0x8b, 0x7f,
+  0x80, 0x83, 0x84, 0xe5, 0xeb, 0xe8, 0xe7, 0xc3, 0x1d, 0x08, 0x06, 0x06, 0x04, 0x07, 0x05, 0x06, 0x09, 0x87, 0xee, 0xed, 0xec, 0xec, 0xa1, 0x86, 0x84, 0x85, 0x86, 0x98, 0xfc, 0xfb, 0xd1, 0xf3,
+  0xf1, 0xf1, 0xd8, 0xec, 0xf1, 0xfa, 0xfa, 0xfb, 0xe6, 0xdf, 0xe8, 0xe9, 0xe8, 0xc7, 0xf6, 0xf6, 0xf4, 0xe1, 0xd5, 0xed, 0xec, 0xea, 0xcf, 0x05, 0xf6, 0xf6, 0x83, 0xf9, 0xfa, 0xfa, 0xfa, 0xf8,
+  0xf7, 0x02, 0xf7, 0xf7, 0x03, 0xf6, 0xf6, 0xa9, 0xf6, 0xf7, 0xf8, 0xf9, 0xf6, 0xe5, 0xce, 0xd8, 0xf0, 0xef, 0xde, 0xe5, 0xec, 0xee, 0xce, 0xe7, 0xec, 0xeb, 0xec, 0xe9, 0xda, 0xf5, 0xf7, 0xfa,
+  0xca, 0x8c, 0x8e, 0x92, 0x94, 0x97, 0x99, 0x99, 0x9b, 0xaf, 0xf2, 0xf5, 0xf3, 0xf2, 0xef, 0xd9, 0xe7, 0xe6, 0xd1, 0xeb, 0xf5, 0x9a, 0x9d, 0x9d, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x9d, 0x9c,
+  0x90, 0x82, 0x80, 0x81, 0x83, 0x86, 0xcf, 0xeb, 0xe8, 0xe8, 0xe5, 0x28, 0x09, 0x04, 0x0a, 0x05, 0x08, 0x05, 0x05, 0x0a, 0xb9, 0xee, 0xed, 0xec, 0xe9, 0x8c, 0x02, 0x85, 0x85, 0x8f, 0x98, 0xfc,
+  0xff, 0xd2, 0xf1, 0xf1, 0xf1, 0xd9, 0xf1, 0xf5, 0xfc, 0xfd, 0xff, 0xf3, 0xdb, 0xe7, 0xe7, 0xe7, 0xc5, 0xf6, 0xf6, 0xf6, 0xe5, 0xd6, 0xed, 0xec, 0xeb, 0xcf, 0xf4, 0xf6, 0x04, 0xf6, 0xf6, 0x81,
+  0xf9, 0xfa, 0x04, 0xfa, 0xfa, 0x03, 0xf6, 0xf6, 0xb2, 0xf9, 0xf6, 0xf7, 0xeb, 0xd7, 0xd5, 0xf0, 0xee, 0xef, 0xdc, 0xe9, 0xea, 0xed, 0xd6, 0xe5, 0xec, 0xeb, 0xeb, 0xe9, 0xd5, 0xf7, 0xfb, 0xfe,
+  0xdf, 0x8a, 0x8f, 0x90, 0x91, 0x94, 0x98, 0x9b, 0x99, 0xa4, 0xeb, 0xf4, 0xf4, 0xf4, 0xf3, 0xd7, 0xea, 0xe9, 0xe3, 0xe1, 0xf8, 0xf5, 0x9b, 0x9a, 0x9b, 0x9d, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9b,
+  0x96, 0x86, 0x81, 0x82, 0x81, 0x84, 0x87, 0xb8, 0xea, 0xe8, 0xe7, 0xe9, 0x56, 0x10, 0x08, 0x07, 0x05, 0x07, 0x06, 0x06, 0x15, 0xdc, 0xed, 0xec, 0xec, 0xde, 0x84, 0x84, 0x85, 0x85, 0x85, 0x7d,
+  0xfc, 0xfd, 0xce, 0xf2, 0xf1, 0xf0, 0xe4, 0xdd, 0xf6, 0xfd, 0xff, 0xfe, 0xd2, 0x02, 0xe7, 0xe8, 0x86, 0xcb, 0xf6, 0xf6, 0xf5, 0xe2, 0xd8, 0xed, 0xec, 0xeb, 0xcf, 0xf4, 0xf6, 0x04, 0xf6, 0xf6,
+  0x8a, 0xe7, 0xe0, 0xe5, 0xec, 0xef, 0xf0, 0xf5, 0xf6, 0xf8, 0xee, 0xe4, 0xda, 0xcf, 0xd0, 0xd5, 0xde, 0xe8, 0xd6, 0xd5, 0xe1, 0x02, 0xee, 0xef, 0xb6, 0xdf, 0xe4, 0xf1, 0xf4, 0xd8, 0xe1, 0xed,
+  0xed, 0xec, 0xed, 0xda, 0xf5, 0xf7, 0xfb, 0xeb, 0x90, 0x8f, 0x90, 0x92, 0x94, 0x95, 0x98, 0x99, 0xa0, 0xe3, 0xf4, 0xf2, 0xf2, 0xf2, 0xd8, 0xed, 0xef, 0xe5, 0xe8, 0xf6, 0xf6, 0xf2, 0x9a, 0x99,
+  0x9a, 0x9b, 0x9f, 0x9e, 0x9f, 0x9c, 0x9b, 0x97, 0x86, 0x80, 0x82, 0x81, 0x82, 0x85, 0x86, 0xa3, 0xec, 0xe8, 0xe7, 0xe6, 0x81, 0x0e, 0x06, 0x05, 0x05, 0x04, 0x04, 0x05, 0x2b, 0xeb, 0xec, 0xec,
+  0xec, 0xcd, 0x85, 0x86, 0x85, 0x86, 0x86, 0x80, 0xec, 0xfc, 0xd3, 0xf0, 0xf0, 0xef, 0xee, 0xe2, 0xdc, 0xfc, 0xfb, 0xdd, 0xdd, 0xe9, 0xe9, 0xe9, 0xd1, 0xef, 0xf6, 0xf6, 0xf4, 0xe0, 0xd9, 0xed,
+  0xec, 0xeb, 0xd0, 0xf4, 0xf6, 0x04, 0xf6, 0xf6, 0xc1, 0xc1, 0xe8, 0xea, 0xe9, 0xeb, 0xee, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xef, 0xf1, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed,
+  0xef, 0xd5, 0xf2, 0xf8, 0xd9, 0xe7, 0xef, 0xef, 0xee, 0xed, 0xd4, 0xf4, 0xf7, 0xfb, 0xed, 0x92, 0x8f, 0x8f, 0x90, 0x93, 0x94, 0x97, 0x98, 0x9b, 0xd5, 0xf6, 0xf3, 0xf2, 0xf1, 0xdd, 0xe6, 0xf0,
+  0xeb, 0xc2, 0xf3, 0xf6, 0xf5, 0xf0, 0x98, 0x97, 0x9a, 0x9c, 0x9e, 0x9e, 0x9d, 0x99, 0x96, 0x88, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x85, 0x86, 0x91, 0xea, 0xe8, 0xe7, 0xe7, 0xa2, 0x0d, 0x05, 0x07,
+  0x05, 0x06, 0x03, 0x04, 0x5b, 0xec, 0xeb, 0xeb, 0xec, 0xb9, 0x85, 0x86, 0x85, 0x86, 0x86, 0x89, 0xbe, 0xfa, 0xf5, 0xd4, 0xf1, 0xf0, 0xf0, 0xf0, 0xe9, 0xcc, 0xd4, 0xe8, 0xeb, 0xea, 0xea, 0xe9,
+  0xc7, 0xf5, 0xf6, 0xf6, 0xf4, 0xe0, 0xd9, 0xed, 0xe9, 0xe9, 0xd0, 0x05, 0xf6, 0xf6, 0x89, 0xbb, 0xe9, 0xeb, 0xeb, 0xec, 0xef, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1,
+  0xee, 0x02, 0xee, 0xee, 0xb7, 0xef, 0xe5, 0xe6, 0xf7, 0xe1, 0xe3, 0xf1, 0xf1, 0xf0, 0xef, 0xf0, 0xe1, 0xe7, 0xfc, 0xf2, 0x9b, 0x96, 0x92, 0x93, 0x93, 0x95, 0x95, 0x98, 0x96, 0xc6, 0xf5, 0xf5,
+  0xf5, 0xf3, 0xe6, 0xdf, 0xef, 0xf1, 0x6d, 0xb6, 0xf4, 0xf5, 0xf4, 0xed, 0x95, 0x96, 0x99, 0x9a, 0x9c, 0x9b, 0x98, 0x96, 0x8a, 0x7f, 0x7f, 0x80, 0x81, 0x83, 0x85, 0x84, 0x86, 0x86, 0xe0, 0xe8,
+  0xe7, 0xe7, 0xbc, 0x10, 0x04, 0x08, 0x06, 0x04, 0x03, 0x03, 0x7f, 0xea, 0xeb, 0xeb, 0xeb, 0xa9, 0x84, 0x85, 0x86, 0x85, 0x87, 0x8a, 0x8f, 0xfb, 0xfb, 0xd1, 0xea, 0xef, 0xef, 0xf0, 0xed, 0xed,
+  0xed, 0xed, 0xec, 0xeb, 0xeb, 0xce, 0xe9, 0xf3, 0xf8, 0xf6, 0xf4, 0xdf, 0xd8, 0xec, 0xe9, 0xe9, 0xcf, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0x86, 0xf5, 0xf5, 0xbf, 0xe8, 0xea, 0xeb, 0xeb, 0xee, 0xef,
+  0xf1, 0xf2, 0xf1, 0x02, 0xf1, 0xf1, 0xbb, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xed, 0xed, 0xee, 0xdc, 0xcf, 0xf4, 0xf9, 0xd4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xe5, 0xe6, 0xb1, 0x9d, 0x98,
+  0x95, 0x95, 0x95, 0x97, 0x99, 0x97, 0xb8, 0xf4, 0xf4, 0xf3, 0xf4, 0xf0, 0xd8, 0xf0, 0xf5, 0x8c, 0x28, 0xaf, 0xf2, 0xf2, 0xf1, 0xea, 0x93, 0x95, 0x98, 0x9a, 0x99, 0x98, 0x96, 0x8d, 0x81, 0x7e,
+  0x80, 0x82, 0x82, 0x84, 0x85, 0x86, 0x87, 0x85, 0xcd, 0xeb, 0xe8, 0xe7, 0xd4, 0x1a, 0x04, 0x05, 0x05, 0x05, 0x03, 0x07, 0x9d, 0xec, 0xeb, 0xeb, 0xeb, 0x99, 0x85, 0x86, 0x88, 0x86, 0x86, 0x89,
+  0x85, 0xcb, 0xf9, 0xf3, 0xcc, 0xe8, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xef, 0xed, 0xeb, 0xce, 0xe6, 0xf8, 0xfa, 0xfe, 0xf5, 0xf0, 0xe2, 0xd7, 0xec, 0xe9, 0xe8, 0xce, 0xf4, 0xf6, 0x03, 0xf6, 0xf6,
+  0xc3, 0xf4, 0xf1, 0xbf, 0xe8, 0xea, 0xeb, 0xec, 0xed, 0xed, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xee, 0xee, 0xef, 0xec, 0xdb, 0xcb, 0xd2, 0xd5, 0xeb, 0xf6, 0xf8, 0xe3, 0xe3, 0xef, 0xf0,
+  0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf5, 0xf2, 0xc8, 0x9e, 0x99, 0x94, 0x97, 0x99, 0x99, 0x98, 0xab, 0xf0, 0xf4, 0xf3, 0xf1, 0xf4, 0xcf, 0xf1, 0xf3, 0xb2, 0x22, 0x25, 0xb0, 0xf2, 0xf1, 0xf0, 0xe9,
+  0x90, 0x94, 0x98, 0x98, 0x97, 0x96, 0x8f, 0x83, 0x7f, 0x80, 0x81, 0x82, 0x86, 0x85, 0x84, 0x86, 0x86, 0x85, 0xbb, 0xeb, 0xe8, 0xe8, 0xe8, 0x20, 0x03, 0x04, 0x06, 0x04, 0x04, 0x0b, 0xb6, 0xec,
+  0xec, 0xeb, 0xe9, 0x8e, 0x86, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8b, 0x8a, 0xe9, 0xf6, 0xf0, 0xd0, 0xd5, 0xf0, 0xf0, 0xed, 0xed, 0xf1, 0xd3, 0xd3, 0xe5, 0xf1, 0xf9, 0xfa, 0xfe, 0xf4, 0xef, 0xe5,
+  0xd4, 0xec, 0xe9, 0xe9, 0xd2, 0xf4, 0xf6, 0x03, 0xf6, 0xf6, 0xc3, 0xf4, 0xf1, 0xbc, 0xe8, 0xea, 0xeb, 0xeb, 0xa4, 0x7c, 0x69, 0x6c, 0x77, 0x8b, 0x99, 0xa4, 0xac, 0xb1, 0xb0, 0xa5, 0xa5, 0xaf,
+  0xc0, 0xc5, 0xd3, 0xe6, 0xf6, 0xf2, 0xcf, 0xef, 0xf0, 0xee, 0xe7, 0xd7, 0xf1, 0xf1, 0xf4, 0xf5, 0xf7, 0xf8, 0xd2, 0x9b, 0x98, 0x99, 0x9a, 0x9a, 0xa4, 0xec, 0xf5, 0xf3, 0xf0, 0xf0, 0xd2, 0xeb,
+  0xf3, 0xd7, 0x31, 0x22, 0x25, 0xb0, 0xf1, 0xf1, 0xf1, 0xea, 0x92, 0x94, 0x96, 0x97, 0x96, 0x90, 0x86, 0x80, 0x80, 0x7f, 0x82, 0x83, 0x85, 0x84, 0x86, 0x86, 0x86, 0x85, 0xb1, 0xec, 0xea, 0xea,
+  0xeb, 0x41, 0x02, 0x07, 0x07, 0x04, 0x05, 0x08, 0xca, 0xec, 0xec, 0xeb, 0xe2, 0x86, 0x85, 0x87, 0x88, 0x88, 0x87, 0x88, 0x8a, 0x8d, 0x92, 0xe7, 0xf1, 0xf0, 0xf3, 0xd2, 0xf0, 0xf0, 0xf0, 0xe9,
+  0xef, 0xeb, 0xec, 0xf2, 0xfa, 0xfa, 0xfc, 0xf0, 0xee, 0xe0, 0xd3, 0xec, 0xe9, 0xe8, 0xd3, 0xf2, 0xf6, 0x02, 0xf6, 0xf6, 0xbc, 0xf6, 0xf5, 0xf2, 0xf1, 0xbb, 0xe9, 0xe9, 0xe9, 0xea, 0x81, 0x1c,
+  0x04, 0x06, 0x14, 0x3a, 0x5b, 0x7a, 0x8f, 0x9d, 0xa7, 0xa7, 0xa5, 0x8d, 0x6c, 0x4a, 0x67, 0xe9, 0xf6, 0xe5, 0xde, 0xee, 0xf1, 0xf1, 0xc7, 0x72, 0xaa, 0xf0, 0xf2, 0xf5, 0xf6, 0xf7, 0xfa, 0xdb,
+  0x9c, 0x9a, 0x9b, 0x9f, 0xe1, 0xf6, 0xf4, 0xf2, 0xf1, 0xdb, 0xe2, 0xf2, 0xf0, 0x4a, 0x1f, 0x21, 0x26, 0xaf, 0xf0, 0xf0, 0xf0, 0xeb, 0x92, 0x92, 0x96, 0x95, 0x94, 0x8c, 0x81, 0x7f, 0x82, 0x81,
+  0x83, 0x83, 0x85, 0x85, 0x87, 0x85, 0x86, 0x86, 0xa7, 0xed, 0xeb, 0xea, 0xe9, 0x5e, 0x01, 0x05, 0x06, 0x03, 0x04, 0x12, 0xd7, 0xec, 0xec, 0xeb, 0xd9, 0x83, 0x84, 0x85, 0x85, 0x86, 0x85, 0x86,
+  0x88, 0x8d, 0x8f, 0x9c, 0xdd, 0xf6, 0xf8, 0xe7, 0xee, 0xf0, 0xf1, 0xdf, 0xf1, 0x03, 0xf1, 0xf1, 0x85, 0xec, 0xea, 0xdd, 0xd3, 0xe9, 0xe8, 0xe7, 0xd3, 0xf1, 0xf6, 0x02, 0xf6, 0xf6, 0xc4, 0xf6,
+  0xf5, 0xf1, 0xf1, 0xb4, 0xe7, 0xe8, 0xe8, 0xea, 0x74, 0x0d, 0x05, 0x07, 0x07, 0x09, 0x0e, 0x14, 0x1a, 0x1e, 0x1f, 0x1b, 0x18, 0x1a, 0x28, 0x3a, 0x7d, 0xf2, 0xf5, 0xd5, 0xed, 0xee, 0xee, 0xec,
+  0xcf, 0xf6, 0x94, 0x75, 0xe0, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xe1, 0x9b, 0x95, 0xd6, 0xf6, 0xf4, 0xf2, 0xf1, 0xe2, 0xeb, 0xf1, 0xf3, 0x71, 0x1c, 0x1f, 0x21, 0x24, 0xb3, 0xf0, 0xf0, 0xef, 0xec,
+  0x8f, 0x8e, 0x93, 0x92, 0x90, 0x87, 0x81, 0x7e, 0x80, 0x83, 0x83, 0x84, 0x84, 0x85, 0x86, 0x85, 0x85, 0x85, 0x9b, 0xee, 0xeb, 0xea, 0xe8, 0x6f, 0x02, 0x04, 0x09, 0x05, 0x04, 0x14, 0xe0, 0xec,
+  0xec, 0xeb, 0xce, 0x85, 0x85, 0x84, 0x85, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8e, 0x92, 0x96, 0xdc, 0xf9, 0xdd, 0xed, 0xf1, 0xf1, 0xd9, 0xf4, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf3, 0xf0, 0xed, 0xdc,
+  0xd2, 0xe9, 0xe8, 0xe6, 0xcf, 0xf2, 0xf6, 0x02, 0xf6, 0xf6, 0x94, 0xf6, 0xf5, 0xf1, 0xf1, 0xb7, 0xe6, 0xe8, 0xe8, 0xe8, 0x71, 0x08, 0x0c, 0x0e, 0x0f, 0x0f, 0x10, 0x14, 0x18, 0x1a, 0x1e, 0x1d,
+  0x20, 0x23, 0x3d, 0x8e, 0xef, 0xf1, 0xf1, 0xd6, 0xed, 0xee, 0xef, 0xd1, 0xf2, 0xfb, 0xff, 0xd9, 0x84, 0xd6, 0xf4, 0x02, 0xf6, 0xf5, 0xae, 0xd6, 0xc9, 0xf5, 0xf5, 0xf3, 0xf1, 0xe2, 0xde, 0xf5,
+  0xfa, 0x9f, 0x1c, 0x1c, 0x1c, 0x1d, 0x4f, 0xbd, 0xed, 0xee, 0xee, 0xec, 0x89, 0x89, 0x91, 0x92, 0x8c, 0x85, 0x83, 0x82, 0x80, 0x83, 0x83, 0x82, 0x83, 0x83, 0x84, 0x84, 0x85, 0x84, 0x93, 0xed,
+  0xeb, 0xea, 0xe9, 0x88, 0x03, 0x06, 0x0a, 0x04, 0x04, 0x1e, 0xe7, 0xec, 0xec, 0xeb, 0xc4, 0x84, 0x84, 0x85, 0x86, 0x85, 0x85, 0x87, 0x89, 0x8a, 0x8d, 0x91, 0x93, 0xcd, 0xfd, 0xc9, 0xef, 0xf0,
+  0xf0, 0xd8, 0xf4, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xfa, 0xf9, 0xf0, 0xd9, 0xd2, 0xe9, 0xe8, 0xe6, 0xcb, 0xf2, 0xf6, 0x02, 0xf6, 0xf6, 0xc4, 0xf6, 0xf5, 0xf3, 0xf0, 0xbc, 0xe5, 0xe8, 0xe8, 0xe6,
+  0xa0, 0x44, 0x25, 0x1e, 0x1b, 0x15, 0x14, 0x15, 0x18, 0x1c, 0x32, 0x5a, 0x86, 0xbe, 0xf2, 0xf4, 0xf1, 0xf2, 0xd3, 0xeb, 0xee, 0xef, 0xef, 0xcd, 0xf1, 0xf9, 0xfc, 0xfa, 0xf9, 0x7c, 0xd1, 0xf4,
+  0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf3, 0xf3, 0xee, 0xde, 0xf0, 0xf4, 0xcc, 0x22, 0x1a, 0x18, 0x17, 0x52, 0xe7, 0xbf, 0xec, 0xed, 0xee, 0xec, 0x7c, 0x7e, 0x90, 0x90, 0x8a, 0x85, 0x84, 0x84,
+  0x83, 0x85, 0x84, 0x83, 0x83, 0x82, 0x82, 0x83, 0x84, 0x84, 0x8f, 0xec, 0xec, 0xea, 0xea, 0x9f, 0x04, 0x05, 0x08, 0x03, 0x04, 0x2a, 0xea, 0xec, 0xec, 0xeb, 0xbb, 0x84, 0x85, 0x85, 0x86, 0x85,
+  0x84, 0x87, 0x89, 0x89, 0x8b, 0x8e, 0x93, 0xca, 0xff, 0xcc, 0xef, 0xf0, 0xf1, 0xd9, 0xf4, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf5, 0xf8, 0xef, 0xd7, 0xd1, 0xe9, 0xe8, 0xe7, 0xc8, 0xf2, 0xf6, 0x03,
+  0xf6, 0xf6, 0xa5, 0xf6, 0xf2, 0xbc, 0xe6, 0xe7, 0xe7, 0xe6, 0xda, 0xf7, 0xf7, 0xf2, 0xec, 0xed, 0xea, 0xe3, 0xe5, 0xeb, 0xf4, 0xf4, 0xf6, 0xf6, 0xf5, 0xf3, 0xf1, 0xf1, 0xcf, 0xf0, 0xf0, 0xf0,
+  0xe3, 0xe2, 0xf3, 0xfa, 0xfc, 0xfb, 0xce, 0x69, 0x65, 0xc8, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf0, 0xf0, 0xd7, 0xef, 0xf5, 0xdc, 0x38, 0x1c, 0x1a, 0x17, 0x47, 0xeb, 0xf1, 0xbf, 0xeb, 0xec,
+  0xed, 0xec, 0x6d, 0x6b, 0x8c, 0x8b, 0x88, 0x86, 0x85, 0x84, 0x85, 0x85, 0x84, 0x02, 0x83, 0x82, 0x9c, 0x82, 0x84, 0x82, 0x8b, 0xeb, 0xeb, 0xea, 0xe9, 0x9a, 0x05, 0x02, 0x06, 0x05, 0x03, 0x32,
+  0xea, 0xec, 0xec, 0xeb, 0xb6, 0x83, 0x83, 0x85, 0x85, 0x85, 0x86, 0x88, 0x87, 0x8a, 0x8c, 0x8e, 0x93, 0xcd, 0xfd, 0xce, 0xf1, 0xf0, 0xf1, 0xdd, 0xf5, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf8,
+  0xef, 0xd6, 0xd1, 0xe9, 0xe9, 0xe8, 0xc8, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0x87, 0xf4, 0xf1, 0xba, 0xe7, 0xe6, 0xe6, 0xe6, 0xd6, 0xf6, 0xf9, 0xf8, 0xf5, 0xfc, 0xfd, 0x05, 0xf5, 0xf5, 0x97, 0xe6,
+  0xd6, 0xf0, 0xf0, 0xf3, 0xd4, 0xeb, 0xf5, 0xfd, 0xfd, 0xd5, 0x77, 0x6e, 0x67, 0x5e, 0xae, 0xf7, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xd6, 0xea, 0xf3, 0xee, 0x44, 0x19, 0x17, 0x18, 0x37, 0xdf, 0xf8,
+  0xf5, 0xbc, 0xec, 0xec, 0xec, 0xec, 0x60, 0x54, 0x84, 0x86, 0x88, 0x85, 0x84, 0x02, 0x85, 0x85, 0x8d, 0x84, 0x83, 0x82, 0x82, 0x84, 0x82, 0x82, 0x89, 0xea, 0xec, 0xea, 0xe9, 0x9e, 0x05, 0x03,
+  0x04, 0x04, 0x01, 0x37, 0xeb, 0xec, 0xec, 0xeb, 0xb7, 0x84, 0x85, 0x02, 0x85, 0x85, 0x8f, 0x87, 0x87, 0x87, 0x8a, 0x8d, 0x8f, 0xd1, 0xff, 0xce, 0xf1, 0xf1, 0xf0, 0xe3, 0xf2, 0xfa, 0xf9, 0xf4,
+  0xf1, 0xf1, 0xf2, 0xf8, 0xef, 0xdd, 0xd2, 0xe9, 0xe9, 0xe8, 0xc8, 0xf4, 0xf6, 0x03, 0xf6, 0xf6, 0x86, 0xf4, 0xf1, 0xbd, 0xe7, 0xe6, 0xe7, 0xe9, 0xd9, 0xf9, 0xff, 0xfb, 0xf6, 0x05, 0xf6, 0xf6,
+  0x9b, 0xf6, 0xf4, 0xcc, 0xf2, 0xf1, 0xf1, 0xf1, 0xd9, 0xf9, 0xfe, 0xff, 0xcf, 0x76, 0x77, 0x72, 0x66, 0x62, 0x7d, 0xeb, 0xf7, 0xf7, 0xf5, 0xf4, 0xd9, 0xe9, 0xed, 0xf7, 0x56, 0x1d, 0x17, 0x14,
+  0x30, 0xd6, 0xf1, 0xf8, 0xf1, 0xbd, 0xec, 0xec, 0xec, 0xee, 0x45, 0x2f, 0x77, 0x85, 0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x02, 0x84, 0x83, 0x9b, 0x82, 0x86, 0xeb, 0xeb, 0xea,
+  0xe9, 0xa0, 0x07, 0x06, 0x06, 0x02, 0x02, 0x37, 0xeb, 0xec, 0xec, 0xec, 0xb8, 0x82, 0x82, 0x83, 0x82, 0x84, 0x83, 0x86, 0x87, 0x87, 0x88, 0x86, 0xc3, 0xfb, 0xff, 0xd5, 0xf2, 0xf2, 0xf2, 0xe7,
+  0xf0, 0xfa, 0xfa, 0xf7, 0xf3, 0xf1, 0xf2, 0xf5, 0xf0, 0xda, 0xd3, 0xea, 0xe9, 0xe9, 0xc6, 0xf4, 0xf6, 0x03, 0xf6, 0xf6, 0x86, 0xf4, 0xee, 0xbe, 0xe7, 0xe6, 0xe7, 0xe9, 0xd8, 0xfd, 0xfc, 0xf9,
+  0xf6, 0x05, 0xf6, 0xf6, 0x98, 0xf6, 0xf3, 0xd2, 0xf4, 0xf2, 0xf2, 0xe1, 0xf2, 0xfd, 0xf9, 0xb0, 0x72, 0x76, 0x79, 0x71, 0x8e, 0xd5, 0xfb, 0xfb, 0xf9, 0xf6, 0xf6, 0xec, 0xdc, 0xf0, 0xf5, 0x9e,
+  0x1b, 0x1a, 0x16, 0x21, 0xc6, 0xf3, 0xf1, 0xf6, 0xf0, 0xc1, 0xec, 0xec, 0xeb, 0xef, 0x3f, 0x1f, 0x67, 0x85, 0x88, 0x86, 0x84, 0x02, 0x84, 0x84, 0x87, 0x84, 0x83, 0x83, 0x83, 0x84, 0x84, 0x83,
+  0x8a, 0xeb, 0xec, 0xea, 0xe9, 0x9e, 0x07, 0x02, 0x04, 0x04, 0x95, 0x35, 0xeb, 0xec, 0xec, 0xec, 0xbe, 0x82, 0x81, 0x81, 0x83, 0x81, 0x82, 0x85, 0x86, 0x85, 0x8a, 0xdd, 0xf7, 0xfc, 0xfd, 0xe4,
+  0xf2, 0xf4, 0xf4, 0xe6, 0xf0, 0xf8, 0xfa, 0xf8, 0xf6, 0xf2, 0xf1, 0xf0, 0xee, 0xd7, 0xd3, 0xec, 0xe9, 0xe9, 0xc3, 0xf0, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf4, 0xee, 0xbb, 0xe7, 0xe6, 0xe7, 0xe9,
+  0xd6, 0xfa, 0xf6, 0x06, 0xf6, 0xf6, 0x98, 0xf6, 0xd8, 0xe8, 0xf3, 0xf4, 0xf1, 0xf5, 0xd0, 0xdc, 0x85, 0x72, 0x72, 0x72, 0x93, 0xd4, 0xfb, 0xfb, 0xfa, 0xf9, 0xf9, 0xf5, 0xe9, 0xd8, 0xf3, 0xf5,
+  0xd6, 0x23, 0x19, 0x1a, 0x19, 0xa9, 0xf5, 0xf3, 0xf2, 0xf1, 0xed, 0xc4, 0xec, 0xec, 0xec, 0xee, 0x60, 0x5a, 0x62, 0x8a, 0x88, 0x88, 0x85, 0x02, 0x85, 0x85, 0x02, 0x84, 0x84, 0x9c, 0x84, 0x83,
+  0x83, 0x8b, 0xeb, 0xec, 0xea, 0xea, 0x95, 0x07, 0x05, 0x05, 0x07, 0x05, 0x2e, 0xeb, 0xec, 0xec, 0xec, 0xc6, 0x80, 0x80, 0x81, 0x83, 0x82, 0x82, 0x82, 0x85, 0x83, 0xd4, 0xf7, 0xf7, 0xef, 0xdb,
+  0xe8, 0xf1, 0xf3, 0xf4, 0xf2, 0xdc, 0xe2, 0xf9, 0xf8, 0xf6, 0xf2, 0xf1, 0xf0, 0xee, 0xd7, 0xd3, 0xec, 0xe9, 0xe8, 0xc1, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf4, 0xee, 0xb9, 0xe7, 0xe7, 0xe8,
+  0xe9, 0xd3, 0xf8, 0xf6, 0x06, 0xf6, 0xf6, 0xb8, 0xf7, 0xca, 0xf4, 0xf4, 0xf4, 0xf3, 0xf8, 0xfa, 0xb8, 0x6b, 0x7d, 0xab, 0xdf, 0xfb, 0xfb, 0xfa, 0xf9, 0xf9, 0xfb, 0xef, 0xd5, 0xea, 0xfa, 0xf7,
+  0xec, 0x3d, 0x19, 0x19, 0x1a, 0x7a, 0xf5, 0xfb, 0xf6, 0xf5, 0xf4, 0xf2, 0xc3, 0xec, 0xec, 0xec, 0xed, 0x81, 0x93, 0x6f, 0x8b, 0x8c, 0x88, 0x86, 0x86, 0x87, 0x86, 0x86, 0x84, 0x85, 0x84, 0x82,
+  0x82, 0x83, 0x82, 0x8e, 0xec, 0xeb, 0xea, 0xe9, 0x88, 0x07, 0x05, 0x06, 0x05, 0x04, 0x26, 0xe8, 0xec, 0xec, 0xec, 0xce, 0x81, 0x81, 0x82, 0x83, 0x82, 0x82, 0x81, 0x82, 0xa6, 0xf5, 0xf7, 0xe3,
+  0xda, 0xf6, 0xf3, 0xf1, 0xf4, 0xf3, 0xf4, 0xf6, 0xf5, 0xe1, 0xec, 0xf5, 0xf2, 0xf1, 0xf0, 0xee, 0xd7, 0xd3, 0xeb, 0xe9, 0xe8, 0xbf, 0xf5, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf4, 0xee, 0xb8, 0xe7,
+  0xe8, 0xe8, 0xe8, 0xd0, 0xf2, 0xf6, 0x06, 0xf6, 0xf6, 0x81, 0xf9, 0xc9, 0x02, 0xf5, 0xf5, 0x8c, 0xfb, 0xfc, 0xfb, 0xdf, 0xf9, 0xfa, 0xfb, 0xfa, 0xf9, 0xf9, 0xf9, 0xeb, 0xd5, 0xe5, 0xfe, 0xfa,
+  0xfa, 0xf2, 0x55, 0x1a, 0x18, 0x19, 0x5d, 0xf0, 0x02, 0xf6, 0xf6, 0xa7, 0xf6, 0xf4, 0xc3, 0xec, 0xec, 0xec, 0xeb, 0xb8, 0xc6, 0x7c, 0x8b, 0x8b, 0x88, 0x88, 0x87, 0x88, 0x86, 0x85, 0x85, 0x84,
+  0x85, 0x82, 0x81, 0x84, 0x82, 0x93, 0xee, 0xec, 0xea, 0xe8, 0x77, 0x06, 0x06, 0x04, 0x04, 0x05, 0x1e, 0xdf, 0xed, 0xec, 0xec, 0xda, 0x80, 0x7f, 0x83, 0x83, 0x82, 0x82, 0x84, 0x84, 0xf0, 0xf8,
+  0xee, 0xd9, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xe1, 0xf2, 0xf5, 0xf5, 0xf0, 0xef, 0xdb, 0xd3, 0xe9, 0xe9, 0xe8, 0xc0, 0xf7, 0xf9, 0x03, 0xf6, 0xf6, 0x84, 0xf4, 0xee,
+  0xba, 0xe7, 0xe8, 0xe8, 0xe8, 0xcf, 0x07, 0xf6, 0xf6, 0x85, 0xf8, 0xd3, 0xf5, 0xf6, 0xf2, 0xc3, 0xf8, 0xfc, 0xfc, 0xfb, 0x02, 0xf9, 0xf8, 0x88, 0xf8, 0xf1, 0xdb, 0xe2, 0xf9, 0xfd, 0xfe, 0xfe,
+  0xd6, 0x51, 0x1f, 0x1c, 0x18, 0x4f, 0xee, 0xf6, 0x02, 0xf6, 0xf6, 0x88, 0xf2, 0xef, 0xc1, 0xeb, 0xec, 0xec, 0xea, 0xd8, 0xe3, 0x99, 0x8f, 0x8b, 0x8a, 0x89, 0x88, 0x88, 0x02, 0x86, 0x85, 0x9d,
+  0x85, 0x84, 0x84, 0x83, 0x84, 0x9e, 0xed, 0xec, 0xea, 0xe7, 0x69, 0x05, 0x04, 0x06, 0x06, 0x04, 0x11, 0xd1, 0xec, 0xec, 0xec, 0xe4, 0x80, 0x81, 0x83, 0x82, 0x81, 0x82, 0x83, 0xbb, 0xf1, 0xf7,
+  0xd3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf0, 0xe1, 0xe4, 0xf0, 0xf3, 0xf3, 0xf1, 0xf1, 0xd8, 0xf1, 0xf5, 0xf3, 0xf1, 0xe3, 0xd1, 0xe9, 0xe9, 0xe8, 0xc2, 0xf1, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf4, 0xee,
+  0xba, 0xe7, 0xe8, 0xe8, 0xe8, 0xce, 0xfa, 0xf6, 0x06, 0xf6, 0xf6, 0x8f, 0xf5, 0xdc, 0xf6, 0xf5, 0xd7, 0xd3, 0xe7, 0xfa, 0xfd, 0xfd, 0xfa, 0xf8, 0xf8, 0xed, 0xda, 0xe0, 0xfc, 0xfc, 0xfb, 0xfc,
+  0xea, 0x86, 0x30, 0x27, 0x22, 0x1c, 0x47, 0xea, 0xf7, 0xf6, 0x02, 0xf6, 0xf6, 0xa7, 0xf2, 0xf0, 0xbd, 0xeb, 0xeb, 0xec, 0xe9, 0xdd, 0xee, 0xa2, 0x8d, 0x8d, 0x8b, 0x8a, 0x89, 0x88, 0x86, 0x86,
+  0x84, 0x85, 0x84, 0x84, 0x84, 0x83, 0x83, 0xa4, 0xec, 0xeb, 0xea, 0xe7, 0x55, 0x05, 0x04, 0x05, 0x08, 0x07, 0x08, 0xbf, 0xed, 0xed, 0xec, 0xed, 0x87, 0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0xe3,
+  0xfc, 0xe7, 0xdb, 0xf2, 0xf1, 0xf2, 0xdd, 0xe1, 0xf7, 0xf7, 0xde, 0xde, 0xf0, 0xee, 0xee, 0xdf, 0xed, 0xf8, 0xf7, 0xf5, 0xe3, 0xd0, 0xe8, 0xea, 0xe8, 0xc4, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0x85,
+  0xf4, 0xee, 0xb7, 0xe7, 0xe8, 0xe7, 0xe5, 0xcc, 0xfd, 0xf6, 0x06, 0xf6, 0xf6, 0x8e, 0xd9, 0xf7, 0xf6, 0xf4, 0xf3, 0xf4, 0xf7, 0xf8, 0xf9, 0xfb, 0xfa, 0xeb, 0xd4, 0xe5, 0xfa, 0xf8, 0xfb, 0xfd,
+  0xe3, 0x88, 0x3a, 0x29, 0x27, 0x26, 0x28, 0x65, 0xea, 0xf6, 0x03, 0xf6, 0xf6, 0xa7, 0xf2, 0xf1, 0xbf, 0xea, 0xec, 0xed, 0xe8, 0xdc, 0xed, 0xae, 0x8f, 0x8e, 0x8b, 0x8b, 0x88, 0x85, 0x85, 0x85,
+  0x84, 0x84, 0x85, 0x83, 0x84, 0x83, 0x81, 0xad, 0xec, 0xea, 0xea, 0xea, 0x33, 0x05, 0x05, 0x06, 0x09, 0x06, 0x08, 0xa6, 0xed, 0xed, 0xec, 0xee, 0x93, 0x82, 0x82, 0x83, 0x86, 0x85, 0x7e, 0xfb,
+  0xf9, 0xd0, 0xf2, 0xf2, 0xf2, 0xe9, 0xe8, 0xf6, 0xf7, 0xfb, 0xfe, 0xd2, 0xea, 0xec, 0xec, 0xee, 0xd6, 0xfa, 0xf9, 0xf6, 0xe6, 0xd2, 0xe9, 0xe9, 0xe8, 0xc6, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0x85,
+  0xf4, 0xee, 0xb8, 0xe8, 0xe8, 0xe8, 0xe6, 0xcc, 0xfb, 0xf4, 0x06, 0xf6, 0xf6, 0x81, 0xd7, 0xf8, 0x02, 0xf6, 0xf6, 0x8b, 0xf9, 0xf9, 0xf8, 0xea, 0xd3, 0xe3, 0xf8, 0xf9, 0xfa, 0xfa, 0xe1, 0x84,
+  0x38, 0x2d, 0x2a, 0x27, 0x24, 0x3d, 0xad, 0xf7, 0xf5, 0xf6, 0x03, 0xf6, 0xf6, 0xa7, 0xf2, 0xee, 0xbc, 0xea, 0xec, 0xed, 0xe9, 0xe0, 0xee, 0xb1, 0x92, 0x90, 0x8d, 0x88, 0x88, 0x87, 0x85, 0x84,
+  0x82, 0x84, 0x84, 0x84, 0x83, 0x83, 0x81, 0xc2, 0xec, 0xea, 0xea, 0xe5, 0x1d, 0x05, 0x05, 0x06, 0x07, 0x06, 0x08, 0x8c, 0xed, 0xed, 0xec, 0xee, 0xa9, 0x84, 0x83, 0x84, 0x86, 0x86, 0x9a, 0xfa,
+  0xf6, 0xcb, 0xef, 0xf1, 0xf3, 0xd2, 0xf1, 0xf6, 0xf6, 0xfa, 0xff, 0xe3, 0xdb, 0xec, 0xeb, 0xeb, 0xc8, 0xfa, 0xfa, 0xf7, 0xe2, 0xd4, 0xe9, 0xe9, 0xe7, 0xc7, 0xf3, 0xf6, 0x02, 0xf6, 0xf6, 0x86,
+  0xf2, 0xf6, 0xf4, 0xee, 0xb6, 0xe8, 0xe9, 0xe8, 0xe7, 0xcc, 0xf7, 0xf3, 0x06, 0xf6, 0xf6, 0x8d, 0xd5, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf3, 0xd0, 0xd3, 0xe1, 0xf6, 0xf3, 0xf6, 0xf8, 0xe1, 0x7f,
+  0x3b, 0x32, 0x2b, 0x29, 0x24, 0x27, 0x7c, 0xeb, 0xf7, 0xf6, 0x04, 0xf6, 0xf6, 0x93, 0xf2, 0xee, 0xbf, 0xeb, 0xeb, 0xeb, 0xeb, 0xe7, 0xf5, 0xb1, 0x92, 0x90, 0x8d, 0x8a, 0x88, 0x86, 0x85, 0x84,
+  0x81, 0x83, 0x83, 0x84, 0x83, 0x83, 0x80, 0xd4, 0xec, 0xeb, 0xea, 0xd2, 0x1d, 0x05, 0x04, 0x07, 0x07, 0x08, 0x06, 0x67, 0x02, 0xec, 0xec, 0x92, 0xbc, 0x83, 0x84, 0x84, 0x87, 0x88, 0x94, 0xfb,
+  0xf8, 0xcc, 0xf0, 0xf0, 0xf1, 0xd2, 0xf2, 0xf7, 0xff, 0xff, 0xff, 0xe1, 0xdd, 0xe9, 0xe8, 0xea, 0xd4, 0xfa, 0xfa, 0xf8, 0xe3, 0xd8, 0xe9, 0xe8, 0xe7, 0xc3, 0xf4, 0xf6, 0x02, 0xf6, 0xf6, 0x86,
+  0xf3, 0xf6, 0xf4, 0xee, 0xb3, 0xe8, 0xe9, 0xe8, 0xe6, 0xcd, 0xf5, 0xf3, 0x06, 0xf6, 0xf6, 0x8d, 0xd3, 0xf3, 0xf3, 0xf6, 0xd8, 0xd8, 0xd6, 0xf3, 0xf9, 0xf9, 0xf3, 0xfa, 0xf0, 0x8e, 0x3b, 0x36,
+  0x34, 0x2f, 0x26, 0x41, 0x87, 0xde, 0xf7, 0xf7, 0xf7, 0xf6, 0x04, 0xf6, 0xf6, 0x82, 0xf2, 0xef, 0xc3, 0xeb, 0x02, 0xeb, 0xea, 0x8f, 0xf7, 0xaf, 0x93, 0x91, 0x8d, 0x8a, 0x88, 0x87, 0x86, 0x84,
+  0x84, 0x84, 0x83, 0x84, 0x83, 0x82, 0x84, 0xe5, 0xec, 0xeb, 0xe9, 0xb3, 0x0a, 0x06, 0x04, 0x04, 0x07, 0x07, 0x05, 0x3e, 0x02, 0xec, 0xec, 0x92, 0xd1, 0x83, 0x84, 0x86, 0x87, 0x88, 0x78, 0xfb,
+  0xf9, 0xcb, 0xef, 0xf0, 0xf1, 0xe3, 0xe1, 0xfa, 0xff, 0xff, 0xfe, 0xd3, 0xea, 0xeb, 0xe9, 0xdf, 0xd4, 0xfa, 0xfa, 0xf8, 0xdf, 0xda, 0xe9, 0xe8, 0xe7, 0xc3, 0xf4, 0xf6, 0x03, 0xf6, 0xf6, 0x85,
+  0xf4, 0xee, 0xb6, 0xe8, 0xe9, 0xe8, 0xe7, 0xca, 0xf5, 0xf3, 0x04, 0xf6, 0xf6, 0x8d, 0xf6, 0xf8, 0xf7, 0xf8, 0xec, 0xe1, 0xdd, 0xd8, 0xf7, 0xf4, 0xf5, 0xf6, 0xf9, 0xfa, 0xf6, 0xf0, 0x54, 0x3e,
+  0x35, 0x3f, 0x5a, 0x90, 0xd5, 0xfa, 0xfc, 0xf8, 0x06, 0xf6, 0xf6, 0xa7, 0xf2, 0xef, 0xc3, 0xeb, 0xea, 0xe9, 0xec, 0xeb, 0xf5, 0xac, 0x95, 0x92, 0x8e, 0x8a, 0x88, 0x87, 0x85, 0x85, 0x82, 0x83,
+  0x83, 0x85, 0x84, 0x82, 0x92, 0xec, 0xec, 0xea, 0xe8, 0x90, 0x04, 0x05, 0x04, 0x06, 0x06, 0x06, 0x05, 0x1c, 0xe0, 0xea, 0xeb, 0xec, 0xe5, 0x83, 0x84, 0x85, 0x86, 0x87, 0x80, 0xe4, 0xfd, 0xd6,
+  0xec, 0xf0, 0xef, 0xf1, 0xd9, 0xe4, 0xfe, 0xfd, 0xe0, 0xde, 0xec, 0xeb, 0xe8, 0xc8, 0xf2, 0xf8, 0xfa, 0xf7, 0xdd, 0xdc, 0xe9, 0xe8, 0xe7, 0xc4, 0xf3, 0xf6, 0x03, 0xf6, 0xf6, 0x85, 0xf4, 0xee,
+  0xb8, 0xe9, 0xe9, 0xe8, 0xe7, 0xcc, 0xf5, 0xf4, 0x04, 0xf6, 0xf6, 0x81, 0xf7, 0xfa, 0x02, 0xfa, 0xfa, 0x82, 0xfa, 0xf9, 0xf8, 0xf6, 0x02, 0xf6, 0xf6, 0x85, 0xf5, 0xf1, 0xe0, 0xe3, 0xf0, 0xf3,
+  0xf6, 0xf6, 0xf7, 0xf6, 0x07, 0xf6, 0xf6, 0xa7, 0xf2, 0xf0, 0xc2, 0xeb, 0xec, 0xec, 0xe9, 0xe6, 0xf4, 0xa7, 0x94, 0x90, 0x8c, 0x8b, 0x89, 0x86, 0x86, 0x84, 0x82, 0x83, 0x82, 0x84, 0x85, 0x83,
+  0xaa, 0xed, 0xeb, 0xea, 0xe8, 0x65, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x12, 0xbd, 0xeb, 0xec, 0xec, 0xee, 0x91, 0x86, 0x87, 0x88, 0x87, 0x86, 0xbe, 0xff, 0xf0, 0xcc, 0xef, 0xee, 0xf1,
+  0xf1, 0xe9, 0xd4, 0xd0, 0xea, 0xec, 0xeb, 0xe9, 0xe8, 0xd4, 0xf1, 0xf6, 0xf9, 0xf6, 0xda, 0xde, 0xe9, 0xe8, 0xe7, 0xc6, 0xf0, 0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xf4, 0xee, 0xb8, 0xe8, 0xe8, 0xe8,
+  0xe8, 0xcc, 0x04, 0xf6, 0xf6, 0x82, 0xf6, 0xf8, 0xf9, 0xfa, 0x03, 0xfa, 0xfa, 0x82, 0xfa, 0xf9, 0xf8, 0xf6, 0x02, 0xf6, 0xf6, 0x83, 0xf6, 0xf9, 0xfb, 0xfc, 0xf5, 0xf6, 0x08, 0xf6, 0xf6, 0x89,
+  0xf2, 0xef, 0xc1, 0xeb, 0xec, 0xec, 0xe8, 0xe5, 0xf5, 0xa9, 0x95, 0x91, 0x8c, 0x8b, 0x88, 0x88, 0x86, 0x82, 0x02, 0x83, 0x83, 0x9c, 0x82, 0x84, 0xc2, 0xec, 0xeb, 0xeb, 0xeb, 0x3c, 0x04, 0x04,
+  0x05, 0x05, 0x0a, 0x08, 0x05, 0x05, 0x90, 0xed, 0xed, 0xec, 0xed, 0xa7, 0x87, 0x8a, 0x88, 0x87, 0x86, 0x8c, 0xfa, 0xfe, 0xd4, 0xe2, 0xed, 0xee, 0xf0, 0xf1, 0xf0, 0xf0, 0xef, 0xed, 0xea, 0xe8,
+  0xd0, 0xe9, 0xf0, 0xf6, 0xf9, 0xf6, 0xd7, 0xdd, 0xe9, 0xe8, 0xe7, 0xc6, 0xed, 0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xf4, 0xee, 0xb7, 0xe8, 0xe8, 0xe8, 0xe8, 0xcd, 0x04, 0xf6, 0xf6, 0x81, 0xf6, 0xfa,
+  0x06, 0xfa, 0xfa, 0x81, 0xf9, 0xf9, 0x02, 0xfa, 0xfa, 0x83, 0xfa, 0xfe, 0xfa, 0xfc, 0xfa, 0xf6, 0x02, 0xf6, 0xf6, 0x81, 0xf9, 0xfa, 0x02, 0xfa, 0xfa, 0x99, 0xf9, 0xf6, 0xf6, 0xf6, 0xf2, 0xef,
+  0xc1, 0xeb, 0xec, 0xec, 0xe6, 0xe1, 0xf5, 0xa8, 0x93, 0x92, 0x8e, 0x8b, 0x88, 0x89, 0x85, 0x85, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0xdb, 0xec, 0xeb, 0xe9, 0xdf, 0x1f, 0x05, 0x04, 0x06, 0x04,
+  0x09, 0x06, 0x08, 0x04, 0x51, 0xee, 0xee, 0xed, 0xed, 0xc1, 0x87, 0x87, 0x02, 0x89, 0x89, 0x8e, 0xbf, 0xf9, 0xf6, 0xca, 0xde, 0xec, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xec, 0xea, 0xd2, 0xea, 0xed,
+  0xf4, 0xf6, 0xf6, 0xf4, 0xd5, 0xdb, 0xe9, 0xe8, 0xe7, 0xc5, 0xf1, 0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xf4, 0xee, 0xb8, 0xe8, 0xe9, 0xe8, 0xe8, 0xcc, 0x03, 0xf6, 0xf6, 0x8d, 0xf7, 0xf5, 0xf4, 0xf7,
+  0xf6, 0xfc, 0xf2, 0xe9, 0xe5, 0xec, 0xf1, 0xf4, 0xf3, 0xf4, 0xfa, 0xfa, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xfa, 0x02, 0xf9, 0xf9, 0x02, 0xf7, 0xf7, 0x93, 0xf7, 0xf8, 0xf7,
+  0xfc, 0xfa, 0xf9, 0xf6, 0xf6, 0xf2, 0xef, 0xc1, 0xeb, 0xeb, 0xeb, 0xe2, 0xdc, 0xf5, 0xa9, 0x92, 0x91, 0x8e, 0x8a, 0x89, 0x86, 0x85, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x88, 0xec, 0xec, 0xe8,
+  0xe8, 0xaf, 0x0d, 0x02, 0x04, 0x04, 0x02, 0x06, 0x05, 0x94, 0x1d, 0xe7, 0xed, 0xed, 0xed, 0xdb, 0x86, 0x88, 0x87, 0x87, 0x89, 0x89, 0x88, 0xdc, 0xf9, 0xf5, 0xdd, 0xcd, 0xea, 0xee, 0xee, 0xf0,
+  0xef, 0xd8, 0xd8, 0xf0, 0xf0, 0xf1, 0xf5, 0xf6, 0xf4, 0xf2, 0xd9, 0xda, 0xe9, 0xe8, 0xe7, 0xc5, 0xf1, 0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xf4, 0xee, 0xb8, 0xe8, 0xe9, 0xe8, 0xe8, 0xd2, 0x03, 0xf6,
+  0xf6, 0xbc, 0xd6, 0xd8, 0xe4, 0xe8, 0xea, 0xea, 0xeb, 0xeb, 0xe8, 0xe5, 0xe4, 0xe4, 0xe4, 0xe2, 0xdf, 0xde, 0xde, 0xde, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xd7, 0xd4, 0xd1, 0xcd, 0xcd,
+  0xcd, 0xce, 0xd1, 0xd4, 0xd4, 0xd2, 0xda, 0xdf, 0xf8, 0xf9, 0xf6, 0xf6, 0xf2, 0xee, 0xbf, 0xe9, 0xeb, 0xeb, 0xe0, 0xd6, 0xf8, 0xab, 0x93, 0x91, 0x8c, 0x8a, 0x86, 0x87, 0x85, 0x84, 0x83, 0x83,
+  0x82, 0x81, 0x80, 0xa2, 0xed, 0xeb, 0xe9, 0xe7, 0x79, 0x08, 0x05, 0x06, 0x05, 0x05, 0x0b, 0x07, 0x06, 0x06, 0x09, 0xb7, 0xec, 0xed, 0xed, 0xed, 0x91, 0x87, 0x86, 0x86, 0x86, 0x89, 0x8b, 0x95,
+  0xec, 0xf9, 0xf9, 0xf8, 0xdb, 0xf3, 0xee, 0xef, 0xdc, 0xf5, 0xf0, 0xf1, 0xf2, 0xf4, 0xf6, 0xf5, 0xf1, 0xef, 0xd4, 0xdb, 0xe9, 0xe8, 0xe7, 0xc6, 0xf4, 0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xf4, 0xee,
+  0xb7, 0xe9, 0xe8, 0xe8, 0xe7, 0xd2, 0x02, 0xf6, 0xf6, 0xbd, 0xf6, 0xf5, 0xd5, 0xee, 0xee, 0xee, 0xec, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xea, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xea, 0xea, 0xe8,
+  0xe9, 0xea, 0xeb, 0xe9, 0xe7, 0xe8, 0xe8, 0xe7, 0xe8, 0xea, 0xea, 0xe8, 0xea, 0xed, 0xed, 0xee, 0xee, 0xde, 0xed, 0xf9, 0xf6, 0xf6, 0xf2, 0xf0, 0xc1, 0xe9, 0xe9, 0xea, 0xdf, 0xd6, 0xfb, 0xbd,
+  0x92, 0x8f, 0x8d, 0x89, 0x88, 0x85, 0x86, 0x84, 0x83, 0x84, 0x83, 0x82, 0x80, 0xc3, 0xec, 0xeb, 0xea, 0xe7, 0x34, 0x05, 0x06, 0x04, 0x05, 0x05, 0x0a, 0x07, 0x07, 0x04, 0x05, 0x68, 0xed, 0xed,
+  0xed, 0xec, 0xb0, 0x86, 0x85, 0x85, 0x86, 0x88, 0x8c, 0x91, 0x92, 0xce, 0xf9, 0xfa, 0xd7, 0xee, 0xef, 0xf0, 0xdc, 0xf4, 0xf4, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf1, 0xef, 0xd1, 0xde, 0xe8, 0xe7,
+  0xe5, 0xc7, 0xf9, 0xf9, 0x03, 0xf6, 0xf6, 0x84, 0xf4, 0xee, 0xb8, 0xea, 0xe9, 0xe8, 0xe8, 0xd1, 0x02, 0xf6, 0xf6, 0x83, 0xf6, 0xf3, 0xc9, 0xed, 0xec, 0xed, 0x02, 0xec, 0xeb, 0x81, 0xeb, 0xeb,
+  0x02, 0xea, 0xea, 0x02, 0xeb, 0xea, 0x85, 0xea, 0xe8, 0xe8, 0xe9, 0xe9, 0xe8, 0xe7, 0xe8, 0xe8, 0xe9, 0x02, 0xe8, 0xe8, 0xa5, 0xe9, 0xeb, 0xed, 0xed, 0xec, 0xdf, 0xf6, 0xfc, 0xf6, 0xf6, 0xf2,
+  0xf2, 0xc2, 0xe9, 0xe9, 0xe9, 0xde, 0xd9, 0xfd, 0xcf, 0x93, 0x8e, 0x8c, 0x8a, 0x88, 0x88, 0x86, 0x84, 0x85, 0x84, 0x83, 0x83, 0x83, 0xe5, 0xed, 0xec, 0xe9, 0xcb, 0x14, 0x04, 0x07, 0x04, 0x04,
+  0x05, 0x07, 0x08, 0x08, 0x06, 0x02, 0x2b, 0xe9, 0xed, 0xed, 0xec, 0xd5, 0x88, 0x85, 0x84, 0x86, 0x87, 0x88, 0x8c, 0x93, 0x92, 0xbe, 0xfb, 0xc5, 0xed, 0xf0, 0xf0, 0xd6, 0xf4, 0xf5, 0xf6, 0x02,
+  0xf6, 0xf6, 0x85, 0xf4, 0xef, 0xce, 0xdf, 0xe8, 0xe6, 0xe5, 0xc8, 0xf8, 0xfa, 0x03, 0xf6, 0xf6, 0x84, 0xf3, 0xee, 0xb7, 0xe9, 0xe9, 0xe8, 0xe8, 0xd2, 0x02, 0xf6, 0xf6, 0xb6, 0xf6, 0xf7, 0xc8,
+  0xd7, 0xe7, 0xe7, 0xe5, 0xe4, 0xe4, 0xe5, 0xe3, 0xe1, 0xe0, 0xe0, 0xe1, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe3, 0xe0, 0xe1, 0xe2, 0xe2, 0xe2, 0xe0, 0xdf, 0xdf, 0xde, 0xdb, 0xdb, 0xdc, 0xde, 0xe0,
+  0xe4, 0xe5, 0xe6, 0xde, 0xe0, 0xf9, 0xfd, 0xf6, 0xf6, 0xf2, 0xf2, 0xc2, 0xe9, 0xe9, 0xe9, 0xdf, 0xd9, 0xfa, 0xd4, 0x94, 0x8f, 0x8c, 0x8b, 0x88, 0x87, 0x86, 0x86, 0x84, 0x85, 0x84, 0x83, 0x9f,
+  0xef, 0xed, 0xec, 0xe9, 0x8f, 0x0a, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x05, 0x04, 0x03, 0x12, 0xb8, 0xec, 0xec, 0xec, 0xee, 0x96, 0x87, 0x86, 0x86, 0x86, 0x88, 0x8a, 0x8d, 0x91, 0xb1,
+  0xf9, 0xca, 0xee, 0xf0, 0xf0, 0xcf, 0xf3, 0xf5, 0xf6, 0x02, 0xf6, 0xf6, 0x85, 0xf5, 0xf0, 0xd6, 0xdf, 0xe8, 0xe6, 0xe4, 0xca, 0xf9, 0xfa, 0x02, 0xf6, 0xf6, 0x85, 0xf6, 0xf5, 0xf2, 0xef, 0xbe,
+  0xea, 0xea, 0xe9, 0xe9, 0xd3, 0x02, 0xf6, 0xf6, 0xb5, 0xf6, 0xf5, 0xf8, 0xeb, 0xe9, 0xef, 0xed, 0xea, 0xea, 0xe9, 0xea, 0xe5, 0xe7, 0xe8, 0xe8, 0xe6, 0xe4, 0xe7, 0xe8, 0xe7, 0xea, 0xec, 0xe8,
+  0xe8, 0xe9, 0xe9, 0xe6, 0xe7, 0xe5, 0xe0, 0xe0, 0xe0, 0xe1, 0xe3, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xed, 0xf3, 0xfd, 0xf6, 0xf6, 0xf2, 0xf2, 0xc2, 0xe9, 0xe9, 0xe9, 0xe0, 0xde, 0xfe, 0xce, 0x91,
+  0x8f, 0x8c, 0x8a, 0x88, 0x87, 0x86, 0x86, 0x84, 0x85, 0x85, 0x82, 0xc4, 0xee, 0xec, 0xe9, 0xe8, 0x43, 0x05, 0x05, 0x04, 0x06, 0x06, 0x07, 0x06, 0x05, 0x07, 0x05, 0x04, 0x06, 0x72, 0xec, 0xed,
+  0xec, 0xed, 0xbc, 0x85, 0x86, 0x85, 0x85, 0x85, 0x88, 0x88, 0x8a, 0xc8, 0xfa, 0xcc, 0xed, 0xf0, 0xf0, 0xcb, 0xf4, 0x03, 0xf6, 0xf6, 0x85, 0xf6, 0xf5, 0xe1, 0xd2, 0xe7, 0xe6, 0xe4, 0xd8, 0xed,
+  0xfa, 0x03, 0xf6, 0xf6, 0x84, 0xf6, 0xf4, 0xc5, 0xea, 0xe9, 0xe9, 0xea, 0xd1, 0x02, 0xf6, 0xf6, 0x8b, 0xf6, 0xf5, 0xf6, 0xf7, 0xf7, 0xf6, 0xf7, 0xf5, 0xf5, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1,
+  0xee, 0xef, 0xf1, 0xef, 0xed, 0xf1, 0xf1, 0x02, 0xf0, 0xf0, 0x82, 0xee, 0xee, 0xee, 0xef, 0x02, 0xf1, 0xf1, 0xa5, 0xf4, 0xf1, 0xf2, 0xf2, 0xf6, 0xf4, 0xf4, 0xfd, 0xf6, 0xf6, 0xf2, 0xf0, 0xc1,
+  0xe9, 0xe9, 0xe9, 0xe2, 0xde, 0xfc, 0xcc, 0x8f, 0x8e, 0x8b, 0x89, 0x87, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x88, 0xe9, 0xec, 0xeb, 0xe9, 0xc9, 0x14, 0x06, 0x06, 0x05, 0x05, 0x07, 0x08, 0x07,
+  0x05, 0x05, 0x06, 0x04, 0x04, 0x2a, 0xe8, 0xed, 0xec, 0xec, 0xe2, 0x86, 0x85, 0x85, 0x83, 0x85, 0x85, 0x84, 0x83, 0xc9, 0xfb, 0xd4, 0xee, 0xf0, 0xf0, 0xcc, 0xf7, 0xf7, 0xf6, 0x03, 0xf6, 0xf6,
+  0x84, 0xef, 0xc9, 0xe7, 0xe7, 0xe6, 0xe8, 0xd0, 0xf9, 0x04, 0xf6, 0xf6, 0x83, 0xcf, 0xe8, 0xe9, 0xe9, 0xea, 0xd2, 0x03, 0xf6, 0xf6, 0x87, 0xf7, 0xfa, 0xf7, 0xf9, 0xf9, 0xf6, 0xf6, 0xf4, 0xf4,
+  0xfb, 0xf4, 0xf4, 0xf4, 0xf1, 0x0a, 0xf1, 0xf1, 0xa3, 0xf1, 0xf4, 0xf9, 0xf9, 0xf9, 0xfd, 0xf6, 0xf6, 0xf2, 0xef, 0xbf, 0xe8, 0xe9, 0xe9, 0xe2, 0xdc, 0xff, 0xbe, 0x8d, 0x8e, 0x8c, 0x89, 0x87,
+  0x84, 0x83, 0x83, 0x85, 0x84, 0x86, 0xad, 0xf0, 0xec, 0xeb, 0xe9, 0x84, 0x0a, 0x04, 0x06, 0x08, 0x07, 0x06, 0x06, 0x06, 0x03, 0x03, 0x04, 0x03, 0x05, 0x0c, 0xad, 0xec, 0xec, 0xec, 0xed, 0xab,
+  0x85, 0x84, 0x85, 0x85, 0x83, 0x81, 0x81, 0xc2, 0xfd, 0xd9, 0xee, 0xf0, 0xf0, 0xcc, 0xf3, 0x04, 0xf6, 0xf6, 0x84, 0xf3, 0xc7, 0xe9, 0xe8, 0xe6, 0xe5, 0xd3, 0xfd, 0x03, 0xf9, 0xf9, 0x85, 0xfb,
+  0xee, 0xda, 0xec, 0xeb, 0xeb, 0xe5, 0xdb, 0xf5, 0xf6, 0x02, 0xf6, 0xf6, 0xaa, 0xee, 0xd8, 0xc5, 0xc9, 0xc6, 0xc6, 0xc6, 0xc3, 0xc0, 0xbe, 0xc5, 0xc9, 0xcd, 0xd1, 0xd4, 0xd8, 0xd7, 0xd8, 0xdc,
+  0xde, 0xdd, 0xdc, 0xda, 0xd8, 0xd9, 0xd9, 0xdb, 0xdb, 0xdb, 0xd9, 0xd9, 0xdb, 0xdd, 0xdf, 0xdc, 0xd7, 0xd5, 0xf1, 0xfa, 0xfb, 0xf8, 0xf6, 0xf5, 0xf2, 0xc0, 0xea, 0xea, 0xe9, 0xe2, 0xdc, 0xff,
+  0xab, 0x8c, 0x8e, 0x8a, 0x89, 0x86, 0x85, 0x85, 0x83, 0x81, 0x82, 0x84, 0xd8, 0xee, 0xec, 0xeb, 0xe5, 0x39, 0x07, 0x06, 0x09, 0x06, 0x08, 0x07, 0x03, 0x06, 0x06, 0x07, 0x06, 0x04, 0x06, 0x04,
+  0x57, 0x02, 0xec, 0xec, 0x81, 0xd8, 0x89, 0x02, 0x85, 0x85, 0x9b, 0x81, 0x80, 0xbe, 0xff, 0xdf, 0xed, 0xf0, 0xf0, 0xcc, 0xf2, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf3, 0xcf, 0xe6,
+  0xe7, 0xe7, 0xe8, 0xd8, 0xe4, 0xf9, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xd8, 0xf3, 0xee, 0xec, 0xee, 0xcd, 0xf4, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xcf, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xed,
+  0xed, 0x02, 0xeb, 0xea, 0x81, 0xe8, 0xe8, 0x03, 0xe9, 0xea, 0xb9, 0xea, 0xea, 0xe9, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xeb, 0xed, 0xee, 0xee, 0xee, 0xed, 0xeb, 0xd7, 0xfa, 0xfa, 0xf8,
+  0xf6, 0xf6, 0xf4, 0xc2, 0xea, 0xea, 0xe9, 0xe3, 0xe3, 0xfb, 0xa9, 0x8d, 0x8d, 0x8a, 0x86, 0x85, 0x83, 0x82, 0x82, 0x81, 0x82, 0x97, 0xec, 0xec, 0xea, 0xe9, 0xb6, 0x18, 0x09, 0x09, 0x09, 0x08,
+  0x06, 0x08, 0x05, 0x05, 0x05, 0x03, 0x07, 0x07, 0x06, 0x04, 0x12, 0xc2, 0xea, 0xea, 0xeb, 0xec, 0x9e, 0x86, 0x87, 0x87, 0x85, 0x83, 0x7d, 0xbf, 0xfd, 0xe1, 0xee, 0xf0, 0xef, 0xcf, 0xf7, 0xf7,
+  0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf6, 0xf6, 0xf3, 0xef, 0xc6, 0xe8, 0xe9, 0xe9, 0xea, 0xd4, 0xe2, 0xf9, 0xfb, 0xff, 0xfb, 0xf5, 0xdb, 0xed, 0xf0, 0xee, 0xeb, 0xe8, 0xd1, 0xf1, 0x03, 0xf6, 0xf6,
+  0x81, 0xd2, 0xef, 0x02, 0xee, 0xee, 0x82, 0xed, 0xeb, 0xeb, 0xe9, 0x05, 0xe9, 0xe9, 0x9e, 0xe9, 0xe8, 0xe7, 0xe8, 0xe8, 0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xea, 0xec, 0xed, 0xed, 0xed, 0xec,
+  0xe4, 0xeb, 0xfa, 0xf8, 0xf6, 0xf6, 0xf5, 0xc7, 0xea, 0xea, 0xe9, 0xe3, 0xe3, 0xfb, 0xae, 0x8d, 0x8a, 0x89, 0x86, 0x84, 0x84, 0x84, 0x81, 0x80, 0x81, 0xbf, 0xed, 0xeb, 0xea, 0xe9, 0x65, 0x0f,
+  0x07, 0x0b, 0x07, 0x07, 0x09, 0x08, 0x08, 0x05, 0x06, 0x05, 0x04, 0x02, 0x04, 0x05, 0x99, 0x69, 0xe9, 0xea, 0xeb, 0xec, 0xcd, 0x89, 0x89, 0x8a, 0x88, 0x86, 0x7b, 0xeb, 0xfd, 0xde, 0xed, 0xed,
+  0xed, 0xcd, 0xf5, 0xf6, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf6, 0xf6, 0xf3, 0xf5, 0xcf, 0xe5, 0xea, 0xeb, 0xec, 0xea, 0xe2, 0xcd, 0xde, 0xce, 0xdb, 0xdc, 0xef, 0xf0, 0xf0, 0xee, 0xec, 0xca, 0xe9,
+  0xf0, 0x02, 0xf6, 0xf6, 0x8e, 0xf6, 0xf7, 0xc5, 0xec, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xe9, 0xe8, 0xe8, 0xe6, 0xe8, 0xea, 0xea, 0xea, 0xec, 0xec, 0xeb, 0xea, 0xe9, 0xe8, 0xe7, 0xe6, 0xe7, 0xe7,
+  0xe7, 0x02, 0xe8, 0xe9, 0xae, 0xe9, 0xeb, 0xec, 0xed, 0xed, 0xec, 0xee, 0xd0, 0xfb, 0xfa, 0xf7, 0xf6, 0xf6, 0xf2, 0xcd, 0xea, 0xea, 0xe9, 0xe2, 0xe2, 0xf6, 0xaa, 0x8b, 0x8a, 0x88, 0x86, 0x84,
+  0x85, 0x85, 0x82, 0x7f, 0x8a, 0xeb, 0xec, 0xec, 0xeb, 0xcb, 0x28, 0x08, 0x09, 0x0a, 0x0b, 0x08, 0x06, 0x07, 0x09, 0x06, 0x09, 0x07, 0x05, 0x05, 0x07, 0x05, 0x05, 0x17, 0xd5, 0xe9, 0xea, 0xeb,
+  0xea, 0x9c, 0x8c, 0x8c, 0x8b, 0x7f, 0xd0, 0xfc, 0xff, 0xd7, 0xec, 0xec, 0xeb, 0xcc, 0xf3, 0xf5, 0xf6, 0xf4, 0xf1, 0xf1, 0xf2, 0xf6, 0xf6, 0xf3, 0xf1, 0xf1, 0xc7, 0xeb, 0xeb, 0xed, 0xed, 0xee,
+  0xee, 0x02, 0xee, 0xed, 0x84, 0xf0, 0xf0, 0xf0, 0xee, 0xde, 0xcb, 0xef, 0xf1, 0x02, 0xf6, 0xf6, 0x95, 0xf6, 0xf9, 0xef, 0xd4, 0xd8, 0xd8, 0xdb, 0xd8, 0xd5, 0xd4, 0xd7, 0xd5, 0xd3, 0xd2, 0xd3,
+  0xd1, 0xce, 0xce, 0xcb, 0xcc, 0xc9, 0xc9, 0xc7, 0xc8, 0xc3, 0xc6, 0xc7, 0xca, 0xca, 0xca, 0xc9, 0xcb, 0xce, 0xcf, 0xcb, 0xcb, 0xd2, 0xda, 0xcb, 0xec, 0xf7, 0xf9, 0x02, 0xf6, 0xf6, 0xa6, 0xd0,
+  0xeb, 0xea, 0xe9, 0xe2, 0xe0, 0xf5, 0x9d, 0x89, 0x8a, 0x89, 0x86, 0x84, 0x86, 0x85, 0x84, 0x81, 0xbf, 0xed, 0xec, 0xea, 0xe8, 0x7a, 0x0b, 0x04, 0x09, 0x07, 0x07, 0x07, 0x05, 0x09, 0x0a, 0x06,
+  0x05, 0x06, 0x04, 0x06, 0x06, 0x08, 0x05, 0x06, 0x7a, 0xe9, 0xeb, 0xeb, 0xeb, 0xcd, 0x8f, 0x8e, 0x8c, 0xa0, 0xf7, 0xfc, 0xfc, 0xce, 0xeb, 0xec, 0xeb, 0xd1, 0xf8, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5,
+  0xf5, 0xf6, 0xf6, 0xf3, 0xf1, 0xf1, 0xe9, 0xc2, 0xeb, 0xed, 0xee, 0x02, 0xef, 0xef, 0x86, 0xef, 0xed, 0xef, 0xf0, 0xef, 0xe5, 0x68, 0xc5, 0xf2, 0xfa, 0xfc, 0xf6, 0x02, 0xf6, 0xf6, 0x88, 0xf6,
+  0xf4, 0xee, 0xeb, 0xea, 0xeb, 0xeb, 0xec, 0xeb, 0xeb, 0xec, 0xeb, 0xed, 0xee, 0xeb, 0xec, 0x02, 0xec, 0xed, 0x8a, 0xf0, 0xef, 0xf0, 0xf0, 0xf1, 0xf5, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3,
+  0xf3, 0xf0, 0xf5, 0xf6, 0xf4, 0xf6, 0xf9, 0x02, 0xf6, 0xf6, 0x9e, 0xd3, 0xec, 0xea, 0xea, 0xe2, 0xe0, 0xf8, 0x91, 0x8c, 0x8a, 0x87, 0x86, 0x85, 0x86, 0x87, 0x87, 0x90, 0xea, 0xec, 0xec, 0xea,
+  0xdd, 0x27, 0x02, 0x03, 0x05, 0x0a, 0x07, 0x07, 0x09, 0x0a, 0x07, 0x05, 0x04, 0x05, 0x07, 0x07, 0x08, 0x08, 0x07, 0x04, 0x16, 0xd3, 0xea, 0xeb, 0xea, 0xe9, 0xa2, 0x8b, 0x7d, 0xdf, 0xf5, 0xf4,
+  0xbc, 0xdd, 0xee, 0xeb, 0xeb, 0xd6, 0xf8, 0x05, 0xf6, 0xf6, 0x8b, 0xf2, 0xf0, 0xc8, 0xa5, 0xea, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xec, 0xee, 0xef, 0xd6, 0x48, 0x18, 0xde, 0xf7, 0xfc, 0xfc,
+  0xf6, 0x03, 0xf6, 0xf6, 0x84, 0xf3, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0x03, 0xec, 0xec, 0x81, 0xef, 0xf1, 0x08, 0xf1, 0xf1, 0x83, 0xf4, 0xf9, 0xfb, 0xfb, 0xfa, 0xf9, 0x02, 0xf6, 0xf6,
+  0x9f, 0xd9, 0xec, 0xeb, 0xeb, 0xe0, 0xe4, 0xf9, 0x87, 0x8c, 0x8b, 0x89, 0x87, 0x86, 0x88, 0x88, 0x87, 0xc6, 0xef, 0xed, 0xec, 0xea, 0x88, 0x11, 0x08, 0x07, 0x07, 0x09, 0x07, 0x05, 0x08, 0x08,
+  0x08, 0x06, 0x07, 0x05, 0x06, 0x07, 0x07, 0x05, 0x01, 0x02, 0x05, 0x6b, 0xe9, 0xeb, 0xea, 0xe9, 0xd3, 0x87, 0x92, 0xe9, 0xf0, 0xd3, 0xdf, 0xe9, 0xec, 0xec, 0xeb, 0xdd, 0xf1, 0xf1, 0xf6, 0x04,
+  0xf6, 0xf6, 0x8a, 0xf6, 0xf1, 0xdd, 0x6f, 0x4d, 0xa1, 0xe6, 0xf0, 0xef, 0xed, 0xec, 0xed, 0xd3, 0x80, 0x23, 0x17, 0x57, 0xfa, 0xfa, 0xf7, 0x03, 0xf6, 0xf6, 0xb5, 0xf5, 0xf6, 0xf0, 0xec, 0xea,
+  0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf2, 0xf2, 0xee, 0xf2, 0xf2, 0xfb,
+  0xf8, 0xfa, 0xf9, 0xf6, 0xf6, 0xf6, 0xf5, 0xdf, 0xeb, 0xed, 0xee, 0xde, 0xe1, 0xf8, 0x89, 0x8c, 0x8c, 0x8a, 0x87, 0x86, 0x88, 0x88, 0x9e, 0xeb, 0xec, 0xec, 0xea, 0xd1, 0x2b, 0x0d, 0x08, 0x04,
+  0x06, 0x09, 0x08, 0x07, 0x09, 0x08, 0x07, 0x06, 0x06, 0x05, 0x06, 0x09, 0x09, 0x07, 0x04, 0x05, 0x05, 0x13, 0xcb, 0xea, 0xe9, 0xe9, 0xeb, 0xa0, 0xbe, 0xeb, 0xed, 0xba, 0xe3, 0xea, 0xec, 0xec,
+  0xeb, 0xe8, 0xec, 0xf1, 0xf6, 0x04, 0xf6, 0xf6, 0x8a, 0xf6, 0xf5, 0xee, 0x90, 0x28, 0x0b, 0x20, 0x61, 0x85, 0x85, 0x6d, 0x3c, 0x14, 0x13, 0x14, 0x26, 0xdf, 0xfa, 0xf7, 0xf6, 0x02, 0xf6, 0xf6,
+  0xb6, 0xf6, 0xf5, 0xe0, 0xd6, 0xeb, 0xe9, 0xe6, 0xe4, 0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xe2, 0xe1, 0xe1, 0xe1, 0xe3, 0xe2, 0xe2, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe5, 0xe3, 0xde, 0xd9, 0xd7,
+  0xd7, 0xd9, 0xdf, 0xe6, 0xea, 0xed, 0xe9, 0xdc, 0xe4, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xee, 0xdc, 0xea, 0xed, 0xee, 0xe0, 0xe1, 0xf6, 0x8c, 0x8c, 0x8c, 0x88, 0x86, 0x85, 0x88, 0x89, 0xd9, 0xed,
+  0xec, 0xeb, 0xe8, 0x70, 0x0f, 0x09, 0x08, 0x08, 0x06, 0x07, 0x07, 0x08, 0x0a, 0x0a, 0x08, 0x06, 0x05, 0x06, 0x07, 0x08, 0x04, 0x02, 0x03, 0x04, 0x02, 0x04, 0x53, 0xe8, 0xe9, 0xe9, 0xe9, 0xc3,
+  0xe3, 0xf2, 0xbd, 0xbe, 0xdf, 0xeb, 0xed, 0xee, 0xed, 0xef, 0xd1, 0xf1, 0xf6, 0x05, 0xf6, 0xf6, 0x89, 0xf3, 0xe3, 0x52, 0x0c, 0x0a, 0x0d, 0x0b, 0x09, 0x0d, 0x0f, 0x15, 0x18, 0x28, 0xcb, 0xfc,
+  0xf7, 0xf5, 0xf6, 0x02, 0xf6, 0xf6, 0x8b, 0xf6, 0xf4, 0xc8, 0xf1, 0xf1, 0xee, 0xee, 0xf0, 0xee, 0xec, 0xec, 0xeb, 0xe9, 0xea, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xed, 0xed, 0x02, 0xee, 0xee,
+  0x02, 0xed, 0xed, 0xa7, 0xec, 0xec, 0xec, 0xed, 0xee, 0xee, 0xee, 0xf1, 0xef, 0xda, 0xf3, 0xfa, 0xf8, 0xf7, 0xf6, 0xd2, 0xec, 0xec, 0xed, 0xee, 0xe0, 0xd9, 0xf6, 0x8e, 0x8c, 0x8b, 0x89, 0x87,
+  0x86, 0x86, 0xb4, 0xef, 0xed, 0xec, 0xe9, 0xbc, 0x1f, 0x09, 0x0b, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x06, 0x03, 0x06, 0x06, 0x08, 0x04, 0x06, 0x05, 0x04, 0x07, 0x03, 0x04, 0x0b,
+  0xa7, 0xe9, 0xe9, 0xe9, 0xd2, 0xe1, 0xe3, 0x7a, 0xa8, 0xc9, 0xea, 0xef, 0xf0, 0xef, 0xf1, 0xd0, 0xf5, 0xf7, 0x05, 0xf6, 0xf6, 0x87, 0xf6, 0xf5, 0xe6, 0x73, 0x1d, 0x0a, 0x0c, 0x17, 0x23, 0x27,
+  0x23, 0x6b, 0xdd, 0xf1, 0x04, 0xf6, 0xf6, 0x84, 0xf6, 0xf5, 0xc7, 0xef, 0xee, 0xee, 0xee, 0xec, 0x02, 0xec, 0xec, 0xb0, 0xec, 0xeb, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xec, 0xed, 0xee, 0xed,
+  0xec, 0xee, 0xee, 0xec, 0xec, 0xeb, 0xeb, 0xec, 0xed, 0xed, 0xed, 0xef, 0xef, 0xee, 0xef, 0xdb, 0xec, 0xfa, 0xfa, 0xfb, 0xfd, 0xd1, 0xee, 0xee, 0xed, 0xee, 0xdf, 0xdc, 0xf7, 0x8d, 0x8c, 0x8b,
+  0x8a, 0x87, 0x85, 0x92, 0xec, 0xef, 0xed, 0xec, 0xe7, 0x4e, 0x10, 0x06, 0x0c, 0x0d, 0x08, 0x05, 0x07, 0x09, 0x08, 0x09, 0x04, 0x06, 0x05, 0x05, 0x07, 0x07, 0x04, 0x05, 0x06, 0x05, 0x07, 0x06,
+  0x07, 0x07, 0x2e, 0xdb, 0xe8, 0xea, 0xca, 0xd4, 0xb3, 0x50, 0x7d, 0x8e, 0xd8, 0xef, 0xf0, 0xf0, 0xf0, 0xcf, 0xf8, 0xf6, 0x05, 0xf6, 0xf6, 0x89, 0xf6, 0xf5, 0xf2, 0xf2, 0xda, 0x9f, 0x78, 0x74,
+  0x82, 0xa8, 0xda, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xfb, 0xf7, 0x02, 0xf6, 0xf6, 0x82, 0xf6, 0xf8, 0xc3, 0xe5, 0x02, 0xec, 0xed, 0x02, 0xed, 0xed, 0x81, 0xec, 0xeb, 0x03, 0xeb, 0xeb, 0xad, 0xec,
+  0xed, 0xf0, 0xee, 0xed, 0xef, 0xef, 0xed, 0xed, 0xec, 0xeb, 0xec, 0xee, 0xec, 0xea, 0xef, 0xef, 0xee, 0xe8, 0xd4, 0xfa, 0xfa, 0xfb, 0xfc, 0xde, 0xe6, 0xf0, 0xee, 0xed, 0xed, 0xde, 0xdc, 0xf3,
+  0x90, 0x8e, 0x8b, 0x89, 0x86, 0x85, 0xd6, 0xf0, 0xed, 0xed, 0xec, 0x9f, 0x1b, 0x10, 0x08, 0x0e, 0x0c, 0x09, 0x08, 0x08, 0x09, 0x08, 0x08, 0x0a, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x05, 0x07,
+  0x05, 0x04, 0x05, 0x06, 0x07, 0x0a, 0x67, 0xe7, 0xe9, 0xb6, 0x9d, 0x5e, 0x48, 0x51, 0x49, 0xb1, 0xef, 0xee, 0xee, 0xee, 0xe2, 0xe3, 0xf4, 0xf5, 0xf6, 0x04, 0xf6, 0xf6, 0x86, 0xf4, 0xf1, 0xf1,
+  0xf1, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xf4, 0x06, 0xf6, 0xf6, 0xb6, 0xf4, 0xd4, 0xe1, 0xed, 0xf0, 0xee, 0xee, 0xee, 0xea, 0xe8, 0xe3, 0xe3, 0xe3, 0xe6, 0xe7, 0xe9, 0xe9, 0xe8, 0xe8,
+  0xe7, 0xe4, 0xe2, 0xe1, 0xdf, 0xdd, 0xdb, 0xd9, 0xd8, 0xd5, 0xd2, 0xd2, 0xd4, 0xd4, 0xd3, 0xd2, 0xcf, 0xe1, 0xf7, 0xfa, 0xfb, 0xff, 0xef, 0xd8, 0xf1, 0xf0, 0xee, 0xee, 0xed, 0xdf, 0xda, 0xf5,
+  0xab, 0x8c, 0x8b, 0x88, 0x85, 0xb4, 0xef, 0xef, 0xed, 0xed, 0xd5, 0x39, 0x0e, 0x0b, 0x0c, 0x0a, 0x08, 0x0b, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x07, 0x06, 0x06, 0x06, 0x05, 0x04, 0x04, 0x04, 0x06,
+  0x06, 0x06, 0x08, 0x07, 0x05, 0x05, 0x0d, 0xa6, 0xea, 0xc0, 0x38, 0x2d, 0x3e, 0x2e, 0x1c, 0xa0, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xd8, 0xf1, 0xf5, 0xf6, 0x03, 0xf6, 0xf6, 0x82, 0xf6, 0xf5, 0xf2,
+  0xf1, 0x04, 0xf1, 0xf1, 0x82, 0xf1, 0xf3, 0xf5, 0xf6, 0x05, 0xf6, 0xf6, 0x83, 0xf7, 0xf6, 0xf7, 0xfc, 0xfc, 0xfa, 0x02, 0xf9, 0xfb, 0x02, 0xfa, 0xf8, 0xaf, 0xf4, 0xf3, 0xf7, 0xf6, 0xf3, 0xf5,
+  0xf6, 0xf5, 0xf1, 0xf5, 0xf6, 0xf8, 0xf9, 0xf9, 0xf6, 0xf7, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xfc, 0xf9, 0xf6, 0xfa, 0xfb, 0xf3, 0xd7, 0xf1, 0xf2, 0xf0, 0xf0, 0xee, 0xec, 0xe2, 0xd8, 0xf6, 0xb1,
+  0x8e, 0x8c, 0x89, 0x99, 0xec, 0xee, 0xed, 0xec, 0xea, 0x57, 0x16, 0x0e, 0x0e, 0x0d, 0x0b, 0x08, 0x09, 0x08, 0x07, 0x07, 0x07, 0x0a, 0x08, 0x07, 0x06, 0x05, 0x07, 0x06, 0x04, 0x05, 0x07, 0x09,
+  0x08, 0x07, 0x07, 0x02, 0x02, 0x04, 0x1e, 0xd2, 0xd9, 0x3c, 0x32, 0x34, 0x1c, 0x48, 0xaa, 0xed, 0xef, 0xf0, 0xf1, 0xef, 0xf1, 0xdd, 0xf2, 0xf6, 0x03, 0xf6, 0xf6, 0x81, 0xf6, 0xf5, 0x06, 0xf1,
+  0xf1, 0x81, 0xf2, 0xf3, 0x06, 0xf6, 0xf6, 0xba, 0xf6, 0xf3, 0xf2, 0xf2, 0xf2, 0xf7, 0xfa, 0xfe, 0xfa, 0xfa, 0xfd, 0xfb, 0xf8, 0xf4, 0xfa, 0xfc, 0xf9, 0xfa, 0xfc, 0xf9, 0xf1, 0xf2, 0xf2, 0xf6,
+  0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf6, 0xf6, 0xf7, 0xf7, 0xf6, 0xf6, 0xfb, 0xe6, 0xd5, 0xf2, 0xf3, 0xf2, 0xf1, 0xf1, 0xee, 0xed, 0xe6, 0xd9, 0xf6, 0xb1, 0x8e, 0x8d, 0x93, 0xe0, 0xef, 0xed,
+  0xec, 0xec, 0x85, 0x1a, 0x10, 0x0f, 0x0c, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0x08, 0x07, 0x08, 0x0a, 0x04, 0x07, 0x09, 0x09, 0x06, 0x05, 0x05, 0x05, 0x05, 0x04, 0x07, 0x05, 0x09, 0x05, 0x03, 0x04,
+  0x06, 0x39, 0xdc, 0x82, 0x43, 0x2f, 0x35, 0x5e, 0xa9, 0xeb, 0xef, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xdb, 0xdf, 0xfb, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf6, 0xf6, 0xf5, 0xf3, 0x05, 0xf1, 0xf1, 0x81,
+  0xf1, 0xf2, 0x03, 0xf6, 0xf6, 0x8f, 0xf4, 0xf2, 0xf2, 0xf5, 0xf3, 0xf6, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xfa, 0xfe, 0xfa, 0xfa, 0xfd, 0xfb, 0xf8, 0xf1, 0xf6, 0xfa, 0xfc, 0xfe, 0xfa, 0xfa,
+  0xf9, 0xf9, 0xf9, 0xfa, 0x02, 0xf9, 0xf9, 0x94, 0xf9, 0xfc, 0xfe, 0xfe, 0xfd, 0xf9, 0xfb, 0xed, 0xd4, 0xe3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf0, 0xf1, 0xee, 0xed, 0xe9, 0xd8, 0xf6, 0xb3, 0x90, 0x90,
+  0xcf, 0xef, 0xed, 0xec, 0xed, 0xad, 0x18, 0x09, 0x0d, 0x0a, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x07, 0x02, 0x06, 0x06, 0x82, 0x05, 0x08, 0x05, 0x05, 0x02, 0x06, 0x04, 0x98, 0x03, 0x04, 0x06, 0x06,
+  0x06, 0x04, 0x04, 0x01, 0x03, 0x08, 0x5d, 0xbc, 0x63, 0x2d, 0x59, 0x5f, 0xad, 0xeb, 0xef, 0xef, 0xef, 0xf0, 0xf1, 0xf0, 0xf3, 0xed, 0xd9, 0xd6, 0xe9, 0xf9, 0xf8, 0xf5, 0xf7, 0xf7, 0xf6, 0xf3,
+  0xf2, 0xf3, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xef, 0xf0, 0xf0, 0xee, 0x02, 0xf4, 0xf5, 0xe9, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf4, 0xf0, 0xec, 0xef, 0xef, 0xee, 0xf2, 0xf3, 0xf7,
+  0xf6, 0xf6, 0xf9, 0xf7, 0xf7, 0xf0, 0xef, 0xf4, 0xf9, 0xfa, 0xf5, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf7, 0xf7, 0xf7, 0xf6, 0xf8, 0xf7, 0xfa, 0xfd, 0xfa, 0xde, 0xde, 0xe4, 0xf1, 0xf3, 0xf4, 0xf3,
+  0xf2, 0xeb, 0xdc, 0xef, 0xf0, 0xf0, 0xe9, 0xda, 0xfb, 0xb8, 0x93, 0xbd, 0xf0, 0xef, 0xed, 0xec, 0xd1, 0x28, 0x0c, 0x08, 0x09, 0x08, 0x07, 0x09, 0x09, 0x0c, 0x05, 0x08, 0x05, 0x05, 0x07, 0x06,
+  0x06, 0x08, 0x08, 0x06, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x09, 0x08, 0x08, 0x06, 0x06, 0x02, 0x02, 0x05, 0x0b, 0x86, 0x98, 0x41, 0x6e, 0x5a, 0xbe, 0xef, 0xf1, 0xf1, 0xcf, 0xea, 0xf1, 0xf1,
+  0xf2, 0xf1, 0xee, 0xed, 0xe3, 0xdc, 0xe6, 0xe0, 0xdb, 0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0xd8, 0xd8, 0xd5, 0xd6, 0xd5, 0xda, 0xdd, 0xdf, 0xe2, 0xe2, 0xe1, 0xde, 0xdd, 0xdd, 0xdc, 0xd6, 0xd6, 0xd7,
+  0xd6, 0xd5, 0xd7, 0xd8, 0xdc, 0xe3, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe9, 0xec, 0xea, 0xe8, 0xeb, 0xe8, 0xec, 0xea, 0xe9, 0xe5, 0xe6, 0xe6, 0xe8, 0xe9, 0xe8, 0xe9, 0xe9, 0xe8, 0xe7, 0xe5, 0xe2,
+  0xe0, 0xe2, 0xeb, 0xe8, 0xe0, 0xf5, 0xf3, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0x7b, 0xa9, 0xee, 0xef, 0xf0, 0xe9, 0xe0, 0xff, 0xbe, 0xb3, 0xed, 0xee, 0xed, 0xec, 0xe6, 0x46, 0x08, 0x09, 0x09,
+  0x0c, 0x0a, 0x02, 0x0a, 0x09, 0x81, 0x08, 0x08, 0x02, 0x06, 0x04, 0x96, 0x06, 0x05, 0x04, 0x06, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x06, 0x09, 0x09, 0x08, 0x08, 0x05, 0x05, 0x06, 0x09, 0x1d,
+  0x98, 0x63, 0x99, 0x7a, 0xc1, 0xf0, 0xf2, 0xf3, 0xe7, 0xa9, 0xef, 0xef, 0xf0, 0xf0, 0xed, 0xec, 0xec, 0xed, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xed, 0x03, 0xed, 0xed, 0x84, 0xec, 0xed, 0xee, 0xef,
+  0xed, 0xed, 0xef, 0xed, 0x02, 0xec, 0xec, 0x8c, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xed, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xed,
+  0x02, 0xed, 0xed, 0x81, 0xed, 0xec, 0x02, 0xec, 0xec, 0x9b, 0xed, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf3, 0xf5, 0x8b, 0x12, 0x96, 0xed, 0xee, 0xef, 0xe7, 0xde, 0xfc, 0xc9,
+  0xe6, 0xeb, 0xeb, 0xea, 0xe9, 0x71, 0x0a, 0x07, 0x09, 0x07, 0x0b, 0x09, 0x0a, 0x08, 0x09, 0x0a, 0x09, 0x07, 0x08, 0x06, 0x07, 0x04, 0x05, 0x04, 0x07, 0x06, 0x07, 0x04, 0x05, 0x05, 0x04, 0x06,
+  0x02, 0x07, 0x08, 0x8c, 0x08, 0x08, 0x07, 0x05, 0x06, 0x10, 0x39, 0x80, 0xd8, 0xba, 0xb9, 0xef, 0xef, 0xf3, 0xde, 0x9c, 0x69, 0xdc, 0xef, 0xef, 0xee, 0xec, 0xed, 0xec, 0x03, 0xec, 0xec, 0x03,
+  0xed, 0xed, 0x87, 0xec, 0xec, 0xed, 0xee, 0xec, 0xec, 0xee, 0xed, 0xec, 0xee, 0xee, 0xec, 0xed, 0xee, 0x02, 0xee, 0xee, 0x82, 0xee, 0xec, 0xec, 0xec, 0x02, 0xeb, 0xeb, 0x81, 0xeb, 0xed, 0x04,
+  0xee, 0xee, 0x83, 0xee, 0xed, 0xed, 0xed, 0xed, 0xec, 0x02, 0xec, 0xec, 0x02, 0xed, 0xed, 0x89, 0xee, 0xf0, 0xf1, 0xef, 0xee, 0xf0, 0xdd, 0x5f, 0x0c, 0x16, 0xa0, 0xec, 0xed, 0xee, 0xea, 0xe3,
+  0xf6, 0xd0, 0x02, 0xe8, 0xe8, 0xa3, 0x90, 0x13, 0x08, 0x0b, 0x08, 0x07, 0x0d, 0x0a, 0x08, 0x0a, 0x09, 0x0d, 0x09, 0x07, 0x06, 0x07, 0x07, 0x06, 0x08, 0x05, 0x05, 0x05, 0x04, 0x07, 0x04, 0x06,
+  0x05, 0x05, 0x03, 0x04, 0x07, 0x09, 0x0a, 0x05, 0x07, 0x04, 0x04, 0x09, 0x11, 0x7d, 0xe4, 0xdb, 0xbf, 0xec, 0xef, 0xf1, 0xf0, 0xdb, 0x3a, 0x34, 0x95, 0xe4, 0xf1, 0xed, 0xec, 0xec, 0xec, 0xed,
+  0xed, 0xec, 0xec, 0xed, 0xec, 0xec, 0xed, 0xed, 0xec, 0xed, 0xed, 0xec, 0x02, 0xec, 0xec, 0x82, 0xec, 0xed, 0xee, 0xec, 0x02, 0xec, 0xec, 0x86, 0xee, 0xee, 0xec, 0xed, 0xee, 0xec, 0xec, 0xec,
+  0xec, 0xeb, 0xeb, 0xeb, 0x02, 0xec, 0xec, 0x83, 0xec, 0xed, 0xed, 0xed, 0xee, 0xef, 0x02, 0xed, 0xed, 0x03, 0xec, 0xec, 0x99, 0xed, 0xed, 0xed, 0xec, 0xec, 0xec, 0xed, 0xee, 0xd8, 0x86, 0x2b,
+  0x18, 0x47, 0xca, 0xbe, 0xec, 0xee, 0xef, 0xe1, 0xf6, 0xed, 0xc3, 0xe7, 0xe6, 0xe6, 0xa0, 0x19, 0x0f, 0x0b, 0x0e, 0x0c, 0x0b, 0x09, 0x08, 0x09, 0x09, 0x0a, 0x0a, 0x0c, 0x09, 0x0a, 0x09, 0x08,
+  0x06, 0x04, 0x05, 0x05, 0x05, 0x04, 0x07, 0x02, 0x05, 0x07, 0xff, 0x04, 0x04, 0x05, 0x09, 0x09, 0x08, 0x08, 0x05, 0x06, 0x07, 0x05, 0x50, 0xe7, 0xe8, 0xc3, 0xea, 0xee, 0xf0, 0xf0, 0xe1, 0xe8,
+  0x6e, 0x2f, 0x42, 0x78, 0xa4, 0xbd, 0xcb, 0xd3, 0xda, 0xde, 0xde, 0xe0, 0xe1, 0xdf, 0xe2, 0xe3, 0xe2, 0xde, 0xdc, 0xd6, 0xce, 0xcb, 0xc6, 0xc1, 0xbc, 0xb7, 0xba, 0xbd, 0xbf, 0xc4, 0xc7, 0xca,
+  0xcb, 0xcb, 0xc8, 0xc6, 0xc6, 0xc9, 0xcd, 0xd4, 0xd6, 0xd6, 0xd5, 0xd3, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd3, 0xd3, 0xd5, 0xd8, 0xd9, 0xda, 0xdd, 0xe1, 0xe2, 0xe2, 0xe3, 0xe3, 0xe4,
+  0xe6, 0xe7, 0xe8, 0xe8, 0xe4, 0xdd, 0xc7, 0xa1, 0x6e, 0x45, 0x2f, 0x29, 0x8b, 0xf8, 0xdb, 0xde, 0xec, 0xec, 0xec, 0xc5, 0xf5, 0xb8, 0xd1, 0xe3, 0xe2, 0xa3, 0x25, 0x16, 0x14, 0x0b, 0x0e, 0x0a,
+  0x09, 0x0a, 0x0c, 0x06, 0x0b, 0x09, 0x0c, 0x0e, 0x09, 0x0b, 0x08, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x05, 0x08, 0x09, 0x07, 0x08, 0x05, 0x07, 0x08, 0x06,
+  0x05, 0x04, 0x13, 0xe1, 0xed, 0xca, 0xe1, 0xee, 0xee, 0xef, 0xeb, 0xe0, 0xfd, 0xca, 0x80, 0x59, 0x4d, 0x42, 0x38, 0x39, 0x41, 0x49, 0x4e, 0x4f, 0x51, 0x4f, 0x4f, 0x4e, 0x4d, 0x4a, 0x46, 0x43,
+  0x38, 0x32, 0x2d, 0x2e, 0x31, 0x38, 0x3f, 0x43, 0x47, 0x48, 0x4c, 0x4b, 0x4a, 0x47, 0x43, 0x41, 0x41, 0x44, 0x47, 0x4d, 0x54, 0x56, 0x59, 0x5a, 0x59, 0x59, 0x56, 0x51, 0x4e, 0x46, 0x43, 0x42,
+  0x43, 0x44, 0x46, 0x4c, 0x4e, 0x55, 0x5d, 0x62, 0x64, 0x60, 0x5a, 0x59, 0x58, 0x5c, 0x63, 0x64, 0x60, 0x59, 0x55, 0x53, 0x55, 0x5e, 0x92, 0xe5, 0xfe, 0xdf, 0xc7, 0xee, 0xed, 0xec, 0xeb, 0xb2,
+  0x9f, 0x6a, 0xd7, 0xde, 0xa5, 0x1d, 0x18, 0x13, 0x12, 0xcb, 0x0b, 0x0a, 0x0c, 0x09, 0x06, 0x09, 0x08, 0x0a, 0x08, 0x09, 0x08, 0x0b, 0x0a, 0x09, 0x08, 0x0a, 0x07, 0x06, 0x07, 0x05, 0x05, 0x05,
+  0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x04, 0x07, 0x06, 0x05, 0x08, 0x05, 0x03, 0x04, 0x06, 0x9a, 0xee, 0xf1, 0xc2, 0xec, 0xee, 0xef, 0xef, 0xe9, 0xda, 0xfc, 0xfc, 0xf6, 0xdf, 0xc5, 0xbc,
+  0xb3, 0xb0, 0xaa, 0xa8, 0xaa, 0xaa, 0xa1, 0x9a, 0x8e, 0x88, 0x8b, 0x91, 0x9f, 0xa0, 0x9c, 0x9a, 0x99, 0x99, 0x9c, 0xa1, 0xa6, 0xa8, 0xa8, 0xa9, 0xa9, 0xa9, 0xa8, 0xa6, 0xa8, 0xa5, 0xa3, 0xa9,
+  0xb5, 0xbb, 0xba, 0xba, 0xb9, 0xb8, 0xb9, 0xbd, 0xc1, 0xba, 0xb4, 0xad, 0xa4, 0x9d, 0x9a, 0x9a, 0x94, 0x91, 0x8d, 0x84, 0x80, 0x7c, 0x7f, 0x7f, 0x77, 0x5e, 0x47, 0x44, 0x43, 0x47, 0x4c, 0x63,
+  0x97, 0xcb, 0xfc, 0xfe, 0xf2, 0xa0, 0xab, 0xec, 0xed, 0xed, 0xec, 0xec, 0xa5, 0x29, 0x6e, 0xd7, 0xaa, 0x16, 0x0f, 0x16, 0x11, 0x0e, 0x0c, 0x08, 0x0d, 0x08, 0x0b, 0x09, 0x06, 0x07, 0x08, 0x06,
+  0x02, 0x07, 0x08, 0x9f, 0x07, 0x07, 0x08, 0x04, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x07, 0x05, 0x04, 0x04, 0x04, 0x05, 0x08, 0x08, 0x06, 0x08, 0x05, 0x03, 0x03, 0x07, 0x38, 0xef, 0xf2, 0xcd,
+  0xe7, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xd2, 0xdc, 0xfd, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xfd, 0xfa, 0xfa, 0xf6, 0xfa, 0xfa, 0xf7, 0xee, 0xeb, 0xec, 0xed, 0xef, 0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4,
+  0xf7, 0xf7, 0x03, 0xfa, 0xfa, 0x83, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf0, 0x02, 0xec, 0xec, 0x9f, 0xec, 0xf0, 0xf2, 0xf5, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xec, 0xe8, 0xe1, 0xd9, 0xd8, 0xd4, 0xd2,
+  0xcb, 0xc8, 0xbe, 0xa3, 0x8e, 0x7b, 0x82, 0xaa, 0xea, 0xff, 0xff, 0xfd, 0xe1, 0xa4, 0x7c, 0xc9, 0xed, 0xed, 0xec, 0xec, 0xeb, 0xeb, 0x95, 0x40, 0x88, 0xa4, 0x16, 0x07, 0x0c, 0x12, 0x10, 0x0a,
+  0x09, 0x09, 0x08, 0x07, 0x0a, 0x08, 0x07, 0x0c, 0x0a, 0x07, 0x05, 0x08, 0x06, 0x07, 0x02, 0x06, 0x05, 0xbc, 0x0a, 0x07, 0x06, 0x07, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x08,
+  0x08, 0x08, 0x03, 0x05, 0x05, 0x06, 0x0c, 0x9a, 0xf7, 0xf3, 0xc5, 0xe9, 0xec, 0xec, 0xed, 0xef, 0xed, 0xe2, 0xc6, 0xcc, 0xcc, 0xc9, 0xcc, 0xcd, 0xd0, 0xd3, 0xd5, 0xd6, 0xcf, 0xd0, 0xc6, 0xbb,
+  0xba, 0xbe, 0xc1, 0xc4, 0xc2, 0xbf, 0xbf, 0xbd, 0xbd, 0xc7, 0xc8, 0xc9, 0xc8, 0xcc, 0xcf, 0xd2, 0xd1, 0xd5, 0xd8, 0xdb, 0xdd, 0xdd, 0xd8, 0xd6, 0xd7, 0xd4, 0xd4, 0xd2, 0xd1, 0xd1, 0xd3, 0xd4,
+  0xd4, 0xd6, 0xd7, 0xd3, 0xd6, 0xd2, 0xca, 0xc2, 0xbd, 0xb6, 0xb2, 0xb1, 0xaf, 0xb1, 0xa4, 0x9b, 0x90, 0x8a, 0x86, 0x85, 0x8f, 0x9b, 0xa0, 0x9b, 0xaf, 0xd6, 0xec, 0xee, 0xef, 0xed, 0xec, 0xec,
+  0xe8, 0xe6, 0x7e, 0x3e, 0x5e, 0x16, 0x05, 0x0a, 0x0c, 0x0d, 0x02, 0x0a, 0x09, 0xa1, 0x08, 0x06, 0x07, 0x08, 0x0a, 0x07, 0x09, 0x08, 0x05, 0x06, 0x04, 0x05, 0x07, 0x06, 0x06, 0x07, 0x04, 0x05,
+  0x05, 0x06, 0x04, 0x05, 0x04, 0x06, 0x07, 0x06, 0x07, 0x05, 0x04, 0x07, 0x04, 0x05, 0x02, 0x06, 0x05, 0x06, 0x08, 0x17, 0xc7, 0xf7, 0xf1, 0xc7, 0xe8, 0xeb, 0xec, 0xed, 0xed, 0xed, 0xef, 0xed,
+  0xec, 0xec, 0xed, 0xeb, 0xea, 0xec, 0xed, 0xee, 0xec, 0xec, 0xec, 0xed, 0xee, 0xed, 0xeb, 0xed, 0x02, 0xec, 0xeb, 0x95, 0xec, 0xef, 0xed, 0xed, 0xec, 0xeb, 0xed, 0xed, 0xed, 0xec, 0xed, 0xed,
+  0xec, 0xed, 0xed, 0xee, 0xef, 0xf1, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xec, 0xeb, 0xec, 0xed, 0xec, 0xec, 0xec, 0xeb, 0x02, 0xea,
+  0xea, 0x93, 0xe8, 0xea, 0xed, 0xee, 0xec, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xe9, 0xb9, 0x62, 0x73, 0x3f, 0x04, 0x05, 0x0c, 0x0d, 0x0a, 0x0c, 0x0b, 0x0a, 0x08, 0x08, 0x07, 0x06, 0x07, 0x06, 0x08,
+  0x07, 0x06, 0x04, 0x05, 0x05, 0x06, 0x05, 0x05, 0x02, 0x06, 0x06, 0xa7, 0x05, 0x05, 0x04, 0x06, 0x07, 0x06, 0x05, 0x07, 0x08, 0x06, 0x06, 0x04, 0x05, 0x06, 0x04, 0x05, 0x06, 0x06, 0x07, 0x09,
+  0x26, 0xd5, 0xf6, 0xf3, 0xc9, 0xde, 0xec, 0xed, 0xee, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xec, 0xed, 0xee, 0xed, 0xef,
+  0xef, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xee, 0xef, 0xee, 0xee, 0xed, 0xee, 0xf0, 0xf0, 0xed, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xef, 0xf1, 0x02, 0xf1, 0xf1, 0x88, 0xf1, 0xf0,
+  0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xeb, 0x04, 0xec, 0xec, 0xa6, 0xec, 0xea, 0xae, 0x91, 0xa3, 0x5f, 0x0b, 0x06, 0x05, 0x0d, 0x0a, 0x0a, 0x0d, 0x09,
+  0x08, 0x09, 0x09, 0x07, 0x05, 0x07, 0x09, 0x09, 0x07, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x07, 0x07, 0x08, 0x05, 0x04, 0x07, 0x07, 0x06, 0x06, 0x04, 0x08, 0x09, 0x09, 0x07,
+  0x04, 0x03, 0x05, 0x06, 0x04, 0x06, 0x05, 0x08, 0x0c, 0x23, 0xb8, 0xf6, 0xf2, 0xd2, 0xca, 0xea, 0xed, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xf1, 0xef, 0xf0, 0xee, 0xf0, 0xef, 0x02, 0xef,
+  0xef, 0x86, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xef, 0x02, 0xf0, 0xf0, 0x83, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0x03, 0xf0, 0xf0, 0x02, 0xf0, 0xf1, 0x84, 0xf1,
+  0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0x02, 0xf0, 0xf0, 0xae, 0xf0, 0xee, 0xed, 0xee, 0xed, 0xec, 0xec, 0xec, 0xec, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xe9, 0xea, 0xa6, 0xa4, 0xa9, 0x4a,
+  0x07, 0x06, 0x06, 0x07, 0x0a, 0x09, 0x08, 0x0c, 0x09, 0x09, 0x09, 0x09, 0x0c, 0x09, 0x0b, 0x07, 0x07, 0x06, 0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x06, 0x05, 0x06, 0x07, 0x07, 0x07, 0x05,
+  0x06, 0x06, 0x07, 0x04, 0x04, 0x06, 0x08, 0x09, 0x07, 0x07, 0x03, 0x07, 0x06, 0x05, 0x08, 0x05, 0x05, 0x08, 0x0d, 0x16, 0x96, 0xea, 0xe9, 0xdc, 0xbb, 0xc4, 0xe6, 0xed, 0xee, 0xee, 0xef, 0xf0,
+  0xf0, 0xf2, 0xf1, 0xf1, 0xef, 0xf0, 0xf1, 0x04, 0xf0, 0xf0, 0x03, 0xf1, 0xf1, 0x81, 0xf1, 0xf0, 0x03, 0xf0, 0xf0, 0x81, 0xf0, 0xf1, 0x08, 0xf0, 0xf0, 0x03, 0xf1, 0xf1, 0xb4, 0xf0, 0xf0, 0xf0,
+  0xef, 0xed, 0xed, 0xee, 0xed, 0xec, 0xee, 0xed, 0xed, 0xed, 0xec, 0xec, 0xeb, 0xeb, 0xe9, 0xaa, 0x9d, 0x9b, 0x34, 0x09, 0x07, 0x05, 0x05, 0x06, 0x04, 0x05, 0x06, 0x04, 0x08, 0x08, 0x07, 0x08,
+  0x0b, 0x0d, 0x09, 0x07, 0x06, 0x04, 0x06, 0x05, 0x05, 0x06, 0x05, 0x04, 0x05, 0x06, 0x05, 0x03, 0x07, 0x06, 0x07, 0x06, 0x04, 0x05, 0x06, 0x08, 0x08, 0x06, 0x07, 0x05, 0x04, 0x07, 0x08, 0x05,
+  0x06, 0x07, 0x06, 0x08, 0x08, 0x04, 0x06, 0x0c, 0x0f, 0x4e, 0xbd, 0xde, 0xe2, 0xe3, 0xbc, 0xbe, 0xec, 0xee, 0xf0, 0xf1, 0xf1, 0xf3, 0xf1, 0xe2, 0xb8, 0xbb, 0xc1, 0xc1, 0xbf, 0xbd, 0xc0, 0xc0,
+  0xbe, 0xbe, 0xc0, 0xc0, 0xbe, 0x02, 0xbc, 0xbc, 0x82, 0xbc, 0xbd, 0xbd, 0xbf, 0x02, 0xc0, 0xc0, 0x81, 0xbf, 0xc0, 0x02, 0xc1, 0xc1, 0xa3, 0xc1, 0xbf, 0xbe, 0xbe, 0xbe, 0xbf, 0xc0, 0xbf, 0xbf,
+  0xbd, 0xbc, 0xba, 0xba, 0xba, 0xbc, 0xbb, 0xbb, 0xbc, 0xbe, 0xbf, 0xc2, 0xc5, 0xc7, 0xc5, 0xc4, 0xca, 0xeb, 0xed, 0xed, 0xed, 0xeb, 0xeb, 0xed, 0xea, 0xe9, 0xab, 0xa0, 0x6d, 0x18, 0x0a, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x04, 0x05, 0x07, 0x08, 0x03, 0x07, 0x05, 0x0a, 0x07, 0x09, 0x09, 0x07, 0x05, 0x07, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x09, 0x06, 0x03, 0x05, 0x05, 0x02, 0x07, 0x05,
+  0xa0, 0x07, 0x09, 0x07, 0x07, 0x06, 0x05, 0x08, 0x08, 0x05, 0x06, 0x04, 0x04, 0x05, 0x09, 0x08, 0x09, 0x07, 0x04, 0x09, 0x0d, 0x0f, 0x17, 0x57, 0x9c, 0xc3, 0xdb, 0xba, 0xae, 0xeb, 0xef, 0xf0,
+  0xf2, 0xf2, 0xf3, 0xf4, 0xef, 0xc1, 0xa4, 0xa0, 0x9d, 0x99, 0x9a, 0x9a, 0x98, 0x97, 0x95, 0x94, 0x95, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98, 0x99, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9c,
+  0x9b, 0x02, 0x9a, 0x9a, 0x82, 0x98, 0x98, 0x99, 0x9a, 0x02, 0x9a, 0x9a, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x9b, 0x98, 0x97, 0x97, 0x98, 0x9a, 0x9b, 0x9b, 0x96, 0x91, 0xc1, 0xec, 0xed, 0xec,
+  0xec, 0xeb, 0xeb, 0xeb, 0xe9, 0xa2, 0x7a, 0x37, 0x09, 0x07, 0x07, 0x06, 0x06, 0x05, 0x04, 0x05, 0x07, 0x05, 0x06, 0x03, 0x07, 0x06, 0x07, 0x07, 0x07, 0x09, 0x07, 0x08, 0x05, 0x06, 0x04, 0x02,
+  0x04, 0x05, 0x9e, 0x03, 0x08, 0x07, 0x07, 0x06, 0x08, 0x06, 0x07, 0x08, 0x07, 0x09, 0x06, 0x05, 0x08, 0x06, 0x09, 0x06, 0x05, 0x06, 0x04, 0x06, 0x05, 0x05, 0x08, 0x09, 0x08, 0x06, 0x02, 0x06,
+  0x09, 0x0b, 0x0e, 0x0f, 0x13, 0x1b, 0x28, 0x2e, 0x28, 0x9a, 0xe6, 0xec, 0xf0, 0xf1, 0xf2, 0xf3, 0xf2, 0xf4, 0xe7, 0xb8, 0x9a, 0x99, 0x99, 0x99, 0x98, 0x96, 0x94, 0x93, 0x93, 0x94, 0x94, 0x02,
+  0x94, 0x95, 0x88, 0x96, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x99, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x94, 0x95, 0x02, 0x97, 0x97, 0x03, 0x98, 0x98, 0x8b, 0x97, 0x96, 0x96, 0x97, 0x97, 0x97,
+  0x98, 0x98, 0x97, 0xa5, 0xd7, 0xec, 0xec, 0xec, 0xeb, 0xea, 0xe9, 0xe9, 0xca, 0x67, 0x28, 0x0a, 0x02, 0x05, 0x05, 0x96, 0x05, 0x07, 0x04, 0x04, 0x06, 0x06, 0x05, 0x04, 0x05, 0x09, 0x07, 0x04,
+  0x04, 0x04, 0x05, 0x03, 0x05, 0x07, 0x04, 0x03, 0x06, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x0a, 0x06, 0x08, 0x07, 0x08, 0x09, 0x07, 0x08, 0x08, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x09, 0x05,
+  0x02, 0x05, 0x07, 0x91, 0x0a, 0x07, 0x03, 0x03, 0x05, 0x05, 0x09, 0x0b, 0x0c, 0x0e, 0x0f, 0x0f, 0x10, 0x13, 0x16, 0x4e, 0xc6, 0xed, 0xee, 0xee, 0xef, 0xf0, 0xf3, 0xf1, 0xef, 0xe2, 0xc4, 0xa7,
+  0x99, 0x97, 0x96, 0x94, 0x93, 0x92, 0x02, 0x95, 0x95, 0x82, 0x95, 0x96, 0x96, 0x95, 0x02, 0x95, 0x96, 0x89, 0x96, 0x96, 0x98, 0x97, 0x97, 0x97, 0x95, 0x94, 0x96, 0x94, 0x96, 0x96, 0x94, 0x96,
+  0x97, 0x96, 0x97, 0x97, 0x02, 0x96, 0x97, 0x93, 0x95, 0x95, 0x96, 0x97, 0x9b, 0xb6, 0xd5, 0xec, 0xec, 0xec, 0xec, 0xea, 0xe8, 0xe6, 0xd9, 0x7c, 0x1b, 0x05, 0x07, 0x05, 0x05, 0x07, 0x05, 0x04,
+  0x08, 0x05, 0x05, 0x03, 0x06, 0x08, 0x05, 0x05, 0x07, 0x07, 0x08, 0x04, 0x06, 0x08, 0x02, 0x06, 0x06, 0x91, 0x05, 0x06, 0x04, 0x06, 0x06, 0x05, 0x05, 0x06, 0x09, 0x09, 0x0a, 0x09, 0x03, 0x05,
+  0x05, 0x0b, 0x09, 0x05, 0x08, 0x05, 0x04, 0x06, 0x0a, 0x05, 0x08, 0x05, 0x04, 0x07, 0x03, 0x0b, 0x09, 0x0a, 0x04, 0x08, 0x02, 0x05, 0x05, 0x92, 0x07, 0x08, 0x09, 0x0a, 0x0a, 0x0d, 0x10, 0x0f,
+  0x11, 0x65, 0xd3, 0xec, 0xec, 0xef, 0xf0, 0xf0, 0xee, 0xef, 0xf0, 0xf0, 0xde, 0xc0, 0xa7, 0x97, 0x94, 0x95, 0x97, 0x97, 0x97, 0x96, 0x94, 0x96, 0x95, 0x94, 0x93, 0x92, 0x02, 0x93, 0x93, 0x82,
+  0x94, 0x95, 0x96, 0x93, 0x03, 0x92, 0x92, 0x83, 0x94, 0x95, 0x95, 0x95, 0x96, 0x97, 0x02, 0x97, 0x97, 0x88, 0x92, 0x96, 0xb4, 0xd0, 0xe8, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xea, 0xe9, 0xe4, 0x9a,
+  0x2f, 0x0a, 0x02, 0x05, 0x05, 0x93, 0x05, 0x07, 0x08, 0x04, 0x04, 0x03, 0x04, 0x05, 0x08, 0x08, 0x05, 0x07, 0x09, 0x04, 0x06, 0x04, 0x08, 0x05, 0x08, 0x07, 0x07, 0x07, 0x05, 0x05, 0x08, 0x07,
+  0x06, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x07, 0x06, 0x08, 0x05, 0x0a, 0x02, 0x08, 0x08, 0x84, 0x08, 0x04, 0x0a, 0x05, 0x03, 0x03, 0x04, 0x04, 0x03, 0x07, 0x06, 0x99, 0x04, 0x06, 0x05, 0x07,
+  0x06, 0x06, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0a, 0x09, 0x12, 0x72, 0xd3, 0xed, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xf1, 0xf1, 0xee, 0xee, 0xea, 0xd8, 0xc2, 0xae, 0x9d, 0x97, 0x97, 0x96, 0x94,
+  0x94, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x91, 0x92, 0x91, 0x92, 0x92, 0x93, 0x90, 0x02, 0x91, 0x91, 0xb6, 0x92, 0x94, 0x94, 0x95, 0x93, 0x94, 0x96, 0x98, 0xaa, 0xc4, 0xde, 0xec, 0xed, 0xec,
+  0xec, 0xeb, 0xea, 0xea, 0xeb, 0xe8, 0xe6, 0xaf, 0x42, 0x0e, 0x08, 0x04, 0x08, 0x09, 0x0d, 0x07, 0x06, 0x09, 0x05, 0x05, 0x04, 0x04, 0x07, 0x06, 0x04, 0x03, 0x06, 0x09, 0x09, 0x0c, 0x07, 0x07,
+  0x06, 0x04, 0x03, 0x09, 0x08, 0x06, 0x07, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x08, 0x0b, 0x0d, 0x07, 0x06, 0x08, 0x09, 0x05, 0x09, 0x0a, 0x09, 0x08, 0x09, 0x07, 0x07, 0x0c, 0x09, 0x05, 0x04,
+  0x03, 0x06, 0x07, 0x06, 0x09, 0x08, 0x07, 0x05, 0x07, 0x06, 0x04, 0x06, 0x06, 0x05, 0x09, 0x07, 0x08, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x0b, 0x18, 0x72, 0xcb, 0xec, 0xee, 0xef, 0x02, 0xef,
+  0xef, 0x9f, 0xee, 0xee, 0xef, 0xed, 0xed, 0xe9, 0xd8, 0xc6, 0xb5, 0xa8, 0x99, 0x92, 0x90, 0x91, 0x8f, 0x90, 0x8f, 0x91, 0x92, 0x92, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x91, 0x90, 0x92, 0x94,
+  0x9a, 0xa6, 0xb2, 0xc2, 0xd5, 0xeb, 0xef, 0xee, 0xee, 0xed, 0xec, 0xec, 0xec, 0xeb, 0xe9, 0xea, 0xe5, 0xa2, 0x4c, 0x17, 0x0f, 0x09, 0x07, 0x05, 0x06, 0x08, 0x09, 0x06, 0x07, 0x07, 0x08, 0x06,
+  0x02, 0x07, 0x07, 0x84, 0x06, 0x0c, 0x08, 0x09, 0x09, 0x0b, 0x08, 0x08, 0x02, 0x07, 0x08, 0x8d, 0x08, 0x07, 0x06, 0x06, 0x05, 0x04, 0x07, 0x09, 0x08, 0x09, 0x09, 0x0b, 0x06, 0x05, 0x07, 0x08,
+  0x07, 0x07, 0x06, 0x09, 0x0d, 0x0c, 0x09, 0x06, 0x07, 0x09, 0x02, 0x07, 0x04, 0x8a, 0x06, 0x06, 0x06, 0x08, 0x07, 0x07, 0x05, 0x04, 0x06, 0x09, 0x07, 0x09, 0x0c, 0x09, 0x08, 0x07, 0x06, 0x07,
+  0x06, 0x05, 0x02, 0x05, 0x05, 0x85, 0x0e, 0x48, 0x91, 0xd7, 0xed, 0xee, 0xee, 0xef, 0xee, 0xed, 0x02, 0xed, 0xed, 0x8d, 0xee, 0xef, 0xed, 0xef, 0xef, 0xea, 0xe0, 0xd2, 0xc6, 0xc0, 0xbb, 0xb6,
+  0xb1, 0xac, 0xa9, 0xa7, 0xaa, 0xaf, 0xb4, 0xb9, 0xbf, 0xc9, 0xd5, 0xe6, 0xec, 0xed, 0x05, 0xec, 0xec, 0x99, 0xea, 0xea, 0xd2, 0x82, 0x2d, 0x11, 0x09, 0x0b, 0x08, 0x08, 0x07, 0x02, 0x05, 0x08,
+  0x07, 0x09, 0x0b, 0x0b, 0x0a, 0x04, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0a, 0x0a, 0x08, 0x0a, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x04, 0x05, 0x07, 0x04, 0x08, 0x08, 0x0a, 0x0b,
+  0x08, 0x08, 0x06, 0x06, 0x02, 0x07, 0x07, 0x8b, 0x09, 0x09, 0x0b, 0x0b, 0x0c, 0x07, 0x09, 0x07, 0x05, 0x08, 0x09, 0x06, 0x06, 0x06, 0x06, 0x08, 0x08, 0x05, 0x06, 0x07, 0x07, 0x08, 0x02, 0x09,
+  0x0a, 0x99, 0x0b, 0x08, 0x07, 0x09, 0x09, 0x07, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x11, 0x4d, 0x9d, 0xdc, 0xeb, 0xec, 0xec, 0xed, 0xed, 0xec, 0xec, 0xed, 0xee, 0xef, 0xed, 0xee, 0xf0,
+  0xf1, 0xf0, 0xf0, 0xf1, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf5, 0xf5, 0xf4, 0xf2, 0xf1, 0xf0, 0xf0, 0xed, 0xed, 0xed, 0xec, 0x02, 0xec, 0xec, 0xbd, 0xec, 0xeb, 0xeb, 0xec, 0xec, 0xdc, 0x99, 0x4f,
+  0x15, 0x05, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x05, 0x06, 0x08, 0x09, 0x0b, 0x0e, 0x0d, 0x0a, 0x04, 0x07, 0x05, 0x06, 0x07, 0x06, 0x06, 0x08, 0x09, 0x0b, 0x0c, 0x08, 0x08, 0x07, 0x03,
+  0x04, 0x07, 0x06, 0x03, 0x08, 0x08, 0x08, 0x04, 0x07, 0x07, 0x08, 0x0b, 0x09, 0x08, 0x06, 0x07, 0x07, 0x08, 0x05, 0x08, 0x09, 0x0b, 0x0c, 0x0c, 0x0a, 0x0a, 0x09, 0x08, 0x04, 0x08, 0x06, 0x07,
+  0x08, 0x04, 0x07, 0x05, 0x05, 0x04, 0x06, 0x08, 0x09, 0x05, 0x0b, 0x05, 0x08, 0x0a, 0x09, 0x0c, 0x09, 0x09, 0x09, 0x0a, 0x0d, 0x0b, 0x07, 0x07, 0x08, 0x04, 0x04, 0x04, 0x05, 0x09, 0x18, 0x46,
+  0x89, 0xc8, 0xea, 0xed, 0xec, 0xec, 0xec, 0xee, 0xef, 0xed, 0xed, 0xed, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf2, 0x03, 0xf2, 0xf2, 0x83, 0xf1, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0x03, 0xec, 0xec, 0x9e,
+  0xec, 0xe8, 0xca, 0x91, 0x53, 0x1f, 0x12, 0x0a, 0x08, 0x07, 0x09, 0x0c, 0x09, 0x07, 0x06, 0x07, 0x07, 0x07, 0x03, 0x03, 0x07, 0x08, 0x09, 0x09, 0x07, 0x03, 0x04, 0x04, 0x03, 0x05, 0x07, 0x08,
+  0x07, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x05, 0x05, 0x07, 0x05, 0x04, 0x08, 0x05, 0x04, 0x07, 0x03, 0x08, 0x09, 0x05, 0x08, 0x0a, 0x07, 0x05, 0x05, 0x05, 0x08, 0x08, 0x08, 0x02, 0x09, 0x0c, 0x83,
+  0x07, 0x07, 0x07, 0x05, 0x04, 0x05, 0x02, 0x07, 0x06, 0x95, 0x05, 0x06, 0x06, 0x06, 0x05, 0x08, 0x09, 0x07, 0x09, 0x04, 0x0a, 0x08, 0x09, 0x0a, 0x09, 0x09, 0x08, 0x09, 0x0e, 0x0b, 0x06, 0x07,
+  0x07, 0x06, 0x04, 0x05, 0x05, 0x05, 0x04, 0x06, 0x05, 0x07, 0x1f, 0x4c, 0x79, 0xab, 0xd5, 0xea, 0xeb, 0xec, 0xee, 0xef, 0x03, 0xf0, 0xf0, 0x81, 0xf0, 0xf1, 0x02, 0xf1, 0xf1, 0xdd, 0xf1, 0xf0,
+  0xf0, 0xf0, 0xed, 0xec, 0xeb, 0xeb, 0xec, 0xe4, 0xc0, 0x94, 0x5e, 0x2b, 0x09, 0x02, 0x03, 0x03, 0x07, 0x08, 0x0a, 0x09, 0x0c, 0x04, 0x07, 0x06, 0x07, 0x08, 0x06, 0x05, 0x07, 0x06, 0x06, 0x04,
+  0x08, 0x09, 0x08, 0x05, 0x05, 0x0b, 0x09, 0x08, 0x09, 0x05, 0x06, 0x09, 0x0b, 0x09, 0x0a, 0x06, 0x08, 0x06, 0x09, 0x08, 0x07, 0x06, 0x06, 0x07, 0x09, 0x08, 0x0a, 0x0c, 0x06, 0x08, 0x0b, 0x07,
+  0x06, 0x06, 0x08, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x0a, 0x09, 0x07, 0x08, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x05, 0x06, 0x06, 0x06, 0x09, 0x07, 0x07, 0x05, 0x04, 0x06, 0x07, 0x07, 0x06, 0x06,
+  0x07, 0x08, 0x06, 0x06, 0x06, 0x0b, 0x0c, 0x0a, 0x0c, 0x09, 0x07, 0x07, 0x07, 0x05, 0x05, 0x04, 0x03, 0x05, 0x05, 0x04, 0x06, 0x08, 0x07, 0x09, 0x09, 0x26, 0x57, 0x86, 0xab, 0xc5, 0xdd, 0xec,
+  0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf3, 0xef, 0xe3, 0xcb, 0xbd, 0x97, 0x73, 0x41, 0x1a, 0x0f, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x05, 0x08, 0x09, 0x0b, 0x08,
+  0x0a, 0x08, 0x06, 0x06, 0x05, 0x07, 0x04, 0x07, 0x06, 0x05, 0x07, 0x05, 0x07, 0x0b, 0x0b, 0x0a, 0x07, 0x07, 0x09, 0x09, 0x08, 0x05, 0x07, 0x06, 0x02, 0x09, 0x0a, 0xcc, 0x08, 0x07, 0x09, 0x0a,
+  0x07, 0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x0c, 0x0d, 0x08, 0x09, 0x07, 0x09, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x08, 0x08, 0x08, 0x09, 0x07, 0x07, 0x08, 0x06, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06,
+  0x06, 0x05, 0x09, 0x07, 0x04, 0x05, 0x05, 0x07, 0x06, 0x05, 0x07, 0x06, 0x07, 0x03, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0c, 0x0a, 0x0b, 0x08, 0x0a, 0x06, 0x07, 0x06, 0x06, 0x03, 0x06, 0x06, 0x05,
+  0x07, 0x09, 0x09, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x0b, 0x12, 0x15, 0x1f, 0x34, 0x3f, 0x4f, 0x61, 0x6a, 0x6c, 0x6b, 0x65, 0x5b, 0x4e, 0x4a, 0x3d, 0x23, 0x21, 0x15, 0x0e, 0x09, 0x06, 0x05, 0x05,
+  0x07, 0x06, 0x06, 0x0a, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0b, 0x0a, 0x08, 0x07, 0x08, 0x06, 0x06, 0x05, 0x07, 0x04, 0x09, 0x05, 0x04, 0x05, 0x05, 0x05, 0x08, 0x09, 0x08, 0x08, 0x0a, 0x08, 0x08,
+  0x08, 0x06, 0x0a, 0x07, 0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x08, 0x08, 0x08, 0x0b, 0x0a, 0x0a, 0x05, 0x05, 0x09, 0x09, 0x02, 0x08, 0x07, 0x90, 0x06, 0x05, 0x05, 0x08, 0x07, 0x09, 0x08, 0x07,
+  0x08, 0x08, 0x06, 0x05, 0x07, 0x07, 0x05, 0x06, 0x07, 0x05, 0x04, 0x0a, 0x07, 0x09, 0x04, 0x06, 0x03, 0x04, 0x05, 0x06, 0x04, 0x07, 0x08, 0x07, 0x02, 0x04, 0x06, 0x95, 0x05, 0x05, 0x08, 0x0a,
+  0x09, 0x0a, 0x09, 0x0c, 0x07, 0x09, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x0c, 0x0c, 0x0d, 0x0c, 0x0a, 0x06, 0x04, 0x04, 0x03, 0x03, 0x06, 0x07, 0x04, 0x07, 0x06, 0x0c,
+  0x0c, 0x0f, 0x0b, 0x07, 0x08, 0x06, 0x02, 0x08, 0x08, 0x93, 0x09, 0x09, 0x08, 0x08, 0x08, 0x0a, 0x07, 0x07, 0x09, 0x08, 0x0b, 0x0e, 0x0c, 0x0c, 0x0b, 0x0b, 0x07, 0x05, 0x07, 0x06, 0x06, 0x04,
+  0x04, 0x04, 0x03, 0x03, 0x06, 0x06, 0x08, 0x0b, 0x0b, 0x0e, 0x0c, 0x0b, 0x09, 0x08, 0x08, 0x08, 0x02, 0x06, 0x05, 0x88, 0x08, 0x09, 0x08, 0x08, 0x08, 0x07, 0x08, 0x09, 0x07, 0x06, 0x05, 0x04,
+  0x07, 0x0a, 0x05, 0x07,
 };
 
 const lv_image_dsc_t img_programs = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 140,
   .header.h = 134,
-  .data_size = 18760 * 3,
+  .header.stride = 280,
+  .data_size = sizeof(img_programs_map),
   .data = img_programs_map,
 };
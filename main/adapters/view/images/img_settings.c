@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_settings.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,294 +24,716 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_SETTINGS uint8_t img_settings_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x72, 0x84, 0xab, 0x4a, 0x6e, 0x63, 0xd0, 0x73, 0xd0, 0x73, 0xd0, 0x73, 0x4e, 0x63, 0x26, 0x19, 0xab, 0x4a, 0xaf, 0x6b, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xd0, 0x73, 0x72, 0x84, 0xfc, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9d, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0xaf, 0x6b, 0xdd, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xdf, 0xec, 0x52, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0xd4, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xde, 0x46, 0x21, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xa7, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8c, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xa7, 0x31, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xe8, 0x31, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xcc, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x73, 0xaf, 0x6b, 0x52, 0x84, 0xf1, 0x73, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xd7, 0x4a, 0x42, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8c, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x15, 0x9d, 0xcc, 0x52, 0xec, 0x52, 0x0d, 0x5b, 0xf5, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0xd0, 0x73, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xcc, 0x52, 0x5a, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xdf, 0x6a, 0x42, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x11, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x96, 0xa5, 0x25, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0x66, 0x21, 0x8b, 0x4a, 0xbb, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x0d, 0x5b, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x6f, 0x6b, 0x1f, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xdf, 0x6b, 0x42, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x52, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xbd, 0x87, 0x29, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x4a, 0x42, 0x29, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8c, 0x29, 0x3a, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x21, 0xd5, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xdf, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x73, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xce, 0x0d, 0x5b, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xd6, 0x10, 0x7c, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x2a, 0x42, 0x77, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xdf, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x94, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x84, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x21, 0xec, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xbe, 0xaf, 0x73, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x8f, 0x6b, 0x3e, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xd7, 0xcc, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xd5, 0x8c, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x94, 0x46, 0x21, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0x29, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xad, 0x8b, 0x4a, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x15, 0x9d, 0x7d, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xc6, 0x15, 0x95, 0x11, 0x74, 0x31, 0x7c, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6a, 0x42, 0x8f, 0x6b, 0xf1, 0x73, 0x73, 0x84, 0xf8, 0xb5, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xad, 0x29, 0x3a, 0xe4, 0x10, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0xd4, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xe7, 0xd4, 0x94, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x87, 0x29, 0xf8, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xdf, 0x19, 0xb6, 0x51, 0x7c, 0x4e, 0x63, 0x49, 0x42, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xe4, 0x18, 0xe4, 0x18, 0xc4, 0x10, 0x66, 0x29, 0x0d, 0x5b, 0x2d, 0x5b, 0xf8, 0xb5, 0x5d, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xdf, 0xd0, 0x73, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xe8, 0x39, 0x32, 0x84, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xef, 0x52, 0x84, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x6a, 0x4a, 0x7b, 0xc6, 0xff, 0xff, 0x19, 0xbe, 0x31, 0x7c, 0x6e, 0x63, 0x66, 0x21, 0xe5, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xe5, 0x10, 0xe5, 0x18, 0x66, 0x29, 0x4e, 0x63, 0xec, 0x52, 0x13, 0x84, 0x00, 0x00, 0x15, 0x9d, 0x25, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x87, 0x29, 0x11, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x94, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x72, 0x84, 0xd4, 0x94, 0x09, 0x3a, 0xe4, 0x10, 0x04, 0x11, 0xe5, 0x10, 0xe5, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0x05, 0x19, 0xe5, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0xe4, 0x10, 0xa7, 0x29, 0x8f, 0x6b, 0xe8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x87, 0x29, 0x93, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x10, 0xe4, 0x18, 0xe4, 0x18, 0xc4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xac, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6b, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc4, 0x10, 0x08, 0x3a, 0x0d, 0x5b, 0xcf, 0x73, 0xf4, 0x94, 0x14, 0x9d, 0x35, 0xa5, 0x35, 0x9d, 0x14, 0x9d, 0x72, 0x84, 0x6e, 0x63, 0x6a, 0x4a, 0x04, 0x11, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x18, 0xe4, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xab, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x73, 0x09, 0x3a, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x6e, 0x63, 0x14, 0x9d, 0x39, 0xc6, 0x3d, 0xe7, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9e, 0xef, 0xfc, 0xde, 0x39, 0xc6, 0x14, 0x9d, 0x6e, 0x6b, 0x04, 0x19, 0xe4, 0x10, 0xe5, 0x18, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x6a, 0x42, 0x57, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x5a, 0x05, 0x19, 0xe4, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0x51, 0x84, 0x5a, 0xc6, 0x7e, 0xef, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x5d, 0xe7, 0x4d, 0x63, 0x05, 0x19, 0x26, 0x21, 0x93, 0x94, 0x9e, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x7e, 0xef, 0x38, 0xbe, 0x31, 0x84, 0x87, 0x29, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe9, 0x39, 0x57, 0x9d, 0xb8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0xe4, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x31, 0x7c, 0x59, 0xc6, 0xbf, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xf7, 0x2d, 0x63, 0x05, 0x11, 0x05, 0x11, 0xe4, 0x10, 0xe5, 0x10, 0x0c, 0x5b, 0x7e, 0xef, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xf7, 0xbd, 0x2c, 0x63, 0xe4, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0xf5, 0x8c, 0x98, 0xa5, 0xb9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x29, 0x42, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xc7, 0x31, 0x96, 0xad, 0x7e, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb5, 0x05, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x18, 0xb3, 0x94, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x9a, 0xce, 0xaf, 0x73, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xb4, 0x8c, 0x98, 0x9d, 0x98, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x8c, 0x26, 0x21, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x29, 0x42, 0xd7, 0xb5, 0xbf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x73, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0x09, 0x3a, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7a, 0xce, 0x0c, 0x5b, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x11, 0x74, 0x78, 0x9d, 0x97, 0x9d, 0xd8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x94, 0xe5, 0x10, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xf4, 0x9c, 0x9e, 0xef, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x63, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x29, 0x42, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0x55, 0xa5, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4e, 0x5b, 0x98, 0x9d, 0x98, 0x9d, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb4, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xab, 0x52, 0xbb, 0xce, 0xdf, 0xf7, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xa5, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x56, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0x8a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0x57, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x59, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xdf, 0x52, 0x84, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x10, 0x7c, 0x7e, 0xe7, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x2d, 0x63, 0xc4, 0x10, 0xc4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xcc, 0x5a, 0x5e, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x6e, 0x6b, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x37, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x56, 0x9d, 0xe8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x51, 0x84, 0x9f, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x14, 0xa5, 0xc7, 0x39, 0x86, 0x29, 0x51, 0x8c, 0x3d, 0xe7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0xaf, 0x73, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0x37, 0x95, 0x98, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xef, 0xf4, 0x94, 0x25, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x11, 0x7c, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xaf, 0x73, 0xe4, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x29, 0x56, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xce, 0x31, 0x84, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0xab, 0x52, 0x7e, 0xe7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x5d, 0xef, 0xdb, 0xde, 0x7a, 0xce, 0x59, 0xce, 0x59, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0xbb, 0xd6, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xab, 0x52, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x6f, 0x63, 0x0d, 0x5b, 0xec, 0x52, 0x11, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xad, 0x2d, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x09, 0x3a, 0x3d, 0xe7, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x96, 0xad, 0x2d, 0x63, 0x87, 0x29, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0xec, 0x5a, 0x96, 0xb5, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x67, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8f, 0x6b, 0xcc, 0x52, 0xac, 0x4a, 0x4e, 0x63, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xb5, 0xcc, 0x52, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0xb1, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xce, 0x29, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x19, 0x59, 0xc6, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0x56, 0xad, 0x05, 0x19, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x52, 0x8c, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x73, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x85, 0x2d, 0x5b, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0x97, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa6, 0xec, 0x5a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0xf0, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xdf, 0x10, 0x7c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xf0, 0x7b, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x6a, 0x4a, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xc4, 0x10, 0x72, 0x8c, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf0, 0x7b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0xf5, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x5b, 0xe8, 0x31, 0x26, 0x19, 0x26, 0x19, 0x06, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0x74, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0xec, 0x52, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x31, 0x7c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xbb, 0xd6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xb3, 0x94, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0xc8, 0x39, 0x9a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x66, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0xf5, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbe, 0xec, 0x52, 0x46, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xb0, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xa5, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0xd0, 0x73, 0x00, 0x00, 0x72, 0x8c, 0x66, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xd0, 0x7b, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x2d, 0x63, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0xd7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xa5, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x29, 0x3a, 0x5a, 0xc6, 0xff, 0xe7, 0x72, 0x84, 0x4a, 0x42, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6a, 0x42, 0x5d, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xce, 0xec, 0x5a, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0xc8, 0x31, 0x4d, 0x63, 0xa7, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x19, 0xfc, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x0d, 0x63, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xa7, 0x29, 0x0d, 0x5b, 0xf0, 0x73, 0xf1, 0x73, 0xaf, 0x6b, 0x8f, 0x6b, 0xd0, 0x6b, 0x2d, 0x5b, 0x8b, 0x4a, 0x05, 0x19, 0xc4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0xd7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x87, 0x31, 0x05, 0x19, 0xe5, 0x10, 0xa7, 0x31, 0x6b, 0x4a, 0xe5, 0x10, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xf0, 0x7b, 0xd0, 0x73, 0x46, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x6e, 0x63, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0x73, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xf0, 0x73, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xaf, 0x73, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x6a, 0x42, 0x93, 0x84, 0x77, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0x76, 0x9d, 0xd0, 0x73, 0xe8, 0x31, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x9b, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfb, 0xde, 0x35, 0xa5, 0x66, 0x29, 0xe4, 0x10, 0xc4, 0x10, 0xc4, 0x10, 0x32, 0x7c, 0x0d, 0x5b, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0xf4, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xad, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x39, 0xbe, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x11, 0x05, 0x19, 0x25, 0x19, 0x4e, 0x63, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xd8, 0xad, 0xb8, 0xad, 0x94, 0x84, 0xc8, 0x31, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x29, 0x42, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x38, 0xc6, 0xcb, 0x5a, 0x83, 0x08, 0xc4, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0xc4, 0x10, 0xc4, 0x10, 0xab, 0x4a, 0x36, 0x9d, 0x0d, 0x5b, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xc6, 0xcb, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x5e, 0xef, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x11, 0x7c, 0xb9, 0xa5, 0xb9, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb9, 0xa5, 0xb9, 0xa5, 0xb8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xb9, 0xad, 0xb8, 0xa5, 0x77, 0x9d, 0x2e, 0x5b, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x72, 0x8c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xd7, 0xbd, 0xab, 0x52, 0xc4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0xc4, 0x10, 0xc4, 0x10, 0xd5, 0x94, 0x77, 0xad, 0x4a, 0x4a, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8f, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x52, 0x84, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x0c, 0x5b, 0xbf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xcf, 0x7b, 0x04, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x53, 0x84, 0xb9, 0xa5, 0xb9, 0xa5, 0xb9, 0xa5, 0xb9, 0xa5, 0xb8, 0xad, 0xd8, 0xad, 0xd9, 0xad, 0x1a, 0xb6, 0xbb, 0xde, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xad, 0xd9, 0xad, 0xb9, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x0d, 0x5b, 0xe4, 0x10, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x76, 0xad, 0xc8, 0x39, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0xc4, 0x10, 0xa4, 0x10, 0xb0, 0x6b, 0x98, 0xad, 0x93, 0x8c, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x67, 0x21, 0xb4, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x9c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6a, 0x4a, 0xab, 0x52, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0xd3, 0x94, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x05, 0x19, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6f, 0x63, 0xb8, 0xa5, 0xb8, 0xa5, 0xb9, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x57, 0xa5, 0xe8, 0x31, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x6e, 0x6b, 0xdf, 0xf7, 0xbb, 0xd6, 0x51, 0x8c, 0x66, 0x21, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0x8b, 0x4a, 0xb4, 0x8c, 0x98, 0xa5, 0xff, 0xff, 0xf0, 0x73, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6a, 0x4a, 0xdb, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb5, 0x6a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0x59, 0xae, 0x86, 0x29, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0xd8, 0xb5, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0x05, 0x19, 0xe4, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xc8, 0x31, 0x98, 0xa5, 0xb9, 0xa5, 0xb8, 0xa5, 0x98, 0x9d, 0x98, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0xb3, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x29, 0x42, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x18, 0x87, 0x29, 0xb0, 0x6b, 0x15, 0x8d, 0x77, 0x9d, 0x77, 0x95, 0xb8, 0xa5, 0x00, 0x00, 0xf8, 0xbd, 0x6e, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xf1, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7c, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x31, 0x4e, 0x63, 0x00, 0x00, 0x4a, 0x4a, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x59, 0xc6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x86, 0x29, 0xe5, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe5, 0x18, 0x12, 0x74, 0x99, 0xa5, 0x98, 0x9d, 0x77, 0x9d, 0x57, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xad, 0xd8, 0xad, 0x6a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x08, 0x3a, 0xf1, 0x73, 0x57, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb7, 0xa5, 0x00, 0x00, 0xbb, 0xae, 0x97, 0xa5, 0x4a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0xfe, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x7c, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x8f, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xe5, 0x18, 0xe5, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0x16, 0x95, 0x98, 0x9d, 0x57, 0x95, 0xf5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcc, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x6a, 0x42, 0x72, 0x7c, 0x56, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xd8, 0x9d, 0x3a, 0xae, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xad, 0x93, 0x8c, 0xc8, 0x31, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x4e, 0x63, 0xb8, 0xad, 0x7a, 0xd6, 0xd9, 0xbd, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x9a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x05, 0x19, 0xe5, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0x87, 0x29, 0x78, 0x9d, 0x58, 0x9d, 0x98, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x4a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xc8, 0x31, 0x2e, 0x5b, 0xb4, 0x8c, 0x97, 0xa5, 0x98, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xd8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xad, 0xcc, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x29, 0xfe, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x4e, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0x36, 0x9d, 0x97, 0xa5, 0x00, 0x00, 0x14, 0x95, 0xa7, 0x31, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x05, 0x19, 0xe5, 0x18, 0xe5, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xa8, 0x31, 0x57, 0x9d, 0x36, 0x95, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x52, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x6b, 0x42, 0xf0, 0x73, 0xd4, 0x8c, 0x57, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x98, 0x9d, 0x98, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb9, 0xa5, 0xf9, 0xad, 0xbb, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb5, 0x97, 0x9d, 0x29, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x86, 0x29, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xde, 0x0d, 0x5b, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x11, 0x74, 0x77, 0x9d, 0x97, 0xa5, 0x00, 0x00, 0x72, 0x84, 0x87, 0x29, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0xe4, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xc4, 0x10, 0x36, 0x95, 0x57, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x84, 0x0d, 0x5b, 0x0d, 0x53, 0x2e, 0x5b, 0x6f, 0x63, 0xd1, 0x6b, 0x53, 0x7c, 0x16, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x78, 0x9d, 0x97, 0x9d, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xd9, 0xad, 0xbb, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xad, 0x4e, 0x63, 0x26, 0x21, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4e, 0x5b, 0x36, 0x95, 0xf9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x84, 0x2e, 0x63, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x06, 0x19, 0xc8, 0x31, 0x56, 0x9d, 0x77, 0xa5, 0xd8, 0xad, 0x00, 0x00, 0x56, 0x9d, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xc4, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe4, 0x10, 0xc4, 0x10, 0xf1, 0x73, 0xb8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x7c, 0x94, 0x7c, 0xd5, 0x84, 0xf6, 0x8c, 0x16, 0x8d, 0x36, 0x95, 0x57, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x97, 0x9d, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xd8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xda, 0xbd, 0x6b, 0x4a, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xab, 0x4a, 0xf4, 0x8c, 0x98, 0xa5, 0xb8, 0xa5, 0xfb, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xb5, 0xb8, 0xad, 0xb3, 0x8c, 0xe8, 0x39, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x11, 0x74, 0x77, 0x9d, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x7a, 0xce, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc8, 0x39, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x10, 0xe5, 0x10, 0x66, 0x21, 0xd8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x95, 0xb4, 0x84, 0xf6, 0x8c, 0xf6, 0x8c, 0x16, 0x95, 0x36, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x97, 0x9d, 0x97, 0xa5, 0xb8, 0xa5, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xb6, 0xd0, 0x73, 0xa7, 0x29, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x29, 0x11, 0x7c, 0x77, 0x9d, 0x98, 0xa5, 0xb8, 0xa5, 0xd8, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x77, 0xa5, 0x97, 0xad, 0x97, 0xa5, 0x2d, 0x5b, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xc8, 0x31, 0x57, 0x9d, 0x97, 0x9d, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x94, 0xe4, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x10, 0xe4, 0x10, 0xab, 0x52, 0xfb, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xce, 0x5b, 0xbe, 0x78, 0xa5, 0x37, 0x9d, 0x16, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0xa5, 0x97, 0xa5, 0xb8, 0xad, 0xd8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x52, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0xf5, 0x94, 0x77, 0xa5, 0x77, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xd9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xa5, 0x77, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x73, 0x84, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x6e, 0x63, 0x97, 0xa5, 0x97, 0x9d, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0x76, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x04, 0x19, 0xe4, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0xe4, 0x10, 0xe4, 0x18, 0x05, 0x19, 0xac, 0x4a, 0xd6, 0x9c, 0x7a, 0xd6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xce, 0xdd, 0xce, 0xfd, 0xce, 0xfd, 0xd6, 0xfd, 0xd6, 0xfd, 0xce, 0xff, 0xff, 0x1f, 0xc6, 0x7a, 0xd6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x7b, 0x46, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0x52, 0x7c, 0x36, 0x9d, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0xa5, 0x98, 0xa5, 0xb9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb5, 0x77, 0xa5, 0xb8, 0xa5, 0xd9, 0xa5, 0xb8, 0xa5, 0xec, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0xf5, 0x94, 0x97, 0x9d, 0x77, 0x9d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x51, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x8c, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x18, 0x09, 0x3a, 0xec, 0x52, 0x52, 0x7c, 0x72, 0x7c, 0x72, 0x7c, 0x52, 0x7c, 0xf1, 0x73, 0xd0, 0x6b, 0x6e, 0x5b, 0x0c, 0x53, 0x0c, 0x53, 0xcc, 0x4a, 0xab, 0x4a, 0x4a, 0x3a, 0x09, 0x32, 0xc8, 0x29, 0xa7, 0x29, 0xa7, 0x29, 0xe9, 0x31, 0x6a, 0x42, 0xc7, 0x29, 0x4e, 0x5b, 0x15, 0x95, 0xb8, 0xa5, 0x1a, 0xb6, 0xbc, 0xc6, 0xfd, 0xce, 0xfd, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x29, 0x3a, 0x15, 0x95, 0x56, 0x9d, 0x56, 0x9d, 0x56, 0x9d, 0x77, 0xa5, 0x97, 0xa5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb5, 0xb8, 0xa5, 0xb8, 0x9d, 0xf9, 0xad, 0x8f, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xe9, 0x39, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8a, 0x4a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0xaa, 0x52, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x67, 0x21, 0x0d, 0x53, 0x93, 0x84, 0x7b, 0xbe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0x16, 0x95, 0x56, 0x9d, 0x56, 0x9d, 0x56, 0x9d, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa5, 0x7b, 0xc6, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x90, 0x6b, 0x98, 0xa5, 0x97, 0xa5, 0xda, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x5d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x05, 0x19, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x06, 0x19, 0x09, 0x3a, 0x2e, 0x5b, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x8c, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xb0, 0x6b, 0x97, 0xa5, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x9d, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x15, 0x95, 0x97, 0xa5, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0xa7, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x18, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0x08, 0x3a, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0xc8, 0x31, 0xcc, 0x52, 0x7a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0xb8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xf0, 0x73, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0x97, 0xa5, 0x77, 0xa5, 0xb8, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x39, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xf0, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0xae, 0x73, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x4a, 0x42, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8f, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xd6, 0xe8, 0x39, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xf0, 0x73, 0x97, 0xa5, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x5d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x18, 0xbe, 0x29, 0x42, 0xc4, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x29, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x94, 0xa7, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x2a, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xa5, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xd4, 0x8c, 0x97, 0xa5, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x73, 0x66, 0x21, 0x05, 0x19, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x04, 0x19, 0x55, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x9a, 0xd6, 0x55, 0xad, 0x30, 0x84, 0x8e, 0x6b, 0x49, 0x4a, 0x8b, 0x4a, 0xe8, 0x31, 0x0d, 0x5b, 0xaf, 0x6b, 0xcf, 0x73, 0xcf, 0x73, 0xcf, 0x73, 0xcf, 0x73, 0xcf, 0x73, 0xcf, 0x73, 0xaf, 0x6b, 0xcf, 0x73, 0xcf, 0x73, 0xcf, 0x73, 0xcf, 0x73, 0xcf, 0x73, 0xaf, 0x6b, 0x8a, 0x4a, 0x29, 0x3a, 0x45, 0x19, 0xe4, 0x10, 0x04, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0x2a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x29, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x77, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x42, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe8, 0x39, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xbf, 0xf7, 0x5d, 0xe7, 0x18, 0xbe, 0x4d, 0x63, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xed, 0x5a, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x5a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0xb7, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0x97, 0xa5, 0x77, 0xa5, 0xb8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x63, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x76, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x5d, 0xe7, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xce, 0x6e, 0x6b, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x29, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x51, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xdf, 0xab, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4e, 0x63, 0x97, 0xa5, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa6, 0x29, 0x3a, 0xe5, 0x10, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0xa7, 0x31, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xab, 0x52, 0xa3, 0x08, 0xe4, 0x18, 0x10, 0x84, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x96, 0xb5, 0x25, 0x21, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x67, 0x21, 0x1b, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x84, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x08, 0x3a, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x72, 0x84, 0x77, 0xa5, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0x05, 0x19, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0xcf, 0x73, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x26, 0x21, 0xe4, 0x10, 0xc4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0x29, 0x42, 0x1c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0x6a, 0x4a, 0xe5, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xac, 0x4a, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5d, 0xd7, 0x76, 0x9d, 0x93, 0x84, 0xb3, 0x84, 0xb3, 0x84, 0xf4, 0x8c, 0x35, 0x95, 0xb3, 0x84, 0x55, 0x95, 0x18, 0xae, 0x00, 0x00, 0xd7, 0xad, 0x87, 0x29, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xd4, 0x94, 0x77, 0xa5, 0x76, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xad, 0xab, 0x4a, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x55, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x6a, 0x4a, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xec, 0x5a, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x8e, 0x6b, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x2a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x6f, 0x63, 0x56, 0x95, 0x97, 0x9d, 0x97, 0xa5, 0x98, 0xa5, 0xb8, 0xad, 0xb8, 0xa5, 0x32, 0x7c, 0x09, 0x2a, 0x47, 0x21, 0xc4, 0x08, 0xb8, 0xad, 0x3f, 0xe7, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0xd8, 0xb5, 0x0d, 0x5b, 0x66, 0x21, 0x66, 0x21, 0x67, 0x29, 0x86, 0x29, 0x86, 0x21, 0x86, 0x21, 0x86, 0x29, 0xa7, 0x29, 0xa7, 0x29, 0x05, 0x19, 0x87, 0x29, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x21, 0x56, 0xa5, 0x56, 0x9d, 0x57, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xad, 0x36, 0x9d, 0xa7, 0x29, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xc4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0x9a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xcf, 0x73, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x67, 0x21, 0x4e, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x42, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe4, 0x10, 0x46, 0x21, 0xec, 0x5a, 0xde, 0xd6, 0x00, 0x00, 
-  0x7b, 0xc6, 0x29, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x09, 0x3a, 0x77, 0xa5, 0x56, 0x9d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xa5, 0x97, 0xa5, 0x32, 0x7c, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x66, 0x21, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xc4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x39, 0xc6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x31, 0x84, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x67, 0x21, 0xed, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x11, 0x7c, 0xff, 0xff, 
-  0xb3, 0x94, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xac, 0x52, 0x97, 0xa5, 0x76, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x77, 0xa5, 0x77, 0x9d, 0xb0, 0x6b, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0xc4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x66, 0x21, 0x3d, 0xe7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xaf, 0x73, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0x3f, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x7b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0x7b, 0xc6, 
-  0x8a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x4e, 0x63, 0x97, 0xa5, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x9d, 0x36, 0x9d, 0x57, 0x9d, 0x4a, 0x42, 0xe4, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x92, 0x8c, 0x9f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xab, 0x52, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x15, 0x9d, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x6a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x4e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0xb7, 0xad, 
-  0x4e, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x2d, 0x5b, 0x77, 0xa5, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x94, 0x56, 0x9d, 0x56, 0x9d, 0x6a, 0x42, 0xe5, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xcb, 0x52, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x08, 0x3a, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x2d, 0x63, 0x9f, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x29, 0x42, 0x57, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0xa7, 0x29, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x11, 0x76, 0xa5, 
-  0xaf, 0x73, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0xf0, 0x73, 0x76, 0xa5, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x15, 0x95, 0x77, 0x9d, 0x36, 0x9d, 0x2a, 0x42, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x31, 0x84, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xef, 0x15, 0xa5, 0x4d, 0x63, 0xcf, 0x7b, 0x76, 0xad, 0x7e, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9c, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x52, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb6, 0x09, 0x3a, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6b, 0x42, 
-  0xec, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x32, 0x7c, 0x77, 0xa5, 0xb7, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9d, 0x36, 0x9d, 0x77, 0x9d, 0x56, 0x9d, 0xac, 0x4a, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0x04, 0x19, 0x31, 0x84, 0x7a, 0xce, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x8b, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0x5b, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x86, 0x21, 
-  0x6f, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x52, 0x7c, 0x77, 0xa5, 0x7a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x9d, 0x36, 0x9d, 0x57, 0x9d, 0x57, 0x9d, 0x6f, 0x63, 0xe5, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0xa7, 0x31, 0x51, 0x84, 0xb7, 0xb5, 0x59, 0xce, 0xbb, 0xd6, 0xfc, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xde, 0x9a, 0xd6, 0x59, 0xce, 0x39, 0xc6, 0x39, 0xc6, 0xf8, 0xbd, 0xd7, 0xb5, 0x76, 0xad, 0x56, 0xad, 0x55, 0xa5, 0x15, 0xa5, 0x35, 0xa5, 0x76, 0xad, 0x18, 0xbe, 0x9a, 0xd6, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x73, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x21, 
-  0x6e, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x52, 0x7c, 0x77, 0xa5, 0x7a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8c, 0x36, 0x9d, 0x57, 0x9d, 0x57, 0x9d, 0x52, 0x84, 0xa7, 0x29, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0xe4, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x4d, 0x63, 0xd7, 0xbd, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6e, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 
-  0x0d, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x11, 0x7c, 0x97, 0xad, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x94, 0x36, 0x9d, 0x56, 0x9d, 0x56, 0x9d, 0x35, 0x95, 0x4e, 0x63, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x04, 0x11, 0xe4, 0x10, 0xa7, 0x31, 0xb7, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xad, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0x3a, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd7, 0x66, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 
-  0x0d, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x06, 0x19, 0xd0, 0x6b, 0x97, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8c, 0x15, 0x95, 0x36, 0x9d, 0x57, 0x9d, 0x97, 0x9d, 0xd5, 0x8c, 0xab, 0x4a, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0x04, 0x11, 0x04, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x8e, 0x73, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x26, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0x73, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xc6, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x86, 0x21, 
-  0x2d, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xe4, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x4e, 0x63, 0x97, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x85, 0x15, 0x95, 0x36, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x77, 0x9d, 0xd4, 0x84, 0x0d, 0x53, 0x25, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xc6, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 
-  0xcc, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0xed, 0x5a, 0xb7, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x9d, 0x36, 0x9d, 0x77, 0x9d, 0x78, 0x9d, 0x78, 0x9d, 0x98, 0x9d, 0x36, 0x95, 0x52, 0x7c, 0xed, 0x52, 0x26, 0x19, 0xe5, 0x10, 0x05, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0x9b, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb5, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 
-  0xec, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x29, 0x42, 0xb7, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x9d, 0x16, 0x95, 0x57, 0x95, 0x78, 0x9d, 0x98, 0x9d, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x57, 0x9d, 0xb4, 0x8c, 0x11, 0x74, 0x8f, 0x6b, 0x4e, 0x5b, 0x0d, 0x5b, 0xec, 0x52, 0xab, 0x4a, 0x6a, 0x42, 0x09, 0x3a, 0xc8, 0x31, 0x87, 0x29, 0x67, 0x21, 0x67, 0x21, 0x67, 0x21, 0x67, 0x21, 0x67, 0x21, 0x67, 0x21, 0xc8, 0x31, 0x2a, 0x3a, 0x6a, 0x42, 0x09, 0x32, 0x87, 0x29, 0x05, 0x11, 0xe5, 0x18, 0x05, 0x19, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0x5d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0xc4, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x21, 0xb3, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xad, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 
-  0xe8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x87, 0x29, 0x76, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x9d, 0x78, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0xd5, 0x8c, 0xac, 0x4a, 0x05, 0x11, 0xe5, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x10, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x09, 0x3a, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xaf, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x21, 
-  0x09, 0x3a, 0xe5, 0x10, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x04, 0x19, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xe5, 0x18, 0x15, 0x9d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7a, 0xd6, 0xd8, 0xad, 0xb9, 0xa5, 0xb8, 0xad, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xa5, 0xd0, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xec, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x84, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe9, 0x31, 0x56, 0x9d, 
-  0x50, 0x6b, 0x87, 0x29, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x04, 0x19, 0xe4, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x31, 0x84, 0xfb, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xc6, 0xd8, 0xad, 0xd8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xb8, 0xa5, 0x73, 0x84, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4d, 0x63, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x7b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xf1, 0x73, 0xd9, 0xad, 
-  0x00, 0x00, 0x2e, 0x5b, 0x0d, 0x5b, 0xac, 0x4a, 0xac, 0x4a, 0x8b, 0x4a, 0x8b, 0x4a, 0x8b, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x8a, 0x42, 0xab, 0x4a, 0xab, 0x4a, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0xb8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xae, 0xf9, 0xb5, 0xd8, 0xad, 0xd8, 0xad, 0xf8, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xd9, 0xad, 0xd9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0xf9, 0xad, 0x1a, 0xb6, 0x59, 0xbe, 0x39, 0xb6, 0x38, 0xbe, 0x1c, 0xc6, 0xf9, 0xb5, 0xd8, 0xad, 0xd8, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xa5, 0x98, 0xa5, 0x4e, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xe5, 0x18, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xad, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xcc, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xdf, 0x6a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x29, 0x09, 0x3a, 0x09, 0x32, 0x09, 0x32, 0x09, 0x32, 0x29, 0x3a, 0x4a, 0x3a, 0x4a, 0x3a, 0x4a, 0x3a, 0x4a, 0x42, 0x6a, 0x42, 0x4a, 0x3a, 0xb0, 0x6b, 0xb8, 0xad, 0xb8, 0xad, 
-  0x00, 0x00, 0x00, 0x00, 0x78, 0xa5, 0x57, 0x9d, 0x57, 0x9d, 0x57, 0x9d, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0xb7, 0xa5, 0xd8, 0xad, 0x4a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x2a, 0x42, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x59, 0xae, 0xd9, 0xa5, 0x98, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0x56, 0x9d, 0x87, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xb7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0xf8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbe, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8f, 0x6b, 0x77, 0xa5, 0x77, 0xa5, 0x77, 0x9d, 0x77, 0x9d, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 
-  0x00, 0x00, 0x00, 0x00, 0xf7, 0xad, 0x37, 0x9d, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0x4a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x8f, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3e, 0xdf, 0x5e, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xad, 0xd9, 0xad, 0xab, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x72, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0xd8, 0xb5, 0x38, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x9d, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x11, 0x74, 0x77, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0xd8, 0xad, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xa5, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0xb8, 0xad, 0xed, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xcc, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x75, 0xad, 0x11, 0x74, 0x4e, 0x63, 0x2d, 0x5b, 0xe8, 0x31, 0x0d, 0x53, 0xec, 0x52, 0x6e, 0x6b, 0x16, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xaf, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0xd8, 0xad, 0xd8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xd4, 0x8c, 0x77, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0xb8, 0xad, 0x97, 0xad, 0x97, 0xad, 0x77, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0xb0, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0xec, 0x52, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0xdf, 0xbc, 0xce, 0x36, 0x9d, 0x11, 0x74, 0x8b, 0x4a, 0x87, 0x21, 0x46, 0x19, 0x46, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x6e, 0x63, 0x1f, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x45, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc7, 0x31, 0xb7, 0xb5, 0xd8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe7, 0x0d, 0x5b, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x57, 0x9d, 0x97, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0x77, 0xa5, 0x57, 0xa5, 0x57, 0xa5, 0x57, 0xa5, 0x77, 0xa5, 0x36, 0x9d, 0x97, 0xa5, 0xdb, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x29, 0x42, 0x7b, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xce, 0xd4, 0x94, 0x72, 0x84, 0xd0, 0x73, 0x09, 0x3a, 0xa8, 0x29, 0x87, 0x21, 0x67, 0x21, 0x46, 0x19, 0x46, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0xe8, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb5, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x49, 0x42, 0xd8, 0xb5, 0xf8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbe, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0x97, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x72, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x31, 0x84, 0xb0, 0x6b, 0xab, 0x4a, 0xc8, 0x29, 0xa8, 0x29, 0xa8, 0x21, 0x87, 0x21, 0x87, 0x21, 0x67, 0x21, 0x47, 0x19, 0x46, 0x19, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x52, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x84, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xd0, 0x73, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xa5, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x11, 0xec, 0x52, 0xd8, 0xad, 0x5a, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x9c, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xb0, 0x6b, 0x98, 0xa5, 0x97, 0xa5, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x5b, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xd0, 0x73, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xd7, 0xfd, 0xce, 0xb4, 0x8c, 0x6e, 0x63, 0x4e, 0x63, 0xec, 0x52, 0x09, 0x3a, 0xc8, 0x29, 0xa8, 0x29, 0xa8, 0x29, 0xa8, 0x21, 0x88, 0x21, 0x87, 0x21, 0x87, 0x21, 0x67, 0x19, 0x46, 0x19, 0x26, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xab, 0x4a, 0x3e, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xb3, 0x94, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x8c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x10, 0x7c, 0xd8, 0xb5, 0x39, 0xbe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xdf, 0x6e, 0x63, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0xf5, 0x94, 0x98, 0xa5, 0x98, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x94, 0xa8, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x87, 0x29, 0xf9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xd6, 0x72, 0x84, 0x8a, 0x4a, 0x66, 0x29, 0x25, 0x21, 0x45, 0x21, 0x66, 0x21, 0x86, 0x21, 0x87, 0x21, 0x87, 0x21, 0x87, 0x21, 0x87, 0x21, 0x88, 0x21, 0x87, 0x21, 0x67, 0x19, 0x47, 0x19, 0x46, 0x19, 0x06, 0x11, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x93, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xe7, 0x6a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xd8, 0xb5, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x31, 0x84, 0xd7, 0xb5, 0x19, 0xbe, 0xdd, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb6, 0x67, 0x21, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x09, 0x3a, 0x98, 0xa5, 0xb8, 0xa5, 0xf8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x73, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xa5, 0xe4, 0x18, 0xe4, 0x10, 0x04, 0x11, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x46, 0x11, 0x46, 0x19, 0x46, 0x19, 0x47, 0x19, 0x67, 0x19, 0x87, 0x19, 0x67, 0x19, 0x47, 0x19, 0x26, 0x19, 0x11, 0x74, 0xf8, 0xb5, 0x3d, 0xdf, 0x14, 0x9d, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0xbc, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xb6, 0x66, 0x21, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x11, 0xfc, 0xd6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe8, 0x39, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xf4, 0x94, 0xd8, 0xb5, 0x39, 0xbe, 0xdd, 0xde, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xe7, 0x32, 0x7c, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0xac, 0x52, 0xd8, 0xad, 0xd8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x8b, 0x4a, 0xdc, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xa5, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0x47, 0x11, 0xa8, 0x21, 0x52, 0x84, 0xf8, 0xbd, 0x7e, 0xe7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0x5d, 0xe7, 0x66, 0x29, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x32, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x29, 0x3a, 0x9f, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0xb7, 0xad, 0xd7, 0xad, 0x19, 0xbe, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xce, 0xe8, 0x31, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x66, 0x21, 0x16, 0x95, 0xd9, 0xad, 0xf9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9d, 0x29, 0x3a, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x93, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xad, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x08, 0xc8, 0x31, 0xb3, 0x8c, 0x7a, 0xc6, 0xbf, 0xef, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xf3, 0x9c, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa8, 0x31, 0x77, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xb5, 0x29, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x55, 0xa5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0xd8, 0xad, 0xd8, 0xad, 0x19, 0xb6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x15, 0x95, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x8f, 0x6b, 0x97, 0xa5, 0xf9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x6e, 0x63, 0x66, 0x21, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xab, 0x4a, 0xdc, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xd6, 0xc8, 0x31, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0x92, 0x8c, 0xfc, 0xde, 0xbf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x29, 0x42, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0xd8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xbd, 0x6e, 0x63, 0x04, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xa8, 0x21, 0x7e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6a, 0x42, 0xf8, 0xb5, 0xd8, 0xad, 0x9b, 0xce, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xd6, 0xac, 0x4a, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xa7, 0x29, 0xac, 0x4a, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x15, 0x9d, 0x6a, 0x42, 0x46, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x15, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x4a, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xf4, 0x9c, 0xbf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xc4, 0x10, 0xe4, 0x18, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xab, 0x52, 0xd4, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x94, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x93, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x5a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x2d, 0x63, 0xff, 0xff, 0x1d, 0xd7, 0xfd, 0xd6, 0x00, 0x00, 0xff, 0xd7, 0xd4, 0x8c, 0x46, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0x31, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xd6, 0x52, 0x84, 0xc8, 0x31, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xcc, 0x52, 0xbb, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x6b, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xcc, 0x5a, 0xbf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x51, 0x8c, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0xab, 0x4a, 0x32, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xad, 0x0d, 0x5b, 0x08, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x21, 0xdc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xa7, 0x29, 0x55, 0x9d, 0x1b, 0xc6, 0xfc, 0xd6, 0xdc, 0xd6, 0xff, 0xde, 0xbc, 0xc6, 0x8b, 0x4a, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xf4, 0x94, 0x0c, 0x5b, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0xb0, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xbd, 0xa7, 0x31, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xc4, 0x10, 0xbb, 0xd6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x2d, 0x63, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x67, 0x29, 0x6a, 0x42, 0x6f, 0x63, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9d, 0x0d, 0x5b, 0x6a, 0x42, 0x45, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xb7, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x4e, 0x5b, 0xf8, 0xad, 0x19, 0xb6, 0xfd, 0xd6, 0xfd, 0xd6, 0x3c, 0xd7, 0xd4, 0x94, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x29, 0x3a, 0xcc, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xc6, 0x4e, 0x63, 0x26, 0x21, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x21, 0x55, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0x31, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0x6a, 0x4a, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x46, 0x21, 0x09, 0x3a, 0x09, 0x3a, 0xec, 0x52, 0x29, 0x42, 0xa8, 0x31, 0xa7, 0x29, 0xab, 0x4a, 0x29, 0x3a, 0x26, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0xf4, 0x9c, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xa7, 0x31, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x73, 0x84, 0xd8, 0xad, 0x7a, 0xbe, 0xfd, 0xd6, 0xdc, 0xd6, 0x5a, 0xbe, 0xc8, 0x31, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0x6b, 0x4a, 0xda, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xdf, 0x8f, 0x6b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xab, 0x4a, 0x1c, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x94, 0x46, 0x21, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x25, 0x21, 0x1d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x29, 0x42, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x52, 0x8c, 0x9f, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xa5, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x6a, 0x42, 0xb8, 0xad, 0xd8, 0xad, 0xbb, 0xce, 0xfd, 0xd6, 0xfc, 0xce, 0xd0, 0x73, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x9d, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x52, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xb3, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0x72, 0x8c, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x72, 0x8c, 0xbf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0x86, 0x29, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xf1, 0x73, 0xb8, 0xad, 0xd8, 0xb5, 0x1d, 0xd7, 0xfd, 0xd6, 0xf4, 0x94, 0x25, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa8, 0x31, 0x9c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x66, 0x21, 0x35, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x63, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x1d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xce, 0x2d, 0x63, 0xc4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x4a, 0x42, 0xf8, 0xbd, 0xbf, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x8c, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x87, 0x29, 0x77, 0xa5, 0x98, 0xa5, 0x5a, 0xbe, 0x1d, 0xd7, 0x5a, 0xbe, 0xa7, 0x29, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0xf5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x2a, 0x42, 0xdc, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0xe5, 0x18, 0x31, 0x84, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0x92, 0x94, 0xc7, 0x31, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x46, 0x19, 0xf0, 0x73, 0x19, 0xbe, 0xbf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xf0, 0x73, 0x97, 0xa5, 0x97, 0xa5, 0xfd, 0xd6, 0xfd, 0xd6, 0xed, 0x52, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x8f, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0x46, 0x21, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xba, 0xd6, 0x96, 0xad, 0x92, 0x8c, 0x51, 0x84, 0x51, 0x84, 0x51, 0x84, 0x31, 0x84, 0x8f, 0x6b, 0xec, 0x52, 0x0d, 0x5b, 0xcf, 0x73, 0xd3, 0x94, 0x39, 0xc6, 0x5e, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x6a, 0x4a, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x6a, 0x42, 0x56, 0xa5, 0x97, 0xa5, 0xd8, 0xad, 0x3e, 0xdf, 0x32, 0x7c, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x4e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x7c, 0x87, 0x29, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x46, 0x21, 0xf0, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6b, 0x05, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x08, 0x3a, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x10, 0x84, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x21, 0xb4, 0x8c, 0x77, 0xa5, 0x97, 0xa5, 0xbc, 0xce, 0x35, 0x9d, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xed, 0x52, 0xb8, 0xa5, 0xda, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x63, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0x46, 0x21, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb5, 0xa7, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x10, 0x7c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xd7, 0xb5, 0x10, 0x84, 0x92, 0x8c, 0x9b, 0xce, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x14, 0xa5, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x26, 0x19, 0xd0, 0x73, 0x56, 0xa5, 0x77, 0xa5, 0xd9, 0xb5, 0x15, 0x95, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0x57, 0x9d, 0xb9, 0xa5, 0xd9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x2d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x6b, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x46, 0x21, 0x76, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x6e, 0x6b, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0xb3, 0x94, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x2d, 0x5b, 0x56, 0xa5, 0x57, 0xa5, 0x98, 0xad, 0x56, 0xa5, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x93, 0x84, 0xb8, 0xa5, 0xb8, 0xa5, 0xf9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x63, 0xa7, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x31, 0x4e, 0x63, 0x00, 0x00, 0xff, 0xff, 0xcf, 0x73, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x25, 0x21, 0x25, 0x21, 0x46, 0x21, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x76, 0xad, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xe8, 0x39, 0x36, 0xa5, 0x57, 0xa5, 0x57, 0xa5, 0xaf, 0x6b, 0x05, 0x19, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x21, 0xf2, 0x6b, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x46, 0x21, 0x6a, 0x42, 0xff, 0xff, 0x38, 0xbe, 0x29, 0x42, 0x04, 0x19, 0x04, 0x19, 0x05, 0x19, 0x25, 0x21, 0x25, 0x21, 0xe8, 0x39, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xa7, 0x29, 0x9f, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0x46, 0x29, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0xb3, 0x8c, 0x77, 0xa5, 0x77, 0xa5, 0xaf, 0x73, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0x4e, 0x63, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc8, 0x29, 0x56, 0x9d, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xae, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4e, 0x5b, 0x36, 0x8d, 0x78, 0x95, 0xd5, 0x84, 0x67, 0x21, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x6e, 0x63, 0x10, 0x84, 0x31, 0x84, 0x25, 0x21, 0x04, 0x19, 0x05, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0xc7, 0x39, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0xfc, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x46, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8f, 0x6b, 0x77, 0xa5, 0x56, 0xa5, 0x6e, 0x6b, 0xc3, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0xd5, 0x8c, 0x56, 0x95, 0x72, 0x84, 0x29, 0x3a, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x72, 0x84, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x7c, 0xa7, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x4a, 0x42, 0x94, 0x84, 0xb9, 0x9d, 0xb9, 0x9d, 0x99, 0x95, 0x78, 0x95, 0xb5, 0x84, 0x46, 0x21, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xab, 0x4a, 0x5a, 0xc6, 0xb3, 0x94, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x86, 0x29, 0xb7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xc4, 0x10, 0xc4, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x25, 0x19, 0x1d, 0xe7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xf4, 0x9c, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6a, 0x4a, 0x35, 0xa5, 0x32, 0x84, 0x09, 0x3a, 0xc4, 0x10, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0x15, 0x95, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0xd0, 0x6b, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xab, 0x4a, 0xb8, 0xa5, 0xb8, 0xa5, 0xb9, 0xa5, 0xd9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x66, 0x29, 0x32, 0x74, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb9, 0x9d, 0xd9, 0x9d, 0x98, 0x95, 0x98, 0x95, 0xd5, 0x84, 0x87, 0x29, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x09, 0x3a, 0xaf, 0x73, 0x29, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x45, 0x21, 0x31, 0x84, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x87, 0x31, 0xc4, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0xcf, 0x73, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x2d, 0x63, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x26, 0x21, 0xab, 0x52, 0xa7, 0x31, 0xc4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0xe8, 0x31, 0x15, 0x95, 0x98, 0xa5, 0x98, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0xd4, 0x8c, 0x29, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x29, 0x36, 0x9d, 0xb8, 0xad, 0xb8, 0xad, 0xd8, 0xad, 0xfa, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x42, 0x15, 0x8d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0x98, 0xa5, 0x7a, 0xd6, 0x3b, 0xbe, 0x57, 0x95, 0x78, 0x95, 0xd5, 0x84, 0x87, 0x29, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x21, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x6a, 0x4a, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xce, 0x87, 0x31, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x11, 0x2d, 0x63, 0x5e, 0xe7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0xc7, 0x31, 0x66, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x04, 0x19, 0x04, 0x19, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x18, 0x04, 0x19, 0xe8, 0x31, 0x16, 0x95, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xf9, 0xad, 0x5a, 0xbe, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x56, 0x9d, 0xb0, 0x6b, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x52, 0x84, 0xb8, 0xa5, 0xb8, 0xad, 0xd8, 0xad, 0xd9, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x84, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x6e, 0x63, 0x36, 0x95, 0x77, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0xb8, 0xa5, 0x98, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x95, 0x57, 0x95, 0x77, 0x9d, 0x15, 0x8d, 0xc8, 0x31, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x21, 0x25, 0x21, 0x45, 0x21, 0x92, 0x94, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0xf4, 0x9c, 0xcb, 0x5a, 0x2d, 0x63, 0x55, 0xa5, 0x9e, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0x10, 0x7c, 0x86, 0x29, 0x66, 0x29, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xe4, 0x18, 0xe4, 0x10, 0xe5, 0x10, 0xe5, 0x18, 0x4a, 0x42, 0x15, 0x95, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x3a, 0xbe, 0xff, 0xff, 0x00, 0x00, 0x75, 0x9d, 0x15, 0x95, 0x36, 0x95, 0x56, 0x9d, 0x77, 0x9d, 0xd4, 0x8c, 0xe8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xd0, 0x73, 0x97, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xd8, 0xad, 0x59, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x09, 0x3a, 0x0d, 0x5b, 0x73, 0x84, 0x36, 0x95, 0x57, 0x95, 0x77, 0x9d, 0x78, 0x9d, 0x98, 0xa5, 0x1f, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x9d, 0x77, 0x9d, 0x98, 0x9d, 0x16, 0x95, 0x29, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0xc7, 0x31, 0xd7, 0xb5, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x7d, 0xef, 0x34, 0xa5, 0xc7, 0x31, 0x86, 0x29, 0x66, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0xed, 0x52, 0x36, 0x9d, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xf9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x35, 0x95, 0x36, 0x95, 0x36, 0x95, 0x56, 0x9d, 0x56, 0x9d, 0x32, 0x7c, 0x0d, 0x5b, 0x93, 0x84, 0x77, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0x1a, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xc6, 0xb7, 0xa5, 0x56, 0x9d, 0x56, 0x9d, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xbd, 0x77, 0x9d, 0x97, 0xa5, 0x56, 0x9d, 0xcc, 0x52, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0xab, 0x52, 0xd8, 0xbd, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x55, 0xad, 0x29, 0x42, 0x66, 0x21, 0x66, 0x21, 0x66, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x46, 0x21, 0x11, 0x74, 0x77, 0x9d, 0x77, 0x9d, 0x98, 0xa5, 0x97, 0xa5, 0xd9, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaf, 0x56, 0x9d, 0x36, 0x95, 0x36, 0x9d, 0x77, 0xa5, 0x97, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0xb8, 0xa5, 0xb8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xad, 0x77, 0xa5, 0x97, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xa5, 0xb7, 0xa5, 0xd0, 0x73, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc7, 0x31, 0xf4, 0x9c, 0x7a, 0xce, 0x7e, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5d, 0xef, 0x79, 0xce, 0xb3, 0x94, 0xe8, 0x31, 0x66, 0x21, 0x66, 0x21, 0x66, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x09, 0x3a, 0x57, 0x9d, 0x77, 0x9d, 0x77, 0x9d, 0x77, 0xa5, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x56, 0xa5, 0xb7, 0xad, 0xb8, 0xad, 0x98, 0xad, 0x98, 0xa5, 0xb8, 0xa5, 0xd8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x84, 0x87, 0x29, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xe8, 0x39, 0x8e, 0x73, 0x71, 0x8c, 0x55, 0xad, 0x96, 0xb5, 0xd7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xbb, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x18, 0xc6, 0x96, 0xb5, 0xf4, 0x9c, 0xcf, 0x73, 0xc8, 0x31, 0x26, 0x19, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xb0, 0x6b, 0x77, 0x9d, 0x97, 0xa5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd6, 0x8a, 0x4a, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x21, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x26, 0x21, 0x26, 0x21, 0x46, 0x21, 0x46, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xd0, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x7c, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0xb7, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xa5, 0x29, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x0d, 0x5b, 0x3d, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xc6, 0xed, 0x5a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0xf0, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0x04, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa8, 0x31, 0xd4, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x4a, 0x4a, 0x18, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xbe, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x05, 0x19, 0x09, 0x3a, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x05, 0x19, 0xed, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x84, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x66, 0x21, 0x16, 0x9d, 0xf5, 0x94, 0xb0, 0x6b, 0x09, 0x3a, 0xe4, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x18, 0x09, 0x3a, 0xd0, 0x6b, 0x16, 0x8d, 0x98, 0x9d, 0xac, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x87, 0x29, 0xf8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xb0, 0x6b, 0x77, 0xa5, 0x77, 0x9d, 0x78, 0x9d, 0x98, 0xa5, 0xd5, 0x8c, 0xb0, 0x6b, 0x4b, 0x42, 0xa8, 0x31, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0x0d, 0x5b, 0x31, 0x74, 0x16, 0x95, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0x9d, 0x98, 0xa5, 0x15, 0x95, 0x67, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x4a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0xc8, 0x31, 0x77, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0x77, 0x9d, 0x16, 0x8d, 0xb4, 0x84, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x0d, 0x5b, 0xb4, 0x8c, 0x15, 0x9d, 0x97, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xd9, 0xa5, 0xf9, 0xa5, 0x4d, 0x5b, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xc8, 0x31, 0xd3, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x46, 0x21, 0x6e, 0x63, 0xf9, 0xb5, 0xf9, 0xad, 0x3a, 0xbe, 0xd8, 0xb5, 0x98, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x98, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xb9, 0xa5, 0xa8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x11, 0x74, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x98, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xd8, 0xad, 0xd9, 0xad, 0x3a, 0xbe, 0xd8, 0xad, 0x1a, 0xb6, 0x00, 0x00, 0x6b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x18, 0xe5, 0x18, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0xb4, 0x94, 0x1a, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0d, 0x5b, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x8b, 0x4a, 0x00, 0x00, 0xff, 0xde, 0xdc, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0x19, 0xb6, 0xb8, 0xad, 0xb8, 0xa5, 0xb8, 0xa5, 0xb8, 0xa5, 0xd8, 0xa5, 0xd9, 0xa5, 0xe9, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0xf1, 0x73, 0xb7, 0xa5, 0xb7, 0xad, 0xb7, 0xad, 0xb8, 0xad, 0xb8, 0xb5, 0xda, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x74, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xcb, 0x52, 0xf4, 0x9c, 0x97, 0xad, 0xf8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xad, 0xb8, 0xad, 0xd4, 0x94, 0xec, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x29, 0x42, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5a, 0xc6, 0xbc, 0xce, 0xbc, 0xc6, 0x6a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x8f, 0x6b, 0xd9, 0xad, 0xd9, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x63, 0x25, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xc7, 0x31, 0x31, 0x7c, 0x56, 0xa5, 0x97, 0xad, 0xb7, 0xad, 0xf8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xad, 0x98, 0xa5, 0x97, 0xa5, 0x77, 0xa5, 0x73, 0x84, 0xe8, 0x39, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0xa7, 0x29, 0xb0, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xde, 0x1d, 0xdf, 0xab, 0x52, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x93, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xcc, 0x52, 0xf4, 0x94, 0x76, 0xa5, 0x97, 0xad, 0x97, 0xad, 0xd8, 0xad, 0x59, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x97, 0xa5, 0x97, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x36, 0x9d, 0xec, 0x52, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x2d, 0x5b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xdf, 0xab, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x26, 0x19, 0x26, 0x19, 0x11, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6b, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x21, 0xf0, 0x73, 0x36, 0x9d, 0x76, 0xa5, 0x76, 0xa5, 0x97, 0xad, 0xb7, 0xad, 0xd8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xad, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x77, 0xa5, 0x31, 0x7c, 0x46, 0x21, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xa7, 0x29, 0xad, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xdf, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x4a, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x87, 0x29, 0x93, 0x84, 0x56, 0xa5, 0x77, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0xb7, 0xad, 0xb8, 0xad, 0x7a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xad, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x77, 0xa5, 0xd4, 0x8c, 0x09, 0x3a, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xcc, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xdf, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x26, 0x19, 0x6a, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9c, 0x09, 0x3a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0xf5, 0x94, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0xb7, 0xad, 0xb8, 0xad, 0xd8, 0xad, 0xd9, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb5, 0x97, 0xad, 0x97, 0xad, 0x97, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x35, 0x9d, 0xab, 0x4a, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x19, 0x8b, 0x4a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xdf, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe4, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x2d, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x5b, 0xc8, 0x31, 0x05, 0x19, 0x05, 0x19, 0x66, 0x21, 0x2d, 0x5b, 0x97, 0xa5, 0x97, 0xad, 0x97, 0xad, 0xb7, 0xad, 0xb8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xb5, 0x97, 0xad, 0x97, 0xa5, 0x97, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x77, 0xa5, 0x52, 0x7c, 0x2e, 0x5b, 0xd0, 0x73, 0x96, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xdf, 0x8b, 0x4a, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x6e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x8c, 0xcc, 0x52, 0x46, 0x21, 0xf1, 0x7b, 0xd8, 0xb5, 0xb8, 0xad, 0xb7, 0xad, 0xb7, 0xad, 0xb7, 0xad, 0xb8, 0xad, 0xf9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xae, 0xb8, 0xad, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x97, 0xa5, 0x98, 0xa5, 0xb8, 0xad, 0x19, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xdf, 0xac, 0x4a, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x25, 0x19, 0x25, 0x19, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xb5, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0x7a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xb5, 0x97, 0xad, 0x97, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xf8, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0x8b, 0x4a, 0x05, 0x11, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x25, 0x19, 0xab, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1a, 0xb6, 0x1b, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x63, 0xe5, 0x10, 0x05, 0x11, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x46, 0x19, 0xf0, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x5b, 0x25, 0x19, 0xe5, 0x10, 0xe5, 0x10, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0xab, 0x4a, 0x1c, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x63, 0x6a, 0x42, 0x49, 0x42, 0x29, 0x42, 0xec, 0x5a, 0x2d, 0x63, 0x25, 0x19, 0x05, 0x19, 0x66, 0x21, 0x09, 0x3a, 0x4a, 0x42, 0x87, 0x29, 0x26, 0x19, 0xc8, 0x31, 0x8b, 0x4a, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x55, 0xae, 0xee, 0xff, 0xff, 0xff, 0xeb, 0xc5, 0xd9, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0x9b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x84, 0xb1, 0x4c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0xa3, 0xb6, 0x7f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x87, 0xf2, 0xff, 0xff, 0xff, 0xbb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x62, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x9b, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5f, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x4e, 0x85, 0xca, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xd5, 0xae, 0x5c, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x7d, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x15, 0x49, 0x8e, 0xce, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd6, 0x6c, 0x3c, 0x0b, 0x00, 0x00, 0x00, 0x1b, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x56, 0x01, 0x19, 0x77, 0xe1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x5f, 0x0a, 0x00, 0x84, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xce, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x90, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf5, 0xff, 0xfd, 0xfb, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xf5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe2, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfc, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xfe, 0xf1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf8, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf6, 0xff, 0xd2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xf7, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xae, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xdb, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0xaa, 0x9c, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xfa, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x94, 0xa9, 0x65, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfc, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9b, 0xf7, 0xff, 0xff, 0xff, 0xa9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf1, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x72, 0x03, 0x00, 0x00, 0x03, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x26, 0x00, 0x00, 0x00, 0x26, 0xa5, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x1c, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x17, 0x08, 0x5a, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8d, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xe0, 0xc2, 0xc3, 0xdb, 0xe4, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xba, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf2, 0xff, 0xfd, 0xff, 0xff, 0xfc, 0xeb, 0xe3, 0xeb, 0xe5, 0xcb, 0xb4, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfb, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xe8, 0xd3, 0xcf, 0xee, 0xee, 0xee, 0xd5, 0xae, 0xca, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa2, 0xea, 0xff, 0xff, 0xff, 0xf9, 0xf5, 0xc6, 0xa4, 0xc6, 0xc7, 0xd1, 0xd5, 0xd6, 0xc8, 0xe8, 0xfe, 0xc8, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xda, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xac, 0xdf, 0xff, 0xff, 0xfe, 0xc8, 0x48, 0x20, 0x14, 0x06, 0x00, 0x01, 0x15, 0x24, 0x34, 0x83, 0xce, 0xfc, 0xff, 0xf7, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x44, 0x39, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xe3, 0xff, 0xff, 0xee, 0x6b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x6f, 0xe4, 0xfe, 0xc6, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x01, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x09, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xd4, 0xff, 0xff, 0xcf, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x97, 0xf1, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x6b, 0x00, 0x22, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x23, 0x00, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xd1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x43, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x57, 0x00, 0x06, 0x2a, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x01, 0x00, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xe0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x11, 0x00, 0x00, 0x3d, 0x51, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc9, 0x05, 0x12, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x49, 0x00, 0x00, 0x00, 0x03, 0x43, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xd1, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xd1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xbf, 0x4a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x87, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x90, 0x35, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf2, 0xf5, 0x15, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x6d, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xde, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xbf, 0xb9, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xca, 0x00, 0x00, 0x02, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xc2, 0x50, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xf2, 0xbe, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xec, 0xff, 0x76, 0x00, 0x00, 0x00, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x55, 0xb6, 0xce, 0xda, 0xe4, 0xe5, 0xd4, 0xa7, 0x5d, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe1, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xcc, 0xfc, 0xe3, 0xa6, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xfa, 0xfd, 0x21, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x0a, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x8f, 0xce, 0xf8, 0xf9, 0x68, 0x02, 0x04, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xff, 0xf5, 0x9d, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xc4, 0x01, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x96, 0xad, 0xad, 0xaf, 0xa7, 0x9b, 0x98, 0x93, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x91, 0x9a, 0x8e, 0xa4, 0xf0, 0xeb, 0xf6, 0xf1, 0xd6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf5, 0xff, 0xff, 0xff, 0xf2, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x81, 0xf1, 0xbe, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xc2, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xa9, 0x4c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe8, 0xff, 0xfc, 0xa4, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x9f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xf4, 0xec, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x8b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xd3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x67, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe3, 0xfc, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xfd, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xe1, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf2, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xab, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xdf, 0xfa, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xf6, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0b, 0x1c, 0x2b, 0x2b, 0x2b, 0x30, 0x35, 0x2b, 0x2b, 0x20, 0x00, 0x31, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x54, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3b, 0x2b, 0x2b, 0x2b, 0x3e, 0x09, 0x00, 0x00, 
-  0x02, 0x69, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf1, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xa4, 0x1b, 0x00, 
-  0x65, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf1, 0xec, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x05, 
-  0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf6, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x22, 
-  0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xf7, 0xf6, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 
-  0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xd2, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 
-  0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd4, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf2, 0xf2, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 
-  0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xef, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf0, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xef, 0xe5, 0xff, 0xff, 0xf1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe7, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xbb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xd9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xe3, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb2, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf7, 0xeb, 0xf3, 0xfa, 0xff, 0xfd, 0xfa, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xfd, 0xf8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x92, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xec, 0xdd, 0xd3, 0xd2, 0xd3, 0xd2, 0xcc, 0xca, 0xbd, 0xc9, 0xd3, 0xd3, 0xe1, 0xf8, 0xe9, 0xf2, 0xe4, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 
-  0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x5b, 0x93, 0xd5, 0xf9, 0xfb, 0xff, 0xfe, 0xfe, 0xf7, 0xf4, 0xed, 0xf3, 0xfd, 0xf3, 0xf5, 0xf7, 0xef, 0xef, 0xe9, 0xec, 0xe8, 0xec, 0xf2, 0xf4, 0xf6, 0xf6, 0xe4, 0xc8, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1d, 
-  0x0a, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x38, 0x70, 0xa7, 0x99, 0xd9, 0xc3, 0xc8, 0xcb, 0xd0, 0xb9, 0xc1, 0xd5, 0xd8, 0xc5, 0xb2, 0xa4, 0xa1, 0x9f, 0x9b, 0x90, 0x94, 0x97, 0x97, 0x99, 0xb9, 0xeb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x4b, 
-  0x00, 0x19, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x25, 0x3a, 0x79, 0x74, 0x6f, 0x70, 0x63, 0x63, 0x5d, 0x47, 0x36, 0x14, 0x0e, 0x0d, 0x11, 0x08, 0x1a, 0x4d, 0x8e, 0xa0, 0xd7, 0xfa, 0xf8, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xc8, 0xb9, 0xa2, 
-  0x00, 0x00, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xa4, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x0e, 0x50, 0xa2, 0xe9, 0xcc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfb, 0xf4, 0xfa, 0xfa, 0xdc, 0x68, 
-  0x00, 0x00, 0x0f, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc7, 0x89, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1b, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x20, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x57, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xb0, 0x2b, 
-  0x00, 0x00, 0x00, 0x22, 0xc9, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe8, 0xbd, 0xb1, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x28, 0x66, 0xa6, 0xb1, 0xee, 0xfc, 0xed, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xa5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xbe, 0x26, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x34, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x39, 0x30, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x4f, 0x84, 0xca, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xbc, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0xfe, 0x8e, 0x4e, 0x74, 0x74, 0x74, 0x74, 0x69, 0x3c, 0x30, 0x07, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x69, 0xc0, 0xf1, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x9a, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe2, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0xa2, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x8d, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfd, 0xd5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x34, 0x3e, 0x71, 0xb8, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xc1, 0x8d, 0x01, 0x00, 0x00, 0x00, 0x1d, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xfe, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xaa, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xd8, 0xa3, 0x0d, 0x00, 0x00, 0x00, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd0, 0xf2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0xbc, 0xc7, 0x13, 0x00, 0x00, 0x0f, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa8, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf7, 0xff, 0xff, 0xff, 0xe8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x70, 0xe9, 0x7c, 0x07, 0x00, 0x00, 0x4b, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x8f, 0x66, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x52, 0xbf, 0x6a, 0x00, 0x00, 0x05, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaa, 0x56, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x72, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x15, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x1e, 0x5b, 0x20, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x65, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x02, 0x27, 0x16, 0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xaa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x24, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x97, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x54, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2b, 0x0c, 0x63, 0x37, 0x07, 0x67, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x12, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xa4, 0x3d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x51, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x64, 0x2c, 0x8d, 0x4c, 0x1b, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x42, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xbe, 0xb4, 0x83, 0x7b, 0x7e, 0xba, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x83, 0x6f, 0xa3, 0x48, 0x8c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x82, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x11, 0x00, 0x00, 0x00, 0x1d, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xaf, 0x75, 0xab, 0x74, 0x67, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xe7, 0x50, 0xcd, 0xa0, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x40, 0x00, 0x00, 0x00, 0x2c, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xc6, 0xf4, 0xb0, 0xf8, 0xe1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x19, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc, 0xf6, 0xdc, 0xf4, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x01, 0x00, 0x00, 0x2d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xee, 0xf6, 0xef, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 0xff, 0xd0, 0xf8, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf3, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x39, 0x00, 0x00, 0x30, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xec, 0xef, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0xff, 0x7d, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xe4, 0xf9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x46, 0x00, 0x00, 0x5c, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xff, 0xbd, 0xc5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xfe, 0xf9, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x66, 0x00, 0x03, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe3, 0xff, 0xe4, 0x8c, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf6, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x67, 0x01, 0x2a, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xef, 0xd0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x98, 0x02, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xf3, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe1, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x69, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd4, 0xfc, 0xf4, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xdd, 0xf6, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xb3, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf8, 0xf1, 0xff, 0xf3, 0xf0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xec, 0xed, 0xc5, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x76, 0x05, 0x46, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xf0, 0x53, 0x37, 0xee, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf8, 0xf2, 0xd2, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x52, 0x00, 0x00, 0x00, 0x32, 0xec, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xf3, 0xf4, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xc4, 0x6e, 0x01, 0x00, 0x0f, 0xab, 0xfe, 0xff, 0xfd, 0xde, 0xed, 0xff, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xab, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x95, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xcc, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd3, 0x35, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xce, 0xff, 0xff, 0xe9, 0xe5, 0xc6, 0xd4, 0xff, 0xff, 0xfb, 0xc8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x96, 0xfd, 0xff, 0xfe, 0xa9, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8f, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x54, 0xbc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe8, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x77, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x82, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf6, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf4, 0xff, 0xff, 0xc9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x65, 0x6e, 0x98, 0xda, 0xb3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xf2, 0xfe, 0xff, 0xfc, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xde, 0x6e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xe4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xdb, 0xe2, 0xcc, 0xd4, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xcf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xa6, 0xf6, 0xfa, 0xfb, 0xff, 0xff, 0xff, 0xf4, 0xcc, 0xc3, 0xc9, 0xd2, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf8, 0xf1, 0xf0, 0xf9, 0xff, 0xfe, 0xf1, 0xec, 0xe1, 0xe9, 0xc3, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4e, 0x25, 0x38, 0x89, 0x70, 0x9c, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xfc, 0xdf, 0xc2, 0x67, 0x3d, 0x11, 0x4d, 0x10, 0x00, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x00, 0x07, 0x65, 0x55, 0x72, 0x3e, 0x25, 0x55, 0x87, 0xb9, 0xdf, 0xe6, 0xc0, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xe5, 0xc8, 0xab, 0x56, 0x26, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xad, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x17, 0x17, 0x22, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x27, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xf8, 0xfe, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xff, 0xff, 0xff, 0xfe, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xee, 0xff, 0xff, 0xff, 0xf4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xe8, 0xbe, 0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xe3, 0xff, 0xff, 0xfa, 0xb6, 0xd7, 0xfe, 0xff, 0xff, 0xcb, 0x7e, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcd, 0xb0, 0x77, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x54, 0x4f, 0x2b, 0x32, 0xc0, 0xe9, 0xf8, 0xde, 0x9c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x74, 0xea, 0xff, 0xff, 0xff, 0xfd, 0xa0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x7b, 0x93, 0x62, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x99, 0xd7, 0xdb, 0x9b, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x94, 0xc8, 0xc7, 0xc5, 0xbc, 0x8c, 0x8b, 0x8b, 0x8f, 0x92, 0x8b, 0x8b, 0x94, 0x69, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x87, 0x57, 0x00, 0x00, 0xb0, 0xe5, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x8c, 0xdc, 0xce, 0x52, 0x84, 0x8a, 0x4a, 0x6e, 0x63, 0xcf, 0x73, 0xcf, 0x6b, 0xcf, 0x73, 0x2d, 0x5b,
+  0x25, 0x19, 0x8a, 0x4a, 0xaf, 0x6b, 0xd0, 0x73, 0x03, 0xcf, 0x6b, 0x82, 0x52, 0x84, 0xbb, 0xce, 0x7b, 0x00, 0x00, 0x82, 0xf4, 0x94, 0xc4, 0x10, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x07, 0x05,
+  0x19, 0x84, 0x05, 0x11, 0x05, 0x19, 0x8f, 0x63, 0xbc, 0xc6, 0x79, 0x00, 0x00, 0x82, 0x1c, 0xd7, 0xcc, 0x52, 0x03, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x04, 0x05, 0x19, 0x04, 0x05, 0x11, 0x83, 0x05,
+  0x19, 0xe5, 0x10, 0xb4, 0x8c, 0x79, 0x00, 0x00, 0x82, 0xbb, 0xce, 0x25, 0x19, 0x03, 0xe4, 0x10, 0x0b, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0x0d, 0x53, 0x79, 0x00, 0x00, 0x82, 0xdc, 0xce, 0xa7,
+  0x29, 0x03, 0xe4, 0x10, 0x0a, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0xe4, 0x18, 0x8b, 0x4a, 0x79, 0x00, 0x00, 0x82, 0xbb, 0xce, 0xa7, 0x29, 0x03, 0xe4, 0x10, 0x06, 0x04, 0x11, 0x03, 0x05, 0x11,
+  0x03, 0x05, 0x19, 0x82, 0xe5, 0x18, 0xed, 0x52, 0x79, 0x00, 0x00, 0x82, 0xdc, 0xce, 0xc8, 0x31, 0x03, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x81, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02,
+  0x05, 0x19, 0x02, 0xe5, 0x18, 0x81, 0xac, 0x52, 0x64, 0x00, 0x00, 0x85, 0xaf, 0x6b, 0xaf, 0x63, 0x31, 0x7c, 0xd0, 0x6b, 0xd8, 0xad, 0x10, 0x00, 0x00, 0x82, 0xfc, 0xce, 0x29, 0x3a, 0x02, 0xe4,
+  0x10, 0x06, 0x04, 0x11, 0x84, 0xe4, 0x10, 0x04, 0x11, 0x04, 0x19, 0x04, 0x11, 0x03, 0x05, 0x11, 0x82, 0xe4, 0x18, 0x8b, 0x42, 0x10, 0x00, 0x00, 0x86, 0xfc, 0xd6, 0x15, 0x95, 0xcb, 0x4a, 0xcc,
+  0x52, 0xec, 0x52, 0xd4, 0x8c, 0x4c, 0x00, 0x00, 0x83, 0x7a, 0xc6, 0xcf, 0x6b, 0x86, 0x21, 0x03, 0x05, 0x11, 0x82, 0xab, 0x4a, 0xf9, 0xb5, 0x0f, 0x00, 0x00, 0x82, 0xfd, 0xd6, 0x4a, 0x42, 0x03,
+  0xe4, 0x10, 0x82, 0x04, 0x11, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x84, 0xe4, 0x10, 0x04, 0x11, 0x04, 0x19, 0x04, 0x11, 0x03, 0x05, 0x11, 0x82, 0xe4, 0x18, 0xf1, 0x73, 0x0f, 0x00, 0x00, 0x83, 0x7e,
+  0xe7, 0x76, 0xa5, 0x25, 0x19, 0x02, 0xe4, 0x10, 0x84, 0xc4, 0x10, 0x46, 0x21, 0x6a, 0x42, 0x19, 0xbe, 0x49, 0x00, 0x00, 0x83, 0x92, 0x84, 0xec, 0x52, 0x25, 0x11, 0x02, 0x05, 0x11, 0x03, 0x05,
+  0x19, 0x82, 0x6e, 0x63, 0xfd, 0xd6, 0x0e, 0x00, 0x00, 0x82, 0x1d, 0xd7, 0x6a, 0x42, 0x09, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x03, 0x04, 0x19, 0x82, 0x05, 0x11, 0x32, 0x7c, 0x0f, 0x00, 0x00, 0x82,
+  0xf8, 0xb5, 0x86, 0x29, 0x05, 0xe4, 0x10, 0x83, 0x05, 0x19, 0x4a, 0x42, 0xc8, 0x29, 0x47, 0x00, 0x00, 0x82, 0x93, 0x8c, 0x29, 0x3a, 0x04, 0x05, 0x11, 0x03, 0x05, 0x19, 0x83, 0x46, 0x21, 0xd4,
+  0x8c, 0x9c, 0xc6, 0x0d, 0x00, 0x00, 0x84, 0x1d, 0xd7, 0x6a, 0x42, 0xe4, 0x10, 0x04, 0x11, 0x07, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x04, 0x04, 0x19, 0x82, 0xe4, 0x10, 0x52, 0x7c, 0x0e, 0x00, 0x00,
+  0x82, 0x9a, 0xc6, 0x0c, 0x5b, 0x06, 0xe4, 0x10, 0x84, 0x04, 0x19, 0x04, 0x11, 0xc8, 0x31, 0x0d, 0x5b, 0x44, 0x00, 0x00, 0x83, 0xbb, 0xce, 0xf0, 0x73, 0x25, 0x19, 0x05, 0x05, 0x11, 0x04, 0x05,
+  0x19, 0x82, 0x29, 0x3a, 0x76, 0xa5, 0x0d, 0x00, 0x00, 0x82, 0x1c, 0xd7, 0x6a, 0x42, 0x05, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x03, 0x05, 0x19,
+  0x82, 0x04, 0x11, 0x94, 0x84, 0x0e, 0x00, 0x00, 0x81, 0x51, 0x84, 0x07, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x82, 0x25, 0x19, 0xcc, 0x52, 0x42, 0x00, 0x00, 0x82, 0x19, 0xb6, 0xaf, 0x6b, 0x08, 0x05,
+  0x11, 0x02, 0x05, 0x19, 0x02, 0x05, 0x11, 0x82, 0x6e, 0x63, 0xdc, 0xce, 0x0c, 0x00, 0x00, 0x82, 0xfc, 0xce, 0xab, 0x4a, 0x07, 0x04, 0x11, 0x04, 0xe4, 0x10, 0x04, 0x04, 0x11, 0x83, 0xe4, 0x10,
+  0xb4, 0x8c, 0xfc, 0xce, 0x0c, 0x00, 0x00, 0x82, 0xb3, 0x8c, 0x45, 0x21, 0x07, 0xe4, 0x10, 0x81, 0xe4, 0x18, 0x04, 0x04, 0x19, 0x82, 0x2a, 0x42, 0x26, 0x19, 0x3e, 0x00, 0x00, 0x83, 0xdc, 0xce,
+  0xb7, 0xad, 0x8a, 0x4a, 0x0b, 0x05, 0x11, 0x81, 0x04, 0x11, 0x02, 0x05, 0x19, 0x82, 0xf5, 0x94, 0xdc, 0xd6, 0x08, 0x00, 0x00, 0x85, 0x5a, 0xbe, 0xf4, 0x8c, 0xf0, 0x73, 0x31, 0x7c, 0xe8, 0x31,
+  0x04, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x09, 0xe4, 0x10, 0x86, 0x4a, 0x42, 0x6e, 0x63, 0xf0, 0x73, 0x52, 0x7c, 0xb7, 0xad, 0xfc, 0xd6, 0x07, 0x00, 0x00, 0x82, 0x97, 0xa5, 0x09, 0x3a, 0x08, 0xe4,
+  0x10, 0x81, 0xe5, 0x18, 0x04, 0x04, 0x19, 0x83, 0x05, 0x19, 0xe8, 0x31, 0xb3, 0x8c, 0x3c, 0x00, 0x00, 0x83, 0x1c, 0xd7, 0xb3, 0x8c, 0x08, 0x32, 0x07, 0x05, 0x11, 0x02, 0x04, 0x11, 0x81, 0x05,
+  0x11, 0x03, 0x04, 0x11, 0x02, 0x05, 0x19, 0x83, 0x86, 0x29, 0xd8, 0xb5, 0xdc, 0xce, 0x03, 0x00, 0x00, 0x87, 0x1c, 0xd7, 0xf8, 0xad, 0x31, 0x7c, 0x4d, 0x5b, 0x29, 0x3a, 0xe4, 0x10, 0x04, 0x11,
+  0x02, 0xe4, 0x10, 0x06, 0x04, 0x11, 0x0d, 0xe4, 0x10, 0x86, 0xc4, 0x10, 0x66, 0x21, 0x0c, 0x53, 0x0d, 0x5b, 0xb8, 0xad, 0xdc, 0xce, 0x03, 0x00, 0x00, 0x82, 0xfc, 0xd6, 0xcf, 0x73, 0x04, 0xe4,
+  0x10, 0x04, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x05, 0x04, 0x19, 0x84, 0x05, 0x19, 0xc8, 0x31, 0x31, 0x7c, 0xdc, 0xce, 0x39, 0x00, 0x00, 0x85, 0x1d, 0xdf, 0x51, 0x84, 0x45, 0x19, 0x05, 0x11, 0x04,
+  0x11, 0x06, 0x05, 0x11, 0x02, 0x04, 0x11, 0x81, 0x05, 0x19, 0x02, 0x04, 0x19, 0x03, 0x05, 0x19, 0x88, 0x25, 0x19, 0x6a, 0x42, 0x7a, 0xc6, 0xfc, 0xd6, 0xf8, 0xb5, 0x31, 0x7c, 0x4d, 0x63, 0x46,
+  0x21, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x04, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x12, 0xe4, 0x10, 0x87, 0x46, 0x21, 0x4e, 0x63, 0xcb, 0x4a, 0xf0, 0x6b, 0x00, 0x00, 0xf4, 0x94, 0x05, 0x19, 0x02,
+  0xe4, 0x10, 0x07, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x19, 0x81, 0x04, 0x19, 0x02, 0x05, 0x19, 0x82, 0x86, 0x21, 0xf1, 0x73, 0x39, 0x00, 0x00, 0x81, 0xd3, 0x94, 0x04, 0xe4, 0x10, 0x02,
+  0x04, 0x11, 0x06, 0x05, 0x11, 0x81, 0x05, 0x19, 0x04, 0x04, 0x19, 0x03, 0x05, 0x19, 0x84, 0x51, 0x84, 0xb3, 0x8c, 0x08, 0x3a, 0xc4, 0x08, 0x0b, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x16, 0xe4, 0x10,
+  0x83, 0xa7, 0x29, 0x8e, 0x63, 0xc7, 0x31, 0x02, 0xe4, 0x10, 0x82, 0x04, 0x11, 0x05, 0x11, 0x08, 0x04, 0x11, 0x05, 0x04, 0x19, 0x02, 0x05, 0x19, 0x82, 0x66, 0x21, 0x73, 0x84, 0x38, 0x00, 0x00,
+  0x81, 0x8e, 0x6b, 0x04, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x06, 0x05, 0x11, 0x81, 0x05, 0x19, 0x04, 0x04, 0x19, 0x04, 0x05, 0x19, 0x0e, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x03, 0xe4, 0x10, 0x05, 0xc4,
+  0x10, 0x10, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x05, 0x05, 0x11, 0x08, 0x04, 0x11, 0x05, 0x04, 0x19, 0x84, 0x05, 0x19, 0x05, 0x11, 0xe4, 0x10, 0x8b, 0x4a, 0x38, 0x00, 0x00, 0x81, 0x6e, 0x63, 0x06,
+  0xe4, 0x10, 0x06, 0x04, 0x11, 0x81, 0x05, 0x19, 0x04, 0x04, 0x19, 0x84, 0x05, 0x19, 0x04, 0x11, 0x05, 0x11, 0x04, 0x11, 0x0a, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x8f, 0xe4, 0x10, 0xc4, 0x10, 0xe8,
+  0x31, 0x0c, 0x5b, 0xaf, 0x73, 0xd3, 0x94, 0xf4, 0x9c, 0x34, 0x9d, 0x14, 0x9d, 0xf4, 0x94, 0x71, 0x84, 0x4d, 0x63, 0x49, 0x42, 0xe4, 0x10, 0xc3, 0x08, 0x02, 0xe4, 0x10, 0x81, 0xc4, 0x10, 0x09,
+  0xe4, 0x10, 0x82, 0x04, 0x11, 0xe4, 0x10, 0x06, 0x05, 0x11, 0x04, 0x04, 0x11, 0x81, 0x04, 0x19, 0x02, 0x04, 0x11, 0x04, 0xe4, 0x10, 0x84, 0x04, 0x19, 0x04, 0x11, 0xe4, 0x10, 0x8b, 0x42, 0x38,
+  0x00, 0x00, 0x82, 0x6e, 0x63, 0xe8, 0x31, 0x05, 0xe4, 0x10, 0x06, 0x04, 0x11, 0x81, 0x05, 0x19, 0x05, 0x04, 0x19, 0x03, 0x04, 0x11, 0x09, 0xe4, 0x10, 0x86, 0x05, 0x19, 0x4d, 0x63, 0xf4, 0x94,
+  0x39, 0xbe, 0x3c, 0xdf, 0x9e, 0xef, 0x04, 0xdf, 0xf7, 0x83, 0x5d, 0xe7, 0x9e, 0xef, 0xff, 0xff, 0x03, 0xdf, 0xf7, 0x86, 0x7d, 0xef, 0xfb, 0xd6, 0x38, 0xbe, 0xf3, 0x9c, 0x6d, 0x6b, 0x04, 0x11,
+  0x0a, 0xe4, 0x10, 0x06, 0x05, 0x11, 0x04, 0x04, 0x11, 0x81, 0x04, 0x19, 0x02, 0x04, 0x11, 0x04, 0xe4, 0x10, 0x84, 0xe4, 0x18, 0xe4, 0x10, 0x4a, 0x42, 0x36, 0x95, 0x39, 0x00, 0x00, 0x82, 0xcc,
+  0x52, 0x05, 0x19, 0x04, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x82, 0x04, 0x11, 0x05, 0x11, 0x04, 0x04, 0x11, 0x03, 0x04, 0x19, 0x02, 0x04, 0x11, 0x06, 0xe4, 0x10, 0x86, 0xe5, 0x10, 0xe4, 0x10, 0xe8,
+  0x31, 0x51, 0x7c, 0x59, 0xbe, 0x7e, 0xe7, 0x04, 0xdf, 0xf7, 0x81, 0xbf, 0xf7, 0x02, 0xdf, 0xf7, 0x86, 0x3d, 0xe7, 0x2d, 0x63, 0x05, 0x11, 0x25, 0x19, 0x92, 0x8c, 0x7e, 0xef, 0x05, 0xdf, 0xf7,
+  0x86, 0xdf, 0xff, 0xdf, 0xf7, 0x7d, 0xef, 0x18, 0xbe, 0x30, 0x7c, 0x86, 0x29, 0x07, 0xe4, 0x10, 0x82, 0x05, 0x11, 0x05, 0x19, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x03, 0x04,
+  0x19, 0x06, 0xe4, 0x10, 0x84, 0xe4, 0x18, 0xe8, 0x31, 0x36, 0x95, 0x97, 0xa5, 0x3a, 0x00, 0x00, 0x81, 0xcc, 0x52, 0x04, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x82, 0x04, 0x11, 0x05, 0x19, 0x05, 0x04,
+  0x11, 0x02, 0x04, 0x19, 0x02, 0x04, 0x11, 0x05, 0xe4, 0x10, 0x84, 0x45, 0x19, 0x10, 0x7c, 0x59, 0xc6, 0x9e, 0xef, 0x06, 0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x02, 0xdf, 0xf7, 0x82, 0x9e, 0xf7, 0x2c,
+  0x5b, 0x04, 0xe4, 0x10, 0x82, 0xec, 0x5a, 0x7e, 0xef, 0x03, 0xdf, 0xf7, 0x82, 0xdf, 0xff, 0xdf, 0xf7, 0x02, 0xdf, 0xff, 0x02, 0xdf, 0xf7, 0x84, 0x7d, 0xef, 0xd7, 0xb5, 0x0c, 0x5b, 0xc4, 0x10,
+  0x04, 0xe4, 0x10, 0x82, 0x05, 0x11, 0x05, 0x19, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x04, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x84, 0xa7, 0x29, 0xf5, 0x8c, 0x98, 0x9d, 0xb8, 0xa5,
+  0x3a, 0x00, 0x00, 0x82, 0x97, 0xa5, 0x29, 0x3a, 0x03, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x04, 0x05, 0x19, 0x02, 0x04, 0x11, 0x02, 0x04, 0x19, 0x03, 0xe4, 0x10, 0x85, 0xe4, 0x18, 0xe4, 0x10, 0xa7,
+  0x29, 0x96, 0xa5, 0x5d, 0xe7, 0x0a, 0xdf, 0xf7, 0x02, 0xdf, 0xff, 0x81, 0xb6, 0xb5, 0x02, 0xe5, 0x10, 0x04, 0xe4, 0x10, 0x81, 0xb3, 0x94, 0x03, 0xdf, 0xf7, 0x04, 0xdf, 0xff, 0x81, 0xdf, 0xf7,
+  0x02, 0xdf, 0xff, 0x84, 0xdf, 0xf7, 0xde, 0xf7, 0x79, 0xc6, 0xae, 0x6b, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x04, 0x05, 0x19, 0x04, 0x04, 0x11, 0x06, 0x04, 0x19, 0x84, 0x05, 0x19, 0x93, 0x84,
+  0x77, 0x9d, 0x97, 0x9d, 0x3c, 0x00, 0x00, 0x82, 0x93, 0x84, 0x25, 0x19, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x05, 0x05, 0x19, 0x04, 0x04, 0x19, 0x02, 0xe4, 0x18, 0x83, 0x29, 0x3a, 0xb7, 0xb5,
+  0x9e, 0xef, 0x03, 0xdf, 0xf7, 0x0b, 0xdf, 0xff, 0x82, 0x8e, 0x6b, 0xe5, 0x10, 0x05, 0xe4, 0x10, 0x81, 0xe8, 0x39, 0x02, 0xdf, 0xf7, 0x0b, 0xdf, 0xff, 0x86, 0xdf, 0xf7, 0x7a, 0xce, 0xec, 0x5a,
+  0xe4, 0x10, 0xe4, 0x18, 0x04, 0x11, 0x04, 0x04, 0x19, 0x03, 0x04, 0x11, 0x06, 0x04, 0x19, 0x82, 0xe4, 0x10, 0xf0, 0x6b, 0x02, 0x77, 0x9d, 0x81, 0x97, 0x9d, 0x3d, 0x00, 0x00, 0x82, 0xb4, 0x8c,
+  0xc4, 0x10, 0x02, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x04, 0x05, 0x11, 0x05, 0x05, 0x19, 0x02, 0x04, 0x19, 0x82, 0xf3, 0x94, 0x7e, 0xe7, 0x02, 0xbf, 0xf7, 0x81, 0xdf, 0xf7, 0x0d, 0xdf, 0xff, 0x82,
+  0x2d, 0x63, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x81, 0x09, 0x3a, 0x02, 0xdf, 0xf7, 0x0d, 0xdf, 0xff, 0x85, 0x9e, 0xf7, 0x35, 0xa5, 0x24, 0x19, 0x04, 0x11, 0xe4,
+  0x10, 0x07, 0x04, 0x19, 0x05, 0x05, 0x19, 0x81, 0x2e, 0x5b, 0x03, 0x77, 0x9d, 0x3e, 0x00, 0x00, 0x85, 0xbc, 0xce, 0x93, 0x8c, 0x05, 0x11, 0xe4, 0x10, 0x04, 0x19, 0x05, 0x05, 0x11, 0x04, 0x05,
+  0x19, 0x82, 0x8a, 0x4a, 0x9a, 0xce, 0x03, 0xbf, 0xf7, 0x81, 0xdf, 0xf7, 0x03, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x09, 0xdf, 0xff, 0x84, 0x34, 0xa5, 0xe5, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0x03, 0xe4,
+  0x10, 0x81, 0x55, 0xa5, 0x02, 0xdf, 0xf7, 0x03, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0x82, 0xba, 0xd6, 0x69, 0x4a, 0x02, 0xe4, 0x10, 0x83, 0xe4, 0x18, 0x04, 0x19, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x81,
+  0x05, 0x19, 0x02, 0x04, 0x19, 0x86, 0x05, 0x19, 0xe9, 0x31, 0x57, 0x95, 0x77, 0x95, 0x77, 0x9d, 0x97, 0x9d, 0x3f, 0x00, 0x00, 0x84, 0xfd, 0xd6, 0x52, 0x84, 0xe4, 0x10, 0x04, 0x19, 0x04, 0x05,
+  0x11, 0x03, 0x05, 0x19, 0x83, 0x04, 0x11, 0xf0, 0x7b, 0x5d, 0xe7, 0x02, 0xbf, 0xf7, 0x81, 0xdf, 0xf7, 0x05, 0xdf, 0xff, 0x02, 0xff, 0xf7, 0x09, 0xdf, 0xff, 0x82, 0x7d, 0xef, 0x0c, 0x5b, 0x04,
+  0xc4, 0x10, 0x82, 0xab, 0x52, 0x5e, 0xe7, 0x02, 0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x5d, 0xe7, 0x4d, 0x6b, 0x05, 0xe4, 0x10, 0x83, 0xe4, 0x18,
+  0x04, 0x19, 0x05, 0x19, 0x02, 0x04, 0x19, 0x85, 0x25, 0x19, 0x16, 0x8d, 0x78, 0x9d, 0x77, 0x9d, 0x97, 0x9d, 0x3f, 0x00, 0x00, 0x85, 0x3d, 0xd7, 0x56, 0x9d, 0xc8, 0x31, 0xe4, 0x10, 0x04, 0x19,
+  0x04, 0x05, 0x11, 0x03, 0x05, 0x19, 0x83, 0x31, 0x7c, 0x9e, 0xef, 0xbf, 0xf7, 0x02, 0xdf, 0xf7, 0x10, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x87, 0x9e, 0xef, 0xf4, 0x9c, 0xc7, 0x31, 0x86, 0x29, 0x51,
+  0x84, 0x3d, 0xe7, 0xbf, 0xf7, 0x03, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x0e, 0xdf, 0xff, 0x82, 0x7d, 0xef, 0xae, 0x73, 0x05, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x04, 0xe4, 0x10, 0x83, 0x6a, 0x42, 0x36,
+  0x8d, 0x98, 0x9d, 0x3f, 0x00, 0x00, 0x83, 0x3d, 0xdf, 0xd4, 0x8c, 0x25, 0x19, 0x02, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x02, 0x05, 0x11, 0x04, 0x05, 0x19, 0x81, 0x10, 0x7c, 0x04, 0xdf, 0xf7, 0x0f,
+  0xdf, 0xff, 0x07, 0xff, 0xff, 0x03, 0xdf, 0xff, 0x82, 0xdf, 0xf7, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x0e, 0xdf, 0xff, 0x83, 0xfe, 0xff, 0x9e, 0xef, 0x8e, 0x73, 0x04, 0xe4, 0x10, 0x81, 0x04, 0x19,
+  0x05, 0xe4, 0x10, 0x82, 0x87, 0x21, 0x35, 0x9d, 0x3e, 0x00, 0x00, 0x82, 0x7a, 0xc6, 0x31, 0x7c, 0x03, 0xe4, 0x10, 0x83, 0x04, 0x19, 0x05, 0x19, 0x05, 0x11, 0x02, 0x05, 0x19, 0x02, 0x25, 0x19,
+  0x82, 0xab, 0x52, 0x5d, 0xe7, 0x02, 0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x0e, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x9e, 0xf7, 0x3d, 0xe7, 0xdb, 0xd6, 0x03, 0x59, 0xc6, 0x85, 0x18, 0xbe,
+  0x39, 0xc6, 0x9a, 0xd6, 0x5d, 0xe7, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x0e, 0xdf, 0xff, 0x82, 0x7d, 0xef, 0xaa, 0x52, 0x03, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x83, 0x04, 0x19, 0x46,
+  0x21, 0x2d, 0x5b, 0x2d, 0x00, 0x00, 0x86, 0xb3, 0x8c, 0x6e, 0x63, 0x0c, 0x53, 0xcc, 0x52, 0xf0, 0x73, 0xb8, 0xad, 0x09, 0x00, 0x00, 0x84, 0x56, 0x9d, 0x0d, 0x5b, 0xe4, 0x10, 0x04, 0x11, 0x02,
+  0xe4, 0x10, 0x81, 0x04, 0x19, 0x04, 0x05, 0x19, 0x83, 0x25, 0x19, 0xe8, 0x31, 0x3d, 0xdf, 0x03, 0xdf, 0xf7, 0x04, 0xff, 0xff, 0x09, 0xdf, 0xff, 0x87, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x5d,
+  0xef, 0x76, 0xad, 0x0c, 0x5b, 0x66, 0x21, 0x08, 0xe4, 0x10, 0x84, 0x04, 0x19, 0xec, 0x5a, 0x96, 0xad, 0x5d, 0xe7, 0x03, 0xff, 0xff, 0x0f, 0xdf, 0xff, 0x83, 0xfb, 0xde, 0x05, 0x19, 0xe4, 0x10,
+  0x02, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x02, 0xe4, 0x18, 0x82, 0xe4, 0x10, 0x46, 0x21, 0x0a, 0x00, 0x00, 0x82, 0x3d, 0xd7, 0x6e, 0x63, 0x02, 0xab, 0x4a, 0x82, 0x2d, 0x5b, 0xd4, 0x8c, 0x1b, 0x00,
+  0x00, 0x84, 0xb7, 0xad, 0xab, 0x4a, 0xe4, 0x10, 0x04, 0x11, 0x02, 0xe5, 0x10, 0x82, 0xe8, 0x31, 0x8f, 0x63, 0x07, 0x00, 0x00, 0x85, 0x5a, 0xbe, 0x09, 0x3a, 0xe4, 0x10, 0x04, 0x19, 0xe4, 0x10,
+  0x02, 0x04, 0x19, 0x04, 0x05, 0x19, 0x83, 0x25, 0x19, 0x26, 0x19, 0x39, 0xc6, 0x03, 0xdf, 0xf7, 0x03, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0x83, 0x9e, 0xf7, 0x55, 0xa5, 0x04, 0x11, 0x03, 0xe4, 0x10,
+  0x05, 0xe5, 0x10, 0x06, 0xe4, 0x10, 0x83, 0x04, 0x19, 0x51, 0x84, 0xdb, 0xd6, 0x06, 0xff, 0xff, 0x0b, 0xdf, 0xff, 0x81, 0x96, 0xad, 0x03, 0x04, 0x19, 0x81, 0x05, 0x19, 0x07, 0xe4, 0x10, 0x82,
+  0x46, 0x21, 0x72, 0x84, 0x08, 0x00, 0x00, 0x84, 0x31, 0x7c, 0x0c, 0x53, 0x25, 0x19, 0x05, 0x11, 0x02, 0xe5, 0x10, 0x82, 0xa7, 0x29, 0x93, 0x8c, 0x19, 0x00, 0x00, 0x82, 0x55, 0x9d, 0xec, 0x52,
+  0x02, 0x05, 0x11, 0x86, 0x04, 0x11, 0xe4, 0x10, 0x04, 0x11, 0xe4, 0x10, 0x46, 0x21, 0xd0, 0x6b, 0x05, 0x00, 0x00, 0x83, 0xdc, 0xd6, 0xf0, 0x73, 0xe4, 0x10, 0x05, 0x04, 0x19, 0x05, 0x05, 0x19,
+  0x82, 0xf0, 0x73, 0xbf, 0xf7, 0x02, 0xdf, 0xf7, 0x03, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0x82, 0x59, 0xc6, 0x4a, 0x42, 0x05, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x0c, 0xe4, 0x10, 0x83, 0xa3, 0x08, 0x51,
+  0x8c, 0x7e, 0xef, 0x04, 0xff, 0xff, 0x0b, 0xdf, 0xff, 0x86, 0xdf, 0xf7, 0xef, 0x7b, 0x04, 0x19, 0xe5, 0x18, 0x05, 0x19, 0x04, 0x19, 0x07, 0xe4, 0x10, 0x82, 0xa7, 0x31, 0xd4, 0x94, 0x05, 0x00,
+  0x00, 0x84, 0x96, 0xa5, 0xec, 0x52, 0xc8, 0x31, 0x25, 0x11, 0x04, 0x05, 0x11, 0x82, 0xe5, 0x18, 0x6a, 0x42, 0x18, 0x00, 0x00, 0x82, 0xfc, 0xd6, 0xf0, 0x73, 0x07, 0x05, 0x11, 0x84, 0x04, 0x11,
+  0x25, 0x19, 0xcc, 0x52, 0xd0, 0x6b, 0x02, 0x00, 0x00, 0x83, 0xbb, 0xce, 0x11, 0x7c, 0x05, 0x11, 0x06, 0x04, 0x19, 0x02, 0x05, 0x11, 0x03, 0x05, 0x19, 0x81, 0xbb, 0xce, 0x02, 0xdf, 0xf7, 0x03,
+  0xff, 0xff, 0x0b, 0xdf, 0xff, 0x82, 0xbe, 0xf7, 0xb3, 0x94, 0x02, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x11, 0xe4, 0x10, 0x83, 0xc7, 0x31, 0x7a, 0xce, 0xff, 0xf7, 0x02, 0xff, 0xff,
+  0x0c, 0xdf, 0xff, 0x83, 0x1c, 0xdf, 0x66, 0x21, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0xe4, 0x18, 0x06, 0xe4, 0x10, 0x83, 0x04, 0x11, 0x6a, 0x42, 0xd4, 0x94, 0x03, 0x00, 0x00, 0x84, 0xf8, 0xb5,
+  0xcc, 0x52, 0x45, 0x19, 0x05, 0x11, 0x03, 0x05, 0x19, 0x85, 0x05, 0x11, 0x05, 0x19, 0x04, 0x19, 0x05, 0x19, 0xaf, 0x6b, 0x17, 0x00, 0x00, 0x82, 0x76, 0xa5, 0x66, 0x21, 0x07, 0x05, 0x11, 0x89,
+  0x04, 0x11, 0x05, 0x19, 0x04, 0x11, 0x29, 0x3a, 0xaf, 0x6b, 0x00, 0x00, 0x72, 0x84, 0x46, 0x21, 0x04, 0x11, 0x04, 0x04, 0x19, 0x02, 0x04, 0x11, 0x03, 0x05, 0x19, 0x82, 0x25, 0x19, 0xcf, 0x73,
+  0x03, 0xdf, 0xf7, 0x02, 0xff, 0xff, 0x0b, 0xdf, 0xff, 0x84, 0x5d, 0xef, 0x2c, 0x63, 0xe4, 0x10, 0xe5, 0x10, 0x09, 0xe4, 0x10, 0x04, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x02, 0xc4, 0x10, 0x05, 0xe4,
+  0x10, 0x83, 0xb7, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0x0d, 0xdf, 0xff, 0x83, 0x14, 0x9d, 0x05, 0x11, 0x05, 0x19, 0x02, 0xe5, 0x10, 0x06, 0xe4, 0x10, 0x8a, 0x04, 0x11, 0xe4, 0x10, 0x09, 0x3a, 0x19,
+  0xbe, 0x1d, 0xd7, 0x52, 0x84, 0x49, 0x3a, 0x25, 0x11, 0x05, 0x19, 0x05, 0x11, 0x03, 0x05, 0x19, 0x02, 0x05, 0x11, 0x84, 0x04, 0x19, 0xe4, 0x10, 0x4a, 0x42, 0xfd, 0xd6, 0x15, 0x00, 0x00, 0x83,
+  0x9b, 0xc6, 0xec, 0x52, 0x05, 0x19, 0x06, 0x05, 0x11, 0x81, 0x05, 0x19, 0x04, 0x05, 0x11, 0x83, 0xa7, 0x29, 0x2d, 0x5b, 0xa7, 0x29, 0x02, 0xe4, 0x10, 0x04, 0x04, 0x19, 0x02, 0x04, 0x11, 0x03,
+  0x05, 0x19, 0x82, 0x46, 0x19, 0xfc, 0xd6, 0x02, 0xdf, 0xf7, 0x03, 0xff, 0xff, 0x0a, 0xdf, 0xff, 0x82, 0x7d, 0xef, 0x0c, 0x5b, 0x08, 0xe4, 0x10, 0x8a, 0x87, 0x29, 0x0d, 0x53, 0xd0, 0x6b, 0xf0,
+  0x6b, 0x8f, 0x63, 0x8e, 0x63, 0xaf, 0x6b, 0x2d, 0x5b, 0x8a, 0x42, 0x05, 0x19, 0x03, 0xc4, 0x10, 0x05, 0xe4, 0x10, 0x83, 0x05, 0x19, 0xb7, 0xb5, 0xdf, 0xf7, 0x0d, 0xdf, 0xff, 0x87, 0x7e, 0xf7,
+  0x87, 0x29, 0xe4, 0x10, 0xc4, 0x10, 0x87, 0x29, 0x6a, 0x42, 0xc4, 0x10, 0x06, 0xe4, 0x10, 0x84, 0x04, 0x11, 0xf0, 0x73, 0xaf, 0x6b, 0x25, 0x19, 0x02, 0x05, 0x11, 0x81, 0x05, 0x19, 0x06, 0x05,
+  0x11, 0x85, 0xe4, 0x10, 0x05, 0x19, 0xe4, 0x10, 0x4e, 0x63, 0xfd, 0xd6, 0x13, 0x00, 0x00, 0x84, 0xfc, 0xd6, 0x72, 0x84, 0xe4, 0x10, 0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x81, 0x05,
+  0x19, 0x03, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0x04, 0x19, 0x05, 0x11, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x81, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x03, 0x05, 0x11, 0x84, 0x05, 0x19, 0xcf, 0x73,
+  0xbf, 0xf7, 0xdf, 0xf7, 0x03, 0xff, 0xff, 0x0a, 0xdf, 0xff, 0x82, 0xbe, 0xf7, 0xae, 0x73, 0x07, 0xe4, 0x10, 0x83, 0x4a, 0x3a, 0x73, 0x84, 0x77, 0x9d, 0x03, 0x97, 0xa5, 0x05, 0xb7, 0xa5, 0x83,
+  0x56, 0x9d, 0xd0, 0x6b, 0xe8, 0x31, 0x02, 0xc4, 0x10, 0x05, 0xe4, 0x10, 0x82, 0x05, 0x19, 0x9a, 0xce, 0x04, 0xff, 0xff, 0x07, 0xdf, 0xff, 0x84, 0xdf, 0xf7, 0xdb, 0xde, 0x14, 0xa5, 0x66, 0x29,
+  0x02, 0xc4, 0x10, 0x83, 0xc4, 0x08, 0x11, 0x7c, 0xec, 0x52, 0x07, 0xe4, 0x10, 0x81, 0x25, 0x19, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x05, 0x05, 0x11, 0x02, 0xe4, 0x10,
+  0x84, 0x05, 0x11, 0x04, 0x11, 0xc8, 0x31, 0xd4, 0x94, 0x13, 0x00, 0x00, 0x82, 0x76, 0xa5, 0x25, 0x19, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x02, 0x05, 0x11,
+  0x04, 0x05, 0x19, 0x03, 0x05, 0x11, 0x02, 0x04, 0x11, 0x04, 0xe4, 0x10, 0x04, 0x05, 0x11, 0x81, 0x18, 0xbe, 0x02, 0xdf, 0xf7, 0x03, 0xff, 0xff, 0x0a, 0xdf, 0xff, 0x81, 0x34, 0xa5, 0x06, 0xe4,
+  0x10, 0x83, 0x25, 0x19, 0x2e, 0x5b, 0x97, 0x9d, 0x07, 0xb8, 0xa5, 0x05, 0xb7, 0xa5, 0x83, 0xb8, 0xa5, 0x73, 0x84, 0xa7, 0x29, 0x02, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x84, 0x04, 0x19, 0x08, 0x3a,
+  0x5d, 0xe7, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x8c, 0xbe, 0xf7, 0x18, 0xc6, 0xcb, 0x5a, 0x62, 0x08, 0xc4, 0x08, 0xe4, 0x08, 0xe4, 0x10, 0xc4, 0x08, 0xc3, 0x08, 0xab, 0x4a, 0x36,
+  0x9d, 0xec, 0x52, 0x06, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82, 0x05, 0x11, 0x05, 0x19, 0x07, 0x05, 0x11, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x8b, 0x4a, 0x36, 0x9d, 0x11, 0x00, 0x00, 0x82,
+  0x39, 0xbe, 0xab, 0x4a, 0x05, 0x04, 0x11, 0x05, 0x05, 0x19, 0x03, 0x05, 0x11, 0x81, 0x04, 0x19, 0x04, 0x05, 0x11, 0x81, 0x04, 0x11, 0x05, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0x25,
+  0x19, 0x5e, 0xe7, 0x02, 0xdf, 0xf7, 0x02, 0xff, 0xff, 0x0a, 0xdf, 0xff, 0x82, 0xfb, 0xde, 0x24, 0x21, 0x05, 0xe4, 0x10, 0x82, 0x45, 0x19, 0x11, 0x74, 0x10, 0xb8, 0xa5, 0x83, 0x77, 0x9d, 0x0d,
+  0x5b, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x82, 0x71, 0x84, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x86, 0x7e, 0xef, 0xd7, 0xb5, 0xaa, 0x52, 0xa3, 0x08, 0xc3, 0x10, 0xc4,
+  0x10, 0x03, 0xe4, 0x10, 0x81, 0xc4, 0x08, 0x02, 0xa3, 0x08, 0x83, 0xd4, 0x8c, 0x76, 0xa5, 0x4a, 0x42, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x06, 0x05, 0x11, 0x02, 0x04, 0x19, 0x03, 0x05, 0x19,
+  0x06, 0xe4, 0x10, 0x82, 0x8f, 0x6b, 0xbc, 0xce, 0x0f, 0x00, 0x00, 0x83, 0xfc, 0xd6, 0x31, 0x7c, 0xe4, 0x10, 0x05, 0x04, 0x11, 0x81, 0x05, 0x11, 0x04, 0x05, 0x19, 0x03, 0x05, 0x11, 0x81, 0x05,
+  0x19, 0x04, 0x05, 0x11, 0x02, 0x04, 0x11, 0x82, 0xe4, 0x10, 0xe4, 0x18, 0x02, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0xec, 0x5a, 0xbf, 0xf7, 0x02, 0xdf, 0xf7, 0x81, 0xff, 0xff, 0x0a,
+  0xdf, 0xff, 0x82, 0xdf, 0xf7, 0xae, 0x73, 0x05, 0xe4, 0x10, 0x82, 0x04, 0x11, 0x52, 0x7c, 0x06, 0xb8, 0xa5, 0x81, 0x98, 0xa5, 0x02, 0xb8, 0xad, 0x85, 0x00, 0x00, 0xd8, 0xad, 0xb8, 0xa5, 0xb8,
+  0xad, 0xb8, 0xa5, 0x02, 0x98, 0xa5, 0x85, 0xb8, 0xa5, 0x98, 0xa5, 0x97, 0xa5, 0xed, 0x52, 0xc4, 0x10, 0x02, 0xe4, 0x10, 0x85, 0x04, 0x19, 0x04, 0x11, 0x05, 0x19, 0xbb, 0xd6, 0xdf, 0xff, 0x02,
+  0xff, 0xff, 0x83, 0x5d, 0xe7, 0x55, 0xa5, 0xc7, 0x31, 0x08, 0xe4, 0x10, 0x87, 0xc4, 0x10, 0xa4, 0x10, 0xa3, 0x10, 0xb0, 0x6b, 0x97, 0xa5, 0x72, 0x84, 0xc7, 0x31, 0x02, 0xe4, 0x10, 0x03, 0x04,
+  0x11, 0x04, 0x05, 0x11, 0x81, 0x04, 0x11, 0x02, 0x04, 0x19, 0x03, 0x05, 0x19, 0x05, 0xe4, 0x10, 0x83, 0xe4, 0x18, 0x66, 0x21, 0x73, 0x84, 0x0f, 0x00, 0x00, 0x82, 0xf4, 0x94, 0x05, 0x19, 0x04,
+  0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0x05, 0x11, 0x03, 0x04, 0x11, 0x05, 0x05, 0x11, 0x02, 0x04, 0x11, 0x82, 0x6a, 0x42, 0x8b, 0x4a, 0x02, 0xe4, 0x10, 0x03,
+  0x05, 0x11, 0x81, 0xb3, 0x8c, 0x03, 0xdf, 0xf7, 0x0b, 0xdf, 0xff, 0x81, 0x9a, 0xce, 0x06, 0xe4, 0x10, 0x87, 0x6e, 0x63, 0x98, 0xa5, 0x98, 0x9d, 0xb8, 0xa5, 0xb8, 0x9d, 0x97, 0x9d, 0x98, 0xa5,
+  0x0a, 0x00, 0x00, 0x04, 0x97, 0xa5, 0x82, 0x56, 0x9d, 0xc8, 0x31, 0x02, 0xe4, 0x10, 0x88, 0x04, 0x11, 0x05, 0x11, 0x05, 0x19, 0x4d, 0x63, 0xbf, 0xf7, 0xba, 0xd6, 0x51, 0x84, 0x45, 0x21, 0x05,
+  0xe4, 0x10, 0x02, 0xe5, 0x10, 0x03, 0xe4, 0x10, 0x8b, 0xc4, 0x10, 0xe4, 0x10, 0x6a, 0x42, 0xb4, 0x84, 0x97, 0x9d, 0xf8, 0xb5, 0xcf, 0x73, 0x45, 0x21, 0xe4, 0x10, 0xe4, 0x18, 0x04, 0x19, 0x02,
+  0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0x04, 0x19, 0x04, 0x05, 0x19, 0x06, 0xe4, 0x10, 0x82, 0x4a, 0x42, 0x3a, 0xbe, 0x0d, 0x00, 0x00, 0x85, 0x97, 0xad, 0x4a, 0x42, 0xe4, 0x10,
+  0x05, 0x11, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x05, 0x05, 0x11, 0x84, 0x04, 0x11, 0xc8, 0x31, 0x76, 0xa5,
+  0x66, 0x29, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x81, 0xd7, 0xb5, 0x02, 0xdf, 0xf7, 0x0c, 0xdf, 0xff, 0x81, 0x51, 0x84, 0x05, 0xe4, 0x10, 0x81, 0xc8, 0x29, 0x03, 0x98, 0x9d, 0x02, 0x77, 0x9d,
+  0x0e, 0x00, 0x00, 0x02, 0x56, 0x9d, 0x84, 0x76, 0x9d, 0x93, 0x8c, 0x04, 0x19, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x04, 0x11, 0x29, 0x3a, 0x05, 0xe4, 0x10, 0x05, 0xe5, 0x10, 0x02, 0xe4, 0x10,
+  0x83, 0x66, 0x29, 0x8f, 0x63, 0xf5, 0x8c, 0x02, 0x77, 0x95, 0x84, 0x97, 0x9d, 0x00, 0x00, 0xd8, 0xb5, 0x4e, 0x63, 0x02, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x07, 0x04, 0x11, 0x05, 0x04, 0x19, 0x05,
+  0xe4, 0x10, 0x83, 0x04, 0x19, 0xe4, 0x10, 0xf0, 0x73, 0x0d, 0x00, 0x00, 0x81, 0xf0, 0x73, 0x02, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x0a, 0x05, 0x19, 0x06, 0x05, 0x11, 0x84, 0x87, 0x29, 0x2d, 0x5b,
+  0x00, 0x00, 0x49, 0x42, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x81, 0x39, 0xc6, 0x02, 0xdf, 0xf7, 0x0b, 0xdf, 0xff, 0x82, 0xbe, 0xf7, 0x66, 0x29, 0x05, 0xe4, 0x10, 0x81, 0x11, 0x74, 0x02, 0x98,
+  0x9d, 0x82, 0x57, 0x95, 0xf5, 0x8c, 0x11, 0x00, 0x00, 0x84, 0x76, 0xa5, 0x97, 0xad, 0x4a, 0x42, 0xe4, 0x10, 0x04, 0x05, 0x11, 0x06, 0xe4, 0x10, 0x03, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x83, 0xe8,
+  0x31, 0xf0, 0x73, 0x36, 0x95, 0x02, 0x77, 0x95, 0x02, 0x98, 0x95, 0x87, 0x97, 0x9d, 0x00, 0x00, 0xb7, 0xad, 0x76, 0xa5, 0x29, 0x3a, 0x05, 0x19, 0x04, 0x19, 0x02, 0x04, 0x11, 0x02, 0x04, 0x19,
+  0x02, 0x04, 0x11, 0x82, 0x05, 0x11, 0x04, 0x11, 0x04, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x84, 0x04, 0x19, 0xe4, 0x10, 0x29, 0x3a, 0xdd, 0xce, 0x0c, 0x00, 0x00, 0x81, 0x10, 0x7c, 0x03, 0xe4, 0x10,
+  0x02, 0x04, 0x11, 0x81, 0x04, 0x19, 0x02, 0x05, 0x19, 0x02, 0x04, 0x19, 0x04, 0x05, 0x19, 0x06, 0x05, 0x11, 0x85, 0x05, 0x19, 0x6e, 0x63, 0xd8, 0xad, 0x00, 0x00, 0x05, 0x19, 0x02, 0xe4, 0x10,
+  0x02, 0x05, 0x11, 0x84, 0x04, 0x11, 0x59, 0xc6, 0xdf, 0xff, 0xdf, 0xf7, 0x0b, 0xdf, 0xff, 0x81, 0xfb, 0xde, 0x05, 0xe4, 0x10, 0x85, 0xc4, 0x08, 0x16, 0x8d, 0x78, 0x95, 0x57, 0x95, 0xb4, 0x84,
+  0x13, 0x00, 0x00, 0x83, 0xd8, 0xad, 0xcc, 0x52, 0x05, 0x19, 0x05, 0x05, 0x11, 0x06, 0xe4, 0x10, 0x85, 0x04, 0x11, 0xe4, 0x10, 0x4a, 0x42, 0x52, 0x7c, 0x36, 0x95, 0x02, 0x77, 0x95, 0x81, 0x77,
+  0x9d, 0x02, 0x98, 0x9d, 0x82, 0xb8, 0x9d, 0xd8, 0xa5, 0x02, 0x00, 0x00, 0x86, 0xb7, 0xad, 0x72, 0x84, 0xa7, 0x29, 0x04, 0x19, 0x04, 0x11, 0x05, 0x11, 0x02, 0x05, 0x19, 0x83, 0x05, 0x11, 0x04,
+  0x11, 0x05, 0x11, 0x04, 0x04, 0x19, 0x06, 0xe4, 0x10, 0x84, 0x04, 0x19, 0x04, 0x11, 0x46, 0x21, 0x57, 0x9d, 0x0c, 0x00, 0x00, 0x81, 0x51, 0x7c, 0x03, 0xe4, 0x10, 0x04, 0x04, 0x19, 0x81, 0x05,
+  0x19, 0x02, 0x04, 0x19, 0x03, 0x05, 0x19, 0x03, 0x05, 0x11, 0x81, 0x05, 0x19, 0x02, 0x05, 0x11, 0x83, 0x04, 0x19, 0x2d, 0x5b, 0x97, 0xa5, 0x02, 0xb7, 0xad, 0x81, 0x86, 0x29, 0x02, 0xe4, 0x10,
+  0x03, 0x05, 0x11, 0x83, 0x9a, 0xce, 0xdf, 0xf7, 0xff, 0xf7, 0x0b, 0xdf, 0xff, 0x81, 0x59, 0xc6, 0x03, 0xe4, 0x10, 0x02, 0xc4, 0x10, 0x81, 0x67, 0x29, 0x02, 0x57, 0x95, 0x81, 0x97, 0x9d, 0x15,
+  0x00, 0x00, 0x82, 0x35, 0x9d, 0x29, 0x3a, 0x08, 0x05, 0x11, 0x85, 0xe5, 0x10, 0xe4, 0x10, 0xa7, 0x29, 0x2d, 0x5b, 0xb4, 0x84, 0x04, 0x77, 0x9d, 0x81, 0x97, 0x9d, 0x02, 0x98, 0x9d, 0x82, 0xb8,
+  0xa5, 0xd8, 0xa5, 0x03, 0x00, 0x00, 0x85, 0xd8, 0xb5, 0x97, 0xad, 0xcc, 0x4a, 0xe4, 0x10, 0x04, 0x19, 0x03, 0x05, 0x19, 0x81, 0x05, 0x11, 0x02, 0x05, 0x19, 0x04, 0x04, 0x19, 0x06, 0xe4, 0x10,
+  0x84, 0x04, 0x19, 0x04, 0x11, 0x87, 0x29, 0x9c, 0xc6, 0x0c, 0x00, 0x00, 0x82, 0x76, 0xa5, 0x4d, 0x63, 0x02, 0xe4, 0x10, 0x07, 0x04, 0x19, 0x02, 0x04, 0x11, 0x81, 0x04, 0x19, 0x03, 0x04, 0x11,
+  0x81, 0x04, 0x19, 0x02, 0x05, 0x19, 0x86, 0x66, 0x21, 0x36, 0x95, 0x97, 0xa5, 0x00, 0x00, 0xd4, 0x94, 0xa7, 0x29, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x81, 0xdb, 0xd6, 0x02, 0xdf, 0xf7, 0x0b,
+  0xdf, 0xff, 0x82, 0x18, 0xbe, 0xe4, 0x18, 0x04, 0xe4, 0x10, 0x84, 0x87, 0x29, 0x57, 0x95, 0x36, 0x95, 0x3a, 0xb6, 0x16, 0x00, 0x00, 0x81, 0xab, 0x4a, 0x06, 0x05, 0x11, 0x86, 0x25, 0x19, 0x6a,
+  0x42, 0xd0, 0x6b, 0xb4, 0x84, 0x57, 0x9d, 0x77, 0x9d, 0x02, 0x97, 0x9d, 0x81, 0x77, 0x9d, 0x02, 0x97, 0x9d, 0x81, 0x98, 0x9d, 0x02, 0xb8, 0xa5, 0x81, 0xd8, 0xa5, 0x05, 0x00, 0x00, 0x84, 0x97,
+  0xa5, 0x56, 0x9d, 0x09, 0x3a, 0x04, 0x19, 0x07, 0x05, 0x19, 0x02, 0x04, 0x19, 0x06, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82, 0x66, 0x21, 0xec, 0x52, 0x0e, 0x00, 0x00, 0x84, 0xbb, 0xce, 0x0c, 0x53,
+  0xa7, 0x29, 0x05, 0x11, 0x03, 0x04, 0x19, 0x03, 0x05, 0x19, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0x05, 0x11, 0x04, 0x05, 0x19, 0x86, 0xf0, 0x73, 0x77, 0x9d, 0x97, 0xa5, 0x00, 0x00, 0x52,
+  0x7c, 0x86, 0x29, 0x02, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x83, 0xe5, 0x10, 0xdb, 0xd6, 0xdf, 0xf7, 0x0c, 0xdf, 0xff, 0x81, 0x38, 0xc6, 0x05, 0xe4, 0x10, 0x81, 0xc4, 0x10, 0x02, 0x36, 0x95, 0x17,
+  0x00, 0x00, 0x81, 0x11, 0x7c, 0x02, 0xed, 0x52, 0x87, 0x2e, 0x5b, 0x4e, 0x5b, 0xd0, 0x6b, 0x52, 0x7c, 0xf5, 0x8c, 0x56, 0x95, 0x57, 0x95, 0x03, 0x77, 0x9d, 0x02, 0x97, 0x9d, 0x82, 0x98, 0x9d,
+  0x98, 0xa5, 0x02, 0xb8, 0xa5, 0x81, 0xb8, 0xad, 0x08, 0x00, 0x00, 0x82, 0x97, 0xa5, 0x2d, 0x5b, 0x08, 0x05, 0x19, 0x02, 0x04, 0x19, 0x06, 0xe4, 0x10, 0x84, 0x04, 0x19, 0x2e, 0x5b, 0x36, 0x95,
+  0xb8, 0xa5, 0x10, 0x00, 0x00, 0x82, 0x72, 0x84, 0x2d, 0x5b, 0x06, 0x05, 0x19, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0x05, 0x11, 0x03, 0x05, 0x19, 0x87, 0xc7, 0x29, 0x56, 0x95, 0x77, 0x9d,
+  0x97, 0xa5, 0x00, 0x00, 0x15, 0x9d, 0xa7, 0x31, 0x03, 0xe4, 0x10, 0x84, 0xe5, 0x10, 0xe4, 0x10, 0xba, 0xce, 0xdf, 0xf7, 0x0c, 0xdf, 0xff, 0x82, 0xdb, 0xd6, 0xc3, 0x10, 0x03, 0xe4, 0x10, 0x02,
+  0xc4, 0x10, 0x82, 0xf0, 0x73, 0x97, 0xa5, 0x18, 0x00, 0x00, 0x89, 0x52, 0x7c, 0x94, 0x7c, 0xb5, 0x84, 0xf5, 0x84, 0x15, 0x8d, 0x36, 0x8d, 0x36, 0x95, 0x57, 0x95, 0x57, 0x9d, 0x03, 0x77, 0x9d,
+  0x82, 0x97, 0x9d, 0x97, 0xa5, 0x02, 0xb8, 0xa5, 0x0b, 0x00, 0x00, 0x83, 0xd8, 0xad, 0xb7, 0xa5, 0x6a, 0x42, 0x05, 0x05, 0x19, 0x03, 0x05, 0x11, 0x81, 0x05, 0x19, 0x05, 0xe4, 0x10, 0x85, 0x8b,
+  0x4a, 0xd4, 0x8c, 0x97, 0x9d, 0xb8, 0xa5, 0xd8, 0xa5, 0x10, 0x00, 0x00, 0x85, 0xb7, 0xad, 0x97, 0xad, 0x93, 0x8c, 0xe8, 0x31, 0x05, 0x19, 0x03, 0x04, 0x19, 0x82, 0x05, 0x11, 0x04, 0x11, 0x02,
+  0x05, 0x19, 0x81, 0x05, 0x11, 0x03, 0x05, 0x19, 0x81, 0xf1, 0x73, 0x02, 0x77, 0x9d, 0x02, 0x00, 0x00, 0x82, 0xfc, 0xd6, 0x04, 0x19, 0x03, 0xe4, 0x10, 0x83, 0xe5, 0x10, 0xe4, 0x10, 0x59, 0xc6,
+  0x02, 0xdf, 0xf7, 0x0b, 0xdf, 0xff, 0x82, 0xbe, 0xf7, 0xc7, 0x31, 0x05, 0xe4, 0x10, 0x82, 0x45, 0x21, 0xb7, 0xad, 0x18, 0x00, 0x00, 0x89, 0x15, 0x8d, 0x94, 0x7c, 0xd5, 0x84, 0xf5, 0x8c, 0x15,
+  0x8d, 0x36, 0x95, 0x56, 0x95, 0x57, 0x95, 0x57, 0x9d, 0x03, 0x77, 0x9d, 0x82, 0x97, 0x9d, 0x98, 0xa5, 0x0e, 0x00, 0x00, 0x83, 0xb8, 0xad, 0xaf, 0x6b, 0x87, 0x29, 0x04, 0x05, 0x19, 0x03, 0x05,
+  0x11, 0x81, 0x05, 0x19, 0x03, 0xe4, 0x10, 0x86, 0x66, 0x21, 0x11, 0x74, 0x77, 0x9d, 0x97, 0x9d, 0x98, 0x9d, 0xb8, 0xa5, 0x11, 0x00, 0x00, 0x86, 0x77, 0xa5, 0x76, 0xa5, 0x97, 0xa5, 0x76, 0xa5,
+  0x2d, 0x5b, 0x25, 0x19, 0x02, 0xe4, 0x18, 0x82, 0x04, 0x19, 0x04, 0x11, 0x03, 0x05, 0x11, 0x02, 0x05, 0x19, 0x84, 0xa7, 0x29, 0x56, 0x95, 0x77, 0x9d, 0x56, 0x9d, 0x03, 0x00, 0x00, 0x81, 0x86,
+  0x21, 0x05, 0xe4, 0x10, 0x82, 0x18, 0xbe, 0xdf, 0xf7, 0x0d, 0xdf, 0xff, 0x81, 0xb2, 0x94, 0x02, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x83, 0xc4, 0x10, 0x8b, 0x4a, 0xf9, 0xb5, 0x16, 0x00, 0x00, 0x02,
+  0xbc, 0xc6, 0x8a, 0x3a, 0xb6, 0x77, 0x9d, 0x16, 0x95, 0x16, 0x8d, 0x36, 0x95, 0x57, 0x9d, 0x77, 0x9d, 0x97, 0x9d, 0x97, 0xa5, 0x97, 0xad, 0x13, 0x00, 0x00, 0x81, 0xab, 0x4a, 0x09, 0x05, 0x19,
+  0x88, 0xe4, 0x10, 0xec, 0x52, 0xf4, 0x94, 0x57, 0x9d, 0x77, 0x9d, 0x97, 0x9d, 0x98, 0xa5, 0xb8, 0xa5, 0x12, 0x00, 0x00, 0x86, 0x56, 0x9d, 0x76, 0x9d, 0x97, 0xa5, 0xb8, 0xa5, 0x73, 0x7c, 0xa7,
+  0x29, 0x02, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x03, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0x4e, 0x5b, 0x02, 0x77, 0x9d, 0x81, 0x56, 0x95, 0x03, 0x00, 0x00, 0x81, 0x8a, 0x4a, 0x05, 0xe4, 0x10, 0x81,
+  0x55, 0xa5, 0x02, 0xdf, 0xf7, 0x0c, 0xdf, 0xff, 0x83, 0xfc, 0xde, 0xe4, 0x18, 0xc4, 0x10, 0x05, 0xe4, 0x10, 0x84, 0xab, 0x4a, 0xb4, 0x8c, 0xf8, 0xad, 0xd8, 0xad, 0x12, 0x00, 0x00, 0x8a, 0xbc,
+  0xc6, 0xdc, 0xc6, 0xfc, 0xce, 0xfd, 0xce, 0xdd, 0xce, 0xdc, 0xce, 0x5e, 0xdf, 0xf8, 0xb5, 0xf8, 0xad, 0xf8, 0xb5, 0x16, 0x00, 0x00, 0x82, 0xd0, 0x73, 0x46, 0x19, 0x07, 0x05, 0x19, 0x83, 0xc8,
+  0x31, 0x31, 0x7c, 0x36, 0x95, 0x02, 0x56, 0x9d, 0x83, 0x77, 0x9d, 0x77, 0xa5, 0x98, 0xa5, 0x14, 0x00, 0x00, 0x82, 0x97, 0xa5, 0x77, 0x9d, 0x02, 0xb8, 0xa5, 0x85, 0x98, 0x9d, 0xcc, 0x4a, 0xe4,
+  0x10, 0x05, 0x19, 0x04, 0x11, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0xe5, 0x10, 0xf4, 0x8c, 0x02, 0x77, 0x9d, 0x81, 0x97, 0xa5, 0x03, 0x00, 0x00, 0x82, 0x29, 0x3a, 0x04, 0x11, 0x04, 0xe4, 0x10,
+  0x82, 0x31, 0x7c, 0xdf, 0xf7, 0x0e, 0xdf, 0xff, 0x83, 0x71, 0x8c, 0xc3, 0x10, 0xc4, 0x10, 0x05, 0xe4, 0x10, 0x83, 0x09, 0x32, 0xcc, 0x4a, 0x31, 0x74, 0x02, 0x52, 0x7c, 0x84, 0x31, 0x74, 0xf0,
+  0x6b, 0xaf, 0x6b, 0x4e, 0x5b, 0x02, 0xec, 0x4a, 0x85, 0xcb, 0x4a, 0x8a, 0x42, 0x49, 0x3a, 0xe8, 0x31, 0xa7, 0x29, 0x02, 0x87, 0x21, 0x8a, 0xe8, 0x31, 0x4a, 0x3a, 0xa7, 0x21, 0x4d, 0x5b, 0x15,
+  0x8d, 0x97, 0x9d, 0x19, 0xae, 0xbc, 0xc6, 0xfd, 0xce, 0xdc, 0xce, 0x1a, 0x00, 0x00, 0x81, 0x8a, 0x4a, 0x06, 0x05, 0x19, 0x84, 0x09, 0x3a, 0xf5, 0x94, 0x36, 0x95, 0x36, 0x9d, 0x02, 0x56, 0x9d,
+  0x82, 0x76, 0x9d, 0xb8, 0xa5, 0x16, 0x00, 0x00, 0x88, 0x77, 0xa5, 0x97, 0x9d, 0xb7, 0x9d, 0xf9, 0xa5, 0x8f, 0x63, 0xe4, 0x10, 0x04, 0x19, 0x04, 0x11, 0x03, 0x05, 0x19, 0x82, 0xe8, 0x31, 0x77,
+  0xa5, 0x02, 0x77, 0x9d, 0x04, 0x00, 0x00, 0x81, 0x4a, 0x42, 0x05, 0xe4, 0x10, 0x82, 0x6a, 0x4a, 0xdf, 0xf7, 0x0e, 0xdf, 0xff, 0x82, 0x7d, 0xef, 0x8a, 0x4a, 0x02, 0xc4, 0x10, 0x05, 0xe4, 0x10,
+  0x02, 0x04, 0x11, 0x07, 0x05, 0x11, 0x81, 0x04, 0x11, 0x06, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x04, 0x05, 0x11, 0x81, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x85, 0x46, 0x19, 0x0d, 0x53, 0x73, 0x84, 0x5a,
+  0xbe, 0xdc, 0xce, 0x18, 0x00, 0x00, 0x82, 0x0d, 0x53, 0x05, 0x11, 0x05, 0x05, 0x19, 0x82, 0x66, 0x21, 0x15, 0x95, 0x02, 0x36, 0x9d, 0x02, 0x56, 0x9d, 0x1a, 0x00, 0x00, 0x84, 0xb7, 0x9d, 0x7b,
+  0xbe, 0x26, 0x19, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x03, 0x05, 0x19, 0x84, 0x8f, 0x6b, 0x97, 0xa5, 0x77, 0x9d, 0x97, 0x9d, 0x04, 0x00, 0x00, 0x81, 0x8e, 0x63, 0x02, 0xe4, 0x10, 0x03, 0xe5, 0x10,
+  0x82, 0xe4, 0x10, 0x5d, 0xe7, 0x0f, 0xdf, 0xff, 0x82, 0xfb, 0xde, 0x04, 0x19, 0x02, 0xc4, 0x10, 0x05, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x05, 0x05, 0x11, 0x81, 0xe5, 0x10, 0x05, 0xe4, 0x10, 0x83,
+  0xe5, 0x10, 0xe5, 0x18, 0xe5, 0x10, 0x07, 0x05, 0x11, 0x03, 0x05, 0x19, 0x83, 0x09, 0x32, 0x2d, 0x53, 0x36, 0x9d, 0x17, 0x00, 0x00, 0x82, 0x31, 0x7c, 0xc8, 0x31, 0x06, 0x05, 0x19, 0x83, 0xb0,
+  0x6b, 0x77, 0xa5, 0x56, 0x9d, 0x1d, 0x00, 0x00, 0x81, 0x15, 0x9d, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x02, 0x05, 0x19, 0x82, 0x46, 0x21, 0xf5, 0x94, 0x02, 0x77, 0x9d, 0x05, 0x00, 0x00, 0x83,
+  0xf4, 0x94, 0xa7, 0x29, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x83, 0xe4, 0x10, 0xf8, 0xbd, 0xdf, 0xf7, 0x0f, 0xdf, 0xff, 0x82, 0xdb, 0xd6, 0x08, 0x3a, 0x02, 0xc4, 0x10, 0x04, 0xe4, 0x10, 0x03, 0x04,
+  0x11, 0x0e, 0xe4, 0x10, 0x06, 0x05, 0x11, 0x05, 0x05, 0x19, 0x83, 0xa7, 0x29, 0xac, 0x4a, 0x77, 0x9d, 0x16, 0x00, 0x00, 0x81, 0x8b, 0x4a, 0x02, 0x05, 0x19, 0x04, 0x04, 0x19, 0x82, 0xe8, 0x31,
+  0x77, 0xa5, 0x1d, 0x00, 0x00, 0x82, 0x1d, 0xd7, 0xd0, 0x73, 0x02, 0xe4, 0x10, 0x04, 0x05, 0x19, 0x81, 0x8a, 0x42, 0x03, 0x77, 0x9d, 0x06, 0x00, 0x00, 0x81, 0xe8, 0x31, 0x04, 0x05, 0x11, 0x83,
+  0x04, 0x11, 0xf0, 0x7b, 0xdf, 0xf7, 0x10, 0xdf, 0xff, 0x82, 0x3c, 0xe7, 0x8e, 0x6b, 0x02, 0xc4, 0x10, 0x14, 0xe4, 0x10, 0x08, 0x05, 0x11, 0x03, 0x05, 0x19, 0x02, 0x05, 0x11, 0x82, 0x29, 0x3a,
+  0xec, 0x52, 0x15, 0x00, 0x00, 0x82, 0xcc, 0x52, 0x05, 0x19, 0x05, 0x04, 0x19, 0x82, 0xe4, 0x10, 0x6f, 0x63, 0x1d, 0x00, 0x00, 0x83, 0xbb, 0xce, 0xe8, 0x31, 0x04, 0x11, 0x03, 0x04, 0x19, 0x85,
+  0x05, 0x19, 0x05, 0x11, 0xd0, 0x73, 0x77, 0x9d, 0x57, 0x9d, 0x07, 0x00, 0x00, 0x81, 0xab, 0x4a, 0x05, 0xe4, 0x10, 0x82, 0x25, 0x19, 0x3d, 0xe7, 0x11, 0xdf, 0xff, 0x84, 0xdf, 0xf7, 0xf7, 0xbd,
+  0x08, 0x3a, 0xc4, 0x08, 0x04, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x07, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x06, 0xe4, 0x10, 0x06, 0x05, 0x11, 0x83, 0x04, 0x11, 0x05, 0x19, 0xe5, 0x10, 0x02, 0x05, 0x19,
+  0x85, 0x05, 0x11, 0x05, 0x19, 0xe4, 0x18, 0x87, 0x29, 0xec, 0x52, 0x14, 0x00, 0x00, 0x82, 0x72, 0x84, 0x87, 0x29, 0x02, 0x04, 0x19, 0x81, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x82, 0xe4, 0x10, 0x29,
+  0x3a, 0x1d, 0x00, 0x00, 0x84, 0x35, 0x9d, 0x04, 0x11, 0x04, 0x19, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x85, 0x04, 0x11, 0xe4, 0x10, 0xb4, 0x8c, 0x77, 0x9d, 0x57, 0x9d, 0x07, 0x00, 0x00, 0x82, 0xf0,
+  0x73, 0x46, 0x21, 0x05, 0xe4, 0x10, 0x81, 0x35, 0xa5, 0x13, 0xdf, 0xff, 0x8b, 0xbe, 0xf7, 0x9a, 0xce, 0x55, 0xa5, 0x10, 0x7c, 0x6d, 0x6b, 0x49, 0x42, 0x6a, 0x4a, 0xc7, 0x31, 0x0c, 0x5b, 0x8e,
+  0x6b, 0xaf, 0x6b, 0x03, 0xcf, 0x6b, 0x05, 0xaf, 0x6b, 0x02, 0xcf, 0x73, 0x85, 0xcf, 0x6b, 0x8e, 0x6b, 0x8a, 0x42, 0x28, 0x3a, 0x25, 0x19, 0x04, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x03, 0xe4, 0x10,
+  0x02, 0x05, 0x19, 0x82, 0x46, 0x21, 0x29, 0x3a, 0x14, 0x00, 0x00, 0x82, 0x4a, 0x42, 0xe4, 0x18, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x82, 0x05, 0x11, 0x09, 0x3a, 0x1d, 0x00, 0x00, 0x81, 0x72,
+  0x84, 0x05, 0x04, 0x19, 0x83, 0x04, 0x11, 0x05, 0x19, 0x56, 0x9d, 0x02, 0x77, 0x9d, 0x08, 0x00, 0x00, 0x81, 0x29, 0x3a, 0x05, 0xe4, 0x10, 0x82, 0xe7, 0x31, 0x7e, 0xef, 0x15, 0xdf, 0xff, 0x06,
+  0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x07, 0xdf, 0xf7, 0x81, 0xbf, 0xf7, 0x06, 0xdf, 0xf7, 0x85, 0xbe, 0xf7, 0xbe, 0xef, 0x3c, 0xdf, 0xf7, 0xb5, 0x4d, 0x63, 0x06, 0xe4, 0x10, 0x81, 0x05, 0x19, 0x02,
+  0xe4, 0x10, 0x82, 0xec, 0x52, 0x8f, 0x63, 0x12, 0x00, 0x00, 0x82, 0xcc, 0x52, 0xe4, 0x18, 0x02, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x82, 0x08, 0x32, 0x76, 0xa5, 0x1c, 0x00, 0x00, 0x82, 0x51, 0x84,
+  0x05, 0x19, 0x05, 0x04, 0x19, 0x84, 0x29, 0x3a, 0x77, 0xa5, 0x77, 0x9d, 0x77, 0xa5, 0x08, 0x00, 0x00, 0x81, 0x2d, 0x5b, 0x06, 0xe4, 0x10, 0x81, 0x55, 0xa5, 0x1a, 0xdf, 0xff, 0x84, 0xdf, 0xf7,
+  0xbf, 0xf7, 0x3d, 0xe7, 0x7e, 0xe7, 0x03, 0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x02, 0xdf, 0xf7, 0x07, 0xdf, 0xff, 0x81, 0xdf, 0xf7, 0x02, 0xdf, 0xff, 0x83, 0xdf, 0xf7, 0x7a, 0xce, 0x4d, 0x63, 0x04,
+  0xe4, 0x10, 0x86, 0xe5, 0x18, 0x05, 0x19, 0x05, 0x11, 0x04, 0x11, 0xa7, 0x29, 0xa8, 0x29, 0x11, 0x00, 0x00, 0x81, 0x8f, 0x6b, 0x03, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x82, 0xe4, 0x10, 0x31, 0x74,
+  0x1b, 0x00, 0x00, 0x82, 0xfc, 0xce, 0x8a, 0x4a, 0x05, 0x05, 0x19, 0x84, 0xe4, 0x10, 0x4d, 0x63, 0x77, 0xa5, 0x77, 0x9d, 0x09, 0x00, 0x00, 0x82, 0x15, 0x95, 0x09, 0x3a, 0x05, 0xe4, 0x10, 0x82,
+  0x87, 0x29, 0x1c, 0xdf, 0x19, 0xdf, 0xff, 0x86, 0x9a, 0xce, 0x8a, 0x52, 0x83, 0x08, 0xc4, 0x10, 0x10, 0x7c, 0x3d, 0xe7, 0x02, 0xdf, 0xf7, 0x0e, 0xdf, 0xff, 0x83, 0xdf, 0xf7, 0x96, 0xad, 0x25,
+  0x19, 0x03, 0xe4, 0x10, 0x81, 0xe5, 0x18, 0x02, 0x05, 0x11, 0x83, 0x04, 0x11, 0x66, 0x21, 0xd9, 0xad, 0x10, 0x00, 0x00, 0x82, 0x31, 0x7c, 0x66, 0x21, 0x05, 0x04, 0x19, 0x82, 0xe4, 0x10, 0x2d,
+  0x5b, 0x1b, 0x00, 0x00, 0x82, 0x3d, 0xd7, 0xe8, 0x31, 0x04, 0x05, 0x19, 0x85, 0x05, 0x11, 0xe5, 0x10, 0x52, 0x84, 0x76, 0x9d, 0x77, 0x9d, 0x0a, 0x00, 0x00, 0x81, 0x4e, 0x63, 0x05, 0xe4, 0x10,
+  0x83, 0x04, 0x11, 0xaf, 0x73, 0xbf, 0xf7, 0x17, 0xdf, 0xff, 0x82, 0x9a, 0xd6, 0x25, 0x21, 0x04, 0xc4, 0x08, 0x83, 0x08, 0x3a, 0xfc, 0xde, 0xdf, 0xf7, 0x10, 0xdf, 0xff, 0x82, 0xba, 0xd6, 0x6a,
+  0x42, 0x04, 0xe4, 0x10, 0x85, 0x05, 0x11, 0x04, 0x11, 0x05, 0x11, 0xab, 0x4a, 0x56, 0x9d, 0x0f, 0x00, 0x00, 0x83, 0x76, 0xa5, 0x49, 0x42, 0x04, 0x11, 0x04, 0x04, 0x19, 0x82, 0x05, 0x19, 0xe8,
+  0x31, 0x10, 0x00, 0x00, 0x83, 0xfc, 0xce, 0x35, 0x95, 0x72, 0x7c, 0x02, 0x93, 0x7c, 0x88, 0xd3, 0x84, 0x14, 0x8d, 0xb3, 0x7c, 0x14, 0x8d, 0xd7, 0xa5, 0x00, 0x00, 0x97, 0xa5, 0x86, 0x21, 0x03,
+  0x05, 0x11, 0x84, 0x05, 0x19, 0x05, 0x11, 0xe4, 0x10, 0xd4, 0x8c, 0x02, 0x56, 0x9d, 0x0a, 0x00, 0x00, 0x82, 0xb7, 0xa5, 0x8b, 0x42, 0x04, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x81, 0x55, 0xa5, 0x07,
+  0xdf, 0xff, 0x0d, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x82, 0x9e, 0xf7, 0x49, 0x4a, 0x06, 0xc4, 0x08, 0x82, 0xec, 0x5a, 0xbf, 0xf7, 0x10, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x7d, 0xe7, 0x6e, 0x6b, 0xe4,
+  0x10, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x19, 0x81, 0x09, 0x3a, 0x10, 0x00, 0x00, 0x81, 0x8b, 0x4a, 0x05, 0x05, 0x19, 0x85, 0x05, 0x11, 0x6e, 0x63, 0x35, 0x8d, 0x97, 0x9d, 0x77, 0x9d,
+  0x03, 0x97, 0xa5, 0x86, 0x31, 0x74, 0xe8, 0x29, 0x46, 0x19, 0xa4, 0x00, 0x97, 0xa5, 0xdc, 0xce, 0x02, 0x00, 0x00, 0x84, 0xfc, 0xd6, 0xb7, 0xad, 0x0c, 0x5b, 0x46, 0x21, 0x05, 0x66, 0x21, 0x81,
+  0x86, 0x21, 0x02, 0x86, 0x29, 0x82, 0x04, 0x11, 0x86, 0x21, 0x04, 0x05, 0x11, 0x86, 0x05, 0x19, 0x05, 0x11, 0x25, 0x19, 0x36, 0x9d, 0x56, 0x9d, 0x36, 0x9d, 0x0a, 0x00, 0x00, 0x83, 0xb7, 0xa5,
+  0x35, 0x95, 0x87, 0x29, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82, 0x25, 0x19, 0x38, 0xc6, 0x02, 0xdf, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x10, 0xff, 0xff, 0x82, 0x79, 0xce, 0xc3, 0x10,
+  0x07, 0xc4, 0x08, 0x82, 0x9a, 0xce, 0xdf, 0xf7, 0x11, 0xdf, 0xff, 0x82, 0x9e, 0xef, 0xae, 0x73, 0x03, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x66, 0x21, 0x2d, 0x5b, 0x0f, 0x00, 0x00, 0x81, 0x29,
+  0x3a, 0x05, 0x05, 0x19, 0x03, 0x05, 0x11, 0x81, 0x04, 0x11, 0x03, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x86, 0x25, 0x21, 0xcc, 0x52, 0xbc, 0xce, 0x00, 0x00, 0x5a, 0xc6, 0x09, 0x3a,
+  0x03, 0xe4, 0x10, 0x04, 0x05, 0x11, 0x05, 0x05, 0x19, 0x06, 0x05, 0x11, 0x84, 0x08, 0x3a, 0x76, 0xa5, 0x56, 0x9d, 0x9b, 0xc6, 0x0a, 0x00, 0x00, 0x83, 0x77, 0xa5, 0x77, 0x9d, 0x31, 0x7c, 0x03,
+  0xe4, 0x10, 0x02, 0x04, 0x11, 0x83, 0x05, 0x11, 0x46, 0x21, 0x59, 0xc6, 0x14, 0xff, 0xff, 0x82, 0x18, 0xc6, 0xa3, 0x10, 0x06, 0xc4, 0x08, 0x82, 0xe4, 0x08, 0x39, 0xbe, 0x02, 0xdf, 0xf7, 0x11,
+  0xdf, 0xff, 0x85, 0xdf, 0xf7, 0x10, 0x84, 0xe4, 0x10, 0xe5, 0x10, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x66, 0x21, 0xcc, 0x52, 0x0e, 0x00, 0x00, 0x81, 0x8a, 0x4a, 0x04, 0x05, 0x19, 0x07, 0x05,
+  0x11, 0x02, 0x04, 0x19, 0x02, 0x05, 0x19, 0x87, 0xe5, 0x18, 0xe4, 0x10, 0x04, 0x11, 0xe4, 0x10, 0xf1, 0x73, 0xdd, 0xd6, 0xb3, 0x8c, 0x02, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02,
+  0x04, 0x11, 0x02, 0x05, 0x11, 0x03, 0x05, 0x19, 0x07, 0x05, 0x11, 0x83, 0xab, 0x4a, 0x77, 0xa5, 0x56, 0x9d, 0x0b, 0x00, 0x00, 0x85, 0x97, 0xa5, 0x76, 0x9d, 0x57, 0x9d, 0x8f, 0x63, 0xc4, 0x10,
+  0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x84, 0x05, 0x11, 0x46, 0x21, 0xf7, 0xb5, 0xdf, 0xff, 0x12, 0xff, 0xff, 0x82, 0x9a, 0xd6, 0xa4, 0x10, 0x03, 0xc4, 0x08, 0x02, 0xe4, 0x08, 0x83, 0xe5, 0x08,
+  0x46, 0x21, 0x1d, 0xdf, 0x02, 0xdf, 0xf7, 0x81, 0xff, 0xff, 0x11, 0xdf, 0xff, 0x82, 0xbd, 0xef, 0x8e, 0x73, 0x03, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x0d, 0x5b, 0xfd, 0xd6, 0x0d, 0x00, 0x00,
+  0x82, 0xf0, 0x73, 0xe4, 0x10, 0x02, 0x05, 0x19, 0x82, 0x05, 0x11, 0x04, 0x11, 0x06, 0x05, 0x11, 0x82, 0x04, 0x19, 0x04, 0x11, 0x04, 0x05, 0x11, 0x02, 0x04, 0x11, 0x85, 0x49, 0x42, 0x5a, 0xbe,
+  0x6a, 0x4a, 0xe4, 0x10, 0x04, 0x11, 0x03, 0x05, 0x11, 0x02, 0x04, 0x11, 0x0c, 0x05, 0x11, 0x81, 0x4d, 0x63, 0x02, 0x76, 0xa5, 0x0c, 0x00, 0x00, 0x84, 0x35, 0x95, 0x36, 0x95, 0x56, 0x9d, 0x29,
+  0x3a, 0x07, 0xe4, 0x10, 0x82, 0x72, 0x8c, 0x9e, 0xef, 0x11, 0xff, 0xff, 0x82, 0xbe, 0xf7, 0xab, 0x52, 0x02, 0xc4, 0x08, 0x02, 0xe4, 0x10, 0x83, 0xe5, 0x08, 0xe5, 0x10, 0x14, 0x9d, 0x03, 0xdf,
+  0xf7, 0x02, 0xff, 0xff, 0x10, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x7d, 0xef, 0x6a, 0x4a, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x26, 0x19, 0x2d, 0x5b, 0x0d, 0x00, 0x00, 0x82, 0x6a, 0x42, 0x25,
+  0x19, 0x02, 0x05, 0x19, 0x02, 0x04, 0x11, 0x05, 0x05, 0x11, 0x83, 0x04, 0x11, 0x04, 0x19, 0x04, 0x11, 0x07, 0x05, 0x11, 0x82, 0x97, 0xa5, 0x4d, 0x63, 0x02, 0xe4, 0x10, 0x07, 0x05, 0x11, 0x02,
+  0x04, 0x11, 0x08, 0x05, 0x11, 0x81, 0x0d, 0x5b, 0x02, 0x76, 0xa5, 0x0d, 0x00, 0x00, 0x81, 0xf5, 0x8c, 0x02, 0x36, 0x95, 0x82, 0x4a, 0x42, 0xc4, 0x10, 0x06, 0xe4, 0x10, 0x82, 0xab, 0x52, 0x7a,
+  0xce, 0x11, 0xff, 0xff, 0x83, 0xdb, 0xd6, 0xe8, 0x39, 0xe4, 0x08, 0x02, 0xe4, 0x10, 0x84, 0xe5, 0x10, 0x2d, 0x63, 0x7e, 0xef, 0xbf, 0xf7, 0x02, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x10, 0xdf, 0xff,
+  0x82, 0x9a, 0xce, 0x05, 0x19, 0x03, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x82, 0x09, 0x3a, 0x35, 0x9d, 0x0c, 0x00, 0x00, 0x84, 0x92, 0x84, 0xa7, 0x29, 0x05, 0x11, 0x05, 0x19, 0x02, 0x04, 0x19, 0x02,
+  0x04, 0x11, 0x03, 0x05, 0x11, 0x83, 0x04, 0x11, 0x04, 0x19, 0x04, 0x11, 0x06, 0x05, 0x11, 0x83, 0xe4, 0x10, 0x35, 0x9d, 0xaf, 0x6b, 0x02, 0xe4, 0x10, 0x07, 0x05, 0x11, 0x02, 0x04, 0x11, 0x08,
+  0x05, 0x11, 0x83, 0xd0, 0x73, 0x76, 0x9d, 0x76, 0xa5, 0x0d, 0x00, 0x00, 0x85, 0xd4, 0x8c, 0x15, 0x8d, 0x56, 0x9d, 0x36, 0x95, 0x29, 0x3a, 0x08, 0xe4, 0x10, 0x82, 0x10, 0x7c, 0x3c, 0xe7, 0x0f,
+  0xff, 0xff, 0x87, 0xdf, 0xff, 0x3d, 0xe7, 0x14, 0x9d, 0x2d, 0x63, 0xaf, 0x73, 0x75, 0xad, 0x7e, 0xef, 0x02, 0xdf, 0xf7, 0x05, 0xff, 0xff, 0x11, 0xdf, 0xff, 0x82, 0xff, 0xff, 0xf3, 0x9c, 0x04,
+  0xe4, 0x10, 0x83, 0x05, 0x11, 0xe4, 0x10, 0x32, 0x7c, 0x0c, 0x00, 0x00, 0x84, 0xf8, 0xb5, 0x08, 0x3a, 0x05, 0x11, 0x05, 0x19, 0x02, 0x04, 0x19, 0x02, 0x04, 0x11, 0x03, 0x05, 0x11, 0x04, 0xe4,
+  0x10, 0x06, 0x05, 0x11, 0x82, 0x29, 0x3a, 0xec, 0x52, 0x02, 0xe4, 0x10, 0x05, 0x04, 0x11, 0x03, 0x05, 0x19, 0x02, 0x04, 0x19, 0x81, 0x04, 0x11, 0x06, 0x05, 0x11, 0x83, 0x31, 0x74, 0x76, 0xa5,
+  0x97, 0xa5, 0x0e, 0x00, 0x00, 0x85, 0x15, 0x8d, 0x35, 0x95, 0x56, 0x9d, 0x36, 0x9d, 0x8b, 0x4a, 0x09, 0xe4, 0x10, 0x83, 0x30, 0x84, 0x79, 0xce, 0xbe, 0xf7, 0x0c, 0xff, 0xff, 0x81, 0xdf, 0xff,
+  0x06, 0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x11, 0xdf, 0xff, 0x82, 0x9e, 0xef, 0x6a, 0x4a, 0x04, 0xe4, 0x10, 0x83, 0xe5, 0x10, 0x4a, 0x42, 0x3a, 0xbe, 0x0c, 0x00, 0x00, 0x82, 0x25,
+  0x19, 0x05, 0x19, 0x02, 0x04, 0x19, 0x81, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x0a, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x25, 0x19, 0x6e, 0x63, 0x02, 0xe4, 0x10, 0x05, 0x04, 0x11, 0x03, 0xe4, 0x10,
+  0x02, 0x04, 0x19, 0x81, 0x04, 0x11, 0x05, 0x05, 0x11, 0x84, 0x05, 0x19, 0x31, 0x7c, 0x76, 0xa5, 0x77, 0xa5, 0x0f, 0x00, 0x00, 0x82, 0x15, 0x95, 0x36, 0x95, 0x02, 0x56, 0x9d, 0x81, 0x4e, 0x5b,
+  0x09, 0xe4, 0x10, 0x91, 0xc4, 0x10, 0x87, 0x29, 0x31, 0x84, 0xb6, 0xb5, 0x59, 0xc6, 0xba, 0xd6, 0xfb, 0xde, 0xfc, 0xde, 0x1c, 0xdf, 0xdb, 0xde, 0x9a, 0xce, 0x59, 0xc6, 0x38, 0xc6, 0x18, 0xbe,
+  0xf8, 0xbd, 0xb6, 0xb5, 0x75, 0xad, 0x02, 0x55, 0xa5, 0x87, 0x14, 0x9d, 0x15, 0x9d, 0x76, 0xad, 0xf8, 0xbd, 0x9a, 0xd6, 0x5d, 0xe7, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x11, 0xdf, 0xff, 0x81, 0xf8,
+  0xbd, 0x05, 0xe4, 0x10, 0x82, 0x05, 0x19, 0x72, 0x84, 0x0c, 0x00, 0x00, 0x83, 0x05, 0x19, 0x04, 0x19, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x0a, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82,
+  0x05, 0x19, 0x4e, 0x63, 0x02, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x07, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x04, 0x05, 0x11, 0x84, 0x05, 0x19, 0x31, 0x7c, 0x76, 0xa5, 0x97, 0xad, 0x10, 0x00, 0x00, 0x86,
+  0xb3, 0x84, 0x16, 0x95, 0x56, 0x95, 0x36, 0x9d, 0x52, 0x7c, 0x87, 0x29, 0x0b, 0xe4, 0x10, 0x03, 0xc4, 0x10, 0x04, 0xc3, 0x10, 0x82, 0xc4, 0x10, 0xc3, 0x10, 0x02, 0xe4, 0x10, 0x81, 0xc4, 0x10,
+  0x08, 0xe4, 0x10, 0x84, 0x04, 0x19, 0x2d, 0x63, 0xd7, 0xb5, 0x9e, 0xf7, 0x06, 0xff, 0xff, 0x0d, 0xdf, 0xff, 0x82, 0xbf, 0xf7, 0x49, 0x42, 0x04, 0xe4, 0x10, 0x83, 0x04, 0x11, 0x4e, 0x63, 0xfd,
+  0xd6, 0x0b, 0x00, 0x00, 0x81, 0x05, 0x19, 0x06, 0x04, 0x11, 0x04, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x03, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x81,
+  0xec, 0x52, 0x0c, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x04, 0x05, 0x11, 0x84, 0x05, 0x19, 0x11, 0x74, 0x76, 0xa5, 0xb7, 0xad, 0x11, 0x00, 0x00, 0x81, 0xb4, 0x8c, 0x03, 0x36, 0x95, 0x83, 0x15, 0x8d,
+  0x4e, 0x5b, 0xe4, 0x08, 0x20, 0xe4, 0x10, 0x84, 0x86, 0x29, 0x96, 0xad, 0xbf, 0xf7, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x0e, 0xdf, 0xff, 0x81, 0x76, 0xad, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82,
+  0xa7, 0x29, 0xf9, 0xb5, 0x0a, 0x00, 0x00, 0x82, 0xbb, 0xce, 0x46, 0x21, 0x06, 0x04, 0x11, 0x03, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x09, 0xe4, 0x10, 0x82, 0x05, 0x11, 0x0c, 0x53, 0x0b, 0xe4, 0x10,
+  0x81, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x05, 0x05, 0x11, 0x83, 0xaf, 0x6b, 0x96, 0xa5, 0xd8, 0xb5, 0x12, 0x00, 0x00, 0x82, 0x93, 0x84, 0xf5, 0x8c, 0x02, 0x36, 0x95, 0x85, 0x77, 0x9d, 0xd4, 0x84,
+  0x8b, 0x4a, 0xc4, 0x10, 0xe5, 0x10, 0x1f, 0xe4, 0x10, 0x82, 0x6e, 0x6b, 0x3d, 0xe7, 0x03, 0xff, 0xff, 0x0e, 0xdf, 0xff, 0x82, 0x5d, 0xe7, 0x25, 0x21, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82,
+  0xe4, 0x10, 0x52, 0x84, 0x0a, 0x00, 0x00, 0x82, 0x5a, 0xbe, 0x08, 0x3a, 0x06, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x08, 0xe4, 0x10, 0x83, 0x04, 0x11, 0x05, 0x19, 0x0d, 0x5b, 0x0b,
+  0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x05, 0x05, 0x11, 0x83, 0x4e, 0x63, 0x96, 0xa5, 0xd8, 0xb5, 0x13, 0x00, 0x00, 0x84, 0x52, 0x7c, 0xf5, 0x94, 0x16, 0x95, 0x57, 0x9d, 0x02, 0x77,
+  0x9d, 0x83, 0xb4, 0x84, 0xec, 0x52, 0x05, 0x19, 0x1e, 0xe4, 0x10, 0x83, 0x05, 0x11, 0x09, 0x3a, 0x9a, 0xce, 0x02, 0xff, 0xff, 0x0f, 0xdf, 0xff, 0x81, 0x10, 0x7c, 0x03, 0xe4, 0x10, 0x02, 0x04,
+  0x11, 0x81, 0x0d, 0x5b, 0x0a, 0x00, 0x00, 0x82, 0x59, 0xbe, 0x86, 0x29, 0x09, 0x04, 0x11, 0x0b, 0xe4, 0x10, 0x81, 0xab, 0x52, 0x0b, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x05, 0x05,
+  0x11, 0x83, 0xec, 0x52, 0x97, 0xad, 0xd7, 0xb5, 0x15, 0x00, 0x00, 0x82, 0x15, 0x95, 0x36, 0x95, 0x02, 0x77, 0x9d, 0x87, 0x77, 0x95, 0x77, 0x9d, 0x36, 0x8d, 0x32, 0x74, 0xec, 0x4a, 0x25, 0x19,
+  0xc4, 0x10, 0x1a, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x82, 0x66, 0x29, 0x9a, 0xce, 0x0f, 0xdf, 0xff, 0x83, 0xff, 0xff, 0xf7, 0xbd, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x83, 0x05, 0x11, 0xc8, 0x31, 0x52,
+  0x7c, 0x09, 0x00, 0x00, 0x82, 0xb7, 0xad, 0x25, 0x19, 0x08, 0x04, 0x11, 0x08, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x03, 0xe4, 0x10, 0x81, 0xcb, 0x52, 0x0b, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0xe4,
+  0x10, 0x05, 0x05, 0x11, 0x83, 0x29, 0x3a, 0x97, 0xad, 0xd7, 0xb5, 0x16, 0x00, 0x00, 0x83, 0x36, 0x95, 0x15, 0x8d, 0x56, 0x95, 0x02, 0x78, 0x9d, 0x03, 0x98, 0x9d, 0x8c, 0x57, 0x95, 0xb4, 0x84,
+  0xf0, 0x73, 0x8f, 0x63, 0x2d, 0x5b, 0x0d, 0x53, 0xec, 0x52, 0xab, 0x4a, 0x4a, 0x3a, 0xe8, 0x31, 0xa7, 0x29, 0x87, 0x21, 0x02, 0x66, 0x21, 0x02, 0x67, 0x21, 0x87, 0x46, 0x21, 0x67, 0x21, 0xa8,
+  0x29, 0x29, 0x3a, 0x6a, 0x42, 0xe8, 0x31, 0x66, 0x21, 0x06, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x82, 0xe8, 0x39, 0x3d, 0xe7, 0x0f, 0xdf, 0xff, 0x82, 0x1c, 0xe7, 0xc4, 0x08, 0x03, 0xe4, 0x10, 0x83,
+  0x05, 0x11, 0x25, 0x19, 0x92, 0x84, 0x09, 0x00, 0x00, 0x82, 0x76, 0xa5, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x06, 0x04, 0x11, 0x0c, 0xe4, 0x10, 0x81, 0xe8, 0x31, 0x0b, 0xe4, 0x10, 0x81, 0x04, 0x11,
+  0x02, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x04, 0x05, 0x11, 0x83, 0x66, 0x21, 0x76, 0xa5, 0xd7, 0xb5, 0x18, 0x00, 0x00, 0x82, 0x36, 0x95, 0x57, 0x9d, 0x02, 0x98, 0xa5, 0x04, 0x98, 0x9d, 0x04, 0x97,
+  0x9d, 0x05, 0x98, 0xa5, 0x82, 0x97, 0xa5, 0x98, 0xa5, 0x02, 0x97, 0xa5, 0x81, 0xb7, 0xa5, 0x02, 0x97, 0xa5, 0x82, 0x97, 0x9d, 0x97, 0xa5, 0x02, 0xb7, 0xa5, 0x84, 0x97, 0xa5, 0xd4, 0x8c, 0xab,
+  0x4a, 0xe5, 0x10, 0x03, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0xf0, 0x7b, 0xdf, 0xf7, 0x0e, 0xdf, 0xff, 0x82, 0xdf, 0xf7, 0xe8, 0x39, 0x03, 0xe4, 0x10, 0x83, 0x05, 0x11, 0xe4, 0x10,
+  0x8e, 0x63, 0x09, 0x00, 0x00, 0x82, 0x72, 0x84, 0x04, 0x11, 0x03, 0x04, 0x19, 0x03, 0x04, 0x11, 0x0c, 0xe4, 0x10, 0x83, 0x05, 0x11, 0x46, 0x19, 0xe8, 0x31, 0x0e, 0xe4, 0x10, 0x02, 0x05, 0x11,
+  0x02, 0x05, 0x19, 0x84, 0x05, 0x11, 0xe5, 0x10, 0xf4, 0x9c, 0xb7, 0xb5, 0x19, 0x00, 0x00, 0x81, 0xdc, 0xce, 0x02, 0xb7, 0xa5, 0x04, 0xb8, 0xa5, 0x81, 0x98, 0xa5, 0x03, 0x97, 0xa5, 0x05, 0xb7,
+  0xa5, 0x02, 0xb8, 0xa5, 0x02, 0xb7, 0xa5, 0x02, 0xb8, 0xa5, 0x02, 0xb7, 0xa5, 0x81, 0x98, 0xa5, 0x03, 0xb7, 0xa5, 0x84, 0xb8, 0xa5, 0xb7, 0xa5, 0xaf, 0x6b, 0x05, 0x11, 0x03, 0xe4, 0x10, 0x81,
+  0xe5, 0x18, 0x02, 0x05, 0x19, 0x81, 0x59, 0xc6, 0x0e, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x6d, 0x6b, 0x02, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x82, 0xe4, 0x10, 0xcc, 0x52, 0x09, 0x00, 0x00, 0x82, 0x52,
+  0x84, 0x05, 0x19, 0x05, 0x04, 0x19, 0x0c, 0xe4, 0x10, 0x86, 0xe5, 0x10, 0xc8, 0x31, 0x15, 0x95, 0x0d, 0x5b, 0x66, 0x21, 0xe5, 0x10, 0x0a, 0xe4, 0x10, 0x82, 0xe5, 0x10, 0xe4, 0x10, 0x02, 0x04,
+  0x19, 0x03, 0x05, 0x19, 0x83, 0xe5, 0x18, 0x11, 0x7c, 0xb7, 0xad, 0x1d, 0x00, 0x00, 0x81, 0xd8, 0xad, 0x02, 0xb7, 0xa5, 0x18, 0xb8, 0xa5, 0x82, 0x52, 0x7c, 0x05, 0x19, 0x02, 0xe4, 0x10, 0x81,
+  0xe5, 0x18, 0x02, 0x05, 0x19, 0x82, 0x2d, 0x63, 0xdf, 0xf7, 0x0e, 0xdf, 0xff, 0x81, 0xd3, 0x94, 0x02, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x81, 0xe8, 0x31, 0x08, 0x00, 0x00, 0x83, 0xfc, 0xd6, 0xf0,
+  0x73, 0x05, 0x11, 0x04, 0x04, 0x19, 0x81, 0x04, 0x11, 0x0c, 0xe4, 0x10, 0x87, 0xe5, 0x10, 0xd0, 0x73, 0xb8, 0xa5, 0x00, 0x00, 0xec, 0x52, 0x0d, 0x53, 0xab, 0x4a, 0x02, 0x8b, 0x42, 0x81, 0x8a,
+  0x42, 0x02, 0x6a, 0x42, 0x02, 0x4a, 0x3a, 0x88, 0x6a, 0x42, 0xab, 0x4a, 0x8b, 0x42, 0x05, 0x19, 0xe4, 0x10, 0x04, 0x19, 0x04, 0x11, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0x8a, 0x4a, 0x97, 0xad,
+  0x21, 0x00, 0x00, 0x02, 0xb8, 0xad, 0x81, 0xb8, 0xa5, 0x08, 0xd8, 0xa5, 0x08, 0xd8, 0xad, 0x86, 0xb8, 0xa5, 0xb7, 0xa5, 0xb8, 0xa5, 0x98, 0xa5, 0x97, 0xa5, 0x4e, 0x5b, 0x02, 0xe4, 0x10, 0x81,
+  0x04, 0x19, 0x02, 0x05, 0x11, 0x82, 0xe4, 0x10, 0xdb, 0xd6, 0x0e, 0xdf, 0xff, 0x82, 0x55, 0xa5, 0x05, 0x19, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x82, 0xcb, 0x4a, 0xd8, 0xb5, 0x07, 0x00, 0x00,
+  0x84, 0xfc, 0xd6, 0x6a, 0x42, 0x05, 0x11, 0x05, 0x19, 0x02, 0x04, 0x19, 0x02, 0x04, 0x11, 0x82, 0xa7, 0x29, 0x08, 0x32, 0x02, 0xe8, 0x31, 0x82, 0x08, 0x32, 0x09, 0x32, 0x04, 0x29, 0x3a, 0x85,
+  0x4a, 0x42, 0x29, 0x3a, 0xaf, 0x6b, 0x97, 0xa5, 0xb8, 0xa5, 0x02, 0x00, 0x00, 0x83, 0x77, 0x9d, 0x36, 0x95, 0x57, 0x95, 0x02, 0x56, 0x9d, 0x03, 0x76, 0x9d, 0x82, 0x77, 0x9d, 0x97, 0xa5, 0x02,
+  0xb7, 0xa5, 0x81, 0x4a, 0x3a, 0x03, 0x04, 0x19, 0x81, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0x29, 0x3a, 0x93, 0x8c, 0x33, 0x00, 0x00, 0x84, 0xd8, 0xad, 0xb7, 0xa5, 0x76, 0xa5, 0x77, 0xa5, 0x02,
+  0x97, 0xa5, 0x84, 0x36, 0x9d, 0x86, 0x29, 0xe4, 0x10, 0x04, 0x11, 0x02, 0x05, 0x11, 0x82, 0x05, 0x19, 0x96, 0xad, 0x0e, 0xdf, 0xff, 0x82, 0xf7, 0xbd, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x84, 0x04,
+  0x11, 0xe4, 0x10, 0xe8, 0x31, 0xb8, 0xad, 0x07, 0x00, 0x00, 0x82, 0x19, 0xb6, 0x25, 0x19, 0x03, 0x05, 0x11, 0x02, 0x04, 0x19, 0x85, 0x04, 0x11, 0x8f, 0x63, 0x77, 0xa5, 0x57, 0x9d, 0x76, 0x9d,
+  0x03, 0x77, 0x9d, 0x81, 0x97, 0x9d, 0x05, 0x97, 0xa5, 0x82, 0x98, 0xa5, 0xb7, 0xa5, 0x02, 0x00, 0x00, 0x83, 0x57, 0x9d, 0x36, 0x95, 0x57, 0x95, 0x02, 0x57, 0x9d, 0x82, 0x76, 0x9d, 0x77, 0x9d,
+  0x02, 0x77, 0xa5, 0x02, 0x97, 0xa5, 0x82, 0xb7, 0xad, 0x29, 0x3a, 0x04, 0x04, 0x19, 0x03, 0x05, 0x19, 0x81, 0x6e, 0x63, 0x1d, 0x00, 0x00, 0x83, 0x1d, 0xd7, 0xfd, 0xd6, 0x1d, 0xd7, 0x18, 0x00,
+  0x00, 0x84, 0x97, 0xa5, 0xb8, 0xa5, 0x8b, 0x4a, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x05, 0x19, 0x71, 0x84, 0x0e, 0xdf, 0xff, 0x82, 0x38, 0xc6, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11,
+  0x81, 0x25, 0x19, 0x02, 0xb7, 0xad, 0x06, 0x00, 0x00, 0x81, 0x15, 0x9d, 0x04, 0x05, 0x11, 0x84, 0x04, 0x11, 0x04, 0x19, 0x04, 0x11, 0xf1, 0x73, 0x02, 0x77, 0x9d, 0x81, 0x76, 0x9d, 0x03, 0x77,
+  0x9d, 0x02, 0x77, 0xa5, 0x02, 0x97, 0xa5, 0x02, 0x98, 0xa5, 0x02, 0x97, 0xa5, 0x03, 0x00, 0x00, 0x02, 0x56, 0x9d, 0x03, 0x77, 0x9d, 0x02, 0x77, 0xa5, 0x03, 0x97, 0xa5, 0x83, 0xb7, 0xa5, 0xec,
+  0x52, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x02, 0x05, 0x19, 0x82, 0x05, 0x11, 0xab, 0x4a, 0x17, 0x00, 0x00, 0x8a, 0xdc, 0xce, 0xd4, 0x8c, 0xf0, 0x6b, 0x4e, 0x5b, 0x0d, 0x53, 0xe8, 0x29, 0xec, 0x52,
+  0xcc, 0x52, 0x6e, 0x63, 0x15, 0x95, 0x19, 0x00, 0x00, 0x82, 0x6a, 0x42, 0xe4, 0x10, 0x04, 0x05, 0x11, 0x82, 0xae, 0x6b, 0xdf, 0xf7, 0x0d, 0xdf, 0xff, 0x87, 0x38, 0xc6, 0xe5, 0x18, 0x05, 0x11,
+  0xe4, 0x10, 0x04, 0x11, 0xe4, 0x10, 0x45, 0x21, 0x02, 0xb7, 0xad, 0x06, 0x00, 0x00, 0x81, 0x72, 0x84, 0x02, 0x05, 0x11, 0x03, 0x04, 0x11, 0x84, 0x04, 0x19, 0xe4, 0x10, 0xd4, 0x8c, 0x77, 0x9d,
+  0x02, 0x77, 0xa5, 0x03, 0x77, 0x9d, 0x03, 0x77, 0xa5, 0x04, 0x97, 0xa5, 0x05, 0x00, 0x00, 0x8c, 0x77, 0x9d, 0x76, 0x9d, 0x97, 0xa5, 0x76, 0xa5, 0x77, 0xa5, 0x56, 0xa5, 0x76, 0x9d, 0x76, 0xa5,
+  0x77, 0xa5, 0x77, 0x9d, 0x8f, 0x63, 0x04, 0x11, 0x04, 0x04, 0x19, 0x02, 0x05, 0x19, 0x82, 0xcc, 0x52, 0xdc, 0xce, 0x12, 0x00, 0x00, 0x88, 0xbb, 0xc6, 0x3d, 0xd7, 0xbb, 0xc6, 0x35, 0x95, 0xf0,
+  0x6b, 0x8b, 0x42, 0x86, 0x21, 0x46, 0x19, 0x02, 0x25, 0x19, 0x81, 0x05, 0x19, 0x02, 0x05, 0x11, 0x82, 0x4e, 0x63, 0xbc, 0xce, 0x18, 0x00, 0x00, 0x82, 0xd4, 0x8c, 0xe4, 0x10, 0x04, 0x05, 0x11,
+  0x81, 0x25, 0x19, 0x02, 0xdf, 0xf7, 0x0c, 0xdf, 0xff, 0x81, 0x18, 0xbe, 0x02, 0xe5, 0x10, 0x03, 0xe4, 0x10, 0x81, 0xa7, 0x29, 0x02, 0xb7, 0xad, 0x05, 0x00, 0x00, 0x83, 0x1d, 0xd7, 0xec, 0x52,
+  0x05, 0x11, 0x04, 0x04, 0x11, 0x86, 0x04, 0x19, 0x05, 0x19, 0x56, 0x9d, 0x77, 0xa5, 0x77, 0x9d, 0x77, 0xa5, 0x02, 0x56, 0x9d, 0x81, 0x36, 0x9d, 0x02, 0x56, 0x9d, 0x84, 0x36, 0x95, 0x76, 0x9d,
+  0x77, 0xa5, 0x97, 0xa5, 0x10, 0x00, 0x00, 0x84, 0x8f, 0x63, 0xc8, 0x29, 0x04, 0x19, 0x04, 0x11, 0x02, 0x04, 0x19, 0x02, 0x05, 0x19, 0x82, 0x29, 0x3a, 0x5a, 0xbe, 0x10, 0x00, 0x00, 0x85, 0x7a,
+  0xc6, 0xd3, 0x8c, 0x52, 0x84, 0xd0, 0x6b, 0xe9, 0x31, 0x02, 0x87, 0x21, 0x02, 0x46, 0x19, 0x02, 0x25, 0x19, 0x04, 0x05, 0x11, 0x82, 0x46, 0x19, 0x36, 0x9d, 0x18, 0x00, 0x00, 0x82, 0xb4, 0x84,
+  0xe5, 0x10, 0x02, 0x05, 0x11, 0x85, 0x05, 0x19, 0x25, 0x11, 0xc7, 0x31, 0xdf, 0xff, 0xdf, 0xf7, 0x0c, 0xdf, 0xff, 0x81, 0xb6, 0xb5, 0x02, 0xe5, 0x10, 0x03, 0xe4, 0x10, 0x83, 0x29, 0x3a, 0xb7,
+  0xad, 0xd8, 0xad, 0x05, 0x00, 0x00, 0x83, 0x19, 0xb6, 0x46, 0x19, 0x05, 0x11, 0x05, 0x04, 0x11, 0x81, 0x49, 0x42, 0x03, 0x77, 0x9d, 0x1b, 0x00, 0x00, 0x83, 0x09, 0x32, 0xe4, 0x10, 0x04, 0x11,
+  0x02, 0x04, 0x19, 0x02, 0x05, 0x19, 0x82, 0x05, 0x11, 0x51, 0x7c, 0x0d, 0x00, 0x00, 0x85, 0x15, 0x9d, 0x11, 0x7c, 0x8f, 0x6b, 0x8b, 0x4a, 0xa7, 0x29, 0x03, 0x87, 0x21, 0x84, 0x67, 0x19, 0x66,
+  0x19, 0x46, 0x19, 0x26, 0x19, 0x02, 0x05, 0x11, 0x03, 0xe4, 0x10, 0x83, 0x05, 0x11, 0xe5, 0x10, 0x32, 0x7c, 0x18, 0x00, 0x00, 0x81, 0x73, 0x84, 0x03, 0x05, 0x11, 0x83, 0x05, 0x19, 0x25, 0x11,
+  0xcf, 0x73, 0x02, 0xdf, 0xf7, 0x0c, 0xdf, 0xff, 0x83, 0x34, 0x9d, 0xe5, 0x18, 0xe5, 0x10, 0x02, 0xe4, 0x10, 0x84, 0x04, 0x11, 0xec, 0x52, 0xb7, 0xad, 0x39, 0xbe, 0x05, 0x00, 0x00, 0x81, 0xf4,
+  0x94, 0x03, 0x05, 0x11, 0x81, 0x04, 0x11, 0x03, 0x05, 0x11, 0x84, 0xaf, 0x6b, 0x77, 0x9d, 0x77, 0xa5, 0x97, 0xa5, 0x1b, 0x00, 0x00, 0x81, 0x0c, 0x53, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x03,
+  0x05, 0x19, 0x82, 0xcf, 0x73, 0xfc, 0xd6, 0x07, 0x00, 0x00, 0x88, 0xdc, 0xc6, 0xdc, 0xce, 0x93, 0x84, 0x4d, 0x5b, 0x2d, 0x63, 0xcc, 0x52, 0x08, 0x3a, 0xa7, 0x29, 0x02, 0xa7, 0x21, 0x02, 0x87,
+  0x21, 0x86, 0x87, 0x19, 0x67, 0x19, 0x66, 0x19, 0x46, 0x19, 0x25, 0x11, 0x05, 0x11, 0x05, 0xe4, 0x10, 0x83, 0x04, 0x11, 0x8b, 0x4a, 0x1d, 0xd7, 0x17, 0x00, 0x00, 0x81, 0x8f, 0x6b, 0x03, 0x05,
+  0x11, 0x83, 0x05, 0x19, 0x05, 0x11, 0xb3, 0x8c, 0x02, 0xdf, 0xf7, 0x82, 0xdf, 0xff, 0xff, 0xff, 0x0a, 0xdf, 0xff, 0x8a, 0x71, 0x84, 0xe5, 0x10, 0xe4, 0x10, 0x04, 0x11, 0xe4, 0x10, 0x04, 0x11,
+  0xf0, 0x73, 0xb7, 0xad, 0x19, 0xb6, 0xbb, 0xce, 0x03, 0x00, 0x00, 0x82, 0x1d, 0xd7, 0x4e, 0x63, 0x02, 0x05, 0x19, 0x81, 0x05, 0x11, 0x03, 0x05, 0x19, 0x82, 0x04, 0x11, 0xd5, 0x8c, 0x02, 0x97,
+  0xa5, 0x1c, 0x00, 0x00, 0x83, 0x73, 0x84, 0xa7, 0x29, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x02, 0x05, 0x19, 0x83, 0x05, 0x11, 0x86, 0x21, 0xd8, 0xb5, 0x06, 0x00, 0x00, 0x86, 0xbb, 0xce, 0x52, 0x84,
+  0x6a, 0x42, 0x65, 0x21, 0x24, 0x19, 0x45, 0x19, 0x03, 0x66, 0x19, 0x03, 0x67, 0x19, 0x81, 0x87, 0x19, 0x02, 0x67, 0x19, 0x82, 0x46, 0x19, 0x26, 0x19, 0x02, 0x05, 0x11, 0x81, 0x05, 0x19, 0x05,
+  0xe4, 0x10, 0x82, 0x05, 0x19, 0x72, 0x84, 0x16, 0x00, 0x00, 0x82, 0xbb, 0xce, 0x6a, 0x42, 0x03, 0x05, 0x11, 0x83, 0x05, 0x19, 0x05, 0x11, 0xb7, 0xad, 0x02, 0xdf, 0xf7, 0x82, 0xdf, 0xff, 0xff,
+  0xff, 0x09, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x6d, 0x63, 0x02, 0xe4, 0x10, 0x87, 0x04, 0x11, 0xe4, 0x10, 0x04, 0x11, 0x31, 0x7c, 0xd7, 0xad, 0x18, 0xb6, 0xbb, 0xce, 0x03, 0x00, 0x00, 0x82, 0xf8,
+  0xb5, 0x66, 0x19, 0x02, 0x05, 0x19, 0x81, 0x05, 0x11, 0x03, 0x05, 0x19, 0x84, 0xe8, 0x31, 0x97, 0xa5, 0x98, 0xa5, 0xb7, 0xa5, 0x1d, 0x00, 0x00, 0x82, 0x6a, 0x42, 0xe4, 0x10, 0x02, 0x04, 0x19,
+  0x02, 0x05, 0x19, 0x02, 0x05, 0x11, 0x81, 0x72, 0x84, 0x06, 0x00, 0x00, 0x81, 0x35, 0xa5, 0x03, 0xe4, 0x10, 0x82, 0x04, 0x11, 0x05, 0x11, 0x03, 0x25, 0x11, 0x82, 0x26, 0x11, 0x46, 0x19, 0x03,
+  0x67, 0x19, 0x86, 0x46, 0x19, 0x26, 0x11, 0xf0, 0x6b, 0xd8, 0xad, 0x3d, 0xdf, 0xf4, 0x9c, 0x05, 0xe4, 0x10, 0x83, 0x04, 0x11, 0xec, 0x52, 0x9b, 0xc6, 0x15, 0x00, 0x00, 0x82, 0xf8, 0xad, 0x66,
+  0x21, 0x03, 0x05, 0x11, 0x83, 0x05, 0x19, 0x05, 0x11, 0xdb, 0xd6, 0x02, 0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x83, 0xbf, 0xf7, 0xe8, 0x31, 0x04,
+  0x11, 0x03, 0xe4, 0x10, 0x85, 0x05, 0x19, 0xd4, 0x94, 0xb7, 0xad, 0x39, 0xbe, 0xbb, 0xce, 0x02, 0x00, 0x00, 0x83, 0x1d, 0xd7, 0x31, 0x7c, 0x25, 0x19, 0x02, 0x05, 0x19, 0x03, 0x05, 0x11, 0x82,
+  0x05, 0x19, 0xab, 0x4a, 0x02, 0xb8, 0xa5, 0x1e, 0x00, 0x00, 0x84, 0x8f, 0x6b, 0x05, 0x11, 0x04, 0x11, 0x04, 0x19, 0x02, 0x05, 0x19, 0x02, 0x05, 0x11, 0x82, 0x8b, 0x4a, 0xbb, 0xce, 0x05, 0x00,
+  0x00, 0x81, 0x35, 0x9d, 0x02, 0xc3, 0x10, 0x03, 0xe4, 0x10, 0x8a, 0x04, 0x11, 0x05, 0x09, 0xe5, 0x08, 0x05, 0x11, 0x06, 0x11, 0x26, 0x11, 0xa7, 0x21, 0x31, 0x7c, 0xf8, 0xb5, 0x5d, 0xe7, 0x03,
+  0xdf, 0xf7, 0x82, 0x5d, 0xe7, 0x45, 0x21, 0x06, 0xe4, 0x10, 0x81, 0x31, 0x7c, 0x15, 0x00, 0x00, 0x81, 0xaf, 0x6b, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0x09, 0x32, 0x9e, 0xef,
+  0x02, 0xdf, 0xf7, 0x81, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x82, 0x5d, 0xef, 0xc4, 0x08, 0x04, 0xe4, 0x10, 0x85, 0xc7, 0x31, 0x97, 0xad, 0xb7, 0xad, 0x18, 0xb6,
+  0xbb, 0xce, 0x02, 0x00, 0x00, 0x82, 0x9b, 0xc6, 0xc8, 0x31, 0x03, 0x05, 0x19, 0x03, 0x05, 0x11, 0x84, 0x46, 0x21, 0x15, 0x95, 0xb8, 0xa5, 0xb8, 0xad, 0x1d, 0x00, 0x00, 0x83, 0x35, 0x9d, 0x09,
+  0x3a, 0x05, 0x11, 0x02, 0x04, 0x19, 0x04, 0x05, 0x11, 0x82, 0x05, 0x19, 0x72, 0x84, 0x05, 0x00, 0x00, 0x83, 0x76, 0xa5, 0xc3, 0x10, 0xc4, 0x10, 0x04, 0xe4, 0x10, 0x86, 0xe4, 0x08, 0xe5, 0x08,
+  0xc8, 0x29, 0x93, 0x84, 0x7a, 0xc6, 0x9e, 0xef, 0x07, 0xdf, 0xf7, 0x81, 0xd3, 0x94, 0x06, 0xe4, 0x10, 0x82, 0xa7, 0x29, 0x56, 0xa5, 0x13, 0x00, 0x00, 0x82, 0xb7, 0xad, 0x29, 0x3a, 0x02, 0x04,
+  0x11, 0x02, 0x05, 0x11, 0x82, 0x25, 0x11, 0x35, 0x9d, 0x02, 0xdf, 0xf7, 0x04, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x81, 0x9a, 0xce, 0x05, 0xe4, 0x10, 0x84, 0x49, 0x3a, 0xb7, 0xad,
+  0xd7, 0xad, 0x18, 0xb6, 0x02, 0x00, 0x00, 0x82, 0x3e, 0xdf, 0xf4, 0x94, 0x02, 0x05, 0x11, 0x81, 0x25, 0x11, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x84, 0x46, 0x21, 0x8f, 0x63, 0x77, 0xa5, 0xb7,
+  0xa5, 0x1b, 0x00, 0x00, 0x85, 0x76, 0x9d, 0x4e, 0x63, 0x66, 0x21, 0x05, 0x19, 0x05, 0x11, 0x02, 0x05, 0x19, 0x03, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0x8b, 0x4a, 0xbb, 0xce, 0x04, 0x00, 0x00,
+  0x83, 0x7a, 0xc6, 0xc7, 0x31, 0xc4, 0x10, 0x04, 0xe4, 0x10, 0x83, 0x72, 0x84, 0xdc, 0xd6, 0xbf, 0xef, 0x03, 0xdf, 0xf7, 0x07, 0xdf, 0xff, 0x83, 0x5d, 0xef, 0x08, 0x3a, 0xc4, 0x10, 0x04, 0xe4,
+  0x10, 0x83, 0x04, 0x11, 0x8a, 0x4a, 0xb7, 0xad, 0x11, 0x00, 0x00, 0x83, 0xd7, 0xad, 0x4d, 0x63, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x84, 0x87, 0x21, 0x7e, 0xe7, 0xdf, 0xf7, 0xff,
+  0xf7, 0x04, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x82, 0x35, 0xa5, 0x05, 0x19, 0x03, 0xe4, 0x10, 0x85, 0x05, 0x11, 0x4a, 0x42, 0xd8, 0xad, 0xd7, 0xad, 0x7a, 0xc6, 0x02, 0x00, 0x00,
+  0x82, 0xdc, 0xce, 0xab, 0x4a, 0x05, 0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x83, 0x87, 0x29, 0xab, 0x4a, 0x97, 0xa5, 0x18, 0x00, 0x00, 0x84, 0xfc, 0xce, 0xf4, 0x94, 0x6a, 0x42, 0x25,
+  0x19, 0x02, 0x05, 0x19, 0x07, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0xf5, 0x94, 0x05, 0x00, 0x00, 0x81, 0x4a, 0x42, 0x02, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x81, 0xf4, 0x9c, 0x02, 0xbf, 0xf7, 0x81,
+  0xdf, 0xf7, 0x09, 0xdf, 0xff, 0x84, 0xdf, 0xf7, 0x18, 0xbe, 0xa3, 0x10, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82, 0xab, 0x4a, 0xb3, 0x8c, 0x0f, 0x00, 0x00, 0x82, 0x92, 0x84, 0x8b,
+  0x4a, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x83, 0x05, 0x19, 0x05, 0x11, 0x92, 0x84, 0x02, 0xdf, 0xf7, 0x04, 0xff, 0xff, 0x07, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xdf, 0xff, 0xcb, 0x52, 0x04, 0x11,
+  0x03, 0x05, 0x11, 0x89, 0xe4, 0x10, 0x0d, 0x5b, 0xd8, 0xad, 0xfc, 0xce, 0xdc, 0xce, 0x00, 0x00, 0xdc, 0xce, 0xb3, 0x8c, 0x26, 0x19, 0x07, 0x05, 0x11, 0x81, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x83,
+  0x05, 0x19, 0x08, 0x32, 0x10, 0x74, 0x16, 0x00, 0x00, 0x84, 0xbb, 0xce, 0x31, 0x7c, 0xc7, 0x29, 0x25, 0x11, 0x03, 0x05, 0x19, 0x07, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0xcb, 0x52, 0x7b, 0xc6,
+  0x04, 0x00, 0x00, 0x81, 0x6e, 0x63, 0x02, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x83, 0xcb, 0x52, 0xbf, 0xf7, 0xdf, 0xf7, 0x03, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x84, 0xdf, 0xf7, 0x51,
+  0x84, 0xc3, 0x10, 0xc4, 0x10, 0x02, 0xe4, 0x10, 0x86, 0x05, 0x11, 0x04, 0x11, 0x05, 0x11, 0x46, 0x19, 0xab, 0x4a, 0x11, 0x7c, 0x0b, 0x00, 0x00, 0x83, 0x35, 0x95, 0xec, 0x52, 0xe8, 0x31, 0x05,
+  0x04, 0x11, 0x84, 0x05, 0x11, 0x25, 0x19, 0xdb, 0xd6, 0xdf, 0xf7, 0x05, 0xff, 0xff, 0x08, 0xdf, 0xff, 0x82, 0xfb, 0xde, 0x04, 0x11, 0x03, 0x05, 0x11, 0x84, 0x05, 0x19, 0x87, 0x29, 0x14, 0x95,
+  0xd8, 0xad, 0x02, 0xdc, 0xce, 0x84, 0xbb, 0xce, 0x9b, 0xc6, 0x8b, 0x42, 0x25, 0x11, 0x0a, 0x05, 0x11, 0x84, 0x04, 0x19, 0x04, 0x11, 0x66, 0x21, 0x6e, 0x63, 0x13, 0x00, 0x00, 0x83, 0xfc, 0xd6,
+  0xd4, 0x94, 0xec, 0x52, 0x02, 0x05, 0x11, 0x04, 0x05, 0x19, 0x07, 0x05, 0x11, 0x03, 0x05, 0x19, 0x81, 0xaf, 0x6b, 0x04, 0x00, 0x00, 0x84, 0xd8, 0xad, 0xa7, 0x29, 0xc4, 0x10, 0xe4, 0x10, 0x02,
+  0xc4, 0x10, 0x83, 0xa3, 0x08, 0x9a, 0xce, 0xdf, 0xf7, 0x02, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x85, 0xdf, 0xf7, 0x9e, 0xef, 0x2c, 0x63, 0xc4, 0x10, 0xe4, 0x10, 0x02, 0xe5, 0x10,
+  0x81, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x85, 0xe5, 0x10, 0x66, 0x21, 0x4a, 0x42, 0x4e, 0x5b, 0x19, 0xb6, 0x06, 0x00, 0x00, 0x86, 0x35, 0x9d, 0x0c, 0x53, 0x6a, 0x42, 0x25, 0x19, 0x04, 0x19, 0x04,
+  0x11, 0x03, 0x04, 0x19, 0x02, 0x05, 0x11, 0x83, 0x96, 0xad, 0xbf, 0xf7, 0xdf, 0xf7, 0x05, 0xff, 0xff, 0x08, 0xdf, 0xff, 0x82, 0x92, 0x8c, 0x05, 0x19, 0x03, 0x05, 0x11, 0x89, 0x05, 0x19, 0x2d,
+  0x5b, 0xd7, 0xad, 0xf8, 0xad, 0xdc, 0xce, 0xbc, 0xce, 0xdc, 0xce, 0xb3, 0x8c, 0x26, 0x11, 0x09, 0x05, 0x11, 0x03, 0x05, 0x19, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0x29, 0x3a, 0xab, 0x4a, 0x10,
+  0x00, 0x00, 0x83, 0x7a, 0xc6, 0x4d, 0x63, 0x25, 0x19, 0x04, 0x05, 0x11, 0x03, 0x05, 0x19, 0x08, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0x46, 0x19, 0x15, 0x9d, 0x04, 0x00, 0x00, 0x82, 0x4e, 0x63,
+  0xc4, 0x10, 0x03, 0xe4, 0x10, 0x82, 0xc4, 0x10, 0x10, 0x84, 0x02, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x07, 0xdf, 0xff, 0x83, 0xdf, 0xf7, 0x3d, 0xe7, 0x49, 0x4a, 0x05, 0xe4, 0x10, 0x02, 0xe5, 0x10,
+  0x02, 0x05, 0x11, 0x81, 0x46, 0x19, 0x02, 0x08, 0x32, 0x86, 0xec, 0x52, 0x09, 0x3a, 0xa7, 0x29, 0x87, 0x29, 0x8b, 0x4a, 0x09, 0x3a, 0x02, 0x25, 0x19, 0x02, 0x05, 0x19, 0x81, 0x04, 0x11, 0x04,
+  0x05, 0x19, 0x81, 0xf4, 0x9c, 0x02, 0xdf, 0xf7, 0x81, 0xff, 0xf7, 0x05, 0xff, 0xff, 0x07, 0xdf, 0xff, 0x83, 0x3d, 0xe7, 0x86, 0x29, 0x05, 0x11, 0x03, 0x05, 0x19, 0x88, 0x25, 0x19, 0x52, 0x7c,
+  0xb7, 0xa5, 0x5a, 0xbe, 0xfc, 0xce, 0xdc, 0xce, 0x3a, 0xbe, 0xc8, 0x29, 0x0a, 0x05, 0x11, 0x81, 0xe4, 0x10, 0x06, 0x05, 0x19, 0x83, 0x66, 0x21, 0x4a, 0x42, 0x73, 0x84, 0x0d, 0x00, 0x00, 0x82,
+  0xfc, 0xd6, 0x8e, 0x6b, 0x03, 0x05, 0x11, 0x04, 0x04, 0x11, 0x0d, 0x05, 0x11, 0x82, 0x8b, 0x4a, 0xbb, 0xce, 0x03, 0x00, 0x00, 0x82, 0xb3, 0x8c, 0x46, 0x21, 0x04, 0xe4, 0x10, 0x82, 0x05, 0x19,
+  0x1c, 0xdf, 0x02, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x09, 0xdf, 0xff, 0x82, 0x1b, 0xdf, 0x28, 0x42, 0x05, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x82, 0x05, 0x19, 0x25, 0x19, 0x04, 0x05,
+  0x19, 0x82, 0x05, 0x11, 0x25, 0x11, 0x06, 0x05, 0x19, 0x83, 0x04, 0x19, 0x51, 0x8c, 0x9f, 0xf7, 0x02, 0xdf, 0xf7, 0x05, 0xff, 0xff, 0x08, 0xdf, 0xff, 0x83, 0x14, 0x9d, 0x05, 0x19, 0x05, 0x11,
+  0x03, 0x05, 0x19, 0x84, 0x6a, 0x42, 0x97, 0xa5, 0xb7, 0xa5, 0x9b, 0xc6, 0x02, 0xdc, 0xce, 0x84, 0xd0, 0x6b, 0x25, 0x19, 0x05, 0x11, 0x05, 0x19, 0x08, 0x05, 0x11, 0x82, 0x05, 0x19, 0xe4, 0x10,
+  0x03, 0x05, 0x19, 0x81, 0x04, 0x19, 0x03, 0x05, 0x19, 0x82, 0xec, 0x52, 0x9c, 0xc6, 0x0c, 0x00, 0x00, 0x81, 0x15, 0x9d, 0x03, 0xe4, 0x10, 0x81, 0x05, 0x11, 0x06, 0x04, 0x11, 0x0b, 0x05, 0x11,
+  0x82, 0x05, 0x19, 0x51, 0x84, 0x04, 0x00, 0x00, 0x81, 0x6a, 0x42, 0x05, 0xe4, 0x10, 0x81, 0x92, 0x8c, 0x02, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x85, 0xdf, 0xf7, 0x7d, 0xef, 0x71,
+  0x84, 0xe3, 0x10, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x83, 0xe5, 0x10, 0x05, 0x11, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x81, 0x25, 0x11, 0x05, 0x05, 0x11, 0x05, 0x25, 0x11, 0x02, 0x05, 0x19, 0x83, 0x72,
+  0x8c, 0x9f, 0xef, 0xbf, 0xf7, 0x02, 0xdf, 0xf7, 0x04, 0xff, 0xff, 0x08, 0xdf, 0xff, 0x82, 0x3c, 0xe7, 0x66, 0x29, 0x05, 0x05, 0x19, 0x86, 0xd0, 0x73, 0x97, 0xa5, 0xb8, 0xad, 0x1d, 0xd7, 0xdc,
+  0xce, 0xd4, 0x8c, 0x03, 0x05, 0x11, 0x81, 0x05, 0x19, 0x07, 0x05, 0x11, 0x83, 0x04, 0x11, 0x04, 0x19, 0x05, 0x11, 0x02, 0xe4, 0x10, 0x82, 0x04, 0x19, 0x05, 0x11, 0x03, 0x05, 0x19, 0x82, 0xa7,
+  0x29, 0x5b, 0xbe, 0x0c, 0x00, 0x00, 0x81, 0x51, 0x84, 0x03, 0xe4, 0x10, 0x81, 0x05, 0x11, 0x06, 0x04, 0x11, 0x0b, 0x05, 0x11, 0x83, 0x05, 0x19, 0x66, 0x21, 0x15, 0x9d, 0x03, 0x00, 0x00, 0x82,
+  0x4d, 0x5b, 0x45, 0x19, 0x04, 0xe4, 0x10, 0x83, 0x25, 0x19, 0x1c, 0xdf, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x07, 0xdf, 0xff, 0x84, 0xdf, 0xf7, 0x79, 0xce, 0x2c, 0x63, 0xc4, 0x08, 0x02, 0xc4, 0x10,
+  0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x09, 0x05, 0x11, 0x86, 0x25, 0x11, 0x26, 0x11, 0x25, 0x19, 0x25, 0x11, 0x49, 0x3a, 0xf8, 0xb5, 0x02, 0xbf, 0xf7, 0x03, 0xdf, 0xf7, 0x04, 0xff, 0xff, 0x08,
+  0xdf, 0xff, 0x82, 0x51, 0x8c, 0x04, 0x19, 0x04, 0x05, 0x19, 0x87, 0x86, 0x29, 0x56, 0x9d, 0x97, 0xa5, 0x3a, 0xbe, 0xfd, 0xd6, 0x3a, 0xbe, 0xa7, 0x29, 0x03, 0x05, 0x11, 0x81, 0x05, 0x19, 0x07,
+  0x05, 0x11, 0x81, 0x04, 0x11, 0x05, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x84, 0x05, 0x19, 0x04, 0x11, 0x45, 0x19, 0xb4, 0x84, 0x0c, 0x00, 0x00, 0x82, 0x31, 0x7c, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x02,
+  0x04, 0x19, 0x81, 0x05, 0x19, 0x04, 0x04, 0x19, 0x04, 0x05, 0x19, 0x03, 0x05, 0x11, 0x02, 0x05, 0x19, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x82, 0x29, 0x3a, 0x9b, 0xc6, 0x03, 0x00, 0x00, 0x81,
+  0xe8, 0x31, 0x04, 0xe4, 0x10, 0x84, 0xe4, 0x18, 0x30, 0x84, 0xdf, 0xf7, 0xdf, 0xff, 0x09, 0xff, 0xff, 0x04, 0xdf, 0xff, 0x87, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xf7, 0xba, 0xd6, 0x72, 0x8c, 0xa7,
+  0x31, 0xc4, 0x10, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x04, 0x05, 0x11, 0x85, 0x25, 0x11, 0x46, 0x11, 0xcf, 0x73, 0x18, 0xbe, 0x9e, 0xef, 0x03, 0xdf, 0xf7,
+  0x02, 0xdf, 0xff, 0x81, 0xff, 0xff, 0x0b, 0xdf, 0xff, 0x83, 0x7a, 0xce, 0x05, 0x19, 0x04, 0x19, 0x04, 0x05, 0x19, 0x83, 0xd0, 0x73, 0x77, 0xa5, 0x97, 0xa5, 0x02, 0xfc, 0xce, 0x82, 0xcc, 0x52,
+  0x05, 0x11, 0x02, 0x05, 0x19, 0x05, 0x05, 0x11, 0x03, 0x04, 0x11, 0x82, 0x05, 0x19, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x85, 0x05, 0x11, 0x05, 0x19, 0xe5, 0x18, 0xe4, 0x10, 0xa7, 0x29, 0x0e, 0x00,
+  0x00, 0x81, 0x8a, 0x4a, 0x03, 0xe4, 0x10, 0x82, 0x04, 0x19, 0x05, 0x19, 0x05, 0x04, 0x19, 0x02, 0x05, 0x19, 0x04, 0x05, 0x11, 0x03, 0x05, 0x19, 0x04, 0x05, 0x11, 0x82, 0x8e, 0x6b, 0xbb, 0xce,
+  0x02, 0x00, 0x00, 0x82, 0x2d, 0x5b, 0x46, 0x21, 0x05, 0xe4, 0x10, 0x82, 0x39, 0xc6, 0xdf, 0xff, 0x09, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x82, 0xff, 0xf7, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x85, 0x9e,
+  0xef, 0x9a, 0xce, 0x75, 0xad, 0x71, 0x8c, 0x51, 0x84, 0x02, 0x31, 0x84, 0x88, 0x31, 0x7c, 0x6e, 0x63, 0xec, 0x52, 0x0c, 0x53, 0xaf, 0x73, 0xb3, 0x94, 0x18, 0xbe, 0x5d, 0xe7, 0x03, 0xdf, 0xf7,
+  0x04, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x0a, 0xdf, 0xff, 0x83, 0x7d, 0xef, 0x6a, 0x4a, 0x05, 0x11, 0x04, 0x05, 0x19, 0x8a, 0x4a, 0x42, 0x56, 0x9d, 0x76, 0xa5, 0xd8, 0xad, 0x3e, 0xd7, 0x31, 0x7c,
+  0x05, 0x11, 0x04, 0x11, 0x05, 0x11, 0x05, 0x19, 0x03, 0x04, 0x11, 0x03, 0x05, 0x11, 0x02, 0x04, 0x11, 0x82, 0x05, 0x19, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x85, 0x05, 0x11, 0x05, 0x19, 0x04, 0x19,
+  0xe4, 0x10, 0x2d, 0x5b, 0x0e, 0x00, 0x00, 0x82, 0xf0, 0x73, 0x86, 0x29, 0x02, 0xe4, 0x10, 0x08, 0x04, 0x19, 0x81, 0x05, 0x19, 0x03, 0x04, 0x11, 0x03, 0x05, 0x11, 0x82, 0x05, 0x19, 0x04, 0x19,
+  0x03, 0x05, 0x11, 0x82, 0x45, 0x21, 0xd0, 0x73, 0x03, 0x00, 0x00, 0x81, 0x4e, 0x63, 0x04, 0xe4, 0x10, 0x83, 0xe4, 0x18, 0xe8, 0x39, 0x5d, 0xe7, 0x11, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x82, 0xdf,
+  0xf7, 0xdf, 0xff, 0x03, 0xdf, 0xf7, 0x02, 0xdf, 0xff, 0x03, 0xff, 0xf7, 0x07, 0xdf, 0xf7, 0x0f, 0xdf, 0xff, 0x82, 0xdf, 0xf7, 0x10, 0x7c, 0x05, 0x05, 0x19, 0x89, 0x46, 0x19, 0xb3, 0x8c, 0x56,
+  0xa5, 0x77, 0xa5, 0xbb, 0xc6, 0x15, 0x95, 0x05, 0x11, 0x04, 0x11, 0x04, 0x19, 0x02, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x03, 0x05, 0x19, 0x03, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x81,
+  0x04, 0x19, 0x02, 0x04, 0x11, 0x83, 0xec, 0x52, 0x98, 0xa5, 0xb7, 0xa5, 0x0e, 0x00, 0x00, 0x83, 0x2d, 0x5b, 0xe4, 0x18, 0xe4, 0x10, 0x0a, 0x04, 0x19, 0x03, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02,
+  0x04, 0x19, 0x02, 0x05, 0x11, 0x03, 0xe4, 0x10, 0x81, 0x45, 0x19, 0x02, 0x00, 0x00, 0x82, 0x97, 0xad, 0xa7, 0x29, 0x03, 0xe4, 0x10, 0x84, 0xe4, 0x18, 0x05, 0x19, 0xf0, 0x7b, 0xdf, 0xf7, 0x10,
+  0xff, 0xff, 0x06, 0xdf, 0xff, 0x85, 0x9e, 0xf7, 0xb7, 0xb5, 0xf0, 0x7b, 0x72, 0x8c, 0x9a, 0xce, 0x07, 0xdf, 0xf7, 0x10, 0xdf, 0xff, 0x82, 0x14, 0x9d, 0x05, 0x11, 0x04, 0x05, 0x19, 0x87, 0x25,
+  0x19, 0xd0, 0x73, 0x56, 0x9d, 0x56, 0xa5, 0xd8, 0xad, 0xf4, 0x94, 0x05, 0x11, 0x02, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x02, 0x05, 0x19, 0x03, 0x04, 0x19, 0x02,
+  0x04, 0x11, 0x05, 0xe4, 0x10, 0x83, 0x04, 0x19, 0x86, 0x21, 0x36, 0x95, 0x02, 0xb8, 0xa5, 0x0e, 0x00, 0x00, 0x83, 0xd0, 0x6b, 0x29, 0x3a, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x81, 0x05, 0x19, 0x02,
+  0x04, 0x19, 0x03, 0xe4, 0x10, 0x04, 0x04, 0x19, 0x02, 0x05, 0x11, 0x02, 0x04, 0x19, 0x81, 0x05, 0x19, 0x04, 0xe4, 0x10, 0x82, 0x05, 0x11, 0xec, 0x52, 0x02, 0x00, 0x00, 0x82, 0x6e, 0x63, 0x25,
+  0x19, 0x03, 0xe4, 0x18, 0x83, 0x05, 0x19, 0x25, 0x21, 0x55, 0xa5, 0x0f, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x89, 0x7e, 0xef, 0x6e, 0x6b, 0xc3, 0x08, 0xc4, 0x10, 0xe4, 0x10, 0xe5, 0x10, 0x93, 0x8c,
+  0xbf, 0xf7, 0xdf, 0xf7, 0x13, 0xdf, 0xff, 0x83, 0xd7, 0xbd, 0x04, 0x19, 0x05, 0x11, 0x04, 0x05, 0x19, 0x86, 0x0d, 0x5b, 0x36, 0x9d, 0x56, 0x9d, 0x97, 0xa5, 0x56, 0x9d, 0x05, 0x11, 0x03, 0xe4,
+  0x10, 0x03, 0x04, 0x11, 0x04, 0x05, 0x11, 0x81, 0x05, 0x19, 0x03, 0x04, 0x19, 0x81, 0x05, 0x19, 0x02, 0x04, 0x11, 0x05, 0xe4, 0x10, 0x83, 0x04, 0x19, 0x73, 0x7c, 0xb8, 0x9d, 0x02, 0xb8, 0xa5,
+  0x0f, 0x00, 0x00, 0x83, 0x4e, 0x63, 0x87, 0x29, 0xe4, 0x10, 0x05, 0x04, 0x19, 0x03, 0xe4, 0x10, 0x04, 0x04, 0x19, 0x02, 0x05, 0x19, 0x08, 0xe4, 0x10, 0x85, 0xa7, 0x29, 0x2d, 0x63, 0x00, 0x00,
+  0xdc, 0xd6, 0xaf, 0x73, 0x03, 0xe4, 0x18, 0x84, 0x04, 0x19, 0x25, 0x19, 0x45, 0x21, 0x79, 0xce, 0x0f, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x83, 0x30, 0x84, 0xc4, 0x10, 0xc4, 0x08, 0x02, 0xe4, 0x10,
+  0x84, 0x04, 0x11, 0x05, 0x11, 0x76, 0xa5, 0xdf, 0xf7, 0x12, 0xdf, 0xff, 0x82, 0x18, 0xc6, 0x25, 0x19, 0x02, 0x04, 0x11, 0x03, 0x05, 0x19, 0x82, 0xe8, 0x31, 0x36, 0x9d, 0x02, 0x56, 0xa5, 0x82,
+  0x8f, 0x63, 0x05, 0x19, 0x04, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82, 0x04, 0x19, 0xe5, 0x18, 0x04, 0x05, 0x11, 0x82, 0x04, 0x11, 0x04, 0x19, 0x03, 0x04, 0x11, 0x04, 0xe4, 0x10, 0x02, 0xe5, 0x10,
+  0x84, 0xec, 0x52, 0x98, 0x9d, 0xb8, 0x9d, 0x97, 0xa5, 0x11, 0x00, 0x00, 0x82, 0x8a, 0x42, 0x05, 0x19, 0x05, 0x04, 0x19, 0x03, 0xe4, 0x10, 0x05, 0x04, 0x19, 0x83, 0x67, 0x21, 0xf1, 0x6b, 0xa8,
+  0x29, 0x07, 0xe4, 0x10, 0x8c, 0x25, 0x19, 0x49, 0x3a, 0x96, 0xa5, 0xf8, 0xb5, 0x29, 0x42, 0xe4, 0x10, 0xe4, 0x18, 0x04, 0x19, 0x05, 0x19, 0x25, 0x19, 0xe7, 0x39, 0xba, 0xd6, 0x0e, 0xff, 0xff,
+  0x04, 0xdf, 0xff, 0x82, 0xdb, 0xde, 0xc3, 0x10, 0x02, 0xc4, 0x08, 0x81, 0xe4, 0x08, 0x02, 0xe4, 0x10, 0x83, 0x04, 0x11, 0x87, 0x29, 0x9e, 0xef, 0x11, 0xdf, 0xff, 0x83, 0x18, 0xc6, 0x45, 0x21,
+  0x05, 0x19, 0x02, 0x04, 0x19, 0x84, 0x05, 0x19, 0x05, 0x11, 0x05, 0x19, 0x93, 0x8c, 0x02, 0x56, 0xa5, 0x82, 0xaf, 0x6b, 0xa3, 0x08, 0x02, 0xc4, 0x10, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82,
+  0x08, 0x32, 0x4e, 0x5b, 0x05, 0x05, 0x11, 0x81, 0x04, 0x19, 0x03, 0x04, 0x11, 0x02, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x83, 0xe4, 0x18, 0xa7, 0x29, 0x56, 0x95, 0x02, 0x98, 0x9d, 0x81, 0x97, 0xa5,
+  0x11, 0x00, 0x00, 0x84, 0x97, 0xa5, 0x6a, 0x4a, 0xe5, 0x10, 0x04, 0x11, 0x09, 0x04, 0x19, 0x86, 0xe4, 0x18, 0x2d, 0x53, 0x16, 0x8d, 0x78, 0x8d, 0xb5, 0x7c, 0x67, 0x21, 0x06, 0xe4, 0x10, 0x87,
+  0x04, 0x11, 0x25, 0x19, 0x4e, 0x63, 0x2d, 0x5b, 0x10, 0x7c, 0x05, 0x19, 0xe4, 0x18, 0x02, 0x04, 0x19, 0x84, 0x05, 0x19, 0x25, 0x19, 0xc7, 0x31, 0x7a, 0xce, 0x11, 0xff, 0xff, 0x82, 0xf7, 0xbd,
+  0xc3, 0x10, 0x02, 0xc4, 0x08, 0x03, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x81, 0xdb, 0xd6, 0x10, 0xdf, 0xff, 0x82, 0xd7, 0xb5, 0x45, 0x21, 0x06, 0x05, 0x19, 0x87, 0x6e, 0x63, 0x76, 0xa5, 0x36, 0x9d,
+  0x6e, 0x63, 0xa3, 0x08, 0xc3, 0x10, 0xc4, 0x10, 0x04, 0xe4, 0x10, 0x88, 0x04, 0x11, 0xe8, 0x31, 0xd4, 0x8c, 0x36, 0x95, 0x52, 0x7c, 0x29, 0x3a, 0x05, 0x11, 0x04, 0x11, 0x03, 0x05, 0x19, 0x81,
+  0x04, 0x11, 0x02, 0x05, 0x19, 0x02, 0x04, 0x19, 0x87, 0x05, 0x11, 0x04, 0x11, 0x52, 0x7c, 0xb8, 0x9d, 0x98, 0xa5, 0xb8, 0xa5, 0x97, 0xa5, 0x12, 0x00, 0x00, 0x82, 0xd0, 0x73, 0xa7, 0x29, 0x09,
+  0x04, 0x19, 0x82, 0x29, 0x3a, 0x94, 0x84, 0x02, 0x98, 0x95, 0x84, 0x78, 0x95, 0x78, 0x8d, 0x94, 0x7c, 0x46, 0x19, 0x04, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x02, 0x05, 0x11, 0x84, 0x25, 0x19, 0x8b,
+  0x4a, 0x39, 0xbe, 0xb3, 0x94, 0x02, 0xe4, 0x18, 0x02, 0x04, 0x19, 0x86, 0x05, 0x19, 0x25, 0x19, 0x66, 0x29, 0x96, 0xb5, 0xdf, 0xf7, 0xdf, 0xff, 0x0e, 0xff, 0xff, 0x82, 0x18, 0xc6, 0xa3, 0x10,
+  0x02, 0xc4, 0x08, 0x02, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x83, 0x05, 0x11, 0x1c, 0xdf, 0xdf, 0xf7, 0x0d, 0xdf, 0xff, 0x82, 0x9e, 0xef, 0xd3, 0x9c, 0x03, 0x25, 0x19, 0x04, 0x05, 0x19, 0x84, 0x6a,
+  0x4a, 0x15, 0x9d, 0x31, 0x7c, 0xe8, 0x39, 0x02, 0xc3, 0x10, 0x81, 0xc4, 0x10, 0x04, 0xe4, 0x10, 0x8a, 0x04, 0x11, 0xc8, 0x31, 0x15, 0x95, 0x76, 0x9d, 0x56, 0x9d, 0x77, 0x9d, 0x56, 0x9d, 0xb0,
+  0x6b, 0x05, 0x19, 0x05, 0x11, 0x03, 0x05, 0x19, 0x82, 0xe4, 0x10, 0x05, 0x19, 0x02, 0x04, 0x19, 0x83, 0x05, 0x11, 0x8b, 0x4a, 0x97, 0xa5, 0x03, 0xb8, 0xa5, 0x14, 0x00, 0x00, 0x83, 0xec, 0x52,
+  0xe4, 0x10, 0x04, 0x11, 0x04, 0x04, 0x19, 0x83, 0x05, 0x19, 0x66, 0x21, 0x11, 0x74, 0x03, 0x98, 0x95, 0x82, 0x98, 0x9d, 0xb9, 0x9d, 0x02, 0x78, 0x95, 0x82, 0xd5, 0x84, 0x87, 0x29, 0x03, 0xe4,
+  0x10, 0x03, 0x05, 0x11, 0x02, 0x05, 0x19, 0x83, 0x08, 0x3a, 0x8f, 0x6b, 0x09, 0x3a, 0x04, 0x04, 0x19, 0x81, 0x05, 0x19, 0x02, 0x25, 0x19, 0x82, 0x30, 0x84, 0x7d, 0xef, 0x0e, 0xff, 0xff, 0x83,
+  0x7d, 0xef, 0x86, 0x29, 0xc4, 0x08, 0x02, 0xe4, 0x10, 0x02, 0xe5, 0x10, 0x82, 0x05, 0x11, 0xcf, 0x73, 0x03, 0xdf, 0xf7, 0x0b, 0xdf, 0xff, 0x83, 0xfb, 0xde, 0x2c, 0x63, 0x46, 0x21, 0x03, 0x25,
+  0x19, 0x03, 0x05, 0x19, 0x83, 0x25, 0x19, 0x8a, 0x4a, 0xa7, 0x31, 0x04, 0xc3, 0x10, 0x05, 0xe4, 0x10, 0x82, 0xe8, 0x31, 0xf5, 0x94, 0x04, 0x97, 0x9d, 0x02, 0x77, 0x9d, 0x87, 0xb4, 0x8c, 0x09,
+  0x3a, 0xe4, 0x10, 0x05, 0x11, 0x05, 0x19, 0xe4, 0x10, 0x05, 0x19, 0x02, 0x04, 0x19, 0x82, 0x87, 0x29, 0x36, 0x95, 0x04, 0xb8, 0xa5, 0x14, 0x00, 0x00, 0x84, 0xaf, 0x6b, 0xe8, 0x31, 0xe4, 0x10,
+  0xe4, 0x18, 0x03, 0x04, 0x19, 0x83, 0x6a, 0x42, 0xf5, 0x8c, 0x77, 0x95, 0x02, 0x98, 0x95, 0x88, 0x98, 0x9d, 0x97, 0x9d, 0xd8, 0xad, 0x3a, 0xb6, 0x57, 0x95, 0x77, 0x95, 0xd4, 0x84, 0x87, 0x21,
+  0x02, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0x05, 0x11, 0x04, 0x05, 0x19, 0x82, 0x25, 0x19, 0x05, 0x19, 0x05, 0x04, 0x19, 0x02, 0x25, 0x19, 0x82, 0x69, 0x4a, 0x9a, 0xce, 0x0e, 0xff, 0xff, 0x82,
+  0x59, 0xce, 0x86, 0x29, 0x02, 0xe4, 0x10, 0x84, 0xe5, 0x10, 0x05, 0x11, 0x0c, 0x5b, 0x5d, 0xe7, 0x02, 0xdf, 0xf7, 0x82, 0xff, 0xf7, 0xff, 0xff, 0x08, 0xdf, 0xff, 0x85, 0xdf, 0xf7, 0xf7, 0xbd,
+  0xa7, 0x31, 0x46, 0x21, 0x45, 0x21, 0x03, 0x25, 0x19, 0x02, 0x05, 0x19, 0x02, 0x25, 0x19, 0x02, 0x04, 0x11, 0x08, 0xe4, 0x10, 0x83, 0xe8, 0x31, 0x15, 0x95, 0x97, 0x9d, 0x02, 0x97, 0xa5, 0x88,
+  0xd8, 0xad, 0x39, 0xb6, 0x77, 0x9d, 0x56, 0x95, 0x56, 0x9d, 0x56, 0x95, 0xaf, 0x6b, 0x05, 0x19, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x82, 0x31, 0x7c, 0x97, 0xa5, 0x02, 0xb8, 0xa5, 0x81, 0xd8,
+  0xa5, 0x16, 0x00, 0x00, 0x82, 0x31, 0x7c, 0x09, 0x3a, 0x02, 0xe4, 0x10, 0x85, 0x05, 0x19, 0x4e, 0x5b, 0x15, 0x8d, 0x57, 0x95, 0x77, 0x95, 0x02, 0x97, 0x9d, 0x81, 0x77, 0x9d, 0x03, 0x00, 0x00,
+  0x85, 0x15, 0x8d, 0x36, 0x8d, 0x77, 0x95, 0xf5, 0x8c, 0xc8, 0x31, 0x02, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x07, 0x05, 0x19, 0x05, 0x04, 0x19, 0x85, 0x05, 0x19, 0x25, 0x19, 0x25, 0x21, 0x92, 0x8c,
+  0x5d, 0xef, 0x02, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x87, 0x3d, 0xe7, 0xd3, 0x94, 0xcb, 0x52, 0x2c, 0x63, 0x55, 0xa5, 0x7e, 0xef, 0xdf, 0xf7,
+  0x03, 0xdf, 0xff, 0x02, 0xff, 0xff, 0x06, 0xdf, 0xff, 0x84, 0x1c, 0xdf, 0xf0, 0x7b, 0x66, 0x29, 0x66, 0x21, 0x02, 0x45, 0x21, 0x02, 0x25, 0x19, 0x05, 0x05, 0x19, 0x82, 0x04, 0x19, 0x04, 0x11,
+  0x07, 0xe4, 0x10, 0x83, 0x29, 0x3a, 0x15, 0x95, 0x97, 0x9d, 0x02, 0x97, 0xa5, 0x84, 0x39, 0xb6, 0xfd, 0xce, 0x00, 0x00, 0xf5, 0x8c, 0x02, 0x15, 0x95, 0x8a, 0x36, 0x95, 0x56, 0x9d, 0xb4, 0x84,
+  0xe8, 0x31, 0xe4, 0x18, 0xe4, 0x10, 0x05, 0x19, 0xb0, 0x6b, 0x77, 0xa5, 0x97, 0xa5, 0x02, 0xb7, 0xa5, 0x81, 0xb8, 0xa5, 0x17, 0x00, 0x00, 0x84, 0x31, 0x7c, 0x08, 0x3a, 0x0d, 0x53, 0x72, 0x7c,
+  0x02, 0x36, 0x95, 0x81, 0x57, 0x95, 0x02, 0x77, 0x9d, 0x81, 0xb8, 0xa5, 0x05, 0x00, 0x00, 0x86, 0x56, 0x95, 0x77, 0x95, 0x77, 0x9d, 0xf5, 0x94, 0x09, 0x3a, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x07,
+  0x05, 0x19, 0x07, 0x04, 0x19, 0x02, 0x05, 0x19, 0x83, 0xa7, 0x31, 0xb7, 0xb5, 0xbe, 0xf7, 0x0f, 0xff, 0xff, 0x83, 0xdf, 0xff, 0xdf, 0xf7, 0xdf, 0xff, 0x06, 0xff, 0xff, 0x03, 0xdf, 0xff, 0x84,
+  0x5d, 0xef, 0x14, 0x9d, 0xc7, 0x29, 0x66, 0x21, 0x02, 0x46, 0x21, 0x81, 0x45, 0x21, 0x03, 0x25, 0x19, 0x06, 0x05, 0x19, 0x02, 0x04, 0x19, 0x05, 0xe4, 0x10, 0x83, 0xec, 0x52, 0x36, 0x95, 0x77,
+  0x9d, 0x02, 0x97, 0xa5, 0x81, 0xd8, 0xad, 0x04, 0x00, 0x00, 0x81, 0x36, 0x95, 0x03, 0x15, 0x95, 0x02, 0x36, 0x95, 0x83, 0x31, 0x7c, 0x0d, 0x53, 0x73, 0x84, 0x02, 0x77, 0xa5, 0x02, 0x97, 0xa5,
+  0x81, 0xd8, 0xa5, 0x19, 0x00, 0x00, 0x84, 0xd8, 0xad, 0x97, 0xa5, 0x56, 0x9d, 0x36, 0x95, 0x02, 0x56, 0x9d, 0x81, 0x57, 0x9d, 0x08, 0x00, 0x00, 0x87, 0x77, 0x9d, 0x56, 0x9d, 0x77, 0x9d, 0x56,
+  0x9d, 0xcb, 0x4a, 0xe5, 0x10, 0x05, 0x11, 0x07, 0x05, 0x19, 0x09, 0x04, 0x19, 0x02, 0x05, 0x19, 0x83, 0xaa, 0x4a, 0xd7, 0xb5, 0xbe, 0xf7, 0x16, 0xff, 0xff, 0x84, 0xdf, 0xf7, 0x5d, 0xef, 0x55,
+  0xa5, 0x09, 0x3a, 0x02, 0x66, 0x21, 0x82, 0x46, 0x21, 0x45, 0x21, 0x05, 0x25, 0x19, 0x06, 0x05, 0x19, 0x81, 0x05, 0x11, 0x03, 0x04, 0x19, 0x84, 0xe4, 0x10, 0x25, 0x19, 0xf1, 0x73, 0x57, 0x9d,
+  0x02, 0x77, 0x9d, 0x82, 0x77, 0xa5, 0x97, 0xa5, 0x07, 0x00, 0x00, 0x86, 0x97, 0x9d, 0x35, 0x95, 0x15, 0x95, 0x36, 0x95, 0x76, 0x9d, 0x76, 0xa5, 0x02, 0x77, 0x9d, 0x83, 0x77, 0xa5, 0x97, 0xa5,
+  0xb7, 0xa5, 0x1c, 0x00, 0x00, 0x83, 0x77, 0xa5, 0x76, 0x9d, 0x56, 0x9d, 0x0c, 0x00, 0x00, 0x83, 0x76, 0x9d, 0x97, 0x9d, 0xcf, 0x6b, 0x02, 0x05, 0x11, 0x07, 0x05, 0x19, 0x09, 0x04, 0x19, 0x03,
+  0x05, 0x19, 0x86, 0x04, 0x19, 0xa7, 0x31, 0xd3, 0x94, 0x79, 0xce, 0x7d, 0xef, 0xdf, 0xf7, 0x0f, 0xff, 0xff, 0x85, 0xdf, 0xf7, 0x3d, 0xe7, 0x59, 0xc6, 0xb2, 0x8c, 0xc8, 0x31, 0x03, 0x46, 0x21,
+  0x82, 0x45, 0x21, 0x45, 0x19, 0x04, 0x25, 0x19, 0x0d, 0x05, 0x19, 0x81, 0x08, 0x3a, 0x02, 0x57, 0x95, 0x83, 0x77, 0x9d, 0x57, 0x9d, 0x56, 0x9d, 0x0a, 0x00, 0x00, 0x82, 0x97, 0xa5, 0x56, 0x9d,
+  0x06, 0x97, 0xa5, 0x2d, 0x00, 0x00, 0x82, 0x10, 0x7c, 0x86, 0x21, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0x05, 0x11, 0x06, 0x05, 0x19, 0x0b, 0x04, 0x19, 0x04, 0x05, 0x19, 0x88, 0xe8, 0x39,
+  0x8e, 0x6b, 0x51, 0x84, 0x55, 0xa5, 0x96, 0xad, 0xd7, 0xb5, 0x39, 0xc6, 0x9a, 0xce, 0x03, 0x9a, 0xd6, 0x8a, 0x7a, 0xce, 0xf8, 0xbd, 0x76, 0xad, 0xd3, 0x9c, 0xaf, 0x73, 0xa7, 0x29, 0x25, 0x19,
+  0x45, 0x19, 0x46, 0x19, 0x45, 0x19, 0x08, 0x25, 0x19, 0x0e, 0x05, 0x19, 0x82, 0x04, 0x11, 0x8f, 0x63, 0x02, 0x77, 0x9d, 0x81, 0x3a, 0xbe, 0x3f, 0x00, 0x00, 0x82, 0x7a, 0xc6, 0x6a, 0x42, 0x03,
+  0x05, 0x11, 0x09, 0x05, 0x19, 0x06, 0x04, 0x19, 0x03, 0xe4, 0x10, 0x83, 0xe4, 0x18, 0xe4, 0x10, 0x04, 0x19, 0x07, 0x05, 0x19, 0x82, 0x05, 0x11, 0x05, 0x19, 0x02, 0x04, 0x11, 0x81, 0x05, 0x19,
+  0x02, 0x05, 0x11, 0x81, 0x05, 0x19, 0x10, 0x25, 0x19, 0x11, 0x05, 0x19, 0x81, 0xaf, 0x6b, 0x41, 0x00, 0x00, 0x83, 0x10, 0x7c, 0x04, 0x11, 0x04, 0x19, 0x04, 0x05, 0x11, 0x09, 0x05, 0x19, 0x04,
+  0x04, 0x19, 0x03, 0xe4, 0x10, 0x81, 0xe4, 0x18, 0x02, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x05, 0x05, 0x19, 0x08, 0x05, 0x11, 0x81, 0x05, 0x19, 0x0a, 0x25, 0x19, 0x81, 0x05, 0x19, 0x02, 0x25, 0x19,
+  0x02, 0x05, 0x19, 0x02, 0x25, 0x19, 0x07, 0x05, 0x19, 0x81, 0x05, 0x11, 0x03, 0x05, 0x19, 0x82, 0x05, 0x11, 0x04, 0x11, 0x02, 0x05, 0x19, 0x83, 0xe5, 0x10, 0x66, 0x21, 0x96, 0xa5, 0x3f, 0x00,
+  0x00, 0x82, 0x35, 0x9d, 0x09, 0x3a, 0x02, 0x05, 0x11, 0x02, 0x04, 0x11, 0x03, 0x05, 0x11, 0x02, 0x04, 0x11, 0x81, 0x04, 0x19, 0x06, 0x05, 0x19, 0x02, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x04, 0xe4,
+  0x18, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x03, 0x05, 0x19, 0x02, 0x04, 0x19, 0x02, 0x05, 0x19, 0x02, 0x05, 0x11, 0x81, 0x05, 0x19, 0x02, 0x05, 0x11, 0x09, 0x05, 0x19, 0x07, 0x04, 0x19, 0x0a,
+  0x05, 0x19, 0x05, 0x04, 0x19, 0x02, 0x05, 0x19, 0x83, 0x05, 0x11, 0xec, 0x52, 0xbb, 0xce, 0x3d, 0x00, 0x00, 0x82, 0x19, 0xbe, 0xec, 0x52, 0x03, 0x05, 0x11, 0x02, 0x04, 0x11, 0x03, 0x05, 0x11,
+  0x02, 0x04, 0x11, 0x81, 0x04, 0x19, 0x06, 0x05, 0x19, 0x02, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x04, 0xe4, 0x18, 0x02, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x81, 0x05, 0x19, 0x03, 0x04, 0x19, 0x02, 0x05,
+  0x19, 0x02, 0x05, 0x11, 0x81, 0x05, 0x19, 0x02, 0x04, 0x11, 0x81, 0x05, 0x11, 0x08, 0x05, 0x19, 0x07, 0x04, 0x19, 0x09, 0x05, 0x19, 0x03, 0x04, 0x19, 0x03, 0xe4, 0x10, 0x04, 0x05, 0x19, 0x81,
+  0xd0, 0x73, 0x3d, 0x00, 0x00, 0x82, 0x0c, 0x5b, 0x04, 0x11, 0x05, 0x05, 0x11, 0x02, 0x05, 0x19, 0x02, 0x04, 0x19, 0x08, 0x05, 0x19, 0x02, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x02, 0xe4, 0x18, 0x81,
+  0xe4, 0x10, 0x05, 0xe4, 0x18, 0x05, 0x04, 0x19, 0x03, 0x05, 0x19, 0x04, 0x04, 0x19, 0x05, 0x05, 0x19, 0x81, 0x04, 0x19, 0x02, 0xe4, 0x18, 0x09, 0x04, 0x19, 0x07, 0x05, 0x19, 0x03, 0x04, 0x19,
+  0x05, 0xe4, 0x10, 0x03, 0x05, 0x19, 0x82, 0xa7, 0x29, 0xb3, 0x8c, 0x3b, 0x00, 0x00, 0x82, 0x31, 0x7c, 0x25, 0x21, 0x03, 0x04, 0x11, 0x03, 0x05, 0x11, 0x02, 0x05, 0x19, 0x02, 0x04, 0x19, 0x08,
+  0x05, 0x19, 0x02, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x09, 0xe4, 0x18, 0x04, 0x04, 0x19, 0x03, 0x05, 0x19, 0x04, 0x04, 0x19, 0x05, 0x05, 0x19, 0x81, 0x04, 0x19, 0x02, 0xe4, 0x18, 0x08, 0x04, 0x19,
+  0x07, 0x05, 0x19, 0x02, 0x04, 0x19, 0x07, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x03, 0x05, 0x19, 0x82, 0x4a, 0x42, 0x11, 0x7c, 0x39, 0x00, 0x00, 0x82, 0x19, 0xbe, 0x6a, 0x42, 0x02, 0xe4, 0x10, 0x03,
+  0x04, 0x11, 0x04, 0x05, 0x11, 0x05, 0x04, 0x19, 0x05, 0x05, 0x19, 0x83, 0x04, 0x19, 0x09, 0x3a, 0x25, 0x19, 0x07, 0xe4, 0x18, 0x81, 0x04, 0x19, 0x03, 0xe4, 0x18, 0x81, 0x04, 0x19, 0x02, 0x05,
+  0x19, 0x04, 0x04, 0x19, 0x81, 0x05, 0x19, 0x02, 0x04, 0x19, 0x05, 0x05, 0x19, 0x81, 0x04, 0x19, 0x05, 0xe4, 0x18, 0x03, 0x04, 0x19, 0x82, 0x25, 0x19, 0xe9, 0x31, 0x06, 0x05, 0x19, 0x02, 0x04,
+  0x19, 0x09, 0xe4, 0x10, 0x02, 0x05, 0x19, 0x83, 0x05, 0x11, 0x05, 0x19, 0xec, 0x52, 0x39, 0x00, 0x00, 0x82, 0x31, 0x7c, 0x05, 0x11, 0x02, 0xe4, 0x10, 0x09, 0x04, 0x11, 0x03, 0x04, 0x19, 0x05,
+  0x05, 0x19, 0x86, 0x66, 0x21, 0xf5, 0x94, 0xf5, 0x8c, 0x8f, 0x6b, 0xe8, 0x31, 0xe4, 0x10, 0x08, 0xe4, 0x18, 0x81, 0x04, 0x19, 0x02, 0x05, 0x19, 0x07, 0x04, 0x19, 0x05, 0x05, 0x19, 0x81, 0x04,
+  0x19, 0x04, 0xe4, 0x18, 0x02, 0xe4, 0x10, 0x85, 0x08, 0x32, 0xaf, 0x63, 0x15, 0x8d, 0x97, 0x9d, 0x8b, 0x42, 0x03, 0x05, 0x19, 0x04, 0x04, 0x19, 0x09, 0xe4, 0x10, 0x81, 0xe5, 0x18, 0x02, 0x05,
+  0x11, 0x83, 0x05, 0x19, 0x87, 0x29, 0xb8, 0xad, 0x38, 0x00, 0x00, 0x81, 0x25, 0x19, 0x04, 0x04, 0x11, 0x81, 0xe4, 0x10, 0x07, 0x04, 0x11, 0x81, 0xe4, 0x10, 0x02, 0x04, 0x19, 0x05, 0x05, 0x19,
+  0x81, 0xaf, 0x6b, 0x02, 0x57, 0x9d, 0x02, 0x77, 0x9d, 0x86, 0xd5, 0x8c, 0x8f, 0x63, 0x4a, 0x42, 0xa8, 0x29, 0x05, 0x19, 0xe4, 0x10, 0x04, 0x04, 0x19, 0x04, 0x05, 0x19, 0x04, 0x04, 0x19, 0x06,
+  0x05, 0x19, 0x03, 0x04, 0x11, 0x85, 0x86, 0x29, 0xec, 0x52, 0x11, 0x74, 0xf5, 0x8c, 0x77, 0x95, 0x02, 0x77, 0x9d, 0x85, 0x97, 0x9d, 0xf5, 0x8c, 0x66, 0x21, 0x04, 0x19, 0x05, 0x19, 0x04, 0x04,
+  0x19, 0x0b, 0xe4, 0x10, 0x81, 0x04, 0x11, 0x02, 0x05, 0x11, 0x81, 0x09, 0x3a, 0x38, 0x00, 0x00, 0x82, 0x0c, 0x53, 0x05, 0x11, 0x02, 0x04, 0x11, 0x81, 0xe4, 0x10, 0x08, 0x04, 0x11, 0x03, 0x04,
+  0x19, 0x04, 0x05, 0x19, 0x84, 0xa7, 0x29, 0x77, 0x9d, 0x98, 0xa5, 0x97, 0xa5, 0x02, 0x97, 0x9d, 0x04, 0x98, 0x9d, 0x84, 0x77, 0x95, 0x15, 0x8d, 0xb4, 0x84, 0x46, 0x21, 0x06, 0x05, 0x19, 0x04,
+  0x04, 0x19, 0x06, 0x05, 0x19, 0x86, 0x0c, 0x53, 0xb3, 0x8c, 0x15, 0x95, 0x76, 0xa5, 0x97, 0xa5, 0x97, 0x9d, 0x02, 0x97, 0xa5, 0x03, 0xb8, 0xa5, 0x83, 0xd8, 0xa5, 0x2d, 0x5b, 0x05, 0x19, 0x04,
+  0x04, 0x19, 0x0c, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x82, 0xa7, 0x29, 0x73, 0x84, 0x39, 0x00, 0x00, 0x81, 0xe8, 0x31, 0x02, 0x05, 0x11, 0x81, 0xe4, 0x10, 0x08, 0x04, 0x11, 0x02, 0x04, 0x19, 0x04,
+  0x05, 0x19, 0x82, 0x25, 0x19, 0x4e, 0x63, 0x02, 0xd8, 0xad, 0x84, 0x39, 0xb6, 0xb8, 0xad, 0x97, 0xa5, 0x98, 0xa5, 0x05, 0x98, 0x9d, 0x82, 0xb8, 0x9d, 0x87, 0x29, 0x04, 0x05, 0x19, 0x05, 0x04,
+  0x19, 0x81, 0x04, 0x11, 0x02, 0x05, 0x11, 0x03, 0x05, 0x19, 0x82, 0x25, 0x19, 0xf0, 0x73, 0x02, 0x76, 0xa5, 0x03, 0x97, 0xa5, 0x02, 0xb7, 0xa5, 0x87, 0xb8, 0xa5, 0xd8, 0xa5, 0x98, 0xa5, 0xd8,
+  0xad, 0x00, 0x00, 0x6a, 0x42, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x0c, 0xe4, 0x10, 0x84, 0x05, 0x11, 0x86, 0x29, 0xb3, 0x8c, 0xd8, 0xad, 0x39, 0x00, 0x00, 0x84, 0x8f, 0x63, 0xec, 0x52, 0x05, 0x19,
+  0xe4, 0x10, 0x04, 0x04, 0x11, 0x81, 0x04, 0x19, 0x05, 0x04, 0x11, 0x81, 0x04, 0x19, 0x03, 0x05, 0x19, 0x85, 0x6a, 0x42, 0x00, 0x00, 0xdc, 0xd6, 0xdc, 0xce, 0xbb, 0xce, 0x02, 0x9b, 0xce, 0x82,
+  0xd8, 0xb5, 0xb8, 0xa5, 0x03, 0x98, 0xa5, 0x02, 0xb8, 0x9d, 0x83, 0xe8, 0x31, 0x04, 0x19, 0x05, 0x19, 0x04, 0x04, 0x19, 0x02, 0x04, 0x11, 0x83, 0xe4, 0x10, 0x04, 0x11, 0x05, 0x19, 0x02, 0x05,
+  0x11, 0x02, 0x05, 0x19, 0x82, 0x25, 0x19, 0xf0, 0x73, 0x02, 0x97, 0xa5, 0x02, 0x97, 0xad, 0x02, 0xb7, 0xad, 0x81, 0xd8, 0xad, 0x05, 0x00, 0x00, 0x82, 0xaf, 0x6b, 0xc7, 0x31, 0x04, 0x04, 0x19,
+  0x09, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x84, 0xab, 0x52, 0xf4, 0x94, 0x97, 0xa5, 0xd8, 0xad, 0x39, 0x00, 0x00, 0x87, 0xb8, 0xad, 0xb7, 0xa5, 0xd4, 0x8c, 0xec, 0x52, 0xe4, 0x10, 0x05, 0x11, 0x04,
+  0x11, 0x02, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x03, 0x04, 0x11, 0x84, 0x04, 0x19, 0x05, 0x19, 0x25, 0x19, 0x29, 0x3a, 0x02, 0x00, 0x00, 0x81, 0x5a, 0xbe, 0x07, 0x00, 0x00, 0x86, 0xb8, 0xad, 0xf9,
+  0xb5, 0x7a, 0xc6, 0x9b, 0xc6, 0x4a, 0x42, 0xe4, 0x18, 0x03, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x02, 0xe4, 0x10, 0x81, 0xe5, 0x18, 0x02, 0x05, 0x11, 0x02, 0x05, 0x19, 0x84, 0x25,
+  0x19, 0x6f, 0x63, 0xb8, 0xad, 0xb7, 0xad, 0x0b, 0x00, 0x00, 0x82, 0x4d, 0x63, 0x25, 0x19, 0x02, 0x04, 0x19, 0x09, 0xe4, 0x10, 0x87, 0x04, 0x11, 0xa7, 0x29, 0x10, 0x7c, 0x35, 0x9d, 0x76, 0xa5,
+  0x97, 0xad, 0xb7, 0xad, 0x39, 0x00, 0x00, 0x02, 0x97, 0xa5, 0x02, 0x76, 0x9d, 0x83, 0x72, 0x84, 0xc8, 0x31, 0xe4, 0x10, 0x03, 0x04, 0x19, 0x02, 0xe4, 0x10, 0x04, 0x05, 0x19, 0x82, 0x87, 0x29,
+  0x8f, 0x6b, 0x0c, 0x00, 0x00, 0x84, 0xbb, 0xce, 0xfc, 0xd6, 0xab, 0x4a, 0x04, 0x11, 0x02, 0x04, 0x19, 0x08, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x04, 0x05, 0x19, 0x81, 0x93, 0x8c, 0x0e, 0x00, 0x00,
+  0x82, 0x4a, 0x42, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x07, 0xe4, 0x10, 0x88, 0x05, 0x11, 0xcb, 0x52, 0xd3, 0x94, 0x55, 0x9d, 0x76, 0xa5, 0x97, 0xa5, 0xb7, 0xad, 0xd8, 0xad, 0x39, 0x00, 0x00, 0x02,
+  0x97, 0xa5, 0x81, 0x77, 0x9d, 0x02, 0x76, 0x9d, 0x82, 0x35, 0x9d, 0xcc, 0x52, 0x05, 0xe4, 0x10, 0x04, 0x05, 0x19, 0x82, 0x0d, 0x5b, 0xf8, 0xad, 0x0d, 0x00, 0x00, 0x83, 0xfd, 0xd6, 0x8b, 0x4a,
+  0x04, 0x11, 0x02, 0x04, 0x19, 0x08, 0xe4, 0x10, 0x81, 0x04, 0x19, 0x03, 0x05, 0x19, 0x82, 0x25, 0x19, 0xf0, 0x73, 0x0e, 0x00, 0x00, 0x82, 0x8e, 0x63, 0xc7, 0x31, 0x02, 0x05, 0x11, 0x02, 0x04,
+  0x19, 0x04, 0x05, 0x19, 0x88, 0x25, 0x19, 0xd0, 0x73, 0x35, 0x9d, 0x56, 0x9d, 0x76, 0xa5, 0x97, 0xa5, 0x97, 0xad, 0xb7, 0xad, 0x3b, 0x00, 0x00, 0x02, 0x77, 0xa5, 0x81, 0x76, 0xa5, 0x03, 0x76,
+  0x9d, 0x82, 0x31, 0x7c, 0x25, 0x21, 0x03, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x83, 0x05, 0x11, 0xa7, 0x29, 0x8b, 0x42, 0x0e, 0x00, 0x00, 0x83, 0x1d, 0xd7, 0x6a, 0x42, 0xe4, 0x18, 0x0a, 0xe4, 0x10,
+  0x81, 0x04, 0x11, 0x02, 0x05, 0x11, 0x02, 0x25, 0x19, 0x81, 0x29, 0x3a, 0x0f, 0x00, 0x00, 0x81, 0x8b, 0x4a, 0x02, 0x05, 0x11, 0x81, 0x05, 0x19, 0x04, 0x05, 0x11, 0x89, 0x87, 0x29, 0x72, 0x84,
+  0x56, 0x9d, 0x76, 0x9d, 0x76, 0xa5, 0x96, 0xa5, 0xb7, 0xa5, 0xb7, 0xad, 0xd8, 0xad, 0x3c, 0x00, 0x00, 0x02, 0x97, 0xa5, 0x81, 0x77, 0xa5, 0x02, 0x76, 0xa5, 0x83, 0x76, 0x9d, 0xb3, 0x8c, 0x08,
+  0x3a, 0x02, 0xe4, 0x10, 0x02, 0x04, 0x11, 0x82, 0x05, 0x19, 0xcb, 0x4a, 0x0f, 0x00, 0x00, 0x82, 0xfd, 0xd6, 0x6a, 0x42, 0x0c, 0xe4, 0x10, 0x02, 0x05, 0x11, 0x83, 0x05, 0x19, 0x25, 0x19, 0x49,
+  0x42, 0x0f, 0x00, 0x00, 0x83, 0x93, 0x84, 0x08, 0x3a, 0xe4, 0x10, 0x04, 0x05, 0x11, 0x82, 0x6a, 0x42, 0xf4, 0x94, 0x02, 0x76, 0xa5, 0x03, 0x97, 0xa5, 0x02, 0xb7, 0xad, 0x3e, 0x00, 0x00, 0x02,
+  0x97, 0xa5, 0x02, 0x77, 0xa5, 0x84, 0x76, 0xa5, 0x56, 0x9d, 0x15, 0x95, 0x8b, 0x4a, 0x02, 0xe4, 0x10, 0x83, 0xe5, 0x10, 0x8a, 0x42, 0x46, 0x19, 0x0f, 0x00, 0x00, 0x82, 0xfd, 0xd6, 0x6b, 0x42,
+  0x0c, 0xe4, 0x10, 0x82, 0xe5, 0x10, 0x05, 0x11, 0x02, 0x05, 0x19, 0x81, 0x0d, 0x5b, 0x10, 0x00, 0x00, 0x87, 0x2d, 0x5b, 0xa7, 0x29, 0xe5, 0x10, 0x05, 0x11, 0x66, 0x21, 0x0d, 0x5b, 0x76, 0xa5,
+  0x04, 0x97, 0xa5, 0x81, 0xb7, 0xa5, 0x02, 0xb7, 0xad, 0x40, 0x00, 0x00, 0x8b, 0xb7, 0xad, 0x97, 0xa5, 0x77, 0xa5, 0x76, 0xa5, 0x56, 0x9d, 0x76, 0x9d, 0x56, 0x9d, 0x31, 0x7c, 0x2d, 0x5b, 0xaf,
+  0x6b, 0x36, 0x9d, 0x10, 0x00, 0x00, 0x82, 0x1e, 0xd7, 0x6b, 0x42, 0x0d, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x81, 0x4d, 0x63, 0x11, 0x00, 0x00, 0x84, 0x11, 0x7c, 0xab, 0x4a, 0x26, 0x19, 0xf0, 0x73,
+  0x02, 0xb7, 0xad, 0x04, 0xb7, 0xa5, 0x81, 0xd8, 0xad, 0x43, 0x00, 0x00, 0x84, 0xb7, 0xad, 0x97, 0xa5, 0x77, 0xa5, 0x76, 0xa5, 0x02, 0x77, 0xa5, 0x83, 0x97, 0xa5, 0xb7, 0xa5, 0xd8, 0xad, 0x11,
+  0x00, 0x00, 0x82, 0xfd, 0xd6, 0x8b, 0x4a, 0x0d, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x81, 0x6e, 0x63, 0x16, 0x00, 0x00, 0x05, 0xb7, 0xad, 0x46, 0x00, 0x00, 0x81, 0xb7, 0xad, 0x03, 0x97, 0xa5, 0x82,
+  0xb7, 0xa5, 0xd8, 0xad, 0x12, 0x00, 0x00, 0x82, 0xdc, 0xce, 0x6b, 0x42, 0x0c, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x03, 0x05, 0x11, 0x81, 0x8b, 0x4a, 0x63, 0x00, 0x00, 0x84, 0xb7, 0xad, 0xb8, 0xad,
+  0xd8, 0xad, 0xf8, 0xad, 0x13, 0x00, 0x00, 0x81, 0x2d, 0x5b, 0x0c, 0xe4, 0x10, 0x81, 0xe5, 0x10, 0x02, 0x05, 0x11, 0x82, 0x25, 0x19, 0xcf, 0x6b, 0x7a, 0x00, 0x00, 0x82, 0x0d, 0x5b, 0x05, 0x19,
+  0x0b, 0xe4, 0x10, 0x03, 0x05, 0x11, 0x82, 0x8b, 0x4a, 0x7a, 0xc6, 0x7b, 0x00, 0x00, 0x82, 0x2d, 0x5b, 0x49, 0x42, 0x02, 0x29, 0x3a, 0x8c, 0xcc, 0x52, 0x0d, 0x5b, 0x05, 0x19, 0x05, 0x11, 0x46,
+  0x21, 0xe8, 0x31, 0x49, 0x42, 0x66, 0x21, 0x05, 0x11, 0xc7, 0x31, 0x6a, 0x42, 0x67, 0x19, 0x5c, 0x00, 0x00, 0x89, 0x00, 0x04, 0x55, 0xae, 0xee, 0xff, 0xff, 0xff, 0xeb, 0xc5, 0xd9, 0xf9, 0xff,
+  0xff, 0xff, 0xfd, 0x9b, 0x1c, 0x3d, 0x00, 0x00, 0x82, 0x00, 0x8d, 0xf9, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xe3, 0x20, 0x00, 0x3c, 0x00, 0x00, 0x81, 0x22, 0xfc, 0x08, 0xff, 0xff, 0x81, 0x99,
+  0x00, 0x3c, 0x00, 0x00, 0x81, 0x0d, 0xf8, 0x08, 0xff, 0xff, 0x81, 0x9a, 0x00, 0x3c, 0x00, 0x00, 0x81, 0x1d, 0xfb, 0x08, 0xff, 0xff, 0x81, 0x96, 0x00, 0x3c, 0x00, 0x00, 0x81, 0x17, 0xfa, 0x08,
+  0xff, 0xff, 0x81, 0x9e, 0x00, 0x3c, 0x00, 0x00, 0x81, 0x16, 0xfa, 0x08, 0xff, 0xff, 0x81, 0x97, 0x00, 0x31, 0x00, 0x00, 0x83, 0x00, 0x17, 0x84, 0xb1, 0x4c, 0x03, 0x08, 0x00, 0x00, 0x81, 0x30,
+  0xff, 0x08, 0xff, 0xff, 0x81, 0x93, 0x00, 0x07, 0x00, 0x00, 0x84, 0x00, 0x06, 0x75, 0xa3, 0xb6, 0x7f, 0x22, 0x00, 0x25, 0x00, 0x00, 0x85, 0x00, 0x0c, 0x87, 0xf2, 0xff, 0xff, 0xff, 0xbb, 0x1b,
+  0x00, 0x07, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0xb6, 0x00, 0x07, 0x00, 0x00, 0x81, 0x04, 0xc7, 0x02, 0xff, 0xff, 0x82, 0xf0, 0x62, 0x06, 0x00, 0x24, 0x00, 0x00, 0x81, 0x17,
+  0xc5, 0x03, 0xff, 0xff, 0x81, 0xab, 0x08, 0x07, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0xbc, 0x00, 0x07, 0x00, 0x00, 0x81, 0x7a, 0xfa, 0x03, 0xff, 0xff, 0x81, 0xb7, 0x0f, 0x23,
+  0x00, 0x00, 0x82, 0x00, 0x54, 0xe9, 0xff, 0x03, 0xff, 0xff, 0x82, 0xff, 0x84, 0x01, 0x00, 0x06, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0xbc, 0x00, 0x06, 0x00, 0x00, 0x82, 0x00,
+  0x1d, 0xe2, 0xff, 0x03, 0xff, 0xff, 0x82, 0xff, 0xe7, 0x3c, 0x00, 0x21, 0x00, 0x00, 0x82, 0x00, 0x1c, 0x9b, 0xf9, 0x04, 0xff, 0xff, 0x82, 0xff, 0xf3, 0x28, 0x00, 0x06, 0x00, 0x00, 0x81, 0x30,
+  0xff, 0x08, 0xff, 0xff, 0x81, 0xbc, 0x00, 0x06, 0x00, 0x00, 0x81, 0x00, 0xb2, 0x05, 0xff, 0xff, 0x81, 0xf9, 0x76, 0x21, 0x00, 0x00, 0x81, 0x3c, 0xdf, 0x06, 0xff, 0xff, 0x81, 0xd8, 0x1b, 0x06,
+  0x00, 0x00, 0x81, 0x2b, 0xfe, 0x08, 0xff, 0xff, 0x81, 0xae, 0x05, 0x06, 0x00, 0x00, 0x81, 0x5c, 0xfb, 0x06, 0xff, 0xff, 0x81, 0xaa, 0x07, 0x1f, 0x00, 0x00, 0x82, 0x02, 0x5f, 0xec, 0xff, 0x06,
+  0xff, 0xff, 0x82, 0xff, 0xb8, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x1b, 0x4e, 0x85, 0xca, 0xfd, 0x08, 0xff, 0xff, 0x83, 0xec, 0xd5, 0xae, 0x5c, 0x26, 0x07, 0x03, 0x00, 0x00, 0x82, 0x00,
+  0x27, 0xea, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xcf, 0x2c, 0x00, 0x1d, 0x00, 0x00, 0x82, 0x00, 0x0f, 0x7d, 0xfa, 0x07, 0xff, 0xff, 0x86, 0xff, 0xf8, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x15, 0x49,
+  0x8e, 0xce, 0xf7, 0x0c, 0xff, 0xff, 0x85, 0xf7, 0xd6, 0x6c, 0x3c, 0x0b, 0x00, 0x00, 0x00, 0x1b, 0xd3, 0x08, 0xff, 0xff, 0x82, 0xee, 0x56, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x81, 0x0a, 0xae, 0x09,
+  0xff, 0xff, 0x84, 0xf2, 0x56, 0x01, 0x19, 0x77, 0xe1, 0xfd, 0xff, 0x0e, 0xff, 0xff, 0x84, 0xff, 0xfc, 0xde, 0x5f, 0x0a, 0x00, 0x84, 0xfe, 0x08, 0xff, 0xff, 0x82, 0xff, 0xfd, 0x84, 0x00, 0x1c,
+  0x00, 0x00, 0x81, 0x78, 0xfd, 0x09, 0xff, 0xff, 0x82, 0xff, 0xe5, 0xce, 0xf2, 0x12, 0xff, 0xff, 0x82, 0xe8, 0x90, 0xf3, 0xff, 0x09, 0xff, 0xff, 0x81, 0xfb, 0x35, 0x1c, 0x00, 0x00, 0x81, 0xc1,
+  0xff, 0x28, 0xff, 0xff, 0x81, 0xff, 0x73, 0x1c, 0x00, 0x00, 0x81, 0x83, 0xff, 0x12, 0xff, 0xff, 0x81, 0xe9, 0xff, 0x02, 0xff, 0xff, 0x82, 0xf1, 0xff, 0xf9, 0xff, 0x11, 0xff, 0xff, 0x81, 0xff,
+  0x63, 0x1c, 0x00, 0x00, 0x81, 0x10, 0xee, 0x0f, 0xff, 0xff, 0x02, 0xff, 0xf2, 0x02, 0xff, 0xff, 0x86, 0xfb, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0x0f, 0xff, 0xff,
+  0x81, 0xef, 0x1d, 0x1c, 0x00, 0x00, 0x82, 0x00, 0x4a, 0xfd, 0xff, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xf0, 0xf1, 0xff, 0x03, 0xff, 0xff, 0x84, 0xff, 0xf7, 0xf5, 0xff, 0xfd, 0xfb, 0xf6, 0xff, 0x03,
+  0xff, 0xff, 0x81, 0xf4, 0xff, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xfa, 0x2d, 0x1d, 0x00, 0x00, 0x81, 0x94, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xe7, 0xfc, 0xff, 0x04, 0xff, 0xff, 0x81, 0xfc,
+  0xf8, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x05, 0xff, 0xff, 0x81, 0xf4, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xdc, 0xf5, 0x18, 0x1d, 0x00, 0x00, 0x81, 0x05, 0xc6, 0x09, 0xff, 0xff, 0x82, 0xff,
+  0xf1, 0xff, 0xf2, 0x06, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xee, 0x06, 0xff, 0xff, 0x81, 0xfc, 0xff, 0x09, 0xff, 0xff, 0x83, 0xff, 0xfe, 0xe2, 0xff, 0x95, 0x00, 0x1d,
+  0x00, 0x00, 0x82, 0x00, 0x25, 0xe7, 0xff, 0x07, 0xff, 0xff, 0x82, 0xff, 0xf9, 0xfc, 0xf2, 0x0a, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x07, 0xff, 0xff, 0x81, 0xe5, 0xff, 0x08, 0xff, 0xff, 0x83, 0xff,
+  0xd9, 0xfe, 0xf1, 0x15, 0x00, 0x1e, 0x00, 0x00, 0x81, 0x70, 0xf9, 0x07, 0xff, 0xff, 0x81, 0xf2, 0xf7, 0x08, 0xff, 0xff, 0x81, 0xf9, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf4, 0x10, 0xff, 0xff,
+  0x82, 0xf4, 0xf8, 0xff, 0x7c, 0x1f, 0x00, 0x00, 0x81, 0x05, 0xac, 0x06, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf1, 0x0f, 0xff, 0xff, 0x83, 0xff, 0xee, 0xf6, 0xff, 0xd2,
+  0x09, 0x1f, 0x00, 0x00, 0x82, 0x00, 0x2b, 0xd7, 0xff, 0x22, 0xff, 0xff, 0x83, 0xff, 0xda, 0xff, 0xf7, 0x33, 0x00, 0x1f, 0x00, 0x00, 0x82, 0x08, 0xae, 0xf9, 0xff, 0x04, 0xff, 0xff, 0x81, 0xfe,
+  0xff, 0x0a, 0xff, 0xff, 0x81, 0xff, 0xf9, 0x12, 0xff, 0xff, 0x82, 0xff, 0xe9, 0xdb, 0x69, 0x1f, 0x00, 0x00, 0x82, 0x00, 0x13, 0xc9, 0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xfa, 0xf3, 0xff, 0x1e,
+  0xff, 0xff, 0x81, 0xec, 0x6d, 0x1f, 0x00, 0x00, 0x81, 0x1a, 0xce, 0x05, 0xff, 0xff, 0x81, 0xff, 0xf8, 0x0a, 0xff, 0xff, 0x82, 0xff, 0xf5, 0xff, 0xf7, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x0b,
+  0xff, 0xff, 0x81, 0xf5, 0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xf9, 0x59, 0x00, 0x16, 0x00, 0x00, 0x83, 0x08, 0x70, 0xaa, 0x9c, 0x52, 0x01, 0x04, 0x00, 0x00, 0x82, 0x00, 0x0c, 0xca, 0xff, 0x04,
+  0xff, 0xff, 0x82, 0xff, 0xfd, 0xf3, 0xff, 0x08, 0xff, 0xff, 0x83, 0xff, 0xfe, 0xf4, 0xfa, 0xf2, 0xfc, 0x05, 0xff, 0xff, 0x81, 0xfa, 0xf6, 0x09, 0xff, 0xff, 0x81, 0xf6, 0xf8, 0x05, 0xff, 0xff,
+  0x81, 0xf7, 0x49, 0x05, 0x00, 0x00, 0x83, 0x01, 0x34, 0x94, 0xa9, 0x65, 0x04, 0x0d, 0x00, 0x00, 0x85, 0x00, 0x38, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x81, 0x16,
+  0xb5, 0x05, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x09, 0xff, 0xff, 0x82, 0xf7, 0xfc, 0xf7, 0xff, 0x07, 0xff, 0xff, 0x82, 0xfe, 0xfb, 0xfc, 0xff, 0x07, 0xff, 0xff, 0x81, 0xff, 0xf4, 0x05, 0xff, 0xff,
+  0x82, 0xff, 0xf9, 0x64, 0x00, 0x03, 0x00, 0x00, 0x85, 0x00, 0x08, 0x9b, 0xf7, 0xff, 0xff, 0xff, 0xa9, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x81, 0x08, 0xdc, 0x03, 0xff, 0xff, 0x81, 0xd6, 0x3a, 0x02,
+  0x00, 0x00, 0x82, 0x00, 0x0c, 0xc0, 0xff, 0x05, 0xff, 0xff, 0x81, 0xef, 0xfb, 0x08, 0xff, 0xff, 0x82, 0xff, 0xf2, 0xf9, 0xff, 0x08, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xf1, 0xf7, 0x0e, 0xff, 0xff,
+  0x81, 0xee, 0x3f, 0x02, 0x00, 0x00, 0x82, 0x00, 0x01, 0x45, 0xd8, 0x03, 0xff, 0xff, 0x81, 0x84, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x04, 0xac, 0xff, 0x03, 0xff, 0xff, 0x84, 0xff, 0xf2, 0x72,
+  0x03, 0x00, 0x00, 0x03, 0xa1, 0x06, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x07, 0xff, 0xff, 0x82, 0xff, 0xfa, 0xf9, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x08, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x05,
+  0xff, 0xff, 0x85, 0xff, 0xf1, 0x26, 0x00, 0x00, 0x00, 0x26, 0xa5, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x81, 0xf6, 0x34, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x70, 0xfd, 0xff, 0x04, 0xff, 0xff, 0x83, 0xff,
+  0xc1, 0x1c, 0x00, 0x77, 0xff, 0x0e, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x1b, 0xff, 0xff, 0x83, 0xc5, 0x17, 0x08, 0x5a, 0xe9, 0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xd3, 0x0c, 0x00, 0x0a, 0x00, 0x00,
+  0x81, 0x2c, 0xef, 0x06, 0xff, 0xff, 0x82, 0xf2, 0x8d, 0xf8, 0xff, 0x13, 0xff, 0xff, 0x85, 0xfe, 0xfb, 0xe0, 0xc2, 0xc3, 0xdb, 0xe4, 0xf8, 0xfd, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xe9, 0xfc,
+  0xff, 0x05, 0xff, 0xff, 0x82, 0xff, 0xa4, 0xba, 0xfc, 0x06, 0xff, 0xff, 0x81, 0x7e, 0x01, 0x09, 0x00, 0x00, 0x82, 0x00, 0x08, 0xbf, 0xff, 0x0d, 0xff, 0xff, 0x81, 0xf7, 0xfe, 0x0b, 0xff, 0xff,
+  0x88, 0xff, 0xfa, 0xf2, 0xff, 0xfd, 0xff, 0xff, 0xfc, 0xeb, 0xe3, 0xeb, 0xe5, 0xcb, 0xb4, 0xe4, 0xff, 0x03, 0xff, 0xff, 0x81, 0xff, 0xf7, 0x05, 0xff, 0xff, 0x82, 0xff, 0xf8, 0xfb, 0xe8, 0x0e,
+  0xff, 0xff, 0x81, 0xf9, 0x38, 0x09, 0x00, 0x00, 0x82, 0x00, 0x6f, 0xfa, 0xff, 0x0d, 0xff, 0xff, 0x81, 0xf1, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xe9, 0xff, 0x03, 0xff, 0xff, 0x81, 0xc2,
+  0xdd, 0x02, 0xff, 0xff, 0x86, 0xfa, 0xe8, 0xd3, 0xcf, 0xee, 0xee, 0xee, 0xd5, 0xae, 0xca, 0xef, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf7, 0x05, 0xff, 0xff, 0x81, 0xff, 0xf9, 0x03, 0xff, 0xff,
+  0x81, 0xfc, 0xfe, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xd1, 0x04, 0x00, 0x08, 0x00, 0x00, 0x81, 0x29, 0xeb, 0x0e, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x07, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xff, 0xff,
+  0x8a, 0xfc, 0xa2, 0xea, 0xff, 0xff, 0xff, 0xf9, 0xf5, 0xc6, 0xa4, 0xc6, 0xc7, 0xd1, 0xd5, 0xd6, 0xc8, 0xe8, 0xfe, 0xc8, 0xf1, 0x03, 0xff, 0xff, 0x81, 0xf5, 0xff, 0x08, 0xff, 0xff, 0x82, 0xff,
+  0xfb, 0xda, 0xe4, 0x0b, 0xff, 0xff, 0x81, 0x82, 0x01, 0x07, 0x00, 0x00, 0x82, 0x00, 0x04, 0xc7, 0xff, 0x18, 0xff, 0xff, 0x8c, 0xff, 0xfb, 0xac, 0xdf, 0xff, 0xff, 0xfe, 0xc8, 0x48, 0x20, 0x14,
+  0x06, 0x00, 0x01, 0x15, 0x24, 0x34, 0x83, 0xce, 0xfc, 0xff, 0xf7, 0xed, 0xff, 0x04, 0xff, 0xff, 0x81, 0xff, 0xf1, 0x06, 0xff, 0xff, 0x83, 0xff, 0xe0, 0x44, 0x39, 0xf4, 0xff, 0x0a, 0xff, 0xff,
+  0x81, 0xf2, 0x2f, 0x07, 0x00, 0x00, 0x82, 0x00, 0x71, 0xfc, 0xff, 0x0a, 0xff, 0xff, 0x81, 0x90, 0xc6, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf5, 0x0a, 0xff, 0xff, 0x84, 0xff, 0xb5, 0xe3, 0xff, 0xff,
+  0xee, 0x6b, 0x02, 0x05, 0x00, 0x00, 0x83, 0x0e, 0x6f, 0xe4, 0xfe, 0xc6, 0xf0, 0x02, 0xff, 0xff, 0x83, 0xff, 0xf1, 0xf2, 0xff, 0xf3, 0xff, 0x07, 0xff, 0xff, 0x82, 0x4e, 0x01, 0x6c, 0xff, 0x0a,
+  0xff, 0xff, 0x82, 0xff, 0xc6, 0x0d, 0x00, 0x06, 0x00, 0x00, 0x81, 0x1f, 0xec, 0x0a, 0xff, 0xff, 0x82, 0xff, 0xc1, 0x09, 0xb6, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x07, 0xff, 0xff, 0x81, 0xf1,
+  0xff, 0x02, 0xff, 0xff, 0x83, 0xef, 0xd4, 0xff, 0xff, 0xcf, 0x27, 0x07, 0x00, 0x00, 0x82, 0x10, 0x97, 0xf1, 0xcd, 0x09, 0xff, 0xff, 0x85, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x6b, 0x00, 0x22,
+  0xaf, 0x0b, 0xff, 0xff, 0x81, 0x7f, 0x00, 0x06, 0x00, 0x00, 0x81, 0x8f, 0xff, 0x0a, 0xff, 0xff, 0x82, 0xf5, 0x23, 0x00, 0xeb, 0x09, 0xff, 0xff, 0x82, 0xff, 0xf3, 0xfe, 0xff, 0x02, 0xff, 0xff,
+  0x83, 0xf1, 0xff, 0xff, 0xd1, 0x15, 0x00, 0x08, 0x00, 0x00, 0x82, 0x18, 0x43, 0xcf, 0xff, 0x08, 0xff, 0xff, 0x86, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x57, 0x00, 0x06, 0x2a, 0xdb, 0xff, 0x0a,
+  0xff, 0xff, 0x81, 0xed, 0x17, 0x06, 0x00, 0x00, 0x81, 0xc5, 0xff, 0x0a, 0xff, 0xff, 0x82, 0x84, 0x01, 0x00, 0xea, 0x09, 0xff, 0xff, 0x81, 0xff, 0xfd, 0x03, 0xff, 0xff, 0x82, 0xf1, 0xff, 0xe0,
+  0x15, 0x09, 0x00, 0x00, 0x82, 0x00, 0x01, 0x4d, 0xff, 0x06, 0xff, 0xff, 0x81, 0xff, 0xfc, 0x03, 0xff, 0xff, 0x84, 0xff, 0xf7, 0x11, 0x00, 0x00, 0x3d, 0x51, 0xfc, 0x0a, 0xff, 0xff, 0x81, 0xfe,
+  0x2c, 0x06, 0x00, 0x00, 0x81, 0x71, 0xff, 0x09, 0xff, 0xff, 0x83, 0xff, 0xf0, 0xc9, 0x05, 0x12, 0xf6, 0x09, 0xff, 0xff, 0x81, 0xff, 0xfa, 0x03, 0xff, 0xff, 0x82, 0xef, 0xff, 0x69, 0x00, 0x0a,
+  0x00, 0x00, 0x81, 0x07, 0xec, 0x05, 0xff, 0xff, 0x82, 0xff, 0xef, 0xfb, 0xf6, 0x03, 0xff, 0xff, 0x84, 0xc4, 0x49, 0x00, 0x00, 0x00, 0x03, 0x43, 0x80, 0x0a, 0xff, 0xff, 0x81, 0xe3, 0x0e, 0x06,
+  0x00, 0x00, 0x82, 0x04, 0xb1, 0xfe, 0xff, 0x08, 0xff, 0xff, 0x83, 0xfe, 0xf2, 0xd1, 0x00, 0x23, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xd7, 0x0a, 0xff, 0xff, 0x82, 0xd6, 0xd1, 0x03, 0x00, 0x0a,
+  0x00, 0x00, 0x81, 0x00, 0x89, 0x04, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xed, 0xfb, 0x02, 0xff, 0xff, 0x83, 0xff, 0xfc, 0xbf, 0x4a, 0x06, 0x00, 0x02, 0x00, 0x00, 0x82, 0x22, 0x26, 0xe1, 0xff, 0x08,
+  0xff, 0xff, 0x82, 0xff, 0xfe, 0x5e, 0x00, 0x06, 0x00, 0x00, 0x82, 0x00, 0x06, 0x63, 0xf4, 0x08, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x87, 0x00, 0x23, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xd9, 0x0a,
+  0xff, 0xff, 0x81, 0xd2, 0x7d, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x24, 0xfa, 0xff, 0x06, 0xff, 0xff, 0x83, 0xff, 0xf7, 0x90, 0x35, 0x06, 0x00, 0x03, 0x00, 0x00, 0x82, 0x00, 0x36, 0x57, 0xff, 0x08,
+  0xff, 0xff, 0x82, 0xff, 0xf7, 0x23, 0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x2d, 0xd5, 0xff, 0x06, 0xff, 0xff, 0x84, 0xff, 0xf7, 0xf2, 0xf5, 0x15, 0x00, 0x23, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff,
+  0xe6, 0x0a, 0xff, 0xff, 0x81, 0xbd, 0x1f, 0x0c, 0x00, 0x00, 0x81, 0xa3, 0xff, 0x05, 0xff, 0xff, 0x82, 0xff, 0xc3, 0x6d, 0x19, 0x05, 0x00, 0x00, 0x82, 0x00, 0x02, 0x0b, 0xc1, 0x07, 0xff, 0xff,
+  0x83, 0xfe, 0xff, 0xff, 0xde, 0x07, 0x00, 0x07, 0x00, 0x00, 0x83, 0x00, 0x24, 0xbf, 0xb9, 0xee, 0xff, 0x05, 0xff, 0xff, 0x84, 0xff, 0xe0, 0xff, 0xca, 0x00, 0x00, 0x02, 0xec, 0x09, 0xff, 0xff,
+  0x81, 0xff, 0xf4, 0x03, 0xff, 0xff, 0x81, 0xe0, 0x28, 0x0c, 0x00, 0x00, 0x81, 0x19, 0xe1, 0x04, 0xff, 0xff, 0x82, 0xf9, 0xc2, 0x50, 0x03, 0x07, 0x00, 0x00, 0x82, 0x0a, 0x38, 0xfe, 0xff, 0x05,
+  0xff, 0xff, 0x83, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xa5, 0x08, 0x00, 0x00, 0x84, 0x00, 0x01, 0xae, 0xf2, 0xbe, 0xc3, 0xfe, 0xff, 0x04, 0xff, 0xff, 0x84, 0xfd, 0xec, 0xff, 0x76, 0x00, 0x00, 0x00,
+  0xea, 0x0a, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xb8, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x87, 0x00, 0x03, 0x0e, 0x55, 0xb6, 0xce, 0xda, 0xe4, 0xe5, 0xd4, 0xa7, 0x5d, 0x1c,
+  0x00, 0x09, 0x00, 0x00, 0x81, 0xb2, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xe1, 0x2a, 0x09, 0x00, 0x00, 0x83, 0x10, 0xcc, 0xfc, 0xe3, 0xa6, 0xf1, 0x04, 0xff, 0xff, 0x84, 0xd1, 0xfa, 0xfd,
+  0x21, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x0b, 0xff, 0xff, 0x82, 0xa5, 0x0a, 0x05, 0x02, 0x09, 0x00, 0x00, 0x85, 0x0d, 0x8f, 0xce, 0xf8, 0xf9, 0x68, 0x02, 0x04, 0x05,
+  0x02, 0x0b, 0x00, 0x00, 0x81, 0x3b, 0xfd, 0x06, 0xff, 0xff, 0x82, 0xff, 0xb6, 0x18, 0x00, 0x09, 0x00, 0x00, 0x84, 0x00, 0x1f, 0xc3, 0xff, 0xf5, 0x9d, 0xb6, 0xff, 0x03, 0xff, 0xff, 0x84, 0xc2,
+  0xff, 0xc4, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf3, 0x07, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x03, 0xff, 0xff, 0x85, 0xff, 0xde, 0x96, 0xad, 0xad, 0xaf, 0xa7, 0x9b, 0x98,
+  0x93, 0x04, 0x8d, 0x8d, 0x86, 0x8d, 0x91, 0x9a, 0x8e, 0xa4, 0xf0, 0xeb, 0xf6, 0xf1, 0xd6, 0x39, 0x00, 0x0c, 0x00, 0x00, 0x81, 0x00, 0xd0, 0x03, 0xff, 0xff, 0x84, 0xf2, 0xf5, 0xff, 0xff, 0xff,
+  0xf2, 0x62, 0x01, 0x0b, 0x00, 0x00, 0x83, 0x0a, 0x81, 0xf1, 0xbe, 0xd1, 0xff, 0x02, 0xff, 0xff, 0x85, 0xff, 0xed, 0xc2, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x02, 0xff, 0xff, 0x82, 0xff,
+  0xf9, 0xf8, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xf3, 0xfe, 0xff, 0x0f, 0xff, 0xff, 0x83, 0xff, 0xec, 0xa9, 0x4c, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x00, 0x5d, 0x03, 0xff, 0xff, 0x83, 0xfe,
+  0xe8, 0xff, 0xfc, 0xa4, 0x22, 0x0d, 0x00, 0x00, 0x82, 0x13, 0x9f, 0xf9, 0xff, 0x02, 0xff, 0xff, 0x85, 0xff, 0xcc, 0xf4, 0xec, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x59, 0x03, 0xff, 0xff, 0x81, 0xf2,
+  0xff, 0x07, 0xff, 0xff, 0x81, 0xfa, 0xf4, 0x10, 0xff, 0xff, 0x82, 0xff, 0xf4, 0x8b, 0x19, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x0b, 0xf3, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xc9, 0xd3, 0x33, 0x0e,
+  0x00, 0x00, 0x81, 0x00, 0xbc, 0x03, 0xff, 0xff, 0x82, 0xff, 0xb8, 0xff, 0x8c, 0x02, 0x00, 0x00, 0x82, 0x00, 0x15, 0xfd, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xff, 0xe7, 0x11, 0xff, 0xff, 0x82, 0xff,
+  0xea, 0x67, 0x05, 0x0b, 0x00, 0x00, 0x81, 0xb2, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xee, 0x26, 0x00, 0x0e, 0x00, 0x00, 0x81, 0x07, 0xea, 0x03, 0xff, 0xff, 0x82, 0xe9, 0xe3, 0xfc, 0x26, 0x03,
+  0x00, 0x00, 0x81, 0xbe, 0xff, 0x02, 0xff, 0xff, 0x81, 0xf9, 0xff, 0x08, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x11, 0xff, 0xff, 0x82, 0xff, 0xcb, 0x25, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x56, 0xff, 0x03,
+  0xff, 0xff, 0x81, 0x4e, 0x00, 0x0e, 0x00, 0x00, 0x81, 0x2d, 0xf4, 0x03, 0xff, 0xff, 0x82, 0xd9, 0xfd, 0xdc, 0x00, 0x03, 0x00, 0x00, 0x81, 0x7a, 0xff, 0x0c, 0xff, 0xff, 0x81, 0xfb, 0xed, 0x11,
+  0xff, 0xff, 0x81, 0xf5, 0x54, 0x0a, 0x00, 0x00, 0x81, 0x12, 0xf6, 0x03, 0xff, 0xff, 0x81, 0x85, 0x00, 0x0e, 0x00, 0x00, 0x81, 0x68, 0xff, 0x03, 0xff, 0xff, 0x82, 0xde, 0xff, 0x98, 0x00, 0x03,
+  0x00, 0x00, 0x81, 0x2d, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xe7, 0x09, 0xff, 0xff, 0x85, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xe1, 0xf4, 0x07, 0xff, 0xff, 0x81, 0xea, 0xff, 0x05,
+  0xff, 0xff, 0x82, 0xff, 0xfe, 0x75, 0x00, 0x09, 0x00, 0x00, 0x81, 0x00, 0xc3, 0x03, 0xff, 0xff, 0x81, 0xc4, 0x00, 0x0e, 0x00, 0x00, 0x81, 0xa8, 0xff, 0x03, 0xff, 0xff, 0x82, 0xdc, 0xff, 0x50,
+  0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0xcd, 0x02, 0xff, 0xff, 0x81, 0xff, 0xfc, 0x0c, 0xff, 0xff, 0x82, 0xfb, 0xff, 0xf7, 0xfc, 0x07, 0xff, 0xff, 0x83, 0xf9, 0xff, 0xff, 0xf2, 0xfc, 0xfe, 0x04,
+  0xff, 0xff, 0x82, 0xfe, 0xab, 0x04, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x85, 0x03, 0xff, 0xff, 0x81, 0xfb, 0x1e, 0x0e, 0x00, 0x00, 0x81, 0xe4, 0xff, 0x02, 0xff, 0xff, 0x83, 0xff, 0xf0, 0xdf,
+  0xfa, 0x11, 0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0x61, 0x03, 0xff, 0xff, 0x81, 0xf1, 0xff, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xe7, 0xfd, 0xff, 0x07, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xf8, 0xff, 0x04,
+  0xff, 0xff, 0x81, 0xa9, 0x04, 0x08, 0x00, 0x00, 0x81, 0x00, 0x45, 0x03, 0xff, 0xff, 0x81, 0xff, 0x3e, 0x0d, 0x00, 0x00, 0x82, 0x00, 0x0d, 0xd0, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdc, 0xf6,
+  0xbc, 0x04, 0x00, 0x00, 0x82, 0x00, 0x08, 0xe0, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x02, 0xff, 0xff, 0x81, 0xf3, 0xff, 0x07, 0xff, 0xff, 0x82, 0xff,
+  0xf9, 0xf9, 0xff, 0x03, 0xff, 0xff, 0x82, 0xff, 0xa7, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x0a, 0xfd, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0x67, 0x0d, 0x00, 0x00, 0x82, 0x00, 0x08, 0xf2,
+  0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xf6, 0xff, 0x8a, 0x05, 0x00, 0x00, 0x81, 0x6c, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xfa, 0xff, 0x17, 0xff, 0xff, 0x81, 0xff, 0xec, 0x04, 0xff, 0xff,
+  0x81, 0xac, 0x04, 0x07, 0x00, 0x00, 0x82, 0x00, 0x02, 0xe1, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0x7f, 0x08, 0x00, 0x00, 0x87, 0x0b, 0x1c, 0x2b, 0x2b, 0x2b, 0x30, 0x35, 0x2b, 0x2b, 0x20, 0x00,
+  0x31, 0xfd, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xf4, 0xff, 0x4e, 0x05, 0x00, 0x00, 0x81, 0x77, 0xde, 0x03, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xfd, 0xf4, 0xff, 0x08,
+  0xff, 0xff, 0x81, 0xee, 0xfe, 0x03, 0xff, 0xff, 0x81, 0xff, 0x78, 0x08, 0x00, 0x00, 0x81, 0xc0, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xda, 0x54, 0x66, 0x02, 0x66, 0x66, 0x86, 0x3b, 0x2b, 0x2b,
+  0x2b, 0x3e, 0x09, 0x00, 0x00, 0x02, 0x69, 0xe8, 0xfa, 0x03, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xf1, 0xf7, 0x03, 0xff, 0xff, 0x82, 0xff, 0xe8, 0xff, 0x23, 0x05, 0x00, 0x00, 0x81, 0x71, 0xe2, 0x0e,
+  0xff, 0xff, 0x81, 0xff, 0xf7, 0x0e, 0xff, 0xff, 0x81, 0xe3, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x4f, 0x00, 0x07, 0x00, 0x00, 0x81, 0x8d, 0xff, 0x08, 0xff, 0xff, 0x83, 0xfb, 0xa4, 0x1b,
+  0x00, 0x65, 0xf7, 0x09, 0xff, 0xff, 0x82, 0xfa, 0xf1, 0xec, 0x01, 0x05, 0x00, 0x00, 0x82, 0x3d, 0xff, 0xde, 0xff, 0x1c, 0xff, 0xff, 0x81, 0xeb, 0xf5, 0x03, 0xff, 0xff, 0x81, 0xe7, 0x16, 0x07,
+  0x00, 0x00, 0x81, 0x61, 0xff, 0x09, 0xff, 0xff, 0x82, 0xb4, 0x05, 0xb3, 0xff, 0x09, 0xff, 0xff, 0x82, 0xf4, 0xf6, 0xc9, 0x00, 0x05, 0x00, 0x00, 0x82, 0x01, 0xbe, 0xff, 0xfb, 0x03, 0xff, 0xff,
+  0x81, 0xff, 0xf2, 0x09, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x12, 0xff, 0xff, 0x82, 0xff, 0xbe, 0x09, 0x00, 0x06, 0x00, 0x00, 0x81, 0x53, 0xff, 0x09, 0xff, 0xff, 0x82, 0xf8, 0x22, 0x99, 0xff, 0x09,
+  0xff, 0xff, 0x82, 0xed, 0xff, 0xab, 0x00, 0x05, 0x00, 0x00, 0x83, 0x00, 0x29, 0xf7, 0xf6, 0xe4, 0xff, 0x10, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x0b, 0xff, 0xff, 0x81, 0xfb, 0xfb, 0x03, 0xff, 0xff,
+  0x81, 0x59, 0x00, 0x06, 0x00, 0x00, 0x81, 0x1a, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0x39, 0xc5, 0xff, 0x09, 0xff, 0xff, 0x82, 0xd4, 0xff, 0x7a, 0x00, 0x06, 0x00, 0x00, 0x82, 0x88, 0xff, 0xd2,
+  0xfd, 0x04, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x0b, 0xff, 0xff, 0x81, 0xf5, 0xfb, 0x0f, 0xff, 0xff, 0x81, 0xe6, 0x12, 0x06, 0x00, 0x00, 0x81, 0x1e, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0x31, 0xdc,
+  0xff, 0x09, 0xff, 0xff, 0x82, 0xf8, 0xff, 0x60, 0x00, 0x06, 0x00, 0x00, 0x83, 0x06, 0xd4, 0xff, 0xfb, 0xfc, 0xff, 0x03, 0xff, 0xff, 0x82, 0xff, 0xf2, 0xec, 0xff, 0x08, 0xff, 0xff, 0x82, 0xfb,
+  0xf2, 0xf2, 0xf5, 0x0d, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xa2, 0x06, 0x00, 0x00, 0x81, 0x2c, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0x18, 0xc7, 0xff, 0x09, 0xff, 0xff,
+  0x82, 0xff, 0xfe, 0x26, 0x00, 0x06, 0x00, 0x00, 0x83, 0x00, 0x2b, 0xef, 0xff, 0xfd, 0xfe, 0x04, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xf7, 0xf9, 0x19, 0xff, 0xff, 0x82, 0xff, 0xea, 0x13, 0x00, 0x05,
+  0x00, 0x00, 0x81, 0x00, 0xe2, 0x09, 0xff, 0xff, 0x82, 0xff, 0x16, 0xda, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x05, 0x00, 0x07, 0x00, 0x00, 0x82, 0x3c, 0xf0, 0xff, 0xfa, 0x06, 0xff, 0xff,
+  0x87, 0xff, 0xf2, 0xff, 0xef, 0xe5, 0xff, 0xff, 0xf1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x02, 0xff, 0xff, 0x82, 0xff, 0xf0, 0xf4, 0xfe, 0x0b, 0xff, 0xff, 0x81, 0xff, 0xe6, 0x03, 0xff, 0xff,
+  0x81, 0x6a, 0x00, 0x05, 0x00, 0x00, 0x81, 0x00, 0xe0, 0x09, 0xff, 0xff, 0x82, 0xff, 0x16, 0xd8, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0xfb, 0x05, 0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x37, 0xf0,
+  0xff, 0x12, 0xff, 0xff, 0x81, 0xff, 0xee, 0x09, 0xff, 0xff, 0x82, 0xff, 0xf4, 0xfb, 0xff, 0x02, 0xff, 0xff, 0x81, 0xcc, 0x05, 0x05, 0x00, 0x00, 0x81, 0x00, 0xe0, 0x09, 0xff, 0xff, 0x82, 0xff,
+  0x16, 0xcb, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0xeb, 0x03, 0x00, 0x08, 0x00, 0x00, 0x83, 0x38, 0xe7, 0xff, 0xff, 0xff, 0xfc, 0x10, 0xff, 0xff, 0x82, 0xff, 0xf6, 0xf2, 0xff, 0x09, 0xff, 0xff,
+  0x81, 0xf2, 0xff, 0x02, 0xff, 0xff, 0x81, 0xf7, 0x27, 0x05, 0x00, 0x00, 0x81, 0x10, 0xe6, 0x09, 0xff, 0xff, 0x82, 0xff, 0x16, 0xc9, 0xff, 0x09, 0xff, 0xff, 0x82, 0xf2, 0xd9, 0x02, 0x00, 0x08,
+  0x00, 0x00, 0x83, 0x00, 0x18, 0xbb, 0xff, 0xff, 0xfe, 0x12, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x0b, 0xff, 0xff, 0x81, 0xff, 0x64, 0x05, 0x00, 0x00, 0x81, 0x47, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff,
+  0x16, 0xc5, 0xff, 0x09, 0xff, 0xff, 0x82, 0xed, 0xd9, 0x02, 0x00, 0x09, 0x00, 0x00, 0x84, 0x06, 0x90, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x0b, 0xff, 0xff,
+  0x81, 0xff, 0xae, 0x05, 0x00, 0x00, 0x81, 0x54, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0x16, 0xad, 0xff, 0x09, 0xff, 0xff, 0x82, 0xfc, 0xde, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x84, 0x4a, 0xe3, 0xff,
+  0xff, 0xff, 0xf8, 0xf7, 0xfd, 0x10, 0xff, 0xff, 0x81, 0xf1, 0xff, 0x07, 0xff, 0xff, 0x81, 0xff, 0xf9, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdd, 0x02, 0x00, 0x04, 0x00, 0x00, 0x81, 0x3e, 0xff, 0x09,
+  0xff, 0xff, 0x82, 0xff, 0x16, 0xae, 0xff, 0x09, 0xff, 0xff, 0x82, 0xfb, 0xe6, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x82, 0x00, 0x1c, 0xb2, 0xfd, 0x02, 0xff, 0xff, 0x85, 0xff, 0xf3, 0xf7, 0xeb, 0xf3,
+  0xfa, 0xff, 0xfd, 0xfa, 0xf4, 0x05, 0xf1, 0xf1, 0x82, 0xf5, 0xfd, 0xf8, 0xfb, 0x0f, 0xff, 0xff, 0x82, 0xff, 0xfd, 0x21, 0x00, 0x04, 0x00, 0x00, 0x81, 0x69, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff,
+  0x16, 0x96, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0xbe, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x34, 0x92, 0xda, 0x04, 0xff, 0xff, 0x82, 0xff, 0xfa, 0xec, 0xdd, 0x02, 0xd3, 0xd2, 0x86, 0xcc,
+  0xca, 0xbd, 0xc9, 0xd3, 0xd3, 0xe1, 0xf8, 0xe9, 0xf2, 0xe4, 0xf1, 0x03, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xf7, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xf8, 0xf9, 0xff, 0x02, 0xff, 0xff, 0x81, 0x54,
+  0x00, 0x04, 0x00, 0x00, 0x81, 0x79, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0x16, 0x6f, 0xff, 0x09, 0xff, 0xff, 0x82, 0xff, 0xba, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x90, 0x02, 0x05, 0x5b, 0x93, 0xd5,
+  0xf9, 0xfb, 0xff, 0xfe, 0xfe, 0xf7, 0xf4, 0xed, 0xf3, 0xfd, 0xf3, 0xf5, 0xf7, 0xef, 0xef, 0xe9, 0xec, 0xe8, 0xec, 0xf2, 0xf4, 0xf6, 0xf6, 0xe4, 0xc8, 0xcd, 0xff, 0x03, 0xff, 0xff, 0x81, 0xfb,
+  0xff, 0x07, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x02, 0xff, 0xff, 0x81, 0x7b, 0x00, 0x04, 0x00, 0x00, 0x81, 0xb6, 0xff, 0x09, 0xff, 0xff, 0x82, 0xf8, 0x1d, 0x0a, 0xd5, 0x09, 0xff, 0xff, 0x82, 0xff,
+  0xb6, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x8e, 0x0c, 0x38, 0x70, 0xa7, 0x99, 0xd9, 0xc3, 0xc8, 0xcb, 0xd0, 0xb9, 0xc1, 0xd5, 0xd8, 0xc5, 0xb2, 0xa4, 0xa1, 0x9f, 0x9b, 0x90, 0x94, 0x97, 0x97, 0x99,
+  0xb9, 0xeb, 0xf9, 0x0b, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x81, 0x80, 0x00, 0x03, 0x00, 0x00, 0x82, 0x00, 0x04, 0xe7, 0xff, 0x09, 0xff, 0xff, 0x83, 0xcc, 0x4b, 0x00, 0x19, 0xcd,
+  0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xf6, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xb8, 0x1b, 0x00, 0x10, 0x00, 0x00, 0x8d, 0x0c, 0x25, 0x3a, 0x79, 0x74, 0x6f, 0x70, 0x63, 0x63, 0x5d, 0x47,
+  0x36, 0x14, 0x0e, 0x0d, 0x11, 0x08, 0x1a, 0x4d, 0x8e, 0xa0, 0xd7, 0xfa, 0xf8, 0xf1, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xf4, 0xff, 0x02, 0xff, 0xff, 0x81, 0xb0, 0x03, 0x03, 0x00, 0x00, 0x82, 0x00,
+  0x31, 0xeb, 0xff, 0x08, 0xff, 0xff, 0x84, 0xea, 0xc8, 0xb9, 0xa2, 0x00, 0x00, 0x7d, 0xff, 0x04, 0xff, 0xff, 0x82, 0xf1, 0xa4, 0xed, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xec, 0x03, 0x00, 0x19,
+  0x00, 0x00, 0x84, 0x01, 0x09, 0x0e, 0x50, 0xa2, 0xe9, 0xcc, 0xfe, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf8, 0x07, 0xff, 0xff, 0x81, 0xf8, 0xff, 0x02, 0xff, 0xff, 0x81, 0xaf, 0x26, 0x03, 0x00, 0x00,
+  0x82, 0x00, 0x53, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdd, 0xef, 0xf9, 0x02, 0xff, 0xff, 0x86, 0xfe, 0xfb, 0xfb, 0xf4, 0xfa, 0xfa, 0xdc, 0x68, 0x00, 0x00, 0x0f, 0xcc, 0x03, 0xff, 0xff,
+  0x83, 0xff, 0xf7, 0xc7, 0x89, 0xb9, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x29, 0x00, 0x0e, 0x00, 0x00, 0x82, 0x05, 0x1b, 0x17, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x26, 0x20, 0xb8, 0x02,
+  0xff, 0xff, 0x81, 0xff, 0xfd, 0x0a, 0xff, 0xff, 0x82, 0xaf, 0x57, 0x15, 0x00, 0x02, 0x00, 0x00, 0x81, 0x00, 0x95, 0x03, 0xff, 0xff, 0x81, 0xff, 0xd1, 0x05, 0xff, 0xff, 0x85, 0xff, 0xf1, 0xb0,
+  0x2b, 0x00, 0x00, 0x00, 0x22, 0xc9, 0xfb, 0x02, 0xff, 0xff, 0x83, 0xfe, 0xe8, 0xbd, 0xb1, 0x87, 0xff, 0x03, 0xff, 0xff, 0x81, 0x73, 0x00, 0x0b, 0x00, 0x00, 0x85, 0x01, 0x03, 0x28, 0x66, 0xa6,
+  0xb1, 0xee, 0xfc, 0xed, 0x39, 0x0c, 0x00, 0x00, 0x81, 0x00, 0x63, 0x02, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x0a, 0xff, 0xff, 0x82, 0xb2, 0xa5, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x81, 0x00, 0xdc, 0x03,
+  0xff, 0xff, 0x81, 0xff, 0xd9, 0x04, 0xff, 0xff, 0x83, 0xff, 0xfe, 0xf9, 0xbe, 0x26, 0x00, 0x02, 0x00, 0x00, 0x82, 0x02, 0x04, 0x34, 0x3a, 0x02, 0x3a, 0x3a, 0x82, 0x39, 0x30, 0x41, 0xff, 0x03,
+  0xff, 0xff, 0x81, 0xc1, 0x06, 0x09, 0x00, 0x00, 0x84, 0x01, 0x1a, 0x4f, 0x84, 0xca, 0xee, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xd7, 0x08, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x00, 0x7d, 0x02,
+  0xff, 0xff, 0x82, 0xff, 0xd1, 0xf5, 0xff, 0x09, 0xff, 0xff, 0x82, 0xb8, 0xbc, 0x36, 0x00, 0x02, 0x00, 0x00, 0x81, 0x25, 0xf1, 0x03, 0xff, 0xff, 0x87, 0xfe, 0xc8, 0xfe, 0x8e, 0x4e, 0x74, 0x74,
+  0x74, 0x74, 0x69, 0x3c, 0x30, 0x07, 0x01, 0x08, 0x00, 0x00, 0x81, 0x06, 0xf5, 0x03, 0xff, 0xff, 0x81, 0xfa, 0x2c, 0x08, 0x00, 0x00, 0x83, 0x1c, 0x69, 0xc0, 0xf1, 0xf7, 0xff, 0x05, 0xff, 0xff,
+  0x81, 0x48, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x00, 0x7f, 0x02, 0xff, 0xff, 0x82, 0xff, 0xd8, 0xf7, 0xff, 0x06, 0xff, 0xff, 0x81, 0xe5, 0xff, 0x02, 0xff, 0xff, 0x82, 0xbe, 0x9a, 0x38, 0x00, 0x02,
+  0x00, 0x00, 0x81, 0x59, 0xfc, 0x03, 0xff, 0xff, 0x82, 0xf0, 0xe2, 0xff, 0x25, 0x0d, 0x00, 0x00, 0x81, 0x00, 0xb0, 0x03, 0xff, 0xff, 0x81, 0xff, 0x5e, 0x06, 0x00, 0x00, 0x83, 0x00, 0x06, 0x30,
+  0xa2, 0xf0, 0xff, 0x07, 0xff, 0xff, 0x81, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x00, 0x9a, 0x0d, 0xff, 0xff, 0x82, 0xbe, 0x8d, 0x52, 0x00, 0x02, 0x00, 0x00, 0x81, 0xac, 0xff, 0x03, 0xff, 0xff,
+  0x82, 0xda, 0xfd, 0xd5, 0x04, 0x0d, 0x00, 0x00, 0x81, 0x00, 0x63, 0x03, 0xff, 0xff, 0x82, 0xff, 0xcf, 0x03, 0x00, 0x03, 0x00, 0x00, 0x83, 0x0a, 0x34, 0x3e, 0x71, 0xb8, 0xea, 0x09, 0xff, 0xff,
+  0x81, 0xe9, 0x13, 0x0b, 0x00, 0x00, 0x81, 0x00, 0xb3, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x07, 0xff, 0xff, 0x81, 0xf1, 0xff, 0x02, 0xff, 0xff, 0x85, 0xce, 0xc1, 0x8d, 0x01, 0x00, 0x00, 0x00,
+  0x1d, 0xe3, 0xff, 0x03, 0xff, 0xff, 0x82, 0xd7, 0xfe, 0x81, 0x00, 0x0d, 0x00, 0x00, 0x82, 0x00, 0x14, 0xf6, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xf3, 0x31, 0x00, 0x02, 0x00, 0x00, 0x82, 0x00,
+  0x42, 0xaa, 0xed, 0x0b, 0xff, 0xff, 0x81, 0xfe, 0x60, 0x0b, 0x00, 0x00, 0x81, 0x09, 0xd9, 0x0d, 0xff, 0xff, 0x84, 0xa6, 0xd8, 0xa3, 0x0d, 0x00, 0x00, 0x00, 0x69, 0x03, 0xff, 0xff, 0x83, 0xff,
+  0xf4, 0xd0, 0xf2, 0x25, 0x00, 0x0e, 0x00, 0x00, 0x81, 0xa1, 0xff, 0x03, 0xff, 0xff, 0x81, 0xa6, 0x00, 0x02, 0x00, 0x00, 0x81, 0x00, 0xae, 0x07, 0xff, 0xff, 0x83, 0xfa, 0xff, 0xff, 0xff, 0xf2,
+  0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xe6, 0x1e, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x3f, 0xfe, 0x09, 0xff, 0xff, 0x82, 0xff, 0xf9, 0xfa, 0xff, 0x02, 0xff, 0xff, 0x84, 0x89, 0xbc, 0xc7, 0x13, 0x00,
+  0x00, 0x0f, 0xd6, 0x03, 0xff, 0xff, 0x82, 0xff, 0xa4, 0xa8, 0xc0, 0x0f, 0x00, 0x00, 0x81, 0x42, 0xfe, 0x03, 0xff, 0xff, 0x81, 0xf0, 0x28, 0x02, 0x00, 0x00, 0x81, 0x00, 0x91, 0x06, 0xff, 0xff,
+  0x84, 0xff, 0xf2, 0xf7, 0xff, 0xff, 0xff, 0xe8, 0xfc, 0x03, 0xff, 0xff, 0x81, 0x9f, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x83, 0xff, 0x0c, 0xff, 0xff, 0x85, 0xff, 0xfc, 0x70, 0xe9, 0x7c, 0x07, 0x00,
+  0x00, 0x4b, 0xfd, 0x03, 0xff, 0xff, 0x82, 0xfd, 0x8f, 0x66, 0x25, 0x0e, 0x00, 0x00, 0x82, 0x00, 0x3d, 0xaf, 0xff, 0x03, 0xff, 0xff, 0x81, 0xff, 0x70, 0x02, 0x00, 0x00, 0x82, 0x00, 0x55, 0xfe,
+  0xff, 0x03, 0xff, 0xff, 0x82, 0xfd, 0xfe, 0xf9, 0xff, 0x03, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x03, 0xff, 0xff, 0x81, 0xfe, 0x65, 0x09, 0x00, 0x00, 0x82, 0x00, 0x16, 0xe2, 0xff, 0x02, 0xff, 0xff,
+  0x81, 0xf0, 0xff, 0x06, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x02, 0xff, 0xff, 0x85, 0xff, 0xd6, 0x52, 0xbf, 0x6a, 0x00, 0x00, 0x05, 0xd1, 0xff, 0x03, 0xff, 0xff, 0x82, 0xfd, 0xaa, 0x56, 0x13, 0x0d,
+  0x00, 0x00, 0x82, 0x00, 0x05, 0x72, 0xf4, 0x04, 0xff, 0xff, 0x85, 0xff, 0xd8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x15, 0xec, 0xff, 0x02, 0xff, 0xff, 0x82, 0xf2, 0xf2, 0xf4, 0xff, 0x08, 0xff, 0xff,
+  0x82, 0xff, 0xfb, 0x56, 0x00, 0x08, 0x00, 0x00, 0x81, 0x0f, 0xc9, 0x03, 0xff, 0xff, 0x81, 0xf1, 0xff, 0x06, 0xff, 0xff, 0x81, 0xff, 0xf1, 0x02, 0xff, 0xff, 0x84, 0xff, 0x9a, 0x1e, 0x5b, 0x20,
+  0x00, 0x00, 0x5a, 0x05, 0xff, 0xff, 0x82, 0xe9, 0x65, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x01, 0x42, 0xc4, 0x06, 0xff, 0xff, 0x81, 0x94, 0x00, 0x02, 0x00, 0x00, 0x81, 0xa8, 0xff, 0x02,
+  0xff, 0xff, 0x81, 0xf2, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xfa, 0x4b, 0x07, 0x00, 0x00, 0x82, 0x00, 0x12, 0xbb, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x07, 0xff, 0xff, 0x81, 0xfe, 0xfb, 0x02,
+  0xff, 0xff, 0x84, 0xff, 0x60, 0x02, 0x27, 0x16, 0x00, 0x05, 0xbe, 0x06, 0xff, 0xff, 0x81, 0xbe, 0x25, 0x0b, 0x00, 0x00, 0x82, 0x34, 0xaa, 0xfd, 0xff, 0x06, 0xff, 0xff, 0x81, 0xf3, 0x24, 0x02,
+  0x00, 0x00, 0x81, 0x52, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0xfb, 0x06, 0xff, 0xff, 0x81, 0xff, 0xfa, 0x03, 0xff, 0xff, 0x82, 0xff, 0xfa, 0x97, 0x19, 0x05, 0x00, 0x00, 0x82, 0x00, 0x03, 0x54,
+  0xe6, 0x0b, 0xff, 0xff, 0x81, 0xf3, 0xff, 0x02, 0xff, 0xff, 0x84, 0xf6, 0x2b, 0x0c, 0x63, 0x37, 0x07, 0x67, 0xfe, 0x06, 0xff, 0xff, 0x82, 0xff, 0xee, 0x72, 0x01, 0x09, 0x00, 0x00, 0x82, 0x09,
+  0x7f, 0xf1, 0xff, 0x07, 0xff, 0xff, 0x81, 0xff, 0x94, 0x02, 0x00, 0x00, 0x81, 0x12, 0xe2, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x06, 0xff, 0xff, 0x81, 0xff, 0xf6, 0x04, 0xff, 0xff, 0x83, 0xff,
+  0xf6, 0xa4, 0x3d, 0x01, 0x00, 0x02, 0x00, 0x00, 0x82, 0x00, 0x0a, 0x51, 0xce, 0x0c, 0xff, 0xff, 0x81, 0xe6, 0xff, 0x02, 0xff, 0xff, 0x84, 0xcf, 0x64, 0x2c, 0x8d, 0x4c, 0x1b, 0xc8, 0xff, 0x07,
+  0xff, 0xff, 0x82, 0xff, 0xbe, 0x2c, 0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x2b, 0xc2, 0xff, 0x08, 0xff, 0xff, 0x84, 0xff, 0xf5, 0x42, 0x00, 0x00, 0x00, 0x00, 0x88, 0x02, 0xff, 0xff, 0x81, 0xff,
+  0xf2, 0x07, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x05, 0xff, 0xff, 0x84, 0xf0, 0xbe, 0xb4, 0x83, 0x7b, 0x7e, 0xba, 0xf0, 0x04, 0xff, 0xff, 0x81, 0xff, 0xf7, 0x0b, 0xff, 0xff, 0x84, 0x8f, 0x83, 0x6f,
+  0xa3, 0x48, 0x8c, 0xfb, 0xff, 0x08, 0xff, 0xff, 0x82, 0xfb, 0x82, 0x05, 0x00, 0x06, 0x00, 0x00, 0x81, 0x15, 0xdc, 0x0a, 0xff, 0xff, 0x87, 0xc1, 0x11, 0x00, 0x00, 0x00, 0x1d, 0xf3, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfb, 0xff, 0x07, 0xff, 0xff, 0x81, 0xec, 0xff, 0x17, 0xff, 0xff, 0x84, 0xff, 0xf6, 0xaf, 0x75, 0xab, 0x74, 0x67, 0xed, 0x0a, 0xff, 0xff, 0x81, 0x88, 0x02, 0x06, 0x00, 0x00,
+  0x81, 0x74, 0xfe, 0x0a, 0xff, 0xff, 0x81, 0xff, 0x89, 0x02, 0x00, 0x00, 0x81, 0xa3, 0xff, 0x02, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x07, 0xff, 0xff, 0x81, 0xfa, 0xff, 0x0b, 0xff, 0xff, 0x81, 0xff,
+  0xee, 0x08, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x02, 0xff, 0xff, 0x84, 0xff, 0xbd, 0xe7, 0x50, 0xcd, 0xa0, 0xb6, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xf6, 0x21, 0x06, 0x00, 0x00, 0x81, 0x9e, 0xff, 0x0a,
+  0xff, 0xff, 0x84, 0xff, 0xed, 0x40, 0x00, 0x00, 0x00, 0x2c, 0xfd, 0x02, 0xff, 0xff, 0x81, 0xff, 0xf1, 0x08, 0xff, 0xff, 0x81, 0xf3, 0xfb, 0x09, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xff, 0xfe, 0x07,
+  0xff, 0xff, 0x81, 0xff, 0xfe, 0x03, 0xff, 0xff, 0x84, 0xf5, 0xc6, 0xf4, 0xb0, 0xf8, 0xe1, 0xfd, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xff, 0x2e, 0x06, 0x00, 0x00, 0x81, 0x4a, 0xfe, 0x0b, 0xff, 0xff,
+  0x83, 0xc9, 0x19, 0x00, 0x00, 0x00, 0xa8, 0x02, 0xff, 0xff, 0x82, 0xff, 0xfc, 0xfb, 0xff, 0x07, 0xff, 0xff, 0x82, 0xff, 0xf7, 0xf4, 0xfd, 0x08, 0xff, 0xff, 0x81, 0xff, 0xf8, 0x08, 0xff, 0xff,
+  0x81, 0xff, 0xf2, 0x03, 0xff, 0xff, 0x83, 0xd2, 0xfc, 0xf6, 0xdc, 0xf4, 0xf7, 0x0b, 0xff, 0xff, 0x81, 0xed, 0x00, 0x06, 0x00, 0x00, 0x81, 0x00, 0xbd, 0x0b, 0xff, 0xff, 0x84, 0xff, 0x97, 0x01,
+  0x00, 0x00, 0x2d, 0xfb, 0xff, 0x02, 0xff, 0xff, 0x81, 0xfd, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xf5, 0xff, 0x02, 0xff, 0xff, 0x83, 0xed, 0xee, 0xf6, 0xef, 0xf2, 0xf2, 0x0a, 0xff, 0xff, 0x81, 0xfc,
+  0xfc, 0x02, 0xff, 0xff, 0x84, 0xff, 0xfd, 0xf4, 0xff, 0xd0, 0xf8, 0xee, 0xff, 0x0b, 0xff, 0xff, 0x81, 0x8d, 0x00, 0x06, 0x00, 0x00, 0x82, 0x00, 0x22, 0xf1, 0xff, 0x0b, 0xff, 0xff, 0x83, 0x6c,
+  0x00, 0x00, 0x00, 0xaf, 0xff, 0x02, 0xff, 0xff, 0x81, 0xfd, 0xfd, 0x0d, 0xff, 0xff, 0x02, 0xff, 0xfe, 0x0b, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x02, 0xff, 0xff, 0x83, 0xff, 0xfa, 0xff, 0xf3, 0xb8,
+  0xff, 0x0c, 0xff, 0xff, 0x81, 0xb2, 0x0b, 0x07, 0x00, 0x00, 0x81, 0x6f, 0xff, 0x0b, 0xff, 0xff, 0x83, 0xf0, 0x39, 0x00, 0x00, 0x30, 0xe8, 0x0f, 0xff, 0xff, 0x83, 0xff, 0xf9, 0xec, 0xef, 0xf7,
+  0xff, 0x0a, 0xff, 0xff, 0x81, 0xff, 0xf2, 0x03, 0xff, 0xff, 0x83, 0xf3, 0xfe, 0xff, 0x7d, 0xc2, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xfa, 0xe4, 0xf9, 0x27, 0x07, 0x00, 0x00, 0x81, 0x01, 0xbf, 0x0b,
+  0xff, 0xff, 0x84, 0xff, 0xf0, 0x46, 0x00, 0x00, 0x5c, 0xfe, 0xff, 0x02, 0xff, 0xff, 0x81, 0xfb, 0xfd, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xfe, 0xff, 0x0d, 0xff, 0xff, 0x84, 0xff, 0xf7, 0xfd,
+  0xff, 0xbd, 0xc5, 0xfd, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xed, 0xfe, 0xf9, 0x1a, 0x07, 0x00, 0x00, 0x82, 0x00, 0x25, 0xf7, 0xff, 0x0b, 0xff, 0xff, 0x83, 0xfd, 0x66, 0x00, 0x03, 0xbc, 0xff, 0x02,
+  0xff, 0xff, 0x81, 0xfc, 0xf8, 0x0a, 0xff, 0xff, 0x81, 0xf2, 0xff, 0x10, 0xff, 0xff, 0x83, 0xf7, 0xe3, 0xff, 0xe4, 0x8c, 0xfd, 0x0b, 0xff, 0xff, 0x83, 0xff, 0xef, 0xf6, 0xff, 0xc4, 0x00, 0x08,
+  0x00, 0x00, 0x81, 0x6b, 0xff, 0x0b, 0xff, 0xff, 0x83, 0xff, 0xfd, 0x67, 0x01, 0x2a, 0xe8, 0x10, 0xff, 0xff, 0x82, 0xff, 0xfd, 0xf4, 0xff, 0x0c, 0xff, 0xff, 0x83, 0xe3, 0xff, 0xef, 0xd0, 0xfc,
+  0xff, 0x0b, 0xff, 0xff, 0x83, 0xff, 0xfc, 0xff, 0xff, 0x61, 0x00, 0x08, 0x00, 0x00, 0x81, 0x06, 0xc3, 0x06, 0xff, 0xff, 0x81, 0xfe, 0xfd, 0x05, 0xff, 0xff, 0x83, 0xfe, 0x98, 0x02, 0x5c, 0xfc,
+  0xff, 0x10, 0xff, 0xff, 0x81, 0xe2, 0xff, 0x07, 0xff, 0xff, 0x81, 0xfa, 0xff, 0x03, 0xff, 0xff, 0x83, 0xff, 0xe5, 0xf3, 0xff, 0xfe, 0xff, 0x03, 0xff, 0xff, 0x83, 0xff, 0xfd, 0xfe, 0xff, 0xf7,
+  0xfd, 0x06, 0xff, 0xff, 0x83, 0xe0, 0xff, 0xff, 0xe9, 0x14, 0x00, 0x08, 0x00, 0x00, 0x82, 0x00, 0x1e, 0xf0, 0xff, 0x04, 0xff, 0xff, 0x82, 0xf9, 0xe1, 0xf3, 0xff, 0x06, 0xff, 0xff, 0x82, 0xb6,
+  0x69, 0xbb, 0xff, 0x03, 0xff, 0xff, 0x81, 0xfe, 0xf9, 0x0c, 0xff, 0xff, 0x81, 0xf7, 0xff, 0x07, 0xff, 0xff, 0x81, 0xf8, 0xff, 0x03, 0xff, 0xff, 0x81, 0xfa, 0xf1, 0x05, 0xff, 0xff, 0x81, 0xfd,
+  0xf4, 0x02, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x04, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xd4, 0xfc, 0xf4, 0x6e, 0x0a, 0x00, 0x00, 0x81, 0x67, 0xff, 0x03, 0xff, 0xff, 0x85, 0xff, 0xfe, 0xfd, 0xff, 0xff,
+  0xff, 0xdd, 0xf6, 0xff, 0xfe, 0x04, 0xff, 0xff, 0x82, 0xff, 0xf9, 0xb3, 0xfb, 0x03, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xe7, 0xfd, 0xff, 0x02, 0xff, 0xff,
+  0x81, 0xff, 0xfe, 0x07, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x0a, 0xff, 0xff, 0x85, 0xfe, 0xff, 0xff, 0xf8, 0xf1, 0xff, 0xf3, 0xf0, 0xfd, 0xff, 0x03, 0xff, 0xff, 0x83, 0xff, 0xc7, 0xec, 0xed, 0xc5,
+  0x0f, 0x0a, 0x00, 0x00, 0x81, 0x03, 0xc1, 0x05, 0xff, 0xff, 0x83, 0xfe, 0x76, 0x05, 0x46, 0xd2, 0xff, 0x0a, 0xff, 0xff, 0x82, 0xfa, 0xff, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x81, 0xe4, 0xff, 0x09,
+  0xff, 0xff, 0x81, 0xf7, 0xf7, 0x0a, 0xff, 0xff, 0x86, 0xfd, 0xfc, 0xff, 0xff, 0xf0, 0x53, 0x37, 0xee, 0xff, 0xff, 0xff, 0xf9, 0x03, 0xff, 0xff, 0x83, 0xef, 0xf8, 0xf2, 0xd2, 0x58, 0x00, 0x0a,
+  0x00, 0x00, 0x82, 0x00, 0x28, 0xe9, 0xff, 0x03, 0xff, 0xff, 0x85, 0xff, 0xd5, 0x52, 0x00, 0x00, 0x00, 0x32, 0xec, 0xff, 0xfd, 0x0a, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x84, 0xff,
+  0xf6, 0xee, 0xf3, 0xf4, 0xfb, 0xfc, 0xff, 0x05, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xfa, 0xff, 0x0a, 0xff, 0xff, 0x8c, 0xfb, 0xff, 0xfd, 0xc4, 0x6e, 0x01, 0x00, 0x0f, 0xab, 0xfe, 0xff, 0xfd, 0xde,
+  0xed, 0xff, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xab, 0x0e, 0x00, 0x0b, 0x00, 0x00, 0x85, 0x20, 0x95, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7b, 0x04, 0x02, 0x00, 0x00, 0x83, 0x00, 0x2a, 0xcc,
+  0xff, 0xf7, 0xfc, 0x09, 0xff, 0xff, 0x82, 0xff, 0xf8, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xfe, 0xff, 0x05, 0xff, 0xff, 0x82, 0xff, 0xfd, 0xf7, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xff,
+  0xfe, 0xd3, 0x35, 0x02, 0x00, 0x00, 0x87, 0x01, 0x3a, 0xce, 0xff, 0xff, 0xe9, 0xe5, 0xc6, 0xd4, 0xff, 0xff, 0xfb, 0xc8, 0x10, 0x0c, 0x00, 0x00, 0x84, 0x00, 0x0c, 0x96, 0xfd, 0xff, 0xfe, 0xa9,
+  0x22, 0x04, 0x00, 0x00, 0x83, 0x07, 0x8f, 0xff, 0xf2, 0xe3, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xfe, 0xf0, 0x0b, 0xff, 0xff, 0x81, 0xff, 0xf1, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xe0, 0x27, 0x00, 0x03,
+  0x00, 0x00, 0x86, 0x03, 0x54, 0xbc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe8, 0x29, 0x00, 0x0d, 0x00, 0x00, 0x82, 0x00, 0x39, 0x77, 0x27, 0x06, 0x00, 0x00, 0x82, 0x43, 0x82, 0x91, 0xff, 0x0a,
+  0xff, 0xff, 0x02, 0xff, 0xfc, 0x82, 0xff, 0xff, 0xfe, 0xff, 0x06, 0xff, 0xff, 0x83, 0xff, 0xfe, 0xff, 0xf6, 0xf1, 0xff, 0x0b, 0xff, 0xff, 0x83, 0xf2, 0xf4, 0xff, 0xff, 0xc9, 0x24, 0x05, 0x00,
+  0x00, 0x84, 0x01, 0x2f, 0x65, 0x6e, 0x98, 0xda, 0xb3, 0x21, 0x16, 0x00, 0x00, 0x82, 0x00, 0x2b, 0xf2, 0xff, 0x0c, 0xff, 0xff, 0x84, 0xff, 0xfd, 0xf9, 0xf2, 0xfe, 0xff, 0xfc, 0xe8, 0x02, 0xff,
+  0xff, 0x83, 0xff, 0xef, 0xff, 0xff, 0xfd, 0xfc, 0x0d, 0xff, 0xff, 0x83, 0xff, 0xfd, 0xde, 0x6e, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x81, 0x10, 0xc8, 0x24, 0xff, 0xff, 0x81, 0x87, 0x00, 0x20, 0x00,
+  0x00, 0x81, 0x84, 0xff, 0x24, 0xff, 0xff, 0x81, 0xef, 0x39, 0x1f, 0x00, 0x00, 0x82, 0x00, 0x44, 0xfe, 0xff, 0x24, 0xff, 0xff, 0x82, 0xff, 0xc7, 0x0a, 0x00, 0x1e, 0x00, 0x00, 0x81, 0x19, 0xe0,
+  0x26, 0xff, 0xff, 0x81, 0x7b, 0x00, 0x1e, 0x00, 0x00, 0x81, 0x90, 0xff, 0x26, 0xff, 0xff, 0x81, 0xf0, 0x28, 0x1d, 0x00, 0x00, 0x82, 0x00, 0x4c, 0xfa, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xca,
+  0x04, 0x00, 0x1c, 0x00, 0x00, 0x81, 0x0b, 0xe0, 0x0a, 0xff, 0xff, 0x81, 0xfa, 0xff, 0x12, 0xff, 0xff, 0x81, 0xf5, 0xff, 0x0a, 0xff, 0xff, 0x81, 0x8d, 0x00, 0x1c, 0x00, 0x00, 0x81, 0x6c, 0xff,
+  0x09, 0xff, 0xff, 0x83, 0xff, 0xfe, 0xf2, 0xf3, 0xe7, 0xff, 0x10, 0xff, 0xff, 0x82, 0xf9, 0xff, 0xe4, 0xf0, 0x0a, 0xff, 0xff, 0x81, 0xf4, 0x29, 0x1c, 0x00, 0x00, 0x81, 0x6a, 0xff, 0x09, 0xff,
+  0xff, 0x86, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xdb, 0xe2, 0xcc, 0xd4, 0xf8, 0xfd, 0xff, 0x0a, 0xff, 0xff, 0x86, 0xff, 0xfd, 0xf7, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xcf, 0xfe, 0xff, 0x09, 0xff,
+  0xff, 0x81, 0xff, 0x2f, 0x1c, 0x00, 0x00, 0x81, 0x43, 0xfe, 0x09, 0xff, 0xff, 0x87, 0xe7, 0xa6, 0xf6, 0xfa, 0xfb, 0xff, 0xff, 0xff, 0xf4, 0xcc, 0xc3, 0xc9, 0xd2, 0xfa, 0x08, 0xff, 0xff, 0x87,
+  0xdb, 0xf8, 0xf1, 0xf0, 0xf9, 0xff, 0xfe, 0xf1, 0xec, 0xe1, 0xe9, 0xc3, 0x87, 0xff, 0x09, 0xff, 0xff, 0x81, 0xf3, 0x14, 0x1c, 0x00, 0x00, 0x81, 0x00, 0xa9, 0x08, 0xff, 0xff, 0x85, 0xff, 0xf9,
+  0x4e, 0x25, 0x38, 0x89, 0x70, 0x9c, 0xed, 0xff, 0x02, 0xff, 0xff, 0x81, 0xc5, 0xf5, 0x08, 0xff, 0xff, 0x87, 0xc5, 0xff, 0xff, 0xff, 0xfc, 0xdf, 0xc2, 0x67, 0x3d, 0x11, 0x4d, 0x10, 0x00, 0xa1,
+  0x09, 0xff, 0xff, 0x81, 0xdd, 0x14, 0x1c, 0x00, 0x00, 0x82, 0x00, 0x06, 0xc4, 0xff, 0x07, 0xff, 0xff, 0x88, 0xff, 0x76, 0x00, 0x07, 0x65, 0x55, 0x72, 0x3e, 0x25, 0x55, 0x87, 0xb9, 0xdf, 0xe6,
+  0xc0, 0xf5, 0x08, 0xff, 0xff, 0x84, 0xc1, 0xe5, 0xc8, 0xab, 0x56, 0x26, 0x0b, 0x01, 0x02, 0x00, 0x00, 0x82, 0x00, 0x0b, 0xdb, 0xff, 0x08, 0xff, 0xff, 0x81, 0xee, 0x2a, 0x1c, 0x00, 0x00, 0x82,
+  0x00, 0x3a, 0xad, 0xe0, 0x07, 0xff, 0xff, 0x82, 0xcb, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x83, 0x00, 0x02, 0x17, 0x17, 0x22, 0xf9, 0x08, 0xff, 0xff, 0x82, 0x9d, 0x27, 0x0e, 0x00, 0x05, 0x00,
+  0x00, 0x81, 0x4b, 0xfe, 0x08, 0xff, 0xff, 0x81, 0xdc, 0x34, 0x1c, 0x00, 0x00, 0x83, 0x00, 0x4d, 0xf8, 0xfe, 0xff, 0xf6, 0x05, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x37, 0x00, 0x05, 0x00, 0x00, 0x82,
+  0x00, 0x0d, 0x42, 0xff, 0x08, 0xff, 0xff, 0x81, 0xbb, 0x00, 0x06, 0x00, 0x00, 0x81, 0x00, 0xa0, 0x08, 0xff, 0xff, 0x81, 0x80, 0x0e, 0x1c, 0x00, 0x00, 0x84, 0x00, 0x04, 0xc4, 0xff, 0xff, 0xff,
+  0xfe, 0xed, 0x04, 0xff, 0xff, 0x82, 0xff, 0xa7, 0x02, 0x00, 0x06, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0xa5, 0x00, 0x06, 0x00, 0x00, 0x82, 0x00, 0x16, 0xf1, 0xff, 0x06, 0xff,
+  0xff, 0x82, 0xff, 0xec, 0x3f, 0x00, 0x1d, 0x00, 0x00, 0x84, 0x28, 0xee, 0xff, 0xff, 0xff, 0xf4, 0xfd, 0xff, 0x03, 0xff, 0xff, 0x81, 0xe8, 0x0c, 0x07, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff,
+  0xff, 0x81, 0x82, 0x00, 0x07, 0x00, 0x00, 0x81, 0x70, 0xff, 0x06, 0xff, 0xff, 0x82, 0xe6, 0xa6, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x82, 0x00, 0x2f, 0xe5, 0xff, 0x05, 0xff, 0xff, 0x81, 0x67, 0x00,
+  0x07, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0x86, 0x00, 0x07, 0x00, 0x00, 0x81, 0x0a, 0xd3, 0x02, 0xff, 0xff, 0x85, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xe8, 0xbe, 0x90, 0x12,
+  0x1f, 0x00, 0x00, 0x81, 0x25, 0xda, 0x02, 0xff, 0xff, 0x84, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xb5, 0x01, 0x00, 0x07, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0x98, 0x00, 0x07, 0x00,
+  0x00, 0x88, 0x00, 0x27, 0xe3, 0xff, 0xff, 0xfa, 0xb6, 0xd7, 0xfe, 0xff, 0xff, 0xcb, 0x7e, 0x3f, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x86, 0x00, 0x1c, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcd, 0xb0,
+  0x77, 0x0d, 0x08, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0x9e, 0x00, 0x08, 0x00, 0x00, 0x86, 0x11, 0x54, 0x4f, 0x2b, 0x32, 0xc0, 0xe9, 0xf8, 0xde, 0x9c, 0x23, 0x00, 0x21, 0x00,
+  0x00, 0x85, 0x06, 0x74, 0xea, 0xff, 0xff, 0xff, 0xfd, 0xa0, 0x18, 0x00, 0x08, 0x00, 0x00, 0x81, 0x30, 0xff, 0x08, 0xff, 0xff, 0x81, 0xa1, 0x00, 0x0a, 0x00, 0x00, 0x83, 0x00, 0x2c, 0x7b, 0x93,
+  0x62, 0x05, 0x23, 0x00, 0x00, 0x83, 0x17, 0x99, 0xd7, 0xdb, 0x9b, 0x3f, 0x09, 0x00, 0x00, 0x81, 0x15, 0xe7, 0x08, 0xff, 0xff, 0x81, 0x87, 0x00, 0x31, 0x00, 0x00, 0x82, 0x03, 0x10, 0x0c, 0x01,
+  0x09, 0x00, 0x00, 0x81, 0x00, 0xc1, 0x08, 0xff, 0xff, 0x81, 0x40, 0x00, 0x3c, 0x00, 0x00, 0x82, 0x00, 0x2a, 0xe8, 0xff, 0x06, 0xff, 0xff, 0x82, 0xff, 0xa5, 0x08, 0x00, 0x3d, 0x00, 0x00, 0x88,
+  0x23, 0x94, 0xc8, 0xc7, 0xc5, 0xbc, 0x8c, 0x8b, 0x8b, 0x8f, 0x92, 0x8b, 0x8b, 0x94, 0x69, 0x02, 0x1f, 0x00, 0x00,
 };
 
 const lv_image_dsc_t img_settings = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 140,
   .header.h = 140,
-  .data_size = 19600 * 3,
+  .header.stride = 280,
+  .data_size = sizeof(img_settings_map),
   .data = img_settings_map,
 };
@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_wifi_signal_1.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,68 +24,49 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_WIFI_SIGNAL_1 uint8_t img_wifi_signal_1_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xbe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x38, 0xbe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0xf7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xbb, 0xde, 0x00, 0x00, 
-  0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xf8, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf8, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 
-  0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xd7, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xf8, 0xbd, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xbb, 0xde, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0x59, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x7a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0x7a, 0xd6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf7, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf8, 0xc5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x59, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0xd8, 0xbd, 0xf8, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x75, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xf7, 0xbd, 0x39, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x5a, 0xc7, 0x39, 0x04, 0x21, 0x86, 0x39, 0x8e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x04, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x8e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2d, 0x48, 0x5d, 0x6c, 0x78, 0x7c, 0x79, 0x6e, 0x5f, 0x4a, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x49, 0x79, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x80, 0x51, 0x19, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x65, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x73, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0d, 0x5f, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x71, 0x19, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x32, 0x8f, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x8d, 0x75, 0x62, 0x5b, 0x59, 0x5c, 0x61, 0x76, 0x8d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x96, 0x45, 0x02, 0x00, 0x00, 
-  0x00, 0x03, 0x58, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x75, 0x40, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x40, 0x76, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x68, 0x06, 0x00, 
-  0x08, 0x73, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x67, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x66, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x08, 
-  0x60, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x83, 0x24, 0x00, 0x00, 0x00, 0x00, 0x05, 0x24, 0x3f, 0x57, 0x61, 0x66, 0x61, 0x58, 0x40, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x25, 0x82, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x58, 
-  0x8d, 0x9b, 0x9b, 0x9b, 0x9b, 0x5c, 0x06, 0x00, 0x00, 0x01, 0x27, 0x66, 0x93, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x91, 0x60, 0x22, 0x01, 0x00, 0x00, 0x06, 0x5d, 0x9b, 0x9b, 0x9b, 0x9b, 0x82, 
-  0x6a, 0x9b, 0x9b, 0x9a, 0x4c, 0x01, 0x00, 0x00, 0x1d, 0x74, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6f, 0x1a, 0x00, 0x00, 0x01, 0x54, 0x9b, 0x9b, 0x9b, 0x68, 
-  0x09, 0x4d, 0x5c, 0x2a, 0x00, 0x00, 0x02, 0x4b, 0x98, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x52, 0x05, 0x00, 0x00, 0x34, 0x60, 0x4f, 0x0a, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x90, 0x73, 0x60, 0x5c, 0x62, 0x75, 0x92, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x7a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6a, 0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x67, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x19, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x84, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x77, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x14, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x9a, 0x9b, 0x9b, 0x9b, 0x66, 0x08, 0x00, 0x00, 0x01, 0x13, 0x3e, 0x54, 0x5d, 0x55, 0x3e, 0x1b, 0x01, 0x00, 0x00, 0x02, 0x4c, 0x9a, 0x9b, 0x9b, 0x99, 0x0e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x92, 0x94, 0x4b, 0x01, 0x00, 0x01, 0x2e, 0x75, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x80, 0x38, 0x01, 0x00, 0x01, 0x3f, 0x98, 0x96, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0e, 0x6f, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x71, 0x0c, 0x00, 0x01, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x83, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x7f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x86, 0x79, 0x7d, 0x96, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x9b, 0x9b, 0x9b, 0x9c, 0x66, 0x15, 0x00, 0x00, 0x00, 0x09, 0x53, 0x9a, 0x9b, 0x9b, 0x9b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8a, 0x9b, 0x98, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0x96, 0x9b, 0x8f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x33, 0x17, 0x00, 0x00, 0x00, 0x03, 0x21, 0x01, 0x00, 0x00, 0x00, 0x13, 0x34, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xe6, 0xff, 0xde, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xbb, 0xf3, 0xb3, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0xb7, 0xb5, 0x13, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x12, 0xb7, 0xb5, 0x81, 0xd6, 0xde, 0x0d, 0x00,
+  0x00, 0x17, 0xb7, 0xb5, 0x0a, 0x00, 0x00, 0x1a, 0xb7, 0xb5, 0x82, 0xd7, 0xb5, 0xb6, 0xb5, 0x05, 0x00, 0x00, 0x81, 0xb7, 0xcd, 0x1d, 0xb7, 0xb5, 0x81, 0x18, 0xc6, 0x03, 0x00, 0x00, 0x81, 0x17,
+  0xb6, 0x0b, 0xb7, 0xb5, 0x81, 0xb9, 0xe5, 0x07, 0x00, 0x00, 0x03, 0xd7, 0xb5, 0x09, 0xb7, 0xb5, 0x83, 0xd7, 0xb5, 0x00, 0x00, 0xd7, 0xb5, 0x09, 0xb7, 0xb5, 0x09, 0x00, 0x00, 0x81, 0xb8, 0xd5,
+  0x04, 0x00, 0x00, 0x81, 0xd6, 0xde, 0x09, 0xb7, 0xb5, 0x81, 0xf7, 0xbd, 0x08, 0xb7, 0xb5, 0x04, 0x00, 0x00, 0x81, 0x77, 0xc6, 0x09, 0xb7, 0xb5, 0x81, 0x97, 0xc6, 0x04, 0x00, 0x00, 0x81, 0xd7,
+  0xb5, 0x0e, 0xb7, 0xb5, 0x02, 0x00, 0x00, 0x81, 0xb7, 0xc5, 0x0f, 0xb7, 0xb5, 0x81, 0x16, 0xc6, 0x02, 0x00, 0x00, 0x81, 0xd6, 0xbd, 0x0b, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x02, 0x00, 0x00, 0x81,
+  0xd7, 0xb5, 0x12, 0xb7, 0xb5, 0x02, 0x00, 0x00, 0x81, 0x96, 0xd6, 0x09, 0xb7, 0xb5, 0x02, 0x00, 0x00, 0x82, 0xf7, 0xbd, 0xd7, 0xb5, 0x14, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x02, 0x00, 0x00, 0x04,
+  0xb7, 0xb5, 0x05, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x17, 0xb7, 0xb5, 0x81, 0xd7, 0xbd, 0x0a, 0x00, 0x00, 0x09, 0xb7, 0xb5, 0x81, 0xd8, 0xb5, 0x05, 0x00, 0x00, 0x81, 0xf8, 0xb5, 0x09, 0xb7, 0xb5,
+  0x09, 0x00, 0x00, 0x08, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x04, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x05, 0x00, 0x00, 0x07, 0xb7, 0xb5, 0x81, 0xd6, 0xb5, 0x08, 0x00, 0x00, 0x07, 0xb7, 0xb5, 0x02, 0x00,
+  0x00, 0x81, 0xb6, 0xb5, 0x07, 0xb7, 0xb5, 0x81, 0xd8, 0xb5, 0x02, 0x00, 0x00, 0x81, 0xf7, 0xbd, 0x05, 0xb7, 0xb5, 0x81, 0xd6, 0xb5, 0x09, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x03, 0xb7, 0xb5, 0x83,
+  0x57, 0xce, 0x00, 0x00, 0xb6, 0xb5, 0x0b, 0xb7, 0xb5, 0x83, 0x18, 0xc6, 0x00, 0x00, 0xb7, 0xc5, 0x04, 0xb7, 0xb5, 0x0b, 0x00, 0x00, 0x02, 0xb6, 0xb5, 0x02, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x0e,
+  0xb7, 0xb5, 0x81, 0x00, 0x00, 0x04, 0xb6, 0xb5, 0x0e, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x0f, 0xb7, 0xb5, 0x81, 0xf7, 0xbd, 0x12, 0x00, 0x00, 0x10, 0xb7, 0xb5, 0x81, 0xd7, 0xb5, 0x12, 0x00, 0x00,
+  0x07, 0xb7, 0xb5, 0x03, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x06, 0xb7, 0xb5, 0x12, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x04, 0xb7, 0xb5, 0x06, 0x00, 0x00, 0x81, 0x76, 0xd6, 0x05, 0xb7, 0xb5, 0x13, 0x00,
+  0x00, 0x81, 0xd7, 0xb5, 0x02, 0xb7, 0xb5, 0x03, 0x00, 0x00, 0x83, 0x97, 0xbd, 0x55, 0xad, 0xd7, 0xc5, 0x03, 0x00, 0x00, 0x03, 0xb7, 0xb5, 0x19, 0x00, 0x00, 0x85, 0x8a, 0x52, 0xa6, 0x39, 0xe4,
+  0x20, 0x86, 0x31, 0x6e, 0x73, 0x1d, 0x00, 0x00, 0x82, 0x99, 0xb6, 0xc7, 0x39, 0x03, 0xe4, 0x20, 0x81, 0xe7, 0x39, 0x1d, 0x00, 0x00, 0x82, 0xb6, 0xad, 0x04, 0x21, 0x03, 0xe4, 0x20, 0x82, 0x86,
+  0x31, 0xd7, 0xbd, 0x1c, 0x00, 0x00, 0x82, 0x3a, 0xb7, 0xe8, 0x41, 0x03, 0xe4, 0x20, 0x81, 0xe7, 0x41, 0x1e, 0x00, 0x00, 0x81, 0xab, 0x5a, 0x02, 0xe7, 0x41, 0x82, 0xe8, 0x41, 0x4d, 0x6b, 0x14,
+  0x00, 0x00, 0x87, 0x00, 0x0c, 0x2d, 0x48, 0x5d, 0x6c, 0x78, 0x7c, 0x79, 0x6e, 0x5f, 0x4a, 0x30, 0x10, 0x09, 0x00, 0x00, 0x83, 0x00, 0x10, 0x49, 0x79, 0x9a, 0x9b, 0x05, 0x9b, 0x9b, 0x83, 0x9b,
+  0x80, 0x51, 0x19, 0x02, 0x00, 0x06, 0x00, 0x00, 0x82, 0x1c, 0x65, 0x99, 0x9b, 0x08, 0x9b, 0x9b, 0x82, 0x9a, 0x73, 0x2a, 0x00, 0x04, 0x00, 0x00, 0x82, 0x00, 0x0d, 0x5f, 0x9a, 0x0a, 0x9b, 0x9b,
+  0x83, 0x9b, 0x9a, 0x71, 0x19, 0x01, 0x00, 0x02, 0x00, 0x00, 0x82, 0x01, 0x32, 0x8f, 0x9b, 0x03, 0x9b, 0x9b, 0x85, 0x9b, 0x8d, 0x75, 0x62, 0x5b, 0x59, 0x5c, 0x61, 0x76, 0x8d, 0x04, 0x9b, 0x9b,
+  0x84, 0x96, 0x45, 0x02, 0x00, 0x00, 0x00, 0x03, 0x58, 0x03, 0x9b, 0x9b, 0x83, 0x9b, 0x75, 0x40, 0x15, 0x01, 0x00, 0x03, 0x00, 0x00, 0x82, 0x01, 0x14, 0x40, 0x76, 0x03, 0x9b, 0x9b, 0x83, 0x9b,
+  0x68, 0x06, 0x00, 0x08, 0x73, 0x02, 0x9b, 0x9b, 0x82, 0x9b, 0x9a, 0x67, 0x1b, 0x04, 0x00, 0x00, 0x81, 0x00, 0x01, 0x02, 0x00, 0x00, 0x82, 0x01, 0x1b, 0x66, 0x9b, 0x02, 0x9b, 0x9b, 0x82, 0x9b,
+  0x77, 0x08, 0x60, 0x02, 0x9b, 0x9b, 0x89, 0x9b, 0x83, 0x24, 0x00, 0x00, 0x00, 0x00, 0x05, 0x24, 0x3f, 0x57, 0x61, 0x66, 0x61, 0x58, 0x40, 0x23, 0x04, 0x02, 0x00, 0x00, 0x81, 0x25, 0x82, 0x02,
+  0x9b, 0x9b, 0x88, 0x9b, 0x58, 0x8d, 0x9b, 0x9b, 0x9b, 0x9b, 0x5c, 0x06, 0x00, 0x00, 0x01, 0x27, 0x66, 0x93, 0x9b, 0x04, 0x9b, 0x9b, 0x84, 0x91, 0x60, 0x22, 0x01, 0x00, 0x00, 0x06, 0x5d, 0x02,
+  0x9b, 0x9b, 0x86, 0x82, 0x6a, 0x9b, 0x9b, 0x9a, 0x4c, 0x01, 0x00, 0x00, 0x1d, 0x74, 0x9b, 0x07, 0x9b, 0x9b, 0x8a, 0x6f, 0x1a, 0x00, 0x00, 0x01, 0x54, 0x9b, 0x9b, 0x9b, 0x68, 0x09, 0x4d, 0x5c,
+  0x2a, 0x00, 0x00, 0x02, 0x4b, 0x98, 0x9b, 0x08, 0x9b, 0x9b, 0x85, 0x97, 0x52, 0x05, 0x00, 0x00, 0x34, 0x60, 0x4f, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x81, 0x07, 0x6d, 0x03, 0x9b, 0x9b, 0x84, 0x9b,
+  0x90, 0x73, 0x60, 0x5c, 0x62, 0x75, 0x92, 0x03, 0x9b, 0x9b, 0x82, 0x9b, 0x7a, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x81, 0x00, 0x69, 0x03, 0x9b, 0x9b, 0x82, 0x6a, 0x28, 0x02, 0x00, 0x02, 0x00, 0x00,
+  0x82, 0x03, 0x2b, 0x67, 0x9a, 0x02, 0x9b, 0x9b, 0x81, 0x9b, 0x70, 0x04, 0x00, 0x00, 0x81, 0x00, 0x19, 0x02, 0x9b, 0x9b, 0x82, 0x9b, 0x84, 0x25, 0x01, 0x02, 0x00, 0x00, 0x81, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0x81, 0x1d, 0x77, 0x02, 0x9b, 0x9b, 0x81, 0x9a, 0x14, 0x04, 0x00, 0x00, 0x8e, 0x13, 0x9a, 0x9b, 0x9b, 0x9b, 0x66, 0x08, 0x00, 0x00, 0x01, 0x13, 0x3e, 0x54, 0x5d, 0x55, 0x3e, 0x1b,
+  0x01, 0x00, 0x00, 0x02, 0x4c, 0x9a, 0x9b, 0x9b, 0x99, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x85, 0x40, 0x92, 0x94, 0x4b, 0x01, 0x00, 0x01, 0x2e, 0x75, 0x9b, 0x03, 0x9b, 0x9b, 0x85, 0x80, 0x38, 0x01,
+  0x00, 0x01, 0x3f, 0x98, 0x96, 0x47, 0x00, 0x05, 0x00, 0x00, 0x83, 0x01, 0x01, 0x00, 0x00, 0x0e, 0x6f, 0x05, 0x9b, 0x9b, 0x84, 0x9b, 0x71, 0x0c, 0x00, 0x01, 0x04, 0x02, 0x01, 0x07, 0x00, 0x00,
+  0x81, 0x0a, 0x83, 0x06, 0x9b, 0x9b, 0x82, 0x9b, 0x7f, 0x08, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x4b, 0x03, 0x9b, 0x9b, 0x82, 0x86, 0x79, 0x7d, 0x96, 0x02, 0x9b, 0x9b, 0x81, 0x9b, 0x41, 0x09,
+  0x00, 0x00, 0x89, 0x52, 0x9b, 0x9b, 0x9b, 0x9c, 0x66, 0x15, 0x00, 0x00, 0x00, 0x09, 0x53, 0x9a, 0x9b, 0x9b, 0x9b, 0x4d, 0x00, 0x08, 0x00, 0x00, 0x83, 0x00, 0x13, 0x8a, 0x9b, 0x98, 0x44, 0x03,
+  0x00, 0x00, 0x83, 0x01, 0x38, 0x96, 0x9b, 0x8f, 0x15, 0x09, 0x00, 0x00, 0x88, 0x00, 0x0a, 0x33, 0x17, 0x00, 0x00, 0x00, 0x03, 0x21, 0x01, 0x00, 0x00, 0x00, 0x13, 0x34, 0x0d, 0x0c, 0x00, 0x00,
+  0x83, 0x00, 0x3c, 0xe6, 0xff, 0xde, 0x38, 0x0e, 0x00, 0x00, 0x84, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x0e, 0x00, 0x00, 0x81, 0x07, 0xff, 0x02, 0xff, 0xff, 0x81, 0x02, 0x00, 0x0d,
+  0x00, 0x00, 0x84, 0x00, 0x01, 0xcd, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x0e, 0x00, 0x00, 0x83, 0x00, 0x20, 0xbb, 0xf3, 0xb3, 0x1e, 0x08, 0x00, 0x00,
 };
 
 const lv_image_dsc_t img_wifi_signal_1 = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 35,
   .header.h = 27,
-  .data_size = 945 * 3,
+  .header.stride = 70,
+  .data_size = sizeof(img_wifi_signal_1_map),
   .data = img_wifi_signal_1_map,
 };
@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_wifi_signal_2.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,68 +24,51 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_WIFI_SIGNAL_2 uint8_t img_wifi_signal_2_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x39, 0xce, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x18, 0xc6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xbe, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x38, 0xbe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd9, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xbb, 0xde, 0x00, 0x00, 
-  0x59, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf8, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xfb, 0xde, 
-  0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xf8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xbb, 0xde, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0x7a, 0xd6, 0xd8, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x59, 0xce, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x7a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf8, 0xc5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xfb, 0xde, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6d, 0x73, 0x6a, 0x52, 0x29, 0x4a, 0x66, 0x31, 0x49, 0x4a, 0x49, 0x4a, 0x8e, 0x73, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xeb, 0x62, 0xc7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x41, 0xab, 0x5a, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xcf, 0x7b, 0xc7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0xae, 0x73, 0x00, 0x00, 0xff, 0xff, 0x1f, 0xc6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x7b, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x66, 0x31, 0xa7, 0x39, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xaa, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x29, 0x4a, 0x8e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0x29, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x86, 0x31, 0x04, 0x21, 0x45, 0x29, 0x8a, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8a, 0x52, 0x45, 0x29, 0x04, 0x21, 0x66, 0x31, 0xaf, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x73, 0xcb, 0x5a, 0x4d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x76, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x73, 0xab, 0x5a, 0x8e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0xc7, 0x39, 0x04, 0x21, 0xa6, 0x39, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x29, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x62, 0x08, 0x42, 0x08, 0x42, 0xe8, 0x41, 0xef, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x2d, 0x4a, 0x5f, 0x6c, 0x78, 0x7b, 0x79, 0x6e, 0x5f, 0x4b, 0x2f, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x49, 0x7b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x7f, 0x4f, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x66, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x71, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0x61, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6f, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x33, 0x90, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x8b, 0x76, 0x61, 0x5c, 0x59, 0x5c, 0x63, 0x77, 0x8e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x96, 0x42, 0x00, 0x00, 0x00, 
-  0x00, 0x04, 0x5a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x73, 0x3e, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x41, 0x76, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x65, 0x06, 0x00, 
-  0x09, 0x77, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x65, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x69, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x76, 0x07, 
-  0x63, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x81, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x40, 0x57, 0x61, 0x65, 0x61, 0x58, 0x40, 0x21, 0x02, 0x00, 0x00, 0x00, 0x01, 0x27, 0x84, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x53, 
-  0x92, 0x9b, 0x9b, 0x9b, 0x9b, 0x59, 0x06, 0x00, 0x00, 0x01, 0x29, 0x66, 0x94, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x90, 0x5e, 0x20, 0x00, 0x00, 0x00, 0x08, 0x61, 0x9b, 0x9b, 0x9b, 0x9b, 0x7d, 
-  0x6e, 0x9b, 0x9b, 0x9b, 0x47, 0x01, 0x00, 0x00, 0x1e, 0x77, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6d, 0x19, 0x00, 0x00, 0x01, 0x57, 0x9b, 0x9b, 0x9b, 0x65, 
-  0x0a, 0x50, 0x5c, 0x29, 0x00, 0x00, 0x02, 0x4d, 0x98, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x98, 0x51, 0x04, 0x00, 0x00, 0x36, 0x60, 0x4e, 0x09, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x8f, 0x73, 0x5f, 0x5c, 0x61, 0x76, 0x93, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x76, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x6c, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x68, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x6a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x83, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x7a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x9a, 0x9b, 0x9b, 0x9b, 0x64, 0x07, 0x00, 0x00, 0x01, 0x2b, 0x71, 0x99, 0x9c, 0x98, 0x70, 0x35, 0x02, 0x00, 0x00, 0x03, 0x4f, 0x9a, 0x9b, 0x9b, 0x99, 0x0c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x93, 0x92, 0x49, 0x01, 0x00, 0x01, 0x5d, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x65, 0x02, 0x00, 0x01, 0x42, 0x98, 0x96, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x20, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x16, 0x00, 0x01, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xcc, 0xd4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x2d, 0x00, 0x00, 0x00, 0x17, 0x97, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xec, 0xff, 0xfc, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6c, 0xfb, 0xff, 0xee, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x62, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x22, 0x02, 0x00, 0x00, 0x00, 0x2a, 0x63, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xe8, 0xff, 0xdc, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe4, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xff, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xbd, 0xf3, 0xb0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x6f, 0x04, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x82, 0xb6, 0xb5, 0xd7, 0xb5, 0x0b, 0xb7, 0xb5, 0x82, 0xd7, 0xb5, 0xb6, 0xb5, 0x12, 0x00, 0x00, 0x13,
+  0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x0d, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x16, 0xb7, 0xb5, 0x0a, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x19, 0xb7, 0xb5, 0x81, 0xd7, 0xb5, 0x07, 0x00, 0x00, 0x1d, 0xb7, 0xb5,
+  0x04, 0x00, 0x00, 0x81, 0xf7, 0xbd, 0x0a, 0xb7, 0xb5, 0x82, 0xd7, 0xb5, 0xb6, 0xb5, 0x07, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x0b, 0xb7, 0xb5, 0x83, 0xd7, 0xbd, 0x00, 0x00, 0xd7, 0xbd, 0x09, 0xb7,
+  0xb5, 0x0e, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x09, 0xb7, 0xb5, 0x81, 0xf7, 0xbd, 0x08, 0xb7, 0xb5, 0x04, 0x00, 0x00, 0x0b, 0xb7, 0xb5, 0x03, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x0e, 0xb7, 0xb5, 0x81,
+  0xb7, 0xbd, 0x02, 0x00, 0x00, 0x81, 0x79, 0xb6, 0x0e, 0xb7, 0xb5, 0x81, 0xd7, 0xb5, 0x03, 0x00, 0x00, 0x81, 0xd7, 0xbd, 0x0b, 0xb7, 0xb5, 0x81, 0x16, 0xce, 0x02, 0x00, 0x00, 0x13, 0xb7, 0xb5,
+  0x02, 0x00, 0x00, 0x81, 0x36, 0xc6, 0x05, 0xb7, 0xb5, 0x81, 0xd6, 0xbd, 0x03, 0xb7, 0xb5, 0x02, 0x00, 0x00, 0x16, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x02, 0x00, 0x00, 0x03, 0xb7, 0xb5, 0x81, 0xf7,
+  0xbd, 0x05, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x17, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x09, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x09, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x05, 0x00, 0x00, 0x0a, 0xb7, 0xb5, 0x81,
+  0xb6, 0xb5, 0x08, 0x00, 0x00, 0x81, 0xb6, 0xb5, 0x07, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x09, 0x00, 0x00, 0x82, 0xb6, 0xb5, 0xd6, 0xb5, 0x07, 0xb7, 0xb5, 0x08, 0x00, 0x00, 0x06, 0xb7, 0xb5, 0x81,
+  0xd7, 0xbd, 0x02, 0x00, 0x00, 0x85, 0x58, 0xb6, 0x4d, 0x6b, 0x49, 0x4a, 0x28, 0x42, 0x65, 0x29, 0x02, 0x28, 0x42, 0x82, 0x6d, 0x73, 0xf7, 0xbd, 0x02, 0x00, 0x00, 0x81, 0x57, 0xbe, 0x06, 0xb7,
+  0xb5, 0x09, 0x00, 0x00, 0x04, 0xb7, 0xb5, 0x85, 0x19, 0xb6, 0x00, 0x00, 0xb6, 0xb5, 0xcb, 0x5a, 0xa7, 0x39, 0x07, 0xe4, 0x20, 0x85, 0xc7, 0x39, 0xaa, 0x52, 0xb7, 0xbd, 0x00, 0x00, 0xb6, 0xb5,
+  0x03, 0xb7, 0xb5, 0x81, 0xd7, 0xb5, 0x0b, 0x00, 0x00, 0x86, 0xb7, 0xce, 0xf7, 0xde, 0x00, 0x00, 0xb6, 0xb5, 0x8e, 0x73, 0xc7, 0x39, 0x0b, 0xe4, 0x20, 0x86, 0xe7, 0x41, 0x8e, 0x73, 0x00, 0x00,
+  0xb6, 0xb5, 0xd8, 0xb5, 0xd9, 0xc5, 0x0f, 0x00, 0x00, 0x82, 0x8e, 0x73, 0x65, 0x31, 0x0d, 0xe4, 0x20, 0x82, 0xc7, 0x39, 0xae, 0x73, 0x12, 0x00, 0x00, 0x81, 0x08, 0x42, 0x06, 0xe4, 0x20, 0x84,
+  0xa7, 0x39, 0x45, 0x29, 0xa6, 0x31, 0x45, 0x29, 0x05, 0xe4, 0x20, 0x81, 0x8a, 0x52, 0x12, 0x00, 0x00, 0x81, 0xe7, 0x39, 0x04, 0xe4, 0x20, 0x82, 0x28, 0x42, 0x6e, 0x73, 0x03, 0x00, 0x00, 0x82,
+  0x50, 0x84, 0x08, 0x42, 0x04, 0xe4, 0x20, 0x81, 0x28, 0x4a, 0x12, 0x00, 0x00, 0x86, 0x2c, 0x63, 0x66, 0x31, 0xe4, 0x20, 0x24, 0x29, 0x69, 0x52, 0xd6, 0xb5, 0x05, 0x00, 0x00, 0x86, 0xb6, 0xb5,
+  0x8a, 0x52, 0x24, 0x29, 0xe4, 0x20, 0x65, 0x31, 0x8e, 0x73, 0x13, 0x00, 0x00, 0x83, 0x8e, 0x73, 0xaa, 0x5a, 0x2c, 0x6b, 0x03, 0x00, 0x00, 0x83, 0xb7, 0xc5, 0x55, 0xad, 0xf9, 0xcd, 0x03, 0x00,
+  0x00, 0x83, 0x2d, 0x6b, 0x8a, 0x52, 0x6d, 0x6b, 0x19, 0x00, 0x00, 0x85, 0xaa, 0x5a, 0xa6, 0x39, 0xe4, 0x20, 0x86, 0x31, 0x6d, 0x6b, 0x1d, 0x00, 0x00, 0x82, 0xd7, 0xbd, 0xc7, 0x39, 0x03, 0xe4,
+  0x20, 0x81, 0xe7, 0x41, 0x1d, 0x00, 0x00, 0x81, 0x51, 0x8c, 0x04, 0xe4, 0x20, 0x81, 0xc7, 0x39, 0x1e, 0x00, 0x00, 0x81, 0xe7, 0x39, 0x03, 0xe4, 0x20, 0x81, 0x28, 0x4a, 0x1e, 0x00, 0x00, 0x85,
+  0xcb, 0x5a, 0xe7, 0x39, 0xe7, 0x41, 0xc7, 0x39, 0x8e, 0x73, 0x14, 0x00, 0x00, 0x88, 0x01, 0x0d, 0x2d, 0x4a, 0x5f, 0x6c, 0x78, 0x7b, 0x79, 0x6e, 0x5f, 0x4b, 0x2f, 0x10, 0x01, 0x00, 0x08, 0x00,
+  0x00, 0x83, 0x00, 0x11, 0x49, 0x7b, 0x9a, 0x9b, 0x05, 0x9b, 0x9b, 0x83, 0x9b, 0x7f, 0x4f, 0x18, 0x01, 0x00, 0x06, 0x00, 0x00, 0x82, 0x1d, 0x66, 0x99, 0x9b, 0x08, 0x9b, 0x9b, 0x82, 0x9a, 0x71,
+  0x27, 0x00, 0x04, 0x00, 0x00, 0x82, 0x00, 0x0f, 0x61, 0x9a, 0x0b, 0x9b, 0x9b, 0x81, 0x6f, 0x18, 0x03, 0x00, 0x00, 0x82, 0x00, 0x33, 0x90, 0x9b, 0x03, 0x9b, 0x9b, 0x85, 0x9b, 0x8b, 0x76, 0x61,
+  0x5c, 0x59, 0x5c, 0x63, 0x77, 0x8e, 0x04, 0x9b, 0x9b, 0x81, 0x96, 0x42, 0x02, 0x00, 0x00, 0x82, 0x04, 0x5a, 0x9a, 0x9b, 0x02, 0x9b, 0x9b, 0x83, 0x9b, 0x73, 0x3e, 0x15, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x82, 0x01, 0x16, 0x41, 0x76, 0x03, 0x9b, 0x9b, 0x83, 0x9b, 0x65, 0x06, 0x00, 0x09, 0x77, 0x02, 0x9b, 0x9b, 0x82, 0x9b, 0x9a, 0x65, 0x1b, 0x07, 0x00, 0x00, 0x82, 0x01, 0x1d, 0x69, 0x9b,
+  0x02, 0x9b, 0x9b, 0x82, 0x9b, 0x76, 0x07, 0x63, 0x02, 0x9b, 0x9b, 0x8c, 0x9b, 0x81, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x40, 0x57, 0x61, 0x65, 0x61, 0x58, 0x40, 0x21, 0x02, 0x00, 0x00,
+  0x00, 0x01, 0x27, 0x84, 0x02, 0x9b, 0x9b, 0x88, 0x9b, 0x53, 0x92, 0x9b, 0x9b, 0x9b, 0x9b, 0x59, 0x06, 0x00, 0x00, 0x01, 0x29, 0x66, 0x94, 0x9b, 0x04, 0x9b, 0x9b, 0x84, 0x90, 0x5e, 0x20, 0x00,
+  0x00, 0x00, 0x08, 0x61, 0x02, 0x9b, 0x9b, 0x86, 0x7d, 0x6e, 0x9b, 0x9b, 0x9b, 0x47, 0x01, 0x00, 0x00, 0x1e, 0x77, 0x9b, 0x07, 0x9b, 0x9b, 0x8a, 0x6d, 0x19, 0x00, 0x00, 0x01, 0x57, 0x9b, 0x9b,
+  0x9b, 0x65, 0x0a, 0x50, 0x5c, 0x29, 0x00, 0x00, 0x02, 0x4d, 0x98, 0x9b, 0x08, 0x9b, 0x9b, 0x85, 0x98, 0x51, 0x04, 0x00, 0x00, 0x36, 0x60, 0x4e, 0x09, 0x00, 0x02, 0x00, 0x00, 0x81, 0x08, 0x6e,
+  0x03, 0x9b, 0x9b, 0x84, 0x9b, 0x8f, 0x73, 0x5f, 0x5c, 0x61, 0x76, 0x93, 0x03, 0x9b, 0x9b, 0x82, 0x9b, 0x76, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x81, 0x01, 0x6c, 0x02, 0x9b, 0x9b, 0x83, 0x9b, 0x9a,
+  0x68, 0x26, 0x01, 0x00, 0x02, 0x00, 0x00, 0x82, 0x03, 0x2b, 0x6a, 0x9a, 0x02, 0x9b, 0x9b, 0x82, 0x9b, 0x6d, 0x01, 0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0x1b, 0x02, 0x9b, 0x9b, 0x82, 0x9b, 0x83,
+  0x24, 0x01, 0x04, 0x00, 0x00, 0x82, 0x00, 0x01, 0x1f, 0x7a, 0x02, 0x9b, 0x9b, 0x81, 0x9c, 0x10, 0x04, 0x00, 0x00, 0x8e, 0x14, 0x9a, 0x9b, 0x9b, 0x9b, 0x64, 0x07, 0x00, 0x00, 0x01, 0x2b, 0x71,
+  0x99, 0x9c, 0x98, 0x70, 0x35, 0x02, 0x00, 0x00, 0x03, 0x4f, 0x9a, 0x9b, 0x9b, 0x99, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x85, 0x43, 0x93, 0x92, 0x49, 0x01, 0x00, 0x01, 0x5d, 0xcd, 0xff, 0x03, 0xff,
+  0xff, 0x85, 0xdc, 0x65, 0x02, 0x00, 0x01, 0x42, 0x98, 0x96, 0x45, 0x00, 0x05, 0x00, 0x00, 0x83, 0x01, 0x02, 0x00, 0x01, 0x20, 0xc4, 0x05, 0xff, 0xff, 0x84, 0xff, 0xc0, 0x16, 0x00, 0x01, 0x04,
+  0x02, 0x00, 0x07, 0x00, 0x00, 0x81, 0x18, 0xe2, 0x06, 0xff, 0xff, 0x82, 0xff, 0xd5, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x8a, 0x03, 0xff, 0xff, 0x82, 0xe6, 0xcc, 0xd4, 0xfc, 0x02, 0xff,
+  0xff, 0x81, 0xff, 0x71, 0x09, 0x00, 0x00, 0x86, 0x95, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x2d, 0x00, 0x00, 0x00, 0x17, 0x97, 0x02, 0xff, 0xff, 0x81, 0x84, 0x00, 0x08, 0x00, 0x00, 0x84, 0x00, 0x29,
+  0xec, 0xff, 0xfc, 0x77, 0x02, 0x00, 0x02, 0x00, 0x00, 0x83, 0x01, 0x6c, 0xfb, 0xff, 0xee, 0x25, 0x09, 0x00, 0x00, 0x88, 0x00, 0x16, 0x62, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x22, 0x02, 0x00, 0x00,
+  0x00, 0x2a, 0x63, 0x19, 0x0c, 0x00, 0x00, 0x83, 0x00, 0x41, 0xe8, 0xff, 0xdc, 0x31, 0x0e, 0x00, 0x00, 0x84, 0x00, 0x01, 0xe4, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x0e, 0x00, 0x00, 0x83, 0x07, 0xff,
+  0xff, 0xff, 0xff, 0xfc, 0x0f, 0x00, 0x00, 0x83, 0xd3, 0xff, 0xff, 0xff, 0xba, 0x00, 0x0e, 0x00, 0x00, 0x83, 0x00, 0x24, 0xbd, 0xf3, 0xb0, 0x1b, 0x08, 0x00, 0x00,
 };
 
 const lv_image_dsc_t img_wifi_signal_2 = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 35,
   .header.h = 27,
-  .data_size = 945 * 3,
+  .header.stride = 70,
+  .data_size = sizeof(img_wifi_signal_2_map),
   .data = img_wifi_signal_2_map,
 };
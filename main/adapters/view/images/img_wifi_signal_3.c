@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_wifi_signal_3.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,68 +24,56 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_WIFI_SIGNAL_3 uint8_t img_wifi_signal_3_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0xd8, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd9, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x39, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf8, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xf8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf8, 0xc5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x18, 0xc6, 0x00, 0x00, 
-  0xf8, 0xc7, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0xbe, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x59, 0xce, 
-  0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf8, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x0c, 0x63, 0x29, 0x4a, 0x28, 0x4a, 0x29, 0x4a, 0x8a, 0x52, 0x69, 0x52, 0xa7, 0x39, 0x69, 0x52, 0xab, 0x5a, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x97, 0xbe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2c, 0x63, 0x28, 0x42, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0xe8, 0x41, 0xeb, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6b, 0xe8, 0x41, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0xcc, 0x62, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 
-  0x7a, 0xd6, 0xd7, 0xbd, 0xd7, 0xbd, 0xd8, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xab, 0x5a, 0x65, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x29, 0x6a, 0x52, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xda, 0xbd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0x28, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0xc7, 0x39, 0x08, 0x42, 0x66, 0x31, 0x08, 0x42, 0xc7, 0x39, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0xae, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x28, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0xec, 0x62, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0xeb, 0x62, 0xe8, 0x41, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x24, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0xaa, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2c, 0x63, 0x29, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x2c, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x94, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe7, 0x41, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6f, 0x7b, 0x8a, 0x52, 0x49, 0x4a, 0x66, 0x31, 0x29, 0x4a, 0x29, 0x4a, 0x4d, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6a, 0x52, 0x25, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x86, 0x31, 0x86, 0x31, 0x08, 0x42, 0x18, 0xc6, 0x00, 0x00, 0xff, 0xff, 0xec, 0x62, 0x08, 0x42, 0x04, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xa7, 0x39, 0x49, 0x4a, 0x18, 0xc6, 0x00, 0x00, 0xff, 0xff, 0x6a, 0x52, 0x86, 0x31, 0x65, 0x31, 0x49, 0x4a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x12, 0x94, 0x28, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0xae, 0x73, 0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0xba, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8c, 0xe7, 0x41, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xa7, 0x39, 0xcf, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x65, 0x31, 0x86, 0x39, 0x66, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x41, 0x8e, 0x73, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x49, 0x4a, 0x25, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x86, 0x31, 0x04, 0x21, 0x25, 0x29, 0x6a, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x63, 0x45, 0x29, 0x04, 0x21, 0x65, 0x31, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x7c, 0xab, 0x5a, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x76, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x7b, 0x8a, 0x52, 0xef, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6b, 0xc7, 0x39, 0x04, 0x21, 0xc7, 0x39, 0xeb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x29, 0x9a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xe8, 0x41, 0x08, 0x42, 0x08, 0x42, 0xeb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2a, 0x46, 0x5e, 0x6b, 0x77, 0x7b, 0x79, 0x6f, 0x61, 0x4d, 0x31, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x44, 0x75, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x83, 0x52, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x5e, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x76, 0x2e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x57, 0x98, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x75, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0x88, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x8f, 0x78, 0x63, 0x5c, 0x59, 0x5c, 0x62, 0x75, 0x8c, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x98, 0x49, 0x01, 0x00, 0x00, 
-  0x00, 0x01, 0x4c, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x7a, 0x44, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x3c, 0x71, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6c, 0x08, 0x00, 
-  0x04, 0x67, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6f, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x63, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x7c, 0x09, 
-  0x50, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x88, 0x2e, 0x01, 0x00, 0x00, 0x00, 0x07, 0x40, 0x6d, 0x98, 0xa8, 0xb9, 0xaf, 0x9a, 0x76, 0x45, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x21, 0x7f, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x5c, 
-  0x7c, 0x9b, 0x9b, 0x9b, 0x9b, 0x68, 0x0b, 0x00, 0x00, 0x01, 0x40, 0xaa, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xad, 0x46, 0x01, 0x00, 0x00, 0x06, 0x57, 0x9b, 0x9b, 0x9b, 0x9b, 0x87, 
-  0x5a, 0x9b, 0x9b, 0x9b, 0x59, 0x01, 0x00, 0x00, 0x2d, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x37, 0x01, 0x00, 0x01, 0x4d, 0x9b, 0x9b, 0x9b, 0x6d, 
-  0x05, 0x48, 0x5d, 0x33, 0x00, 0x00, 0x01, 0x75, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9c, 0x0d, 0x00, 0x00, 0x32, 0x5f, 0x52, 0x0b, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc9, 0xa9, 0x9b, 0xa9, 0xc9, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x55, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4c, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x53, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x14, 0xf8, 0xff, 0xff, 0xff, 0xc2, 0x1a, 0x00, 0x00, 0x01, 0x23, 0x6b, 0x97, 0x9c, 0x9a, 0x73, 0x3b, 0x02, 0x00, 0x00, 0x03, 0x81, 0xfd, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf2, 0xfd, 0x96, 0x08, 0x00, 0x02, 0x4d, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x6d, 0x04, 0x00, 0x01, 0x69, 0xfd, 0xfe, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x14, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x1f, 0x00, 0x01, 0x10, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xcc, 0xd1, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x38, 0x01, 0x00, 0x00, 0x0f, 0x89, 0xfe, 0xff, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xe1, 0xff, 0xff, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0xf7, 0xff, 0xf4, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5c, 0x37, 0x00, 0x00, 0x00, 0x03, 0x21, 0x03, 0x00, 0x00, 0x00, 0x23, 0x63, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xde, 0xff, 0xe6, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb1, 0xf2, 0xbc, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x81, 0xd7, 0xb5, 0x0b, 0xb7, 0xb5, 0x82, 0xd7, 0xb5, 0xb6, 0xb5, 0x11, 0x00, 0x00, 0x81, 0xb6, 0xb5,
+  0x13, 0xb7, 0xb5, 0x0e, 0x00, 0x00, 0x17, 0xb7, 0xb5, 0x81, 0xd7, 0xb5, 0x09, 0x00, 0x00, 0x1a, 0xb7, 0xb5, 0x81, 0xd7, 0xb5, 0x07, 0x00, 0x00, 0x1d, 0xb7, 0xb5, 0x81, 0x79, 0xbe, 0x03, 0x00,
+  0x00, 0x81, 0x17, 0xc6, 0x0b, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x07, 0x00, 0x00, 0x82, 0xb6, 0xb5, 0xd7, 0xb5, 0x0a, 0xb7, 0xb5, 0x83, 0xf7, 0xbd, 0x00, 0x00, 0x17, 0xbe, 0x09, 0xb7, 0xb5, 0x81,
+  0xb6, 0xb5, 0x07, 0x00, 0x00, 0x82, 0xb8, 0xd5, 0xba, 0xce, 0x04, 0x00, 0x00, 0x82, 0xb6, 0xb5, 0xd7, 0xb5, 0x08, 0xb7, 0xb5, 0x81, 0xf7, 0xbd, 0x08, 0xb7, 0xb5, 0x81, 0xb6, 0xb5, 0x03, 0x00,
+  0x00, 0x82, 0x34, 0xa5, 0xeb, 0x62, 0x03, 0x08, 0x42, 0x87, 0x69, 0x52, 0x49, 0x4a, 0xa6, 0x31, 0x49, 0x4a, 0xaa, 0x5a, 0x35, 0xad, 0xb6, 0xb5, 0x03, 0x00, 0x00, 0x0e, 0xb7, 0xb5, 0x81, 0xf7,
+  0xbd, 0x02, 0x00, 0x00, 0x84, 0x78, 0xb6, 0x0c, 0x63, 0x08, 0x42, 0x86, 0x31, 0x09, 0xe4, 0x20, 0x84, 0x66, 0x31, 0xc7, 0x39, 0xcb, 0x5a, 0x18, 0xbe, 0x02, 0x00, 0x00, 0x81, 0xd7, 0xbd, 0x0b,
+  0xb7, 0xb5, 0x81, 0x16, 0xc6, 0x02, 0x00, 0x00, 0x82, 0x2d, 0x6b, 0xe7, 0x39, 0x0f, 0xe4, 0x20, 0x85, 0xe7, 0x41, 0xab, 0x5a, 0xb6, 0xb5, 0x00, 0x00, 0x16, 0xce, 0x05, 0xb7, 0xb5, 0x81, 0xd7,
+  0xb5, 0x02, 0xb7, 0xb5, 0x81, 0xd7, 0xb5, 0x02, 0x00, 0x00, 0x83, 0xd7, 0xbd, 0xaa, 0x52, 0x45, 0x29, 0x11, 0xe4, 0x20, 0x83, 0x24, 0x29, 0x69, 0x4a, 0xcf, 0x7b, 0x02, 0x00, 0x00, 0x03, 0xb7,
+  0xb5, 0x81, 0xd7, 0xb5, 0x05, 0x00, 0x00, 0x82, 0x14, 0xa5, 0x08, 0x42, 0x07, 0xe4, 0x20, 0x87, 0x86, 0x31, 0xa7, 0x39, 0x08, 0x42, 0x65, 0x29, 0x08, 0x42, 0xc7, 0x39, 0x86, 0x31, 0x07, 0xe4,
+  0x20, 0x82, 0xc7, 0x39, 0x6d, 0x6b, 0x09, 0x00, 0x00, 0x82, 0xd7, 0xb5, 0x08, 0x42, 0x06, 0xe4, 0x20, 0x83, 0xe7, 0x41, 0xeb, 0x5a, 0x92, 0x94, 0x05, 0x00, 0x00, 0x84, 0x55, 0xad, 0xcb, 0x5a,
+  0xe7, 0x39, 0x24, 0x29, 0x05, 0xe4, 0x20, 0x82, 0x08, 0x42, 0xd7, 0xb5, 0x08, 0x00, 0x00, 0x82, 0xcf, 0x7b, 0x04, 0x21, 0x04, 0xe4, 0x20, 0x83, 0x65, 0x31, 0x8a, 0x52, 0x37, 0xb6, 0x09, 0x00,
+  0x00, 0x83, 0xb7, 0xbd, 0xeb, 0x5a, 0x08, 0x42, 0x05, 0xe4, 0x20, 0x81, 0x0c, 0x63, 0x08, 0x00, 0x00, 0x82, 0x10, 0x84, 0x45, 0x29, 0x03, 0xe4, 0x20, 0x82, 0xc7, 0x39, 0xcf, 0x7b, 0x02, 0x00,
+  0x00, 0x89, 0x58, 0xbe, 0x6d, 0x6b, 0x6a, 0x52, 0x28, 0x4a, 0x65, 0x29, 0x08, 0x42, 0x28, 0x42, 0x2c, 0x63, 0xf7, 0xbd, 0x02, 0x00, 0x00, 0x83, 0xd7, 0xbd, 0x69, 0x52, 0x24, 0x29, 0x03, 0xe4,
+  0x20, 0x81, 0x2d, 0x6b, 0x09, 0x00, 0x00, 0x8a, 0x8a, 0x52, 0x86, 0x31, 0x65, 0x31, 0xe8, 0x41, 0x55, 0xad, 0x00, 0x00, 0xf7, 0xb5, 0xeb, 0x5a, 0xe8, 0x41, 0x04, 0x21, 0x06, 0xe4, 0x20, 0x8a,
+  0x86, 0x31, 0x49, 0x4a, 0x55, 0xad, 0x00, 0x00, 0x17, 0xb6, 0x69, 0x4a, 0x65, 0x31, 0x45, 0x29, 0x49, 0x4a, 0xb6, 0xb5, 0x0a, 0x00, 0x00, 0x86, 0xf8, 0xc5, 0x19, 0xd6, 0xb6, 0xb5, 0x00, 0x00,
+  0xf0, 0x83, 0x08, 0x42, 0x0b, 0xe4, 0x20, 0x84, 0xa7, 0x39, 0x6d, 0x6b, 0x00, 0x00, 0xb6, 0xb5, 0x02, 0x96, 0xb5, 0x0f, 0x00, 0x00, 0x82, 0xae, 0x73, 0xc7, 0x39, 0x0d, 0xe4, 0x20, 0x82, 0x86,
+  0x31, 0x8d, 0x6b, 0x12, 0x00, 0x00, 0x81, 0xaa, 0x5a, 0x06, 0xe4, 0x20, 0x84, 0xa7, 0x39, 0x45, 0x29, 0x86, 0x31, 0x65, 0x29, 0x05, 0xe4, 0x20, 0x81, 0x28, 0x42, 0x12, 0x00, 0x00, 0x81, 0xaa,
+  0x52, 0x04, 0xe4, 0x20, 0x83, 0xc7, 0x39, 0x8e, 0x73, 0x38, 0xbe, 0x02, 0x00, 0x00, 0x83, 0xcf, 0x7b, 0x49, 0x4a, 0x04, 0x21, 0x03, 0xe4, 0x20, 0x81, 0xc7, 0x39, 0x12, 0x00, 0x00, 0x86, 0x10,
+  0x84, 0x66, 0x31, 0xe4, 0x20, 0x24, 0x29, 0x49, 0x4a, 0xf7, 0xbd, 0x05, 0x00, 0x00, 0x86, 0xb6, 0xb5, 0xeb, 0x5a, 0x45, 0x29, 0xe4, 0x20, 0x45, 0x29, 0x2c, 0x63, 0x13, 0x00, 0x00, 0x83, 0xcf,
+  0x73, 0xaa, 0x52, 0x4d, 0x6b, 0x03, 0x00, 0x00, 0x83, 0xf8, 0xc5, 0x55, 0xad, 0xb7, 0xbd, 0x03, 0x00, 0x00, 0x83, 0x8e, 0x73, 0x6a, 0x52, 0xcf, 0x7b, 0x19, 0x00, 0x00, 0x85, 0x2c, 0x6b, 0xa6,
+  0x39, 0xe4, 0x20, 0xa6, 0x39, 0xcb, 0x5a, 0x1e, 0x00, 0x00, 0x81, 0xe7, 0x39, 0x03, 0xe4, 0x20, 0x81, 0xa6, 0x39, 0x1e, 0x00, 0x00, 0x81, 0x86, 0x31, 0x03, 0xe4, 0x20, 0x82, 0x04, 0x21, 0xd7,
+  0xbd, 0x1d, 0x00, 0x00, 0x81, 0xc7, 0x39, 0x03, 0xe4, 0x20, 0x81, 0xc7, 0x39, 0x1e, 0x00, 0x00, 0x85, 0xef, 0x7b, 0xe7, 0x39, 0xe7, 0x41, 0xe8, 0x41, 0xcb, 0x5a, 0x14, 0x00, 0x00, 0x88, 0x00,
+  0x0a, 0x2a, 0x46, 0x5e, 0x6b, 0x77, 0x7b, 0x79, 0x6f, 0x61, 0x4d, 0x31, 0x12, 0x01, 0x00, 0x08, 0x00, 0x00, 0x83, 0x01, 0x0d, 0x44, 0x75, 0x99, 0x9b, 0x05, 0x9b, 0x9b, 0x82, 0x9b, 0x83, 0x52,
+  0x1b, 0x07, 0x00, 0x00, 0x82, 0x16, 0x5e, 0x97, 0x9b, 0x08, 0x9b, 0x9b, 0x82, 0x9b, 0x76, 0x2e, 0x01, 0x04, 0x00, 0x00, 0x82, 0x00, 0x09, 0x57, 0x98, 0x0b, 0x9b, 0x9b, 0x81, 0x75, 0x1c, 0x03,
+  0x00, 0x00, 0x82, 0x00, 0x27, 0x88, 0x9b, 0x03, 0x9b, 0x9b, 0x85, 0x9b, 0x8f, 0x78, 0x63, 0x5c, 0x59, 0x5c, 0x62, 0x75, 0x8c, 0x04, 0x9b, 0x9b, 0x85, 0x98, 0x49, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x4c, 0x9a, 0x9b, 0x02, 0x9b, 0x9b, 0x83, 0x9b, 0x7a, 0x44, 0x17, 0x01, 0x00, 0x03, 0x00, 0x00, 0x83, 0x01, 0x14, 0x3c, 0x71, 0x9a, 0x9b, 0x02, 0x9b, 0x9b, 0x83, 0x9b, 0x6c, 0x08, 0x00, 0x04,
+  0x67, 0x03, 0x9b, 0x9b, 0x82, 0x6f, 0x21, 0x01, 0x00, 0x03, 0x00, 0x00, 0x81, 0x01, 0x01, 0x02, 0x00, 0x00, 0x82, 0x01, 0x19, 0x63, 0x9a, 0x02, 0x9b, 0x9b, 0x82, 0x9b, 0x7c, 0x09, 0x50, 0x02,
+  0x9b, 0x9b, 0x8c, 0x9b, 0x88, 0x2e, 0x01, 0x00, 0x00, 0x00, 0x07, 0x40, 0x6d, 0x98, 0xa8, 0xb9, 0xaf, 0x9a, 0x76, 0x45, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x21, 0x7f, 0x02, 0x9b, 0x9b, 0x88, 0x9b,
+  0x5c, 0x7c, 0x9b, 0x9b, 0x9b, 0x9b, 0x68, 0x0b, 0x00, 0x00, 0x01, 0x40, 0xaa, 0xf5, 0xff, 0x04, 0xff, 0xff, 0x84, 0xf7, 0xad, 0x46, 0x01, 0x00, 0x00, 0x06, 0x57, 0x02, 0x9b, 0x9b, 0x86, 0x87,
+  0x5a, 0x9b, 0x9b, 0x9b, 0x59, 0x01, 0x00, 0x00, 0x2d, 0xbe, 0xff, 0x07, 0xff, 0xff, 0x8a, 0xc9, 0x37, 0x01, 0x00, 0x01, 0x4d, 0x9b, 0x9b, 0x9b, 0x6d, 0x05, 0x48, 0x5d, 0x33, 0x00, 0x00, 0x01,
+  0x75, 0xf9, 0xff, 0x08, 0xff, 0xff, 0x85, 0xfe, 0x9c, 0x0d, 0x00, 0x00, 0x32, 0x5f, 0x52, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x81, 0x0a, 0xaa, 0x03, 0xff, 0xff, 0x84, 0xff, 0xf8, 0xc9, 0xa9, 0x9b,
+  0xa9, 0xc9, 0xf7, 0x03, 0xff, 0xff, 0x82, 0xff, 0xd7, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x81, 0x02, 0x9e, 0x03, 0xff, 0xff, 0x82, 0xc4, 0x55, 0x07, 0x00, 0x02, 0x00, 0x00, 0x82, 0x06, 0x4c, 0xaf,
+  0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xce, 0x03, 0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0x1c, 0x02, 0xff, 0xff, 0x82, 0xff, 0xe8, 0x53, 0x01, 0x04, 0x00, 0x00, 0x82, 0x00, 0x01, 0x31, 0xca, 0x02,
+  0xff, 0xff, 0x81, 0xff, 0x34, 0x04, 0x00, 0x00, 0x8e, 0x14, 0xf8, 0xff, 0xff, 0xff, 0xc2, 0x1a, 0x00, 0x00, 0x01, 0x23, 0x6b, 0x97, 0x9c, 0x9a, 0x73, 0x3b, 0x02, 0x00, 0x00, 0x03, 0x81, 0xfd,
+  0xff, 0xff, 0xff, 0x28, 0x00, 0x04, 0x00, 0x00, 0x85, 0x61, 0xf2, 0xfd, 0x96, 0x08, 0x00, 0x02, 0x4d, 0xc6, 0xff, 0x03, 0xff, 0xff, 0x85, 0xe1, 0x6d, 0x04, 0x00, 0x01, 0x69, 0xfd, 0xfe, 0x8a,
+  0x01, 0x05, 0x00, 0x00, 0x83, 0x02, 0x02, 0x01, 0x00, 0x14, 0xb5, 0x05, 0xff, 0xff, 0x84, 0xff, 0xc9, 0x1f, 0x00, 0x01, 0x10, 0x0a, 0x00, 0x07, 0x00, 0x00, 0x81, 0x0b, 0xd2, 0x06, 0xff, 0xff,
+  0x82, 0xff, 0xe2, 0x13, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x6f, 0x03, 0xff, 0xff, 0x82, 0xea, 0xcc, 0xd1, 0xfb, 0x02, 0xff, 0xff, 0x81, 0xff, 0x83, 0x09, 0x00, 0x00, 0x89, 0x80, 0xff, 0xff,
+  0xff, 0xff, 0xbe, 0x38, 0x01, 0x00, 0x00, 0x0f, 0x89, 0xfe, 0xff, 0xff, 0xff, 0x93, 0x00, 0x08, 0x00, 0x00, 0x84, 0x00, 0x1a, 0xe1, 0xff, 0xff, 0x8c, 0x03, 0x00, 0x02, 0x00, 0x00, 0x83, 0x01,
+  0x5c, 0xf7, 0xff, 0xf4, 0x33, 0x09, 0x00, 0x00, 0x88, 0x00, 0x0f, 0x5c, 0x37, 0x00, 0x00, 0x00, 0x03, 0x21, 0x03, 0x00, 0x00, 0x00, 0x23, 0x63, 0x21, 0x0c, 0x00, 0x00, 0x83, 0x00, 0x32, 0xde,
+  0xff, 0xe6, 0x40, 0x0f, 0x00, 0x00, 0x83, 0xcd, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x0e, 0x00, 0x00, 0x81, 0x00, 0xfd, 0x02, 0xff, 0xff, 0x81, 0x0b, 0x00, 0x0e, 0x00, 0x00, 0x83, 0xb6, 0xff, 0xff,
+  0xff, 0xcf, 0x00, 0x0e, 0x00, 0x00, 0x83, 0x00, 0x1c, 0xb1, 0xf2, 0xbc, 0x22, 0x08, 0x00, 0x00,
 };
 
 const lv_image_dsc_t img_wifi_signal_3 = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 35,
   .header.h = 27,
-  .data_size = 945 * 3,
+  .header.stride = 70,
+  .data_size = sizeof(img_wifi_signal_3_map),
   .data = img_wifi_signal_3_map,
 };
@@ -1,3 +1,5 @@
+/* Generated by assets/convert_images.py from assets/images/img_wifi_signal_max.png, do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,68 +24,61 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_WIFI_SIGNAL_MAX uint8_t img_wifi_signal_max_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x71, 0x8c, 0xcb, 0x5a, 0x49, 0x4a, 0xc7, 0x41, 0x49, 0x4a, 0x86, 0x31, 0x04, 0x29, 0x45, 0x31, 0x49, 0x4a, 0xc7, 0x39, 0x69, 0x52, 0x8a, 0x52, 0xaf, 0x7b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4e, 0x73, 0x49, 0x4a, 0x08, 0x42, 0x25, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x49, 0x4a, 0x4d, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6b, 0x08, 0x42, 0x45, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x29, 0xe7, 0x41, 0xeb, 0x62, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x28, 0x42, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0x4d, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0xa7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xa7, 0x39, 0xc7, 0x39, 0x29, 0x4a, 0x66, 0x31, 0x86, 0x39, 0x66, 0x31, 0x28, 0x4a, 0xa7, 0x39, 0xc7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x45, 0x29, 0x8a, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0xc6, 0x69, 0x52, 0x04, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe8, 0x41, 0x69, 0x52, 0x8e, 0x73, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcf, 0x7b, 0x49, 0x4a, 0xc7, 0x39, 0x04, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x4a, 0x10, 0x84, 0x00, 0x00, 
-  0x10, 0x84, 0x28, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0x2d, 0x6b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2d, 0x6b, 0x08, 0x42, 0x04, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xa7, 0x39, 0x10, 0x84, 
-  0x49, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xa6, 0x39, 0x6a, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0xec, 0x62, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x6a, 0x52, 0x49, 0x52, 0xc7, 0x39, 0x69, 0x4a, 0xeb, 0x5a, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6e, 0x73, 0xa7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x29, 0x4a, 
-  0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe8, 0x41, 0xcf, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x6b, 0x08, 0x42, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0x08, 0x42, 0x2c, 0x63, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x29, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x49, 0x4a, 
-  0x08, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x29, 0x4a, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x6e, 0x73, 0x08, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0x0c, 0x63, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6a, 0x52, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 
-  0x51, 0x8c, 0x49, 0x4a, 0x45, 0x29, 0xcb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xaa, 0x52, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x45, 0x29, 0x6a, 0x52, 0x71, 0x8c, 0x00, 0x00, 0xff, 0xff, 0xcb, 0x5a, 0xa7, 0x39, 0x08, 0x42, 0x71, 0x8c, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xa5, 0x49, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0xc7, 0x39, 0x08, 0x42, 0x66, 0x31, 0x28, 0x42, 0xc7, 0x39, 0x86, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x8f, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x49, 0x52, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0xeb, 0x62, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0xcb, 0x5a, 0x08, 0x42, 0x25, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe8, 0x41, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x7b, 0x04, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0x8b, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2d, 0x6b, 0x29, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x65, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0xcf, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8e, 0x73, 0x6a, 0x52, 0x28, 0x4a, 0x66, 0x31, 0x29, 0x4a, 0x29, 0x4a, 0x6e, 0x73, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x6a, 0x52, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x24, 0x29, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x52, 0x86, 0x31, 0x86, 0x31, 0x08, 0x42, 0x18, 0xc6, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x63, 0xe8, 0x41, 0x04, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xa7, 0x39, 0x8a, 0x52, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x69, 0x4a, 0x65, 0x31, 0x66, 0x31, 0x6a, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x31, 0x8c, 0x29, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x41, 0xcf, 0x7b, 0x00, 0x00, 0xff, 0xff, 0x96, 0xb5, 0xd7, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x7b, 0xa7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x39, 0x45, 0x31, 0xa7, 0x39, 0x66, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x49, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x52, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xc7, 0x41, 0x8e, 0x73, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x49, 0x4a, 0x24, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x73, 0x86, 0x31, 0x04, 0x21, 0x25, 0x29, 0x8a, 0x52, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcb, 0x5a, 0x45, 0x29, 0x04, 0x21, 0x66, 0x31, 0x4e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0xcb, 0x5a, 0x6d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x76, 0xb5, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x7b, 0x8a, 0x52, 0xcf, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x6b, 0xa7, 0x39, 0x04, 0x21, 0xa7, 0x39, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x29, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x73, 0xe8, 0x41, 0x08, 0x42, 0x08, 0x42, 0x2d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x18, 0x52, 0x7f, 0xa1, 0xc0, 0xcc, 0xcc, 0xcd, 0xc7, 0xa4, 0x89, 0x5a, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x7d, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x91, 0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x9e, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x32, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcc, 0xad, 0x9b, 0x9b, 0x9b, 0xaa, 0xca, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x80, 0x02, 0x00, 0x00, 
-  0x00, 0x04, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x78, 0x2f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x71, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x0e, 0x00, 
-  0x0a, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 
-  0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x4f, 0x02, 0x00, 0x00, 0x01, 0x08, 0x41, 0x6f, 0x99, 0xa8, 0xb8, 0xae, 0x99, 0x74, 0x44, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x49, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 
-  0xd3, 0xff, 0xff, 0xff, 0xff, 0xae, 0x11, 0x00, 0x00, 0x01, 0x44, 0xac, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xab, 0x43, 0x02, 0x00, 0x00, 0x0f, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xe5, 
-  0xa7, 0xff, 0xff, 0xff, 0x99, 0x02, 0x00, 0x01, 0x32, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x35, 0x00, 0x00, 0x01, 0x97, 0xff, 0xff, 0xff, 0xb7, 
-  0x0d, 0x83, 0x9c, 0x5c, 0x00, 0x00, 0x02, 0x7b, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x96, 0x0b, 0x00, 0x01, 0x62, 0xa3, 0x8b, 0x16, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc9, 0xa8, 0x9b, 0xaa, 0xc9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x52, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4d, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x35, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1b, 0xfc, 0xff, 0xff, 0xff, 0xbe, 0x17, 0x00, 0x00, 0x01, 0x25, 0x6d, 0x96, 0x9c, 0x9a, 0x72, 0x3a, 0x02, 0x00, 0x00, 0x05, 0x86, 0xff, 0xff, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xf4, 0xfc, 0x91, 0x04, 0x00, 0x02, 0x53, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x6b, 0x03, 0x00, 0x01, 0x6e, 0xfe, 0xfe, 0x85, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x17, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1e, 0x00, 0x01, 0x10, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xcc, 0xd2, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0xba, 0x34, 0x01, 0x00, 0x00, 0x12, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe3, 0xff, 0xfe, 0x87, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0xf8, 0xff, 0xf3, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5e, 0x34, 0x00, 0x00, 0x00, 0x02, 0x22, 0x03, 0x01, 0x00, 0x00, 0x27, 0x62, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe0, 0xff, 0xe3, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0xff, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xb5, 0xf3, 0xb8, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x05, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x8f, 0xb6, 0xb5, 0x10, 0x84, 0xaa, 0x52, 0x28, 0x4a, 0xc7, 0x39, 0x28, 0x4a, 0x65, 0x31, 0x04, 0x21,
+  0x45, 0x29, 0x29, 0x4a, 0xa7, 0x39, 0x49, 0x4a, 0x69, 0x52, 0x8e, 0x73, 0xb6, 0xb5, 0x11, 0x00, 0x00, 0x85, 0x38, 0xb6, 0x2d, 0x6b, 0x28, 0x4a, 0xe7, 0x41, 0x04, 0x21, 0x0c, 0xe4, 0x20, 0x84,
+  0xa6, 0x39, 0x28, 0x42, 0x2c, 0x63, 0xf7, 0xb5, 0x0d, 0x00, 0x00, 0x83, 0x4d, 0x6b, 0x08, 0x42, 0x45, 0x29, 0x12, 0xe4, 0x20, 0x83, 0xc7, 0x39, 0xcb, 0x5a, 0xb6, 0xb5, 0x09, 0x00, 0x00, 0x83,
+  0xae, 0x7b, 0x08, 0x42, 0x45, 0x29, 0x16, 0xe4, 0x20, 0x83, 0xe8, 0x41, 0x2c, 0x63, 0xb6, 0xb5, 0x06, 0x00, 0x00, 0x82, 0xaa, 0x52, 0x86, 0x31, 0x08, 0xe4, 0x20, 0x89, 0xa6, 0x31, 0xa6, 0x39,
+  0x08, 0x42, 0x45, 0x29, 0x86, 0x31, 0x45, 0x29, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x39, 0x08, 0xe4, 0x20, 0x83, 0x45, 0x29, 0x69, 0x4a, 0xd7, 0xbd, 0x03, 0x00, 0x00, 0x83, 0x76, 0xb5, 0x49, 0x4a,
+  0x04, 0x21, 0x06, 0xe4, 0x20, 0x84, 0xe7, 0x39, 0x49, 0x4a, 0x6d, 0x6b, 0xb6, 0xb5, 0x07, 0x00, 0x00, 0x85, 0xb6, 0xb5, 0x8e, 0x73, 0x49, 0x4a, 0xc7, 0x39, 0x04, 0x21, 0x06, 0xe4, 0x20, 0x85,
+  0x08, 0x42, 0x8e, 0x73, 0x00, 0x00, 0xcf, 0x7b, 0x08, 0x42, 0x06, 0xe4, 0x20, 0x83, 0x08, 0x42, 0x2c, 0x63, 0x37, 0xb6, 0x04, 0x00, 0x00, 0x82, 0xb9, 0xdd, 0xbb, 0xed, 0x02, 0x00, 0x00, 0x81,
+  0xbc, 0xfd, 0x04, 0x00, 0x00, 0x84, 0xb6, 0xb5, 0x0c, 0x63, 0x08, 0x42, 0x04, 0x21, 0x05, 0xe4, 0x20, 0x83, 0xa6, 0x31, 0xef, 0x7b, 0x49, 0x4a, 0x05, 0xe4, 0x20, 0x83, 0x86, 0x31, 0x69, 0x4a,
+  0xb6, 0xb5, 0x02, 0x00, 0x00, 0x84, 0xb6, 0xb5, 0x34, 0xa5, 0xcb, 0x5a, 0x28, 0x42, 0x02, 0x08, 0x42, 0x86, 0x69, 0x4a, 0x49, 0x4a, 0xa6, 0x39, 0x49, 0x4a, 0xab, 0x5a, 0x55, 0xad, 0x03, 0x00,
+  0x00, 0x83, 0xb6, 0xb5, 0x6d, 0x6b, 0xa6, 0x31, 0x05, 0xe4, 0x20, 0x82, 0x08, 0x42, 0x86, 0x31, 0x04, 0xe4, 0x20, 0x82, 0xe7, 0x39, 0x6d, 0x6b, 0x02, 0x00, 0x00, 0x84, 0x9a, 0xce, 0x0c, 0x63,
+  0xe7, 0x41, 0x66, 0x31, 0x09, 0xe4, 0x20, 0x84, 0x86, 0x31, 0xe8, 0x41, 0x0c, 0x63, 0xb6, 0xb5, 0x02, 0x00, 0x00, 0x82, 0x92, 0x94, 0x28, 0x42, 0x04, 0xe4, 0x20, 0x82, 0x28, 0x4a, 0x08, 0x42,
+  0x03, 0xe4, 0x20, 0x86, 0x08, 0x42, 0xd7, 0xc5, 0x00, 0x00, 0x58, 0xb6, 0x4d, 0x6b, 0x08, 0x42, 0x0f, 0xe4, 0x20, 0x82, 0x08, 0x42, 0xeb, 0x5a, 0x02, 0x00, 0x00, 0x82, 0xb6, 0xb5, 0x69, 0x4a,
+  0x03, 0xe4, 0x20, 0x85, 0x08, 0x42, 0xae, 0x73, 0x28, 0x42, 0x45, 0x29, 0xaa, 0x5a, 0x02, 0x00, 0x00, 0x83, 0xd7, 0xbd, 0x8a, 0x52, 0x45, 0x29, 0x11, 0xe4, 0x20, 0x89, 0x25, 0x29, 0x49, 0x4a,
+  0xcf, 0x7b, 0x00, 0x00, 0xd7, 0xc5, 0xaa, 0x5a, 0xa6, 0x31, 0xe8, 0x41, 0x10, 0x84, 0x05, 0x00, 0x00, 0x82, 0xf3, 0x9c, 0x28, 0x42, 0x07, 0xe4, 0x20, 0x87, 0x66, 0x31, 0xc7, 0x39, 0xe8, 0x41,
+  0x65, 0x29, 0x08, 0x42, 0xa7, 0x39, 0x86, 0x31, 0x07, 0xe4, 0x20, 0x82, 0xc7, 0x39, 0x8e, 0x73, 0x09, 0x00, 0x00, 0x82, 0x98, 0xb6, 0x49, 0x4a, 0x06, 0xe4, 0x20, 0x83, 0xe8, 0x41, 0xcb, 0x5a,
+  0xd3, 0x9c, 0x05, 0x00, 0x00, 0x84, 0xf3, 0x9c, 0xcb, 0x5a, 0xe7, 0x41, 0x24, 0x29, 0x05, 0xe4, 0x20, 0x82, 0xe7, 0x39, 0xd7, 0xbd, 0x08, 0x00, 0x00, 0x82, 0x8e, 0x73, 0x04, 0x21, 0x04, 0xe4,
+  0x20, 0x83, 0x86, 0x31, 0x8a, 0x52, 0xf7, 0xb5, 0x09, 0x00, 0x00, 0x83, 0x17, 0xb6, 0x0c, 0x63, 0x08, 0x42, 0x05, 0xe4, 0x20, 0x81, 0x2c, 0x63, 0x08, 0x00, 0x00, 0x82, 0xef, 0x7b, 0x45, 0x29,
+  0x03, 0xe4, 0x20, 0x82, 0xe7, 0x41, 0xcf, 0x7b, 0x02, 0x00, 0x00, 0x85, 0x18, 0xbe, 0x6d, 0x6b, 0x69, 0x4a, 0x28, 0x42, 0x65, 0x29, 0x02, 0x28, 0x42, 0x82, 0x4d, 0x6b, 0xf7, 0xbd, 0x02, 0x00,
+  0x00, 0x83, 0x96, 0xb5, 0x49, 0x4a, 0x24, 0x29, 0x02, 0xe4, 0x20, 0x82, 0x04, 0x21, 0x4d, 0x6b, 0x09, 0x00, 0x00, 0x81, 0x49, 0x4a, 0x02, 0x86, 0x31, 0x87, 0xe8, 0x41, 0x34, 0xad, 0x00, 0x00,
+  0xb6, 0xb5, 0xeb, 0x62, 0xe7, 0x39, 0x04, 0x21, 0x06, 0xe4, 0x20, 0x86, 0x86, 0x31, 0x6a, 0x52, 0x96, 0xb5, 0x00, 0x00, 0xb6, 0xb5, 0x49, 0x4a, 0x02, 0x45, 0x29, 0x82, 0x69, 0x4a, 0x78, 0xb6,
+  0x0a, 0x00, 0x00, 0x02, 0xf8, 0xcd, 0x84, 0xb6, 0xb5, 0x00, 0x00, 0xcf, 0x7b, 0x28, 0x42, 0x0b, 0xe4, 0x20, 0x86, 0xc7, 0x39, 0xae, 0x73, 0x00, 0x00, 0xb6, 0xb5, 0x75, 0xad, 0xb6, 0xbd, 0x0f,
+  0x00, 0x00, 0x82, 0x4d, 0x6b, 0xa6, 0x39, 0x0d, 0xe4, 0x20, 0x82, 0xa7, 0x39, 0xcf, 0x7b, 0x12, 0x00, 0x00, 0x81, 0xaa, 0x52, 0x06, 0xe4, 0x20, 0x84, 0xa7, 0x39, 0x45, 0x29, 0x86, 0x31, 0x45,
+  0x29, 0x05, 0xe4, 0x20, 0x81, 0x49, 0x4a, 0x12, 0x00, 0x00, 0x81, 0x49, 0x4a, 0x04, 0xe4, 0x20, 0x83, 0xc7, 0x39, 0x6d, 0x6b, 0xd7, 0xbd, 0x02, 0x00, 0x00, 0x83, 0xef, 0x7b, 0x29, 0x4a, 0x04,
+  0x21, 0x03, 0xe4, 0x20, 0x81, 0x08, 0x42, 0x12, 0x00, 0x00, 0x86, 0x2c, 0x6b, 0x65, 0x31, 0xe4, 0x20, 0x24, 0x29, 0x69, 0x4a, 0xf7, 0xbd, 0x05, 0x00, 0x00, 0x86, 0xb6, 0xb5, 0xaa, 0x5a, 0x45,
+  0x29, 0xe4, 0x20, 0x65, 0x31, 0x4d, 0x6b, 0x13, 0x00, 0x00, 0x83, 0x8e, 0x73, 0xaa, 0x5a, 0x2d, 0x6b, 0x03, 0x00, 0x00, 0x84, 0xf8, 0xcd, 0x55, 0xad, 0xf7, 0xb5, 0xb6, 0xb5, 0x02, 0x00, 0x00,
+  0x83, 0x8e, 0x73, 0x69, 0x52, 0x8e, 0x73, 0x19, 0x00, 0x00, 0x85, 0x0c, 0x63, 0xa6, 0x31, 0xe4, 0x20, 0xa6, 0x31, 0x4d, 0x6b, 0x1e, 0x00, 0x00, 0x81, 0xc7, 0x39, 0x03, 0xe4, 0x20, 0x81, 0xe7,
+  0x39, 0x1e, 0x00, 0x00, 0x81, 0x45, 0x29, 0x03, 0xe4, 0x20, 0x82, 0x04, 0x21, 0x9a, 0xd6, 0x1d, 0x00, 0x00, 0x81, 0x28, 0x4a, 0x03, 0xe4, 0x20, 0x81, 0x08, 0x42, 0x1e, 0x00, 0x00, 0x81, 0x6d,
+  0x73, 0x03, 0xe7, 0x41, 0x81, 0xec, 0x62, 0x14, 0x00, 0x00, 0x88, 0x02, 0x18, 0x52, 0x7f, 0xa1, 0xc0, 0xcc, 0xcc, 0xcd, 0xc7, 0xa4, 0x89, 0x5a, 0x23, 0x02, 0x00, 0x08, 0x00, 0x00, 0x82, 0x01,
+  0x1b, 0x7d, 0xcf, 0x06, 0xff, 0xff, 0x83, 0xff, 0xdf, 0x91, 0x34, 0x01, 0x00, 0x06, 0x00, 0x00, 0x82, 0x30, 0xaa, 0xfd, 0xff, 0x08, 0xff, 0xff, 0x82, 0xff, 0xc9, 0x52, 0x02, 0x04, 0x00, 0x00,
+  0x82, 0x00, 0x14, 0x9e, 0xfe, 0x0b, 0xff, 0xff, 0x82, 0xc9, 0x32, 0x01, 0x00, 0x02, 0x00, 0x00, 0x82, 0x00, 0x4f, 0xeb, 0xff, 0x03, 0xff, 0xff, 0x85, 0xff, 0xf3, 0xcc, 0xad, 0x9b, 0x9b, 0x9b,
+  0xaa, 0xca, 0xf2, 0x04, 0xff, 0xff, 0x84, 0xfb, 0x80, 0x02, 0x00, 0x00, 0x00, 0x04, 0x8d, 0x03, 0xff, 0xff, 0x83, 0xff, 0xd2, 0x78, 0x2f, 0x02, 0x00, 0x03, 0x00, 0x00, 0x82, 0x02, 0x2b, 0x71,
+  0xc8, 0x03, 0xff, 0xff, 0x83, 0xff, 0xb7, 0x0e, 0x00, 0x0a, 0xbd, 0x03, 0xff, 0xff, 0x86, 0xbe, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x82, 0x01,
+  0x35, 0xb2, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xcc, 0x10, 0x96, 0x02, 0xff, 0xff, 0x8c, 0xff, 0xe5, 0x4f, 0x02, 0x00, 0x00, 0x01, 0x08, 0x41, 0x6f, 0x99, 0xa8, 0xb8, 0xae, 0x99, 0x74, 0x44,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x49, 0xdd, 0x02, 0xff, 0xff, 0x88, 0xff, 0x9d, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xae, 0x11, 0x00, 0x00, 0x01, 0x44, 0xac, 0xf6, 0xff, 0x04, 0xff, 0xff, 0x84, 0xf7,
+  0xab, 0x43, 0x02, 0x00, 0x00, 0x0f, 0xa3, 0x02, 0xff, 0xff, 0x86, 0xe5, 0xa7, 0xff, 0xff, 0xff, 0x99, 0x02, 0x00, 0x01, 0x32, 0xc3, 0xff, 0x07, 0xff, 0xff, 0x8a, 0xc6, 0x35, 0x00, 0x00, 0x01,
+  0x97, 0xff, 0xff, 0xff, 0xb7, 0x0d, 0x83, 0x9c, 0x5c, 0x00, 0x00, 0x02, 0x7b, 0xfa, 0xff, 0x08, 0xff, 0xff, 0x85, 0xfe, 0x96, 0x0b, 0x00, 0x01, 0x62, 0xa3, 0x8b, 0x16, 0x00, 0x02, 0x00, 0x00,
+  0x81, 0x0b, 0xb2, 0x03, 0xff, 0xff, 0x84, 0xff, 0xf7, 0xc9, 0xa8, 0x9b, 0xaa, 0xc9, 0xf8, 0x03, 0xff, 0xff, 0x82, 0xff, 0xd2, 0x1b, 0x00, 0x04, 0x00, 0x00, 0x81, 0x01, 0xa7, 0x03, 0xff, 0xff,
+  0x82, 0xc0, 0x52, 0x06, 0x00, 0x02, 0x00, 0x00, 0x82, 0x06, 0x4d, 0xb3, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xc5, 0x02, 0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0x23, 0x02, 0xff, 0xff, 0x82, 0xff,
+  0xe6, 0x4e, 0x01, 0x04, 0x00, 0x00, 0x82, 0x00, 0x02, 0x35, 0xce, 0x02, 0xff, 0xff, 0x81, 0xff, 0x2c, 0x04, 0x00, 0x00, 0x8b, 0x1b, 0xfc, 0xff, 0xff, 0xff, 0xbe, 0x17, 0x00, 0x00, 0x01, 0x25,
+  0x6d, 0x96, 0x9c, 0x9a, 0x72, 0x3a, 0x02, 0x00, 0x00, 0x05, 0x86, 0x02, 0xff, 0xff, 0x81, 0x21, 0x00, 0x04, 0x00, 0x00, 0x85, 0x65, 0xf4, 0xfc, 0x91, 0x04, 0x00, 0x02, 0x53, 0xc8, 0xff, 0x03,
+  0xff, 0xff, 0x85, 0xdf, 0x6b, 0x03, 0x00, 0x01, 0x6e, 0xfe, 0xfe, 0x85, 0x01, 0x05, 0x00, 0x00, 0x83, 0x02, 0x03, 0x01, 0x00, 0x17, 0xbb, 0x05, 0xff, 0xff, 0x84, 0xff, 0xc6, 0x1e, 0x00, 0x01,
+  0x10, 0x0b, 0x00, 0x07, 0x00, 0x00, 0x81, 0x0d, 0xd6, 0x06, 0xff, 0xff, 0x82, 0xff, 0xde, 0x11, 0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x79, 0x03, 0xff, 0xff, 0x82, 0xe9, 0xcc, 0xd2, 0xfb, 0x02,
+  0xff, 0xff, 0x81, 0xff, 0x7d, 0x09, 0x00, 0x00, 0x86, 0x86, 0xff, 0xff, 0xff, 0xff, 0xba, 0x34, 0x01, 0x00, 0x00, 0x12, 0x8e, 0x02, 0xff, 0xff, 0x81, 0x8f, 0x00, 0x08, 0x00, 0x00, 0x84, 0x00,
+  0x1c, 0xe3, 0xff, 0xfe, 0x87, 0x03, 0x00, 0x02, 0x00, 0x00, 0x83, 0x01, 0x62, 0xf8, 0xff, 0xf3, 0x2e, 0x09, 0x00, 0x00, 0x88, 0x00, 0x11, 0x5e, 0x34, 0x00, 0x00, 0x00, 0x02, 0x22, 0x03, 0x01,
+  0x00, 0x00, 0x27, 0x62, 0x1e, 0x0c, 0x00, 0x00, 0x83, 0x00, 0x35, 0xe0, 0xff, 0xe3, 0x3d, 0x0f, 0x00, 0x00, 0x83, 0xd5, 0xff, 0xff, 0xff, 0xdc, 0x00, 0x0e, 0x00, 0x00, 0x81, 0x00, 0xfe, 0x02,
+  0xff, 0xff, 0x81, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x83, 0xc3, 0xff, 0xff, 0xff, 0xc9, 0x00, 0x0e, 0x00, 0x00, 0x83, 0x00, 0x1f, 0xb5, 0xf3, 0xb8, 0x21, 0x08, 0x00, 0x00,
 };
 
 const lv_image_dsc_t img_wifi_signal_max = {
   .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
   .header.w = 35,
   .header.h = 27,
-  .data_size = 945 * 3,
+  .header.stride = 70,
+  .data_size = sizeof(img_wifi_signal_max_map),
   .data = img_wifi_signal_max_map,
 };
@@ -0,0 +1,260 @@
+#include <string.h>
+#include "lvgl.h"
+#include "src/display/lv_display_private.h"
+#include "src/draw/lv_draw_buf_private.h"
+#include "monitor.h"
+#include "view.h"
+#include "services/timestamp.h"
+#include "services/event_log.h"
+
+#if LV_USE_STDLIB_MALLOC != LV_STDLIB_BUILTIN
+#ifdef BUILD_CONFIG_SIMULATOR
+#include <malloc.h>
+#else
+#include "esp_heap_caps.h"
+#endif
+#endif
+
+
+#define SAMPLE_PERIOD_MS     500
+#define MAX_TRACKED_BUFFERS  32
+#define PEAK(Peak, Value)    (Peak) = LV_MAX((Peak), (Value))
+#define NO_PAGE              -1
+
+
+static void                  take_sample(void);
+static void                  finish_visit(void);
+static int                   find_page(const pman_page_t *page);
+static void                  get_heap_usage(uint32_t *used, uint32_t *total);
+static uint32_t              count_objects(lv_obj_t *obj);
+static void                 *draw_buf_malloc(size_t size, lv_color_format_t color_format);
+static void                  draw_buf_free(void *buffer);
+static view_monitor_sample_t sample_peak(view_monitor_sample_t peak, view_monitor_sample_t sample);
+
+
+// The index in this table identifies the page in the event log, append new pages at the end
+static const pman_page_t *const pages[] = {
+    &page_home,   &page_info,      &page_settings,   &page_config, &page_program,
+    &page_choice, &page_execution, &page_statistics,
+};
+
+static const char *const page_names[] = {
+    "Home", "Info", "Diagnosi", "Configurazione", "Programma", "Scelta", "Esecuzione", "Statistiche",
+};
+
+_Static_assert(sizeof(pages) / sizeof(pages[0]) == sizeof(page_names) / sizeof(page_names[0]),
+               "Every monitored page needs a name");
+
+
+static struct {
+    view_monitor_page_stats_t pages[sizeof(pages) / sizeof(pages[0])];
+    int                       current_page;
+    view_monitor_sample_t     current;
+    view_monitor_sample_t     peak;
+    view_monitor_sample_t     visit_peak;
+    timestamp_t               last_sample_ts;
+
+    struct {
+        lv_draw_buf_malloc_cb malloc_cb;
+        lv_draw_buf_free_cb   free_cb;
+        // Draw units allocate from their own threads, the global LVGL lock is held by the renderer waiting for them
+        lv_mutex_t            lock;
+        struct {
+            void  *buffer;
+            size_t size;
+        } tracked[MAX_TRACKED_BUFFERS];
+        uint32_t used;
+        uint32_t peak;
+    } draw_buf;
+} state = {0};
+
+
+void view_monitor_init(void) {
+    for (size_t i = 0; i < sizeof(pages) / sizeof(pages[0]); i++) {
+        state.pages[i].name = page_names[i];
+    }
+    state.current_page = NO_PAGE;
+
+    // Hook the default draw buffer allocator to account the buffers of layers
+    lv_mutex_init(&state.draw_buf.lock);
+    lv_draw_buf_handlers_t *handlers = lv_draw_buf_get_handlers();
+    state.draw_buf.malloc_cb         = handlers->buf_malloc_cb;
+    state.draw_buf.free_cb           = handlers->buf_free_cb;
+    handlers->buf_malloc_cb          = draw_buf_malloc;
+    handlers->buf_free_cb            = draw_buf_free;
+}
+
+
+void view_monitor_manage(const pman_page_t *page) {
+    int page_index = find_page(page);
+
+    if (page_index != state.current_page) {
+        finish_visit();
+
+        state.current_page = page_index;
+        memset(&state.visit_peak, 0, sizeof(state.visit_peak));
+        if (page_index != NO_PAGE) {
+            state.pages[page_index].visits++;
+        }
+        take_sample();
+    } else if (timestamp_is_expired(state.last_sample_ts, SAMPLE_PERIOD_MS)) {
+        take_sample();
+    }
+}
+
+
+view_monitor_sample_t view_monitor_get_current(void) {
+    return state.current;
+}
+
+
+view_monitor_sample_t view_monitor_get_peak(void) {
+    return state.peak;
+}
+
+
+size_t view_monitor_get_num_pages(void) {
+    return sizeof(pages) / sizeof(pages[0]);
+}
+
+
+const view_monitor_page_stats_t *view_monitor_get_page(size_t index) {
+    if (index < view_monitor_get_num_pages()) {
+        return &state.pages[index];
+    } else {
+        return NULL;
+    }
+}
+
+
+static void take_sample(void) {
+    view_monitor_sample_t sample = {0};
+
+    get_heap_usage(&sample.heap_used, &sample.heap_total);
+
+    // Every screen is counted, including the ones retained by the page manager and the layers
+    lv_display_t *display = lv_display_get_default();
+    for (uint32_t i = 0; display != NULL && i < display->screen_cnt; i++) {
+        sample.objects += count_objects(display->screens[i]);
+    }
+
+    for (lv_timer_t *timer = lv_timer_get_next(NULL); timer != NULL; timer = lv_timer_get_next(timer)) {
+        sample.timers++;
+    }
+
+    lv_mutex_lock(&state.draw_buf.lock);
+    sample.draw_buffers = state.draw_buf.peak;
+    state.draw_buf.peak = state.draw_buf.used;
+    lv_mutex_unlock(&state.draw_buf.lock);
+
+    state.current    = sample;
+    state.peak       = sample_peak(state.peak, sample);
+    state.visit_peak = sample_peak(state.visit_peak, sample);
+    if (state.current_page != NO_PAGE) {
+        state.pages[state.current_page].peak = sample_peak(state.pages[state.current_page].peak, sample);
+    }
+
+    state.last_sample_ts = timestamp_get();
+}
+
+
+static void finish_visit(void) {
+    if (state.current_page != NO_PAGE) {
+        EVENT_LOG(VIEW_PAGE_RESOURCES, state.current_page, state.visit_peak.heap_used, state.visit_peak.objects,
+                  state.visit_peak.timers, state.visit_peak.draw_buffers);
+    }
+}
+
+
+static int find_page(const pman_page_t *page) {
+    if (page == NULL) {
+        return NO_PAGE;
+    }
+
+    // The page manager works on copies, pages are recognized by their event handler
+    for (size_t i = 0; i < sizeof(pages) / sizeof(pages[0]); i++) {
+        if (pages[i]->process_event == page->process_event) {
+            return (int)i;
+        }
+    }
+
+    return NO_PAGE;
+}
+
+
+static void get_heap_usage(uint32_t *used, uint32_t *total) {
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_monitor_t monitor = {0};
+    lv_mem_monitor(&monitor);
+    *total = monitor.total_size;
+    *used  = monitor.total_size - monitor.free_size;
+#elif defined(BUILD_CONFIG_SIMULATOR)
+    // LVGL allocates from the process heap
+    struct mallinfo2 info = mallinfo2();
+    *total                = info.arena;
+    *used                 = info.uordblks;
+#else
+    // LVGL allocates from the system heap
+    *total = heap_caps_get_total_size(MALLOC_CAP_8BIT);
+    *used  = *total - heap_caps_get_free_size(MALLOC_CAP_8BIT);
+#endif
+}
+
+
+static uint32_t count_objects(lv_obj_t *obj) {
+    uint32_t count = 1;
+
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        count += count_objects(lv_obj_get_child(obj, i));
+    }
+
+    return count;
+}
+
+
+static void *draw_buf_malloc(size_t size, lv_color_format_t color_format) {
+    void *buffer = state.draw_buf.malloc_cb(size, color_format);
+
+    if (buffer != NULL) {
+        lv_mutex_lock(&state.draw_buf.lock);
+        for (size_t i = 0; i < MAX_TRACKED_BUFFERS; i++) {
+            if (state.draw_buf.tracked[i].buffer == NULL) {
+                state.draw_buf.tracked[i].buffer = buffer;
+                state.draw_buf.tracked[i].size   = size;
+                state.draw_buf.used += size;
+                PEAK(state.draw_buf.peak, state.draw_buf.used);
+                break;
+            }
+        }
+        lv_mutex_unlock(&state.draw_buf.lock);
+    }
+
+    return buffer;
+}
+
+
+static void draw_buf_free(void *buffer) {
+    // Buffers allocated before the hook was installed (or when the table was full) are simply not tracked
+    lv_mutex_lock(&state.draw_buf.lock);
+    for (size_t i = 0; i < MAX_TRACKED_BUFFERS; i++) {
+        if (state.draw_buf.tracked[i].buffer == buffer) {
+            state.draw_buf.used -= state.draw_buf.tracked[i].size;
+            state.draw_buf.tracked[i].buffer = NULL;
+            state.draw_buf.tracked[i].size   = 0;
+            break;
+        }
+    }
+    lv_mutex_unlock(&state.draw_buf.lock);
+
+    state.draw_buf.free_cb(buffer);
+}
+
+
+static view_monitor_sample_t sample_peak(view_monitor_sample_t peak, view_monitor_sample_t sample) {
+    PEAK(peak.heap_used, sample.heap_used);
+    PEAK(peak.heap_total, sample.heap_total);
+    PEAK(peak.objects, sample.objects);
+    PEAK(peak.timers, sample.timers);
+    PEAK(peak.draw_buffers, sample.draw_buffers);
+    return peak;
+}
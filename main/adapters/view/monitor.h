@@ -0,0 +1,40 @@
+#ifndef VIEW_MONITOR_H_INCLUDED
+#define VIEW_MONITOR_H_INCLUDED
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "page_manager.h"
+
+
+/*
+ * Samples the resources used by LVGL (heap, live objects, timers and draw buffers) and keeps their high-water marks,
+ * both overall and for every page. The peaks of each page visit are also written to the event log.
+ */
+
+
+typedef struct {
+    uint32_t heap_used;
+    uint32_t heap_total;
+    uint32_t objects;
+    uint32_t timers;
+    // Peak of the draw buffers allocated for layers since the previous sample
+    uint32_t draw_buffers;
+} view_monitor_sample_t;
+
+typedef struct {
+    const char           *name;
+    uint32_t              visits;
+    view_monitor_sample_t peak;
+} view_monitor_page_stats_t;
+
+
+void                             view_monitor_init(void);
+void                             view_monitor_manage(const pman_page_t *page);
+view_monitor_sample_t            view_monitor_get_current(void);
+view_monitor_sample_t            view_monitor_get_peak(void);
+size_t                           view_monitor_get_num_pages(void);
+const view_monitor_page_stats_t *view_monitor_get_page(size_t index);
+
+
+#endif
@@ -6,6 +6,7 @@
 #include "src/page.h"
 #include "../style.h"
 #include <assert.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 #include "../common.h"
@@ -16,7 +17,10 @@ enum {
     BTN_PROGRAM_ID,
 };
 
-struct page_data {};
+struct page_data {
+    // Double front machines pick a program for each board, the carousel one for each form, one after the other
+    uint16_t choice;
+};
 
 static void update_page(model_t *model, struct page_data *pdata);
 
@@ -26,6 +30,7 @@ static void *create_page(pman_handle_t handle, void *extra) {
 
     struct page_data *pdata = lv_malloc(sizeof(struct page_data));
     assert(pdata != NULL);
+    pdata->choice = 0;
 
     return pdata;
 }
@@ -35,7 +40,14 @@ static void open_page(pman_handle_t handle, void *state) {
 
     model_t *model = view_get_model(handle);
 
-    view_common_title_create(lv_screen_active(), BTN_BACK_ID, "Selezionare programma");
+    if (model_get_num_program_choices(model) > 1) {
+        char title[64] = {0};
+        snprintf(title, sizeof(title), "Selezionare programma %s %i", model_is_carousel(model) ? "forma" : "fronte",
+                 pdata->choice + 1);
+        view_common_title_create(lv_screen_active(), BTN_BACK_ID, title);
+    } else {
+        view_common_title_create(lv_screen_active(), BTN_BACK_ID, "Selezionare programma");
+    }
 
     lv_obj_t *cont = lv_obj_create(lv_screen_active());
     lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
@@ -66,10 +78,8 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
     pman_msg_t msg = PMAN_MSG_NULL;
 
     struct page_data *pdata = state;
-    (void)pdata;
 
     mut_model_t *model = view_get_model(handle);
-    (void)model;
 
     switch (event.tag) {
         case PMAN_EVENT_TAG_USER: {
@@ -84,18 +94,32 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         }
 
         case PMAN_EVENT_TAG_LVGL: {
-            lv_obj_t *target = lv_event_get_current_target_obj(event.as.lvgl);
+            lv_obj_t *target = pman_event_get_target_obj(event);
 
             switch (lv_event_get_code(event.as.lvgl)) {
                 case LV_EVENT_CLICKED: {
                     switch (view_get_obj_id(target)) {
                         case BTN_BACK_ID:
-                            msg.stack_msg = PMAN_STACK_MSG_BACK();
+                            if (pdata->choice > 0) {
+                                // Back to the previous program
+                                pdata->choice--;
+                                lv_obj_clean(lv_screen_active());
+                                open_page(handle, pdata);
+                            } else {
+                                msg.stack_msg = PMAN_STACK_MSG_BACK();
+                            }
                             break;
 
                         case BTN_PROGRAM_ID:
-                            model_set_current_program(model, view_get_obj_number(target));
-                            msg.stack_msg = PMAN_STACK_MSG_PUSH_PAGE(&page_execution);
+                            model_set_program_choice(model, pdata->choice, view_get_obj_number(target));
+                            if (pdata->choice + 1 < model_get_num_program_choices(model)) {
+                                pdata->choice++;
+                                lv_obj_clean(lv_screen_active());
+                                open_page(handle, pdata);
+                            } else {
+                                pdata->choice = 0;
+                                msg.stack_msg = PMAN_STACK_MSG_PUSH_PAGE(&page_execution);
+                            }
                             break;
 
                         default:
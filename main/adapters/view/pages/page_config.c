@@ -24,6 +24,7 @@ enum {
     BTN_DELETE_ID,
     BTN_EXPORT_ID,
     DD_MACHINE_MODEL,
+    DD_MACHINE_MODE,
     SLIDER_POSITION_SCALE,
     KEYBOARD_ID,
 };
@@ -38,6 +39,7 @@ struct page_data {
     lv_obj_t *label_position_scale;
 
     lv_obj_t *dropdown_machine_model;
+    lv_obj_t *dropdown_machine_mode;
 
     lv_obj_t *slider_position_scale;
 
@@ -344,17 +346,26 @@ static void open_page(pman_handle_t handle, void *state) {
 
             lv_obj_t *label = lv_label_create(cont_machine);
             lv_obj_set_style_text_font(label, STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
-            lv_label_set_text(label, "Modello Macchina");
+            lv_label_set_text(label, "Modello e Modo Macchina");
             lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
 
             lv_obj_t *dropdown = lv_dropdown_create(cont_machine);
             lv_obj_set_style_text_font(dropdown, STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
             lv_obj_set_style_text_font(lv_dropdown_get_list(dropdown), STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
-            lv_obj_set_size(dropdown, 280, 40);
+            lv_obj_set_size(dropdown, 200, 40);
             lv_dropdown_set_options(dropdown, "Tradizionale\nDoppio Davanti");
-            lv_obj_align(dropdown, LV_ALIGN_BOTTOM_MID, 0, 0);
+            lv_obj_align(dropdown, LV_ALIGN_BOTTOM_LEFT, 0, 0);
             view_register_object_default_callback(dropdown, DD_MACHINE_MODEL);
             pdata->dropdown_machine_model = dropdown;
+
+            dropdown = lv_dropdown_create(cont_machine);
+            lv_obj_set_style_text_font(dropdown, STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
+            lv_obj_set_style_text_font(lv_dropdown_get_list(dropdown), STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
+            lv_obj_set_size(dropdown, 140, 40);
+            lv_dropdown_set_options(dropdown, "Normale\nCarosello");
+            lv_obj_align(dropdown, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+            view_register_object_default_callback(dropdown, DD_MACHINE_MODE);
+            pdata->dropdown_machine_mode = dropdown;
         }
 
         {     // Communication
@@ -410,10 +421,8 @@ static void open_page(pman_handle_t handle, void *state) {
         pdata->keyboard = keyboard;
     }
 
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.drive_mounted, 0);
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.num_importable_configurations, 0);
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.importable_configurations, 0);
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.minion, 0);
+    view_subscribe(MODEL_TOPIC_BIT(MODEL_TOPIC_DRIVE) | MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_READ) |
+                   MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_COMMUNICATION));
 
     update_page(model, pdata);
 }
@@ -433,7 +442,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
             switch (view_event->tag) {
                 case VIEW_EVENT_TAG_STORAGE_OPERATION_COMPLETED:
                     break;
-                case VIEW_EVENT_TAG_PAGE_WATCHER:
+                case VIEW_EVENT_TAG_MODEL_CHANGED:
                     update_page(model, pdata);
                     break;
                 default:
@@ -443,7 +452,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         }
 
         case PMAN_EVENT_TAG_LVGL: {
-            lv_obj_t *target = lv_event_get_current_target_obj(event.as.lvgl);
+            lv_obj_t *target = pman_event_get_target_obj(event);
 
             switch (lv_event_get_code(event.as.lvgl)) {
                 case LV_EVENT_CLICKED: {
@@ -486,7 +495,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
 
                         case BTN_POSITION_SENSOR_CALIBRATION_ID: {
                             pdata->modified             = 1;
-                            model->config.ma4_20_offset = model->run.minion.read.ma4_20_adc;
+                            model->config.ma4_20_offset = model->run.boards[POSITION_SENSOR_BOARD].read.ma4_20_adc;
                             update_page(model, pdata);
                             break;
                         }
@@ -541,6 +550,13 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             break;
                         }
 
+                        case DD_MACHINE_MODE: {
+                            pdata->modified            = 1;
+                            model->config.machine_mode = lv_dropdown_get_selected(pdata->dropdown_machine_mode);
+                            update_page(model, pdata);
+                            break;
+                        }
+
                         case SLIDER_POSITION_SCALE: {
                             pdata->modified = 1;
                             model->config.position_sensor_scale_mm =
@@ -606,8 +622,11 @@ static void update_page(model_t *model, struct page_data *pdata) {
     lv_label_set_text_fmt(pdata->label_headgap_offset_down, "Sotto: %imm", model->config.headgap_offset_down);
 
     lv_dropdown_set_selected(pdata->dropdown_machine_model, model->config.machine_model);
+    lv_dropdown_set_selected(pdata->dropdown_machine_mode, model->config.machine_mode);
 
-    lv_label_set_text_fmt(pdata->label_position_sensor, "%04i mm\n[%04i mm]", model_get_calibrated_position_mm(model),
+    // Tenths of millimetre help while zeroing the sensor
+    lv_label_set_text_fmt(pdata->label_position_sensor, "%06.1f mm\n[%04i mm]",
+                          ((float)model_get_calibrated_position_mm_q16(model)) / (1 << POSITION_CALIBRATION_SHIFT),
                           model_get_uncalibrated_position_mm(model));
 
     lv_label_set_text_fmt(pdata->label_position_scale, "%03i mm", model->config.position_sensor_scale_mm);
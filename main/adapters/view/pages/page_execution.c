@@ -6,9 +6,12 @@
 #include "src/page.h"
 #include "../style.h"
 #include <assert.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include "../common.h"
+#include "../widgets/schedule_grid.h"
 #include "services/timestamp.h"
 
 
@@ -16,42 +19,53 @@
 #define CHANNEL_ROW_HEIGHT  23
 #define TIME_UNIT_WIDTH     40
 #define LAG_MS              20
+// About 30 fps
+#define TIME_BAR_PERIOD_MS 33
+// Beyond this the estimate is realigned at once instead of being corrected gradually
+#define CLOCK_MAX_ERROR_MS 500
 
 
 enum {
     BTN_BACK_ID,
+    BTN_BOARD_ID,
     OBJ_RIGHT_PANEL_ID,
-    WATCH_MINION_ID,
-    WATCH_MINION_ELAPSED_TIME_ID,
 };
 
-typedef struct {
-    lv_obj_t  *obj;
-    lv_color_t color;
-} channel_schedule_unit_t;
-
 struct page_data {
     lv_obj_t *time_bar;
 
     lv_obj_t *label_position;
+    lv_obj_t *label_carousel;
+
+    lv_obj_t *grid_schedule;
 
-    channel_schedule_unit_t channel_schedules[PROGRAM_NUM_PROGRAMMABLE_CHANNELS][PROGRAM_NUM_TIME_UNITS];
+    // Where the time bar currently is, to move it only when needed
+    int32_t time_bar_x;
 
-    timestamp_t last_minion_update_ts;
+    // Estimate of the elapsed time between minion samples
+    struct {
+        timestamp_t reference_ts;
+        uint32_t    reference_elapsed_ms;
+        // Last sample of the board shown
+        uint32_t sampled_elapsed_ms;
+    } clock;
 
     pman_timer_t *timer;
+
+    // Board whose program is shown; double front machines run both at once
+    uint16_t board;
+
+    // What the schedule was built for
+    program_t program;
+    name_t    channel_names[PROGRAM_NUM_CHANNELS];
 };
 
 
-static void      update_page(model_t *model, struct page_data *pdata);
-static void      configuration_from_digital_channel(uint8_t                           *channel_configuration,
-                                                    program_digital_channel_schedule_t digital_channel_schedule);
-static void      configuration_from_pressure_channel(uint8_t                          *channel_configuration,
-                                                     program_pressure_channel_state_t *pressure_channel_states);
-static void      configuration_from_sensor_channel(uint8_t                            *channel_configuration,
-                                                   program_sensor_channel_threshold_t *pressure_channel_thresholds);
-static lv_obj_t *channel_schedule_create(lv_obj_t *parent, channel_schedule_unit_t channel_schedules[],
-                                         uint8_t *channel_configuration, uint8_t digital);
+static void     update_page(model_t *model, struct page_data *pdata);
+static void     update_time_bar(model_t *model, struct page_data *pdata);
+static void     update_timer(model_t *model, struct page_data *pdata);
+static void     clock_correct(struct page_data *pdata, uint32_t sampled_elapsed_ms);
+static uint32_t clock_get_elapsed_ms(struct page_data *pdata);
 
 
 static void *create_page(pman_handle_t handle, void *extra) {
@@ -60,7 +74,12 @@ static void *create_page(pman_handle_t handle, void *extra) {
 
     struct page_data *pdata = lv_malloc(sizeof(struct page_data));
     assert(pdata != NULL);
-    pdata->timer = PMAN_REGISTER_TIMER_ID(handle, 50, 0);
+    pdata->timer = PMAN_REGISTER_TIMER_ID(handle, TIME_BAR_PERIOD_MS, 0);
+
+    pdata->clock.reference_ts         = timestamp_get();
+    pdata->clock.reference_elapsed_ms = 0;
+    pdata->clock.sampled_elapsed_ms   = 0;
+    pdata->board                      = 0;
 
     return pdata;
 }
@@ -69,8 +88,14 @@ static void *create_page(pman_handle_t handle, void *extra) {
 static void open_page(pman_handle_t handle, void *state) {
     struct page_data *pdata = state;
 
-    model_t         *model   = view_get_model(handle);
-    const program_t *program = model_get_current_program(model);
+    model_t *model = view_get_model(handle);
+    if (pdata->board >= model_get_num_boards(model)) {
+        pdata->board = 0;
+    }
+    const program_t *program = model_get_current_program(model, pdata->board);
+
+    memcpy(&pdata->program, program, sizeof(pdata->program));
+    memcpy(pdata->channel_names, model->config.channel_names, sizeof(pdata->channel_names));
 
     view_common_title_create(lv_screen_active(), BTN_BACK_ID, program->name);
 
@@ -83,6 +108,28 @@ static void open_page(pman_handle_t handle, void *state) {
         pdata->label_position = label;
     }
 
+    if (model_is_carousel(model)) {
+        lv_obj_t *label = lv_label_create(lv_screen_active());
+        lv_obj_set_style_text_font(label, STYLE_FONT_SMALL, LV_STATE_DEFAULT);
+        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, LV_STATE_DEFAULT);
+        lv_obj_set_width(label, 200);
+        lv_obj_align(label, LV_ALIGN_TOP_RIGHT, -208, 0);
+        pdata->label_carousel = label;
+    } else {
+        pdata->label_carousel = NULL;
+    }
+
+    if (model_get_num_boards(model) > 1) {
+        lv_obj_t *button = lv_button_create(lv_screen_active());
+        lv_obj_set_size(button, 120, 48);
+        lv_obj_align(button, LV_ALIGN_TOP_RIGHT, -208, 8);
+        lv_obj_t *label = lv_label_create(button);
+        lv_obj_set_style_text_font(label, STYLE_FONT_SMALL, LV_STATE_DEFAULT);
+        lv_label_set_text_fmt(label, "Fronte %i", pdata->board + 1);
+        lv_obj_center(label);
+        view_register_object_default_callback(button, BTN_BOARD_ID);
+    }
+
     lv_obj_t *bottom_container = lv_obj_create(lv_screen_active());
     lv_obj_set_style_border_width(bottom_container, 0, LV_STATE_DEFAULT);
     lv_obj_set_style_pad_ver(bottom_container, 0, LV_STATE_DEFAULT);
@@ -136,30 +183,19 @@ static void open_page(pman_handle_t handle, void *state) {
     lv_obj_set_flex_flow(right_panel, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_flex_align(right_panel, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
 
-    uint8_t channel_configuration[PROGRAM_NUM_TIME_UNITS] = {0};
-    for (uint16_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
-        // Channel 8 should be the pressure channel
-        if (i == PROGRAM_PRESSURE_CHANNEL_INDEX) {
-            configuration_from_pressure_channel(channel_configuration,
-                                                (program_pressure_channel_state_t *)program->pressure_channel);
-        }
-        // Channel 12 should be the 4-20ma channel
-        else if (i == PROGRAM_SENSOR_CHANNEL_INDEX) {
-            configuration_from_sensor_channel(channel_configuration,
-                                              (program_sensor_channel_threshold_t *)program->sensor_channel);
-        }
-        // Every other is a digital channel
-        else {
-            uint16_t digital_index = i;
-            if (i > PROGRAM_SENSOR_CHANNEL_INDEX) {
-                digital_index -= 1;
-            }
-
-            configuration_from_digital_channel(channel_configuration, program->digital_channels[digital_index]);
-        }
-
-        channel_schedule_create(right_panel, pdata->channel_schedules[i], channel_configuration,
-                                i != PROGRAM_PRESSURE_CHANNEL_INDEX && i != PROGRAM_SENSOR_CHANNEL_INDEX);
+    {
+        const lv_color_t colors[SCHEDULE_GRID_NUM_COLORS] = {STYLE_COLOR_GREEN, STYLE_COLOR_YELLOW, STYLE_COLOR_RED,
+                                                             STYLE_COLOR_BLUE};
+
+        lv_obj_t *grid = schedule_grid_create(right_panel, SCHEDULE_GRID_LOOK_SPANS, TIME_UNIT_WIDTH,
+                                              CHANNEL_ROW_HEIGHT, 0, CHANNEL_ROW_PADDING);
+        lv_obj_set_style_line_color(grid, lv_palette_lighten(LV_PALETTE_GREY, 2), LV_PART_ITEMS);
+        lv_obj_set_style_line_width(grid, 6, LV_PART_ITEMS);
+        lv_obj_set_style_border_width(grid, 4, LV_PART_ITEMS);
+        lv_obj_remove_flag(grid, LV_OBJ_FLAG_CLICKABLE);
+        schedule_grid_set_colors(grid, colors);
+        schedule_grid_set_program(grid, program);
+        pdata->grid_schedule = grid;
     }
 
     view_register_object_default_callback(right_panel, OBJ_RIGHT_PANEL_ID);
@@ -173,10 +209,14 @@ static void open_page(pman_handle_t handle, void *state) {
     lv_obj_set_style_opa(time_bar, LV_OPA_70, LV_STATE_DEFAULT);
     pdata->time_bar = time_bar;
 
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.minion.read, WATCH_MINION_ID);
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.minion.read.elapsed_milliseconds, WATCH_MINION_ELAPSED_TIME_ID);
+    pdata->time_bar_x = -1;
+
+    view_subscribe(MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_READ) | MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_ELAPSED_TIME) |
+                   MODEL_TOPIC_BIT(MODEL_TOPIC_CURRENT_PROGRAM));
 
+    clock_correct(pdata, model->run.boards[pdata->board].read.elapsed_milliseconds);
     update_page(model, pdata);
+    update_time_bar(model, pdata);
 }
 
 static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t event) {
@@ -190,7 +230,8 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
 
     switch (event.tag) {
         case PMAN_EVENT_TAG_TIMER: {
-            update_page(model, pdata);
+            // Runs every frame, only moves the bar
+            update_time_bar(model, pdata);
             break;
         }
 
@@ -200,25 +241,29 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                 case VIEW_EVENT_TAG_STORAGE_OPERATION_COMPLETED:
                     break;
 
-                case VIEW_EVENT_TAG_PAGE_WATCHER: {
-                    switch (view_event->as.page_watcher.code) {
-                        case WATCH_MINION_ID: {
-                            if (model->run.minion.read.running) {
-                                pdata->last_minion_update_ts = timestamp_get();
-                                pman_timer_resume(pdata->timer);
-                            } else {
-                                pman_timer_pause(pdata->timer);
-                                pman_timer_reset(pdata->timer);
-                            }
+                case VIEW_EVENT_TAG_MODEL_CHANGED: {
+                    model_topics_t topics = view_event->as.model_changed.topics;
+
+                    // The carousel moved to the other form
+                    if ((topics & MODEL_TOPIC_BIT(MODEL_TOPIC_CURRENT_PROGRAM)) &&
+                        memcmp(&pdata->program, model_get_current_program(model, pdata->board),
+                               sizeof(pdata->program)) != 0) {
+                        lv_obj_clean(lv_screen_active());
+                        open_page(handle, pdata);
+                        update_timer(model, pdata);
+                        break;
+                    }
 
-                            update_page(model, pdata);
-                            break;
-                        }
+                    // Published for any board, only a new sample of the board shown corrects the clock
+                    uint32_t elapsed_ms = model->run.boards[pdata->board].read.elapsed_milliseconds;
+                    if ((topics & MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_ELAPSED_TIME)) &&
+                        elapsed_ms != pdata->clock.sampled_elapsed_ms) {
+                        clock_correct(pdata, elapsed_ms);
+                    }
 
-                        case WATCH_MINION_ELAPSED_TIME_ID: {
-                            pdata->last_minion_update_ts = timestamp_get();
-                            break;
-                        }
+                    if (topics & MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_READ)) {
+                        update_timer(model, pdata);
+                        update_page(model, pdata);
                     }
                     break;
                 }
@@ -230,7 +275,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         }
 
         case PMAN_EVENT_TAG_LVGL: {
-            lv_obj_t *target = lv_event_get_current_target_obj(event.as.lvgl);
+            lv_obj_t *target = pman_event_get_target_obj(event);
 
             switch (lv_event_get_code(event.as.lvgl)) {
                 case LV_EVENT_CLICKED: {
@@ -240,6 +285,18 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             msg.stack_msg = PMAN_STACK_MSG_BACK();
                             break;
 
+                        case BTN_BOARD_ID:
+                            // Both boards keep running, only the schedule on screen changes
+                            pdata->board = (pdata->board + 1) % model_get_num_boards(model);
+                            // The clock followed the other board
+                            pdata->clock.reference_ts = timestamp_get();
+                            pdata->clock.reference_elapsed_ms =
+                                model->run.boards[pdata->board].read.elapsed_milliseconds;
+                            lv_obj_clean(lv_screen_active());
+                            open_page(handle, pdata);
+                            update_timer(model, pdata);
+                            break;
+
                         default:
                             break;
                     }
@@ -276,161 +333,130 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
 static void update_page(model_t *model, struct page_data *pdata) {
     int16_t current_time_unit_index = -1;
 
-    lv_label_set_text_fmt(pdata->label_position, "%4i/%4i mm\n%4i - %4i mm", model_get_calibrated_position_mm(model),
-                          model_get_current_position_target(model), model->config.headgap_offset_down,
-                          model->config.headgap_offset_up);
+    char position_string[64] = {0};
+    snprintf(position_string, sizeof(position_string), "%4i/%4i mm\n%4i - %4i mm",
+             model_get_calibrated_position_mm(model), model_get_current_position_target(model),
+             model->config.headgap_offset_down, model->config.headgap_offset_up);
+    if (strcmp(lv_label_get_text(pdata->label_position), position_string) != 0) {
+        lv_label_set_text(pdata->label_position, position_string);
+    }
 
-    if (!model->run.minion.read.running) {
-        lv_obj_set_x(pdata->time_bar, 0);
-        lv_obj_scroll_to_view(pdata->time_bar, LV_ANIM_OFF);
-    } else {
-        const program_t *program = model_get_current_program(model);
-        uint32_t         elapsed_time_ms =
-            model->run.minion.read.elapsed_milliseconds + timestamp_since(pdata->last_minion_update_ts) + LAG_MS;
-        uint32_t duration = program_get_duration_milliseconds(program);
+    if (pdata->label_carousel != NULL) {
+        char carousel_string[64] = {0};
+        snprintf(carousel_string, sizeof(carousel_string), "Forma %i\nCicli %lu - %lu",
+                 model_get_active_form(model) + 1, (unsigned long)model_get_form_cycles(model, 0),
+                 (unsigned long)model_get_form_cycles(model, 1));
+        if (strcmp(lv_label_get_text(pdata->label_carousel), carousel_string) != 0) {
+            lv_label_set_text(pdata->label_carousel, carousel_string);
+        }
+    }
 
-        current_time_unit_index = model->run.minion.read.elapsed_milliseconds / (program->time_unit_decisecs * 100);
+    const minion_read_t *read    = &model->run.boards[pdata->board].read;
+    const program_t     *program = model_get_current_program(model, pdata->board);
+    // Without a selected program the board may still run, but the zeroed placeholder has no time unit
+    if (read->running && program->time_unit_decisecs > 0) {
+        current_time_unit_index = read->elapsed_milliseconds / (program->time_unit_decisecs * 100);
+    }
+
+    schedule_grid_set_highlighted_column(pdata->grid_schedule, current_time_unit_index);
+}
+
+
+static void update_time_bar(model_t *model, struct page_data *pdata) {
+    int32_t time_bar_x = 0;
+
+    const program_t *program  = model_get_current_program(model, pdata->board);
+    uint32_t         duration = program_get_duration_milliseconds(program);
+
+    // The duration is 0 when no program is selected
+    if (model->run.boards[pdata->board].read.running && duration > 0) {
+        uint32_t elapsed_time_ms = clock_get_elapsed_ms(pdata);
 
         if (elapsed_time_ms > duration) {
             elapsed_time_ms = duration;
         }
 
-        uint16_t elapsed_permillage = (elapsed_time_ms * 1000) / duration;
-
-        lv_obj_set_x(pdata->time_bar, (TIME_UNIT_WIDTH * PROGRAM_NUM_TIME_UNITS * elapsed_permillage) / 1000);
-
-        lv_obj_scroll_to_view(pdata->time_bar, LV_ANIM_OFF);
+        time_bar_x =
+            (int32_t)(((uint64_t)TIME_UNIT_WIDTH * program_get_num_time_units(program) * elapsed_time_ms) / duration);
     }
 
-    for (uint16_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
-        // First set all unit groups to the default color
-        for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-            if (pdata->channel_schedules[i][j].obj) {
-                lv_obj_set_style_border_color(pdata->channel_schedules[i][j].obj,
-                                              lv_color_darken(pdata->channel_schedules[i][j].color, LV_OPA_10),
-                                              LV_STATE_DEFAULT);
-                lv_obj_set_style_bg_color(pdata->channel_schedules[i][j].obj, pdata->channel_schedules[i][j].color,
-                                          LV_STATE_DEFAULT);
-            }
-        }
+    if (time_bar_x != pdata->time_bar_x) {
+        lv_obj_set_x(pdata->time_bar, time_bar_x);
+        pdata->time_bar_x = time_bar_x;
 
-        // Then lightnen up only those who are active
-        for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-            if (pdata->channel_schedules[i][j].obj) {
-                if (j == current_time_unit_index) {
-                    lv_obj_set_style_border_color(pdata->channel_schedules[i][j].obj,
-                                                  lv_color_lighten(pdata->channel_schedules[i][j].color, LV_OPA_10),
-                                                  LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(pdata->channel_schedules[i][j].obj,
-                                              lv_color_lighten(pdata->channel_schedules[i][j].color, LV_OPA_40),
-                                              LV_STATE_DEFAULT);
-                }
-            }
+        // Scrolling invalidates the whole panel, do it only when the bar is about to leave the view
+        lv_obj_t *panel    = lv_obj_get_parent(pdata->time_bar);
+        int32_t   scroll_x = lv_obj_get_scroll_x(panel);
+        if (time_bar_x < scroll_x ||
+            time_bar_x + lv_obj_get_width(pdata->time_bar) > scroll_x + lv_obj_get_content_width(panel)) {
+            lv_obj_scroll_to_view(pdata->time_bar, LV_ANIM_OFF);
         }
     }
 }
 
 
-static void close_page(void *state) {
-    struct page_data *pdata = state;
-    (void)pdata;
-    lv_obj_clean(lv_scr_act());
+static void update_timer(model_t *model, struct page_data *pdata) {
+    if (model->run.boards[pdata->board].read.running) {
+        pman_timer_resume(pdata->timer);
+    } else {
+        pman_timer_pause(pdata->timer);
+        pman_timer_reset(pdata->timer);
+        // Bring the bar back to the start
+        update_time_bar(model, pdata);
+    }
 }
 
 
-static uint16_t get_channel_activity_duration(uint8_t *channel_configuration, uint16_t starting_index) {
-    uint16_t duration = 1;
+/*
+ * The minion only reports the elapsed time every now and then and with some jitter; in between the bar is moved
+ * according to the local clock, which follows each sample halfway to avoid visible jumps
+ */
+static void clock_correct(struct page_data *pdata, uint32_t sampled_elapsed_ms) {
+    uint32_t estimated_elapsed_ms = clock_get_elapsed_ms(pdata);
+    int32_t  error                = (int32_t)(sampled_elapsed_ms + LAG_MS) - (int32_t)estimated_elapsed_ms;
 
-    for (uint16_t i = starting_index + 1; i < PROGRAM_NUM_TIME_UNITS; i++) {
-        if (channel_configuration[i] == channel_configuration[starting_index]) {
-            duration++;
-        } else {
-            break;
-        }
+    if (error > CLOCK_MAX_ERROR_MS || error < -CLOCK_MAX_ERROR_MS) {
+        pdata->clock.reference_elapsed_ms = sampled_elapsed_ms + LAG_MS;
+    } else {
+        pdata->clock.reference_elapsed_ms = estimated_elapsed_ms + error / 2;
     }
-
-    return duration;
+    pdata->clock.reference_ts       = timestamp_get();
+    pdata->clock.sampled_elapsed_ms = sampled_elapsed_ms;
 }
 
 
-static lv_obj_t *channel_schedule_create(lv_obj_t *parent, channel_schedule_unit_t channel_schedules[],
-                                         uint8_t *channel_configuration, uint8_t digital) {
-    lv_obj_t *cont = lv_obj_create(parent);
-    lv_obj_set_style_pad_all(cont, 0, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_row(cont, 0, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_column(cont, 0, LV_STATE_DEFAULT);
-    lv_obj_set_size(cont, PROGRAM_NUM_TIME_UNITS * TIME_UNIT_WIDTH, CHANNEL_ROW_HEIGHT);
-    lv_obj_add_style(cont, &style_transparent_cont, LV_STATE_DEFAULT);
-
-    lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
-    lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
-
-    lv_obj_t *obj_line = lv_obj_create(cont);
-    lv_obj_add_flag(obj_line, LV_OBJ_FLAG_IGNORE_LAYOUT);
-    lv_obj_set_size(obj_line, LV_PCT(100), 6);
-    lv_obj_set_style_bg_color(obj_line, lv_obj_get_style_border_color(obj_line, LV_PART_MAIN), LV_STATE_DEFAULT);
-    lv_obj_set_style_radius(obj_line, 0, LV_STATE_DEFAULT);
-    lv_obj_center(obj_line);
-
-    uint16_t i = 0;
-    while (i < PROGRAM_NUM_TIME_UNITS) {
-        lv_obj_t *unit = lv_obj_create(cont);
-        lv_obj_remove_flag(unit, LV_OBJ_FLAG_SCROLLABLE);
-        uint16_t duration = get_channel_activity_duration(channel_configuration, i);
-        assert(duration > 0);
-        lv_obj_set_size(unit, TIME_UNIT_WIDTH * duration, CHANNEL_ROW_HEIGHT);
-
-        if (channel_configuration[i] > 0) {
-            const lv_color_t colors[3] = {STYLE_COLOR_GREEN, STYLE_COLOR_YELLOW, STYLE_COLOR_RED};
-            lv_color_t       color     = digital ? STYLE_COLOR_BLUE : colors[channel_configuration[i] - 1];
-
-            lv_obj_set_style_bg_color(unit, color, LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(unit, 4, LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(unit, LV_RADIUS_CIRCLE, LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(unit, lv_color_darken(color, LV_OPA_10), LV_STATE_DEFAULT);
-
-            for (uint16_t j = i; j < i + duration; j++) {
-                channel_schedules[j].obj   = unit;
-                channel_schedules[j].color = color;
-            }
-        } else {
-            lv_obj_add_style(unit, &style_transparent_cont, LV_STATE_DEFAULT);
-
-            for (uint16_t j = i; j < i + duration; j++) {
-                channel_schedules[j].obj = NULL;
-            }
-        }
-
-        i += duration;
-    }
-
-    return cont;
+static uint32_t clock_get_elapsed_ms(struct page_data *pdata) {
+    return pdata->clock.reference_elapsed_ms + timestamp_since(pdata->clock.reference_ts);
 }
 
 
-static void configuration_from_digital_channel(uint8_t                           *channel_configuration,
-                                               program_digital_channel_schedule_t digital_channel_schedule) {
-    for (uint16_t i = 0; i < PROGRAM_NUM_TIME_UNITS; i++) {
-        channel_configuration[i] = (digital_channel_schedule & (1 << i)) > 0;
-    }
-}
+static void resume_page(pman_handle_t handle, void *state, void *extra) {
+    (void)extra;
+    struct page_data *pdata = state;
 
+    model_t *model = view_get_model(handle);
 
-static void configuration_from_pressure_channel(uint8_t                          *channel_configuration,
-                                                program_pressure_channel_state_t *pressure_channel_states) {
-    for (uint16_t i = 0; i < PROGRAM_NUM_TIME_UNITS; i++) {
-        channel_configuration[i] = pressure_channel_states[i];
+    // The schedule layout depends on the program; rebuild it only if it changed
+    if (memcmp(&pdata->program, model_get_current_program(model, pdata->board), sizeof(pdata->program)) != 0 ||
+        memcmp(pdata->channel_names, model->config.channel_names, sizeof(pdata->channel_names)) != 0) {
+        lv_obj_clean(lv_screen_active());
+        open_page(handle, state);
+    } else {
+        view_subscribe(MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_READ) | MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_ELAPSED_TIME) |
+                       MODEL_TOPIC_BIT(MODEL_TOPIC_CURRENT_PROGRAM));
+        clock_correct(pdata, model->run.boards[pdata->board].read.elapsed_milliseconds);
+        update_page(model, pdata);
+        update_time_bar(model, pdata);
     }
+
+    update_timer(model, pdata);
 }
 
 
-static void configuration_from_sensor_channel(uint8_t                            *channel_configuration,
-                                              program_sensor_channel_threshold_t *pressure_channel_thresholds) {
-    for (uint16_t i = 0; i < PROGRAM_NUM_TIME_UNITS; i++) {
-        channel_configuration[i] = pressure_channel_thresholds[i];
-    }
+static void close_page(void *state) {
+    struct page_data *pdata = state;
+    // The objects are kept by the page manager
+    pman_timer_pause(pdata->timer);
 }
 
 
@@ -439,5 +465,7 @@ const pman_page_t page_execution = {
     .destroy       = pman_destroy_all,
     .open          = open_page,
     .close         = close_page,
+    .resume        = resume_page,
     .process_event = page_event,
+    .retention     = PMAN_RETENTION_CACHED,
 };
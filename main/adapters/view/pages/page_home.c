@@ -18,6 +18,7 @@ enum {
     CONFIG_BTN_ID,
     TEST_BTN_ID,
     INFO_BTN_ID,
+    STATISTICS_BTN_ID,
     OTA_BTN_ID,
     CONFIRM_BTN_ID,
     REJECT_BTN_ID,
@@ -112,6 +113,17 @@ static void open_page(pman_handle_t handle, void *state) {
         view_register_object_default_callback(btn4, INFO_BTN_ID);
     }
 
+    {
+        lv_obj_t *btn = lv_button_create(obj_background);
+        lv_obj_set_size(btn, 64, 64);
+        lv_obj_t *label = lv_label_create(btn);
+        lv_obj_set_style_text_font(label, STYLE_FONT_BIG, LV_STATE_DEFAULT);
+        lv_label_set_text(label, LV_SYMBOL_LIST);
+        lv_obj_center(label);
+        lv_obj_align(btn, LV_ALIGN_LEFT_MID, offsetx, 0);
+        view_register_object_default_callback(btn, STATISTICS_BTN_ID);
+    }
+
     {
         lv_obj_t *btn = lv_button_create(obj_background);
         lv_obj_set_size(btn, 64, 64);
@@ -170,7 +182,7 @@ static void open_page(pman_handle_t handle, void *state) {
         pdata->obj_blanket = obj;
     }
 
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.firmware_update_ready, 0);
+    view_subscribe(MODEL_TOPIC_BIT(MODEL_TOPIC_FIRMWARE_UPDATE));
 
     update_page(model, pdata);
 }
@@ -191,7 +203,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         case PMAN_EVENT_TAG_USER: {
             view_event_t *view_event = event.as.user;
             switch (view_event->tag) {
-                case VIEW_EVENT_TAG_PAGE_WATCHER:
+                case VIEW_EVENT_TAG_MODEL_CHANGED:
                     update_page(model, pdata);
                     break;
 
@@ -205,7 +217,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         }
 
         case PMAN_EVENT_TAG_LVGL: {
-            lv_obj_t *target = lv_event_get_current_target_obj(event.as.lvgl);
+            lv_obj_t *target = pman_event_get_target_obj(event);
 
             switch (lv_event_get_code(event.as.lvgl)) {
                 case LV_EVENT_CLICKED: {
@@ -231,6 +243,10 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             msg.stack_msg = PMAN_STACK_MSG_PUSH_PAGE(&page_info);
                             break;
 
+                        case STATISTICS_BTN_ID:
+                            msg.stack_msg = PMAN_STACK_MSG_PUSH_PAGE(&page_statistics);
+                            break;
+
                         case OTA_BTN_ID: {
                             pdata->popup_state = POPUP_STATE_OTA;
                             update_page(model, pdata);
@@ -336,9 +352,19 @@ static void update_page(model_t *model, struct page_data *pdata) {
 }
 
 
-static void close_page(void *state) {
-    (void)state;
-    lv_obj_clean(lv_screen_active());
+static void resume_page(pman_handle_t handle, void *state, void *extra) {
+    (void)extra;
+    struct page_data *pdata = state;
+
+    model_t *model = view_get_model(handle);
+
+    pdata->popup_state         = POPUP_STATE_NONE;
+    pdata->password_navigation = PASSWORD_NAVIGATION_NONE;
+    lv_textarea_set_text(pdata->password_popup.textarea, "");
+
+    view_subscribe(MODEL_TOPIC_BIT(MODEL_TOPIC_FIRMWARE_UPDATE));
+
+    update_page(model, pdata);
 }
 
 
@@ -346,6 +372,7 @@ const pman_page_t page_home = {
     .create        = create_page,
     .destroy       = pman_destroy_all,
     .open          = open_page,
-    .close         = close_page,
+    .resume        = resume_page,
     .process_event = page_event,
+    .retention     = PMAN_RETENTION_CACHED,
 };
@@ -6,9 +6,14 @@
 #include "src/page.h"
 #include <assert.h>
 #include <stdlib.h>
+#include <inttypes.h>
 #include "adapters/view/common.h"
 #include "adapters/view/style.h"
 #include "config/app_config.h"
+#include "../monitor.h"
+
+
+#define MONITOR_REFRESH_PERIOD_MS 1000
 
 
 enum {
@@ -16,8 +21,21 @@ enum {
 };
 
 
+enum {
+    TABLE_COLUMN_NAME = 0,
+    TABLE_COLUMN_VISITS,
+    TABLE_COLUMN_HEAP,
+    TABLE_COLUMN_OBJECTS,
+    TABLE_COLUMN_TIMERS,
+    TABLE_COLUMN_DRAW_BUFFERS,
+#define TABLE_NUM_COLUMNS 6
+};
+
+
 struct page_data {
-    uint8_t placeholder;
+    lv_obj_t *table_monitor;
+
+    pman_timer_t *timer;
 };
 
 
@@ -25,11 +43,11 @@ static void update_page(model_t *model, struct page_data *pdata);
 
 
 static void *create_page(pman_handle_t handle, void *extra) {
-    (void)handle;
     (void)extra;
 
     struct page_data *pdata = lv_malloc(sizeof(struct page_data));
     assert(pdata != NULL);
+    pdata->timer = PMAN_REGISTER_TIMER_ID(handle, MONITOR_REFRESH_PERIOD_MS, 0);
 
     return pdata;
 }
@@ -49,9 +67,32 @@ static void open_page(pman_handle_t handle, void *state) {
         lv_obj_t *label = lv_label_create(cont);
         lv_obj_set_style_text_font(label, STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
         lv_label_set_text_fmt(label, "v%s %s", SOFTWARE_VERSION, SOFTWARE_BUILD_DATE);
-        lv_obj_center(label);
+        lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
     }
 
+    {     // Resources used by the interface; peaks are kept across page switches
+        lv_obj_t *table = lv_table_create(cont);
+        lv_obj_set_style_text_font(table, STYLE_FONT_SMALL, LV_STATE_DEFAULT | LV_PART_ITEMS);
+        lv_obj_set_size(table, LV_PCT(100), LV_VER_RES - 64 - 32 - 96);
+        lv_obj_align(table, LV_ALIGN_BOTTOM_MID, 0, 0);
+
+        lv_table_set_column_count(table, TABLE_NUM_COLUMNS);
+        lv_table_set_row_count(table, view_monitor_get_num_pages() + 3);
+        for (uint16_t i = 0; i < TABLE_NUM_COLUMNS; i++) {
+            lv_table_set_column_width(table, i, i == TABLE_COLUMN_NAME ? 260 : 180);
+        }
+
+        lv_table_set_cell_value(table, 0, TABLE_COLUMN_NAME, "Pagina");
+        lv_table_set_cell_value(table, 0, TABLE_COLUMN_VISITS, "Visite");
+        lv_table_set_cell_value(table, 0, TABLE_COLUMN_HEAP, "Heap KB");
+        lv_table_set_cell_value(table, 0, TABLE_COLUMN_OBJECTS, "Oggetti");
+        lv_table_set_cell_value(table, 0, TABLE_COLUMN_TIMERS, "Timer");
+        lv_table_set_cell_value(table, 0, TABLE_COLUMN_DRAW_BUFFERS, "Buffer KB");
+        pdata->table_monitor = table;
+    }
+
+    pman_timer_resume(pdata->timer);
+
     update_page(model, pdata);
 }
 
@@ -63,6 +104,11 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
     mut_model_t *model = view_get_model(handle);
 
     switch (event.tag) {
+        case PMAN_EVENT_TAG_TIMER: {
+            update_page(model, pdata);
+            break;
+        }
+
         case PMAN_EVENT_TAG_USER: {
             view_event_t *view_event = event.as.user;
             switch (view_event->tag) {
@@ -75,7 +121,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         }
 
         case PMAN_EVENT_TAG_LVGL: {
-            lv_obj_t *target = lv_event_get_current_target_obj(event.as.lvgl);
+            lv_obj_t *target = pman_event_get_target_obj(event);
 
             switch (lv_event_get_code(event.as.lvgl)) {
                 case LV_EVENT_CLICKED: {
@@ -107,11 +153,37 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
 
 static void update_page(model_t *model, struct page_data *pdata) {
     (void)model;
-    (void)pdata;
+
+    lv_obj_t *table = pdata->table_monitor;
+    uint32_t  row   = 1;
+
+    for (size_t i = 0; i < view_monitor_get_num_pages(); i++, row++) {
+        const view_monitor_page_stats_t *page = view_monitor_get_page(i);
+        lv_table_set_cell_value(table, row, TABLE_COLUMN_NAME, page->name);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_VISITS, "%" PRIu32, page->visits);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_HEAP, "%" PRIu32, page->peak.heap_used / 1024);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_OBJECTS, "%" PRIu32, page->peak.objects);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_TIMERS, "%" PRIu32, page->peak.timers);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_DRAW_BUFFERS, "%" PRIu32, page->peak.draw_buffers / 1024);
+    }
+
+    const char *const           names[]   = {"Attuale", "Massimo"};
+    const view_monitor_sample_t samples[] = {view_monitor_get_current(), view_monitor_get_peak()};
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++, row++) {
+        lv_table_set_cell_value(table, row, TABLE_COLUMN_NAME, names[i]);
+        lv_table_set_cell_value(table, row, TABLE_COLUMN_VISITS, "");
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_HEAP, "%" PRIu32 "/%" PRIu32, samples[i].heap_used / 1024,
+                                    samples[i].heap_total / 1024);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_OBJECTS, "%" PRIu32, samples[i].objects);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_TIMERS, "%" PRIu32, samples[i].timers);
+        lv_table_set_cell_value_fmt(table, row, TABLE_COLUMN_DRAW_BUFFERS, "%" PRIu32,
+                                    samples[i].draw_buffers / 1024);
+    }
 }
 
 static void close_page(void *state) {
-    (void)state;
+    struct page_data *pdata = state;
+    pman_timer_pause(pdata->timer);
     lv_obj_clean(lv_scr_act());
 }
 
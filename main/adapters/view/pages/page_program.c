@@ -9,32 +9,17 @@
 #include <stdlib.h>
 #include <time.h>
 #include "../common.h"
+#include "../widgets/schedule_grid.h"
 
 
 enum {
     BTN_BACK_ID,
     BTN_PROGRAM_NAME_ID,
     BTN_CHANNEL_NAME_ID,
-    BTN_DIGITAL_CHANNEL_1_ID,
-    BTN_DIGITAL_CHANNEL_2_ID,
-    BTN_DIGITAL_CHANNEL_3_ID,
-    BTN_DIGITAL_CHANNEL_4_ID,
-    BTN_DIGITAL_CHANNEL_5_ID,
-    BTN_DIGITAL_CHANNEL_6_ID,
-    BTN_DIGITAL_CHANNEL_7_ID,
-    BTN_DIGITAL_CHANNEL_8_ID,
-    BTN_DIGITAL_CHANNEL_9_ID,
-    BTN_DIGITAL_CHANNEL_10_ID,
-    BTN_DIGITAL_CHANNEL_11_ID,
-    BTN_DIGITAL_CHANNEL_12_ID,
-    BTN_DIGITAL_CHANNEL_13_ID,
-    BTN_DIGITAL_CHANNEL_14_ID,
-    BTN_DIGITAL_CHANNEL_15_ID,
-    BTN_DIGITAL_CHANNEL_16_ID,
-    BTN_PRESSURE_CHANNEL_ID,
-    BTN_SENSOR_CHANNEL_ID,
+    GRID_SCHEDULE_ID,
     BTN_PARAMETER_ID,
     BTN_TIME_UNIT_MOD_ID,
+    BTN_NUM_TIME_UNITS_MOD_ID,
     BTN_PRESSURE_LEVEL_1_MOD_ID,
     BTN_PRESSURE_LEVEL_2_MOD_ID,
     BTN_PRESSURE_LEVEL_3_MOD_ID,
@@ -57,9 +42,7 @@ typedef enum {
 struct page_data {
     lv_obj_t *label_channels[PROGRAM_NUM_PROGRAMMABLE_CHANNELS];
 
-    lv_obj_t *obj_digital_time_bars[PROGRAM_NUM_PROGRAMMABLE_CHANNELS];
-    lv_obj_t *obj_pressure_time_bar;
-    lv_obj_t *obj_position_time_bar;
+    lv_obj_t *grid_schedule;
     lv_obj_t *obj_parameters;
     lv_obj_t *obj_blanket;
 
@@ -68,6 +51,7 @@ struct page_data {
     lv_obj_t *label_program_name;
     lv_obj_t *label_parameters;
     lv_obj_t *label_time_unit;
+    lv_obj_t *label_num_time_units;
     lv_obj_t *label_pressure_levels[PROGRAM_PRESSURE_LEVELS];
     lv_obj_t *label_position_levels[PROGRAM_SENSOR_LEVELS];
 
@@ -190,39 +174,17 @@ static void open_page(pman_handle_t handle, void *state) {
     lv_obj_set_flex_flow(right_panel, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_flex_align(right_panel, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
 
-    for (uint16_t i = 0; i < PROGRAM_NUM_TIME_UNITS; i++) {
-        lv_obj_t *line = lv_obj_create(right_panel);
-        lv_obj_add_flag(line, LV_OBJ_FLAG_IGNORE_LAYOUT);
-        lv_obj_set_size(line, 1, LV_PCT(100));
-
-        lv_obj_set_style_border_color(line, lv_color_black(), LV_STATE_DEFAULT);
-        lv_obj_set_style_border_width(line, 2, LV_STATE_DEFAULT);
-        lv_obj_add_flag(line, LV_OBJ_FLAG_IGNORE_LAYOUT);
-        lv_obj_align(line, LV_ALIGN_LEFT_MID, 46 * (i + 1) + i, 0);
-    }
-
-    for (uint16_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
-        // Channel 8 should be the PRESSURE channel
-        if (i == PROGRAM_PRESSURE_CHANNEL_INDEX) {
-            lv_obj_t *time_bar = view_common_time_bar_create(right_panel, BTN_PRESSURE_CHANNEL_ID);
-            lv_obj_remove_flag(time_bar, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
-            lv_obj_remove_flag(time_bar, LV_OBJ_FLAG_SNAPPABLE);
-            pdata->obj_pressure_time_bar    = time_bar;
-            pdata->obj_digital_time_bars[i] = NULL;
-        }
-        // Channel 12 should be the 4-20ma channel
-        else if (i == PROGRAM_SENSOR_CHANNEL_INDEX) {
-            lv_obj_t *time_bar = view_common_time_bar_create(right_panel, BTN_SENSOR_CHANNEL_ID);
-            lv_obj_remove_flag(time_bar, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
-            lv_obj_remove_flag(time_bar, LV_OBJ_FLAG_SNAPPABLE);
-            pdata->obj_position_time_bar    = time_bar;
-            pdata->obj_digital_time_bars[i] = NULL;
-        } else {
-            lv_obj_t *time_bar = view_common_time_bar_create(right_panel, BTN_DIGITAL_CHANNEL_1_ID + i);
-            lv_obj_remove_flag(time_bar, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
-            lv_obj_remove_flag(time_bar, LV_OBJ_FLAG_SNAPPABLE);
-            pdata->obj_digital_time_bars[i] = time_bar;
-        }
+    {
+        const lv_color_t colors[SCHEDULE_GRID_NUM_COLORS] = {STYLE_COLOR_GREEN, STYLE_COLOR_YELLOW, STYLE_COLOR_RED,
+                                                             STYLE_COLOR_CYAN};
+
+        lv_obj_t *grid = schedule_grid_create(right_panel, SCHEDULE_GRID_LOOK_CELLS, 46, 46, 1, 6);
+        lv_obj_set_style_bg_color(grid, STYLE_COLOR_BLUE, LV_PART_ITEMS);
+        lv_obj_set_style_bg_opa(grid, LV_OPA_70, LV_PART_ITEMS);
+        lv_obj_set_style_line_color(grid, lv_color_black(), LV_PART_ITEMS);
+        schedule_grid_set_colors(grid, colors);
+        view_register_object_default_callback(grid, GRID_SCHEDULE_ID);
+        pdata->grid_schedule = grid;
     }
 
     {     // Parameters and names
@@ -303,6 +265,37 @@ static void open_page(pman_handle_t handle, void *state) {
                 lv_obj_align_to(button, obj_time_unit, LV_ALIGN_OUT_RIGHT_MID, 16, 0);
                 view_register_object_default_callback_with_number(button, BTN_TIME_UNIT_MOD_ID, +1);
             }
+
+            // Length of the program
+            lv_obj_t *obj_num_time_units = lv_obj_create(tab);
+            lv_obj_set_size(obj_num_time_units, 160, 64);
+            lv_obj_remove_flag(obj_num_time_units, LV_OBJ_FLAG_SCROLLABLE);
+            lv_obj_align_to(obj_num_time_units, obj_time_unit, LV_ALIGN_OUT_BOTTOM_MID, 0, 32);
+            lv_obj_t *label_num_time_units = lv_label_create(obj_num_time_units);
+            lv_obj_set_style_text_font(label_num_time_units, STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
+            pdata->label_num_time_units = label_num_time_units;
+
+            {
+                lv_obj_t *button = lv_button_create(tab);
+                lv_obj_set_size(button, 96, 64);
+                lv_obj_t *label = lv_label_create(button);
+                lv_obj_set_style_text_font(label, STYLE_FONT_BIG, LV_STATE_DEFAULT);
+                lv_label_set_text(label, LV_SYMBOL_MINUS);
+                lv_obj_center(label);
+                lv_obj_align_to(button, obj_num_time_units, LV_ALIGN_OUT_LEFT_MID, -16, 0);
+                view_register_object_default_callback_with_number(button, BTN_NUM_TIME_UNITS_MOD_ID, -1);
+            }
+
+            {
+                lv_obj_t *button = lv_button_create(tab);
+                lv_obj_set_size(button, 96, 64);
+                lv_obj_t *label = lv_label_create(button);
+                lv_obj_set_style_text_font(label, STYLE_FONT_BIG, LV_STATE_DEFAULT);
+                lv_label_set_text(label, LV_SYMBOL_PLUS);
+                lv_obj_center(label);
+                lv_obj_align_to(button, obj_num_time_units, LV_ALIGN_OUT_RIGHT_MID, 16, 0);
+                view_register_object_default_callback_with_number(button, BTN_NUM_TIME_UNITS_MOD_ID, +1);
+            }
         }
 
         {
@@ -435,7 +428,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         }
 
         case PMAN_EVENT_TAG_LVGL: {
-            lv_obj_t *target     = lv_event_get_current_target_obj(event.as.lvgl);
+            lv_obj_t *target     = pman_event_get_target_obj(event);
             uint16_t  obj_id     = view_get_obj_id(target);
             int16_t   obj_number = view_get_obj_number(target);
 
@@ -480,6 +473,16 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             program_t *program = model_get_program_mut(model, pdata->arg->program_index);
                             program->time_unit_decisecs += obj_number;
                             program_check_parameters(program, model->config.position_sensor_scale_mm);
+                            model_publish_program(model, pdata->arg->program_index);
+                            update_page(model, pdata);
+                            break;
+                        }
+
+                        case BTN_NUM_TIME_UNITS_MOD_ID: {
+                            *pdata->arg->modified = 1;
+                            program_t *program    = model_get_program_mut(model, pdata->arg->program_index);
+                            program_set_num_time_units(program, program_get_num_time_units(program) + obj_number);
+                            model_publish_program(model, pdata->arg->program_index);
                             update_page(model, pdata);
                             break;
                         }
@@ -491,6 +494,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             program_t *program              = model_get_program_mut(model, pdata->arg->program_index);
                             program->pressure_levels[pressure_level_index] += obj_number;
                             program_check_parameters(program, model->config.position_sensor_scale_mm);
+                            model_publish_program(model, pdata->arg->program_index);
                             update_page(model, pdata);
                             break;
                         }
@@ -502,37 +506,29 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             program_t *program              = model_get_program_mut(model, pdata->arg->program_index);
                             program->position_levels[position_level_index] += obj_number * 1;
                             program_check_parameters(program, model->config.position_sensor_scale_mm);
+                            model_publish_program(model, pdata->arg->program_index);
                             update_page(model, pdata);
                             break;
                         }
 
-                        case BTN_DIGITAL_CHANNEL_1_ID ... BTN_DIGITAL_CHANNEL_16_ID: {
-                            *pdata->arg->modified    = 1;
-                            program_t *program       = model_get_program_mut(model, pdata->arg->program_index);
-                            uint16_t   channel_index = obj_id - BTN_DIGITAL_CHANNEL_1_ID;
-                            uint16_t   unit_index    = view_get_obj_number(target);
-
-                            program_flip_digital_channel_state_at(program, channel_index, unit_index);
-                            update_page(model, pdata);
-                            break;
-                        }
-
-                        case BTN_PRESSURE_CHANNEL_ID: {
-                            *pdata->arg->modified = 1;
-                            program_t *program    = model_get_program_mut(model, pdata->arg->program_index);
-                            uint16_t   unit_index = view_get_obj_number(target);
-
-                            program_increase_pressure_channel_state_at(program, unit_index);
-                            update_page(model, pdata);
-                            break;
-                        }
+                        case GRID_SCHEDULE_ID: {
+                            uint16_t channel_index = 0;
+                            uint16_t unit_index    = 0;
+                            if (!schedule_grid_get_pressed_cell(target, &channel_index, &unit_index)) {
+                                break;
+                            }
 
-                        case BTN_SENSOR_CHANNEL_ID: {
                             *pdata->arg->modified = 1;
                             program_t *program    = model_get_program_mut(model, pdata->arg->program_index);
-                            uint16_t   unit_index = view_get_obj_number(target);
 
-                            program_increase_sensor_channel_threshold_at(program, unit_index);
+                            if (channel_index == PROGRAM_PRESSURE_CHANNEL_INDEX) {
+                                program_increase_pressure_channel_state_at(program, unit_index);
+                            } else if (channel_index == PROGRAM_SENSOR_CHANNEL_INDEX) {
+                                program_increase_sensor_channel_threshold_at(program, unit_index);
+                            } else {
+                                program_flip_digital_channel_state_at(program, channel_index, unit_index);
+                            }
+                            model_publish_program(model, pdata->arg->program_index);
                             update_page(model, pdata);
                             break;
                         }
@@ -549,6 +545,18 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             program_t *program = model_get_program_mut(model, pdata->arg->program_index);
                             program->time_unit_decisecs += obj_number;
                             program_check_parameters(program, model->config.position_sensor_scale_mm);
+                            model_publish_program(model, pdata->arg->program_index);
+                            update_page(model, pdata);
+                            break;
+                        }
+
+                        case BTN_NUM_TIME_UNITS_MOD_ID: {
+                            *pdata->arg->modified  = 1;
+                            program_t *program     = model_get_program_mut(model, pdata->arg->program_index);
+                            int32_t num_time_units = program_get_num_time_units(program) + obj_number * 10;
+                            num_time_units -= num_time_units % 10;
+                            program_set_num_time_units(program, LV_MAX(num_time_units, 0));
+                            model_publish_program(model, pdata->arg->program_index);
                             update_page(model, pdata);
                             break;
                         }
@@ -562,6 +570,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             program->pressure_levels[pressure_level_index] -=
                                 program->pressure_levels[pressure_level_index] % 10;
                             program_check_parameters(program, model->config.position_sensor_scale_mm);
+                            model_publish_program(model, pdata->arg->program_index);
                             update_page(model, pdata);
                             break;
                         }
@@ -575,6 +584,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                             program->position_levels[position_level_index] -=
                                 program->position_levels[position_level_index] % 10;
                             program_check_parameters(program, model->config.position_sensor_scale_mm);
+                            model_publish_program(model, pdata->arg->program_index);
                             update_page(model, pdata);
                             break;
                         }
@@ -593,6 +603,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                                     program_t *program = model_get_program_mut(model, pdata->arg->program_index);
                                     snprintf(program->name, sizeof(program->name), "%s",
                                              lv_textarea_get_text(pdata->textarea));
+                                    model_publish_program(model, pdata->arg->program_index);
                                     break;
                                 }
 
@@ -669,41 +680,7 @@ static void update_page(model_t *model, struct page_data *pdata) {
         lv_label_set_text(pdata->label_channels[i], model->config.channel_names[i]);
     }
 
-    for (uint16_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
-        for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-            if (pdata->obj_digital_time_bars[i] != NULL) {
-                lv_obj_t *unit = lv_obj_get_child(pdata->obj_digital_time_bars[i], j);
-                if (program_get_digital_channel_state_at(program, i, j)) {
-                    lv_obj_set_style_bg_opa(unit, LV_OPA_100, LV_STATE_DEFAULT);
-                } else {
-                    lv_obj_set_style_bg_opa(unit, LV_OPA_0, LV_STATE_DEFAULT);
-                }
-            }
-        }
-    }
-
-    const lv_color_t colors[4] = {STYLE_COLOR_BLUE, STYLE_COLOR_GREEN, STYLE_COLOR_YELLOW, STYLE_COLOR_RED};
-    for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-        lv_obj_t                        *pressure_unit          = lv_obj_get_child(pdata->obj_pressure_time_bar, j);
-        program_pressure_channel_state_t pressure_channel_state = program_get_pressure_channel_state_at(program, j);
-
-        if (pressure_channel_state != PROGRAM_PRESSURE_CHANNEL_STATE_OFF) {
-            lv_obj_set_style_bg_opa(pressure_unit, LV_OPA_100, LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_color(pressure_unit, colors[pressure_channel_state], LV_STATE_DEFAULT);
-        } else {
-            lv_obj_set_style_bg_opa(pressure_unit, LV_OPA_0, LV_STATE_DEFAULT);
-        }
-
-        lv_obj_t                          *position_unit = lv_obj_get_child(pdata->obj_position_time_bar, j);
-        program_sensor_channel_threshold_t position_channel_threshold = program_get_sensor_channel_state_at(program, j);
-
-        if (position_channel_threshold != PROGRAM_SENSOR_CHANNEL_THRESHOLD_NONE) {
-            lv_obj_set_style_bg_opa(position_unit, LV_OPA_100, LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_color(position_unit, colors[position_channel_threshold], LV_STATE_DEFAULT);
-        } else {
-            lv_obj_set_style_bg_opa(position_unit, LV_OPA_0, LV_STATE_DEFAULT);
-        }
-    }
+    schedule_grid_set_program(pdata->grid_schedule, program);
 
     switch (pdata->state) {
         case STATE_PROGRAM:
@@ -723,6 +700,7 @@ static void update_page(model_t *model, struct page_data *pdata) {
             lv_label_set_text(pdata->label_parameters, LV_SYMBOL_SETTINGS LV_SYMBOL_RIGHT);
 
             lv_label_set_text_fmt(pdata->label_time_unit, "%.1f s", ((float)program->time_unit_decisecs) / 10.);
+            lv_label_set_text_fmt(pdata->label_num_time_units, "%i x", program_get_num_time_units(program));
             for (uint16_t i = 0; i < PROGRAM_PRESSURE_LEVELS; i++) {
                 lv_label_set_text_fmt(pdata->label_pressure_levels[i], "%.1f bar",
                                       ((float)program->pressure_levels[i]) / 10.);
@@ -745,9 +723,20 @@ static void update_page(model_t *model, struct page_data *pdata) {
 }
 
 
-static void close_page(void *state) {
-    (void)state;
-    lv_obj_clean(lv_scr_act());
+static void resume_page(pman_handle_t handle, void *state, void *extra) {
+    struct page_data *pdata = state;
+
+    model_t *model = view_get_model(handle);
+
+    // The same screen is reused for whichever program is being edited
+    pdata->arg                  = (view_page_program_arg_t *)extra;
+    pdata->channel_window_index = 0;
+    pdata->state                = STATE_PROGRAM;
+
+    lv_obj_scroll_to(pdata->right_panel, 0, 0, LV_ANIM_OFF);
+    lv_obj_scroll_to(lv_obj_get_parent(pdata->right_panel), 0, 0, LV_ANIM_OFF);
+
+    update_page(model, pdata);
 }
 
 
@@ -755,6 +744,7 @@ const pman_page_t page_program = {
     .create        = create_page,
     .destroy       = pman_destroy_all,
     .open          = open_page,
-    .close         = close_page,
+    .resume        = resume_page,
     .process_event = page_event,
+    .retention     = PMAN_RETENTION_CACHED,
 };
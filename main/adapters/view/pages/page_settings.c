@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include "../common.h"
+#include "config/app_config.h"
 
 
 enum {
@@ -18,8 +19,13 @@ enum {
     SLIDER_PWM_ID,
     KEYBOARD_ID,
     TIMER_WIFI_ID,
-    UPDATE_MINION_ID,
-    UPDATE_NETWORK_ID,
+    BTN_POSITION_MM_MOD_ID,
+    BTN_POSITION_POINT_ID,
+    BTN_POSITION_CLEAR_ID,
+    BTN_CALIBRATION_PWM_MOD_ID,
+    BTN_PRESSURE_MOD_ID,
+    BTN_PRESSURE_POINT_ID,
+    BTN_PRESSURE_CLEAR_ID,
 };
 
 
@@ -36,6 +42,13 @@ struct page_data {
     lv_obj_t *label_wifi;
     lv_obj_t *label_state;
     lv_obj_t *label_ethernet;
+    lv_obj_t *label_position_reading;
+    lv_obj_t *label_position_mm;
+    lv_obj_t *label_position_points;
+    lv_obj_t *label_calibration_pwm;
+    lv_obj_t *label_pressure_reading;
+    lv_obj_t *label_pressure;
+    lv_obj_t *label_pressure_points;
 
     lv_obj_t *list_networks;
 
@@ -45,12 +58,22 @@ struct page_data {
 
     uint8_t password;
     char    selected_network[33];
+
+    // Measured on the machine while capturing calibration points
+    int16_t position_mm;
+    int16_t pressure_decibar;
+    uint8_t modified;
 };
 
 
 static const void *get_wifi_icon(int signal);
 static void        update_network_list(struct page_data *pdata, wifi_network_t *networks, int num);
 static void        update_page(model_t *model, struct page_data *pdata);
+static lv_obj_t   *calibration_column_create(lv_obj_t *parent, const char *title, const char *hint);
+static lv_obj_t   *calibration_mod_create(lv_obj_t *parent, uint16_t id, int16_t step);
+static lv_obj_t   *calibration_buttons_create(lv_obj_t *parent, uint16_t point_id, uint16_t clear_id);
+static void        update_curve_label(lv_obj_t *label, const calibration_curve_t *curve, const char *fmt,
+                                      float value_unit);
 
 
 static void *create_page(pman_handle_t handle, void *extra) {
@@ -60,8 +83,11 @@ static void *create_page(pman_handle_t handle, void *extra) {
     struct page_data *pdata = lv_malloc(sizeof(struct page_data));
     assert(pdata != NULL);
 
-    pdata->timer_wifi = PMAN_REGISTER_TIMER_ID(handle, 10000, TIMER_WIFI_ID);
-    pdata->password   = 0;
+    pdata->timer_wifi       = PMAN_REGISTER_TIMER_ID(handle, 10000, TIMER_WIFI_ID);
+    pdata->password         = 0;
+    pdata->position_mm      = 0;
+    pdata->pressure_decibar = 0;
+    pdata->modified         = 0;
 
     return pdata;
 }
@@ -192,6 +218,37 @@ static void open_page(pman_handle_t handle, void *state) {
         }
     }
 
+    {
+        lv_obj_t *tab = lv_tabview_add_tab(tabview, "Calibrazione");
+        lv_obj_set_style_text_font(tab, STYLE_FONT_SMALL, LV_STATE_DEFAULT);
+        lv_obj_set_style_pad_ver(tab, 10, LV_STATE_DEFAULT);
+        lv_obj_set_layout(tab, LV_LAYOUT_FLEX);
+        lv_obj_set_flex_flow(tab, LV_FLEX_FLOW_ROW);
+        lv_obj_set_flex_align(tab, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
+
+        {
+            lv_obj_t *cont = calibration_column_create(tab, "Sensore di posizione",
+                                                       "Portare la pressa a una quota nota dalla diagnosi, impostare "
+                                                       "la distanza misurata e acquisire il punto");
+
+            pdata->label_position_reading = lv_label_create(cont);
+            pdata->label_position_mm      = calibration_mod_create(cont, BTN_POSITION_MM_MOD_ID, 1);
+            calibration_buttons_create(cont, BTN_POSITION_POINT_ID, BTN_POSITION_CLEAR_ID);
+            pdata->label_position_points = lv_label_create(cont);
+        }
+
+        {
+            lv_obj_t *cont = calibration_column_create(
+                tab, "Pressione", "Impostare l'uscita analogica, leggere il manometro e acquisire il punto");
+
+            pdata->label_calibration_pwm  = calibration_mod_create(cont, BTN_CALIBRATION_PWM_MOD_ID, 5);
+            pdata->label_pressure_reading = lv_label_create(cont);
+            pdata->label_pressure         = calibration_mod_create(cont, BTN_PRESSURE_MOD_ID, 1);
+            calibration_buttons_create(cont, BTN_PRESSURE_POINT_ID, BTN_PRESSURE_CLEAR_ID);
+            pdata->label_pressure_points = lv_label_create(cont);
+        }
+    }
+
     {
         lv_obj_t *tab = lv_tabview_add_tab(tabview, "Rete");
         lv_obj_set_style_text_font(tab, STYLE_FONT_SMALL, LV_STATE_DEFAULT);
@@ -238,8 +295,7 @@ static void open_page(pman_handle_t handle, void *state) {
         pdata->obj_blanket = blanket;
     }
 
-    VIEW_ADD_WATCHED_VARIABLE(&model->run.minion.read, UPDATE_MINION_ID);
-    VIEW_ADD_WATCHED_VARIABLE(&model->network, UPDATE_NETWORK_ID);
+    view_subscribe(MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_READ) | MODEL_TOPIC_BIT(MODEL_TOPIC_NETWORK));
 
     update_page(model, pdata);
 }
@@ -268,13 +324,9 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
             switch (view_event->tag) {
                 case VIEW_EVENT_TAG_STORAGE_OPERATION_COMPLETED:
                     break;
-                case VIEW_EVENT_TAG_PAGE_WATCHER: {
-                    switch (view_event->as.page_watcher.code) {
-                        case UPDATE_NETWORK_ID:
-                            update_network_list(pdata, model->network.networks, model->network.num_networks);
-                            break;
-                        default:
-                            break;
+                case VIEW_EVENT_TAG_MODEL_CHANGED: {
+                    if (view_event->as.model_changed.topics & MODEL_TOPIC_BIT(MODEL_TOPIC_NETWORK)) {
+                        update_network_list(pdata, model->network.networks, model->network.num_networks);
                     }
                     update_page(model, pdata);
                     break;
@@ -286,7 +338,7 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
         }
 
         case PMAN_EVENT_TAG_LVGL: {
-            lv_obj_t *target     = lv_event_get_current_target_obj(event.as.lvgl);
+            lv_obj_t *target     = pman_event_get_target_obj(event);
             uint16_t  obj_id     = view_get_obj_id(target);
             uint16_t  obj_number = view_get_obj_number(target);
 
@@ -294,10 +346,62 @@ static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t eve
                 case LV_EVENT_CLICKED: {
                     switch (obj_id) {
                         case BTN_BACK_ID:
+                            if (pdata->modified) {
+                                view_get_protocol(handle)->save_configuration(handle);
+                            }
                             msg.stack_msg = PMAN_STACK_MSG_BACK();
                             view_get_protocol(handle)->set_test_mode(handle, 0);
                             break;
 
+                        case BTN_POSITION_MM_MOD_ID:
+                            pdata->position_mm = LV_CLAMP(0, pdata->position_mm + (int16_t)obj_number,
+                                                          APP_CONFIG_MAX_POSITION_SENSOR_SCALE_MM);
+                            update_page(model, pdata);
+                            break;
+
+                        case BTN_POSITION_POINT_ID:
+                            if (model_add_position_calibration_point(model, pdata->position_mm)) {
+                                pdata->modified = 1;
+                            } else {
+                                view_show_toast(1, "Numero massimo di punti raggiunto");
+                            }
+                            update_page(model, pdata);
+                            break;
+
+                        case BTN_POSITION_CLEAR_ID:
+                            pdata->modified = 1;
+                            calibration_curve_clear(&model->config.position_curve);
+                            update_page(model, pdata);
+                            break;
+
+                        case BTN_CALIBRATION_PWM_MOD_ID:
+                            view_get_protocol(handle)->test_pwm(
+                                handle, LV_CLAMP(0, model->run.minion.write.pwm + (int16_t)obj_number,
+                                                 APP_CONFIG_MAX_PRESSURE_DAC_LEVEL));
+                            update_page(model, pdata);
+                            break;
+
+                        case BTN_PRESSURE_MOD_ID:
+                            pdata->pressure_decibar = LV_CLAMP(0, pdata->pressure_decibar + (int16_t)obj_number,
+                                                               APP_CONFIG_MAX_PRESSURE_LEVEL);
+                            update_page(model, pdata);
+                            break;
+
+                        case BTN_PRESSURE_POINT_ID:
+                            if (model_add_pressure_calibration_point(model, pdata->pressure_decibar)) {
+                                pdata->modified = 1;
+                            } else {
+                                view_show_toast(1, "Numero massimo di punti raggiunto");
+                            }
+                            update_page(model, pdata);
+                            break;
+
+                        case BTN_PRESSURE_CLEAR_ID:
+                            pdata->modified = 1;
+                            calibration_curve_clear(&model->config.pressure_curve);
+                            update_page(model, pdata);
+                            break;
+
                         case BTN_OUTPUT_ID:
                             view_get_protocol(handle)->test_output(handle, obj_number);
                             update_page(model, pdata);
@@ -390,17 +494,28 @@ static void update_page(model_t *model, struct page_data *pdata) {
     }
 
     for (size_t i = 0; i < NUM_INPUTS; i++) {
-        if (model->run.minion.read.inputs & (1 << i)) {
+        if (model->run.boards[0].read.inputs & (1 << i)) {
             lv_led_on(pdata->led_input[i]);
         } else {
             lv_led_off(pdata->led_input[i]);
         }
     }
 
-    lv_label_set_text_fmt(pdata->label_4_20ma, "%4i", model->run.minion.read.ma4_20_adc);
+    lv_label_set_text_fmt(pdata->label_4_20ma, "%4i", model->run.boards[POSITION_SENSOR_BOARD].read.ma4_20_adc);
     lv_slider_set_value(pdata->slider_pwm, model->run.minion.write.pwm, LV_ANIM_OFF);
     lv_label_set_text_fmt(pdata->label_pwm, "%3i%% (%4i)", model->run.minion.write.pwm,
-                          model->run.minion.read.v0_10_adc);
+                          model->run.boards[0].read.v0_10_adc);
+
+    lv_label_set_text_fmt(pdata->label_position_reading, "Lettura: %4i (%.1f mm)", model_get_position_adc(model),
+                          ((float)model_get_calibrated_position_mm_q16(model)) / (1 << POSITION_CALIBRATION_SHIFT));
+    lv_label_set_text_fmt(pdata->label_position_mm, "%3i mm", pdata->position_mm);
+    update_curve_label(pdata->label_position_points, &model->config.position_curve, "%4i -> %3.0f mm\n", 1.);
+
+    lv_label_set_text_fmt(pdata->label_calibration_pwm, "Uscita %3i%%", model->run.minion.write.pwm);
+    lv_label_set_text_fmt(pdata->label_pressure_reading, "Attesa: %.1f bar",
+                          ((float)model_dac_to_pressure(model, model->run.minion.write.pwm)) / 10.);
+    lv_label_set_text_fmt(pdata->label_pressure, "%.1f bar", ((float)pdata->pressure_decibar) / 10.);
+    update_curve_label(pdata->label_pressure_points, &model->config.pressure_curve, "%3i%% -> %.1f bar\n", 10.);
 
     view_common_set_hidden(pdata->obj_blanket, !pdata->password);
 
@@ -450,6 +565,106 @@ static void update_network_list(struct page_data *pdata, wifi_network_t *network
 }
 
 
+static lv_obj_t *calibration_column_create(lv_obj_t *parent, const char *title, const char *hint) {
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_set_size(cont, LV_PCT(48), LV_PCT(100));
+    lv_obj_set_style_pad_row(cont, 8, LV_STATE_DEFAULT);
+    lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    lv_obj_t *label = lv_label_create(cont);
+    lv_obj_set_style_text_font(label, STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
+    lv_label_set_text(label, title);
+
+    label = lv_label_create(cont);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(label, LV_PCT(100));
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, LV_STATE_DEFAULT);
+    lv_label_set_text(label, hint);
+
+    return cont;
+}
+
+
+/**
+ * Minus and plus buttons around a label, which is returned
+ */
+static lv_obj_t *calibration_mod_create(lv_obj_t *parent, uint16_t id, int16_t step) {
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_add_style(cont, &style_transparent_cont, LV_STATE_DEFAULT);
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(cont, LV_PCT(100), 64);
+    lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    for (int16_t i = 0; i < 2; i++) {
+        lv_obj_t *button = lv_button_create(cont);
+        lv_obj_set_size(button, 72, 56);
+        lv_obj_t *label = lv_label_create(button);
+        lv_label_set_text(label, i == 0 ? LV_SYMBOL_MINUS : LV_SYMBOL_PLUS);
+        lv_obj_center(label);
+        view_register_object_default_callback_with_number(button, id, i == 0 ? -step : step);
+    }
+
+    // Between the two buttons
+    lv_obj_t *label = lv_label_create(cont);
+    lv_obj_set_style_text_font(label, STYLE_FONT_MEDIUM, LV_STATE_DEFAULT);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, LV_STATE_DEFAULT);
+    lv_obj_set_width(label, 160);
+    lv_obj_move_to_index(label, 1);
+
+    return label;
+}
+
+
+static lv_obj_t *calibration_buttons_create(lv_obj_t *parent, uint16_t point_id, uint16_t clear_id) {
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_add_style(cont, &style_transparent_cont, LV_STATE_DEFAULT);
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(cont, LV_PCT(100), 64);
+    lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    const char *texts[] = {"Acquisisci", "Cancella"};
+    uint16_t    ids[]   = {point_id, clear_id};
+    for (size_t i = 0; i < 2; i++) {
+        lv_obj_t *button = lv_button_create(cont);
+        lv_obj_set_size(button, 160, 56);
+        lv_obj_t *label = lv_label_create(button);
+        lv_label_set_text(label, texts[i]);
+        lv_obj_center(label);
+        view_register_object_default_callback(button, ids[i]);
+    }
+
+    return cont;
+}
+
+
+/**
+ * Lists the captured points, one per line; `fmt` receives the raw value and the measured one divided by `value_unit`
+ */
+static void update_curve_label(lv_obj_t *label, const calibration_curve_t *curve, const char *fmt, float value_unit) {
+    char     text[CALIBRATION_CURVE_MAX_POINTS * 32] = {0};
+    uint16_t num_points                              = calibration_curve_get_num_points(curve);
+
+    if (num_points < 2) {
+        snprintf(text, sizeof(text), "Conversione lineare (%i punti)", num_points);
+    } else {
+        size_t length = 0;
+        for (uint16_t i = 0; i < num_points && length < sizeof(text); i++) {
+            const calibration_curve_point_t *point = calibration_curve_get_point(curve, i);
+            length += snprintf(&text[length], sizeof(text) - length, fmt, point->raw,
+                               ((float)point->value) / value_unit);
+        }
+    }
+
+    lv_label_set_text(label, text);
+}
+
+
 static const void *get_wifi_icon(int signal) {
     LV_IMG_DECLARE(img_wifi_signal_1);
     LV_IMG_DECLARE(img_wifi_signal_2);
@@ -0,0 +1,288 @@
+#include "../view.h"
+#include "lvgl.h"
+#include "model/model.h"
+#include "src/core/lv_obj_event.h"
+#include "src/misc/lv_types.h"
+#include "src/page.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "adapters/view/common.h"
+#include "adapters/view/style.h"
+#include "config/app_config.h"
+
+
+enum {
+    BTN_BACK_ID,
+    BTN_RESET_ID,
+};
+
+
+enum {
+    PROGRAMS_COLUMN_NAME = 0,
+    PROGRAMS_COLUMN_CYCLES,
+    PROGRAMS_COLUMN_MIN,
+    PROGRAMS_COLUMN_AVERAGE,
+    PROGRAMS_COLUMN_MAX,
+    PROGRAMS_COLUMN_NOMINAL,
+#define PROGRAMS_NUM_COLUMNS 6
+};
+
+
+enum {
+    SHIFTS_COLUMN_NAME = 0,
+    SHIFTS_COLUMN_CYCLES,
+    SHIFTS_COLUMN_RUNNING,
+    SHIFTS_COLUMN_IDLE,
+#define SHIFTS_NUM_COLUMNS 4
+};
+
+
+struct page_data {
+    lv_obj_t *table_programs;
+    lv_obj_t *table_shifts;
+    lv_obj_t *table_idle;
+};
+
+
+static void update_page(model_t *model, struct page_data *pdata);
+static void set_cell_seconds(lv_obj_t *table, uint32_t row, uint32_t column, uint32_t milliseconds);
+static void set_cell_hours(lv_obj_t *table, uint32_t row, uint32_t column, uint64_t milliseconds);
+
+
+static void *create_page(pman_handle_t handle, void *extra) {
+    (void)handle;
+    (void)extra;
+
+    struct page_data *pdata = lv_malloc(sizeof(struct page_data));
+    assert(pdata != NULL);
+
+    return pdata;
+}
+
+static void open_page(pman_handle_t handle, void *state) {
+    struct page_data *pdata = state;
+
+    model_t *model = view_get_model(handle);
+
+    lv_obj_t *title = view_common_title_create(lv_screen_active(), BTN_BACK_ID, "Statistiche");
+
+    {     // Long press only, the counters cannot be recovered
+        lv_obj_t *button = lv_button_create(title);
+        lv_obj_set_size(button, 128, 56);
+        lv_obj_t *label = lv_label_create(button);
+        lv_obj_set_style_text_font(label, STYLE_FONT_SMALL, LV_STATE_DEFAULT);
+        lv_label_set_text(label, LV_SYMBOL_TRASH " Azzera");
+        lv_obj_center(label);
+        lv_obj_align(button, LV_ALIGN_RIGHT_MID, -8, 0);
+        view_register_object_default_callback(button, BTN_RESET_ID);
+    }
+
+    lv_obj_t *cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, LV_HOR_RES - 32, LV_VER_RES - 64 - 32);
+    lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(cont, 16, LV_STATE_DEFAULT);
+    lv_obj_align(cont, LV_ALIGN_BOTTOM_MID, 0, -16);
+
+    {     // Cycle times of every program, in seconds
+        lv_obj_t *table = lv_table_create(cont);
+        lv_obj_set_style_text_font(table, STYLE_FONT_SMALL, LV_STATE_DEFAULT | LV_PART_ITEMS);
+        lv_obj_set_size(table, LV_PCT(100), LV_SIZE_CONTENT);
+
+        lv_table_set_column_count(table, PROGRAMS_NUM_COLUMNS);
+        lv_table_set_row_count(table, model_get_num_programs(model) + 1);
+        for (uint16_t i = 0; i < PROGRAMS_NUM_COLUMNS; i++) {
+            lv_table_set_column_width(table, i, i == PROGRAMS_COLUMN_NAME ? 260 : 140);
+        }
+
+        lv_table_set_cell_value(table, 0, PROGRAMS_COLUMN_NAME, "Programma");
+        lv_table_set_cell_value(table, 0, PROGRAMS_COLUMN_CYCLES, "Cicli");
+        lv_table_set_cell_value(table, 0, PROGRAMS_COLUMN_MIN, "Min s");
+        lv_table_set_cell_value(table, 0, PROGRAMS_COLUMN_AVERAGE, "Medio s");
+        lv_table_set_cell_value(table, 0, PROGRAMS_COLUMN_MAX, "Max s");
+        lv_table_set_cell_value(table, 0, PROGRAMS_COLUMN_NOMINAL, "Previsto s");
+        pdata->table_programs = table;
+    }
+
+    {
+        lv_obj_t *table = lv_table_create(cont);
+        lv_obj_set_style_text_font(table, STYLE_FONT_SMALL, LV_STATE_DEFAULT | LV_PART_ITEMS);
+        lv_obj_set_size(table, LV_PCT(100), LV_SIZE_CONTENT);
+
+        lv_table_set_column_count(table, SHIFTS_NUM_COLUMNS);
+        lv_table_set_row_count(table, STATISTICS_NUM_SHIFTS + 1);
+        for (uint16_t i = 0; i < SHIFTS_NUM_COLUMNS; i++) {
+            lv_table_set_column_width(table, i, i == SHIFTS_COLUMN_NAME ? 260 : 180);
+        }
+
+        lv_table_set_cell_value(table, 0, SHIFTS_COLUMN_NAME, "Turno");
+        lv_table_set_cell_value(table, 0, SHIFTS_COLUMN_CYCLES, "Cicli");
+        lv_table_set_cell_value(table, 0, SHIFTS_COLUMN_RUNNING, "Lavoro h:m");
+        lv_table_set_cell_value(table, 0, SHIFTS_COLUMN_IDLE, "Fermo h:m");
+        for (uint16_t i = 0; i < STATISTICS_NUM_SHIFTS; i++) {
+            uint16_t start = (STATISTICS_FIRST_SHIFT_HOUR + i * STATISTICS_SHIFT_HOURS) % 24;
+            lv_table_set_cell_value_fmt(table, i + 1, SHIFTS_COLUMN_NAME, "%02i:00 - %02i:00", start,
+                                        (start + STATISTICS_SHIFT_HOURS) % 24);
+        }
+        pdata->table_shifts = table;
+    }
+
+    {     // Pauses between cycles, by duration
+        lv_obj_t *table = lv_table_create(cont);
+        lv_obj_set_style_text_font(table, STYLE_FONT_SMALL, LV_STATE_DEFAULT | LV_PART_ITEMS);
+        lv_obj_set_size(table, LV_PCT(100), LV_SIZE_CONTENT);
+
+        lv_table_set_column_count(table, 2);
+        lv_table_set_row_count(table, STATISTICS_IDLE_BINS + 1);
+        lv_table_set_column_width(table, 0, 260);
+        lv_table_set_column_width(table, 1, 180);
+
+        lv_table_set_cell_value(table, 0, 0, "Fermo");
+        lv_table_set_cell_value(table, 0, 1, "Volte");
+        for (uint16_t i = 0; i < STATISTICS_IDLE_BINS; i++) {
+            uint32_t limit_s = statistics_get_idle_bin_limit_s(i);
+            if (limit_s == 0) {
+                lv_table_set_cell_value_fmt(table, i + 1, 0, "oltre %" PRIu32 " min",
+                                            statistics_get_idle_bin_limit_s(i - 1) / 60);
+            } else if (limit_s < 60) {
+                lv_table_set_cell_value_fmt(table, i + 1, 0, "meno di %" PRIu32 " s", limit_s);
+            } else {
+                lv_table_set_cell_value_fmt(table, i + 1, 0, "meno di %" PRIu32 " min", limit_s / 60);
+            }
+        }
+        pdata->table_idle = table;
+    }
+
+    view_subscribe(MODEL_TOPIC_BIT(MODEL_TOPIC_STATISTICS) | MODEL_TOPIC_BIT(MODEL_TOPIC_PROGRAM));
+
+    update_page(model, pdata);
+}
+
+static pman_msg_t page_event(pman_handle_t handle, void *state, pman_event_t event) {
+    pman_msg_t msg = PMAN_MSG_NULL;
+
+    struct page_data *pdata = state;
+
+    mut_model_t *model = view_get_model(handle);
+
+    switch (event.tag) {
+        case PMAN_EVENT_TAG_USER: {
+            view_event_t *view_event = event.as.user;
+            switch (view_event->tag) {
+                case VIEW_EVENT_TAG_MODEL_CHANGED:
+                    update_page(model, pdata);
+                    break;
+
+                default:
+                    break;
+            }
+            break;
+        }
+
+        case PMAN_EVENT_TAG_LVGL: {
+            lv_obj_t *target = pman_event_get_target_obj(event);
+
+            switch (lv_event_get_code(event.as.lvgl)) {
+                case LV_EVENT_CLICKED: {
+                    switch (view_get_obj_id(target)) {
+                        case BTN_BACK_ID: {
+                            msg.stack_msg = PMAN_STACK_MSG_BACK();
+                            break;
+                        }
+
+                        case BTN_RESET_ID: {
+                            view_show_toast(0, "Tenere premuto per azzerare");
+                            break;
+                        }
+
+                        default:
+                            break;
+                    }
+                    break;
+                }
+
+                case LV_EVENT_LONG_PRESSED: {
+                    switch (view_get_obj_id(target)) {
+                        case BTN_RESET_ID: {
+                            model_reset_statistics(model);
+                            update_page(model, pdata);
+                            break;
+                        }
+
+                        default:
+                            break;
+                    }
+                    break;
+                }
+
+                default:
+                    break;
+            }
+
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    return msg;
+}
+
+static void update_page(model_t *model, struct page_data *pdata) {
+    const statistics_t *statistics = model_get_statistics(model);
+
+    for (uint16_t i = 0; i < model_get_num_programs(model); i++) {
+        const statistics_program_t *program = statistics_get_program(statistics, i);
+        lv_obj_t                   *table   = pdata->table_programs;
+        uint32_t                    row     = i + 1;
+
+        lv_table_set_cell_value(table, row, PROGRAMS_COLUMN_NAME, model_get_program_name(model, i));
+        lv_table_set_cell_value_fmt(table, row, PROGRAMS_COLUMN_CYCLES, "%" PRIu32, program->cycles);
+        if (program->cycles > 0) {
+            set_cell_seconds(table, row, PROGRAMS_COLUMN_MIN, program->min_cycle_ms);
+            set_cell_seconds(table, row, PROGRAMS_COLUMN_AVERAGE, statistics_get_average_cycle_ms(program));
+            set_cell_seconds(table, row, PROGRAMS_COLUMN_MAX, program->max_cycle_ms);
+            set_cell_seconds(table, row, PROGRAMS_COLUMN_NOMINAL, program->nominal_cycle_ms);
+        } else {
+            for (uint16_t j = PROGRAMS_COLUMN_MIN; j < PROGRAMS_NUM_COLUMNS; j++) {
+                lv_table_set_cell_value(table, row, j, "-");
+            }
+        }
+    }
+
+    for (uint16_t i = 0; i < STATISTICS_NUM_SHIFTS; i++) {
+        const statistics_shift_t *shift = &statistics->shifts[i];
+        lv_table_set_cell_value_fmt(pdata->table_shifts, i + 1, SHIFTS_COLUMN_CYCLES, "%" PRIu32, shift->cycles);
+        set_cell_hours(pdata->table_shifts, i + 1, SHIFTS_COLUMN_RUNNING, shift->running_ms);
+        set_cell_hours(pdata->table_shifts, i + 1, SHIFTS_COLUMN_IDLE, shift->idle_ms);
+    }
+
+    for (uint16_t i = 0; i < STATISTICS_IDLE_BINS; i++) {
+        lv_table_set_cell_value_fmt(pdata->table_idle, i + 1, 1, "%" PRIu32, statistics->idle_histogram[i]);
+    }
+}
+
+static void close_page(void *state) {
+    (void)state;
+    lv_obj_clean(lv_scr_act());
+}
+
+static void set_cell_seconds(lv_obj_t *table, uint32_t row, uint32_t column, uint32_t milliseconds) {
+    lv_table_set_cell_value_fmt(table, row, column, "%" PRIu32 ".%" PRIu32, milliseconds / 1000,
+                                (milliseconds % 1000) / 100);
+}
+
+static void set_cell_hours(lv_obj_t *table, uint32_t row, uint32_t column, uint64_t milliseconds) {
+    uint32_t minutes = (uint32_t)(milliseconds / 60000UL);
+    lv_table_set_cell_value_fmt(table, row, column, "%" PRIu32 ":%02" PRIu32, minutes / 60, minutes % 60);
+}
+
+const pman_page_t page_statistics = {
+    .create        = create_page,
+    .destroy       = pman_destroy_all,
+    .open          = open_page,
+    .close         = close_page,
+    .process_event = page_event,
+};
@@ -21,8 +21,6 @@
 
 extern const lv_style_t style_transparent_cont;
 extern const lv_style_t style_padless_cont;
-extern const lv_style_t style_time_bar;
-extern const lv_style_t style_time_unit;
 
 
 #endif
@@ -3,13 +3,16 @@
 #include "model/model.h"
 #include "page_manager.h"
 #include "src/page.h"
-#include "watcher.h"
 #include "services/timestamp.h"
+#include "services/wakeup.h"
 #include "common.h"
 #include "style.h"
+#include "monitor.h"
 
 
-static void view_watcher_cb(void *old_value, const void *memory, uint16_t size, void *user_ptr, void *arg);
+static void update_communication_error_popup(model_t *model);
+static void clear_subscriptions(void *handle);
+static uint8_t event_global_callback(void *handle, pman_event_t event);
 static void retry_communication_callback(lv_event_t *event);
 static void ignore_communication_error_callback(lv_event_t *event);
 static void toast_fade_out_timer_cb(lv_timer_t *timer);
@@ -21,7 +24,7 @@ static void toast_click_callback(lv_event_t *event);
 static struct {
     pman_t                      page_manager;
     view_protocol_t             view_protocol;
-    watcher_t                   watcher;
+    model_topics_t              subscriptions;
     communication_error_popup_t popup_communication_error;
     uint16_t                    communication_attempts;
     timestamp_t                 last_communication_attempt;
@@ -31,7 +34,7 @@ static struct {
 
 void view_init(model_t *model, view_protocol_t protocol) {
     state.view_protocol = protocol;
-    WATCHER_INIT_STD(&state.watcher, NULL);
+    state.subscriptions = 0;
 
     lv_display_t *display = lv_display_get_default();
     lv_indev_t * touch_indev = lv_indev_get_next(NULL);
@@ -43,19 +46,41 @@ void view_init(model_t *model, view_protocol_t protocol) {
     state.last_communication_attempt = timestamp_get();
     state.popup_communication_error  = view_common_communication_error_popup(lv_layer_top());
 
+    lv_label_set_text(state.popup_communication_error.lbl_msg, "Errore di comunicazione!");
+    lv_label_set_text(state.popup_communication_error.lbl_retry, "Riprova");
+    lv_label_set_text(state.popup_communication_error.lbl_disable, "Disabilita");
+
     lv_obj_add_event_cb(state.popup_communication_error.btn_retry, retry_communication_callback, LV_EVENT_CLICKED,
                         &state.page_manager);
     lv_obj_add_event_cb(state.popup_communication_error.btn_disable, ignore_communication_error_callback,
                         LV_EVENT_CLICKED, &state.page_manager);
     view_common_set_hidden(state.popup_communication_error.blanket, 1);
 
-    pman_init(&state.page_manager, (void *)model, touch_indev, NULL, NULL, NULL);
+    view_monitor_init();
+
+    pman_init(&state.page_manager, (void *)model, touch_indev, NULL, clear_subscriptions, event_global_callback);
+    pman_set_delegated_events(
+        &state.page_manager,
+        PMAN_EVENT_CODE_BIT(LV_EVENT_CLICKED) | PMAN_EVENT_CODE_BIT(LV_EVENT_VALUE_CHANGED) |
+            PMAN_EVENT_CODE_BIT(LV_EVENT_RELEASED) | PMAN_EVENT_CODE_BIT(LV_EVENT_PRESSED) |
+            PMAN_EVENT_CODE_BIT(LV_EVENT_PRESSING) | PMAN_EVENT_CODE_BIT(LV_EVENT_LONG_PRESSED) |
+            PMAN_EVENT_CODE_BIT(LV_EVENT_LONG_PRESSED_REPEAT) | PMAN_EVENT_CODE_BIT(LV_EVENT_CANCEL) |
+            PMAN_EVENT_CODE_BIT(LV_EVENT_READY) | PMAN_EVENT_CODE_BIT(LV_EVENT_SCROLL) |
+            PMAN_EVENT_CODE_BIT(LV_EVENT_SCROLL_BEGIN) | PMAN_EVENT_CODE_BIT(LV_EVENT_SCROLL_END));
 }
 
 void view_change_page(const pman_page_t *page) {
     pman_change_page(&state.page_manager, *page);
 }
 
+void view_change_page_extra(const pman_page_t *page, void *extra) {
+    pman_change_page_extra(&state.page_manager, *page, extra);
+}
+
+void view_back(void) {
+    pman_back(&state.page_manager);
+}
+
 mut_model_t *view_get_model(void *handle) {
     return pman_get_user_data(handle);
 }
@@ -80,52 +105,46 @@ void view_register_object_default_callback_with_number(lv_obj_t *obj, int id, in
     lv_obj_set_user_data(obj, (void *)(uintptr_t)((id & 0xFFFF) | ((number & 0xFFFF) << 16)));
 
     pman_unregister_obj_event(obj);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_CLICKED);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_VALUE_CHANGED);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_RELEASED);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_PRESSED);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_PRESSING);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_LONG_PRESSED);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_LONG_PRESSED_REPEAT);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_CANCEL);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_READY);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_SCROLL);
-    pman_register_obj_event(&state.page_manager, obj, LV_EVENT_SCROLL_BEGIN);
+    pman_register_obj_delegated(&state.page_manager, obj);
 }
 
 
-void view_manage(model_t *model) {
+void view_manage(mut_model_t *model) {
+    view_monitor_manage(pman_page_stack_top(&state.page_manager.page_stack));
+
     // Reset the attempt counter every minute
     if (state.communication_attempts > 0 && timestamp_is_expired(state.last_communication_attempt, 60000UL)) {
         state.communication_attempts = 0;
     }
 
-    if (model->run.minion.communication_error && model->run.minion.communication_enabled) {
-        // After 5 attempts allow the popup to disappear without retrying
-        if (state.communication_attempts >= 5) {
-            view_common_set_hidden(state.popup_communication_error.btn_disable, 0);
-            lv_obj_align(state.popup_communication_error.btn_disable, LV_ALIGN_BOTTOM_MID, -128, 0);
-            lv_obj_align(state.popup_communication_error.btn_retry, LV_ALIGN_BOTTOM_MID, 128, 0);
-        } else {
-            view_common_set_hidden(state.popup_communication_error.btn_disable, 1);
-            lv_obj_align(state.popup_communication_error.btn_retry, LV_ALIGN_BOTTOM_MID, 0, 0);
-        }
+    uint32_t       programs = 0;
+    model_topics_t topics   = model_take_published(model, &programs);
 
-        lv_label_set_text(state.popup_communication_error.lbl_msg, "Errore di comunicazione!");
-        lv_label_set_text(state.popup_communication_error.lbl_retry, "Riprova");
-        lv_label_set_text(state.popup_communication_error.lbl_disable, "Disabilita");
+    if (topics == 0) {
+        return;
+    }
 
-        view_common_set_hidden(state.popup_communication_error.blanket, 0);
-    } else {
-        view_common_set_hidden(state.popup_communication_error.blanket, 1);
+    if (topics & MODEL_TOPIC_BIT(MODEL_TOPIC_MINION_COMMUNICATION)) {
+        update_communication_error_popup(model);
     }
 
-    watcher_watch(&state.watcher, timestamp_get());
+    // Only bother the current page with what it displays
+    topics &= state.subscriptions;
+    if (topics != 0) {
+        view_event((view_event_t){
+            .tag              = VIEW_EVENT_TAG_MODEL_CHANGED,
+            .as.model_changed = {.topics = topics, .programs = programs},
+        });
+    }
 }
 
 
-void view_add_watched_variable(void *ptr, size_t size, int code) {
-    watcher_add_entry(&state.watcher, ptr, size, view_watcher_cb, (void *)(uintptr_t)code);
+/**
+ * @brief Subscribe the current page to the given topics (see `MODEL_TOPIC_BIT`).
+ * Subscriptions are dropped when the page is closed, so they must be renewed every time the page is opened.
+ */
+void view_subscribe(model_topics_t topics) {
+    state.subscriptions |= topics;
 }
 
 
@@ -248,12 +267,45 @@ static void toast_fade_out_timer_cb(lv_timer_t *timer) {
 }
 
 
-static void view_watcher_cb(void *old_value, const void *memory, uint16_t size, void *user_ptr, void *arg) {
-    (void)old_value;
-    (void)memory;
-    (void)size;
-    (void)user_ptr;
-    view_event((view_event_t){.tag = VIEW_EVENT_TAG_PAGE_WATCHER, .as.page_watcher.code = (uintptr_t)arg});
+static void update_communication_error_popup(model_t *model) {
+    if (model->run.minion.communication_error && model->run.minion.communication_enabled) {
+        // After 5 attempts allow the popup to disappear without retrying
+        if (state.communication_attempts >= 5) {
+            view_common_set_hidden(state.popup_communication_error.btn_disable, 0);
+            lv_obj_align(state.popup_communication_error.btn_disable, LV_ALIGN_BOTTOM_MID, -128, 0);
+            lv_obj_align(state.popup_communication_error.btn_retry, LV_ALIGN_BOTTOM_MID, 128, 0);
+        } else {
+            view_common_set_hidden(state.popup_communication_error.btn_disable, 1);
+            lv_obj_align(state.popup_communication_error.btn_retry, LV_ALIGN_BOTTOM_MID, 0, 0);
+        }
+
+        view_common_set_hidden(state.popup_communication_error.blanket, 0);
+    } else {
+        view_common_set_hidden(state.popup_communication_error.blanket, 1);
+    }
+}
+
+
+static void clear_subscriptions(void *handle) {
+    (void)handle;
+    state.subscriptions = 0;
+}
+
+
+/**
+ * Page events caused by input and by LVGL timers run in the LVGL task and may change the model: in the threaded build
+ * the controller must be woken up to handle them instead of waiting for its next periodic job
+ */
+static uint8_t event_global_callback(void *handle, pman_event_t event) {
+    (void)handle;
+#ifdef BUILD_CONFIG_LVGL_THREADED
+    if (event.tag == PMAN_EVENT_TAG_LVGL || event.tag == PMAN_EVENT_TAG_TIMER) {
+        wakeup_post();
+    }
+#else
+    (void)event;
+#endif
+    return 0;
 }
 
 
@@ -262,13 +314,20 @@ static void retry_communication_callback(lv_event_t *event) {
     state.last_communication_attempt = timestamp_get();
     state.view_protocol.retry_communication(lv_event_get_user_data(event));
     view_common_set_hidden(state.popup_communication_error.blanket, 1);
+#ifdef BUILD_CONFIG_LVGL_THREADED
+    wakeup_post();
+#endif
 }
 
 
 static void ignore_communication_error_callback(lv_event_t *event) {
     mut_model_t *model                      = view_get_model(lv_event_get_user_data(event));
     model->run.minion.communication_enabled = 0;
+    model_publish(model, MODEL_TOPIC_MINION_COMMUNICATION);
     view_common_set_hidden(state.popup_communication_error.blanket, 1);
+#ifdef BUILD_CONFIG_LVGL_THREADED
+    wakeup_post();
+#endif
 }
 
 
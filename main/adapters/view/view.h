@@ -5,10 +5,6 @@
 #include "model/model.h"
 
 
-#define VIEW_ADD_WATCHED_VARIABLE(ptr, code)     view_add_watched_variable((void *)ptr, sizeof(*ptr), code)
-#define VIEW_ADD_WATCHED_ARRAY(ptr, items, code) view_add_watched_variable((void *)ptr, sizeof(*ptr) * items, code)
-
-
 typedef struct {
     void (*set_test_mode)(pman_handle_t handle, uint8_t test_mode);
     void (*test_output)(pman_handle_t handle, uint16_t output_index);
@@ -25,7 +21,7 @@ typedef struct {
 
 typedef enum {
     VIEW_EVENT_TAG_STORAGE_OPERATION_COMPLETED,
-    VIEW_EVENT_TAG_PAGE_WATCHER,
+    VIEW_EVENT_TAG_MODEL_CHANGED,
 } view_event_tag_t;
 
 typedef struct {
@@ -35,8 +31,11 @@ typedef struct {
             int code;
         } storage_operation;
         struct {
-            int code;
-        } page_watcher;
+            // Subscribed topics that were published since the last notification
+            model_topics_t topics;
+            // Programs that changed, valid with MODEL_TOPIC_PROGRAM
+            uint32_t programs;
+        } model_changed;
     } as;
 } view_event_t;
 
@@ -49,12 +48,14 @@ typedef struct {
 void             view_init(model_t *model, view_protocol_t protocol);
 view_protocol_t *view_get_protocol(pman_handle_t handle);
 void             view_change_page(const pman_page_t *page);
+void             view_change_page_extra(const pman_page_t *page, void *extra);
+void             view_back(void);
 mut_model_t     *view_get_model(void *handle);
 void             view_register_object_default_callback(lv_obj_t *obj, int id);
 void             view_register_object_default_callback_with_number(lv_obj_t *obj, int id, int number);
 void             view_event(view_event_t event);
-void             view_add_watched_variable(void *ptr, size_t size, int code);
-void             view_manage(model_t *model);
+void             view_subscribe(model_topics_t topics);
+void             view_manage(mut_model_t *model);
 uint16_t         view_get_obj_id(lv_obj_t *obj);
 uint16_t         view_get_obj_number(lv_obj_t *obj);
 void             view_show_toast(uint8_t error, const char *fmt, ...);
@@ -62,7 +63,7 @@ void             view_show_toast(uint8_t error, const char *fmt, ...);
 
 extern const pman_page_t page_home, page_info, page_settings_home, page_programs_home, page_execution_home,
     page_execution_programs, page_programs_setup, page_settings, page_config, page_program, page_choice, page_execution,
-    page_info;
+    page_info, page_statistics;
 
 
 #endif
@@ -0,0 +1,462 @@
+#include <stdio.h>
+#include <string.h>
+#include "lvgl.h"
+#include "src/core/lv_obj_private.h"
+#include "src/core/lv_obj_class_private.h"
+#include "schedule_grid.h"
+
+
+#define MY_CLASS (&schedule_grid_class)
+
+_Static_assert((int)PROGRAM_PRESSURE_CHANNEL_STATE_HIGH == (int)SCHEDULE_GRID_VALUE_LEVEL_3,
+               "Pressure states must map on the grid levels");
+_Static_assert((int)PROGRAM_SENSOR_CHANNEL_THRESHOLD_FAR == (int)SCHEDULE_GRID_VALUE_LEVEL_3,
+               "Position thresholds must map on the grid levels");
+
+
+typedef struct {
+    lv_obj_t obj;
+
+    schedule_grid_look_t look;
+    int32_t              cell_width;
+    int32_t              cell_height;
+    int32_t              column_gap;
+    int32_t              row_gap;
+    lv_color_t           colors[SCHEDULE_GRID_NUM_COLORS];
+
+    // Copy of the packed schedule being shown, one column per time unit
+    program_t program;
+
+    int16_t highlighted_column;
+    int16_t pressed_row;
+    int16_t pressed_column;
+} schedule_grid_t;
+
+
+static void    schedule_grid_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void    schedule_grid_event(const lv_obj_class_t *class_p, lv_event_t *e);
+static uint8_t get_value(const program_t *program, uint16_t row, uint16_t column);
+static void    update_size(schedule_grid_t *grid);
+static void    draw_grid(schedule_grid_t *grid, lv_layer_t *layer);
+static void    draw_span(schedule_grid_t *grid, lv_layer_t *layer, uint16_t row, uint16_t first, uint16_t last);
+static void    get_span(schedule_grid_t *grid, uint16_t row, uint16_t column, uint16_t *first, uint16_t *last);
+static uint8_t is_single_unit(schedule_grid_t *grid, uint16_t row, uint16_t column);
+static void    get_cells_area(schedule_grid_t *grid, uint16_t row, uint16_t first, uint16_t last, lv_area_t *area);
+static void    invalidate_unit(schedule_grid_t *grid, uint16_t row, uint16_t column);
+static uint8_t find_cell(schedule_grid_t *grid, const lv_point_t *point, uint16_t *row, uint16_t *column);
+
+
+static const lv_obj_class_t schedule_grid_class = {
+    .base_class     = &lv_obj_class,
+    .constructor_cb = schedule_grid_constructor,
+    .event_cb       = schedule_grid_event,
+    .instance_size  = sizeof(schedule_grid_t),
+};
+
+
+lv_obj_t *schedule_grid_create(lv_obj_t *parent, schedule_grid_look_t look, int32_t cell_width, int32_t cell_height,
+                               int32_t column_gap, int32_t row_gap) {
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+
+    schedule_grid_t *grid = (schedule_grid_t *)obj;
+    grid->look            = look;
+    grid->cell_width      = cell_width;
+    grid->cell_height     = cell_height;
+    grid->column_gap      = column_gap;
+    grid->row_gap         = row_gap;
+
+    update_size(grid);
+
+    return obj;
+}
+
+
+void schedule_grid_set_colors(lv_obj_t *obj, const lv_color_t colors[SCHEDULE_GRID_NUM_COLORS]) {
+    schedule_grid_t *grid = (schedule_grid_t *)obj;
+    memcpy(grid->colors, colors, sizeof(grid->colors));
+    lv_obj_invalidate(obj);
+}
+
+
+/**
+ * Copies the schedule of the program, invalidating only the units that changed
+ */
+void schedule_grid_set_program(lv_obj_t *obj, const program_t *program) {
+    schedule_grid_t *grid = (schedule_grid_t *)obj;
+
+    if (program_get_num_time_units(program) != program_get_num_time_units(&grid->program)) {
+        // The whole layout changes
+        grid->program = *program;
+        update_size(grid);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    uint16_t columns = program_get_num_time_units(program);
+    for (uint16_t i = 0; i < SCHEDULE_GRID_ROWS; i++) {
+        for (uint16_t j = 0; j < columns; j++) {
+            if (get_value(program, i, j) != get_value(&grid->program, i, j)) {
+                if (grid->look == SCHEDULE_GRID_LOOK_SPANS) {
+                    // Spans may merge or split, redraw the whole row
+                    lv_area_t area = {0};
+                    get_cells_area(grid, i, 0, columns - 1, &area);
+                    lv_obj_invalidate_area(obj, &area);
+                    break;
+                } else {
+                    invalidate_unit(grid, i, j);
+                }
+            }
+        }
+    }
+
+    grid->program = *program;
+}
+
+
+void schedule_grid_set_highlighted_column(lv_obj_t *obj, int16_t column) {
+    schedule_grid_t *grid = (schedule_grid_t *)obj;
+
+    if (column < 0 || column >= program_get_num_time_units(&grid->program)) {
+        column = -1;
+    }
+    if (column == grid->highlighted_column) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < SCHEDULE_GRID_ROWS; i++) {
+        if (grid->highlighted_column >= 0) {
+            invalidate_unit(grid, i, grid->highlighted_column);
+        }
+        if (column >= 0) {
+            invalidate_unit(grid, i, column);
+        }
+    }
+
+    grid->highlighted_column = column;
+}
+
+
+/**
+ * Returns the unit that was last pressed on the grid
+ *
+ * @return uint8_t 1 if a unit was pressed, 0 if the touch was outside of the units
+ */
+uint8_t schedule_grid_get_pressed_cell(lv_obj_t *obj, uint16_t *row, uint16_t *column) {
+    schedule_grid_t *grid = (schedule_grid_t *)obj;
+
+    if (grid->pressed_row < 0 || grid->pressed_column < 0) {
+        return 0;
+    }
+
+    *row    = grid->pressed_row;
+    *column = grid->pressed_column;
+    return 1;
+}
+
+
+static void schedule_grid_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj) {
+    (void)class_p;
+    schedule_grid_t *grid = (schedule_grid_t *)obj;
+
+    grid->highlighted_column = -1;
+    grid->pressed_row        = -1;
+    grid->pressed_column     = -1;
+
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SNAPPABLE);
+}
+
+
+static void schedule_grid_event(const lv_obj_class_t *class_p, lv_event_t *e) {
+    (void)class_p;
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RESULT_OK) {
+        return;
+    }
+
+    lv_obj_t        *obj  = lv_event_get_current_target_obj(e);
+    schedule_grid_t *grid = (schedule_grid_t *)obj;
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_PRESSED: {
+            lv_point_t point = {0};
+            uint16_t   row = 0, column = 0;
+            lv_indev_get_point(lv_indev_active(), &point);
+
+            if (find_cell(grid, &point, &row, &column)) {
+                grid->pressed_row    = row;
+                grid->pressed_column = column;
+                invalidate_unit(grid, row, column);
+            } else {
+                grid->pressed_row    = -1;
+                grid->pressed_column = -1;
+            }
+            break;
+        }
+
+        case LV_EVENT_RELEASED:
+        case LV_EVENT_PRESS_LOST:
+            // Keep the unit for the click that follows, just remove the pressed feedback
+            if (grid->pressed_row >= 0) {
+                invalidate_unit(grid, grid->pressed_row, grid->pressed_column);
+            }
+            break;
+
+        case LV_EVENT_DRAW_MAIN:
+            draw_grid(grid, lv_event_get_layer(e));
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+static uint8_t get_value(const program_t *program, uint16_t row, uint16_t column) {
+    if (row == PROGRAM_PRESSURE_CHANNEL_INDEX) {
+        return program_get_pressure_channel_state_at(program, column);
+    } else if (row == PROGRAM_SENSOR_CHANNEL_INDEX) {
+        return program_get_sensor_channel_state_at(program, column);
+    } else if (program_get_digital_channel_state_at(program, row, column)) {
+        return SCHEDULE_GRID_VALUE_DIGITAL;
+    } else {
+        return SCHEDULE_GRID_VALUE_OFF;
+    }
+}
+
+
+static void update_size(schedule_grid_t *grid) {
+    uint16_t columns = program_get_num_time_units(&grid->program);
+
+    lv_obj_set_size(&grid->obj, LV_MAX(0, columns * (grid->cell_width + grid->column_gap) - grid->column_gap),
+                    SCHEDULE_GRID_ROWS * (grid->cell_height + grid->row_gap) - grid->row_gap);
+}
+
+
+static void draw_grid(schedule_grid_t *grid, lv_layer_t *layer) {
+    lv_obj_t *obj = &grid->obj;
+
+    lv_area_t coords = {0};
+    lv_obj_get_coords(obj, &coords);
+
+    // Only consider the units that fall in the area being redrawn
+    lv_area_t clip = {
+        .x1 = LV_MAX(coords.x1, layer->_clip_area.x1),
+        .y1 = LV_MAX(coords.y1, layer->_clip_area.y1),
+        .x2 = LV_MIN(coords.x2, layer->_clip_area.x2),
+        .y2 = LV_MIN(coords.y2, layer->_clip_area.y2),
+    };
+    if (clip.x1 > clip.x2 || clip.y1 > clip.y2) {
+        return;
+    }
+
+    uint16_t columns = program_get_num_time_units(&grid->program);
+    if (columns == 0) {
+        return;
+    }
+
+    int32_t  pitch_x      = grid->cell_width + grid->column_gap;
+    int32_t  pitch_y      = grid->cell_height + grid->row_gap;
+    uint16_t first_column = (clip.x1 - coords.x1) / pitch_x;
+    uint16_t last_column  = LV_MIN((clip.x2 - coords.x1) / pitch_x, columns - 1);
+    uint16_t first_row    = (clip.y1 - coords.y1) / pitch_y;
+    uint16_t last_row     = LV_MIN((clip.y2 - coords.y1) / pitch_y, SCHEDULE_GRID_ROWS - 1);
+
+    lv_draw_rect_dsc_t line_dsc;
+    lv_draw_rect_dsc_init(&line_dsc);
+    line_dsc.bg_color = lv_obj_get_style_line_color(obj, LV_PART_ITEMS);
+    line_dsc.bg_opa   = lv_obj_get_style_line_opa(obj, LV_PART_ITEMS);
+
+    for (uint16_t i = first_row; i <= last_row; i++) {
+        if (grid->look == SCHEDULE_GRID_LOOK_SPANS) {
+            // Rail behind the spans
+            int32_t   line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+            lv_area_t area       = {0};
+            get_cells_area(grid, i, first_column, last_column, &area);
+            area.y1 += (grid->cell_height - line_width) / 2;
+            area.y2 = area.y1 + line_width - 1;
+            lv_draw_rect(layer, &line_dsc, &area);
+        }
+
+        // Runs of equal units are drawn with a single rectangle
+        uint16_t first = 0;
+        uint16_t last  = 0;
+        get_span(grid, i, first_column, &first, &last);
+        for (;;) {
+            draw_span(grid, layer, i, first, last);
+
+            if (last >= last_column) {
+                break;
+            }
+            get_span(grid, i, last + 1, &first, &last);
+        }
+    }
+
+    if (grid->look == SCHEDULE_GRID_LOOK_CELLS) {
+        lv_draw_label_dsc_t label_dsc;
+        lv_draw_label_dsc_init(&label_dsc);
+        lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &label_dsc);
+        label_dsc.align      = LV_TEXT_ALIGN_CENTER;
+        label_dsc.text_local = 1;
+        int32_t font_height  = lv_font_get_line_height(label_dsc.font);
+
+        for (uint16_t i = first_row; i <= last_row; i++) {
+            for (uint16_t j = first_column; j <= last_column; j++) {
+                char string[8] = {0};
+                snprintf(string, sizeof(string), "%i", j + 1);
+                label_dsc.text = string;
+
+                lv_area_t area = {0};
+                get_cells_area(grid, i, j, j, &area);
+                area.y1 += (grid->cell_height - font_height) / 2;
+                area.y2 = area.y1 + font_height - 1;
+                lv_draw_label(layer, &label_dsc, &area);
+            }
+        }
+
+        // Column separators, across the row gaps as well
+        if (grid->column_gap > 0) {
+            for (uint16_t j = first_column; j <= last_column && j < columns - 1; j++) {
+                lv_area_t area = {
+                    .x1 = coords.x1 + j * pitch_x + grid->cell_width,
+                    .y1 = coords.y1,
+                    .x2 = coords.x1 + j * pitch_x + grid->cell_width + grid->column_gap - 1,
+                    .y2 = coords.y2,
+                };
+                lv_draw_rect(layer, &line_dsc, &area);
+            }
+        }
+    }
+}
+
+
+static void draw_span(schedule_grid_t *grid, lv_layer_t *layer, uint16_t row, uint16_t first, uint16_t last) {
+    lv_obj_t *obj   = &grid->obj;
+    uint8_t   value = get_value(&grid->program, row, first);
+
+    if (value == SCHEDULE_GRID_VALUE_OFF && grid->look == SCHEDULE_GRID_LOOK_SPANS) {
+        // Only the rail is visible
+        return;
+    }
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &dsc);
+
+    if (value != SCHEDULE_GRID_VALUE_OFF) {
+        lv_color_t color = grid->colors[value - 1];
+        uint8_t    highlighted =
+            grid->highlighted_column >= 0 && grid->highlighted_column >= first && grid->highlighted_column <= last;
+
+        dsc.bg_opa = LV_OPA_COVER;
+        if (highlighted) {
+            dsc.bg_color     = lv_color_lighten(color, LV_OPA_40);
+            dsc.border_color = lv_color_lighten(color, LV_OPA_10);
+        } else {
+            dsc.bg_color     = color;
+            dsc.border_color = lv_color_darken(color, LV_OPA_10);
+        }
+
+        if (grid->look == SCHEDULE_GRID_LOOK_SPANS) {
+            dsc.radius     = LV_RADIUS_CIRCLE;
+            dsc.border_opa = LV_OPA_COVER;
+        }
+    }
+
+    if (lv_obj_has_state(obj, LV_STATE_PRESSED) && grid->pressed_row == row && grid->pressed_column >= first &&
+        grid->pressed_column <= last) {
+        dsc.bg_color = lv_color_darken(dsc.bg_color, LV_OPA_20);
+    }
+
+    lv_area_t area = {0};
+    get_cells_area(grid, row, first, last, &area);
+    lv_draw_rect(layer, &dsc, &area);
+}
+
+
+/**
+ * Finds the run of units with the same value around `column`. In the cells look highlighted and pressed units are
+ * always drawn on their own
+ */
+static void get_span(schedule_grid_t *grid, uint16_t row, uint16_t column, uint16_t *first, uint16_t *last) {
+    uint8_t  value   = get_value(&grid->program, row, column);
+    uint16_t columns = program_get_num_time_units(&grid->program);
+
+    *first = column;
+    *last  = column;
+
+    if (is_single_unit(grid, row, column)) {
+        return;
+    }
+
+    while (*first > 0 && get_value(&grid->program, row, *first - 1) == value &&
+           !is_single_unit(grid, row, *first - 1)) {
+        (*first)--;
+    }
+    while (*last < columns - 1 && get_value(&grid->program, row, *last + 1) == value &&
+           !is_single_unit(grid, row, *last + 1)) {
+        (*last)++;
+    }
+}
+
+
+static uint8_t is_single_unit(schedule_grid_t *grid, uint16_t row, uint16_t column) {
+    if (grid->look == SCHEDULE_GRID_LOOK_SPANS) {
+        return 0;
+    }
+
+    return column == grid->highlighted_column || (row == grid->pressed_row && column == grid->pressed_column);
+}
+
+
+static void get_cells_area(schedule_grid_t *grid, uint16_t row, uint16_t first, uint16_t last, lv_area_t *area) {
+    lv_area_t coords = {0};
+    lv_obj_get_coords(&grid->obj, &coords);
+
+    area->x1 = coords.x1 + first * (grid->cell_width + grid->column_gap);
+    area->x2 = coords.x1 + last * (grid->cell_width + grid->column_gap) + grid->cell_width - 1;
+    area->y1 = coords.y1 + row * (grid->cell_height + grid->row_gap);
+    area->y2 = area->y1 + grid->cell_height - 1;
+}
+
+
+static void invalidate_unit(schedule_grid_t *grid, uint16_t row, uint16_t column) {
+    uint16_t first = column;
+    uint16_t last  = column;
+
+    if (grid->look == SCHEDULE_GRID_LOOK_SPANS) {
+        if (get_value(&grid->program, row, column) == SCHEDULE_GRID_VALUE_OFF) {
+            // Only the rail, which never changes
+            return;
+        }
+        get_span(grid, row, column, &first, &last);
+    }
+
+    lv_area_t area = {0};
+    get_cells_area(grid, row, first, last, &area);
+    lv_obj_invalidate_area(&grid->obj, &area);
+}
+
+
+static uint8_t find_cell(schedule_grid_t *grid, const lv_point_t *point, uint16_t *row, uint16_t *column) {
+    lv_area_t coords = {0};
+    lv_obj_get_coords(&grid->obj, &coords);
+
+    int32_t x = point->x - coords.x1;
+    int32_t y = point->y - coords.y1;
+    if (x < 0 || y < 0) {
+        return 0;
+    }
+
+    x /= grid->cell_width + grid->column_gap;
+    y /= grid->cell_height + grid->row_gap;
+    if (x >= program_get_num_time_units(&grid->program) || y >= SCHEDULE_GRID_ROWS) {
+        return 0;
+    }
+
+    *row    = y;
+    *column = x;
+    return 1;
+}
@@ -0,0 +1,52 @@
+#ifndef SCHEDULE_GRID_H_INCLUDED
+#define SCHEDULE_GRID_H_INCLUDED
+
+
+#include <stdint.h>
+#include "lvgl.h"
+#include "model/program.h"
+
+
+/*
+ * Single object drawing the whole channel schedule of a program (one row per programmable channel, one column per
+ * time unit) instead of one LVGL object per unit. The width follows the length of the program.
+ *
+ * Styling:
+ *  - LV_PART_ITEMS background: empty units
+ *  - LV_PART_ITEMS text: unit numbers (cells look only)
+ *  - LV_PART_ITEMS line color: separators between columns (cells look) or the rail behind each row (spans look)
+ *  - LV_PART_ITEMS border width: border of the active spans (spans look only)
+ */
+
+
+#define SCHEDULE_GRID_ROWS PROGRAM_NUM_PROGRAMMABLE_CHANNELS
+
+
+typedef enum {
+    // Every unit is a numbered square; columns are separated by a line
+    SCHEDULE_GRID_LOOK_CELLS = 0,
+    // Consecutive units with the same value are merged in a rounded span over a rail
+    SCHEDULE_GRID_LOOK_SPANS,
+} schedule_grid_look_t;
+
+typedef enum {
+    SCHEDULE_GRID_VALUE_OFF = 0,
+    // Pressure states and position thresholds
+    SCHEDULE_GRID_VALUE_LEVEL_1,
+    SCHEDULE_GRID_VALUE_LEVEL_2,
+    SCHEDULE_GRID_VALUE_LEVEL_3,
+    // Active digital channel
+    SCHEDULE_GRID_VALUE_DIGITAL,
+#define SCHEDULE_GRID_NUM_COLORS 4
+} schedule_grid_value_t;
+
+
+lv_obj_t *schedule_grid_create(lv_obj_t *parent, schedule_grid_look_t look, int32_t cell_width, int32_t cell_height,
+                               int32_t column_gap, int32_t row_gap);
+void      schedule_grid_set_colors(lv_obj_t *obj, const lv_color_t colors[SCHEDULE_GRID_NUM_COLORS]);
+void      schedule_grid_set_program(lv_obj_t *obj, const program_t *program);
+void      schedule_grid_set_highlighted_column(lv_obj_t *obj, int16_t column);
+uint8_t   schedule_grid_get_pressed_cell(lv_obj_t *obj, uint16_t *row, uint16_t *column);
+
+
+#endif
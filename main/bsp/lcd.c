@@ -50,6 +50,17 @@ void bsp_lcd_init(void) {
 }
 
 
+void bsp_lcd_lock(void) {
+    // Waits indefinitely
+    lvgl_port_lock(0);
+}
+
+
+void bsp_lcd_unlock(void) {
+    lvgl_port_unlock();
+}
+
+
 static lv_display_t *bsp_display_lcd_init(const bsp_display_cfg_t *cfg) {
     assert(cfg != NULL);
     bsp_lcd_handles_t lcd_panels;
@@ -3,6 +3,8 @@
 
 
 void bsp_lcd_init(void);
+void bsp_lcd_lock(void);
+void bsp_lcd_unlock(void);
 
 
 #endif
@@ -24,20 +24,35 @@
 
 #define APP_CONFIG_CONFIGURATION_EXTENSION ".pressa.bin"
 #define APP_CONFIG_CONFIGURATION_PATH      APP_CONFIG_DATA_PATH "/configurazione" APP_CONFIG_CONFIGURATION_EXTENSION
+#define APP_CONFIG_STATISTICS_PATH         APP_CONFIG_DATA_PATH "/statistiche.bin"
+// Saves are written here first and then renamed over the destination
+#define APP_CONFIG_TEMPORARY_SAVE_PATH     APP_CONFIG_DATA_PATH "/salvataggio.tmp"
 #define APP_CONFIG_DRIVE_MOUNT_PATH        "/tmp/mnt"
 #define APP_CONFIG_LOGFILE                 "/tmp/pressa_log.txt"
+#define APP_CONFIG_EVENT_LOGFILE           "/tmp/pressa_events.bin"
 #define MAX_LOGFILE_SIZE                   4000000UL
+#define APP_CONFIG_LOG_SEGMENTS            4
+#define APP_CONFIG_LOG_SEGMENT_SIZE        (MAX_LOGFILE_SIZE / APP_CONFIG_LOG_SEGMENTS)
 
 #define APP_CONFIG_MIN_TIME_UNIT_DECISECS       5
 #define APP_CONFIG_MAX_TIME_UNIT_DECISECS       50
+// The power board holds this many time units; programs cannot be longer until its protocol carries more
+#define APP_CONFIG_MAX_TIME_UNITS               25
 #define APP_CONFIG_MIN_PRESSURE_LEVEL           0
 #define APP_CONFIG_MAX_PRESSURE_LEVEL           60
+#define APP_CONFIG_MAX_PRESSURE_DAC_LEVEL       100
 #define APP_CONFIG_MIN_SENSOR_LEVEL             0
 #define APP_CONFIG_MAX_SENSOR_LEVEL             4096
 #define APP_CONFIG_MIN_HEADGAP_OFFSET           1
 #define APP_CONFIG_MAX_HEADGAP_OFFSET           10
 #define APP_CONFIG_MIN_POSITION_SENSOR_SCALE_MM 10
 #define APP_CONFIG_MAX_POSITION_SENSOR_SCALE_MM 200
+#define APP_CONFIG_MAX_POSITION_LEAD_MM         10
+
+#define APP_CONFIG_MINION_SYNC_PERIOD_MS  200UL
+#define APP_CONFIG_NETWORK_POLL_PERIOD_MS 2000UL
+// Production counters are saved at most this often, and only if something changed
+#define APP_CONFIG_STATISTICS_SAVE_PERIOD_MS (5UL * 60UL * 1000UL)
 
 
 #endif
@@ -1,5 +1,7 @@
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <time.h>
 #include "lvgl.h"
 #include "controller.h"
 #include "model/model.h"
@@ -12,23 +14,55 @@
 #include "gui.h"
 #include "minion.h"
 #include "services/timestamp.h"
+#include "services/event_log.h"
+#include "services/wakeup.h"
+#include "services/system_time.h"
 
 
-static void load_programs_callback(model_t *pmodel, void *data, void *arg);
+static void          load_programs_callback(model_t *pmodel, void *data, void *arg);
+static void          update_drive_state(mut_model_t *model);
+static unsigned long run_periodic_jobs(mut_model_t *model);
+static void          run_periodic_job(mut_model_t *model, uint16_t job);
+static int16_t       get_local_hour(void);
+static uint32_t      extend_elapsed_ms(const minion_read_t *previous_read, uint16_t sampled_ms, uint32_t duration_ms);
+static uint8_t       poll_network(mut_model_t *model);
+static uint32_t      hash_networks(const wifi_network_t *networks, size_t num_networks);
+
+
+enum {
+    PERIODIC_JOB_SYNC_MINION = 0,
+    PERIODIC_JOB_SAVE_STATISTICS,
+    PERIODIC_JOB_NETWORK,
+#define PERIODIC_NUM_JOBS 3
+};
+
+// Longest advance of the elapsed time between two samples of the same cycle
+#define ELAPSED_MAX_STEP_MS 5000U
 
 
 static const char *TAG = __FILE_NAME__;
 
+static const unsigned long periodic_job_periods_ms[PERIODIC_NUM_JOBS] = {
+    [PERIODIC_JOB_SYNC_MINION]     = APP_CONFIG_MINION_SYNC_PERIOD_MS,
+    [PERIODIC_JOB_SAVE_STATISTICS] = APP_CONFIG_STATISTICS_SAVE_PERIOD_MS,
+    // The network has no task of its own, its state can only be polled
+    [PERIODIC_JOB_NETWORK] = APP_CONFIG_NETWORK_POLL_PERIOD_MS,
+};
+// All due at the first pass
+static timestamp_t periodic_job_deadlines[PERIODIC_NUM_JOBS] = {0};
+
 
 void controller_init(mut_model_t *model) {
     (void)model;
 
+    wakeup_init();
     minion_init();
     ESP_LOGI(TAG, "minion");
     network_init();
     ESP_LOGI(TAG, "network");
 
     disk_op_init();
+    disk_op_load_statistics();
     ESP_LOGI(TAG, "disk");
     /*
     disk_op_load_config();
@@ -55,45 +89,78 @@ void controller_init(mut_model_t *model) {
 }
 
 
-void controller_manage(mut_model_t *model) {
-    controller_gui_manage(model);
+/**
+ * Handles everything the tasks posted and the periodic jobs that are due
+ *
+ * @return unsigned long milliseconds the caller can sleep before the next pass, unless woken up earlier
+ */
+unsigned long controller_manage(mut_model_t *model) {
+    // Programs and parameters are edited by the view
+    model_update_current_timeline(model);
+    model_update_calibration(model);
 
     {
+        // Passes are driven by the responses, so take all of them
         minion_response_t response = {0};
-        if (minion_get_response(&response)) {
+        while (minion_get_response(&response)) {
             switch (response.tag) {
                 case MINION_RESPONSE_TAG_ERROR: {
                     model->run.minion.communication_error = 1;
+                    model_publish(model, MODEL_TOPIC_MINION_COMMUNICATION);
+                    EVENT_LOG(CONTROLLER_COMMUNICATION_ERROR);
                     break;
                 }
 
                 case MINION_RESPONSE_TAG_SYNC: {
-                    model->run.minion.read.firmware_version_major = response.as.sync.firmware_version_major;
-                    model->run.minion.read.firmware_version_minor = response.as.sync.firmware_version_minor;
-                    model->run.minion.read.firmware_version_patch = response.as.sync.firmware_version_patch;
-                    model->run.minion.read.inputs                 = response.as.sync.inputs;
-                    model->run.minion.read.v0_10_adc              = response.as.sync.v0_10_adc;
-                    model->run.minion.read.ma4_adc                = response.as.sync.ma4_adc;
-                    model->run.minion.read.ma20_adc               = response.as.sync.ma20_adc;
-                    model->run.minion.read.ma4_20_adc             = response.as.sync.ma4_20_adc;
-                    model->run.minion.read.running                = response.as.sync.running;
-                    model->run.minion.read.elapsed_milliseconds   = response.as.sync.elapsed_time_ms;
-
-
-                    if (model_is_program_ready(model)) {
-                        const program_t *program = model_get_current_program(model);
-
-                        uint16_t time_unit_index =
-                            model->run.minion.read.elapsed_milliseconds / (program->time_unit_decisecs * 100);
-                        if (time_unit_index < PROGRAM_NUM_TIME_UNITS) {
-                            size_t  sensor_threshold_index = program->sensor_channel[time_unit_index];
-                            int16_t position_target        = model->config.ma4_20_offset +
-                                                      (int16_t)model_position_mm_to_adc(
-                                                          model, program->position_levels[sensor_threshold_index - 1]);
-
-                            ESP_LOGI(TAG, "MA420: %4i, %4i", model->run.minion.read.ma4_20_adc, position_target);
+                    for (uint16_t i = 0; i < response.as.sync.num_boards; i++) {
+                        minion_read_t *read          = &model->run.boards[i].read;
+                        minion_read_t  previous_read = {0};
+                        memcpy(&previous_read, read, sizeof(previous_read));
+
+                        read->firmware_version_major = response.as.sync.boards[i].firmware_version_major;
+                        read->firmware_version_minor = response.as.sync.boards[i].firmware_version_minor;
+                        read->firmware_version_patch = response.as.sync.boards[i].firmware_version_patch;
+                        read->inputs                 = response.as.sync.boards[i].inputs;
+                        read->v0_10_adc              = response.as.sync.boards[i].v0_10_adc;
+                        read->ma4_adc                = response.as.sync.boards[i].ma4_adc;
+                        read->ma20_adc               = response.as.sync.boards[i].ma20_adc;
+                        read->ma4_20_adc             = response.as.sync.boards[i].ma4_20_adc;
+                        read->running                = response.as.sync.boards[i].running;
+                        read->elapsed_milliseconds   = extend_elapsed_ms(
+                            &previous_read, response.as.sync.boards[i].elapsed_time_ms,
+                            program_get_duration_milliseconds(model_get_current_program(model, i)));
+
+                        if (memcmp(&previous_read, read, sizeof(previous_read)) != 0) {
+                            model_publish(model, MODEL_TOPIC_MINION_READ);
+                        }
+                        if (previous_read.elapsed_milliseconds != read->elapsed_milliseconds) {
+                            model_publish(model, MODEL_TOPIC_MINION_ELAPSED_TIME);
                         }
                     }
+                    model_update_calibration(model);
+
+                    // The program of the next form is already compiled, send it before the pedal is pressed
+                    if (model_update_carousel(model)) {
+                        EVENT_LOG(CONTROLLER_CAROUSEL_FORM, model_get_active_form(model) + 1,
+                                  model_get_form_cycles(model, model_get_active_form(model)));
+                        controller_sync_minion(model);
+                    }
+
+                    model_update_statistics(model, timestamp_get(), get_local_hour());
+
+                    // Without a threshold there is no target to sample against
+                    uint16_t position_target = model_get_current_position_target_adc(model);
+                    if (position_target != POSITION_ESTIMATOR_NO_TARGET) {
+                        EVENT_LOG(CONTROLLER_POSITION_SAMPLE, model->run.boards[POSITION_SENSOR_BOARD].read.ma4_20_adc,
+                                  position_target);
+                    }
+
+                    if (model_add_position_sample(model, timestamp_get())) {
+                        const position_estimator_t *estimator = &model->run.position_estimator;
+                        EVENT_LOG(CONTROLLER_POSITION_STROKE, position_estimator_get_last_overshoot(estimator),
+                                  position_estimator_get_stop_lag_ms(estimator, POSITION_ESTIMATOR_DIRECTION_UP),
+                                  position_estimator_get_stop_lag_ms(estimator, POSITION_ESTIMATOR_DIRECTION_DOWN));
+                    }
 
                     break;
                 }
@@ -103,7 +170,7 @@ void controller_manage(mut_model_t *model) {
 
     {
         disk_op_response_t response = {0};
-        if (disk_op_get_response(&response)) {
+        while (disk_op_get_response(&response)) {
             switch (response.tag) {
                 case DISK_OP_RESPONSE_TAG_ERROR:
                     view_show_toast(1, "Operazione su disco fallita!");
@@ -111,54 +178,28 @@ void controller_manage(mut_model_t *model) {
 
                 case DISK_OP_RESPONSE_TAG_CONFIGURATION_EXPORTED:
                     disk_op_update_importable_configurations(model);
+                    model_publish(model, MODEL_TOPIC_DRIVE);
                     break;
 
-                default:
+                case DISK_OP_RESPONSE_TAG_STATISTICS_LOADED:
+                    // Also when nothing was loaded, so that counting starts
+                    model_set_statistics(model, response.as.statistics_loaded.statistics);
+                    free(response.as.statistics_loaded.statistics);
                     break;
-            }
-        }
-    }
 
-    {
-        static timestamp_t ts = 0;
-        if (timestamp_is_expired(ts, 200)) {
-            controller_sync_minion(model);
-
-            uint8_t drive_mounted = disk_op_is_drive_mounted();
-
-            if (drive_mounted && !model->run.drive_mounted) {
-                disk_op_update_importable_configurations(model);
-                model->run.firmware_update_ready = disk_op_is_firmware_present();
+                default:
+                    break;
             }
-            model->run.drive_mounted = drive_mounted;
-
-            ts = timestamp_get();
         }
     }
 
-    {
-        static timestamp_t ts = 0;
-        if (timestamp_is_expired(ts, 2000)) {
-            model->network.num_networks = network_read_wifi_scan(&model->network.networks);
-            wifi_status_t status        = network_status(model->network.ssid);
+    update_drive_state(model);
 
-            if (status != WIFI_SCANNING) {
-                model->network.net_status = status;
-            }
-            int ip1 = 0, ip2 = 0;
-            if (status == WIFI_CONNECTED) {
-                ip1 = network_get_ip_address(APP_CONFIG_IFWIFI, model->network.wifi_ipaddr);
-            } else {
-                strcpy(model->network.wifi_ipaddr, "_._._._");
-            }
+    unsigned long next_ms = run_periodic_jobs(model);
+    // Last, so that the view sees everything that changed in this pass
+    uint32_t gui_next_ms = controller_gui_manage(model);
 
-            ip2 = network_get_ip_address(APP_CONFIG_IFETH, model->network.eth_ipaddr);
-
-            model->run.network_connected = ip1 || ip2;
-
-            ts = timestamp_get();
-        }
-    }
+    return gui_next_ms < next_ms ? gui_next_ms : next_ms;
 }
 
 
@@ -182,8 +223,191 @@ static void load_programs_callback(model_t *pmodel, void *data, void *arg) {
 #endif
 
 
-void controller_sync_minion(model_t *model) {
+void controller_sync_minion(mut_model_t *model) {
     if (model_is_communication_ok(model)) {
+        // The program may have been selected or edited since the last cycle
+        model_update_current_timeline(model);
+        model_update_calibration(model);
         minion_sync(model);
     }
 }
+
+
+/**
+ * @return int16_t the hour of the local time, -1 while the clock is not set
+ */
+static int16_t get_local_hour(void) {
+    if (!system_time_is_set()) {
+        return -1;
+    }
+
+    time_t    now = time(NULL);
+    struct tm tm  = {0};
+    localtime_r(&now, &tm);
+    return tm.tm_hour;
+}
+
+
+/**
+ * The board counts the elapsed time of the cycle on 16 bits, which wrap after about a minute. While a cycle runs the
+ * counter advances by little between two samples; a larger jump means a new cycle started.
+ * The board may keep `running` set across back to back cycles, so the restart of the counter is also recognized: a
+ * step backwards when the cycle is too short to wrap, going past the end of the program otherwise. Without a program
+ * (`duration_ms` 0) only the `running` edge and the large jumps are left.
+ */
+static uint32_t extend_elapsed_ms(const minion_read_t *previous_read, uint16_t sampled_ms, uint32_t duration_ms) {
+    uint16_t previous_sampled_ms = (uint16_t)previous_read->elapsed_milliseconds;
+    uint16_t step_ms             = (uint16_t)(sampled_ms - previous_sampled_ms);
+    uint32_t extended_ms         = previous_read->elapsed_milliseconds + step_ms;
+
+    if (!previous_read->running || step_ms > ELAPSED_MAX_STEP_MS) {
+        return sampled_ms;
+    } else if (duration_ms > 0 && duration_ms <= UINT16_MAX && sampled_ms < previous_sampled_ms) {
+        return sampled_ms;
+    } else if (duration_ms > UINT16_MAX && extended_ms > duration_ms) {
+        return sampled_ms;
+    } else {
+        return extended_ms;
+    }
+}
+
+
+/**
+ * The disk task wakes the loop up when a drive is mounted or removed
+ */
+static void update_drive_state(mut_model_t *model) {
+    uint8_t drive_mounted = disk_op_is_drive_mounted();
+
+    if (drive_mounted && !model->run.drive_mounted) {
+        disk_op_update_importable_configurations(model);
+
+        uint8_t firmware_update_ready = disk_op_is_firmware_present();
+        if (firmware_update_ready != model->run.firmware_update_ready) {
+            model->run.firmware_update_ready = firmware_update_ready;
+            model_publish(model, MODEL_TOPIC_FIRMWARE_UPDATE);
+        }
+    }
+    if (drive_mounted != model->run.drive_mounted) {
+        model->run.drive_mounted = drive_mounted;
+        model_publish(model, MODEL_TOPIC_DRIVE);
+    }
+}
+
+
+/**
+ * Runs the jobs that are due
+ *
+ * @return unsigned long milliseconds to the next deadline
+ */
+static unsigned long run_periodic_jobs(mut_model_t *model) {
+    timestamp_t   now     = timestamp_get();
+    unsigned long next_ms = APP_CONFIG_MINION_SYNC_PERIOD_MS;
+
+    for (uint16_t i = 0; i < PERIODIC_NUM_JOBS; i++) {
+        if (TIMESTAMP_AFTER_OR_EQUAL(now, periodic_job_deadlines[i])) {
+            run_periodic_job(model, i);
+            // A late job is not caught up with, the next run is a whole period away
+            periodic_job_deadlines[i] = now + periodic_job_periods_ms[i];
+        }
+
+        unsigned long remaining_ms = periodic_job_deadlines[i] - now;
+        if (remaining_ms < next_ms) {
+            next_ms = remaining_ms;
+        }
+    }
+
+    return next_ms;
+}
+
+
+static void run_periodic_job(mut_model_t *model, uint16_t job) {
+    switch (job) {
+        case PERIODIC_JOB_SYNC_MINION:
+            controller_sync_minion(model);
+            break;
+
+        case PERIODIC_JOB_SAVE_STATISTICS:
+            if (model->run.statistics.unsaved) {
+                disk_op_save_statistics(model_get_statistics(model));
+                model->run.statistics.unsaved = 0;
+            }
+            break;
+
+        case PERIODIC_JOB_NETWORK:
+            // The settings page rebuilds the network list on every publication, resetting its scroll
+            if (poll_network(model)) {
+                model_publish(model, MODEL_TOPIC_NETWORK);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+/**
+ * @return uint8_t 1 if the state, the addresses or the scanned networks changed
+ */
+static uint8_t poll_network(mut_model_t *model) {
+    char previous_wifi_ipaddr[sizeof(model->network.wifi_ipaddr)] = {0};
+    char previous_eth_ipaddr[sizeof(model->network.eth_ipaddr)]   = {0};
+    char previous_ssid[sizeof(model->network.ssid)]               = {0};
+    memcpy(previous_wifi_ipaddr, model->network.wifi_ipaddr, sizeof(previous_wifi_ipaddr));
+    memcpy(previous_eth_ipaddr, model->network.eth_ipaddr, sizeof(previous_eth_ipaddr));
+    memcpy(previous_ssid, model->network.ssid, sizeof(previous_ssid));
+
+    wifi_status_t previous_status       = model->network.net_status;
+    uint8_t       previous_connected    = model->run.network_connected;
+    size_t        previous_num_networks = model->network.num_networks;
+    // The scan may reuse the same buffer, only a digest of the previous results can be kept
+    uint32_t previous_networks = hash_networks(model->network.networks, model->network.num_networks);
+
+    model->network.num_networks = network_read_wifi_scan(&model->network.networks);
+    wifi_status_t status        = network_status(model->network.ssid);
+
+    if (status != WIFI_SCANNING) {
+        model->network.net_status = status;
+    }
+    int ip1 = 0, ip2 = 0;
+    if (status == WIFI_CONNECTED) {
+        ip1 = network_get_ip_address(APP_CONFIG_IFWIFI, model->network.wifi_ipaddr);
+    } else {
+        strcpy(model->network.wifi_ipaddr, "_._._._");
+    }
+
+    ip2 = network_get_ip_address(APP_CONFIG_IFETH, model->network.eth_ipaddr);
+
+    model->run.network_connected = ip1 || ip2;
+
+    return previous_status != model->network.net_status || previous_connected != model->run.network_connected ||
+           memcmp(previous_wifi_ipaddr, model->network.wifi_ipaddr, sizeof(previous_wifi_ipaddr)) != 0 ||
+           memcmp(previous_eth_ipaddr, model->network.eth_ipaddr, sizeof(previous_eth_ipaddr)) != 0 ||
+           memcmp(previous_ssid, model->network.ssid, sizeof(previous_ssid)) != 0 ||
+           previous_num_networks != model->network.num_networks ||
+           previous_networks != hash_networks(model->network.networks, model->network.num_networks);
+}
+
+
+/**
+ * FNV-1a over the names and signals of the networks, as shown in the list
+ */
+static uint32_t hash_networks(const wifi_network_t *networks, size_t num_networks) {
+    uint32_t hash = 2166136261UL;
+
+    for (size_t i = 0; i < num_networks && networks != NULL; i++) {
+        const uint8_t *ssid = (const uint8_t *)networks[i].ssid;
+        for (size_t j = 0; j < sizeof(networks[i].ssid) && ssid[j] != '\0'; j++) {
+            hash = (hash ^ ssid[j]) * 16777619UL;
+        }
+        // Separates the names
+        hash = (hash ^ 0) * 16777619UL;
+
+        uint32_t signal = (uint32_t)networks[i].signal;
+        for (size_t j = 0; j < sizeof(signal); j++) {
+            hash = (hash ^ ((signal >> (j * 8)) & 0xFF)) * 16777619UL;
+        }
+    }
+
+    return hash;
+}
@@ -4,9 +4,9 @@
 #include "model/model.h"
 
 
-void controller_init(mut_model_t *model);
-void controller_manage(mut_model_t *model);
-void controller_sync_minion(model_t *model);
+void          controller_init(mut_model_t *model);
+unsigned long controller_manage(mut_model_t *model);
+void          controller_sync_minion(mut_model_t *model);
 
 
 
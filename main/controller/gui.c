@@ -39,7 +39,15 @@ view_protocol_t gui_view_protocol = {
 static const char *TAG = __FILE_NAME__;
 
 
-void controller_gui_manage(mut_model_t *model) {
+/**
+ * @return uint32_t milliseconds before LVGL has to run again from here, LV_NO_TIMER_READY if it runs elsewhere
+ */
+uint32_t controller_gui_manage(mut_model_t *model) {
+#ifdef BUILD_CONFIG_LVGL_THREADED
+    // Ticks and rendering are handled by the LVGL thread; the caller already holds the LVGL lock
+    view_manage(model);
+    return LV_NO_TIMER_READY;
+#else
 #ifndef BUILD_CONFIG_SIMULATOR
     static timestamp_t last_invoked = 0;
 
@@ -49,10 +57,15 @@ void controller_gui_manage(mut_model_t *model) {
         }
         last_invoked = timestamp_get();
     }
-#endif
 
     view_manage(model);
-    lv_timer_handler();
+    // Invoked by the loop timer of app_main, from within lv_timer_handler already
+    return LV_NO_TIMER_READY;
+#else
+    view_manage(model);
+    return lv_timer_handler();
+#endif
+#endif
 }
 
 
@@ -110,6 +123,7 @@ static void retry_communication(pman_handle_t handle) {
 
     mut_model_t *model                    = view_get_model(handle);
     model->run.minion.communication_error = 0;
+    model_publish(model, MODEL_TOPIC_MINION_COMMUNICATION);
 }
 
 
@@ -5,7 +5,7 @@
 #include "adapters/view/view.h"
 
 
-void controller_gui_manage(mut_model_t *model);
+uint32_t controller_gui_manage(mut_model_t *model);
 
 
 extern view_protocol_t gui_view_protocol;
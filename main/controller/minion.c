@@ -1,6 +1,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
+#include <stdatomic.h>
 #include <assert.h>
 #include <unistd.h>
 #include <string.h>
@@ -9,7 +10,11 @@
 #include <esp_log.h>
 #include "bsp/rs232.h"
 #include "model/model.h"
+#include "config/app_config.h"
 #include "services/timestamp.h"
+#include "services/event_log.h"
+#include "services/wakeup.h"
+#include "services/snapshot.h"
 
 #define LIGHTMODBUS_MASTER_FULL
 #define LIGHTMODBUS_DEBUG
@@ -31,8 +36,17 @@
 #define MODBUS_HR_TEST_MODE      0
 #define MODBUS_HR_PROGRAM_NUMBER 11
 
+// The boards answer at consecutive addresses, the first one is wired to the position sensor
 #define MINION_ADDR 1
 
+// The register map of the minion holds a fixed window of the program
+#define MINION_TIME_UNITS           25
+#define MINION_LEVELS_PER_REGISTER  4
+#define MINION_LEVEL_REGISTERS      ((MINION_TIME_UNITS + MINION_LEVELS_PER_REGISTER - 1) / MINION_LEVELS_PER_REGISTER)
+#define MINION_PROGRAM_REGISTERS    57
+
+_Static_assert(APP_CONFIG_MAX_TIME_UNITS <= MINION_TIME_UNITS, "Programs must fit entirely in the power board");
+
 #define COMMAND_REGISTER_NONE         0
 #define COMMAND_REGISTER_RESUME       1
 #define COMMAND_REGISTER_PAUSE        2
@@ -46,25 +60,29 @@ typedef enum {
 } task_message_tag_t;
 
 
-struct __attribute__((packed)) task_message {
+// What the boards are synchronized to; shared with the task through a snapshot, the requests only carry the tag
+typedef struct {
+    uint8_t         test_on;
+    machine_model_t machine_model;
+    uint16_t        outputs;
+    uint16_t        pwm;
+    uint16_t        headgap_offset_up;
+    uint16_t        headgap_offset_down;
+    uint16_t        num_boards;
+
+    struct {
+        uint32_t digital_channels[PROGRAM_NUM_CHANNELS];
+        uint8_t  dac_channel[MINION_TIME_UNITS];
+        uint8_t  sensor_channel[MINION_TIME_UNITS];
+        uint16_t time_unit_decisecs;
+        uint16_t dac_levels[PROGRAM_PRESSURE_LEVELS];
+        uint16_t adc_levels[PROGRAM_SENSOR_LEVELS];
+    } boards[NUM_BOARDS];
+} sync_state_t;
+
+
+struct task_message {
     task_message_tag_t tag;
-
-    union {
-        struct {
-            uint8_t                            test_on;
-            machine_model_t                    machine_model;
-            uint16_t                           outputs;
-            uint16_t                           pwm;
-            uint16_t                           headgap_offset_up;
-            uint16_t                           headgap_offset_down;
-            program_digital_channel_schedule_t digital_channels[PROGRAM_NUM_CHANNELS];
-            program_pressure_channel_state_t   dac_channel[PROGRAM_NUM_TIME_UNITS];
-            program_sensor_channel_threshold_t sensor_channel[PROGRAM_NUM_TIME_UNITS];
-            uint16_t                           time_unit_decisecs;
-            uint16_t                           dac_levels[PROGRAM_PRESSURE_LEVELS];
-            uint16_t                           adc_levels[PROGRAM_SENSOR_LEVELS];
-        } sync;
-    } as;
 };
 
 
@@ -76,6 +94,11 @@ typedef struct {
 
 static void        minion_task(void *args);
 uint8_t            handle_message(ModbusMaster *master, struct task_message message);
+static void        fill_board_program(model_t *model, sync_state_t *sync, uint16_t board);
+static uint16_t    read_sync_state(uint16_t values[NUM_BOARDS][MINION_PROGRAM_REGISTERS]);
+static void        pack_board(const sync_state_t *sync, uint16_t board, uint16_t *values);
+static int         read_board(ModbusMaster *master, minion_response_t *response, uint16_t board);
+static int         write_board(ModbusMaster *master, const uint16_t *values, uint16_t board);
 static ModbusError exception_callback(const ModbusMaster *master, uint8_t address, uint8_t function,
                                       ModbusExceptionCode code);
 static ModbusError data_callback(const ModbusMaster *master, const ModbusDataCallbackArgs *args);
@@ -85,14 +108,23 @@ static int read_holding_registers(ModbusMaster *master, uint16_t *registers, uin
                                   uint16_t count);
 static int read_input_registers(ModbusMaster *master, uint16_t *registers, uint8_t address, uint16_t start,
                                 uint16_t count);
+static size_t pack_levels(uint16_t *registers, const uint8_t *levels);
 
 
-static const char   *TAG = __FILE_NAME__;
-static QueueHandle_t requestq;
-static QueueHandle_t responseq;
+static const char          *TAG = __FILE_NAME__;
+static QueueHandle_t        requestq;
+static QueueHandle_t        responseq;
+static snapshot_t           sync_snapshot;
+// Set while a sync request is queued, so that a slow bus does not pile up requests for outdated states
+static atomic_uint_least8_t sync_pending;
 
 
 void minion_init(void) {
+    {
+        static sync_state_t sync_memory[2] = {0};
+        snapshot_init(&sync_snapshot, sync_memory, sizeof(sync_state_t));
+        atomic_init(&sync_pending, 0);
+    }
     {
         static StaticQueue_t static_queue;
         static uint8_t       queue_buffer[sizeof(struct task_message) * 8] = {0};
@@ -124,44 +156,37 @@ void minion_retry_communication(void) {
 }
 
 
+/**
+ * Publishes the state of every board at once, so that all of them are synchronized within the same cycle.
+ * The state is built in place in the snapshot; the task always sends the latest one, so a request is queued only if
+ * none is already waiting.
+ * Called both by the controller loop and by view callbacks in the LVGL task: holding the LVGL lock is what keeps the
+ * snapshot with a single writer.
+ */
 void minion_sync(model_t *model) {
-    const program_t *program = model_get_current_program(model);
-
-    struct task_message msg = {
-        .tag = TASK_MESSAGE_TAG_SYNC,
-        .as =
-            {
-                .sync =
-                    {
-                        .test_on             = model->run.minion.write.test_on,
-                        .outputs             = model->run.minion.write.outputs,
-                        .pwm                 = model->run.minion.write.pwm,
-                        .machine_model       = model->config.machine_model,
-                        .headgap_offset_up   = model_position_mm_to_adc(model, model->config.headgap_offset_up),
-                        .headgap_offset_down = model_position_mm_to_adc(model, model->config.headgap_offset_down),
-                        .time_unit_decisecs  = program->time_unit_decisecs,
-                    },
-            },
-    };
-
-    for (size_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
-        msg.as.sync.digital_channels[i] = program->digital_channels[i];
+    sync_state_t *sync = snapshot_write_begin(&sync_snapshot);
+    // The buffer still holds an older state
+    memset(sync, 0, sizeof(sync_state_t));
+
+    sync->test_on             = model->run.minion.write.test_on;
+    sync->outputs             = model->run.minion.write.outputs;
+    sync->pwm                 = model->run.minion.write.pwm;
+    sync->machine_model       = model->config.machine_model;
+    sync->headgap_offset_up   = model_position_mm_to_adc(model, model->config.headgap_offset_up);
+    sync->headgap_offset_down = model_position_mm_to_adc(model, model->config.headgap_offset_down);
+    sync->num_boards          = model_get_num_boards(model);
+
+    for (uint16_t i = 0; i < sync->num_boards; i++) {
+        fill_board_program(model, sync, i);
     }
-    // Last channel is always active during the cycle
-    msg.as.sync.digital_channels[PROGRAM_NUM_PROGRAMMABLE_CHANNELS] = 0xFFFFFFFF;
+    snapshot_write_end(&sync_snapshot);
 
-    memcpy(&msg.as.sync.dac_channel, &program->pressure_channel, sizeof(program->pressure_channel));
-    memcpy(&msg.as.sync.sensor_channel, &program->sensor_channel, sizeof(program->sensor_channel));
-    for (size_t i = 0; i < PROGRAM_PRESSURE_LEVELS; i++) {
-        msg.as.sync.dac_levels[i] = (program->pressure_levels[i] * 100) / 60;
-    }
-
-    for (size_t i = 0; i < PROGRAM_SENSOR_LEVELS; i++) {
-        msg.as.sync.adc_levels[i] =
-            model->config.ma4_20_offset + model_position_mm_to_adc(model, program->position_levels[i]);
+    if (!atomic_exchange_explicit(&sync_pending, 1, memory_order_relaxed)) {
+        struct task_message msg = {.tag = TASK_MESSAGE_TAG_SYNC};
+        if (xQueueSend(requestq, (uint8_t *)&msg, pdMS_TO_TICKS(10)) != pdTRUE) {
+            atomic_store_explicit(&sync_pending, 0, memory_order_relaxed);
+        }
     }
-
-    xQueueSend(requestq, (uint8_t *)&msg, pdMS_TO_TICKS(10));
 }
 
 
@@ -187,7 +212,7 @@ static void minion_task(void *args) {
     struct task_message message                   = {0};
     uint8_t             communication_error       = 0;
 
-    ESP_LOGI(TAG, "Task starting");
+    EVENT_LOG(MINION_TASK_STARTED);
 
     for (;;) {
         if (xQueueReceive(requestq, (uint8_t *)&message, portMAX_DELAY)) {
@@ -214,108 +239,21 @@ uint8_t handle_message(ModbusMaster *master, struct task_message message) {
 
     switch (message.tag) {
         case TASK_MESSAGE_TAG_SYNC: {
-            response.tag = MINION_RESPONSE_TAG_SYNC;
+            // Publications from now on need a request of their own
+            atomic_store_explicit(&sync_pending, 0, memory_order_relaxed);
 
-            uint16_t values[10] = {0};
-            if (read_input_registers(master, values, MINION_ADDR, MODBUS_IR_FIRMWARE_VERSION_MAJOR,
-                                     sizeof(values) / sizeof(values[0]))) {
-                error = 1;
-            } else {
-                response.as.sync.firmware_version_major = (values[0] >> 11) & 0x1F;
-                response.as.sync.firmware_version_minor = (values[0] >> 6) & 0x1F;
-                response.as.sync.firmware_version_patch = (values[0] >> 0) & 0x3F;
-                response.as.sync.inputs                 = values[1];
-                response.as.sync.v0_10_adc              = values[2];
-                response.as.sync.ma4_adc                = values[4];
-                response.as.sync.ma20_adc               = values[5];
-                response.as.sync.ma4_20_adc             = values[6];
-                response.as.sync.running                = values[8];
-                response.as.sync.elapsed_time_ms        = values[9];
-            }
+            uint16_t values[NUM_BOARDS][MINION_PROGRAM_REGISTERS] = {0};
+            uint16_t num_boards                                   = read_sync_state(values);
 
-            if (!error) {
-                uint16_t values[57] = {
-                    message.as.sync.test_on,
-                    message.as.sync.outputs,
-                    message.as.sync.pwm,
-                    message.as.sync.machine_model,
-                    message.as.sync.headgap_offset_up,
-                    message.as.sync.headgap_offset_down,
-                    message.as.sync.time_unit_decisecs,
-                    message.as.sync.dac_levels[0],
-                    message.as.sync.dac_levels[1],
-                    message.as.sync.dac_levels[2],
-                    message.as.sync.adc_levels[0],
-                    message.as.sync.adc_levels[1],
-                    message.as.sync.adc_levels[2],
-                    (message.as.sync.digital_channels[0] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[0] & 0xFFFF,
-                    (message.as.sync.digital_channels[1] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[1] & 0xFFFF,
-                    (message.as.sync.digital_channels[2] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[2] & 0xFFFF,
-                    (message.as.sync.digital_channels[3] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[3] & 0xFFFF,
-                    (message.as.sync.digital_channels[4] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[4] & 0xFFFF,
-                    (message.as.sync.digital_channels[5] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[5] & 0xFFFF,
-                    (message.as.sync.digital_channels[6] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[6] & 0xFFFF,
-                    (message.as.sync.digital_channels[7] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[7] & 0xFFFF,
-                    (message.as.sync.digital_channels[8] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[8] & 0xFFFF,
-                    (message.as.sync.digital_channels[9] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[9] & 0xFFFF,
-                    (message.as.sync.digital_channels[10] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[10] & 0xFFFF,
-                    (message.as.sync.digital_channels[11] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[11] & 0xFFFF,
-                    (message.as.sync.digital_channels[12] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[12] & 0xFFFF,
-                    (message.as.sync.digital_channels[13] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[13] & 0xFFFF,
-                    (message.as.sync.digital_channels[14] >> 16) & 0xFFFF,
-                    message.as.sync.digital_channels[14] & 0xFFFF,
-                    ((message.as.sync.dac_channel[0] & 0xF) << 12) | ((message.as.sync.dac_channel[1] & 0xF) << 8) |
-                        ((message.as.sync.dac_channel[2] & 0xF) << 4) | (message.as.sync.dac_channel[3] & 0xF),
-                    ((message.as.sync.dac_channel[4] & 0xF) << 12) | ((message.as.sync.dac_channel[5] & 0xF) << 8) |
-                        ((message.as.sync.dac_channel[6] & 0xF) << 4) | (message.as.sync.dac_channel[7] & 0xF),
-                    ((message.as.sync.dac_channel[8] & 0xF) << 12) | ((message.as.sync.dac_channel[9] & 0xF) << 8) |
-                        ((message.as.sync.dac_channel[10] & 0xF) << 4) | (message.as.sync.dac_channel[11] & 0xF),
-                    ((message.as.sync.dac_channel[12] & 0xF) << 12) | ((message.as.sync.dac_channel[13] & 0xF) << 8) |
-                        ((message.as.sync.dac_channel[14] & 0xF) << 4) | (message.as.sync.dac_channel[15] & 0xF),
-                    ((message.as.sync.dac_channel[16] & 0xF) << 12) | ((message.as.sync.dac_channel[17] & 0xF) << 8) |
-                        ((message.as.sync.dac_channel[18] & 0xF) << 4) | (message.as.sync.dac_channel[19] & 0xF),
-                    ((message.as.sync.dac_channel[20] & 0xF) << 12) | ((message.as.sync.dac_channel[21] & 0xF) << 8) |
-                        ((message.as.sync.dac_channel[22] & 0xF) << 4) | (message.as.sync.dac_channel[23] & 0xF),
-                    message.as.sync.dac_channel[24],
-                    ((message.as.sync.sensor_channel[0] & 0xF) << 12) |
-                        ((message.as.sync.sensor_channel[1] & 0xF) << 8) |
-                        ((message.as.sync.sensor_channel[2] & 0xF) << 4) | (message.as.sync.sensor_channel[3] & 0xF),
-                    ((message.as.sync.sensor_channel[4] & 0xF) << 12) |
-                        ((message.as.sync.sensor_channel[5] & 0xF) << 8) |
-                        ((message.as.sync.sensor_channel[6] & 0xF) << 4) | (message.as.sync.sensor_channel[7] & 0xF),
-                    ((message.as.sync.sensor_channel[8] & 0xF) << 12) |
-                        ((message.as.sync.sensor_channel[9] & 0xF) << 8) |
-                        ((message.as.sync.sensor_channel[10] & 0xF) << 4) | (message.as.sync.sensor_channel[11] & 0xF),
-                    ((message.as.sync.sensor_channel[12] & 0xF) << 12) |
-                        ((message.as.sync.sensor_channel[13] & 0xF) << 8) |
-                        ((message.as.sync.sensor_channel[14] & 0xF) << 4) | (message.as.sync.sensor_channel[15] & 0xF),
-                    ((message.as.sync.sensor_channel[16] & 0xF) << 12) |
-                        ((message.as.sync.sensor_channel[17] & 0xF) << 8) |
-                        ((message.as.sync.sensor_channel[18] & 0xF) << 4) | (message.as.sync.sensor_channel[19] & 0xF),
-                    ((message.as.sync.sensor_channel[20] & 0xF) << 12) |
-                        ((message.as.sync.sensor_channel[21] & 0xF) << 8) |
-                        ((message.as.sync.sensor_channel[22] & 0xF) << 4) | (message.as.sync.sensor_channel[23] & 0xF),
-                    message.as.sync.sensor_channel[24],
-                };
-
-                if (write_holding_registers(master, MINION_ADDR, MODBUS_HR_TEST_MODE, values,
-                                            sizeof(values) / sizeof(values[0]))) {
-                    error = 1;
-                }
+            response.tag                = MINION_RESPONSE_TAG_SYNC;
+            response.as.sync.num_boards = num_boards;
+
+            // All the boards are read first, so that their states refer to the same instant
+            for (uint16_t i = 0; i < num_boards && !error; i++) {
+                error = read_board(master, &response, i);
+            }
+            for (uint16_t i = 0; i < num_boards && !error; i++) {
+                error = write_board(master, values[i], i);
             }
 
             if (error) {
@@ -323,6 +261,7 @@ uint8_t handle_message(ModbusMaster *master, struct task_message message) {
             }
 
             xQueueSend(responseq, (uint8_t *)&response, portMAX_DELAY);
+            wakeup_post();
             break;
         }
 
@@ -334,6 +273,131 @@ uint8_t handle_message(ModbusMaster *master, struct task_message message) {
 }
 
 
+/**
+ * Only the window held by the minion is sent, filled a step at a time; units past the program length stay empty
+ */
+static void fill_board_program(model_t *model, sync_state_t *sync, uint16_t board) {
+    const program_t          *program  = model_get_current_program(model, board);
+    const program_timeline_t *timeline = model_get_current_timeline(model, board);
+
+    sync->boards[board].time_unit_decisecs = program->time_unit_decisecs;
+
+    for (uint16_t i = 0; i < program_timeline_get_num_steps(timeline); i++) {
+        const program_timeline_step_t *step = program_timeline_get_step(timeline, i);
+        if (step->first_unit >= MINION_TIME_UNITS) {
+            break;
+        }
+
+        uint16_t first = step->first_unit;
+        uint16_t last  = program_timeline_get_step_last_unit(timeline, i);
+        if (last >= MINION_TIME_UNITS) {
+            last = MINION_TIME_UNITS - 1;
+        }
+
+        uint32_t units = (0xFFFFFFFFUL >> (31 - last)) & ~((1UL << first) - 1);
+        for (size_t j = 0; j < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; j++) {
+            if (step->outputs & (1 << j)) {
+                sync->boards[board].digital_channels[j] |= units;
+            }
+        }
+        memset(&sync->boards[board].dac_channel[first], step->pressure, last - first + 1);
+        memset(&sync->boards[board].sensor_channel[first], step->position, last - first + 1);
+    }
+    // Last channel is always active during the cycle
+    sync->boards[board].digital_channels[PROGRAM_NUM_PROGRAMMABLE_CHANNELS] = 0xFFFFFFFF;
+
+    for (size_t i = 0; i < PROGRAM_PRESSURE_LEVELS; i++) {
+        sync->boards[board].dac_levels[i] = model_pressure_to_dac(model, program->pressure_levels[i]);
+    }
+
+    for (size_t i = 0; i < PROGRAM_SENSOR_LEVELS; i++) {
+        sync->boards[board].adc_levels[i] = model_get_position_threshold_adc(model, board, i);
+    }
+}
+
+
+static int read_board(ModbusMaster *master, minion_response_t *response, uint16_t board) {
+    uint16_t values[10] = {0};
+    if (read_input_registers(master, values, MINION_ADDR + board, MODBUS_IR_FIRMWARE_VERSION_MAJOR,
+                             sizeof(values) / sizeof(values[0]))) {
+        return 1;
+    }
+
+    response->as.sync.boards[board].firmware_version_major = (values[0] >> 11) & 0x1F;
+    response->as.sync.boards[board].firmware_version_minor = (values[0] >> 6) & 0x1F;
+    response->as.sync.boards[board].firmware_version_patch = (values[0] >> 0) & 0x3F;
+    response->as.sync.boards[board].inputs                 = values[1];
+    response->as.sync.boards[board].v0_10_adc              = values[2];
+    response->as.sync.boards[board].ma4_adc                = values[4];
+    response->as.sync.boards[board].ma20_adc               = values[5];
+    response->as.sync.boards[board].ma4_20_adc             = values[6];
+    response->as.sync.boards[board].running                = values[8];
+    response->as.sync.boards[board].elapsed_time_ms        = values[9];
+    return 0;
+}
+
+
+/**
+ * Packs the registers of every board straight from the published state; the bus is slow, so it is read once and
+ * again only if the controller overwrote it meanwhile
+ *
+ * @return uint16_t number of boards to synchronize
+ */
+static uint16_t read_sync_state(uint16_t values[NUM_BOARDS][MINION_PROGRAM_REGISTERS]) {
+    uint16_t num_boards = 0;
+    uint32_t ticket     = 0;
+
+    do {
+        const sync_state_t *sync = snapshot_read_begin(&sync_snapshot, &ticket);
+
+        num_boards = sync->num_boards > NUM_BOARDS ? NUM_BOARDS : sync->num_boards;
+        for (uint16_t i = 0; i < num_boards; i++) {
+            pack_board(sync, i, values[i]);
+        }
+    } while (!snapshot_read_end(&sync_snapshot, ticket));
+
+    return num_boards;
+}
+
+
+/**
+ * The test mode is shared, but only the first board drives the test outputs
+ */
+static void pack_board(const sync_state_t *sync, uint16_t board, uint16_t *values) {
+    const uint16_t header[] = {
+        sync->test_on,
+        board == 0 ? sync->outputs : 0,
+        board == 0 ? sync->pwm : 0,
+        sync->machine_model,
+        sync->headgap_offset_up,
+        sync->headgap_offset_down,
+        sync->boards[board].time_unit_decisecs,
+        sync->boards[board].dac_levels[0],
+        sync->boards[board].dac_levels[1],
+        sync->boards[board].dac_levels[2],
+        sync->boards[board].adc_levels[0],
+        sync->boards[board].adc_levels[1],
+        sync->boards[board].adc_levels[2],
+    };
+    memcpy(values, header, sizeof(header));
+
+    size_t index = sizeof(header) / sizeof(header[0]);
+    for (size_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
+        values[index++] = (sync->boards[board].digital_channels[i] >> 16) & 0xFFFF;
+        values[index++] = sync->boards[board].digital_channels[i] & 0xFFFF;
+    }
+    index += pack_levels(&values[index], sync->boards[board].dac_channel);
+    index += pack_levels(&values[index], sync->boards[board].sensor_channel);
+    assert(index <= MINION_PROGRAM_REGISTERS);
+}
+
+
+static int write_board(ModbusMaster *master, const uint16_t *values, uint16_t board) {
+    return write_holding_registers(master, MINION_ADDR + board, MODBUS_HR_TEST_MODE, (uint16_t *)values,
+                                   MINION_PROGRAM_REGISTERS);
+}
+
+
 static ModbusError data_callback(const ModbusMaster *master, const ModbusDataCallbackArgs *args) {
     master_context_t *ctx = modbusMasterGetUserPointer(master);
 
@@ -372,7 +436,7 @@ static ModbusError data_callback(const ModbusMaster *master, const ModbusDataCal
 static ModbusError exception_callback(const ModbusMaster *master, uint8_t address, uint8_t function,
                                       ModbusExceptionCode code) {
     (void)master;
-    ESP_LOGI(TAG, "Received exception (function %d) from slave %d code %d", function, address, code);
+    EVENT_LOG(MINION_EXCEPTION, address, function, code);
 
     return MODBUS_OK;
 }
@@ -397,16 +461,14 @@ static int write_holding_registers(ModbusMaster *master, uint8_t address, uint16
                                          buffer, len);
 
         if (!modbusIsOk(err)) {
-            ESP_LOGW(TAG, "Write holding registers for %i error (%i): %i %i", address, len, err.source, err.error);
+            EVENT_LOG(MINION_WRITE_HOLDING_ERROR, address, len, err.source, err.error);
             res = 1;
             vTaskDelay(pdMS_TO_TICKS(MODBUS_TIMEOUT * 1000));
         }
     } while (res && ++counter < MODBUS_COMMUNICATION_ATTEMPTS);
 
     if (res) {
-        ESP_LOGW(TAG, "ERROR!");
-    } else {
-        ESP_LOGD(TAG, "Success");
+        EVENT_LOG(MINION_COMMUNICATION_FAILED, address, counter);
     }
 
     return res;
@@ -441,7 +503,7 @@ static int read_holding_registers(ModbusMaster *master, uint16_t *registers, uin
                                          buffer, len);
 
         if (!modbusIsOk(err)) {
-            ESP_LOGW(TAG, "Read holding registers for %i error (%i): %i %i", address, len, err.source, err.error);
+            EVENT_LOG(MINION_READ_HOLDING_ERROR, address, len, err.source, err.error);
             res = 1;
             vTaskDelay(pdMS_TO_TICKS(MODBUS_TIMEOUT * 1000));
         }
@@ -479,17 +541,37 @@ static int read_input_registers(ModbusMaster *master, uint16_t *registers, uint8
                                          buffer, len);
 
         if (!modbusIsOk(err)) {
-            ESP_LOGW(TAG, "Read input registers for %i error (%i): %i %i", address, len, err.source, err.error);
+            EVENT_LOG(MINION_READ_INPUT_ERROR, address, len, err.source, err.error);
             res = 1;
             vTaskDelay(pdMS_TO_TICKS((MODBUS_TIMEOUT / 2) * 1000));
         }
     } while (res && ++counter < MODBUS_COMMUNICATION_ATTEMPTS);
 
     if (res) {
-        ESP_LOGW(TAG, "ERROR!");
-    } else {
-        ESP_LOGD(TAG, "Success");
+        EVENT_LOG(MINION_COMMUNICATION_FAILED, address, counter);
     }
 
     return res;
 }
+
+
+/**
+ * Packs the levels four per register, the first unit in the highest nibble; the units left over for the last register
+ * are aligned to the lowest nibble
+ */
+static size_t pack_levels(uint16_t *registers, const uint8_t *levels) {
+    for (size_t i = 0; i < MINION_LEVEL_REGISTERS; i++) {
+        size_t first = i * MINION_LEVELS_PER_REGISTER;
+        size_t count = MINION_TIME_UNITS - first;
+        if (count > MINION_LEVELS_PER_REGISTER) {
+            count = MINION_LEVELS_PER_REGISTER;
+        }
+
+        registers[i] = 0;
+        for (size_t j = 0; j < count; j++) {
+            registers[i] |= (levels[first + j] & 0xF) << ((count - 1 - j) * 4);
+        }
+    }
+
+    return MINION_LEVEL_REGISTERS;
+}
@@ -16,16 +16,20 @@ typedef struct {
     minion_response_tag_t tag;
     union {
         struct {
-            uint8_t  firmware_version_major;
-            uint8_t  firmware_version_minor;
-            uint8_t  firmware_version_patch;
-            uint16_t inputs;
-            uint16_t v0_10_adc;
-            uint16_t ma4_adc;
-            uint16_t ma20_adc;
-            uint16_t ma4_20_adc;
-            uint8_t  running;
-            uint16_t elapsed_time_ms;
+            uint16_t num_boards;
+
+            struct {
+                uint8_t  firmware_version_major;
+                uint8_t  firmware_version_minor;
+                uint8_t  firmware_version_patch;
+                uint16_t inputs;
+                uint16_t v0_10_adc;
+                uint16_t ma4_adc;
+                uint16_t ma20_adc;
+                uint16_t ma4_20_adc;
+                uint8_t  running;
+                uint16_t elapsed_time_ms;
+            } boards[NUM_BOARDS];
         } sync;
     } as;
 } minion_response_t;
@@ -19,10 +19,18 @@
 #include "adapters/network/network.h"
 #include <esp_log.h>
 #include "model/model.h"
+#include "services/log_sink.h"
+#include "services/event_log.h"
+#include "services/wakeup.h"
+#include "services/snapshot.h"
+#include "services/timestamp.h"
 
 
-#define MOUNT_ATTEMPTS 5
-#define APP_UPDATE     "/tmp/mnt/pressa-display-rotondi"
+#define MOUNT_ATTEMPTS       5
+#define APP_UPDATE           "/tmp/mnt/pressa-display-rotondi"
+// The whole ESP-IDF output waits in the log sink until this task writes it out, long operations included
+#define LOG_FLUSH_PERIOD_MS  100
+#define DRIVE_POLL_PERIOD_MS 500
 
 #ifdef BUILD_CONFIG_SIMULATOR
 #define TEMPORARY_APP "./newapp"
@@ -55,6 +63,8 @@ typedef enum {
     DISK_OP_MESSAGE_TAG_SAVE_WIFI_CONFIG,
     DISK_OP_MESSAGE_TAG_FIRMWARE_UPDATE,
     DISK_OP_MESSAGE_TAG_FINALIZE_FIRMWARE_UPDATE,
+    DISK_OP_MESSAGE_TAG_LOAD_STATISTICS,
+    DISK_OP_MESSAGE_TAG_SAVE_STATISTICS,
 } task_request_tag_t;
 
 
@@ -64,9 +74,6 @@ typedef struct {
     void              *arg;
 
     union {
-        struct {
-            configuration_t *config;
-        } save_config;
         struct {
             const char *name;
         } export_config;
@@ -78,6 +85,11 @@ typedef struct {
 
 static void disk_interaction_task(void *args);
 static void simple_request(int code);
+static void send_response(task_response_t *response);
+static void flush_log(void);
+static void flush_log_if_due(void);
+static int  save_config_snapshot(void);
+static int  save_statistics_snapshot(void);
 
 
 static QueueHandle_t     requestq;
@@ -85,9 +97,22 @@ static QueueHandle_t     responseq;
 static SemaphoreHandle_t sem;
 static int               drive_mounted = 0;
 static const char       *TAG           = __FILE_NAME__;
+// What is saved is published here instead of being copied into each request. The snapshots need a single writer:
+// they are only written with the LVGL lock held, by the controller loop or by view callbacks in the LVGL task
+static snapshot_t        config_snapshot;
+static snapshot_t        statistics_snapshot;
+static timestamp_t       last_log_flush = 0;
 
 
 void disk_op_init(void) {
+    {
+        static configuration_t config_memory[2] = {0};
+        snapshot_init(&config_snapshot, config_memory, sizeof(configuration_t));
+    }
+    {
+        static statistics_t statistics_memory[2] = {0};
+        snapshot_init(&statistics_snapshot, statistics_memory, sizeof(statistics_t));
+    }
     {
         static StaticQueue_t static_queue;
         static uint8_t       queue_buffer[sizeof(task_request_t) * 8] = {0};
@@ -117,14 +142,32 @@ void disk_op_init(void) {
 }
 
 
+/**
+ * Must be called with the LVGL lock held (controller loop or view callback), see config_snapshot
+ */
 void disk_op_save_config(const configuration_t *config) {
-    configuration_t *config_copy = malloc(sizeof(configuration_t));
-    assert(config_copy != NULL);
-    memcpy(config_copy, config, sizeof(configuration_t));
-    task_request_t msg = {
-        .tag = DISK_OP_MESSAGE_TAG_SAVE_CONFIG,
-        .as  = {.save_config = {.config = config_copy}},
-    };
+    memcpy(snapshot_write_begin(&config_snapshot), config, sizeof(configuration_t));
+    snapshot_write_end(&config_snapshot);
+
+    task_request_t msg = {.tag = DISK_OP_MESSAGE_TAG_SAVE_CONFIG};
+    xQueueSend(requestq, (uint8_t *)&msg, pdMS_TO_TICKS(10));
+}
+
+
+void disk_op_load_statistics(void) {
+    simple_request(DISK_OP_MESSAGE_TAG_LOAD_STATISTICS);
+}
+
+
+/**
+ * Must be called with the LVGL lock held, like disk_op_save_config
+ */
+void disk_op_save_statistics(const statistics_t *statistics) {
+    memcpy(snapshot_write_begin(&statistics_snapshot), statistics, sizeof(statistics_t));
+    snapshot_write_end(&statistics_snapshot);
+
+    // Not worth blocking for, the next period will try again
+    task_request_t msg = {.tag = DISK_OP_MESSAGE_TAG_SAVE_STATISTICS};
     xQueueSend(requestq, (uint8_t *)&msg, pdMS_TO_TICKS(10));
 }
 
@@ -209,7 +252,8 @@ void disk_op_update_importable_configurations(mut_model_t *model) {
 uint8_t disk_op_get_response(disk_op_response_t *response) {
     task_response_t task_response = {0};
 
-    if (xQueueReceive(responseq, (uint8_t *)&task_response, 0)) {
+    // Responses with nothing to report only run their callback, look past them
+    while (xQueueReceive(responseq, (uint8_t *)&task_response, 0)) {
         if (task_response.callback) {
             task_response.callback(task_response.error, task_response.data, task_response.arg);
         }
@@ -219,12 +263,10 @@ uint8_t disk_op_get_response(disk_op_response_t *response) {
         } else if (task_response.payload) {
             *response = task_response.response;
             return 1;
-        } else {
-            return 0;
         }
-    } else {
-        return 0;
     }
+
+    return 0;
 }
 
 
@@ -235,13 +277,14 @@ int disk_op_is_firmware_present(void) {
 
 static void disk_interaction_task(void *args) {
     (void)args;
-    unsigned int mount_attempts = 0;
+    unsigned int mount_attempts  = 0;
+    timestamp_t  last_drive_poll = 0;
 
     storage_create_dir(APP_CONFIG_DATA_PATH);
 
     for (;;) {
         task_request_t msg;
-        if (xQueueReceive(requestq, (uint8_t *)&msg, pdMS_TO_TICKS(500))) {
+        if (xQueueReceive(requestq, (uint8_t *)&msg, pdMS_TO_TICKS(LOG_FLUSH_PERIOD_MS))) {
             task_response_t response = {
                 .callback = msg.callback,
                 .data     = NULL,
@@ -250,10 +293,9 @@ static void disk_interaction_task(void *args) {
 
             switch (msg.tag) {
                 case DISK_OP_MESSAGE_TAG_SAVE_CONFIG:
-                    response.error =
-                        storage_save_configuration(APP_CONFIG_CONFIGURATION_PATH, msg.as.save_config.config);
-                    free(msg.as.save_config.config);
-                    xQueueSend(responseq, (uint8_t *)&response, portMAX_DELAY);
+                    response.error = save_config_snapshot();
+                    EVENT_LOG(DISK_OP_CONFIG_SAVED, response.error);
+                    send_response(&response);
                     break;
 
                 case DISK_OP_MESSAGE_TAG_EXPORT_CONFIG: {
@@ -269,11 +311,12 @@ static void disk_interaction_task(void *args) {
                              APP_CONFIG_CONFIGURATION_EXTENSION);
 
                     ESP_LOGI(TAG, "Exporting " APP_CONFIG_CONFIGURATION_PATH " to %s", path);
-                    response.error = storage_copy_file(path, APP_CONFIG_CONFIGURATION_PATH);
+                    response.error = storage_copy_file(path, APP_CONFIG_CONFIGURATION_PATH, flush_log_if_due);
+                    EVENT_LOG(DISK_OP_CONFIG_EXPORTED, response.error);
                     free((void *)msg.as.export_config.name);
                     free(path);
 
-                    xQueueSend(responseq, (uint8_t *)&response, portMAX_DELAY);
+                    send_response(&response);
                     break;
                 }
 
@@ -285,32 +328,58 @@ static void disk_interaction_task(void *args) {
 
                     response.error = storage_load_configuration(APP_CONFIG_CONFIGURATION_PATH,
                                                                 response.response.as.configuration_loaded.config);
-                    xQueueSend(responseq, (uint8_t *)&response, portMAX_DELAY);
+                    EVENT_LOG(DISK_OP_CONFIG_LOADED, response.error);
+                    send_response(&response);
+                    break;
+
+                case DISK_OP_MESSAGE_TAG_LOAD_STATISTICS:
+                    response.payload                                  = 1;
+                    response.response.tag                             = DISK_OP_RESPONSE_TAG_STATISTICS_LOADED;
+                    response.response.as.statistics_loaded.statistics = malloc(sizeof(statistics_t));
+                    assert(response.response.as.statistics_loaded.statistics);
+
+                    // Missing on the first start, which is not an error
+                    if (storage_load_statistics(APP_CONFIG_STATISTICS_PATH,
+                                                response.response.as.statistics_loaded.statistics) < 0) {
+                        free(response.response.as.statistics_loaded.statistics);
+                        response.response.as.statistics_loaded.statistics = NULL;
+                    }
+                    send_response(&response);
+                    break;
+
+                case DISK_OP_MESSAGE_TAG_SAVE_STATISTICS:
+                    response.error = save_statistics_snapshot();
+                    EVENT_LOG(DISK_OP_STATISTICS_SAVED, response.error);
+                    send_response(&response);
                     break;
 
                 case DISK_OP_MESSAGE_TAG_SAVE_WIFI_CONFIG:
                     response.error = 0;
                     network_save_config();
-                    xQueueSend(responseq, (uint8_t *)&response, portMAX_DELAY);
+                    send_response(&response);
                     break;
 
                 case DISK_OP_MESSAGE_TAG_FIRMWARE_UPDATE:
-                    response.error = storage_update_temporary_firmware(APP_UPDATE, TEMPORARY_APP);
-                    xQueueSend(responseq, (uint8_t *)&response, portMAX_DELAY);
+                    response.error = storage_update_temporary_firmware(APP_UPDATE, TEMPORARY_APP, flush_log_if_due);
+                    EVENT_LOG(DISK_OP_FIRMWARE_UPDATE, response.error);
+                    send_response(&response);
                     break;
 
                 case DISK_OP_MESSAGE_TAG_FINALIZE_FIRMWARE_UPDATE:
                     response.error = storage_update_final_firmware((char *)(msg.as.finalize_firmware_update.path
                                                                                 ? msg.as.finalize_firmware_update.path
                                                                                 : "root/app"));
-                    xQueueSend(responseq, (uint8_t *)&response, portMAX_DELAY);
+                    send_response(&response);
                     break;
             }
         }
 
-        if (storage_get_file_size(APP_CONFIG_LOGFILE) > MAX_LOGFILE_SIZE) {
-            storage_clear_file(APP_CONFIG_LOGFILE);
+        flush_log();
+
+        if (!timestamp_is_expired(last_drive_poll, DRIVE_POLL_PERIOD_MS)) {
+            continue;
         }
+        last_drive_poll = timestamp_get();
 
         int drive_already_mounted = disk_op_is_drive_mounted();
         int drive_plugged         = storage_is_drive_plugged();
@@ -320,25 +389,27 @@ static void disk_interaction_task(void *args) {
             drive_mounted = 0;
             xSemaphoreGive(sem);
             storage_unmount_drive();
-            ESP_LOGI(TAG, "Chiavetta rimossa");
+            EVENT_LOG(DISK_OP_DRIVE_REMOVED);
+            wakeup_post();
             mount_attempts = 0;
         } else if (!drive_already_mounted && drive_plugged) {
             if (mount_attempts < MOUNT_ATTEMPTS) {
                 mount_attempts++;
-                ESP_LOGI(TAG, "Rilevata una chiavetta");
+                EVENT_LOG(DISK_OP_DRIVE_DETECTED, mount_attempts);
                 if (storage_mount_drive() == 0) {
                     xSemaphoreTake(sem, portMAX_DELAY);
                     drive_mounted = 1;
                     // drive_machines_num = storage_list_saved_machines(DRIVE_MOUNT_PATH, &drive_machines);
                     xSemaphoreGive(sem);
                     // model->system.f_update_ready  = is_firmware_present();
-                    ESP_LOGI(TAG, "Chiavetta montata con successo");
+                    EVENT_LOG(DISK_OP_DRIVE_MOUNTED);
+                    wakeup_post();
                     mount_attempts = 0;
                 } else {
                     xSemaphoreTake(sem, portMAX_DELAY);
                     drive_mounted = 0;
                     xSemaphoreGive(sem);
-                    ESP_LOGW(TAG, "Non sono riuscito a montare la chiavetta!");
+                    EVENT_LOG(DISK_OP_DRIVE_MOUNT_FAILED);
                 }
             }
         }
@@ -348,9 +419,95 @@ static void disk_interaction_task(void *args) {
 }
 
 
+/**
+ * The file is written straight from the published configuration; if the controller published another one meanwhile
+ * the copy may mix the two, so it is written again with the newer one. It is written aside and replaces the saved
+ * configuration only once known to be consistent.
+ */
+static int save_config_snapshot(void) {
+    int      res    = 0;
+    uint32_t ticket = 0;
+
+    do {
+        const configuration_t *config = snapshot_read_begin(&config_snapshot, &ticket);
+        res                           = storage_save_configuration(APP_CONFIG_TEMPORARY_SAVE_PATH, config);
+    } while (!snapshot_read_end(&config_snapshot, ticket));
+
+    if (res == 0) {
+        res = storage_replace_file(APP_CONFIG_CONFIGURATION_PATH, APP_CONFIG_TEMPORARY_SAVE_PATH);
+    }
+    return res;
+}
+
+
+/**
+ * Like save_config_snapshot, through the same temporary file: both run in the disk task, one at a time
+ */
+static int save_statistics_snapshot(void) {
+    int      res    = 0;
+    uint32_t ticket = 0;
+
+    do {
+        const statistics_t *statistics = snapshot_read_begin(&statistics_snapshot, &ticket);
+        res                            = storage_save_statistics(APP_CONFIG_TEMPORARY_SAVE_PATH, statistics);
+    } while (!snapshot_read_end(&statistics_snapshot, ticket));
+
+    if (res == 0) {
+        res = storage_replace_file(APP_CONFIG_STATISTICS_PATH, APP_CONFIG_TEMPORARY_SAVE_PATH);
+    }
+    return res;
+}
+
+
 static void simple_request(int code) {
     task_request_t msg = {
         .tag = code,
     };
     xQueueSend(requestq, (uint8_t *)&msg, portMAX_DELAY);
 }
+
+
+static void send_response(task_response_t *response) {
+    xQueueSend(responseq, (uint8_t *)response, portMAX_DELAY);
+    wakeup_post();
+}
+
+
+static void flush_log(void) {
+    last_log_flush = timestamp_get();
+
+    if (log_sink_is_pending()) {
+        // One open and one write burst for everything that was logged since the last pass
+        FILE *fp = fopen(APP_CONFIG_LOGFILE, "a");
+        log_sink_flush(fp);
+        if (fp != NULL) {
+            fclose(fp);
+        }
+
+        if (storage_get_file_size(APP_CONFIG_LOGFILE) > APP_CONFIG_LOG_SEGMENT_SIZE) {
+            storage_rotate_file(APP_CONFIG_LOGFILE, APP_CONFIG_LOG_SEGMENTS);
+        }
+    }
+
+    if (event_log_is_pending()) {
+        FILE *fp = fopen(APP_CONFIG_EVENT_LOGFILE, "ab");
+        event_log_flush(fp);
+        if (fp != NULL) {
+            fclose(fp);
+        }
+
+        if (storage_get_file_size(APP_CONFIG_EVENT_LOGFILE) > APP_CONFIG_LOG_SEGMENT_SIZE) {
+            storage_rotate_file(APP_CONFIG_EVENT_LOGFILE, APP_CONFIG_LOG_SEGMENTS);
+        }
+    }
+}
+
+
+/**
+ * Between the steps of long operations, which would otherwise hold the log back until they end
+ */
+static void flush_log_if_due(void) {
+    if (timestamp_is_expired(last_log_flush, LOG_FLUSH_PERIOD_MS)) {
+        flush_log();
+    }
+}
@@ -12,6 +12,7 @@ typedef enum {
     DISK_OP_RESPONSE_TAG_ERROR,
     DISK_OP_RESPONSE_TAG_CONFIGURATION_LOADED,
     DISK_OP_RESPONSE_TAG_CONFIGURATION_EXPORTED,
+    DISK_OP_RESPONSE_TAG_STATISTICS_LOADED,
 } disk_op_response_tag_t;
 
 
@@ -21,6 +22,10 @@ typedef struct {
         struct {
             configuration_t *config;
         } configuration_loaded;
+        struct {
+            // NULL if none were saved yet
+            statistics_t *statistics;
+        } statistics_loaded;
     } as;
 } disk_op_response_t;
 
@@ -28,6 +33,8 @@ typedef struct {
 void    disk_op_init(void);
 void    disk_op_load_config(void);
 void    disk_op_save_config(const configuration_t *config);
+void    disk_op_load_statistics(void);
+void    disk_op_save_statistics(const statistics_t *statistics);
 uint8_t disk_op_get_response(disk_op_response_t *response);
 void    disk_op_save_wifi_config(void);
 void    disk_op_read_file(void);
@@ -15,11 +15,36 @@
 
 
 #define PARAMETERS_SERIALIZED_SIZE 8
-#define PROGRAM_SERIALIZED_SIZE                                                                                        \
-    (PROGRAM_NAME_SIZE + sizeof(program_digital_channel_schedule_t) * PROGRAM_NUM_CHANNELS +                           \
-     PROGRAM_NUM_TIME_UNITS * 2 + 2 + PROGRAM_PRESSURE_LEVELS * 2 + PROGRAM_SENSOR_LEVELS * 2)
-
-#define STORAGE_VERSION 0
+// Longest program the format holds; longer than what is kept in RAM, the excess is dropped when loading
+#define PROGRAM_SERIALIZED_MAX_TIME_UNITS 400
+// Name, length, time unit and levels; the schedules follow, sized on the length of the program
+#define PROGRAM_HEADER_SERIALIZED_SIZE                                                                                 \
+    (PROGRAM_NAME_SIZE + 2 + 2 + PROGRAM_PRESSURE_LEVELS * 2 + PROGRAM_SENSOR_LEVELS * 2)
+#define PROGRAM_SCHEDULE_SERIALIZED_SIZE(Units)                                                                        \
+    (PROGRAM_SCHEDULE_WORDS_FOR(Units) * 4 * PROGRAM_NUM_PROGRAMMABLE_CHANNELS + PROGRAM_LEVEL_BYTES_FOR(Units) * 2)
+#define PROGRAM_MAX_SERIALIZED_SIZE                                                                                    \
+    (PROGRAM_HEADER_SERIALIZED_SIZE + PROGRAM_SCHEDULE_SERIALIZED_SIZE(PROGRAM_SERIALIZED_MAX_TIME_UNITS))
+// Fixed 25 units programs, as saved before programs had a length
+#define PROGRAM_V0_TIME_UNITS 25
+#define PROGRAM_V0_SERIALIZED_SIZE                                                                                     \
+    (PROGRAM_NAME_SIZE + 4 * PROGRAM_NUM_CHANNELS + PROGRAM_V0_TIME_UNITS * 2 + 2 + PROGRAM_PRESSURE_LEVELS * 2 +      \
+     PROGRAM_SENSOR_LEVELS * 2)
+_Static_assert(PROGRAM_V0_TIME_UNITS <= PROGRAM_MAX_TIME_UNITS, "Version 0 programs must be loaded entirely");
+
+// Number of points followed by every point slot, used or not
+#define CALIBRATION_CURVE_SERIALIZED_SIZE (2 + CALIBRATION_CURVE_MAX_POINTS * 4)
+// Machine model and mode
+#define MACHINE_SERIALIZED_SIZE 4
+
+#define STORAGE_VERSION 3
+
+// Version, then every counter whether used or not
+#define STATISTICS_PROGRAM_SERIALIZED_SIZE (4 + 4 + 4 + 8 + 4)
+#define STATISTICS_SHIFT_SERIALIZED_SIZE   (4 + 8 + 8)
+#define STATISTICS_SERIALIZED_SIZE                                                                                     \
+    (1 + STATISTICS_MAX_PROGRAMS * STATISTICS_PROGRAM_SERIALIZED_SIZE +                                                \
+     STATISTICS_NUM_SHIFTS * STATISTICS_SHIFT_SERIALIZED_SIZE + STATISTICS_IDLE_BINS * 4)
+#define STATISTICS_VERSION 0
 
 #define DIR_CHECK(x)                                                                                                   \
     {                                                                                                                  \
@@ -30,12 +55,21 @@
 
 
 static int read_exactly(uint8_t *buffer, size_t length, FILE *fp);
+static int read_exactly_v0(uint8_t *buffer, size_t length, FILE *fp);
 static int write_exactly(const uint8_t *buffer, size_t length, FILE *fp);
 static int is_dir(const char *path);
+static int read_program(program_t *program, FILE *fp);
+static int read_program_v0(program_t *program, FILE *fp);
+static int write_program(const program_t *program, FILE *fp);
+static int read_calibration_curve(calibration_curve_t *curve, FILE *fp);
+static int write_calibration_curve(const calibration_curve_t *curve, FILE *fp);
 
 
 static const char *TAG = __FILE_NAME__;
 
+// Programs can be quite large, keep them off the stack of the disk task
+static uint8_t program_buffer[PROGRAM_MAX_SERIALIZED_SIZE];
+
 
 int storage_load_configuration(const char *path, configuration_t *config) {
     if (storage_is_file(path)) {
@@ -46,8 +80,17 @@ int storage_load_configuration(const char *path, configuration_t *config) {
             return -1;
         }
 
+        // Version 0 files need their own reader from the very first field
+        int version = fgetc(fp);
+        if (version == EOF || ungetc(version, fp) == EOF) {
+            ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
+            fclose(fp);
+            return -1;
+        }
+        int (*read_fn)(uint8_t *, size_t, FILE *) = version == 0 ? read_exactly_v0 : read_exactly;
+
         uint8_t buffer[PARAMETERS_SERIALIZED_SIZE + 1] = {0};
-        if (read_exactly(buffer, sizeof(buffer), fp) < 0) {
+        if (read_fn(buffer, sizeof(buffer), fp) < 0) {
             ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
             fclose(fp);
             return -1;
@@ -62,7 +105,7 @@ int storage_load_configuration(const char *path, configuration_t *config) {
             deserialize_uint16_be(&config->position_sensor_scale_mm, &buffer[parameters_buffer_index]);
 
         for (uint16_t i = 0; i < PROGRAM_NUM_CHANNELS; i++) {
-            if (read_exactly((uint8_t *)config->channel_names[i], sizeof(name_t), fp) < 0) {
+            if (read_fn((uint8_t *)config->channel_names[i], sizeof(name_t), fp) < 0) {
                 ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
                 fclose(fp);
                 return -1;
@@ -70,48 +113,43 @@ int storage_load_configuration(const char *path, configuration_t *config) {
         }
 
         for (uint16_t i = 0; i < NUM_PROGRAMS; i++) {
-            uint8_t buffer[PROGRAM_SERIALIZED_SIZE] = {0};
+            int res = version == 0 ? read_program_v0(&config->programs[i], fp) : read_program(&config->programs[i], fp);
 
-            if (read_exactly(buffer, sizeof(buffer), fp) < 0) {
+            if (res < 0) {
                 ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
                 fclose(fp);
                 return -1;
             }
+        }
 
-            uint16_t   program_buffer_index = 0;
-            program_t *program              = &config->programs[i];
-            memcpy(program->name, &buffer[program_buffer_index], PROGRAM_NAME_SIZE);
-            program->name[PROGRAM_NAME_LENGTH] = '\0';
-            program_buffer_index += PROGRAM_NAME_SIZE;
-
-            for (uint16_t j = 0; j < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; j++) {
-                program_buffer_index +=
-                    deserialize_uint32_be(&program->digital_channels[j], &buffer[program_buffer_index]);
-            }
-
-            for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-                uint8_t value = 0;
-                program_buffer_index += deserialize_uint8(&value, &buffer[program_buffer_index]);
-                program->pressure_channel[j] = value;
-            }
-
-            for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-                uint8_t value = 0;
-                program_buffer_index += deserialize_uint8(&value, &buffer[program_buffer_index]);
-                program->sensor_channel[j] = value;
+        // Calibration curves were added with version 2
+        if (version >= 2) {
+            if (read_calibration_curve(&config->position_curve, fp) < 0 ||
+                read_calibration_curve(&config->pressure_curve, fp) < 0) {
+                ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
+                fclose(fp);
+                return -1;
             }
+        } else {
+            calibration_curve_clear(&config->position_curve);
+            calibration_curve_clear(&config->pressure_curve);
+        }
 
-            program_buffer_index += deserialize_uint16_be(&program->time_unit_decisecs, &buffer[program_buffer_index]);
-
-            for (uint16_t j = 0; j < PROGRAM_PRESSURE_LEVELS; j++) {
-                program_buffer_index +=
-                    deserialize_uint16_be(&program->pressure_levels[j], &buffer[program_buffer_index]);
+        // Machine model and mode were added with version 3
+        if (version >= 3) {
+            uint8_t machine_buffer[MACHINE_SERIALIZED_SIZE] = {0};
+            if (read_exactly(machine_buffer, sizeof(machine_buffer), fp) < 0) {
+                ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
+                fclose(fp);
+                return -1;
             }
 
-            for (uint16_t j = 0; j < PROGRAM_SENSOR_LEVELS; j++) {
-                program_buffer_index +=
-                    deserialize_uint16_be(&program->position_levels[j], &buffer[program_buffer_index]);
-            }
+            uint16_t index = 0;
+            index += deserialize_uint16_be(&config->machine_model, &machine_buffer[index]);
+            index += deserialize_uint16_be(&config->machine_mode, &machine_buffer[index]);
+        } else {
+            config->machine_model = MACHINE_MODEL_TRADITIONAL;
+            config->machine_mode  = MACHINE_MODE_NORMAL;
         }
 
         fclose(fp);
@@ -154,40 +192,113 @@ int storage_save_configuration(const char *path, const configuration_t *config)
     }
 
     for (uint16_t i = 0; i < NUM_PROGRAMS; i++) {
-        uint8_t buffer[PROGRAM_SERIALIZED_SIZE] = {0};
+        if (write_program(&config->programs[i], fp) < 0) {
+            ESP_LOGE(TAG, "Failed to write file %s: %s", path, strerror(errno));
+            fclose(fp);
+            return -1;
+        }
+    }
 
-        uint16_t         program_buffer_index = 0;
-        const program_t *program              = &config->programs[i];
-        memcpy(&buffer[program_buffer_index], program->name, PROGRAM_NAME_SIZE);
-        program_buffer_index += PROGRAM_NAME_SIZE;
+    if (write_calibration_curve(&config->position_curve, fp) < 0 ||
+        write_calibration_curve(&config->pressure_curve, fp) < 0) {
+        ESP_LOGE(TAG, "Failed to write file %s: %s", path, strerror(errno));
+        fclose(fp);
+        return -1;
+    }
 
-        for (uint16_t j = 0; j < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; j++) {
-            program_buffer_index += serialize_uint32_be(&buffer[program_buffer_index], program->digital_channels[j]);
-        }
+    uint8_t  machine_buffer[MACHINE_SERIALIZED_SIZE] = {0};
+    uint16_t index                                   = 0;
+    index += serialize_uint16_be(&machine_buffer[index], config->machine_model);
+    index += serialize_uint16_be(&machine_buffer[index], config->machine_mode);
 
-        for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-            program_buffer_index += serialize_uint8(&buffer[program_buffer_index], program->pressure_channel[j]);
-        }
+    if (write_exactly(machine_buffer, sizeof(machine_buffer), fp) < 0) {
+        ESP_LOGE(TAG, "Failed to write file %s: %s", path, strerror(errno));
+        fclose(fp);
+        return -1;
+    }
 
-        for (uint16_t j = 0; j < PROGRAM_NUM_TIME_UNITS; j++) {
-            program_buffer_index += serialize_uint8(&buffer[program_buffer_index], program->sensor_channel[j]);
-        }
+    fclose(fp);
+    return 0;
+}
 
-        program_buffer_index += serialize_uint16_be(&buffer[program_buffer_index], program->time_unit_decisecs);
 
-        for (uint16_t j = 0; j < PROGRAM_PRESSURE_LEVELS; j++) {
-            program_buffer_index += serialize_uint16_be(&buffer[program_buffer_index], program->pressure_levels[j]);
-        }
+int storage_load_statistics(const char *path, statistics_t *statistics) {
+    FILE *fp = fopen(path, "rb");
 
-        for (uint16_t j = 0; j < PROGRAM_SENSOR_LEVELS; j++) {
-            program_buffer_index += serialize_uint16_be(&buffer[program_buffer_index], program->position_levels[j]);
-        }
+    if (!fp) {
+        ESP_LOGW(TAG, "Failed to open file %s: %s", path, strerror(errno));
+        return -1;
+    }
 
-        if (write_exactly(buffer, sizeof(buffer), fp) < 0) {
-            ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
-            fclose(fp);
-            return -1;
-        }
+    uint8_t buffer[STATISTICS_SERIALIZED_SIZE] = {0};
+    if (read_exactly(buffer, sizeof(buffer), fp) < 0) {
+        ESP_LOGE(TAG, "Failed to read file %s: %s", path, strerror(errno));
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+
+    if (buffer[0] != STATISTICS_VERSION) {
+        ESP_LOGW(TAG, "Unknown statistics version %i", buffer[0]);
+        return -1;
+    }
+
+    uint16_t index = 1;
+    for (uint16_t i = 0; i < STATISTICS_MAX_PROGRAMS; i++) {
+        statistics_program_t *program = &statistics->programs[i];
+        index += deserialize_uint32_be(&program->cycles, &buffer[index]);
+        index += deserialize_uint32_be(&program->min_cycle_ms, &buffer[index]);
+        index += deserialize_uint32_be(&program->max_cycle_ms, &buffer[index]);
+        index += deserialize_uint64_be(&program->total_cycle_ms, &buffer[index]);
+        index += deserialize_uint32_be(&program->nominal_cycle_ms, &buffer[index]);
+    }
+    for (uint16_t i = 0; i < STATISTICS_NUM_SHIFTS; i++) {
+        statistics_shift_t *shift = &statistics->shifts[i];
+        index += deserialize_uint32_be(&shift->cycles, &buffer[index]);
+        index += deserialize_uint64_be(&shift->running_ms, &buffer[index]);
+        index += deserialize_uint64_be(&shift->idle_ms, &buffer[index]);
+    }
+    for (uint16_t i = 0; i < STATISTICS_IDLE_BINS; i++) {
+        index += deserialize_uint32_be(&statistics->idle_histogram[i], &buffer[index]);
+    }
+
+    return 0;
+}
+
+
+int storage_save_statistics(const char *path, const statistics_t *statistics) {
+    uint8_t buffer[STATISTICS_SERIALIZED_SIZE] = {0};
+    buffer[0]                                  = STATISTICS_VERSION;
+
+    uint16_t index = 1;
+    for (uint16_t i = 0; i < STATISTICS_MAX_PROGRAMS; i++) {
+        const statistics_program_t *program = &statistics->programs[i];
+        index += serialize_uint32_be(&buffer[index], program->cycles);
+        index += serialize_uint32_be(&buffer[index], program->min_cycle_ms);
+        index += serialize_uint32_be(&buffer[index], program->max_cycle_ms);
+        index += serialize_uint64_be(&buffer[index], program->total_cycle_ms);
+        index += serialize_uint32_be(&buffer[index], program->nominal_cycle_ms);
+    }
+    for (uint16_t i = 0; i < STATISTICS_NUM_SHIFTS; i++) {
+        const statistics_shift_t *shift = &statistics->shifts[i];
+        index += serialize_uint32_be(&buffer[index], shift->cycles);
+        index += serialize_uint64_be(&buffer[index], shift->running_ms);
+        index += serialize_uint64_be(&buffer[index], shift->idle_ms);
+    }
+    for (uint16_t i = 0; i < STATISTICS_IDLE_BINS; i++) {
+        index += serialize_uint32_be(&buffer[index], statistics->idle_histogram[i]);
+    }
+
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        ESP_LOGE(TAG, "Failed to open file %s: %s", path, strerror(errno));
+        return -1;
+    }
+
+    if (write_exactly(buffer, sizeof(buffer), fp) < 0) {
+        ESP_LOGE(TAG, "Failed to write file %s: %s", path, strerror(errno));
+        fclose(fp);
+        return -1;
     }
 
     fclose(fp);
@@ -233,6 +344,65 @@ void storage_clear_file(const char *path) {
 }
 
 
+/**
+ * Keeps the last `segments` pieces of a growing file: `path` becomes `path.1`, `path.1` becomes `path.2` and so on,
+ * discarding the oldest one.
+ */
+void storage_rotate_file(const char *path, unsigned int segments) {
+    char from[128] = {0};
+    char to[128]   = {0};
+
+    if (segments <= 1) {
+        storage_clear_file(path);
+        return;
+    }
+
+    snprintf(to, sizeof(to), "%s.%u", path, segments - 1);
+    remove(to);
+
+    for (unsigned int i = segments - 1; i > 1; i--) {
+        snprintf(from, sizeof(from), "%s.%u", path, i - 1);
+        snprintf(to, sizeof(to), "%s.%u", path, i);
+        if (storage_is_file(from)) {
+            rename(from, to);
+        }
+    }
+
+    snprintf(to, sizeof(to), "%s.1", path);
+    if (rename(path, to) < 0) {
+        ESP_LOGW(TAG, "Non sono riuscito a ruotare %s: %s", path, strerror(errno));
+        storage_clear_file(path);
+    }
+}
+
+
+/**
+ * Moves a completely written `temporary_path` over `path`, so that an interrupted save never leaves `path` torn
+ */
+int storage_replace_file(const char *path, const char *temporary_path) {
+    // The data must reach the medium before the file that points to it
+    int fd = open(temporary_path, O_RDONLY);
+    if (fd < 0) {
+        ESP_LOGE(TAG, "Failed to open file %s: %s", temporary_path, strerror(errno));
+        return -1;
+    }
+    fsync(fd);
+    close(fd);
+
+    if (rename(temporary_path, path) == 0) {
+        return 0;
+    }
+
+    // Some file systems (FAT) do not rename over an existing file
+    remove(path);
+    if (rename(temporary_path, path) < 0) {
+        ESP_LOGE(TAG, "Failed to rename %s to %s: %s", temporary_path, path, strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+
 /*
  *  Chiavetta USB
  */
@@ -267,10 +437,11 @@ int storage_update_final_firmware(char *dest) {
 
 
 
-int storage_update_temporary_firmware(char *app_path, char *temporary_path) {
+int storage_update_temporary_firmware(char *app_path, char *temporary_path, void (*between_chunks)(void)) {
 #ifdef BUILD_CONFIG_SIMULATOR
     (void)app_path;
     (void)temporary_path;
+    (void)between_chunks;
     return 0;
 #else
     int res = 0;
@@ -278,7 +449,7 @@ int storage_update_temporary_firmware(char *app_path, char *temporary_path) {
     if (storage_is_file(app_path)) {
         ESP_LOGI(TAG, "Update temporary firmware at %s", temporary_path);
 
-        if ((res = storage_copy_file(temporary_path, app_path)) < 0) {
+        if ((res = storage_copy_file(temporary_path, app_path, between_chunks)) < 0) {
             ESP_LOGE(TAG, "Non sono riuscito ad aggiornare il firmware");
         }
     } else {
@@ -299,7 +470,7 @@ int storage_update_temporary_firmware(char *app_path, char *temporary_path) {
 static int read_exactly(uint8_t *buffer, size_t length, FILE *fp) {
     size_t count = 0;
     while (count < length) {
-        size_t bytes_read = fread(&buffer[count], length - count, 1, fp);
+        size_t bytes_read = fread(&buffer[count], 1, length - count, fp);
         if (0 == bytes_read) {
             return -1;
         } else {
@@ -310,10 +481,29 @@ static int read_exactly(uint8_t *buffer, size_t length, FILE *fp) {
 }
 
 
+/**
+ * Version 0 files were written passing the remaining length as the element size, so each write of N bytes stored the
+ * buffer from every offset in turn: N bytes, then the last N - 1, down to the last one. Reading them back the same way
+ * leaves every byte where it belongs.
+ */
+static int read_exactly_v0(uint8_t *buffer, size_t length, FILE *fp) {
+    size_t count = 0;
+    while (count < length) {
+        size_t elements_read = fread(&buffer[count], length - count, 1, fp);
+        if (0 == elements_read) {
+            return -1;
+        } else {
+            count += elements_read;
+        }
+    }
+    return count;
+}
+
+
 static int write_exactly(const uint8_t *buffer, size_t length, FILE *fp) {
     size_t count = 0;
     while (count < length) {
-        size_t bytes_written = fwrite(&buffer[count], length - count, 1, fp);
+        size_t bytes_written = fwrite(&buffer[count], 1, length - count, fp);
         if (0 == bytes_written) {
             return -1;
         } else {
@@ -333,12 +523,193 @@ static int is_dir(const char *path) {
 }
 
 
+static int read_program(program_t *program, FILE *fp) {
+    if (read_exactly(program_buffer, PROGRAM_HEADER_SERIALIZED_SIZE, fp) < 0) {
+        return -1;
+    }
+
+    uint16_t index = 0;
+    memcpy(program->name, &program_buffer[index], PROGRAM_NAME_SIZE);
+    program->name[PROGRAM_NAME_LENGTH] = '\0';
+    index += PROGRAM_NAME_SIZE;
+
+    uint16_t num_time_units = 0;
+    index += deserialize_uint16_be(&num_time_units, &program_buffer[index]);
+    index += deserialize_uint16_be(&program->time_unit_decisecs, &program_buffer[index]);
+
+    for (uint16_t j = 0; j < PROGRAM_PRESSURE_LEVELS; j++) {
+        index += deserialize_uint16_be(&program->pressure_levels[j], &program_buffer[index]);
+    }
+
+    for (uint16_t j = 0; j < PROGRAM_SENSOR_LEVELS; j++) {
+        index += deserialize_uint16_be(&program->position_levels[j], &program_buffer[index]);
+    }
+
+    if (num_time_units < PROGRAM_MIN_TIME_UNITS || num_time_units > PROGRAM_SERIALIZED_MAX_TIME_UNITS) {
+        ESP_LOGE(TAG, "Invalid program length: %i", num_time_units);
+        errno = EINVAL;
+        return -1;
+    }
+
+    // Only the units within the length are saved
+    uint16_t words = PROGRAM_SCHEDULE_WORDS_FOR(num_time_units);
+    uint16_t bytes = PROGRAM_LEVEL_BYTES_FOR(num_time_units);
+    if (read_exactly(program_buffer, PROGRAM_SCHEDULE_SERIALIZED_SIZE(num_time_units), fp) < 0) {
+        return -1;
+    }
+
+    memset(program->digital_channels, 0, sizeof(program->digital_channels));
+    memset(program->pressure_channel, 0, sizeof(program->pressure_channel));
+    memset(program->sensor_channel, 0, sizeof(program->sensor_channel));
+
+    // What does not fit in RAM is skipped, then cut away with the length
+    index = 0;
+    for (uint16_t j = 0; j < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; j++) {
+        for (uint16_t k = 0; k < words; k++) {
+            uint32_t word = 0;
+            index += deserialize_uint32_be(&word, &program_buffer[index]);
+            if (k < PROGRAM_SCHEDULE_WORDS) {
+                program->digital_channels[j][k] = word;
+            }
+        }
+    }
+
+    uint16_t kept_bytes = bytes < PROGRAM_LEVEL_BYTES ? bytes : PROGRAM_LEVEL_BYTES;
+    memcpy(program->pressure_channel, &program_buffer[index], kept_bytes);
+    index += bytes;
+    memcpy(program->sensor_channel, &program_buffer[index], kept_bytes);
+    index += bytes;
+
+    if (num_time_units > PROGRAM_MAX_TIME_UNITS) {
+        ESP_LOGW(TAG, "Program %s cut from %i to %i time units", program->name, num_time_units,
+                 PROGRAM_MAX_TIME_UNITS);
+    }
+    // Also clears the units the rounding of the buffers kept past the length
+    program_set_num_time_units(program, num_time_units);
+    return 0;
+}
+
+
+static int read_program_v0(program_t *program, FILE *fp) {
+    if (read_exactly_v0(program_buffer, PROGRAM_V0_SERIALIZED_SIZE, fp) < 0) {
+        return -1;
+    }
+
+    program_init(program);
+    program->num_time_units = PROGRAM_V0_TIME_UNITS;
+
+    uint16_t index = 0;
+    memcpy(program->name, &program_buffer[index], PROGRAM_NAME_SIZE);
+    program->name[PROGRAM_NAME_LENGTH] = '\0';
+    index += PROGRAM_NAME_SIZE;
+
+    // The first word holds the whole schedule
+    for (uint16_t j = 0; j < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; j++) {
+        index += deserialize_uint32_be(&program->digital_channels[j][0], &program_buffer[index]);
+    }
+
+    for (uint16_t j = 0; j < PROGRAM_V0_TIME_UNITS; j++) {
+        uint8_t value = 0;
+        index += deserialize_uint8(&value, &program_buffer[index]);
+        program_set_pressure_channel_state_at(program, j, value);
+    }
+
+    for (uint16_t j = 0; j < PROGRAM_V0_TIME_UNITS; j++) {
+        uint8_t value = 0;
+        index += deserialize_uint8(&value, &program_buffer[index]);
+        program_set_sensor_channel_threshold_at(program, j, value);
+    }
+
+    index += deserialize_uint16_be(&program->time_unit_decisecs, &program_buffer[index]);
+
+    for (uint16_t j = 0; j < PROGRAM_PRESSURE_LEVELS; j++) {
+        index += deserialize_uint16_be(&program->pressure_levels[j], &program_buffer[index]);
+    }
+
+    for (uint16_t j = 0; j < PROGRAM_SENSOR_LEVELS; j++) {
+        index += deserialize_uint16_be(&program->position_levels[j], &program_buffer[index]);
+    }
+
+    return 0;
+}
+
+
+static int write_program(const program_t *program, FILE *fp) {
+    memset(program_buffer, 0, sizeof(program_buffer));
+
+    uint16_t index = 0;
+    memcpy(&program_buffer[index], program->name, PROGRAM_NAME_SIZE);
+    index += PROGRAM_NAME_SIZE;
+
+    index += serialize_uint16_be(&program_buffer[index], program->num_time_units);
+    index += serialize_uint16_be(&program_buffer[index], program->time_unit_decisecs);
+
+    for (uint16_t j = 0; j < PROGRAM_PRESSURE_LEVELS; j++) {
+        index += serialize_uint16_be(&program_buffer[index], program->pressure_levels[j]);
+    }
+
+    for (uint16_t j = 0; j < PROGRAM_SENSOR_LEVELS; j++) {
+        index += serialize_uint16_be(&program_buffer[index], program->position_levels[j]);
+    }
+
+    uint16_t words = PROGRAM_SCHEDULE_WORDS_FOR(program->num_time_units);
+    uint16_t bytes = PROGRAM_LEVEL_BYTES_FOR(program->num_time_units);
+    for (uint16_t j = 0; j < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; j++) {
+        for (uint16_t k = 0; k < words; k++) {
+            index += serialize_uint32_be(&program_buffer[index], program->digital_channels[j][k]);
+        }
+    }
+
+    memcpy(&program_buffer[index], program->pressure_channel, bytes);
+    index += bytes;
+    memcpy(&program_buffer[index], program->sensor_channel, bytes);
+    index += bytes;
+
+    return write_exactly(program_buffer, index, fp);
+}
+
+
+static int read_calibration_curve(calibration_curve_t *curve, FILE *fp) {
+    uint8_t buffer[CALIBRATION_CURVE_SERIALIZED_SIZE] = {0};
+    if (read_exactly(buffer, sizeof(buffer), fp) < 0) {
+        return -1;
+    }
+
+    uint16_t index = 0;
+    index += deserialize_uint16_be(&curve->num_points, &buffer[index]);
+    for (uint16_t i = 0; i < CALIBRATION_CURVE_MAX_POINTS; i++) {
+        index += deserialize_uint16_be(&curve->points[i].raw, &buffer[index]);
+        index += deserialize_uint16_be(&curve->points[i].value, &buffer[index]);
+    }
+
+    // Validated by model_check_parameters
+    return 0;
+}
+
+
+static int write_calibration_curve(const calibration_curve_t *curve, FILE *fp) {
+    uint8_t buffer[CALIBRATION_CURVE_SERIALIZED_SIZE] = {0};
+
+    uint16_t index = 0;
+    index += serialize_uint16_be(&buffer[index], curve->num_points);
+    for (uint16_t i = 0; i < CALIBRATION_CURVE_MAX_POINTS; i++) {
+        index += serialize_uint16_be(&buffer[index], curve->points[i].raw);
+        index += serialize_uint16_be(&buffer[index], curve->points[i].value);
+    }
+
+    return write_exactly(buffer, sizeof(buffer), fp);
+}
+
+
 void storage_create_dir(char *name) {
     DIR_CHECK(mkdir(name, 0766));
 }
 
 
-int storage_copy_file(const char *to, const char *from) {
+/**
+ * `between_chunks`, if not NULL, is called after every block copied
+ */
+int storage_copy_file(const char *to, const char *from, void (*between_chunks)(void)) {
     int     fd_to, fd_from;
     char    buf[4096];
     ssize_t nread;
@@ -372,6 +743,10 @@ int storage_copy_file(const char *to, const char *from) {
                 return -1;
             }
         } while (nread > 0);
+
+        if (between_chunks != NULL) {
+            between_chunks();
+        }
     }
 
     close(fd_to);
@@ -15,14 +15,18 @@ char  *storage_read_file(char *name);
 void   storage_create_dir(char *name);
 size_t storage_get_file_size(const char *path);
 void   storage_clear_file(const char *path);
+void   storage_rotate_file(const char *path, unsigned int segments);
+int    storage_replace_file(const char *path, const char *temporary_path);
 char   storage_is_drive_plugged(void);
 int    storage_mount_drive(void);
 void   storage_unmount_drive(void);
 int    storage_is_file(const char *path);
-int    storage_update_temporary_firmware(char *app_path, char *temporary_path);
+int    storage_update_temporary_firmware(char *app_path, char *temporary_path, void (*between_chunks)(void));
 int    storage_load_configuration(const char *path, configuration_t *config);
 int    storage_save_configuration(const char *path, const configuration_t *config);
-int    storage_copy_file(const char *to, const char *from);
+int    storage_load_statistics(const char *path, statistics_t *statistics);
+int    storage_save_statistics(const char *path, const statistics_t *statistics);
+int    storage_copy_file(const char *to, const char *from, void (*between_chunks)(void));
 int    storage_update_final_firmware(char *dest);
 
 
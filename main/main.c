@@ -9,26 +9,71 @@
 #include "controller/controller.h"
 #include "controller/gui.h"
 #include "services/system_time.h"
+#include "services/log_sink.h"
+#include "services/event_log.h"
+#include "services/wakeup.h"
 #include "config/app_config.h"
 #include "bsp/rs232.h"
 #include "bsp/lcd.h"
 
 
+#ifdef BUILD_CONFIG_LVGL_THREADED
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+
+static void controller_task(void *arg);
+#else
 static void loop(lv_timer_t *timer);
+#endif
 
 
 static const char *TAG = __FILE_NAME__;
 
 
 void app_main(void) {
+    log_sink_init();
+    esp_log_set_vprintf(log_sink_vprintf);
+    event_log_init();
+    // Production statistics are split by shift on the local time
+    init_system_time_from_rtc();
+
     bsp_rs232_init();
     bsp_lcd_init();
+#ifdef BUILD_CONFIG_LVGL_THREADED
+    // The LVGL port task only renders; the controller runs on its own and takes the display lock to touch the view
+    xTaskCreate(controller_task, "Controller", 8192, NULL, 5, NULL);
+#else
     lv_timer_create(loop, 1, NULL);
+#endif
 
     ESP_LOGI(TAG, "App version %s, %s", SOFTWARE_VERSION, SOFTWARE_BUILD_DATE);
 }
 
 
+#ifdef BUILD_CONFIG_LVGL_THREADED
+static void controller_task(void *arg) {
+    (void)arg;
+    static mut_model_t model = {0};
+
+    bsp_lcd_lock();
+    model_init(&model);
+    view_init(&model, gui_view_protocol);
+    controller_init(&model);
+    bsp_lcd_unlock();
+
+    for (;;) {
+        bsp_lcd_lock();
+        unsigned long next_ms = controller_manage(&model);
+        bsp_lcd_unlock();
+
+        // Until a task posts a response, the view handles an input or the next periodic job is due
+        wakeup_wait(next_ms);
+    }
+
+    vTaskDelete(NULL);
+}
+#else
 static void loop(lv_timer_t *timer) {
     static mut_model_t model = {0};
 
@@ -39,6 +84,9 @@ static void loop(lv_timer_t *timer) {
         controller_init(&model);
         first_run = false;
     } else {
-        controller_manage(&model);
+        unsigned long next_ms = controller_manage(&model);
+        // The tasks cannot wake an LVGL timer up, their responses wait for the next frame at most
+        lv_timer_set_period(timer, LV_CLAMP(1, next_ms, LV_DEF_REFR_PERIOD));
     }
 }
+#endif
@@ -0,0 +1,205 @@
+#include <string.h>
+#include <assert.h>
+#include "calibration_curve.h"
+
+
+#define Q16_ROUND(Value) (((Value) + (1UL << (CALIBRATION_CURVE_SHIFT - 1))) >> CALIBRATION_CURVE_SHIFT)
+
+
+static uint16_t find_segment(const calibration_curve_t *curve, uint16_t x, uint8_t by_value);
+static uint32_t interpolate_q16(uint16_t x0, uint16_t y0, uint32_t slope, uint16_t x);
+
+
+void calibration_curve_clear(calibration_curve_t *curve) {
+    assert(curve != NULL);
+    memset(curve, 0, sizeof(calibration_curve_t));
+}
+
+
+/**
+ * Adds a measured point, replacing any point it contradicts: points with the same raw value and points that would
+ * make the curve non monotonic are dropped in favour of the newest measurement
+ *
+ * @return uint8_t 1 if the point was added, 0 if the curve is full
+ */
+uint8_t calibration_curve_add_point(calibration_curve_t *curve, uint16_t raw, uint16_t value) {
+    assert(curve != NULL);
+
+    calibration_curve_t             result   = {0};
+    const calibration_curve_point_t measured = {.raw = raw, .value = value};
+    uint8_t                         added    = 0;
+
+    for (uint16_t i = 0; i < curve->num_points; i++) {
+        const calibration_curve_point_t *point = &curve->points[i];
+
+        if (point->raw < raw && point->value < value) {
+            // Before the new point
+        } else if (point->raw > raw && point->value > value) {
+            // After the new point
+            if (!added) {
+                if (result.num_points == CALIBRATION_CURVE_MAX_POINTS) {
+                    return 0;
+                }
+                result.points[result.num_points++] = measured;
+                added                              = 1;
+            }
+        } else {
+            continue;
+        }
+
+        if (result.num_points == CALIBRATION_CURVE_MAX_POINTS) {
+            return 0;
+        }
+        result.points[result.num_points++] = *point;
+    }
+
+    if (!added) {
+        if (result.num_points == CALIBRATION_CURVE_MAX_POINTS) {
+            return 0;
+        }
+        result.points[result.num_points++] = measured;
+    }
+
+    memcpy(curve, &result, sizeof(calibration_curve_t));
+    return 1;
+}
+
+
+/**
+ * Discards a curve that is not strictly increasing (e.g. read from a corrupted file)
+ */
+void calibration_curve_check(calibration_curve_t *curve) {
+    assert(curve != NULL);
+
+    if (curve->num_points > CALIBRATION_CURVE_MAX_POINTS) {
+        calibration_curve_clear(curve);
+        return;
+    }
+
+    for (uint16_t i = 1; i < curve->num_points; i++) {
+        if (curve->points[i].raw <= curve->points[i - 1].raw || curve->points[i].value <= curve->points[i - 1].value) {
+            calibration_curve_clear(curve);
+            return;
+        }
+    }
+
+    // Unused points are compared when looking for changes
+    memset(&curve->points[curve->num_points], 0,
+           sizeof(calibration_curve_point_t) * (CALIBRATION_CURVE_MAX_POINTS - curve->num_points));
+}
+
+
+uint16_t calibration_curve_get_num_points(const calibration_curve_t *curve) {
+    assert(curve != NULL);
+    return curve->num_points;
+}
+
+
+const calibration_curve_point_t *calibration_curve_get_point(const calibration_curve_t *curve, uint16_t index) {
+    assert(curve != NULL);
+
+    if (index < curve->num_points) {
+        return &curve->points[index];
+    } else {
+        return NULL;
+    }
+}
+
+
+/**
+ * Computes the slopes again if the curve changed
+ *
+ * @return uint8_t 1 if the slopes were computed
+ */
+uint8_t calibration_curve_lut_update(calibration_curve_lut_t *lut, const calibration_curve_t *curve) {
+    assert(lut != NULL && curve != NULL);
+
+    if (memcmp(&lut->source, curve, sizeof(calibration_curve_t)) == 0) {
+        return 0;
+    }
+
+    memcpy(&lut->source, curve, sizeof(calibration_curve_t));
+    memset(lut->value_per_raw, 0, sizeof(lut->value_per_raw));
+    memset(lut->raw_per_value, 0, sizeof(lut->raw_per_value));
+
+    for (uint16_t i = 0; i + 1 < curve->num_points; i++) {
+        // Both coordinates are strictly increasing, the differences are never 0
+        uint32_t raw_delta   = curve->points[i + 1].raw - curve->points[i].raw;
+        uint32_t value_delta = curve->points[i + 1].value - curve->points[i].value;
+
+        lut->value_per_raw[i] = (value_delta << CALIBRATION_CURVE_SHIFT) / raw_delta;
+        lut->raw_per_value[i] = (raw_delta << CALIBRATION_CURVE_SHIFT) / value_delta;
+    }
+
+    return 1;
+}
+
+
+/**
+ * A curve needs at least two points; without it callers fall back to their linear conversion
+ */
+uint8_t calibration_curve_lut_is_active(const calibration_curve_lut_t *lut) {
+    assert(lut != NULL);
+    return lut->source.num_points >= 2;
+}
+
+
+/**
+ * Value corresponding to a raw reading as a Q16 number; the first and last segments are extended past the curve
+ */
+uint32_t calibration_curve_lut_raw_to_value_q16(const calibration_curve_lut_t *lut, uint16_t raw) {
+    assert(calibration_curve_lut_is_active(lut));
+
+    uint16_t                         segment = find_segment(&lut->source, raw, 0);
+    const calibration_curve_point_t *point   = &lut->source.points[segment];
+    return interpolate_q16(point->raw, point->value, lut->value_per_raw[segment], raw);
+}
+
+
+uint16_t calibration_curve_lut_raw_to_value(const calibration_curve_lut_t *lut, uint16_t raw) {
+    return Q16_ROUND(calibration_curve_lut_raw_to_value_q16(lut, raw));
+}
+
+
+uint16_t calibration_curve_lut_value_to_raw(const calibration_curve_lut_t *lut, uint16_t value) {
+    assert(calibration_curve_lut_is_active(lut));
+
+    uint16_t                         segment = find_segment(&lut->source, value, 1);
+    const calibration_curve_point_t *point   = &lut->source.points[segment];
+    return Q16_ROUND(interpolate_q16(point->value, point->raw, lut->raw_per_value[segment], value));
+}
+
+
+/**
+ * Last segment starting at or before `x`, along the raw or the value axis
+ */
+static uint16_t find_segment(const calibration_curve_t *curve, uint16_t x, uint8_t by_value) {
+    uint16_t low  = 0;
+    uint16_t high = curve->num_points - 2;
+
+    while (low < high) {
+        uint16_t middle = (low + high + 1) / 2;
+        uint16_t start  = by_value ? curve->points[middle].value : curve->points[middle].raw;
+        if (start <= x) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    return low;
+}
+
+
+static uint32_t interpolate_q16(uint16_t x0, uint16_t y0, uint32_t slope, uint16_t x) {
+    // Signed and wide, since x may lie before the segment or far past it
+    int64_t result = ((int64_t)y0 << CALIBRATION_CURVE_SHIFT) + ((int64_t)x - x0) * slope;
+
+    if (result < 0) {
+        return 0;
+    } else if (result > ((int64_t)UINT16_MAX << CALIBRATION_CURVE_SHIFT)) {
+        return (uint32_t)UINT16_MAX << CALIBRATION_CURVE_SHIFT;
+    } else {
+        return (uint32_t)result;
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef MODEL_CALIBRATION_CURVE_H_INCLUDED
+#define MODEL_CALIBRATION_CURVE_H_INCLUDED
+
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+#define CALIBRATION_CURVE_MAX_POINTS 8
+#define CALIBRATION_CURVE_SHIFT      16
+
+
+/*
+ * Piecewise linear calibration between a raw quantity (ADC reading, DAC level) and the physical one it measures or
+ * drives. Points are captured on the machine and kept sorted, with both coordinates strictly increasing, so the curve
+ * can be evaluated in either direction. The lookup table holds the slopes of every segment as Q16 numbers: converting
+ * is a binary search for the segment followed by a multiply and a shift.
+ */
+
+
+typedef struct {
+    uint16_t raw;
+    uint16_t value;
+} calibration_curve_point_t;
+
+typedef struct {
+    uint16_t                  num_points;
+    calibration_curve_point_t points[CALIBRATION_CURVE_MAX_POINTS];
+} calibration_curve_t;
+
+typedef struct {
+    // Curve the slopes were computed from
+    calibration_curve_t source;
+
+    uint32_t value_per_raw[CALIBRATION_CURVE_MAX_POINTS - 1];
+    uint32_t raw_per_value[CALIBRATION_CURVE_MAX_POINTS - 1];
+} calibration_curve_lut_t;
+
+
+void                             calibration_curve_clear(calibration_curve_t *curve);
+uint8_t                          calibration_curve_add_point(calibration_curve_t *curve, uint16_t raw, uint16_t value);
+void                             calibration_curve_check(calibration_curve_t *curve);
+uint16_t                         calibration_curve_get_num_points(const calibration_curve_t *curve);
+const calibration_curve_point_t *calibration_curve_get_point(const calibration_curve_t *curve, uint16_t index);
+
+uint8_t  calibration_curve_lut_update(calibration_curve_lut_t *lut, const calibration_curve_t *curve);
+uint8_t  calibration_curve_lut_is_active(const calibration_curve_lut_t *lut);
+uint32_t calibration_curve_lut_raw_to_value_q16(const calibration_curve_lut_t *lut, uint16_t raw);
+uint16_t calibration_curve_lut_raw_to_value(const calibration_curve_lut_t *lut, uint16_t raw);
+uint16_t calibration_curve_lut_value_to_raw(const calibration_curve_lut_t *lut, uint16_t value);
+
+
+#endif
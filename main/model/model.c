@@ -6,7 +6,11 @@
 #include "config/app_config.h"
 
 
-static uint16_t adc_to_mm(model_t *model, uint16_t adc);
+static uint16_t         get_position_level(model_t *model, uint16_t board);
+static const program_t *get_program(model_t *model, int16_t program_index);
+static int16_t          get_current_program_index(model_t *model, uint16_t board);
+static uint16_t         get_position_reading(model_t *model);
+static uint32_t         get_program_key(model_t *model, int16_t program_index);
 
 
 void model_init(mut_model_t *model) {
@@ -24,11 +28,20 @@ void model_init(mut_model_t *model) {
         snprintf(model->config.channel_names[i], sizeof(model->config.channel_names[i]), "CH %i", i + 1);
     }
 
-    model->run.current_program_index         = -1;
+    for (uint16_t i = 0; i < NUM_BOARDS; i++) {
+        model->run.boards[i].current_program_index = -1;
+        statistics_tracker_reset(&model->run.boards[i].statistics_tracker);
+    }
+    for (uint16_t i = 0; i < CAROUSEL_NUM_FORMS; i++) {
+        model->run.carousel.forms[i].program_index = -1;
+    }
+    statistics_reset(&model->run.statistics.data);
     model->run.minion.communication_enabled  = 1;
     model->run.minion.communication_error    = 0;
     model->run.num_importable_configurations = 0;
     model->run.importable_configurations     = NULL;
+
+    position_estimator_reset(&model->run.position_estimator);
 }
 
 
@@ -44,11 +57,16 @@ void model_check_parameters(mut_model_t *model) {
     CHECK_WITHIN(model->config.headgap_offset_up, APP_CONFIG_MIN_HEADGAP_OFFSET, APP_CONFIG_MAX_HEADGAP_OFFSET);
     CHECK_WITHIN(model->config.headgap_offset_down, APP_CONFIG_MIN_HEADGAP_OFFSET, APP_CONFIG_MAX_HEADGAP_OFFSET);
     CHECK_WITHIN(model->config.machine_model, MACHINE_MODEL_TRADITIONAL, MACHINE_MODEL_DOUBLE_FRONT);
+    CHECK_WITHIN(model->config.machine_mode, MACHINE_MODE_NORMAL, MACHINE_MODE_CAROUSEL);
     CHECK_WITHIN(model->config.position_sensor_scale_mm, APP_CONFIG_MIN_POSITION_SENSOR_SCALE_MM,
                  APP_CONFIG_MAX_POSITION_SENSOR_SCALE_MM);
+    calibration_curve_check(&model->config.position_curve);
+    calibration_curve_check(&model->config.pressure_curve);
 
     for (uint16_t i = 0; i < NUM_PROGRAMS; i++) {
         program_check_parameters(&model->config.programs[i], model->config.position_sensor_scale_mm);
+        // The check may have changed the program
+        model->run.program_revisions[i]++;
     }
 #undef CHECK_WITHIN
 }
@@ -63,6 +81,7 @@ size_t model_get_num_programs(model_t *model) {
 void model_copy_program(mut_model_t *model, uint16_t source_index, uint16_t destination_index) {
     assert(model != NULL);
     model->config.programs[destination_index] = model->config.programs[source_index];
+    model_publish_program(model, destination_index);
 }
 
 
@@ -73,6 +92,9 @@ const char *model_get_program_name(model_t *model, size_t num) {
 }
 
 
+/**
+ * Callers that change the program must publish it with model_publish_program
+ */
 program_t *model_get_program_mut(mut_model_t *model, size_t num) {
     assert(model != NULL && num < NUM_PROGRAMS);
     return &model->config.programs[num];
@@ -102,40 +124,184 @@ void model_set_test_output(mut_model_t *model, uint16_t output_index) {
 void model_reset_program(mut_model_t *model, uint16_t program_index) {
     assert(model != NULL);
     program_init(&model->config.programs[program_index]);
+    model_publish_program(model, program_index);
 }
 
 
 void model_clear_current_program(mut_model_t *model) {
     assert(model != NULL);
-    model->run.current_program_index = -1;
+    for (uint16_t i = 0; i < NUM_BOARDS; i++) {
+        model->run.boards[i].current_program_index = -1;
+    }
+    for (uint16_t i = 0; i < CAROUSEL_NUM_FORMS; i++) {
+        model->run.carousel.forms[i].program_index = -1;
+    }
+    model_publish(model, MODEL_TOPIC_CURRENT_PROGRAM);
+}
+
+
+void model_set_current_program(mut_model_t *model, uint16_t board, uint16_t current_program_index) {
+    assert(model != NULL && board < NUM_BOARDS);
+    model->run.boards[board].current_program_index = current_program_index;
+    model_publish(model, MODEL_TOPIC_CURRENT_PROGRAM);
+}
+
+
+void model_publish(mut_model_t *model, model_topic_t topic) {
+    assert(model != NULL && topic < MODEL_NUM_TOPICS);
+    model->run.published.topics |= MODEL_TOPIC_BIT(topic);
 }
 
 
-void model_set_current_program(mut_model_t *model, uint16_t current_program_index) {
+void model_publish_program(mut_model_t *model, uint16_t program_index) {
+    assert(model != NULL && program_index < NUM_PROGRAMS);
+    model->run.published.programs |= ((uint32_t)1) << program_index;
+    model->run.program_revisions[program_index]++;
+    model_publish(model, MODEL_TOPIC_PROGRAM);
+}
+
+
+model_topics_t model_take_published(mut_model_t *model, uint32_t *programs) {
     assert(model != NULL);
-    model->run.current_program_index = current_program_index;
+
+    model_topics_t topics = model->run.published.topics;
+    if (programs != NULL) {
+        *programs = model->run.published.programs;
+    }
+
+    model->run.published.topics   = 0;
+    model->run.published.programs = 0;
+    return topics;
 }
 
 
-uint8_t model_is_program_ready(model_t *model) {
+uint8_t model_is_carousel(model_t *model) {
     assert(model != NULL);
+    return model->config.machine_mode == MACHINE_MODE_CAROUSEL;
+}
 
-    return model->run.current_program_index >= 0;
+
+/**
+ * Boards driven by the display: double front machines have a second power board for the other 16 outputs, while the
+ * carousel alternates its programs on the first one
+ */
+uint16_t model_get_num_boards(model_t *model) {
+    assert(model != NULL);
+    return model->config.machine_model == MACHINE_MODEL_DOUBLE_FRONT && !model_is_carousel(model) ? 2 : 1;
 }
 
 
-const program_t *model_get_current_program(model_t *model) {
+/**
+ * Programs to pick before starting: one for each board, or one for each form of the carousel
+ */
+uint16_t model_get_num_program_choices(model_t *model) {
     assert(model != NULL);
+    return model_is_carousel(model) ? CAROUSEL_NUM_FORMS : model_get_num_boards(model);
+}
+
+
+void model_set_program_choice(mut_model_t *model, uint16_t choice, uint16_t program_index) {
+    assert(model != NULL && choice < model_get_num_program_choices(model));
 
-    if (model_is_program_ready(model)) {
-        return &model->config.programs[model->run.current_program_index];
+    if (model_is_carousel(model)) {
+        model->run.carousel.forms[choice].program_index = program_index;
+        model->run.carousel.forms[choice].cycles        = 0;
+        model_publish(model, MODEL_TOPIC_CURRENT_PROGRAM);
     } else {
-        static program_t program = {0};
-        return &program;
+        model_set_current_program(model, choice, program_index);
     }
 }
 
 
+uint16_t model_get_active_form(model_t *model) {
+    assert(model != NULL);
+    return model->run.carousel.active_form;
+}
+
+
+uint32_t model_get_form_cycles(model_t *model, uint16_t form) {
+    assert(model != NULL && form < CAROUSEL_NUM_FORMS);
+    return model->run.carousel.forms[form].cycles;
+}
+
+
+/**
+ * Counts the cycles of every form and follows the proximity sensors. The form (and so the program of the first board)
+ * changes only between cycles and when exactly one of the forms is detected under the press; its timeline is already
+ * compiled, so the new program can be sent right away
+ *
+ * @return uint8_t 1 if the active form changed
+ */
+uint8_t model_update_carousel(mut_model_t *model) {
+    assert(model != NULL);
+
+    if (!model_is_carousel(model)) {
+        return 0;
+    }
+
+    const minion_read_t *read = &model->run.boards[0].read;
+
+    if (read->running && !model->run.carousel.cycle_running) {
+        model->run.carousel.cycle_form = model->run.carousel.active_form;
+    } else if (!read->running && model->run.carousel.cycle_running) {
+        model->run.carousel.forms[model->run.carousel.cycle_form].cycles++;
+    }
+    model->run.carousel.cycle_running = read->running;
+
+    if (read->running) {
+        return 0;
+    }
+
+    int16_t detected_form = -1;
+    for (uint16_t i = 0; i < CAROUSEL_NUM_FORMS; i++) {
+        if (read->inputs & (1 << (CAROUSEL_FIRST_FORM_INPUT + i))) {
+            if (detected_form >= 0) {
+                // Both sensors on, the carousel is still rotating
+                return 0;
+            }
+            detected_form = i;
+        }
+    }
+
+    if (detected_form < 0 || detected_form == model->run.carousel.active_form) {
+        return 0;
+    }
+
+    model->run.carousel.active_form = detected_form;
+    model_publish(model, MODEL_TOPIC_CURRENT_PROGRAM);
+    return 1;
+}
+
+
+/**
+ * Whether any of the boards is running its program
+ */
+uint8_t model_is_running(model_t *model) {
+    assert(model != NULL);
+
+    for (uint16_t i = 0; i < model_get_num_boards(model); i++) {
+        if (model->run.boards[i].read.running) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+uint8_t model_is_program_ready(model_t *model, uint16_t board) {
+    assert(model != NULL && board < NUM_BOARDS);
+
+    return get_current_program_index(model, board) >= 0;
+}
+
+
+const program_t *model_get_current_program(model_t *model, uint16_t board) {
+    assert(model != NULL && board < NUM_BOARDS);
+
+    return get_program(model, get_current_program_index(model, board));
+}
+
+
 uint8_t model_is_communication_ok(model_t *model) {
     assert(model != NULL);
 
@@ -145,53 +311,99 @@ uint8_t model_is_communication_ok(model_t *model) {
 
 uint16_t model_get_calibrated_position_mm(model_t *model) {
     assert(model != NULL);
+    return position_calibration_reading_to_mm(&model->run.calibration, get_position_reading(model));
+}
 
-    int16_t calibrated_ma4_20 = model->run.minion.read.ma4_20_adc - model->config.ma4_20_offset;
-    if (calibrated_ma4_20 < 0) {
-        calibrated_ma4_20 = 0;
-    }
 
-    return adc_to_mm(model, calibrated_ma4_20);
+uint32_t model_get_calibrated_position_mm_q16(model_t *model) {
+    assert(model != NULL);
+    return position_calibration_reading_to_mm_q16(&model->run.calibration, get_position_reading(model));
 }
 
 
 uint16_t model_get_uncalibrated_position_mm(model_t *model) {
     assert(model != NULL);
+    return position_calibration_adc_to_mm(&model->run.calibration, get_position_reading(model));
+}
+
 
-    return adc_to_mm(model, model->run.minion.read.ma4_20_adc);
+/**
+ * Current position sensor reading net of the zero offset
+ */
+uint16_t model_get_position_adc(model_t *model) {
+    assert(model != NULL);
+    return position_calibration_reading_to_adc(&model->run.calibration, get_position_reading(model));
 }
 
 
 uint16_t model_position_mm_to_adc(model_t *model, uint16_t mm) {
     assert(model != NULL);
+    return position_calibration_mm_to_adc(&model->run.calibration, mm);
+}
 
-    int16_t total_range_adc = model->run.minion.read.ma20_adc - model->run.minion.read.ma4_adc;
-    if (total_range_adc <= 0 || model->config.position_sensor_scale_mm == 0) {
-        return 0;
+
+/**
+ * DAC level (0-100%) driving the proportional valve to the given pressure, in tenths of bar
+ */
+uint16_t model_pressure_to_dac(model_t *model, uint16_t decibar) {
+    assert(model != NULL);
+
+    uint32_t dac_level = 0;
+    if (calibration_curve_lut_is_active(&model->run.pressure_curve)) {
+        dac_level = calibration_curve_lut_value_to_raw(&model->run.pressure_curve, decibar);
+    } else {
+        // Nominal valve: 10V for 6 bar
+        dac_level = ((uint32_t)decibar * APP_CONFIG_MAX_PRESSURE_DAC_LEVEL) / APP_CONFIG_MAX_PRESSURE_LEVEL;
     }
 
-    if (mm > model->config.position_sensor_scale_mm) {
-        // Maximum value
-        return model->run.minion.read.ma20_adc;
+    return dac_level > APP_CONFIG_MAX_PRESSURE_DAC_LEVEL ? APP_CONFIG_MAX_PRESSURE_DAC_LEVEL : dac_level;
+}
+
+
+uint16_t model_dac_to_pressure(model_t *model, uint16_t dac_level) {
+    assert(model != NULL);
+
+    if (calibration_curve_lut_is_active(&model->run.pressure_curve)) {
+        return calibration_curve_lut_raw_to_value(&model->run.pressure_curve, dac_level);
     } else {
-        return (mm * total_range_adc) / (model->config.position_sensor_scale_mm);
+        return ((uint32_t)dac_level * APP_CONFIG_MAX_PRESSURE_LEVEL) / APP_CONFIG_MAX_PRESSURE_DAC_LEVEL;
     }
 }
 
 
-uint16_t model_get_current_position_target(model_t *model) {
+/**
+ * Pairs the current position sensor reading with the distance measured on the machine
+ *
+ * @return uint8_t 1 if the point was added, 0 if the curve is full
+ */
+uint8_t model_add_position_calibration_point(mut_model_t *model, uint16_t mm) {
     assert(model != NULL);
+    return calibration_curve_add_point(&model->config.position_curve, model_get_position_adc(model), mm);
+}
 
-    const program_t *program         = model_get_current_program(model);
-    uint32_t         elapsed_time_ms = model->run.minion.read.elapsed_milliseconds;
 
-    if (program->time_unit_decisecs > 0) {
-        uint16_t position_time_index = elapsed_time_ms / program->time_unit_decisecs;
-        if (position_time_index < PROGRAM_NUM_TIME_UNITS) {
-            uint16_t position_index = program->sensor_channel[position_time_index];
-            if (position_index > 0 && position_index < 4) {
-                return program->position_levels[position_index - 1];
-            }
+/**
+ * Pairs the DAC level currently set in test mode with the pressure read on the gauge
+ *
+ * @return uint8_t 1 if the point was added, 0 if the curve is full
+ */
+uint8_t model_add_pressure_calibration_point(mut_model_t *model, uint16_t decibar) {
+    assert(model != NULL);
+    return calibration_curve_add_point(&model->config.pressure_curve, model->run.minion.write.pwm, decibar);
+}
+
+
+/**
+ * Position the press is heading to, in millimetres; with two boards the first one with a threshold in its current time
+ * unit drives the press
+ */
+uint16_t model_get_current_position_target(model_t *model) {
+    assert(model != NULL);
+
+    for (uint16_t i = 0; i < model_get_num_boards(model); i++) {
+        uint16_t level = get_position_level(model, i);
+        if (level > 0) {
+            return model_get_current_program(model, i)->position_levels[level - 1];
         }
     }
 
@@ -199,18 +411,225 @@ uint16_t model_get_current_position_target(model_t *model) {
 }
 
 
-static uint16_t adc_to_mm(model_t *model, uint16_t adc) {
+/**
+ * Compiles the current programs again if they (or the selection) changed; the programs of both forms of the carousel
+ * are kept compiled, not only the one running
+ *
+ * @return uint8_t 1 if any timeline was compiled
+ */
+uint8_t model_update_current_timeline(mut_model_t *model) {
+    assert(model != NULL);
+
+    uint8_t compiled = 0;
+    for (uint16_t i = 0; i < NUM_BOARDS; i++) {
+        int16_t program_index = model->run.boards[i].current_program_index;
+        compiled |= program_timeline_update(&model->run.boards[i].timeline, get_program(model, program_index),
+                                            get_program_key(model, program_index));
+    }
+    for (uint16_t i = 0; i < CAROUSEL_NUM_FORMS; i++) {
+        int16_t program_index = model->run.carousel.forms[i].program_index;
+        compiled |= program_timeline_update(&model->run.carousel.forms[i].timeline, get_program(model, program_index),
+                                            get_program_key(model, program_index));
+    }
+    return compiled;
+}
+
+
+const program_timeline_t *model_get_current_timeline(model_t *model, uint16_t board) {
+    assert(model != NULL && board < NUM_BOARDS);
+
+    if (model_is_carousel(model) && board == 0) {
+        return &model->run.carousel.forms[model->run.carousel.active_form].timeline;
+    } else {
+        return &model->run.boards[board].timeline;
+    }
+}
+
+
+/**
+ * Computes the position sensor factors and the pressure curve again if the readings at 4 and 20 mA or the
+ * configuration changed
+ *
+ * @return uint8_t 1 if anything was computed
+ */
+uint8_t model_update_calibration(mut_model_t *model) {
+    assert(model != NULL);
+
+    uint8_t position_changed = position_calibration_update(
+        &model->run.calibration, model->run.boards[POSITION_SENSOR_BOARD].read.ma4_adc,
+        model->run.boards[POSITION_SENSOR_BOARD].read.ma20_adc, model->config.position_sensor_scale_mm,
+        model->config.ma4_20_offset, &model->config.position_curve);
+    uint8_t pressure_changed = calibration_curve_lut_update(&model->run.pressure_curve, &model->config.pressure_curve);
+
+    return position_changed || pressure_changed;
+}
+
+
+/**
+ * Sensor reading the current time unit of the program is heading to
+ *
+ * @return uint16_t POSITION_ESTIMATOR_NO_TARGET if the time unit has no position threshold
+ */
+uint16_t model_get_current_position_target_adc(model_t *model) {
+    assert(model != NULL);
+
+    for (uint16_t i = 0; i < model_get_num_boards(model); i++) {
+        uint16_t level = get_position_level(model, i);
+        if (level > 0) {
+            return model->config.ma4_20_offset +
+                   model_position_mm_to_adc(model, model_get_current_program(model, i)->position_levels[level - 1]);
+        }
+    }
+
+    return POSITION_ESTIMATOR_NO_TARGET;
+}
+
+
+/**
+ * Feeds the last position sensor reading to the estimator
+ *
+ * @return uint8_t 1 if a stroke just ended and the stop lag was updated
+ */
+uint8_t model_add_position_sample(mut_model_t *model, uint32_t timestamp_ms) {
+    assert(model != NULL);
+
+    uint16_t target =
+        model_is_running(model) ? model_get_current_position_target_adc(model) : POSITION_ESTIMATOR_NO_TARGET;
+    return position_estimator_add_sample(&model->run.position_estimator, timestamp_ms,
+                                         get_position_reading(model), target);
+}
+
+
+/**
+ * Threshold sent to the minion for a position level of the current program; while the program runs it is moved ahead
+ * by the overshoot predicted for the press
+ */
+uint16_t model_get_position_threshold_adc(model_t *model, uint16_t board, uint16_t level) {
+    assert(model != NULL && board < NUM_BOARDS && level < PROGRAM_SENSOR_LEVELS);
+
+    const program_t *program = model_get_current_program(model, board);
+    uint16_t         target =
+        model->config.ma4_20_offset + model_position_mm_to_adc(model, program->position_levels[level]);
+
+    if (model->run.boards[board].read.running) {
+        uint16_t max_lead = model_position_mm_to_adc(model, APP_CONFIG_MAX_POSITION_LEAD_MM);
+        return position_estimator_adjust_threshold(&model->run.position_estimator, get_position_reading(model),
+                                                   target, max_lead);
+    } else {
+        return target;
+    }
+}
+
+
+/**
+ * Feeds the running state of every board to the production counters; `hour` is the local time of the samples
+ *
+ * @return uint8_t 1 if a cycle ended
+ */
+uint8_t model_update_statistics(mut_model_t *model, uint32_t timestamp_ms, int16_t hour) {
+    assert(model != NULL);
+
+    // The trackers are left untouched: a cycle in progress is picked up from its elapsed time
+    if (!model->run.statistics.loaded) {
+        return 0;
+    }
+
+    uint8_t cycle_ended = 0;
+    for (uint16_t i = 0; i < model_get_num_boards(model); i++) {
+        const minion_read_t *read          = &model->run.boards[i].read;
+        int16_t              program_index = get_current_program_index(model, i);
+
+        cycle_ended |= statistics_update(&model->run.statistics.data, &model->run.boards[i].statistics_tracker,
+                                         timestamp_ms, hour, read->running, read->elapsed_milliseconds, program_index,
+                                         program_get_duration_milliseconds(get_program(model, program_index)));
+    }
+
+    if (cycle_ended) {
+        model->run.statistics.unsaved = 1;
+        model_publish(model, MODEL_TOPIC_STATISTICS);
+    }
+    return cycle_ended;
+}
+
+
+const statistics_t *model_get_statistics(model_t *model) {
     assert(model != NULL);
+    return &model->run.statistics.data;
+}
 
-    int16_t total_range_adc = model->run.minion.read.ma20_adc - model->run.minion.read.ma4_adc;
-    if (total_range_adc <= 0) {
+
+/**
+ * Replaces the counters with the saved ones and starts counting; `statistics` is NULL if nothing could be loaded
+ */
+void model_set_statistics(mut_model_t *model, const statistics_t *statistics) {
+    assert(model != NULL);
+    if (statistics != NULL) {
+        memcpy(&model->run.statistics.data, statistics, sizeof(statistics_t));
+    }
+    model->run.statistics.loaded = 1;
+    model_publish(model, MODEL_TOPIC_STATISTICS);
+}
+
+
+void model_reset_statistics(mut_model_t *model) {
+    assert(model != NULL);
+    statistics_reset(&model->run.statistics.data);
+    model->run.statistics.unsaved = 1;
+    model_publish(model, MODEL_TOPIC_STATISTICS);
+}
+
+
+/**
+ * Position level (1 to 3) of the time unit the board is in, 0 if there is none
+ */
+static uint16_t get_position_level(model_t *model, uint16_t board) {
+    if (!model_is_program_ready(model, board)) {
         return 0;
     }
 
-    if (adc > total_range_adc) {
-        // Maximum value
-        return APP_CONFIG_MAX_POSITION_SENSOR_SCALE_MM;
+    const program_timeline_step_t *step = program_timeline_get_step_at(
+        model_get_current_timeline(model, board), model->run.boards[board].read.elapsed_milliseconds);
+
+    if (step != NULL && step->position > 0 && step->position <= PROGRAM_SENSOR_LEVELS) {
+        return step->position;
+    } else {
+        return 0;
+    }
+}
+
+
+static uint16_t get_position_reading(model_t *model) {
+    return model->run.boards[POSITION_SENSOR_BOARD].read.ma4_20_adc;
+}
+
+
+static const program_t *get_program(model_t *model, int16_t program_index) {
+    if (program_index >= 0) {
+        return &model->config.programs[program_index];
+    } else {
+        static program_t program = {0};
+        return &program;
+    }
+}
+
+
+/**
+ * Key of the program for program_timeline_update: the index in the high half and the revision in the low one. No
+ * program gives 0, the key of a timeline never compiled, which is already empty
+ */
+static uint32_t get_program_key(model_t *model, int16_t program_index) {
+    if (program_index >= 0) {
+        return (((uint32_t)program_index + 1) << 16) | model->run.program_revisions[program_index];
+    } else {
+        return 0;
+    }
+}
+
+
+static int16_t get_current_program_index(model_t *model, uint16_t board) {
+    if (model_is_carousel(model) && board == 0) {
+        return model->run.carousel.forms[model->run.carousel.active_form].program_index;
     } else {
-        return (adc * model->config.position_sensor_scale_mm) / total_range_adc;
+        return model->run.boards[board].current_program_index;
     }
 }
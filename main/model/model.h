@@ -6,11 +6,22 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "program.h"
+#include "program_timeline.h"
+#include "position_calibration.h"
+#include "position_estimator.h"
+#include "statistics.h"
 
 
 #define NUM_PROGRAMS 20
 #define NUM_INPUTS   12
 #define NUM_OUTPUTS  16
+// Power boards; the second one only drives the other 16 outputs of MACHINE_MODEL_DOUBLE_FRONT machines
+#define NUM_BOARDS 2
+// The single position sensor of the press is wired to this board
+#define POSITION_SENSOR_BOARD 0
+// Lower forms of the carousel; the proximity sensor of each one is on consecutive inputs of the first board
+#define CAROUSEL_NUM_FORMS        2
+#define CAROUSEL_FIRST_FORM_INPUT 9
 
 typedef enum {
     OTA_STATE_NONE = 0,
@@ -23,6 +34,12 @@ typedef enum {
     MACHINE_MODEL_DOUBLE_FRONT,
 } machine_model_t;
 
+typedef enum {
+    MACHINE_MODE_NORMAL = 0,
+    // Rotary machine: the programs of the two lower forms alternate under the upper one
+    MACHINE_MODE_CAROUSEL,
+} machine_mode_t;
+
 typedef enum {
     WIFI_CONNECTED,
     WIFI_CONNECTING,
@@ -35,6 +52,45 @@ typedef struct {
     char ssid[33];
 } wifi_network_t;
 
+/*
+ * Change notification topics. Whoever modifies the model publishes the topics it touched; the view forwards them to
+ * the current page only if it subscribed to them.
+ */
+typedef enum {
+    MODEL_TOPIC_MINION_READ = 0,
+    MODEL_TOPIC_MINION_ELAPSED_TIME,
+    MODEL_TOPIC_MINION_COMMUNICATION,
+    MODEL_TOPIC_CURRENT_PROGRAM,
+    MODEL_TOPIC_PROGRAM,
+    MODEL_TOPIC_DRIVE,
+    MODEL_TOPIC_FIRMWARE_UPDATE,
+    MODEL_TOPIC_NETWORK,
+    MODEL_TOPIC_STATISTICS,
+    MODEL_NUM_TOPICS,
+} model_topic_t;
+
+typedef uint32_t model_topics_t;
+
+#define MODEL_TOPIC_BIT(topic) (((model_topics_t)1) << (topic))
+
+_Static_assert(MODEL_NUM_TOPICS <= 32, "Too many model topics");
+_Static_assert(NUM_PROGRAMS <= 32, "The changed programs must fit in a 32 bit mask");
+_Static_assert(NUM_PROGRAMS <= STATISTICS_MAX_PROGRAMS, "Every program must have its production counters");
+
+typedef struct {
+    uint16_t firmware_version_major;
+    uint16_t firmware_version_minor;
+    uint16_t firmware_version_patch;
+    uint16_t inputs;
+    uint16_t ma4_adc;
+    uint16_t ma20_adc;
+    uint16_t ma4_20_adc;
+    uint16_t v0_10_adc;
+    uint8_t  running;
+    // Extended from the 16 bit counter of the board, which wraps within the longest programs
+    uint32_t elapsed_milliseconds;
+} minion_read_t;
+
 typedef struct {
     name_t    channel_names[PROGRAM_NUM_CHANNELS];
     program_t programs[NUM_PROGRAMS];
@@ -42,8 +98,13 @@ typedef struct {
     uint16_t  headgap_offset_up;
     uint16_t  headgap_offset_down;
     uint16_t  machine_model;
+    uint16_t  machine_mode;
     uint16_t  position_sensor_scale_mm;
 
+    // Captured on the test page; with less than two points the linear conversions are used
+    calibration_curve_t position_curve;
+    calibration_curve_t pressure_curve;
+
     program_digital_channel_schedule_t digital_channels[PROGRAM_NUM_CHANNELS];
 } configuration_t;
 
@@ -66,19 +127,7 @@ typedef struct {
             uint8_t communication_error;
             uint8_t communication_enabled;
 
-            struct {
-                uint16_t firmware_version_major;
-                uint16_t firmware_version_minor;
-                uint16_t firmware_version_patch;
-                uint16_t inputs;
-                uint16_t ma4_adc;
-                uint16_t ma20_adc;
-                uint16_t ma4_20_adc;
-                uint16_t v0_10_adc;
-                uint8_t  running;
-                uint16_t elapsed_milliseconds;
-            } read;
-
+            // Test mode drives the first board only
             struct {
                 uint8_t  test_on;
                 uint16_t outputs;
@@ -86,14 +135,62 @@ typedef struct {
             } write;
         } minion;
 
-        int16_t current_program_index;
+        // Every board runs its own program; only the first one is used on single front machines
+        struct {
+            minion_read_t read;
+
+            int16_t current_program_index;
+            // Current program, compiled by model_update_current_timeline
+            program_timeline_t timeline;
+            // Cycle in progress, fed by model_update_statistics
+            statistics_tracker_t statistics_tracker;
+        } boards[NUM_BOARDS];
+
+        // In carousel mode the first board runs the program of the form under the press
+        struct {
+            struct {
+                int16_t program_index;
+                // Kept compiled while the other form works, so that switching costs nothing
+                program_timeline_t timeline;
+                uint32_t           cycles;
+            } forms[CAROUSEL_NUM_FORMS];
+
+            uint16_t active_form;
+            uint8_t  cycle_running;
+            // Form the running cycle is counted for
+            uint16_t cycle_form;
+        } carousel;
+
         uint8_t drive_mounted;
         uint8_t firmware_update_ready;
 
+        // Position sensor factors and pressure curve, computed by model_update_calibration
+        position_calibration_t  calibration;
+        calibration_curve_lut_t pressure_curve;
+        // Speed and stop lag of the press, fed by model_add_position_sample
+        position_estimator_t position_estimator;
+
+        // Production counters of all boards; saved periodically while unsaved is set.
+        // Nothing is counted until the saved counters were loaded, see model_set_statistics
+        struct {
+            statistics_t data;
+            uint8_t      unsaved;
+            uint8_t      loaded;
+        } statistics;
+
         size_t num_importable_configurations;
         char **importable_configurations;
 
         uint8_t network_connected;
+
+        struct {
+            model_topics_t topics;
+            // Mask of the programs that changed, valid with MODEL_TOPIC_PROGRAM
+            uint32_t programs;
+        } published;
+
+        // Bumped at every change of a program, so that the timelines recognize edits without comparing programs
+        uint16_t program_revisions[NUM_PROGRAMS];
     } run;
 
     struct {
@@ -114,16 +211,44 @@ program_t       *model_get_program_mut(mut_model_t *model, size_t num);
 void             model_clear_test_outputs(mut_model_t *model);
 void             model_set_test_output(mut_model_t *model, uint16_t output_index);
 void             model_check_parameters(mut_model_t *model);
-uint8_t          model_is_program_ready(model_t *model);
-const program_t *model_get_current_program(model_t *model);
+uint16_t         model_get_num_boards(model_t *model);
+uint8_t          model_is_running(model_t *model);
+uint8_t          model_is_program_ready(model_t *model, uint16_t board);
+const program_t *model_get_current_program(model_t *model, uint16_t board);
 void             model_clear_current_program(mut_model_t *model);
-void             model_set_current_program(mut_model_t *model, uint16_t current_program_index);
+void             model_set_current_program(mut_model_t *model, uint16_t board, uint16_t current_program_index);
+uint8_t          model_is_carousel(model_t *model);
+uint16_t         model_get_num_program_choices(model_t *model);
+void             model_set_program_choice(mut_model_t *model, uint16_t choice, uint16_t program_index);
+uint16_t         model_get_active_form(model_t *model);
+uint32_t         model_get_form_cycles(model_t *model, uint16_t form);
+uint8_t          model_update_carousel(mut_model_t *model);
 uint8_t          model_is_communication_ok(model_t *model);
 void             model_copy_program(mut_model_t *model, uint16_t source_index, uint16_t destination_index);
 uint16_t         model_get_uncalibrated_position_mm(model_t *model);
 uint16_t         model_get_calibrated_position_mm(model_t *model);
+uint32_t         model_get_calibrated_position_mm_q16(model_t *model);
+uint16_t         model_get_position_adc(model_t *model);
 uint16_t         model_position_mm_to_adc(model_t *model, uint16_t mm);
+uint16_t         model_pressure_to_dac(model_t *model, uint16_t decibar);
+uint16_t         model_dac_to_pressure(model_t *model, uint16_t dac_level);
+uint8_t          model_add_position_calibration_point(mut_model_t *model, uint16_t mm);
+uint8_t          model_add_pressure_calibration_point(mut_model_t *model, uint16_t decibar);
 uint16_t         model_get_current_position_target(model_t *model);
 void             model_reset_program(mut_model_t *model, uint16_t program_index);
+void             model_publish(mut_model_t *model, model_topic_t topic);
+void             model_publish_program(mut_model_t *model, uint16_t program_index);
+model_topics_t   model_take_published(mut_model_t *model, uint32_t *programs);
+
+uint8_t                   model_update_current_timeline(mut_model_t *model);
+const program_timeline_t *model_get_current_timeline(model_t *model, uint16_t board);
+uint8_t                   model_update_calibration(mut_model_t *model);
+uint16_t                  model_get_current_position_target_adc(model_t *model);
+uint8_t                   model_add_position_sample(mut_model_t *model, uint32_t timestamp_ms);
+uint16_t                  model_get_position_threshold_adc(model_t *model, uint16_t board, uint16_t level);
+uint8_t                   model_update_statistics(mut_model_t *model, uint32_t timestamp_ms, int16_t hour);
+const statistics_t       *model_get_statistics(model_t *model);
+void                      model_set_statistics(mut_model_t *model, const statistics_t *statistics);
+void                      model_reset_statistics(mut_model_t *model);
 
 #endif
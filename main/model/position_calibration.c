@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <assert.h>
+#include "position_calibration.h"
+#include "config/app_config.h"
+
+
+#define Q16_ROUND(Value) (((Value) + (1UL << (POSITION_CALIBRATION_SHIFT - 1))) >> POSITION_CALIBRATION_SHIFT)
+
+
+/**
+ * Computes the scale factors again if any of the inputs or the calibration curve changed
+ *
+ * @return uint8_t 1 if the factors were computed
+ */
+uint8_t position_calibration_update(position_calibration_t *calibration, uint16_t ma4_adc, uint16_t ma20_adc,
+                                    uint16_t scale_mm, uint16_t offset_adc, const calibration_curve_t *curve) {
+    assert(calibration != NULL && curve != NULL);
+
+    // Always refreshed, the curve keeps track of its own changes
+    uint8_t curve_changed = calibration_curve_lut_update(&calibration->curve, curve);
+
+    if (!curve_changed && calibration->ma4_adc == ma4_adc && calibration->ma20_adc == ma20_adc &&
+        calibration->scale_mm == scale_mm && calibration->offset_adc == offset_adc) {
+        return 0;
+    }
+
+    calibration->ma4_adc    = ma4_adc;
+    calibration->ma20_adc   = ma20_adc;
+    calibration->scale_mm   = scale_mm;
+    calibration->offset_adc = offset_adc;
+
+    // Without a valid range every conversion yields 0
+    calibration->range_adc  = ma20_adc > ma4_adc ? ma20_adc - ma4_adc : 0;
+    calibration->mm_per_adc = 0;
+    calibration->adc_per_mm = 0;
+
+    if (calibration->range_adc > 0 && scale_mm > 0) {
+        calibration->mm_per_adc = ((uint32_t)scale_mm << POSITION_CALIBRATION_SHIFT) / calibration->range_adc;
+        calibration->adc_per_mm = ((uint32_t)calibration->range_adc << POSITION_CALIBRATION_SHIFT) / scale_mm;
+    }
+
+    return 1;
+}
+
+
+/**
+ * Millimetres corresponding to an ADC value relative to the 4mA reading, rounded to the nearest millimetre
+ */
+uint16_t position_calibration_adc_to_mm(const position_calibration_t *calibration, uint16_t adc) {
+    return Q16_ROUND(position_calibration_adc_to_mm_q16(calibration, adc));
+}
+
+
+/**
+ * Same as position_calibration_adc_to_mm, as a Q16 number for sub-millimetre resolution
+ */
+uint32_t position_calibration_adc_to_mm_q16(const position_calibration_t *calibration, uint16_t adc) {
+    assert(calibration != NULL);
+
+    if (calibration_curve_lut_is_active(&calibration->curve)) {
+        uint32_t mm_q16 = calibration_curve_lut_raw_to_value_q16(&calibration->curve, adc);
+        if (mm_q16 > ((uint32_t)APP_CONFIG_MAX_POSITION_SENSOR_SCALE_MM << POSITION_CALIBRATION_SHIFT)) {
+            return (uint32_t)APP_CONFIG_MAX_POSITION_SENSOR_SCALE_MM << POSITION_CALIBRATION_SHIFT;
+        } else {
+            return mm_q16;
+        }
+    } else if (calibration->range_adc == 0) {
+        return 0;
+    } else if (adc > calibration->range_adc) {
+        // Maximum value
+        return (uint32_t)APP_CONFIG_MAX_POSITION_SENSOR_SCALE_MM << POSITION_CALIBRATION_SHIFT;
+    } else {
+        // adc is within the range, so the product is at most scale_mm in Q16 and cannot overflow
+        return adc * calibration->mm_per_adc;
+    }
+}
+
+
+/**
+ * Millimetres corresponding to a raw sensor reading, net of the calibration offset
+ */
+uint16_t position_calibration_reading_to_mm(const position_calibration_t *calibration, uint16_t reading_adc) {
+    return Q16_ROUND(position_calibration_reading_to_mm_q16(calibration, reading_adc));
+}
+
+
+uint32_t position_calibration_reading_to_mm_q16(const position_calibration_t *calibration, uint16_t reading_adc) {
+    return position_calibration_adc_to_mm_q16(calibration, position_calibration_reading_to_adc(calibration, reading_adc));
+}
+
+
+/**
+ * Raw sensor reading net of the calibration offset, as used by the conversions and stored in the calibration curve
+ */
+uint16_t position_calibration_reading_to_adc(const position_calibration_t *calibration, uint16_t reading_adc) {
+    assert(calibration != NULL);
+    return reading_adc > calibration->offset_adc ? reading_adc - calibration->offset_adc : 0;
+}
+
+
+uint16_t position_calibration_mm_to_adc(const position_calibration_t *calibration, uint16_t mm) {
+    assert(calibration != NULL);
+
+    if (calibration_curve_lut_is_active(&calibration->curve)) {
+        uint16_t adc = calibration_curve_lut_value_to_raw(&calibration->curve, mm);
+        return adc > APP_CONFIG_MAX_SENSOR_LEVEL ? APP_CONFIG_MAX_SENSOR_LEVEL : adc;
+    } else if (calibration->adc_per_mm == 0) {
+        return 0;
+    } else if (mm > calibration->scale_mm) {
+        // Maximum value
+        return calibration->ma20_adc;
+    } else {
+        return Q16_ROUND(mm * calibration->adc_per_mm);
+    }
+}
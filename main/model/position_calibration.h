@@ -0,0 +1,45 @@
+#ifndef MODEL_POSITION_CALIBRATION_H_INCLUDED
+#define MODEL_POSITION_CALIBRATION_H_INCLUDED
+
+
+#include <stdint.h>
+#include "calibration_curve.h"
+
+
+#define POSITION_CALIBRATION_SHIFT CALIBRATION_CURVE_SHIFT
+
+
+/*
+ * Conversions between the 4-20mA position sensor readings and millimetres. The scale factors are computed once, as
+ * Q16 fixed point numbers, whenever one of the inputs changes; every conversion is then a multiply and a shift.
+ * When a calibration curve was captured it replaces the linear 4-20mA model.
+ */
+
+
+typedef struct {
+    // Inputs the factors were computed from
+    uint16_t ma4_adc;
+    uint16_t ma20_adc;
+    uint16_t scale_mm;
+    uint16_t offset_adc;
+
+    uint16_t range_adc;
+    uint32_t mm_per_adc;
+    uint32_t adc_per_mm;
+
+    // Readings net of the offset against millimetres
+    calibration_curve_lut_t curve;
+} position_calibration_t;
+
+
+uint8_t  position_calibration_update(position_calibration_t *calibration, uint16_t ma4_adc, uint16_t ma20_adc,
+                                     uint16_t scale_mm, uint16_t offset_adc, const calibration_curve_t *curve);
+uint16_t position_calibration_adc_to_mm(const position_calibration_t *calibration, uint16_t adc);
+uint32_t position_calibration_adc_to_mm_q16(const position_calibration_t *calibration, uint16_t adc);
+uint16_t position_calibration_reading_to_mm(const position_calibration_t *calibration, uint16_t reading_adc);
+uint32_t position_calibration_reading_to_mm_q16(const position_calibration_t *calibration, uint16_t reading_adc);
+uint16_t position_calibration_reading_to_adc(const position_calibration_t *calibration, uint16_t reading_adc);
+uint16_t position_calibration_mm_to_adc(const position_calibration_t *calibration, uint16_t mm);
+
+
+#endif
@@ -0,0 +1,217 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "position_estimator.h"
+
+
+static int32_t  compute_velocity(const position_estimator_t *estimator);
+static uint8_t  is_before_target(position_estimator_direction_t direction, uint16_t adc, uint16_t target);
+static uint32_t get_approach_speed(const position_estimator_t *estimator, position_estimator_direction_t direction,
+                                   uint16_t adc, uint16_t target);
+
+
+void position_estimator_reset(position_estimator_t *estimator) {
+    assert(estimator != NULL);
+    memset(estimator, 0, sizeof(position_estimator_t));
+    estimator->settled_target = POSITION_ESTIMATOR_NO_TARGET;
+}
+
+
+/**
+ * Adds a sample of the position sensor. `target` is the threshold the press is currently moving to, or
+ * POSITION_ESTIMATOR_NO_TARGET; when the press stops after reaching it the stop lag of that direction is corrected
+ *
+ * @return uint8_t 1 if a stroke was completed and the stop lag updated
+ */
+uint8_t position_estimator_add_sample(position_estimator_t *estimator, uint32_t timestamp_ms, uint16_t adc,
+                                      uint16_t target) {
+    assert(estimator != NULL);
+
+    if (estimator->num_samples > 0) {
+        uint32_t elapsed = timestamp_ms - estimator->samples[estimator->newest].timestamp_ms;
+
+        if (elapsed == 0) {
+            // Same instant, nothing to learn from
+            return 0;
+        } else if (elapsed > POSITION_ESTIMATOR_MAX_GAP_MS) {
+            // Communication stalled, the old samples say nothing about the current movement
+            estimator->num_samples   = 0;
+            estimator->velocity      = 0;
+            estimator->stroke.active = 0;
+        }
+    }
+
+    estimator->newest                     = (estimator->newest + 1) % POSITION_ESTIMATOR_SAMPLES;
+    estimator->samples[estimator->newest] = (position_estimator_sample_t){.timestamp_ms = timestamp_ms, .adc = adc};
+    if (estimator->num_samples < POSITION_ESTIMATOR_SAMPLES) {
+        estimator->num_samples++;
+    }
+    estimator->velocity = compute_velocity(estimator);
+
+    if (target == POSITION_ESTIMATOR_NO_TARGET || (estimator->stroke.active && estimator->stroke.target != target)) {
+        estimator->stroke.active = 0;
+    }
+    if (target == POSITION_ESTIMATOR_NO_TARGET) {
+        return 0;
+    }
+
+    uint32_t                       speed     = abs(estimator->velocity);
+    position_estimator_direction_t direction =
+        estimator->velocity > 0 ? POSITION_ESTIMATOR_DIRECTION_UP : POSITION_ESTIMATOR_DIRECTION_DOWN;
+
+    if (speed > POSITION_ESTIMATOR_STILL_ADC_PER_S) {
+        if (!estimator->stroke.active) {
+            if (is_before_target(direction, adc, target)) {
+                estimator->stroke.active    = 1;
+                estimator->stroke.crossed   = 0;
+                estimator->stroke.direction = direction;
+                estimator->stroke.target    = target;
+                estimator->stroke.speed     = speed;
+            }
+        } else if (estimator->stroke.direction != direction) {
+            // Reversed before stopping; whatever happened, it is not an overshoot
+            estimator->stroke.active = 0;
+        } else if (!estimator->stroke.crossed) {
+            if (is_before_target(direction, adc, target)) {
+                // Speed right before the threshold
+                estimator->stroke.speed = speed;
+            } else {
+                estimator->stroke.crossed = 1;
+            }
+        }
+        return 0;
+    } else if (estimator->stroke.active) {
+        estimator->stroke.active  = 0;
+        estimator->settled_target = target;
+        direction                 = estimator->stroke.direction;
+
+        // Past the target in the direction of the movement, negative when stopping short
+        int32_t overshoot =
+            direction == POSITION_ESTIMATOR_DIRECTION_UP ? (int32_t)adc - target : (int32_t)target - adc;
+        // Lag the overshoot corresponds to at the approach speed
+        int32_t error_ms = (overshoot * 1000) / (int32_t)estimator->stroke.speed;
+
+        // The press stopped for some other reason
+        if (abs(error_ms) > POSITION_ESTIMATOR_MAX_STOP_LAG_MS) {
+            return 0;
+        }
+
+        int32_t stop_lag_ms = estimator->stop_lag_ms[direction] + error_ms / (1 << POSITION_ESTIMATOR_LEARNING_SHIFT);
+        if (stop_lag_ms < 0) {
+            stop_lag_ms = 0;
+        } else if (stop_lag_ms > POSITION_ESTIMATOR_MAX_STOP_LAG_MS) {
+            stop_lag_ms = POSITION_ESTIMATOR_MAX_STOP_LAG_MS;
+        }
+
+        estimator->stop_lag_ms[direction]    = stop_lag_ms;
+        estimator->approach_speed[direction] = estimator->stroke.speed;
+        estimator->last_overshoot            = overshoot;
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+
+int32_t position_estimator_get_velocity(const position_estimator_t *estimator) {
+    assert(estimator != NULL);
+    return estimator->velocity;
+}
+
+
+int32_t position_estimator_get_stop_lag_ms(const position_estimator_t *estimator,
+                                           position_estimator_direction_t direction) {
+    assert(estimator != NULL && direction < POSITION_ESTIMATOR_NUM_DIRECTIONS);
+    return estimator->stop_lag_ms[direction];
+}
+
+
+int32_t position_estimator_get_last_overshoot(const position_estimator_t *estimator) {
+    assert(estimator != NULL);
+    return estimator->last_overshoot;
+}
+
+
+/**
+ * Threshold to send instead of `target`, moved towards the current position by the predicted overshoot. The lead is
+ * limited to `max_lead` and never goes past the current position: a press that would overshoot anyway stops right away
+ */
+uint16_t position_estimator_adjust_threshold(const position_estimator_t *estimator, uint16_t adc, uint16_t target,
+                                             uint16_t max_lead) {
+    assert(estimator != NULL);
+
+    position_estimator_direction_t direction =
+        target >= adc ? POSITION_ESTIMATOR_DIRECTION_UP : POSITION_ESTIMATOR_DIRECTION_DOWN;
+
+    uint32_t speed    = get_approach_speed(estimator, direction, adc, target);
+    uint32_t lead     = (speed * estimator->stop_lag_ms[direction]) / 1000;
+    uint32_t distance = abs((int32_t)target - adc);
+    if (lead > distance) {
+        lead = distance;
+    }
+    if (lead > max_lead) {
+        lead = max_lead;
+    }
+
+    return direction == POSITION_ESTIMATOR_DIRECTION_UP ? target - lead : target + lead;
+}
+
+
+/**
+ * Least squares slope of the samples, in ADC counts per second
+ */
+static int32_t compute_velocity(const position_estimator_t *estimator) {
+    if (estimator->num_samples < 2) {
+        return 0;
+    }
+
+    // Relative to the newest sample to keep the sums small
+    const position_estimator_sample_t *newest = &estimator->samples[estimator->newest];
+
+    int64_t sum_t = 0, sum_x = 0, sum_tt = 0, sum_tx = 0;
+    for (uint16_t i = 0; i < estimator->num_samples; i++) {
+        const position_estimator_sample_t *sample =
+            &estimator->samples[(estimator->newest + POSITION_ESTIMATOR_SAMPLES - i) % POSITION_ESTIMATOR_SAMPLES];
+        int64_t t = -(int64_t)(newest->timestamp_ms - sample->timestamp_ms);
+        int64_t x = (int64_t)sample->adc - newest->adc;
+
+        sum_t += t;
+        sum_x += x;
+        sum_tt += t * t;
+        sum_tx += t * x;
+    }
+
+    int64_t n           = estimator->num_samples;
+    int64_t denominator = n * sum_tt - sum_t * sum_t;
+    if (denominator == 0) {
+        return 0;
+    }
+
+    return (int32_t)(((n * sum_tx - sum_t * sum_x) * 1000) / denominator);
+}
+
+
+static uint8_t is_before_target(position_estimator_direction_t direction, uint16_t adc, uint16_t target) {
+    return direction == POSITION_ESTIMATOR_DIRECTION_UP ? adc < target : adc > target;
+}
+
+
+/**
+ * Current speed if the press is moving to the target, the speed of the last stroke if it is about to start
+ */
+static uint32_t get_approach_speed(const position_estimator_t *estimator, position_estimator_direction_t direction,
+                                   uint16_t adc, uint16_t target) {
+    uint32_t speed = abs(estimator->velocity);
+
+    if (speed > POSITION_ESTIMATOR_STILL_ADC_PER_S) {
+        // Moving away from the target (e.g. overshooting it) there is nothing to anticipate
+        position_estimator_direction_t moving =
+            estimator->velocity > 0 ? POSITION_ESTIMATOR_DIRECTION_UP : POSITION_ESTIMATOR_DIRECTION_DOWN;
+        return moving == direction && is_before_target(direction, adc, target) ? speed : 0;
+    } else if (target == estimator->settled_target) {
+        // Already stopped on this target, the remaining error is left to the minion
+        return 0;
+    } else {
+        return estimator->approach_speed[direction];
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef MODEL_POSITION_ESTIMATOR_H_INCLUDED
+#define MODEL_POSITION_ESTIMATOR_H_INCLUDED
+
+
+#include <stdint.h>
+
+
+#define POSITION_ESTIMATOR_SAMPLES         4
+#define POSITION_ESTIMATOR_MAX_GAP_MS      1000
+#define POSITION_ESTIMATOR_STILL_ADC_PER_S 20
+#define POSITION_ESTIMATOR_MAX_STOP_LAG_MS 500
+// Every stroke corrects half of the measured error
+#define POSITION_ESTIMATOR_LEARNING_SHIFT 1
+#define POSITION_ESTIMATOR_NO_TARGET      0xFFFF
+
+
+/*
+ * Estimates the speed of the press from the position sensor samples and learns, for each direction, how long it keeps
+ * moving after the minion sees the threshold: the stop lag. The thresholds sent to the minion are moved ahead by the
+ * distance covered in that time at the approach speed, so that the press stops on the target despite the hydraulic
+ * inertia and the latency of the link. The lag starts at 0, i.e. without any compensation.
+ */
+
+
+typedef enum {
+    // Readings increasing
+    POSITION_ESTIMATOR_DIRECTION_UP = 0,
+    // Readings decreasing
+    POSITION_ESTIMATOR_DIRECTION_DOWN,
+    POSITION_ESTIMATOR_NUM_DIRECTIONS,
+} position_estimator_direction_t;
+
+typedef struct {
+    uint32_t timestamp_ms;
+    uint16_t adc;
+} position_estimator_sample_t;
+
+typedef struct {
+    position_estimator_sample_t samples[POSITION_ESTIMATOR_SAMPLES];
+    uint16_t                    num_samples;
+    uint16_t                    newest;
+    // ADC counts per second, least squares over the samples
+    int32_t velocity;
+
+    int32_t  stop_lag_ms[POSITION_ESTIMATOR_NUM_DIRECTIONS];
+    uint32_t approach_speed[POSITION_ESTIMATOR_NUM_DIRECTIONS];
+    int32_t  last_overshoot;
+    // Target of the last completed stroke
+    uint16_t settled_target;
+
+    struct {
+        uint8_t  active;
+        uint8_t  crossed;
+        uint8_t  direction;
+        uint16_t target;
+        uint32_t speed;
+    } stroke;
+} position_estimator_t;
+
+
+void     position_estimator_reset(position_estimator_t *estimator);
+uint8_t  position_estimator_add_sample(position_estimator_t *estimator, uint32_t timestamp_ms, uint16_t adc,
+                                       uint16_t target);
+int32_t  position_estimator_get_velocity(const position_estimator_t *estimator);
+int32_t  position_estimator_get_stop_lag_ms(const position_estimator_t *estimator,
+                                            position_estimator_direction_t direction);
+int32_t  position_estimator_get_last_overshoot(const position_estimator_t *estimator);
+uint16_t position_estimator_adjust_threshold(const position_estimator_t *estimator, uint16_t adc, uint16_t target,
+                                             uint16_t max_lead);
+
+
+#endif
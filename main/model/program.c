@@ -5,9 +5,26 @@
 #include "config/app_config.h"
 
 
+#define WORD_INDEX(Instant)  ((Instant) / PROGRAM_SCHEDULE_WORD_BITS)
+#define WORD_MASK(Instant)   (((program_schedule_word_t)1) << ((Instant) % PROGRAM_SCHEDULE_WORD_BITS))
+#define LEVEL_INDEX(Instant) ((Instant) / PROGRAM_LEVELS_PER_BYTE)
+#define LEVEL_SHIFT(Instant) (((Instant) % PROGRAM_LEVELS_PER_BYTE) * 2)
+#define LEVEL_MASK           0x03
+
+_Static_assert(PROGRAM_PRESSURE_CHANNEL_STATE_NUM <= LEVEL_MASK + 1, "Pressure states must fit in two bits");
+_Static_assert(PROGRAM_SENSOR_CHANNEL_THRESHOLD_NUM <= LEVEL_MASK + 1, "Position thresholds must fit in two bits");
+
+
+static uint8_t get_level(const program_level_schedule_t levels, uint16_t instant);
+static void    set_level(program_level_schedule_t levels, uint16_t instant, uint8_t value);
+static void    update_pressure_digital_channel(program_t *program, uint16_t instant);
+static void    clear_units_from(program_t *program, uint16_t first);
+
+
 void program_init(program_t *program) {
     assert(program);
     program->time_unit_decisecs = APP_CONFIG_MIN_TIME_UNIT_DECISECS;
+    program->num_time_units     = PROGRAM_DEFAULT_TIME_UNITS;
     memset(program->digital_channels, 0, sizeof(program->digital_channels));
     memset(program->sensor_channel, 0, sizeof(program->sensor_channel));
     memset(program->pressure_channel, 0, sizeof(program->pressure_channel));
@@ -35,6 +52,7 @@ void program_check_parameters(program_t *program, uint16_t max_position_level) {
     }
     assert(program);
 
+    CHECK_WITHIN(program->num_time_units, PROGRAM_MIN_TIME_UNITS, PROGRAM_MAX_TIME_UNITS);
     CHECK_WITHIN(program->time_unit_decisecs, APP_CONFIG_MIN_TIME_UNIT_DECISECS, APP_CONFIG_MAX_TIME_UNIT_DECISECS);
     CHECK_WITHIN(program->pressure_levels[0], APP_CONFIG_MIN_PRESSURE_LEVEL, APP_CONFIG_MAX_PRESSURE_LEVEL);
     CHECK_WITHIN(program->pressure_levels[1], APP_CONFIG_MIN_PRESSURE_LEVEL, APP_CONFIG_MAX_PRESSURE_LEVEL);
@@ -44,14 +62,9 @@ void program_check_parameters(program_t *program, uint16_t max_position_level) {
     CHECK_WITHIN(program->position_levels[0], 0, max_position_level);
     CHECK_WITHIN(program->position_levels[1], 0, max_position_level);
 
-    for (size_t i = 0; i < PROGRAM_NUM_TIME_UNITS; i++) {
-        // The pressure channel also flips the corresponding digital output
-        if (program->pressure_channel[i] == 0) {
-            program->digital_channels[PROGRAM_PRESSURE_CHANNEL_INDEX] &=
-                ~(((program_digital_channel_schedule_t)1) << i);
-        } else {
-            program->digital_channels[PROGRAM_PRESSURE_CHANNEL_INDEX] |= ((program_digital_channel_schedule_t)1) << i;
-        }
+    clear_units_from(program, program->num_time_units);
+    for (uint16_t i = 0; i < program->num_time_units; i++) {
+        update_pressure_digital_channel(program, i);
     }
 
 #undef CHECK_WITHIN
@@ -60,54 +73,150 @@ void program_check_parameters(program_t *program, uint16_t max_position_level) {
 
 uint8_t program_get_digital_channel_state_at(const program_t *program, uint16_t channel, uint16_t instant) {
     assert(program && channel < PROGRAM_NUM_PROGRAMMABLE_CHANNELS);
-    return (program->digital_channels[channel] & (((program_digital_channel_schedule_t)1) << instant)) > 0;
+    if (instant >= program->num_time_units) {
+        return 0;
+    }
+    return (program->digital_channels[channel][WORD_INDEX(instant)] & WORD_MASK(instant)) > 0;
 }
 
 
 program_pressure_channel_state_t program_get_pressure_channel_state_at(const program_t *program, uint16_t instant) {
     assert(program);
-    return program->pressure_channel[instant];
+    if (instant >= program->num_time_units) {
+        return PROGRAM_PRESSURE_CHANNEL_STATE_OFF;
+    }
+    return get_level(program->pressure_channel, instant);
 }
 
 
 program_sensor_channel_threshold_t program_get_sensor_channel_state_at(const program_t *program, uint16_t instant) {
     assert(program);
-    return program->sensor_channel[instant];
+    if (instant >= program->num_time_units) {
+        return PROGRAM_SENSOR_CHANNEL_THRESHOLD_NONE;
+    }
+    return get_level(program->sensor_channel, instant);
 }
 
 
 void program_increase_pressure_channel_state_at(program_t *program, uint16_t instant) {
     assert(program);
-    program->pressure_channel[instant] = (program->pressure_channel[instant] + 1) % PROGRAM_PRESSURE_CHANNEL_STATE_NUM;
-    // The pressure channel also flips the corresponding digital output
-    if (program->pressure_channel[instant] == 0) {
-        program->digital_channels[PROGRAM_PRESSURE_CHANNEL_INDEX] &=
-            ~(((program_digital_channel_schedule_t)1) << instant);
-    } else {
-        program->digital_channels[PROGRAM_PRESSURE_CHANNEL_INDEX] |= ((program_digital_channel_schedule_t)1) << instant;
-    }
+    program_set_pressure_channel_state_at(
+        program, instant,
+        (program_get_pressure_channel_state_at(program, instant) + 1) % PROGRAM_PRESSURE_CHANNEL_STATE_NUM);
 }
 
 
 void program_increase_sensor_channel_threshold_at(program_t *program, uint16_t instant) {
     assert(program);
-    program->sensor_channel[instant] = (program->sensor_channel[instant] + 1) % PROGRAM_SENSOR_CHANNEL_THRESHOLD_NUM;
+    program_set_sensor_channel_threshold_at(
+        program, instant,
+        (program_get_sensor_channel_state_at(program, instant) + 1) % PROGRAM_SENSOR_CHANNEL_THRESHOLD_NUM);
+}
+
+
+void program_set_pressure_channel_state_at(program_t *program, uint16_t instant,
+                                           program_pressure_channel_state_t state) {
+    assert(program);
+    if (instant >= program->num_time_units) {
+        return;
+    }
+    set_level(program->pressure_channel, instant, state);
+    update_pressure_digital_channel(program, instant);
+}
+
+
+void program_set_sensor_channel_threshold_at(program_t *program, uint16_t instant,
+                                             program_sensor_channel_threshold_t threshold) {
+    assert(program);
+    if (instant >= program->num_time_units) {
+        return;
+    }
+    set_level(program->sensor_channel, instant, threshold);
 }
 
 
 void program_flip_digital_channel_state_at(program_t *program, uint16_t channel, uint16_t instant) {
     assert(program && channel < PROGRAM_NUM_PROGRAMMABLE_CHANNELS);
+    if (instant >= program->num_time_units) {
+        return;
+    }
+    program->digital_channels[channel][WORD_INDEX(instant)] ^= WORD_MASK(instant);
+}
 
-    if (program_get_digital_channel_state_at(program, channel, instant)) {
-        program->digital_channels[channel] &= ~(((program_digital_channel_schedule_t)1) << instant);
-    } else {
-        program->digital_channels[channel] |= ((program_digital_channel_schedule_t)1) << instant;
+
+uint16_t program_get_num_time_units(const program_t *program) {
+    assert(program);
+    return program->num_time_units;
+}
+
+
+/**
+ * Changes the length of the program; the units cut away are cleared, so growing the program back adds empty units
+ */
+void program_set_num_time_units(program_t *program, uint16_t num_time_units) {
+    assert(program);
+
+    if (num_time_units < PROGRAM_MIN_TIME_UNITS) {
+        num_time_units = PROGRAM_MIN_TIME_UNITS;
+    } else if (num_time_units > PROGRAM_MAX_TIME_UNITS) {
+        num_time_units = PROGRAM_MAX_TIME_UNITS;
     }
+
+    clear_units_from(program, num_time_units);
+    program->num_time_units = num_time_units;
 }
 
 
 uint32_t program_get_duration_milliseconds(const program_t *program) {
     assert(program);
 
-    return PROGRAM_NUM_TIME_UNITS * program->time_unit_decisecs * 100;
+    return program->num_time_units * program->time_unit_decisecs * 100;
+}
+
+
+static uint8_t get_level(const program_level_schedule_t levels, uint16_t instant) {
+    return (levels[LEVEL_INDEX(instant)] >> LEVEL_SHIFT(instant)) & LEVEL_MASK;
+}
+
+
+static void set_level(program_level_schedule_t levels, uint16_t instant, uint8_t value) {
+    uint8_t *byte = &levels[LEVEL_INDEX(instant)];
+    *byte         = (*byte & ~(LEVEL_MASK << LEVEL_SHIFT(instant))) | ((value & LEVEL_MASK) << LEVEL_SHIFT(instant));
+}
+
+
+static void update_pressure_digital_channel(program_t *program, uint16_t instant) {
+    // The pressure channel also flips the corresponding digital output
+    program_schedule_word_t *word = &program->digital_channels[PROGRAM_PRESSURE_CHANNEL_INDEX][WORD_INDEX(instant)];
+    if (get_level(program->pressure_channel, instant) == PROGRAM_PRESSURE_CHANNEL_STATE_OFF) {
+        *word &= ~WORD_MASK(instant);
+    } else {
+        *word |= WORD_MASK(instant);
+    }
+}
+
+
+/**
+ * Empties every unit from `first` to the end of the buffers, a word (or byte) at a time. The buffers are rounded up
+ * to whole words and bytes, so they may hold a few units past PROGRAM_MAX_TIME_UNITS
+ */
+static void clear_units_from(program_t *program, uint16_t first) {
+    if (first < PROGRAM_SCHEDULE_WORDS * PROGRAM_SCHEDULE_WORD_BITS) {
+        uint16_t                word_index = WORD_INDEX(first);
+        program_schedule_word_t word_mask  = WORD_MASK(first) - 1;
+        for (uint16_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
+            program->digital_channels[i][word_index] &= word_mask;
+            memset(&program->digital_channels[i][word_index + 1], 0,
+                   (PROGRAM_SCHEDULE_WORDS - word_index - 1) * sizeof(program_schedule_word_t));
+        }
+    }
+
+    if (first < PROGRAM_LEVEL_BYTES * PROGRAM_LEVELS_PER_BYTE) {
+        uint16_t level_index = LEVEL_INDEX(first);
+        uint8_t  level_mask  = (1 << LEVEL_SHIFT(first)) - 1;
+        program->pressure_channel[level_index] &= level_mask;
+        program->sensor_channel[level_index] &= level_mask;
+        memset(&program->pressure_channel[level_index + 1], 0, PROGRAM_LEVEL_BYTES - level_index - 1);
+        memset(&program->sensor_channel[level_index + 1], 0, PROGRAM_LEVEL_BYTES - level_index - 1);
+    }
 }
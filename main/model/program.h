@@ -3,32 +3,40 @@
 
 
 #include <stdint.h>
+#include "config/app_config.h"
 
 
 #define PROGRAM_NAME_LENGTH               20
 #define PROGRAM_NAME_SIZE                 (PROGRAM_NAME_LENGTH + 1)
 #define PROGRAM_NUM_CHANNELS              16
 #define PROGRAM_NUM_PROGRAMMABLE_CHANNELS 15
-#define PROGRAM_NUM_TIME_UNITS            25
 #define PROGRAM_PRESSURE_CHANNEL_INDEX    7
 #define PROGRAM_SENSOR_CHANNEL_INDEX      11
 
+// Programs have their own length, up to what the power board runs; the schedules are sized on it. The saved format
+// allows longer programs, which storage cuts down when loading
+#define PROGRAM_MIN_TIME_UNITS     1
+#define PROGRAM_DEFAULT_TIME_UNITS 25
+#define PROGRAM_MAX_TIME_UNITS     APP_CONFIG_MAX_TIME_UNITS
+
+#define PROGRAM_SCHEDULE_WORD_BITS 32
+#define PROGRAM_LEVELS_PER_BYTE    4
+#define PROGRAM_SCHEDULE_WORDS_FOR(Units)                                                                              \
+    (((Units) + PROGRAM_SCHEDULE_WORD_BITS - 1) / PROGRAM_SCHEDULE_WORD_BITS)
+#define PROGRAM_LEVEL_BYTES_FOR(Units) (((Units) + PROGRAM_LEVELS_PER_BYTE - 1) / PROGRAM_LEVELS_PER_BYTE)
+#define PROGRAM_SCHEDULE_WORDS         PROGRAM_SCHEDULE_WORDS_FOR(PROGRAM_MAX_TIME_UNITS)
+#define PROGRAM_LEVEL_BYTES            PROGRAM_LEVEL_BYTES_FOR(PROGRAM_MAX_TIME_UNITS)
+
 
 typedef char name_t[PROGRAM_NAME_SIZE];
 
-typedef
-#if PROGRAM_NUM_TIME_UNITS <= 8
-    uint8_t
-#elif PROGRAM_NUM_TIME_UNITS <= 16
-    uint16_t
-#elif PROGRAM_NUM_TIME_UNITS <= 32
-    uint32_t
-#elif PROGRAM_NUM_TIME_UNITS <= 64
-    uint64_t
-#else
-#error "Too many time units!"
-#endif
-        program_digital_channel_schedule_t;
+typedef uint32_t program_schedule_word_t;
+
+// One bit per time unit
+typedef program_schedule_word_t program_digital_channel_schedule_t[PROGRAM_SCHEDULE_WORDS];
+
+// Two bits per time unit, four units per byte
+typedef uint8_t program_level_schedule_t[PROGRAM_LEVEL_BYTES];
 
 typedef enum {
     PROGRAM_PRESSURE_CHANNEL_STATE_OFF = 0,
@@ -57,11 +65,14 @@ typedef struct {
     // Pressure and position, at indexes 7 and 11, are special; their digital channel is always empty and they are
     // managed with the two following fields
     program_digital_channel_schedule_t digital_channels[PROGRAM_NUM_PROGRAMMABLE_CHANNELS];
-    program_pressure_channel_state_t   pressure_channel[PROGRAM_NUM_TIME_UNITS];
-    program_sensor_channel_threshold_t sensor_channel[PROGRAM_NUM_TIME_UNITS];
-    uint16_t                           time_unit_decisecs;
-    uint16_t                           pressure_levels[PROGRAM_PRESSURE_LEVELS];
-    uint16_t                           position_levels[PROGRAM_SENSOR_LEVELS];
+    // Packed program_pressure_channel_state_t and program_sensor_channel_threshold_t values, use the accessors
+    program_level_schedule_t pressure_channel;
+    program_level_schedule_t sensor_channel;
+    // Units past the length are always kept empty
+    uint16_t num_time_units;
+    uint16_t time_unit_decisecs;
+    uint16_t pressure_levels[PROGRAM_PRESSURE_LEVELS];
+    uint16_t position_levels[PROGRAM_SENSOR_LEVELS];
 } program_t;
 
 
@@ -71,9 +82,14 @@ program_sensor_channel_threshold_t program_get_sensor_channel_state_at(const pro
 program_pressure_channel_state_t   program_get_pressure_channel_state_at(const program_t *program, uint16_t instant);
 void                               program_increase_pressure_channel_state_at(program_t *program, uint16_t instant);
 void                               program_increase_sensor_channel_threshold_at(program_t *program, uint16_t instant);
-void                               program_init(program_t *program);
-void                               program_check_parameters(program_t *program, uint16_t max_position_level);
-uint32_t                           program_get_duration_milliseconds(const program_t *program);
+void program_set_pressure_channel_state_at(program_t *program, uint16_t instant, program_pressure_channel_state_t state);
+void program_set_sensor_channel_threshold_at(program_t *program, uint16_t instant,
+                                             program_sensor_channel_threshold_t threshold);
+uint16_t program_get_num_time_units(const program_t *program);
+void     program_set_num_time_units(program_t *program, uint16_t num_time_units);
+void     program_init(program_t *program);
+void     program_check_parameters(program_t *program, uint16_t max_position_level);
+uint32_t program_get_duration_milliseconds(const program_t *program);
 
 
 #endif
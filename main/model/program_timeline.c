@@ -0,0 +1,127 @@
+#include <assert.h>
+#include "program_timeline.h"
+
+
+static program_timeline_step_t get_state_at(const program_t *program, uint16_t instant);
+
+
+void program_timeline_compile(program_timeline_t *timeline, const program_t *program) {
+    assert(timeline != NULL && program != NULL);
+
+    timeline->num_steps      = 0;
+    timeline->num_time_units = program_get_num_time_units(program);
+    timeline->time_unit_ms   = program->time_unit_decisecs * 100;
+
+    for (uint16_t i = 0; i < timeline->num_time_units; i++) {
+        program_timeline_step_t state = get_state_at(program, i);
+
+        if (timeline->num_steps > 0) {
+            const program_timeline_step_t *last = &timeline->steps[timeline->num_steps - 1];
+            if (last->outputs == state.outputs && last->pressure == state.pressure &&
+                last->position == state.position) {
+                continue;
+            }
+        }
+
+        state.first_unit                       = i;
+        state.start_ms                         = i * timeline->time_unit_ms;
+        timeline->steps[timeline->num_steps++] = state;
+    }
+}
+
+
+/**
+ * Compiles the program again only if its key changed since the last compilation; the caller builds the key so that it
+ * changes with every edit of the program
+ *
+ * @return uint8_t 1 if the timeline was compiled
+ */
+uint8_t program_timeline_update(program_timeline_t *timeline, const program_t *program, uint32_t source_key) {
+    assert(timeline != NULL && program != NULL);
+
+    if (timeline->source_key == source_key) {
+        return 0;
+    }
+
+    program_timeline_compile(timeline, program);
+    timeline->source_key = source_key;
+    return 1;
+}
+
+
+uint16_t program_timeline_get_num_steps(const program_timeline_t *timeline) {
+    assert(timeline != NULL);
+    return timeline->num_steps;
+}
+
+
+const program_timeline_step_t *program_timeline_get_step(const program_timeline_t *timeline, uint16_t index) {
+    assert(timeline != NULL);
+
+    if (index < timeline->num_steps) {
+        return &timeline->steps[index];
+    } else {
+        return NULL;
+    }
+}
+
+
+/**
+ * Finds the step running at `elapsed_ms` with a binary search
+ *
+ * @return NULL if the program is already over
+ */
+const program_timeline_step_t *program_timeline_get_step_at(const program_timeline_t *timeline, uint32_t elapsed_ms) {
+    assert(timeline != NULL);
+
+    if (timeline->num_steps == 0 || elapsed_ms >= program_timeline_get_duration_ms(timeline)) {
+        return NULL;
+    }
+
+    // Last step starting at or before the elapsed time
+    uint16_t low  = 0;
+    uint16_t high = timeline->num_steps - 1;
+    while (low < high) {
+        uint16_t middle = (low + high + 1) / 2;
+        if (timeline->steps[middle].start_ms <= elapsed_ms) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    return &timeline->steps[low];
+}
+
+
+uint16_t program_timeline_get_step_last_unit(const program_timeline_t *timeline, uint16_t index) {
+    assert(timeline != NULL && index < timeline->num_steps);
+
+    if (index + 1 < timeline->num_steps) {
+        return timeline->steps[index + 1].first_unit - 1;
+    } else {
+        return timeline->num_time_units - 1;
+    }
+}
+
+
+uint32_t program_timeline_get_duration_ms(const program_timeline_t *timeline) {
+    assert(timeline != NULL);
+    return timeline->num_time_units * timeline->time_unit_ms;
+}
+
+
+static program_timeline_step_t get_state_at(const program_t *program, uint16_t instant) {
+    program_timeline_step_t state = {
+        .pressure = program_get_pressure_channel_state_at(program, instant),
+        .position = program_get_sensor_channel_state_at(program, instant),
+    };
+
+    for (uint16_t i = 0; i < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; i++) {
+        if (program_get_digital_channel_state_at(program, i, instant)) {
+            state.outputs |= 1 << i;
+        }
+    }
+
+    return state;
+}
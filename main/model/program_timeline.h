@@ -0,0 +1,48 @@
+#ifndef MODEL_PROGRAM_TIMELINE_H_INCLUDED
+#define MODEL_PROGRAM_TIMELINE_H_INCLUDED
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "program.h"
+
+
+/*
+ * A program compiled into a run-length list of steps: a new step starts whenever an output, the pressure level or the
+ * position threshold changes. Steps are sorted by time, so the state at any elapsed time is a binary search away and
+ * the transitions of each channel can be read by comparing consecutive steps.
+ */
+
+
+typedef struct {
+    uint32_t start_ms;
+    uint16_t first_unit;
+    // One bit per programmable channel, including the digital output driven by the pressure channel
+    uint16_t outputs;
+    // program_pressure_channel_state_t and program_sensor_channel_threshold_t, as bytes to keep the steps small
+    uint8_t pressure;
+    uint8_t position;
+} program_timeline_step_t;
+
+typedef struct {
+    uint16_t                num_steps;
+    uint16_t                num_time_units;
+    uint32_t                time_unit_ms;
+    program_timeline_step_t steps[PROGRAM_MAX_TIME_UNITS];
+
+    // Identifies the compiled program and its revision, to recognize changes; 0 is the empty program
+    uint32_t source_key;
+} program_timeline_t;
+
+
+void                           program_timeline_compile(program_timeline_t *timeline, const program_t *program);
+uint8_t                        program_timeline_update(program_timeline_t *timeline, const program_t *program,
+                                                       uint32_t source_key);
+uint16_t                       program_timeline_get_num_steps(const program_timeline_t *timeline);
+const program_timeline_step_t *program_timeline_get_step(const program_timeline_t *timeline, uint16_t index);
+const program_timeline_step_t *program_timeline_get_step_at(const program_timeline_t *timeline, uint32_t elapsed_ms);
+uint16_t                       program_timeline_get_step_last_unit(const program_timeline_t *timeline, uint16_t index);
+uint32_t                       program_timeline_get_duration_ms(const program_timeline_t *timeline);
+
+
+#endif
@@ -0,0 +1,129 @@
+#include <string.h>
+#include <assert.h>
+#include "statistics.h"
+
+
+static void add_cycle(statistics_t *statistics, const statistics_tracker_t *tracker, uint32_t cycle_ms);
+static void add_idle_time(statistics_t *statistics, uint16_t shift, uint32_t idle_ms);
+
+
+// Upper bounds of the idle time bins, the last one has none
+static const uint32_t idle_bin_limits_s[STATISTICS_IDLE_BINS - 1] = {10, 30, 60, 5 * 60, 15 * 60, 30 * 60, 60 * 60};
+
+
+void statistics_reset(statistics_t *statistics) {
+    assert(statistics != NULL);
+    memset(statistics, 0, sizeof(statistics_t));
+}
+
+
+void statistics_tracker_reset(statistics_tracker_t *tracker) {
+    assert(tracker != NULL);
+    memset(tracker, 0, sizeof(statistics_tracker_t));
+    tracker->program_index = -1;
+}
+
+
+/**
+ * Feeds a sample of the state of a board. `hour` is the local time, used to assign cycles and pauses to the shifts;
+ * negative if unknown
+ *
+ * @return uint8_t 1 if a cycle just ended and was accounted
+ */
+uint8_t statistics_update(statistics_t *statistics, statistics_tracker_t *tracker, uint32_t timestamp_ms, int16_t hour,
+                          uint8_t running, uint32_t elapsed_ms, int16_t program_index, uint32_t nominal_cycle_ms) {
+    assert(statistics != NULL && tracker != NULL);
+
+    if (running && !tracker->running) {
+        tracker->running          = 1;
+        tracker->cycle_start_ms   = timestamp_ms - elapsed_ms;
+        tracker->program_index    = program_index;
+        tracker->nominal_cycle_ms = nominal_cycle_ms;
+        tracker->shift            = hour < 0 ? STATISTICS_NO_SHIFT : statistics_get_shift(hour);
+
+        if (tracker->idle) {
+            // The cycle may have started before the previous one was seen ending
+            int32_t idle_ms = (int32_t)(tracker->cycle_start_ms - tracker->idle_start_ms);
+            add_idle_time(statistics, tracker->shift, idle_ms > 0 ? idle_ms : 0);
+        }
+        return 0;
+    } else if (!running && tracker->running) {
+        tracker->running       = 0;
+        tracker->idle          = 1;
+        tracker->idle_start_ms = timestamp_ms;
+
+        add_cycle(statistics, tracker, timestamp_ms - tracker->cycle_start_ms);
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+
+uint16_t statistics_get_shift(uint16_t hour) {
+    return ((hour + 24 - STATISTICS_FIRST_SHIFT_HOUR) % 24) / STATISTICS_SHIFT_HOURS;
+}
+
+
+/**
+ * Idle times in `bin` are shorter than the returned number of seconds, 0 for the last bin, which has no bound
+ */
+uint32_t statistics_get_idle_bin_limit_s(uint16_t bin) {
+    assert(bin < STATISTICS_IDLE_BINS);
+    return bin < STATISTICS_IDLE_BINS - 1 ? idle_bin_limits_s[bin] : 0;
+}
+
+
+const statistics_program_t *statistics_get_program(const statistics_t *statistics, uint16_t program_index) {
+    assert(statistics != NULL && program_index < STATISTICS_MAX_PROGRAMS);
+    return &statistics->programs[program_index];
+}
+
+
+uint32_t statistics_get_average_cycle_ms(const statistics_program_t *program) {
+    assert(program != NULL);
+
+    if (program->cycles > 0) {
+        return (uint32_t)(program->total_cycle_ms / program->cycles);
+    } else {
+        return 0;
+    }
+}
+
+
+static void add_cycle(statistics_t *statistics, const statistics_tracker_t *tracker, uint32_t cycle_ms) {
+    if (tracker->shift < STATISTICS_NUM_SHIFTS) {
+        statistics_shift_t *shift = &statistics->shifts[tracker->shift];
+        shift->cycles++;
+        shift->running_ms += cycle_ms;
+    }
+
+    // Cycles started without a program (e.g. from the test page) only count for the shift
+    if (tracker->program_index < 0 || tracker->program_index >= STATISTICS_MAX_PROGRAMS) {
+        return;
+    }
+
+    statistics_program_t *program = &statistics->programs[tracker->program_index];
+    if (program->cycles == 0 || cycle_ms < program->min_cycle_ms) {
+        program->min_cycle_ms = cycle_ms;
+    }
+    if (cycle_ms > program->max_cycle_ms) {
+        program->max_cycle_ms = cycle_ms;
+    }
+    program->cycles++;
+    program->total_cycle_ms += cycle_ms;
+    program->nominal_cycle_ms = tracker->nominal_cycle_ms;
+}
+
+
+static void add_idle_time(statistics_t *statistics, uint16_t shift, uint32_t idle_ms) {
+    if (shift < STATISTICS_NUM_SHIFTS) {
+        statistics->shifts[shift].idle_ms += idle_ms;
+    }
+
+    uint16_t bin = 0;
+    while (bin < STATISTICS_IDLE_BINS - 1 && idle_ms >= idle_bin_limits_s[bin] * 1000UL) {
+        bin++;
+    }
+    statistics->idle_histogram[bin]++;
+}
@@ -0,0 +1,74 @@
+#ifndef MODEL_STATISTICS_H_INCLUDED
+#define MODEL_STATISTICS_H_INCLUDED
+
+
+#include <stdint.h>
+
+
+#define STATISTICS_MAX_PROGRAMS 20
+#define STATISTICS_IDLE_BINS    8
+// Three shifts of eight hours, the first one starting at 6
+#define STATISTICS_NUM_SHIFTS       3
+#define STATISTICS_SHIFT_HOURS      8
+#define STATISTICS_FIRST_SHIFT_HOUR 6
+// Assigned while the local time is unknown: the cycles count for their program only
+#define STATISTICS_NO_SHIFT STATISTICS_NUM_SHIFTS
+
+
+/*
+ * Production counters, fed with the running state of the minion. A cycle lasts from the sample where the minion starts
+ * running (backdated by the time it already reports as elapsed) to the first sample where it stopped; the pause before
+ * it is the idle time. Everything is accumulated in place, so the memory used does not depend on how long the machine
+ * works.
+ */
+
+
+typedef struct {
+    uint32_t cycles;
+    uint32_t min_cycle_ms;
+    uint32_t max_cycle_ms;
+    uint64_t total_cycle_ms;
+    // Duration of the program at the start of the last cycle, to compare the actual ones with
+    uint32_t nominal_cycle_ms;
+} statistics_program_t;
+
+typedef struct {
+    uint32_t cycles;
+    uint64_t running_ms;
+    uint64_t idle_ms;
+} statistics_shift_t;
+
+typedef struct {
+    statistics_program_t programs[STATISTICS_MAX_PROGRAMS];
+    statistics_shift_t   shifts[STATISTICS_NUM_SHIFTS];
+    // Pauses between cycles, see statistics_get_idle_bin_limit_s
+    uint32_t idle_histogram[STATISTICS_IDLE_BINS];
+} statistics_t;
+
+// Cycle in progress on one board; not saved, a cycle interrupted by a restart is lost
+typedef struct {
+    uint8_t  running;
+    int16_t  program_index;
+    uint32_t nominal_cycle_ms;
+    uint32_t cycle_start_ms;
+    uint16_t shift;
+
+    // Set after the first cycle, when the pauses can be measured
+    uint8_t  idle;
+    uint32_t idle_start_ms;
+} statistics_tracker_t;
+
+
+void     statistics_reset(statistics_t *statistics);
+void     statistics_tracker_reset(statistics_tracker_t *tracker);
+uint8_t  statistics_update(statistics_t *statistics, statistics_tracker_t *tracker, uint32_t timestamp_ms,
+                           int16_t hour, uint8_t running, uint32_t elapsed_ms, int16_t program_index,
+                           uint32_t nominal_cycle_ms);
+uint16_t statistics_get_shift(uint16_t hour);
+uint32_t statistics_get_idle_bin_limit_s(uint16_t bin);
+
+const statistics_program_t *statistics_get_program(const statistics_t *statistics, uint16_t program_index);
+uint32_t                    statistics_get_average_cycle_ms(const statistics_program_t *program);
+
+
+#endif
@@ -0,0 +1,88 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "event_log.h"
+#include "record_ring.h"
+#include "serializer.h"
+#include "timestamp.h"
+
+
+#define EVENT_LOG_SLOTS 256
+
+
+static struct {
+    record_ring_t ring;
+    int           initialized;
+} state = {0};
+
+
+void event_log_init(void) {
+    static uint32_t memory[RECORD_RING_MEMORY_SIZE(EVENT_LOG_SLOTS, EVENT_LOG_MAX_RECORD_SIZE) / sizeof(uint32_t)] = {
+        0};
+    record_ring_init(&state.ring, memory, EVENT_LOG_SLOTS, EVENT_LOG_MAX_RECORD_SIZE);
+    state.initialized = 1;
+}
+
+
+void event_log_record(event_log_id_t id, const int32_t *args, size_t num_args) {
+    assert(num_args <= EVENT_LOG_MAX_ARGS);
+
+    if (!state.initialized) {
+        return;
+    }
+
+    uint32_t ticket = 0;
+    uint8_t *record = record_ring_reserve(&state.ring, &ticket);
+    if (record == NULL) {
+        return;
+    }
+
+    size_t length = 0;
+    length += serialize_uint8(&record[length], (uint8_t)id);
+    length += serialize_uint8(&record[length], (uint8_t)num_args);
+    length += serialize_uint32_be(&record[length], (uint32_t)timestamp_get());
+    for (size_t i = 0; i < num_args; i++) {
+        length += event_log_pack_varint(&record[length], args[i]);
+    }
+
+    record_ring_commit(&state.ring, ticket, length);
+}
+
+
+int event_log_is_pending(void) {
+    size_t length = 0;
+    return state.initialized && record_ring_peek(&state.ring, &length) != NULL;
+}
+
+
+size_t event_log_flush(FILE *fp) {
+    size_t total = 0;
+
+    if (!state.initialized) {
+        return 0;
+    }
+
+    const uint8_t *record = NULL;
+    size_t         length = 0;
+    while ((record = record_ring_peek(&state.ring, &length)) != NULL) {
+        if (fp != NULL) {
+            fwrite(record, 1, length, fp);
+        }
+        total += length;
+        record_ring_release(&state.ring);
+    }
+
+    uint32_t lost = record_ring_take_dropped(&state.ring);
+    if (lost > 0 && fp != NULL) {
+        uint8_t record[EVENT_LOG_MAX_RECORD_SIZE] = {0};
+        size_t  length                            = 0;
+        length += serialize_uint8(&record[length], EVENT_LOG_LOST);
+        length += serialize_uint8(&record[length], 1);
+        length += serialize_uint32_be(&record[length], (uint32_t)timestamp_get());
+        length += event_log_pack_varint(&record[length], (int32_t)lost);
+        fwrite(record, 1, length, fp);
+        total += length;
+    }
+
+    return total;
+}
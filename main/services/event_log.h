@@ -0,0 +1,79 @@
+#ifndef EVENT_LOG_H_INCLUDED
+#define EVENT_LOG_H_INCLUDED
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "event_log_events.h"
+
+
+/*
+ * Binary event log. Each record is
+ *  - the event id (1 byte)
+ *  - the number of arguments (1 byte)
+ *  - the timestamp in milliseconds (4 bytes, big endian)
+ *  - the arguments, zigzag varint encoded
+ */
+
+
+#define EVENT_LOG_MAX_ARGS           6
+#define EVENT_LOG_RECORD_HEADER_SIZE 6
+#define EVENT_LOG_MAX_RECORD_SIZE    (EVENT_LOG_RECORD_HEADER_SIZE + EVENT_LOG_MAX_ARGS * 5)
+
+#define EVENT_LOG(id, ...)                                                                                             \
+    do {                                                                                                               \
+        const int32_t event_log_args[] = {0, ##__VA_ARGS__};                                                           \
+        event_log_record(EVENT_LOG_##id, &event_log_args[1],                                                           \
+                         sizeof(event_log_args) / sizeof(event_log_args[0]) - 1);                                      \
+    } while (0)
+
+
+#define EVENT_LOG_ENUM(id, format) EVENT_LOG_##id,
+
+typedef enum {
+    EVENT_LOG_EVENTS(EVENT_LOG_ENUM) EVENT_LOG_NUM_EVENTS,
+} event_log_id_t;
+
+#undef EVENT_LOG_ENUM
+
+
+void   event_log_init(void);
+void   event_log_record(event_log_id_t id, const int32_t *args, size_t num_args);
+int    event_log_is_pending(void);
+size_t event_log_flush(FILE *fp);
+
+
+static inline __attribute__((always_inline)) size_t event_log_pack_varint(uint8_t *buffer, int32_t value) {
+    uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    size_t   i      = 0;
+
+    while (zigzag >= 0x80) {
+        buffer[i++] = (uint8_t)(zigzag | 0x80);
+        zigzag >>= 7;
+    }
+    buffer[i++] = (uint8_t)zigzag;
+    return i;
+}
+
+
+static inline __attribute__((always_inline)) size_t event_log_unpack_varint(int32_t *value, const uint8_t *buffer,
+                                                                            size_t length) {
+    uint32_t zigzag = 0;
+    size_t   i      = 0;
+
+    for (uint8_t shift = 0; i < length && shift < 35; shift += 7) {
+        uint8_t byte = buffer[i++];
+        zigzag |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = (int32_t)((zigzag >> 1) ^ -(zigzag & 1));
+            return i;
+        }
+    }
+
+    // Truncated
+    return 0;
+}
+
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef EVENT_LOG_EVENTS_H_INCLUDED
+#define EVENT_LOG_EVENTS_H_INCLUDED
+
+
+/*
+ * Dictionary of the binary log events.
+ * The firmware only expands the identifiers; the format strings are used by the host side decoder and never end up
+ * in the application image. Append new events at the end so that old logs still decode.
+ * Every argument is printed as a signed 32 bit integer.
+ */
+#define EVENT_LOG_EVENTS(X)                                                                                            \
+    X(LOST, "%i events lost")                                                                                          \
+    X(MINION_TASK_STARTED, "Minion task started")                                                                      \
+    X(MINION_EXCEPTION, "Exception from slave %i: function %i, code %i")                                               \
+    X(MINION_WRITE_HOLDING_ERROR, "Write holding registers for %i failed (length %i): source %i, error %i")            \
+    X(MINION_READ_HOLDING_ERROR, "Read holding registers for %i failed (length %i): source %i, error %i")              \
+    X(MINION_READ_INPUT_ERROR, "Read input registers for %i failed (length %i): source %i, error %i")                  \
+    X(MINION_COMMUNICATION_FAILED, "Communication with slave %i failed after %i attempts")                             \
+    X(CONTROLLER_COMMUNICATION_ERROR, "Minion communication error")                                                    \
+    X(CONTROLLER_POSITION_SAMPLE, "MA420: %4i, target %4i")                                                            \
+    X(DISK_OP_CONFIG_SAVED, "Configuration saved with result %i")                                                      \
+    X(DISK_OP_CONFIG_LOADED, "Configuration loaded with result %i")                                                    \
+    X(DISK_OP_CONFIG_EXPORTED, "Configuration exported with result %i")                                                \
+    X(DISK_OP_FIRMWARE_UPDATE, "Temporary firmware update with result %i")                                             \
+    X(DISK_OP_DRIVE_REMOVED, "Drive removed")                                                                          \
+    X(DISK_OP_DRIVE_DETECTED, "Drive detected (attempt %i)")                                                           \
+    X(DISK_OP_DRIVE_MOUNTED, "Drive mounted")                                                                          \
+    X(DISK_OP_DRIVE_MOUNT_FAILED, "Could not mount the drive")                                                         \
+    X(VIEW_PAGE_RESOURCES, "Page %i: heap %i bytes, %i objects, %i timers, draw buffers %i bytes")                     \
+    X(CONTROLLER_POSITION_STROKE, "Stroke stopped %i past the target, stop lag up %i ms, down %i ms")                  \
+    X(CONTROLLER_CAROUSEL_FORM, "Carousel switched to form %i (%i cycles)")                                            \
+    X(DISK_OP_STATISTICS_SAVED, "Statistics saved with result %i")
+
+
+#endif
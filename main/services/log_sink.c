@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include "log_sink.h"
+#include "record_ring.h"
+
+
+#define LOG_SINK_SLOTS     128
+#define LOG_SINK_LINE_SIZE 160
+
+
+static struct {
+    record_ring_t ring;
+    int           initialized;
+} state = {0};
+
+
+void log_sink_init(void) {
+    static uint32_t memory[RECORD_RING_MEMORY_SIZE(LOG_SINK_SLOTS, LOG_SINK_LINE_SIZE) / sizeof(uint32_t)] = {0};
+    record_ring_init(&state.ring, memory, LOG_SINK_SLOTS, LOG_SINK_LINE_SIZE);
+    state.initialized = 1;
+}
+
+
+int log_sink_vprintf(const char *format, va_list args) {
+    if (!state.initialized) {
+        // Too early, fall back to synchronous output
+        return vprintf(format, args);
+    }
+
+    uint32_t ticket = 0;
+    char    *line   = record_ring_reserve(&state.ring, &ticket);
+    if (line == NULL) {
+        return 0;
+    }
+
+    int length = vsnprintf(line, LOG_SINK_LINE_SIZE, format, args);
+    if (length < 0) {
+        length = 0;
+    } else if (length >= LOG_SINK_LINE_SIZE) {
+        // Truncated; keep the line terminated
+        length           = LOG_SINK_LINE_SIZE;
+        line[length - 1] = '\n';
+    }
+
+    record_ring_commit(&state.ring, ticket, length);
+    return length;
+}
+
+
+int log_sink_printf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int res = log_sink_vprintf(format, args);
+    va_end(args);
+    return res;
+}
+
+
+int log_sink_is_pending(void) {
+    size_t length = 0;
+    return state.initialized && record_ring_peek(&state.ring, &length) != NULL;
+}
+
+
+size_t log_sink_flush(FILE *fp) {
+    size_t total = 0;
+
+    if (!state.initialized) {
+        return 0;
+    }
+
+    const char *line   = NULL;
+    size_t      length = 0;
+    while ((line = record_ring_peek(&state.ring, &length)) != NULL) {
+        fwrite(line, 1, length, stdout);
+        if (fp != NULL) {
+            fwrite(line, 1, length, fp);
+        }
+        total += length;
+        record_ring_release(&state.ring);
+    }
+
+    uint32_t dropped = record_ring_take_dropped(&state.ring);
+    if (dropped > 0) {
+        printf("log_sink: %u messages dropped\n", (unsigned)dropped);
+        if (fp != NULL) {
+            fprintf(fp, "log_sink: %u messages dropped\n", (unsigned)dropped);
+        }
+    }
+
+    fflush(stdout);
+    return total;
+}
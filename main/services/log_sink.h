@@ -0,0 +1,23 @@
+#ifndef LOG_SINK_H_INCLUDED
+#define LOG_SINK_H_INCLUDED
+
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/*
+ * Asynchronous log sink: callers only format their line into a RAM ring, the actual I/O is done in batches by
+ * whoever calls `log_sink_flush` (the disk_op task).
+ */
+
+
+void   log_sink_init(void);
+int    log_sink_vprintf(const char *format, va_list args);
+int    log_sink_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+int    log_sink_is_pending(void);
+size_t log_sink_flush(FILE *fp);
+
+
+#endif
@@ -0,0 +1,101 @@
+#include <assert.h>
+#include <string.h>
+#include "record_ring.h"
+
+
+/*
+ * Every slot carries a sequence number: a producer may write slot `i` when its sequence equals the enqueue position,
+ * the consumer may read it when the sequence equals the position plus one.
+ */
+typedef struct {
+    atomic_uint_least32_t sequence;
+    uint32_t              length;
+} slot_header_t;
+
+
+static inline slot_header_t *get_slot(record_ring_t *ring, uint32_t position);
+
+
+void record_ring_init(record_ring_t *ring, void *memory, size_t num_slots, size_t record_size) {
+    assert(ring != NULL);
+    assert(memory != NULL);
+    assert(num_slots > 0 && (num_slots & (num_slots - 1)) == 0);
+    assert(sizeof(slot_header_t) <= RECORD_RING_SLOT_HEADER_SIZE);
+
+    ring->memory           = memory;
+    ring->mask             = num_slots - 1;
+    ring->record_size      = record_size;
+    ring->slot_size        = RECORD_RING_SLOT_SIZE(record_size);
+    ring->dequeue_position = 0;
+    atomic_init(&ring->enqueue_position, 0);
+    atomic_init(&ring->dropped, 0);
+
+    for (uint32_t i = 0; i < num_slots; i++) {
+        slot_header_t *slot = get_slot(ring, i);
+        atomic_init(&slot->sequence, i);
+        slot->length = 0;
+    }
+}
+
+
+void *record_ring_reserve(record_ring_t *ring, uint32_t *ticket) {
+    uint32_t position = atomic_load_explicit(&ring->enqueue_position, memory_order_relaxed);
+
+    for (;;) {
+        slot_header_t *slot       = get_slot(ring, position);
+        uint32_t       sequence   = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int32_t        difference = (int32_t)(sequence - position);
+
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->enqueue_position, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                *ticket = position;
+                return (uint8_t *)slot + RECORD_RING_SLOT_HEADER_SIZE;
+            }
+            // `position` was updated by the failed exchange, try again
+        } else if (difference < 0) {
+            // The consumer is a full lap behind
+            atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+            return NULL;
+        } else {
+            position = atomic_load_explicit(&ring->enqueue_position, memory_order_relaxed);
+        }
+    }
+}
+
+
+void record_ring_commit(record_ring_t *ring, uint32_t ticket, size_t length) {
+    slot_header_t *slot = get_slot(ring, ticket);
+    slot->length        = length > ring->record_size ? ring->record_size : length;
+    atomic_store_explicit(&slot->sequence, ticket + 1, memory_order_release);
+}
+
+
+const void *record_ring_peek(record_ring_t *ring, size_t *length) {
+    slot_header_t *slot     = get_slot(ring, ring->dequeue_position);
+    uint32_t       sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+    if ((int32_t)(sequence - (ring->dequeue_position + 1)) < 0) {
+        return NULL;
+    } else {
+        *length = slot->length;
+        return (uint8_t *)slot + RECORD_RING_SLOT_HEADER_SIZE;
+    }
+}
+
+
+void record_ring_release(record_ring_t *ring) {
+    slot_header_t *slot = get_slot(ring, ring->dequeue_position);
+    atomic_store_explicit(&slot->sequence, ring->dequeue_position + ring->mask + 1, memory_order_release);
+    ring->dequeue_position++;
+}
+
+
+uint32_t record_ring_take_dropped(record_ring_t *ring) {
+    return atomic_exchange_explicit(&ring->dropped, 0, memory_order_relaxed);
+}
+
+
+static inline slot_header_t *get_slot(record_ring_t *ring, uint32_t position) {
+    return (slot_header_t *)&ring->memory[(position & ring->mask) * ring->slot_size];
+}
@@ -0,0 +1,87 @@
+#ifndef RECORD_RING_H_INCLUDED
+#define RECORD_RING_H_INCLUDED
+
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/*
+ * Bounded multiple producer, single consumer queue of fixed size records.
+ * Producers never block nor lock: when the ring is full the record is dropped and counted.
+ * Memory is provided by the caller, see RECORD_RING_MEMORY_SIZE.
+ */
+
+
+#define RECORD_RING_SLOT_HEADER_SIZE 8
+#define RECORD_RING_SLOT_SIZE(record_size)                                                                             \
+    (RECORD_RING_SLOT_HEADER_SIZE + (((record_size) + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1)))
+#define RECORD_RING_MEMORY_SIZE(num_slots, record_size) ((num_slots) * RECORD_RING_SLOT_SIZE(record_size))
+
+
+typedef struct {
+    uint8_t              *memory;
+    uint32_t              mask;
+    size_t                record_size;
+    size_t                slot_size;
+    atomic_uint_least32_t enqueue_position;
+    uint32_t              dequeue_position;
+    atomic_uint_least32_t dropped;
+} record_ring_t;
+
+
+/**
+ * @brief Initializes the ring over a caller provided memory area
+ *
+ * @param ring
+ * @param memory at least RECORD_RING_MEMORY_SIZE(num_slots, record_size) bytes, aligned to 4
+ * @param num_slots must be a power of two
+ * @param record_size maximum size of a single record
+ */
+void record_ring_init(record_ring_t *ring, void *memory, size_t num_slots, size_t record_size);
+
+/**
+ * @brief Reserves a slot for writing. Safe to call from any task.
+ *
+ * @param ring
+ * @param ticket filled with the handle to pass to `record_ring_commit`
+ * @return void* pointer to `record_size` bytes, or NULL if the ring is full
+ */
+void *record_ring_reserve(record_ring_t *ring, uint32_t *ticket);
+
+/**
+ * @brief Publishes a slot previously obtained with `record_ring_reserve`
+ *
+ * @param ring
+ * @param ticket
+ * @param length number of valid bytes in the slot
+ */
+void record_ring_commit(record_ring_t *ring, uint32_t ticket, size_t length);
+
+/**
+ * @brief Returns the oldest published record without removing it. Must be called by the consumer only.
+ *
+ * @param ring
+ * @param length filled with the record length
+ * @return const void* the record, or NULL if the ring is empty
+ */
+const void *record_ring_peek(record_ring_t *ring, size_t *length);
+
+/**
+ * @brief Removes the record returned by the last `record_ring_peek`
+ *
+ * @param ring
+ */
+void record_ring_release(record_ring_t *ring);
+
+/**
+ * @brief Returns the number of records dropped since the last call and resets the count
+ *
+ * @param ring
+ * @return uint32_t
+ */
+uint32_t record_ring_take_dropped(record_ring_t *ring);
+
+
+#endif
@@ -0,0 +1,64 @@
+#include <assert.h>
+#include "snapshot.h"
+
+
+/*
+ * The sequence is odd while the writer fills a buffer and even otherwise; `sequence / 2` counts the publications and
+ * its lowest bit selects the published buffer. The writer starts overwriting the buffer a reader got with an even
+ * sequence `s` only when it moves the sequence past `s + 2`.
+ */
+
+
+static inline uint8_t *get_buffer(snapshot_t *snapshot, uint32_t publication);
+
+
+void snapshot_init(snapshot_t *snapshot, void *memory, size_t size) {
+    assert(snapshot != NULL);
+    assert(memory != NULL);
+    assert(size > 0);
+
+    snapshot->memory = memory;
+    snapshot->size   = size;
+    atomic_init(&snapshot->sequence, 0);
+}
+
+
+void *snapshot_write_begin(snapshot_t *snapshot) {
+    uint32_t sequence = atomic_load_explicit(&snapshot->sequence, memory_order_relaxed);
+    assert((sequence & 1) == 0);
+
+    atomic_store_explicit(&snapshot->sequence, sequence + 1, memory_order_relaxed);
+    // Readers that see the writes to the buffer must also see the odd sequence
+    atomic_thread_fence(memory_order_release);
+
+    return get_buffer(snapshot, (sequence >> 1) + 1);
+}
+
+
+void snapshot_write_end(snapshot_t *snapshot) {
+    uint32_t sequence = atomic_load_explicit(&snapshot->sequence, memory_order_relaxed);
+    assert((sequence & 1) == 1);
+
+    atomic_store_explicit(&snapshot->sequence, sequence + 1, memory_order_release);
+}
+
+
+const void *snapshot_read_begin(snapshot_t *snapshot, uint32_t *ticket) {
+    // While the writer is busy the previous publication is still the current one
+    uint32_t sequence = atomic_load_explicit(&snapshot->sequence, memory_order_acquire) & ~1UL;
+    *ticket           = sequence;
+    return get_buffer(snapshot, sequence >> 1);
+}
+
+
+uint8_t snapshot_read_end(snapshot_t *snapshot, uint32_t ticket) {
+    // The reads of the buffer must complete before the sequence is checked
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t sequence = atomic_load_explicit(&snapshot->sequence, memory_order_relaxed);
+    return (uint32_t)(sequence - ticket) <= 2;
+}
+
+
+static inline uint8_t *get_buffer(snapshot_t *snapshot, uint32_t publication) {
+    return &snapshot->memory[(publication & 1) * snapshot->size];
+}
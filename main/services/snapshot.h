@@ -0,0 +1,74 @@
+#ifndef SNAPSHOT_H_INCLUDED
+#define SNAPSHOT_H_INCLUDED
+
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/*
+ * Double buffered copy of a state shared by a single writer with any number of readers.
+ * The writer fills the buffer readers are not using and publishes it with a sequence number; readers work on the
+ * published buffer in place, without locks nor copies, and check afterwards that the writer did not start reusing it
+ * in the meantime. Neither side ever waits for the other: a reader overtaken by two publications reads again.
+ * Memory is provided by the caller, see SNAPSHOT_MEMORY_SIZE.
+ */
+
+
+#define SNAPSHOT_MEMORY_SIZE(size) (2 * (size))
+
+
+typedef struct {
+    uint8_t              *memory;
+    size_t                size;
+    atomic_uint_least32_t sequence;
+} snapshot_t;
+
+
+/**
+ * @brief Initializes the snapshot over a caller provided memory area. Until the first publication readers see the
+ * first buffer as it was provided.
+ *
+ * @param snapshot
+ * @param memory at least SNAPSHOT_MEMORY_SIZE(size) bytes, aligned for the state stored
+ * @param size size of the state
+ */
+void snapshot_init(snapshot_t *snapshot, void *memory, size_t size);
+
+/**
+ * @brief Returns the buffer to fill with the next state. Must be called by the writer only; the buffer holds the
+ * state published two times before and must be overwritten entirely.
+ *
+ * @param snapshot
+ * @return void* pointer to `size` bytes
+ */
+void *snapshot_write_begin(snapshot_t *snapshot);
+
+/**
+ * @brief Publishes the buffer returned by the last `snapshot_write_begin`
+ *
+ * @param snapshot
+ */
+void snapshot_write_end(snapshot_t *snapshot);
+
+/**
+ * @brief Returns the last published state. Safe to call from any task.
+ *
+ * @param snapshot
+ * @param ticket filled with the handle to pass to `snapshot_read_end`
+ * @return const void* pointer to `size` bytes, valid until `snapshot_read_end`
+ */
+const void *snapshot_read_begin(snapshot_t *snapshot, uint32_t *ticket);
+
+/**
+ * @brief Checks that the state returned by `snapshot_read_begin` was not overwritten while it was being read
+ *
+ * @param snapshot
+ * @param ticket
+ * @return uint8_t 1 if what was read is consistent, 0 if it must be read again
+ */
+uint8_t snapshot_read_end(snapshot_t *snapshot, uint32_t ticket);
+
+
+#endif
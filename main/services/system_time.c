@@ -7,9 +7,12 @@
 #include <string.h>
 #include <sys/ioctl.h>
 #include <esp_log.h>
+#include "system_time.h"
 
 
 #define RTC_ATTEMPTS 5
+// 2024-01-01; an earlier clock was never set and still counts from the epoch
+#define SYSTEM_TIME_MIN_VALID 1704067200LL
 
 
 static const char *TAG = __FILE_NAME__;
@@ -52,6 +55,11 @@ int init_system_time_from_rtc(void) {
 }
 
 
+uint8_t system_time_is_set(void) {
+    return (long long)time(NULL) >= SYSTEM_TIME_MIN_VALID;
+}
+
+
 time_t mktime_autodst(struct tm *tm) {
     // struct tm autodst = *tm;
     // mktime(&autodst);
@@ -1,4 +1,14 @@
 #ifndef SYSTEM_TIME_H_INCLUDED
 #define SYSTEM_TIME_H_INCLUDED
 
+
+#include <stdint.h>
+#include <time.h>
+
+
+int     init_system_time_from_rtc(void);
+int     update_system_rtc_time(time_t seconds);
+uint8_t system_time_is_set(void);
+time_t  mktime_autodst(struct tm *tm);
+
 #endif
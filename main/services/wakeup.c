@@ -0,0 +1,28 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "wakeup.h"
+
+
+static SemaphoreHandle_t sem;
+
+
+void wakeup_init(void) {
+    static StaticSemaphore_t static_semaphore;
+    sem = xSemaphoreCreateBinaryStatic(&static_semaphore);
+}
+
+
+void wakeup_post(void) {
+    // Already posted if full, which is just as good
+    xSemaphoreGive(sem);
+}
+
+
+/**
+ * Blocks until something is posted or `timeout_ms` elapses
+ *
+ * @return uint8_t 1 if woken by a post
+ */
+uint8_t wakeup_wait(unsigned long timeout_ms) {
+    return xSemaphoreTake(sem, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+}
@@ -0,0 +1,20 @@
+#ifndef WAKEUP_H_INCLUDED
+#define WAKEUP_H_INCLUDED
+
+
+#include <stdint.h>
+
+
+/*
+ * Single notification the controller loop sleeps on. The tasks working for the controller post it after queueing a
+ * response, and the view after handling an input that may have changed the model, so the loop runs as soon as there is
+ * something to handle instead of polling; posts made while the loop is awake are merged into one.
+ */
+
+
+void    wakeup_init(void);
+void    wakeup_post(void);
+uint8_t wakeup_wait(unsigned long timeout_ms);
+
+
+#endif
@@ -0,0 +1,455 @@
+/*
+ * Headless rendering benchmark: renders the view into an in-memory display, scripts navigation and touches through
+ * the page manager and reports open time, frame render/flush time, redrawn area and LVGL heap usage for every step.
+ * Time advances by one refresh period per iteration, so every iteration with invalidated areas renders one frame.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "lvgl.h"
+#include "model/model.h"
+#include "adapters/view/view.h"
+#include "services/log_sink.h"
+#include "services/event_log.h"
+
+
+#define DISPLAY_HOR_RES   1280
+#define DISPLAY_VER_RES   800
+#define DISPLAY_BUF_LINES 80
+#define FRAME_PERIOD_MS   LV_DEF_REFR_PERIOD
+#define TAP_DURATION_MS   100
+#define MAX_SECTIONS      32
+
+
+typedef enum {
+    // Push a page on the stack; starts a new report section
+    STEP_TAG_PUSH = 0,
+    // Go back to the previous page; starts a new report section
+    STEP_TAG_BACK,
+    STEP_TAG_TAP,
+    STEP_TAG_DRAG,
+    STEP_TAG_IDLE,
+    STEP_TAG_END,
+} step_tag_t;
+
+typedef struct {
+    step_tag_t         tag;
+    const char        *name;
+    const pman_page_t *page;
+    void              *extra;
+    lv_point_t         from;
+    lv_point_t         to;
+    uint32_t           duration_ms;
+} step_t;
+
+typedef struct {
+    const char *name;
+    uint32_t    open_us;
+    uint32_t    frames;
+    uint64_t    render_us_total;
+    uint32_t    render_us_max;
+    uint64_t    flush_us_total;
+    uint32_t    flush_us_max;
+    uint64_t    area_total;
+    uint32_t    area_max;
+    size_t      heap_used;
+    size_t      heap_max_used;
+} section_t;
+
+
+static void     init_display(void);
+static void     init_program(mut_model_t *model);
+static void     run_step(mut_model_t *model, const step_t *step);
+static void     run_frames(mut_model_t *model, uint32_t duration_ms);
+static void     start_section(const char *name);
+static void     print_report(void);
+static uint32_t tick_cb(void);
+static void     flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map);
+static void     refr_event_cb(lv_event_t *event);
+static void     pointer_read_cb(lv_indev_t *indev, lv_indev_data_t *data);
+static uint64_t get_us(void);
+static void     set_test_mode(pman_handle_t handle, uint8_t test_on);
+static void     test_output(pman_handle_t handle, uint16_t output_index);
+static void     test_output_clear(pman_handle_t handle);
+static void     test_pwm(pman_handle_t handle, uint8_t percentage);
+static void     save_configuration(pman_handle_t handle);
+static void     retry_communication(pman_handle_t handle);
+static void     export_configuration(pman_handle_t handle, const char *name);
+static void     ota_update(pman_handle_t handle);
+static void     finalize_ota_update(pman_handle_t handle);
+static void     wifi_scan(pman_handle_t handle);
+static void     connect_to_wifi(pman_handle_t handle, char *ssid, char *psk);
+
+
+// The benchmark only measures the view, the controller is never involved
+static const view_protocol_t benchmark_view_protocol = {
+    .set_test_mode        = set_test_mode,
+    .test_output          = test_output,
+    .test_output_clear    = test_output_clear,
+    .test_pwm             = test_pwm,
+    .save_configuration   = save_configuration,
+    .export_configuration = export_configuration,
+    .retry_communication  = retry_communication,
+    .ota_update           = ota_update,
+    .finalize_ota_update  = finalize_ota_update,
+    .wifi_scan            = wifi_scan,
+    .connect_to_wifi      = connect_to_wifi,
+};
+
+static uint8_t                 program_modified = 0;
+static view_page_program_arg_t program_arg      = {.modified = &program_modified, .program_index = 0};
+
+static const step_t script[] = {
+    {.tag = STEP_TAG_PUSH, .name = "page_home", .page = &page_home},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+
+    {.tag = STEP_TAG_PUSH, .name = "page_program", .page = &page_program, .extra = &program_arg},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+    // Flip a few units of the schedule
+    {.tag = STEP_TAG_TAP, .from = {179, 87}},
+    {.tag = STEP_TAG_TAP, .from = {226, 87}},
+    {.tag = STEP_TAG_TAP, .from = {273, 139}},
+    // Scroll the channels down and back up
+    {.tag = STEP_TAG_DRAG, .from = {700, 700}, .to = {700, 200}, .duration_ms = 500},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 1000},
+    {.tag = STEP_TAG_DRAG, .from = {700, 200}, .to = {700, 700}, .duration_ms = 500},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 1000},
+    // Scroll the time units sideways
+    {.tag = STEP_TAG_DRAG, .from = {1100, 400}, .to = {400, 400}, .duration_ms = 500},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 1000},
+    {.tag = STEP_TAG_BACK, .name = "back to page_home"},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+
+    {.tag = STEP_TAG_PUSH, .name = "page_execution", .page = &page_execution},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 2000},
+    {.tag = STEP_TAG_DRAG, .from = {1100, 400}, .to = {400, 400}, .duration_ms = 500},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 1000},
+    {.tag = STEP_TAG_BACK, .name = "back to page_home"},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+
+    {.tag = STEP_TAG_PUSH, .name = "page_config", .page = &page_config},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+    {.tag = STEP_TAG_DRAG, .from = {640, 700}, .to = {640, 200}, .duration_ms = 500},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 1000},
+    {.tag = STEP_TAG_BACK, .name = "back to page_home"},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+
+    {.tag = STEP_TAG_PUSH, .name = "page_settings", .page = &page_settings},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+    {.tag = STEP_TAG_DRAG, .from = {640, 700}, .to = {640, 200}, .duration_ms = 500},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 1000},
+    {.tag = STEP_TAG_BACK, .name = "back to page_home"},
+    {.tag = STEP_TAG_IDLE, .duration_ms = 500},
+
+    {.tag = STEP_TAG_END},
+};
+
+
+static struct {
+    uint32_t tick_ms;
+
+    struct {
+        lv_point_t point;
+        uint8_t    pressed;
+    } pointer;
+
+    struct {
+        uint64_t start_us;
+        uint32_t flush_us;
+        uint32_t area;
+    } frame;
+
+    section_t sections[MAX_SECTIONS];
+    size_t    num_sections;
+} state = {0};
+
+
+void app_main(void *arg) {
+    (void)arg;
+
+    mut_model_t model = {0};
+
+    log_sink_init();
+    event_log_init();
+
+    lv_init();
+    init_display();
+
+    model_init(&model);
+    init_program(&model);
+    view_init(&model, benchmark_view_protocol);
+
+    for (size_t i = 0; script[i].tag != STEP_TAG_END; i++) {
+        run_step(&model, &script[i]);
+    }
+
+    print_report();
+    exit(EXIT_SUCCESS);
+}
+
+
+static void init_display(void) {
+    static uint8_t buffer[DISPLAY_HOR_RES * DISPLAY_BUF_LINES * LV_COLOR_DEPTH / 8];
+
+    lv_tick_set_cb(tick_cb);
+
+    lv_display_t *display = lv_display_create(DISPLAY_HOR_RES, DISPLAY_VER_RES);
+    lv_display_set_buffers(display, buffer, NULL, sizeof(buffer), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(display, flush_cb);
+    lv_display_add_event_cb(display, refr_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(display, refr_event_cb, LV_EVENT_REFR_READY, NULL);
+
+    lv_indev_t *indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, pointer_read_cb);
+}
+
+
+// Fills the first program with a busy schedule so that the heavy pages have something to draw
+static void init_program(mut_model_t *model) {
+    program_t *program = &model->config.programs[0];
+
+    for (uint16_t instant = 0; instant < program_get_num_time_units(program); instant++) {
+        for (uint16_t channel = 0; channel < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; channel++) {
+            if (channel != PROGRAM_PRESSURE_CHANNEL_INDEX && channel != PROGRAM_SENSOR_CHANNEL_INDEX &&
+                ((channel + instant) % 3) == 0) {
+                program_flip_digital_channel_state_at(program, channel, instant);
+            }
+        }
+        for (uint16_t i = 0; i < instant % PROGRAM_PRESSURE_CHANNEL_STATE_NUM; i++) {
+            program_increase_pressure_channel_state_at(program, instant);
+        }
+        for (uint16_t i = 0; i < (instant / 2) % PROGRAM_SENSOR_CHANNEL_THRESHOLD_NUM; i++) {
+            program_increase_sensor_channel_threshold_at(program, instant);
+        }
+    }
+
+    model_set_current_program(model, 0, 0);
+    model_update_current_timeline(model);
+}
+
+
+static void run_step(mut_model_t *model, const step_t *step) {
+    switch (step->tag) {
+        case STEP_TAG_PUSH:
+        case STEP_TAG_BACK: {
+            start_section(step->name);
+
+            uint64_t start = get_us();
+            if (step->tag == STEP_TAG_PUSH) {
+                view_change_page_extra(step->page, step->extra);
+            } else {
+                view_back();
+            }
+            state.sections[state.num_sections - 1].open_us = (uint32_t)(get_us() - start);
+
+            // The first frame of the page is accounted like any other
+            run_frames(model, FRAME_PERIOD_MS);
+            break;
+        }
+
+        case STEP_TAG_TAP:
+            state.pointer.point   = step->from;
+            state.pointer.pressed = 1;
+            run_frames(model, TAP_DURATION_MS);
+            state.pointer.pressed = 0;
+            run_frames(model, FRAME_PERIOD_MS);
+            break;
+
+        case STEP_TAG_DRAG: {
+            state.pointer.point   = step->from;
+            state.pointer.pressed = 1;
+            run_frames(model, FRAME_PERIOD_MS);
+
+            uint32_t num_frames = step->duration_ms / FRAME_PERIOD_MS;
+            for (uint32_t i = 1; i <= num_frames; i++) {
+                state.pointer.point.x = step->from.x + ((step->to.x - step->from.x) * (int32_t)i) / (int32_t)num_frames;
+                state.pointer.point.y = step->from.y + ((step->to.y - step->from.y) * (int32_t)i) / (int32_t)num_frames;
+                run_frames(model, FRAME_PERIOD_MS);
+            }
+
+            state.pointer.pressed = 0;
+            run_frames(model, FRAME_PERIOD_MS);
+            break;
+        }
+
+        case STEP_TAG_IDLE:
+            run_frames(model, step->duration_ms);
+            break;
+
+        case STEP_TAG_END:
+            break;
+    }
+}
+
+
+static void run_frames(mut_model_t *model, uint32_t duration_ms) {
+    for (uint32_t elapsed = 0; elapsed < duration_ms; elapsed += FRAME_PERIOD_MS) {
+        state.tick_ms += FRAME_PERIOD_MS;
+        view_manage(model);
+        lv_timer_handler();
+    }
+
+    section_t        *section = &state.sections[state.num_sections - 1];
+    lv_mem_monitor_t  monitor = {0};
+    lv_mem_monitor(&monitor);
+    section->heap_used     = monitor.total_size - monitor.free_size;
+    section->heap_max_used = monitor.max_used;
+}
+
+
+static void start_section(const char *name) {
+    if (state.num_sections < MAX_SECTIONS) {
+        state.num_sections++;
+    }
+
+    section_t *section = &state.sections[state.num_sections - 1];
+    memset(section, 0, sizeof(*section));
+    section->name = name;
+}
+
+
+static void print_report(void) {
+    printf("\n%-20s %9s %6s %11s %11s %11s %11s %10s %10s %10s %10s\n", "step", "open ms", "frames", "render avg",
+           "render max", "flush avg", "flush max", "area avg", "area max", "heap KB", "peak KB");
+
+    for (size_t i = 0; i < state.num_sections; i++) {
+        const section_t *section = &state.sections[i];
+        uint32_t         frames  = section->frames > 0 ? section->frames : 1;
+
+        printf("%-20s %9.2f %6lu %11.2f %11.2f %11.2f %11.2f %10llu %10lu %10zu %10zu\n", section->name,
+               section->open_us / 1000.0, (unsigned long)section->frames,
+               section->render_us_total / 1000.0 / frames, section->render_us_max / 1000.0,
+               section->flush_us_total / 1000.0 / frames, section->flush_us_max / 1000.0,
+               (unsigned long long)(section->area_total / frames), (unsigned long)section->area_max,
+               section->heap_used / 1024, section->heap_max_used / 1024);
+    }
+}
+
+
+static uint32_t tick_cb(void) {
+    return state.tick_ms;
+}
+
+
+static void flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map) {
+    static uint8_t framebuffer[DISPLAY_HOR_RES * DISPLAY_VER_RES * LV_COLOR_DEPTH / 8];
+
+    uint64_t start = get_us();
+
+    // Copy the area in the framebuffer, as a real panel driver would
+    uint32_t px_size = LV_COLOR_DEPTH / 8;
+    uint32_t width   = lv_area_get_width(area);
+    uint32_t stride  = lv_draw_buf_width_to_stride(width, lv_display_get_color_format(display));
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&framebuffer[(y * DISPLAY_HOR_RES + area->x1) * px_size], &px_map[(y - area->y1) * stride],
+               width * px_size);
+    }
+
+    state.frame.flush_us += (uint32_t)(get_us() - start);
+    // In partial mode only the (joined) invalidated areas are rendered and flushed
+    state.frame.area += lv_area_get_size(area);
+
+    lv_display_flush_ready(display);
+}
+
+
+static void refr_event_cb(lv_event_t *event) {
+    if (lv_event_get_code(event) == LV_EVENT_REFR_START) {
+        state.frame.start_us = get_us();
+        state.frame.flush_us = 0;
+        state.frame.area     = 0;
+    } else if (state.frame.area > 0 && state.num_sections > 0) {
+        // Only account refreshes that actually drew something
+        section_t *section   = &state.sections[state.num_sections - 1];
+        uint32_t   total_us  = (uint32_t)(get_us() - state.frame.start_us);
+        uint32_t   render_us = total_us - state.frame.flush_us;
+
+        section->frames++;
+        section->render_us_total += render_us;
+        section->render_us_max = LV_MAX(section->render_us_max, render_us);
+        section->flush_us_total += state.frame.flush_us;
+        section->flush_us_max = LV_MAX(section->flush_us_max, state.frame.flush_us);
+        section->area_total += state.frame.area;
+        section->area_max = LV_MAX(section->area_max, state.frame.area);
+    }
+}
+
+
+static void pointer_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
+    (void)indev;
+    data->point = state.pointer.point;
+    data->state = state.pointer.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+
+static uint64_t get_us(void) {
+    struct timespec ts = {0};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec) * 1000000UL + ts.tv_nsec / 1000;
+}
+
+
+static void set_test_mode(pman_handle_t handle, uint8_t test_on) {
+    (void)handle;
+    (void)test_on;
+}
+
+
+static void test_output(pman_handle_t handle, uint16_t output_index) {
+    (void)handle;
+    (void)output_index;
+}
+
+
+static void test_output_clear(pman_handle_t handle) {
+    (void)handle;
+}
+
+
+static void test_pwm(pman_handle_t handle, uint8_t percentage) {
+    (void)handle;
+    (void)percentage;
+}
+
+
+static void save_configuration(pman_handle_t handle) {
+    (void)handle;
+}
+
+
+static void retry_communication(pman_handle_t handle) {
+    (void)handle;
+}
+
+
+static void export_configuration(pman_handle_t handle, const char *name) {
+    (void)handle;
+    (void)name;
+}
+
+
+static void ota_update(pman_handle_t handle) {
+    (void)handle;
+}
+
+
+static void finalize_ota_update(pman_handle_t handle) {
+    (void)handle;
+}
+
+
+static void wifi_scan(pman_handle_t handle) {
+    (void)handle;
+}
+
+
+static void connect_to_wifi(pman_handle_t handle, char *ssid, char *psk) {
+    (void)handle;
+    (void)ssid;
+    (void)psk;
+}
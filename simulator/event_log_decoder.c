@@ -0,0 +1,101 @@
+/*
+ * Host side decoder for the binary event log produced by services/event_log.c
+ * Usage: event_log_decoder <file> [<file> ...]
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "services/event_log.h"
+#include "services/serializer.h"
+
+
+#define EVENT_LOG_FORMAT(id, format) [EVENT_LOG_##id] = {#id, format},
+
+static const struct {
+    const char *name;
+    const char *format;
+} dictionary[EVENT_LOG_NUM_EVENTS] = {EVENT_LOG_EVENTS(EVENT_LOG_FORMAT)};
+
+#undef EVENT_LOG_FORMAT
+
+
+static int decode_file(const char *path);
+
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <file> [<file> ...]\n", argv[0]);
+        return 1;
+    }
+
+    int res = 0;
+    for (int i = 1; i < argc; i++) {
+        res |= decode_file(argv[i]);
+    }
+
+    return res;
+}
+
+
+static int decode_file(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open %s\n", path);
+        return 1;
+    }
+
+    uint8_t buffer[EVENT_LOG_MAX_RECORD_SIZE * 64] = {0};
+    size_t  available                              = 0;
+    size_t  offset                                 = 0;
+    int     res                                    = 0;
+
+    for (;;) {
+        // Keep at least a full record in the buffer
+        if (available - offset < EVENT_LOG_MAX_RECORD_SIZE) {
+            memmove(buffer, &buffer[offset], available - offset);
+            available -= offset;
+            offset = 0;
+            available += fread(&buffer[available], 1, sizeof(buffer) - available, fp);
+        }
+
+        if (available - offset < EVENT_LOG_RECORD_HEADER_SIZE) {
+            if (available != offset) {
+                fprintf(stderr, "%s: truncated record at the end of the file\n", path);
+                res = 1;
+            }
+            break;
+        }
+
+        uint8_t  id        = 0;
+        uint8_t  num_args  = 0;
+        uint32_t timestamp = 0;
+        offset += deserialize_uint8(&id, &buffer[offset]);
+        offset += deserialize_uint8(&num_args, &buffer[offset]);
+        offset += deserialize_uint32_be(&timestamp, &buffer[offset]);
+
+        if (id >= EVENT_LOG_NUM_EVENTS || num_args > EVENT_LOG_MAX_ARGS) {
+            fprintf(stderr, "%s: corrupted record (id %i, %i arguments)\n", path, id, num_args);
+            res = 1;
+            break;
+        }
+
+        int32_t args[EVENT_LOG_MAX_ARGS] = {0};
+        for (uint8_t i = 0; i < num_args; i++) {
+            size_t read = event_log_unpack_varint(&args[i], &buffer[offset], available - offset);
+            if (read == 0) {
+                fprintf(stderr, "%s: truncated record\n", path);
+                fclose(fp);
+                return 1;
+            }
+            offset += read;
+        }
+
+        printf("[%10lu] %-32s ", (unsigned long)timestamp, dictionary[id].name);
+        printf(dictionary[id].format, args[0], args[1], args[2], args[3], args[4], args[5]);
+        printf("\n");
+    }
+
+    fclose(fp);
+    return res;
+}
@@ -2,11 +2,12 @@
 #define ESP_LOG_H_INCLUDED
 
 #include <stdio.h>
+#include "services/log_sink.h"
 
-#define ESP_LOG_BUFFER_HEX(tag, buffer, len) printf("%s: buffer of size %i\n", tag, len)
+#define ESP_LOG_BUFFER_HEX(tag, buffer, len) log_sink_printf("%s: buffer of size %i\n", tag, len)
 #define ESP_LOGD(tag, format, ...)           
-#define ESP_LOGI(tag, format, ...)           printf("%s: " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGW(tag, format, ...)           printf("%s: " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGE(tag, format, ...)           printf("%s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)           log_sink_printf("%s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)           log_sink_printf("%s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGE(tag, format, ...)           log_sink_printf("%s: " format "\n", tag, ##__VA_ARGS__)
 
 #endif
@@ -7,6 +7,21 @@
 #include "controller/controller.h"
 #include "controller/gui.h"
 #include "bsp/rs232.h"
+#include "services/log_sink.h"
+#include "services/event_log.h"
+#include "services/wakeup.h"
+
+#ifdef BUILD_CONFIG_LVGL_THREADED
+#include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
+
+
+#define RENDER_PERIOD_MS 5
+
+
+static void *render_thread(void *arg);
+#endif
 
 
 static const char *TAG = "Main";
@@ -17,23 +32,69 @@ void app_main(void *arg) {
 
     mut_model_t model = {0};
 
+    log_sink_init();
+    event_log_init();
     bsp_rs232_init();
 
+#ifdef BUILD_CONFIG_LVGL_THREADED
+    // LVGL and SDL belong to the render thread; from here on the model and the view are only touched under lv_lock
+    sem_t     lvgl_ready;
+    pthread_t render_thread_id;
+    sem_init(&lvgl_ready, 0, 0);
+    pthread_create(&render_thread_id, NULL, render_thread, &lvgl_ready);
+    sem_wait(&lvgl_ready);
+    sem_destroy(&lvgl_ready);
+
+    lv_lock();
+#else
     lv_init();
     lv_sdl_window_create(1280, 800);
     lv_sdl_mouse_create();
+#endif
 
     model_init(&model);
     view_init(&model, gui_view_protocol);
     controller_init(&model);
     ESP_LOGI(TAG, "controller");
 
+#ifdef BUILD_CONFIG_LVGL_THREADED
+    lv_unlock();
+#endif
+
     ESP_LOGI(TAG, "Begin main loop");
     for (;;) {
-        controller_manage(&model);
+#ifdef BUILD_CONFIG_LVGL_THREADED
+        lv_lock();
+        unsigned long next_ms = controller_manage(&model);
+        lv_unlock();
+#else
+        unsigned long next_ms = controller_manage(&model);
+#endif
 
-        vTaskDelay(pdMS_TO_TICKS(5));
+        // Until a task posts a response or the next periodic job is due
+        wakeup_wait(next_ms);
     }
 
     vTaskDelete(NULL);
 }
+
+
+#ifdef BUILD_CONFIG_LVGL_THREADED
+static void *render_thread(void *arg) {
+    sem_t *lvgl_ready = arg;
+
+    lv_init();
+    lv_sdl_window_create(1280, 800);
+    lv_sdl_mouse_create();
+    sem_post(lvgl_ready);
+
+    ESP_LOGI(TAG, "Begin render loop");
+    for (;;) {
+        // lv_timer_handler takes the LVGL lock by itself
+        uint32_t next_ms = lv_timer_handler();
+        usleep(LV_MIN(next_ms, RENDER_PERIOD_MS) * 1000);
+    }
+
+    return NULL;
+}
+#endif
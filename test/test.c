@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include "model/model.h"
+#include "controller/storage/storage.h"
+#include "services/log_sink.h"
+
+
+/*
+ * Saved by the firmware before programs had a length (storage version 0), filled with the pattern checked below:
+ *  - channel `c` is named "Canale <c + 1>"
+ *  - program `i` is named "Programma <i + 1>", its time unit is 5 + i decisecs and its levels are 100 * (j + 1) + i
+ *    (pressure) and 10 * (j + 1) + i (position)
+ *  - digital channel `c` is on at unit `t` when (t + c + i) % 3 == 0, the pressure is (t + i) % 4 and the position
+ *    threshold (3 * t + i) % 4; as in the editor, the pressure channel follows the pressure and the position channel
+ *    stays off
+ */
+#define CONFIGURATION_V0_PATH "test/fixtures/configuration_v0.bin"
+#define PROGRAM_V0_TIME_UNITS 25
+
+
+static mut_model_t model;
+
+
+// The test links the storage alone, without the RAM sink behind esp_log
+int log_sink_printf(const char *format, ...) {
+    (void)format;
+    return 0;
+}
+
+
+int setup(void **state) {
+    (void)state;
+    return 0;
+}
+
+int teardown(void **state) {
+    (void)state;
+    return 0;
+}
+
+
+static void storage_load_v0_test(void **state) {
+    (void)state;
+    model_init(&model);
+
+    configuration_t *config = &model.config;
+    assert_int_equal(0, storage_load_configuration(CONFIGURATION_V0_PATH, config));
+
+    assert_int_equal(12, config->headgap_offset_up);
+    assert_int_equal(34, config->headgap_offset_down);
+    assert_int_equal(56, config->ma4_20_offset);
+    assert_int_equal(300, config->position_sensor_scale_mm);
+    assert_int_equal(MACHINE_MODEL_TRADITIONAL, config->machine_model);
+    assert_int_equal(MACHINE_MODE_NORMAL, config->machine_mode);
+
+    for (uint16_t c = 0; c < PROGRAM_NUM_CHANNELS; c++) {
+        char name[sizeof(name_t)] = {0};
+        snprintf(name, sizeof(name), "Canale %i", c + 1);
+        assert_string_equal(name, config->channel_names[c]);
+    }
+
+    for (uint16_t i = 0; i < NUM_PROGRAMS; i++) {
+        const program_t *program = &config->programs[i];
+
+        char name[PROGRAM_NAME_SIZE] = {0};
+        snprintf(name, sizeof(name), "Programma %i", i + 1);
+        assert_string_equal(name, program->name);
+        assert_int_equal(PROGRAM_V0_TIME_UNITS, program_get_num_time_units(program));
+        assert_int_equal(5 + i, program->time_unit_decisecs);
+
+        for (uint16_t j = 0; j < PROGRAM_PRESSURE_LEVELS; j++) {
+            assert_int_equal(100 * (j + 1) + i, program->pressure_levels[j]);
+        }
+        for (uint16_t j = 0; j < PROGRAM_SENSOR_LEVELS; j++) {
+            assert_int_equal(10 * (j + 1) + i, program->position_levels[j]);
+        }
+
+        for (uint16_t t = 0; t < PROGRAM_V0_TIME_UNITS; t++) {
+            uint8_t pressure = (t + i) % 4;
+            for (uint16_t c = 0; c < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; c++) {
+                uint8_t expected = 0;
+                if (c == PROGRAM_PRESSURE_CHANNEL_INDEX) {
+                    expected = pressure != 0;
+                } else if (c != PROGRAM_SENSOR_CHANNEL_INDEX) {
+                    expected = (t + c + i) % 3 == 0;
+                }
+                assert_int_equal(expected, program_get_digital_channel_state_at(program, c, t));
+            }
+            assert_int_equal(pressure, program_get_pressure_channel_state_at(program, t));
+            assert_int_equal((3 * t + i) % 4, program_get_sensor_channel_state_at(program, t));
+        }
+    }
+}
+
+
+static void storage_round_trip_test(void **state) {
+    (void)state;
+    model_init(&model);
+    assert_int_equal(0, storage_load_configuration(CONFIGURATION_V0_PATH, &model.config));
+
+    // Saving converts to the current version, which must read back the same
+    static configuration_t loaded;
+    char                   path[] = "/tmp/configuration_XXXXXX";
+    int                    fd     = mkstemp(path);
+    assert_true(fd >= 0);
+    close(fd);
+
+    assert_int_equal(0, storage_save_configuration(path, &model.config));
+    assert_int_equal(0, storage_load_configuration(path, &loaded));
+    unlink(path);
+
+    for (uint16_t i = 0; i < NUM_PROGRAMS; i++) {
+        const program_t *expected = &model.config.programs[i];
+        const program_t *actual   = &loaded.programs[i];
+
+        assert_string_equal(expected->name, actual->name);
+        assert_int_equal(program_get_num_time_units(expected), program_get_num_time_units(actual));
+        for (uint16_t t = 0; t < program_get_num_time_units(expected); t++) {
+            for (uint16_t c = 0; c < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; c++) {
+                assert_int_equal(program_get_digital_channel_state_at(expected, c, t),
+                                 program_get_digital_channel_state_at(actual, c, t));
+            }
+            assert_int_equal(program_get_pressure_channel_state_at(expected, t),
+                             program_get_pressure_channel_state_at(actual, t));
+            assert_int_equal(program_get_sensor_channel_state_at(expected, t),
+                             program_get_sensor_channel_state_at(actual, t));
+        }
+    }
+}
+
+
+/*
+ * The format holds programs longer than the RAM representation: program 0 of a saved configuration is replaced with
+ * a 40 units one, which must load cut to PROGRAM_MAX_TIME_UNITS without misaligning the programs that follow
+ */
+static void storage_load_long_program_test(void **state) {
+    (void)state;
+    // Version and parameters, then the channel names
+    const size_t   program_offset = 1 + 8 + PROGRAM_NUM_CHANNELS * PROGRAM_NAME_SIZE;
+    const size_t   old_size       = PROGRAM_NAME_SIZE + 4 + 12 + PROGRAM_NUM_PROGRAMMABLE_CHANNELS * 4 + 7 * 2;
+    const uint16_t units          = 40;
+
+    model_init(&model);
+    assert_int_equal(0, storage_load_configuration(CONFIGURATION_V0_PATH, &model.config));
+
+    char path[] = "/tmp/configuration_XXXXXX";
+    int  fd     = mkstemp(path);
+    assert_true(fd >= 0);
+    close(fd);
+    assert_int_equal(0, storage_save_configuration(path, &model.config));
+
+    static uint8_t original[1 << 16];
+    FILE          *fp   = fopen(path, "rb");
+    size_t         size = fread(original, 1, sizeof(original), fp);
+    fclose(fp);
+    assert_true(size > program_offset + old_size && size < sizeof(original));
+
+    static uint8_t program[1024];
+    size_t         index = 0;
+    memcpy(&program[index], "Lungo", 6);
+    index += PROGRAM_NAME_SIZE;
+    program[index++] = units >> 8;
+    program[index++] = units & 0xFF;
+    program[index++] = 0;
+    program[index++] = 10;
+    index += 12;     // Levels
+    for (uint16_t c = 0; c < PROGRAM_NUM_PROGRAMMABLE_CHANNELS; c++) {
+        // Units 0, 24, 30 and 35 of channel 0, big endian words
+        uint32_t words[2] = {c == 0 ? 0x41000001 : 0, c == 0 ? 0x00000008 : 0};
+        for (uint16_t w = 0; w < 2; w++) {
+            program[index++] = words[w] >> 24;
+            program[index++] = (words[w] >> 16) & 0xFF;
+            program[index++] = (words[w] >> 8) & 0xFF;
+            program[index++] = words[w] & 0xFF;
+        }
+    }
+    // Pressure high at units 24 and 30; no sensor thresholds
+    program[index + 6] = 0x03;
+    program[index + 7] = 0x30;
+    index += 2 * ((units + 3) / 4);
+
+    fp = fopen(path, "wb");
+    fwrite(original, 1, program_offset, fp);
+    fwrite(program, 1, index, fp);
+    fwrite(&original[program_offset + old_size], 1, size - program_offset - old_size, fp);
+    fclose(fp);
+
+    static configuration_t loaded;
+    assert_int_equal(0, storage_load_configuration(path, &loaded));
+    unlink(path);
+
+    const program_t *long_program = &loaded.programs[0];
+    assert_string_equal("Lungo", long_program->name);
+    assert_int_equal(PROGRAM_MAX_TIME_UNITS, program_get_num_time_units(long_program));
+    assert_int_equal(1, program_get_digital_channel_state_at(long_program, 0, 0));
+    assert_int_equal(1, program_get_digital_channel_state_at(long_program, 0, 24));
+    assert_int_equal(PROGRAM_PRESSURE_CHANNEL_STATE_HIGH, program_get_pressure_channel_state_at(long_program, 24));
+    // Nothing past the length survives, not even in the rounding of the buffers
+    assert_int_equal(0x01000001, long_program->digital_channels[0][0]);
+    for (size_t i = 0; i < PROGRAM_LEVEL_BYTES; i++) {
+        assert_int_equal(i == 6 ? 0x03 : 0, long_program->pressure_channel[i]);
+    }
+
+    for (uint16_t i = 1; i < NUM_PROGRAMS; i++) {
+        assert_string_equal(model.config.programs[i].name, loaded.programs[i].name);
+        assert_int_equal(model.config.programs[i].time_unit_decisecs, loaded.programs[i].time_unit_decisecs);
+    }
+    assert_int_equal(model.config.machine_model, loaded.machine_model);
+}
+
+
+int main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(storage_load_v0_test),
+        cmocka_unit_test(storage_round_trip_test),
+        cmocka_unit_test(storage_load_long_program_test),
+    };
+
+    int count_fail_tests = cmocka_run_group_tests(tests, setup, teardown);
+
+    return count_fail_tests;
+}